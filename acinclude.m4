@@ -17,9 +17,52 @@ AC_DEFUN([AX_LIBEVTX_CHECK_LOCAL],
       [1])
   ])
 
+  dnl Headers and functions used to memory map a file in libevtx/libevtx_file.c and evtxtools/resource_file.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([mmap munmap])
+
+  dnl Headers and functions used for positional reads and read-ahead advice in libevtx/libevtx_io_handle.c
+  AC_CHECK_HEADERS([errno.h])
+  AC_CHECK_FUNCS([madvise posix_fadvise pread])
+
+  dnl Headers used for io_uring asynchronous reads in libevtx/libevtx_async_reader.c
+  AC_CHECK_HEADERS([linux/io_uring.h sys/syscall.h sys/uio.h])
+
+  dnl Headers and functions used to time checksum calculations in libevtx/libevtx_statistics.c
+  AC_CHECK_HEADERS([time.h])
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Functions used to determine the number of processors for auto tuning in libevtx/libevtx_file.c
+  AC_CHECK_FUNCS([sysconf])
+
   dnl Check for internationalization functions in libevtx/libevtx_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 
+  dnl Check if the USDT static tracepoints in libevtx/libevtx_probes.h and evtxtools/evtxtools_probes.h should be enabled
+  AX_COMMON_ARG_ENABLE(
+    [probes],
+    [probes],
+    [enable USDT static tracepoints (probes)],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_probes" != xno],
+    [AC_CHECK_HEADERS([sys/sdt.h])
+
+    AS_IF(
+      [test "x$ac_cv_header_sys_sdt_h" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing header: sys/sdt.h],
+        [1])
+    ])
+
+    AC_DEFINE(
+      [HAVE_PROBES],
+      [1],
+      [Define to 1 if USDT static tracepoints (probes) should be used.])
+
+    ac_cv_enable_probes=yes])
+
   dnl Check if library should be build with verbose output
   AX_COMMON_CHECK_ENABLE_VERBOSE_OUTPUT
 
@@ -56,6 +99,11 @@ AC_DEFUN([AX_EVTXTOOLS_CHECK_LOCAL],
      [1])
   ])
 
+  dnl Headers and functions used in evtxtools/network_stream.c
+  AC_CHECK_HEADERS([netdb.h sys/socket.h sys/un.h])
+
+  AC_CHECK_FUNCS([getaddrinfo])
+
   dnl Headers included in evtxtools/log_handle.c
   AC_CHECK_HEADERS([stdarg.h varargs.h])
 
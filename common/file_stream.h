@@ -42,11 +42,13 @@ extern "C" {
 #if defined( WINAPI )
 #define FILE_STREAM_BINARY_OPEN_APPEND		"ab"
 #define FILE_STREAM_BINARY_OPEN_READ		"rb"
+#define FILE_STREAM_BINARY_OPEN_READ_WRITE	"r+b"
 #define FILE_STREAM_BINARY_OPEN_WRITE		"wb"
 
 #else
 #define FILE_STREAM_BINARY_OPEN_APPEND		"a"
 #define FILE_STREAM_BINARY_OPEN_READ		"r"
+#define FILE_STREAM_BINARY_OPEN_READ_WRITE	"r+"
 #define FILE_STREAM_BINARY_OPEN_WRITE		"w"
 
 #endif
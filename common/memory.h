@@ -40,9 +40,30 @@
 extern "C" {
 #endif
 
+#if defined( HAVE_LIBEVTX_ALLOCATOR )
+
+/* The memory of libevtx and of the local libraries it is built with
+ * is managed by the allocator set with libevtx_set_allocator
+ */
+void *libevtx_memory_allocate(
+       size_t size );
+
+void *libevtx_memory_reallocate(
+       void *buffer,
+       size_t size );
+
+void libevtx_memory_free(
+      void *buffer );
+
+#endif /* defined( HAVE_LIBEVTX_ALLOCATOR ) */
+
 /* Memory allocation
  */
-#if defined( HAVE_GLIB_H )
+#if defined( HAVE_LIBEVTX_ALLOCATOR )
+#define memory_allocate( size ) \
+	libevtx_memory_allocate( (size_t) size )
+
+#elif defined( HAVE_GLIB_H )
 #define memory_allocate( size ) \
 	g_malloc( (gsize) size )
 
@@ -63,7 +84,11 @@ extern "C" {
 
 /* Memory reallocation
  */
-#if defined( HAVE_GLIB_H )
+#if defined( HAVE_LIBEVTX_ALLOCATOR )
+#define memory_reallocate( buffer, size ) \
+	libevtx_memory_reallocate( (void *) buffer, (size_t) size )
+
+#elif defined( HAVE_GLIB_H )
 #define memory_reallocate( buffer, size ) \
 	g_realloc( (gpointer) buffer, (gsize) size )
 
@@ -82,7 +107,11 @@ extern "C" {
 
 /* Memory free
  */
-#if defined( HAVE_GLIB_H )
+#if defined( HAVE_LIBEVTX_ALLOCATOR )
+#define memory_free( buffer ) \
+	libevtx_memory_free( (void *) buffer )
+
+#elif defined( HAVE_GLIB_H )
 #define memory_free( buffer ) \
 	g_free( (gpointer) buffer )
 
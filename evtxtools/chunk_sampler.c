@@ -0,0 +1,333 @@
+/*
+ * Chunk sampler
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "chunk_sampler.h"
+#include "evtxtools_libcerror.h"
+
+/* Creates a chunk sampler
+ * Make sure the value chunk_sampler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_sampler_initialize(
+     chunk_sampler_t **chunk_sampler,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_sampler_initialize";
+
+	if( chunk_sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_sampler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk sampler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_sampler = memory_allocate_structure(
+	                  chunk_sampler_t );
+
+	if( *chunk_sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *chunk_sampler,
+	     0,
+	     sizeof( chunk_sampler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk sampler.",
+		 function );
+
+		memory_free(
+		 *chunk_sampler );
+
+		*chunk_sampler = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a chunk sampler
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_sampler_free(
+     chunk_sampler_t **chunk_sampler,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_sampler_free";
+
+	if( chunk_sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_sampler != NULL )
+	{
+		if( ( *chunk_sampler )->chunk_indexes != NULL )
+		{
+			memory_free(
+			 ( *chunk_sampler )->chunk_indexes );
+		}
+		memory_free(
+		 *chunk_sampler );
+
+		*chunk_sampler = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the sample
+ * The string contains a number of chunks, such as 64, or a percentage
+ * of the chunks followed by a percent sign, such as 5%
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int chunk_sampler_set_sample(
+     chunk_sampler_t *chunk_sampler,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_sampler_set_sample";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int is_percentage     = 0;
+	int value             = 0;
+
+	if( chunk_sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length > 0 )
+	 && ( string[ string_length - 1 ] == (system_character_t) '%' ) )
+	{
+		is_percentage  = 1;
+		string_length -= 1;
+	}
+	/* The number of chunks of a file is at most 65535
+	 */
+	if( ( string_length == 0 )
+	 || ( string_length > 5 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( value == 0 )
+	{
+		return( 0 );
+	}
+	if( is_percentage != 0 )
+	{
+		if( value > 100 )
+		{
+			return( 0 );
+		}
+		chunk_sampler->requested_number_of_chunks = 0;
+		chunk_sampler->percentage                 = value;
+	}
+	else
+	{
+		if( value > (int) UINT16_MAX )
+		{
+			return( 0 );
+		}
+		chunk_sampler->requested_number_of_chunks = value;
+		chunk_sampler->percentage                 = 0;
+	}
+	return( 1 );
+}
+
+/* Selects the chunks of the sample from the chunks of a file
+ * All chunks are selected if the sample is at least the number of chunks
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_sampler_select_chunks(
+     chunk_sampler_t *chunk_sampler,
+     uint16_t number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function        = "chunk_sampler_select_chunks";
+	uint32_t random_value        = CHUNK_SAMPLER_SEED;
+	int first_stratum_chunk      = 0;
+	int number_of_sampled_chunks = 0;
+	int number_of_stratum_chunks = 0;
+	int sample_index             = 0;
+
+	if( chunk_sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_sampler->requested_number_of_chunks > 0 )
+	{
+		number_of_sampled_chunks = chunk_sampler->requested_number_of_chunks;
+	}
+	else
+	{
+		/* Round up so that a sample of a small file contains at least 1 chunk
+		 */
+		number_of_sampled_chunks = ( ( (int) number_of_chunks * chunk_sampler->percentage ) + 99 ) / 100;
+	}
+	if( number_of_sampled_chunks > (int) number_of_chunks )
+	{
+		number_of_sampled_chunks = (int) number_of_chunks;
+	}
+	if( chunk_sampler->chunk_indexes != NULL )
+	{
+		memory_free(
+		 chunk_sampler->chunk_indexes );
+
+		chunk_sampler->chunk_indexes = NULL;
+	}
+	chunk_sampler->number_of_sampled_chunks  = 0;
+	chunk_sampler->number_of_chunks          = (int) number_of_chunks;
+	chunk_sampler->number_of_sampled_records = 0;
+
+	if( number_of_sampled_chunks == 0 )
+	{
+		return( 1 );
+	}
+	chunk_sampler->chunk_indexes = (uint16_t *) memory_allocate(
+	                                             sizeof( uint16_t ) * number_of_sampled_chunks );
+
+	if( chunk_sampler->chunk_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk indexes.",
+		 function );
+
+		return( -1 );
+	}
+	for( sample_index = 0;
+	     sample_index < number_of_sampled_chunks;
+	     sample_index++ )
+	{
+		/* The stratum of the sample consists of the chunks [first, first + number)
+		 */
+		first_stratum_chunk      = (int) ( ( (int64_t) sample_index * number_of_chunks ) / number_of_sampled_chunks );
+		number_of_stratum_chunks = (int) ( ( ( (int64_t) sample_index + 1 ) * number_of_chunks ) / number_of_sampled_chunks ) - first_stratum_chunk;
+
+		/* Use a xorshift pseudo random number generator
+		 */
+		random_value ^= random_value << 13;
+		random_value ^= random_value >> 17;
+		random_value ^= random_value << 5;
+
+		chunk_sampler->chunk_indexes[ sample_index ] = (uint16_t) ( first_stratum_chunk + (int) ( random_value % (uint32_t) number_of_stratum_chunks ) );
+	}
+	chunk_sampler->number_of_sampled_chunks = number_of_sampled_chunks;
+
+	return( 1 );
+}
+
+/* Scales a count of the sampled chunks to an estimate of the count of all chunks
+ * Returns the estimated count
+ */
+uint64_t chunk_sampler_scale_count(
+          chunk_sampler_t *chunk_sampler,
+          uint64_t count )
+{
+	if( ( chunk_sampler == NULL )
+	 || ( chunk_sampler->number_of_sampled_chunks == 0 ) )
+	{
+		return( count );
+	}
+	/* Round to the nearest value
+	 */
+	return( ( ( count * (uint64_t) chunk_sampler->number_of_chunks ) + ( (uint64_t) chunk_sampler->number_of_sampled_chunks / 2 ) )
+	        / (uint64_t) chunk_sampler->number_of_sampled_chunks );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * Chunk sampler
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _CHUNK_SAMPLER_H )
+#define _CHUNK_SAMPLER_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The seed of the random selection of the chunks
+ * A fixed seed makes the sample of a file reproducible
+ */
+#define CHUNK_SAMPLER_SEED	0x9e3779b9UL
+
+typedef struct chunk_sampler chunk_sampler_t;
+
+/* The chunk sampler selects a stratified random sample of the chunks of a file
+ * The chunks are divided into strata of consecutive chunks of equal size
+ * and a random chunk is selected from every stratum, which spreads
+ * the sample over the time range of the file
+ */
+struct chunk_sampler
+{
+	/* The requested number of chunks
+	 * Contains 0 if a percentage is requested
+	 */
+	int requested_number_of_chunks;
+
+	/* The requested percentage of the chunks
+	 */
+	int percentage;
+
+	/* The indexes of the sampled chunks in ascending order
+	 */
+	uint16_t *chunk_indexes;
+
+	/* The number of sampled chunks
+	 */
+	int number_of_sampled_chunks;
+
+	/* The number of chunks of the file
+	 */
+	int number_of_chunks;
+
+	/* The number of records of the sampled chunks
+	 */
+	uint64_t number_of_sampled_records;
+};
+
+int chunk_sampler_initialize(
+     chunk_sampler_t **chunk_sampler,
+     libcerror_error_t **error );
+
+int chunk_sampler_free(
+     chunk_sampler_t **chunk_sampler,
+     libcerror_error_t **error );
+
+int chunk_sampler_set_sample(
+     chunk_sampler_t *chunk_sampler,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int chunk_sampler_select_chunks(
+     chunk_sampler_t *chunk_sampler,
+     uint16_t number_of_chunks,
+     libcerror_error_t **error );
+
+uint64_t chunk_sampler_scale_count(
+          chunk_sampler_t *chunk_sampler,
+          uint64_t count );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHUNK_SAMPLER_H ) */
+
@@ -0,0 +1,2396 @@
+/*
+ * Compressed file IO handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+#include <zstd.h>
+#endif
+
+#include "compressed_file_io_handle.h"
+#include "evtxtools_libbfio.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_unused.h"
+
+/* Creates a compressed file IO handle
+ * Make sure the value compressed_file_io_handle is referencing, is set to NULL
+ * The source file IO handle is managed by the compressed file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_initialize(
+     compressed_file_io_handle_t **compressed_file_io_handle,
+     libbfio_handle_t *source_file_io_handle,
+     uint8_t compression_method,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_initialize";
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_method )
+	{
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+		case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_GZIP:
+			break;
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+		case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD:
+		case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE:
+			break;
+#endif
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression method.",
+			 function );
+
+			return( -1 );
+	}
+	*compressed_file_io_handle = memory_allocate_structure(
+	                              compressed_file_io_handle_t );
+
+	if( *compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressed_file_io_handle,
+	     0,
+	     sizeof( compressed_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressed file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressed_file_io_handle )->source_file_io_handle = source_file_io_handle;
+	( *compressed_file_io_handle )->compression_method    = compression_method;
+	( *compressed_file_io_handle )->frame_index           = -1;
+
+	return( 1 );
+
+on_error:
+	if( *compressed_file_io_handle != NULL )
+	{
+		memory_free(
+		 *compressed_file_io_handle );
+
+		*compressed_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a file IO handle that reads the uncompressed data of a compressed file
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful, 0 if the file is not compressed or -1 on error
+ */
+int compressed_file_initialize(
+     libbfio_handle_t **handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	compressed_file_io_handle_t *compressed_file_io_handle = NULL;
+	libbfio_handle_t *source_file_io_handle                = NULL;
+	static char *function                                  = "compressed_file_initialize";
+	size_t filename_length                                 = 0;
+	uint8_t compression_method                             = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &source_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     source_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     source_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in source file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     source_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( compressed_file_io_handle_determine_compression_method(
+	     source_file_io_handle,
+	     &compression_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine compression method.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compressed file IO handle opens the source file IO handle itself
+	 */
+	if( libbfio_handle_close(
+	     source_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( compression_method == COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_NONE )
+	{
+		if( libbfio_handle_free(
+		     &source_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( compressed_file_io_handle_initialize(
+	     &compressed_file_io_handle,
+	     source_file_io_handle,
+	     compression_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The source file IO handle is now managed by the compressed file IO handle
+	 */
+	source_file_io_handle = NULL;
+
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) compressed_file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) compressed_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) compressed_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) compressed_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) compressed_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) compressed_file_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) compressed_file_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) compressed_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) compressed_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) compressed_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) compressed_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_file_io_handle != NULL )
+	{
+		compressed_file_io_handle_free(
+		 &compressed_file_io_handle,
+		 NULL );
+	}
+	if( source_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &source_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a compressed file IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int compressed_file_io_handle_free(
+     compressed_file_io_handle_t **compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_free";
+	int result            = 1;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_file_io_handle != NULL )
+	{
+		if( ( *compressed_file_io_handle )->is_open != 0 )
+		{
+			if( compressed_file_io_handle_close(
+			     *compressed_file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close compressed file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libbfio_handle_free(
+		     &( ( *compressed_file_io_handle )->source_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *compressed_file_io_handle );
+
+		*compressed_file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the compressed file IO handle and its attributes
+ * The clone has its own source file IO handle and decompression state
+ * Returns 1 if succesful or -1 on error
+ */
+int compressed_file_io_handle_clone(
+     compressed_file_io_handle_t **destination_compressed_file_io_handle,
+     compressed_file_io_handle_t *source_compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *source_file_io_handle = NULL;
+	static char *function                   = "compressed_file_io_handle_clone";
+
+	if( destination_compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_compressed_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination compressed file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_compressed_file_io_handle == NULL )
+	{
+		*destination_compressed_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_handle_clone(
+	     &source_file_io_handle,
+	     source_compressed_file_io_handle->source_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone source file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The clone is opened by the caller
+	 */
+	if( libbfio_handle_is_open(
+	     source_file_io_handle,
+	     NULL ) == 1 )
+	{
+		if( libbfio_handle_close(
+		     source_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( compressed_file_io_handle_initialize(
+	     destination_compressed_file_io_handle,
+	     source_file_io_handle,
+	     source_compressed_file_io_handle->compression_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination compressed file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_compressed_file_io_handle )->uncompressed_size = source_compressed_file_io_handle->uncompressed_size;
+
+	return( 1 );
+
+on_error:
+	if( source_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &source_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the compression method from the signature of the data
+ * The file IO handle must be open
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_determine_compression_method(
+     libbfio_handle_t *file_io_handle,
+     uint8_t *compression_method,
+     libcerror_error_t **error )
+{
+	uint8_t footer_data[ 9 ];
+	uint8_t signature[ 4 ];
+
+	static char *function = "compressed_file_io_handle_determine_compression_method";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+	uint32_t magic_number = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_method == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression method.",
+		 function );
+
+		return( -1 );
+	}
+	*compression_method = COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_NONE;
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size < 18 )
+	{
+		return( 1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek signature offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              signature,
+	              4,
+	              error );
+
+	if( read_count != (ssize_t) 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature[ 0 ] == 0x1f )
+	 && ( signature[ 1 ] == 0x8b ) )
+	{
+		*compression_method = COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_GZIP;
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 signature,
+	 magic_number );
+
+	/* A zstd file starts with a frame or a skippable frame
+	 */
+	if( ( magic_number != 0xfd2fb528UL )
+	 && ( ( magic_number & 0xfffffff0UL ) != 0x184d2a50UL ) )
+	{
+		return( 1 );
+	}
+	*compression_method = COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD;
+
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     (off64_t) ( file_size - 9 ),
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek seek table footer offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              footer_data,
+	              9,
+	              error );
+
+	if( read_count != (ssize_t) 9 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read seek table footer.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( footer_data[ 5 ] ),
+	 magic_number );
+
+	if( magic_number == COMPRESSED_FILE_IO_HANDLE_ZSTD_SEEKABLE_MAGIC_NUMBER )
+	{
+		*compression_method = COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE;
+	}
+	return( 1 );
+}
+
+/* Opens the compressed file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_open(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_open";
+	ssize_t read_count    = 0;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     compressed_file_io_handle->source_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Mark the handle open so that close releases what was allocated
+	 */
+	compressed_file_io_handle->is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     compressed_file_io_handle->source_file_io_handle,
+	     &( compressed_file_io_handle->compressed_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed size.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_file_io_handle->input_data = (uint8_t *) memory_allocate(
+	                                                     sizeof( uint8_t ) * COMPRESSED_FILE_IO_HANDLE_INPUT_BUFFER_SIZE );
+
+	if( compressed_file_io_handle->input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input data.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_file_io_handle->skip_data = (uint8_t *) memory_allocate(
+	                                                    sizeof( uint8_t ) * COMPRESSED_FILE_IO_HANDLE_INPUT_BUFFER_SIZE );
+
+	if( compressed_file_io_handle->skip_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create skip data.",
+		 function );
+
+		goto on_error;
+	}
+	switch( compressed_file_io_handle->compression_method )
+	{
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+		case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_GZIP:
+			/* A window bits value of 15 + 16 only decodes the gzip format
+			 */
+			if( inflateInit2(
+			     &( compressed_file_io_handle->zlib_stream ),
+			     15 + 16 ) != Z_OK )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize zlib stream.",
+				 function );
+
+				goto on_error;
+			}
+			compressed_file_io_handle->zlib_stream_initialized = 1;
+
+			break;
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+		case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD:
+			compressed_file_io_handle->zstd_stream = ZSTD_createDStream();
+
+			if( compressed_file_io_handle->zstd_stream == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create zstd stream.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE:
+			if( compressed_file_io_handle_read_seek_table(
+			     compressed_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read seek table.",
+				 function );
+
+				goto on_error;
+			}
+			compressed_file_io_handle->uncompressed_size = (size64_t) compressed_file_io_handle->frame_uncompressed_offsets[ compressed_file_io_handle->number_of_frames ];
+
+			break;
+#endif
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression method.",
+			 function );
+
+			goto on_error;
+	}
+	/* The gzip trailer only contains the size modulo 2^32 of the last member
+	 * and a zstd frame does not necessarily store its content size, hence
+	 * the uncompressed size of a stream is determined by decompressing it once,
+	 * clones inherit the uncompressed size
+	 */
+	if( ( compressed_file_io_handle->compression_method != COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE )
+	 && ( compressed_file_io_handle->uncompressed_size == 0 ) )
+	{
+		if( compressed_file_io_handle_rewind(
+		     compressed_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind stream.",
+			 function );
+
+			goto on_error;
+		}
+		do
+		{
+			read_count = compressed_file_io_handle_decompress_stream(
+			              compressed_file_io_handle,
+			              compressed_file_io_handle->skip_data,
+			              COMPRESSED_FILE_IO_HANDLE_INPUT_BUFFER_SIZE,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to decompress stream.",
+				 function );
+
+				goto on_error;
+			}
+			compressed_file_io_handle->uncompressed_size += (size64_t) read_count;
+		}
+		while( read_count > 0 );
+	}
+	if( compressed_file_io_handle->compression_method != COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE )
+	{
+		if( compressed_file_io_handle_rewind(
+		     compressed_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	compressed_file_io_handle->current_offset = 0;
+
+	return( 1 );
+
+on_error:
+	compressed_file_io_handle_close(
+	 compressed_file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the compressed file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int compressed_file_io_handle_close(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_close";
+	int result            = 0;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	if( compressed_file_io_handle->zlib_stream_initialized != 0 )
+	{
+		inflateEnd(
+		 &( compressed_file_io_handle->zlib_stream ) );
+
+		compressed_file_io_handle->zlib_stream_initialized = 0;
+	}
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	if( compressed_file_io_handle->zstd_stream != NULL )
+	{
+		ZSTD_freeDStream(
+		 compressed_file_io_handle->zstd_stream );
+
+		compressed_file_io_handle->zstd_stream = NULL;
+	}
+#endif
+	if( compressed_file_io_handle->frame_data != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->frame_data );
+
+		compressed_file_io_handle->frame_data = NULL;
+	}
+	if( compressed_file_io_handle->frame_compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->frame_compressed_data );
+
+		compressed_file_io_handle->frame_compressed_data = NULL;
+	}
+	if( compressed_file_io_handle->frame_uncompressed_offsets != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->frame_uncompressed_offsets );
+
+		compressed_file_io_handle->frame_uncompressed_offsets = NULL;
+	}
+	if( compressed_file_io_handle->frame_compressed_offsets != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->frame_compressed_offsets );
+
+		compressed_file_io_handle->frame_compressed_offsets = NULL;
+	}
+	if( compressed_file_io_handle->skip_data != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->skip_data );
+
+		compressed_file_io_handle->skip_data = NULL;
+	}
+	if( compressed_file_io_handle->input_data != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->input_data );
+
+		compressed_file_io_handle->input_data = NULL;
+	}
+	if( libbfio_handle_close(
+	     compressed_file_io_handle->source_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	compressed_file_io_handle->number_of_frames              = 0;
+	compressed_file_io_handle->maximum_frame_compressed_size = 0;
+	compressed_file_io_handle->maximum_frame_size            = 0;
+	compressed_file_io_handle->frame_index                   = -1;
+	compressed_file_io_handle->compressed_size               = 0;
+	compressed_file_io_handle->is_open                       = 0;
+
+	return( result );
+}
+
+/* Reads data of the source file IO handle at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_read_source_data(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_read_source_data";
+	ssize_t read_count    = 0;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     compressed_file_io_handle->source_file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              compressed_file_io_handle->source_file_io_handle,
+	              data,
+	              data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the seek table of the zstd seekable format
+ * The seek table is stored in a skippable frame at the end of the file
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_read_seek_table(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t footer_data[ 9 ];
+	uint8_t header_data[ 8 ];
+
+	uint8_t *seek_table_data     = NULL;
+	static char *function        = "compressed_file_io_handle_read_seek_table";
+	size64_t seek_table_size     = 0;
+	size_t entry_size            = 0;
+	size_t seek_table_data_size  = 0;
+	size_t seek_table_offset     = 0;
+	off64_t compressed_offset    = 0;
+	off64_t uncompressed_offset  = 0;
+	uint32_t compressed_size     = 0;
+	uint32_t frame_index         = 0;
+	uint32_t magic_number        = 0;
+	uint32_t number_of_frames    = 0;
+	uint32_t uncompressed_size   = 0;
+	uint32_t value_32bit         = 0;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->frame_compressed_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed file IO handle - frame compressed offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->compressed_size < 17 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed file IO handle - compressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle_read_source_data(
+	     compressed_file_io_handle,
+	     (off64_t) ( compressed_file_io_handle->compressed_size - 9 ),
+	     footer_data,
+	     9,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read seek table footer.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( footer_data[ 0 ] ),
+	 number_of_frames );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( footer_data[ 5 ] ),
+	 magic_number );
+
+	if( magic_number != COMPRESSED_FILE_IO_HANDLE_ZSTD_SEEKABLE_MAGIC_NUMBER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported seekable magic number: 0x%08" PRIx32 ".",
+		 function,
+		 magic_number );
+
+		goto on_error;
+	}
+	/* Bits 2 - 6 of the seek table descriptor are reserved
+	 */
+	if( ( footer_data[ 4 ] & 0x7c ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported seek table descriptor: 0x%02" PRIx8 ".",
+		 function,
+		 footer_data[ 4 ] );
+
+		goto on_error;
+	}
+	entry_size = 8;
+
+	if( ( footer_data[ 4 ] & 0x80 ) != 0 )
+	{
+		entry_size += 4;
+	}
+	if( ( number_of_frames == 0 )
+	 || ( number_of_frames > (uint32_t) ( INT_MAX - 1 ) )
+	 || ( (size_t) number_of_frames > ( ( COMPRESSED_FILE_IO_HANDLE_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of frames value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	seek_table_size = ( (size64_t) number_of_frames * entry_size ) + 17;
+
+	if( seek_table_size > compressed_file_io_handle->compressed_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid seek table size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( compressed_file_io_handle_read_source_data(
+	     compressed_file_io_handle,
+	     (off64_t) ( compressed_file_io_handle->compressed_size - seek_table_size ),
+	     header_data,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read seek table skippable frame header.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 0 ] ),
+	 magic_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 4 ] ),
+	 value_32bit );
+
+	if( ( magic_number != COMPRESSED_FILE_IO_HANDLE_ZSTD_SEEK_TABLE_MAGIC_NUMBER )
+	 || ( (size64_t) value_32bit != ( seek_table_size - 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported seek table skippable frame header.",
+		 function );
+
+		goto on_error;
+	}
+	seek_table_data_size = (size_t) number_of_frames * entry_size;
+
+	if( seek_table_data_size > (size_t) COMPRESSED_FILE_IO_HANDLE_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid seek table data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	seek_table_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * seek_table_data_size );
+
+	if( seek_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create seek table data.",
+		 function );
+
+		goto on_error;
+	}
+	if( compressed_file_io_handle_read_source_data(
+	     compressed_file_io_handle,
+	     (off64_t) ( compressed_file_io_handle->compressed_size - seek_table_size + 8 ),
+	     seek_table_data,
+	     seek_table_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read seek table entries.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_file_io_handle->frame_compressed_offsets = (off64_t *) memory_allocate(
+	                                                                   sizeof( off64_t ) * ( number_of_frames + 1 ) );
+
+	if( compressed_file_io_handle->frame_compressed_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create frame compressed offsets.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_file_io_handle->frame_uncompressed_offsets = (off64_t *) memory_allocate(
+	                                                                     sizeof( off64_t ) * ( number_of_frames + 1 ) );
+
+	if( compressed_file_io_handle->frame_uncompressed_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create frame uncompressed offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( frame_index = 0;
+	     frame_index < number_of_frames;
+	     frame_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( seek_table_data[ seek_table_offset ] ),
+		 compressed_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( seek_table_data[ seek_table_offset + 4 ] ),
+		 uncompressed_size );
+
+		seek_table_offset += entry_size;
+
+		compressed_file_io_handle->frame_compressed_offsets[ frame_index ]   = compressed_offset;
+		compressed_file_io_handle->frame_uncompressed_offsets[ frame_index ] = uncompressed_offset;
+
+		if( (size_t) compressed_size > compressed_file_io_handle->maximum_frame_compressed_size )
+		{
+			compressed_file_io_handle->maximum_frame_compressed_size = (size_t) compressed_size;
+		}
+		if( (size_t) uncompressed_size > compressed_file_io_handle->maximum_frame_size )
+		{
+			compressed_file_io_handle->maximum_frame_size = (size_t) uncompressed_size;
+		}
+		compressed_offset   += (off64_t) compressed_size;
+		uncompressed_offset += (off64_t) uncompressed_size;
+	}
+	compressed_file_io_handle->frame_compressed_offsets[ number_of_frames ]   = compressed_offset;
+	compressed_file_io_handle->frame_uncompressed_offsets[ number_of_frames ] = uncompressed_offset;
+
+	/* The frames are stored directly in front of the seek table
+	 */
+	if( (size64_t) compressed_offset != ( compressed_file_io_handle->compressed_size - seek_table_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid frame compressed sizes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( compressed_file_io_handle->maximum_frame_compressed_size > (size_t) COMPRESSED_FILE_IO_HANDLE_MAXIMUM_ALLOCATION_SIZE )
+	 || ( compressed_file_io_handle->maximum_frame_size > (size_t) COMPRESSED_FILE_IO_HANDLE_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum frame size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_file_io_handle->number_of_frames = number_of_frames;
+
+	memory_free(
+	 seek_table_data );
+
+	return( 1 );
+
+on_error:
+	if( compressed_file_io_handle->frame_uncompressed_offsets != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->frame_uncompressed_offsets );
+
+		compressed_file_io_handle->frame_uncompressed_offsets = NULL;
+	}
+	if( compressed_file_io_handle->frame_compressed_offsets != NULL )
+	{
+		memory_free(
+		 compressed_file_io_handle->frame_compressed_offsets );
+
+		compressed_file_io_handle->frame_compressed_offsets = NULL;
+	}
+	if( seek_table_data != NULL )
+	{
+		memory_free(
+		 seek_table_data );
+	}
+	compressed_file_io_handle->maximum_frame_compressed_size = 0;
+	compressed_file_io_handle->maximum_frame_size            = 0;
+
+	return( -1 );
+}
+
+/* Rewinds the decompressed stream to the start of the compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_rewind(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_rewind";
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     compressed_file_io_handle->source_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of compressed data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	if( compressed_file_io_handle->zlib_stream_initialized != 0 )
+	{
+		if( inflateReset(
+		     &( compressed_file_io_handle->zlib_stream ) ) != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset zlib stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	if( compressed_file_io_handle->zstd_stream != NULL )
+	{
+		if( ZSTD_isError(
+		     ZSTD_initDStream(
+		      compressed_file_io_handle->zstd_stream ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset zstd stream.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_file_io_handle->zstd_frame_is_complete = 1;
+	}
+#endif
+	compressed_file_io_handle->input_data_size   = 0;
+	compressed_file_io_handle->input_data_offset = 0;
+	compressed_file_io_handle->stream_offset     = 0;
+	compressed_file_io_handle->end_of_input      = 0;
+	compressed_file_io_handle->end_of_stream     = 0;
+
+	return( 1 );
+}
+
+/* Reads the next compressed input data of the stream
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_read_input_data(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_read_input_data";
+	ssize_t read_count    = 0;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              compressed_file_io_handle->source_file_io_handle,
+	              compressed_file_io_handle->input_data,
+	              COMPRESSED_FILE_IO_HANDLE_INPUT_BUFFER_SIZE,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_file_io_handle->input_data_size   = (size_t) read_count;
+	compressed_file_io_handle->input_data_offset = 0;
+
+	if( read_count == 0 )
+	{
+		compressed_file_io_handle->end_of_input = 1;
+	}
+	return( 1 );
+}
+
+/* Decompresses the next data of the stream
+ * Returns the number of bytes decompressed, 0 at the end of the stream or -1 on error
+ */
+ssize_t compressed_file_io_handle_decompress_stream(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "compressed_file_io_handle_decompress_stream";
+	size_t data_offset        = 0;
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	int zlib_result           = 0;
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	ZSTD_inBuffer zstd_input;
+	ZSTD_outBuffer zstd_output;
+
+	size_t zstd_result        = 0;
+#endif
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( data_offset < data_size )
+	    && ( compressed_file_io_handle->end_of_stream == 0 ) )
+	{
+		if( ( compressed_file_io_handle->input_data_offset >= compressed_file_io_handle->input_data_size )
+		 && ( compressed_file_io_handle->end_of_input == 0 ) )
+		{
+			if( compressed_file_io_handle_read_input_data(
+			     compressed_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read input data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		switch( compressed_file_io_handle->compression_method )
+		{
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+			case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_GZIP:
+				compressed_file_io_handle->zlib_stream.next_in   = (Bytef *) &( compressed_file_io_handle->input_data[ compressed_file_io_handle->input_data_offset ] );
+				compressed_file_io_handle->zlib_stream.avail_in  = (uInt) ( compressed_file_io_handle->input_data_size - compressed_file_io_handle->input_data_offset );
+				compressed_file_io_handle->zlib_stream.next_out  = (Bytef *) &( data[ data_offset ] );
+				compressed_file_io_handle->zlib_stream.avail_out = (uInt) ( data_size - data_offset );
+
+				zlib_result = inflate(
+				               &( compressed_file_io_handle->zlib_stream ),
+				               Z_NO_FLUSH );
+
+				data_offset = data_size - (size_t) compressed_file_io_handle->zlib_stream.avail_out;
+
+				compressed_file_io_handle->input_data_offset = compressed_file_io_handle->input_data_size - (size_t) compressed_file_io_handle->zlib_stream.avail_in;
+
+				if( zlib_result == Z_STREAM_END )
+				{
+					if( ( compressed_file_io_handle->input_data_offset >= compressed_file_io_handle->input_data_size )
+					 && ( compressed_file_io_handle->end_of_input == 0 ) )
+					{
+						if( compressed_file_io_handle_read_input_data(
+						     compressed_file_io_handle,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_READ_FAILED,
+							 "%s: unable to read input data.",
+							 function );
+
+							return( -1 );
+						}
+					}
+					/* Another member can follow, trailing data that is not
+					 * a gzip member, such as padding, is ignored
+					 */
+					if( ( compressed_file_io_handle->input_data_offset < compressed_file_io_handle->input_data_size )
+					 && ( compressed_file_io_handle->input_data[ compressed_file_io_handle->input_data_offset ] == 0x1f ) )
+					{
+						if( inflateReset(
+						     &( compressed_file_io_handle->zlib_stream ) ) != Z_OK )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+							 "%s: unable to reset zlib stream.",
+							 function );
+
+							return( -1 );
+						}
+					}
+					else
+					{
+						compressed_file_io_handle->end_of_stream = 1;
+					}
+				}
+				else if( ( zlib_result == Z_BUF_ERROR )
+				      && ( compressed_file_io_handle->end_of_input != 0 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: truncated gzip stream.",
+					 function );
+
+					return( -1 );
+				}
+				else if( ( zlib_result != Z_OK )
+				      && ( zlib_result != Z_BUF_ERROR ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decompress gzip data with error: %d.",
+					 function,
+					 zlib_result );
+
+					return( -1 );
+				}
+				break;
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+			case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD:
+			case COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE:
+				if( ( compressed_file_io_handle->input_data_offset >= compressed_file_io_handle->input_data_size )
+				 && ( compressed_file_io_handle->end_of_input != 0 )
+				 && ( compressed_file_io_handle->zstd_frame_is_complete != 0 ) )
+				{
+					compressed_file_io_handle->end_of_stream = 1;
+
+					break;
+				}
+				zstd_input.src   = compressed_file_io_handle->input_data;
+				zstd_input.size  = compressed_file_io_handle->input_data_size;
+				zstd_input.pos   = compressed_file_io_handle->input_data_offset;
+				zstd_output.dst  = data;
+				zstd_output.size = data_size;
+				zstd_output.pos  = data_offset;
+
+				/* Consecutive frames and skippable frames, such as the seek table,
+				 * are handled by the zstd stream
+				 */
+				zstd_result = ZSTD_decompressStream(
+				               compressed_file_io_handle->zstd_stream,
+				               &zstd_output,
+				               &zstd_input );
+
+				if( ZSTD_isError( zstd_result ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decompress zstd data with error: %s.",
+					 function,
+					 ZSTD_getErrorName( zstd_result ) );
+
+					return( -1 );
+				}
+				/* Without input data the stream can only flush buffered output
+				 */
+				if( ( zstd_input.pos >= zstd_input.size )
+				 && ( compressed_file_io_handle->end_of_input != 0 )
+				 && ( zstd_result != 0 )
+				 && ( zstd_output.pos == data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: truncated zstd stream.",
+					 function );
+
+					return( -1 );
+				}
+				data_offset = zstd_output.pos;
+
+				compressed_file_io_handle->input_data_offset      = zstd_input.pos;
+				compressed_file_io_handle->zstd_frame_is_complete = (uint8_t) ( zstd_result == 0 );
+
+				break;
+#endif
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported compression method.",
+				 function );
+
+				return( -1 );
+		}
+	}
+	compressed_file_io_handle->stream_offset += (off64_t) data_offset;
+
+	return( (ssize_t) data_offset );
+}
+
+/* Reads and decompresses a frame of the zstd seekable format
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_read_frame(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     int frame_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "compressed_file_io_handle_read_frame";
+	size_t compressed_size  = 0;
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	size_t frame_size       = 0;
+	size_t zstd_result      = 0;
+#endif
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( frame_index < 0 )
+	 || ( (uint32_t) frame_index >= compressed_file_io_handle->number_of_frames ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid frame index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame_index == compressed_file_io_handle->frame_index )
+	{
+		return( 1 );
+	}
+	if( compressed_file_io_handle->frame_compressed_data == NULL )
+	{
+		compressed_file_io_handle->frame_compressed_data = (uint8_t *) memory_allocate(
+		                                                                sizeof( uint8_t ) * ( compressed_file_io_handle->maximum_frame_compressed_size + 1 ) );
+
+		if( compressed_file_io_handle->frame_compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create frame compressed data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( compressed_file_io_handle->frame_data == NULL )
+	{
+		compressed_file_io_handle->frame_data = (uint8_t *) memory_allocate(
+		                                                     sizeof( uint8_t ) * ( compressed_file_io_handle->maximum_frame_size + 1 ) );
+
+		if( compressed_file_io_handle->frame_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create frame data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	compressed_size = (size_t) ( compressed_file_io_handle->frame_compressed_offsets[ frame_index + 1 ] - compressed_file_io_handle->frame_compressed_offsets[ frame_index ] );
+
+	/* The frame is being replaced hence it is no longer valid
+	 */
+	compressed_file_io_handle->frame_index = -1;
+
+	if( compressed_file_io_handle_read_source_data(
+	     compressed_file_io_handle,
+	     compressed_file_io_handle->frame_compressed_offsets[ frame_index ],
+	     compressed_file_io_handle->frame_compressed_data,
+	     compressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data of frame: %d.",
+		 function,
+		 frame_index );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	frame_size = (size_t) ( compressed_file_io_handle->frame_uncompressed_offsets[ frame_index + 1 ] - compressed_file_io_handle->frame_uncompressed_offsets[ frame_index ] );
+
+	zstd_result = ZSTD_decompress(
+	               compressed_file_io_handle->frame_data,
+	               frame_size,
+	               compressed_file_io_handle->frame_compressed_data,
+	               compressed_size );
+
+	if( ZSTD_isError( zstd_result ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress frame: %d with error: %s.",
+		 function,
+		 frame_index,
+		 ZSTD_getErrorName( zstd_result ) );
+
+		return( -1 );
+	}
+	if( zstd_result != frame_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in uncompressed size of frame: %d.",
+		 function,
+		 frame_index );
+
+		return( -1 );
+	}
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported compression method.",
+	 function );
+
+	return( -1 );
+#endif
+	compressed_file_io_handle->frame_index = frame_index;
+
+	return( 1 );
+}
+
+/* Reads a buffer from the compressed file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t compressed_file_io_handle_read(
+         compressed_file_io_handle_t *compressed_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function  = "compressed_file_io_handle_read";
+	size_t buffer_offset   = 0;
+	size_t frame_offset    = 0;
+	size_t read_size       = 0;
+	size_t skip_size       = 0;
+	ssize_t read_count     = 0;
+	int frame_index        = 0;
+	int maximum_index      = 0;
+	int minimum_index      = 0;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) compressed_file_io_handle->current_offset >= compressed_file_io_handle->uncompressed_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( compressed_file_io_handle->uncompressed_size - compressed_file_io_handle->current_offset ) )
+	{
+		size = (size_t) ( compressed_file_io_handle->uncompressed_size - compressed_file_io_handle->current_offset );
+	}
+	if( compressed_file_io_handle->compression_method == COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE )
+	{
+		/* The seek table maps the offset to a frame that can be decompressed
+		 * on its own, which provides random access
+		 */
+		while( buffer_offset < size )
+		{
+			frame_index = compressed_file_io_handle->frame_index;
+
+			if( ( frame_index == -1 )
+			 || ( compressed_file_io_handle->current_offset < compressed_file_io_handle->frame_uncompressed_offsets[ frame_index ] )
+			 || ( compressed_file_io_handle->current_offset >= compressed_file_io_handle->frame_uncompressed_offsets[ frame_index + 1 ] ) )
+			{
+				minimum_index = 0;
+				maximum_index = (int) compressed_file_io_handle->number_of_frames - 1;
+
+				while( minimum_index < maximum_index )
+				{
+					frame_index = minimum_index + ( ( maximum_index - minimum_index + 1 ) / 2 );
+
+					if( compressed_file_io_handle->frame_uncompressed_offsets[ frame_index ] <= compressed_file_io_handle->current_offset )
+					{
+						minimum_index = frame_index;
+					}
+					else
+					{
+						maximum_index = frame_index - 1;
+					}
+				}
+				frame_index = minimum_index;
+
+				/* Skip frames without uncompressed data
+				 */
+				while( ( (uint32_t) frame_index < compressed_file_io_handle->number_of_frames )
+				    && ( compressed_file_io_handle->frame_uncompressed_offsets[ frame_index + 1 ] <= compressed_file_io_handle->current_offset ) )
+				{
+					frame_index++;
+				}
+				if( compressed_file_io_handle_read_frame(
+				     compressed_file_io_handle,
+				     frame_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read frame: %d.",
+					 function,
+					 frame_index );
+
+					return( -1 );
+				}
+			}
+			frame_offset = (size_t) ( compressed_file_io_handle->current_offset - compressed_file_io_handle->frame_uncompressed_offsets[ frame_index ] );
+			read_size    = (size_t) ( compressed_file_io_handle->frame_uncompressed_offsets[ frame_index + 1 ] - compressed_file_io_handle->current_offset );
+
+			if( read_size > ( size - buffer_offset ) )
+			{
+				read_size = size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( compressed_file_io_handle->frame_data[ frame_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy frame data.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset                             += read_size;
+			compressed_file_io_handle->current_offset += (off64_t) read_size;
+		}
+		return( (ssize_t) buffer_offset );
+	}
+	/* A stream can only be decompressed forward, reading before the current
+	 * offset of the stream restarts the decompression from the start
+	 */
+	if( compressed_file_io_handle->current_offset < compressed_file_io_handle->stream_offset )
+	{
+		if( compressed_file_io_handle_rewind(
+		     compressed_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( compressed_file_io_handle->stream_offset < compressed_file_io_handle->current_offset )
+	{
+		skip_size = COMPRESSED_FILE_IO_HANDLE_INPUT_BUFFER_SIZE;
+
+		if( (off64_t) skip_size > ( compressed_file_io_handle->current_offset - compressed_file_io_handle->stream_offset ) )
+		{
+			skip_size = (size_t) ( compressed_file_io_handle->current_offset - compressed_file_io_handle->stream_offset );
+		}
+		read_count = compressed_file_io_handle_decompress_stream(
+		              compressed_file_io_handle,
+		              compressed_file_io_handle->skip_data,
+		              skip_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to decompress stream.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			return( 0 );
+		}
+	}
+	read_count = compressed_file_io_handle_decompress_stream(
+	              compressed_file_io_handle,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to decompress stream.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_file_io_handle->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Writes a buffer to the compressed file IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t compressed_file_io_handle_write(
+         compressed_file_io_handle_t *compressed_file_io_handle,
+         const uint8_t *buffer EVTXTOOLS_ATTRIBUTE_UNUSED,
+         size_t size EVTXTOOLS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_write";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( buffer )
+	EVTXTOOLS_UNREFERENCED_PARAMETER( size )
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the compressed file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t compressed_file_io_handle_seek_offset(
+         compressed_file_io_handle_t *compressed_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_seek_offset";
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data is not decompressed until it is read
+	 */
+	if( whence == SEEK_CUR )
+	{
+		offset += compressed_file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) compressed_file_io_handle->uncompressed_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int compressed_file_io_handle_exists(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_exists";
+	int result            = 0;
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          compressed_file_io_handle->source_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if source file exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the compressed file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int compressed_file_io_handle_is_open(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_is_open";
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the uncompressed size of the compressed file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_file_io_handle_get_size(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_file_io_handle_get_size";
+
+	if( compressed_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = compressed_file_io_handle->uncompressed_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,274 @@
+/*
+ * Compressed file IO handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _COMPRESSED_FILE_IO_HANDLE_H )
+#define _COMPRESSED_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+#include <zstd.h>
+#endif
+
+#include "evtxtools_libbfio.h"
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to read the compressed data of a stream
+ */
+#define COMPRESSED_FILE_IO_HANDLE_INPUT_BUFFER_SIZE	65536
+
+/* The maximum size of an allocation for the seek table or frame data
+ */
+#define COMPRESSED_FILE_IO_HANDLE_MAXIMUM_ALLOCATION_SIZE	( 128 * 1024 * 1024 )
+
+/* The zstd seekable format magic numbers
+ */
+#define COMPRESSED_FILE_IO_HANDLE_ZSTD_SEEKABLE_MAGIC_NUMBER	0x8f92eab1UL
+#define COMPRESSED_FILE_IO_HANDLE_ZSTD_SEEK_TABLE_MAGIC_NUMBER	0x184d2a5eUL
+
+enum COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHODS
+{
+	COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_NONE,
+	COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_GZIP,
+	COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD,
+	COMPRESSED_FILE_IO_HANDLE_COMPRESSION_METHOD_ZSTD_SEEKABLE
+};
+
+typedef struct compressed_file_io_handle compressed_file_io_handle_t;
+
+struct compressed_file_io_handle
+{
+	/* The file IO handle of the compressed data
+	 */
+	libbfio_handle_t *source_file_io_handle;
+
+	/* The compression method
+	 */
+	uint8_t compression_method;
+
+	/* The compressed size
+	 */
+	size64_t compressed_size;
+
+	/* The uncompressed size
+	 */
+	size64_t uncompressed_size;
+
+	/* The current (uncompressed) offset
+	 */
+	off64_t current_offset;
+
+	/* The uncompressed offset of the decompressed stream
+	 */
+	off64_t stream_offset;
+
+	/* The compressed input data of the stream
+	 */
+	uint8_t *input_data;
+
+	/* The compressed input data size
+	 */
+	size_t input_data_size;
+
+	/* The compressed input data offset
+	 */
+	size_t input_data_offset;
+
+	/* The buffer used to decompress data that is skipped
+	 */
+	uint8_t *skip_data;
+
+	/* Value to indicate the end of the compressed input was reached
+	 */
+	uint8_t end_of_input;
+
+	/* Value to indicate the end of the decompressed stream was reached
+	 */
+	uint8_t end_of_stream;
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	/* The zlib stream
+	 */
+	z_stream zlib_stream;
+
+	/* Value to indicate the zlib stream was initialized
+	 */
+	uint8_t zlib_stream_initialized;
+#endif
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	/* The zstd stream
+	 */
+	ZSTD_DStream *zstd_stream;
+
+	/* Value to indicate the zstd stream is at the end of a frame
+	 */
+	uint8_t zstd_frame_is_complete;
+#endif
+
+	/* The number of frames in the zstd seek table
+	 */
+	uint32_t number_of_frames;
+
+	/* The compressed offsets of the frames, contains number of frames + 1 values
+	 */
+	off64_t *frame_compressed_offsets;
+
+	/* The uncompressed offsets of the frames, contains number of frames + 1 values
+	 */
+	off64_t *frame_uncompressed_offsets;
+
+	/* The compressed data of the frame
+	 */
+	uint8_t *frame_compressed_data;
+
+	/* The maximum compressed size of a frame
+	 */
+	size_t maximum_frame_compressed_size;
+
+	/* The uncompressed data of the frame
+	 */
+	uint8_t *frame_data;
+
+	/* The maximum uncompressed size of a frame
+	 */
+	size_t maximum_frame_size;
+
+	/* The index of the frame in the frame data
+	 * Contains -1 if not set
+	 */
+	int frame_index;
+
+	/* Value to indicate the IO handle is open
+	 */
+	int is_open;
+};
+
+int compressed_file_io_handle_initialize(
+     compressed_file_io_handle_t **compressed_file_io_handle,
+     libbfio_handle_t *source_file_io_handle,
+     uint8_t compression_method,
+     libcerror_error_t **error );
+
+int compressed_file_initialize(
+     libbfio_handle_t **handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_free(
+     compressed_file_io_handle_t **compressed_file_io_handle,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_clone(
+     compressed_file_io_handle_t **destination_compressed_file_io_handle,
+     compressed_file_io_handle_t *source_compressed_file_io_handle,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_determine_compression_method(
+     libbfio_handle_t *file_io_handle,
+     uint8_t *compression_method,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_open(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_close(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_read_source_data(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_read_seek_table(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_rewind(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_read_input_data(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t compressed_file_io_handle_decompress_stream(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_read_frame(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     int frame_index,
+     libcerror_error_t **error );
+
+ssize_t compressed_file_io_handle_read(
+         compressed_file_io_handle_t *compressed_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t compressed_file_io_handle_write(
+         compressed_file_io_handle_t *compressed_file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t compressed_file_io_handle_seek_offset(
+         compressed_file_io_handle_t *compressed_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int compressed_file_io_handle_exists(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_is_open(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     libcerror_error_t **error );
+
+int compressed_file_io_handle_get_size(
+     compressed_file_io_handle_t *compressed_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _COMPRESSED_FILE_IO_HANDLE_H ) */
+
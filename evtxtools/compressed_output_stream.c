@@ -0,0 +1,1254 @@
+/*
+ * Compressed output stream
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+#include <zstd.h>
+#endif
+
+#include "compressed_output_stream.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libcthreads.h"
+
+/* Creates a compressed output stream
+ * Make sure the value compressed_output_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_initialize(
+     compressed_output_stream_t **compressed_output_stream,
+     FILE *stream,
+     int compression_method,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function       = "compressed_output_stream_initialize";
+	int maximum_level           = 0;
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+	size_t compressed_data_size = 0;
+	int block_index             = 0;
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	size_t zstd_result          = 0;
+#endif
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_output_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed output stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_method )
+	{
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+		case COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_GZIP:
+			maximum_level = 9;
+			break;
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+		case COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_ZSTD:
+			maximum_level = ZSTD_maxCLevel();
+			break;
+#endif
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression method.",
+			 function );
+
+			return( -1 );
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > maximum_level ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compression level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > COMPRESSED_OUTPUT_STREAM_MAXIMUM_NUMBER_OF_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_output_stream = memory_allocate_structure(
+	                             compressed_output_stream_t );
+
+	if( *compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed output stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressed_output_stream,
+	     0,
+	     sizeof( compressed_output_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressed output stream.",
+		 function );
+
+		memory_free(
+		 *compressed_output_stream );
+
+		*compressed_output_stream = NULL;
+
+		return( -1 );
+	}
+	( *compressed_output_stream )->stream             = stream;
+	( *compressed_output_stream )->compression_method = compression_method;
+	( *compressed_output_stream )->compression_level  = compression_level;
+	( *compressed_output_stream )->number_of_threads  = number_of_threads;
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	if( compression_method == COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_GZIP )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_threads > 1 )
+		{
+			/* Every block is compressed into a separate gzip member, one block
+			 * more than the number of threads is used so that the calling thread
+			 * can fill a block while the other blocks are compressed
+			 */
+			( *compressed_output_stream )->number_of_blocks = number_of_threads + 1;
+
+			( *compressed_output_stream )->blocks = (compressed_output_block_t *) memory_allocate(
+			                                                                       sizeof( compressed_output_block_t ) * ( *compressed_output_stream )->number_of_blocks );
+
+			if( ( *compressed_output_stream )->blocks == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create blocks.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     ( *compressed_output_stream )->blocks,
+			     0,
+			     sizeof( compressed_output_block_t ) * ( *compressed_output_stream )->number_of_blocks ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear blocks.",
+				 function );
+
+				memory_free(
+				 ( *compressed_output_stream )->blocks );
+
+				( *compressed_output_stream )->blocks = NULL;
+
+				goto on_error;
+			}
+			/* The gzip header and trailer add 18 bytes to the zlib bound
+			 */
+			compressed_data_size = (size_t) compressBound(
+			                                 (uLong) COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE ) + 18;
+
+			for( block_index = 0;
+			     block_index < ( *compressed_output_stream )->number_of_blocks;
+			     block_index++ )
+			{
+				( *compressed_output_stream )->blocks[ block_index ].compression_level = compression_level;
+
+				( *compressed_output_stream )->blocks[ block_index ].data = (uint8_t *) memory_allocate(
+				                                                                         sizeof( uint8_t ) * COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE );
+
+				if( ( *compressed_output_stream )->blocks[ block_index ].data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create data of block: %d.",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+				( *compressed_output_stream )->blocks[ block_index ].compressed_data = (uint8_t *) memory_allocate(
+				                                                                                    sizeof( uint8_t ) * compressed_data_size );
+
+				if( ( *compressed_output_stream )->blocks[ block_index ].compressed_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create compressed data of block: %d.",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+				( *compressed_output_stream )->blocks[ block_index ].compressed_data_size = compressed_data_size;
+			}
+			return( 1 );
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		/* The window bits of 15 + 16 write a gzip header and trailer
+		 */
+		if( deflateInit2(
+		     &( ( *compressed_output_stream )->zlib_stream ),
+		     ( compression_level == 0 ) ? Z_DEFAULT_COMPRESSION : compression_level,
+		     Z_DEFLATED,
+		     15 + 16,
+		     8,
+		     Z_DEFAULT_STRATEGY ) != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize zlib stream.",
+			 function );
+
+			goto on_error;
+		}
+		( *compressed_output_stream )->zlib_stream_initialized = 1;
+		( *compressed_output_stream )->output_data_size        = COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE;
+	}
+#endif /* defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H ) */
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	if( compression_method == COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_ZSTD )
+	{
+		( *compressed_output_stream )->zstd_context = ZSTD_createCCtx();
+
+		if( ( *compressed_output_stream )->zstd_context == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create zstd compression context.",
+			 function );
+
+			goto on_error;
+		}
+		if( compression_level != 0 )
+		{
+			zstd_result = ZSTD_CCtx_setParameter(
+			               ( *compressed_output_stream )->zstd_context,
+			               ZSTD_c_compressionLevel,
+			               compression_level );
+
+			if( ZSTD_isError( zstd_result ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set zstd compression level with error: %s.",
+				 function,
+				 ZSTD_getErrorName( zstd_result ) );
+
+				goto on_error;
+			}
+		}
+		if( number_of_threads > 1 )
+		{
+			/* The zstd workers compress in the background while the calling thread
+			 * continues, a libzstd without multi-threading support fails to set
+			 * the number of workers and compresses in the calling thread instead
+			 */
+			zstd_result = ZSTD_CCtx_setParameter(
+			               ( *compressed_output_stream )->zstd_context,
+			               ZSTD_c_nbWorkers,
+			               number_of_threads );
+
+			if( ZSTD_isError( zstd_result ) )
+			{
+				( *compressed_output_stream )->number_of_threads = 1;
+			}
+		}
+		( *compressed_output_stream )->output_data_size = ZSTD_CStreamOutSize();
+	}
+#endif /* defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H ) */
+
+	( *compressed_output_stream )->output_data = (uint8_t *) memory_allocate(
+	                                                          sizeof( uint8_t ) * ( *compressed_output_stream )->output_data_size );
+
+	if( ( *compressed_output_stream )->output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *compressed_output_stream != NULL )
+	{
+		compressed_output_stream_free(
+		 compressed_output_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a compressed output stream
+ * Data that was not written is discarded, use compressed_output_stream_finish
+ * to complete the compressed stream
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_free(
+     compressed_output_stream_t **compressed_output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_output_stream_free";
+	int block_index       = 0;
+	int result            = 1;
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_output_stream != NULL )
+	{
+		if( ( *compressed_output_stream )->blocks != NULL )
+		{
+			for( block_index = 0;
+			     block_index < ( *compressed_output_stream )->number_of_blocks;
+			     block_index++ )
+			{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+				if( ( *compressed_output_stream )->blocks[ block_index ].thread != NULL )
+				{
+					if( libcthreads_thread_join(
+					     &( ( *compressed_output_stream )->blocks[ block_index ].thread ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to join thread of block: %d.",
+						 function,
+						 block_index );
+
+						result = -1;
+					}
+				}
+#endif
+				if( ( *compressed_output_stream )->blocks[ block_index ].compressed_data != NULL )
+				{
+					memory_free(
+					 ( *compressed_output_stream )->blocks[ block_index ].compressed_data );
+				}
+				if( ( *compressed_output_stream )->blocks[ block_index ].data != NULL )
+				{
+					memory_free(
+					 ( *compressed_output_stream )->blocks[ block_index ].data );
+				}
+			}
+			memory_free(
+			 ( *compressed_output_stream )->blocks );
+		}
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+		if( ( *compressed_output_stream )->zlib_stream_initialized != 0 )
+		{
+			deflateEnd(
+			 &( ( *compressed_output_stream )->zlib_stream ) );
+		}
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+		if( ( *compressed_output_stream )->zstd_context != NULL )
+		{
+			ZSTD_freeCCtx(
+			 ( *compressed_output_stream )->zstd_context );
+		}
+#endif
+		if( ( *compressed_output_stream )->output_data != NULL )
+		{
+			memory_free(
+			 ( *compressed_output_stream )->output_data );
+		}
+		memory_free(
+		 *compressed_output_stream );
+
+		*compressed_output_stream = NULL;
+	}
+	return( result );
+}
+
+/* Compresses the data of a block into a separate gzip member
+ * This function is used as the start function of the compression threads
+ * and therefore does not set an error
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_block_compress(
+     compressed_output_block_t *compressed_output_block )
+{
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	z_stream zlib_stream;
+
+	int zlib_result = 0;
+#endif
+
+	if( compressed_output_block == NULL )
+	{
+		return( -1 );
+	}
+	compressed_output_block->result = -1;
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	if( memory_set(
+	     &zlib_stream,
+	     0,
+	     sizeof( z_stream ) ) == NULL )
+	{
+		return( -1 );
+	}
+	if( deflateInit2(
+	     &zlib_stream,
+	     ( compressed_output_block->compression_level == 0 ) ? Z_DEFAULT_COMPRESSION : compressed_output_block->compression_level,
+	     Z_DEFLATED,
+	     15 + 16,
+	     8,
+	     Z_DEFAULT_STRATEGY ) != Z_OK )
+	{
+		return( -1 );
+	}
+	zlib_stream.next_in   = (Bytef *) compressed_output_block->data;
+	zlib_stream.avail_in  = (uInt) compressed_output_block->data_offset;
+	zlib_stream.next_out  = (Bytef *) compressed_output_block->compressed_data;
+	zlib_stream.avail_out = (uInt) compressed_output_block->compressed_data_size;
+
+	zlib_result = deflate(
+	               &zlib_stream,
+	               Z_FINISH );
+
+	if( zlib_result == Z_STREAM_END )
+	{
+		compressed_output_block->compressed_data_offset = compressed_output_block->compressed_data_size - (size_t) zlib_stream.avail_out;
+		compressed_output_block->result                 = 1;
+	}
+	deflateEnd(
+	 &zlib_stream );
+#endif /* defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H ) */
+
+	return( compressed_output_block->result );
+}
+
+/* Starts compressing the block that is being filled and continues with the next block
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_start_block(
+     compressed_output_stream_t *compressed_output_stream,
+     libcerror_error_t **error )
+{
+	compressed_output_block_t *compressed_output_block = NULL;
+	static char *function                              = "compressed_output_stream_start_block";
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_output_stream->blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed output stream - missing blocks.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_output_block = &( compressed_output_stream->blocks[ compressed_output_stream->current_block_index ] );
+
+	if( compressed_output_block->data_offset == 0 )
+	{
+		return( 1 );
+	}
+	compressed_output_block->is_pending = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_create(
+	     &( compressed_output_block->thread ),
+	     NULL,
+	     (int (*)(void *)) &compressed_output_block_compress,
+	     (void *) compressed_output_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread of block: %d.",
+		 function,
+		 compressed_output_stream->current_block_index );
+
+		compressed_output_block->is_pending = 0;
+
+		return( -1 );
+	}
+#else
+	compressed_output_block_compress(
+	 compressed_output_block );
+#endif
+	compressed_output_stream->current_block_index += 1;
+
+	if( compressed_output_stream->current_block_index >= compressed_output_stream->number_of_blocks )
+	{
+		compressed_output_stream->current_block_index = 0;
+	}
+	return( 1 );
+}
+
+/* Waits for a pending block to be compressed and writes its compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_write_block(
+     compressed_output_stream_t *compressed_output_stream,
+     int block_index,
+     libcerror_error_t **error )
+{
+	compressed_output_block_t *compressed_output_block = NULL;
+	static char *function                              = "compressed_output_stream_write_block";
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_output_stream->blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed output stream - missing blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_index < 0 )
+	 || ( block_index >= compressed_output_stream->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_output_block = &( compressed_output_stream->blocks[ block_index ] );
+
+	if( compressed_output_block->is_pending == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( compressed_output_block->thread != NULL )
+	{
+		if( libcthreads_thread_join(
+		     &( compressed_output_block->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread of block: %d.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+	}
+#endif
+	compressed_output_block->is_pending = 0;
+
+	if( compressed_output_block->result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress block: %d.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( compressed_output_stream_write_output_data(
+	     compressed_output_stream,
+	     compressed_output_block->compressed_data,
+	     compressed_output_block->compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compressed data of block: %d.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	compressed_output_block->data_offset            = 0;
+	compressed_output_block->compressed_data_offset = 0;
+
+	return( 1 );
+}
+
+/* Writes compressed data to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_write_output_data(
+     compressed_output_stream_t *compressed_output_stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_output_stream_write_output_data";
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     compressed_output_stream->stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data to stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses data with the zlib or zstd stream and writes the compressed data
+ * The data size cannot exceed COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_compress(
+     compressed_output_stream_t *compressed_output_stream,
+     const uint8_t *data,
+     size_t data_size,
+     int flush_mode,
+     libcerror_error_t **error )
+{
+	static char *function     = "compressed_output_stream_compress";
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	size_t compressed_size    = 0;
+	int zlib_flush            = Z_NO_FLUSH;
+	int zlib_result           = 0;
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	ZSTD_EndDirective zstd_directive = ZSTD_e_continue;
+	ZSTD_inBuffer zstd_input;
+	ZSTD_outBuffer zstd_output;
+
+	size_t zstd_result        = 0;
+#endif
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flush_mode != COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_NONE )
+	 && ( flush_mode != COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_SYNC )
+	 && ( flush_mode != COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_FINISH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flush mode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	if( compressed_output_stream->zlib_stream_initialized != 0 )
+	{
+		if( flush_mode == COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_SYNC )
+		{
+			zlib_flush = Z_SYNC_FLUSH;
+		}
+		else if( flush_mode == COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_FINISH )
+		{
+			zlib_flush = Z_FINISH;
+		}
+		compressed_output_stream->zlib_stream.next_in  = (Bytef *) data;
+		compressed_output_stream->zlib_stream.avail_in = (uInt) data_size;
+
+		/* The output data is filled completely as long as deflate has more
+		 * compressed data to write
+		 */
+		do
+		{
+			compressed_output_stream->zlib_stream.next_out  = (Bytef *) compressed_output_stream->output_data;
+			compressed_output_stream->zlib_stream.avail_out = (uInt) compressed_output_stream->output_data_size;
+
+			zlib_result = deflate(
+			               &( compressed_output_stream->zlib_stream ),
+			               zlib_flush );
+
+			if( zlib_result == Z_STREAM_ERROR )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress data.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_size = compressed_output_stream->output_data_size - (size_t) compressed_output_stream->zlib_stream.avail_out;
+
+			if( compressed_output_stream_write_output_data(
+			     compressed_output_stream,
+			     compressed_output_stream->output_data,
+			     compressed_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write compressed data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		while( compressed_output_stream->zlib_stream.avail_out == 0 );
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H ) */
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	if( compressed_output_stream->zstd_context != NULL )
+	{
+		if( flush_mode == COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_SYNC )
+		{
+			zstd_directive = ZSTD_e_flush;
+		}
+		else if( flush_mode == COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_FINISH )
+		{
+			zstd_directive = ZSTD_e_end;
+		}
+		zstd_input.src  = (const void *) data;
+		zstd_input.size = data_size;
+		zstd_input.pos  = 0;
+
+		/* Without a flush the compressor keeps data buffered until all input is
+		 * consumed, with a flush it is called until no more data remains
+		 */
+		do
+		{
+			zstd_output.dst  = (void *) compressed_output_stream->output_data;
+			zstd_output.size = compressed_output_stream->output_data_size;
+			zstd_output.pos  = 0;
+
+			zstd_result = ZSTD_compressStream2(
+			               compressed_output_stream->zstd_context,
+			               &zstd_output,
+			               &zstd_input,
+			               zstd_directive );
+
+			if( ZSTD_isError( zstd_result ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress zstd data with error: %s.",
+				 function,
+				 ZSTD_getErrorName( zstd_result ) );
+
+				return( -1 );
+			}
+			if( compressed_output_stream_write_output_data(
+			     compressed_output_stream,
+			     compressed_output_stream->output_data,
+			     zstd_output.pos,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write compressed data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		while( ( zstd_directive == ZSTD_e_continue ) ? ( zstd_input.pos < zstd_input.size ) : ( zstd_result != 0 ) );
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H ) */
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: invalid compressed output stream - missing compression stream.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes data to the compressed output stream
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_write(
+     compressed_output_stream_t *compressed_output_stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	compressed_output_block_t *compressed_output_block = NULL;
+	static char *function                              = "compressed_output_stream_write";
+	size_t write_size                                  = 0;
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_size > 0 )
+	{
+		if( compressed_output_stream->blocks != NULL )
+		{
+			compressed_output_block = &( compressed_output_stream->blocks[ compressed_output_stream->current_block_index ] );
+
+			/* The block that is filled next is the oldest pending block
+			 */
+			if( compressed_output_stream_write_block(
+			     compressed_output_stream,
+			     compressed_output_stream->current_block_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block: %d.",
+				 function,
+				 compressed_output_stream->current_block_index );
+
+				return( -1 );
+			}
+			write_size = COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE - compressed_output_block->data_offset;
+
+			if( write_size > data_size )
+			{
+				write_size = data_size;
+			}
+			if( memory_copy(
+			     &( compressed_output_block->data[ compressed_output_block->data_offset ] ),
+			     data,
+			     write_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to block.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_output_block->data_offset += write_size;
+
+			if( compressed_output_block->data_offset >= COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE )
+			{
+				if( compressed_output_stream_start_block(
+				     compressed_output_stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to start compressing block.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		else
+		{
+			write_size = data_size;
+
+			if( write_size > COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE )
+			{
+				write_size = COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE;
+			}
+			if( compressed_output_stream_compress(
+			     compressed_output_stream,
+			     data,
+			     write_size,
+			     COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_NONE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		data      += write_size;
+		data_size -= write_size;
+	}
+	return( 1 );
+}
+
+/* Compresses and writes all the pending data
+ * The flush mode determines if the compressed stream is completed
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_write_pending(
+     compressed_output_stream_t *compressed_output_stream,
+     int flush_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_output_stream_write_pending";
+	int block_index       = 0;
+	int block_iterator    = 0;
+
+	if( compressed_output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_output_stream->blocks == NULL )
+	{
+		if( compressed_output_stream_compress(
+		     compressed_output_stream,
+		     NULL,
+		     0,
+		     flush_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to flush compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* Every block is a complete gzip member hence flushing and finishing
+	 * both write all the blocks
+	 */
+	if( compressed_output_stream_start_block(
+	     compressed_output_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to start compressing block.",
+		 function );
+
+		return( -1 );
+	}
+	/* The pending blocks are written from the oldest to the most recent
+	 */
+	block_index = compressed_output_stream->current_block_index;
+
+	for( block_iterator = 0;
+	     block_iterator < compressed_output_stream->number_of_blocks;
+	     block_iterator++ )
+	{
+		if( compressed_output_stream_write_block(
+		     compressed_output_stream,
+		     block_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block: %d.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		block_index += 1;
+
+		if( block_index >= compressed_output_stream->number_of_blocks )
+		{
+			block_index = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Flushes the compressed output stream
+ * After a flush the data written so far can be decompressed from the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_flush(
+     compressed_output_stream_t *compressed_output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_output_stream_flush";
+
+	if( compressed_output_stream_write_pending(
+	     compressed_output_stream,
+	     COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_SYNC,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write pending data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finishes the compressed output stream
+ * Writes all pending data and the end of the compressed stream
+ * Returns 1 if successful or -1 on error
+ */
+int compressed_output_stream_finish(
+     compressed_output_stream_t *compressed_output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "compressed_output_stream_finish";
+
+	if( compressed_output_stream_write_pending(
+	     compressed_output_stream,
+	     COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_FINISH,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write pending data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,228 @@
+/*
+ * Compressed output stream
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _COMPRESSED_OUTPUT_STREAM_H )
+#define _COMPRESSED_OUTPUT_STREAM_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+#include <zstd.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the blocks that are compressed in parallel
+ */
+#define COMPRESSED_OUTPUT_STREAM_BLOCK_SIZE		131072
+
+/* The maximum number of blocks that are compressed in parallel
+ */
+#define COMPRESSED_OUTPUT_STREAM_MAXIMUM_NUMBER_OF_BLOCKS	64
+
+enum COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHODS
+{
+	COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_NONE	= 0,
+	COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_GZIP	= (int) 'g',
+	COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_ZSTD	= (int) 'z'
+};
+
+enum COMPRESSED_OUTPUT_STREAM_FLUSH_MODES
+{
+	COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_NONE		= 0,
+	COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_SYNC		= 1,
+	COMPRESSED_OUTPUT_STREAM_FLUSH_MODE_FINISH	= 2
+};
+
+typedef struct compressed_output_block compressed_output_block_t;
+
+struct compressed_output_block
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread that compresses the block
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The uncompressed data
+	 */
+	uint8_t *data;
+
+	/* The uncompressed data offset
+	 */
+	size_t data_offset;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The compressed data offset
+	 */
+	size_t compressed_data_offset;
+
+	/* Value to indicate the block is being compressed or was compressed
+	 * but not yet written
+	 */
+	uint8_t is_pending;
+
+	/* The result of the compression
+	 */
+	int result;
+};
+
+typedef struct compressed_output_stream compressed_output_stream_t;
+
+struct compressed_output_stream
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The compression method
+	 */
+	int compression_method;
+
+	/* The compression level, 0 represents the default level
+	 */
+	int compression_level;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	/* The zlib stream
+	 */
+	z_stream zlib_stream;
+
+	/* Value to indicate the zlib stream was initialized
+	 */
+	uint8_t zlib_stream_initialized;
+#endif
+
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	/* The zstd compression context
+	 */
+	ZSTD_CCtx *zstd_context;
+#endif
+
+	/* The compressed output data
+	 */
+	uint8_t *output_data;
+
+	/* The compressed output data size
+	 */
+	size_t output_data_size;
+
+	/* The blocks that are compressed in parallel
+	 */
+	compressed_output_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The index of the block that is being filled
+	 */
+	int current_block_index;
+};
+
+int compressed_output_stream_initialize(
+     compressed_output_stream_t **compressed_output_stream,
+     FILE *stream,
+     int compression_method,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int compressed_output_stream_free(
+     compressed_output_stream_t **compressed_output_stream,
+     libcerror_error_t **error );
+
+int compressed_output_block_compress(
+     compressed_output_block_t *compressed_output_block );
+
+int compressed_output_stream_start_block(
+     compressed_output_stream_t *compressed_output_stream,
+     libcerror_error_t **error );
+
+int compressed_output_stream_write_block(
+     compressed_output_stream_t *compressed_output_stream,
+     int block_index,
+     libcerror_error_t **error );
+
+int compressed_output_stream_write_output_data(
+     compressed_output_stream_t *compressed_output_stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int compressed_output_stream_compress(
+     compressed_output_stream_t *compressed_output_stream,
+     const uint8_t *data,
+     size_t data_size,
+     int flush_mode,
+     libcerror_error_t **error );
+
+int compressed_output_stream_write(
+     compressed_output_stream_t *compressed_output_stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int compressed_output_stream_write_pending(
+     compressed_output_stream_t *compressed_output_stream,
+     int flush_mode,
+     libcerror_error_t **error );
+
+int compressed_output_stream_flush(
+     compressed_output_stream_t *compressed_output_stream,
+     libcerror_error_t **error );
+
+int compressed_output_stream_finish(
+     compressed_output_stream_t *compressed_output_stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _COMPRESSED_OUTPUT_STREAM_H ) */
+
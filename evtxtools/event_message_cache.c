@@ -0,0 +1,783 @@
+/*
+ * Event message cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "event_message_cache.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "message_string.h"
+
+/* Frees an event message cache entry
+ * The template definition is not freed since it is managed by the template definition cache
+ * Returns 1 if successful or -1 on error
+ */
+int event_message_cache_entry_free(
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "event_message_cache_entry_free";
+	int result            = 1;
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_entry != NULL )
+	{
+		if( ( *cache_entry )->message_string != NULL )
+		{
+			if( message_string_free(
+			     &( ( *cache_entry )->message_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message string.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *cache_entry )->message_filename != NULL )
+		{
+			memory_free(
+			 ( *cache_entry )->message_filename );
+		}
+		if( ( *cache_entry )->resource_filename != NULL )
+		{
+			memory_free(
+			 ( *cache_entry )->resource_filename );
+		}
+		if( ( *cache_entry )->event_source != NULL )
+		{
+			memory_free(
+			 ( *cache_entry )->event_source );
+		}
+		if( ( *cache_entry )->event_provider_identifier != NULL )
+		{
+			memory_free(
+			 ( *cache_entry )->event_provider_identifier );
+		}
+		memory_free(
+		 *cache_entry );
+
+		*cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Creates an event message cache
+ * Make sure the value event_message_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int event_message_cache_initialize(
+     event_message_cache_t **event_message_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "event_message_cache_initialize";
+
+	if( event_message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *event_message_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid event message cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*event_message_cache = memory_allocate_structure(
+	                        event_message_cache_t );
+
+	if( *event_message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event message cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *event_message_cache,
+	     0,
+	     sizeof( event_message_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event message cache.",
+		 function );
+
+		memory_free(
+		 *event_message_cache );
+
+		*event_message_cache = NULL;
+
+		return( -1 );
+	}
+	if( event_message_cache_resize_buckets(
+	     *event_message_cache,
+	     EVENT_MESSAGE_CACHE_INITIAL_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *event_message_cache != NULL )
+	{
+		memory_free(
+		 *event_message_cache );
+
+		*event_message_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an event message cache
+ * The cached entries are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int event_message_cache_free(
+     event_message_cache_t **event_message_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "event_message_cache_free";
+	int result            = 1;
+
+	if( event_message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *event_message_cache != NULL )
+	{
+		if( event_message_cache_empty(
+		     *event_message_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty event message cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *event_message_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *event_message_cache )->buckets );
+		}
+		memory_free(
+		 *event_message_cache );
+
+		*event_message_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties an event message cache
+ * The cached entries are freed
+ * Returns 1 if successful or -1 on error
+ */
+int event_message_cache_empty(
+     event_message_cache_t *event_message_cache,
+     libcerror_error_t **error )
+{
+	event_message_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "event_message_cache_empty";
+	int bucket_index                         = 0;
+	int result                               = 1;
+
+	if( event_message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event message cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < event_message_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( event_message_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = event_message_cache->buckets[ bucket_index ];
+
+			event_message_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			if( event_message_cache_entry_free(
+			     &cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free cache entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	event_message_cache->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Calculates the hash of an event provider identifier, source, event identifier and qualifiers
+ * Returns the 32-bit hash
+ */
+uint32_t event_message_cache_get_key_hash(
+          const system_character_t *event_provider_identifier,
+          size_t event_provider_identifier_length,
+          const system_character_t *event_source,
+          size_t event_source_length,
+          uint32_t event_identifier,
+          uint32_t event_identifier_qualifiers )
+{
+	uint32_t key_hash      = 0x811c9dc5UL;
+	size_t character_index = 0;
+
+	/* The provider identifier and source are hashed with FNV-1a,
+	 * separated by a value that is not a valid character,
+	 * and the event identifier and qualifiers are mixed in afterwards
+	 */
+	if( event_provider_identifier != NULL )
+	{
+		for( character_index = 0;
+		     character_index < event_provider_identifier_length;
+		     character_index++ )
+		{
+			key_hash ^= (uint32_t) event_provider_identifier[ character_index ];
+			key_hash *= 0x01000193UL;
+		}
+	}
+	key_hash ^= 0xffffffffUL;
+	key_hash *= 0x01000193UL;
+
+	if( event_source != NULL )
+	{
+		for( character_index = 0;
+		     character_index < event_source_length;
+		     character_index++ )
+		{
+			key_hash ^= (uint32_t) event_source[ character_index ];
+			key_hash *= 0x01000193UL;
+		}
+	}
+	key_hash ^= event_identifier * 0x9e3779b1UL;
+	key_hash ^= key_hash >> 16;
+	key_hash ^= event_identifier_qualifiers * 0x85ebca6bUL;
+	key_hash ^= key_hash >> 13;
+
+	return( key_hash );
+}
+
+/* Resizes the hash table buckets
+ * Returns 1 if successful or -1 on error
+ */
+int event_message_cache_resize_buckets(
+     event_message_cache_t *event_message_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	event_message_cache_entry_t **buckets    = NULL;
+	event_message_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "event_message_cache_resize_buckets";
+	int bucket_index                         = 0;
+	int new_bucket_index                     = 0;
+
+	if( event_message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) SSIZE_MAX / sizeof( event_message_cache_entry_t * ) ) )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (event_message_cache_entry_t **) memory_allocate(
+	                                            sizeof( event_message_cache_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( new_bucket_index = 0;
+	     new_bucket_index < number_of_buckets;
+	     new_bucket_index++ )
+	{
+		buckets[ new_bucket_index ] = NULL;
+	}
+	for( bucket_index = 0;
+	     bucket_index < event_message_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( event_message_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = event_message_cache->buckets[ bucket_index ];
+
+			event_message_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			new_bucket_index = (int) ( cache_entry->key_hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+			cache_entry->next_bucket_entry = buckets[ new_bucket_index ];
+			buckets[ new_bucket_index ]    = cache_entry;
+		}
+	}
+	if( event_message_cache->buckets != NULL )
+	{
+		memory_free(
+		 event_message_cache->buckets );
+	}
+	event_message_cache->buckets           = buckets;
+	event_message_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Determines if a cached string matches a string
+ * Returns 1 if the strings match or 0 if not
+ */
+int event_message_cache_compare_string(
+     const system_character_t *cached_string,
+     size_t cached_string_length,
+     const system_character_t *string,
+     size_t string_length )
+{
+	if( ( cached_string == NULL )
+	 && ( string == NULL ) )
+	{
+		return( 1 );
+	}
+	if( ( cached_string == NULL )
+	 || ( string == NULL ) )
+	{
+		return( 0 );
+	}
+	if( cached_string_length != string_length )
+	{
+		return( 0 );
+	}
+	if( system_string_compare(
+	     cached_string,
+	     string,
+	     string_length ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache entry of an event
+ * The cache entry is managed by the cache
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int event_message_cache_get_entry(
+     event_message_cache_t *event_message_cache,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	event_message_cache_entry_t *safe_cache_entry = NULL;
+	static char *function                         = "event_message_cache_get_entry";
+	uint32_t key_hash                             = 0;
+
+	if( event_message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_entry = NULL;
+
+	key_hash = event_message_cache_get_key_hash(
+	            event_provider_identifier,
+	            event_provider_identifier_length,
+	            event_source,
+	            event_source_length,
+	            event_identifier,
+	            event_identifier_qualifiers );
+
+	safe_cache_entry = event_message_cache->buckets[ key_hash & (uint32_t) ( event_message_cache->number_of_buckets - 1 ) ];
+
+	while( safe_cache_entry != NULL )
+	{
+		if( ( safe_cache_entry->key_hash == key_hash )
+		 && ( safe_cache_entry->event_identifier == event_identifier )
+		 && ( safe_cache_entry->event_identifier_qualifiers == event_identifier_qualifiers )
+		 && ( event_message_cache_compare_string(
+		       safe_cache_entry->event_provider_identifier,
+		       safe_cache_entry->event_provider_identifier_length,
+		       event_provider_identifier,
+		       event_provider_identifier_length ) != 0 )
+		 && ( event_message_cache_compare_string(
+		       safe_cache_entry->event_source,
+		       safe_cache_entry->event_source_length,
+		       event_source,
+		       event_source_length ) != 0 ) )
+		{
+			*cache_entry = safe_cache_entry;
+
+			return( 1 );
+		}
+		safe_cache_entry = safe_cache_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Copies a string of the key of a cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int event_message_cache_copy_string(
+     system_character_t **cached_string,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "event_message_cache_copy_string";
+
+	if( cached_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( ( SSIZE_MAX / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*cached_string = system_string_allocate(
+	                  string_length + 1 );
+
+	if( *cached_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     *cached_string,
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		memory_free(
+		 *cached_string );
+
+		*cached_string = NULL;
+
+		return( -1 );
+	}
+	( *cached_string )[ string_length ] = 0;
+
+	return( 1 );
+}
+
+/* Appends a cache entry of an event
+ * The values of the cache entry are cleared and are to be set by the caller,
+ * the cache manages the strings and message string that are set
+ * Returns 1 if successful or -1 on error
+ */
+int event_message_cache_append_entry(
+     event_message_cache_t *event_message_cache,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	event_message_cache_entry_t *safe_cache_entry = NULL;
+	static char *function                         = "event_message_cache_append_entry";
+	int bucket_index                              = 0;
+
+	if( event_message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_message_cache->number_of_entries >= event_message_cache->number_of_buckets )
+	{
+		if( event_message_cache_resize_buckets(
+		     event_message_cache,
+		     event_message_cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	safe_cache_entry = memory_allocate_structure(
+	                    event_message_cache_entry_t );
+
+	if( safe_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_cache_entry,
+	     0,
+	     sizeof( event_message_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		memory_free(
+		 safe_cache_entry );
+
+		return( -1 );
+	}
+	if( event_provider_identifier != NULL )
+	{
+		if( event_message_cache_copy_string(
+		     &( safe_cache_entry->event_provider_identifier ),
+		     event_provider_identifier,
+		     event_provider_identifier_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy event provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+		safe_cache_entry->event_provider_identifier_length = event_provider_identifier_length;
+	}
+	if( event_source != NULL )
+	{
+		if( event_message_cache_copy_string(
+		     &( safe_cache_entry->event_source ),
+		     event_source,
+		     event_source_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy event source.",
+			 function );
+
+			goto on_error;
+		}
+		safe_cache_entry->event_source_length = event_source_length;
+	}
+	safe_cache_entry->event_identifier            = event_identifier;
+	safe_cache_entry->event_identifier_qualifiers = event_identifier_qualifiers;
+
+	safe_cache_entry->key_hash = event_message_cache_get_key_hash(
+	                              event_provider_identifier,
+	                              event_provider_identifier_length,
+	                              event_source,
+	                              event_source_length,
+	                              event_identifier,
+	                              event_identifier_qualifiers );
+
+	bucket_index = (int) ( safe_cache_entry->key_hash & (uint32_t) ( event_message_cache->number_of_buckets - 1 ) );
+
+	safe_cache_entry->next_bucket_entry = event_message_cache->buckets[ bucket_index ];
+
+	event_message_cache->buckets[ bucket_index ] = safe_cache_entry;
+
+	event_message_cache->number_of_entries += 1;
+
+	*cache_entry = safe_cache_entry;
+
+	return( 1 );
+
+on_error:
+	if( safe_cache_entry != NULL )
+	{
+		event_message_cache_entry_free(
+		 &safe_cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
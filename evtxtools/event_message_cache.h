@@ -0,0 +1,192 @@
+/*
+ * Event message cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVENT_MESSAGE_CACHE_H )
+#define _EVENT_MESSAGE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of hash table buckets, must be a power of 2
+ */
+#define EVENT_MESSAGE_CACHE_INITIAL_NUMBER_OF_BUCKETS	64
+
+typedef struct event_message_cache_entry event_message_cache_entry_t;
+
+struct event_message_cache_entry
+{
+	/* The event provider identifier
+	 * Contains NULL if the event has no provider identifier
+	 */
+	system_character_t *event_provider_identifier;
+
+	/* The event provider identifier length
+	 */
+	size_t event_provider_identifier_length;
+
+	/* The event source
+	 * Contains NULL if the event has no source
+	 */
+	system_character_t *event_source;
+
+	/* The event source length
+	 */
+	size_t event_source_length;
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The event identifier qualifiers
+	 */
+	uint32_t event_identifier_qualifiers;
+
+	/* The hash of the key
+	 */
+	uint32_t key_hash;
+
+	/* The resource filename
+	 * Contains NULL if the provider has no resource filename
+	 */
+	system_character_t *resource_filename;
+
+	/* The message filename
+	 * Contains NULL if the provider has no message filename
+	 */
+	system_character_t *message_filename;
+
+	/* The message identifier
+	 */
+	uint32_t message_identifier;
+
+	/* Value to indicate the message identifier was derived from the event identifier and qualifiers
+	 */
+	uint8_t message_identifier_is_event_identifier;
+
+	/* The template definition
+	 * The template definition is managed by the template definition cache
+	 */
+	libevtx_template_definition_t *template_definition;
+
+	/* The message string
+	 * Contains NULL if the event has no message string
+	 */
+	message_string_t *message_string;
+
+	/* The next entry in the same hash table bucket
+	 */
+	event_message_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct event_message_cache event_message_cache_t;
+
+struct event_message_cache
+{
+	/* The hash table buckets
+	 */
+	event_message_cache_entry_t **buckets;
+
+	/* The number of hash table buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int event_message_cache_entry_free(
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+int event_message_cache_initialize(
+     event_message_cache_t **event_message_cache,
+     libcerror_error_t **error );
+
+int event_message_cache_free(
+     event_message_cache_t **event_message_cache,
+     libcerror_error_t **error );
+
+int event_message_cache_empty(
+     event_message_cache_t *event_message_cache,
+     libcerror_error_t **error );
+
+uint32_t event_message_cache_get_key_hash(
+          const system_character_t *event_provider_identifier,
+          size_t event_provider_identifier_length,
+          const system_character_t *event_source,
+          size_t event_source_length,
+          uint32_t event_identifier,
+          uint32_t event_identifier_qualifiers );
+
+int event_message_cache_resize_buckets(
+     event_message_cache_t *event_message_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int event_message_cache_compare_string(
+     const system_character_t *cached_string,
+     size_t cached_string_length,
+     const system_character_t *string,
+     size_t string_length );
+
+int event_message_cache_get_entry(
+     event_message_cache_t *event_message_cache,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+int event_message_cache_copy_string(
+     system_character_t **cached_string,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int event_message_cache_append_entry(
+     event_message_cache_t *event_message_cache,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVENT_MESSAGE_CACHE_H ) */
+
@@ -0,0 +1,113 @@
+/*
+ * Message catalog file format definitions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTX_MESSAGE_CATALOG_H )
+#define _EVTX_MESSAGE_CATALOG_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The message catalog file consists of:
+ * the file header
+ * the entry descriptors sorted by key hash
+ * the key and value data the entry descriptors refer to
+ *
+ * All values are stored in little-endian and all offsets are relative
+ * to the start of the file, so the file can be used without parsing
+ * its entries first
+ */
+
+typedef struct evtx_message_catalog_file_header evtx_message_catalog_file_header_t;
+
+struct evtx_message_catalog_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Consists of: "EVTXMCAT"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The size of the characters of the (system) strings
+	 * Consists of 4 bytes
+	 */
+	uint8_t character_size[ 4 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* The file size
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_size[ 4 ];
+};
+
+typedef struct evtx_message_catalog_entry_descriptor evtx_message_catalog_entry_descriptor_t;
+
+struct evtx_message_catalog_entry_descriptor
+{
+	/* The key hash
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_hash[ 4 ];
+
+	/* The key type
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_type[ 4 ];
+
+	/* The key data offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_data_offset[ 4 ];
+
+	/* The key data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_data_size[ 4 ];
+
+	/* The value data offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t value_data_offset[ 4 ];
+
+	/* The value data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t value_data_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTX_MESSAGE_CATALOG_H ) */
+
@@ -0,0 +1,696 @@
+/*
+ * Carves records from Windows XML Event Viewer Log (EVTX) chunks in raw data
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtxtools_getopt.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "evtxtools_signal.h"
+#include "evtxtools_unused.h"
+#include "export_handle.h"
+#include "log_handle.h"
+#include "message_catalog.h"
+
+export_handle_t *evtxcarve_export_handle = NULL;
+int evtxcarve_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtxcarve to carve the records of Windows XML Event Viewer Log\n"
+	                 "(EVTX) chunks stored in raw data, such as a disk image or\n"
+	                 "unallocated space.\n\n" );
+
+	fprintf( stream, "Usage: evtxcarve [ -c codepage ] [ -C cache_size ] [ -f format ]\n"
+	                 "                 [ -j threads ] [ -l log_file ] [ -M catalog_file ]\n"
+	                 "                 [ -o output_file ] [ -p resource_files_path ]\n"
+	                 "                 [ -r registy_files_path ] [ -s system_file ]\n"
+	                 "                 [ -S software_file ] [ -t event_log_type ]\n"
+	                 "                 [ -hTvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file, such as a disk image\n\n" );
+
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     maximum number of cached resource files, the default is 64\n" );
+	fprintf( stream, "\t-f:     output format, options: csv, json, ndjson, xml,\n"
+	                 "\t        xml-compact, text (default)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to read the carved chunks,\n"
+	                 "\t        the default is 1\n" );
+	fprintf( stream, "\t-l:     logs information about the exported items\n" );
+	fprintf( stream, "\t-M:     use the message catalog in catalog_file, created with\n"
+	                 "\t        evtxmessages, instead of the (Windows) Registry files and\n"
+	                 "\t        the resource files\n" );
+	fprintf( stream, "\t-o:     writes the carved items to output_file instead of stdout\n" );
+	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
+	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
+	                 "\t        (Windows) Registry file\n" );
+	fprintf( stream, "\t-s:     filename of the SYSTEM (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-S:     filename of the SOFTWARE (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-t:     event log type, options: application, security, system\n" );
+	fprintf( stream, "\t-T:     use event template definitions to parse the event record data\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtxcarve
+ */
+void evtxcarve_signal_handler(
+      evtxtools_signal_t signal EVTXTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "evtxcarve_signal_handler";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtxcarve_abort = 1;
+
+	if( evtxcarve_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     evtxcarve_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                              = NULL;
+	log_handle_t *log_handle                              = NULL;
+	message_catalog_t *message_catalog                    = NULL;
+	system_character_t *option_ascii_codepage             = NULL;
+	system_character_t *option_cache_size                 = NULL;
+	system_character_t *option_event_log_type             = NULL;
+	system_character_t *option_export_format              = NULL;
+	system_character_t *option_log_filename               = NULL;
+	system_character_t *option_message_catalog_filename   = NULL;
+	system_character_t *option_number_of_threads          = NULL;
+	system_character_t *option_output_filename            = NULL;
+	system_character_t *option_resource_files_path        = NULL;
+	system_character_t *option_preferred_language         = NULL;
+	system_character_t *option_registry_directory_name    = NULL;
+	system_character_t *option_software_registry_filename = NULL;
+	system_character_t *option_system_registry_filename   = NULL;
+	system_character_t *source                            = NULL;
+	char *program                                         = "evtxcarve";
+	system_integer_t option                               = 0;
+	int result                                            = 0;
+	int use_template_definition                           = 0;
+	int verbose                                           = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evtxtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtxoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evtxtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:C:f:hj:l:M:o:p:r:s:S:t:TvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'C':
+				option_cache_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_export_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'l':
+				option_log_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'M':
+				option_message_catalog_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_resource_files_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_registry_directory_name = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_system_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_software_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_event_log_type = optarg;
+
+				break;
+
+			case (system_integer_t) 'T':
+				use_template_definition = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtxoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libevtx_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevtx_notify_set_verbose(
+	 verbose );
+
+	if( log_handle_initialize(
+	     &log_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize log handle.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_initialize(
+	     &evtxcarve_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+	if( option_ascii_codepage != NULL )
+	{
+		result = export_handle_set_ascii_codepage(
+		          evtxcarve_export_handle,
+		          option_ascii_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( option_event_log_type != NULL )
+	{
+		result = export_handle_set_event_log_type(
+		          evtxcarve_export_handle,
+		          option_event_log_type,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set event log type in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+			  evtxcarve_export_handle,
+			  option_export_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format defaulting to: text.\n" );
+		}
+	}
+	if( option_cache_size != NULL )
+	{
+		result = export_handle_set_maximum_number_of_cached_resource_files(
+			  evtxcarve_export_handle,
+			  option_cache_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of cached resource files.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum number of cached resource files defaulting to: %d.\n",
+			 RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+			  evtxcarve_export_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	if( option_resource_files_path != NULL )
+	{
+		if( export_handle_set_resource_files_path(
+		     evtxcarve_export_handle,
+		     option_resource_files_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource files path in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_software_registry_filename != NULL )
+	{
+		if( export_handle_set_software_registry_filename(
+		     evtxcarve_export_handle,
+		     option_software_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set software registry filename in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_system_registry_filename != NULL )
+	{
+		if( export_handle_set_system_registry_filename(
+		     evtxcarve_export_handle,
+		     option_system_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set system registry filename in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_registry_directory_name != NULL )
+	{
+		if( export_handle_set_registry_directory_name(
+		     evtxcarve_export_handle,
+		     option_registry_directory_name,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set registry directory name in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_message_catalog_filename != NULL )
+	{
+		if( message_catalog_initialize(
+		     &message_catalog,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize message catalog.\n" );
+
+			goto on_error;
+		}
+		if( message_catalog_open(
+		     message_catalog,
+		     option_message_catalog_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open message catalog: %" PRIs_SYSTEM ".\n",
+			 option_message_catalog_filename );
+
+			goto on_error;
+		}
+		if( export_handle_set_message_catalog(
+		     evtxcarve_export_handle,
+		     message_catalog,
+		     MESSAGE_HANDLE_CATALOG_MODE_LOOKUP,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set message catalog in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_preferred_language != NULL )
+	{
+/* TODO set preferred language identifier from input */
+		if( export_handle_set_preferred_language_identifier(
+		     evtxcarve_export_handle,
+		     0x0409,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set preferred language identifier in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	evtxcarve_export_handle->use_template_definition = use_template_definition;
+	evtxcarve_export_handle->verbose                 = verbose;
+
+	if( log_handle_open(
+	     log_handle,
+	     option_log_filename,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open log file: %" PRIs_SYSTEM ".\n",
+		 option_log_filename );
+
+		goto on_error;
+	}
+	if( option_output_filename != NULL )
+	{
+		if( export_handle_open_output(
+		     evtxcarve_export_handle,
+		     option_output_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open output file: %" PRIs_SYSTEM ".\n",
+			 option_output_filename );
+
+			goto on_error;
+		}
+	}
+	result = export_handle_carve_input(
+	          evtxcarve_export_handle,
+	          source,
+	          log_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to carve: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( export_handle_close_output(
+	     evtxcarve_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close output file.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &evtxcarve_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( message_catalog != NULL )
+	{
+		if( message_catalog_free(
+		     &message_catalog,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free message catalog.\n" );
+
+			goto on_error;
+		}
+	}
+	if( log_handle_close(
+	     log_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close log handle.\n" );
+
+		goto on_error;
+	}
+	if( log_handle_free(
+	     &log_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free log handle.\n" );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "No records carved.\n" );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxcarve_export_handle != NULL )
+	{
+		export_handle_free(
+		 &evtxcarve_export_handle,
+		 NULL );
+	}
+	if( message_catalog != NULL )
+	{
+		message_catalog_free(
+		 &message_catalog,
+		 NULL );
+	}
+	if( log_handle != NULL )
+	{
+		log_handle_free(
+		 &log_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,832 @@
+/*
+ * Serves queries on Windows XML Event Log (EVTX) files kept open in memory
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtxtools_getopt.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "evtxtools_signal.h"
+#include "evtxtools_unused.h"
+#include "export_handle.h"
+#include "log_handle.h"
+#include "network_stream.h"
+#include "query_server.h"
+#include "source_list.h"
+
+export_handle_t *evtxd_export_handle = NULL;
+query_server_t *evtxd_query_server   = NULL;
+int evtxd_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtxd to keep Windows XML Event Viewer Log (EVTX) files open\n"
+	                 "and answer queries about their records on a UNIX domain socket.\n\n" );
+
+	fprintf( stream, "Usage: evtxd -u socket_path [ -b batch_source ] [ -c codepage ]\n"
+	                 "             [ -C cache_size ] [ -f format ] [ -l log_file ]\n"
+	                 "             [ -m chunk_cache_size ] [ -p resource_files_path ]\n"
+	                 "             [ -r registy_files_path ] [ -s system_file ]\n"
+	                 "             [ -S software_file ] [ -t event_log_type ]\n"
+	                 "             [ -hTvVx ] [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: the source file, multiple source files can be provided\n\n" );
+
+	fprintf( stream, "\t-b:     also serve the source files listed in batch_source, which\n"
+	                 "\t        is either a directory, of which the .evtx files are served,\n"
+	                 "\t        or a file that contains a source filename per line\n" );
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     maximum number of cached resource files, the default is 64\n" );
+	fprintf( stream, "\t-f:     default output format of a query, options: csv, json,\n"
+	                 "\t        ndjson, xml, xml-compact, text (default)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-l:     logs information about the exported items\n" );
+	fprintf( stream, "\t-m:     maximum size in bytes of the chunk cache shared by the source\n"
+	                 "\t        files, the default is 268435456\n" );
+	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
+	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
+	                 "\t        (Windows) Registry file\n" );
+	fprintf( stream, "\t-s:     filename of the SYSTEM (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-S:     filename of the SOFTWARE (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-t:     event log type, options: application, security, system\n"
+	                 "\t        if not specified the event log type is determined based\n"
+	                 "\t        on the filename.\n" );
+	fprintf( stream, "\t-T:     use event template definitions to parse the event record data\n" );
+	fprintf( stream, "\t-u:     path of the UNIX domain socket to listen on. A connection\n"
+	                 "\t        sends a single request line and receives OK or ERROR\n"
+	                 "\t        followed by the result, the requests are:\n"
+	                 "\t        list\n"
+	                 "\t        query source [format=format] [since=record_identifier]\n"
+	                 "\t              [after=written_time] [offset=offset]\n"
+	                 "\t              [limit=max_records] [filter=expression]\n"
+	                 "\t        where source is the index or the filename of a source\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-x:     keep an index file, the source filename followed by .idx,\n"
+	                 "\t        beside every source file so that a restart does not need\n"
+	                 "\t        to read all the chunks\n" );
+}
+
+/* Signal handler for evtxd
+ */
+void evtxd_signal_handler(
+      evtxtools_signal_t signal EVTXTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "evtxd_signal_handler";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtxd_abort = 1;
+
+	if( evtxd_query_server != NULL )
+	{
+		if( query_server_signal_abort(
+		     evtxd_query_server,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal query server to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( evtxd_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     evtxd_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                              = NULL;
+	log_handle_t *log_handle                              = NULL;
+	source_list_t *source_list                            = NULL;
+	char *program                                         = "evtxd";
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	system_character_t *option_ascii_codepage             = NULL;
+	system_character_t *option_batch_source               = NULL;
+	system_character_t *option_cache_size                 = NULL;
+	system_character_t *option_chunk_cache_size           = NULL;
+	system_character_t *option_event_log_type             = NULL;
+	system_character_t *option_export_format              = NULL;
+	system_character_t *option_log_filename               = NULL;
+	system_character_t *option_resource_files_path        = NULL;
+	system_character_t *option_registry_directory_name    = NULL;
+	system_character_t *option_software_registry_filename = NULL;
+	system_character_t *option_socket_path                = NULL;
+	system_character_t *option_system_registry_filename   = NULL;
+	system_integer_t option                               = 0;
+	uint8_t event_log_type_from_filename                  = 0;
+	int argument_index                                    = 0;
+	int result                                            = 0;
+	int use_index_files                                   = 0;
+	int use_template_definition                           = 0;
+	int verbose                                           = 0;
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evtxtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtxoutput_version_fprint(
+	 stdout,
+	 program );
+
+#if !defined( HAVE_NETWORK_STREAM_SUPPORT )
+	fprintf(
+	 stderr,
+	 "UNIX domain sockets are not supported on this platform.\n" );
+
+	goto on_error;
+#else
+	while( ( option = evtxtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:c:C:f:hl:m:p:r:s:S:t:Tu:vVx" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_batch_source = optarg;
+
+				break;
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'C':
+				option_cache_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_export_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'l':
+				option_log_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_chunk_cache_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_resource_files_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_registry_directory_name = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_system_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_software_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_event_log_type = optarg;
+
+				break;
+
+			case (system_integer_t) 'T':
+				use_template_definition = 1;
+
+				break;
+
+			case (system_integer_t) 'u':
+				option_socket_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtxoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'x':
+				use_index_files = 1;
+
+				break;
+		}
+	}
+	if( option_socket_path == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing socket path.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( optind == argc )
+	 && ( option_batch_source == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libevtx_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevtx_notify_set_verbose(
+	 verbose );
+
+	if( log_handle_initialize(
+	     &log_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize log handle.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_initialize(
+	     &evtxd_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+	if( option_ascii_codepage != NULL )
+	{
+		result = export_handle_set_ascii_codepage(
+		          evtxd_export_handle,
+		          option_ascii_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( option_event_log_type != NULL )
+	{
+		result = export_handle_set_event_log_type(
+		          evtxd_export_handle,
+		          option_event_log_type,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set event log type in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( option_event_log_type == NULL )
+	 || ( result == 0 ) )
+	{
+		/* The event log type is determined for every source file
+		 */
+		event_log_type_from_filename = 1;
+	}
+	if( option_export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+			  evtxd_export_handle,
+			  option_export_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format defaulting to: text.\n" );
+		}
+	}
+	if( option_cache_size != NULL )
+	{
+		result = export_handle_set_maximum_number_of_cached_resource_files(
+			  evtxd_export_handle,
+			  option_cache_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of cached resource files.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum number of cached resource files defaulting to: %d.\n",
+			 RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES );
+		}
+	}
+	if( option_resource_files_path != NULL )
+	{
+		if( export_handle_set_resource_files_path(
+		     evtxd_export_handle,
+		     option_resource_files_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource files path in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_software_registry_filename != NULL )
+	{
+		if( export_handle_set_software_registry_filename(
+		     evtxd_export_handle,
+		     option_software_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set software registry filename in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_system_registry_filename != NULL )
+	{
+		if( export_handle_set_system_registry_filename(
+		     evtxd_export_handle,
+		     option_system_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set system registry filename in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_registry_directory_name != NULL )
+	{
+		if( export_handle_set_registry_directory_name(
+		     evtxd_export_handle,
+		     option_registry_directory_name,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set registry directory name in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	evtxd_export_handle->use_template_definition = use_template_definition;
+	evtxd_export_handle->verbose                 = verbose;
+
+	/* The query server takes the default export format from the export handle
+	 */
+	if( query_server_initialize(
+	     &evtxd_query_server,
+	     evtxd_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize query server.\n" );
+
+		goto on_error;
+	}
+	if( option_chunk_cache_size != NULL )
+	{
+		result = query_server_set_maximum_cache_size(
+			  evtxd_query_server,
+			  option_chunk_cache_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum chunk cache size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum chunk cache size defaulting to: %d.\n",
+			 QUERY_SERVER_DEFAULT_CACHE_SIZE );
+		}
+	}
+	evtxd_query_server->use_index_files = use_index_files;
+
+	if( source_list_initialize(
+	     &source_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize source list.\n" );
+
+		goto on_error;
+	}
+	if( option_batch_source != NULL )
+	{
+		if( source_list_read(
+		     source_list,
+		     option_batch_source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read batch source: %" PRIs_SYSTEM ".\n",
+			 option_batch_source );
+
+			goto on_error;
+		}
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( source_list_append_filename(
+		     source_list,
+		     argv[ argument_index ],
+		     system_string_length(
+		      argv[ argument_index ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source file: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			goto on_error;
+		}
+	}
+	if( source_list->number_of_filenames == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "No source files in batch source: %" PRIs_SYSTEM ".\n",
+		 option_batch_source );
+
+		goto on_error;
+	}
+	if( log_handle_open(
+	     log_handle,
+	     option_log_filename,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open log file: %" PRIs_SYSTEM ".\n",
+		 option_log_filename );
+
+		goto on_error;
+	}
+	if( evtxtools_signal_attach(
+	     evtxd_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = query_server_open_sources(
+	          evtxd_query_server,
+	          (const system_character_t * const *) source_list->filenames,
+	          source_list->number_of_filenames,
+	          event_log_type_from_filename,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source files.\n" );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open one or more source files.\n" );
+	}
+	if( evtxd_query_server->number_of_sources == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "No source files to serve.\n" );
+
+		goto on_error;
+	}
+	if( query_server_open(
+	     evtxd_query_server,
+	     (const char *) option_socket_path,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to listen on socket: %" PRIs_SYSTEM ".\n",
+		 option_socket_path );
+
+		goto on_error;
+	}
+	if( verbose != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Serving %d source file(s) on: %" PRIs_SYSTEM "\n",
+		 evtxd_query_server->number_of_sources,
+		 option_socket_path );
+	}
+	if( evtxd_abort == 0 )
+	{
+		if( query_server_run(
+		     evtxd_query_server,
+		     log_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run query server.\n" );
+
+			goto on_error;
+		}
+	}
+	if( evtxtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( query_server_free(
+	     &evtxd_query_server,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free query server.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &evtxd_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( source_list_free(
+	     &source_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source list.\n" );
+
+		goto on_error;
+	}
+	if( log_handle_close(
+	     log_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close log handle.\n" );
+
+		goto on_error;
+	}
+	if( log_handle_free(
+	     &log_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free log handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+#endif /* !defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxd_query_server != NULL )
+	{
+		query_server_free(
+		 &evtxd_query_server,
+		 NULL );
+	}
+	if( evtxd_export_handle != NULL )
+	{
+		export_handle_free(
+		 &evtxd_export_handle,
+		 NULL );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
+	if( log_handle != NULL )
+	{
+		log_handle_free(
+		 &log_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
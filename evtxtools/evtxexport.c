@@ -42,6 +42,11 @@
 #include "evtxtools_unused.h"
 #include "export_handle.h"
 #include "log_handle.h"
+#include "message_catalog.h"
+#include "network_stream.h"
+#include "source_list.h"
+
+#define EVTXEXPORT_MAXIMUM_NUMBER_OF_SEARCH_STRINGS	32
 
 export_handle_t *evtxexport_export_handle = NULL;
 int evtxexport_abort                      = 0;
@@ -58,30 +63,119 @@ void usage_fprint(
 	fprintf( stream, "Use evtxexport to export items stored in a Windows XML Event Viewer\n"
 	                 "Log (EVTX) file.\n\n" );
 
-	fprintf( stream, "Usage: evtxexport [ -c codepage ] [ -f format ] [ -l log_file ]\n"
-	                 "                  [ -m mode ] [ -p resource_files_path ]\n"
+	fprintf( stream, "Usage: evtxexport [ -a sample ] [ -b batch_source ] [ -c codepage ]\n"
+	                 "                  [ -C cache_size ] [ -d output_directory ]\n"
+	                 "                  [ -e string ] [ -f format ] [ -i record_identifier ]\n"
+	                 "                  [ -I flush_interval ] [ -j threads ]\n"
+	                 "                  [ -k timings_format ] [ -K checkpoint_file ]\n"
+	                 "                  [ -l log_file ] [ -m mode ]\n"
+	                 "                  [ -M catalog_file ] [ -n shards ] [ -N max_records ]\n"
+	                 "                  [ -o output_file ] [ -O offset ]\n"
+	                 "                  [ -p resource_files_path ] [ -q expression ]\n"
 	                 "                  [ -r registy_files_path ] [ -s system_file ]\n"
 	                 "                  [ -S software_file ] [ -t event_log_type ]\n"
-	                 "                  [ -hTvV ] source\n\n" );
-
-
-	fprintf( stream, "\tsource: the source file\n\n" );
+	                 "                  [ -u value ] [ -w written_time ] [ -y granularity ]\n"
+	                 "                  [ -z compression ]\n"
+	                 "                  [ -ADFghLPRTvVWx ] source [ source ... ]\n\n" );
+
+
+	fprintf( stream, "\tsource: the source file, multiple source files can be provided\n"
+	                 "\t        when -g is used\n\n" );
+
+	fprintf( stream, "\t-A:     bind the threads that export the records in the XML format\n"
+	                 "\t        to the NUMA nodes, the threads are spread over the nodes and\n"
+	                 "\t        use the memory of their node. Only applies when -j is used\n" );
+	fprintf( stream, "\t-a:     only export the records of a stratified random sample of\n"
+	                 "\t        the chunks, sample is a number of chunks, such as 64, or\n"
+	                 "\t        a percentage of the chunks, such as 5%%. The statistics\n"
+	                 "\t        printed by -v contain the estimated number of records.\n"
+	                 "\t        Implies -L\n" );
+	fprintf( stream, "\t-b:     export the source files listed in batch_source one after the\n"
+	                 "\t        other, batch_source is either a directory, of which the .evtx\n"
+	                 "\t        files are exported, or a file that contains a source filename\n"
+	                 "\t        per line. The (Windows) Registry, resource files and messages\n"
+	                 "\t        are shared by all the source files\n" );
 
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
 	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
 	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
-	fprintf( stream, "\t-f:     output format, options: xml, text (default)\n" );
+	fprintf( stream, "\t-C:     maximum number of cached resource files, the default is 64\n" );
+	fprintf( stream, "\t-D:     skip the records with the same content as a previously exported\n"
+	                 "\t        record, such as the records of overlapping copies of the same\n"
+	                 "\t        log. Applies across all the source files in batch mode and\n"
+	                 "\t        when merging. Recovered records that duplicate an allocated\n"
+	                 "\t        record of the same file are skipped as well\n" );
+	fprintf( stream, "\t-d:     writes the exported items of every batch source file to a\n"
+	                 "\t        separate file in output_directory instead of stdout, or\n"
+	                 "\t        the partition files when -y is used\n" );
+	fprintf( stream, "\t-e:     only export the records that contain string, as UTF-16 or ASCII,\n"
+	                 "\t        case sensitive. The data of the records is searched before\n"
+	                 "\t        they are decoded. Can be used multiple times to export\n"
+	                 "\t        the records that contain any of the strings\n" );
+	fprintf( stream, "\t-f:     output format, options: bodyfile, csv, es-bulk, json,\n"
+	                 "\t        l2tcsv, ndjson, protobuf, protobuf-raw, xml, xml-compact,\n"
+	                 "\t        text (default)\n" );
+	fprintf( stream, "\t-F:     follow the source and export records as they are added\n"
+	                 "\t        to it, until interrupted\n" );
+	fprintf( stream, "\t-g:     merge the records of all the source files into a single\n"
+	                 "\t        timeline ordered by written time\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     only export the records with an identifier greater than\n"
+	                 "\t        record_identifier\n" );
+	fprintf( stream, "\t-I:     writes the buffered records at the end of a record when\n"
+	                 "\t        flush_interval seconds have elapsed since the last write\n" );
+	fprintf( stream, "\t-j:     number of threads used to read the source and to export\n"
+	                 "\t        the records in the XML format, the default is 1. Use auto\n"
+	                 "\t        to tune the number of threads, read-ahead depth and\n"
+	                 "\t        coalesced read size while the source is opened\n" );
+	fprintf( stream, "\t-k:     print the time spent reading, decoding, formatting and\n"
+	                 "\t        writing the records and on the event messages when done,\n"
+	                 "\t        options: json, text (default when -v is used)\n" );
+	fprintf( stream, "\t-K:     records the position up to which the records were written to\n"
+	                 "\t        the output in checkpoint_file after every write. If\n"
+	                 "\t        checkpoint_file exists the export resumes at its position,\n"
+	                 "\t        the exported batch source files are skipped and the output\n"
+	                 "\t        is truncated to the checkpoint. Requires -o or -d and the same\n"
+	                 "\t        options as the interrupted export. The checkpoint_file is\n"
+	                 "\t        removed when the export completes\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
+	fprintf( stream, "\t-L:     lazy access, only reads the chunk headers when opening the\n"
+	                 "\t        source, which bounds the memory needed for large sources.\n"
+	                 "\t        Only applies to the items export mode\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, items (default), recovered\n"
 	                 "\t        'all' exports the (allocated) items and recovered items,\n"
 	                 "\t        'items' exports the (allocated) items and 'recovered' exports\n"
 	                 "\t        the recovered items\n" );
+	fprintf( stream, "\t-M:     use the message catalog in catalog_file, created with\n"
+	                 "\t        evtxmessages, instead of the (Windows) Registry files and\n"
+	                 "\t        the resource files\n" );
+	fprintf( stream, "\t-n:     split the output into a number of shards, every shard covers a\n"
+	                 "\t        contiguous range of the records and is written concurrently\n"
+	                 "\t        to output_file followed by the index of the shard, such as\n"
+	                 "\t        output_file.0. Requires -o and only applies to the XML format\n" );
+	fprintf( stream, "\t-N:     only export max_records records, the reading of the source\n"
+	                 "\t        stops once these are exported\n" );
+	fprintf( stream, "\t-o:     writes the exported items to output_file instead of stdout,\n"
+	                 "\t        output_file can also be a network address: tcp://host:port\n"
+	                 "\t        sends batches prefixed with their 32-bit big-endian size,\n"
+	                 "\t        syslog://host:port sends every record as a RFC 5424 message,\n"
+	                 "\t        unix:path writes to a UNIX domain socket and\n"
+	                 "\t        http://host:port/path sends batches as bulk requests\n" );
+	fprintf( stream, "\t-O:     skip the first offset records, or when combined with -R\n"
+	                 "\t        the newest offset records\n" );
 	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
+	fprintf( stream, "\t-P:     preload the (Windows) Registry values and resource files of\n"
+	                 "\t        all the providers and event sources before exporting\n" );
+	fprintf( stream, "\t-q:     only export the records that match expression, a subset of\n"
+	                 "\t        the XPath queries of the Windows Event Viewer such as:\n"
+	                 "\t        *[System[(EventID=4624 or EventID=4625) and Level<=3]]\n"
+	                 "\t        The offset and max_records are applied before the expression\n" );
 	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
 	                 "\t        (Windows) Registry file\n" );
+	fprintf( stream, "\t-R:     export the newest records first, combined with -L and -N\n"
+	                 "\t        only the last chunks of the source are read\n" );
 	fprintf( stream, "\t-s:     filename of the SYSTEM (Windows) Registry file.\n"
 	                 "\t        This option overrides the path provided by -r\n" );
 	fprintf( stream, "\t-S:     filename of the SOFTWARE (Windows) Registry file.\n"
@@ -90,8 +184,31 @@ void usage_fprint(
 	                 "\t        if not specified the event log type is determined based\n"
 	                 "\t        on the filename.\n" );
 	fprintf( stream, "\t-T:     use event template definitions to parse the event record data\n" );
+	fprintf( stream, "\t-u:     only export the records with an EventData value, or a word of\n"
+	                 "\t        such a value, that equals value, case insensitive. Can be\n"
+	                 "\t        used multiple times to export the records that match any of\n"
+	                 "\t        the values\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-W:     live access, re-reads the chunks of a source that is actively\n"
+	                 "\t        written until they are consistent, instead of requiring a copy\n"
+	                 "\t        of the source. Implied by -F\n" );
+	fprintf( stream, "\t-w:     only export the records with a written time greater than\n"
+	                 "\t        written_time, which is a FILETIME timestamp\n" );
+	fprintf( stream, "\t-x:     profile the decode cost of the records and print the\n"
+	                 "\t        providers, event identifiers, templates and chunks that\n"
+	                 "\t        are the most expensive to decode when done\n" );
+	fprintf( stream, "\t-y:     partition the output by the written time of the records,\n"
+	                 "\t        options: day, hour. The records are written to files named\n"
+	                 "\t        dt=YYYY-MM-DD/hr=HH/part-N in output_directory, where the\n"
+	                 "\t        hr=HH directory is only used per hour and N is the first\n"
+	                 "\t        number not used by a previous export. Requires -d and is\n"
+	                 "\t        not supported in batch mode or with the json format\n" );
+	fprintf( stream, "\t-z:     compress the output file or the files in output_directory,\n"
+	                 "\t        options: gzip[:level] or zstd[:level]. The output is\n"
+	                 "\t        compressed while it is written using the number of threads\n"
+	                 "\t        set by -j, in batch mode and with -y .gz or .zst is added\n"
+	                 "\t        to the output filenames\n" );
 }
 
 /* Signal handler for evtxexport
@@ -146,22 +263,63 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error                              = NULL;
-	log_handle_t *log_handle                              = NULL;
-	system_character_t *option_ascii_codepage             = NULL;
-	system_character_t *option_event_log_type             = NULL;
-	system_character_t *option_export_format              = NULL;
-	system_character_t *option_export_mode                = NULL;
+	libcerror_error_t *error                  = NULL;
+	log_handle_t *log_handle                  = NULL;
+	message_catalog_t *message_catalog        = NULL;
+	source_list_t *source_list                = NULL;
+	system_character_t *option_ascii_codepage = NULL;
+	system_character_t *option_batch_source   = NULL;
+	system_character_t *option_cache_size     = NULL;
+	system_character_t *option_event_log_type = NULL;
+	system_character_t *option_export_format  = NULL;
+	system_character_t *option_export_mode    = NULL;
+	system_character_t *option_match_values[ EVTXEXPORT_MAXIMUM_NUMBER_OF_SEARCH_STRINGS ];
+	system_character_t *option_search_strings[ EVTXEXPORT_MAXIMUM_NUMBER_OF_SEARCH_STRINGS ];
+	system_character_t *option_checkpoint_filename        = NULL;
+	system_character_t *option_filter_expression          = NULL;
+	system_character_t *option_flush_interval             = NULL;
+	system_character_t *option_since_record_identifier    = NULL;
+	system_character_t *option_since_written_time         = NULL;
 	system_character_t *option_log_filename               = NULL;
+	system_character_t *option_message_catalog_filename   = NULL;
+	system_character_t *option_maximum_number_of_records  = NULL;
+	system_character_t *option_number_of_shards           = NULL;
+	system_character_t *option_number_of_threads          = NULL;
+	system_character_t *option_output_directory           = NULL;
+	system_character_t *option_output_compression         = NULL;
+	system_character_t *option_output_filename            = NULL;
+	system_character_t *option_partition_granularity      = NULL;
 	system_character_t *option_resource_files_path        = NULL;
 	system_character_t *option_preferred_language         = NULL;
+	system_character_t *option_record_offset              = NULL;
+	system_character_t *option_sample                     = NULL;
 	system_character_t *option_registry_directory_name    = NULL;
 	system_character_t *option_software_registry_filename = NULL;
 	system_character_t *option_system_registry_filename   = NULL;
+	system_character_t *option_timings_format             = NULL;
 	system_character_t *source                            = NULL;
 	char *program                                         = "evtxexport";
 	system_integer_t option                               = 0;
+	size_t output_location_offset                         = 0;
+	uint8_t event_log_type_from_filename                  = 0;
+	int batch_has_failures                                = 0;
+	int decode_profiling                                  = 0;
+	int deduplicate                                       = 0;
+	int follow                                            = 0;
+	int lazy                                              = 0;
+	int live                                              = 0;
+	int match_value_index                                 = 0;
+	int merge                                             = 0;
+	int newest_first                                      = 0;
+	int numa_affinity                                     = 0;
+	int number_of_match_values                            = 0;
+	int number_of_search_strings                          = 0;
+	int number_of_sources                                 = 0;
+	int output_protocol                                   = 0;
+	int preload                                           = 0;
 	int result                                            = 0;
+	int search_string_index                               = 0;
+	int use_shards                                        = 0;
 	int use_template_definition                           = 0;
 	int verbose                                           = 0;
 
@@ -198,7 +356,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = evtxtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:f:hl:m:p:r:s:S:t:TvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "Aa:b:c:C:d:De:f:Fghi:I:j:k:K:l:Lm:M:n:N:o:O:p:Pq:Rr:s:S:t:Tu:vVw:Wxy:z:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -214,42 +372,169 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'a':
+				option_sample = optarg;
+
+				break;
+
+			case (system_integer_t) 'A':
+				numa_affinity = 1;
+
+				break;
+
+			case (system_integer_t) 'b':
+				option_batch_source = optarg;
+
+				break;
+
 			case (system_integer_t) 'c':
 				option_ascii_codepage = optarg;
 
 				break;
 
+			case (system_integer_t) 'C':
+				option_cache_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_output_directory = optarg;
+
+				break;
+
+			case (system_integer_t) 'D':
+				deduplicate = 1;
+
+				break;
+
+			case (system_integer_t) 'e':
+				if( number_of_search_strings >= EVTXEXPORT_MAXIMUM_NUMBER_OF_SEARCH_STRINGS )
+				{
+					fprintf(
+					 stderr,
+					 "Too many search strings, at most %d are supported.\n",
+					 EVTXEXPORT_MAXIMUM_NUMBER_OF_SEARCH_STRINGS );
+
+					usage_fprint(
+					 stdout );
+
+					return( EXIT_FAILURE );
+				}
+				option_search_strings[ number_of_search_strings++ ] = optarg;
+
+				break;
+
 			case (system_integer_t) 'f':
 				option_export_format = optarg;
 
 				break;
 
+			case (system_integer_t) 'F':
+				follow = 1;
+
+				break;
+
+			case (system_integer_t) 'g':
+				merge = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				option_since_record_identifier = optarg;
+
+				break;
+
+			case (system_integer_t) 'I':
+				option_flush_interval = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'k':
+				option_timings_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'K':
+				option_checkpoint_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'l':
 				option_log_filename = optarg;
 
 				break;
 
+			case (system_integer_t) 'L':
+				lazy = 1;
+
+				break;
+
 			case (system_integer_t) 'm':
 				option_export_mode = optarg;
 
 				break;
 
+			case (system_integer_t) 'M':
+				option_message_catalog_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_number_of_shards = optarg;
+
+				break;
+
+			case (system_integer_t) 'N':
+				option_maximum_number_of_records = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'O':
+				option_record_offset = optarg;
+
+				break;
+
 			case (system_integer_t) 'p':
 				option_resource_files_path = optarg;
 
 				break;
 
+			case (system_integer_t) 'P':
+				preload = 1;
+
+				break;
+
+			case (system_integer_t) 'q':
+				option_filter_expression = optarg;
+
+				break;
+
 			case (system_integer_t) 'r':
 				option_registry_directory_name = optarg;
 
 				break;
 
+			case (system_integer_t) 'R':
+				newest_first = 1;
+
+				break;
+
 			case (system_integer_t) 's':
 				option_system_registry_filename = optarg;
 
@@ -270,6 +555,23 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'u':
+				if( number_of_match_values >= EVTXEXPORT_MAXIMUM_NUMBER_OF_SEARCH_STRINGS )
+				{
+					fprintf(
+					 stderr,
+					 "Too many match values, at most %d are supported.\n",
+					 EVTXEXPORT_MAXIMUM_NUMBER_OF_SEARCH_STRINGS );
+
+					usage_fprint(
+					 stdout );
+
+					return( EXIT_FAILURE );
+				}
+				option_match_values[ number_of_match_values++ ] = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -280,20 +582,308 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				option_since_written_time = optarg;
+
+				break;
+
+			case (system_integer_t) 'W':
+				live = 1;
+
+				break;
+
+			case (system_integer_t) 'x':
+				decode_profiling = 1;
+
+				break;
+
+			case (system_integer_t) 'y':
+				option_partition_granularity = optarg;
+
+				break;
+
+			case (system_integer_t) 'z':
+				option_output_compression = optarg;
+
+				break;
+		}
+	}
+	if( ( option_output_compression != NULL )
+	 && ( option_output_directory == NULL )
+	 && ( option_output_filename == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Compression is only supported with an output file or an output directory.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_partition_granularity != NULL )
+	{
+		if( option_output_directory == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Partitioned output is only supported with an output directory.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( option_batch_source != NULL )
+		 || ( option_output_filename != NULL )
+		 || ( option_number_of_shards != NULL )
+		 || ( option_checkpoint_filename != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Partitioned output is not supported in batch mode, with an output file, shards or a checkpoint.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( ( merge != 0 )
+	 && ( ( option_filter_expression != NULL )
+	  || ( number_of_search_strings > 0 )
+	  || ( number_of_match_values > 0 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "A filter expression, search strings or match values are not supported when merging the sources.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( merge != 0 )
+	 && ( ( newest_first != 0 )
+	  || ( option_maximum_number_of_records != NULL )
+	  || ( option_record_offset != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Newest first, an offset or a maximum number of records are not supported when merging the sources.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_number_of_shards != NULL )
+	{
+		if( option_output_filename == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Shards are only supported with an output file.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( option_batch_source != NULL )
+		 || ( merge != 0 )
+		 || ( follow != 0 )
+		 || ( newest_first != 0 )
+		 || ( deduplicate != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Shards are not supported in batch mode, when merging or following the source, with newest first or when skipping duplicate records.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( option_checkpoint_filename != NULL )
+	{
+		if( ( option_output_directory == NULL )
+		 && ( option_output_filename == NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "A checkpoint is only supported with an output file or an output directory.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		/* The output is resumed at the checkpoint which requires the records
+		 * to be written in order to an output file that can be truncated
+		 */
+		if( ( merge != 0 )
+		 || ( follow != 0 )
+		 || ( newest_first != 0 )
+		 || ( option_number_of_shards != NULL )
+		 || ( option_output_compression != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "A checkpoint is not supported when merging or following the source, with newest first, shards or compression.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		if( option_output_filename != NULL )
+		{
+			if( network_stream_get_protocol(
+			     option_output_filename,
+			     &output_protocol,
+			     &output_location_offset,
+			     NULL ) != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "A checkpoint is not supported with a network output.\n" );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+			}
+		}
+	}
+	if( option_batch_source != NULL )
+	{
+		if( optind != argc )
+		{
+			fprintf(
+			 stderr,
+			 "Source files are not supported in combination with a batch source.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( merge != 0 )
+		 || ( follow != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Merging or following the source is not supported in batch mode.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( option_output_directory != NULL )
+		 && ( option_output_filename != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "An output file and an output directory cannot be combined.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
 		}
 	}
-	if( optind == argc )
+	else
+	{
+		if( optind == argc )
+		{
+			fprintf(
+			 stderr,
+			 "Missing source file.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( option_output_directory != NULL )
+		 && ( option_partition_granularity == NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "An output directory is only supported in batch mode or with partitioned output.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		source            = argv[ optind ];
+		number_of_sources = argc - optind;
+	}
+
+	if( ( merge == 0 )
+	 && ( number_of_sources > 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Multiple source files are only supported when merging.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( merge != 0 )
+	 && ( follow != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Following the source is not supported when merging.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( lazy != 0 )
+	 && ( follow != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Following the source is not supported with lazy access.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	/* The sampled records are determined from the chunks of a source
+	 * which replaces the selection of the records by identifier, time or position
+	 */
+	if( ( option_sample != NULL )
+	 && ( ( merge != 0 )
+	  || ( follow != 0 )
+	  || ( newest_first != 0 )
+	  || ( option_number_of_shards != NULL )
+	  || ( option_checkpoint_filename != NULL )
+	  || ( option_since_record_identifier != NULL )
+	  || ( option_since_written_time != NULL )
+	  || ( option_record_offset != NULL )
+	  || ( option_maximum_number_of_records != NULL ) ) )
 	{
 		fprintf(
 		 stderr,
-		 "Missing source file.\n" );
+		 "A sample is not supported when merging or following the source, with newest first, shards, a checkpoint, a record identifier, a written time, an offset or a maximum number of records.\n" );
 
 		usage_fprint(
 		 stdout );
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
 
 	libcnotify_verbose_set(
 	 verbose );
@@ -405,38 +995,393 @@ int main( int argc, char * const argv[] )
 			 "Unsupported export mode defaulting to: items.\n" );
 		}
 	}
-	if( ( option_event_log_type == NULL )
-	 || ( result == 0 ) )
+	if( option_sample != NULL )
 	{
-		result = export_handle_set_event_log_type_from_filename(
+		if( evtxexport_export_handle->export_mode != EXPORT_MODE_ITEMS )
+		{
+			fprintf(
+			 stderr,
+			 "A sample is only supported in the items export mode.\n" );
+
+			goto on_error;
+		}
+		result = export_handle_set_sample(
 			  evtxexport_export_handle,
-			  source,
+			  option_sample,
 			  &error );
 
 		if( result == -1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to set event log type from filename in export handle.\n" );
+			 "Unable to set sample.\n" );
 
 			goto on_error;
 		}
-	}
-	if( option_resource_files_path != NULL )
-	{
-		if( export_handle_set_resource_files_path(
-		     evtxexport_export_handle,
-		     option_resource_files_path,
-		     &error ) != 1 )
+		else if( result == 0 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to set resource files path in export handle.\n" );
+			 "Unsupported sample.\n" );
 
 			goto on_error;
 		}
+		lazy = 1;
 	}
-	if( option_software_registry_filename != NULL )
+	if( option_cache_size != NULL )
+	{
+		result = export_handle_set_maximum_number_of_cached_resource_files(
+			  evtxexport_export_handle,
+			  option_cache_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of cached resource files.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum number of cached resource files defaulting to: %d.\n",
+			 RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES );
+		}
+	}
+	if( option_flush_interval != NULL )
+	{
+		result = export_handle_set_flush_interval(
+			  evtxexport_export_handle,
+			  option_flush_interval,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set flush interval.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported flush interval writing the buffered records when full.\n" );
+		}
+	}
+	if( option_number_of_shards != NULL )
+	{
+		result = export_handle_set_number_of_shards(
+			  evtxexport_export_handle,
+			  option_number_of_shards,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of shards.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of shards writing a single output file.\n" );
+		}
+		else
+		{
+			use_shards = 1;
+		}
+	}
+	if( option_output_compression != NULL )
+	{
+		result = export_handle_set_output_compression(
+			  evtxexport_export_handle,
+			  option_output_compression,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output compression.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output compression.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+			  evtxexport_export_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	if( option_since_record_identifier != NULL )
+	{
+		result = export_handle_set_since_record_identifier(
+			  evtxexport_export_handle,
+			  option_since_record_identifier,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set since record identifier.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported record identifier exporting all records.\n" );
+		}
+	}
+	if( option_since_written_time != NULL )
+	{
+		result = export_handle_set_since_written_time(
+			  evtxexport_export_handle,
+			  option_since_written_time,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set since written time.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported written time exporting all records.\n" );
+		}
+	}
+	if( option_record_offset != NULL )
+	{
+		result = export_handle_set_record_offset(
+			  evtxexport_export_handle,
+			  option_record_offset,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set record offset.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported record offset exporting all records.\n" );
+		}
+	}
+	if( option_filter_expression != NULL )
+	{
+		if( export_handle_set_filter_expression(
+		     evtxexport_export_handle,
+		     option_filter_expression,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set filter expression.\n" );
+
+			goto on_error;
+		}
+	}
+	for( search_string_index = 0;
+	     search_string_index < number_of_search_strings;
+	     search_string_index++ )
+	{
+		if( export_handle_append_search_string(
+		     evtxexport_export_handle,
+		     option_search_strings[ search_string_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append search string.\n" );
+
+			goto on_error;
+		}
+	}
+	for( match_value_index = 0;
+	     match_value_index < number_of_match_values;
+	     match_value_index++ )
+	{
+		if( export_handle_append_match_value(
+		     evtxexport_export_handle,
+		     option_match_values[ match_value_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append match value.\n" );
+
+			goto on_error;
+		}
+	}
+	if( deduplicate != 0 )
+	{
+		if( export_handle_set_deduplicate(
+		     evtxexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set deduplicate.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_partition_granularity != NULL )
+	{
+		result = export_handle_set_partition_granularity(
+			  evtxexport_export_handle,
+			  option_partition_granularity,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set partition granularity.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported partition granularity.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( option_timings_format == NULL )
+	 && ( verbose != 0 ) )
+	{
+		option_timings_format = _SYSTEM_STRING( "text" );
+	}
+	if( option_timings_format != NULL )
+	{
+		result = export_handle_set_timings_format(
+			  evtxexport_export_handle,
+			  option_timings_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set timings format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported timings format not printing timings.\n" );
+		}
+	}
+	if( option_maximum_number_of_records != NULL )
+	{
+		result = export_handle_set_maximum_number_of_records(
+			  evtxexport_export_handle,
+			  option_maximum_number_of_records,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of records.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum number of records exporting all records.\n" );
+		}
+	}
+	if( ( option_event_log_type == NULL )
+	 || ( result == 0 ) )
+	{
+		/* In batch mode the event log type is determined for every source file
+		 */
+		event_log_type_from_filename = 1;
+	}
+	if( ( event_log_type_from_filename != 0 )
+	 && ( option_batch_source == NULL ) )
+	{
+		result = export_handle_set_event_log_type_from_filename(
+			  evtxexport_export_handle,
+			  source,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set event log type from filename in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_resource_files_path != NULL )
+	{
+		if( export_handle_set_resource_files_path(
+		     evtxexport_export_handle,
+		     option_resource_files_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource files path in export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_software_registry_filename != NULL )
 	{
 		if( export_handle_set_software_registry_filename(
 		     evtxexport_export_handle,
@@ -478,6 +1423,43 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_message_catalog_filename != NULL )
+	{
+		if( message_catalog_initialize(
+		     &message_catalog,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize message catalog.\n" );
+
+			goto on_error;
+		}
+		if( message_catalog_open(
+		     message_catalog,
+		     option_message_catalog_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open message catalog: %" PRIs_SYSTEM ".\n",
+			 option_message_catalog_filename );
+
+			goto on_error;
+		}
+		if( export_handle_set_message_catalog(
+		     evtxexport_export_handle,
+		     message_catalog,
+		     MESSAGE_HANDLE_CATALOG_MODE_LOOKUP,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set message catalog in export handle.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_preferred_language != NULL )
 	{
 /* TODO set preferred language identifier from input */
@@ -493,9 +1475,42 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	evtxexport_export_handle->decode_profiling        = decode_profiling;
+	evtxexport_export_handle->follow                  = follow;
+	evtxexport_export_handle->lazy                    = lazy;
+	evtxexport_export_handle->live                    = live;
+	evtxexport_export_handle->newest_first            = newest_first;
+	evtxexport_export_handle->numa_affinity           = numa_affinity;
+	evtxexport_export_handle->preload                 = preload;
 	evtxexport_export_handle->use_template_definition = use_template_definition;
 	evtxexport_export_handle->verbose                 = verbose;
 
+	if( option_checkpoint_filename != NULL )
+	{
+		/* The recovered records are not exported in order of the records
+		 */
+		if( evtxexport_export_handle->export_mode != EXPORT_MODE_ITEMS )
+		{
+			fprintf(
+			 stderr,
+			 "A checkpoint is only supported in the items export mode.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_set_checkpoint_file(
+		     evtxexport_export_handle,
+		     option_checkpoint_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read checkpoint file: %" PRIs_SYSTEM ".\n",
+			 option_checkpoint_filename );
+
+			goto on_error;
+		}
+	}
+
 	if( log_handle_open(
 	     log_handle,
 	     option_log_filename,
@@ -508,31 +1523,234 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( export_handle_open_input(
-	     evtxexport_export_handle,
-	     source,
-	     &error ) != 1 )
+	if( option_batch_source != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open: %" PRIs_SYSTEM ".\n",
-		 source );
+		if( source_list_initialize(
+		     &source_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize source list.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( source_list_read(
+		     source_list,
+		     option_batch_source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read batch source: %" PRIs_SYSTEM ".\n",
+			 option_batch_source );
+
+			goto on_error;
+		}
+		if( source_list->number_of_filenames == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No source files in batch source: %" PRIs_SYSTEM ".\n",
+			 option_batch_source );
+
+			goto on_error;
+		}
+	}
+	else if( merge == 0 )
+	{
+		if( export_handle_open_input(
+		     evtxexport_export_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+	}
+	if( ( option_output_filename != NULL )
+	 && ( use_shards == 0 ) )
+	{
+		if( export_handle_open_output(
+		     evtxexport_export_handle,
+		     option_output_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open output file: %" PRIs_SYSTEM ".\n",
+			 option_output_filename );
+
+			goto on_error;
+		}
+	}
+	if( option_partition_granularity != NULL )
+	{
+		if( export_handle_open_partitioned_output(
+		     evtxexport_export_handle,
+		     option_output_directory,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open partitioned output in: %" PRIs_SYSTEM ".\n",
+			 option_output_directory );
+
+			goto on_error;
+		}
 	}
-	result = export_handle_export_file(
-	          evtxexport_export_handle,
-	          log_handle,
-	          &error );
+	if( option_batch_source != NULL )
+	{
+		result = export_handle_export_batch(
+		          evtxexport_export_handle,
+		          (const system_character_t * const *) source_list->filenames,
+		          source_list->number_of_filenames,
+		          option_output_directory,
+		          event_log_type_from_filename,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export batch.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export one or more files of the batch.\n" );
 
-	if( result == -1 )
+			batch_has_failures = 1;
+		}
+		result = 1;
+	}
+	else if( merge != 0 )
+	{
+		result = export_handle_merge_input(
+		          evtxexport_export_handle,
+		          (const system_character_t * const *) &( argv[ optind ] ),
+		          number_of_sources,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to merge files.\n" );
+
+			goto on_error;
+		}
+	}
+	else if( use_shards != 0 )
+	{
+		result = export_handle_export_shards(
+		          evtxexport_export_handle,
+		          option_output_filename,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export shards.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = export_handle_export_file(
+		          evtxexport_export_handle,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( verbose != 0 )
+	 && ( merge == 0 )
+	 && ( option_batch_source == NULL ) )
+	{
+		if( export_handle_statistics_fprint(
+		     evtxexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The timings are only measured when a single source is exported
+	 */
+	if( ( merge == 0 )
+	 && ( option_batch_source == NULL )
+	 && ( use_shards == 0 ) )
+	{
+		if( export_handle_timings_fprint(
+		     evtxexport_export_handle,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print timings.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_decode_profile_fprint(
+		     evtxexport_export_handle,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print decode profile.\n" );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_close_output(
+	     evtxexport_export_handle,
+	     &error ) != 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to export file.\n" );
+		 "Unable to close output file.\n" );
 
 		goto on_error;
 	}
+	/* The checkpoint is kept when the export was interrupted or a source file
+	 * could not be exported
+	 */
+	if( ( evtxexport_abort == 0 )
+	 && ( batch_has_failures == 0 ) )
+	{
+		if( export_handle_remove_checkpoint_file(
+		     evtxexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to remove checkpoint file.\n" );
+
+			goto on_error;
+		}
+	}
 	if( export_handle_close_input(
 	     evtxexport_export_handle,
 	     &error ) != 0 )
@@ -553,6 +1771,32 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( message_catalog != NULL )
+	{
+		if( message_catalog_free(
+		     &message_catalog,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free message catalog.\n" );
+
+			goto on_error;
+		}
+	}
+	if( source_list != NULL )
+	{
+		if( source_list_free(
+		     &source_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source list.\n" );
+
+			goto on_error;
+		}
+	}
 	if( log_handle_close(
 	     log_handle,
 	     &error ) != 0 )
@@ -573,6 +1817,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( batch_has_failures != 0 )
+	{
+		return( EXIT_FAILURE );
+	}
 	if( result == 0 )
 	{
 		fprintf(
@@ -595,6 +1843,18 @@ on_error:
 		 &evtxexport_export_handle,
 		 NULL );
 	}
+	if( message_catalog != NULL )
+	{
+		message_catalog_free(
+		 &message_catalog,
+		 NULL );
+	}
+	if( source_list != NULL )
+	{
+		source_list_free(
+		 &source_list,
+		 NULL );
+	}
 	if( log_handle != NULL )
 	{
 		log_handle_free(
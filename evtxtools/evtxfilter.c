@@ -0,0 +1,456 @@
+/*
+ * Writes the records of a Windows XML Event Viewer Log (EVTX) file that match a filter to a new file
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtxtools_getopt.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "evtxtools_signal.h"
+#include "evtxtools_unused.h"
+#include "filter_handle.h"
+
+#define EVTXFILTER_MAXIMUM_NUMBER_OF_SEARCH_STRINGS	32
+
+filter_handle_t *evtxfilter_filter_handle = NULL;
+int evtxfilter_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtxfilter to write the records of a Windows XML Event Viewer Log\n"
+	                 "(EVTX) file that match a filter to a new EVTX file\n\n" );
+
+	fprintf( stream, "Usage: evtxfilter [ -c codepage ] [ -e string ] [ -q expression ]\n"
+	                 "                  [ -hvV ] source destination\n\n" );
+
+	fprintf( stream, "\tsource:      the source file\n" );
+	fprintf( stream, "\tdestination: the destination file, which is overwritten if it\n"
+	                 "\t             exists\n\n" );
+
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-e:     only write the records that contain string, as UTF-16 or ASCII,\n"
+	                 "\t        case sensitive. Can be used multiple times to write the records\n"
+	                 "\t        that contain any of the strings\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-q:     only write the records that match expression, a subset of\n"
+	                 "\t        the XPath queries of the Windows Event Viewer such as:\n"
+	                 "\t        *[System[(EventID=4624 or EventID=4625) and Level<=3]]\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtxfilter
+ */
+void evtxfilter_signal_handler(
+      evtxtools_signal_t signal EVTXTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "evtxfilter_signal_handler";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtxfilter_abort = 1;
+
+	if( evtxfilter_filter_handle != NULL )
+	{
+		if( filter_handle_signal_abort(
+		     evtxfilter_filter_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal filter handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	system_character_t *option_search_strings[ EVTXFILTER_MAXIMUM_NUMBER_OF_SEARCH_STRINGS ];
+
+	libevtx_error_t *error                       = NULL;
+	system_character_t *destination              = NULL;
+	system_character_t *option_ascii_codepage    = NULL;
+	system_character_t *option_filter_expression = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "evtxfilter";
+	system_integer_t option                      = 0;
+	int number_of_search_strings                 = 0;
+	int result                                   = 0;
+	int search_string_index                      = 0;
+	int verbose                                  = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evtxtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+        if( evtxtools_output_initialize(
+             _IONBF,
+             &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtxoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evtxtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:e:hq:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'e':
+				if( number_of_search_strings >= EVTXFILTER_MAXIMUM_NUMBER_OF_SEARCH_STRINGS )
+				{
+					fprintf(
+					 stderr,
+					 "Too many search strings, at most %d are supported.\n",
+					 EVTXFILTER_MAXIMUM_NUMBER_OF_SEARCH_STRINGS );
+
+					usage_fprint(
+					 stdout );
+
+					return( EXIT_FAILURE );
+				}
+				option_search_strings[ number_of_search_strings++ ] = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'q':
+				option_filter_expression = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtxoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind++ ];
+
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing destination file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	destination = argv[ optind ];
+
+	if( ( option_filter_expression == NULL )
+	 && ( number_of_search_strings == 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing filter, requires an expression or a search string.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libevtx_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevtx_notify_set_verbose(
+	 verbose );
+
+	if( filter_handle_initialize(
+	     &evtxfilter_filter_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize filter handle.\n" );
+
+		goto on_error;
+	}
+	if( option_ascii_codepage != NULL )
+	{
+		result = filter_handle_set_ascii_codepage(
+		          evtxfilter_filter_handle,
+		          option_ascii_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in filter handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( option_filter_expression != NULL )
+	{
+		if( filter_handle_set_filter_expression(
+		     evtxfilter_filter_handle,
+		     option_filter_expression,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set filter expression.\n" );
+
+			goto on_error;
+		}
+	}
+	for( search_string_index = 0;
+	     search_string_index < number_of_search_strings;
+	     search_string_index++ )
+	{
+		if( filter_handle_append_search_string(
+		     evtxfilter_filter_handle,
+		     option_search_strings[ search_string_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append search string.\n" );
+
+			goto on_error;
+		}
+	}
+	if( filter_handle_open(
+	     evtxfilter_filter_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( evtxtools_signal_attach(
+	     evtxfilter_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = filter_handle_write_filtered(
+	          evtxfilter_filter_handle,
+	          destination,
+	          &error );
+
+	if( evtxtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write: %" PRIs_SYSTEM ".\n",
+		 destination );
+
+		goto on_error;
+	}
+	if( filter_handle_close(
+	     evtxfilter_filter_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close filter handle.\n" );
+
+		goto on_error;
+	}
+	if( filter_handle_free(
+	     &evtxfilter_filter_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free filter handle.\n" );
+
+		goto on_error;
+	}
+	if( evtxfilter_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Filtering: aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "Filtered records written to: %" PRIs_SYSTEM ".\n",
+	 destination );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxfilter_filter_handle != NULL )
+	{
+		filter_handle_free(
+		 &evtxfilter_filter_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
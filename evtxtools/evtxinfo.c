@@ -58,16 +58,31 @@ void usage_fprint(
 	fprintf( stream, "Use evtxinfo to determine information about a Windows XML Event Viewer\n"
 	                 "Log (EVTX) file\n\n" );
 
-	fprintf( stream, "Usage: evtxinfo [ -c codepage ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: evtxinfo [ -a sample ] [ -c codepage ] [ -j threads ]\n"
+	                 "                [ -CFghHsvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-a:     only read a stratified random sample of the chunks and\n"
+	                 "\t        scale the record statistics to estimates for the file,\n"
+	                 "\t        sample is a number of chunks, such as 64, or a percentage\n"
+	                 "\t        of the chunks, such as 5%%. Requires -s\n" );
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
 	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
 	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     verify the file header and chunk checksums instead of printing\n"
+	                 "\t        information, the exit status is 1 if a failure was found\n" );
+	fprintf( stream, "\t-F:     stop verifying at the first failure, implies -C\n" );
+	fprintf( stream, "\t-g:     print the gaps, duplicates and out of order ranges\n"
+	                 "\t        in the record identifiers\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-H:     only read the file header and the headers of the oldest\n"
+	                 "\t        and newest chunk to estimate the number of records\n" );
+	fprintf( stream, "\t-j:     number of threads used to read the source, the default is 1\n" );
+	fprintf( stream, "\t-s:     print statistics of the records, per event identifier,\n"
+	                 "\t        provider, level and hour, and of the library\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -124,13 +139,21 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libevtx_error_t *error                    = NULL;
-	system_character_t *option_ascii_codepage = NULL;
-	system_character_t *source                = NULL;
-	char *program                             = "evtxinfo";
-	system_integer_t option                   = 0;
-	int result                                = 0;
-	int verbose                               = 0;
+	libevtx_error_t *error                       = NULL;
+	system_character_t *option_ascii_codepage    = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_sample            = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "evtxinfo";
+	system_integer_t option                      = 0;
+	uint8_t header_only                          = 0;
+	uint8_t stop_on_failure                      = 0;
+	uint8_t verify_only                          = 0;
+	int print_gaps                               = 0;
+	int print_statistics                         = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+	int verify_result                            = 1;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -165,7 +188,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = evtxtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "a:c:CFghHj:svV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -181,17 +204,53 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'a':
+				option_sample = optarg;
+
+				break;
+
 			case (system_integer_t) 'c':
 				option_ascii_codepage = optarg;
 
 				break;
 
+			case (system_integer_t) 'C':
+				verify_only = 1;
+
+				break;
+
+			case (system_integer_t) 'F':
+				stop_on_failure = 1;
+				verify_only     = 1;
+
+				break;
+
+			case (system_integer_t) 'g':
+				print_gaps = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'H':
+				header_only = 1;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -215,6 +274,35 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( ( header_only != 0 )
+	 && ( ( verify_only != 0 )
+	  || ( print_statistics != 0 )
+	  || ( print_gaps != 0 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Header only mode cannot be combined with verification, statistics or gaps.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( option_sample != NULL )
+	 && ( ( print_statistics == 0 )
+	  || ( verify_only != 0 )
+	  || ( header_only != 0 )
+	  || ( print_gaps != 0 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "A sample requires statistics and cannot be combined with verification, header only mode or gaps.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
 	source = argv[ optind ];
 
 	libcnotify_verbose_set(
@@ -235,6 +323,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	evtxinfo_info_handle->verify_only = verify_only;
+	evtxinfo_info_handle->header_only = header_only;
+
 	if( option_ascii_codepage != NULL )
 	{
 		result = info_handle_set_ascii_codepage(
@@ -257,6 +348,50 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		result = info_handle_set_number_of_threads(
+		          evtxinfo_info_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	if( option_sample != NULL )
+	{
+		result = info_handle_set_sample(
+		          evtxinfo_info_handle,
+		          option_sample,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set sample.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported sample reading all chunks.\n" );
+		}
+	}
 	result = info_handle_set_event_log_type_from_filename(
 	          evtxinfo_info_handle,
 	          source,
@@ -282,9 +417,25 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( info_handle_file_fprint(
-	     evtxinfo_info_handle,
-	     &error ) != 1 )
+	if( verify_only != 0 )
+	{
+		verify_result = info_handle_verify_fprint(
+		                 evtxinfo_info_handle,
+		                 stop_on_failure,
+		                 &error );
+
+		if( verify_result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify file.\n" );
+
+			goto on_error;
+		}
+	}
+	else if( info_handle_file_fprint(
+	          evtxinfo_info_handle,
+	          &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
@@ -292,6 +443,55 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_record_statistics_fprint(
+		     evtxinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print record statistics.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_statistics_fprint(
+		     evtxinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
+	if( print_gaps != 0 )
+	{
+		if( info_handle_identifier_gaps_fprint(
+		     evtxinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print record identifier gaps.\n" );
+
+			goto on_error;
+		}
+	}
+	if( verbose != 0 )
+	{
+		if( info_handle_memory_usage_fprint(
+		     evtxinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print memory usage.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close(
 	     evtxinfo_info_handle,
 	     &error ) != 0 )
@@ -312,6 +512,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( verify_result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,713 @@
+/*
+ * Builds a message catalog of the message strings and templates used by
+ * Windows XML Event Viewer Log (EVTX) files
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtxtools_getopt.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "evtxtools_signal.h"
+#include "evtxtools_unused.h"
+#include "export_handle.h"
+#include "log_handle.h"
+#include "message_catalog.h"
+
+/* The records are exported to the null device, only the lookups are of interest
+ */
+#if defined( WINAPI )
+#define EVTXMESSAGES_NULL_DEVICE	_SYSTEM_STRING( "NUL" )
+#else
+#define EVTXMESSAGES_NULL_DEVICE	_SYSTEM_STRING( "/dev/null" )
+#endif
+
+export_handle_t *evtxmessages_export_handle = NULL;
+int evtxmessages_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtxmessages to build a message catalog of the message strings\n"
+	                 "and event templates used by Windows XML Event Viewer Log (EVTX) files.\n\n" );
+
+	fprintf( stream, "Usage: evtxmessages [ -c codepage ] [ -C cache_size ]\n"
+	                 "                    [ -p resource_files_path ] [ -r registy_files_path ]\n"
+	                 "                    [ -s system_file ] [ -S software_file ]\n"
+	                 "                    [ -t event_log_type ] [ -hvV ]\n"
+	                 "                    build catalog_file source [ source ... ]\n\n" );
+
+	fprintf( stream, "\tbuild:        builds the message catalog\n" );
+	fprintf( stream, "\tcatalog_file: the message catalog file that is created\n" );
+	fprintf( stream, "\tsource:       the source file of which the message strings\n"
+	                 "\t              and event templates are added to the catalog\n\n" );
+
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     maximum number of cached resource files, the default is 64\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
+	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
+	                 "\t        (Windows) Registry file\n" );
+	fprintf( stream, "\t-s:     filename of the SYSTEM (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-S:     filename of the SOFTWARE (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-t:     event log type, options: application, security, system\n"
+	                 "\t        if not specified the event log type is determined based\n"
+	                 "\t        on the filename of each source.\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtxmessages
+ */
+void evtxmessages_signal_handler(
+      evtxtools_signal_t signal EVTXTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "evtxmessages_signal_handler";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtxmessages_abort = 1;
+
+	if( evtxmessages_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     evtxmessages_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                              = NULL;
+	log_handle_t *log_handle                              = NULL;
+	message_catalog_t *message_catalog                    = NULL;
+	system_character_t *catalog_filename                  = NULL;
+	system_character_t *option_ascii_codepage             = NULL;
+	system_character_t *option_cache_size                 = NULL;
+	system_character_t *option_event_log_type             = NULL;
+	system_character_t *option_resource_files_path        = NULL;
+	system_character_t *option_registry_directory_name    = NULL;
+	system_character_t *option_software_registry_filename = NULL;
+	system_character_t *option_system_registry_filename   = NULL;
+	system_character_t *source                            = NULL;
+	char *program                                         = "evtxmessages";
+	system_integer_t option                               = 0;
+	int result                                            = 0;
+	int source_index                                      = 0;
+	int verbose                                           = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evtxtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtxoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evtxtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:C:hp:r:s:S:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'C':
+				option_cache_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'p':
+				option_resource_files_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_registry_directory_name = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_system_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_software_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_event_log_type = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtxoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing command.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( system_string_compare(
+	     argv[ optind ],
+	     _SYSTEM_STRING( "build" ),
+	     6 ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported command: %" PRIs_SYSTEM "\n",
+		 argv[ optind ] );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( optind + 2 ) >= argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing catalog or source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	catalog_filename = argv[ optind + 1 ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libevtx_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevtx_notify_set_verbose(
+	 verbose );
+
+	if( evtxtools_signal_attach(
+	     evtxmessages_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( log_handle_initialize(
+	     &log_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize log handle.\n" );
+
+		goto on_error;
+	}
+	if( log_handle_open(
+	     log_handle,
+	     NULL,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open log handle.\n" );
+
+		goto on_error;
+	}
+	if( message_catalog_initialize(
+	     &message_catalog,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize message catalog.\n" );
+
+		goto on_error;
+	}
+	/* The records of every source are exported with the message catalog in record mode,
+	 * which adds the values that are looked up to the catalog
+	 */
+	for( source_index = optind + 2;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( evtxmessages_abort != 0 )
+		{
+			break;
+		}
+		source = argv[ source_index ];
+
+		if( export_handle_initialize(
+		     &evtxmessages_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize export handle.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_set_message_catalog(
+		     evtxmessages_export_handle,
+		     message_catalog,
+		     MESSAGE_HANDLE_CATALOG_MODE_RECORD,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set message catalog in export handle.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_set_export_mode(
+		     evtxmessages_export_handle,
+		     _SYSTEM_STRING( "all" ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export mode.\n" );
+
+			goto on_error;
+		}
+		if( option_ascii_codepage != NULL )
+		{
+			result = export_handle_set_ascii_codepage(
+			          evtxmessages_export_handle,
+			          option_ascii_codepage,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set ASCII codepage in export handle.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+			}
+		}
+		if( option_cache_size != NULL )
+		{
+			result = export_handle_set_maximum_number_of_cached_resource_files(
+				  evtxmessages_export_handle,
+				  option_cache_size,
+				  &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set maximum number of cached resource files.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported maximum number of cached resource files defaulting to: %d.\n",
+				 RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES );
+			}
+		}
+		result = 0;
+
+		if( option_event_log_type != NULL )
+		{
+			result = export_handle_set_event_log_type(
+			          evtxmessages_export_handle,
+			          option_event_log_type,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set event log type in export handle.\n" );
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			if( export_handle_set_event_log_type_from_filename(
+			     evtxmessages_export_handle,
+			     source,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set event log type from filename in export handle.\n" );
+
+				goto on_error;
+			}
+		}
+		if( option_resource_files_path != NULL )
+		{
+			if( export_handle_set_resource_files_path(
+			     evtxmessages_export_handle,
+			     option_resource_files_path,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set resource files path in export handle.\n" );
+
+				goto on_error;
+			}
+		}
+		if( option_software_registry_filename != NULL )
+		{
+			if( export_handle_set_software_registry_filename(
+			     evtxmessages_export_handle,
+			     option_software_registry_filename,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set software registry filename in export handle.\n" );
+
+				goto on_error;
+			}
+		}
+		if( option_system_registry_filename != NULL )
+		{
+			if( export_handle_set_system_registry_filename(
+			     evtxmessages_export_handle,
+			     option_system_registry_filename,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set system registry filename in export handle.\n" );
+
+				goto on_error;
+			}
+		}
+		if( option_registry_directory_name != NULL )
+		{
+			if( export_handle_set_registry_directory_name(
+			     evtxmessages_export_handle,
+			     option_registry_directory_name,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set registry directory name in export handle.\n" );
+
+				goto on_error;
+			}
+		}
+		evtxmessages_export_handle->use_template_definition = 1;
+		evtxmessages_export_handle->verbose                 = verbose;
+
+		if( export_handle_open_input(
+		     evtxmessages_export_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+		if( export_handle_open_output(
+		     evtxmessages_export_handle,
+		     EVTXMESSAGES_NULL_DEVICE,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open output file: %" PRIs_SYSTEM ".\n",
+			 EVTXMESSAGES_NULL_DEVICE );
+
+			goto on_error;
+		}
+		if( export_handle_export_file(
+		     evtxmessages_export_handle,
+		     log_handle,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export file: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+		if( export_handle_close_output(
+		     evtxmessages_export_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close output file.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_close_input(
+		     evtxmessages_export_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close export handle.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_free(
+		     &evtxmessages_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( evtxmessages_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Building message catalog: aborted.\n" );
+
+		goto on_error;
+	}
+	if( message_catalog_write(
+	     message_catalog,
+	     catalog_filename,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write message catalog: %" PRIs_SYSTEM ".\n",
+		 catalog_filename );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Message catalog: %" PRIs_SYSTEM " written with %d entries.\n",
+	 catalog_filename,
+	 message_catalog->number_of_entries );
+
+	if( message_catalog_free(
+	     &message_catalog,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free message catalog.\n" );
+
+		goto on_error;
+	}
+	if( log_handle_close(
+	     log_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close log handle.\n" );
+
+		goto on_error;
+	}
+	if( log_handle_free(
+	     &log_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free log handle.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxmessages_export_handle != NULL )
+	{
+		export_handle_free(
+		 &evtxmessages_export_handle,
+		 NULL );
+	}
+	if( message_catalog != NULL )
+	{
+		message_catalog_free(
+		 &message_catalog,
+		 NULL );
+	}
+	if( log_handle != NULL )
+	{
+		log_handle_free(
+		 &log_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,64 @@
+/*
+ * USDT static tracepoint (probe) definitions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTXTOOLS_PROBES_H )
+#define _EVTXTOOLS_PROBES_H
+
+#include <common.h>
+#include <types.h>
+
+/* The probes are USDT (DTRACE_PROBE) static tracepoints that are only compiled in
+ * when configured with --enable-probes, otherwise the probe macros do not
+ * evaluate their arguments
+ */
+#if defined( HAVE_PROBES ) && defined( HAVE_SYS_SDT_H )
+#include <sys/sdt.h>
+
+#define EVTXTOOLS_PROBES_ENABLED	1
+
+/* Fired after a resource file was opened
+ * Arguments: filename as a system string, 1 if the file is memory mapped or 0 if not
+ */
+#define EVTXTOOLS_PROBE_RESOURCE_FILE_OPEN( filename, is_memory_mapped ) \
+	DTRACE_PROBE2( evtxtools, resource__file__open, filename, is_memory_mapped )
+
+/* Fired when a message string is retrieved from the message string cache
+ * Arguments: message string identifier
+ */
+#define EVTXTOOLS_PROBE_MESSAGE_CACHE_HIT( message_string_identifier ) \
+	DTRACE_PROBE1( evtxtools, message__cache__hit, message_string_identifier )
+
+/* Fired after a message string was looked up in the message table resource
+ * Arguments: message string identifier, language identifier, result
+ */
+#define EVTXTOOLS_PROBE_MESSAGE_LOOKUP( message_string_identifier, language_identifier, result ) \
+	DTRACE_PROBE3( evtxtools, message__lookup, message_string_identifier, language_identifier, result )
+
+#else
+
+#define EVTXTOOLS_PROBE_RESOURCE_FILE_OPEN( filename, is_memory_mapped )
+#define EVTXTOOLS_PROBE_MESSAGE_CACHE_HIT( message_string_identifier )
+#define EVTXTOOLS_PROBE_MESSAGE_LOOKUP( message_string_identifier, language_identifier, result )
+
+#endif /* defined( HAVE_PROBES ) && defined( HAVE_SYS_SDT_H ) */
+
+#endif /* !defined( _EVTXTOOLS_PROBES_H ) */
+
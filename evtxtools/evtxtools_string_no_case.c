@@ -0,0 +1,295 @@
+/*
+ * Case insensitive string functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#elif !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#include <ctype.h>
+#endif
+
+#include "evtxtools_string_no_case.h"
+
+#if defined( EVTXTOOLS_STRING_NO_CASE_HAVE_SSE2 )
+#include <emmintrin.h>
+
+#elif defined( EVTXTOOLS_STRING_NO_CASE_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* Case folds a character
+ * ASCII characters are folded directly, other characters are folded
+ * by the C library unless EVTXTOOLS_STRING_NO_CASE_FLAG_ASCII_ONLY is set
+ * Returns the case folded character
+ */
+system_character_t evtxtools_string_no_case_fold_character(
+                    system_character_t character,
+                    uint8_t flags )
+{
+	if( ( character >= (system_character_t) 'A' )
+	 && ( character <= (system_character_t) 'Z' ) )
+	{
+		return( character + ( (system_character_t) 'a' - (system_character_t) 'A' ) );
+	}
+	else if( character == (system_character_t) '/' )
+	{
+		if( ( flags & EVTXTOOLS_STRING_NO_CASE_FLAG_PATH_SEPARATORS ) != 0 )
+		{
+			return( (system_character_t) '\\' );
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	else if( ( (uint32_t) character > 0x7f )
+	      && ( ( flags & EVTXTOOLS_STRING_NO_CASE_FLAG_ASCII_ONLY ) == 0 ) )
+	{
+		return( (system_character_t) towlower( (wint_t) character ) );
+	}
+#else
+	else if( ( (uint8_t) character > 0x7f )
+	      && ( ( flags & EVTXTOOLS_STRING_NO_CASE_FLAG_ASCII_ONLY ) == 0 ) )
+	{
+		return( (system_character_t) tolower( (int) (unsigned char) character ) );
+	}
+#endif
+	return( character );
+}
+
+/* Compares two strings of the same length ignoring case
+ * Narrow strings are compared 16 characters at a time (SSE2 or NEON) if available
+ * at compile time, as long as the characters of both strings are ASCII. The remaining
+ * characters, starting with the first block that contains a non-ASCII character,
+ * are compared one at a time
+ * Returns 1 if the strings are equal or 0 if not
+ */
+int evtxtools_string_no_case_compare(
+     const system_character_t *first_string,
+     const system_character_t *second_string,
+     size_t string_length,
+     uint8_t flags )
+{
+#if defined( EVTXTOOLS_STRING_NO_CASE_HAVE_SSE2 )
+	__m128i backslash_vector    = _mm_set1_epi8( (char) '\\' );
+	__m128i case_vector         = _mm_set1_epi8( (char) 0x20 );
+	__m128i first_vector        = _mm_setzero_si128();
+	__m128i lower_bound_vector  = _mm_set1_epi8( (char) ( 'A' - 1 ) );
+	__m128i mask_vector         = _mm_setzero_si128();
+	__m128i second_vector       = _mm_setzero_si128();
+	__m128i slash_vector        = _mm_set1_epi8( (char) '/' );
+	__m128i upper_bound_vector  = _mm_set1_epi8( (char) ( 'Z' + 1 ) );
+
+#elif defined( EVTXTOOLS_STRING_NO_CASE_HAVE_NEON )
+	uint8x16_t backslash_vector = vdupq_n_u8( (uint8_t) '\\' );
+	uint8x16_t case_vector      = vdupq_n_u8( 0x20 );
+	uint8x16_t first_vector     = vdupq_n_u8( 0 );
+	uint8x16_t mask_vector      = vdupq_n_u8( 0 );
+	uint8x16_t second_vector    = vdupq_n_u8( 0 );
+	uint8x16_t slash_vector     = vdupq_n_u8( (uint8_t) '/' );
+	uint8x16_t upper_a_vector   = vdupq_n_u8( (uint8_t) 'A' );
+	uint8x16_t upper_z_vector   = vdupq_n_u8( (uint8_t) 'Z' );
+#endif
+	size_t string_index         = 0;
+
+	if( ( first_string == NULL )
+	 || ( second_string == NULL ) )
+	{
+		return( 0 );
+	}
+	if( first_string == second_string )
+	{
+		return( 1 );
+	}
+#if defined( EVTXTOOLS_STRING_NO_CASE_HAVE_SSE2 )
+	while( ( string_length - string_index ) >= 16 )
+	{
+		first_vector = _mm_loadu_si128(
+		                (const __m128i *) &( first_string[ string_index ] ) );
+
+		second_vector = _mm_loadu_si128(
+		                 (const __m128i *) &( second_string[ string_index ] ) );
+
+		/* A block that contains a non-ASCII character is compared one character at a time
+		 */
+		if( _mm_movemask_epi8(
+		     _mm_or_si128(
+		      first_vector,
+		      second_vector ) ) != 0 )
+		{
+			break;
+		}
+		/* The ASCII characters are signed positive hence A to Z can be determined
+		 * with signed comparisons
+		 */
+		mask_vector = _mm_and_si128(
+		               _mm_cmpgt_epi8(
+		                first_vector,
+		                lower_bound_vector ),
+		               _mm_cmplt_epi8(
+		                first_vector,
+		                upper_bound_vector ) );
+
+		first_vector = _mm_or_si128(
+		                first_vector,
+		                _mm_and_si128(
+		                 mask_vector,
+		                 case_vector ) );
+
+		mask_vector = _mm_and_si128(
+		               _mm_cmpgt_epi8(
+		                second_vector,
+		                lower_bound_vector ),
+		               _mm_cmplt_epi8(
+		                second_vector,
+		                upper_bound_vector ) );
+
+		second_vector = _mm_or_si128(
+		                 second_vector,
+		                 _mm_and_si128(
+		                  mask_vector,
+		                  case_vector ) );
+
+		if( ( flags & EVTXTOOLS_STRING_NO_CASE_FLAG_PATH_SEPARATORS ) != 0 )
+		{
+			mask_vector = _mm_cmpeq_epi8(
+			               first_vector,
+			               slash_vector );
+
+			first_vector = _mm_or_si128(
+			                _mm_andnot_si128(
+			                 mask_vector,
+			                 first_vector ),
+			                _mm_and_si128(
+			                 mask_vector,
+			                 backslash_vector ) );
+
+			mask_vector = _mm_cmpeq_epi8(
+			               second_vector,
+			               slash_vector );
+
+			second_vector = _mm_or_si128(
+			                 _mm_andnot_si128(
+			                  mask_vector,
+			                  second_vector ),
+			                 _mm_and_si128(
+			                  mask_vector,
+			                  backslash_vector ) );
+		}
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      first_vector,
+		      second_vector ) ) != 0xffff )
+		{
+			return( 0 );
+		}
+		string_index += 16;
+	}
+#elif defined( EVTXTOOLS_STRING_NO_CASE_HAVE_NEON )
+	while( ( string_length - string_index ) >= 16 )
+	{
+		first_vector = vld1q_u8(
+		                (const uint8_t *) &( first_string[ string_index ] ) );
+
+		second_vector = vld1q_u8(
+		                 (const uint8_t *) &( second_string[ string_index ] ) );
+
+		/* A block that contains a non-ASCII character is compared one character at a time
+		 */
+		if( vmaxvq_u8(
+		     vorrq_u8(
+		      first_vector,
+		      second_vector ) ) > 0x7f )
+		{
+			break;
+		}
+		mask_vector = vandq_u8(
+		               vcgeq_u8(
+		                first_vector,
+		                upper_a_vector ),
+		               vcleq_u8(
+		                first_vector,
+		                upper_z_vector ) );
+
+		first_vector = vorrq_u8(
+		                first_vector,
+		                vandq_u8(
+		                 mask_vector,
+		                 case_vector ) );
+
+		mask_vector = vandq_u8(
+		               vcgeq_u8(
+		                second_vector,
+		                upper_a_vector ),
+		               vcleq_u8(
+		                second_vector,
+		                upper_z_vector ) );
+
+		second_vector = vorrq_u8(
+		                 second_vector,
+		                 vandq_u8(
+		                  mask_vector,
+		                  case_vector ) );
+
+		if( ( flags & EVTXTOOLS_STRING_NO_CASE_FLAG_PATH_SEPARATORS ) != 0 )
+		{
+			first_vector = vbslq_u8(
+			                vceqq_u8(
+			                 first_vector,
+			                 slash_vector ),
+			                backslash_vector,
+			                first_vector );
+
+			second_vector = vbslq_u8(
+			                 vceqq_u8(
+			                  second_vector,
+			                  slash_vector ),
+			                 backslash_vector,
+			                 second_vector );
+		}
+		if( vminvq_u8(
+		     vceqq_u8(
+		      first_vector,
+		      second_vector ) ) != 0xff )
+		{
+			return( 0 );
+		}
+		string_index += 16;
+	}
+#endif
+	while( string_index < string_length )
+	{
+		if( first_string[ string_index ] != second_string[ string_index ] )
+		{
+			if( evtxtools_string_no_case_fold_character(
+			     first_string[ string_index ],
+			     flags ) != evtxtools_string_no_case_fold_character(
+			                 second_string[ string_index ],
+			                 flags ) )
+			{
+				return( 0 );
+			}
+		}
+		string_index++;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,74 @@
+/*
+ * Case insensitive string functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTXTOOLS_STRING_NO_CASE_H )
+#define _EVTXTOOLS_STRING_NO_CASE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The vector instructions used to compare narrow strings, determined at compile time
+ */
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define EVTXTOOLS_STRING_NO_CASE_HAVE_SSE2
+#endif
+
+#if defined( __ARM_NEON ) && defined( __aarch64__ )
+#define EVTXTOOLS_STRING_NO_CASE_HAVE_NEON
+#endif
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* The case insensitive comparison flags
+ */
+enum EVTXTOOLS_STRING_NO_CASE_FLAGS
+{
+	/* Only ignore the case of ASCII characters
+	 */
+	EVTXTOOLS_STRING_NO_CASE_FLAG_ASCII_ONLY		= 0x01,
+
+	/* Treat / and \ as the same path segment separator
+	 */
+	EVTXTOOLS_STRING_NO_CASE_FLAG_PATH_SEPARATORS		= 0x02
+};
+
+system_character_t evtxtools_string_no_case_fold_character(
+                    system_character_t character,
+                    uint8_t flags );
+
+int evtxtools_string_no_case_compare(
+     const system_character_t *first_string,
+     const system_character_t *second_string,
+     size_t string_length,
+     uint8_t flags );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTXTOOLS_STRING_NO_CASE_H ) */
+
@@ -0,0 +1,506 @@
+/*
+ * Export checkpoint
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "export_checkpoint.h"
+
+/* The checkpoint file consists of:
+ * offset	size	description
+ * 0		8	signature "evtxckpt"
+ * 8		4	input index (little-endian)
+ * 12		4	export index (little-endian)
+ * 16		8	output offset (little-endian)
+ * 24		4	number of JSON records (little-endian)
+ */
+const uint8_t export_checkpoint_signature[ 8 ] = { 'e', 'v', 't', 'x', 'c', 'k', 'p', 't' };
+
+/* Creates an export checkpoint
+ * Make sure the value export_checkpoint is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_checkpoint_initialize(
+     export_checkpoint_t **export_checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_checkpoint_initialize";
+	size_t filename_size  = 0;
+
+	if( export_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_checkpoint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export checkpoint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_size = system_string_length(
+	                 filename ) + 1;
+
+	*export_checkpoint = memory_allocate_structure(
+	                      export_checkpoint_t );
+
+	if( *export_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_checkpoint,
+	     0,
+	     sizeof( export_checkpoint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export checkpoint.",
+		 function );
+
+		memory_free(
+		 *export_checkpoint );
+
+		*export_checkpoint = NULL;
+
+		return( -1 );
+	}
+	( *export_checkpoint )->filename = system_string_allocate(
+	                                    filename_size );
+
+	if( ( *export_checkpoint )->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *export_checkpoint )->filename,
+	     filename,
+	     filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *export_checkpoint != NULL )
+	{
+		if( ( *export_checkpoint )->filename != NULL )
+		{
+			memory_free(
+			 ( *export_checkpoint )->filename );
+		}
+		memory_free(
+		 *export_checkpoint );
+
+		*export_checkpoint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int export_checkpoint_free(
+     export_checkpoint_t **export_checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "export_checkpoint_free";
+
+	if( export_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_checkpoint != NULL )
+	{
+		memory_free(
+		 ( *export_checkpoint )->filename );
+
+		memory_free(
+		 *export_checkpoint );
+
+		*export_checkpoint = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the checkpoint file of a previous export
+ * The checkpoint is resumable after a successful read
+ * Returns 1 if successful, 0 if the checkpoint file does not exist or -1 on error
+ */
+int export_checkpoint_read(
+     export_checkpoint_t *export_checkpoint,
+     libcerror_error_t **error )
+{
+	uint8_t checkpoint_data[ EXPORT_CHECKPOINT_FILE_SIZE + 1 ];
+
+	FILE *stream                    = NULL;
+	static char *function           = "export_checkpoint_read";
+	size_t read_count               = 0;
+	uint64_t output_offset          = 0;
+	uint32_t export_index           = 0;
+	uint32_t input_index            = 0;
+	uint32_t number_of_json_records = 0;
+
+	if( export_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          export_checkpoint->filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          export_checkpoint->filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reading one more byte than the checkpoint size detects trailing data
+	 */
+	read_count = file_stream_read(
+	              stream,
+	              checkpoint_data,
+	              EXPORT_CHECKPOINT_FILE_SIZE + 1 );
+
+	file_stream_close(
+	 stream );
+
+	if( read_count != EXPORT_CHECKPOINT_FILE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: invalid checkpoint file - unsupported size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     checkpoint_data,
+	     export_checkpoint_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid checkpoint file - unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( checkpoint_data[ 8 ] ),
+	 input_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( checkpoint_data[ 12 ] ),
+	 export_index );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( checkpoint_data[ 16 ] ),
+	 output_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( checkpoint_data[ 24 ] ),
+	 number_of_json_records );
+
+	if( ( input_index > (uint32_t) INT_MAX )
+	 || ( export_index > (uint32_t) INT_MAX )
+	 || ( number_of_json_records > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid checkpoint file - value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	export_checkpoint->input_index            = (int) input_index;
+	export_checkpoint->export_index           = (int) export_index;
+	export_checkpoint->output_offset          = output_offset;
+	export_checkpoint->number_of_json_records = (int) number_of_json_records;
+	export_checkpoint->current_input_index    = (int) input_index;
+	export_checkpoint->is_resumable           = 1;
+
+	return( 1 );
+}
+
+/* Writes the checkpoint file
+ * The output must be flushed up to the output offset before the checkpoint is written
+ * The checkpoint contains the written values after a successful write
+ * Returns 1 if successful or -1 on error
+ */
+int export_checkpoint_write(
+     export_checkpoint_t *export_checkpoint,
+     int input_index,
+     int export_index,
+     uint64_t output_offset,
+     int number_of_json_records,
+     libcerror_error_t **error )
+{
+	uint8_t checkpoint_data[ EXPORT_CHECKPOINT_FILE_SIZE ];
+
+	FILE *stream          = NULL;
+	static char *function = "export_checkpoint_write";
+	int result            = 1;
+
+	if( export_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_index < 0 )
+	 || ( export_index < 0 )
+	 || ( number_of_json_records < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid checkpoint value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     checkpoint_data,
+	     export_checkpoint_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( checkpoint_data[ 8 ] ),
+	 (uint32_t) input_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( checkpoint_data[ 12 ] ),
+	 (uint32_t) export_index );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( checkpoint_data[ 16 ] ),
+	 output_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( checkpoint_data[ 24 ] ),
+	 (uint32_t) number_of_json_records );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          export_checkpoint->filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          export_checkpoint->filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     stream,
+	     checkpoint_data,
+	     EXPORT_CHECKPOINT_FILE_SIZE ) != EXPORT_CHECKPOINT_FILE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint file.",
+		 function );
+
+		result = -1;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		export_checkpoint->input_index            = input_index;
+		export_checkpoint->export_index           = export_index;
+		export_checkpoint->output_offset          = output_offset;
+		export_checkpoint->number_of_json_records = number_of_json_records;
+	}
+	return( result );
+}
+
+/* Removes the checkpoint file after the export completed
+ * Returns 1 if successful or -1 on error
+ */
+int export_checkpoint_remove(
+     export_checkpoint_t *export_checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "export_checkpoint_remove";
+	int result            = 0;
+
+	if( export_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = _wremove(
+	          export_checkpoint->filename );
+#else
+	result = remove(
+	          export_checkpoint->filename );
+#endif
+	if( ( result != 0 )
+	 && ( errno != ENOENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	export_checkpoint->is_resumable = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * Export checkpoint
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_CHECKPOINT_H )
+#define _EXPORT_CHECKPOINT_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the checkpoint file
+ */
+#define EXPORT_CHECKPOINT_FILE_SIZE	28
+
+typedef struct export_checkpoint export_checkpoint_t;
+
+struct export_checkpoint
+{
+	/* The checkpoint filename
+	 */
+	system_character_t *filename;
+
+	/* Value to indicate the checkpoint was read from an export
+	 * that did not complete and the export should be resumed
+	 */
+	int is_resumable;
+
+	/* The index of the input file in the batch
+	 */
+	int input_index;
+
+	/* The index of the next record to export within the records to export of the input file
+	 */
+	int export_index;
+
+	/* The offset in the output file up to which the data was written
+	 */
+	uint64_t output_offset;
+
+	/* The number of JSON records written to the output file
+	 */
+	int number_of_json_records;
+
+	/* The index of the input file in the batch that is currently exported
+	 */
+	int current_input_index;
+};
+
+int export_checkpoint_initialize(
+     export_checkpoint_t **export_checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_checkpoint_free(
+     export_checkpoint_t **export_checkpoint,
+     libcerror_error_t **error );
+
+int export_checkpoint_read(
+     export_checkpoint_t *export_checkpoint,
+     libcerror_error_t **error );
+
+int export_checkpoint_write(
+     export_checkpoint_t *export_checkpoint,
+     int input_index,
+     int export_index,
+     uint64_t output_offset,
+     int number_of_json_records,
+     libcerror_error_t **error );
+
+int export_checkpoint_remove(
+     export_checkpoint_t *export_checkpoint,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_CHECKPOINT_H ) */
+
@@ -19,6 +19,7 @@
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -26,21 +27,40 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "chunk_sampler.h"
+#include "compressed_file_io_handle.h"
+#include "compressed_output_stream.h"
+#include "event_message_cache.h"
 #include "evtxinput.h"
+#include "evtxtools_libbfio.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libcnotify.h"
 #include "evtxtools_libclocale.h"
+#include "evtxtools_libcpath.h"
 #include "evtxtools_libevtx.h"
-#include "evtxtools_libfdatetime.h"
-#include "evtxtools_libfguid.h"
 #include "export_handle.h"
+#include "filetime_formatter.h"
 #include "log_handle.h"
+#include "message_catalog.h"
 #include "message_handle.h"
 #include "message_string.h"
-#include "resource_file.h"
+#include "network_stream.h"
+#include "output_writer.h"
+#include "provider_fields.h"
+#include "template_definition_cache.h"
 
 #define EXPORT_HANDLE_NOTIFY_STREAM		stdout
 
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_DECODE_PROFILE_ENTRIES	20
+
 const char *export_handle_get_event_log_key_name(
              int event_log_type )
 {
@@ -176,6 +196,45 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
+	if( template_definition_cache_initialize(
+	     &( ( *export_handle )->template_definition_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( event_message_cache_initialize(
+	     &( ( *export_handle )->event_message_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event message cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( filetime_formatter_initialize(
+	     &( ( *export_handle )->filetime_formatter ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create FILETIME formatter.",
+		 function );
+
+		goto on_error;
+	}
 	if( libevtx_file_initialize(
 	     &( ( *export_handle )->input_file ),
 	     error ) != 1 )
@@ -189,17 +248,56 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
-	( *export_handle )->export_mode    = EXPORT_MODE_ITEMS;
-	( *export_handle )->export_format  = EXPORT_FORMAT_TEXT;
-	( *export_handle )->event_log_type = EVTXTOOLS_EVENT_LOG_TYPE_UNKNOWN;
-	( *export_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
-	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
+	if( output_writer_initialize(
+	     &( ( *export_handle )->output_writer ),
+	     EXPORT_HANDLE_NOTIFY_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->export_mode       = EXPORT_MODE_ITEMS;
+	( *export_handle )->export_format     = EXPORT_FORMAT_TEXT;
+	( *export_handle )->number_of_threads = 1;
+	( *export_handle )->event_log_type    = EVTXTOOLS_EVENT_LOG_TYPE_UNKNOWN;
+	( *export_handle )->ascii_codepage    = LIBEVTX_CODEPAGE_WINDOWS_1252;
+	( *export_handle )->notify_stream     = EXPORT_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->input_file != NULL )
+		{
+			libevtx_file_free(
+			 &( ( *export_handle )->input_file ),
+			 NULL );
+		}
+		if( ( *export_handle )->filetime_formatter != NULL )
+		{
+			filetime_formatter_free(
+			 &( ( *export_handle )->filetime_formatter ),
+			 NULL );
+		}
+		if( ( *export_handle )->event_message_cache != NULL )
+		{
+			event_message_cache_free(
+			 &( ( *export_handle )->event_message_cache ),
+			 NULL );
+		}
+		if( ( *export_handle )->template_definition_cache != NULL )
+		{
+			template_definition_cache_free(
+			 &( ( *export_handle )->template_definition_cache ),
+			 NULL );
+		}
 		if( ( *export_handle )->message_handle != NULL )
 		{
 			message_handle_free(
@@ -221,8 +319,9 @@ int export_handle_free(
      export_handle_t **export_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_free";
-	int result            = 1;
+	static char *function    = "export_handle_free";
+	int result               = 1;
+	int scratch_string_index = 0;
 
 	if( export_handle == NULL )
 	{
@@ -266,6 +365,45 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( event_message_cache_free(
+		     &( ( *export_handle )->event_message_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free event message cache.",
+			 function );
+
+			result = -1;
+		}
+		if( template_definition_cache_free(
+		     &( ( *export_handle )->template_definition_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template definition cache.",
+			 function );
+
+			result = -1;
+		}
+		if( filetime_formatter_free(
+		     &( ( *export_handle )->filetime_formatter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free FILETIME formatter.",
+			 function );
+
+			result = -1;
+		}
 		if( libevtx_file_free(
 		     &( ( *export_handle )->input_file ),
 		     error ) != 1 )
@@ -279,6 +417,135 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( ( *export_handle )->partition_writer != NULL )
+		{
+			( *export_handle )->output_writer = ( *export_handle )->unpartitioned_output_writer;
+
+			if( partition_writer_free(
+			     &( ( *export_handle )->partition_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->output_writer != NULL )
+		{
+			if( output_writer_free(
+			     &( ( *export_handle )->output_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->record_filter != NULL )
+		{
+			if( libevtx_record_filter_free(
+			     &( ( *export_handle )->record_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->chunk_sampler != NULL )
+		{
+			if( chunk_sampler_free(
+			     &( ( *export_handle )->chunk_sampler ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk sampler.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->record_hash_set != NULL )
+		{
+			if( record_hash_set_free(
+			     &( ( *export_handle )->record_hash_set ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record hash set.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->checkpoint != NULL )
+		{
+			if( export_checkpoint_free(
+			     &( ( *export_handle )->checkpoint ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free checkpoint.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->timings != NULL )
+		{
+			if( export_timings_free(
+			     &( ( *export_handle )->timings ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free timings.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->json_value_string != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->json_value_string );
+		}
+		for( scratch_string_index = 0;
+		     scratch_string_index < EXPORT_HANDLE_NUMBER_OF_SCRATCH_STRINGS;
+		     scratch_string_index++ )
+		{
+			if( ( *export_handle )->scratch_strings[ scratch_string_index ] != NULL )
+			{
+				memory_free(
+				 ( *export_handle )->scratch_strings[ scratch_string_index ] );
+			}
+		}
 		memory_free(
 		 *export_handle );
 
@@ -338,6 +605,38 @@ int export_handle_signal_abort(
 			return( -1 );
 		}
 	}
+	if( export_handle->carver != NULL )
+	{
+		if( libevtx_carver_signal_abort(
+		     export_handle->carver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal carver to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->collection != NULL )
+	{
+		if( libevtx_collection_signal_abort(
+		     export_handle->collection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal collection to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -447,10 +746,20 @@ int export_handle_set_export_format(
 	{
 		if( system_string_compare(
 		     string,
-		     _SYSTEM_STRING( "xml" ),
+		     _SYSTEM_STRING( "csv" ),
 		     3 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_CSV;
+
+			result = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "xml" ),
+		          3 ) == 0 )
 		{
 			export_handle->export_format = EXPORT_FORMAT_XML;
+			export_handle->compact_xml   = 0;
 
 			result = 1;
 		}
@@ -459,29 +768,123 @@ int export_handle_set_export_format(
 	{
 		if( system_string_compare(
 		     string,
-		     _SYSTEM_STRING( "text" ),
+		     _SYSTEM_STRING( "json" ),
 		     4 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_JSON;
+
+			result = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "text" ),
+		          4 ) == 0 )
 		{
 			export_handle->export_format = EXPORT_FORMAT_TEXT;
 
 			result = 1;
 		}
 	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "l2tcsv" ),
+		     6 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_L2T_CSV;
+
+			result = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "ndjson" ),
+		          6 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_NDJSON;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 7 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "es-bulk" ),
+		     7 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_ES_BULK;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "bodyfile" ),
+		     8 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_BODYFILE;
+
+			result = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "protobuf" ),
+		          8 ) == 0 )
+		{
+			export_handle->export_format     = EXPORT_FORMAT_PROTOBUF;
+			export_handle->protobuf_raw_data = 0;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 11 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "xml-compact" ),
+		     11 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_XML;
+			export_handle->compact_xml   = 1;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 12 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "protobuf-raw" ),
+		     12 ) == 0 )
+		{
+			export_handle->export_format     = EXPORT_FORMAT_PROTOBUF;
+			export_handle->protobuf_raw_data = 1;
+
+			result = 1;
+		}
+	}
 	return( result );
 }
 
-/* Sets the ascii codepage
- * Returns 1 if successful or -1 on error
+/* Sets the output compression
+ * The string contains the compression method: gzip or zstd, optionally followed by
+ * a colon and the compression level
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_ascii_codepage(
+int export_handle_set_output_compression(
      export_handle_t *export_handle,
      const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function  = "export_handle_set_ascii_codepage";
+	static char *function  = "export_handle_set_output_compression";
+	size_t string_index    = 0;
 	size_t string_length   = 0;
-	uint32_t feature_flags = 0;
-	int result             = 0;
+	int compression_level  = 0;
+	int compression_method = 0;
+	int maximum_level      = 0;
 
 	if( export_handle == NULL )
 	{
@@ -494,67 +897,95 @@ int export_handle_set_ascii_codepage(
 
 		return( -1 );
 	}
-	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
-	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
-
-	string_length = system_string_length(
-	                 string );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libclocale_codepage_copy_from_string_wide(
-	          &( export_handle->ascii_codepage ),
-	          string,
-	          string_length,
-	          feature_flags,
-	          error );
-#else
-	result = libclocale_codepage_copy_from_string(
-	          &( export_handle->ascii_codepage ),
-	          string,
-	          string_length,
-	          feature_flags,
-	          error );
-#endif
-	if( result == -1 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length < 4 )
 	{
-		if( message_handle_set_ascii_codepage(
-		     export_handle->message_handle,
-		     export_handle->ascii_codepage,
-		     error ) != 1 )
+		return( 0 );
+	}
+#if defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_H )
+	if( system_string_compare(
+	     string,
+	     _SYSTEM_STRING( "gzip" ),
+	     4 ) == 0 )
+	{
+		compression_method = COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_GZIP;
+		maximum_level      = 9;
+	}
+#endif
+#if defined( HAVE_LIBZSTD ) && defined( HAVE_ZSTD_H )
+	if( system_string_compare(
+	     string,
+	     _SYSTEM_STRING( "zstd" ),
+	     4 ) == 0 )
+	{
+		compression_method = COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_ZSTD;
+		maximum_level      = 19;
+	}
+#endif
+	if( compression_method == 0 )
+	{
+		return( 0 );
+	}
+	if( string_length > 4 )
+	{
+		/* The level consists of a colon followed by 1 or 2 digits
+		 */
+		if( ( string[ 4 ] != (system_character_t) ':' )
+		 || ( string_length < 6 )
+		 || ( string_length > 7 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set ASCII codepage in message handle.",
-			 function );
-
-			return( -1 );
+			return( 0 );
+		}
+		for( string_index = 5;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			if( ( string[ string_index ] < (system_character_t) '0' )
+			 || ( string[ string_index ] > (system_character_t) '9' ) )
+			{
+				return( 0 );
+			}
+			compression_level *= 10;
+			compression_level += (int) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		if( ( compression_level < 1 )
+		 || ( compression_level > maximum_level ) )
+		{
+			return( 0 );
 		}
 	}
-	return( result );
+	export_handle->output_compression_method = compression_method;
+	export_handle->output_compression_level  = compression_level;
+
+	return( 1 );
 }
 
-/* Sets the preferred language identifier
- * Returns 1 if successful or -1 on error
+/* Sets the number of threads
+ * A string of "auto" tunes the number of threads and read parameters of the input
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_preferred_language_identifier(
+int export_handle_set_number_of_threads(
      export_handle_t *export_handle,
-     uint32_t preferred_language_identifier,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_preferred_language_identifier";
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
 
 	if( export_handle == NULL )
 	{
@@ -567,33 +998,78 @@ int export_handle_set_preferred_language_identifier(
 
 		return( -1 );
 	}
-	if( message_handle_set_preferred_language_identifier(
-	     export_handle->message_handle,
-	     preferred_language_identifier,
-	     error ) != 1 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set preferred language identifier in message handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "auto" ),
+		     4 ) == 0 )
+		{
+			export_handle->auto_tuning = 1;
+
+			return( 1 );
+		}
+	}
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		return( 0 );
+	}
+#endif
+	export_handle->number_of_threads = number_of_threads;
+	export_handle->auto_tuning       = 0;
+
 	return( 1 );
 }
 
-/* Sets the event log type
- * Returns 1 if successful or -1 on error
+/* Sets the number of shards
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_event_log_type(
+int export_handle_set_number_of_shards(
      export_handle_t *export_handle,
      const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_event_log_type";
-	int result            = 0;
+	static char *function = "export_handle_set_number_of_shards";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_shards  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -606,75 +1082,127 @@ int export_handle_set_event_log_type(
 
 		return( -1 );
 	}
-	result = evtxinput_determine_event_log_type(
-	          string,
-	          &( export_handle->event_log_type ),
-	          error );
-
-	if( result == -1 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine event log type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_shards *= 10;
+		number_of_shards += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( number_of_shards < 1 )
+	 || ( number_of_shards > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS ) )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_shards = number_of_shards;
+
+	return( 1 );
 }
 
-/* Sets the event log type from the filename
- * Returns 1 if successful or -1 on error
+/* Copies a decimal string to a 64-bit value
+ * Returns 1 if successful, 0 if the string does not contain a valid decimal value or -1 on error
  */
-int export_handle_set_event_log_type_from_filename(
-     export_handle_t *export_handle,
-     const system_character_t *filename,
+int export_handle_copy_decimal_string_to_uint64(
+     const system_character_t *string,
+     uint64_t *value_64bit,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_event_log_type_from_filename";
-	int result            = 0;
+	static char *function = "export_handle_copy_decimal_string_to_uint64";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint64_t digit        = 0;
+	uint64_t value        = 0;
 
-	if( export_handle == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	result = evtxinput_determine_event_log_type_from_filename(
-	          filename,
-	          &( export_handle->event_log_type ),
-	          error );
-
-	if( result == -1 )
+	if( value_64bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine event log type from filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	string_length = system_string_length(
+	                 string );
+
+	/* A 64-bit value has at most 20 decimal digits
+	 */
+	if( ( string_length == 0 )
+	 || ( string_length > 20 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		digit = (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value > ( ( UINT64_MAX - digit ) / 10 ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += digit;
+	}
+	*value_64bit = value;
+
+	return( 1 );
 }
 
-/* Sets the name of the software registry file
- * Returns 1 if successful or -1 error
+/* Sets the flush interval of the output in seconds
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_software_registry_filename(
+int export_handle_set_flush_interval(
      export_handle_t *export_handle,
-     const system_character_t *filename,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_software_registry_filename";
+	static char *function   = "export_handle_set_flush_interval";
+	uint64_t flush_interval = 0;
+	int result              = 0;
 
 	if( export_handle == NULL )
 	{
@@ -687,16 +1215,41 @@ int export_handle_set_software_registry_filename(
 
 		return( -1 );
 	}
-	if( message_handle_set_software_registry_filename(
-	     export_handle->message_handle,
-	     filename,
+	result = export_handle_copy_decimal_string_to_uint64(
+	          string,
+	          &flush_interval,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to flush interval.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( flush_interval == 0 )
+	 || ( flush_interval > (uint64_t) EXPORT_HANDLE_MAXIMUM_FLUSH_INTERVAL ) )
+	{
+		return( 0 );
+	}
+	if( output_writer_set_flush_interval(
+	     export_handle->output_writer,
+	     (int) flush_interval,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set SOFTWARE registry filename in message handle.",
+		 "%s: unable to set flush interval of output writer.",
 		 function );
 
 		return( -1 );
@@ -704,15 +1257,16 @@ int export_handle_set_software_registry_filename(
 	return( 1 );
 }
 
-/* Sets the name of the system registry file
- * Returns 1 if successful or -1 error
+/* Sets the record identifier after which records are exported
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_system_registry_filename(
+int export_handle_set_since_record_identifier(
      export_handle_t *export_handle,
-     const system_character_t *filename,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_system_registry_filename";
+	static char *function = "export_handle_set_since_record_identifier";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -725,32 +1279,39 @@ int export_handle_set_system_registry_filename(
 
 		return( -1 );
 	}
-	if( message_handle_set_system_registry_filename(
-	     export_handle->message_handle,
-	     filename,
-	     error ) != 1 )
+	result = export_handle_copy_decimal_string_to_uint64(
+	          string,
+	          &( export_handle->since_record_identifier ),
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set SYSTEM registry filename in message handle.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to record identifier.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	else if( result != 0 )
+	{
+		export_handle->since_record_identifier_is_set = 1;
+	}
+	return( result );
 }
 
-/* Sets the name of the directory containing the software and system registry file
- * Returns 1 if successful or -1 error
+/* Sets the written time, as a FILETIME, after which records are exported
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_registry_directory_name(
+int export_handle_set_since_written_time(
      export_handle_t *export_handle,
-     const system_character_t *name,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_registry_directory_name";
+	static char *function = "export_handle_set_since_written_time";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -763,32 +1324,40 @@ int export_handle_set_registry_directory_name(
 
 		return( -1 );
 	}
-	if( message_handle_set_registry_directory_name(
-	     export_handle->message_handle,
-	     name,
-	     error ) != 1 )
+	result = export_handle_copy_decimal_string_to_uint64(
+	          string,
+	          &( export_handle->since_written_time ),
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set registry directory name in message handle.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to written time.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	else if( result != 0 )
+	{
+		export_handle->since_written_time_is_set = 1;
+	}
+	return( result );
 }
 
-/* Sets the path of the resource files
- * Returns 1 if successful or -1 error
+/* Sets the number of records that are skipped before records are exported
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_resource_files_path(
+int export_handle_set_record_offset(
      export_handle_t *export_handle,
-     const system_character_t *path,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_resource_files_path";
+	static char *function  = "export_handle_set_record_offset";
+	uint64_t record_offset = 0;
+	int result             = 0;
 
 	if( export_handle == NULL )
 	{
@@ -801,32 +1370,46 @@ int export_handle_set_resource_files_path(
 
 		return( -1 );
 	}
-	if( message_handle_set_resource_files_path(
-	     export_handle->message_handle,
-	     path,
-	     error ) != 1 )
+	result = export_handle_copy_decimal_string_to_uint64(
+	          string,
+	          &record_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource files path in message handle.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to record offset.",
 		 function );
 
 		return( -1 );
 	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( record_offset > (uint64_t) INT_MAX )
+	{
+		return( 0 );
+	}
+	export_handle->record_offset = (int) record_offset;
+
 	return( 1 );
 }
 
-/* Opens the input
- * Returns 1 if successful or -1 on error
+/* Sets the maximum number of records to export
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_open_input(
+int export_handle_set_maximum_number_of_records(
      export_handle_t *export_handle,
-     const system_character_t *filename,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open_input";
+	static char *function              = "export_handle_set_maximum_number_of_records";
+	uint64_t maximum_number_of_records = 0;
+	int result                         = 0;
 
 	if( export_handle == NULL )
 	{
@@ -839,82 +1422,48 @@ int export_handle_open_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid export handle input is already open.",
-		 function );
+	result = export_handle_copy_decimal_string_to_uint64(
+	          string,
+	          &maximum_number_of_records,
+	          error );
 
-		return( -1 );
-	}
-	if( message_handle_open_input(
-	     export_handle->message_handle,
-	     export_handle_get_event_log_key_name(
-	      export_handle->event_log_type ),
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input of message handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to maximum number of records.",
 		 function );
 
 		return( -1 );
 	}
-	if( libevtx_file_set_ascii_codepage(
-	     export_handle->input_file,
-	     export_handle->ascii_codepage,
-	     error ) != 1 )
+	else if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set ASCII codepage in input file.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libevtx_file_open_wide(
-	     export_handle->input_file,
-	     filename,
-	     LIBEVTX_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libevtx_file_open(
-	     export_handle->input_file,
-	     filename,
-	     LIBEVTX_OPEN_READ,
-	     error ) != 1 )
-#endif
+	if( ( maximum_number_of_records == 0 )
+	 || ( maximum_number_of_records > (uint64_t) INT_MAX ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	export_handle->input_is_open = 1;
+	export_handle->maximum_number_of_records = (int) maximum_number_of_records;
 
 	return( 1 );
 }
 
-/* Closes the input
- * Returns the 0 if succesful or -1 on error
+/* Sets the sample of the chunks of which the records are exported
+ * The string contains a number of chunks or a percentage of the chunks, such as 5%
+ * The records of the sampled chunks are determined from the chunk headers,
+ * hence the input file is opened with lazy access
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_close_input(
+int export_handle_set_sample(
      export_handle_t *export_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_close_input";
+	static char *function = "export_handle_set_sample";
 	int result            = 0;
 
 	if( export_handle == NULL )
@@ -928,53 +1477,61 @@ int export_handle_close_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
+	if( export_handle->chunk_sampler == NULL )
 	{
-		if( message_handle_close_input(
-		     export_handle->message_handle,
-		     error ) != 0 )
+		if( chunk_sampler_initialize(
+		     &( export_handle->chunk_sampler ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input of message handle.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk sampler.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
-		if( libevtx_file_close(
-		     export_handle->input_file,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input file.",
-			 function );
+	}
+	result = chunk_sampler_set_sample(
+	          export_handle->chunk_sampler,
+	          string,
+	          error );
 
-			result = -1;
-		}
-		export_handle->input_is_open = 0;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sample.",
+		 function );
+	}
+	if( result != 1 )
+	{
+		chunk_sampler_free(
+		 &( export_handle->chunk_sampler ),
+		 NULL );
+	}
+	else
+	{
+		export_handle->lazy = 1;
 	}
 	return( result );
 }
 
-/* Copies the GUID string to a byte stream
+/* Sets the filter expression
+ * The expression is compiled once and evaluated for every record
  * Returns 1 if successful or -1 on error
  */
-int export_handle_guid_string_copy_to_byte_stream(
+int export_handle_set_filter_expression(
      export_handle_t *export_handle,
      const system_character_t *string,
-     size_t string_length,
-     uint8_t *byte_stream,
-     size_t byte_stream_size,
      libcerror_error_t **error )
 {
-	libfguid_identifier_t *guid = NULL;
-	static char *function       = "export_handle_guid_string_copy_to_byte_stream";
-	int result                  = 0;
+	static char *function = "export_handle_set_filter_expression";
+	size_t string_length  = 0;
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -987,33 +1544,48 @@ int export_handle_guid_string_copy_to_byte_stream(
 
 		return( -1 );
 	}
-	if( libfguid_identifier_initialize(
-	     &guid,
-	     error ) != 1 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create GUID.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( export_handle->record_filter == NULL )
+	{
+		if( libevtx_record_filter_initialize(
+		     &( export_handle->record_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record filter.",
+			 function );
+
+			return( -1 );
+		}
 	}
+	string_length = system_string_length(
+	                 string );
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfguid_identifier_copy_from_utf16_string(
-		  guid,
-		  (uint16_t *) string,
-		  string_length,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-		  error );
+	result = libevtx_record_filter_set_utf16_expression(
+	          export_handle->record_filter,
+	          (uint16_t *) string,
+	          string_length,
+	          error );
 #else
-	result = libfguid_identifier_copy_from_utf8_string(
-		  guid,
-		  (uint8_t *) string,
-		  string_length,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-		  error );
+	result = libevtx_record_filter_set_utf8_expression(
+	          export_handle->record_filter,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
 #endif
 	if( result != 1 )
 	{
@@ -1021,72 +1593,108 @@ int export_handle_guid_string_copy_to_byte_stream(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy GUID from string.",
+		 "%s: unable to set expression in record filter.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfguid_identifier_copy_to_byte_stream(
-	     guid,
-	     byte_stream,
-	     byte_stream_size,
-	     LIBFGUID_ENDIAN_LITTLE,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Appends a search string
+ * Only the records that contain one of the search strings are exported
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_search_string(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_append_search_string";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy GUID to byte stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfguid_identifier_free(
-	     &guid,
-	     error ) != 1 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free GUID.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	if( export_handle->record_filter == NULL )
+	{
+		if( libevtx_record_filter_initialize(
+		     &( export_handle->record_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record filter.",
+			 function );
 
-on_error:
-	if( guid != NULL )
+			return( -1 );
+		}
+	}
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_filter_append_utf16_search_string(
+	          export_handle->record_filter,
+	          (uint16_t *) string,
+	          string_length,
+	          error );
+#else
+	result = libevtx_record_filter_append_utf8_search_string(
+	          export_handle->record_filter,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
 	{
-		libfguid_identifier_free(
-		 &guid,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append search string to record filter.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the template definition from the resource file
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Appends a match value
+ * Only the records with an EventData value, or a word of such a value,
+ * that equals one of the match values are exported
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_resource_file_get_template_definition(
+int export_handle_append_match_value(
      export_handle_t *export_handle,
-     resource_file_t *resource_file,
-     const uint8_t *provider_identifier,
-     size_t provider_identifier_size,
-     uint32_t event_identifier,
-     libevtx_template_definition_t **template_definition,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	libwrc_wevt_event_t *wevt_event                             = NULL;
-	libwrc_wevt_provider_t *wevt_provider                       = NULL;
-	libwrc_wevt_template_definition_t *wevt_template_definition = NULL;
-	uint8_t *template_data                                      = NULL;
-	static char *function                                       = "export_handle_resource_file_get_template_definition";
-	size_t template_data_size                                   = 0;
-	uint32_t template_data_offset                               = 0;
-	int result                                                  = 0;
+	static char *function = "export_handle_append_match_value";
+	size_t string_length  = 0;
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1099,240 +1707,241 @@ int export_handle_resource_file_get_template_definition(
 
 		return( -1 );
 	}
-	if( template_definition == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid template definition.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	result = resource_file_get_template_definition(
-		  resource_file,
-		  provider_identifier,
-		  provider_identifier_size,
-		  event_identifier,
-		  &wevt_provider,
-		  &wevt_event,
-		  &wevt_template_definition,
-		  error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve WEVT template definition.",
-		 function );
-
-		goto on_error;
-	}
-	else if( result != 0 )
+	if( export_handle->record_filter == NULL )
 	{
-		if( libwrc_wevt_template_definition_get_offset(
-		     wevt_template_definition,
-		     &template_data_offset,
+		if( libevtx_record_filter_initialize(
+		     &( export_handle->record_filter ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template offset.",
-			 function );
-
-			goto on_error;
-		}
-		if( libwrc_wevt_template_definition_get_size(
-		     wevt_template_definition,
-		     &template_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template size.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record filter.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( template_data_size > 0 )
-		{
-			template_data = (uint8_t *) memory_allocate(
-			                             sizeof( uint8_t ) * template_data_size );
-
-			if( template_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create template data.",
-				 function );
+	}
+	string_length = system_string_length(
+	                 string );
 
-				goto on_error;
-			}
-			if( libwrc_wevt_template_definition_get_data(
-			     wevt_template_definition,
-			     template_data,
-			     template_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template data.",
-				 function );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_filter_append_utf16_match_value(
+	          export_handle->record_filter,
+	          (uint16_t *) string,
+	          string_length,
+	          error );
+#else
+	result = libevtx_record_filter_append_utf8_match_value(
+	          export_handle->record_filter,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append match value to record filter.",
+		 function );
 
-				goto on_error;
-			}
-/* TODO cache the EVTX template definitions ? */
-			if( libevtx_template_definition_initialize(
-			     template_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create template definitions.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			if( libevtx_template_definition_set_data(
-			     *template_definition,
-			     template_data,
-			     template_data_size,
-			     template_data_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set template data.",
-				 function );
+/* Clears the record selection
+ * Resets the since record identifier, since written time, record offset, maximum
+ * number of records, filter expression and search strings so that all records are exported
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_clear_record_selection(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_clear_record_selection";
 
-				goto on_error;
-			}
-			memory_free(
-			 template_data );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-			template_data = NULL;
-		}
-		if( libwrc_wevt_template_definition_free(
-		     &wevt_template_definition,
+		return( -1 );
+	}
+	if( export_handle->record_filter != NULL )
+	{
+		if( libevtx_record_filter_free(
+		     &( export_handle->record_filter ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free template definition.",
+			 "%s: unable to free record filter.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libwrc_wevt_event_free(
-		     &wevt_event,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free event.",
-			 function );
+	}
+	export_handle->since_record_identifier        = 0;
+	export_handle->since_record_identifier_is_set = 0;
+	export_handle->since_written_time             = 0;
+	export_handle->since_written_time_is_set      = 0;
+	export_handle->record_offset                  = 0;
+	export_handle->maximum_number_of_records      = 0;
 
-			goto on_error;
-		}
-		if( libwrc_wevt_provider_free(
-		     &wevt_provider,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free provider.",
-			 function );
+	return( 1 );
+}
 
-			goto on_error;
-		}
+/* Sets the export handle to skip records with the same content as a previously exported record
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_deduplicate(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_deduplicate";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	if( export_handle->record_hash_set != NULL )
+	{
+		return( 1 );
+	}
+	if( record_hash_set_initialize(
+	     &( export_handle->record_hash_set ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record hash set.",
+		 function );
 
-on_error:
-	if( template_data != NULL )
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the checkpoint file that records the position up to which the records were exported
+ * If the checkpoint file exists the export resumes at the position of the checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_checkpoint_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_checkpoint_file";
+	int result            = 0;
+
+	if( export_handle == NULL )
 	{
-		memory_free(
-		 template_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( wevt_template_definition != NULL )
+	if( export_handle->checkpoint != NULL )
 	{
-		libwrc_wevt_template_definition_free(
-		 &wevt_template_definition,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - checkpoint value already set.",
+		 function );
+
+		return( -1 );
 	}
-	if( wevt_event != NULL )
+	if( export_checkpoint_initialize(
+	     &( export_handle->checkpoint ),
+	     filename,
+	     error ) != 1 )
 	{
-		libwrc_wevt_event_free(
-		 &wevt_event,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		return( -1 );
 	}
-	if( wevt_provider != NULL )
+	result = export_checkpoint_read(
+	          export_handle->checkpoint,
+	          error );
+
+	if( result == -1 )
 	{
-		libwrc_wevt_provider_free(
-		 &wevt_provider,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint file.",
+		 function );
+
+		export_checkpoint_free(
+		 &( export_handle->checkpoint ),
 		 NULL );
+
+		return( -1 );
 	}
-	if( *template_definition != NULL )
+	else if( ( result != 0 )
+	      && ( export_handle->verbose != 0 ) )
 	{
-		libevtx_template_definition_free(
-		 template_definition,
-		 NULL );
+		fprintf(
+		 export_handle->notify_stream,
+		 "Resuming export at input file: %d, record: %d, output offset: %" PRIu64 "\n",
+		 export_handle->checkpoint->input_index,
+		 export_handle->checkpoint->export_index,
+		 export_handle->checkpoint->output_offset );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Exports the record event message
+/* Writes the checkpoint when the output was flushed since the previous checkpoint
+ * The export index is the index of the next record to export of the current input file
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_record_event_message(
+int export_handle_write_checkpoint(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
-     const system_character_t *event_provider_identifier,
-     size_t event_provider_identifier_length,
-     const system_character_t *event_source,
-     size_t event_source_length,
-     uint32_t event_identifier,
-     log_handle_t *log_handle,
+     int export_index,
      libcerror_error_t **error )
 {
-	uint8_t provider_identifier[ 16 ];
-
-	libevtx_template_definition_t *template_definition = NULL;
-	message_string_t *message_string                   = NULL;
-	resource_file_t *resource_file                     = NULL;
-	system_character_t *message_filename               = NULL;
-	system_character_t *resource_filename              = NULL;
-	system_character_t *value_string                   = NULL;
-	static char *function                              = "export_handle_export_record_event_message";
-	size_t message_filename_size                       = 0;
-	size_t resource_filename_size                      = 0;
-	size_t value_string_size                           = 0;
-	uint32_t event_identifier_qualifiers               = 0;
-	uint32_t message_identifier                        = 0;
-	int number_of_strings                              = 0;
-	int result                                         = 0;
-	int value_string_index                             = 0;
+	static char *function = "export_handle_write_checkpoint";
 
 	if( export_handle == NULL )
 	{
@@ -1345,526 +1954,12368 @@ int export_handle_export_record_event_message(
 
 		return( -1 );
 	}
-	if( event_provider_identifier != NULL )
+	if( export_handle->checkpoint == NULL )
 	{
-		result = message_handle_get_value_by_provider_identifier(
-		          export_handle->message_handle,
-		          event_provider_identifier,
-		          event_provider_identifier_length,
-		          _SYSTEM_STRING( "ResourceFileName" ),
-		          16,
-		          &resource_filename,
-		          &resource_filename_size,
-		          error );
+		return( 1 );
+	}
+	/* A checkpoint is only consistent with the output when no data is buffered
+	 */
+	if( ( export_handle->output_writer->buffer_offset != 0 )
+	 || ( export_handle->output_writer->output_offset == export_handle->checkpoint->output_offset ) )
+	{
+		return( 1 );
+	}
+	if( output_writer_flush_stream(
+	     export_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output writer.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename by provider identifier.",
-			 function );
+		return( -1 );
+	}
+	if( export_checkpoint_write(
+	     export_handle->checkpoint,
+	     export_handle->checkpoint->current_input_index,
+	     export_index,
+	     export_handle->output_writer->output_offset,
+	     export_handle->number_of_json_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint file.",
+		 function );
 
-			goto on_error;
-		}
-		result = message_handle_get_value_by_provider_identifier(
-		          export_handle->message_handle,
-		          event_provider_identifier,
-		          event_provider_identifier_length,
-		          _SYSTEM_STRING( "MessageFileName" ),
-		          15,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename by provider identifier.",
-			 function );
+/* Removes the checkpoint file after the export completed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_remove_checkpoint_file(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_remove_checkpoint_file";
 
-			goto on_error;
-		}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( message_filename == NULL )
-	 && ( event_source != NULL ) )
+	if( export_handle->checkpoint == NULL )
 	{
-		result = message_handle_get_value_by_event_source(
-		          export_handle->message_handle,
-		          event_source,
-		          event_source_length,
-		          _SYSTEM_STRING( "EventMessageFile" ),
-		          16,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
+		return( 1 );
+	}
+	if( export_checkpoint_remove(
+	     export_handle->checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to remove checkpoint file.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename by event source.",
-			 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-			goto on_error;
-		}
+/* Sets the granularity of the time partitioned output
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_partition_granularity(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_partition_granularity";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( resource_filename != NULL )
+	if( string == NULL )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Resource filename\t\t: %" PRIs_SYSTEM "\n",
-		 resource_filename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
 	}
-	if( resource_filename != NULL )
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
 	{
-		if( export_handle_guid_string_copy_to_byte_stream(
-		     export_handle,
-		     event_provider_identifier,
-		     event_provider_identifier_length,
-		     provider_identifier,
-		     16,
-		     error ) != 1 )
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "day" ),
+		     3 ) == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy GUID from string.",
-			 function );
+			export_handle->partition_granularity = PARTITION_WRITER_GRANULARITY_DAY;
 
-			goto on_error;
+			result = 1;
 		}
-		result = message_handle_get_resource_file_by_provider_identifier(
-			  export_handle->message_handle,
-			  resource_filename,
-			  resource_filename_size - 1,
-			  provider_identifier,
-			  16,
-			  &resource_file,
-			  error );
-
-		if( result == -1 )
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "hour" ),
+		     4 ) == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource file.",
-			 function );
+			export_handle->partition_granularity = PARTITION_WRITER_GRANULARITY_HOUR;
 
-			goto on_error;
+			result = 1;
 		}
-		else if( result != 0 )
-		{
-			result = resource_file_get_event_message_identifier(
-				  resource_file,
-				  provider_identifier,
-				  16,
-				  event_identifier,
-				  &message_identifier,
-				  error );
+	}
+	return( result );
+}
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message identifier.",
-				 function );
+/* Sets the export handle to measure the time spent per phase and the format the timings are printed in
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_timings_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_timings_format";
+	size_t string_length  = 0;
+	int format            = 0;
 
-				goto on_error;
-			}
-			else if( result == 0 )
-			{
-				message_identifier = 0;
-			}
-			if( export_handle->use_template_definition != 0 )
-			{
-				result = export_handle_resource_file_get_template_definition(
-					  export_handle,
-					  resource_file,
-					  provider_identifier,
-					  16,
-					  event_identifier,
-					  &template_definition,
-					  error );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve tempate definition.",
-					 function );
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
 
-					goto on_error;
-				}
-			}
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "json" ),
+		     4 ) == 0 )
+		{
+			format = EXPORT_TIMINGS_FORMAT_JSON;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "text" ),
+		          4 ) == 0 )
+		{
+			format = EXPORT_TIMINGS_FORMAT_TEXT;
 		}
-		memory_free(
-		 resource_filename );
-
-		resource_filename = NULL;
 	}
-	if( message_filename != NULL )
+	if( format == 0 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Message filename\t\t: %" PRIs_SYSTEM "\n",
-		 message_filename );
+		return( 0 );
+	}
+	if( export_handle->timings != NULL )
+	{
+		export_handle->timings->format = format;
 
-		if( message_identifier == 0 )
-		{
-			result = libevtx_record_get_event_identifier_qualifiers(
-				  record,
-				  &event_identifier_qualifiers,
-				  error );
+		return( 1 );
+	}
+	if( export_timings_initialize(
+	     &( export_handle->timings ),
+	     format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timings.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve event identifier qualifiers.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				if( export_handle->verbose != 0 )
-				{
-					fprintf(
-					 export_handle->notify_stream,
-					 "Event identifier qualifiers\t: 0x%08" PRIx32 "\n",
-					 event_identifier_qualifiers );
-				}
-				message_identifier = event_identifier_qualifiers << 16;
-			}
-			message_identifier |= event_identifier;
-		}
-		if( export_handle->verbose != 0 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Message identifier\t\t: 0x%08" PRIx32 "\n",
-			 message_identifier );
-		}
-		result = message_handle_get_message_string(
-			  export_handle->message_handle,
-			  message_filename,
-			  message_filename_size - 1,
-			  message_identifier,
-			  &message_string,
-			  error );
+/* Determines if a record content hash was seen before and otherwise remembers it
+ * The record hash set is shared by all the inputs
+ * Returns 1 if the record is a duplicate, 0 if not or -1 on error
+ */
+int export_handle_is_duplicate_record_content_hash(
+     export_handle_t *export_handle,
+     uint64_t content_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_is_duplicate_record_content_hash";
+	int result            = 0;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string.",
-			 function );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-			goto on_error;
-		}
-		memory_free(
-		 message_filename );
+		return( -1 );
+	}
+	if( export_handle->record_hash_set == NULL )
+	{
+		return( 0 );
+	}
+	result = record_hash_set_insert(
+	          export_handle->record_hash_set,
+	          content_hash,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert content hash into record hash set.",
+		 function );
 
-		message_filename = NULL;
+		return( -1 );
 	}
-	if( export_handle->use_template_definition != 0 )
+	else if( result == 0 )
 	{
-		result = libevtx_record_parse_data_with_template_definition(
-			  record,
-			  template_definition,
-			  error );
+		export_handle->number_of_duplicate_records += 1;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse record data.",
-			 function );
+		return( 1 );
+	}
+	return( 0 );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
+/* Sets the maximum number of cached resource files
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_maximum_number_of_cached_resource_files(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_maximum_number_of_cached_resource_files";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_handle_copy_decimal_string_to_uint64(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to maximum number of cached resource files.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_CACHED_RESOURCE_FILES ) )
+	{
+		return( 0 );
+	}
+	if( message_handle_set_maximum_number_of_cached_resource_files(
+	     export_handle->message_handle,
+	     (int) value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of cached resource files in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the message catalog
+ * The message catalog is not managed by the export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_message_catalog(
+     export_handle_t *export_handle,
+     message_catalog_t *message_catalog,
+     int message_catalog_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_message_catalog";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_message_catalog(
+	     export_handle->message_handle,
+	     message_catalog,
+	     message_catalog_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set message catalog in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the ascii codepage
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_ascii_codepage(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_set_ascii_codepage";
+	size_t string_length   = 0;
+	uint32_t feature_flags = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
+	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
+
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libclocale_codepage_copy_from_string_wide(
+	          &( export_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#else
+	result = libclocale_codepage_copy_from_string(
+	          &( export_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
 #endif
-			libcerror_error_free(
-			 error );
-		}
-		if( libevtx_template_definition_free(
-		     &template_definition,
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( message_handle_set_ascii_codepage(
+		     export_handle->message_handle,
+		     export_handle->ascii_codepage,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free template definition.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set ASCII codepage in message handle.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libevtx_record_get_number_of_strings(
-	     record,
-	     &number_of_strings,
+	return( result );
+}
+
+/* Sets the preferred language identifier
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_preferred_language_identifier(
+     export_handle_t *export_handle,
+     uint32_t preferred_language_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_preferred_language_identifier";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_preferred_language_identifier(
+	     export_handle->message_handle,
+	     preferred_language_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set preferred language identifier in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the event log type
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_event_log_type(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_event_log_type";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = evtxinput_determine_event_log_type(
+	          string,
+	          &( export_handle->event_log_type ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine event log type.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the event log type from the filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_event_log_type_from_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_event_log_type_from_filename";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = evtxinput_determine_event_log_type_from_filename(
+	          filename,
+	          &( export_handle->event_log_type ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine event log type from filename.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the name of the software registry file
+ * Returns 1 if successful or -1 error
+ */
+int export_handle_set_software_registry_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_software_registry_filename";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_software_registry_filename(
+	     export_handle->message_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set SOFTWARE registry filename in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name of the system registry file
+ * Returns 1 if successful or -1 error
+ */
+int export_handle_set_system_registry_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_system_registry_filename";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_system_registry_filename(
+	     export_handle->message_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set SYSTEM registry filename in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name of the directory containing the software and system registry file
+ * Returns 1 if successful or -1 error
+ */
+int export_handle_set_registry_directory_name(
+     export_handle_t *export_handle,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_registry_directory_name";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_registry_directory_name(
+	     export_handle->message_handle,
+	     name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set registry directory name in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the path of the resource files
+ * Returns 1 if successful or -1 error
+ */
+int export_handle_set_resource_files_path(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_resource_files_path";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_resource_files_path(
+	     export_handle->message_handle,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource files path in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input of the message handle for the event log type
+ * The message handle is preloaded if requested
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_message_handle_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_message_handle_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_open_input(
+	     export_handle->message_handle,
+	     export_handle_get_event_log_key_name(
+	      export_handle->event_log_type ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->preload != 0 )
+	{
+		if( message_handle_preload(
+		     export_handle->message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to preload message handle.",
+			 function );
+
+			message_handle_close_input(
+			 export_handle->message_handle,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_open_message_handle_input(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_open_input_file(
+	     export_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		message_handle_close_input(
+		 export_handle->message_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input file without (re)opening the input of the message handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input_file";
+	int access_flags      = LIBEVTX_OPEN_READ;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     export_handle->input_file,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_set_number_of_threads(
+	     export_handle->input_file,
+	     export_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads in input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_set_auto_tuning(
+	     export_handle->input_file,
+	     export_handle->auto_tuning,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set auto tuning in input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->decode_profiling != 0 )
+	{
+		if( libevtx_file_set_decode_profiling(
+		     export_handle->input_file,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set decode profiling in input file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Lazy access does not provide the recovered records and does not support refresh
+	 */
+	if( ( export_handle->lazy != 0 )
+	 && ( export_handle->export_mode == EXPORT_MODE_ITEMS )
+	 && ( export_handle->follow == 0 ) )
+	{
+		access_flags = LIBEVTX_OPEN_READ_LAZY;
+	}
+	/* Only exporting the recovered records does not require the allocated records to be indexed
+	 */
+	else if( export_handle->export_mode == EXPORT_MODE_RECOVERED )
+	{
+		access_flags = LIBEVTX_OPEN_READ_RECOVERED;
+	}
+	/* Let the library drop the recovered records that duplicate allocated records
+	 * while it scans the chunks, which requires the allocated records to be read
+	 */
+	if( ( export_handle->record_hash_set != NULL )
+	 && ( export_handle->export_mode != EXPORT_MODE_ITEMS )
+	 && ( export_handle->follow == 0 ) )
+	{
+		access_flags = LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_DEDUPLICATE_RECOVERED;
+	}
+	/* A followed input file is actively written hence it is always read with live access
+	 */
+	if( ( export_handle->live != 0 )
+	 || ( export_handle->follow != 0 ) )
+	{
+		access_flags |= LIBEVTX_ACCESS_FLAG_LIVE;
+	}
+	/* A gzip or zstd compressed input file is decompressed while it is read
+	 */
+	result = compressed_file_initialize(
+	          &( export_handle->input_file_io_handle ),
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* A compressed stream cannot be read out of order without restarting
+		 * the decompression, hence the chunks are only read sequentially
+		 */
+		if( libevtx_file_set_auto_tuning(
+		     export_handle->input_file,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set auto tuning in input file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_file_set_number_of_threads(
+		     export_handle->input_file,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of threads in input file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_file_set_read_ahead_depth(
+		     export_handle->input_file,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read-ahead depth in input file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_file_open_file_io_handle(
+		     export_handle->input_file,
+		     export_handle->input_file_io_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open compressed input file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	else if( libevtx_file_open_wide(
+	          export_handle->input_file,
+	          filename,
+	          access_flags,
+	          error ) != 1 )
+#else
+	else if( libevtx_file_open(
+	          export_handle->input_file,
+	          filename,
+	          access_flags,
+	          error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->auto_tuning != 0 )
+	{
+		if( export_handle_get_tuned_read_parameters(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve tuned read parameters.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	export_handle->input_filename = filename;
+	export_handle->input_is_open  = 1;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->input_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( export_handle->input_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the read parameters the input file was tuned with
+ * The records are exported by the number of threads that was tuned
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_tuned_read_parameters(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "export_handle_get_tuned_read_parameters";
+	size_t coalesced_read_size = 0;
+	uint64_t chunk_decode_time = 0;
+	uint64_t chunk_read_time   = 0;
+	int number_of_threads      = 0;
+	int read_ahead_depth       = 0;
+	int result                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_threads(
+	     export_handle->input_file,
+	     &number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of threads of input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_read_ahead_depth(
+	     export_handle->input_file,
+	     &read_ahead_depth,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read-ahead depth of input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_coalesced_read_size(
+	     export_handle->input_file,
+	     &coalesced_read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve coalesced read size of input file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_file_get_tuning_measurements(
+	          export_handle->input_file,
+	          &chunk_read_time,
+	          &chunk_decode_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve tuning measurements of input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads >= 1 )
+	 && ( number_of_threads <= EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		export_handle->number_of_threads = number_of_threads;
+	}
+	if( export_handle->timings != NULL )
+	{
+		if( export_timings_set_read_parameters(
+		     export_handle->timings,
+		     export_handle->number_of_threads,
+		     read_ahead_depth,
+		     coalesced_read_size,
+		     chunk_read_time,
+		     chunk_decode_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read parameters in timings.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		if( message_handle_close_input(
+		     export_handle->message_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input of message handle.",
+			 function );
+
+			result = -1;
+		}
+		if( export_handle_close_input_file(
+		     export_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Closes the input file without closing the input of the message handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_input_file(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input_file";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		if( libevtx_file_close(
+		     export_handle->input_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			result = -1;
+		}
+		if( export_handle->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( export_handle->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressed input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		export_handle->input_filename = NULL;
+		export_handle->input_is_open  = 0;
+	}
+	return( result );
+}
+
+/* Opens the output file
+ * The records are written to the output file instead of stdout
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_output";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_set_compression(
+	     export_handle->output_writer,
+	     export_handle->output_compression_method,
+	     export_handle->output_compression_level,
+	     export_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set output compression.",
+		 function );
+
+		return( -1 );
+	}
+	/* The output of the checkpointed input file is continued at the checkpoint
+	 */
+	if( ( export_handle->checkpoint != NULL )
+	 && ( export_handle->checkpoint->is_resumable != 0 )
+	 && ( export_handle->checkpoint->current_input_index == export_handle->checkpoint->input_index )
+	 && ( export_handle->checkpoint->output_offset > 0 ) )
+	{
+		result = output_writer_open_resume(
+		          export_handle->output_writer,
+		          filename,
+		          export_handle->checkpoint->output_offset,
+		          error );
+	}
+	else
+	{
+		result = output_writer_open(
+		          export_handle->output_writer,
+		          filename,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens an already opened output stream
+ * The records are written to the stream instead of stdout and the stream is
+ * closed when the output is closed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output_stream(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_output_stream";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_open_stream(
+	     export_handle->output_writer,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the extension of an output file, which depends on the export format
+ * The compression extension is set to NULL if the output is not compressed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_output_file_extension(
+     export_handle_t *export_handle,
+     const system_character_t **extension,
+     const system_character_t **compression_extension,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_output_file_extension";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression extension.",
+		 function );
+
+		return( -1 );
+	}
+	switch( export_handle->export_format )
+	{
+		case EXPORT_FORMAT_BODYFILE:
+			*extension = _SYSTEM_STRING( ".body" );
+			break;
+
+		case EXPORT_FORMAT_CSV:
+		case EXPORT_FORMAT_L2T_CSV:
+			*extension = _SYSTEM_STRING( ".csv" );
+			break;
+
+		case EXPORT_FORMAT_JSON:
+			*extension = _SYSTEM_STRING( ".json" );
+			break;
+
+		case EXPORT_FORMAT_ES_BULK:
+		case EXPORT_FORMAT_NDJSON:
+			*extension = _SYSTEM_STRING( ".ndjson" );
+			break;
+
+		case EXPORT_FORMAT_PROTOBUF:
+			*extension = _SYSTEM_STRING( ".pb" );
+			break;
+
+		case EXPORT_FORMAT_XML:
+			*extension = _SYSTEM_STRING( ".xml" );
+			break;
+
+		case EXPORT_FORMAT_TEXT:
+		default:
+			*extension = _SYSTEM_STRING( ".txt" );
+			break;
+	}
+	if( export_handle->output_compression_method == COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_GZIP )
+	{
+		*compression_extension = _SYSTEM_STRING( ".gz" );
+	}
+	else if( export_handle->output_compression_method == COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_ZSTD )
+	{
+		*compression_extension = _SYSTEM_STRING( ".zst" );
+	}
+	else
+	{
+		*compression_extension = NULL;
+	}
+	return( 1 );
+}
+
+/* Opens the time partitioned output in a directory
+ * The records are written to a partition file per hour or day of their written time
+ * instead of stdout
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_partitioned_output(
+     export_handle_t *export_handle,
+     const system_character_t *directory_name,
+     libcerror_error_t **error )
+{
+	const system_character_t *compression_extension = NULL;
+	const system_character_t *extension             = NULL;
+	static char *function                           = "export_handle_open_partitioned_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->partition_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - partition writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The JSON array and a checkpoint span the entire output
+	 * which cannot be split into partition files
+	 */
+	if( ( export_handle->export_format == EXPORT_FORMAT_JSON )
+	 || ( export_handle->checkpoint != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: partitioned output is not supported with the JSON format or a checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_output_file_extension(
+	     export_handle,
+	     &extension,
+	     &compression_extension,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve output file extension.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_writer_make_directory(
+	     directory_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create output directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_writer_initialize(
+	     &( export_handle->partition_writer ),
+	     directory_name,
+	     export_handle->partition_granularity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_writer_set_extension(
+	     export_handle->partition_writer,
+	     extension,
+	     compression_extension,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set extension of partition writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( partition_writer_set_compression(
+	     export_handle->partition_writer,
+	     export_handle->output_compression_method,
+	     export_handle->output_compression_level,
+	     export_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compression of partition writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( partition_writer_set_flush_interval(
+	     export_handle->partition_writer,
+	     export_handle->output_writer->flush_interval,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set flush interval of partition writer.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->unpartitioned_output_writer = export_handle->output_writer;
+	export_handle->partition_is_selected       = 0;
+
+	return( 1 );
+
+on_error:
+	partition_writer_free(
+	 &( export_handle->partition_writer ),
+	 NULL );
+
+	return( -1 );
+}
+
+/* Selects the partition file the record is written to, based on its written time
+ * The start of the output is written when a partition file is created
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_select_partition(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	output_writer_t *output_writer = NULL;
+	static char *function          = "export_handle_select_partition";
+	uint64_t bucket                = 0;
+	uint64_t written_time          = 0;
+	int result                     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	/* A record without a written time is written to the partition of January 1, 1601
+	 */
+	if( libevtx_record_get_written_time(
+	     record,
+	     &written_time,
+	     NULL ) != 1 )
+	{
+		written_time = 0;
+	}
+	/* The records in a chunk are mostly in time order so consecutive records
+	 * are typically written to the selected partition
+	 */
+	if( ( export_handle->partition_is_selected != 0 )
+	 && ( written_time >= export_handle->partition_first_filetime )
+	 && ( written_time <= export_handle->partition_last_filetime ) )
+	{
+		return( 1 );
+	}
+	result = partition_writer_get_output_writer(
+	          export_handle->partition_writer,
+	          written_time,
+	          &output_writer,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve output writer of partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_writer_get_bucket_time_range(
+	     export_handle->partition_writer,
+	     written_time,
+	     &bucket,
+	     &( export_handle->partition_first_filetime ),
+	     &( export_handle->partition_last_filetime ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time range of partition.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->output_writer         = output_writer;
+	export_handle->partition_is_selected = 1;
+
+	if( result != 0 )
+	{
+		if( export_handle_write_start_of_output(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write start of output of partition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Closes the output file
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_output";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->partition_writer != NULL )
+	{
+		export_handle->output_writer         = export_handle->unpartitioned_output_writer;
+		export_handle->partition_is_selected = 0;
+
+		if( partition_writer_close(
+		     export_handle->partition_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close partition files.",
+			 function );
+
+			result = -1;
+		}
+		if( partition_writer_free(
+		     &( export_handle->partition_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition writer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( output_writer_close(
+	     export_handle->output_writer,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the template definition of an event of a specific provider
+ * The template definition is managed by the template definition cache
+ * and is parsed only once for all the records of the event
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int export_handle_get_template_definition(
+     export_handle_t *export_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	libevtx_template_definition_t *safe_template_definition = NULL;
+	resource_file_mapped_data_t *mapped_data                = NULL;
+	const uint8_t *resource_data                            = NULL;
+	uint8_t *template_data                                  = NULL;
+	static char *function                                   = "export_handle_get_template_definition";
+	size_t resource_data_size                               = 0;
+	size_t template_data_size                               = 0;
+	uint32_t template_data_offset                           = 0;
+	int result                                              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = template_definition_cache_get_template_definition(
+	          export_handle->template_definition_cache,
+	          provider_identifier,
+	          provider_identifier_size,
+	          event_identifier,
+	          template_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( *template_definition == NULL )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	result = message_handle_get_template_definition_data(
+	          export_handle->message_handle,
+	          resource_filename,
+	          resource_filename_length,
+	          provider_identifier,
+	          provider_identifier_size,
+	          event_identifier,
+	          &template_data,
+	          &template_data_size,
+	          &template_data_offset,
+	          &resource_data,
+	          &resource_data_size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libevtx_template_definition_initialize(
+		     &safe_template_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create template definitions.",
+			 function );
+
+			goto on_error;
+		}
+		/* A template definition read from the memory mapped resource data references
+		 * the resource data instead of a copy of the template data
+		 */
+		if( mapped_data != NULL )
+		{
+			if( libevtx_template_definition_set_resource_data(
+			     safe_template_definition,
+			     resource_data,
+			     resource_data_size,
+			     template_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set template resource data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libevtx_template_definition_set_data(
+			     safe_template_definition,
+			     template_data,
+			     template_data_size,
+			     template_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set template data.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 template_data );
+
+			template_data = NULL;
+		}
+	}
+	/* The events without a template definition are cached as well
+	 * to prevent looking them up in the resource file for every record
+	 */
+	if( template_definition_cache_append_template_definition(
+	     export_handle->template_definition_cache,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     safe_template_definition,
+	     mapped_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append template definition to cache.",
+		 function );
+
+		/* The cache takes over management of the template definition and
+		 * the mapped data, also on error
+		 */
+		return( -1 );
+	}
+	*template_definition = safe_template_definition;
+
+	return( result );
+
+on_error:
+	if( template_data != NULL )
+	{
+		memory_free(
+		 template_data );
+	}
+	if( safe_template_definition != NULL )
+	{
+		libevtx_template_definition_free(
+		 &safe_template_definition,
+		 NULL );
+	}
+	if( mapped_data != NULL )
+	{
+		resource_file_mapped_data_free(
+		 &mapped_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the event message cache entry of an event
+ * The event message is resolved only once for all the records of the event
+ * of a specific provider and is managed by the event message cache
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_event_message_cache_entry(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ 16 ];
+
+	libevtx_template_definition_t *template_definition = NULL;
+	message_string_t *message_string                   = NULL;
+	system_character_t *message_filename               = NULL;
+	system_character_t *resource_filename              = NULL;
+	static char *function                              = "export_handle_get_event_message_cache_entry";
+	size_t message_filename_size                       = 0;
+	size_t resource_filename_size                      = 0;
+	uint32_t message_identifier                        = 0;
+	uint8_t message_identifier_is_event_identifier     = 0;
+	int result                                         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = event_message_cache_get_entry(
+	          export_handle->event_message_cache,
+	          event_provider_identifier,
+	          event_provider_identifier_length,
+	          event_source,
+	          event_source_length,
+	          event_identifier,
+	          event_identifier_qualifiers,
+	          cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event message from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	if( event_provider_identifier != NULL )
+	{
+		result = message_handle_get_value_by_provider_identifier(
+		          export_handle->message_handle,
+		          event_provider_identifier,
+		          event_provider_identifier_length,
+		          _SYSTEM_STRING( "ResourceFileName" ),
+		          16,
+		          &resource_filename,
+		          &resource_filename_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource filename by provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+		result = message_handle_get_value_by_provider_identifier(
+		          export_handle->message_handle,
+		          event_provider_identifier,
+		          event_provider_identifier_length,
+		          _SYSTEM_STRING( "MessageFileName" ),
+		          15,
+		          &message_filename,
+		          &message_filename_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message filename by provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( message_filename == NULL )
+	 && ( event_source != NULL ) )
+	{
+		result = message_handle_get_value_by_event_source(
+		          export_handle->message_handle,
+		          event_source,
+		          event_source_length,
+		          _SYSTEM_STRING( "EventMessageFile" ),
+		          16,
+		          &message_filename,
+		          &message_filename_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message filename by event source.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( resource_filename != NULL )
+	{
+		result = libevtx_record_get_provider_identifier(
+		          record,
+		          provider_identifier,
+		          16,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = message_handle_get_event_message_identifier(
+				  export_handle->message_handle,
+				  resource_filename,
+				  resource_filename_size - 1,
+				  provider_identifier,
+				  16,
+				  event_identifier,
+				  &message_identifier,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message identifier.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				message_identifier = 0;
+			}
+			if( export_handle->use_template_definition != 0 )
+			{
+				result = export_handle_get_template_definition(
+					  export_handle,
+					  resource_filename,
+					  resource_filename_size - 1,
+					  provider_identifier,
+					  16,
+					  event_identifier,
+					  &template_definition,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve tempate definition.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	if( message_filename != NULL )
+	{
+		if( message_identifier == 0 )
+		{
+			message_identifier = ( event_identifier_qualifiers << 16 ) | event_identifier;
+
+			message_identifier_is_event_identifier = 1;
+		}
+		result = message_handle_get_message_string(
+			  export_handle->message_handle,
+			  message_filename,
+			  message_filename_size - 1,
+			  message_identifier,
+			  &message_string,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( event_message_cache_append_entry(
+	     export_handle->event_message_cache,
+	     event_provider_identifier,
+	     event_provider_identifier_length,
+	     event_source,
+	     event_source_length,
+	     event_identifier,
+	     event_identifier_qualifiers,
+	     cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event message to cache.",
+		 function );
+
+		goto on_error;
+	}
+	( *cache_entry )->resource_filename                      = resource_filename;
+	( *cache_entry )->message_filename                       = message_filename;
+	( *cache_entry )->message_identifier                     = message_identifier;
+	( *cache_entry )->message_identifier_is_event_identifier = message_identifier_is_event_identifier;
+	( *cache_entry )->template_definition                    = template_definition;
+
+	/* The message string is managed by the resource file that can be removed
+	 * from the resource file cache hence the cache entry contains a copy
+	 */
+	if( message_string_clone(
+	     &( ( *cache_entry )->message_string ),
+	     message_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( message_filename != NULL )
+	{
+		memory_free(
+		 message_filename );
+	}
+	if( resource_filename != NULL )
+	{
+		memory_free(
+		 resource_filename );
+	}
+	*cache_entry = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves a scratch string of at least the string size
+ * The scratch string is reused between the records that are exported
+ * and grows to the largest size requested
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_scratch_string(
+     export_handle_t *export_handle,
+     int scratch_string_index,
+     size_t string_size,
+     system_character_t **string,
+     libcerror_error_t **error )
+{
+	system_character_t *reallocation = NULL;
+	static char *function            = "export_handle_get_scratch_string";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scratch_string_index < 0 )
+	 || ( scratch_string_index >= EXPORT_HANDLE_NUMBER_OF_SCRATCH_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scratch string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) ( SSIZE_MAX / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > export_handle->scratch_string_sizes[ scratch_string_index ] )
+	{
+		reallocation = (system_character_t *) memory_reallocate(
+		                                       export_handle->scratch_strings[ scratch_string_index ],
+		                                       sizeof( system_character_t ) * string_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize scratch string: %d.",
+			 function,
+			 scratch_string_index );
+
+			return( -1 );
+		}
+		export_handle->scratch_strings[ scratch_string_index ]      = reallocation;
+		export_handle->scratch_string_sizes[ scratch_string_index ] = string_size;
+	}
+	*string = export_handle->scratch_strings[ scratch_string_index ];
+
+	return( 1 );
+}
+
+/* Exports the record event message
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_event_message(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	event_message_cache_entry_t *cache_entry           = NULL;
+	libevtx_template_definition_t *template_definition = NULL;
+	message_string_t *message_string                   = NULL;
+	static char *function                              = "export_handle_export_record_event_message";
+	size_t value_string_size                           = 0;
+	uint32_t event_identifier_qualifiers               = 0;
+	uint8_t has_event_identifier_qualifiers            = 0;
+	int number_of_strings                              = 0;
+	int result                                         = 0;
+	int value_string_index                             = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	system_character_t *value_string                   = NULL;
+#else
+	const size_t *utf8_string_offsets                  = NULL;
+	const size_t *utf8_string_sizes                    = NULL;
+	const uint8_t *utf8_strings                        = NULL;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_get_event_identifier_qualifiers(
+		  record,
+		  &event_identifier_qualifiers,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers.",
+		 function );
+
+		goto on_error;
+	}
+	has_event_identifier_qualifiers = (uint8_t) result;
+
+	if( export_handle_get_event_message_cache_entry(
+	     export_handle,
+	     record,
+	     event_provider_identifier,
+	     event_provider_identifier_length,
+	     event_source,
+	     event_source_length,
+	     event_identifier,
+	     event_identifier_qualifiers,
+	     &cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event message.",
+		 function );
+
+		goto on_error;
+	}
+	if( cache_entry->resource_filename != NULL )
+	{
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "Resource filename\t\t: %" PRIs_SYSTEM "\n",
+		 cache_entry->resource_filename );
+	}
+	if( cache_entry->message_filename != NULL )
+	{
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "Message filename\t\t: %" PRIs_SYSTEM "\n",
+		 cache_entry->message_filename );
+
+		if( export_handle->verbose != 0 )
+		{
+			if( ( cache_entry->message_identifier_is_event_identifier != 0 )
+			 && ( has_event_identifier_qualifiers != 0 ) )
+			{
+				output_writer_printf(
+				 export_handle->output_writer,
+				 "Event identifier qualifiers\t: 0x%08" PRIx32 "\n",
+				 event_identifier_qualifiers );
+			}
+			output_writer_printf(
+			 export_handle->output_writer,
+			 "Message identifier\t\t: 0x%08" PRIx32 "\n",
+			 cache_entry->message_identifier );
+		}
+	}
+	template_definition = cache_entry->template_definition;
+	message_string      = cache_entry->message_string;
+
+	if( export_handle->use_template_definition != 0 )
+	{
+		result = libevtx_record_parse_data_with_template_definition(
+			  record,
+			  template_definition,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse record data.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		template_definition = NULL;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings in record.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	/* The strings are converted in one pass and are reused by the message string
+	 */
+	if( libevtx_record_get_utf8_strings(
+	     record,
+	     &utf8_strings,
+	     &number_of_strings,
+	     &utf8_string_offsets,
+	     &utf8_string_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings in record.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	output_writer_printf(
+	 export_handle->output_writer,
+	 "Number of strings\t\t: %d\n",
+	 number_of_strings );
+
+	for( value_string_index = 0;
+	     value_string_index < number_of_strings;
+	     value_string_index++ )
+	{
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "String: %d\t\t\t: ",
+		 value_string_index + 1 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_record_get_utf16_string_size(
+			  record,
+			  value_string_index,
+			  &value_string_size,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d size.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			if( export_handle_get_scratch_string(
+			     export_handle,
+			     EXPORT_SCRATCH_STRING_VALUE,
+			     value_string_size,
+			     &value_string,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value string.",
+				 function );
+
+				goto on_error;
+			}
+			result = libevtx_record_get_utf16_string(
+				  record,
+				  value_string_index,
+				  (uint16_t *) value_string,
+				  value_string_size,
+				  error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d.",
+				 function,
+				 value_string_index );
+
+				goto on_error;
+			}
+			output_writer_printf(
+			 export_handle->output_writer,
+			 "%" PRIs_SYSTEM "",
+			 value_string );
+		}
+#else
+		value_string_size = utf8_string_sizes[ value_string_index ];
+
+		/* The string size includes the end of string character
+		 */
+		if( value_string_size > 1 )
+		{
+			if( output_writer_write_data(
+			     export_handle->output_writer,
+			     &( utf8_strings[ utf8_string_offsets[ value_string_index ] ] ),
+			     value_string_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string: %d.",
+				 function,
+				 value_string_index );
+
+				goto on_error;
+			}
+		}
+#endif
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "\n" );
+	}
+	if( message_string != NULL )
+	{
+		if( message_string_print(
+		     message_string,
+		     record,
+		     export_handle->output_writer,
+		     &( export_handle->scratch_strings[ EXPORT_SCRATCH_STRING_VALUE ] ),
+		     &( export_handle->scratch_string_sizes[ EXPORT_SCRATCH_STRING_VALUE ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_string = NULL;
+	}
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Exports the record
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_export_record";
+	size_t xml_string_size = 0;
+	uint64_t message_time  = 0;
+	uint64_t start_time    = 0;
+	uint32_t record_size   = 0;
+	int number_of_strings  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->timings != NULL )
+	{
+		/* The record is decoded before it is formatted, so that the decoding
+		 * is not accounted to the format phase. Errors are ignored here since
+		 * they are reported when the record is formatted.
+		 */
+		start_time = export_timings_get_time();
+
+		if( export_handle->export_format == EXPORT_FORMAT_XML )
+		{
+			libevtx_record_get_utf8_xml_string_size(
+			 record,
+			 &xml_string_size,
+			 NULL );
+		}
+		else
+		{
+			libevtx_record_get_number_of_strings(
+			 record,
+			 &number_of_strings,
+			 NULL );
+		}
+		if( export_timings_add_phase_time(
+		     export_handle->timings,
+		     EXPORT_TIMINGS_PHASE_DECODE,
+		     start_time,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add decode time.",
+			 function );
+
+			return( -1 );
+		}
+		message_time = export_handle->timings->phase_times[ EXPORT_TIMINGS_PHASE_MESSAGE ];
+		start_time   = export_timings_get_time();
+	}
+	if( export_handle->partition_writer != NULL )
+	{
+		if( export_handle_select_partition(
+		     export_handle,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to select partition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+	{
+		if( export_handle_export_record_text(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in text.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_XML )
+	{
+		if( export_handle_export_record_xml(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in XML.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( export_handle->export_format == EXPORT_FORMAT_JSON )
+	      || ( export_handle->export_format == EXPORT_FORMAT_NDJSON ) )
+	{
+		if( export_handle_export_record_json(
+		     export_handle,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in JSON.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_ES_BULK )
+	{
+		if( export_handle_export_record_es_bulk(
+		     export_handle,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in Elasticsearch bulk format.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_PROTOBUF )
+	{
+		if( export_handle_export_record_protobuf(
+		     export_handle,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in Protocol Buffers format.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_CSV )
+	{
+		if( export_handle_export_record_csv(
+		     export_handle,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in CSV.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_BODYFILE )
+	{
+		if( export_handle_export_record_bodyfile(
+		     export_handle,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in bodyfile.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_L2T_CSV )
+	{
+		if( export_handle_export_record_l2t_csv(
+		     export_handle,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in L2T CSV.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->timings != NULL )
+	{
+		/* The time spent on the event message is accounted to the message phase
+		 */
+		message_time = export_handle->timings->phase_times[ EXPORT_TIMINGS_PHASE_MESSAGE ] - message_time;
+
+		if( export_timings_add_phase_time(
+		     export_handle->timings,
+		     EXPORT_TIMINGS_PHASE_FORMAT,
+		     start_time,
+		     message_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add format time.",
+			 function );
+
+			return( -1 );
+		}
+		start_time = export_timings_get_time();
+	}
+	/* The buffered output is written between records
+	 */
+	if( output_writer_flush_when_full(
+	     export_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->timings != NULL )
+	{
+		if( export_timings_add_phase_time(
+		     export_handle->timings,
+		     EXPORT_TIMINGS_PHASE_OUTPUT,
+		     start_time,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add output time.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_record_get_size(
+		     record,
+		     &record_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record size.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_timings_add_record(
+		     export_handle->timings,
+		     record_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the provider identifier and source name of the record
+ * The strings are stored in the scratch strings of the export handle and are
+ * set to NULL if not available
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_record_event_source(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     system_character_t **provider_identifier,
+     size_t *provider_identifier_size,
+     system_character_t **source_name,
+     size_t *source_name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_record_event_source";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier size.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source name.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source name size.",
+		 function );
+
+		return( -1 );
+	}
+	*provider_identifier      = NULL;
+	*provider_identifier_size = 0;
+	*source_name              = NULL;
+	*source_name_size         = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_get_utf16_provider_identifier_size(
+	          record,
+	          provider_identifier_size,
+	          error );
+#else
+	result = libevtx_record_get_utf8_provider_identifier_size(
+	          record,
+	          provider_identifier_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( *provider_identifier_size > 0 ) )
+	{
+		if( export_handle_get_scratch_string(
+		     export_handle,
+		     EXPORT_SCRATCH_STRING_PROVIDER_IDENTIFIER,
+		     *provider_identifier_size,
+		     provider_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_record_get_utf16_provider_identifier(
+		          record,
+		          (uint16_t *) *provider_identifier,
+		          *provider_identifier_size,
+		          error );
+#else
+		result = libevtx_record_get_utf8_provider_identifier(
+		          record,
+		          (uint8_t *) *provider_identifier,
+		          *provider_identifier_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_get_utf16_source_name_size(
+	          record,
+	          source_name_size,
+	          error );
+#else
+	result = libevtx_record_get_utf8_source_name_size(
+	          record,
+	          source_name_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( *source_name_size > 0 ) )
+	{
+		if( export_handle_get_scratch_string(
+		     export_handle,
+		     EXPORT_SCRATCH_STRING_SOURCE_NAME,
+		     *source_name_size,
+		     source_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source name.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_record_get_utf16_source_name(
+		          record,
+		          (uint16_t *) *source_name,
+		          *source_name_size,
+		          error );
+#else
+		result = libevtx_record_get_utf8_source_name(
+		          record,
+		          (uint8_t *) *source_name,
+		          *source_name_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	*provider_identifier      = NULL;
+	*provider_identifier_size = 0;
+	*source_name              = NULL;
+	*source_name_size         = 0;
+
+	return( -1 );
+}
+
+/* Exports the record in the text format
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_text(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	uint8_t filetime_string[ FILETIME_FORMATTER_STRING_SIZE ];
+
+	system_character_t *source_name         = NULL;
+	system_character_t *provider_identifier = NULL;
+	system_character_t *value_string        = NULL;
+	static char *function                   = "export_handle_export_record_text";
+	size_t source_name_size                 = 0;
+	size_t provider_identifier_size         = 0;
+	size_t value_string_size                = 0;
+	uint64_t start_time                     = 0;
+	uint64_t value_64bit                    = 0;
+	uint32_t event_identifier               = 0;
+	uint8_t event_level                     = 0;
+	int result                              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	output_writer_printf(
+	 export_handle->output_writer,
+	 "Event number\t\t\t: %" PRIu64 "\n",
+	 value_64bit );
+
+	if( libevtx_record_get_written_time(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( filetime_formatter_copy_to_utf8_string(
+	     export_handle->filetime_formatter,
+	     value_64bit,
+	     FILETIME_FORMATTER_FORMAT_TYPE_CTIME,
+	     filetime_string,
+	     FILETIME_FORMATTER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy filetime to string.",
+		 function );
+
+		goto on_error;
+	}
+	output_writer_printf(
+	 export_handle->output_writer,
+	 "Written time\t\t\t: %s UTC\n",
+	 (char *) filetime_string );
+
+	if( libevtx_record_get_event_level(
+	     record,
+	     &event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level.",
+		 function );
+
+		goto on_error;
+	}
+	output_writer_printf(
+	 export_handle->output_writer,
+	 "Event level\t\t\t: %s (%d)\n",
+	 export_handle_get_event_level(
+	  event_level ),
+	 event_level );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_get_utf16_user_security_identifier_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevtx_record_get_utf8_user_security_identifier_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve user security identifier size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		if( export_handle_get_scratch_string(
+		     export_handle,
+		     EXPORT_SCRATCH_STRING_VALUE,
+		     value_string_size,
+		     &value_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_record_get_utf16_user_security_identifier(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevtx_record_get_utf8_user_security_identifier(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve user security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "User security identifier\t: %" PRIs_SYSTEM "\n",
+		 value_string );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_get_utf16_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevtx_record_get_utf8_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve computer name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		if( export_handle_get_scratch_string(
+		     export_handle,
+		     EXPORT_SCRATCH_STRING_VALUE,
+		     value_string_size,
+		     &value_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_record_get_utf16_computer_name(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevtx_record_get_utf8_computer_name(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve computer name.",
+			 function );
+
+			goto on_error;
+		}
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
+		 value_string );
+	}
+	if( export_handle_get_record_event_source(
+	     export_handle,
+	     record,
+	     &provider_identifier,
+	     &provider_identifier_size,
+	     &source_name,
+	     &source_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event source.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( export_handle->verbose != 0 )
+	 && ( provider_identifier != NULL ) )
+	{
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "Provider identifier\t\t: %" PRIs_SYSTEM "\n",
+		 provider_identifier );
+	}
+	if( source_name != NULL )
+	{
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
+		 source_name );
+	}
+/* TODO category ? */
+
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	output_writer_printf(
+	 export_handle->output_writer,
+	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
+	 event_identifier,
+	 event_identifier );
+
+	if( export_handle->timings != NULL )
+	{
+		start_time = export_timings_get_time();
+	}
+	if( export_handle_export_record_event_message(
+	     export_handle,
+	     record,
+	     provider_identifier,
+	     provider_identifier_size - 1,
+	     source_name,
+	     source_name_size - 1,
+	     event_identifier,
+	     log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export event message.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->timings != NULL )
+	{
+		if( export_timings_add_phase_time(
+		     export_handle->timings,
+		     EXPORT_TIMINGS_PHASE_MESSAGE,
+		     start_time,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add message time.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	output_writer_printf(
+	 export_handle->output_writer,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Removes the indentation from the XML string
+ * The new line and indentation between the end of a tag and the start of the next tag
+ * are removed. The remaining new lines, which are part of values, are replaced by
+ * character references so that the XML string consists of a single line, except
+ * for the new line at the end of the XML string
+ * The XML string is reallocated if needed and the XML string size, which includes
+ * the end of string character, is updated
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_compact_xml_string(
+     system_character_t **xml_string,
+     size_t *xml_string_size,
+     libcerror_error_t **error )
+{
+	system_character_t *compacted_string = NULL;
+	system_character_t *string           = NULL;
+	static char *function                = "export_handle_compact_xml_string";
+	size_t compacted_index               = 0;
+	size_t compacted_string_size         = 0;
+	size_t number_of_references          = 0;
+	size_t string_index                  = 0;
+	size_t string_size                   = 0;
+	size_t whitespace_index              = 0;
+	int pass                             = 0;
+
+	if( xml_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML string size.",
+		 function );
+
+		return( -1 );
+	}
+	string      = *xml_string;
+	string_size = *xml_string_size;
+
+	/* The end of string character and the new line before it are retained
+	 */
+	while( ( string_size > 0 )
+	    && ( string[ string_size - 1 ] == 0 ) )
+	{
+		string_size--;
+	}
+	if( ( string_size > 0 )
+	 && ( string[ string_size - 1 ] == (system_character_t) '\n' ) )
+	{
+		string_size--;
+	}
+	/* The first pass determines the compacted string size, the second pass
+	 * writes the compacted string in place, or in a new string if the new lines
+	 * of values are replaced by character references or the string is too small
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		compacted_index = 0;
+		string_index    = 0;
+
+		while( string_index < string_size )
+		{
+			if( ( string[ string_index ] == (system_character_t) '\n' )
+			 || ( string[ string_index ] == (system_character_t) '\r' ) )
+			{
+				if( ( string_index > 0 )
+				 && ( string[ string_index - 1 ] == (system_character_t) '>' ) )
+				{
+					whitespace_index = string_index;
+
+					while( ( whitespace_index < string_size )
+					    && ( ( string[ whitespace_index ] == (system_character_t) '\n' )
+					      || ( string[ whitespace_index ] == (system_character_t) '\r' )
+					      || ( string[ whitespace_index ] == (system_character_t) ' ' )
+					      || ( string[ whitespace_index ] == (system_character_t) '\t' ) ) )
+					{
+						whitespace_index++;
+					}
+					if( ( whitespace_index < string_size )
+					 && ( string[ whitespace_index ] == (system_character_t) '<' ) )
+					{
+						string_index = whitespace_index;
+
+						continue;
+					}
+				}
+				if( pass == 0 )
+				{
+					number_of_references++;
+
+					compacted_index += 5;
+				}
+				else
+				{
+					compacted_string[ compacted_index++ ] = (system_character_t) '&';
+					compacted_string[ compacted_index++ ] = (system_character_t) '#';
+					compacted_string[ compacted_index++ ] = (system_character_t) '1';
+
+					if( string[ string_index ] == (system_character_t) '\n' )
+					{
+						compacted_string[ compacted_index++ ] = (system_character_t) '0';
+					}
+					else
+					{
+						compacted_string[ compacted_index++ ] = (system_character_t) '3';
+					}
+					compacted_string[ compacted_index++ ] = (system_character_t) ';';
+				}
+				string_index++;
+
+				continue;
+			}
+			if( ( pass == 1 )
+			 && ( compacted_string != NULL ) )
+			{
+				compacted_string[ compacted_index ] = string[ string_index ];
+			}
+			else if( pass == 1 )
+			{
+				string[ compacted_index ] = string[ string_index ];
+			}
+			compacted_index++;
+			string_index++;
+		}
+		if( pass == 0 )
+		{
+			/* The new line and end of string character
+			 */
+			compacted_string_size = compacted_index + 2;
+
+			if( ( number_of_references > 0 )
+			 || ( compacted_string_size > *xml_string_size ) )
+			{
+				compacted_string = system_string_allocate(
+				                    compacted_string_size );
+
+				if( compacted_string == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create compacted XML string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+	}
+	if( compacted_string != NULL )
+	{
+		memory_free(
+		 *xml_string );
+
+		*xml_string = compacted_string;
+	}
+	( *xml_string )[ compacted_index++ ] = (system_character_t) '\n';
+	( *xml_string )[ compacted_index++ ] = 0;
+
+	*xml_string_size = compacted_index;
+
+	return( 1 );
+}
+
+/* Retrieves the event XML string of the record
+ * The event XML string is allocated and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_record_xml_string(
+     libevtx_record_t *record,
+     uint8_t compact_xml,
+     system_character_t **event_xml,
+     size_t *event_xml_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_record_xml_string";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_xml == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event XML.",
+		 function );
+
+		return( -1 );
+	}
+	if( *event_xml != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid event XML value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_xml_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event XML size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_record_get_utf16_xml_string_size(
+	     record,
+	     event_xml_size,
+	     error ) != 1 )
+#else
+	if( libevtx_record_get_utf8_xml_string_size(
+	     record,
+	     event_xml_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event XML size.",
+		 function );
+
+		goto on_error;
+	}
+	if( *event_xml_size == 0 )
+	{
+		return( 1 );
+	}
+	*event_xml = system_string_allocate(
+	              *event_xml_size );
+
+	if( *event_xml == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event XML.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_record_get_utf16_xml_string(
+	     record,
+	     (uint16_t *) *event_xml,
+	     *event_xml_size,
+	     error ) != 1 )
+#else
+	if( libevtx_record_get_utf8_xml_string(
+	     record,
+	     (uint8_t *) *event_xml,
+	     *event_xml_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event XML.",
+		 function );
+
+		goto on_error;
+	}
+	if( compact_xml != 0 )
+	{
+		if( export_handle_compact_xml_string(
+		     event_xml,
+		     event_xml_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to compact event XML.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *event_xml != NULL )
+	{
+		memory_free(
+		 *event_xml );
+
+		*event_xml = NULL;
+	}
+	*event_xml_size = 0;
+
+	return( -1 );
+}
+
+/* Exports the record in the XML format
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_xml(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *event_xml = NULL;
+	static char *function         = "export_handle_export_record_xml";
+	size_t event_xml_size         = 0;
+	int result                    = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_record_xml_string(
+	     record,
+	     export_handle->compact_xml,
+	     &event_xml,
+	     &event_xml_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event XML string.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_xml != NULL )
+	{
+		/* Note that the event XML ends with a new line
+		 */
+		result = output_writer_write_system_string(
+		          export_handle->output_writer,
+		          event_xml,
+		          error );
+
+		memory_free(
+		 event_xml );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write event XML.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The compact XML contains every record on a single line
+	 */
+	if( export_handle->compact_xml == 0 )
+	{
+		output_writer_printf(
+		 export_handle->output_writer,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Retrieves the written time of the record as an UTF-8 encoded ISO 8601 string
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_record_written_time_string(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_record_written_time_string";
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_written_time(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime_formatter_copy_to_utf8_string(
+	     export_handle->filetime_formatter,
+	     value_64bit,
+	     FILETIME_FORMATTER_FORMAT_TYPE_ISO8601,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy filetime to string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a JSON value string of at least the value string size
+ * The JSON value string is reused between the values that are written
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_json_value_string(
+     export_handle_t *export_handle,
+     size_t value_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "export_handle_get_json_value_string";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_string_size == 0 )
+	 || ( value_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size > export_handle->json_value_string_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            export_handle->json_value_string,
+		                            sizeof( uint8_t ) * value_string_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize JSON value string.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->json_value_string      = reallocation;
+		export_handle->json_value_string_size = value_string_size;
+	}
+	return( 1 );
+}
+
+/* Writes a string value of the record as a member of the JSON object
+ * Returns 1 if successful, 0 if the value is not available or -1 on error
+ */
+int export_handle_write_json_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const char *name,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function    = "export_handle_write_json_record_value";
+	size_t value_string_size = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( get_value_size == NULL )
+	 || ( get_value == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get value function.",
+		 function );
+
+		return( -1 );
+	}
+	result = get_value_size(
+	          record,
+	          &value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve %s size.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( value_string_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( export_handle_get_json_value_string(
+	     export_handle,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve JSON value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_value(
+	     record,
+	     export_handle->json_value_string,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve %s.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	if( output_writer_write_data(
+	     export_handle->output_writer,
+	     (uint8_t *) ",",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_json_member_name(
+	     export_handle->output_writer,
+	     name,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_json_string(
+	     export_handle->output_writer,
+	     export_handle->json_value_string,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write %s.",
+	 function,
+	 name );
+
+	return( -1 );
+}
+
+/* Retrieves the built-in field definitions of the provider event of the record
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int export_handle_get_provider_fields_definition(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const provider_fields_definition_t **fields_definition,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ 16 ];
+
+	static char *function     = "export_handle_get_provider_fields_definition";
+	uint32_t event_identifier = 0;
+	uint8_t event_version     = 0;
+	int result                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_get_provider_identifier(
+	          record,
+	          provider_identifier,
+	          16,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider identifier.",
+			 function );
+		}
+		return( result );
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_get_event_version(
+	          record,
+	          &event_version,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event version.",
+		 function );
+
+		return( -1 );
+	}
+	result = provider_fields_get_definition(
+	          provider_identifier,
+	          16,
+	          event_identifier,
+	          event_version,
+	          fields_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider fields definition.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Writes the value of an event data string as a JSON value of the type of its field definition
+ * Unsigned integer values are written as a JSON number and boolean values as a JSON literal,
+ * other values and values that are not formatted as expected are written as a JSON string
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_field_value(
+     export_handle_t *export_handle,
+     int field_type,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_json_field_value";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int is_literal        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_length < utf8_string_size )
+	    && ( utf8_string[ string_length ] != 0 ) )
+	{
+		string_length++;
+	}
+	if( field_type == PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER )
+	{
+		/* A JSON number has no leading zeros
+		 */
+		if( ( string_length > 0 )
+		 && ( string_length <= 20 )
+		 && ( ( string_length == 1 )
+		  || ( utf8_string[ 0 ] != (uint8_t) '0' ) ) )
+		{
+			is_literal = 1;
+
+			for( string_index = 0;
+			     string_index < string_length;
+			     string_index++ )
+			{
+				if( ( utf8_string[ string_index ] < (uint8_t) '0' )
+				 || ( utf8_string[ string_index ] > (uint8_t) '9' ) )
+				{
+					is_literal = 0;
+
+					break;
+				}
+			}
+		}
+	}
+	else if( field_type == PROVIDER_FIELD_TYPE_BOOLEAN )
+	{
+		if( ( ( string_length == 4 )
+		  && ( memory_compare(
+		        utf8_string,
+		        "true",
+		        4 ) == 0 ) )
+		 || ( ( string_length == 5 )
+		  && ( memory_compare(
+		        utf8_string,
+		        "false",
+		        5 ) == 0 ) ) )
+		{
+			is_literal = 1;
+		}
+	}
+	if( is_literal != 0 )
+	{
+		if( output_writer_write_data(
+		     export_handle->output_writer,
+		     utf8_string,
+		     string_length,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( output_writer_write_json_string(
+		     export_handle->output_writer,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write field value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the strings of the record as a JSON array of Name and Value pairs
+ * The array retains the order of the strings and strings with the same name
+ * Strings without a Name attribute are named by the built-in field definitions
+ * of the provider event, if available, which also determine the type of their value
+ * The prefix, if not NULL, is written before the array
+ * Returns 1 if successful, 0 if the record has no strings or -1 on error
+ */
+int export_handle_write_json_record_event_data(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const char *prefix,
+     libcerror_error_t **error )
+{
+	const provider_field_definition_t *field_definition   = NULL;
+	const provider_fields_definition_t *fields_definition = NULL;
+	const size_t *utf8_string_offsets                     = NULL;
+	const size_t *utf8_string_sizes                       = NULL;
+	const uint8_t *utf8_strings                           = NULL;
+	static char *function                                 = "export_handle_write_json_record_event_data";
+	size_t value_string_size                              = 0;
+	int fields_definition_result                          = -1;
+	int number_of_strings                                 = 0;
+	int string_index                                      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_utf8_strings(
+	     record,
+	     &utf8_strings,
+	     &number_of_strings,
+	     &utf8_string_offsets,
+	     &utf8_string_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings in record.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == 0 )
+	{
+		return( 0 );
+	}
+	if( prefix != NULL )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     prefix,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "[",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     ( string_index == 0 ) ? "{\"Name\":" : ",{\"Name\":",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( libevtx_record_get_utf8_string_name_size(
+		     record,
+		     string_index,
+		     &value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d name size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( export_handle_get_json_value_string(
+		     export_handle,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve JSON value string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_record_get_utf8_string_name(
+		     record,
+		     string_index,
+		     export_handle->json_value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d name.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		/* A string without a Name attribute is named after its element
+		 */
+		field_definition = NULL;
+
+		if( ( value_string_size <= 1 )
+		 || ( ( value_string_size == 5 )
+		  && ( memory_compare(
+		        export_handle->json_value_string,
+		        "Data",
+		        5 ) == 0 ) ) )
+		{
+			if( fields_definition_result == -1 )
+			{
+				fields_definition_result = export_handle_get_provider_fields_definition(
+				                            export_handle,
+				                            record,
+				                            &fields_definition,
+				                            error );
+
+				if( fields_definition_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve provider fields definition.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( ( fields_definition_result == 1 )
+			 && ( string_index < fields_definition->number_of_field_definitions ) )
+			{
+				field_definition = &( fields_definition->field_definitions[ string_index ] );
+			}
+		}
+		if( field_definition != NULL )
+		{
+			if( output_writer_write_json_string(
+			     export_handle->output_writer,
+			     (const uint8_t *) field_definition->name,
+			     narrow_string_length(
+			      field_definition->name ),
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		else
+		{
+			if( output_writer_write_json_string(
+			     export_handle->output_writer,
+			     export_handle->json_value_string,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     ",\"Value\":",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( utf8_string_sizes[ string_index ] == 0 )
+		{
+			if( output_writer_write_ascii_string(
+			     export_handle->output_writer,
+			     "\"\"}",
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			continue;
+		}
+		if( field_definition != NULL )
+		{
+			if( export_handle_write_json_field_value(
+			     export_handle,
+			     field_definition->type,
+			     &( utf8_strings[ utf8_string_offsets[ string_index ] ] ),
+			     utf8_string_sizes[ string_index ],
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		else
+		{
+			if( output_writer_write_json_string(
+			     export_handle->output_writer,
+			     &( utf8_strings[ utf8_string_offsets[ string_index ] ] ),
+			     utf8_string_sizes[ string_index ],
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     "}",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "]",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write event data.",
+	 function );
+
+	return( -1 );
+}
+
+/* Exports the record in the JSON or NDJSON format
+ * The record is written directly from the record values, without rendering the event XML.
+ * A record that cannot be exported is discarded from the output writer, so that
+ * the output remains valid JSON
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_json(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t written_time_string[ FILETIME_FORMATTER_STRING_SIZE ];
+
+	static char *function     = "export_handle_export_record_json";
+	size_t buffer_offset      = 0;
+	uint64_t value_64bit      = 0;
+	uint32_t event_identifier = 0;
+	uint8_t event_level       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_offset = export_handle->output_writer->buffer_offset;
+
+	if( export_handle->export_format == EXPORT_FORMAT_JSON )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     ( export_handle->number_of_json_records == 0 ) ? "\n" : ",\n",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "{\"EventRecordID\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_get_record_written_time_string(
+	     export_handle,
+	     record,
+	     written_time_string,
+	     FILETIME_FORMATTER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time string.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",\"TimeCreated\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_json_string(
+	     export_handle->output_writer,
+	     written_time_string,
+	     48,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",\"EventID\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libevtx_record_get_event_level(
+	     record,
+	     &event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",\"Level\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_level,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "ProviderName",
+	     libevtx_record_get_utf8_source_name_size,
+	     libevtx_record_get_utf8_source_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "ProviderGuid",
+	     libevtx_record_get_utf8_provider_identifier_size,
+	     libevtx_record_get_utf8_provider_identifier,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "Computer",
+	     libevtx_record_get_utf8_computer_name_size,
+	     libevtx_record_get_utf8_computer_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "UserID",
+	     libevtx_record_get_utf8_user_security_identifier_size,
+	     libevtx_record_get_utf8_user_security_identifier,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_json_record_event_data(
+	     export_handle,
+	     record,
+	     ",\"EventData\":",
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write event data.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ( export_handle->export_format == EXPORT_FORMAT_NDJSON ) ? "}\n" : "}",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	export_handle->number_of_json_records += 1;
+
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	export_handle->output_writer->buffer_offset = buffer_offset;
+
+	return( -1 );
+}
+
+/* Writes the strings of the record as the members of the ECS winlog.event_data object
+ * A string without a name is named after its provider field definition or its position
+ * The values are written as strings so that the mapping of a member does not depend on the event
+ * Returns 1 if successful, 0 if the record has no strings or -1 on error
+ */
+int export_handle_write_es_bulk_record_event_data(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	char parameter_name[ 16 ];
+
+	const provider_field_definition_t *field_definition   = NULL;
+	const provider_fields_definition_t *fields_definition = NULL;
+	const size_t *utf8_string_offsets                     = NULL;
+	const size_t *utf8_string_sizes                       = NULL;
+	const uint8_t *utf8_strings                           = NULL;
+	static char *function                                 = "export_handle_write_es_bulk_record_event_data";
+	size_t value_string_size                              = 0;
+	int fields_definition_result                          = -1;
+	int number_of_strings                                 = 0;
+	int string_index                                      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_utf8_strings(
+	     record,
+	     &utf8_strings,
+	     &number_of_strings,
+	     &utf8_string_offsets,
+	     &utf8_string_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings in record.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == 0 )
+	{
+		return( 0 );
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",\"event_data\":{",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( string_index > 0 )
+		{
+			if( output_writer_write_data(
+			     export_handle->output_writer,
+			     (uint8_t *) ",",
+			     1,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( libevtx_record_get_utf8_string_name_size(
+		     record,
+		     string_index,
+		     &value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d name size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( export_handle_get_json_value_string(
+		     export_handle,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve JSON value string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_record_get_utf8_string_name(
+		     record,
+		     string_index,
+		     export_handle->json_value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d name.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		field_definition = NULL;
+
+		if( ( value_string_size <= 1 )
+		 || ( ( value_string_size == 5 )
+		  && ( memory_compare(
+		        export_handle->json_value_string,
+		        "Data",
+		        5 ) == 0 ) ) )
+		{
+			if( fields_definition_result == -1 )
+			{
+				fields_definition_result = export_handle_get_provider_fields_definition(
+				                            export_handle,
+				                            record,
+				                            &fields_definition,
+				                            error );
+
+				if( fields_definition_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve provider fields definition.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( ( fields_definition_result == 1 )
+			 && ( string_index < fields_definition->number_of_field_definitions ) )
+			{
+				field_definition = &( fields_definition->field_definitions[ string_index ] );
+			}
+			if( field_definition != NULL )
+			{
+				if( output_writer_write_json_member_name(
+				     export_handle->output_writer,
+				     field_definition->name,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+			else
+			{
+				/* Unnamed strings are named after their position, as param1, param2, etc.
+				 */
+				if( narrow_string_snprintf(
+				     parameter_name,
+				     16,
+				     "param%d",
+				     string_index + 1 ) < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to format parameter name.",
+					 function );
+
+					return( -1 );
+				}
+				if( output_writer_write_json_member_name(
+				     export_handle->output_writer,
+				     parameter_name,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+		}
+		else
+		{
+			if( output_writer_write_json_string(
+			     export_handle->output_writer,
+			     export_handle->json_value_string,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_data(
+			     export_handle->output_writer,
+			     (uint8_t *) ":",
+			     1,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( output_writer_write_json_string(
+		     export_handle->output_writer,
+		     &( utf8_strings[ utf8_string_offsets[ string_index ] ] ),
+		     utf8_string_sizes[ string_index ],
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( output_writer_write_data(
+	     export_handle->output_writer,
+	     (uint8_t *) "}",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write event data.",
+	 function );
+
+	return( -1 );
+}
+
+/* Exports the record in the Elasticsearch bulk format
+ * Every record is written as an index action line followed by a document line
+ * with the Elastic Common Schema (ECS) fields of the record. The index is not part
+ * of the action so that it is determined by the bulk endpoint, such as /evtx/_bulk
+ * A record that cannot be exported is discarded from the output writer, so that
+ * the output remains a valid bulk request
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_es_bulk(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t written_time_string[ FILETIME_FORMATTER_STRING_SIZE ];
+
+	const char *event_level_name = NULL;
+	static char *function        = "export_handle_export_record_es_bulk";
+	size_t buffer_offset         = 0;
+	size_t value_string_size     = 0;
+	uint64_t value_64bit         = 0;
+	uint32_t event_identifier    = 0;
+	uint8_t event_level          = 0;
+	int result                   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_offset = export_handle->output_writer->buffer_offset;
+
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_event_level(
+	     record,
+	     &event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_get_record_written_time_string(
+	     export_handle,
+	     record,
+	     written_time_string,
+	     FILETIME_FORMATTER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time string.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "{\"index\":{}}\n{\"@timestamp\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_json_string(
+	     export_handle->output_writer,
+	     written_time_string,
+	     FILETIME_FORMATTER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	/* The ECS event.code is a keyword
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",\"event\":{\"code\":\"",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "\",\"kind\":\"event\"",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "provider",
+	     libevtx_record_get_utf8_source_name_size,
+	     libevtx_record_get_utf8_source_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "},\"log\":{\"level\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	event_level_name = export_handle_get_event_level(
+	                    event_level );
+
+	if( output_writer_write_json_string(
+	     export_handle->output_writer,
+	     (uint8_t *) event_level_name,
+	     narrow_string_length(
+	      event_level_name ),
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "},\"host\":{\"os\":{\"family\":\"windows\"}",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "name",
+	     libevtx_record_get_utf8_computer_name_size,
+	     libevtx_record_get_utf8_computer_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "},\"winlog\":{\"record_id\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",\"event_id\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "provider_name",
+	     libevtx_record_get_utf8_source_name_size,
+	     libevtx_record_get_utf8_source_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "provider_guid",
+	     libevtx_record_get_utf8_provider_identifier_size,
+	     libevtx_record_get_utf8_provider_identifier,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "channel",
+	     libevtx_record_get_utf8_channel_name_size,
+	     libevtx_record_get_utf8_channel_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_json_record_value(
+	     export_handle,
+	     record,
+	     "computer_name",
+	     libevtx_record_get_utf8_computer_name_size,
+	     libevtx_record_get_utf8_computer_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	result = libevtx_record_get_utf8_user_security_identifier_size(
+	          record,
+	          &value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve user security identifier size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( value_string_size > 0 ) )
+	{
+		if( export_handle_get_json_value_string(
+		     export_handle,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve JSON value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_record_get_utf8_user_security_identifier(
+		     record,
+		     export_handle->json_value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve user security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     ",\"user\":{\"identifier\":",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_write_json_string(
+		     export_handle->output_writer,
+		     export_handle->json_value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_write_data(
+		     export_handle->output_writer,
+		     (uint8_t *) "}",
+		     1,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( export_handle_write_es_bulk_record_event_data(
+	     export_handle,
+	     record,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write event data.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "}}\n",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	export_handle->number_of_json_records += 1;
+
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	export_handle->output_writer->buffer_offset = buffer_offset;
+
+	return( -1 );
+}
+
+/* Writes a string value of the record as a Protocol Buffers string field
+ * The value is retrieved directly into the buffer of the output writer
+ * Returns 1 if successful, 0 if the value is not available or -1 on error
+ */
+int export_handle_write_protobuf_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     uint32_t field_number,
+     const char *name,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     libcerror_error_t **error )
+{
+	output_writer_t *output_writer = NULL;
+	static char *function          = "export_handle_write_protobuf_record_value";
+	size_t value_string_size       = 0;
+	int result                     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( get_value_size == NULL )
+	 || ( get_value == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get value function.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer = export_handle->output_writer;
+
+	result = get_value_size(
+	          record,
+	          &value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve %s size.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( value_string_size <= 1 ) )
+	{
+		return( 0 );
+	}
+	/* The string is written without the end of string character
+	 */
+	if( output_writer_write_protobuf_key(
+	     output_writer,
+	     field_number,
+	     OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_LENGTH_DELIMITED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_protobuf_varint(
+	     output_writer,
+	     (uint64_t) ( value_string_size - 1 ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_resize_buffer(
+	     output_writer,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( get_value(
+	     record,
+	     &( output_writer->buffer[ output_writer->buffer_offset ] ),
+	     value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve %s.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset += value_string_size - 1;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write %s.",
+	 function,
+	 name );
+
+	return( -1 );
+}
+
+/* Writes an optional integer value of the record as a Protocol Buffers varint field
+ * Returns 1 if successful, 0 if the value is not available or -1 on error
+ */
+int export_handle_write_protobuf_optional_value(
+     export_handle_t *export_handle,
+     uint32_t field_number,
+     int result,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_protobuf_optional_value";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( output_writer_write_protobuf_key(
+	     export_handle->output_writer,
+	     field_number,
+	     OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_VARINT,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_writer_write_protobuf_varint(
+	     export_handle->output_writer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write field: %" PRIu32 ".",
+	 function,
+	 field_number );
+
+	return( -1 );
+}
+
+/* Writes the strings of the record as the event_data fields of the Protocol Buffers record
+ * A string without a name is named after its provider field definition if available
+ * Returns 1 if successful, 0 if the record has no strings or -1 on error
+ */
+int export_handle_write_protobuf_record_event_data(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	const provider_fields_definition_t *fields_definition = NULL;
+	const size_t *utf8_string_offsets                     = NULL;
+	const size_t *utf8_string_sizes                       = NULL;
+	const uint8_t *utf8_strings                           = NULL;
+	const uint8_t *name_string                            = NULL;
+	output_writer_t *output_writer                        = NULL;
+	static char *function                                 = "export_handle_write_protobuf_record_event_data";
+	size_t message_offset                                 = 0;
+	size_t name_offset                                    = 0;
+	size_t name_string_size                               = 0;
+	size_t value_string_size                              = 0;
+	int fields_definition_result                          = -1;
+	int number_of_strings                                 = 0;
+	int string_index                                      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer = export_handle->output_writer;
+
+	if( libevtx_record_get_utf8_strings(
+	     record,
+	     &utf8_strings,
+	     &number_of_strings,
+	     &utf8_string_offsets,
+	     &utf8_string_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings in record.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( output_writer_write_protobuf_key(
+		     output_writer,
+		     17,
+		     OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_LENGTH_DELIMITED,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		message_offset = output_writer->buffer_offset;
+
+		if( libevtx_record_get_utf8_string_name_size(
+		     record,
+		     string_index,
+		     &name_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d name size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( name_string_size > 1 )
+		{
+			/* The name is retrieved directly into the buffer of the output writer
+			 * and discarded again when it is the generic Data element name
+			 */
+			if( output_writer_write_protobuf_key(
+			     output_writer,
+			     1,
+			     OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_LENGTH_DELIMITED,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_write_protobuf_varint(
+			     output_writer,
+			     (uint64_t) ( name_string_size - 1 ),
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			if( output_writer_resize_buffer(
+			     output_writer,
+			     name_string_size,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			name_offset = output_writer->buffer_offset;
+
+			if( libevtx_record_get_utf8_string_name(
+			     record,
+			     string_index,
+			     &( output_writer->buffer[ name_offset ] ),
+			     name_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d name.",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+			if( ( name_string_size == 5 )
+			 && ( memory_compare(
+			       &( output_writer->buffer[ name_offset ] ),
+			       "Data",
+			       5 ) == 0 ) )
+			{
+				output_writer->buffer_offset = message_offset;
+			}
+			else
+			{
+				output_writer->buffer_offset += name_string_size - 1;
+			}
+		}
+		if( output_writer->buffer_offset == message_offset )
+		{
+			if( fields_definition_result == -1 )
+			{
+				fields_definition_result = export_handle_get_provider_fields_definition(
+				                            export_handle,
+				                            record,
+				                            &fields_definition,
+				                            error );
+
+				if( fields_definition_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve provider fields definition.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( ( fields_definition_result == 1 )
+			 && ( string_index < fields_definition->number_of_field_definitions ) )
+			{
+				name_string = (const uint8_t *) fields_definition->field_definitions[ string_index ].name;
+
+				if( output_writer_write_protobuf_bytes(
+				     output_writer,
+				     1,
+				     name_string,
+				     narrow_string_length(
+				      (const char *) name_string ),
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+		}
+		value_string_size = utf8_string_sizes[ string_index ];
+
+		if( ( value_string_size > 0 )
+		 && ( utf8_strings[ utf8_string_offsets[ string_index ] + value_string_size - 1 ] == 0 ) )
+		{
+			value_string_size -= 1;
+		}
+		if( value_string_size > 0 )
+		{
+			if( output_writer_write_protobuf_bytes(
+			     output_writer,
+			     2,
+			     &( utf8_strings[ utf8_string_offsets[ string_index ] ] ),
+			     value_string_size,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+		if( output_writer_delimit_protobuf_message(
+		     output_writer,
+		     message_offset,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write event data.",
+	 function );
+
+	return( -1 );
+}
+
+/* Exports the record as a length delimited Protocol Buffers message
+ * The schema of the message is documented in documentation/evtx_record.proto
+ * A record that cannot be exported is discarded from the output writer, so that
+ * the output remains a valid stream of messages
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_protobuf(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ 16 ];
+
+	const uint8_t *raw_data   = NULL;
+	static char *function     = "export_handle_export_record_protobuf";
+	size_t buffer_offset      = 0;
+	size_t raw_data_size      = 0;
+	uint64_t value_64bit      = 0;
+	uint32_t value_32bit      = 0;
+	uint16_t value_16bit      = 0;
+	uint8_t value_8bit        = 0;
+	int result                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_offset = export_handle->output_writer->buffer_offset;
+
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     1,
+	     1,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libevtx_record_get_written_time(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_protobuf_fixed64(
+	     export_handle->output_writer,
+	     2,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     3,
+	     1,
+	     (uint64_t) value_32bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_event_identifier_qualifiers(
+	          record,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     4,
+	     result,
+	     (uint64_t) value_32bit,
+	     error ) == -1 )
+	{
+		goto on_write_error;
+	}
+	if( libevtx_record_get_event_level(
+	     record,
+	     &value_8bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     5,
+	     1,
+	     (uint64_t) value_8bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_task(
+	          record,
+	          &value_16bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve task.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     6,
+	     result,
+	     (uint64_t) value_16bit,
+	     error ) == -1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_opcode(
+	          record,
+	          &value_8bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve opcode.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     7,
+	     result,
+	     (uint64_t) value_8bit,
+	     error ) == -1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_keywords(
+	          record,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve keywords.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     8,
+	     result,
+	     value_64bit,
+	     error ) == -1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_event_version(
+	          record,
+	          &value_8bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event version.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     9,
+	     result,
+	     (uint64_t) value_8bit,
+	     error ) == -1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_provider_identifier(
+	          record,
+	          provider_identifier,
+	          16,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( output_writer_write_protobuf_bytes(
+		     export_handle->output_writer,
+		     10,
+		     provider_identifier,
+		     16,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( export_handle_write_protobuf_record_value(
+	     export_handle,
+	     record,
+	     11,
+	     "source name",
+	     libevtx_record_get_utf8_source_name_size,
+	     libevtx_record_get_utf8_source_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_record_value(
+	     export_handle,
+	     record,
+	     12,
+	     "channel name",
+	     libevtx_record_get_utf8_channel_name_size,
+	     libevtx_record_get_utf8_channel_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_record_value(
+	     export_handle,
+	     record,
+	     13,
+	     "computer name",
+	     libevtx_record_get_utf8_computer_name_size,
+	     libevtx_record_get_utf8_computer_name,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_record_value(
+	     export_handle,
+	     record,
+	     14,
+	     "user security identifier",
+	     libevtx_record_get_utf8_user_security_identifier_size,
+	     libevtx_record_get_utf8_user_security_identifier,
+	     error ) == -1 )
+	{
+		goto on_error;
+	}
+	result = libevtx_record_get_process_identifier(
+	          record,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve process identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     15,
+	     result,
+	     (uint64_t) value_32bit,
+	     error ) == -1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_thread_identifier(
+	          record,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thread identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_protobuf_optional_value(
+	     export_handle,
+	     16,
+	     result,
+	     (uint64_t) value_32bit,
+	     error ) == -1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_protobuf_record_event_data(
+	     export_handle,
+	     record,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write event data.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->protobuf_raw_data != 0 )
+	{
+		if( libevtx_record_get_raw_data(
+		     record,
+		     &raw_data,
+		     &raw_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve raw data.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_writer_write_protobuf_bytes(
+		     export_handle->output_writer,
+		     18,
+		     raw_data,
+		     raw_data_size,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( output_writer_delimit_protobuf_message(
+	     export_handle->output_writer,
+	     buffer_offset,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	export_handle->output_writer->buffer_offset = buffer_offset;
+
+	return( -1 );
+}
+
+/* Writes a string value of the record as a CSV value preceded by the value separator
+ * An empty value is written if the value is not available
+ * Returns 1 if successful, 0 if the value is not available or -1 on error
+ */
+int export_handle_write_csv_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function    = "export_handle_write_csv_record_value";
+	size_t value_offset      = 0;
+	size_t value_string_size = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( get_value_size == NULL )
+	 || ( get_value == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get value function.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_data(
+	     export_handle->output_writer,
+	     (uint8_t *) ",",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	result = get_value_size(
+	          record,
+	          &value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( value_string_size <= 1 ) )
+	{
+		return( 0 );
+	}
+	if( export_handle_get_json_value_string(
+	     export_handle,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve JSON value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_value(
+	     record,
+	     export_handle->json_value_string,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	value_offset = export_handle->output_writer->buffer_offset;
+
+	/* The value string size includes the end of string character
+	 */
+	if( output_writer_write_data(
+	     export_handle->output_writer,
+	     export_handle->json_value_string,
+	     value_string_size - 1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_quote_csv_value(
+	     export_handle->output_writer,
+	     value_offset,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Exports the record in the CSV format
+ * Every record is written as a row with the System values in fixed columns
+ * and the EventData name and value pairs as a JSON array in the last column
+ * A record that cannot be exported is discarded from the output writer
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_csv(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t written_time_string[ FILETIME_FORMATTER_STRING_SIZE ];
+
+	static char *function                = "export_handle_export_record_csv";
+	size_t buffer_offset                 = 0;
+	size_t value_offset                  = 0;
+	uint64_t value_64bit                 = 0;
+	uint32_t event_identifier            = 0;
+	uint32_t event_identifier_qualifiers = 0;
+	uint8_t event_level                  = 0;
+	int result                           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_offset = export_handle->output_writer->buffer_offset;
+
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_get_record_written_time_string(
+	     export_handle,
+	     record,
+	     written_time_string,
+	     FILETIME_FORMATTER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time string.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     (char *) written_time_string,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	result = libevtx_record_get_event_identifier_qualifiers(
+	          record,
+	          &event_identifier_qualifiers,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( result != 0 )
+	{
+		if( output_writer_write_unsigned_integer(
+		     export_handle->output_writer,
+		     (uint64_t) event_identifier_qualifiers,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( libevtx_record_get_event_level(
+	     record,
+	     &event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_level,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_csv_record_value(
+	     export_handle,
+	     record,
+	     libevtx_record_get_utf8_provider_identifier_size,
+	     libevtx_record_get_utf8_provider_identifier,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_csv_record_value(
+	     export_handle,
+	     record,
+	     libevtx_record_get_utf8_source_name_size,
+	     libevtx_record_get_utf8_source_name,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write source name.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_csv_record_value(
+	     export_handle,
+	     record,
+	     libevtx_record_get_utf8_computer_name_size,
+	     libevtx_record_get_utf8_computer_name,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write computer name.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_csv_record_value(
+	     export_handle,
+	     record,
+	     libevtx_record_get_utf8_user_security_identifier_size,
+	     libevtx_record_get_utf8_user_security_identifier,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write user security identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	value_offset = export_handle->output_writer->buffer_offset;
+
+	result = export_handle_write_json_record_event_data(
+	          export_handle,
+	          record,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write event data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( output_writer_quote_csv_value(
+		     export_handle->output_writer,
+		     value_offset,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "\n",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	export_handle->number_of_json_records += 1;
+
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	export_handle->output_writer->buffer_offset = buffer_offset;
+
+	return( -1 );
+}
+
+/* Writes a string value of the record as a value of a timeline format
+ * The separator and control characters of the value are replaced by spaces
+ * Returns 1 if successful, 0 if the value is not available or -1 on error
+ */
+int export_handle_write_timeline_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     uint8_t separator,
+     libcerror_error_t **error )
+{
+	static char *function    = "export_handle_write_timeline_record_value";
+	size_t value_offset      = 0;
+	size_t value_string_size = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( get_value_size == NULL )
+	 || ( get_value == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get value function.",
+		 function );
+
+		return( -1 );
+	}
+	result = get_value_size(
+	          record,
+	          &value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( value_string_size <= 1 ) )
+	{
+		return( 0 );
+	}
+	if( export_handle_get_json_value_string(
+	     export_handle,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve JSON value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_value(
+	     record,
+	     export_handle->json_value_string,
+	     value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	value_offset = export_handle->output_writer->buffer_offset;
+
+	/* The value string size includes the end of string character
+	 */
+	if( output_writer_write_data(
+	     export_handle->output_writer,
+	     export_handle->json_value_string,
+	     value_string_size - 1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_replace_separators(
+	     export_handle->output_writer,
+	     value_offset,
+	     separator,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the event message of the record as a value of a timeline format
+ * The message is resolved by the event message cache, if no message is available
+ * the strings of the record are written separated by spaces instead
+ * The separator and control characters of the message are replaced by spaces
+ * Returns 1 if successful, 0 if the record has no message or strings or -1 on error
+ */
+int export_handle_write_timeline_message(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     uint32_t event_identifier,
+     uint8_t separator,
+     libcerror_error_t **error )
+{
+	event_message_cache_entry_t *cache_entry = NULL;
+	system_character_t *provider_identifier  = NULL;
+	system_character_t *source_name          = NULL;
+	const size_t *utf8_string_offsets        = NULL;
+	const size_t *utf8_string_sizes          = NULL;
+	const uint8_t *utf8_strings              = NULL;
+	static char *function                    = "export_handle_write_timeline_message";
+	size_t provider_identifier_size          = 0;
+	size_t source_name_size                  = 0;
+	size_t value_offset                      = 0;
+	uint32_t event_identifier_qualifiers     = 0;
+	int number_of_strings                    = 0;
+	int value_string_index                   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_record_event_source(
+	     export_handle,
+	     record,
+	     &provider_identifier,
+	     &provider_identifier_size,
+	     &source_name,
+	     &source_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_event_identifier_qualifiers(
+	     record,
+	     &event_identifier_qualifiers,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sizes include the end of string character
+	 */
+	if( export_handle_get_event_message_cache_entry(
+	     export_handle,
+	     record,
+	     provider_identifier,
+	     ( provider_identifier_size > 0 ) ? provider_identifier_size - 1 : 0,
+	     source_name,
+	     ( source_name_size > 0 ) ? source_name_size - 1 : 0,
+	     event_identifier,
+	     event_identifier_qualifiers,
+	     &cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event message.",
+		 function );
+
+		return( -1 );
+	}
+	value_offset = export_handle->output_writer->buffer_offset;
+
+	if( cache_entry->message_string != NULL )
+	{
+		if( message_string_write(
+		     cache_entry->message_string,
+		     record,
+		     export_handle->output_writer,
+		     &( export_handle->scratch_strings[ EXPORT_SCRATCH_STRING_VALUE ] ),
+		     &( export_handle->scratch_string_sizes[ EXPORT_SCRATCH_STRING_VALUE ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write message string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libevtx_record_get_utf8_strings(
+		     record,
+		     &utf8_strings,
+		     &number_of_strings,
+		     &utf8_string_offsets,
+		     &utf8_string_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve strings in record.",
+			 function );
+
+			return( -1 );
+		}
+		for( value_string_index = 0;
+		     value_string_index < number_of_strings;
+		     value_string_index++ )
+		{
+			/* The string size includes the end of string character
+			 */
+			if( utf8_string_sizes[ value_string_index ] <= 1 )
+			{
+				continue;
+			}
+			if( export_handle->output_writer->buffer_offset > value_offset )
+			{
+				if( output_writer_write_data(
+				     export_handle->output_writer,
+				     (uint8_t *) " ",
+				     1,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+			}
+			if( output_writer_write_data(
+			     export_handle->output_writer,
+			     &( utf8_strings[ utf8_string_offsets[ value_string_index ] ] ),
+			     utf8_string_sizes[ value_string_index ] - 1,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+		}
+	}
+	if( export_handle->output_writer->buffer_offset == value_offset )
+	{
+		return( 0 );
+	}
+	if( output_writer_replace_separators(
+	     export_handle->output_writer,
+	     value_offset,
+	     separator,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write message.",
+	 function );
+
+	return( -1 );
+}
+
+/* Exports the record in the bodyfile format
+ * Every record is written as a line of the (The Sleuth Kit) bodyfile format
+ * with the written time as the modification time and the record identifier as the inode
+ * A record that cannot be exported is discarded from the output writer
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_bodyfile(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	static char *function      = "export_handle_export_record_bodyfile";
+	size_t buffer_offset       = 0;
+	uint64_t posix_time        = 0;
+	uint64_t record_identifier = 0;
+	uint64_t written_time      = 0;
+	uint32_t event_identifier  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_offset = export_handle->output_writer->buffer_offset;
+
+	if( libevtx_record_get_identifier(
+	     record,
+	     &record_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_written_time(
+	     record,
+	     &written_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	/* The bodyfile times are in seconds since January 1, 1970 00:00:00 UTC
+	 */
+	if( written_time > EXPORT_HANDLE_FILETIME_POSIX_EPOCH )
+	{
+		posix_time = ( written_time - EXPORT_HANDLE_FILETIME_POSIX_EPOCH ) / 10000000;
+	}
+	/* The MD5 column is not applicable and is written as 0
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "0|",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	/* The name column contains the source name, the event identifier and the event message
+	 */
+	if( export_handle_write_timeline_record_value(
+	     export_handle,
+	     record,
+	     libevtx_record_get_utf8_source_name_size,
+	     libevtx_record_get_utf8_source_name,
+	     (uint8_t) '|',
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write source name.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ": ",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_timeline_message(
+	     export_handle,
+	     record,
+	     event_identifier,
+	     (uint8_t) '|',
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write event message.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "|",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     record_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	/* The mode, UID, GID, size and access time columns are not applicable
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "|0|0|0|0|0|",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     posix_time,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	/* The change and creation time columns are not applicable
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "|0|0\n",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	export_handle->number_of_json_records += 1;
+
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	export_handle->output_writer->buffer_offset = buffer_offset;
+
+	return( -1 );
+}
+
+/* Exports the record in the log2timeline (L2T) CSV format
+ * Every record is written as a row with the written time as the modification time
+ * and the event message as the description
+ * A record that cannot be exported is discarded from the output writer
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_l2t_csv(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t written_time_string[ FILETIME_FORMATTER_STRING_SIZE ];
+
+	static char *function      = "export_handle_export_record_l2t_csv";
+	size_t buffer_offset       = 0;
+	size_t value_offset        = 0;
+	uint64_t record_identifier = 0;
+	uint64_t written_time      = 0;
+	uint32_t event_identifier  = 0;
+	uint8_t event_level        = 0;
+	int result                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_offset = export_handle->output_writer->buffer_offset;
+
+	if( libevtx_record_get_identifier(
+	     record,
+	     &record_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_written_time(
+	     record,
+	     &written_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_event_level(
+	     record,
+	     &event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( filetime_formatter_copy_to_utf8_string(
+	     export_handle->filetime_formatter,
+	     written_time,
+	     FILETIME_FORMATTER_FORMAT_TYPE_L2T_CSV,
+	     written_time_string,
+	     FILETIME_FORMATTER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy filetime to string.",
+		 function );
+
+		goto on_error;
+	}
+	/* The date and time columns
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     (char *) written_time_string,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	/* The timezone, MACB, source, sourcetype and type columns
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",UTC,M...,EVT,WinEVTX,Written Time,",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	result = export_handle_write_timeline_record_value(
+	          export_handle,
+	          record,
+	          libevtx_record_get_utf8_user_security_identifier_size,
+	          libevtx_record_get_utf8_user_security_identifier,
+	          (uint8_t) ',',
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write user security identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ( result == 0 ) ? "-," : ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	result = export_handle_write_timeline_record_value(
+	          export_handle,
+	          record,
+	          libevtx_record_get_utf8_computer_name_size,
+	          libevtx_record_get_utf8_computer_name,
+	          (uint8_t) ',',
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write computer name.",
+		 function );
+
+		goto on_error;
+	}
+	/* The short column contains the event identifier and the source name
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ( result == 0 ) ? "-,[" : ",[",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "] ",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( export_handle_write_timeline_record_value(
+	     export_handle,
+	     record,
+	     libevtx_record_get_utf8_source_name_size,
+	     libevtx_record_get_utf8_source_name,
+	     (uint8_t) ',',
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write source name.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	result = export_handle_write_timeline_message(
+	          export_handle,
+	          record,
+	          event_identifier,
+	          (uint8_t) ',',
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write event message.",
+		 function );
+
+		goto on_error;
+	}
+	/* The desc, version and filename columns
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ( result == 0 ) ? "-,2," : ",2,",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	value_offset = export_handle->output_writer->buffer_offset;
+
+	if( export_handle->input_filename != NULL )
+	{
+		if( output_writer_write_system_string(
+		     export_handle->output_writer,
+		     export_handle->input_filename,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( output_writer_replace_separators(
+		     export_handle->output_writer,
+		     value_offset,
+		     (uint8_t) ',',
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( export_handle->output_writer->buffer_offset == value_offset )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     "-",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	/* The inode column contains the record identifier
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     record_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	/* The notes, format and extra columns
+	 */
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     ",-,evtxexport,event_identifier: ",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "; event_level: ",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_unsigned_integer(
+	     export_handle->output_writer,
+	     (uint64_t) event_level,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_ascii_string(
+	     export_handle->output_writer,
+	     "\n",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	export_handle->number_of_json_records += 1;
+
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	export_handle->output_writer->buffer_offset = buffer_offset;
+
+	return( -1 );
+}
+
+/* Opens the input file of a worker
+ * Every worker opens its own input file, with its own caches, to read the records concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_worker_input_file(
+     export_handle_t *export_handle,
+     libevtx_file_t *input_file,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_worker_input_file";
+	int access_flags      = LIBEVTX_OPEN_READ;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     input_file,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->lazy != 0 )
+	 && ( export_handle->export_mode == EXPORT_MODE_ITEMS )
+	 && ( export_handle->follow == 0 ) )
+	{
+		access_flags = LIBEVTX_OPEN_READ_LAZY;
+	}
+	if( ( export_handle->live != 0 )
+	 || ( export_handle->follow != 0 ) )
+	{
+		access_flags |= LIBEVTX_ACCESS_FLAG_LIVE;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     input_file,
+	     export_handle->input_filename,
+	     access_flags,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     input_file,
+	     export_handle->input_filename,
+	     access_flags,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the records of a record batch in the XML format
+ * The worker opens its own input file, with its own caches, on first use
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_worker_export_record_batch(
+     export_handle_worker_t *worker,
+     record_batch_t *record_batch )
+{
+	libevtx_record_t *record = NULL;
+	static char *function    = "export_handle_worker_export_record_batch";
+	size_t event_xml_size    = 0;
+	int record_index         = 0;
+	int result               = 0;
+	int slot_index           = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 &( worker->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->input_is_open == 0 )
+	{
+		if( export_handle_open_worker_input_file(
+		     worker->export_handle,
+		     worker->input_file,
+		     &( worker->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input file.",
+			 function );
+
+			goto on_error;
+		}
+		worker->input_is_open = 1;
+	}
+	for( slot_index = 0;
+	     slot_index < record_batch->number_of_records;
+	     slot_index++ )
+	{
+		if( worker->export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		record_index = record_batch->first_record_index + slot_index;
+
+		if( worker->export_handle->record_filter != NULL )
+		{
+			result = libevtx_file_match_record_by_index(
+			          worker->input_file,
+			          worker->export_handle->record_filter,
+			          record_index,
+			          &( worker->error ) );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					libcnotify_print_error_backtrace(
+					 worker->error );
+#endif
+					libcerror_error_free(
+					 &( worker->error ) );
+				}
+				/* Records that do not match the filter expression are skipped
+				 */
+				record_batch->export_results[ slot_index ] = result;
+
+				continue;
+			}
+		}
+		if( libevtx_file_get_record_by_index(
+		     worker->input_file,
+		     record_index,
+		     &record,
+		     &( worker->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		record_batch->export_results[ slot_index ] = export_handle_get_record_xml_string(
+		                                              record,
+		                                              worker->export_handle->compact_xml,
+		                                              &( record_batch->event_xml_strings[ slot_index ] ),
+		                                              &event_xml_size,
+		                                              &( worker->error ) );
+
+		if( record_batch->export_results[ slot_index ] != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( worker->error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 worker->error );
+			}
+#endif
+			libcerror_error_free(
+			 &( worker->error ) );
+		}
+		if( libevtx_record_free(
+		     &record,
+		     &( worker->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the record batches of the free queue of a worker in the XML format
+ * The worker takes batches from the free queue, renders them and passes them
+ * to the writer using the output queue, until it takes an end of work marker.
+ * A worker waits on the free queue when the writer is behind, which bounds
+ * the number of rendered records that are held in memory.
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_worker_export_records(
+     export_handle_worker_t *worker )
+{
+	record_batch_t *record_batch = NULL;
+	static char *function        = "export_handle_worker_export_records";
+	int result                   = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->result = -1;
+
+	/* The worker is bound before it opens its input file so that the file
+	 * and its chunk buffers are allocated from the memory of the node
+	 */
+	if( worker->numa_topology != NULL )
+	{
+		if( numa_topology_bind_thread_to_node(
+		     worker->numa_topology,
+		     worker->numa_node_index,
+		     &( worker->error ) ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			libcnotify_print_error_backtrace(
+			 worker->error );
+#endif
+			/* The worker runs unbound if it cannot be bound
+			 */
+			libcerror_error_free(
+			 &( worker->error ) );
+		}
+	}
+	for( ;; )
+	{
+		result = record_batch_queue_try_pop(
+		          worker->free_queue,
+		          &record_batch,
+		          &( worker->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record batch from free queue.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( worker->export_handle->abort != 0 )
+			{
+				goto on_error;
+			}
+			record_batch_queue_yield();
+
+			continue;
+		}
+		/* A NULL record batch marks the end of the work
+		 */
+		if( record_batch == NULL )
+		{
+			break;
+		}
+		record_batch->result = export_handle_worker_export_record_batch(
+		                        worker,
+		                        record_batch );
+
+		/* The batch is passed to the writer even if rendering failed
+		 * so that the writer does not wait for it
+		 */
+		do
+		{
+			result = record_batch_queue_try_push(
+			          worker->output_queue,
+			          record_batch,
+			          NULL );
+
+			if( result == 0 )
+			{
+				record_batch_queue_yield();
+			}
+		}
+		while( result == 0 );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push record batch onto output queue.",
+			 function );
+
+			goto on_error;
+		}
+		if( record_batch->result != 1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record batch: %d.",
+			 function,
+			 record_batch->batch_index );
+
+			goto on_error;
+		}
+	}
+	worker->result = 1;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Writes the rendered records of a record batch in the original order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_record_batch(
+     export_handle_t *export_handle,
+     record_batch_t *record_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_record_batch";
+	int result            = 0;
+	int slot_index        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < record_batch->number_of_records;
+	     slot_index++ )
+	{
+		if( record_batch->export_results[ slot_index ] == 0 )
+		{
+			continue;
+		}
+		else if( record_batch->export_results[ slot_index ] != 1 )
+		{
+			output_writer_printf(
+			 export_handle->output_writer,
+			 "Unable to export record: %d.\n\n",
+			 record_batch->first_record_index + slot_index );
+
+			continue;
+		}
+		if( record_batch->event_xml_strings[ slot_index ] != NULL )
+		{
+			/* Note that the event XML ends with a new line
+			 */
+			result = output_writer_write_system_string(
+			          export_handle->output_writer,
+			          record_batch->event_xml_strings[ slot_index ],
+			          error );
+
+			memory_free(
+			 record_batch->event_xml_strings[ slot_index ] );
+
+			record_batch->event_xml_strings[ slot_index ] = NULL;
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write event XML of record: %d.",
+				 function,
+				 record_batch->first_record_index + slot_index );
+
+				return( -1 );
+			}
+		}
+		if( export_handle->compact_xml == 0 )
+		{
+			output_writer_printf(
+			 export_handle->output_writer,
+			 "\n" );
+		}
+		if( output_writer_flush_when_full(
+		     export_handle->output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output writer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports a contiguous range of records in the XML format using multiple threads
+ * The records are split into batches of consecutive records, which keeps the chunks
+ * a worker reads local to the worker. The workers render the batches and pass
+ * them to the calling thread, which writes them in the original order and returns
+ * the written batches to the workers for reuse. The batches are passed using
+ * bounded lock-free queues, the number of batches bounds the number of rendered
+ * records that are held in memory.
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_records_parallel(
+     export_handle_t *export_handle,
+     int first_record_index,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	export_handle_worker_t *workers         = NULL;
+	record_batch_t *record_batch            = NULL;
+	record_batch_t **record_batches         = NULL;
+	static char *function                   = "export_handle_export_records_parallel";
+	size_t array_size                       = 0;
+	int batch_index                         = 0;
+	int number_of_batches                   = 0;
+	int number_of_record_batches            = 0;
+	int number_of_workers                   = 0;
+	int result                              = 1;
+	int worker_index                        = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	numa_topology_t *numa_topology          = NULL;
+	record_batch_queue_t *free_queue        = NULL;
+	record_batch_queue_t *output_queue      = NULL;
+	record_batch_t **pending_record_batches = NULL;
+	int next_batch_index                    = 0;
+	int number_of_numa_nodes                = 0;
+	int number_of_started_workers           = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_threads < 1 )
+	 || ( export_handle->number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing input filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	number_of_batches = number_of_records / EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH;
+
+	if( ( number_of_records % EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH ) != 0 )
+	{
+		number_of_batches += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_workers = export_handle->number_of_threads;
+
+	if( number_of_workers > number_of_batches )
+	{
+		number_of_workers = number_of_batches;
+	}
+	number_of_record_batches = number_of_workers * EXPORT_HANDLE_NUMBER_OF_BATCHES_PER_THREAD;
+
+	if( number_of_record_batches > number_of_batches )
+	{
+		number_of_record_batches = number_of_batches;
+	}
+#else
+	/* Without multi-threading support the batches are rendered and written one after the other
+	 */
+	number_of_workers        = 1;
+	number_of_record_batches = 1;
+#endif
+	array_size = sizeof( export_handle_worker_t ) * number_of_workers;
+
+	workers = (export_handle_worker_t *) memory_allocate(
+	                                      array_size );
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		workers = NULL;
+
+		goto on_error;
+	}
+	array_size = sizeof( record_batch_t * ) * number_of_record_batches;
+
+	record_batches = (record_batch_t **) memory_allocate(
+	                                      array_size );
+
+	if( record_batches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record batches.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     record_batches,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record batches.",
+		 function );
+
+		memory_free(
+		 record_batches );
+
+		record_batches = NULL;
+
+		goto on_error;
+	}
+	for( batch_index = 0;
+	     batch_index < number_of_record_batches;
+	     batch_index++ )
+	{
+		if( record_batch_initialize(
+		     &( record_batches[ batch_index ] ),
+		     EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize record batch: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The rendered batches that arrive ahead of the next batch to write are kept
+	 * in a reorder window, the batches in flight are always within the number
+	 * of record batches from the next batch to write
+	 */
+	pending_record_batches = (record_batch_t **) memory_allocate(
+	                                              array_size );
+
+	if( pending_record_batches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pending record batches.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     pending_record_batches,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pending record batches.",
+		 function );
+
+		memory_free(
+		 pending_record_batches );
+
+		pending_record_batches = NULL;
+
+		goto on_error;
+	}
+	/* The free queue also holds an end of work marker for every worker
+	 */
+	if( record_batch_queue_initialize(
+	     &free_queue,
+	     number_of_record_batches + number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize free queue.",
+		 function );
+
+		goto on_error;
+	}
+	/* The output queue can hold all the batches, hence a worker never waits on it
+	 */
+	if( record_batch_queue_initialize(
+	     &output_queue,
+	     number_of_record_batches,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->numa_affinity != 0 )
+	{
+		if( numa_topology_initialize(
+		     &numa_topology,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize NUMA topology.",
+			 function );
+
+			goto on_error;
+		}
+		if( numa_topology_get_number_of_nodes(
+		     numa_topology,
+		     &number_of_numa_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of NUMA nodes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		workers[ worker_index ].export_handle = export_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* The workers are spread over the nodes in contiguous groups
+		 */
+		if( number_of_numa_nodes > 1 )
+		{
+			workers[ worker_index ].numa_topology   = numa_topology;
+			workers[ worker_index ].numa_node_index = ( worker_index * number_of_numa_nodes ) / number_of_workers;
+		}
+		workers[ worker_index ].free_queue   = free_queue;
+		workers[ worker_index ].output_queue = output_queue;
+#endif
+		if( libevtx_file_initialize(
+		     &( workers[ worker_index ].input_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize input file of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( batch_index = 0;
+	     batch_index < number_of_record_batches;
+	     batch_index++ )
+	{
+		record_batch = record_batches[ batch_index ];
+
+		record_batch->batch_index        = batch_index;
+		record_batch->first_record_index = first_record_index + ( batch_index * EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH );
+		record_batch->number_of_records  = number_of_records - ( batch_index * EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH );
+
+		if( record_batch->number_of_records > EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH )
+		{
+			record_batch->number_of_records = EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH;
+		}
+		if( record_batch_queue_try_push(
+		     free_queue,
+		     record_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push record batch: %d onto free queue.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+	}
+	/* The calling thread writes the rendered batches
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( workers[ worker_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &export_handle_worker_export_records,
+		     (void *) &( workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+
+			break;
+		}
+		number_of_started_workers++;
+	}
+	while( ( result == 1 )
+	    && ( next_batch_index < number_of_batches ) )
+	{
+		if( export_handle->abort != 0 )
+		{
+			result = -1;
+
+			break;
+		}
+		record_batch = pending_record_batches[ next_batch_index % number_of_record_batches ];
+
+		if( record_batch != NULL )
+		{
+			pending_record_batches[ next_batch_index % number_of_record_batches ] = NULL;
+
+			if( export_handle_write_record_batch(
+			     export_handle,
+			     record_batch,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write record batch: %d.",
+				 function,
+				 next_batch_index );
+
+				result = -1;
+
+				break;
+			}
+			next_batch_index++;
+
+			/* Reuse the batch for the batch a full lap ahead
+			 */
+			batch_index = record_batch->batch_index + number_of_record_batches;
+
+			if( batch_index >= number_of_batches )
+			{
+				continue;
+			}
+			if( record_batch_clear(
+			     record_batch,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear record batch.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			record_batch->batch_index        = batch_index;
+			record_batch->first_record_index = first_record_index + ( batch_index * EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH );
+			record_batch->number_of_records  = number_of_records - ( batch_index * EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH );
+
+			if( record_batch->number_of_records > EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH )
+			{
+				record_batch->number_of_records = EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH;
+			}
+			if( record_batch_queue_try_push(
+			     free_queue,
+			     record_batch,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push record batch: %d onto free queue.",
+				 function,
+				 batch_index );
+
+				result = -1;
+
+				break;
+			}
+			continue;
+		}
+		result = record_batch_queue_try_pop(
+		          output_queue,
+		          &record_batch,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record batch from output queue.",
+			 function );
+
+			break;
+		}
+		else if( result == 0 )
+		{
+			record_batch_queue_yield();
+
+			result = 1;
+
+			continue;
+		}
+		if( record_batch->result != 1 )
+		{
+			/* The error is retrieved from the worker after it has been joined
+			 */
+			result = -1;
+
+			break;
+		}
+		pending_record_batches[ record_batch->batch_index % number_of_record_batches ] = record_batch;
+	}
+	if( result != 1 )
+	{
+		/* Take the batches that have not been started from the workers
+		 */
+		while( record_batch_queue_try_pop(
+		        free_queue,
+		        &record_batch,
+		        NULL ) == 1 )
+		{
+			continue;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_started_workers;
+	     worker_index++ )
+	{
+		while( record_batch_queue_try_push(
+		        free_queue,
+		        NULL,
+		        NULL ) == 0 )
+		{
+			record_batch_queue_yield();
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_started_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_started_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].result != 1 )
+		{
+			/* Only the first error is passed to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = workers[ worker_index ].error;
+
+				workers[ worker_index ].error = NULL;
+			}
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+#else
+	record_batch = record_batches[ 0 ];
+
+	for( batch_index = 0;
+	     batch_index < number_of_batches;
+	     batch_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		if( record_batch_clear(
+		     record_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear record batch.",
+			 function );
+
+			goto on_error;
+		}
+		record_batch->batch_index        = batch_index;
+		record_batch->first_record_index = first_record_index + ( batch_index * EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH );
+		record_batch->number_of_records  = number_of_records - ( batch_index * EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH );
+
+		if( record_batch->number_of_records > EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH )
+		{
+			record_batch->number_of_records = EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH;
+		}
+		if( export_handle_worker_export_record_batch(
+		     &( workers[ 0 ] ),
+		     record_batch ) != 1 )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = workers[ 0 ].error;
+
+				workers[ 0 ].error = NULL;
+			}
+			goto on_error;
+		}
+		if( export_handle_write_record_batch(
+		     export_handle,
+		     record_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record batch: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].input_is_open != 0 )
+		{
+			if( libevtx_file_close(
+			     workers[ worker_index ].input_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input file of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+			workers[ worker_index ].input_is_open = 0;
+		}
+		if( libevtx_file_free(
+		     &( workers[ worker_index ].input_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( record_batch_queue_free(
+	     &output_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output queue.",
+		 function );
+
+		result = -1;
+	}
+	if( record_batch_queue_free(
+	     &free_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free free queue.",
+		 function );
+
+		result = -1;
+	}
+	if( numa_topology != NULL )
+	{
+		if( numa_topology_free(
+		     &numa_topology,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free NUMA topology.",
+			 function );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 pending_record_batches );
+#endif
+	for( batch_index = 0;
+	     batch_index < number_of_record_batches;
+	     batch_index++ )
+	{
+		if( record_batch_free(
+		     &( record_batches[ batch_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record batch: %d.",
+			 function,
+			 batch_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 record_batches );
+	memory_free(
+	 workers );
+
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( numa_topology != NULL )
+	{
+		numa_topology_free(
+		 &numa_topology,
+		 NULL );
+	}
+	if( output_queue != NULL )
+	{
+		record_batch_queue_free(
+		 &output_queue,
+		 NULL );
+	}
+	if( free_queue != NULL )
+	{
+		record_batch_queue_free(
+		 &free_queue,
+		 NULL );
+	}
+	if( pending_record_batches != NULL )
+	{
+		memory_free(
+		 pending_record_batches );
+	}
+#endif
+	if( record_batches != NULL )
+	{
+		for( batch_index = 0;
+		     batch_index < number_of_record_batches;
+		     batch_index++ )
+		{
+			if( record_batches[ batch_index ] != NULL )
+			{
+				record_batch_free(
+				 &( record_batches[ batch_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 record_batches );
+	}
+	if( workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( workers[ worker_index ].error ) );
+			}
+			if( workers[ worker_index ].input_file != NULL )
+			{
+				if( workers[ worker_index ].input_is_open != 0 )
+				{
+					libevtx_file_close(
+					 workers[ worker_index ].input_file,
+					 NULL );
+				}
+				libevtx_file_free(
+				 &( workers[ worker_index ].input_file ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 workers );
+	}
+	return( -1 );
+}
+
+/* Retrieves the output filename of a shard
+ * The output filename of a shard consists of the output filename followed by a dot and the shard index
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_shard_output_filename(
+     export_handle_t *export_handle,
+     const system_character_t *output_filename,
+     int shard_index,
+     system_character_t **shard_output_filename,
+     size_t *shard_output_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_get_shard_output_filename";
+	size_t filename_length = 0;
+	size_t filename_size   = 0;
+	int print_count        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard_output_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard output filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shard_output_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shard output filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard_output_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard output filename size.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   output_filename );
+
+	/* The shard index consists of at most 2 digits
+	 */
+	filename_size = filename_length + 4;
+
+	*shard_output_filename = system_string_allocate(
+	                          filename_size );
+
+	if( *shard_output_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shard output filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     *shard_output_filename,
+	     output_filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy output filename to shard output filename.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = system_string_sprintf(
+	               &( ( *shard_output_filename )[ filename_length ] ),
+	               filename_size - filename_length,
+	               _SYSTEM_STRING( ".%d" ),
+	               shard_index );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= ( filename_size - filename_length ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set shard index in shard output filename.",
+		 function );
+
+		goto on_error;
+	}
+	*shard_output_filename_size = filename_length + (size_t) print_count + 1;
+
+	return( 1 );
+
+on_error:
+	if( *shard_output_filename != NULL )
+	{
+		memory_free(
+		 *shard_output_filename );
+
+		*shard_output_filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Exports the records assigned to a shard in the XML format to the output file of the shard
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_shard_export_records(
+     export_handle_shard_t *shard )
+{
+	libevtx_record_t *record      = NULL;
+	system_character_t *event_xml = NULL;
+	static char *function         = "export_handle_shard_export_records";
+	size_t event_xml_size         = 0;
+	int export_index              = 0;
+	int record_index              = 0;
+	int result                    = 0;
+
+	if( shard == NULL )
+	{
+		return( -1 );
+	}
+	shard->result = -1;
+
+	if( shard->input_is_open == 0 )
+	{
+		if( export_handle_open_worker_input_file(
+		     shard->export_handle,
+		     shard->input_file,
+		     &( shard->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( shard->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input file.",
+			 function );
+
+			goto on_error;
+		}
+		shard->input_is_open = 1;
+	}
+	for( export_index = 0;
+	     export_index < shard->number_of_records;
+	     export_index++ )
+	{
+		if( shard->export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		/* The records of a shard can continue at the start of the records
+		 */
+		record_index = ( shard->first_record_index + export_index ) % shard->total_number_of_records;
+
+		if( shard->export_handle->record_filter != NULL )
+		{
+			result = libevtx_file_match_record_by_index(
+			          shard->input_file,
+			          shard->export_handle->record_filter,
+			          record_index,
+			          &( shard->error ) );
+
+			if( result == -1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				libcnotify_print_error_backtrace(
+				 shard->error );
+#endif
+				libcerror_error_free(
+				 &( shard->error ) );
+
+				output_writer_printf(
+				 shard->output_writer,
+				 "Unable to export record: %d.\n\n",
+				 record_index );
+			}
+			if( result != 1 )
+			{
+				continue;
+			}
+		}
+		if( libevtx_file_get_record_by_index(
+		     shard->input_file,
+		     record_index,
+		     &record,
+		     &( shard->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( shard->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( export_handle_get_record_xml_string(
+		     record,
+		     shard->export_handle->compact_xml,
+		     &event_xml,
+		     &event_xml_size,
+		     &( shard->error ) ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( shard->error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 shard->error );
+			}
+#endif
+			libcerror_error_free(
+			 &( shard->error ) );
+
+			output_writer_printf(
+			 shard->output_writer,
+			 "Unable to export record: %d.\n\n",
+			 record_index );
+		}
+		else
+		{
+			if( event_xml != NULL )
+			{
+				/* Note that the event XML ends with a new line
+				 */
+				result = output_writer_write_system_string(
+				          shard->output_writer,
+				          event_xml,
+				          &( shard->error ) );
+
+				memory_free(
+				 event_xml );
+
+				event_xml = NULL;
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 &( shard->error ),
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write event XML of record: %d.",
+					 function,
+					 record_index );
+
+					goto on_error;
+				}
+			}
+			if( shard->export_handle->compact_xml == 0 )
+			{
+				output_writer_printf(
+				 shard->output_writer,
+				 "\n" );
+			}
+		}
+		if( libevtx_record_free(
+		     &record,
+		     &( shard->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( shard->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( output_writer_flush_when_full(
+		     shard->output_writer,
+		     &( shard->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( shard->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output writer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_writer_flush(
+	     shard->output_writer,
+	     &( shard->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( shard->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output writer.",
+		 function );
+
+		goto on_error;
+	}
+	shard->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( event_xml != NULL )
+	{
+		memory_free(
+		 event_xml );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the records of the input file in the XML format split into shards
+ * Every shard is written to a separate output file and covers a disjoint contiguous
+ * range of records, which keeps the chunks a shard reads local to the shard.
+ * The shards are exported concurrently, every shard by its own worker, except
+ * for a compressed input file which cannot be reopened by the workers
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_shards(
+     export_handle_t *export_handle,
+     const system_character_t *output_filename,
+     libcerror_error_t **error )
+{
+	export_handle_shard_t *shards     = NULL;
+	static char *function             = "export_handle_export_shards";
+	size_t array_size                 = 0;
+	size_t location_offset            = 0;
+	size_t shard_output_filename_size = 0;
+	int first_record_index            = 0;
+	int number_of_records             = 0;
+	int number_of_records_per_shard   = 0;
+	int number_of_shards              = 0;
+	int protocol                      = 0;
+	int result                        = 0;
+	int shard_index                   = 0;
+	int total_number_of_records       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_shards < 1 )
+	 || ( export_handle->number_of_shards > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of shards value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_format != EXPORT_FORMAT_XML )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported export format, sharded output requires the XML format.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported export mode, sharded output requires the items export mode.",
+		 function );
+
+		return( -1 );
+	}
+	result = network_stream_get_protocol(
+	          output_filename,
+	          &protocol,
+	          &location_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine network protocol of output filename.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: sharded output is not supported with network output.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     export_handle->input_file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	total_number_of_records = number_of_records;
+
+	if( ( export_handle->since_record_identifier_is_set != 0 )
+	 || ( export_handle->since_written_time_is_set != 0 ) )
+	{
+		result = export_handle_get_first_record_index_since(
+		          export_handle,
+		          export_handle->input_file,
+		          &first_record_index,
+		          &number_of_records,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine first record to export.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	result = export_handle_limit_records(
+	          export_handle,
+	          total_number_of_records,
+	          &first_record_index,
+	          &number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to limit records to export.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* Every shard gets the same number of records except for the last
+	 * one or more shards, which can be empty if there are less records than shards
+	 */
+	number_of_records_per_shard = number_of_records / export_handle->number_of_shards;
+
+	if( ( number_of_records % export_handle->number_of_shards ) != 0 )
+	{
+		number_of_records_per_shard += 1;
+	}
+	array_size = sizeof( export_handle_shard_t ) * export_handle->number_of_shards;
+
+	shards = (export_handle_shard_t *) memory_allocate(
+	                                    array_size );
+
+	if( shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     shards,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		memory_free(
+		 shards );
+
+		shards = NULL;
+
+		goto on_error;
+	}
+	for( shard_index = 0;
+	     shard_index < export_handle->number_of_shards;
+	     shard_index++ )
+	{
+		shards[ shard_index ].export_handle           = export_handle;
+		shards[ shard_index ].first_record_index      = ( first_record_index + ( shard_index * number_of_records_per_shard ) ) % total_number_of_records;
+		shards[ shard_index ].number_of_records       = number_of_records - ( shard_index * number_of_records_per_shard );
+		shards[ shard_index ].total_number_of_records = total_number_of_records;
+
+		if( shards[ shard_index ].number_of_records < 0 )
+		{
+			shards[ shard_index ].number_of_records = 0;
+		}
+		else if( shards[ shard_index ].number_of_records > number_of_records_per_shard )
+		{
+			shards[ shard_index ].number_of_records = number_of_records_per_shard;
+		}
+		/* A compressed input file cannot be reopened and is shared by the shards
+		 */
+		if( export_handle->input_file_io_handle != NULL )
+		{
+			shards[ shard_index ].input_file      = export_handle->input_file;
+			shards[ shard_index ].input_is_open   = 1;
+			shards[ shard_index ].input_is_shared = 1;
+		}
+		else if( libevtx_file_initialize(
+		          &( shards[ shard_index ].input_file ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize input file of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( output_writer_initialize(
+		     &( shards[ shard_index ].output_writer ),
+		     EXPORT_HANDLE_NOTIFY_STREAM,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize output writer of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		/* The shards are already exported concurrently hence every shard
+		 * is compressed using a single thread
+		 */
+		if( output_writer_set_compression(
+		     shards[ shard_index ].output_writer,
+		     export_handle->output_compression_method,
+		     export_handle->output_compression_level,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set output compression of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( export_handle_get_shard_output_filename(
+		     export_handle,
+		     output_filename,
+		     shard_index,
+		     &( shards[ shard_index ].output_filename ),
+		     &shard_output_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve output filename of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( output_writer_open(
+		     shards[ shard_index ].output_writer,
+		     shards[ shard_index ].output_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open output file of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		number_of_shards++;
+	}
+	result = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->input_file_io_handle == NULL )
+	{
+		/* The first shard is exported in the calling thread
+		 */
+		for( shard_index = 1;
+		     shard_index < number_of_shards;
+		     shard_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( shards[ shard_index ].thread ),
+			     NULL,
+			     (int (*)(void *)) &export_handle_shard_export_records,
+			     (void *) &( shards[ shard_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of shard: %d.",
+				 function,
+				 shard_index );
+
+				/* Shards that were not started are not joined
+				 */
+				number_of_shards = shard_index;
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			export_handle_shard_export_records(
+			 &( shards[ 0 ] ) );
+		}
+		for( shard_index = 1;
+		     shard_index < number_of_shards;
+		     shard_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( shards[ shard_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( shard_index = 0;
+		     shard_index < number_of_shards;
+		     shard_index++ )
+		{
+			export_handle_shard_export_records(
+			 &( shards[ shard_index ] ) );
+		}
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( shard_index = 0;
+	     shard_index < number_of_shards;
+	     shard_index++ )
+	{
+		if( shards[ shard_index ].result != 1 )
+		{
+			/* Only the first error is passed to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = shards[ shard_index ].error;
+
+				shards[ shard_index ].error = NULL;
+			}
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( shard_index = 0;
+	     shard_index < export_handle->number_of_shards;
+	     shard_index++ )
+	{
+		if( output_writer_close(
+		     shards[ shard_index ].output_writer,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output file of shard: %d.",
+			 function,
+			 shard_index );
+
+			result = -1;
+		}
+		if( output_writer_free(
+		     &( shards[ shard_index ].output_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output writer of shard: %d.",
+			 function,
+			 shard_index );
+
+			result = -1;
+		}
+		memory_free(
+		 shards[ shard_index ].output_filename );
+
+		if( shards[ shard_index ].input_is_shared == 0 )
+		{
+			if( shards[ shard_index ].input_is_open != 0 )
+			{
+				if( libevtx_file_close(
+				     shards[ shard_index ].input_file,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close input file of shard: %d.",
+					 function,
+					 shard_index );
+
+					result = -1;
+				}
+			}
+			if( libevtx_file_free(
+			     &( shards[ shard_index ].input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+	}
+	memory_free(
+	 shards );
+
+	return( result );
+
+on_error:
+	if( shards != NULL )
+	{
+		for( shard_index = 0;
+		     shard_index < export_handle->number_of_shards;
+		     shard_index++ )
+		{
+			if( shards[ shard_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( shards[ shard_index ].error ) );
+			}
+			if( shards[ shard_index ].output_writer != NULL )
+			{
+				output_writer_close(
+				 shards[ shard_index ].output_writer,
+				 NULL );
+				output_writer_free(
+				 &( shards[ shard_index ].output_writer ),
+				 NULL );
+			}
+			if( shards[ shard_index ].output_filename != NULL )
+			{
+				memory_free(
+				 shards[ shard_index ].output_filename );
+			}
+			if( ( shards[ shard_index ].input_is_shared == 0 )
+			 && ( shards[ shard_index ].input_file != NULL ) )
+			{
+				if( shards[ shard_index ].input_is_open != 0 )
+				{
+					libevtx_file_close(
+					 shards[ shard_index ].input_file,
+					 NULL );
+				}
+				libevtx_file_free(
+				 &( shards[ shard_index ].input_file ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 shards );
+	}
+	return( -1 );
+}
+
+/* Exports a specific record
+ * Records that cannot be exported are reported in the output
+ * Records that do not match the filter expression are skipped
+ * Records with the same content as a previously exported record are skipped if deduplicating
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_record_by_index(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     int record_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function    = "export_handle_export_record_by_index";
+	uint64_t content_hash    = 0;
+	uint64_t start_time      = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->timings != NULL )
+	{
+		start_time = export_timings_get_time();
+	}
+	if( export_handle->record_filter != NULL )
+	{
+		result = libevtx_file_match_record_by_index(
+		          file,
+		          export_handle->record_filter,
+		          record_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( export_handle->record_hash_set != NULL )
+	{
+		if( libevtx_file_get_record_content_hash_by_index(
+		     file,
+		     record_index,
+		     &content_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve content hash of record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		result = export_handle_is_duplicate_record_content_hash(
+		          export_handle,
+		          content_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if record: %d is a duplicate.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libevtx_file_get_record_by_index(
+	     file,
+	     record_index,
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( export_handle->timings != NULL )
+	{
+		/* The read phase includes matching and hashing the record
+		 */
+		if( export_timings_add_phase_time(
+		     export_handle->timings,
+		     EXPORT_TIMINGS_PHASE_READ,
+		     start_time,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add read time.",
+			 function );
+
+			libevtx_record_free(
+			 &record,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( export_handle_export_record(
+	     export_handle,
+	     record,
+	     log_handle,
+	     error ) != 1 )
+	{
+		/* The CSV, JSON, Protocol Buffers and timeline formats are written as valid output only
+		 */
+		if( ( export_handle->export_format != EXPORT_FORMAT_BODYFILE )
+		 && ( export_handle->export_format != EXPORT_FORMAT_CSV )
+		 && ( export_handle->export_format != EXPORT_FORMAT_ES_BULK )
+		 && ( export_handle->export_format != EXPORT_FORMAT_JSON )
+		 && ( export_handle->export_format != EXPORT_FORMAT_L2T_CSV )
+		 && ( export_handle->export_format != EXPORT_FORMAT_NDJSON )
+		 && ( export_handle->export_format != EXPORT_FORMAT_PROTOBUF ) )
+		{
+			output_writer_printf(
+			 export_handle->output_writer,
+			 "Unable to export record: %d.\n\n",
+			 record_index );
+		}
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export record: %d.",
+		 function,
+		 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the records that are newer than the since record identifier and written time
+ * The records are considered in order of their identifier, which starts at the record with
+ * the smallest identifier and continues at the first record when the chunks have wrapped around
+ * Returns 1 if successful, 0 if there are no newer records or -1 on error
+ */
+int export_handle_get_first_record_index_since(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     int *record_index,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record    = NULL;
+	static char *function       = "export_handle_get_first_record_index_since";
+	uint64_t written_time       = 0;
+	int first_index             = 0;
+	int lower_index             = 0;
+	int middle_index            = 0;
+	int result                  = 0;
+	int start_record_index      = 0;
+	int total_number_of_records = 0;
+	int upper_index             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &total_number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	/* The record with the smallest identifier
+	 */
+	result = libevtx_file_seek_record_by_identifier(
+	          file,
+	          0,
+	          &start_record_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek first record.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( export_handle->since_record_identifier_is_set != 0 )
+	{
+		if( export_handle->since_record_identifier == (uint64_t) UINT64_MAX )
+		{
+			return( 0 );
+		}
+		result = libevtx_file_seek_record_by_identifier(
+		          file,
+		          export_handle->since_record_identifier + 1,
+		          &first_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek record with identifier: %" PRIu64 ".",
+			 function,
+			 export_handle->since_record_identifier + 1 );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		/* Index in order of the record identifier
+		 */
+		lower_index = ( first_index + total_number_of_records - start_record_index ) % total_number_of_records;
+	}
+	if( export_handle->since_written_time_is_set != 0 )
+	{
+		/* The written time is expected to increase with the record identifier
+		 */
+		upper_index = total_number_of_records;
+
+		while( lower_index < upper_index )
+		{
+			middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+			if( libevtx_file_get_record_by_index(
+			     file,
+			     ( start_record_index + middle_index ) % total_number_of_records,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 ( start_record_index + middle_index ) % total_number_of_records );
+
+				goto on_error;
+			}
+			if( libevtx_record_get_written_time(
+			     record,
+			     &written_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve written time.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevtx_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+			if( written_time <= export_handle->since_written_time )
+			{
+				lower_index = middle_index + 1;
+			}
+			else
+			{
+				upper_index = middle_index;
+			}
+		}
+	}
+	if( lower_index >= total_number_of_records )
+	{
+		return( 0 );
+	}
+	*record_index      = ( start_record_index + lower_index ) % total_number_of_records;
+	*number_of_records = total_number_of_records - lower_index;
+
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Limits the range of records to export to the record offset and the maximum number of records
+ * The range starts at the first record index and can continue at the start of the records.
+ * When exporting newest first the records are skipped and limited from the end of the range
+ * Returns 1 if successful, 0 if no records remain or -1 on error
+ */
+int export_handle_limit_records(
+     export_handle_t *export_handle,
+     int total_number_of_records,
+     int *first_record_index,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_limit_records";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( total_number_of_records <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid total number of records value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->record_offset >= *number_of_records )
+	{
+		return( 0 );
+	}
+	*number_of_records -= export_handle->record_offset;
+
+	if( export_handle->newest_first == 0 )
+	{
+		*first_record_index = ( *first_record_index + export_handle->record_offset ) % total_number_of_records;
+	}
+	if( ( export_handle->maximum_number_of_records > 0 )
+	 && ( *number_of_records > export_handle->maximum_number_of_records ) )
+	{
+		if( export_handle->newest_first != 0 )
+		{
+			*first_record_index = ( *first_record_index + *number_of_records - export_handle->maximum_number_of_records ) % total_number_of_records;
+		}
+		*number_of_records = export_handle->maximum_number_of_records;
+	}
+	return( 1 );
+}
+
+/* Exports the records of the sampled chunks
+ * The chunks are exported in ascending order, which is the order of the records
+ * unless the chunks have wrapped around
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_sampled_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_handle_export_sampled_records";
+	uint16_t chunk_index      = 0;
+	uint16_t number_of_chunks = 0;
+	int first_record_index    = 0;
+	int number_of_records     = 0;
+	int record_index          = 0;
+	int result                = 0;
+	int sample_index          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->chunk_sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing chunk sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_chunks(
+	     file,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_sampler_select_chunks(
+	     export_handle->chunk_sampler,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to select chunks.",
+		 function );
+
+		return( -1 );
+	}
+	for( sample_index = 0;
+	     sample_index < export_handle->chunk_sampler->number_of_sampled_chunks;
+	     sample_index++ )
+	{
+		chunk_index = export_handle->chunk_sampler->chunk_indexes[ sample_index ];
+
+		result = libevtx_file_get_chunk_records_range(
+		          file,
+		          chunk_index,
+		          &first_record_index,
+		          &number_of_records,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records range of chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		for( record_index = first_record_index;
+		     record_index < ( first_record_index + number_of_records );
+		     record_index++ )
+		{
+			if( export_handle->abort != 0 )
+			{
+				return( -1 );
+			}
+			if( export_handle_export_record_by_index(
+			     export_handle,
+			     file,
+			     record_index,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record: %d.",
+				 function,
+				 record_index );
+
+				return( -1 );
+			}
+		}
+		export_handle->chunk_sampler->number_of_sampled_records += (uint64_t) number_of_records;
+	}
+	return( 1 );
+}
+
+/* Exports the records
+ * If a since record identifier or written time is set only the newer records are exported
+ * The record offset and the maximum number of records limit the records that are exported,
+ * which stops reading the file early
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function           = "export_handle_export_records";
+	int export_index                = 0;
+	int first_record_index          = 0;
+	int number_of_records           = 0;
+	int number_of_records_to_export = 0;
+	int record_index                = 0;
+	int result                      = 0;
+	int total_number_of_records     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	if( export_handle->chunk_sampler != NULL )
+	{
+		return( export_handle_export_sampled_records(
+		         export_handle,
+		         file,
+		         log_handle,
+		         error ) );
+	}
+	total_number_of_records = number_of_records;
+
+	/* Reading ahead does not benefit reading the records backwards
+	 */
+	if( export_handle->newest_first == 0 )
+	{
+		if( libevtx_file_advise_sequential_access(
+		     file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to advise sequential access.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	if( ( export_handle->since_record_identifier_is_set != 0 )
+	 || ( export_handle->since_written_time_is_set != 0 ) )
+	{
+		result = export_handle_get_first_record_index_since(
+		          export_handle,
+		          file,
+		          &first_record_index,
+		          &number_of_records,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine first record to export.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	result = export_handle_limit_records(
+	          export_handle,
+	          total_number_of_records,
+	          &first_record_index,
+	          &number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to limit records to export.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The text format uses the message handle which cannot be shared
+	 * between threads and a compressed input file cannot be reopened
+	 * by the worker threads. The record hash set used to skip duplicate
+	 * records is not shared with the worker threads either. A checkpoint
+	 * and partitioned output require the records to be written in order
+	 */
+	if( ( export_handle->number_of_threads > 1 )
+	 && ( export_handle->newest_first == 0 )
+	 && ( export_handle->record_hash_set == NULL )
+	 && ( export_handle->checkpoint == NULL )
+	 && ( export_handle->partition_writer == NULL )
+	 && ( export_handle->export_format == EXPORT_FORMAT_XML )
+	 && ( export_handle->input_file_io_handle == NULL )
+	 && ( file == export_handle->input_file ) )
+	{
+		/* The records to export can continue at the start of the records
+		 */
+		number_of_records_to_export = number_of_records;
+
+		if( number_of_records_to_export > ( total_number_of_records - first_record_index ) )
+		{
+			number_of_records_to_export = total_number_of_records - first_record_index;
+		}
+		if( export_handle_export_records_parallel(
+		     export_handle,
+		     first_record_index,
+		     number_of_records_to_export,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records in parallel.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_records_to_export < number_of_records )
+		{
+			if( export_handle_export_records_parallel(
+			     export_handle,
+			     0,
+			     number_of_records - number_of_records_to_export,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export records in parallel.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	/* The records before the checkpoint were exported by the export that is resumed
+	 */
+	if( ( export_handle->checkpoint != NULL )
+	 && ( export_handle->checkpoint->is_resumable != 0 )
+	 && ( export_handle->checkpoint->current_input_index == export_handle->checkpoint->input_index ) )
+	{
+		export_index = export_handle->checkpoint->export_index;
+
+		export_handle->checkpoint->is_resumable = 0;
+	}
+	for( ;
+	     export_index < number_of_records;
+	     export_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			return( -1 );
+		}
+		if( export_handle->newest_first != 0 )
+		{
+			record_index = ( first_record_index + number_of_records - 1 - export_index ) % total_number_of_records;
+		}
+		else
+		{
+			record_index = ( first_record_index + export_index ) % total_number_of_records;
+		}
+
+		if( export_handle_export_record_by_index(
+		     export_handle,
+		     file,
+		     record_index,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( export_handle_write_checkpoint(
+		     export_handle,
+		     export_index + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write checkpoint.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the recovered records
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_recovered_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function    = "export_handle_export_recovered_records";
+	int number_of_duplicates = 0;
+	int number_of_records    = 0;
+	int record_index         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->record_hash_set != NULL )
+	{
+		if( libevtx_file_get_number_of_duplicate_recovered_records(
+		     file,
+		     &number_of_duplicates,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of duplicate recovered records.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->number_of_duplicate_records += number_of_duplicates;
+	}
+	if( libevtx_file_get_number_of_recovered_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			return( -1 );
+		}
+		if( libevtx_file_get_recovered_record_by_index(
+		     file,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( export_handle_export_record(
+		          export_handle,
+		          record,
+		          log_handle,
+		          error ) != 1 )
+		{
+			/* The CSV, JSON, Protocol Buffers and timeline formats are written as valid output only
+			 */
+			if( ( export_handle->export_format != EXPORT_FORMAT_BODYFILE )
+			 && ( export_handle->export_format != EXPORT_FORMAT_CSV )
+			 && ( export_handle->export_format != EXPORT_FORMAT_ES_BULK )
+			 && ( export_handle->export_format != EXPORT_FORMAT_JSON )
+			 && ( export_handle->export_format != EXPORT_FORMAT_L2T_CSV )
+			 && ( export_handle->export_format != EXPORT_FORMAT_NDJSON )
+			 && ( export_handle->export_format != EXPORT_FORMAT_PROTOBUF ) )
+			{
+				output_writer_printf(
+				 export_handle->output_writer,
+				 "Unable to export recovered record: %d.\n\n",
+				 record_index );
+			}
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export recovered record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libevtx_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Follows the file and exports records as they are added to it
+ * The file is refreshed at a fixed interval until abort is signalled
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_follow_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_follow_records";
+	int number_of_records = 0;
+	int record_index      = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &record_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	while( export_handle->abort == 0 )
+	{
+		if( output_writer_flush_stream(
+		     export_handle->output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output writer.",
+			 function );
+
+			return( -1 );
+		}
+
+#if defined( WINAPI )
+		Sleep(
+		 EXPORT_HANDLE_FOLLOW_INTERVAL * 1000 );
+#else
+		sleep(
+		 EXPORT_HANDLE_FOLLOW_INTERVAL );
+#endif
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		result = libevtx_file_refresh(
+		          file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to refresh file.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libevtx_file_get_number_of_records(
+		     file,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			return( -1 );
+		}
+		while( record_index < number_of_records )
+		{
+			if( export_handle->abort != 0 )
+			{
+				break;
+			}
+			if( export_handle_export_record_by_index(
+			     export_handle,
+			     file,
+			     record_index,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record: %d.",
+				 function,
+				 record_index );
+
+				return( -1 );
+			}
+			record_index++;
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the start of the output, which depends on the export format
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_start_of_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_start_of_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The start of the output is written when a partition file is created
+	 */
+	if( ( export_handle->partition_writer != NULL )
+	 && ( export_handle->partition_is_selected == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The start of the output was written by the export that is resumed
+	 */
+	if( ( export_handle->checkpoint != NULL )
+	 && ( export_handle->checkpoint->is_resumable != 0 )
+	 && ( export_handle->checkpoint->current_input_index == export_handle->checkpoint->input_index )
+	 && ( export_handle->checkpoint->output_offset > 0 ) )
+	{
+		export_handle->number_of_json_records = export_handle->checkpoint->number_of_json_records;
+
+		return( 1 );
+	}
+	/* The JSON format writes the records as a single array
+	 */
+	if( export_handle->export_format == EXPORT_FORMAT_JSON )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     "[",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write start of JSON array.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->number_of_json_records = 0;
+	}
+	/* The CSV format starts with a header with the column names
+	 */
+	else if( export_handle->export_format == EXPORT_FORMAT_CSV )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     "record_identifier,written_time,event_identifier,event_identifier_qualifiers,"
+		     "event_level,provider_identifier,source_name,computer_name,"
+		     "user_security_identifier,event_data\n",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write CSV header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_L2T_CSV )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     "date,time,timezone,MACB,source,sourcetype,type,user,host,short,desc,"
+		     "version,filename,inode,notes,format,extra\n",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write L2T CSV header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the end of the output, which depends on the export format, and flushes the output
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_end_of_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_end_of_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_JSON )
+	{
+		if( output_writer_write_ascii_string(
+		     export_handle->output_writer,
+		     ( export_handle->number_of_json_records == 0 ) ? "]\n" : "\n]\n",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of JSON array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( output_writer_flush(
+	     export_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output writer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the records from the input file
+ * The start and end of the output are not written
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_input_records(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_handle_export_input_records";
+	int result                   = 0;
+	int result_recovered_records = 0;
+	int result_records           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
+	{
+		result_records = export_handle_export_records(
+				  export_handle,
+				  export_handle->input_file,
+				  log_handle,
+				  error );
+
+		if( result_records == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
+	{
+		result_recovered_records = export_handle_export_recovered_records(
+					    export_handle,
+					    export_handle->input_file,
+					    log_handle,
+					    error );
+
+		if( result_recovered_records == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export recovered records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Records added to the file are exported until abort is signalled
+	 */
+	if( ( export_handle->follow != 0 )
+	 && ( export_handle->export_mode != EXPORT_MODE_RECOVERED ) )
+	{
+		if( export_handle_follow_records(
+		     export_handle,
+		     export_handle->input_file,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to follow records.",
+			 function );
+
+			return( -1 );
+		}
+		result = 1;
+	}
+	else if( ( result_records != 0 )
+	      || ( result_recovered_records != 0 ) )
+	{
+		result = 1;
+	}
+	return( result );
+}
+
+/* Exports the records from the file
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_file(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_file";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->timings != NULL )
+	{
+		if( export_timings_start(
+		     export_handle->timings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start timings.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle_write_start_of_output(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write start of output.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_handle_export_input_records(
+	          export_handle,
+	          log_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export records of input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_write_end_of_output(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of output.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->timings != NULL )
+	{
+		if( export_timings_stop(
+		     export_handle->timings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timings.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Exports the records from a file that is kept open by the caller
+ * The file is used as the input for the duration of the export, which allows
+ * a file to be exported multiple times without reopening it
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_resident_file(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     const system_character_t *filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_file_t *input_file = NULL;
+	static char *function      = "export_handle_export_resident_file";
+	int result                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The input file of the export handle is restored afterwards
+	 * since it is freed together with the export handle
+	 */
+	input_file = export_handle->input_file;
+
+	export_handle->input_file     = file;
+	export_handle->input_filename = filename;
+	export_handle->input_is_open  = 1;
+
+	result = export_handle_export_file(
+	          export_handle,
+	          log_handle,
+	          error );
+
+	export_handle->input_file     = input_file;
+	export_handle->input_filename = NULL;
+	export_handle->input_is_open  = 0;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export file.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Exports a record carved from the input
+ * Callback function for libevtx_carver_carve_file
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int export_handle_export_carved_record(
+     libevtx_record_t *record,
+     void *user_data )
+{
+	export_handle_carve_context_t *carve_context = NULL;
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	carve_context = (export_handle_carve_context_t *) user_data;
+
+	if( carve_context->export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( export_handle_export_record(
+	     carve_context->export_handle,
+	     record,
+	     carve_context->log_handle,
+	     &( carve_context->error ) ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Carves the records from the chunks in the input, such as a disk image
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_carve_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	export_handle_carve_context_t carve_context;
+
+	static char *function          = "export_handle_carve_input";
+	int number_of_chunks           = 0;
+	int number_of_corrupted_chunks = 0;
+	int number_of_records          = 0;
+	int result                     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	carve_context.export_handle = export_handle;
+	carve_context.log_handle    = log_handle;
+	carve_context.error         = NULL;
+
+	if( export_handle_open_message_handle_input(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_initialize(
+	     &( export_handle->carver ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_set_ascii_codepage(
+	     export_handle->carver,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_set_number_of_threads(
+	     export_handle->carver,
+	     export_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads in carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_start_of_output(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write start of output.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_carver_carve_file_wide(
+	          export_handle->carver,
+	          filename,
+	          &export_handle_export_carved_record,
+	          &carve_context,
+	          error );
+#else
+	result = libevtx_carver_carve_file(
+	          export_handle->carver,
+	          filename,
+	          &export_handle_export_carved_record,
+	          &carve_context,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		/* The error of the callback contains the cause of the failure
+		 */
+		if( carve_context.error != NULL )
+		{
+			libcerror_error_free(
+			 error );
+
+			*error = carve_context.error;
+
+			carve_context.error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve input.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_end_of_output(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of output.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_get_number_of_chunks(
+	     export_handle->carver,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of carved chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_get_number_of_corrupted_chunks(
+	     export_handle->carver,
+	     &number_of_corrupted_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of corrupted carved chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_get_number_of_records(
+	     export_handle->carver,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of carved records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_free(
+	     &( export_handle->carver ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle_close_input(
+	     export_handle->message_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input of message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->verbose != 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Carved chunks\t\t\t: %d (%d corrupted)\n",
+		 number_of_chunks,
+		 number_of_corrupted_chunks );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "Carved records\t\t\t: %d\n",
+		 number_of_records );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( carve_context.error != NULL )
+	{
+		libcerror_error_free(
+		 &( carve_context.error ) );
+	}
+	if( export_handle->carver != NULL )
+	{
+		libevtx_carver_free(
+		 &( export_handle->carver ),
+		 NULL );
+	}
+	message_handle_close_input(
+	 export_handle->message_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Exports the records of multiple input files merged in order of their written time
+ * The message handle is opened for the event log type of the export handle
+ * Returns 1 if successful, 0 if no records are available or -1 on error
+ */
+int export_handle_merge_input(
+     export_handle_t *export_handle,
+     const system_character_t * const *filenames,
+     int number_of_filenames,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function    = "export_handle_merge_input";
+	uint64_t content_hash    = 0;
+	uint64_t written_time    = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->collection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - collection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_open_message_handle_input(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_collection_initialize(
+	     &( export_handle->collection ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize collection.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_collection_set_ascii_codepage(
+	     export_handle->collection,
+	     export_handle->ascii_codepage,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings in record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in collection.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Number of strings\t\t: %d\n",
-	 number_of_strings );
-
-	for( value_string_index = 0;
-	     value_string_index < number_of_strings;
-	     value_string_index++ )
+	if( libevtx_collection_set_number_of_threads(
+	     export_handle->collection,
+	     export_handle->number_of_threads,
+	     error ) != 1 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "String: %d\t\t\t: ",
-		 value_string_index + 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads in collection.",
+		 function );
 
+		goto on_error;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevtx_record_get_utf16_string_size(
-			  record,
-			  value_string_index,
-			  &value_string_size,
-			  error );
+	result = libevtx_collection_open_wide(
+	          export_handle->collection,
+	          filenames,
+	          number_of_filenames,
+	          error );
 #else
-		result = libevtx_record_get_utf8_string_size(
-			  record,
-			  value_string_index,
-			  &value_string_size,
-			  error );
+	result = libevtx_collection_open(
+	          export_handle->collection,
+	          filenames,
+	          number_of_filenames,
+	          error );
 #endif
-		if( result != 1 )
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open collection.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_start_of_output(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write start of output.",
+		 function );
+
+		goto on_error;
+	}
+	while( export_handle->abort == 0 )
+	{
+		result = libevtx_collection_get_next_record(
+		          export_handle->collection,
+		          &record,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve string: %d size.",
-			 function,
-			 value_string_index );
+			 "%s: unable to retrieve next record.",
+			 function );
 
 			goto on_error;
 		}
-		if( value_string_size > 0 )
+		else if( result == 0 )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
-
-			if( value_string == NULL )
+			break;
+		}
+		if( export_handle->since_written_time_is_set != 0 )
+		{
+			if( libevtx_record_get_written_time(
+			     record,
+			     &written_time,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve written time.",
 				 function );
 
 				goto on_error;
 			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libevtx_record_get_utf16_string(
-				  record,
-				  value_string_index,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libevtx_record_get_utf8_string(
-				  record,
-				  value_string_index,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
-			if( result != 1 )
+			result = ( written_time > export_handle->since_written_time );
+		}
+		if( ( result != 0 )
+		 && ( export_handle->record_hash_set != NULL ) )
+		{
+			if( libevtx_record_get_content_hash(
+			     record,
+			     &content_hash,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve string: %d.",
-				 function,
-				 value_string_index );
+				 "%s: unable to retrieve content hash.",
+				 function );
 
 				goto on_error;
 			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "%" PRIs_SYSTEM "",
-			 value_string );
+			result = export_handle_is_duplicate_record_content_hash(
+			          export_handle,
+			          content_hash,
+			          error );
 
-			memory_free(
-			 value_string );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if record is a duplicate.",
+				 function );
 
-			value_string = NULL;
+				goto on_error;
+			}
+			result = ( result == 0 );
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
-	}
-	if( message_string != NULL )
-	{
-		if( message_string_fprint(
-		     message_string,
-		     record,
-		     export_handle->notify_stream,
+		if( result != 0 )
+		{
+			if( export_handle_export_record(
+			     export_handle,
+			     record,
+			     log_handle,
+			     error ) != 1 )
+			{
+				/* The CSV, JSON, Protocol Buffers and timeline formats are written as valid output only
+				 */
+				if( ( export_handle->export_format != EXPORT_FORMAT_BODYFILE )
+				 && ( export_handle->export_format != EXPORT_FORMAT_CSV )
+				 && ( export_handle->export_format != EXPORT_FORMAT_ES_BULK )
+				 && ( export_handle->export_format != EXPORT_FORMAT_JSON )
+				 && ( export_handle->export_format != EXPORT_FORMAT_L2T_CSV )
+				 && ( export_handle->export_format != EXPORT_FORMAT_NDJSON )
+				 && ( export_handle->export_format != EXPORT_FORMAT_PROTOBUF ) )
+				{
+					output_writer_printf(
+					 export_handle->output_writer,
+					 "Unable to export record.\n\n" );
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			number_of_records++;
+		}
+		if( libevtx_record_free(
+		     &record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print message string.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
 			 function );
 
 			goto on_error;
 		}
-		message_string = NULL;
-	}
-	return( 1 );
-
-on_error:
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	if( template_definition != NULL )
-	{
-		libevtx_template_definition_free(
-		 &template_definition,
-		 NULL );
 	}
-	if( message_filename != NULL )
+	if( export_handle_write_end_of_output(
+	     export_handle,
+	     error ) != 1 )
 	{
-		memory_free(
-		 message_filename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of output.",
+		 function );
+
+		goto on_error;
 	}
-	if( resource_filename != NULL )
+	if( libevtx_collection_free(
+	     &( export_handle->collection ),
+	     error ) != 1 )
 	{
-		memory_free(
-		 resource_filename );
-	}
-	return( -1 );
-}
-
-/* Exports the record
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_record(
-     export_handle_t *export_handle,
-     libevtx_record_t *record,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	static char *function = "export_handle_export_record";
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free collection.",
+		 function );
 
-	if( export_handle == NULL )
+		goto on_error;
+	}
+	if( message_handle_close_input(
+	     export_handle->message_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input of message handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+	if( export_handle->verbose != 0 )
 	{
-		if( export_handle_export_record_text(
-		     export_handle,
-		     record,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record in text.",
-			 function );
+		fprintf(
+		 export_handle->notify_stream,
+		 "Merged files\t\t\t: %d\n",
+		 number_of_filenames );
 
-			return( -1 );
+		fprintf(
+		 export_handle->notify_stream,
+		 "Merged records\t\t\t: %d\n",
+		 number_of_records );
+
+		if( export_handle->record_hash_set != NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Duplicate records\t\t: %d\n",
+			 export_handle->number_of_duplicate_records );
 		}
 	}
-	else if( export_handle->export_format == EXPORT_FORMAT_XML )
+	if( number_of_records == 0 )
 	{
-		if( export_handle_export_record_xml(
-		     export_handle,
-		     record,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record in XML.",
-			 function );
-
-			return( -1 );
-		}
+		return( 0 );
 	}
 	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( export_handle->collection != NULL )
+	{
+		libevtx_collection_free(
+		 &( export_handle->collection ),
+		 NULL );
+	}
+	message_handle_close_input(
+	 export_handle->message_handle,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Exports the record in the text format
+/* Creates the name of the output file of an input file in batch mode
+ * The output filename consists of the output directory name, the name of the input
+ * file without its .evtx extension and an extension that depends on the export format
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_record_text(
+int export_handle_get_batch_output_filename(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	system_character_t filetime_string[ 48 ];
-
-	libfdatetime_filetime_t *filetime       = NULL;
-	system_character_t *source_name         = NULL;
-	system_character_t *provider_identifier = NULL;
-	system_character_t *value_string        = NULL;
-	static char *function                   = "export_handle_export_record_text";
-	size_t source_name_size                 = 0;
-	size_t provider_identifier_size         = 0;
-	size_t value_string_size                = 0;
-	uint64_t value_64bit                    = 0;
-	uint32_t event_identifier               = 0;
-	uint8_t event_level                     = 0;
-	int result                              = 0;
+     const system_character_t *input_filename,
+     const system_character_t *output_directory_name,
+     system_character_t **output_filename,
+     size_t *output_filename_size,
+     libcerror_error_t **error )
+{
+	const system_character_t *compression_extension = NULL;
+	const system_character_t *extension             = NULL;
+	const system_character_t *name                  = NULL;
+	system_character_t *basename                    = NULL;
+	static char *function                           = "export_handle_get_batch_output_filename";
+	size_t basename_length                          = 0;
+	size_t compression_extension_length             = 0;
+	size_t extension_length                         = 0;
+	size_t name_length                              = 0;
+	int result                                      = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1877,526 +14328,690 @@ int export_handle_export_record_text(
 
 		return( -1 );
 	}
-	if( record == NULL )
+	if( input_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid input filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdatetime_filetime_initialize(
-	     &filetime,
-	     error ) != 1 )
+	if( output_directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create filetime.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output directory name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libevtx_record_get_identifier(
-	     record,
-	     &value_64bit,
+	if( export_handle_get_output_file_extension(
+	     export_handle,
+	     &extension,
+	     &compression_extension,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve identifier.",
+		 "%s: unable to retrieve output file extension.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event number\t\t\t: %" PRIu64 "\n",
-	 value_64bit );
+	extension_length = system_string_length(
+	                    extension );
 
-	if( libevtx_record_get_written_time(
-	     record,
-	     &value_64bit,
-	     error ) != 1 )
+	if( compression_extension != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve written time.",
-		 function );
+		compression_extension_length = system_string_length(
+		                                compression_extension );
+	}
 
-		goto on_error;
+	name_length = system_string_length(
+	               input_filename );
+
+	name = system_string_search_character_reverse(
+	        input_filename,
+	        (system_character_t) LIBCPATH_SEPARATOR,
+	        name_length );
+
+	if( name == NULL )
+	{
+		name = input_filename;
 	}
-	if( libfdatetime_filetime_copy_from_64bit(
-	     filetime,
-	     value_64bit,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy filetime from 64-bit.",
-		 function );
+		name++;
 
-		goto on_error;
+		name_length = system_string_length(
+		               name );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfdatetime_filetime_copy_to_utf16_string(
-		  filetime,
-		  (uint16_t *) filetime_string,
-		  48,
-		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-		  error );
-#else
-	result = libfdatetime_filetime_copy_to_utf8_string(
-		  filetime,
-		  (uint8_t *) filetime_string,
-		  48,
-		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-		  error );
-#endif
-	if( result != 1 )
+	if( ( name_length > 5 )
+	 && ( system_string_compare_no_case(
+	       &( name[ name_length - 5 ] ),
+	       _SYSTEM_STRING( ".evtx" ),
+	       5 ) == 0 ) )
+	{
+		name_length -= 5;
+	}
+	if( name_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy filetime to string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input filename - missing name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Written time\t\t\t: %" PRIs_SYSTEM " UTC\n",
-	 filetime_string );
+	basename_length = name_length + extension_length + compression_extension_length;
 
-	if( libfdatetime_filetime_free(
-	     &filetime,
-	     error ) != 1 )
+	basename = system_string_allocate(
+	            basename_length + 1 );
+
+	if( basename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free filetime.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create basename.",
 		 function );
 
 		goto on_error;
 	}
-	if( libevtx_record_get_event_level(
-	     record,
-	     &event_level,
-	     error ) != 1 )
+	if( system_string_copy(
+	     basename,
+	     name,
+	     name_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event level.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to basename.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event level\t\t\t: %s (%d)\n",
-	 export_handle_get_event_level(
-	  event_level ),
-	 event_level );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevtx_record_get_utf16_user_security_identifier_size(
-	          record,
-	          &value_string_size,
-	          error );
-#else
-	result = libevtx_record_get_utf8_user_security_identifier_size(
-	          record,
-	          &value_string_size,
-	          error );
-#endif
-	if( result == -1 )
+	if( system_string_copy(
+	     &( basename[ name_length ] ),
+	     extension,
+	     extension_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve user security identifier size.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy extension to basename.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( result != 0 )
-	 && ( value_string_size > 0 ) )
+	if( compression_extension != NULL )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
-
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevtx_record_get_utf16_user_security_identifier(
-		          record,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libevtx_record_get_utf8_user_security_identifier(
-		          record,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( system_string_copy(
+		     &( basename[ name_length + extension_length ] ),
+		     compression_extension,
+		     compression_extension_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve user security identifier.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy compression extension to basename.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "User security identifier\t: %" PRIs_SYSTEM "\n",
-		 value_string );
-
-		memory_free(
-		 value_string );
-
-		value_string = NULL;
 	}
+	basename[ basename_length ] = 0;
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevtx_record_get_utf16_computer_name_size(
-	          record,
-	          &value_string_size,
-	          error );
+	result = libcpath_path_join_wide(
+		  output_filename,
+		  output_filename_size,
+		  output_directory_name,
+		  system_string_length(
+		   output_directory_name ),
+		  basename,
+		  basename_length,
+		  error );
 #else
-	result = libevtx_record_get_utf8_computer_name_size(
-	          record,
-	          &value_string_size,
-	          error );
+	result = libcpath_path_join(
+		  output_filename,
+		  output_filename_size,
+		  output_directory_name,
+		  system_string_length(
+		   output_directory_name ),
+		  basename,
+		  basename_length,
+		  error );
 #endif
-	if( result == -1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve computer name size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output filename.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( result != 0 )
-	 && ( value_string_size > 0 ) )
-	{
-		value_string = system_string_allocate(
-		                value_string_size );
+	memory_free(
+	 basename );
 
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
-			 function );
+	return( 1 );
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevtx_record_get_utf16_computer_name(
-		          record,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libevtx_record_get_utf8_computer_name(
-		          record,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve computer name.",
-			 function );
+on_error:
+	if( basename != NULL )
+	{
+		memory_free(
+		 basename );
+	}
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+/* Exports the records of a single input file in batch mode
+ * The input of the message handle must be open
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_batch_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     const system_character_t *output_directory_name,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *output_filename = NULL;
+	static char *function               = "export_handle_export_batch_file";
+	size_t output_filename_size         = 0;
+	int output_is_open                  = 0;
+	int result                          = 0;
 
-		memory_free(
-		 value_string );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		value_string = NULL;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevtx_record_get_utf16_provider_identifier_size(
-	          record,
-	          &provider_identifier_size,
-	          error );
-#else
-	result = libevtx_record_get_utf8_provider_identifier_size(
-	          record,
-	          &provider_identifier_size,
-	          error );
-#endif
-	if( result == -1 )
+	if( export_handle_open_input_file(
+	     export_handle,
+	     filename,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve provider identifier size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( result != 0 )
-	 && ( provider_identifier_size > 0 ) )
+	if( output_directory_name != NULL )
 	{
-		provider_identifier = system_string_allocate(
-		                       provider_identifier_size );
-
-		if( provider_identifier == NULL )
+		if( export_handle_get_batch_output_filename(
+		     export_handle,
+		     filename,
+		     output_directory_name,
+		     &output_filename,
+		     &output_filename_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create event source.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve output filename.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevtx_record_get_utf16_provider_identifier(
-		          record,
-		          (uint16_t *) provider_identifier,
-		          provider_identifier_size,
-		          error );
-#else
-		result = libevtx_record_get_utf8_provider_identifier(
-		          record,
-		          (uint8_t *) provider_identifier,
-		          provider_identifier_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( export_handle_open_output(
+		     export_handle,
+		     output_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open output file: %" PRIs_SYSTEM ".",
+			 function,
+			 output_filename );
+
+			goto on_error;
+		}
+		output_is_open = 1;
+
+		if( export_handle_write_start_of_output(
+		     export_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider identifier.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write start of output.",
 			 function );
 
 			goto on_error;
 		}
-		if( export_handle->verbose != 0 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Provider identifier\t\t: %" PRIs_SYSTEM "\n",
-			 provider_identifier );
-		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevtx_record_get_utf16_source_name_size(
-	          record,
-	          &source_name_size,
+	result = export_handle_export_input_records(
+	          export_handle,
+	          log_handle,
 	          error );
-#else
-	result = libevtx_record_get_utf8_source_name_size(
-	          record,
-	          &source_name_size,
-	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve source name size.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export records of input file.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( result != 0 )
-	 && ( source_name_size > 0 ) )
+	if( output_directory_name != NULL )
 	{
-		source_name = system_string_allocate(
-		               source_name_size );
-
-		if( source_name == NULL )
+		if( export_handle_write_end_of_output(
+		     export_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create event source.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of output.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevtx_record_get_utf16_source_name(
-		          record,
-		          (uint16_t *) source_name,
-		          source_name_size,
-		          error );
-#else
-		result = libevtx_record_get_utf8_source_name(
-		          record,
-		          (uint8_t *) source_name,
-		          source_name_size,
-		          error );
-#endif
-		if( result != 1 )
+		output_is_open = 0;
+
+		if( export_handle_close_output(
+		     export_handle,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve source name.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output file.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
-		 source_name );
-	}
-/* TODO category ? */
+		memory_free(
+		 output_filename );
 
-	if( libevtx_record_get_event_identifier(
-	     record,
-	     &event_identifier,
-	     error ) != 1 )
+		output_filename = NULL;
+
+		/* The next input file is written to a new output file
+		 */
+		if( export_handle->checkpoint != NULL )
+		{
+			if( export_checkpoint_write(
+			     export_handle->checkpoint,
+			     export_handle->checkpoint->current_input_index + 1,
+			     0,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( export_handle_close_input_file(
+	     export_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event identifier.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
-	 event_identifier,
-	 event_identifier );
+	return( result );
 
-	if( export_handle_export_record_event_message(
-	     export_handle,
-	     record,
-	     provider_identifier,
-	     provider_identifier_size - 1,
-	     source_name,
-	     source_name_size - 1,
-	     event_identifier,
-	     log_handle,
-	     error ) != 1 )
+on_error:
+	if( output_is_open != 0 )
+	{
+		export_handle_close_output(
+		 export_handle,
+		 NULL );
+	}
+	if( output_filename != NULL )
+	{
+		memory_free(
+		 output_filename );
+	}
+	export_handle_close_input_file(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Exports the records of multiple input files one after the other
+ * The input of the message handle, and with it the cached resource files, messages
+ * and template definitions, remains open for all the input files and is only
+ * reopened when the event log type changes. If an output directory name is provided
+ * the records of every input file are written to a separate output file, otherwise
+ * they are written to the current output.
+ * An input file that cannot be exported is reported and skipped
+ * Returns 1 if successful, 0 if one or more input files could not be exported or -1 on error
+ */
+int export_handle_export_batch(
+     export_handle_t *export_handle,
+     const system_character_t * const *filenames,
+     int number_of_filenames,
+     const system_character_t *output_directory_name,
+     uint8_t event_log_type_from_filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *file_error     = NULL;
+	static char *function             = "export_handle_export_batch";
+	int default_event_log_type        = 0;
+	int filename_index                = 0;
+	int message_handle_event_log_type = 0;
+	int message_handle_is_open        = 0;
+	int number_of_exported_files      = 0;
+	int number_of_failed_files        = 0;
+	int result                        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to export event message.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of filenames value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	default_event_log_type = export_handle->event_log_type;
+
+	if( output_directory_name == NULL )
+	{
+		if( export_handle_write_start_of_output(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write start of output.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( export_handle->checkpoint != NULL )
+		{
+			/* The input files before the checkpoint were exported by the export that is resumed
+			 */
+			if( ( export_handle->checkpoint->is_resumable != 0 )
+			 && ( filename_index < export_handle->checkpoint->input_index ) )
+			{
+				if( export_handle->verbose != 0 )
+				{
+					fprintf(
+					 export_handle->notify_stream,
+					 "Skipping exported file: %" PRIs_SYSTEM "\n",
+					 filenames[ filename_index ] );
+				}
+				continue;
+			}
+			export_handle->checkpoint->current_input_index = filename_index;
+		}
+		if( event_log_type_from_filename != 0 )
+		{
+			export_handle->event_log_type = default_event_log_type;
+
+			if( export_handle_set_event_log_type_from_filename(
+			     export_handle,
+			     filenames[ filename_index ],
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set event log type from filename: %d.",
+				 function,
+				 filename_index );
+
+				goto on_error;
+			}
+		}
+		/* The event log type determines the registry key of the providers
+		 */
+		if( ( message_handle_is_open != 0 )
+		 && ( message_handle_event_log_type != export_handle->event_log_type ) )
+		{
+			message_handle_is_open = 0;
+
+			if( message_handle_close_input(
+			     export_handle->message_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input of message handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( message_handle_is_open == 0 )
+		{
+			if( export_handle_open_message_handle_input(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open input of message handle.",
+				 function );
+
+				goto on_error;
+			}
+			message_handle_event_log_type = export_handle->event_log_type;
+			message_handle_is_open        = 1;
+		}
+		if( export_handle->verbose != 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Exporting file: %" PRIs_SYSTEM "\n",
+			 filenames[ filename_index ] );
+		}
+		result = export_handle_export_batch_file(
+		          export_handle,
+		          filenames[ filename_index ],
+		          output_directory_name,
+		          log_handle,
+		          &file_error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export file: %" PRIs_SYSTEM ".\n",
+			 filenames[ filename_index ] );
+
+			libcnotify_print_error_backtrace(
+			 file_error );
+			libcerror_error_free(
+			 &file_error );
+
+			number_of_failed_files++;
+		}
+		else
+		{
+			number_of_exported_files++;
+		}
+	}
+	if( output_directory_name == NULL )
+	{
+		if( export_handle_write_end_of_output(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of output.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_handle_is_open != 0 )
+	{
+		message_handle_is_open = 0;
+
+		if( message_handle_close_input(
+		     export_handle->message_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input of message handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	export_handle->event_log_type = default_event_log_type;
 
-	if( provider_identifier != NULL )
+	if( export_handle->verbose != 0 )
 	{
-		memory_free(
-		 provider_identifier );
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exported files\t\t\t: %d\n",
+		 number_of_exported_files );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "Failed files\t\t\t: %d\n",
+		 number_of_failed_files );
 
-		provider_identifier = NULL;
+		if( export_handle->record_hash_set != NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Duplicate records\t\t: %d\n",
+			 export_handle->number_of_duplicate_records );
+		}
 	}
-	if( source_name != NULL )
+	if( number_of_failed_files != 0 )
 	{
-		memory_free(
-		 source_name );
-
-		source_name = NULL;
+		return( 0 );
 	}
 	return( 1 );
 
 on_error:
-	if( provider_identifier != NULL )
-	{
-		memory_free(
-		 provider_identifier );
-	}
-	if( source_name != NULL )
-	{
-		memory_free(
-		 source_name );
-	}
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	if( filetime != NULL )
+	if( message_handle_is_open != 0 )
 	{
-		libfdatetime_filetime_free(
-		 &filetime,
+		message_handle_close_input(
+		 export_handle->message_handle,
 		 NULL );
 	}
+	export_handle->event_log_type = default_event_log_type;
+
 	return( -1 );
 }
 
-/* Exports the record in the XML format
+/* Prints the libevtx statistics to a stream
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_record_xml(
+int export_handle_statistics_fprint(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
-     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	system_character_t *event_xml = NULL;
-	static char *function         = "export_handle_export_record_xml";
-	size_t event_xml_size         = 0;
+	uint64_t statistics[ LIBEVTX_NUMBER_OF_STATISTICS ];
+	static char *function = "export_handle_statistics_fprint";
 
 	if( export_handle == NULL )
 	{
@@ -2409,117 +15024,141 @@ int export_handle_export_record_xml(
 
 		return( -1 );
 	}
-	if( record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libevtx_record_get_utf16_xml_string_size(
-	     record,
-	     &event_xml_size,
-	     error ) != 1 )
-#else
-	if( libevtx_record_get_utf8_xml_string_size(
-	     record,
-	     &event_xml_size,
+	if( libevtx_file_get_statistics(
+	     export_handle->input_file,
+	     statistics,
+	     LIBEVTX_NUMBER_OF_STATISTICS,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event XML size.",
+		 "%s: unable to retrieve statistics.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( event_xml_size > 0 )
-	{
-		event_xml = system_string_allocate(
-		             event_xml_size );
+	fprintf(
+	 export_handle->notify_stream,
+	 "Statistics:\n" );
 
-		if( event_xml == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create event XML.",
-			 function );
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of chunks read\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNKS_READ ] );
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libevtx_record_get_utf16_xml_string(
-		     record,
-		     (uint16_t *) event_xml,
-		     event_xml_size,
-		     error ) != 1 )
-#else
-		if( libevtx_record_get_utf8_xml_string(
-		     record,
-		     (uint8_t *) event_xml,
-		     event_xml_size,
-		     error ) != 1 )
-#endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve event XML.",
-			 function );
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of bytes read\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_BYTES_READ ] );
 
-			goto on_error;
-		}
-		/* Note that the event XML ends with a new line
-		 */
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tChecksum time\t\t\t: %" PRIu64 " ns\n",
+	 statistics[ LIBEVTX_STATISTIC_CHECKSUM_TIME ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tChunk cache hits\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_HITS ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tChunk cache misses\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_MISSES ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tRecord cache hits\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_HITS ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tRecord cache misses\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_MISSES ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of record headers read\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_HEADERS_READ ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of XML documents read\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_XML_DOCUMENTS_READ ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of template expansions\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_TEMPLATE_EXPANSIONS ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of allocations\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_ALLOCATIONS ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of chunk re-reads\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_REREADS ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of background decodes\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_BACKGROUND_DECODED_RECORDS ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of document cache hits\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_DOCUMENT_CACHE_HITS ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tLock wait time\t\t\t: %" PRIu64 " ns\n",
+	 statistics[ LIBEVTX_STATISTIC_LOCK_WAIT_TIME ] );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tNumber of over budget records\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_OVER_BUDGET_RECORDS ] );
+
+	if( export_handle->chunk_sampler != NULL )
+	{
 		fprintf(
 		 export_handle->notify_stream,
-		 "%" PRIs_SYSTEM "",
-		 event_xml );
+		 "\tNumber of sampled chunks\t: %d of %d\n",
+		 export_handle->chunk_sampler->number_of_sampled_chunks,
+		 export_handle->chunk_sampler->number_of_chunks );
 
-		memory_free(
-		 event_xml );
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tNumber of sampled records\t: %" PRIu64 "\n",
+		 export_handle->chunk_sampler->number_of_sampled_records );
 
-		event_xml = NULL;
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tEstimated number of records\t: %" PRIu64 "\n",
+		 chunk_sampler_scale_count(
+		  export_handle->chunk_sampler,
+		  export_handle->chunk_sampler->number_of_sampled_records ) );
 	}
+
 	fprintf(
 	 export_handle->notify_stream,
 	 "\n" );
 
 	return( 1 );
-
-on_error:
-	if( event_xml != NULL )
-	{
-		memory_free(
-		 event_xml );
-	}
-	return( -1 );
 }
 
-/* Exports the records
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
+/* Prints the time spent per phase to a stream
+ * Returns 1 if successful, 0 if the timings were not measured or -1 on error
  */
-int export_handle_export_records(
+int export_handle_timings_fprint(
      export_handle_t *export_handle,
-     libevtx_file_t *file,
-     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libevtx_record_t *record = NULL;
-	static char *function   = "export_handle_export_records";
-	int number_of_records   = 0;
-	int record_index        = 0;
+	static char *function = "export_handle_timings_fprint";
 
 	if( export_handle == NULL )
 	{
@@ -2532,120 +15171,116 @@ int export_handle_export_records(
 
 		return( -1 );
 	}
-	if( file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
-
-		return( -1 );
-	}
-	if( libevtx_file_get_number_of_records(
-	     file,
-	     &number_of_records,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_records == 0 )
+	if( export_handle->timings == NULL )
 	{
 		return( 0 );
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
-	{
-		if( export_handle->abort != 0 )
-		{
-			return( -1 );
-		}
-		if( libevtx_file_get_record_by_index(
-		     file,
-		     record_index,
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
-			 function,
-			 record_index );
-
-			return( -1 );
-		}
-		if( export_handle_export_record(
-		     export_handle,
-		     record,
-		     log_handle,
-		     error ) != 1 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Unable to export record: %d.\n\n",
-			 record_index );
-
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record: %d.",
-			 function,
-			 record_index );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-		if( libevtx_record_free(
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+	if( export_timings_fprint(
+	     export_handle->timings,
+	     export_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print timings.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Exports the recovered records
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
+/* Compares two decode profile chunks by their decode cost in descending order
+ * Every chunk consists of the decode cost followed by the chunk index
+ * Returns -1, 0 or 1 as qsort requires
  */
-int export_handle_export_recovered_records(
+int export_handle_decode_profile_chunk_compare(
+     const void *first_chunk,
+     const void *second_chunk )
+{
+	const uint64_t *first_chunk_values  = (const uint64_t *) first_chunk;
+	const uint64_t *second_chunk_values = (const uint64_t *) second_chunk;
+
+	if( first_chunk_values[ 0 ] > second_chunk_values[ 0 ] )
+	{
+		return( -1 );
+	}
+	else if( first_chunk_values[ 0 ] < second_chunk_values[ 0 ] )
+	{
+		return( 1 );
+	}
+	if( first_chunk_values[ 1 ] < second_chunk_values[ 1 ] )
+	{
+		return( -1 );
+	}
+	else if( first_chunk_values[ 1 ] > second_chunk_values[ 1 ] )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Prints a little-endian GUID to a stream
+ */
+void export_handle_guid_fprint(
+      FILE *stream,
+      const uint8_t *guid )
+{
+	uint32_t value_32bit = 0;
+	uint16_t value_16bit = 0;
+	uint16_t value2_16bit = 0;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 guid,
+	 value_32bit );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( guid[ 4 ] ),
+	 value_16bit );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( guid[ 6 ] ),
+	 value2_16bit );
+
+	fprintf(
+	 stream,
+	 "{%08" PRIx32 "-%04" PRIx16 "-%04" PRIx16 "-%02" PRIx8 "%02" PRIx8 "-%02" PRIx8 "%02" PRIx8 "%02" PRIx8 "%02" PRIx8 "%02" PRIx8 "%02" PRIx8 "}",
+	 value_32bit,
+	 value_16bit,
+	 value2_16bit,
+	 guid[ 8 ],
+	 guid[ 9 ],
+	 guid[ 10 ],
+	 guid[ 11 ],
+	 guid[ 12 ],
+	 guid[ 13 ],
+	 guid[ 14 ],
+	 guid[ 15 ] );
+}
+
+/* Prints the decode profile of the input file
+ * The providers, event identifiers and templates with the highest decode cost
+ * are printed first followed by the chunks with the highest decode cost
+ * Returns 1 if successful, 0 if no decode profile is available or -1 on error
+ */
+int export_handle_decode_profile_fprint(
      export_handle_t *export_handle,
-     libevtx_file_t *file,
-     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libevtx_record_t *record = NULL;
-	static char *function   = "export_handle_export_recovered_records";
-	int number_of_records   = 0;
-	int record_index        = 0;
+	uint8_t provider_identifier[ 16 ];
+	uint8_t template_identifier[ 16 ];
+	uint64_t values[ LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ];
+
+	uint64_t *chunks          = NULL;
+	static char *function     = "export_handle_decode_profile_fprint";
+	uint32_t event_identifier = 0;
+	int chunk_index           = 0;
+	int entry_index           = 0;
+	int number_of_chunks      = 0;
+	int number_of_entries     = 0;
+	int number_of_used_chunks = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2658,184 +15293,240 @@ int export_handle_export_recovered_records(
 
 		return( -1 );
 	}
-	if( file == NULL )
+	if( ( export_handle->decode_profiling == 0 )
+	 || ( export_handle->input_file == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_file_get_number_of_decode_profile_entries(
+	     export_handle->input_file,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of decode profile entries.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libevtx_file_get_number_of_recovered_records(
-	     file,
-	     &number_of_records,
+	if( libevtx_file_get_number_of_decode_profile_chunks(
+	     export_handle->input_file,
+	     &number_of_chunks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of recovered records.",
+		 "%s: unable to retrieve number of decode profile chunks.",
 		 function );
 
-		return( -1 );
-	}
-	if( number_of_records == 0 )
-	{
-		return( 0 );
+		goto on_error;
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	fprintf(
+	 export_handle->notify_stream,
+	 "Decode profile:\n" );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "\tProvider identifier\t\t\t\tEvent identifier\tTemplate identifier\t\t\t\tRecords\tDecode (ms)\tParse (ms)\tBytes\tAllocations\n" );
+
+	/* The entries are ranked by the library on their decode and parse time
+	 */
+	for( entry_index = 0;
+	     ( entry_index < number_of_entries )
+	  && ( entry_index < EXPORT_HANDLE_MAXIMUM_NUMBER_OF_DECODE_PROFILE_ENTRIES );
+	     entry_index++ )
 	{
-		if( export_handle->abort != 0 )
-		{
-			return( -1 );
-		}
-		if( libevtx_file_get_recovered_record_by_index(
-		     file,
-		     record_index,
-		     &record,
+		if( libevtx_file_get_decode_profile_entry(
+		     export_handle->input_file,
+		     entry_index,
+		     provider_identifier,
+		     16,
+		     &event_identifier,
+		     template_identifier,
+		     16,
+		     values,
+		     LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve recovered record: %d.",
-			 function,
-			 record_index );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-		else if( export_handle_export_record(
-		          export_handle,
-		          record,
-		          log_handle,
-		          error ) != 1 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Unable to export recovered record: %d.\n\n",
-			 record_index );
-
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export recovered record: %d.",
+			 "%s: unable to retrieve decode profile entry: %d.",
 			 function,
-			 record_index );
+			 entry_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			goto on_error;
 		}
-		if( libevtx_record_free(
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+		fprintf(
+		 export_handle->notify_stream,
+		 "\t" );
 
-			return( -1 );
-		}
-	}
-	return( 1 );
-}
+		export_handle_guid_fprint(
+		 export_handle->notify_stream,
+		 provider_identifier );
 
-/* Exports the records from the file
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
- */
-int export_handle_export_file(
-     export_handle_t *export_handle,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	static char *function        = "export_handle_export_file";
-	int result_recovered_records = 0;
-	int result_records           = 0;
+		fprintf(
+		 export_handle->notify_stream,
+		 "\t%" PRIu32 "\t\t\t",
+		 event_identifier );
 
-	if( export_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
-		 function );
+		export_handle_guid_fprint(
+		 export_handle->notify_stream,
+		 template_identifier );
 
-		return( -1 );
+		fprintf(
+		 export_handle->notify_stream,
+		 "\t%" PRIu64 "\t%" PRIu64 ".%03" PRIu64 "\t%" PRIu64 ".%03" PRIu64 "\t%" PRIu64 "\t%" PRIu64 "\n",
+		 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ],
+		 values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ] / 1000000,
+		 ( values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ] / 1000 ) % 1000,
+		 values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ] / 1000000,
+		 ( values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ] / 1000 ) % 1000,
+		 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ],
+		 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_ALLOCATIONS ] );
 	}
-	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
+	if( number_of_entries > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_DECODE_PROFILE_ENTRIES )
 	{
-		result_records = export_handle_export_records(
-				  export_handle,
-				  export_handle->input_file,
-				  log_handle,
-				  error );
+		fprintf(
+		 export_handle->notify_stream,
+		 "\t(%d more entries)\n",
+		 number_of_entries - EXPORT_HANDLE_MAXIMUM_NUMBER_OF_DECODE_PROFILE_ENTRIES );
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "\n" );
 
-		if( result_records == -1 )
+	if( number_of_chunks > 0 )
+	{
+		if( (size_t) number_of_chunks > ( (size_t) SSIZE_MAX / ( 2 * sizeof( uint64_t ) ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export records.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of decode profile chunks value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-	}
-	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
-	{
-		result_recovered_records = export_handle_export_recovered_records(
-					    export_handle,
-					    export_handle->input_file,
-					    log_handle,
-					    error );
+		chunks = (uint64_t *) memory_allocate(
+		                       sizeof( uint64_t ) * 2 * number_of_chunks );
 
-		if( result_recovered_records == -1 )
+		if( chunks == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export recovered records.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunks.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( libevtx_file_get_decode_profile_chunk_values(
+			     export_handle->input_file,
+			     chunk_index,
+			     values,
+			     LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve decode profile chunk: %d values.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			/* Chunks without decoded records are not ranked
+			 */
+			if( values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ] == 0 )
+			{
+				continue;
+			}
+			chunks[ number_of_used_chunks * 2 ]     = values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]
+			                                        + values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ];
+			chunks[ ( number_of_used_chunks * 2 ) + 1 ] = (uint64_t) chunk_index;
+
+			number_of_used_chunks++;
+		}
+		qsort(
+		 chunks,
+		 (size_t) number_of_used_chunks,
+		 sizeof( uint64_t ) * 2,
+		 &export_handle_decode_profile_chunk_compare );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "Decode profile per chunk:\n" );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tChunk\tRecords\tDecode (ms)\tParse (ms)\tBytes\tAllocations\n" );
+
+		for( entry_index = 0;
+		     ( entry_index < number_of_used_chunks )
+		  && ( entry_index < EXPORT_HANDLE_MAXIMUM_NUMBER_OF_DECODE_PROFILE_ENTRIES );
+		     entry_index++ )
+		{
+			chunk_index = (int) chunks[ ( entry_index * 2 ) + 1 ];
+
+			if( libevtx_file_get_decode_profile_chunk_values(
+			     export_handle->input_file,
+			     chunk_index,
+			     values,
+			     LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve decode profile chunk: %d values.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "\t%d\t%" PRIu64 "\t%" PRIu64 ".%03" PRIu64 "\t%" PRIu64 ".%03" PRIu64 "\t%" PRIu64 "\t%" PRIu64 "\n",
+			 chunk_index,
+			 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ],
+			 values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ] / 1000000,
+			 ( values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ] / 1000 ) % 1000,
+			 values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ] / 1000000,
+			 ( values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ] / 1000 ) % 1000,
+			 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ],
+			 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_ALLOCATIONS ] );
 		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "\n" );
+
+		memory_free(
+		 chunks );
 	}
-	if( ( result_records != 0 )
-	 || ( result_recovered_records != 0 ) )
+	return( 1 );
+
+on_error:
+	if( chunks != NULL )
 	{
-		return( 1 );
+		memory_free(
+		 chunks );
 	}
-	return( 0 );
+	return( -1 );
 }
 
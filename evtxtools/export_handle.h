@@ -26,12 +26,27 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "chunk_sampler.h"
+#include "event_message_cache.h"
+#include "evtxtools_libbfio.h"
 #include "evtxtools_libcerror.h"
+#include "evtxtools_libcthreads.h"
 #include "evtxtools_libevtx.h"
+#include "export_checkpoint.h"
+#include "export_timings.h"
+#include "filetime_formatter.h"
 #include "log_handle.h"
+#include "message_catalog.h"
 #include "message_handle.h"
 #include "message_string.h"
-#include "resource_file.h"
+#include "numa_topology.h"
+#include "output_writer.h"
+#include "partition_writer.h"
+#include "provider_fields.h"
+#include "record_batch.h"
+#include "record_batch_queue.h"
+#include "record_hash_set.h"
+#include "template_definition_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -44,13 +59,68 @@ enum EXPORT_MODES
 	EXPORT_MODE_RECOVERED			= (int) 'r'
 };
 
+enum EXPORT_SCRATCH_STRINGS
+{
+	EXPORT_SCRATCH_STRING_VALUE		= 0,
+	EXPORT_SCRATCH_STRING_PROVIDER_IDENTIFIER,
+	EXPORT_SCRATCH_STRING_SOURCE_NAME
+};
+
 enum EXPORT_FORMATS
 {
+	EXPORT_FORMAT_BODYFILE			= (int) 'b',
+	EXPORT_FORMAT_CSV			= (int) 'c',
+	EXPORT_FORMAT_ES_BULK			= (int) 'e',
+	EXPORT_FORMAT_JSON			= (int) 'j',
+	EXPORT_FORMAT_L2T_CSV			= (int) 'l',
+	EXPORT_FORMAT_NDJSON			= (int) 'n',
+	EXPORT_FORMAT_PROTOBUF			= (int) 'p',
 	EXPORT_FORMAT_TEXT			= (int) 't',
 	EXPORT_FORMAT_XML			= (int) 'x'
 };
 
+/* The number of scratch strings of the text export
+ */
+#define EXPORT_HANDLE_NUMBER_OF_SCRATCH_STRINGS		3
+
+/* The FILETIME of January 1, 1970 00:00:00 UTC, the epoch of the bodyfile times
+ */
+#define EXPORT_HANDLE_FILETIME_POSIX_EPOCH		(uint64_t) 116444736000000000ULL
+
+/* The maximum number of export threads
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The number of records in a batch of a parallel export
+ * This is about the number of records in a chunk
+ */
+#define EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_BATCH	128
+
+/* The number of batches per thread of a parallel export
+ * The rendered batches that are not written yet are limited to this number
+ */
+#define EXPORT_HANDLE_NUMBER_OF_BATCHES_PER_THREAD	4
+
+/* The maximum number of shards the output can be split into
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS		64
+
+/* The maximum number of cached resource files
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_CACHED_RESOURCE_FILES	4096
+
+/* The interval, in seconds, the input file is checked for new records in follow mode
+ */
+#define EXPORT_HANDLE_FOLLOW_INTERVAL			1
+
+/* The maximum flush interval of the output in seconds
+ */
+#define EXPORT_HANDLE_MAXIMUM_FLUSH_INTERVAL		3600
+
 typedef struct export_handle export_handle_t;
+typedef struct export_handle_worker export_handle_worker_t;
+typedef struct export_handle_shard export_handle_shard_t;
+typedef struct export_handle_carve_context export_handle_carve_context_t;
 
 struct export_handle
 {
@@ -62,10 +132,58 @@ struct export_handle
 	 */
 	uint8_t export_format;
 
+	/* Value to indicate the XML is written without indentation
+	 * with every record on a single line
+	 */
+	uint8_t compact_xml;
+
+	/* Value to indicate the Protocol Buffers records contain the raw record data
+	 */
+	uint8_t protobuf_raw_data;
+
 	/* The libevtx input file
 	 */
 	libevtx_file_t *input_file;
 
+	/* The input filename
+	 */
+	const system_character_t *input_filename;
+
+	/* The compressed input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The libevtx carver
+	 * Only set while the input is carved
+	 */
+	libevtx_carver_t *carver;
+
+	/* The libevtx collection
+	 * Only set while the inputs are merged
+	 */
+	libevtx_collection_t *collection;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate the number of threads and read parameters
+	 * are tuned when the input is opened
+	 */
+	uint8_t auto_tuning;
+
+	/* The number of shards the output is split into, 0 represents no sharding
+	 */
+	int number_of_shards;
+
+	/* The compression method of the output file
+	 */
+	int output_compression_method;
+
+	/* The compression level of the output file, 0 represents the default level
+	 */
+	int output_compression_level;
+
 	/* The message handle
 	 */
 	message_handle_t *message_handle;
@@ -78,10 +196,105 @@ struct export_handle
 	 */
 	int use_template_definition;
 
+	/* The template definition cache
+	 */
+	template_definition_cache_t *template_definition_cache;
+
+	/* The event message cache
+	 */
+	event_message_cache_t *event_message_cache;
+
+	/* The FILETIME formatter
+	 */
+	filetime_formatter_t *filetime_formatter;
+
 	/* Value to indicate the input is open
 	 */
 	int input_is_open;
 
+	/* Value to indicate the input file should be followed for new records
+	 */
+	int follow;
+
+	/* Value to indicate the input file should be opened with lazy access
+	 * which only reads the chunk headers to determine the records
+	 */
+	int lazy;
+
+	/* Value to indicate the input file is actively written and should be opened
+	 * with live access, which re-reads the chunks until they are consistent
+	 */
+	int live;
+
+	/* Value to indicate the decode cost of the records of the input file
+	 * should be profiled
+	 */
+	int decode_profiling;
+
+	/* Value to indicate the message handle should be preloaded
+	 */
+	int preload;
+
+	/* Value to indicate the export threads are bound to the NUMA nodes
+	 */
+	int numa_affinity;
+
+	/* The record identifier after which records are exported
+	 */
+	uint64_t since_record_identifier;
+
+	/* Value to indicate the since record identifier is set
+	 */
+	int since_record_identifier_is_set;
+
+	/* The written time, as a FILETIME, after which records are exported
+	 */
+	uint64_t since_written_time;
+
+	/* Value to indicate the since written time is set
+	 */
+	int since_written_time_is_set;
+
+	/* The number of records that are skipped before records are exported
+	 */
+	int record_offset;
+
+	/* The maximum number of records to export, 0 represents all records
+	 */
+	int maximum_number_of_records;
+
+	/* Value to indicate the records should be exported newest first
+	 */
+	int newest_first;
+
+	/* The record filter, containing the compiled filter expression
+	 */
+	libevtx_record_filter_t *record_filter;
+
+	/* The chunk sampler
+	 * Contains NULL if the records of all chunks are exported
+	 */
+	chunk_sampler_t *chunk_sampler;
+
+	/* The record hash set, containing the content hashes of the exported records
+	 * Only set when duplicate records are skipped
+	 */
+	record_hash_set_t *record_hash_set;
+
+	/* The number of duplicate records that were skipped
+	 */
+	int number_of_duplicate_records;
+
+	/* The export checkpoint, containing the position up to which the records were exported
+	 * Only set when the export can be resumed
+	 */
+	export_checkpoint_t *checkpoint;
+
+	/* The export timings
+	 * Only set when the time spent per phase is measured
+	 */
+	export_timings_t *timings;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
@@ -90,6 +303,58 @@ struct export_handle
 	 */
 	FILE *notify_stream;
 
+	/* The output writer
+	 * Buffers the exported records before they are written to stdout or the output file
+	 */
+	output_writer_t *output_writer;
+
+	/* The partition granularity
+	 */
+	int partition_granularity;
+
+	/* The partition writer
+	 * Only set when the records are written to time partitioned output files
+	 */
+	partition_writer_t *partition_writer;
+
+	/* The output writer that is restored when the partitioned output is closed
+	 */
+	output_writer_t *unpartitioned_output_writer;
+
+	/* Value to indicate a partition is selected
+	 */
+	int partition_is_selected;
+
+	/* The first FILETIME of the selected partition
+	 */
+	uint64_t partition_first_filetime;
+
+	/* The last FILETIME of the selected partition
+	 */
+	uint64_t partition_last_filetime;
+
+	/* The JSON value string
+	 * Reused between the values that are written
+	 */
+	uint8_t *json_value_string;
+
+	/* The JSON value string size
+	 */
+	size_t json_value_string_size;
+
+	/* The scratch strings
+	 * Reused between the records that are exported in the text format
+	 */
+	system_character_t *scratch_strings[ EXPORT_HANDLE_NUMBER_OF_SCRATCH_STRINGS ];
+
+	/* The scratch string sizes
+	 */
+	size_t scratch_string_sizes[ EXPORT_HANDLE_NUMBER_OF_SCRATCH_STRINGS ];
+
+	/* The number of records written in the JSON array
+	 */
+	int number_of_json_records;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -99,6 +364,119 @@ struct export_handle
 	int verbose;
 };
 
+struct export_handle_worker
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The libevtx input file of the worker
+	 */
+	libevtx_file_t *input_file;
+
+	/* Value to indicate the input file of the worker is open
+	 */
+	int input_is_open;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The NUMA topology, set if the worker is bound to a node
+	 */
+	numa_topology_t *numa_topology;
+
+	/* The index of the NUMA node the worker is bound to
+	 */
+	int numa_node_index;
+
+	/* The queue of the record batches to render
+	 */
+	record_batch_queue_t *free_queue;
+
+	/* The queue of the rendered record batches to write
+	 */
+	record_batch_queue_t *output_queue;
+
+	/* The result of the worker
+	 */
+	int result;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+};
+
+struct export_handle_shard
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The libevtx input file of the shard
+	 */
+	libevtx_file_t *input_file;
+
+	/* Value to indicate the input file of the shard is open
+	 */
+	int input_is_open;
+
+	/* Value to indicate the input file of the shard is the input file of the export handle
+	 */
+	int input_is_shared;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The output writer of the shard
+	 */
+	output_writer_t *output_writer;
+
+	/* The output filename of the shard
+	 */
+	system_character_t *output_filename;
+
+	/* The index of the first record to export
+	 */
+	int first_record_index;
+
+	/* The number of records to export
+	 */
+	int number_of_records;
+
+	/* The total number of records in the input file
+	 */
+	int total_number_of_records;
+
+	/* The result of the shard
+	 */
+	int result;
+
+	/* The error of the shard
+	 */
+	libcerror_error_t *error;
+};
+
+struct export_handle_carve_context
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+
+	/* The error of the export of a carved record
+	 */
+	libcerror_error_t *error;
+};
+
 const char *export_handle_get_event_log_key_name(
              int event_log_type );
 
@@ -127,6 +505,119 @@ int export_handle_set_export_format(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_output_compression(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_shards(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_copy_decimal_string_to_uint64(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int export_handle_set_flush_interval(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_since_record_identifier(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_since_written_time(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_record_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_maximum_number_of_records(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_sample(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_filter_expression(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_append_search_string(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_append_match_value(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_clear_record_selection(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_deduplicate(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_checkpoint_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_write_checkpoint(
+     export_handle_t *export_handle,
+     int export_index,
+     libcerror_error_t **error );
+
+int export_handle_remove_checkpoint_file(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_partition_granularity(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_timings_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_is_duplicate_record_content_hash(
+     export_handle_t *export_handle,
+     uint64_t content_hash,
+     libcerror_error_t **error );
+
+int export_handle_set_maximum_number_of_cached_resource_files(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_message_catalog(
+     export_handle_t *export_handle,
+     message_catalog_t *message_catalog,
+     int message_catalog_mode,
+     libcerror_error_t **error );
+
 int export_handle_set_ascii_codepage(
      export_handle_t *export_handle,
      const system_character_t *string,
@@ -167,28 +658,68 @@ int export_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int export_handle_open_message_handle_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 int export_handle_open_input(
      export_handle_t *export_handle,
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int export_handle_open_input_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_get_tuned_read_parameters(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 int export_handle_close_input(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
-/* Record specific export functions
- */
-int export_handle_guid_string_copy_to_byte_stream(
+int export_handle_close_input_file(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_open_output_stream(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int export_handle_get_output_file_extension(
+     export_handle_t *export_handle,
+     const system_character_t **extension,
+     const system_character_t **compression_extension,
+     libcerror_error_t **error );
+
+int export_handle_open_partitioned_output(
+     export_handle_t *export_handle,
+     const system_character_t *directory_name,
+     libcerror_error_t **error );
+
+int export_handle_select_partition(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_close_output(
      export_handle_t *export_handle,
-     const system_character_t *string,
-     size_t string_length,
-     uint8_t *byte_stream,
-     size_t byte_stream_size,
      libcerror_error_t **error );
 
-int export_handle_resource_file_get_template_definition(
+/* Record specific export functions
+ */
+int export_handle_get_template_definition(
      export_handle_t *export_handle,
-     resource_file_t *resource_file,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
      const uint8_t *provider_identifier,
      size_t provider_identifier_size,
      uint32_t event_identifier,
@@ -201,6 +732,25 @@ int export_handle_message_string_fprint(
      libevtx_record_t *record,
      libcerror_error_t **error );
 
+int export_handle_get_event_message_cache_entry(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     event_message_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+int export_handle_get_scratch_string(
+     export_handle_t *export_handle,
+     int scratch_string_index,
+     size_t string_size,
+     system_character_t **string,
+     libcerror_error_t **error );
+
 int export_handle_export_record_event_message(
      export_handle_t *export_handle,
      libevtx_record_t *record,
@@ -218,20 +768,254 @@ int export_handle_export_record(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_get_record_event_source(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     system_character_t **provider_identifier,
+     size_t *provider_identifier_size,
+     system_character_t **source_name,
+     size_t *source_name_size,
+     libcerror_error_t **error );
+
 int export_handle_export_record_text(
      export_handle_t *export_handle,
      libevtx_record_t *record,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_compact_xml_string(
+     system_character_t **xml_string,
+     size_t *xml_string_size,
+     libcerror_error_t **error );
+
+int export_handle_get_record_xml_string(
+     libevtx_record_t *record,
+     uint8_t compact_xml,
+     system_character_t **event_xml,
+     size_t *event_xml_size,
+     libcerror_error_t **error );
+
 int export_handle_export_record_xml(
      export_handle_t *export_handle,
      libevtx_record_t *record,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_get_record_written_time_string(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int export_handle_get_json_value_string(
+     export_handle_t *export_handle,
+     size_t value_string_size,
+     libcerror_error_t **error );
+
+int export_handle_write_json_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const char *name,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     libcerror_error_t **error );
+
+int export_handle_get_provider_fields_definition(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const provider_fields_definition_t **fields_definition,
+     libcerror_error_t **error );
+
+int export_handle_write_json_field_value(
+     export_handle_t *export_handle,
+     int field_type,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int export_handle_write_json_record_event_data(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const char *prefix,
+     libcerror_error_t **error );
+
+int export_handle_export_record_json(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_write_es_bulk_record_event_data(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_export_record_es_bulk(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_write_protobuf_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     uint32_t field_number,
+     const char *name,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     libcerror_error_t **error );
+
+int export_handle_write_protobuf_optional_value(
+     export_handle_t *export_handle,
+     uint32_t field_number,
+     int result,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int export_handle_write_protobuf_record_event_data(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_export_record_protobuf(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_write_csv_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     libcerror_error_t **error );
+
+int export_handle_export_record_csv(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_write_timeline_record_value(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     int (*get_value_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_value)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     uint8_t separator,
+     libcerror_error_t **error );
+
+int export_handle_write_timeline_message(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     uint32_t event_identifier,
+     uint8_t separator,
+     libcerror_error_t **error );
+
+int export_handle_export_record_bodyfile(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_export_record_l2t_csv(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+/* Parallel export functions
+ */
+int export_handle_open_worker_input_file(
+     export_handle_t *export_handle,
+     libevtx_file_t *input_file,
+     libcerror_error_t **error );
+
+int export_handle_worker_export_record_batch(
+     export_handle_worker_t *worker,
+     record_batch_t *record_batch );
+
+int export_handle_worker_export_records(
+     export_handle_worker_t *worker );
+
+int export_handle_write_record_batch(
+     export_handle_t *export_handle,
+     record_batch_t *record_batch,
+     libcerror_error_t **error );
+
+int export_handle_export_records_parallel(
+     export_handle_t *export_handle,
+     int first_record_index,
+     int number_of_records,
+     libcerror_error_t **error );
+
+int export_handle_get_shard_output_filename(
+     export_handle_t *export_handle,
+     const system_character_t *output_filename,
+     int shard_index,
+     system_character_t **shard_output_filename,
+     size_t *shard_output_filename_size,
+     libcerror_error_t **error );
+
+int export_handle_shard_export_records(
+     export_handle_shard_t *shard );
+
+int export_handle_export_shards(
+     export_handle_t *export_handle,
+     const system_character_t *output_filename,
+     libcerror_error_t **error );
+
 /* File export functions
  */
+int export_handle_export_record_by_index(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     int record_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_first_record_index_since(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     int *record_index,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int export_handle_limit_records(
+     export_handle_t *export_handle,
+     int total_number_of_records,
+     int *first_record_index,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int export_handle_export_sampled_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_records(
      export_handle_t *export_handle,
      libevtx_file_t *file,
@@ -244,11 +1028,98 @@ int export_handle_export_recovered_records(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_follow_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_write_start_of_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_write_end_of_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_input_records(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_file(
      export_handle_t *export_handle,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_resident_file(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     const system_character_t *filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_carved_record(
+     libevtx_record_t *record,
+     void *user_data );
+
+int export_handle_carve_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_merge_input(
+     export_handle_t *export_handle,
+     const system_character_t * const *filenames,
+     int number_of_filenames,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_batch_output_filename(
+     export_handle_t *export_handle,
+     const system_character_t *input_filename,
+     const system_character_t *output_directory_name,
+     system_character_t **output_filename,
+     size_t *output_filename_size,
+     libcerror_error_t **error );
+
+int export_handle_export_batch_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     const system_character_t *output_directory_name,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_batch(
+     export_handle_t *export_handle,
+     const system_character_t * const *filenames,
+     int number_of_filenames,
+     const system_character_t *output_directory_name,
+     uint8_t event_log_type_from_filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_statistics_fprint(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_timings_fprint(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_decode_profile_chunk_compare(
+     const void *first_chunk,
+     const void *second_chunk );
+
+void export_handle_guid_fprint(
+      FILE *stream,
+      const uint8_t *guid );
+
+int export_handle_decode_profile_fprint(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,536 @@
+/*
+ * Export timings
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "export_timings.h"
+
+/* The names of the phases as printed in the summary
+ */
+static const char *export_timings_phase_names[ EXPORT_TIMINGS_NUMBER_OF_PHASES ] = {
+	"read",
+	"decode",
+	"message",
+	"format",
+	"output" };
+
+/* Creates export timings
+ * Make sure the value export_timings is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_initialize(
+     export_timings_t **export_timings,
+     int format,
+     libcerror_error_t **error )
+{
+	static char *function = "export_timings_initialize";
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_timings != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export timings value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != EXPORT_TIMINGS_FORMAT_JSON )
+	 && ( format != EXPORT_TIMINGS_FORMAT_TEXT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*export_timings = memory_allocate_structure(
+	                   export_timings_t );
+
+	if( *export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export timings.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *export_timings,
+	     0,
+	     sizeof( export_timings_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export timings.",
+		 function );
+
+		memory_free(
+		 *export_timings );
+
+		*export_timings = NULL;
+
+		return( -1 );
+	}
+	( *export_timings )->format = format;
+
+	return( 1 );
+}
+
+/* Frees export timings
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_free(
+     export_timings_t **export_timings,
+     libcerror_error_t **error )
+{
+	static char *function = "export_timings_free";
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_timings != NULL )
+	{
+		memory_free(
+		 *export_timings );
+
+		*export_timings = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in nano seconds
+ * Returns the time or 0 if no monotonic clock is available
+ */
+uint64_t export_timings_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	      + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Marks the start of the export
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_start(
+     export_timings_t *export_timings,
+     libcerror_error_t **error )
+{
+	static char *function = "export_timings_start";
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	export_timings->start_time = export_timings_get_time();
+
+	return( 1 );
+}
+
+/* Marks the end of the export and adds its duration to the total time
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_stop(
+     export_timings_t *export_timings,
+     libcerror_error_t **error )
+{
+	static char *function = "export_timings_stop";
+	uint64_t end_time     = 0;
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	end_time = export_timings_get_time();
+
+	if( end_time > export_timings->start_time )
+	{
+		export_timings->total_time += end_time - export_timings->start_time;
+	}
+	export_timings->start_time = 0;
+
+	return( 1 );
+}
+
+/* Adds the time elapsed since the start time to a phase
+ * The nested time, that was already accounted to other phases, is not added
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_add_phase_time(
+     export_timings_t *export_timings,
+     int phase,
+     uint64_t start_time,
+     uint64_t nested_time,
+     libcerror_error_t **error )
+{
+	static char *function = "export_timings_add_phase_time";
+	uint64_t elapsed_time = 0;
+	uint64_t end_time     = 0;
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( phase < 0 )
+	 || ( phase >= EXPORT_TIMINGS_NUMBER_OF_PHASES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid phase value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	end_time = export_timings_get_time();
+
+	if( end_time > start_time )
+	{
+		elapsed_time = end_time - start_time;
+	}
+	if( elapsed_time > nested_time )
+	{
+		export_timings->phase_times[ phase ] += elapsed_time - nested_time;
+	}
+	return( 1 );
+}
+
+/* Adds an exported record
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_add_record(
+     export_timings_t *export_timings,
+     uint32_t record_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_timings_add_record";
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	export_timings->number_of_records += 1;
+	export_timings->number_of_bytes   += record_size;
+
+	return( 1 );
+}
+
+/* Sets the read parameters that were chosen when the input was opened
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_set_read_parameters(
+     export_timings_t *export_timings,
+     int number_of_threads,
+     int read_ahead_depth,
+     size_t coalesced_read_size,
+     uint64_t chunk_read_time,
+     uint64_t chunk_decode_time,
+     libcerror_error_t **error )
+{
+	static char *function = "export_timings_set_read_parameters";
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	export_timings->has_read_parameters = 1;
+	export_timings->number_of_threads   = number_of_threads;
+	export_timings->read_ahead_depth    = read_ahead_depth;
+	export_timings->coalesced_read_size = coalesced_read_size;
+	export_timings->chunk_read_time     = chunk_read_time;
+	export_timings->chunk_decode_time   = chunk_decode_time;
+
+	return( 1 );
+}
+
+/* Prints a summary of the export timings to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_timings_fprint(
+     export_timings_t *export_timings,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_timings_fprint";
+	double megabytes_per_second  = 0.0;
+	double percentage            = 0.0;
+	double records_per_second    = 0.0;
+	double total_time_in_seconds = 0.0;
+	int phase                    = 0;
+
+	if( export_timings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export timings.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_timings->total_time > 0 )
+	{
+		total_time_in_seconds = (double) export_timings->total_time / 1000000000.0;
+		records_per_second    = (double) export_timings->number_of_records / total_time_in_seconds;
+		megabytes_per_second  = ( (double) export_timings->number_of_bytes / ( 1024.0 * 1024.0 ) ) / total_time_in_seconds;
+	}
+	if( export_timings->format == EXPORT_TIMINGS_FORMAT_JSON )
+	{
+		fprintf(
+		 stream,
+		 "{\"number_of_records\": %" PRIu64 ", \"number_of_bytes\": %" PRIu64 ", \"total_time\": %" PRIu64 ", \"records_per_second\": %.2f, \"megabytes_per_second\": %.2f, ",
+		 export_timings->number_of_records,
+		 export_timings->number_of_bytes,
+		 export_timings->total_time,
+		 records_per_second,
+		 megabytes_per_second );
+
+		if( export_timings->has_read_parameters != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\"read_parameters\": {\"number_of_threads\": %d, \"read_ahead_depth\": %d, \"coalesced_read_size\": %" PRIzu ", \"chunk_read_time\": %" PRIu64 ", \"chunk_decode_time\": %" PRIu64 "}, ",
+			 export_timings->number_of_threads,
+			 export_timings->read_ahead_depth,
+			 export_timings->coalesced_read_size,
+			 export_timings->chunk_read_time,
+			 export_timings->chunk_decode_time );
+		}
+		fprintf(
+		 stream,
+		 "\"phases\": {" );
+
+		for( phase = 0;
+		     phase < EXPORT_TIMINGS_NUMBER_OF_PHASES;
+		     phase++ )
+		{
+			fprintf(
+			 stream,
+			 "%s\"%s\": %" PRIu64 "",
+			 ( phase == 0 ) ? "" : ", ",
+			 export_timings_phase_names[ phase ],
+			 export_timings->phase_times[ phase ] );
+		}
+		fprintf(
+		 stream,
+		 "}}\n" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "Timings:\n" );
+
+		fprintf(
+		 stream,
+		 "\tNumber of records\t\t: %" PRIu64 "\n",
+		 export_timings->number_of_records );
+
+		fprintf(
+		 stream,
+		 "\tNumber of bytes\t\t\t: %" PRIu64 "\n",
+		 export_timings->number_of_bytes );
+
+		fprintf(
+		 stream,
+		 "\tTotal time\t\t\t: %" PRIu64 " ns\n",
+		 export_timings->total_time );
+
+		fprintf(
+		 stream,
+		 "\tRecords per second\t\t: %.2f\n",
+		 records_per_second );
+
+		fprintf(
+		 stream,
+		 "\tMegabytes per second\t\t: %.2f\n",
+		 megabytes_per_second );
+
+		if( export_timings->has_read_parameters != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\tNumber of threads\t\t: %d\n",
+			 export_timings->number_of_threads );
+
+			fprintf(
+			 stream,
+			 "\tRead-ahead depth\t\t: %d\n",
+			 export_timings->read_ahead_depth );
+
+			fprintf(
+			 stream,
+			 "\tCoalesced read size\t\t: %" PRIzu "\n",
+			 export_timings->coalesced_read_size );
+
+			fprintf(
+			 stream,
+			 "\tChunk read time\t\t\t: %" PRIu64 " ns\n",
+			 export_timings->chunk_read_time );
+
+			fprintf(
+			 stream,
+			 "\tChunk decode time\t\t: %" PRIu64 " ns\n",
+			 export_timings->chunk_decode_time );
+		}
+
+		for( phase = 0;
+		     phase < EXPORT_TIMINGS_NUMBER_OF_PHASES;
+		     phase++ )
+		{
+			percentage = 0.0;
+
+			if( export_timings->total_time > 0 )
+			{
+				percentage = ( (double) export_timings->phase_times[ phase ] * 100.0 ) / (double) export_timings->total_time;
+			}
+			fprintf(
+			 stream,
+			 "\tTime %s\t\t\t: %" PRIu64 " ns (%.1f%%)\n",
+			 export_timings_phase_names[ phase ],
+			 export_timings->phase_times[ phase ],
+			 percentage );
+		}
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,157 @@
+/*
+ * Export timings
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _EXPORT_TIMINGS_H )
+#define _EXPORT_TIMINGS_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum EXPORT_TIMINGS_PHASES
+{
+	EXPORT_TIMINGS_PHASE_READ		= 0,
+	EXPORT_TIMINGS_PHASE_DECODE		= 1,
+	EXPORT_TIMINGS_PHASE_MESSAGE		= 2,
+	EXPORT_TIMINGS_PHASE_FORMAT		= 3,
+	EXPORT_TIMINGS_PHASE_OUTPUT		= 4,
+
+	EXPORT_TIMINGS_NUMBER_OF_PHASES		= 5
+};
+
+enum EXPORT_TIMINGS_FORMATS
+{
+	EXPORT_TIMINGS_FORMAT_JSON		= (int) 'j',
+	EXPORT_TIMINGS_FORMAT_TEXT		= (int) 't'
+};
+
+typedef struct export_timings export_timings_t;
+
+struct export_timings
+{
+	/* The format the timings are printed in
+	 */
+	int format;
+
+	/* The time spent per phase in nano seconds
+	 */
+	uint64_t phase_times[ EXPORT_TIMINGS_NUMBER_OF_PHASES ];
+
+	/* The time the export was started
+	 */
+	uint64_t start_time;
+
+	/* The total time of the export in nano seconds
+	 */
+	uint64_t total_time;
+
+	/* The number of records
+	 */
+	uint64_t number_of_records;
+
+	/* The number of bytes of the records
+	 */
+	uint64_t number_of_bytes;
+
+	/* Value to indicate the read parameters were set
+	 */
+	uint8_t has_read_parameters;
+
+	/* The number of threads used to read the records
+	 */
+	int number_of_threads;
+
+	/* The number of chunks read ahead
+	 */
+	int read_ahead_depth;
+
+	/* The size of the coalesced reads
+	 */
+	size_t coalesced_read_size;
+
+	/* The measured time of a single chunk read in nano seconds
+	 */
+	uint64_t chunk_read_time;
+
+	/* The measured time per chunk read and parsed by a single thread in nano seconds
+	 */
+	uint64_t chunk_decode_time;
+};
+
+int export_timings_initialize(
+     export_timings_t **export_timings,
+     int format,
+     libcerror_error_t **error );
+
+int export_timings_free(
+     export_timings_t **export_timings,
+     libcerror_error_t **error );
+
+uint64_t export_timings_get_time(
+          void );
+
+int export_timings_start(
+     export_timings_t *export_timings,
+     libcerror_error_t **error );
+
+int export_timings_stop(
+     export_timings_t *export_timings,
+     libcerror_error_t **error );
+
+int export_timings_add_phase_time(
+     export_timings_t *export_timings,
+     int phase,
+     uint64_t start_time,
+     uint64_t nested_time,
+     libcerror_error_t **error );
+
+int export_timings_add_record(
+     export_timings_t *export_timings,
+     uint32_t record_size,
+     libcerror_error_t **error );
+
+int export_timings_set_read_parameters(
+     export_timings_t *export_timings,
+     int number_of_threads,
+     int read_ahead_depth,
+     size_t coalesced_read_size,
+     uint64_t chunk_read_time,
+     uint64_t chunk_decode_time,
+     libcerror_error_t **error );
+
+int export_timings_fprint(
+     export_timings_t *export_timings,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_TIMINGS_H ) */
+
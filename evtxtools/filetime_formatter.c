@@ -0,0 +1,417 @@
+/*
+ * FILETIME formatter
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "filetime_formatter.h"
+
+/* The number of FILETIME intervals of 100 nano seconds in a day
+ */
+#define FILETIME_FORMATTER_INTERVALS_PER_DAY	(uint64_t) 864000000000UL
+
+/* The number of days between January 1, 0000 (proleptic Gregorian, March based) and January 1, 1601
+ */
+#define FILETIME_FORMATTER_DAYS_FROM_EPOCH	(uint64_t) 584694UL
+
+/* The decimal digit pairs 00 - 99
+ */
+static const char filetime_formatter_digit_pairs[ 201 ] = \
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/* The abbreviated month names
+ */
+static const char *filetime_formatter_month_names[ 12 ] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+	"Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+/* Creates a FILETIME formatter
+ * Make sure the value filetime_formatter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int filetime_formatter_initialize(
+     filetime_formatter_t **filetime_formatter,
+     libcerror_error_t **error )
+{
+	static char *function = "filetime_formatter_initialize";
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filetime_formatter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid FILETIME formatter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*filetime_formatter = memory_allocate_structure(
+	                       filetime_formatter_t );
+
+	if( *filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create FILETIME formatter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *filetime_formatter,
+	     0,
+	     sizeof( filetime_formatter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear FILETIME formatter.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *filetime_formatter != NULL )
+	{
+		memory_free(
+		 *filetime_formatter );
+
+		*filetime_formatter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a FILETIME formatter
+ * Returns 1 if successful or -1 on error
+ */
+int filetime_formatter_free(
+     filetime_formatter_t **filetime_formatter,
+     libcerror_error_t **error )
+{
+	static char *function = "filetime_formatter_free";
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filetime_formatter != NULL )
+	{
+		memory_free(
+		 *filetime_formatter );
+
+		*filetime_formatter = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the cached date from the number of days since January 1, 1601
+ * Returns 1 if successful or -1 on error
+ */
+int filetime_formatter_set_date(
+     filetime_formatter_t *filetime_formatter,
+     uint64_t number_of_days,
+     libcerror_error_t **error )
+{
+	static char *function = "filetime_formatter_set_date";
+	uint64_t day_of_era   = 0;
+	uint64_t day_of_year  = 0;
+	uint64_t days         = 0;
+	uint64_t era          = 0;
+	uint64_t month_index  = 0;
+	uint64_t year         = 0;
+	uint64_t year_of_era  = 0;
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	/* The date is calculated in 400 year eras of 146097 days
+	 * where the year starts on March 1 so the leap day is the last day of the year
+	 */
+	days        = number_of_days + FILETIME_FORMATTER_DAYS_FROM_EPOCH;
+	era         = days / 146097;
+	day_of_era  = days - ( era * 146097 );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+	month_index = ( ( 5 * day_of_year ) + 2 ) / 153;
+	year        = year_of_era + ( era * 400 );
+
+	if( month_index >= 10 )
+	{
+		year += 1;
+	}
+	/* The string formats only support 4 digit years
+	 */
+	if( year > 9999 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported year value.",
+		 function );
+
+		return( -1 );
+	}
+	filetime_formatter->number_of_days = number_of_days;
+	filetime_formatter->year           = (uint16_t) year;
+	filetime_formatter->day_of_month   = (uint8_t) ( day_of_year - ( ( ( 153 * month_index ) + 2 ) / 5 ) + 1 );
+
+	if( month_index < 10 )
+	{
+		filetime_formatter->month = (uint8_t) ( month_index + 3 );
+	}
+	else
+	{
+		filetime_formatter->month = (uint8_t) ( month_index - 9 );
+	}
+	filetime_formatter->date_is_set = 1;
+
+	return( 1 );
+}
+
+/* Copies a FILETIME to an UTF-8 encoded string
+ * The date is cached since consecutive records mostly share the same day
+ * Returns 1 if successful or -1 on error
+ */
+int filetime_formatter_copy_to_utf8_string(
+     filetime_formatter_t *filetime_formatter,
+     uint64_t filetime,
+     uint8_t format_type,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	const char *month_name  = NULL;
+	static char *function   = "filetime_formatter_copy_to_utf8_string";
+	size_t string_index     = 0;
+	uint64_t number_of_days = 0;
+	uint64_t time_of_day    = 0;
+	uint32_t fraction       = 0;
+	uint32_t seconds_of_day = 0;
+	uint8_t hours           = 0;
+	uint8_t minutes         = 0;
+	uint8_t seconds         = 0;
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format_type != FILETIME_FORMATTER_FORMAT_TYPE_CTIME )
+	 && ( format_type != FILETIME_FORMATTER_FORMAT_TYPE_ISO8601 )
+	 && ( format_type != FILETIME_FORMATTER_FORMAT_TYPE_L2T_CSV ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format type.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < FILETIME_FORMATTER_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_days = filetime / FILETIME_FORMATTER_INTERVALS_PER_DAY;
+	time_of_day    = filetime % FILETIME_FORMATTER_INTERVALS_PER_DAY;
+
+	if( ( filetime_formatter->date_is_set == 0 )
+	 || ( filetime_formatter->number_of_days != number_of_days ) )
+	{
+		if( filetime_formatter_set_date(
+		     filetime_formatter,
+		     number_of_days,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set date.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	seconds_of_day = (uint32_t) ( time_of_day / 10000000 );
+	fraction       = (uint32_t) ( time_of_day % 10000000 );
+	hours          = (uint8_t) ( seconds_of_day / 3600 );
+	minutes        = (uint8_t) ( ( seconds_of_day / 60 ) % 60 );
+	seconds        = (uint8_t) ( seconds_of_day % 60 );
+
+	if( format_type == FILETIME_FORMATTER_FORMAT_TYPE_L2T_CSV )
+	{
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ filetime_formatter->month * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->month * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) '/';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ filetime_formatter->day_of_month * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->day_of_month * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) '/';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->year / 100 ) * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( filetime_formatter->year / 100 ) * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->year % 100 ) * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( filetime_formatter->year % 100 ) * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) ',';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ hours * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( hours * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) ':';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ minutes * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( minutes * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) ':';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ seconds * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( seconds * 2 ) + 1 ];
+		utf8_string[ string_index ]   = 0;
+
+		return( 1 );
+	}
+	if( format_type == FILETIME_FORMATTER_FORMAT_TYPE_CTIME )
+	{
+		month_name = filetime_formatter_month_names[ filetime_formatter->month - 1 ];
+
+		utf8_string[ string_index++ ] = (uint8_t) month_name[ 0 ];
+		utf8_string[ string_index++ ] = (uint8_t) month_name[ 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) month_name[ 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) ' ';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ filetime_formatter->day_of_month * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->day_of_month * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) ',';
+		utf8_string[ string_index++ ] = (uint8_t) ' ';
+	}
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->year / 100 ) * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( filetime_formatter->year / 100 ) * 2 ) + 1 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->year % 100 ) * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( filetime_formatter->year % 100 ) * 2 ) + 1 ];
+
+	if( format_type == FILETIME_FORMATTER_FORMAT_TYPE_CTIME )
+	{
+		utf8_string[ string_index++ ] = (uint8_t) ' ';
+	}
+	else
+	{
+		utf8_string[ string_index++ ] = (uint8_t) '-';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ filetime_formatter->month * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->month * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) '-';
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ filetime_formatter->day_of_month * 2 ];
+		utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( filetime_formatter->day_of_month * 2 ) + 1 ];
+		utf8_string[ string_index++ ] = (uint8_t) 'T';
+	}
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ hours * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( hours * 2 ) + 1 ];
+	utf8_string[ string_index++ ] = (uint8_t) ':';
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ minutes * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( minutes * 2 ) + 1 ];
+	utf8_string[ string_index++ ] = (uint8_t) ':';
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ seconds * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( seconds * 2 ) + 1 ];
+	utf8_string[ string_index++ ] = (uint8_t) '.';
+
+	/* The fraction of 100 nano seconds is printed as 9 digits,
+	 * the last 2 digits are always 0
+	 */
+	utf8_string[ string_index++ ] = (uint8_t) ( '0' + ( fraction / 1000000 ) );
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( fraction / 10000 ) % 100 ) * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( ( fraction / 10000 ) % 100 ) * 2 ) + 1 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( fraction / 100 ) % 100 ) * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( ( fraction / 100 ) % 100 ) * 2 ) + 1 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( fraction % 100 ) * 2 ];
+	utf8_string[ string_index++ ] = (uint8_t) filetime_formatter_digit_pairs[ ( ( fraction % 100 ) * 2 ) + 1 ];
+	utf8_string[ string_index++ ] = (uint8_t) '0';
+	utf8_string[ string_index++ ] = (uint8_t) '0';
+
+	if( format_type == FILETIME_FORMATTER_FORMAT_TYPE_ISO8601 )
+	{
+		utf8_string[ string_index++ ] = (uint8_t) 'Z';
+	}
+	utf8_string[ string_index ] = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,107 @@
+/*
+ * FILETIME formatter
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FILETIME_FORMATTER_H )
+#define _FILETIME_FORMATTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a formatted FILETIME string including the end of string character
+ */
+#define FILETIME_FORMATTER_STRING_SIZE		32
+
+/* The FILETIME formatter format types
+ */
+enum FILETIME_FORMATTER_FORMAT_TYPES
+{
+	/* Mon DD, YYYY hh:mm:ss.nnnnnnnnn
+	 */
+	FILETIME_FORMATTER_FORMAT_TYPE_CTIME		= 1,
+
+	/* YYYY-MM-DDThh:mm:ss.nnnnnnnnnZ
+	 */
+	FILETIME_FORMATTER_FORMAT_TYPE_ISO8601		= 2,
+
+	/* MM/DD/YYYY,hh:mm:ss
+	 * The date and time are separate values of a log2timeline CSV line
+	 */
+	FILETIME_FORMATTER_FORMAT_TYPE_L2T_CSV		= 3
+};
+
+typedef struct filetime_formatter filetime_formatter_t;
+
+struct filetime_formatter
+{
+	/* The number of days since January 1, 1601 of the cached date
+	 */
+	uint64_t number_of_days;
+
+	/* The year of the cached date
+	 */
+	uint16_t year;
+
+	/* The month of the cached date
+	 */
+	uint8_t month;
+
+	/* The day of the month of the cached date
+	 */
+	uint8_t day_of_month;
+
+	/* Value to indicate the cached date is set
+	 */
+	uint8_t date_is_set;
+};
+
+int filetime_formatter_initialize(
+     filetime_formatter_t **filetime_formatter,
+     libcerror_error_t **error );
+
+int filetime_formatter_free(
+     filetime_formatter_t **filetime_formatter,
+     libcerror_error_t **error );
+
+int filetime_formatter_set_date(
+     filetime_formatter_t *filetime_formatter,
+     uint64_t number_of_days,
+     libcerror_error_t **error );
+
+int filetime_formatter_copy_to_utf8_string(
+     filetime_formatter_t *filetime_formatter,
+     uint64_t filetime,
+     uint8_t format_type,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FILETIME_FORMATTER_H ) */
+
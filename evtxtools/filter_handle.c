@@ -0,0 +1,580 @@
+/*
+ * Filter handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libevtx.h"
+#include "filter_handle.h"
+
+#define FILTER_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a filter handle
+ * Make sure the value filter_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_initialize(
+     filter_handle_t **filter_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_initialize";
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*filter_handle = memory_allocate_structure(
+	                  filter_handle_t );
+
+	if( *filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *filter_handle,
+	     0,
+	     sizeof( filter_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_initialize(
+	     &( ( *filter_handle )->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_filter_initialize(
+	     &( ( *filter_handle )->record_filter ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record filter.",
+		 function );
+
+		goto on_error;
+	}
+	( *filter_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
+	( *filter_handle )->notify_stream  = FILTER_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *filter_handle != NULL )
+	{
+		if( ( *filter_handle )->input_file != NULL )
+		{
+			libevtx_file_free(
+			 &( ( *filter_handle )->input_file ),
+			 NULL );
+		}
+		memory_free(
+		 *filter_handle );
+
+		*filter_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a filter handle
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_free(
+     filter_handle_t **filter_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_free";
+	int result            = 1;
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter_handle != NULL )
+	{
+		if( ( *filter_handle )->record_filter != NULL )
+		{
+			if( libevtx_record_filter_free(
+			     &( ( *filter_handle )->record_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *filter_handle )->input_file != NULL )
+		{
+			if( libevtx_file_free(
+			     &( ( *filter_handle )->input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *filter_handle );
+
+		*filter_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the filter handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_signal_abort(
+     filter_handle_t *filter_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_signal_abort";
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	filter_handle->abort = 1;
+
+	if( filter_handle->input_file != NULL )
+	{
+		if( libevtx_file_signal_abort(
+		     filter_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the ascii codepage
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_set_ascii_codepage(
+     filter_handle_t *filter_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "filter_handle_set_ascii_codepage";
+	size_t string_length   = 0;
+	uint32_t feature_flags = 0;
+	int result             = 0;
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
+	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
+
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libclocale_codepage_copy_from_string_wide(
+	          &( filter_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#else
+	result = libclocale_codepage_copy_from_string(
+	          &( filter_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the filter expression
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_set_filter_expression(
+     filter_handle_t *filter_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_set_filter_expression";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_filter_set_utf16_expression(
+	          filter_handle->record_filter,
+	          (uint16_t *) string,
+	          string_length,
+	          error );
+#else
+	result = libevtx_record_filter_set_utf8_expression(
+	          filter_handle->record_filter,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set expression in record filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a search string
+ * Only the records that contain one of the search strings are written
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_append_search_string(
+     filter_handle_t *filter_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_append_search_string";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_record_filter_append_utf16_search_string(
+	          filter_handle->record_filter,
+	          (uint16_t *) string,
+	          string_length,
+	          error );
+#else
+	result = libevtx_record_filter_append_utf8_search_string(
+	          filter_handle->record_filter,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append search string to record filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input of the filter handle
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_open(
+     filter_handle_t *filter_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_open";
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     filter_handle->input_file,
+	     filter_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     filter_handle->input_file,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     filter_handle->input_file,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the filter handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int filter_handle_close(
+     filter_handle_t *filter_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_close";
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_close(
+	     filter_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Writes the records of the input file that match the record filter to a new file
+ * Returns 1 if successful or -1 on error
+ */
+int filter_handle_write_filtered(
+     filter_handle_t *filter_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_handle_write_filtered";
+
+	if( filter_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_write_filtered_wide(
+	     filter_handle->input_file,
+	     filter_handle->record_filter,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libevtx_file_write_filtered(
+	     filter_handle->input_file,
+	     filter_handle->record_filter,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write filtered file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,107 @@
+/*
+ * Filter handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FILTER_HANDLE_H )
+#define _FILTER_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libevtx.h"
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct filter_handle filter_handle_t;
+
+struct filter_handle
+{
+	/* The libevtx input file
+	 */
+	libevtx_file_t *input_file;
+
+	/* The record filter
+	 */
+	libevtx_record_filter_t *record_filter;
+
+	/* The ascii codepage
+	 */
+	int ascii_codepage;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int filter_handle_initialize(
+     filter_handle_t **filter_handle,
+     libcerror_error_t **error );
+
+int filter_handle_free(
+     filter_handle_t **filter_handle,
+     libcerror_error_t **error );
+
+int filter_handle_signal_abort(
+     filter_handle_t *filter_handle,
+     libcerror_error_t **error );
+
+int filter_handle_set_ascii_codepage(
+     filter_handle_t *filter_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int filter_handle_set_filter_expression(
+     filter_handle_t *filter_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int filter_handle_append_search_string(
+     filter_handle_t *filter_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int filter_handle_open(
+     filter_handle_t *filter_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int filter_handle_close(
+     filter_handle_t *filter_handle,
+     libcerror_error_t **error );
+
+int filter_handle_write_filtered(
+     filter_handle_t *filter_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FILTER_HANDLE_H ) */
+
@@ -0,0 +1,1282 @@
+/*
+ * HTTP bulk sink functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "http_bulk_sink.h"
+#include "network_stream.h"
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+#endif
+
+/* Creates a HTTP bulk sink
+ * The address is of the form http://host[:port][/path], the path defaults to /_bulk
+ * Make sure the value http_bulk_sink is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_initialize(
+     http_bulk_sink_t **http_bulk_sink,
+     const system_character_t *address,
+     libcerror_error_t **error )
+{
+	http_bulk_sink_t *safe_http_bulk_sink = NULL;
+	const system_character_t *host        = NULL;
+	const system_character_t *path        = NULL;
+	static char *function                 = "http_bulk_sink_initialize";
+	size_t address_length                 = 0;
+	size_t host_length                    = 0;
+	size_t path_length                    = 0;
+	size_t string_index                   = 0;
+	int connection_index                  = 0;
+	int has_port                          = 0;
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+	if( *http_bulk_sink != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid HTTP bulk sink value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid address.",
+		 function );
+
+		return( -1 );
+	}
+	address_length = system_string_length(
+	                  address );
+
+	if( ( address_length <= 7 )
+	 || ( system_string_compare(
+	       address,
+	       _SYSTEM_STRING( "http://" ),
+	       7 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported address.",
+		 function );
+
+		return( -1 );
+	}
+	host = &( address[ 7 ] );
+
+	for( string_index = 7;
+	     string_index < address_length;
+	     string_index++ )
+	{
+		if( address[ string_index ] == (system_character_t) '/' )
+		{
+			path = &( address[ string_index ] );
+
+			break;
+		}
+		else if( address[ string_index ] == (system_character_t) ':' )
+		{
+			has_port = 1;
+		}
+		else if( address[ string_index ] == (system_character_t) ']' )
+		{
+			has_port = 0;
+		}
+	}
+	host_length = string_index - 7;
+
+	if( path != NULL )
+	{
+		path_length = address_length - string_index;
+	}
+	if( ( host_length == 0 )
+	 || ( ( host_length + 4 ) >= 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid address - host length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length + 7 ) >= 1024 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid address - path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_http_bulk_sink = memory_allocate_structure(
+	                       http_bulk_sink_t );
+
+	if( safe_http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create HTTP bulk sink.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_http_bulk_sink,
+	     0,
+	     sizeof( http_bulk_sink_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear HTTP bulk sink.",
+		 function );
+
+		memory_free(
+		 safe_http_bulk_sink );
+
+		return( -1 );
+	}
+	for( connection_index = 0;
+	     connection_index < HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS;
+	     connection_index++ )
+	{
+		safe_http_bulk_sink->socket_descriptors[ connection_index ] = -1;
+	}
+	/* The address only contains ASCII characters so it can be narrowed per character
+	 */
+	for( string_index = 0;
+	     string_index < host_length;
+	     string_index++ )
+	{
+		safe_http_bulk_sink->host[ string_index ]     = (char) host[ string_index ];
+		safe_http_bulk_sink->location[ string_index ] = (char) host[ string_index ];
+	}
+	safe_http_bulk_sink->host[ host_length ] = 0;
+
+	if( has_port == 0 )
+	{
+		safe_http_bulk_sink->location[ host_length++ ] = ':';
+		safe_http_bulk_sink->location[ host_length++ ] = '8';
+		safe_http_bulk_sink->location[ host_length++ ] = '0';
+	}
+	safe_http_bulk_sink->location[ host_length ] = 0;
+
+	/* A path without a bulk endpoint, such as /index, refers to the bulk endpoint of the index
+	 */
+	while( ( path_length > 0 )
+	    && ( path[ path_length - 1 ] == (system_character_t) '/' ) )
+	{
+		path_length--;
+	}
+	for( string_index = 0;
+	     string_index < path_length;
+	     string_index++ )
+	{
+		safe_http_bulk_sink->path[ string_index ] = (char) path[ string_index ];
+	}
+	if( ( path_length < 6 )
+	 || ( narrow_string_compare(
+	       &( safe_http_bulk_sink->path[ path_length - 6 ] ),
+	       "/_bulk",
+	       6 ) != 0 ) )
+	{
+		if( memory_copy(
+		     &( safe_http_bulk_sink->path[ path_length ] ),
+		     "/_bulk",
+		     6 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			goto on_error;
+		}
+		path_length += 6;
+	}
+	safe_http_bulk_sink->path[ path_length ] = 0;
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	/* A connection closed by the server should result in an error not a signal
+	 */
+	signal(
+	 SIGPIPE,
+	 SIG_IGN );
+#endif
+	*http_bulk_sink = safe_http_bulk_sink;
+
+	return( 1 );
+
+on_error:
+	if( safe_http_bulk_sink != NULL )
+	{
+		memory_free(
+		 safe_http_bulk_sink );
+	}
+	return( -1 );
+}
+
+/* Frees a HTTP bulk sink
+ * The pending responses are not read, use http_bulk_sink_finish
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_free(
+     http_bulk_sink_t **http_bulk_sink,
+     libcerror_error_t **error )
+{
+	static char *function = "http_bulk_sink_free";
+	int result            = 1;
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	int connection_index  = 0;
+#endif
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+	if( *http_bulk_sink != NULL )
+	{
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+		for( connection_index = 0;
+		     connection_index < HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS;
+		     connection_index++ )
+		{
+			if( ( *http_bulk_sink )->socket_descriptors[ connection_index ] < 0 )
+			{
+				continue;
+			}
+			if( network_stream_close_socket(
+			     ( *http_bulk_sink )->socket_descriptors[ connection_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close connection: %d.",
+				 function,
+				 connection_index );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *http_bulk_sink );
+
+		*http_bulk_sink = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+
+/* Receives data from a socket into the read buffer
+ * Returns 1 if successful, 0 if the connection was closed or -1 on error
+ */
+int http_bulk_sink_receive(
+     http_bulk_sink_t *http_bulk_sink,
+     int socket_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "http_bulk_sink_receive";
+	ssize_t read_count    = 0;
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+	if( http_bulk_sink->read_offset > 0 )
+	{
+		if( http_bulk_sink->read_offset < http_bulk_sink->read_size )
+		{
+			if( memory_copy(
+			     http_bulk_sink->read_buffer,
+			     &( http_bulk_sink->read_buffer[ http_bulk_sink->read_offset ] ),
+			     http_bulk_sink->read_size - http_bulk_sink->read_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move unread data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		http_bulk_sink->read_size  -= http_bulk_sink->read_offset;
+		http_bulk_sink->read_offset = 0;
+	}
+	if( http_bulk_sink->read_size >= HTTP_BULK_SINK_READ_BUFFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read buffer - data exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		read_count = recv(
+		              socket_descriptor,
+		              &( http_bulk_sink->read_buffer[ http_bulk_sink->read_size ] ),
+		              HTTP_BULK_SINK_READ_BUFFER_SIZE - http_bulk_sink->read_size,
+		              0 );
+	}
+	while( ( read_count < 0 )
+	    && ( errno == EINTR ) );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from socket.",
+		 function );
+
+		return( -1 );
+	}
+	else if( read_count == 0 )
+	{
+		return( 0 );
+	}
+	http_bulk_sink->read_size += (size_t) read_count;
+
+	return( 1 );
+}
+
+/* Reads a CRLF terminated line of the response
+ * The line terminator is not included in the line
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_read_line(
+     http_bulk_sink_t *http_bulk_sink,
+     int socket_descriptor,
+     char *line,
+     size_t line_size,
+     libcerror_error_t **error )
+{
+	static char *function = "http_bulk_sink_read_line";
+	size_t line_length    = 0;
+	size_t search_offset  = 0;
+	int result            = 0;
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid line size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	search_offset = http_bulk_sink->read_offset;
+
+	do
+	{
+		while( search_offset < http_bulk_sink->read_size )
+		{
+			if( http_bulk_sink->read_buffer[ search_offset ] == (uint8_t) '\n' )
+			{
+				line_length = search_offset - http_bulk_sink->read_offset;
+
+				if( ( line_length > 0 )
+				 && ( http_bulk_sink->read_buffer[ search_offset - 1 ] == (uint8_t) '\r' ) )
+				{
+					line_length--;
+				}
+				/* Header lines that do not fit are truncated since only
+				 * the start of the header lines is inspected
+				 */
+				if( line_length >= line_size )
+				{
+					line_length = line_size - 1;
+				}
+				if( memory_copy(
+				     line,
+				     &( http_bulk_sink->read_buffer[ http_bulk_sink->read_offset ] ),
+				     line_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy line.",
+					 function );
+
+					return( -1 );
+				}
+				line[ line_length ] = 0;
+
+				http_bulk_sink->read_offset = search_offset + 1;
+
+				return( 1 );
+			}
+			search_offset++;
+		}
+		search_offset -= http_bulk_sink->read_offset;
+
+		result = http_bulk_sink_receive(
+		          http_bulk_sink,
+		          socket_descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to receive data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: connection closed before end of line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( 1 );
+
+	return( -1 );
+}
+
+/* Reads a part of the response body
+ * Up to HTTP_BULK_SINK_MAXIMUM_BODY_SIZE bytes are retained in the body,
+ * the remainder is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_read_body(
+     http_bulk_sink_t *http_bulk_sink,
+     int socket_descriptor,
+     size_t body_size,
+     libcerror_error_t **error )
+{
+	static char *function = "http_bulk_sink_read_body";
+	size_t copy_size      = 0;
+	size_t read_size      = 0;
+	int result            = 0;
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+	while( body_size > 0 )
+	{
+		if( http_bulk_sink->read_offset >= http_bulk_sink->read_size )
+		{
+			result = http_bulk_sink_receive(
+			          http_bulk_sink,
+			          socket_descriptor,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to receive body data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		read_size = http_bulk_sink->read_size - http_bulk_sink->read_offset;
+
+		if( read_size > body_size )
+		{
+			read_size = body_size;
+		}
+		copy_size = HTTP_BULK_SINK_MAXIMUM_BODY_SIZE - http_bulk_sink->body_size;
+
+		if( copy_size > read_size )
+		{
+			copy_size = read_size;
+		}
+		if( copy_size > 0 )
+		{
+			if( memory_copy(
+			     &( http_bulk_sink->body[ http_bulk_sink->body_size ] ),
+			     &( http_bulk_sink->read_buffer[ http_bulk_sink->read_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy body data.",
+				 function );
+
+				return( -1 );
+			}
+			http_bulk_sink->body_size += copy_size;
+		}
+		http_bulk_sink->read_offset += read_size;
+		body_size                   -= read_size;
+	}
+	return( 1 );
+}
+
+/* Reads the response of the pending request of a connection
+ * The response must have a 2xx status and its body must not report errors
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_read_response(
+     http_bulk_sink_t *http_bulk_sink,
+     int connection_index,
+     libcerror_error_t **error )
+{
+	char line[ 256 ];
+
+	static char *function  = "http_bulk_sink_read_response";
+	uint64_t value_64bit   = 0;
+	size_t content_length  = 0;
+	size_t line_index      = 0;
+	int close_connection   = 0;
+	int is_chunked         = 0;
+	int socket_descriptor  = -1;
+	int status_code        = 0;
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( connection_index < 0 )
+	 || ( connection_index >= HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid connection index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	socket_descriptor = http_bulk_sink->socket_descriptors[ connection_index ];
+
+	http_bulk_sink->response_is_pending[ connection_index ] = 0;
+	http_bulk_sink->read_offset                             = 0;
+	http_bulk_sink->read_size                               = 0;
+	http_bulk_sink->body_size                               = 0;
+
+	if( http_bulk_sink_read_line(
+	     http_bulk_sink,
+	     socket_descriptor,
+	     line,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read status line.",
+		 function );
+
+		goto on_error;
+	}
+	/* The status line is of the form: HTTP/1.1 200 OK
+	 */
+	if( ( narrow_string_compare(
+	       line,
+	       "HTTP/1.",
+	       7 ) != 0 )
+	 || ( line[ 8 ] != ' ' )
+	 || ( line[ 9 ] < '0' )
+	 || ( line[ 9 ] > '9' )
+	 || ( line[ 10 ] < '0' )
+	 || ( line[ 10 ] > '9' )
+	 || ( line[ 11 ] < '0' )
+	 || ( line[ 11 ] > '9' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported status line.",
+		 function );
+
+		goto on_error;
+	}
+	status_code = ( ( line[ 9 ] - '0' ) * 100 )
+	            + ( ( line[ 10 ] - '0' ) * 10 )
+	            + ( line[ 11 ] - '0' );
+
+	if( line[ 7 ] == '0' )
+	{
+		close_connection = 1;
+	}
+	do
+	{
+		if( http_bulk_sink_read_line(
+		     http_bulk_sink,
+		     socket_descriptor,
+		     line,
+		     256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read header line.",
+			 function );
+
+			goto on_error;
+		}
+		if( narrow_string_compare_no_case(
+		     line,
+		     "Content-Length:",
+		     15 ) == 0 )
+		{
+			value_64bit = 0;
+
+			for( line_index = 15;
+			     line[ line_index ] == ' ';
+			     line_index++ )
+			{
+			}
+			while( ( line[ line_index ] >= '0' )
+			    && ( line[ line_index ] <= '9' ) )
+			{
+				value_64bit *= 10;
+				value_64bit += (uint64_t) ( line[ line_index++ ] - '0' );
+
+				if( value_64bit > (uint64_t) SSIZE_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid content length value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			content_length = (size_t) value_64bit;
+		}
+		else if( ( narrow_string_compare_no_case(
+		            line,
+		            "Transfer-Encoding:",
+		            18 ) == 0 )
+		      && ( narrow_string_search_string(
+		            &( line[ 18 ] ),
+		            "chunked",
+		            narrow_string_length( &( line[ 18 ] ) ) ) != NULL ) )
+		{
+			is_chunked = 1;
+		}
+		else if( ( narrow_string_compare_no_case(
+		            line,
+		            "Connection:",
+		            11 ) == 0 )
+		      && ( narrow_string_search_string(
+		            &( line[ 11 ] ),
+		            "close",
+		            narrow_string_length( &( line[ 11 ] ) ) ) != NULL ) )
+		{
+			close_connection = 1;
+		}
+	}
+	while( line[ 0 ] != 0 );
+
+	if( is_chunked == 0 )
+	{
+		if( http_bulk_sink_read_body(
+		     http_bulk_sink,
+		     socket_descriptor,
+		     content_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read body.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		do
+		{
+			if( http_bulk_sink_read_line(
+			     http_bulk_sink,
+			     socket_descriptor,
+			     line,
+			     256,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk size.",
+				 function );
+
+				goto on_error;
+			}
+			value_64bit = 0;
+
+			for( line_index = 0;
+			     line[ line_index ] != 0;
+			     line_index++ )
+			{
+				if( ( line[ line_index ] >= '0' )
+				 && ( line[ line_index ] <= '9' ) )
+				{
+					value_64bit = ( value_64bit << 4 ) | (uint64_t) ( line[ line_index ] - '0' );
+				}
+				else if( ( line[ line_index ] >= 'a' )
+				      && ( line[ line_index ] <= 'f' ) )
+				{
+					value_64bit = ( value_64bit << 4 ) | (uint64_t) ( line[ line_index ] - 'a' + 10 );
+				}
+				else if( ( line[ line_index ] >= 'A' )
+				      && ( line[ line_index ] <= 'F' ) )
+				{
+					value_64bit = ( value_64bit << 4 ) | (uint64_t) ( line[ line_index ] - 'A' + 10 );
+				}
+				else
+				{
+					break;
+				}
+				if( value_64bit > (uint64_t) SSIZE_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid chunk size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( value_64bit == 0 )
+			{
+				break;
+			}
+			/* The chunk data is followed by a CRLF which is read as an empty line
+			 */
+			if( http_bulk_sink_read_body(
+			     http_bulk_sink,
+			     socket_descriptor,
+			     (size_t) value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk.",
+				 function );
+
+				goto on_error;
+			}
+			if( http_bulk_sink_read_line(
+			     http_bulk_sink,
+			     socket_descriptor,
+			     line,
+			     256,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read end of chunk.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( 1 );
+
+		/* Skip the trailer section
+		 */
+		do
+		{
+			if( http_bulk_sink_read_line(
+			     http_bulk_sink,
+			     socket_descriptor,
+			     line,
+			     256,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trailer line.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( line[ 0 ] != 0 );
+	}
+	http_bulk_sink->body[ http_bulk_sink->body_size ] = 0;
+
+	if( close_connection != 0 )
+	{
+		http_bulk_sink->socket_descriptors[ connection_index ] = -1;
+
+		if( network_stream_close_socket(
+		     socket_descriptor,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close connection: %d.",
+			 function,
+			 connection_index );
+
+			return( -1 );
+		}
+	}
+	if( ( status_code < 200 )
+	 || ( status_code > 299 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: bulk request failed with status: %d %s",
+		 function,
+		 status_code,
+		 http_bulk_sink->body );
+
+		return( -1 );
+	}
+	/* The bulk response reports failed items with: "errors":true
+	 * which precedes the items in the response
+	 */
+	if( narrow_string_search_string(
+	     http_bulk_sink->body,
+	     "\"errors\":true",
+	     http_bulk_sink->body_size ) != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: bulk request reported errors: %s",
+		 function,
+		 http_bulk_sink->body );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	/* The connection cannot be reused after an incomplete response
+	 */
+	http_bulk_sink->socket_descriptors[ connection_index ] = -1;
+
+	network_stream_close_socket(
+	 socket_descriptor,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Sends data on a socket
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_send_data(
+     int socket_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "http_bulk_sink_send_data";
+	ssize_t write_count   = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_size > 0 )
+	{
+		write_count = send(
+		               socket_descriptor,
+		               data,
+		               data_size,
+		               0 );
+
+		if( write_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to socket.",
+			 function );
+
+			return( -1 );
+		}
+		data      += write_count;
+		data_size -= (size_t) write_count;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+
+/* Sends the data as a bulk request
+ * The request is sent on the next connection, after the response of the previous
+ * request on that connection was read, so that requests remain in flight on
+ * the other connections
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_send(
+     http_bulk_sink_t *http_bulk_sink,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	char request_header[ 1536 ];
+
+	static char *function      = "http_bulk_sink_send";
+	int print_count            = 0;
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	int connection_index       = 0;
+	int socket_descriptor      = -1;
+#endif
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	print_count = narrow_string_snprintf(
+	               request_header,
+	               1536,
+	               "POST %s HTTP/1.1\r\n"
+	               "Host: %s\r\n"
+	               "Content-Type: application/x-ndjson\r\n"
+	               "Content-Length: %" PRIzu "\r\n"
+	               "\r\n",
+	               http_bulk_sink->path,
+	               http_bulk_sink->host,
+	               data_size );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 1536 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format request header.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	connection_index = http_bulk_sink->connection_index;
+
+	if( http_bulk_sink->response_is_pending[ connection_index ] != 0 )
+	{
+		if( http_bulk_sink_read_response(
+		     http_bulk_sink,
+		     connection_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read response of connection: %d.",
+			 function,
+			 connection_index );
+
+			return( -1 );
+		}
+	}
+	if( http_bulk_sink->socket_descriptors[ connection_index ] < 0 )
+	{
+		if( network_stream_connect_tcp(
+		     http_bulk_sink->location,
+		     &socket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to connect to: %s.",
+			 function,
+			 http_bulk_sink->location );
+
+			return( -1 );
+		}
+		http_bulk_sink->socket_descriptors[ connection_index ] = socket_descriptor;
+	}
+	socket_descriptor = http_bulk_sink->socket_descriptors[ connection_index ];
+
+	if( ( http_bulk_sink_send_data(
+	       socket_descriptor,
+	       (uint8_t *) request_header,
+	       (size_t) print_count,
+	       error ) != 1 )
+	 || ( http_bulk_sink_send_data(
+	       socket_descriptor,
+	       data,
+	       data_size,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send request on connection: %d.",
+		 function,
+		 connection_index );
+
+		http_bulk_sink->socket_descriptors[ connection_index ] = -1;
+
+		network_stream_close_socket(
+		 socket_descriptor,
+		 NULL );
+
+		return( -1 );
+	}
+	http_bulk_sink->response_is_pending[ connection_index ] = 1;
+	http_bulk_sink->connection_index                        = ( connection_index + 1 ) % HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS;
+	http_bulk_sink->number_of_requests                     += 1;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: network output not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+}
+
+/* Reads the responses of the pending requests
+ * Returns 1 if successful or -1 on error
+ */
+int http_bulk_sink_finish(
+     http_bulk_sink_t *http_bulk_sink,
+     libcerror_error_t **error )
+{
+	static char *function = "http_bulk_sink_finish";
+	int result            = 1;
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	int connection_index  = 0;
+#endif
+
+	if( http_bulk_sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HTTP bulk sink.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	/* The responses are read in the order the requests were sent
+	 */
+	for( connection_index = 0;
+	     connection_index < HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS;
+	     connection_index++ )
+	{
+		if( http_bulk_sink->response_is_pending[ http_bulk_sink->connection_index ] != 0 )
+		{
+			if( http_bulk_sink_read_response(
+			     http_bulk_sink,
+			     http_bulk_sink->connection_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read response of connection: %d.",
+				 function,
+				 http_bulk_sink->connection_index );
+
+				result = -1;
+			}
+		}
+		http_bulk_sink->connection_index = ( http_bulk_sink->connection_index + 1 ) % HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS;
+	}
+#endif
+	return( result );
+}
+
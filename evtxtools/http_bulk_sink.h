@@ -0,0 +1,165 @@
+/*
+ * HTTP bulk sink functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HTTP_BULK_SINK_H )
+#define _HTTP_BULK_SINK_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "network_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of connections a bulk request can be sent on
+ * A connection is reused once the response of its previous request was read
+ * so this is also the maximum number of requests in flight
+ */
+#define HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS	4
+
+/* The size of the data that is sent as one bulk request
+ */
+#define HTTP_BULK_SINK_BATCH_SIZE		( 4 * 1024 * 1024 )
+
+/* The size of the buffer the response is read into
+ */
+#define HTTP_BULK_SINK_READ_BUFFER_SIZE		16384
+
+/* The maximum size of the response body that is checked for errors
+ */
+#define HTTP_BULK_SINK_MAXIMUM_BODY_SIZE	4096
+
+typedef struct http_bulk_sink http_bulk_sink_t;
+
+struct http_bulk_sink
+{
+	/* The location of the server, which is host:port
+	 */
+	char location[ 256 ];
+
+	/* The value of the Host header
+	 */
+	char host[ 256 ];
+
+	/* The path of the bulk endpoint
+	 */
+	char path[ 1024 ];
+
+	/* The socket descriptors of the connections
+	 * Contains -1 if the connection is not open
+	 */
+	int socket_descriptors[ HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS ];
+
+	/* Values to indicate a response of a connection is pending
+	 */
+	uint8_t response_is_pending[ HTTP_BULK_SINK_NUMBER_OF_CONNECTIONS ];
+
+	/* The index of the connection the next request is sent on
+	 */
+	int connection_index;
+
+	/* The read buffer
+	 */
+	uint8_t read_buffer[ HTTP_BULK_SINK_READ_BUFFER_SIZE ];
+
+	/* The offset of the unread data in the read buffer
+	 */
+	size_t read_offset;
+
+	/* The size of the data in the read buffer
+	 */
+	size_t read_size;
+
+	/* The start of the response body
+	 */
+	char body[ HTTP_BULK_SINK_MAXIMUM_BODY_SIZE + 1 ];
+
+	/* The size of the start of the response body
+	 */
+	size_t body_size;
+
+	/* The number of requests sent
+	 */
+	uint64_t number_of_requests;
+};
+
+int http_bulk_sink_initialize(
+     http_bulk_sink_t **http_bulk_sink,
+     const system_character_t *address,
+     libcerror_error_t **error );
+
+int http_bulk_sink_free(
+     http_bulk_sink_t **http_bulk_sink,
+     libcerror_error_t **error );
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+
+int http_bulk_sink_receive(
+     http_bulk_sink_t *http_bulk_sink,
+     int socket_descriptor,
+     libcerror_error_t **error );
+
+int http_bulk_sink_read_line(
+     http_bulk_sink_t *http_bulk_sink,
+     int socket_descriptor,
+     char *line,
+     size_t line_size,
+     libcerror_error_t **error );
+
+int http_bulk_sink_read_body(
+     http_bulk_sink_t *http_bulk_sink,
+     int socket_descriptor,
+     size_t body_size,
+     libcerror_error_t **error );
+
+int http_bulk_sink_read_response(
+     http_bulk_sink_t *http_bulk_sink,
+     int connection_index,
+     libcerror_error_t **error );
+
+int http_bulk_sink_send_data(
+     int socket_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+
+int http_bulk_sink_send(
+     http_bulk_sink_t *http_bulk_sink,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int http_bulk_sink_finish(
+     http_bulk_sink_t *http_bulk_sink,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HTTP_BULK_SINK_H ) */
+
@@ -27,12 +27,14 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "chunk_sampler.h"
 #include "evtxinput.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libclocale.h"
 #include "evtxtools_libfdatetime.h"
 #include "evtxtools_libevtx.h"
 #include "info_handle.h"
+#include "record_statistics.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
@@ -109,8 +111,9 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
-	( *info_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
-	( *info_handle )->notify_stream  = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->ascii_codepage    = LIBEVTX_CODEPAGE_WINDOWS_1252;
+	( *info_handle )->number_of_threads = 1;
+	( *info_handle )->notify_stream     = INFO_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
@@ -164,6 +167,22 @@ int info_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *info_handle )->chunk_sampler != NULL )
+		{
+			if( chunk_sampler_free(
+			     &( ( *info_handle )->chunk_sampler ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk sampler.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *info_handle );
 
@@ -272,6 +291,139 @@ int info_handle_set_ascii_codepage(
 	return( result );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		return( 0 );
+	}
+#endif
+	info_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the sample of the chunks of which the records are read
+ * The string contains a number of chunks or a percentage of the chunks, such as 5%
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_sample(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_sample";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->chunk_sampler == NULL )
+	{
+		if( chunk_sampler_initialize(
+		     &( info_handle->chunk_sampler ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk sampler.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = chunk_sampler_set_sample(
+	          info_handle->chunk_sampler,
+	          string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sample.",
+		 function );
+	}
+	if( result != 1 )
+	{
+		chunk_sampler_free(
+		 &( info_handle->chunk_sampler ),
+		 NULL );
+	}
+	return( result );
+}
+
 /* Sets the event log type from the filename
  * Returns 1 if successful or -1 on error
  */
@@ -322,6 +474,7 @@ int info_handle_open(
      libcerror_error_t **error )
 {
 	static char *function = "info_handle_open";
+	int access_flags      = LIBEVTX_OPEN_READ;
 
 	if( info_handle == NULL )
 	{
@@ -348,17 +501,67 @@ int info_handle_open(
 
 		return( -1 );
 	}
+	/* Only the values of the System element of the records are used
+	 */
+	if( libevtx_file_set_decode_depth(
+	     info_handle->input_file,
+	     LIBEVTX_DECODE_DEPTH_SYSTEM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set decode depth in input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_set_number_of_threads(
+	     info_handle->input_file,
+	     info_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads in input file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Verification does not need the records, hence the file is opened
+	 * without reading the chunks
+	 */
+	if( info_handle->verify_only != 0 )
+	{
+		access_flags = LIBEVTX_OPEN_READ_LAZY;
+	}
+	/* The number of records is estimated from the file and chunk headers
+	 */
+	else if( info_handle->header_only != 0 )
+	{
+		access_flags = LIBEVTX_OPEN_READ_HEADER_ONLY;
+	}
+	/* Lazy access determines the records of the sampled chunks from the chunk headers
+	 * without reading the other chunks
+	 */
+	else if( info_handle->chunk_sampler != NULL )
+	{
+		access_flags = LIBEVTX_OPEN_READ_LAZY;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libevtx_file_open_wide(
 	     info_handle->input_file,
 	     filename,
-	     LIBEVTX_OPEN_READ,
+	     access_flags,
 	     error ) != 1 )
 #else
 	if( libevtx_file_open(
 	     info_handle->input_file,
 	     filename,
-	     LIBEVTX_OPEN_READ,
+	     access_flags,
 	     error ) != 1 )
 #endif
 	{
@@ -481,10 +684,27 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
-	if( libevtx_file_get_number_of_records(
-	     info_handle->input_file,
-	     &number_of_records,
-	     error ) != 1 )
+	if( info_handle->header_only != 0 )
+	{
+		if( libevtx_file_get_estimated_number_of_records(
+		     info_handle->input_file,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve estimated number of records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libevtx_file_get_number_of_records(
+	          info_handle->input_file,
+	          &number_of_records,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -495,10 +715,14 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
-	if( libevtx_file_get_number_of_recovered_records(
-	     info_handle->input_file,
-	     &number_of_recovered_records,
-	     error ) != 1 )
+	if( info_handle->header_only != 0 )
+	{
+		number_of_recovered_records = 0;
+	}
+	else if( libevtx_file_get_number_of_recovered_records(
+	          info_handle->input_file,
+	          &number_of_recovered_records,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -519,15 +743,25 @@ int info_handle_file_fprint(
 	 major_version,
 	 minor_version );
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of records\t\t: %d\n",
-	 number_of_records );
+	if( info_handle->header_only != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tEstimated number of records\t: %d\n",
+		 number_of_records );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of records\t\t: %d\n",
+		 number_of_records );
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of recovered records\t: %d\n",
-	 number_of_recovered_records );
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of recovered records\t: %d\n",
+		 number_of_recovered_records );
+	}
 
 	switch( info_handle->event_log_type )
 	{
@@ -602,3 +836,805 @@ int info_handle_file_fprint(
 	return( 1 );
 }
 
+/* Prints the record identifier gaps
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_identifier_gaps_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *gap_type_string = NULL;
+	static char *function       = "info_handle_identifier_gaps_fprint";
+	uint64_t first_identifier   = 0;
+	uint64_t last_identifier    = 0;
+	uint8_t gap_type            = 0;
+	int gap_index               = 0;
+	int number_of_gaps          = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_identifier_gaps(
+	     info_handle->input_file,
+	     &number_of_gaps,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Record identifier gaps:\n" );
+
+	if( number_of_gaps == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tN/A\n" );
+	}
+	for( gap_index = 0;
+	     gap_index < number_of_gaps;
+	     gap_index++ )
+	{
+		if( libevtx_file_get_identifier_gap(
+		     info_handle->input_file,
+		     gap_index,
+		     &gap_type,
+		     &first_identifier,
+		     &last_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier gap: %d.",
+			 function,
+			 gap_index );
+
+			return( -1 );
+		}
+		switch( gap_type )
+		{
+			case LIBEVTX_IDENTIFIER_GAP_TYPE_MISSING:
+				gap_type_string = "Missing";
+				break;
+
+			case LIBEVTX_IDENTIFIER_GAP_TYPE_DUPLICATE:
+				gap_type_string = "Duplicate";
+				break;
+
+			case LIBEVTX_IDENTIFIER_GAP_TYPE_OUT_OF_ORDER:
+				gap_type_string = "Out of order";
+				break;
+
+			default:
+				gap_type_string = "Unknown";
+				break;
+		}
+		if( first_identifier == last_identifier )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t%s\t\t\t\t: %" PRIu64 "\n",
+			 gap_type_string,
+			 first_identifier );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t%s\t\t\t\t: %" PRIu64 " - %" PRIu64 "\n",
+			 gap_type_string,
+			 first_identifier,
+			 last_identifier );
+		}
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Adds a record to the record statistics
+ * Callback for libevtx_file_iterate_records
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_record_statistics_callback(
+     libevtx_record_t *record,
+     void *user_data )
+{
+	record_statistics_t *record_statistics = NULL;
+	libcerror_error_t *error               = NULL;
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	record_statistics = (record_statistics_t *) user_data;
+
+	if( record_statistics_add_record(
+	     record_statistics,
+	     record,
+	     &error ) != 1 )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds the records of the sampled chunks to the record statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_sample_record_statistics(
+     info_handle_t *info_handle,
+     record_statistics_t *record_statistics,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record  = NULL;
+	static char *function     = "info_handle_sample_record_statistics";
+	uint16_t number_of_chunks = 0;
+	int first_record_index    = 0;
+	int number_of_records     = 0;
+	int record_index          = 0;
+	int result                = 0;
+	int sample_index          = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->chunk_sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing chunk sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_chunks(
+	     info_handle->input_file,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_sampler_select_chunks(
+	     info_handle->chunk_sampler,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to select chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( sample_index = 0;
+	     sample_index < info_handle->chunk_sampler->number_of_sampled_chunks;
+	     sample_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		result = libevtx_file_get_chunk_records_range(
+		          info_handle->input_file,
+		          info_handle->chunk_sampler->chunk_indexes[ sample_index ],
+		          &first_record_index,
+		          &number_of_records,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records range of chunk: %" PRIu16 ".",
+			 function,
+			 info_handle->chunk_sampler->chunk_indexes[ sample_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		for( record_index = first_record_index;
+		     record_index < ( first_record_index + number_of_records );
+		     record_index++ )
+		{
+			if( libevtx_file_get_record_by_index(
+			     info_handle->input_file,
+			     record_index,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( record_statistics_add_record(
+			     record_statistics,
+			     record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add record: %d to statistics.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( libevtx_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		info_handle->chunk_sampler->number_of_sampled_records += (uint64_t) number_of_records;
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the record statistics to a stream
+ * The statistics are gathered in a single pass over the records
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_record_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	record_statistics_t *record_statistics = NULL;
+	static char *function                  = "info_handle_record_statistics_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_statistics_initialize(
+	     &record_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle->chunk_sampler != NULL )
+	{
+		if( info_handle_sample_record_statistics(
+		     info_handle,
+		     record_statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to sample records.",
+			 function );
+
+			goto on_error;
+		}
+		record_statistics->chunk_sampler = info_handle->chunk_sampler;
+	}
+	else if( libevtx_file_iterate_records(
+	          info_handle->input_file,
+	          &info_handle_record_statistics_callback,
+	          (void *) record_statistics,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to iterate records.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_statistics_fprint(
+	     record_statistics,
+	     info_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print record statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_statistics_free(
+	     &record_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record statistics.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_statistics != NULL )
+	{
+		record_statistics_free(
+		 &record_statistics,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the verify result of the file header or a chunk
+ * Callback for libevtx_file_verify
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int info_handle_verify_callback(
+     int chunk_index,
+     off64_t file_offset,
+     uint32_t verify_result_flags,
+     void *user_data )
+{
+	info_handle_t *info_handle = NULL;
+
+	if( user_data == NULL )
+	{
+		return( -1 );
+	}
+	info_handle = (info_handle_t *) user_data;
+
+	if( chunk_index < 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tFile header\t\t\t\t\t: " );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tChunk: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\t: ",
+		 chunk_index,
+		 file_offset,
+		 file_offset );
+
+		info_handle->number_of_verified_chunks += 1;
+	}
+	if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED ) == 0 )
+	{
+		if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_IS_EMPTY ) != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "empty\n" );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "OK\n" );
+		}
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "corrupted" );
+
+		if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_IS_EMPTY ) != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 ", 0-byte filled" );
+		}
+		if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_INVALID_SIGNATURE ) != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 ", invalid signature" );
+		}
+		if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_INVALID_HEADER ) != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 ", invalid header" );
+		}
+		if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_HEADER_CHECKSUM_MISMATCH ) != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 ", header checksum mismatch" );
+		}
+		if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_EVENT_RECORDS_CHECKSUM_MISMATCH ) != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 ", event records checksum mismatch" );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		if( chunk_index >= 0 )
+		{
+			info_handle->number_of_corrupted_chunks += 1;
+		}
+	}
+	if( info_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Verifies the file header and chunk checksums and prints the results
+ * Returns 1 if no failures were found, 0 if a failure was found or -1 on error
+ */
+int info_handle_verify_fprint(
+     info_handle_t *info_handle,
+     uint8_t stop_on_failure,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_verify_fprint";
+	uint8_t verify_flags  = 0;
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stop_on_failure != 0 )
+	{
+		verify_flags = LIBEVTX_VERIFY_FLAG_STOP_ON_FAILURE;
+	}
+	info_handle->number_of_verified_chunks  = 0;
+	info_handle->number_of_corrupted_chunks = 0;
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Verification:\n" );
+
+	result = libevtx_file_verify(
+	          info_handle->input_file,
+	          verify_flags,
+	          &info_handle_verify_callback,
+	          (void *) info_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify input file.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of chunks verified\t\t: %d\n",
+	 info_handle->number_of_verified_chunks );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of corrupted chunks\t\t: %d\n",
+	 info_handle->number_of_corrupted_chunks );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tResult\t\t\t\t\t: %s\n",
+	 ( result == 1 ) ? "OK" : "FAILED" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( result );
+}
+
+/* Prints the libevtx statistics to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t statistics[ LIBEVTX_NUMBER_OF_STATISTICS ];
+	static char *function = "info_handle_statistics_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_statistics(
+	     info_handle->input_file,
+	     statistics,
+	     LIBEVTX_NUMBER_OF_STATISTICS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Statistics:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of chunks read\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNKS_READ ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of bytes read\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_BYTES_READ ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tChecksum time\t\t\t: %" PRIu64 " ns\n",
+	 statistics[ LIBEVTX_STATISTIC_CHECKSUM_TIME ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tChunk cache hits\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_HITS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tChunk cache misses\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_MISSES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tRecord cache hits\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_HITS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tRecord cache misses\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_MISSES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of record headers read\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_HEADERS_READ ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of XML documents read\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_XML_DOCUMENTS_READ ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of template expansions\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_TEMPLATE_EXPANSIONS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of allocations\t\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_ALLOCATIONS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of chunk re-reads\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_REREADS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of background decodes\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_BACKGROUND_DECODED_RECORDS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of document cache hits\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_DOCUMENT_CACHE_HITS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tLock wait time\t\t\t: %" PRIu64 " ns\n",
+	 statistics[ LIBEVTX_STATISTIC_LOCK_WAIT_TIME ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of over budget records\t: %" PRIu64 "\n",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_OVER_BUDGET_RECORDS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Prints the libevtx memory usage to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_memory_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t memory_usage[ LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES ];
+	static char *function = "info_handle_memory_usage_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_memory_usage_values(
+	     info_handle->input_file,
+	     memory_usage,
+	     LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Memory usage:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tChunk data\t\t\t: %" PRIu64 " bytes\n",
+	 memory_usage[ LIBEVTX_MEMORY_USAGE_CHUNK_DATA ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tRecords index\t\t\t: %" PRIu64 " bytes\n",
+	 memory_usage[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tRecord values\t\t\t: %" PRIu64 " bytes\n",
+	 memory_usage[ LIBEVTX_MEMORY_USAGE_RECORD_VALUES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tXML documents\t\t\t: %" PRIu64 " bytes\n",
+	 memory_usage[ LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tTotal\t\t\t\t: %" PRIu64 " bytes\n",
+	 memory_usage[ LIBEVTX_MEMORY_USAGE_TOTAL ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tPeak\t\t\t\t: %" PRIu64 " bytes\n",
+	 memory_usage[ LIBEVTX_MEMORY_USAGE_PEAK ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -26,13 +26,19 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "chunk_sampler.h"
 #include "evtxtools_libevtx.h"
 #include "evtxtools_libcerror.h"
+#include "record_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of threads
+ */
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -49,6 +55,31 @@ struct info_handle
 	 */
 	int ascii_codepage;
 
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate the file is only verified
+	 */
+	uint8_t verify_only;
+
+	/* Value to indicate only the file and chunk headers are read
+	 */
+	uint8_t header_only;
+
+	/* The chunk sampler
+	 * Contains NULL if the records of all chunks are read
+	 */
+	chunk_sampler_t *chunk_sampler;
+
+	/* The number of chunks verified
+	 */
+	int number_of_verified_chunks;
+
+	/* The number of corrupted chunks
+	 */
+	int number_of_corrupted_chunks;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -75,6 +106,16 @@ int info_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_sample(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_set_event_log_type_from_filename(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -93,6 +134,42 @@ int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_record_statistics_callback(
+     libevtx_record_t *record,
+     void *user_data );
+
+int info_handle_sample_record_statistics(
+     info_handle_t *info_handle,
+     record_statistics_t *record_statistics,
+     libcerror_error_t **error );
+
+int info_handle_record_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_verify_callback(
+     int chunk_index,
+     off64_t file_offset,
+     uint32_t verify_result_flags,
+     void *user_data );
+
+int info_handle_verify_fprint(
+     info_handle_t *info_handle,
+     uint8_t stop_on_failure,
+     libcerror_error_t **error );
+
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_identifier_gaps_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_memory_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,136 @@
+/*
+ * Language tag functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "language_tag.h"
+
+/* The language tags of the Windows display languages
+ * The definitions are sorted by language identifier
+ */
+static const language_tag_definition_t language_tag_definitions[ ] = {
+	{ 0x00000401UL, _SYSTEM_STRING( "ar-SA" ), 5 },
+	{ 0x00000402UL, _SYSTEM_STRING( "bg-BG" ), 5 },
+	{ 0x00000404UL, _SYSTEM_STRING( "zh-TW" ), 5 },
+	{ 0x00000405UL, _SYSTEM_STRING( "cs-CZ" ), 5 },
+	{ 0x00000406UL, _SYSTEM_STRING( "da-DK" ), 5 },
+	{ 0x00000407UL, _SYSTEM_STRING( "de-DE" ), 5 },
+	{ 0x00000408UL, _SYSTEM_STRING( "el-GR" ), 5 },
+	{ 0x00000409UL, _SYSTEM_STRING( "en-US" ), 5 },
+	{ 0x0000040aUL, _SYSTEM_STRING( "es-ES" ), 5 },
+	{ 0x0000040bUL, _SYSTEM_STRING( "fi-FI" ), 5 },
+	{ 0x0000040cUL, _SYSTEM_STRING( "fr-FR" ), 5 },
+	{ 0x0000040dUL, _SYSTEM_STRING( "he-IL" ), 5 },
+	{ 0x0000040eUL, _SYSTEM_STRING( "hu-HU" ), 5 },
+	{ 0x00000410UL, _SYSTEM_STRING( "it-IT" ), 5 },
+	{ 0x00000411UL, _SYSTEM_STRING( "ja-JP" ), 5 },
+	{ 0x00000412UL, _SYSTEM_STRING( "ko-KR" ), 5 },
+	{ 0x00000413UL, _SYSTEM_STRING( "nl-NL" ), 5 },
+	{ 0x00000414UL, _SYSTEM_STRING( "nb-NO" ), 5 },
+	{ 0x00000415UL, _SYSTEM_STRING( "pl-PL" ), 5 },
+	{ 0x00000416UL, _SYSTEM_STRING( "pt-BR" ), 5 },
+	{ 0x00000418UL, _SYSTEM_STRING( "ro-RO" ), 5 },
+	{ 0x00000419UL, _SYSTEM_STRING( "ru-RU" ), 5 },
+	{ 0x0000041aUL, _SYSTEM_STRING( "hr-HR" ), 5 },
+	{ 0x0000041bUL, _SYSTEM_STRING( "sk-SK" ), 5 },
+	{ 0x0000041dUL, _SYSTEM_STRING( "sv-SE" ), 5 },
+	{ 0x0000041eUL, _SYSTEM_STRING( "th-TH" ), 5 },
+	{ 0x0000041fUL, _SYSTEM_STRING( "tr-TR" ), 5 },
+	{ 0x00000422UL, _SYSTEM_STRING( "uk-UA" ), 5 },
+	{ 0x00000424UL, _SYSTEM_STRING( "sl-SI" ), 5 },
+	{ 0x00000425UL, _SYSTEM_STRING( "et-EE" ), 5 },
+	{ 0x00000426UL, _SYSTEM_STRING( "lv-LV" ), 5 },
+	{ 0x00000427UL, _SYSTEM_STRING( "lt-LT" ), 5 },
+	{ 0x00000804UL, _SYSTEM_STRING( "zh-CN" ), 5 },
+	{ 0x00000809UL, _SYSTEM_STRING( "en-GB" ), 5 },
+	{ 0x0000080aUL, _SYSTEM_STRING( "es-MX" ), 5 },
+	{ 0x00000816UL, _SYSTEM_STRING( "pt-PT" ), 5 },
+	{ 0x00000c0aUL, _SYSTEM_STRING( "es-ES" ), 5 },
+	{ 0x00000c0cUL, _SYSTEM_STRING( "fr-CA" ), 5 } };
+
+/* Retrieves the language tag of a specific language identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int language_tag_get_by_identifier(
+     uint32_t language_identifier,
+     const system_character_t **language_tag,
+     size_t *language_tag_length,
+     libcerror_error_t **error )
+{
+	static char *function     = "language_tag_get_by_identifier";
+	int definition_index      = 0;
+	int lower_index           = 0;
+	int number_of_definitions = 0;
+	int upper_index           = 0;
+
+	if( language_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid language tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( language_tag_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid language tag length.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_definitions = (int) ( sizeof( language_tag_definitions ) / sizeof( language_tag_definition_t ) );
+
+	lower_index = 0;
+	upper_index = number_of_definitions;
+
+	while( lower_index < upper_index )
+	{
+		definition_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( language_tag_definitions[ definition_index ].language_identifier < language_identifier )
+		{
+			lower_index = definition_index + 1;
+		}
+		else if( language_tag_definitions[ definition_index ].language_identifier > language_identifier )
+		{
+			upper_index = definition_index;
+		}
+		else
+		{
+			*language_tag        = language_tag_definitions[ definition_index ].language_tag;
+			*language_tag_length = language_tag_definitions[ definition_index ].language_tag_length;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
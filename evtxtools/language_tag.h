@@ -0,0 +1,66 @@
+/*
+ * Language tag functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LANGUAGE_TAG_H )
+#define _LANGUAGE_TAG_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default language identifier, which is en-US
+ */
+#define LANGUAGE_TAG_DEFAULT_LANGUAGE_IDENTIFIER	0x00000409UL
+
+typedef struct language_tag_definition language_tag_definition_t;
+
+struct language_tag_definition
+{
+	/* The (Windows) language identifier
+	 */
+	uint32_t language_identifier;
+
+	/* The language tag
+	 */
+	const system_character_t *language_tag;
+
+	/* The language tag length
+	 */
+	size_t language_tag_length;
+};
+
+int language_tag_get_by_identifier(
+     uint32_t language_identifier,
+     const system_character_t **language_tag,
+     size_t *language_tag_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LANGUAGE_TAG_H ) */
+
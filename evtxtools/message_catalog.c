@@ -0,0 +1,2328 @@
+/*
+ * Message catalog
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_message_catalog.h"
+#include "evtxtools_libcerror.h"
+#include "message_catalog.h"
+#include "message_string.h"
+
+const uint8_t message_catalog_file_signature[ 8 ] = { 'E', 'V', 'T', 'X', 'M', 'C', 'A', 'T' };
+
+/* Creates a message catalog
+ * Make sure the value message_catalog is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_initialize(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_initialize";
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message catalog value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*message_catalog = memory_allocate_structure(
+	                    message_catalog_t );
+
+	if( *message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_catalog,
+	     0,
+	     sizeof( message_catalog_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message catalog.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *message_catalog != NULL )
+	{
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message catalog
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_free(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_catalog != NULL )
+	{
+		if( ( *message_catalog )->message_string != NULL )
+		{
+			if( message_string_free(
+			     &( ( *message_catalog )->message_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message string.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *message_catalog )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *message_catalog )->number_of_entries;
+			     entry_index++ )
+			{
+				memory_free(
+				 ( *message_catalog )->entries[ entry_index ]->data );
+
+				memory_free(
+				 ( *message_catalog )->entries[ entry_index ] );
+			}
+			memory_free(
+			 ( *message_catalog )->entries );
+		}
+		if( ( *message_catalog )->key_data != NULL )
+		{
+			memory_free(
+			 ( *message_catalog )->key_data );
+		}
+		if( ( *message_catalog )->file_data != NULL )
+		{
+			memory_free(
+			 ( *message_catalog )->file_data );
+		}
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+	}
+	return( result );
+}
+
+/* Opens a message catalog file
+ * The catalog file is read into memory and its entries are looked up directly in the file data
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_open(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	FILE *stream               = NULL;
+	static char *function      = "message_catalog_open";
+	size_t file_data_allocated = 0;
+	size_t read_count          = 0;
+	size_t read_size           = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->file_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message catalog - file data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open catalog file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	do
+	{
+		if( message_catalog->file_data_size >= file_data_allocated )
+		{
+			if( file_data_allocated > (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid catalog file size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			if( file_data_allocated == 0 )
+			{
+				file_data_allocated = 65536;
+			}
+			else
+			{
+				file_data_allocated *= 2;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            message_catalog->file_data,
+			                            sizeof( uint8_t ) * file_data_allocated );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize file data.",
+				 function );
+
+				goto on_error;
+			}
+			message_catalog->file_data = reallocation;
+		}
+		read_size = file_data_allocated - message_catalog->file_data_size;
+
+		read_count = file_stream_read(
+		              stream,
+		              &( message_catalog->file_data[ message_catalog->file_data_size ] ),
+		              read_size );
+
+		message_catalog->file_data_size += read_count;
+	}
+	while( read_count == read_size );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close catalog file.",
+		 function );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	stream = NULL;
+
+	if( message_catalog_read_file_data(
+	     message_catalog,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( message_catalog->file_data != NULL )
+	{
+		memory_free(
+		 message_catalog->file_data );
+
+		message_catalog->file_data = NULL;
+	}
+	message_catalog->file_data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the file header and entry descriptors of the catalog file data
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_read_file_data(
+     message_catalog_t *message_catalog,
+     libcerror_error_t **error )
+{
+	evtx_message_catalog_entry_descriptor_t *entry_descriptor = NULL;
+	evtx_message_catalog_file_header_t *file_header           = NULL;
+	static char *function                                     = "message_catalog_read_file_data";
+	size_t entry_descriptors_size                             = 0;
+	uint32_t character_size                                   = 0;
+	uint32_t data_offset                                      = 0;
+	uint32_t data_size                                        = 0;
+	uint32_t entry_index                                      = 0;
+	uint32_t file_size                                        = 0;
+	uint32_t format_version                                   = 0;
+	uint32_t number_of_entries                                = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_catalog->file_data == NULL )
+	 || ( message_catalog->file_data_size < sizeof( evtx_message_catalog_file_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message catalog - file data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (evtx_message_catalog_file_header_t *) message_catalog->file_data;
+
+	if( memory_compare(
+	     file_header->signature,
+	     message_catalog_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported catalog file signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->character_size,
+	 character_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_entries,
+	 number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->file_size,
+	 file_size );
+
+	if( format_version != MESSAGE_CATALOG_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported catalog file format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	/* The strings are stored as system strings
+	 */
+	if( character_size != (uint32_t) sizeof( system_character_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported catalog file character size: %" PRIu32 ".",
+		 function,
+		 character_size );
+
+		return( -1 );
+	}
+	if( (size_t) file_size != message_catalog->file_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_entries > ( ( message_catalog->file_data_size - sizeof( evtx_message_catalog_file_header_t ) ) / sizeof( evtx_message_catalog_entry_descriptor_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_descriptors_size = sizeof( evtx_message_catalog_file_header_t )
+	                       + ( (size_t) number_of_entries * sizeof( evtx_message_catalog_entry_descriptor_t ) );
+
+	entry_descriptor = (evtx_message_catalog_entry_descriptor_t *) &( message_catalog->file_data[ sizeof( evtx_message_catalog_file_header_t ) ] );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_descriptor->key_data_offset,
+		 data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_descriptor->key_data_size,
+		 data_size );
+
+		if( ( (size_t) data_offset < entry_descriptors_size )
+		 || ( data_offset > file_size )
+		 || ( data_size > ( file_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %" PRIu32 " key data value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_descriptor->value_data_offset,
+		 data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_descriptor->value_data_size,
+		 data_size );
+
+		if( ( (size_t) data_offset < entry_descriptors_size )
+		 || ( data_offset > file_size )
+		 || ( data_size > ( file_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %" PRIu32 " value data value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		entry_descriptor++;
+	}
+	message_catalog->number_of_file_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Writes the recorded entries to a message catalog file
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_write(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	evtx_message_catalog_entry_descriptor_t *entry_descriptor = NULL;
+	evtx_message_catalog_file_header_t *file_header           = NULL;
+	message_catalog_entry_t *entry                            = NULL;
+	uint8_t *header_data                                      = NULL;
+	FILE *stream                                              = NULL;
+	static char *function                                     = "message_catalog_write";
+	size_t data_offset                                        = 0;
+	size_t header_data_size                                   = 0;
+	int entry_index                                           = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->number_of_entries > 1 )
+	{
+		qsort(
+		 message_catalog->entries,
+		 (size_t) message_catalog->number_of_entries,
+		 sizeof( message_catalog_entry_t * ),
+		 &message_catalog_entry_compare_by_key_hash );
+	}
+	header_data_size = sizeof( evtx_message_catalog_file_header_t )
+	                 + ( (size_t) message_catalog->number_of_entries * sizeof( evtx_message_catalog_entry_descriptor_t ) );
+
+	header_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * header_data_size );
+
+	if( header_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create header data.",
+		 function );
+
+		goto on_error;
+	}
+	file_header      = (evtx_message_catalog_file_header_t *) header_data;
+	entry_descriptor = (evtx_message_catalog_entry_descriptor_t *) &( header_data[ sizeof( evtx_message_catalog_file_header_t ) ] );
+	data_offset      = header_data_size;
+
+	for( entry_index = 0;
+	     entry_index < message_catalog->number_of_entries;
+	     entry_index++ )
+	{
+		entry = message_catalog->entries[ entry_index ];
+
+		if( ( entry->key_data_size + entry->value_data_size ) > ( (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid catalog file size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_descriptor->key_hash,
+		 entry->key_hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_descriptor->key_type,
+		 entry->key_type );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_descriptor->key_data_offset,
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_descriptor->key_data_size,
+		 (uint32_t) entry->key_data_size );
+
+		data_offset += entry->key_data_size;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_descriptor->value_data_offset,
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_descriptor->value_data_size,
+		 (uint32_t) entry->value_data_size );
+
+		data_offset += entry->value_data_size;
+
+		entry_descriptor++;
+	}
+	if( memory_copy(
+	     file_header->signature,
+	     message_catalog_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->format_version,
+	 MESSAGE_CATALOG_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->character_size,
+	 (uint32_t) sizeof( system_character_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_entries,
+	 (uint32_t) message_catalog->number_of_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->file_size,
+	 (uint32_t) data_offset );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open catalog file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( file_stream_write(
+	     stream,
+	     header_data,
+	     header_data_size ) != header_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header and entry descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < message_catalog->number_of_entries;
+	     entry_index++ )
+	{
+		entry = message_catalog->entries[ entry_index ];
+
+		if( file_stream_write(
+		     stream,
+		     entry->data,
+		     entry->key_data_size + entry->value_data_size ) != ( entry->key_data_size + entry->value_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry: %d data.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close catalog file.",
+		 function );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	stream = NULL;
+
+	memory_free(
+	 header_data );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( header_data != NULL )
+	{
+		memory_free(
+		 header_data );
+	}
+	return( -1 );
+}
+
+/* Compares two recorded entries by their key hash
+ * Used to sort the entries before they are written
+ * Returns -1 if the first entry sorts before the second, 1 if after or 0 if equal
+ */
+int message_catalog_entry_compare_by_key_hash(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const message_catalog_entry_t *first_catalog_entry  = *( (message_catalog_entry_t * const *) first_entry );
+	const message_catalog_entry_t *second_catalog_entry = *( (message_catalog_entry_t * const *) second_entry );
+
+	if( first_catalog_entry->key_hash < second_catalog_entry->key_hash )
+	{
+		return( -1 );
+	}
+	else if( first_catalog_entry->key_hash > second_catalog_entry->key_hash )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Calculates the hash of a key
+ * The hash is a 32-bit FNV-1a of the (little-endian) key type and the key data
+ * Returns the key hash
+ */
+uint32_t message_catalog_get_key_hash(
+          uint32_t key_type,
+          const uint8_t *key_data,
+          size_t key_data_size )
+{
+	size_t key_data_offset = 0;
+	uint32_t key_hash      = 0x811c9dc5UL;
+	uint8_t byte_index     = 0;
+
+	for( byte_index = 0;
+	     byte_index < 4;
+	     byte_index++ )
+	{
+		key_hash ^= (uint32_t) ( ( key_type >> ( byte_index * 8 ) ) & 0xff );
+		key_hash *= 0x01000193UL;
+	}
+	for( key_data_offset = 0;
+	     key_data_offset < key_data_size;
+	     key_data_offset++ )
+	{
+		key_hash ^= (uint32_t) key_data[ key_data_offset ];
+		key_hash *= 0x01000193UL;
+	}
+	return( key_hash );
+}
+
+/* Sets the key used by the next value lookup or update
+ * The key consists of the name, the value name, if set, each followed by an end of string character, and the data, if set
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_set_key(
+     message_catalog_t *message_catalog,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "message_catalog_set_key";
+	size_t key_data_size  = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length > (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE )
+	 || ( value_name_length > (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE )
+	 || ( data_size > (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	key_data_size = ( name_length + 1 ) * sizeof( system_character_t );
+
+	if( value_name != NULL )
+	{
+		key_data_size += ( value_name_length + 1 ) * sizeof( system_character_t );
+	}
+	if( data != NULL )
+	{
+		key_data_size += data_size;
+	}
+	if( key_data_size > message_catalog->key_data_allocated_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            message_catalog->key_data,
+		                            sizeof( uint8_t ) * key_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize key data.",
+			 function );
+
+			return( -1 );
+		}
+		message_catalog->key_data                = reallocation;
+		message_catalog->key_data_allocated_size = key_data_size;
+	}
+	if( memory_set(
+	     message_catalog->key_data,
+	     0,
+	     key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key data.",
+		 function );
+
+		return( -1 );
+	}
+	key_data_size = 0;
+
+	if( name_length > 0 )
+	{
+		if( memory_copy(
+		     message_catalog->key_data,
+		     name,
+		     name_length * sizeof( system_character_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	key_data_size += ( name_length + 1 ) * sizeof( system_character_t );
+
+	if( value_name != NULL )
+	{
+		if( value_name_length > 0 )
+		{
+			if( memory_copy(
+			     &( message_catalog->key_data[ key_data_size ] ),
+			     value_name,
+			     value_name_length * sizeof( system_character_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value name.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		key_data_size += ( value_name_length + 1 ) * sizeof( system_character_t );
+	}
+	if( ( data != NULL )
+	 && ( data_size > 0 ) )
+	{
+		if( memory_copy(
+		     &( message_catalog->key_data[ key_data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		key_data_size += data_size;
+	}
+	message_catalog->key_data_size = key_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the value of the key set by message_catalog_set_key
+ * The catalog file entries are searched first and then the recorded entries
+ * The value data references the catalog data and is valid until the catalog is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	evtx_message_catalog_entry_descriptor_t *entry_descriptor  = NULL;
+	evtx_message_catalog_entry_descriptor_t *entry_descriptors = NULL;
+	message_catalog_entry_t *entry                             = NULL;
+	static char *function                                      = "message_catalog_get_value";
+	uint32_t data_offset                                       = 0;
+	uint32_t data_size                                         = 0;
+	uint32_t entry_index                                       = 0;
+	uint32_t entry_key_hash                                    = 0;
+	uint32_t entry_key_type                                    = 0;
+	uint32_t key_hash                                          = 0;
+	uint32_t lower_entry_index                                 = 0;
+	uint32_t upper_entry_index                                 = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message catalog - missing key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	key_hash = message_catalog_get_key_hash(
+	            key_type,
+	            message_catalog->key_data,
+	            message_catalog->key_data_size );
+
+	if( message_catalog->number_of_file_entries > 0 )
+	{
+		entry_descriptors = (evtx_message_catalog_entry_descriptor_t *) &( message_catalog->file_data[ sizeof( evtx_message_catalog_file_header_t ) ] );
+
+		/* The entry descriptors are sorted by key hash, find the first one with a matching hash
+		 */
+		upper_entry_index = message_catalog->number_of_file_entries;
+
+		while( lower_entry_index < upper_entry_index )
+		{
+			entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 entry_descriptors[ entry_index ].key_hash,
+			 entry_key_hash );
+
+			if( entry_key_hash < key_hash )
+			{
+				lower_entry_index = entry_index + 1;
+			}
+			else
+			{
+				upper_entry_index = entry_index;
+			}
+		}
+		for( entry_index = lower_entry_index;
+		     entry_index < message_catalog->number_of_file_entries;
+		     entry_index++ )
+		{
+			entry_descriptor = &( entry_descriptors[ entry_index ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 entry_descriptor->key_hash,
+			 entry_key_hash );
+
+			if( entry_key_hash != key_hash )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 entry_descriptor->key_type,
+			 entry_key_type );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 entry_descriptor->key_data_offset,
+			 data_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 entry_descriptor->key_data_size,
+			 data_size );
+
+			if( ( entry_key_type == key_type )
+			 && ( (size_t) data_size == message_catalog->key_data_size )
+			 && ( memory_compare(
+			       &( message_catalog->file_data[ data_offset ] ),
+			       message_catalog->key_data,
+			       message_catalog->key_data_size ) == 0 ) )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 entry_descriptor->value_data_offset,
+				 data_offset );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 entry_descriptor->value_data_size,
+				 data_size );
+
+				*value_data      = &( message_catalog->file_data[ data_offset ] );
+				*value_data_size = (size_t) data_size;
+
+				return( 1 );
+			}
+		}
+	}
+	entry = message_catalog->buckets[ key_hash & ( MESSAGE_CATALOG_NUMBER_OF_BUCKETS - 1 ) ];
+
+	while( entry != NULL )
+	{
+		if( ( entry->key_hash == key_hash )
+		 && ( entry->key_type == key_type )
+		 && ( entry->key_data_size == message_catalog->key_data_size )
+		 && ( memory_compare(
+		       entry->data,
+		       message_catalog->key_data,
+		       message_catalog->key_data_size ) == 0 ) )
+		{
+			*value_data      = &( entry->data[ entry->key_data_size ] );
+			*value_data_size = entry->value_data_size;
+
+			return( 1 );
+		}
+		entry = entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Records the value of the key set by message_catalog_set_key
+ * Returns 1 if successful, 0 if the key was already present or -1 on error
+ */
+int message_catalog_set_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	message_catalog_entry_t **reallocation = NULL;
+	message_catalog_entry_t *entry         = NULL;
+	const uint8_t *existing_value_data     = NULL;
+	static char *function                  = "message_catalog_set_value";
+	size_t existing_value_data_size        = 0;
+	uint32_t bucket_index                  = 0;
+	int maximum_number_of_entries          = 0;
+	int result                             = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_value(
+	          message_catalog,
+	          key_type,
+	          &existing_value_data,
+	          &existing_value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve existing value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	if( message_catalog->number_of_entries >= message_catalog->maximum_number_of_entries )
+	{
+		if( message_catalog->maximum_number_of_entries == 0 )
+		{
+			maximum_number_of_entries = 256;
+		}
+		else if( message_catalog->maximum_number_of_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			maximum_number_of_entries = message_catalog->maximum_number_of_entries * 2;
+		}
+		reallocation = (message_catalog_entry_t **) memory_reallocate(
+		                                             message_catalog->entries,
+		                                             sizeof( message_catalog_entry_t * ) * maximum_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		message_catalog->entries                   = reallocation;
+		message_catalog->maximum_number_of_entries = maximum_number_of_entries;
+	}
+	entry = memory_allocate_structure(
+	         message_catalog_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( message_catalog_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		goto on_error;
+	}
+	entry->data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ( message_catalog->key_data_size + value_data_size ) );
+
+	if( entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     entry->data,
+	     message_catalog->key_data,
+	     message_catalog->key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( entry->data[ message_catalog->key_data_size ] ),
+		     value_data,
+		     value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	entry->key_hash        = message_catalog_get_key_hash(
+	                          key_type,
+	                          message_catalog->key_data,
+	                          message_catalog->key_data_size );
+	entry->key_type        = key_type;
+	entry->key_data_size   = message_catalog->key_data_size;
+	entry->value_data_size = value_data_size;
+
+	bucket_index = entry->key_hash & ( MESSAGE_CATALOG_NUMBER_OF_BUCKETS - 1 );
+
+	entry->next_bucket_entry                 = message_catalog->buckets[ bucket_index ];
+	message_catalog->buckets[ bucket_index ] = entry;
+
+	message_catalog->entries[ message_catalog->number_of_entries ] = entry;
+	message_catalog->number_of_entries                            += 1;
+
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->data != NULL )
+		{
+			memory_free(
+			 entry->data );
+		}
+		memory_free(
+		 entry );
+	}
+	return( -1 );
+}
+
+/* Retrieves a registry value of an event source or provider identifier
+ * The value string is allocated and should be freed by the caller
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_registry_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "message_catalog_get_registry_value";
+	size_t value_data_size    = 0;
+	int result                = 0;
+
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_set_key(
+	     message_catalog,
+	     name,
+	     name_length,
+	     value_name,
+	     value_name_length,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		goto on_error;
+	}
+	result = message_catalog_get_value(
+	          message_catalog,
+	          key_type,
+	          &value_data,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( ( value_data_size == 0 )
+		 || ( ( value_data_size % sizeof( system_character_t ) ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value data size.",
+			 function );
+
+			goto on_error;
+		}
+		*value_string_size = value_data_size / sizeof( system_character_t );
+
+		*value_string = system_string_allocate(
+		                 *value_string_size );
+
+		if( *value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     *value_string,
+		     value_data,
+		     value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value string.",
+			 function );
+
+			goto on_error;
+		}
+		( *value_string )[ *value_string_size - 1 ] = 0;
+	}
+	return( result );
+
+on_error:
+	if( *value_string != NULL )
+	{
+		memory_free(
+		 *value_string );
+
+		*value_string = NULL;
+	}
+	*value_string_size = 0;
+
+	return( -1 );
+}
+
+/* Records a registry value of an event source or provider identifier
+ * Returns 1 if successful, 0 if the value was already present or -1 on error
+ */
+int message_catalog_set_registry_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t *value_string,
+     size_t value_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_set_registry_value";
+	int result            = 0;
+
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_string_size == 0 )
+	 || ( value_string_size > ( (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_set_key(
+	     message_catalog,
+	     name,
+	     name_length,
+	     value_name,
+	     value_name_length,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_set_value(
+	          message_catalog,
+	          key_type,
+	          (uint8_t *) value_string,
+	          value_string_size * sizeof( system_character_t ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a message string of a specific resource filename
+ * The message string is managed by the catalog and is valid until the next call
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	uint8_t identifier_data[ 4 ];
+
+	const uint8_t *value_data = NULL;
+	static char *function     = "message_catalog_get_message_string";
+	size_t value_data_size    = 0;
+	int result                = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 identifier_data,
+	 message_identifier );
+
+	if( message_catalog_set_key(
+	     message_catalog,
+	     resource_filename,
+	     resource_filename_length,
+	     NULL,
+	     0,
+	     identifier_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_value(
+	          message_catalog,
+	          MESSAGE_CATALOG_KEY_TYPE_MESSAGE_STRING,
+	          &value_data,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( value_data_size == 0 )
+	 || ( ( value_data_size % sizeof( system_character_t ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->message_string != NULL )
+	{
+		if( message_string_free(
+		     &( message_catalog->message_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( message_string_initialize(
+	     &( message_catalog->message_string ),
+	     message_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message string.",
+		 function );
+
+		return( -1 );
+	}
+	message_catalog->message_string->string_size = value_data_size / sizeof( system_character_t );
+
+	message_catalog->message_string->string = system_string_allocate(
+	                                           message_catalog->message_string->string_size );
+
+	if( message_catalog->message_string->string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message string string.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     message_catalog->message_string->string,
+	     value_data,
+	     value_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy message string string.",
+		 function );
+
+		goto on_error;
+	}
+	message_catalog->message_string->string[ message_catalog->message_string->string_size - 1 ] = 0;
+
+	*message_string = message_catalog->message_string;
+
+	return( 1 );
+
+on_error:
+	message_string_free(
+	 &( message_catalog->message_string ),
+	 NULL );
+
+	return( -1 );
+}
+
+/* Records a message string of a specific resource filename
+ * Returns 1 if successful, 0 if the message string was already present or -1 on error
+ */
+int message_catalog_set_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     message_string_t *message_string,
+     libcerror_error_t **error )
+{
+	uint8_t identifier_data[ 4 ];
+
+	static char *function = "message_catalog_set_message_string";
+	int result            = 0;
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_string->string == NULL )
+	 || ( message_string->string_size == 0 )
+	 || ( message_string->string_size > ( (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string - missing string.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 identifier_data,
+	 message_string->identifier );
+
+	if( message_catalog_set_key(
+	     message_catalog,
+	     resource_filename,
+	     resource_filename_length,
+	     NULL,
+	     0,
+	     identifier_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_set_value(
+	          message_catalog,
+	          MESSAGE_CATALOG_KEY_TYPE_MESSAGE_STRING,
+	          (uint8_t *) message_string->string,
+	          message_string->string_size * sizeof( system_character_t ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the key of an event of a specific provider in a resource file
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_set_event_key(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t event_data[ 20 ];
+
+	static char *function = "message_catalog_set_event_key";
+
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     event_data,
+	     provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( event_data[ 16 ] ),
+	 event_identifier );
+
+	if( message_catalog_set_key(
+	     message_catalog,
+	     resource_filename,
+	     resource_filename_length,
+	     NULL,
+	     0,
+	     event_data,
+	     20,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the message identifier of an event of a specific provider in a resource file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_event_message_identifier(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint32_t *message_identifier,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "message_catalog_get_event_message_identifier";
+	size_t value_data_size    = 0;
+	int result                = 0;
+
+	if( message_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_set_event_key(
+	     message_catalog,
+	     resource_filename,
+	     resource_filename_length,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event key.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_value(
+	          message_catalog,
+	          MESSAGE_CATALOG_KEY_TYPE_EVENT_MESSAGE_IDENTIFIER,
+	          &value_data,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( value_data_size != 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value data size.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 value_data,
+		 *message_identifier );
+	}
+	return( result );
+}
+
+/* Records the message identifier of an event of a specific provider in a resource file
+ * Returns 1 if successful, 0 if the message identifier was already present or -1 on error
+ */
+int message_catalog_set_event_message_identifier(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint32_t message_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 4 ];
+
+	static char *function = "message_catalog_set_event_message_identifier";
+	int result            = 0;
+
+	if( message_catalog_set_event_key(
+	     message_catalog,
+	     resource_filename,
+	     resource_filename_length,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event key.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 value_data,
+	 message_identifier );
+
+	result = message_catalog_set_value(
+	          message_catalog,
+	          MESSAGE_CATALOG_KEY_TYPE_EVENT_MESSAGE_IDENTIFIER,
+	          value_data,
+	          4,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the template definition data of an event of a specific provider in a resource file
+ * The template data references the catalog data and is valid until the catalog is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_template_definition_data(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     const uint8_t **template_data,
+     size_t *template_data_size,
+     uint32_t *template_data_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "message_catalog_get_template_definition_data";
+	size_t value_data_size    = 0;
+	int result                = 0;
+
+	if( template_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_set_event_key(
+	     message_catalog,
+	     resource_filename,
+	     resource_filename_length,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event key.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_value(
+	          message_catalog,
+	          MESSAGE_CATALOG_KEY_TYPE_TEMPLATE_DEFINITION,
+	          &value_data,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The value consists of the 32-bit template data offset followed by the template data
+		 */
+		if( value_data_size <= 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value data size.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 value_data,
+		 *template_data_offset );
+
+		*template_data      = &( value_data[ 4 ] );
+		*template_data_size = value_data_size - 4;
+	}
+	return( result );
+}
+
+/* Records the template definition data of an event of a specific provider in a resource file
+ * Returns 1 if successful, 0 if the template definition data was already present or -1 on error
+ */
+int message_catalog_set_template_definition_data(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     const uint8_t *template_data,
+     size_t template_data_size,
+     uint32_t template_data_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data   = NULL;
+	static char *function = "message_catalog_set_template_definition_data";
+	int result            = 0;
+
+	if( template_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_data_size == 0 )
+	 || ( template_data_size > ( (size_t) MESSAGE_CATALOG_MAXIMUM_FILE_SIZE - 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_set_event_key(
+	     message_catalog,
+	     resource_filename,
+	     resource_filename_length,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event key.",
+		 function );
+
+		goto on_error;
+	}
+	value_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * ( template_data_size + 4 ) );
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 value_data,
+	 template_data_offset );
+
+	if( memory_copy(
+	     &( value_data[ 4 ] ),
+	     template_data,
+	     template_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy template data.",
+		 function );
+
+		goto on_error;
+	}
+	result = message_catalog_set_value(
+	          message_catalog,
+	          MESSAGE_CATALOG_KEY_TYPE_TEMPLATE_DEFINITION,
+	          value_data,
+	          template_data_size + 4,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 value_data );
+
+	return( result );
+
+on_error:
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,286 @@
+/*
+ * Message catalog
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_CATALOG_H )
+#define _MESSAGE_CATALOG_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The message catalog file format version
+ */
+#define MESSAGE_CATALOG_FORMAT_VERSION				1
+
+/* The number of hash table buckets of the recorded entries, must be a power of 2
+ */
+#define MESSAGE_CATALOG_NUMBER_OF_BUCKETS			4096
+
+/* The maximum supported size of a message catalog file
+ */
+#define MESSAGE_CATALOG_MAXIMUM_FILE_SIZE			( 512 * 1024 * 1024 )
+
+enum MESSAGE_CATALOG_KEY_TYPES
+{
+	MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE		= 1,
+	MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE	= 2,
+	MESSAGE_CATALOG_KEY_TYPE_MESSAGE_STRING			= 3,
+	MESSAGE_CATALOG_KEY_TYPE_EVENT_MESSAGE_IDENTIFIER	= 4,
+	MESSAGE_CATALOG_KEY_TYPE_TEMPLATE_DEFINITION		= 5
+};
+
+typedef struct message_catalog_entry message_catalog_entry_t;
+
+struct message_catalog_entry
+{
+	/* The key hash
+	 */
+	uint32_t key_hash;
+
+	/* The key type
+	 */
+	uint32_t key_type;
+
+	/* The data
+	 * Contains the key data followed by the value data
+	 */
+	uint8_t *data;
+
+	/* The key data size
+	 */
+	size_t key_data_size;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The next entry in the same hash table bucket
+	 */
+	message_catalog_entry_t *next_bucket_entry;
+};
+
+typedef struct message_catalog message_catalog_t;
+
+struct message_catalog
+{
+	/* The catalog file data
+	 */
+	uint8_t *file_data;
+
+	/* The catalog file data size
+	 */
+	size_t file_data_size;
+
+	/* The number of entries in the catalog file data
+	 */
+	uint32_t number_of_file_entries;
+
+	/* The recorded entries
+	 */
+	message_catalog_entry_t **entries;
+
+	/* The number of recorded entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of recorded entries the entries array can hold
+	 */
+	int maximum_number_of_entries;
+
+	/* The hash table buckets of the recorded entries
+	 */
+	message_catalog_entry_t *buckets[ MESSAGE_CATALOG_NUMBER_OF_BUCKETS ];
+
+	/* The key data
+	 * Reused between lookups
+	 */
+	uint8_t *key_data;
+
+	/* The key data size
+	 */
+	size_t key_data_size;
+
+	/* The allocated size of the key data
+	 */
+	size_t key_data_allocated_size;
+
+	/* The most recently retrieved message string
+	 */
+	message_string_t *message_string;
+};
+
+int message_catalog_initialize(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_free(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_open(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int message_catalog_read_file_data(
+     message_catalog_t *message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_write(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int message_catalog_entry_compare_by_key_hash(
+     const void *first_entry,
+     const void *second_entry );
+
+uint32_t message_catalog_get_key_hash(
+          uint32_t key_type,
+          const uint8_t *key_data,
+          size_t key_data_size );
+
+int message_catalog_set_key(
+     message_catalog_t *message_catalog,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int message_catalog_set_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_registry_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
+int message_catalog_set_registry_value(
+     message_catalog_t *message_catalog,
+     uint32_t key_type,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t *value_string,
+     size_t value_string_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error );
+
+int message_catalog_set_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+int message_catalog_set_event_key(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libcerror_error_t **error );
+
+int message_catalog_get_event_message_identifier(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint32_t *message_identifier,
+     libcerror_error_t **error );
+
+int message_catalog_set_event_message_identifier(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint32_t message_identifier,
+     libcerror_error_t **error );
+
+int message_catalog_get_template_definition_data(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     const uint8_t **template_data,
+     size_t *template_data_size,
+     uint32_t *template_data_offset,
+     libcerror_error_t **error );
+
+int message_catalog_set_template_definition_data(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     const uint8_t *template_data,
+     size_t template_data_size,
+     uint32_t template_data_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_CATALOG_H ) */
+
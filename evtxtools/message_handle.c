@@ -26,30 +26,25 @@
 #include <types.h>
 #include <wide_string.h>
 
-#if defined( TIME_WITH_SYS_TIME )
-#include <sys/time.h>
-#include <time.h>
-#elif defined( HAVE_SYS_TIME_H )
-#include <sys/time.h>
-#else
-#include <time.h>
-#endif
-
 #include "evtxtools_libcdirectory.h"
 #include "evtxtools_libcerror.h"
+#include "evtxtools_libcnotify.h"
 #include "evtxtools_libcpath.h"
 #include "evtxtools_libcsplit.h"
 #include "evtxtools_libevtx.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libregf.h"
 #include "evtxtools_libwrc.h"
 #include "evtxtools_system_split_string.h"
 #include "evtxtools_wide_string.h"
+#include "language_tag.h"
+#include "message_catalog.h"
 #include "message_handle.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
 #include "resource_file.h"
+#include "registry_value_cache.h"
+#include "resource_file_cache.h"
 
 /* Creates a message handle
  * Make sure the value message_handle is referencing, is set to NULL
@@ -129,9 +124,9 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->resource_file_cache ),
-	     16,
+	     RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -143,9 +138,9 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->mui_resource_file_cache ),
-	     16,
+	     RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -157,17 +152,55 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
+	if( registry_value_cache_initialize(
+	     &( ( *message_handle )->registry_value_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create registry value cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *message_handle )->ascii_codepage                = LIBREGF_CODEPAGE_WINDOWS_1252;
-	( *message_handle )->preferred_language_identifier = 0x00000409UL;
+	( *message_handle )->preferred_language_identifier = LANGUAGE_TAG_DEFAULT_LANGUAGE_IDENTIFIER;
+
+	if( message_handle_set_mui_languages(
+	     *message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set MUI languages.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *message_handle != NULL )
 	{
+		if( ( *message_handle )->registry_value_cache != NULL )
+		{
+			registry_value_cache_free(
+			 &( ( *message_handle )->registry_value_cache ),
+			 NULL );
+		}
+		if( ( *message_handle )->mui_resource_file_cache != NULL )
+		{
+			resource_file_cache_free(
+			 &( ( *message_handle )->mui_resource_file_cache ),
+			 NULL );
+		}
 		if( ( *message_handle )->resource_file_cache != NULL )
 		{
-			libfcache_cache_free(
+			resource_file_cache_free(
 			 &( ( *message_handle )->resource_file_cache ),
 			 NULL );
 		}
@@ -278,7 +311,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -291,7 +324,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->mui_resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -304,6 +337,19 @@ int message_handle_free(
 
 			result = -1;
 		}
+		if( registry_value_cache_free(
+		     &( ( *message_handle )->registry_value_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free registry value cache.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *message_handle )->winevt_publishers_key != NULL )
 		{
 			if( libregf_key_free(
@@ -464,6 +510,212 @@ int message_handle_set_preferred_language_identifier(
 	}
 	message_handle->preferred_language_identifier = preferred_language_identifier;
 
+	if( message_handle_set_mui_languages(
+	     message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set MUI languages.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the MUI languages in order of preference
+ * The languages are the preferred language, the default language of its primary
+ * language and en-US, the language of the MUI files that is nearly always available
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_set_mui_languages(
+     message_handle_t *message_handle,
+     libcerror_error_t **error )
+{
+	uint32_t language_identifiers[ MESSAGE_HANDLE_MAXIMUM_NUMBER_OF_MUI_LANGUAGES ];
+
+	const system_character_t *language_tag = NULL;
+	static char *function                  = "message_handle_set_mui_languages";
+	size_t language_tag_length             = 0;
+	int language_index                     = 0;
+	int mui_language_index                 = 0;
+	int result                             = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	language_identifiers[ 0 ] = message_handle->preferred_language_identifier;
+	language_identifiers[ 1 ] = 0x00000400UL | ( message_handle->preferred_language_identifier & 0x000003ffUL );
+	language_identifiers[ 2 ] = LANGUAGE_TAG_DEFAULT_LANGUAGE_IDENTIFIER;
+
+	message_handle->number_of_mui_languages = 0;
+
+	for( language_index = 0;
+	     language_index < MESSAGE_HANDLE_MAXIMUM_NUMBER_OF_MUI_LANGUAGES;
+	     language_index++ )
+	{
+		result = language_tag_get_by_identifier(
+		          language_identifiers[ language_index ],
+		          &language_tag,
+		          &language_tag_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve language tag: 0x%08" PRIx32 ".",
+			 function,
+			 language_identifiers[ language_index ] );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		for( mui_language_index = 0;
+		     mui_language_index < message_handle->number_of_mui_languages;
+		     mui_language_index++ )
+		{
+			if( ( message_handle->mui_language_tag_lengths[ mui_language_index ] == language_tag_length )
+			 && ( system_string_compare(
+			       message_handle->mui_language_tags[ mui_language_index ],
+			       language_tag,
+			       language_tag_length ) == 0 ) )
+			{
+				break;
+			}
+		}
+		if( mui_language_index < message_handle->number_of_mui_languages )
+		{
+			continue;
+		}
+		message_handle->mui_language_tags[ message_handle->number_of_mui_languages ]        = language_tag;
+		message_handle->mui_language_tag_lengths[ message_handle->number_of_mui_languages ] = language_tag_length;
+
+		message_handle->number_of_mui_languages += 1;
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of cached resource files
+ * The same maximum applies to the resource files and MUI resource files
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_set_maximum_number_of_cached_resource_files(
+     message_handle_t *message_handle,
+     int maximum_number_of_cached_resource_files,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_set_maximum_number_of_cached_resource_files";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_number_of_entries(
+	     message_handle->resource_file_cache,
+	     maximum_number_of_cached_resource_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of entries in resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_number_of_entries(
+	     message_handle->mui_resource_file_cache,
+	     maximum_number_of_cached_resource_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of entries in MUI resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the message catalog
+ * In lookup mode the values are retrieved from the catalog instead of the registry and resource files,
+ * in record mode the values retrieved from the registry and resource files are added to the catalog
+ * The message catalog is not managed by the message handle
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_set_message_catalog(
+     message_handle_t *message_handle,
+     message_catalog_t *message_catalog,
+     int message_catalog_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_set_message_catalog";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_catalog_mode != MESSAGE_HANDLE_CATALOG_MODE_LOOKUP )
+	 && ( message_catalog_mode != MESSAGE_HANDLE_CATALOG_MODE_RECORD ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported message catalog mode.",
+		 function );
+
+		return( -1 );
+	}
+	message_handle->message_catalog      = message_catalog;
+	message_handle->message_catalog_mode = message_catalog_mode;
+
 	return( 1 );
 }
 
@@ -1602,6 +1854,7 @@ on_error:
 }
 
 /* Opens the input
+ * The registry files are opened on first use, since not every export needs them
  * Returns 1 if successful or -1 on error
  */
 int message_handle_open_input(
@@ -1610,7 +1863,6 @@ int message_handle_open_input(
      libcerror_error_t **error )
 {
 	static char *function = "message_handle_open_input";
-	int result            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -1623,11 +1875,53 @@ int message_handle_open_input(
 
 		return( -1 );
 	}
-	result = message_handle_open_software_registry_file(
-	          message_handle,
-	          error );
+	/* The registry files are not needed when the values are looked up in the message catalog
+	 */
+	if( ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_LOOKUP ) )
+	{
+		return( 1 );
+	}
+	message_handle->eventlog_key_name              = eventlog_key_name;
+	message_handle->use_registry_files             = 1;
+	message_handle->software_registry_file_is_open = 0;
+	message_handle->system_registry_file_is_open   = 0;
 
-	if( result == -1 )
+	return( 1 );
+}
+
+/* Opens the SOFTWARE registry file on first use
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_open_software_registry_file_on_demand(
+     message_handle_t *message_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_open_software_registry_file_on_demand";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_handle->use_registry_files == 0 )
+	 || ( message_handle->software_registry_file_is_open != 0 ) )
+	{
+		return( 1 );
+	}
+	/* The SOFTWARE registry file is opened at most once, also when opening it failed
+	 */
+	message_handle->software_registry_file_is_open = 1;
+
+	if( message_handle_open_software_registry_file(
+	     message_handle,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1638,12 +1932,42 @@ int message_handle_open_input(
 
 		return( -1 );
 	}
-	result = message_handle_open_system_registry_file(
-	          message_handle,
-	          eventlog_key_name,
-	          error );
+	return( 1 );
+}
 
-	if( result == -1 )
+/* Opens the SYSTEM registry file on first use
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_open_system_registry_file_on_demand(
+     message_handle_t *message_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_open_system_registry_file_on_demand";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_handle->use_registry_files == 0 )
+	 || ( message_handle->system_registry_file_is_open != 0 ) )
+	{
+		return( 1 );
+	}
+	/* The SYSTEM registry file is opened at most once, also when opening it failed
+	 */
+	message_handle->system_registry_file_is_open = 1;
+
+	if( message_handle_open_system_registry_file(
+	     message_handle,
+	     message_handle->eventlog_key_name,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1710,7 +2034,7 @@ int message_handle_close_input(
 			result = -1;
 		}
 	}
-	if( libfcache_cache_empty(
+	if( resource_file_cache_empty(
 	     message_handle->resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1723,7 +2047,7 @@ int message_handle_close_input(
 
 		result = -1;
 	}
-	if( libfcache_cache_empty(
+	if( resource_file_cache_empty(
 	     message_handle->mui_resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1736,27 +2060,51 @@ int message_handle_close_input(
 
 		result = -1;
 	}
+	message_handle->use_registry_files             = 0;
+	message_handle->software_registry_file_is_open = 0;
+	message_handle->system_registry_file_is_open   = 0;
+
+	/* The event source values depend on the eventlog key of the SYSTEM registry file
+	 */
+	if( registry_value_cache_empty(
+	     message_handle->registry_value_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty registry value cache.",
+		 function );
+
+		result = -1;
+	}
 	return( result );
 }
 
-/* Retrieves a value for a specific event source
- * The value is retrieved from the event source key in the SYSTEM Windows Registry File if available
- * Returns 1 if successful, 0 if such event source or -1 error
+/* Preloads the resource files of a resource filename into the resource file cache
+ * The resource filename can contain multiple file names separated by ;
+ * Resource files that cannot be opened are skipped and no resource files are
+ * opened once the resource file cache is full
+ * Returns 1 if successful or -1 on error
  */
-int message_handle_get_value_by_event_source(
+int message_handle_preload_resource_files(
      message_handle_t *message_handle,
-     const system_character_t *event_source,
-     size_t event_source_length,
-     const system_character_t *value_name,
-     size_t value_name_length,
-     system_character_t **value_string,
-     size_t *value_string_size,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
      libcerror_error_t **error )
 {
-	libregf_key_t *key     = NULL;
-	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_event_source";
-	int result             = 0;
+	libcerror_error_t *resource_file_error                = NULL;
+	resource_file_t *resource_file                        = NULL;
+	system_character_t *resource_file_path                = NULL;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	static char *function                                 = "message_handle_preload_resource_files";
+	size_t resource_file_path_size                        = 0;
+	size_t resource_filename_string_segment_size          = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -1769,109 +2117,85 @@ int message_handle_get_value_by_event_source(
 
 		return( -1 );
 	}
-	if( value_string == NULL )
+	if( resource_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value string.",
+		 "%s: invalid resource filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( *value_string != NULL )
+	if( system_string_split(
+	     resource_filename,
+	     resource_filename_length + 1,
+	     (system_character_t) ';',
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid value string value already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split resource filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( value_string_size == NULL )
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value string size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resource filename string segments.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( message_handle->control_set_1_eventlog_services_key != NULL )
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
 	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libregf_key_get_sub_key_by_utf16_name(
-			  message_handle->control_set_1_eventlog_services_key,
-			  (uint16_t *) event_source,
-			  event_source_length,
-			  &key,
-			  error );
-#else
-		result = libregf_key_get_sub_key_by_utf8_name(
-			  message_handle->control_set_1_eventlog_services_key,
-			  (uint8_t *) event_source,
-			  event_source_length,
-			  &key,
-			  error );
-#endif
-		if( result == -1 )
+		/* Opening more resource files than fit in the cache would only
+		 * evict the resource files opened before
+		 */
+		if( message_handle->resource_file_cache->number_of_entries >= message_handle->resource_file_cache->maximum_number_of_entries )
+		{
+			break;
+		}
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
+			 "%s: unable to retrieve resource filename string segment: %d.",
 			 function,
-			 event_source );
+			 resource_filename_segment_index );
 
 			goto on_error;
 		}
-	}
-	if( result == 0 )
-	{
-		if( message_handle->control_set_2_eventlog_services_key != NULL )
+		if( ( resource_filename_string_segment == NULL )
+		 || ( resource_filename_string_segment_size <= 1 ) )
 		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libregf_key_get_sub_key_by_utf16_name(
-				  message_handle->control_set_2_eventlog_services_key,
-				  (uint16_t *) event_source,
-				  event_source_length,
-				  &key,
-				  error );
-#else
-			result = libregf_key_get_sub_key_by_utf8_name(
-				  message_handle->control_set_2_eventlog_services_key,
-				  (uint8_t *) event_source,
-				  event_source_length,
-				  &key,
-				  error );
-#endif
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
-				 function,
-				 event_source );
-
-				goto on_error;
-			}
+			continue;
 		}
-	}
-	if( result != 0 )
-	{
-		result = libregf_key_get_value_by_utf8_name(
-			  key,
-			  (uint8_t *) value_name,
-			  value_name_length,
-			  &value,
+		result = message_handle_get_resource_file_from_cache(
+			  message_handle,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size - 1,
+			  &resource_file,
 			  error );
 
 		if( result == -1 )
@@ -1880,158 +2204,173 @@ int message_handle_get_value_by_event_source(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value: %" PRIs_SYSTEM ".",
+			 "%s: unable to retrieve resource file: %d from cache.",
 			 function,
-			 value_name );
+			 resource_filename_segment_index );
 
 			goto on_error;
 		}
 		else if( result != 0 )
 		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libregf_value_get_value_utf16_string_size(
-			          value,
-			          value_string_size,
-			          error );
-#else
-			result = libregf_value_get_value_utf8_string_size(
-			          value,
-			          value_string_size,
-			          error );
-#endif
-			if( result != 1 )
+			continue;
+		}
+		result = message_handle_get_resource_file_path(
+			  message_handle,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size - 1,
+			  NULL,
+			  0,
+			  &resource_file_path,
+			  &resource_file_path_size,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource file path.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( resource_file_path != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value string size.",
-				 function );
+				memory_free(
+				 resource_file_path );
 
-				goto on_error;
+				resource_file_path = NULL;
 			}
-			if( *value_string_size == 0 )
+			if( message_handle_append_missing_resource_file(
+			     message_handle,
+			     message_handle->resource_file_cache,
+			     resource_filename_string_segment,
+			     resource_filename_string_segment_size - 1,
+			     RESOURCE_FILE_CACHE_MISSING_CAUSE_NOT_FOUND,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing value string.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append missing resource file: %d.",
+				 function,
+				 resource_filename_segment_index );
 
 				goto on_error;
 			}
-			*value_string = system_string_allocate(
-					 *value_string_size );
-
-			if( value_string == NULL )
+			continue;
+		}
+		/* The resource file is managed by the cache
+		 */
+		resource_file = NULL;
+
+		if( message_handle_get_resource_file(
+		     message_handle,
+		     resource_filename_string_segment,
+		     resource_filename_string_segment_size - 1,
+		     resource_file_path,
+		     &resource_file,
+		     &resource_file_error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
+				libcnotify_printf(
+				 "%s: unable to preload resource file: %" PRIs_SYSTEM ".\n",
+				 function,
+				 resource_file_path );
 
-				goto on_error;
+				libcnotify_print_error_backtrace(
+				 resource_file_error );
 			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libregf_value_get_value_utf16_string(
-				  value,
-				  (uint16_t *) *value_string,
-				  *value_string_size,
-				  error );
-#else
-			result = libregf_value_get_value_utf8_string(
-				  value,
-				  (uint8_t *) *value_string,
-				  *value_string_size,
-				  error );
 #endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value string.",
-				 function );
+			libcerror_error_free(
+			 &resource_file_error );
 
-				goto on_error;
-			}
-			if( libregf_value_free(
-			     &value,
+			if( message_handle_append_missing_resource_file(
+			     message_handle,
+			     message_handle->resource_file_cache,
+			     resource_filename_string_segment,
+			     resource_filename_string_segment_size - 1,
+			     RESOURCE_FILE_CACHE_MISSING_CAUSE_OPEN_FAILED,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free value.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append missing resource file: %d.",
+				 function,
+				 resource_filename_segment_index );
 
 				goto on_error;
 			}
 		}
-		if( libregf_key_free(
-		     &key,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free key.",
-			 function );
+		resource_file = NULL;
 
-			goto on_error;
-		}
-	}
-	return( result );
+		memory_free(
+		 resource_file_path );
 
-on_error:
-	if( value != NULL )
-	{
-		libregf_value_free(
-		 &value,
-		 NULL );
+		resource_file_path = NULL;
 	}
-	if( key != NULL )
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
-		libregf_key_free(
-		 &key,
-		 NULL );
-	}
-	if( *value_string != NULL )
-	{
-		memory_free(
-		 *value_string );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
+		 function );
 
-		*value_string = NULL;
+		goto on_error;
 	}
-	*value_string_size = 0;
+	return( 1 );
 
+on_error:
+	if( resource_file_path != NULL )
+	{
+		memory_free(
+		 resource_file_path );
+	}
+	if( resource_filename_split_string != NULL )
+	{
+		system_split_string_free(
+		 &resource_filename_split_string,
+		 NULL );
+	}
 	return( -1 );
 }
 
-/* Retrieves a value for a specific provider identifier
- * The value is retrieved from the WINEVT provider key in the SOFTWARE Windows Registry File if available
- * Returns 1 if successful, 0 if such event source or -1 error
+/* Preloads the values and resource files of the sub keys of a key
+ * The sub keys are either the WINEVT publishers or the eventlog services (event sources)
+ * Returns 1 if successful or -1 on error
  */
-int message_handle_get_value_by_provider_identifier(
+int message_handle_preload_sub_keys(
      message_handle_t *message_handle,
-     const system_character_t *provider_identifier,
-     size_t provider_identifier_length,
-     const system_character_t *value_name,
-     size_t value_name_length,
-     system_character_t **value_string,
-     size_t *value_string_size,
+     libregf_key_t *key,
+     uint32_t key_type,
      libcerror_error_t **error )
 {
-	libregf_key_t *key     = NULL;
-	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_provider_identifier";
-	int result             = 0;
+	const system_character_t *value_names[ 2 ];
+	size_t value_name_lengths[ 2 ];
+
+	libregf_key_t *sub_key          = NULL;
+	system_character_t *name        = NULL;
+	system_character_t *value_string = NULL;
+	static char *function           = "message_handle_preload_sub_keys";
+	size_t name_size                = 0;
+	size_t value_string_size        = 0;
+	int number_of_sub_keys          = 0;
+	int number_of_value_names       = 0;
+	int result                      = 0;
+	int sub_key_index               = 0;
+	int value_name_index            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -2044,150 +2383,116 @@ int message_handle_get_value_by_provider_identifier(
 
 		return( -1 );
 	}
-	if( value_string == NULL )
+	if( key_type == MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value string.",
-		 function );
-
-		return( -1 );
+		value_names[ 0 ]        = _SYSTEM_STRING( "ResourceFileName" );
+		value_name_lengths[ 0 ] = 16;
+		value_names[ 1 ]        = _SYSTEM_STRING( "MessageFileName" );
+		value_name_lengths[ 1 ] = 15;
+		number_of_value_names   = 2;
 	}
-	if( *value_string != NULL )
+	else if( key_type == MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE )
+	{
+		value_names[ 0 ]        = _SYSTEM_STRING( "EventMessageFile" );
+		value_name_lengths[ 0 ] = 16;
+		number_of_value_names   = 1;
+	}
+	else
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid value string value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key type.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_string_size == NULL )
+	if( libregf_key_get_number_of_sub_keys(
+	     key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value string size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( message_handle->winevt_publishers_key != NULL )
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
 	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libregf_key_get_sub_key_by_utf16_name(
-			  message_handle->winevt_publishers_key,
-			  (uint16_t *) provider_identifier,
-			  provider_identifier_length,
-			  &key,
-			  error );
-#else
-		result = libregf_key_get_sub_key_by_utf8_name(
-			  message_handle->winevt_publishers_key,
-			  (uint8_t *) provider_identifier,
-			  provider_identifier_length,
-			  &key,
-			  error );
-#endif
-		if( result == -1 )
+		if( libregf_key_get_sub_key(
+		     key,
+		     sub_key_index,
+		     &sub_key,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
+			 "%s: unable to retrieve sub key: %d.",
 			 function,
-			 provider_identifier );
+			 sub_key_index );
 
 			goto on_error;
 		}
-	}
-	if( result != 0 )
-	{
-		result = libregf_key_get_value_by_utf8_name(
-			  key,
-			  (uint8_t *) value_name,
-			  value_name_length,
-			  &value,
-			  error );
-
-		if( result == -1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_utf16_name_size(
+		          sub_key,
+		          &name_size,
+		          error );
+#else
+		result = libregf_key_get_utf8_name_size(
+		          sub_key,
+		          &name_size,
+		          error );
+#endif
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value: %" PRIs_SYSTEM ".",
+			 "%s: unable to retrieve sub key: %d name size.",
 			 function,
-			 value_name );
+			 sub_key_index );
 
 			goto on_error;
 		}
-		else if( result != 0 )
+		if( ( name_size > 1 )
+		 && ( name_size <= (size_t) ( SSIZE_MAX / sizeof( system_character_t ) ) ) )
 		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libregf_value_get_value_utf16_string_size(
-			          value,
-			          value_string_size,
-			          error );
-#else
-			result = libregf_value_get_value_utf8_string_size(
-			          value,
-			          value_string_size,
-			          error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value string size.",
-				 function );
-
-				goto on_error;
-			}
-			if( *value_string_size == 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing value string.",
-				 function );
-
-				goto on_error;
-			}
-			*value_string = system_string_allocate(
-			                 *value_string_size );
+			name = system_string_allocate(
+			        name_size );
 
-			if( value_string == NULL )
+			if( name == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_MEMORY,
 				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
+				 "%s: unable to create name string.",
 				 function );
 
 				goto on_error;
 			}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libregf_value_get_value_utf16_string(
-				  value,
-				  (uint16_t *) *value_string,
-				  *value_string_size,
+			result = libregf_key_get_utf16_name(
+				  sub_key,
+				  (uint16_t *) name,
+				  name_size,
 				  error );
 #else
-			result = libregf_value_get_value_utf8_string(
-				  value,
-				  (uint8_t *) *value_string,
-				  *value_string_size,
+			result = libregf_key_get_utf8_name(
+				  sub_key,
+				  (uint8_t *) name,
+				  name_size,
 				  error );
 #endif
 			if( result != 1 )
@@ -2196,96 +2501,129 @@ int message_handle_get_value_by_provider_identifier(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value string.",
-				 function );
+				 "%s: unable to retrieve sub key: %d name.",
+				 function,
+				 sub_key_index );
 
 				goto on_error;
 			}
-			if( libregf_value_free(
-			     &value,
-			     error ) != 1 )
+			for( value_name_index = 0;
+			     value_name_index < number_of_value_names;
+			     value_name_index++ )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free value.",
-				 function );
+				if( key_type == MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE )
+				{
+					result = message_handle_get_value_by_provider_identifier(
+					          message_handle,
+					          name,
+					          name_size - 1,
+					          value_names[ value_name_index ],
+					          value_name_lengths[ value_name_index ],
+					          &value_string,
+					          &value_string_size,
+					          error );
+				}
+				else
+				{
+					result = message_handle_get_value_by_event_source(
+					          message_handle,
+					          name,
+					          name_size - 1,
+					          value_names[ value_name_index ],
+					          value_name_lengths[ value_name_index ],
+					          &value_string,
+					          &value_string_size,
+					          error );
+				}
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value: %" PRIs_SYSTEM " of sub key: %" PRIs_SYSTEM ".",
+					 function,
+					 value_names[ value_name_index ],
+					 name );
 
-				goto on_error;
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					if( message_handle_preload_resource_files(
+					     message_handle,
+					     value_string,
+					     value_string_size - 1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to preload resource files: %" PRIs_SYSTEM ".",
+						 function,
+						 value_string );
+
+						goto on_error;
+					}
+					memory_free(
+					 value_string );
+
+					value_string = NULL;
+				}
 			}
+			memory_free(
+			 name );
+
+			name = NULL;
 		}
 		if( libregf_key_free(
-		     &key,
+		     &sub_key,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free key.",
-			 function );
+			 "%s: unable to free sub key: %d.",
+			 function,
+			 sub_key_index );
 
 			goto on_error;
 		}
 	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( value != NULL )
+	if( value_string != NULL )
 	{
-		libregf_value_free(
-		 &value,
-		 NULL );
+		memory_free(
+		 value_string );
 	}
-	if( key != NULL )
+	if( name != NULL )
 	{
-		libregf_key_free(
-		 &key,
-		 NULL );
+		memory_free(
+		 name );
 	}
-	if( *value_string != NULL )
+	if( sub_key != NULL )
 	{
-		memory_free(
-		 *value_string );
-
-		*value_string = NULL;
+		libregf_key_free(
+		 &sub_key,
+		 NULL );
 	}
-	*value_string_size = 0;
-
 	return( -1 );
 }
 
-/* Retrieves the path of the resource file based on the resource filename
- * Returns 1 if successful, 0 if not available or -1 error
+/* Preloads the registry values and resource files of all the WINEVT publishers and event sources
+ * The input must be open. This trades a start-up cost for fewer lookups in the registry
+ * files and resource files while the records are exported
+ * Returns 1 if successful or -1 on error
  */
-int message_handle_get_resource_file_path(
+int message_handle_preload(
      message_handle_t *message_handle,
-     const system_character_t *resource_filename,
-     size_t resource_filename_length,
-     const system_character_t *language_string,
-     size_t language_string_length,
-     system_character_t **resource_file_path,
-     size_t *resource_file_path_size,
      libcerror_error_t **error )
 {
-	system_character_t *mui_string                        = NULL;
-	system_character_t *resource_filename_string_segment  = NULL;
-	system_split_string_t *resource_filename_split_string = NULL;
-	static char *function                                 = "message_handle_get_resource_file_path";
-	size_t mui_string_size                                = 0;
-	size_t resource_file_path_index                       = 0;
-	size_t resource_filename_directory_name_index         = 0;
-	size_t resource_filename_string_segment_size          = 0;
-	size_t resource_files_path_length                     = 0;
-	uint8_t directory_entry_type                          = 0;
-	int resource_filename_number_of_segments              = 0;
-	int resource_filename_segment_index                   = 0;
-	int result                                            = 0;
-
-#if defined( WINAPI )
-	const system_character_t *volume_letter               = NULL;
-#endif
+	static char *function = "message_handle_preload";
 
 	if( message_handle == NULL )
 	{
@@ -2298,645 +2636,2076 @@ int message_handle_get_resource_file_path(
 
 		return( -1 );
 	}
-	if( message_handle->system_root_path == NULL )
+	/* The registry files are not used when the values are looked up in the message catalog
+	 */
+	if( ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_LOOKUP ) )
+	{
+		return( 1 );
+	}
+	if( message_handle_open_software_registry_file_on_demand(
+	     message_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid message handle - missing system root path.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open software registry file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( message_handle->system_root_path_size < 4 )
-	 || ( message_handle->system_root_path_size > (size_t) SSIZE_MAX ) )
+	if( message_handle_open_system_registry_file_on_demand(
+	     message_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid message handle - system root path size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open system registry file.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_filename == NULL )
+	if( message_handle->winevt_publishers_key != NULL )
+	{
+		if( message_handle_preload_sub_keys(
+		     message_handle,
+		     message_handle->winevt_publishers_key,
+		     MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to preload WINEVT publishers.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( message_handle->control_set_1_eventlog_services_key != NULL )
+	{
+		if( message_handle_preload_sub_keys(
+		     message_handle,
+		     message_handle->control_set_1_eventlog_services_key,
+		     MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to preload control set 1 event sources.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( message_handle->control_set_2_eventlog_services_key != NULL )
+	{
+		if( message_handle_preload_sub_keys(
+		     message_handle,
+		     message_handle->control_set_2_eventlog_services_key,
+		     MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to preload control set 2 event sources.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a copy of a value from the registry value cache
+ * The value string is set to NULL if the value was cached as not available
+ * Returns 1 if the value is cached, 0 if not or -1 error
+ */
+int message_handle_get_value_from_cache(
+     message_handle_t *message_handle,
+     uint32_t key_type,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "message_handle_get_value_from_cache";
+	int result                                = 0;
+
+	if( message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource filename.",
+		 "%s: invalid message handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_filename_length == 0 )
+	if( value_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid resource filename length is zero.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_filename_length > (size_t) SSIZE_MAX )
+	if( value_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid resource filename length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( language_string != NULL )
+	result = registry_value_cache_get_entry(
+	          message_handle->registry_value_cache,
+	          key_type,
+	          key_name,
+	          key_name_length,
+	          value_name,
+	          value_name_length,
+	          &cache_entry,
+	          error );
+
+	if( result == -1 )
 	{
-		if( language_string_length > (size_t) SSIZE_MAX )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %" PRIs_SYSTEM " from registry value cache.",
+		 function,
+		 value_name );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	*value_string      = NULL;
+	*value_string_size = 0;
+
+	if( cache_entry->value_string != NULL )
+	{
+		*value_string = system_string_allocate(
+		                 cache_entry->value_string_size );
+
+		if( *value_string == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid language string length value exceeds maximum.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			return( -1 );
+		}
+		if( system_string_copy(
+		     *value_string,
+		     cache_entry->value_string,
+		     cache_entry->value_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value string.",
 			 function );
 
+			memory_free(
+			 *value_string );
+
+			*value_string = NULL;
+
 			return( -1 );
 		}
+		*value_string_size = cache_entry->value_string_size;
 	}
-	if( resource_file_path == NULL )
+	return( 1 );
+}
+
+/* Retrieves a value for a specific event source
+ * The value is retrieved from the event source key in the SYSTEM Windows Registry File if available
+ * Returns 1 if successful, 0 if such event source or -1 error
+ */
+int message_handle_get_value_by_event_source(
+     message_handle_t *message_handle,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	libregf_key_t *key     = NULL;
+	libregf_value_t *value = NULL;
+	static char *function  = "message_handle_get_value_by_event_source";
+	int result             = 0;
+
+	if( message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file path.",
+		 "%s: invalid message handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *resource_file_path != NULL )
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_string != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid resource file path value already set.",
+		 "%s: invalid value string value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_file_path_size == NULL )
+	if( value_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file path size.",
+		 "%s: invalid value string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_filename_length > 2 )
-	{
-		/* Check if the resource filename starts with a volume letter
-		 */
-		if( ( resource_filename[ 1 ] == (system_character_t) ':' )
-		 && ( ( ( resource_filename[ 0 ] >= (system_character_t) 'A' )
-		   &&   ( resource_filename[ 0 ] <= (system_character_t) 'Z' ) )
-		  || ( ( resource_filename[ 0 ] >= (system_character_t) 'a' )
-		   &&  ( resource_filename[ 0 ] <= (system_character_t) 'z' ) ) ) )
+	if( ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_LOOKUP ) )
+	{
+		result = message_catalog_get_registry_value(
+		          message_handle->message_catalog,
+		          MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE,
+		          event_source,
+		          event_source_length,
+		          value_name,
+		          value_name_length,
+		          value_string,
+		          value_string_size,
+		          error );
+
+		if( result == -1 )
 		{
-			resource_filename_directory_name_index = 2;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM " from message catalog.",
+			 function,
+			 value_name );
 
-			if( ( resource_filename_length >= 3 )
-			 && ( resource_filename[ 2 ] == (system_character_t) '\\' ) )
-			{
-				resource_filename_directory_name_index += 1;
-			}
-#if defined( WINAPI )
-			volume_letter = resource_filename;
-#endif
+			return( -1 );
 		}
+		return( result );
 	}
-	if( system_string_split(
-	     &( resource_filename[ resource_filename_directory_name_index ] ),
-	     resource_filename_length - resource_filename_directory_name_index + 1,
-	     (system_character_t) '\\',
-	     &resource_filename_split_string,
-	     error ) != 1 )
+	/* Every value is looked up in the registry file at most once
+	 */
+	result = message_handle_get_value_from_cache(
+	          message_handle,
+	          MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE,
+	          event_source,
+	          event_source_length,
+	          value_name,
+	          value_name_length,
+	          value_string,
+	          value_string_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split resource filename.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %" PRIs_SYSTEM " from cache.",
+		 function,
+		 value_name );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( system_split_string_get_number_of_segments(
-	     resource_filename_split_string,
-	     &resource_filename_number_of_segments,
+	else if( result != 0 )
+	{
+		if( *value_string == NULL )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( message_handle_open_system_registry_file_on_demand(
+	     message_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resource filename string segments.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open system registry file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*resource_file_path_size = 0;
-
-	for( resource_filename_segment_index = 0;
-	     resource_filename_segment_index < resource_filename_number_of_segments;
-	     resource_filename_segment_index++ )
+	if( message_handle->control_set_1_eventlog_services_key != NULL )
 	{
-		if( system_split_string_get_segment_by_index(
-		     resource_filename_split_string,
-		     resource_filename_segment_index,
-		     &resource_filename_string_segment,
-		     &resource_filename_string_segment_size,
-		     error ) != 1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_sub_key_by_utf16_name(
+			  message_handle->control_set_1_eventlog_services_key,
+			  (uint16_t *) event_source,
+			  event_source_length,
+			  &key,
+			  error );
+#else
+		result = libregf_key_get_sub_key_by_utf8_name(
+			  message_handle->control_set_1_eventlog_services_key,
+			  (uint8_t *) event_source,
+			  event_source_length,
+			  &key,
+			  error );
+#endif
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename string segment: %d.",
+			 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
 			 function,
-			 resource_filename_segment_index );
+			 event_source );
 
 			goto on_error;
 		}
-		if( resource_filename_string_segment == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
-
-			goto on_error;
-		}
-		if( resource_filename_string_segment_size == 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported empty resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
-
-			goto on_error;
-		}
-		else if( ( resource_filename_string_segment_size == 2 )
-		      && ( resource_filename_string_segment[ 0 ] == (system_character_t) '.' ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported relative path in resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
-
-			goto on_error;
-		}
-		else if( ( resource_filename_string_segment_size == 3 )
-		      && ( resource_filename_string_segment[ 0 ] == (system_character_t) '.' )
-		      && ( resource_filename_string_segment[ 1 ] == (system_character_t) '.' ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported relative path in resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
-
-			goto on_error;
-		}
-		else if( ( resource_filename_string_segment[ 0 ] == (system_character_t) '%' )
-		      && ( resource_filename_string_segment[ resource_filename_string_segment_size - 2 ] == (system_character_t) '%' ) )
+	}
+	if( result == 0 )
+	{
+		if( message_handle->control_set_2_eventlog_services_key != NULL )
 		{
-			if( resource_filename_string_segment_size == 9 )
-			{
-				/* Expand %WinDir% to WINDOWS
-				 */
-				if( system_string_compare_no_case(
-				     resource_filename_string_segment,
-				     _SYSTEM_STRING( "%WinDir%" ),
-				     8 ) == 0 )
-				{
-					resource_filename_string_segment_size = 8;
-#if defined( WINAPI )
-					volume_letter = message_handle->windows_directory_path;
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libregf_key_get_sub_key_by_utf16_name(
+				  message_handle->control_set_2_eventlog_services_key,
+				  (uint16_t *) event_source,
+				  event_source_length,
+				  &key,
+				  error );
+#else
+			result = libregf_key_get_sub_key_by_utf8_name(
+				  message_handle->control_set_2_eventlog_services_key,
+				  (uint8_t *) event_source,
+				  event_source_length,
+				  &key,
+				  error );
 #endif
-				}
-			}
-			else if( resource_filename_string_segment_size == 13 )
+			if( result == -1 )
 			{
-				/* Expand %SystemRoot%
-				 */
-				if( system_string_compare_no_case(
-				     resource_filename_string_segment,
-				     _SYSTEM_STRING( "%SystemRoot%" ),
-				     12 ) == 0 )
-				{
-					resource_filename_string_segment_size = message_handle->system_root_path_size - 3;
-#if defined( WINAPI )
-					volume_letter = message_handle->system_root_path;
-#endif
-				}
-			}
-		}
-		*resource_file_path_size += resource_filename_string_segment_size;
-	}
-	if( language_string != NULL )
-	{
-		/* Add: <LANGUAGE>/<FILENAME>.mui
-		 */
-		*resource_file_path_size += language_string_length + 5;
-	}
-	if( message_handle->resource_files_path != NULL )
-	{
-		resource_files_path_length = system_string_length(
-		                              message_handle->resource_files_path );
-	}
-	if( ( message_handle->resource_files_path != NULL )
-	 && ( resource_files_path_length > 0 ) )
-	{
-		*resource_file_path_size += resource_files_path_length;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
+				 function,
+				 event_source );
 
-		if( message_handle->resource_files_path[ resource_files_path_length - 1 ] != (system_character_t) LIBCPATH_SEPARATOR )
-		{
-			*resource_file_path_size += 1;
+				goto on_error;
+			}
 		}
 	}
-#if defined( WINAPI )
-	else if( volume_letter != NULL )
-	{
-		*resource_file_path_size += 3;
-	}
-#endif
-	else
-	{
-		*resource_file_path_size += 2;
-	}
-	*resource_file_path_size += 1;
-
-	*resource_file_path = system_string_allocate(
-	                       *resource_file_path_size );
-
-	if( *resource_file_path == NULL )
+	if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create resource file path.",
-		 function );
-
-		goto on_error;
-	}
-	resource_file_path_index = 0;
+		result = libregf_key_get_value_by_utf8_name(
+			  key,
+			  (uint8_t *) value_name,
+			  value_name_length,
+			  &value,
+			  error );
 
-	if( ( message_handle->resource_files_path != NULL )
-	 && ( resource_files_path_length > 0 ) )
-	{
-		if( system_string_copy(
-		     &( ( *resource_file_path )[ resource_file_path_index ] ),
-		     message_handle->resource_files_path,
-		     resource_files_path_length ) == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy resource files path to resource file path.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM ".",
+			 function,
+			 value_name );
 
 			goto on_error;
 		}
-		resource_file_path_index += resource_files_path_length;
-
-		if( message_handle->resource_files_path[ resource_files_path_length - 1 ] != (system_character_t) LIBCPATH_SEPARATOR )
+		else if( result != 0 )
 		{
-			( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
-		}
-	}
-#if defined( WINAPI )
-	else if( volume_letter != NULL )
-	{
-		( *resource_file_path )[ resource_file_path_index++ ] = volume_letter[ 0 ];
-		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) ':';
-		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
-	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libregf_value_get_value_utf16_string_size(
+			          value,
+			          value_string_size,
+			          error );
+#else
+			result = libregf_value_get_value_utf8_string_size(
+			          value,
+			          value_string_size,
+			          error );
 #endif
-	else
-	{
-		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) '.';
-		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
-	}
-	for( resource_filename_segment_index = 0;
-	     resource_filename_segment_index < resource_filename_number_of_segments;
-	     resource_filename_segment_index++ )
-	{
-		if( ( language_string != NULL )
-		 && ( resource_filename_segment_index == ( resource_filename_number_of_segments - 1 ) ) )
-		{
-			/* Make a copy of the language string so it can be written to
-			 */
-			mui_string_size = language_string_length + 1;
-
-			mui_string = system_string_allocate(
-			              mui_string_size );
-
-			if( mui_string == NULL )
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create MUI language string.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value string size.",
 				 function );
 
 				goto on_error;
 			}
-			if( system_string_copy(
-			     mui_string,
-			     language_string,
-			     language_string_length ) == NULL )
+			if( *value_string_size == 0 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy MUI language string.",
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing value string.",
 				 function );
 
 				goto on_error;
 			}
-			mui_string[ language_string_length ] = 0;
-
-			( *resource_file_path )[ resource_file_path_index ] = 0;
-
-			result = path_handle_get_directory_entry_name_by_name_no_case(
-				  message_handle->path_handle,
-				  *resource_file_path,
-				  resource_file_path_index + 1,
-				  mui_string,
-				  mui_string_size,
-				  LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
-				  error );
+			*value_string = system_string_allocate(
+					 *value_string_size );
 
-			if( result == -1 )
+			if( value_string == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_GENERIC,
-				 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
-				 function,
-				 mui_string );
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libregf_value_get_value_utf16_string(
+				  value,
+				  (uint16_t *) *value_string,
+				  *value_string_size,
+				  error );
+#else
+			result = libregf_value_get_value_utf8_string(
+				  value,
+				  (uint8_t *) *value_string,
+				  *value_string_size,
+				  error );
+#endif
+			if( result != 1 )
 			{
-				if( system_string_copy(
-				     &( ( *resource_file_path )[ resource_file_path_index ] ),
-				     mui_string,
-				     language_string_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set MUI language string in resource file path.",
-					 function );
-
-					goto on_error;
-				}
-				resource_file_path_index += language_string_length;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value string.",
+				 function );
 
-				( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+				goto on_error;
 			}
-			memory_free(
-			 mui_string );
-
-			mui_string = NULL;
-
-			if( result == 0 )
+			if( libregf_value_free(
+			     &value,
+			     error ) != 1 )
 			{
-				break;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value.",
+				 function );
+
+				goto on_error;
 			}
 		}
-		if( system_split_string_get_segment_by_index(
-		     resource_filename_split_string,
-		     resource_filename_segment_index,
-		     &resource_filename_string_segment,
-		     &resource_filename_string_segment_size,
+		if( libregf_key_free(
+		     &key,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key.",
+			 function );
 
 			goto on_error;
 		}
-		if( resource_filename_string_segment == NULL )
+	}
+	if( registry_value_cache_append_value(
+	     message_handle->registry_value_cache,
+	     MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE,
+	     event_source,
+	     event_source_length,
+	     value_name,
+	     value_name_length,
+	     ( result != 0 ) ? *value_string : NULL,
+	     ( result != 0 ) ? *value_string_size : 0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value: %" PRIs_SYSTEM " to cache.",
+		 function,
+		 value_name );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_RECORD ) )
+	{
+		if( message_catalog_set_registry_value(
+		     message_handle->message_catalog,
+		     MESSAGE_CATALOG_KEY_TYPE_EVENT_SOURCE_VALUE,
+		     event_source,
+		     event_source_length,
+		     value_name,
+		     value_name_length,
+		     *value_string,
+		     *value_string_size,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing resource filename string segment: %d.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to record value: %" PRIs_SYSTEM " in message catalog.",
 			 function,
-			 resource_filename_segment_index );
+			 value_name );
 
 			goto on_error;
 		}
-		if( ( resource_filename_string_segment[ 0 ] == (system_character_t) '%' )
-		 && ( resource_filename_string_segment[ resource_filename_string_segment_size - 2 ] == (system_character_t) '%' ) )
+	}
+	return( result );
+
+on_error:
+	if( value != NULL )
+	{
+		libregf_value_free(
+		 &value,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libregf_key_free(
+		 &key,
+		 NULL );
+	}
+	if( *value_string != NULL )
+	{
+		memory_free(
+		 *value_string );
+
+		*value_string = NULL;
+	}
+	*value_string_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a value for a specific provider identifier
+ * The value is retrieved from the WINEVT provider key in the SOFTWARE Windows Registry File if available
+ * Returns 1 if successful, 0 if such event source or -1 error
+ */
+int message_handle_get_value_by_provider_identifier(
+     message_handle_t *message_handle,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	libregf_key_t *key     = NULL;
+	libregf_value_t *value = NULL;
+	static char *function  = "message_handle_get_value_by_provider_identifier";
+	int result             = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_LOOKUP ) )
+	{
+		result = message_catalog_get_registry_value(
+		          message_handle->message_catalog,
+		          MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE,
+		          provider_identifier,
+		          provider_identifier_length,
+		          value_name,
+		          value_name_length,
+		          value_string,
+		          value_string_size,
+		          error );
+
+		if( result == -1 )
 		{
-			if( resource_filename_string_segment_size == 9 )
-			{
-				/* Expand %WinDir%
-				 */
-				if( system_string_compare_no_case(
-				     resource_filename_string_segment,
-				     _SYSTEM_STRING( "%WinDir%" ),
-				     8 ) == 0 )
-				{
-					resource_filename_string_segment      = &( ( message_handle->windows_directory_path )[ 3 ] );
-					resource_filename_string_segment_size = message_handle->windows_directory_path_size - 3;
-				}
-			}
-			else if( resource_filename_string_segment_size == 13 )
-			{
-				/* Expand %SystemRoot%
-				 */
-				if( system_string_compare_no_case(
-				     resource_filename_string_segment,
-				     _SYSTEM_STRING( "%SystemRoot%" ),
-				     12 ) == 0 )
-				{
-					resource_filename_string_segment      = &( ( message_handle->system_root_path )[ 3 ] );
-					resource_filename_string_segment_size = message_handle->system_root_path_size - 3;
-				}
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM " from message catalog.",
+			 function,
+			 value_name );
+
+			return( -1 );
 		}
-		if( resource_filename_segment_index < ( resource_filename_number_of_segments - 1 ) )
+		return( result );
+	}
+	/* Every value is looked up in the registry file at most once
+	 */
+	result = message_handle_get_value_from_cache(
+	          message_handle,
+	          MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE,
+	          provider_identifier,
+	          provider_identifier_length,
+	          value_name,
+	          value_name_length,
+	          value_string,
+	          value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %" PRIs_SYSTEM " from cache.",
+		 function,
+		 value_name );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( *value_string == NULL )
 		{
-			directory_entry_type = LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY;
+			return( 0 );
 		}
-		else
-		{
-			if( language_string != NULL )
-			{
-				/* Add .mui to the filename
-			 	 */
-				mui_string = system_string_allocate(
-					      resource_filename_string_segment_size + 4 );
-
-				if( mui_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		return( 1 );
+	}
+	if( message_handle_open_software_registry_file_on_demand(
+	     message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open software registry file.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle->winevt_publishers_key != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_sub_key_by_utf16_name(
+			  message_handle->winevt_publishers_key,
+			  (uint16_t *) provider_identifier,
+			  provider_identifier_length,
+			  &key,
+			  error );
+#else
+		result = libregf_key_get_sub_key_by_utf8_name(
+			  message_handle->winevt_publishers_key,
+			  (uint8_t *) provider_identifier,
+			  provider_identifier_length,
+			  &key,
+			  error );
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
+			 function,
+			 provider_identifier );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libregf_key_get_value_by_utf8_name(
+			  key,
+			  (uint8_t *) value_name,
+			  value_name_length,
+			  &value,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM ".",
+			 function,
+			 value_name );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libregf_value_get_value_utf16_string_size(
+			          value,
+			          value_string_size,
+			          error );
+#else
+			result = libregf_value_get_value_utf8_string_size(
+			          value,
+			          value_string_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value string size.",
+				 function );
+
+				goto on_error;
+			}
+			if( *value_string_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing value string.",
+				 function );
+
+				goto on_error;
+			}
+			*value_string = system_string_allocate(
+			                 *value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libregf_value_get_value_utf16_string(
+				  value,
+				  (uint16_t *) *value_string,
+				  *value_string_size,
+				  error );
+#else
+			result = libregf_value_get_value_utf8_string(
+				  value,
+				  (uint8_t *) *value_string,
+				  *value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value string.",
+				 function );
+
+				goto on_error;
+			}
+			if( libregf_value_free(
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libregf_key_free(
+		     &key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( registry_value_cache_append_value(
+	     message_handle->registry_value_cache,
+	     MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE,
+	     provider_identifier,
+	     provider_identifier_length,
+	     value_name,
+	     value_name_length,
+	     ( result != 0 ) ? *value_string : NULL,
+	     ( result != 0 ) ? *value_string_size : 0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value: %" PRIs_SYSTEM " to cache.",
+		 function,
+		 value_name );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_RECORD ) )
+	{
+		if( message_catalog_set_registry_value(
+		     message_handle->message_catalog,
+		     MESSAGE_CATALOG_KEY_TYPE_PROVIDER_IDENTIFIER_VALUE,
+		     provider_identifier,
+		     provider_identifier_length,
+		     value_name,
+		     value_name_length,
+		     *value_string,
+		     *value_string_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to record value: %" PRIs_SYSTEM " in message catalog.",
+			 function,
+			 value_name );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( value != NULL )
+	{
+		libregf_value_free(
+		 &value,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libregf_key_free(
+		 &key,
+		 NULL );
+	}
+	if( *value_string != NULL )
+	{
+		memory_free(
+		 *value_string );
+
+		*value_string = NULL;
+	}
+	*value_string_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the path of the resource file based on the resource filename
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int message_handle_get_resource_file_path(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const system_character_t *language_string,
+     size_t language_string_length,
+     system_character_t **resource_file_path,
+     size_t *resource_file_path_size,
+     libcerror_error_t **error )
+{
+	system_character_t *mui_string                        = NULL;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	static char *function                                 = "message_handle_get_resource_file_path";
+	size_t mui_string_size                                = 0;
+	size_t resource_file_path_index                       = 0;
+	size_t resource_filename_directory_name_index         = 0;
+	size_t resource_filename_string_segment_size          = 0;
+	size_t resource_files_path_length                     = 0;
+	uint8_t directory_entry_type                          = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
+
+#if defined( WINAPI )
+	const system_character_t *volume_letter               = NULL;
+#endif
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The system root path is read from the SOFTWARE registry file
+	 */
+	if( message_handle_open_software_registry_file_on_demand(
+	     message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open software registry file.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle->system_root_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message handle - missing system root path.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( message_handle->system_root_path_size < 4 )
+	 || ( message_handle->system_root_path_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message handle - system root path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid resource filename length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid resource filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( language_string != NULL )
+	{
+		if( language_string_length > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid language string length value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( resource_file_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_filename_length > 2 )
+	{
+		/* Check if the resource filename starts with a volume letter
+		 */
+		if( ( resource_filename[ 1 ] == (system_character_t) ':' )
+		 && ( ( ( resource_filename[ 0 ] >= (system_character_t) 'A' )
+		   &&   ( resource_filename[ 0 ] <= (system_character_t) 'Z' ) )
+		  || ( ( resource_filename[ 0 ] >= (system_character_t) 'a' )
+		   &&  ( resource_filename[ 0 ] <= (system_character_t) 'z' ) ) ) )
+		{
+			resource_filename_directory_name_index = 2;
+
+			if( ( resource_filename_length >= 3 )
+			 && ( resource_filename[ 2 ] == (system_character_t) '\\' ) )
+			{
+				resource_filename_directory_name_index += 1;
+			}
+#if defined( WINAPI )
+			volume_letter = resource_filename;
+#endif
+		}
+	}
+	if( system_string_split(
+	     &( resource_filename[ resource_filename_directory_name_index ] ),
+	     resource_filename_length - resource_filename_directory_name_index + 1,
+	     (system_character_t) '\\',
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split resource filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resource filename string segments.",
+		 function );
+
+		goto on_error;
+	}
+	*resource_file_path_size = 0;
+
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
+	{
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		if( resource_filename_string_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		if( resource_filename_string_segment_size == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported empty resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		else if( ( resource_filename_string_segment_size == 2 )
+		      && ( resource_filename_string_segment[ 0 ] == (system_character_t) '.' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported relative path in resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		else if( ( resource_filename_string_segment_size == 3 )
+		      && ( resource_filename_string_segment[ 0 ] == (system_character_t) '.' )
+		      && ( resource_filename_string_segment[ 1 ] == (system_character_t) '.' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported relative path in resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		else if( ( resource_filename_string_segment[ 0 ] == (system_character_t) '%' )
+		      && ( resource_filename_string_segment[ resource_filename_string_segment_size - 2 ] == (system_character_t) '%' ) )
+		{
+			if( resource_filename_string_segment_size == 9 )
+			{
+				/* Expand %WinDir% to WINDOWS
+				 */
+				if( system_string_compare_no_case(
+				     resource_filename_string_segment,
+				     _SYSTEM_STRING( "%WinDir%" ),
+				     8 ) == 0 )
+				{
+					resource_filename_string_segment_size = 8;
+#if defined( WINAPI )
+					volume_letter = message_handle->windows_directory_path;
+#endif
+				}
+			}
+			else if( resource_filename_string_segment_size == 13 )
+			{
+				/* Expand %SystemRoot%
+				 */
+				if( system_string_compare_no_case(
+				     resource_filename_string_segment,
+				     _SYSTEM_STRING( "%SystemRoot%" ),
+				     12 ) == 0 )
+				{
+					resource_filename_string_segment_size = message_handle->system_root_path_size - 3;
+#if defined( WINAPI )
+					volume_letter = message_handle->system_root_path;
+#endif
+				}
+			}
+		}
+		*resource_file_path_size += resource_filename_string_segment_size;
+	}
+	if( language_string != NULL )
+	{
+		/* Add: <LANGUAGE>/<FILENAME>.mui
+		 */
+		*resource_file_path_size += language_string_length + 5;
+	}
+	if( message_handle->resource_files_path != NULL )
+	{
+		resource_files_path_length = system_string_length(
+		                              message_handle->resource_files_path );
+	}
+	if( ( message_handle->resource_files_path != NULL )
+	 && ( resource_files_path_length > 0 ) )
+	{
+		*resource_file_path_size += resource_files_path_length;
+
+		if( message_handle->resource_files_path[ resource_files_path_length - 1 ] != (system_character_t) LIBCPATH_SEPARATOR )
+		{
+			*resource_file_path_size += 1;
+		}
+	}
+#if defined( WINAPI )
+	else if( volume_letter != NULL )
+	{
+		*resource_file_path_size += 3;
+	}
+#endif
+	else
+	{
+		*resource_file_path_size += 2;
+	}
+	*resource_file_path_size += 1;
+
+	*resource_file_path = system_string_allocate(
+	                       *resource_file_path_size );
+
+	if( *resource_file_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file path.",
+		 function );
+
+		goto on_error;
+	}
+	resource_file_path_index = 0;
+
+	if( ( message_handle->resource_files_path != NULL )
+	 && ( resource_files_path_length > 0 ) )
+	{
+		if( system_string_copy(
+		     &( ( *resource_file_path )[ resource_file_path_index ] ),
+		     message_handle->resource_files_path,
+		     resource_files_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy resource files path to resource file path.",
+			 function );
+
+			goto on_error;
+		}
+		resource_file_path_index += resource_files_path_length;
+
+		if( message_handle->resource_files_path[ resource_files_path_length - 1 ] != (system_character_t) LIBCPATH_SEPARATOR )
+		{
+			( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+		}
+	}
+#if defined( WINAPI )
+	else if( volume_letter != NULL )
+	{
+		( *resource_file_path )[ resource_file_path_index++ ] = volume_letter[ 0 ];
+		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) ':';
+		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+	}
+#endif
+	else
+	{
+		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) '.';
+		( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+	}
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
+	{
+		if( ( language_string != NULL )
+		 && ( resource_filename_segment_index == ( resource_filename_number_of_segments - 1 ) ) )
+		{
+			/* Make a copy of the language string so it can be written to
+			 */
+			mui_string_size = language_string_length + 1;
+
+			mui_string = system_string_allocate(
+			              mui_string_size );
+
+			if( mui_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create MUI language string.",
+				 function );
+
+				goto on_error;
+			}
+			if( system_string_copy(
+			     mui_string,
+			     language_string,
+			     language_string_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy MUI language string.",
+				 function );
+
+				goto on_error;
+			}
+			mui_string[ language_string_length ] = 0;
+
+			( *resource_file_path )[ resource_file_path_index ] = 0;
+
+			result = path_handle_get_directory_entry_name_by_name_no_case(
+				  message_handle->path_handle,
+				  *resource_file_path,
+				  resource_file_path_index + 1,
+				  mui_string,
+				  mui_string_size,
+				  LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
+				 function,
+				 mui_string );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( system_string_copy(
+				     &( ( *resource_file_path )[ resource_file_path_index ] ),
+				     mui_string,
+				     language_string_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set MUI language string in resource file path.",
+					 function );
+
+					goto on_error;
+				}
+				resource_file_path_index += language_string_length;
+
+				( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+			}
+			memory_free(
+			 mui_string );
+
+			mui_string = NULL;
+
+			if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		if( resource_filename_string_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		if( ( resource_filename_string_segment[ 0 ] == (system_character_t) '%' )
+		 && ( resource_filename_string_segment[ resource_filename_string_segment_size - 2 ] == (system_character_t) '%' ) )
+		{
+			if( resource_filename_string_segment_size == 9 )
+			{
+				/* Expand %WinDir%
+				 */
+				if( system_string_compare_no_case(
+				     resource_filename_string_segment,
+				     _SYSTEM_STRING( "%WinDir%" ),
+				     8 ) == 0 )
+				{
+					resource_filename_string_segment      = &( ( message_handle->windows_directory_path )[ 3 ] );
+					resource_filename_string_segment_size = message_handle->windows_directory_path_size - 3;
+				}
+			}
+			else if( resource_filename_string_segment_size == 13 )
+			{
+				/* Expand %SystemRoot%
+				 */
+				if( system_string_compare_no_case(
+				     resource_filename_string_segment,
+				     _SYSTEM_STRING( "%SystemRoot%" ),
+				     12 ) == 0 )
+				{
+					resource_filename_string_segment      = &( ( message_handle->system_root_path )[ 3 ] );
+					resource_filename_string_segment_size = message_handle->system_root_path_size - 3;
+				}
+			}
+		}
+		if( resource_filename_segment_index < ( resource_filename_number_of_segments - 1 ) )
+		{
+			directory_entry_type = LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY;
+		}
+		else
+		{
+			if( language_string != NULL )
+			{
+				/* Add .mui to the filename
+			 	 */
+				mui_string = system_string_allocate(
+					      resource_filename_string_segment_size + 4 );
+
+				if( mui_string == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
 					 "%s: unable to create MUI resource filename string.",
 					 function );
 
-					goto on_error;
-				}
-				resource_filename_string_segment_size--;
+					goto on_error;
+				}
+				resource_filename_string_segment_size--;
+
+				if( system_string_copy(
+				     mui_string,
+				     resource_filename_string_segment,
+				     resource_filename_string_segment_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy MUI resource filename string.",
+					 function );
+
+					goto on_error;
+				}
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) '.';
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'm';
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'u';
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'i';
+				mui_string[ resource_filename_string_segment_size++ ] = 0;
+
+				resource_filename_string_segment = mui_string;
+			}
+			directory_entry_type = LIBCDIRECTORY_ENTRY_TYPE_FILE;
+		}
+		( *resource_file_path )[ resource_file_path_index ] = 0;
+
+		result = path_handle_get_directory_entry_name_by_name_no_case(
+		          message_handle->path_handle,
+		          *resource_file_path,
+		          resource_file_path_index + 1,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size,
+		          directory_entry_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
+			 function,
+			 resource_filename_string_segment );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( system_string_copy(
+			     &( ( *resource_file_path )[ resource_file_path_index ] ),
+			     resource_filename_string_segment,
+			     resource_filename_string_segment_size - 1 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set resource filename string segment: %d in resource file path.",
+				 function,
+				 resource_filename_segment_index );
+
+				goto on_error;
+			}
+			resource_file_path_index += resource_filename_string_segment_size - 1;
+
+			( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+		}
+		if( mui_string != NULL )
+		{
+			memory_free(
+			 mui_string );
+
+			mui_string = NULL;
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+	}
+	( *resource_file_path )[ resource_file_path_index - 1 ] = 0;
+
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( mui_string != NULL )
+	{
+		memory_free(
+		 mui_string );
+	}
+	if( resource_filename_split_string != NULL )
+	{
+		system_split_string_free(
+		 &resource_filename_split_string,
+		 NULL );
+	}
+	if( *resource_file_path != NULL )
+	{
+		memory_free(
+		 *resource_file_path );
+
+		*resource_file_path = NULL;
+	}
+	*resource_file_path_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a specific resource file and adds it to the cache
+ * Returns 1 if successful, 0 if resource file was not found or -1 error
+ */
+int message_handle_get_resource_file(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const system_character_t *resource_file_path,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_resource_file";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_initialize(
+	     resource_file,
+	     message_handle->preferred_language_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resource file.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_file_set_name(
+	     *resource_file,
+	     resource_filename,
+	     resource_filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in resource file.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_file_open(
+	     *resource_file,
+	     resource_file_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
+		 function,
+		 resource_file_path );
+
+		goto on_error;
+	}
+	/* The cache manages the resource file from here on, also on error
+	 */
+	if( resource_file_cache_append_resource_file(
+	     message_handle->resource_file_cache,
+	     *resource_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append resource file to cache.",
+		 function );
+
+		*resource_file = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *resource_file != NULL )
+	{
+		resource_file_free(
+		 resource_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific resource file from the cache
+ * The resource file is set to NULL if it was cached as missing
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int message_handle_get_resource_file_from_cache(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_resource_file_from_cache";
+	int missing_cause     = 0;
+	int result            = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_cache_get_resource_file_by_name(
+	          message_handle->resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* A resource file that was not found before is not searched for again
+		 */
+		result = resource_file_cache_get_missing_cause_by_name(
+		          message_handle->resource_file_cache,
+		          resource_filename,
+		          resource_filename_length,
+		          &missing_cause,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve missing cause of resource file from cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the path of the MUI resource file based on the resource filename
+ * The MUI resource file path is: %PATH%/%LANGUAGE%/%FILENAME%.mui where the first
+ * of the MUI languages that is available is used. The path, or that no MUI resource
+ * file is available, is cached for the resource filename
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int message_handle_get_mui_resource_file_path(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     system_character_t **resource_file_path,
+     size_t *resource_file_path_size,
+     libcerror_error_t **error )
+{
+	const system_character_t *cached_resource_file_path = NULL;
+	static char *function                               = "message_handle_get_mui_resource_file_path";
+	size_t cached_resource_file_path_size               = 0;
+	int mui_language_index                              = 0;
+	int result                                          = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file path size.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_cache_get_path_by_name(
+	          message_handle->mui_resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          &cached_resource_file_path,
+	          &cached_resource_file_path_size,
+	          error );
 
-				if( system_string_copy(
-				     mui_string,
-				     resource_filename_string_segment,
-				     resource_filename_string_segment_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy MUI resource filename string.",
-					 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MUI resource file path from cache.",
+		 function );
 
-					goto on_error;
-				}
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) '.';
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'm';
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'u';
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'i';
-				mui_string[ resource_filename_string_segment_size++ ] = 0;
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*resource_file_path = system_string_allocate(
+		                       cached_resource_file_path_size );
 
-				resource_filename_string_segment = mui_string;
-			}
-			directory_entry_type = LIBCDIRECTORY_ENTRY_TYPE_FILE;
+		if( *resource_file_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create resource file path.",
+			 function );
+
+			goto on_error;
 		}
-		( *resource_file_path )[ resource_file_path_index ] = 0;
+		if( system_string_copy(
+		     *resource_file_path,
+		     cached_resource_file_path,
+		     cached_resource_file_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy resource file path.",
+			 function );
 
-		result = path_handle_get_directory_entry_name_by_name_no_case(
-		          message_handle->path_handle,
-		          *resource_file_path,
-		          resource_file_path_index + 1,
-			  resource_filename_string_segment,
-			  resource_filename_string_segment_size,
-		          directory_entry_type,
+			goto on_error;
+		}
+		*resource_file_path_size = cached_resource_file_path_size;
+
+		return( 1 );
+	}
+	for( mui_language_index = 0;
+	     mui_language_index < message_handle->number_of_mui_languages;
+	     mui_language_index++ )
+	{
+		result = message_handle_get_resource_file_path(
+		          message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          message_handle->mui_language_tags[ mui_language_index ],
+		          message_handle->mui_language_tag_lengths[ mui_language_index ],
+		          resource_file_path,
+		          resource_file_path_size,
 		          error );
 
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
-			 function,
-			 resource_filename_string_segment );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MUI resource file path.",
+			 function );
 
 			goto on_error;
 		}
 		else if( result != 0 )
 		{
-			if( system_string_copy(
-			     &( ( *resource_file_path )[ resource_file_path_index ] ),
-			     resource_filename_string_segment,
-			     resource_filename_string_segment_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set resource filename string segment: %d in resource file path.",
-				 function,
-				 resource_filename_segment_index );
-
-				goto on_error;
-			}
-			resource_file_path_index += resource_filename_string_segment_size - 1;
-
-			( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+			break;
 		}
-		if( mui_string != NULL )
+		if( *resource_file_path != NULL )
 		{
 			memory_free(
-			 mui_string );
+			 *resource_file_path );
 
-			mui_string = NULL;
+			*resource_file_path = NULL;
 		}
-		if( result == 0 )
+		*resource_file_path_size = 0;
+	}
+	if( result == 0 )
+	{
+		if( message_handle_append_missing_resource_file(
+		     message_handle,
+		     message_handle->mui_resource_file_cache,
+		     resource_filename,
+		     resource_filename_length,
+		     RESOURCE_FILE_CACHE_MISSING_CAUSE_NOT_FOUND,
+		     error ) != 1 )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append missing MUI resource file.",
+			 function );
+
+			goto on_error;
 		}
+		return( 0 );
 	}
-	( *resource_file_path )[ resource_file_path_index - 1 ] = 0;
+	/* The resource file path is terminated after the last path segment
+	 * hence the size of the string can be smaller than the allocated size
+	 */
+	*resource_file_path_size = system_string_length(
+	                            *resource_file_path ) + 1;
 
-	if( system_split_string_free(
-	     &resource_filename_split_string,
+	if( resource_file_cache_append_path(
+	     message_handle->mui_resource_file_cache,
+	     resource_filename,
+	     resource_filename_length,
+	     *resource_file_path,
+	     *resource_file_path_size - 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resource filename split string.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append MUI resource file path to cache.",
 		 function );
 
 		goto on_error;
 	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( mui_string != NULL )
-	{
-		memory_free(
-		 mui_string );
-	}
-	if( resource_filename_split_string != NULL )
-	{
-		system_split_string_free(
-		 &resource_filename_split_string,
-		 NULL );
-	}
 	if( *resource_file_path != NULL )
 	{
 		memory_free(
@@ -2949,10 +4718,63 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a specific resource file and adds it to the cache
+/* Appends the name of a missing resource file to a resource file cache
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_append_missing_resource_file(
+     message_handle_t *message_handle,
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     int missing_cause,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_append_missing_resource_file";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: resource file: %" PRIs_SYSTEM " is missing: %s.\n",
+		 function,
+		 resource_filename,
+		 ( missing_cause == RESOURCE_FILE_CACHE_MISSING_CAUSE_OPEN_FAILED ) ? "unable to open" : "not found" );
+	}
+#endif
+	if( resource_file_cache_append_missing_name(
+	     resource_file_cache,
+	     resource_filename,
+	     resource_filename_length,
+	     missing_cause,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append missing resource file to cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific MUI resource file and adds it to the cache
  * Returns 1 if successful, 0 if resource file was not found or -1 error
  */
-int message_handle_get_resource_file(
+int message_handle_get_mui_resource_file(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
@@ -2960,8 +4782,7 @@ int message_handle_get_resource_file(
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_get_resource_file";
-	time_t timestamp      = 0;
+	static char *function = "message_handle_get_mui_resource_file";
 
 	if( message_handle == NULL )
 	{
@@ -3029,72 +4850,136 @@ int message_handle_get_resource_file(
 
 		goto on_error;
 	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
+	/* The cache manages the resource file from here on, also on error
+	 */
+	if( resource_file_cache_append_resource_file(
+	     message_handle->mui_resource_file_cache,
+	     *resource_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append resource file to cache.",
 		 function );
 
+		*resource_file = NULL;
+
 		return( -1 );
 	}
-	if( libfcache_cache_set_value_by_index(
-	     message_handle->resource_file_cache,
-	     message_handle->next_resource_file_cache_index,
-	     0,
-	     message_handle->next_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( resource_file != NULL )
+	{
+		resource_file_free(
+		 resource_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific MUI resource file from the cache
+ * The resource file is set to NULL if it was cached as missing
+ * Returns 1 if successful, 0 if resource file was not found or -1 error
+ */
+int message_handle_get_mui_resource_file_from_cache(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_mui_resource_file_from_cache";
+	int missing_cause     = 0;
+	int result            = 0;
+
+	if( message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_resource_file_cache_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	message_handle->next_resource_file_cache_index++;
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
 
-	if( message_handle->next_resource_file_cache_index == 16 )
+		return( -1 );
+	}
+	result = resource_file_cache_get_resource_file_by_name(
+	          message_handle->mui_resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
+
+	if( result == -1 )
 	{
-		message_handle->next_resource_file_cache_index = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
+
+		return( -1 );
 	}
-	return( 1 );
+	else if( result == 0 )
+	{
+		/* A resource file that was not found before is not searched for again
+		 */
+		result = resource_file_cache_get_missing_cause_by_name(
+		          message_handle->mui_resource_file_cache,
+		          resource_filename,
+		          resource_filename_length,
+		          &missing_cause,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve missing cause of MUI resource file from cache.",
+			 function );
 
-on_error:
-	if( *resource_file != NULL )
-	{
-		resource_file_free(
-		 resource_file,
-		 NULL );
+			return( -1 );
+		}
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves a specific resource file from the cache
+/* Retrieves the message string from a specific resource file
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_resource_file_from_cache(
+int message_handle_get_message_string_from_resource_file(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     resource_file_t **resource_file,
+     uint32_t message_identifier,
+     message_string_t **message_string,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	system_character_t *resource_file_path     = NULL;
+	system_character_t *mui_resource_file_path = NULL;
+	resource_file_t *resource_file             = NULL;
+	static char *function                      = "message_handle_get_message_string_from_resource_file";
+	size_t resource_file_path_size             = 0;
+	size_t mui_resource_file_path_size         = 0;
+	uint32_t mui_file_type                     = 0;
+	int result                                 = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3107,96 +4992,323 @@ int message_handle_get_resource_file_from_cache(
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	if( resource_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 "%s: invalid resource filename.",
 		 function );
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
+	if( ( resource_filename_length == 0 )
+	 || ( resource_filename_length > (size_t) SSIZE_MAX ) )
 	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_handle_get_resource_file_from_cache(
+		  message_handle,
+		  resource_filename,
+		  resource_filename_length,
+		  &resource_file,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		result = message_handle_get_resource_file_path(
+		          message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          NULL,
+		          0,
+		          &resource_file_path,
+		          &resource_file_path_size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
+			 "%s: unable to retrieve resource file path.",
+			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( message_handle_append_missing_resource_file(
+			     message_handle,
+			     message_handle->resource_file_cache,
+			     resource_filename,
+			     resource_filename_length,
+			     RESOURCE_FILE_CACHE_MISSING_CAUSE_NOT_FOUND,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append missing resource file.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		if( cache_value != NULL )
+		else
 		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
+			if( message_handle_get_resource_file(
+			     message_handle,
+			     resource_filename,
+			     resource_filename_length,
+			     resource_file_path,
+			     &resource_file,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
+				 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
 				 function,
-				 cache_index );
+				 resource_file_path );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
-		if( *resource_file != NULL )
+	}
+	else if( resource_file == NULL )
+	{
+		/* The resource file was cached as missing
+		 */
+		result = 0;
+	}
+	if( resource_file != NULL )
+	{
+		result = resource_file_get_message_string(
+			  resource_file,
+			  message_identifier,
+			  message_string,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+			 function,
+			 message_identifier );
+
+			goto on_error;
+		}
+		else if( result == 0 )
 		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
+			result = resource_file_get_mui_file_type(
+				  resource_file,
+				  &mui_file_type,
+				  error );
+
+			if( result == -1 )
 			{
-				*resource_file = NULL;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve MUI file type.",
+				 function );
+
+				goto on_error;
 			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
+			else if( result != 0 )
 			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
+				if( mui_file_type != 0x00000011UL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported MUI file type: 0x%08" PRIx32 ".",
+					 function,
+					 mui_file_type );
+				}
+				resource_file = NULL;
 
-			break;
+				result = message_handle_get_mui_resource_file_from_cache(
+					  message_handle,
+					  resource_filename,
+					  resource_filename_length,
+					  &resource_file,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve MUI resource file from cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					result = message_handle_get_mui_resource_file_path(
+						  message_handle,
+						  resource_filename,
+						  resource_filename_length,
+						  &mui_resource_file_path,
+						  &mui_resource_file_path_size,
+						  error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve MUI resource file path.",
+						 function );
+
+						goto on_error;
+					}
+					else if( result != 0 )
+					{
+						if( message_handle_get_mui_resource_file(
+						     message_handle,
+						     resource_filename,
+						     resource_filename_length,
+						     mui_resource_file_path,
+						     &resource_file,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve MUI resource file: %" PRIs_SYSTEM ".",
+							 function,
+							 mui_resource_file_path );
+
+							goto on_error;
+						}
+						memory_free(
+						 mui_resource_file_path );
+
+						mui_resource_file_path = NULL;
+					}
+				}
+				else if( resource_file == NULL )
+				{
+					/* The MUI resource file was cached as missing
+					 */
+					result = 0;
+				}
+				if( resource_file != NULL )
+				{
+					result = resource_file_get_message_string(
+						  resource_file,
+						  message_identifier,
+						  message_string,
+						  error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+						 function,
+						 message_identifier );
+
+						goto on_error;
+					}
+				}
+			}
 		}
 	}
-	if( result == 0 )
+	if( resource_file_path != NULL )
 	{
-		*resource_file = NULL;
+		memory_free(
+		 resource_file_path );
+
+		resource_file_path = NULL;
 	}
 	return( result );
+
+on_error:
+	if( mui_resource_file_path != NULL )
+	{
+		memory_free(
+		 mui_resource_file_path );
+	}
+	if( resource_file_path != NULL )
+	{
+		memory_free(
+		 resource_file_path );
+	}
+	if( *message_string != NULL )
+	{
+		message_string_free(
+		 message_string,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific MUI resource file and adds it to the cache
- * Returns 1 if successful, 0 if resource file was not found or -1 error
+/* Retrieves the message string from one or more specified resource files
+ * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_mui_resource_file(
+int message_handle_get_message_string(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     const system_character_t *resource_file_path,
-     resource_file_t **resource_file,
+     uint32_t message_identifier,
+     message_string_t **message_string,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_get_mui_resource_file";
-	time_t timestamp      = 0;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	static char *function                                 = "message_handle_get_message_string";
+	size_t resource_filename_string_segment_size          = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3209,231 +5321,210 @@ int message_handle_get_mui_resource_file(
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	if( message_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 "%s: invalid message string.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_file_initialize(
-	     resource_file,
-	     message_handle->preferred_language_identifier,
-	     error ) != 1 )
+	if( ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_LOOKUP ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create resource file.",
-		 function );
+		result = message_catalog_get_message_string(
+		          message_handle->message_catalog,
+		          resource_filename,
+		          resource_filename_length,
+		          message_identifier,
+		          message_string,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from message catalog.",
+			 function,
+			 message_identifier );
+
+			return( -1 );
+		}
+		return( result );
 	}
-	if( resource_file_set_name(
-	     *resource_file,
+	/* The resource filename can contain multiple file names separated by ;
+	 */
+	if( system_string_split(
 	     resource_filename,
-	     resource_filename_length,
+	     resource_filename_length + 1,
+	     (system_character_t) ';',
+	     &resource_filename_split_string,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in resource file.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split resource filename.",
 		 function );
 
 		goto on_error;
 	}
-	if( resource_file_open(
-	     *resource_file,
-	     resource_file_path,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
-		 function,
-		 resource_file_path );
-
-		goto on_error;
-	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
+		 "%s: unable to retrieve number of resource filename string segments.",
 		 function );
 
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
-	     message_handle->mui_resource_file_cache,
-	     message_handle->next_mui_resource_file_cache_index,
-	     0,
-	     message_handle->next_mui_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_mui_resource_file_cache_index );
-
 		goto on_error;
 	}
-	message_handle->next_mui_resource_file_cache_index++;
-
-	if( message_handle->next_mui_resource_file_cache_index == 16 )
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
 	{
-		message_handle->next_mui_resource_file_cache_index = 0;
-	}
-	return( 1 );
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
 
-on_error:
-	if( resource_file != NULL )
-	{
-		resource_file_free(
-		 resource_file,
-		 NULL );
-	}
-	return( -1 );
-}
+			goto on_error;
+		}
+		if( resource_filename_string_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
 
-/* Retrieves a specific MUI resource file from the cache
- * Returns 1 if successful, 0 if resource file was not found or -1 error
- */
-int message_handle_get_mui_resource_file_from_cache(
-     message_handle_t *message_handle,
-     const system_character_t *resource_filename,
-     size_t resource_filename_length,
-     resource_file_t **resource_file,
-     libcerror_error_t **error )
-{
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_mui_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+			goto on_error;
+		}
+		result = message_handle_get_message_string_from_resource_file(
+			  message_handle,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size - 1,
+			  message_identifier,
+			  message_string,
+			  error );
 
-	if( message_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message handle.",
-		 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
+			 function,
+			 message_identifier,
+			 resource_filename_string_segment );
 
-		return( -1 );
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
 	}
-	if( resource_file == NULL )
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->mui_resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
+	if( ( result != 0 )
+	 && ( *message_string != NULL )
+	 && ( ( *message_string )->string != NULL )
+	 && ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_RECORD ) )
+	{
+		if( message_catalog_set_message_string(
+		     message_handle->message_catalog,
+		     resource_filename,
+		     resource_filename_length,
+		     *message_string,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to record message string: 0x%08" PRIx32 " in message catalog.",
 			 function,
-			 cache_index );
+			 message_identifier );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
+	}
+	return( result );
 
-			break;
-		}
+on_error:
+	if( resource_filename_split_string != NULL )
+	{
+		system_split_string_free(
+		 &resource_filename_split_string,
+		 NULL );
+	}
+	if( *message_string != NULL )
+	{
+		message_string_free(
+		 message_string,
+		 NULL );
 	}
-	return( result );
+	return( -1 );
 }
 
-/* Retrieves the message string from a specific resource file
+/* Retrieves a specific resource file by provider identifier
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_message_string_from_resource_file(
+int message_handle_get_resource_file_by_provider_identifier(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     uint32_t message_identifier,
-     message_string_t **message_string,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	system_character_t *resource_file_path     = NULL;
-	system_character_t *mui_resource_file_path = NULL;
-	resource_file_t *resource_file             = NULL;
-	static char *function                      = "message_handle_get_message_string_from_resource_file";
-	size_t resource_file_path_size             = 0;
-	size_t mui_resource_file_path_size         = 0;
-	uint32_t mui_file_type                     = 0;
-	int result                                 = 0;
+	libwrc_wevt_provider_t *provider                      = NULL;
+	system_character_t *resource_file_path                = NULL;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	static char *function                                 = "message_handle_get_resource_file_by_provider_identifier";
+	size_t resource_file_path_size                        = 0;
+	size_t resource_filename_string_segment_size          = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3446,109 +5537,75 @@ int message_handle_get_message_string_from_resource_file(
 
 		return( -1 );
 	}
-	if( resource_filename == NULL )
+	if( resource_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource filename.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( resource_filename_length == 0 )
-	 || ( resource_filename_length > (size_t) SSIZE_MAX ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource filename length value out of bounds.",
+		 "%s: invalid resource file.",
 		 function );
 
 		return( -1 );
 	}
-	if( message_string == NULL )
+	/* The resource filename can contain multiple file names separated by ;
+	 */
+	if( system_string_split(
+	     resource_filename,
+	     resource_filename_length + 1,
+	     (system_character_t) ';',
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split resource filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	result = message_handle_get_resource_file_from_cache(
-		  message_handle,
-		  resource_filename,
-		  resource_filename_length,
-		  &resource_file,
-		  error );
-
-	if( result == -1 )
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve resource file from cache.",
+		 "%s: unable to retrieve number of resource filename string segments.",
 		 function );
 
 		goto on_error;
 	}
-	if( result == 0 )
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
 	{
-		result = message_handle_get_resource_file_path(
-		          message_handle,
-		          resource_filename,
-		          resource_filename_length,
-		          NULL,
-		          0,
-		          &resource_file_path,
-		          &resource_file_path_size,
-		          error );
-
-		if( result == -1 )
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource file path.",
-			 function );
+			 "%s: unable to retrieve resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
 
 			goto on_error;
 		}
-		else if( result != 0 )
-		{
-			if( message_handle_get_resource_file(
-			     message_handle,
-			     resource_filename,
-			     resource_filename_length,
-			     resource_file_path,
-			     &resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
-				 function,
-				 resource_file_path );
-
-				goto on_error;
-			}
-		}
-	}
-	if( resource_file != NULL )
-	{
-		result = resource_file_get_message_string(
+		result = message_handle_get_resource_file_from_cache(
+			  message_handle,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size - 1,
 			  resource_file,
-			  message_identifier,
-			  message_string,
 			  error );
 
 		if( result == -1 )
@@ -3557,17 +5614,22 @@ int message_handle_get_message_string_from_resource_file(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+			 "%s: unable to retrieve resource file: %d from cache.",
 			 function,
-			 message_identifier );
+			 resource_filename_segment_index );
 
 			goto on_error;
 		}
-		else if( result == 0 )
+		if( result == 0 )
 		{
-			result = resource_file_get_mui_file_type(
-				  resource_file,
-				  &mui_file_type,
+			result = message_handle_get_resource_file_path(
+				  message_handle,
+				  resource_filename_string_segment,
+				  resource_filename_string_segment_size - 1,
+				  NULL,
+				  0,
+				  &resource_file_path,
+				  &resource_file_path_size,
 				  error );
 
 			if( result == -1 )
@@ -3576,166 +5638,156 @@ int message_handle_get_message_string_from_resource_file(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve MUI file type.",
+				 "%s: unable to retrieve resource file path.",
 				 function );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+			else if( result == 0 )
 			{
-				if( mui_file_type != 0x00000011UL )
+				if( resource_file_path != NULL )
+				{
+					memory_free(
+					 resource_file_path );
+
+					resource_file_path = NULL;
+				}
+				if( message_handle_append_missing_resource_file(
+				     message_handle,
+				     message_handle->resource_file_cache,
+				     resource_filename_string_segment,
+				     resource_filename_string_segment_size - 1,
+				     RESOURCE_FILE_CACHE_MISSING_CAUSE_NOT_FOUND,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported MUI file type: 0x%08" PRIx32 ".",
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append missing resource file: %d.",
 					 function,
-					 mui_file_type );
-				}
-				resource_file = NULL;
-
-				result = message_handle_get_mui_resource_file_from_cache(
-					  message_handle,
-					  resource_filename,
-					  resource_filename_length,
-					  &resource_file,
-					  error );
+					 resource_filename_segment_index );
 
-				if( result == -1 )
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( message_handle_get_resource_file(
+				     message_handle,
+				     resource_filename,
+				     resource_filename_length,
+				     resource_file_path,
+				     resource_file,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve MUI resource file from cache.",
-					 function );
+					 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
+					 function,
+					 resource_file_path );
 
 					goto on_error;
 				}
-				else if( result == 0 )
-				{
-/* TODO add support to determine language string */
-					/* The MUI resource file path is: %PATH%/%LANGUAGE%/%FILENAME%.mui
-					 */
-					result = message_handle_get_resource_file_path(
-						  message_handle,
-					          resource_filename,
-					          resource_filename_length,
-					          _SYSTEM_STRING( "en-US" ),
-					          5,
-						  &mui_resource_file_path,
-						  &mui_resource_file_path_size,
-						  error );
-
-					if( result == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve MUI resource file path.",
-						 function );
+				memory_free(
+				 resource_file_path );
 
-						goto on_error;
-					}
-					else if( result != 0 )
-					{
-						if( message_handle_get_mui_resource_file(
-						     message_handle,
-						     resource_filename,
-						     resource_filename_length,
-						     mui_resource_file_path,
-						     &resource_file,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve MUI resource file: %" PRIs_SYSTEM ".",
-							 function,
-							 mui_resource_file_path );
+				resource_file_path = NULL;
+			}
+		}
+		else if( *resource_file == NULL )
+		{
+			/* The resource file was cached as missing
+			 */
+			result = 0;
+		}
+		if( *resource_file != NULL )
+		{
+			result = resource_file_get_provider(
+			          *resource_file,
+				  provider_identifier,
+				  provider_identifier_size,
+				  &provider,
+				  error );
 
-							goto on_error;
-						}
-						memory_free(
-						 mui_resource_file_path );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider.",
+				 function );
 
-						mui_resource_file_path = NULL;
-					}
-				}
-				if( resource_file != NULL )
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( libwrc_wevt_provider_free(
+				     &provider,
+				     error ) != 1 )
 				{
-					result = resource_file_get_message_string(
-						  resource_file,
-						  message_identifier,
-						  message_string,
-						  error );
-
-					if( result == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
-						 function,
-						 message_identifier );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free provider.",
+					 function );
 
-						goto on_error;
-					}
+					goto on_error;
 				}
+				break;
 			}
 		}
 	}
-	if( resource_file_path != NULL )
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
-		memory_free(
-		 resource_file_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
+		 function );
 
-		resource_file_path = NULL;
+		goto on_error;
 	}
 	return( result );
 
 on_error:
-	if( mui_resource_file_path != NULL )
-	{
-		memory_free(
-		 mui_resource_file_path );
-	}
 	if( resource_file_path != NULL )
 	{
 		memory_free(
 		 resource_file_path );
 	}
-	if( *message_string != NULL )
+	if( resource_filename_split_string != NULL )
 	{
-		message_string_free(
-		 message_string,
+		system_split_string_free(
+		 &resource_filename_split_string,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the message string from one or more specified resource files
+/* Retrieves the message identifier of an event of a specific provider
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_message_string(
+int message_handle_get_event_message_identifier(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     uint32_t message_identifier,
-     message_string_t **message_string,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint32_t *message_identifier,
      libcerror_error_t **error )
 {
-	system_character_t *resource_filename_string_segment  = NULL;
-	system_split_string_t *resource_filename_split_string = NULL;
-	static char *function                                 = "message_handle_get_message_string";
-	size_t resource_filename_string_segment_size          = 0;
-	int resource_filename_number_of_segments              = 0;
-	int resource_filename_segment_index                   = 0;
-	int result                                            = 0;
+	resource_file_t *resource_file = NULL;
+	static char *function          = "message_handle_get_event_message_identifier";
+	int result                     = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3748,371 +5800,578 @@ int message_handle_get_message_string(
 
 		return( -1 );
 	}
-	if( message_string == NULL )
+	if( message_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message string.",
+		 "%s: invalid message identifier.",
 		 function );
 
 		return( -1 );
 	}
-	/* The resource filename can contain multiple file names separated by ;
-	 */
-	if( system_string_split(
-	     resource_filename,
-	     resource_filename_length + 1,
-	     (system_character_t) ';',
-	     &resource_filename_split_string,
-	     error ) != 1 )
+	if( ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_LOOKUP ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split resource filename.",
-		 function );
+		result = message_catalog_get_event_message_identifier(
+		          message_handle->message_catalog,
+		          resource_filename,
+		          resource_filename_length,
+		          provider_identifier,
+		          provider_identifier_size,
+		          event_identifier,
+		          message_identifier,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message identifier from message catalog.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
 	}
-	if( system_split_string_get_number_of_segments(
-	     resource_filename_split_string,
-	     &resource_filename_number_of_segments,
-	     error ) != 1 )
+	result = message_handle_get_resource_file_by_provider_identifier(
+	          message_handle,
+	          resource_filename,
+	          resource_filename_length,
+	          provider_identifier,
+	          provider_identifier_size,
+	          &resource_file,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resource filename string segments.",
+		 "%s: unable to retrieve resource file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( resource_filename_segment_index = 0;
-	     resource_filename_segment_index < resource_filename_number_of_segments;
-	     resource_filename_segment_index++ )
+	else if( result != 0 )
 	{
-		if( system_split_string_get_segment_by_index(
-		     resource_filename_split_string,
-		     resource_filename_segment_index,
-		     &resource_filename_string_segment,
-		     &resource_filename_string_segment_size,
-		     error ) != 1 )
+		result = resource_file_get_event_message_identifier(
+		          resource_file,
+		          provider_identifier,
+		          provider_identifier_size,
+		          event_identifier,
+		          message_identifier,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
+			 "%s: unable to retrieve message identifier.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( resource_filename_string_segment == NULL )
+	}
+	if( ( result != 0 )
+	 && ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_RECORD ) )
+	{
+		if( message_catalog_set_event_message_identifier(
+		     message_handle->message_catalog,
+		     resource_filename,
+		     resource_filename_length,
+		     provider_identifier,
+		     provider_identifier_size,
+		     event_identifier,
+		     *message_identifier,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to record message identifier in message catalog.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		result = message_handle_get_message_string_from_resource_file(
-			  message_handle,
-			  resource_filename_string_segment,
-			  resource_filename_string_segment_size - 1,
-			  message_identifier,
-			  message_string,
-			  error );
+	}
+	return( result );
+}
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
-			 function,
-			 message_identifier,
-			 resource_filename_string_segment );
+/* Retrieves the template definition data of an event of a specific provider
+ * The template data is allocated and should be freed by the caller, unless the
+ * WEVT_TEMPLATE resource data of a memory mapped resource file is available.
+ * In that case the template data is not copied but the resource data is returned
+ * with a reference to the mapped data, that should be freed by the caller
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int message_handle_get_template_definition_data(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t **template_data,
+     size_t *template_data_size,
+     uint32_t *template_data_offset,
+     const uint8_t **resource_data,
+     size_t *resource_data_size,
+     resource_file_mapped_data_t **mapped_data,
+     libcerror_error_t **error )
+{
+	libwrc_wevt_event_t *wevt_event                             = NULL;
+	libwrc_wevt_provider_t *wevt_provider                       = NULL;
+	libwrc_wevt_template_definition_t *wevt_template_definition = NULL;
+	resource_file_t *resource_file                              = NULL;
+	const uint8_t *catalog_template_data                        = NULL;
+	const uint8_t *safe_template_data                           = NULL;
+	static char *function                                       = "message_handle_get_template_definition_data";
+	int mapped_result                                           = 0;
+	int result                                                  = 0;
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			break;
-		}
-	}
-	if( system_split_string_free(
-	     &resource_filename_split_string,
-	     error ) != 1 )
+	if( message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resource filename split string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( result );
+	if( template_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template data.",
+		 function );
 
-on_error:
-	if( resource_filename_split_string != NULL )
+		return( -1 );
+	}
+	if( *template_data != NULL )
 	{
-		system_split_string_free(
-		 &resource_filename_split_string,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template data value already set.",
+		 function );
+
+		return( -1 );
 	}
-	if( *message_string != NULL )
+	if( template_data_size == NULL )
 	{
-		message_string_free(
-		 message_string,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template data size.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
-}
+	if( template_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template data offset.",
+		 function );
 
-/* Retrieves a specific resource file by provider identifier
- * Returns 1 if successful, 0 if not available or -1 error
- */
-int message_handle_get_resource_file_by_provider_identifier(
-     message_handle_t *message_handle,
-     const system_character_t *resource_filename,
-     size_t resource_filename_length,
-     const uint8_t *provider_identifier,
-     size_t provider_identifier_size,
-     resource_file_t **resource_file,
-     libcerror_error_t **error )
-{
-	libwrc_wevt_provider_t *provider                      = NULL;
-	system_character_t *resource_file_path                = NULL;
-	system_character_t *resource_filename_string_segment  = NULL;
-	system_split_string_t *resource_filename_split_string = NULL;
-	static char *function                                 = "message_handle_get_resource_file_by_provider_identifier";
-	size_t resource_file_path_size                        = 0;
-	size_t resource_filename_string_segment_size          = 0;
-	int resource_filename_number_of_segments              = 0;
-	int resource_filename_segment_index                   = 0;
-	int result                                            = 0;
+		return( -1 );
+	}
+	if( resource_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource data.",
+		 function );
 
-	if( message_handle == NULL )
+		return( -1 );
+	}
+	if( resource_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message handle.",
+		 "%s: invalid resource data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	if( mapped_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 "%s: invalid mapped data.",
 		 function );
 
 		return( -1 );
 	}
-	/* The resource filename can contain multiple file names separated by ;
-	 */
-	if( system_string_split(
-	     resource_filename,
-	     resource_filename_length + 1,
-	     (system_character_t) ';',
-	     &resource_filename_split_string,
-	     error ) != 1 )
+	if( *mapped_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split resource filename.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_LOOKUP ) )
+	{
+		result = message_catalog_get_template_definition_data(
+		          message_handle->message_catalog,
+		          resource_filename,
+		          resource_filename_length,
+		          provider_identifier,
+		          provider_identifier_size,
+		          event_identifier,
+		          &catalog_template_data,
+		          template_data_size,
+		          template_data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template definition data from message catalog.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			*template_data = (uint8_t *) memory_allocate(
+			                              sizeof( uint8_t ) * *template_data_size );
+
+			if( *template_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create template data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     *template_data,
+			     catalog_template_data,
+			     *template_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy template data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		return( result );
+	}
+	result = message_handle_get_resource_file_by_provider_identifier(
+	          message_handle,
+	          resource_filename,
+	          resource_filename_length,
+	          provider_identifier,
+	          provider_identifier_size,
+	          &resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file.",
 		 function );
 
 		goto on_error;
 	}
-	if( system_split_string_get_number_of_segments(
-	     resource_filename_split_string,
-	     &resource_filename_number_of_segments,
-	     error ) != 1 )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = resource_file_get_template_definition(
+	          resource_file,
+	          provider_identifier,
+	          provider_identifier_size,
+	          event_identifier,
+	          &wevt_provider,
+	          &wevt_event,
+	          &wevt_template_definition,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resource filename string segments.",
+		 "%s: unable to retrieve WEVT template definition.",
 		 function );
 
 		goto on_error;
 	}
-	for( resource_filename_segment_index = 0;
-	     resource_filename_segment_index < resource_filename_number_of_segments;
-	     resource_filename_segment_index++ )
+	else if( result != 0 )
 	{
-		if( system_split_string_get_segment_by_index(
-		     resource_filename_split_string,
-		     resource_filename_segment_index,
-		     &resource_filename_string_segment,
-		     &resource_filename_string_segment_size,
+		if( libwrc_wevt_template_definition_get_offset(
+		     wevt_template_definition,
+		     template_data_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
+			 "%s: unable to retrieve template offset.",
+			 function );
 
 			goto on_error;
 		}
-		result = message_handle_get_resource_file_from_cache(
-			  message_handle,
-			  resource_filename_string_segment,
-			  resource_filename_string_segment_size - 1,
-			  resource_file,
-			  error );
-
-		if( result == -1 )
+		if( libwrc_wevt_template_definition_get_size(
+		     wevt_template_definition,
+		     template_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource file: %d from cache.",
-			 function,
-			 resource_filename_segment_index );
+			 "%s: unable to retrieve template size.",
+			 function );
 
 			goto on_error;
 		}
-		if( result == 0 )
+		if( *template_data_size != 0 )
 		{
-			result = message_handle_get_resource_file_path(
-				  message_handle,
-				  resource_filename_string_segment,
-				  resource_filename_string_segment_size - 1,
-				  NULL,
-				  0,
-				  &resource_file_path,
-				  &resource_file_path_size,
-				  error );
-
-			if( result == -1 )
+			mapped_result = resource_file_get_mapped_wevt_template_data(
+			                 resource_file,
+			                 resource_data,
+			                 resource_data_size,
+			                 mapped_data,
+			                 error );
+
+			if( mapped_result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file path.",
+				 "%s: unable to retrieve mapped WEVT_TEMPLATE data.",
 				 function );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+			else if( mapped_result != 0 )
 			{
-				if( message_handle_get_resource_file(
-				     message_handle,
-				     resource_filename,
-				     resource_filename_length,
-				     resource_file_path,
-				     resource_file,
-				     error ) != 1 )
+				/* Fall back to copying the template data if the template definition
+				 * is not found in the mapped resource data
+				 */
+				if( ( (size_t) *template_data_offset > *resource_data_size )
+				 || ( *template_data_size > ( *resource_data_size - *template_data_offset ) )
+				 || ( *template_data_size < 4 )
+				 || ( memory_compare(
+				       &( ( *resource_data )[ *template_data_offset ] ),
+				       "TEMP",
+				       4 ) != 0 ) )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
-					 function,
-					 resource_file_path );
+					if( resource_file_mapped_data_free(
+					     mapped_data,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free mapped data.",
+						 function );
 
-					goto on_error;
+						goto on_error;
+					}
+					mapped_result = 0;
 				}
-				memory_free(
-				 resource_file_path );
-
-				resource_file_path = NULL;
+				else
+				{
+					safe_template_data = &( ( *resource_data )[ *template_data_offset ] );
+				}
+			}
+			if( mapped_result == 0 )
+			{
+				*resource_data      = NULL;
+				*resource_data_size = 0;
 			}
 		}
-		if( resource_file != NULL )
+		if( *template_data_size == 0 )
 		{
-			result = resource_file_get_provider(
-			          *resource_file,
-				  provider_identifier,
-				  provider_identifier_size,
-				  &provider,
-				  error );
+			result = 0;
+		}
+		else if( *mapped_data == NULL )
+		{
+			*template_data = (uint8_t *) memory_allocate(
+			                              sizeof( uint8_t ) * *template_data_size );
 
-			if( result == -1 )
+			if( *template_data == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve provider.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create template data.",
 				 function );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+			if( libwrc_wevt_template_definition_get_data(
+			     wevt_template_definition,
+			     *template_data,
+			     *template_data_size,
+			     error ) != 1 )
 			{
-				if( libwrc_wevt_provider_free(
-				     &provider,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free provider.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template data.",
+				 function );
 
-					goto on_error;
-				}
-				break;
+				goto on_error;
 			}
+			safe_template_data = *template_data;
+		}
+		if( libwrc_wevt_template_definition_free(
+		     &wevt_template_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template definition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_wevt_event_free(
+		     &wevt_event,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free event.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_wevt_provider_free(
+		     &wevt_provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free provider.",
+			 function );
+
+			goto on_error;
 		}
 	}
-	if( system_split_string_free(
-	     &resource_filename_split_string,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resource filename split string.",
-		 function );
+	if( ( result != 0 )
+	 && ( message_handle->message_catalog != NULL )
+	 && ( message_handle->message_catalog_mode == MESSAGE_HANDLE_CATALOG_MODE_RECORD ) )
+	{
+		if( message_catalog_set_template_definition_data(
+		     message_handle->message_catalog,
+		     resource_filename,
+		     resource_filename_length,
+		     provider_identifier,
+		     provider_identifier_size,
+		     event_identifier,
+		     safe_template_data,
+		     *template_data_size,
+		     *template_data_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to record template definition data in message catalog.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	return( result );
 
 on_error:
-	if( resource_file_path != NULL )
+	if( wevt_template_definition != NULL )
+	{
+		libwrc_wevt_template_definition_free(
+		 &wevt_template_definition,
+		 NULL );
+	}
+	if( wevt_event != NULL )
+	{
+		libwrc_wevt_event_free(
+		 &wevt_event,
+		 NULL );
+	}
+	if( wevt_provider != NULL )
+	{
+		libwrc_wevt_provider_free(
+		 &wevt_provider,
+		 NULL );
+	}
+	if( *template_data != NULL )
 	{
 		memory_free(
-		 resource_file_path );
+		 *template_data );
+
+		*template_data = NULL;
 	}
-	if( resource_filename_split_string != NULL )
+	*template_data_size = 0;
+
+	if( *mapped_data != NULL )
 	{
-		system_split_string_free(
-		 &resource_filename_split_string,
+		resource_file_mapped_data_free(
+		 mapped_data,
 		 NULL );
 	}
+	*resource_data      = NULL;
+	*resource_data_size = 0;
+
 	return( -1 );
 }
 
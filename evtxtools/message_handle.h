@@ -26,17 +26,29 @@
 #include <types.h>
 
 #include "evtxtools_libcerror.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libregf.h"
+#include "message_catalog.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
+#include "registry_value_cache.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of MUI languages
+ */
+#define MESSAGE_HANDLE_MAXIMUM_NUMBER_OF_MUI_LANGUAGES	3
+
+enum MESSAGE_HANDLE_CATALOG_MODES
+{
+	MESSAGE_HANDLE_CATALOG_MODE_LOOKUP	= (int) 'l',
+	MESSAGE_HANDLE_CATALOG_MODE_RECORD	= (int) 'r'
+};
+
 typedef struct message_handle message_handle_t;
 
 struct message_handle
@@ -109,25 +121,49 @@ struct message_handle
 	 */
 	libregf_key_t *control_set_2_eventlog_services_key;
 
+	/* The eventlog key name
+	 * The name is not managed by the message handle
+	 */
+	const char *eventlog_key_name;
+
+	/* Value to indicate the registry files are used
+	 */
+	uint8_t use_registry_files;
+
+	/* Value to indicate the SOFTWARE registry file was opened
+	 * The registry files are opened on first use
+	 */
+	uint8_t software_registry_file_is_open;
+
+	/* Value to indicate the SYSTEM registry file was opened
+	 */
+	uint8_t system_registry_file_is_open;
+
 	/* The resource files path
 	 */
 	const system_character_t *resource_files_path;
 
 	/* The resource file cache
 	 */
-	libfcache_cache_t *resource_file_cache;
+	resource_file_cache_t *resource_file_cache;
 
-	/* The next available resource file cache index
+	/* The MUI resource file cache
 	 */
-	int next_resource_file_cache_index;
+	resource_file_cache_t *mui_resource_file_cache;
 
-	/* The MUI resource file cache
+	/* The registry value cache
+	 * Contains the event source and provider values looked up in the registry files
 	 */
-	libfcache_cache_t *mui_resource_file_cache;
+	registry_value_cache_t *registry_value_cache;
 
-	/* The next available MUI resource file cache index
+	/* The message catalog
+	 * The catalog is not managed by the message handle
 	 */
-	int next_mui_resource_file_cache_index;
+	message_catalog_t *message_catalog;
+
+	/* The message catalog mode
+	 */
+	int message_catalog_mode;
 
 	/* The ascii codepage
 	 */
@@ -136,6 +172,18 @@ struct message_handle
 	/* The preferred language identifier
 	 */
 	uint32_t preferred_language_identifier;
+
+	/* The MUI language tags in order of preference
+	 */
+	const system_character_t *mui_language_tags[ MESSAGE_HANDLE_MAXIMUM_NUMBER_OF_MUI_LANGUAGES ];
+
+	/* The MUI language tag lengths
+	 */
+	size_t mui_language_tag_lengths[ MESSAGE_HANDLE_MAXIMUM_NUMBER_OF_MUI_LANGUAGES ];
+
+	/* The number of MUI languages
+	 */
+	int number_of_mui_languages;
 };
 
 int message_handle_initialize(
@@ -160,6 +208,21 @@ int message_handle_set_preferred_language_identifier(
      uint32_t preferred_language_identifier,
      libcerror_error_t **error );
 
+int message_handle_set_mui_languages(
+     message_handle_t *message_handle,
+     libcerror_error_t **error );
+
+int message_handle_set_maximum_number_of_cached_resource_files(
+     message_handle_t *message_handle,
+     int maximum_number_of_cached_resource_files,
+     libcerror_error_t **error );
+
+int message_handle_set_message_catalog(
+     message_handle_t *message_handle,
+     message_catalog_t *message_catalog,
+     int message_catalog_mode,
+     libcerror_error_t **error );
+
 int message_handle_set_event_log_type_from_filename(
      message_handle_t *message_handle,
      const system_character_t *filename,
@@ -199,10 +262,45 @@ int message_handle_open_input(
      const char *eventlog_key_name,
      libcerror_error_t **error );
 
+int message_handle_open_software_registry_file_on_demand(
+     message_handle_t *message_handle,
+     libcerror_error_t **error );
+
+int message_handle_open_system_registry_file_on_demand(
+     message_handle_t *message_handle,
+     libcerror_error_t **error );
+
 int message_handle_close_input(
      message_handle_t *message_handle,
      libcerror_error_t **error );
 
+int message_handle_preload_resource_files(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     libcerror_error_t **error );
+
+int message_handle_preload_sub_keys(
+     message_handle_t *message_handle,
+     libregf_key_t *key,
+     uint32_t key_type,
+     libcerror_error_t **error );
+
+int message_handle_preload(
+     message_handle_t *message_handle,
+     libcerror_error_t **error );
+
+int message_handle_get_value_from_cache(
+     message_handle_t *message_handle,
+     uint32_t key_type,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
 int message_handle_get_value_by_event_source(
      message_handle_t *message_handle,
      const system_character_t *event_source,
@@ -256,6 +354,14 @@ int message_handle_get_mui_resource_file_path(
      size_t *resource_file_path_size,
      libcerror_error_t **error );
 
+int message_handle_append_missing_resource_file(
+     message_handle_t *message_handle,
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     int missing_cause,
+     libcerror_error_t **error );
+
 int message_handle_get_mui_resource_file(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
@@ -296,6 +402,31 @@ int message_handle_get_resource_file_by_provider_identifier(
      resource_file_t **resource_file,
      libcerror_error_t **error );
 
+int message_handle_get_event_message_identifier(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint32_t *message_identifier,
+     libcerror_error_t **error );
+
+int message_handle_get_template_definition_data(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t **template_data,
+     size_t *template_data_size,
+     uint32_t *template_data_offset,
+     const uint8_t **resource_data,
+     size_t *resource_data_size,
+     resource_file_mapped_data_t **mapped_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -31,6 +31,7 @@
 #include "evtxtools_libevtx.h"
 #include "evtxtools_libwrc.h"
 #include "message_string.h"
+#include "output_writer.h"
 
 /* Creates a message string
  * Make sure the value message_string is referencing, is set to NULL
@@ -136,6 +137,16 @@ int message_string_free(
 	}
 	if( *message_string != NULL )
 	{
+		if( ( *message_string )->operations != NULL )
+		{
+			memory_free(
+			 ( *message_string )->operations );
+		}
+		if( ( *message_string )->format_text != NULL )
+		{
+			memory_free(
+			 ( *message_string )->format_text );
+		}
 		if( ( *message_string )->string != NULL )
 		{
 			memory_free(
@@ -149,6 +160,103 @@ int message_string_free(
 	return( result );
 }
 
+/* Clones the message string
+ * The format operations are not cloned since they are compiled on first print
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_clone(
+     message_string_t **destination_message_string,
+     message_string_t *source_message_string,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_clone";
+
+	if( destination_message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_message_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination message string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_message_string == NULL )
+	{
+		*destination_message_string = NULL;
+
+		return( 1 );
+	}
+	if( message_string_initialize(
+	     destination_message_string,
+	     source_message_string->identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination message string.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_message_string->string != NULL )
+	{
+		( *destination_message_string )->string = system_string_allocate(
+		                                           source_message_string->string_size );
+
+		if( ( *destination_message_string )->string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination string.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *destination_message_string )->string,
+		     source_message_string->string,
+		     source_message_string->string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_message_string )->string_size = source_message_string->string_size;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_message_string != NULL )
+	{
+		message_string_free(
+		 destination_message_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieve the message string from the message table resource
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -291,24 +399,124 @@ on_error:
 	return( -1 );
 }
 
-/* Prints the message string to a FILE stream
+/* Appends a format operation to the message string
  * Returns 1 if successful or -1 on error
  */
-int message_string_fprint(
+int message_string_append_operation(
+     message_string_t *message_string,
+     int *number_of_allocated_operations,
+     uint8_t operation_type,
+     size_t text_offset,
+     size_t text_length,
+     libcerror_error_t **error )
+{
+	message_string_operation_t *operation = NULL;
+	void *reallocation                    = NULL;
+	static char *function                 = "message_string_append_operation";
+	int allocated_operations              = 0;
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocated_operations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocated operations.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive literals are merged into a single operation
+	 */
+	if( ( operation_type == MESSAGE_STRING_OPERATION_TYPE_LITERAL )
+	 && ( message_string->number_of_operations > 0 ) )
+	{
+		operation = &( message_string->operations[ message_string->number_of_operations - 1 ] );
+
+		if( ( operation->type == MESSAGE_STRING_OPERATION_TYPE_LITERAL )
+		 && ( ( operation->text_offset + operation->text_length ) == text_offset ) )
+		{
+			operation->text_length += text_length;
+
+			return( 1 );
+		}
+	}
+	if( message_string->number_of_operations >= *number_of_allocated_operations )
+	{
+		if( *number_of_allocated_operations > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated operations value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		allocated_operations = *number_of_allocated_operations * 2;
+
+		if( allocated_operations == 0 )
+		{
+			allocated_operations = 8;
+		}
+		reallocation = memory_reallocate(
+		                message_string->operations,
+		                sizeof( message_string_operation_t ) * allocated_operations );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize operations.",
+			 function );
+
+			return( -1 );
+		}
+		message_string->operations      = (message_string_operation_t *) reallocation;
+		*number_of_allocated_operations = allocated_operations;
+	}
+	operation = &( message_string->operations[ message_string->number_of_operations ] );
+
+	operation->type               = operation_type;
+	operation->text_offset        = text_offset;
+	operation->text_length        = text_length;
+	operation->value_string_index = 0;
+	operation->next_character     = 0;
+
+	message_string->number_of_operations += 1;
+
+	return( 1 );
+}
+
+/* Compiles the message string into format operations
+ * Since the string does not change after it was retrieved the string is only parsed once
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_compile(
      message_string_t *message_string,
-     libevtx_record_t *record,
-     FILE *stream,
      libcerror_error_t **error )
 {
-	system_character_t *value_string   = NULL;
-	static char *function              = "message_string_fprint";
+	system_character_t character       = 0;
+	static char *function              = "message_string_compile";
 	size_t conversion_specifier_length = 0;
+	size_t format_text_length          = 0;
 	size_t message_string_length       = 0;
 	size_t message_string_index        = 0;
-	size_t value_string_size           = 0;
-	system_character_t last_character  = 0;
-	int number_of_strings              = 0;
-	int result                         = 0;
+	int number_of_allocated_operations = 0;
 	int value_string_index             = 0;
 
 	if( message_string == NULL )
@@ -322,115 +530,138 @@ int message_string_fprint(
 
 		return( -1 );
 	}
-	if( libevtx_record_get_number_of_strings(
-	     record,
-	     &number_of_strings,
-	     error ) != 1 )
+	if( ( message_string->string == NULL )
+	 || ( message_string->string_size == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings in record.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message string - missing string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	fprintf(
-	 stream,
-	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
-	 message_string->string );
-#endif
-	fprintf(
-	 stream,
-	 "Message string\t\t\t: " );
+	if( message_string->format_text != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message string - format text value already set.",
+		 function );
 
+		return( -1 );
+	}
+	/* The format text is never longer than the string
+	 */
+	message_string->format_text = system_string_allocate(
+	                               message_string->string_size );
+
+	if( message_string->format_text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create format text.",
+		 function );
+
+		goto on_error;
+	}
 	message_string_length = message_string->string_size - 1;
-	message_string_index  = 0;
 
 	while( message_string_index < message_string_length )
 	{
-		if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '%' )
+		character = ( message_string->string )[ message_string_index ];
+
+		if( ( character == (system_character_t) '%' )
 		 && ( ( message_string_index + 1 ) < message_string_length ) )
 		{
+			character = ( message_string->string )[ message_string_index + 1 ];
+
 /* TODO add support for more conversion specifiers */
 			/* Ignore %0 = end of string, %r = cariage return */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '0' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'r' ) )
-			{
-				message_string_index += 2;
-
-				continue;
-			}
-			/* Replace:
-			 *  %<space> = <space>
-			 *  %! = !
-			 *  %% = %
-			 *  %. = .
-			 */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) ' ' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '!' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '%' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '.' ) )
-			{
-				last_character = ( message_string->string )[ message_string_index + 1 ];
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
-
-				message_string_index += 2;
-
-				continue;
-			}
-			/* Replace %b = <space> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'b' )
+			if( ( character == (system_character_t) '0' )
+			 || ( character == (system_character_t) 'r' ) )
 			{
-				last_character = (system_character_t) ' ';
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
-
 				message_string_index += 2;
 
 				continue;
 			}
 			/* Replace %n = <new line> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'n' )
+			if( character == (system_character_t) 'n' )
 			{
-				if( last_character != (system_character_t) '\n' )
+				if( message_string_append_operation(
+				     message_string,
+				     &number_of_allocated_operations,
+				     MESSAGE_STRING_OPERATION_TYPE_NEW_LINE,
+				     0,
+				     0,
+				     error ) != 1 )
 				{
-					last_character = (system_character_t) '\n';
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append new line operation.",
+					 function );
 
-					fprintf(
-					 stream,
-					 "%c",
-					 last_character );
+					goto on_error;
 				}
 				message_string_index += 2;
 
 				continue;
 			}
-			/* Replace %t = <tab> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 't' )
+			/* Replace:
+			 *  %<space> = <space>
+			 *  %! = !
+			 *  %% = %
+			 *  %. = .
+			 *  %b = <space>
+			 *  %t = <tab>
+			 */
+			if( ( character == (system_character_t) ' ' )
+			 || ( character == (system_character_t) '!' )
+			 || ( character == (system_character_t) '%' )
+			 || ( character == (system_character_t) '.' )
+			 || ( character == (system_character_t) 'b' )
+			 || ( character == (system_character_t) 't' ) )
 			{
-				last_character = (system_character_t) '\t';
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+				if( character == (system_character_t) 'b' )
+				{
+					character = (system_character_t) ' ';
+				}
+				else if( character == (system_character_t) 't' )
+				{
+					character = (system_character_t) '\t';
+				}
+				( message_string->format_text )[ format_text_length ] = character;
+
+				if( message_string_append_operation(
+				     message_string,
+				     &number_of_allocated_operations,
+				     MESSAGE_STRING_OPERATION_TYPE_LITERAL,
+				     format_text_length,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append literal operation.",
+					 function );
 
+					goto on_error;
+				}
+				format_text_length   += 1;
 				message_string_index += 2;
 
 				continue;
 			}
-			if( ( ( message_string->string )[ message_string_index + 1 ] < (system_character_t) '1' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] > (system_character_t) '9' ) )
+			if( ( character < (system_character_t) '1' )
+			 || ( character > (system_character_t) '9' ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -442,7 +673,7 @@ int message_string_fprint(
 
 				goto on_error;
 			}
-			value_string_index = (int) ( message_string->string )[ message_string_index + 1 ] - (int) '0';
+			value_string_index = (int) character - (int) '0';
 
 			conversion_specifier_length = 2;
 
@@ -475,143 +706,503 @@ int message_string_fprint(
 				}
 				conversion_specifier_length += 3;
 			}
-/* TODO remove index check after user data support */
-			if( value_string_index < number_of_strings )
+			if( message_string_append_operation(
+			     message_string,
+			     &number_of_allocated_operations,
+			     MESSAGE_STRING_OPERATION_TYPE_SUBSTITUTION,
+			     message_string_index,
+			     conversion_specifier_length,
+			     error ) != 1 )
 			{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libevtx_record_get_utf16_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
-#else
-				result = libevtx_record_get_utf8_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
-#endif
-				if( result != 1 )
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append substitution operation.",
+				 function );
+
+				goto on_error;
+			}
+			message_string_index += conversion_specifier_length;
+
+			message_string->operations[ message_string->number_of_operations - 1 ].value_string_index = value_string_index;
+			message_string->operations[ message_string->number_of_operations - 1 ].next_character     = ( message_string->string )[ message_string_index ];
+		}
+		else
+		{
+			if( character == (system_character_t) '\n' )
+			{
+				if( message_string_append_operation(
+				     message_string,
+				     &number_of_allocated_operations,
+				     MESSAGE_STRING_OPERATION_TYPE_NEW_LINE,
+				     0,
+				     0,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve string: %d size.",
-					 function,
-					 value_string_index );
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append new line operation.",
+					 function );
 
 					goto on_error;
 				}
-				if( value_string_size > 0 )
+			}
+			/* Ignore \r and end of string characters */
+			else if( ( character != 0 )
+			      && ( character != (system_character_t) '\r' ) )
+			{
+				( message_string->format_text )[ format_text_length ] = character;
+
+				if( message_string_append_operation(
+				     message_string,
+				     &number_of_allocated_operations,
+				     MESSAGE_STRING_OPERATION_TYPE_LITERAL,
+				     format_text_length,
+				     1,
+				     error ) != 1 )
 				{
-					value_string = system_string_allocate(
-							value_string_size );
-
-					if( value_string == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create value string.",
-						 function );
-
-						goto on_error;
-					}
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append literal operation.",
+					 function );
+
+					goto on_error;
+				}
+				format_text_length += 1;
+			}
+			message_string_index += 1;
+		}
+	}
+	( message_string->format_text )[ format_text_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( message_string->operations != NULL )
+	{
+		memory_free(
+		 message_string->operations );
+
+		message_string->operations = NULL;
+	}
+	message_string->number_of_operations = 0;
+
+	if( message_string->format_text != NULL )
+	{
+		memory_free(
+		 message_string->format_text );
+
+		message_string->format_text = NULL;
+	}
+	return( -1 );
+}
+
+/* Writes system string characters to an output writer
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_write_characters(
+     output_writer_t *output_writer,
+     const system_character_t *characters,
+     size_t number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_write_characters";
+
+	if( characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of characters value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libevtx_record_get_utf16_string(
-						  record,
-						  value_string_index,
-						  (uint16_t *) value_string,
-						  value_string_size,
-						  error );
+	if( output_writer_printf(
+	     output_writer,
+	     "%.*" PRIs_SYSTEM "",
+	     (int) number_of_characters,
+	     characters ) < 0 )
 #else
-					result = libevtx_record_get_utf8_string(
-						  record,
-						  value_string_index,
-						  (uint8_t *) value_string,
-						  value_string_size,
-						  error );
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) characters,
+	     number_of_characters,
+	     error ) != 1 )
 #endif
-					if( result != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve string: %d.",
-						 function,
-						 value_string_index );
-
-						goto on_error;
-					}
-					fprintf(
-					 stream,
-					 "%" PRIs_SYSTEM "",
-					 value_string );
-
-					memory_free(
-					 value_string );
-
-					value_string = NULL;
-				}
-				message_string_index += conversion_specifier_length;
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write characters.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the formatted message string to an output writer
+ * The scratch string is used to retrieve the value strings, it is reallocated
+ * if needed and is reused between the calls of the caller
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_write(
+     message_string_t *message_string,
+     libevtx_record_t *record,
+     output_writer_t *output_writer,
+     system_character_t **scratch_string,
+     size_t *scratch_string_size,
+     libcerror_error_t **error )
+{
+	message_string_operation_t *operation = NULL;
+	static char *function                 = "message_string_write";
+	size_t value_string_size              = 0;
+	system_character_t last_character     = 0;
+	int number_of_strings                 = 0;
+	int operation_index                   = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	system_character_t *reallocation      = NULL;
+	int result                            = 0;
+#else
+	const size_t *utf8_string_offsets     = NULL;
+	const size_t *utf8_string_sizes       = NULL;
+	const uint8_t *utf8_strings           = NULL;
+#endif
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( scratch_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch string.",
+		 function );
+
+		return( -1 );
+	}
+	if( scratch_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string->format_text == NULL )
+	{
+		if( message_string_compile(
+		     message_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compile message string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings in record.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	/* All strings are converted in one pass, the substitutions reference them directly
+	 */
+	if( libevtx_record_get_utf8_strings(
+	     record,
+	     &utf8_strings,
+	     &number_of_strings,
+	     &utf8_string_offsets,
+	     &utf8_string_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings in record.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	for( operation_index = 0;
+	     operation_index < message_string->number_of_operations;
+	     operation_index++ )
+	{
+		operation = &( message_string->operations[ operation_index ] );
+
+		if( operation->type == MESSAGE_STRING_OPERATION_TYPE_LITERAL )
+		{
+			if( message_string_write_characters(
+			     output_writer,
+			     &( ( message_string->format_text )[ operation->text_offset ] ),
+			     operation->text_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write literal text.",
+				 function );
+
+				goto on_error;
 			}
-			else
+			last_character = ( message_string->format_text )[ operation->text_offset + operation->text_length - 1 ];
+		}
+		else if( operation->type == MESSAGE_STRING_OPERATION_TYPE_NEW_LINE )
+		{
+			/* Ignore multiple new line characters */
+			if( last_character != (system_character_t) '\n' )
 			{
-				do
+				last_character = (system_character_t) '\n';
+
+				if( output_writer_write_data(
+				     output_writer,
+				     (uint8_t *) "\n",
+				     1,
+				     error ) != 1 )
 				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index++ ] );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write new line.",
+					 function );
 
-					conversion_specifier_length--;
+					goto on_error;
 				}
-				while( conversion_specifier_length > 0 );
-
-				last_character = ( message_string->string )[ message_string_index ];
 			}
 		}
-		else
+/* TODO remove index check after user data support */
+		else if( operation->value_string_index < number_of_strings )
 		{
-			if( ( message_string->string )[ message_string_index ] != 0 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libevtx_record_get_utf16_string_size(
+				  record,
+				  operation->value_string_index,
+				  &value_string_size,
+				  error );
+
+			if( result != 1 )
 			{
-				if( ( message_string->string )[ message_string_index ] == (system_character_t) '\r' )
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d size.",
+				 function,
+				 operation->value_string_index );
+
+				goto on_error;
+			}
+			if( value_string_size > *scratch_string_size )
+			{
+				reallocation = (system_character_t *) memory_reallocate(
+				                                       *scratch_string,
+				                                       sizeof( system_character_t ) * value_string_size );
+
+				if( reallocation == NULL )
 				{
-					/* Ignore \r characters */
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize scratch string.",
+					 function );
+
+					goto on_error;
 				}
-				else if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '\n' )
-				      && ( last_character == (system_character_t) '\n' ) )
+				*scratch_string      = reallocation;
+				*scratch_string_size = value_string_size;
+			}
+			if( value_string_size > 0 )
+			{
+				result = libevtx_record_get_utf16_string(
+					  record,
+					  operation->value_string_index,
+					  (uint16_t *) *scratch_string,
+					  value_string_size,
+					  error );
+
+				if( result != 1 )
 				{
-					/* Ignore multiple \n characters */
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve string: %d.",
+					 function,
+					 operation->value_string_index );
+
+					goto on_error;
 				}
-				else
+				output_writer_printf(
+				 output_writer,
+				 "%" PRIs_SYSTEM "",
+				 *scratch_string );
+			}
+#else
+			value_string_size = utf8_string_sizes[ operation->value_string_index ];
+
+			/* The string size includes the end of string character
+			 */
+			if( value_string_size > 1 )
+			{
+				if( output_writer_write_data(
+				     output_writer,
+				     &( utf8_strings[ utf8_string_offsets[ operation->value_string_index ] ] ),
+				     value_string_size - 1,
+				     error ) != 1 )
 				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index ] );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write string: %d.",
+					 function,
+					 operation->value_string_index );
 
-					last_character = ( message_string->string )[ message_string_index ];
+					goto on_error;
 				}
 			}
-			message_string_index += 1;
+#endif
 		}
-	}
-	fprintf(
-	 stream,
-	 "\n" );
+		else
+		{
+			/* Strings that are not available are printed as the conversion specifier
+			 */
+			if( message_string_write_characters(
+			     output_writer,
+			     &( ( message_string->string )[ operation->text_offset ] ),
+			     operation->text_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write conversion specifier.",
+				 function );
 
+				goto on_error;
+			}
+			last_character = operation->next_character;
+		}
+	}
 	return( 1 );
 
 on_error:
-	if( value_string != NULL )
+	return( -1 );
+}
+
+/* Prints the message string to an output writer
+ * The scratch string is used to retrieve the value strings, it is reallocated
+ * if needed and is reused between the calls of the caller
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_print(
+     message_string_t *message_string,
+     libevtx_record_t *record,
+     output_writer_t *output_writer,
+     system_character_t **scratch_string,
+     size_t *scratch_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_print";
+
+	if( message_string == NULL )
 	{
-		memory_free(
-		 value_string );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+#if defined( HAVE_DEBUG_OUTPUT )
+	output_writer_printf(
+	 output_writer,
+	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
+	 message_string->string );
+#endif
+	output_writer_printf(
+	 output_writer,
+	 "Message string\t\t\t: " );
+
+	if( message_string_write(
+	     message_string,
+	     record,
+	     output_writer,
+	     scratch_string,
+	     scratch_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message string.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer_printf(
+	 output_writer,
+	 "\n" );
+
+	return( 1 );
 }
 
@@ -29,11 +29,48 @@
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libevtx.h"
 #include "evtxtools_libwrc.h"
+#include "output_writer.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The message string format operation types
+ */
+enum MESSAGE_STRING_OPERATION_TYPES
+{
+	MESSAGE_STRING_OPERATION_TYPE_LITERAL		= 1,
+	MESSAGE_STRING_OPERATION_TYPE_NEW_LINE		= 2,
+	MESSAGE_STRING_OPERATION_TYPE_SUBSTITUTION	= 3
+};
+
+typedef struct message_string_operation message_string_operation_t;
+
+struct message_string_operation
+{
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The offset of the text
+	 * For a literal this is relative to the format text,
+	 * for a substitution to the conversion specifier in the string
+	 */
+	size_t text_offset;
+
+	/* The length of the text
+	 */
+	size_t text_length;
+
+	/* The value string index of a substitution
+	 */
+	int value_string_index;
+
+	/* The character after the conversion specifier of a substitution
+	 */
+	system_character_t next_character;
+};
+
 typedef struct message_string message_string_t;
 
 struct message_string
@@ -49,6 +86,19 @@ struct message_string
 	/* The string size
 	 */
 	size_t string_size;
+
+	/* The format text, the literal text of the string with the escape
+	 * sequences replaced
+	 */
+	system_character_t *format_text;
+
+	/* The format operations
+	 */
+	message_string_operation_t *operations;
+
+	/* The number of format operations
+	 */
+	int number_of_operations;
 };
 
 int message_string_initialize(
@@ -60,16 +110,49 @@ int message_string_free(
      message_string_t **message_string,
      libcerror_error_t **error );
 
+int message_string_clone(
+     message_string_t **destination_message_string,
+     message_string_t *source_message_string,
+     libcerror_error_t **error );
+
 int message_string_get_from_message_table_resource(
      message_string_t *message_string,
      libwrc_resource_t *message_table_resource,
      uint32_t language_identifier,
      libcerror_error_t **error );
 
-int message_string_fprint(
+int message_string_append_operation(
+     message_string_t *message_string,
+     int *number_of_allocated_operations,
+     uint8_t operation_type,
+     size_t text_offset,
+     size_t text_length,
+     libcerror_error_t **error );
+
+int message_string_compile(
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+int message_string_write_characters(
+     output_writer_t *output_writer,
+     const system_character_t *characters,
+     size_t number_of_characters,
+     libcerror_error_t **error );
+
+int message_string_write(
+     message_string_t *message_string,
+     libevtx_record_t *record,
+     output_writer_t *output_writer,
+     system_character_t **scratch_string,
+     size_t *scratch_string_size,
+     libcerror_error_t **error );
+
+int message_string_print(
      message_string_t *message_string,
      libevtx_record_t *record,
-     FILE *stream,
+     output_writer_t *output_writer,
+     system_character_t **scratch_string,
+     size_t *scratch_string_size,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
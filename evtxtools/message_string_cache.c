@@ -0,0 +1,508 @@
+/*
+ * Message string cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_string.h"
+#include "message_string_cache.h"
+
+/* Creates a message string cache
+ * Make sure the value message_string_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_initialize(
+     message_string_cache_t **message_string_cache,
+     size_t maximum_cached_size,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_cache_initialize";
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_string_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message string cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*message_string_cache = memory_allocate_structure(
+	                         message_string_cache_t );
+
+	if( *message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message string cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_string_cache,
+	     0,
+	     sizeof( message_string_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message string cache.",
+		 function );
+
+		memory_free(
+		 *message_string_cache );
+
+		*message_string_cache = NULL;
+
+		return( -1 );
+	}
+	if( message_string_cache_resize_buckets(
+	     *message_string_cache,
+	     MESSAGE_STRING_CACHE_INITIAL_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *message_string_cache )->maximum_cached_size = maximum_cached_size;
+
+	return( 1 );
+
+on_error:
+	if( *message_string_cache != NULL )
+	{
+		memory_free(
+		 *message_string_cache );
+
+		*message_string_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message string cache
+ * The cached message strings are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_free(
+     message_string_cache_t **message_string_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_cache_free";
+	int result            = 1;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_string_cache != NULL )
+	{
+		if( message_string_cache_empty(
+		     *message_string_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty message string cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *message_string_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *message_string_cache )->buckets );
+		}
+		memory_free(
+		 *message_string_cache );
+
+		*message_string_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a message string cache
+ * The cached message strings are freed
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_empty(
+     message_string_cache_t *message_string_cache,
+     libcerror_error_t **error )
+{
+	message_string_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "message_string_cache_empty";
+	int bucket_index                          = 0;
+	int result                                = 1;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < message_string_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( message_string_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = message_string_cache->buckets[ bucket_index ];
+
+			message_string_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			if( message_string_free(
+			     &( cache_entry->message_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message string.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 cache_entry );
+		}
+	}
+	message_string_cache->number_of_entries = 0;
+	message_string_cache->cached_size       = 0;
+
+	return( result );
+}
+
+/* Calculates the hash of a message string identifier
+ * Returns the 32-bit hash
+ */
+uint32_t message_string_cache_get_identifier_hash(
+          uint32_t identifier )
+{
+	uint32_t identifier_hash = 0;
+
+	/* The message identifiers of a message table are mostly consecutive
+	 * or differ in the (severity and facility) upper 16 bits hence
+	 * the upper bits are mixed into the lower bits
+	 */
+	identifier_hash  = identifier * 0x9e3779b1UL;
+	identifier_hash ^= identifier_hash >> 16;
+
+	return( identifier_hash );
+}
+
+/* Resizes the hash table buckets
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_resize_buckets(
+     message_string_cache_t *message_string_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	message_string_cache_entry_t **buckets    = NULL;
+	message_string_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "message_string_cache_resize_buckets";
+	uint32_t identifier_hash                  = 0;
+	int bucket_index                          = 0;
+	int new_bucket_index                      = 0;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) SSIZE_MAX / sizeof( message_string_cache_entry_t * ) ) )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (message_string_cache_entry_t **) memory_allocate(
+	                                             sizeof( message_string_cache_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( new_bucket_index = 0;
+	     new_bucket_index < number_of_buckets;
+	     new_bucket_index++ )
+	{
+		buckets[ new_bucket_index ] = NULL;
+	}
+	for( bucket_index = 0;
+	     bucket_index < message_string_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( message_string_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = message_string_cache->buckets[ bucket_index ];
+
+			message_string_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			identifier_hash = message_string_cache_get_identifier_hash(
+			                   cache_entry->message_string->identifier );
+
+			new_bucket_index = (int) ( identifier_hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+			cache_entry->next_bucket_entry = buckets[ new_bucket_index ];
+			buckets[ new_bucket_index ]    = cache_entry;
+		}
+	}
+	if( message_string_cache->buckets != NULL )
+	{
+		memory_free(
+		 message_string_cache->buckets );
+	}
+	message_string_cache->buckets           = buckets;
+	message_string_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves a message string by its identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_string_cache_get_message_string_by_identifier(
+     message_string_cache_t *message_string_cache,
+     uint32_t identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	message_string_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "message_string_cache_get_message_string_by_identifier";
+	uint32_t identifier_hash                  = 0;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	*message_string = NULL;
+
+	identifier_hash = message_string_cache_get_identifier_hash(
+	                   identifier );
+
+	cache_entry = message_string_cache->buckets[ identifier_hash & (uint32_t) ( message_string_cache->number_of_buckets - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( cache_entry->message_string->identifier == identifier )
+		{
+			*message_string = cache_entry->message_string;
+
+			return( 1 );
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Appends a message string to the cache
+ * The cache takes over management of the message string, also on error
+ * The cache is emptied first if the message string would exceed the maximum cached size
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_append_message_string(
+     message_string_cache_t *message_string_cache,
+     message_string_t *message_string,
+     libcerror_error_t **error )
+{
+	message_string_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "message_string_cache_append_message_string";
+	size_t cache_entry_size                   = 0;
+	uint32_t identifier_hash                  = 0;
+	int bucket_index                          = 0;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry_size = sizeof( message_string_cache_entry_t )
+	                 + sizeof( message_string_t )
+	                 + ( sizeof( system_character_t ) * message_string->string_size );
+
+	if( ( message_string_cache->maximum_cached_size != 0 )
+	 && ( ( message_string_cache->cached_size > message_string_cache->maximum_cached_size )
+	  || ( cache_entry_size > ( message_string_cache->maximum_cached_size - message_string_cache->cached_size ) ) ) )
+	{
+		if( message_string_cache_empty(
+		     message_string_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty message string cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_string_cache->number_of_entries >= message_string_cache->number_of_buckets )
+	{
+		if( message_string_cache_resize_buckets(
+		     message_string_cache,
+		     message_string_cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	cache_entry = memory_allocate_structure(
+	               message_string_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	identifier_hash = message_string_cache_get_identifier_hash(
+	                   message_string->identifier );
+
+	bucket_index = (int) ( identifier_hash & (uint32_t) ( message_string_cache->number_of_buckets - 1 ) );
+
+	cache_entry->message_string    = message_string;
+	cache_entry->next_bucket_entry = message_string_cache->buckets[ bucket_index ];
+
+	message_string_cache->buckets[ bucket_index ] = cache_entry;
+
+	message_string_cache->number_of_entries += 1;
+	message_string_cache->cached_size       += cache_entry_size;
+
+	return( 1 );
+
+on_error:
+	message_string_free(
+	 &message_string,
+	 NULL );
+
+	return( -1 );
+}
+
@@ -0,0 +1,120 @@
+/*
+ * Message string cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_STRING_CACHE_H )
+#define _MESSAGE_STRING_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of hash table buckets, must be a power of 2
+ */
+#define MESSAGE_STRING_CACHE_INITIAL_NUMBER_OF_BUCKETS	64
+
+/* The default maximum cached size, in bytes, of the message strings of a resource file
+ */
+#define MESSAGE_STRING_CACHE_DEFAULT_MAXIMUM_CACHED_SIZE	( 4 * 1024 * 1024 )
+
+typedef struct message_string_cache_entry message_string_cache_entry_t;
+
+struct message_string_cache_entry
+{
+	/* The message string
+	 * A message string without a string marks an identifier that is not available
+	 */
+	message_string_t *message_string;
+
+	/* The next entry in the same hash table bucket
+	 */
+	message_string_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct message_string_cache message_string_cache_t;
+
+struct message_string_cache
+{
+	/* The hash table buckets
+	 */
+	message_string_cache_entry_t **buckets;
+
+	/* The number of hash table buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The cached size
+	 */
+	size_t cached_size;
+
+	/* The maximum cached size
+	 * Contains 0 if the cached size is not limited
+	 */
+	size_t maximum_cached_size;
+};
+
+int message_string_cache_initialize(
+     message_string_cache_t **message_string_cache,
+     size_t maximum_cached_size,
+     libcerror_error_t **error );
+
+int message_string_cache_free(
+     message_string_cache_t **message_string_cache,
+     libcerror_error_t **error );
+
+int message_string_cache_empty(
+     message_string_cache_t *message_string_cache,
+     libcerror_error_t **error );
+
+uint32_t message_string_cache_get_identifier_hash(
+          uint32_t identifier );
+
+int message_string_cache_resize_buckets(
+     message_string_cache_t *message_string_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int message_string_cache_get_message_string_by_identifier(
+     message_string_cache_t *message_string_cache,
+     uint32_t identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error );
+
+int message_string_cache_append_message_string(
+     message_string_cache_t *message_string_cache,
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_STRING_CACHE_H ) */
+
@@ -0,0 +1,1101 @@
+/*
+ * Network output stream
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "network_stream.h"
+
+/* The socket headers depend on the platform checks in network_stream.h
+ */
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+#include <netdb.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+#endif
+
+/* Determines the protocol of a network address
+ * The address is either tcp://host:port, syslog://host:port or unix:path
+ * Returns 1 if the address is a network address, 0 if not or -1 on error
+ */
+int network_stream_get_protocol(
+     const system_character_t *address,
+     int *protocol,
+     size_t *location_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "network_stream_get_protocol";
+	size_t address_length = 0;
+
+	if( address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid address.",
+		 function );
+
+		return( -1 );
+	}
+	if( protocol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid protocol.",
+		 function );
+
+		return( -1 );
+	}
+	if( location_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location offset.",
+		 function );
+
+		return( -1 );
+	}
+	*protocol        = NETWORK_STREAM_PROTOCOL_NONE;
+	*location_offset = 0;
+
+	address_length = system_string_length(
+	                  address );
+
+	if( ( address_length > 6 )
+	 && ( system_string_compare(
+	       address,
+	       _SYSTEM_STRING( "tcp://" ),
+	       6 ) == 0 ) )
+	{
+		*protocol        = NETWORK_STREAM_PROTOCOL_TCP;
+		*location_offset = 6;
+	}
+	else if( ( address_length > 9 )
+	      && ( system_string_compare(
+	            address,
+	            _SYSTEM_STRING( "syslog://" ),
+	            9 ) == 0 ) )
+	{
+		*protocol        = NETWORK_STREAM_PROTOCOL_SYSLOG;
+		*location_offset = 9;
+	}
+	else if( ( address_length > 5 )
+	      && ( system_string_compare(
+	            address,
+	            _SYSTEM_STRING( "unix:" ),
+	            5 ) == 0 ) )
+	{
+		*protocol        = NETWORK_STREAM_PROTOCOL_UNIX;
+		*location_offset = 5;
+	}
+	else if( ( address_length > 7 )
+	      && ( system_string_compare(
+	            address,
+	            _SYSTEM_STRING( "http://" ),
+	            7 ) == 0 ) )
+	{
+		*protocol        = NETWORK_STREAM_PROTOCOL_HTTP;
+		*location_offset = 7;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+
+/* Connects a TCP socket to the location
+ * The location consists of a host and port separated by a colon, an IPv6 host
+ * is enclosed in brackets
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_connect_tcp(
+     const char *location,
+     int *socket_descriptor,
+     libcerror_error_t **error )
+{
+	char host[ 256 ];
+
+	struct addrinfo hints;
+
+	struct addrinfo *address_information = NULL;
+	struct addrinfo *address_iterator    = NULL;
+	const char *port                     = NULL;
+	static char *function                = "network_stream_connect_tcp";
+	size_t host_length                   = 0;
+	size_t host_offset                   = 0;
+	size_t location_length               = 0;
+	int result                           = 0;
+	int safe_socket_descriptor           = -1;
+
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	location_length = narrow_string_length(
+	                   location );
+
+	port = narrow_string_search_character_reverse(
+	        location,
+	        (int) ':',
+	        location_length );
+
+	if( ( port == NULL )
+	 || ( port[ 1 ] == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid location - missing port.",
+		 function );
+
+		return( -1 );
+	}
+	host_length = (size_t) ( port - location );
+
+	port++;
+
+	if( ( host_length >= 2 )
+	 && ( location[ 0 ] == '[' )
+	 && ( location[ host_length - 1 ] == ']' ) )
+	{
+		host_offset  = 1;
+		host_length -= 2;
+	}
+	if( ( host_length == 0 )
+	 || ( host_length >= sizeof( host ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid location - host length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     host,
+	     &( location[ host_offset ] ),
+	     host_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy host.",
+		 function );
+
+		return( -1 );
+	}
+	host[ host_length ] = 0;
+
+	if( memory_set(
+	     &hints,
+	     0,
+	     sizeof( struct addrinfo ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hints.",
+		 function );
+
+		return( -1 );
+	}
+	hints.ai_family   = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	result = getaddrinfo(
+	          host,
+	          port,
+	          &hints,
+	          &address_information );
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to resolve host: %s with error: %s.",
+		 function,
+		 host,
+		 gai_strerror( result ) );
+
+		return( -1 );
+	}
+	/* The addresses are tried in the order returned by the resolver
+	 */
+	for( address_iterator = address_information;
+	     address_iterator != NULL;
+	     address_iterator = address_iterator->ai_next )
+	{
+		safe_socket_descriptor = socket(
+		                          address_iterator->ai_family,
+		                          address_iterator->ai_socktype,
+		                          address_iterator->ai_protocol );
+
+		if( safe_socket_descriptor == -1 )
+		{
+			continue;
+		}
+		if( connect(
+		     safe_socket_descriptor,
+		     address_iterator->ai_addr,
+		     address_iterator->ai_addrlen ) == 0 )
+		{
+			break;
+		}
+		close(
+		 safe_socket_descriptor );
+
+		safe_socket_descriptor = -1;
+	}
+	freeaddrinfo(
+	 address_information );
+
+	if( safe_socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to connect to: %s.",
+		 function,
+		 location );
+
+		return( -1 );
+	}
+	*socket_descriptor = safe_socket_descriptor;
+
+	return( 1 );
+}
+
+/* Connects a UNIX domain socket to the path in the location
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_connect_unix(
+     const char *location,
+     int *socket_descriptor,
+     libcerror_error_t **error )
+{
+	struct sockaddr_un socket_address;
+
+	static char *function      = "network_stream_connect_unix";
+	size_t location_length     = 0;
+	int safe_socket_descriptor = -1;
+
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	location_length = narrow_string_length(
+	                   location );
+
+	if( ( location_length == 0 )
+	 || ( location_length >= sizeof( socket_address.sun_path ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid location - path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_un ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		return( -1 );
+	}
+	socket_address.sun_family = AF_UNIX;
+
+	if( memory_copy(
+	     socket_address.sun_path,
+	     location,
+	     location_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		return( -1 );
+	}
+	safe_socket_descriptor = socket(
+	                          AF_UNIX,
+	                          SOCK_STREAM,
+	                          0 );
+
+	if( safe_socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create socket.",
+		 function );
+
+		return( -1 );
+	}
+	if( connect(
+	     safe_socket_descriptor,
+	     (struct sockaddr *) &socket_address,
+	     sizeof( struct sockaddr_un ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to connect to: %s.",
+		 function,
+		 location );
+
+		close(
+		 safe_socket_descriptor );
+
+		return( -1 );
+	}
+	*socket_descriptor = safe_socket_descriptor;
+
+	return( 1 );
+}
+
+/* Creates a UNIX domain socket that listens for connections
+ * A socket file left behind at the path by a previous listener is removed
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_listen_unix(
+     const char *location,
+     int *socket_descriptor,
+     libcerror_error_t **error )
+{
+	struct sockaddr_un socket_address;
+
+	static char *function      = "network_stream_listen_unix";
+	size_t location_length     = 0;
+	int safe_socket_descriptor = -1;
+
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	location_length = narrow_string_length(
+	                   location );
+
+	if( ( location_length == 0 )
+	 || ( location_length >= sizeof( socket_address.sun_path ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid location - path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_un ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		return( -1 );
+	}
+	socket_address.sun_family = AF_UNIX;
+
+	if( memory_copy(
+	     socket_address.sun_path,
+	     location,
+	     location_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		return( -1 );
+	}
+	safe_socket_descriptor = socket(
+	                          AF_UNIX,
+	                          SOCK_STREAM,
+	                          0 );
+
+	if( safe_socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create socket.",
+		 function );
+
+		return( -1 );
+	}
+	/* The return value is ignored since the path normally does not exist
+	 */
+	unlink(
+	 location );
+
+	if( bind(
+	     safe_socket_descriptor,
+	     (struct sockaddr *) &socket_address,
+	     sizeof( struct sockaddr_un ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to bind to: %s.",
+		 function,
+		 location );
+
+		close(
+		 safe_socket_descriptor );
+
+		return( -1 );
+	}
+	if( listen(
+	     safe_socket_descriptor,
+	     NETWORK_STREAM_LISTEN_BACKLOG ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to listen on: %s.",
+		 function,
+		 location );
+
+		close(
+		 safe_socket_descriptor );
+
+		unlink(
+		 location );
+
+		return( -1 );
+	}
+	*socket_descriptor = safe_socket_descriptor;
+
+	return( 1 );
+}
+
+/* Accepts a connection on a listening socket
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_accept(
+     int listen_socket_descriptor,
+     int *socket_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function      = "network_stream_accept";
+	int safe_socket_descriptor = -1;
+
+	if( listen_socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listen socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	safe_socket_descriptor = accept(
+	                          listen_socket_descriptor,
+	                          NULL,
+	                          NULL );
+
+	if( safe_socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to accept connection.",
+		 function );
+
+		return( -1 );
+	}
+	*socket_descriptor = safe_socket_descriptor;
+
+	return( 1 );
+}
+
+/* Reads a line from a socket
+ * The line is terminated by a newline character, which is replaced by the end-of-string
+ * character together with a preceding carriage return character. Data received after
+ * the newline character is discarded, hence only one line can be read from a connection
+ * Returns 1 if successful, 0 if the connection was closed or the line is too long or -1 on error
+ */
+int network_stream_read_line(
+     int socket_descriptor,
+     char *line,
+     size_t line_size,
+     size_t *line_length,
+     libcerror_error_t **error )
+{
+	static char *function = "network_stream_read_line";
+	size_t line_offset    = 0;
+	size_t search_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( line_size < 2 )
+	 || ( line_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line length.",
+		 function );
+
+		return( -1 );
+	}
+	while( line_offset < ( line_size - 1 ) )
+	{
+		read_count = recv(
+		              socket_descriptor,
+		              &( line[ line_offset ] ),
+		              line_size - 1 - line_offset,
+		              0 );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from socket.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		line_offset += (size_t) read_count;
+
+		while( search_offset < line_offset )
+		{
+			if( line[ search_offset ] == '\n' )
+			{
+				if( ( search_offset > 0 )
+				 && ( line[ search_offset - 1 ] == '\r' ) )
+				{
+					search_offset--;
+				}
+				line[ search_offset ] = 0;
+
+				*line_length = search_offset;
+
+				return( 1 );
+			}
+			search_offset++;
+		}
+	}
+	return( 0 );
+}
+
+/* Opens a file stream that writes to a connected socket
+ * The stream is unbuffered and closing it closes the socket, the socket is
+ * also closed if the stream cannot be opened
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_open_socket(
+     int socket_descriptor,
+     FILE **stream,
+     libcerror_error_t **error )
+{
+	FILE *safe_stream     = NULL;
+	static char *function = "network_stream_open_socket";
+
+	if( socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		close(
+		 socket_descriptor );
+
+		return( -1 );
+	}
+	/* A write to a connection that was closed by the peer raises SIGPIPE,
+	 * which is ignored so that the write fails instead
+	 */
+	signal(
+	 SIGPIPE,
+	 SIG_IGN );
+
+	safe_stream = fdopen(
+	               socket_descriptor,
+	               "wb" );
+
+	if( safe_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open stream of socket.",
+		 function );
+
+		close(
+		 socket_descriptor );
+
+		return( -1 );
+	}
+	/* The output writer buffers the data before it is written
+	 */
+	setvbuf(
+	 safe_stream,
+	 NULL,
+	 _IONBF,
+	 0 );
+
+	*stream = safe_stream;
+
+	return( 1 );
+}
+
+/* Shuts down a socket
+ * A pending accept or read on the socket returns, hence this function can be
+ * used to interrupt a thread that is waiting for a connection
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_shutdown_socket(
+     int socket_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "network_stream_shutdown_socket";
+
+	if( socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( shutdown(
+	     socket_descriptor,
+	     SHUT_RDWR ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to shut down socket.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a socket
+ * Returns 0 if successful or -1 on error
+ */
+int network_stream_close_socket(
+     int socket_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "network_stream_close_socket";
+
+	if( socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( close(
+	     socket_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close socket.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+
+/* Retrieves the hostname of the system
+ * The hostname is set to "-" if it cannot be determined
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_get_hostname(
+     char *hostname,
+     size_t hostname_size,
+     libcerror_error_t **error )
+{
+	static char *function = "network_stream_get_hostname";
+
+	if( hostname == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hostname.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hostname_size < 2 )
+	 || ( hostname_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hostname size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	if( gethostname(
+	     hostname,
+	     hostname_size ) == 0 )
+	{
+		hostname[ hostname_size - 1 ] = 0;
+
+		if( hostname[ 0 ] != 0 )
+		{
+			return( 1 );
+		}
+	}
+#endif
+	hostname[ 0 ] = '-';
+	hostname[ 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Opens a file stream that writes to a network address
+ * The stream is unbuffered and closing it closes the connection
+ * Returns 1 if successful or -1 on error
+ */
+int network_stream_open(
+     const system_character_t *address,
+     FILE **stream,
+     int *protocol,
+     libcerror_error_t **error )
+{
+	static char *function  = "network_stream_open";
+	size_t location_offset = 0;
+	int address_protocol   = 0;
+	int result             = 0;
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	FILE *safe_stream      = NULL;
+	int socket_descriptor  = -1;
+#endif
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( protocol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid protocol.",
+		 function );
+
+		return( -1 );
+	}
+	result = network_stream_get_protocol(
+	          address,
+	          &address_protocol,
+	          &location_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine protocol of address.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported address.",
+		 function );
+
+		return( -1 );
+	}
+	/* A HTTP address is not a stream but a sequence of requests
+	 */
+	if( address_protocol == NETWORK_STREAM_PROTOCOL_HTTP )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported HTTP address.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	if( address_protocol == NETWORK_STREAM_PROTOCOL_UNIX )
+	{
+		result = network_stream_connect_unix(
+		          &( address[ location_offset ] ),
+		          &socket_descriptor,
+		          error );
+	}
+	else
+	{
+		result = network_stream_connect_tcp(
+		          &( address[ location_offset ] ),
+		          &socket_descriptor,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to connect socket.",
+		 function );
+
+		return( -1 );
+	}
+	if( network_stream_open_socket(
+	     socket_descriptor,
+	     &safe_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open stream of socket.",
+		 function );
+
+		return( -1 );
+	}
+	*stream   = safe_stream;
+	*protocol = address_protocol;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: network output not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+}
+
@@ -0,0 +1,122 @@
+/*
+ * Network output stream
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _NETWORK_STREAM_H )
+#define _NETWORK_STREAM_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Network output is only supported on platforms that provide BSD sockets
+ * which can be used as a file stream
+ */
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_NETDB_H ) && defined( HAVE_SYS_UN_H ) && defined( HAVE_GETADDRINFO )
+#define HAVE_NETWORK_STREAM_SUPPORT
+#endif
+
+/* The maximum number of pending connections of a listening socket
+ */
+#define NETWORK_STREAM_LISTEN_BACKLOG		64
+
+enum NETWORK_STREAM_PROTOCOLS
+{
+	NETWORK_STREAM_PROTOCOL_NONE		= 0,
+	NETWORK_STREAM_PROTOCOL_HTTP		= (int) 'h',
+	NETWORK_STREAM_PROTOCOL_SYSLOG		= (int) 's',
+	NETWORK_STREAM_PROTOCOL_TCP		= (int) 't',
+	NETWORK_STREAM_PROTOCOL_UNIX		= (int) 'u'
+};
+
+int network_stream_get_protocol(
+     const system_character_t *address,
+     int *protocol,
+     size_t *location_offset,
+     libcerror_error_t **error );
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+
+int network_stream_connect_tcp(
+     const char *location,
+     int *socket_descriptor,
+     libcerror_error_t **error );
+
+int network_stream_connect_unix(
+     const char *location,
+     int *socket_descriptor,
+     libcerror_error_t **error );
+
+int network_stream_listen_unix(
+     const char *location,
+     int *socket_descriptor,
+     libcerror_error_t **error );
+
+int network_stream_accept(
+     int listen_socket_descriptor,
+     int *socket_descriptor,
+     libcerror_error_t **error );
+
+int network_stream_read_line(
+     int socket_descriptor,
+     char *line,
+     size_t line_size,
+     size_t *line_length,
+     libcerror_error_t **error );
+
+int network_stream_open_socket(
+     int socket_descriptor,
+     FILE **stream,
+     libcerror_error_t **error );
+
+int network_stream_shutdown_socket(
+     int socket_descriptor,
+     libcerror_error_t **error );
+
+int network_stream_close_socket(
+     int socket_descriptor,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+
+int network_stream_get_hostname(
+     char *hostname,
+     size_t hostname_size,
+     libcerror_error_t **error );
+
+int network_stream_open(
+     const system_character_t *address,
+     FILE **stream,
+     int *protocol,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _NETWORK_STREAM_H ) */
+
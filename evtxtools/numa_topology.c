@@ -0,0 +1,613 @@
+/*
+ * NUMA topology functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( __linux__ ) && !defined( WINAPI )
+#include <sched.h>
+
+#if defined( CPU_SET ) && defined( CPU_ZERO )
+#define HAVE_NUMA_TOPOLOGY_SYSFS
+#endif
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "numa_topology.h"
+
+/* Creates a NUMA topology
+ * The nodes are determined from /sys/devices/system/node on Linux and using
+ * GetNumaHighestNodeNumber on Windows. The number of nodes is 0 if the
+ * topology cannot be determined
+ * Make sure the value numa_topology is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int numa_topology_initialize(
+     numa_topology_t **numa_topology,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_NUMA_TOPOLOGY_SYSFS )
+	char cpu_list[ 512 ];
+	char cpu_list_path[ 64 ];
+
+	FILE *file_stream        = NULL;
+	size_t cpu_list_size     = 0;
+#elif defined( WINAPI )
+	ULONGLONG processor_mask = 0;
+	ULONG highest_node       = 0;
+	int cpu_index            = 0;
+#endif
+	static char *function    = "numa_topology_initialize";
+	int node_index           = 0;
+
+	if( numa_topology == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NUMA topology.",
+		 function );
+
+		return( -1 );
+	}
+	if( *numa_topology != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid NUMA topology value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*numa_topology = memory_allocate_structure(
+	                  numa_topology_t );
+
+	if( *numa_topology == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create NUMA topology.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *numa_topology,
+	     0,
+	     sizeof( numa_topology_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear NUMA topology.",
+		 function );
+
+		memory_free(
+		 *numa_topology );
+
+		*numa_topology = NULL;
+
+		return( -1 );
+	}
+	( *numa_topology )->cpu_masks = (uint8_t *) memory_allocate(
+	                                             NUMA_TOPOLOGY_CPU_MASK_SIZE * NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_NODES );
+
+	if( ( *numa_topology )->cpu_masks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create CPU masks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *numa_topology )->cpu_masks,
+	     0,
+	     NUMA_TOPOLOGY_CPU_MASK_SIZE * NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_NODES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear CPU masks.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_NUMA_TOPOLOGY_SYSFS )
+	/* The node numbers are consecutive, except on systems with memory-less
+	 * or offline nodes, which are not used to place threads
+	 */
+	for( node_index = 0;
+	     node_index < NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_NODES;
+	     node_index++ )
+	{
+		if( narrow_string_snprintf(
+		     cpu_list_path,
+		     64,
+		     "/sys/devices/system/node/node%d/cpulist",
+		     node_index ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set CPU list path.",
+			 function );
+
+			goto on_error;
+		}
+		file_stream = file_stream_open(
+		               cpu_list_path,
+		               "r" );
+
+		if( file_stream == NULL )
+		{
+			break;
+		}
+		if( file_stream_get_string(
+		     file_stream,
+		     cpu_list,
+		     512 ) == NULL )
+		{
+			cpu_list[ 0 ] = 0;
+		}
+		file_stream_close(
+		 file_stream );
+
+		file_stream = NULL;
+
+		cpu_list_size = narrow_string_length(
+		                 cpu_list );
+
+		if( numa_topology_read_cpu_list(
+		     *numa_topology,
+		     node_index,
+		     cpu_list,
+		     cpu_list_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read CPU list of node: %d.",
+			 function,
+			 node_index );
+
+			goto on_error;
+		}
+		( *numa_topology )->number_of_nodes = node_index + 1;
+	}
+#elif defined( WINAPI )
+	if( GetNumaHighestNodeNumber(
+	     &highest_node ) != 0 )
+	{
+		for( node_index = 0;
+		     ( node_index <= (int) highest_node )
+		  && ( node_index < NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_NODES );
+		     node_index++ )
+		{
+			if( GetNumaNodeProcessorMask(
+			     (UCHAR) node_index,
+			     &processor_mask ) == 0 )
+			{
+				break;
+			}
+			for( cpu_index = 0;
+			     cpu_index < 64;
+			     cpu_index++ )
+			{
+				if( ( processor_mask & ( (ULONGLONG) 1 << cpu_index ) ) != 0 )
+				{
+					( *numa_topology )->cpu_masks[ ( node_index * NUMA_TOPOLOGY_CPU_MASK_SIZE ) + ( cpu_index / 8 ) ] |= (uint8_t) ( 1 << ( cpu_index % 8 ) );
+				}
+			}
+			( *numa_topology )->number_of_nodes = node_index + 1;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_NUMA_TOPOLOGY_SYSFS )
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+#endif
+	if( *numa_topology != NULL )
+	{
+		if( ( *numa_topology )->cpu_masks != NULL )
+		{
+			memory_free(
+			 ( *numa_topology )->cpu_masks );
+		}
+		memory_free(
+		 *numa_topology );
+
+		*numa_topology = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a NUMA topology
+ * Returns 1 if successful or -1 on error
+ */
+int numa_topology_free(
+     numa_topology_t **numa_topology,
+     libcerror_error_t **error )
+{
+	static char *function = "numa_topology_free";
+
+	if( numa_topology == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NUMA topology.",
+		 function );
+
+		return( -1 );
+	}
+	if( *numa_topology != NULL )
+	{
+		memory_free(
+		 ( *numa_topology )->cpu_masks );
+
+		memory_free(
+		 *numa_topology );
+
+		*numa_topology = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a CPU list of a node into its CPU mask
+ * The CPU list is formatted as the Linux cpulist, such as: 0-15,32-47
+ * Returns 1 if successful or -1 on error
+ */
+int numa_topology_read_cpu_list(
+     numa_topology_t *numa_topology,
+     int node_index,
+     const char *cpu_list,
+     size_t cpu_list_size,
+     libcerror_error_t **error )
+{
+	uint8_t *cpu_mask     = NULL;
+	static char *function = "numa_topology_read_cpu_list";
+	size_t string_index   = 0;
+	int cpu_index         = 0;
+	int first_cpu_index   = 0;
+	int last_cpu_index    = 0;
+	int number_of_digits  = 0;
+	int value             = 0;
+	int in_range          = 0;
+
+	if( numa_topology == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NUMA topology.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_NODES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cpu_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CPU list.",
+		 function );
+
+		return( -1 );
+	}
+	if( cpu_list_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid CPU list size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	cpu_mask = &( numa_topology->cpu_masks[ node_index * NUMA_TOPOLOGY_CPU_MASK_SIZE ] );
+
+	/* The string index runs past the end of the string to terminate the last value
+	 */
+	for( string_index = 0;
+	     string_index <= cpu_list_size;
+	     string_index++ )
+	{
+		if( ( string_index < cpu_list_size )
+		 && ( cpu_list[ string_index ] >= '0' )
+		 && ( cpu_list[ string_index ] <= '9' ) )
+		{
+			if( value > ( NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_CPUS / 10 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid CPU index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			value = ( value * 10 ) + ( cpu_list[ string_index ] - '0' );
+
+			number_of_digits++;
+
+			continue;
+		}
+		if( ( string_index < cpu_list_size )
+		 && ( cpu_list[ string_index ] == '-' ) )
+		{
+			if( ( number_of_digits == 0 )
+			 || ( in_range != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported CPU list.",
+				 function );
+
+				return( -1 );
+			}
+			first_cpu_index  = value;
+			in_range         = 1;
+			number_of_digits = 0;
+			value            = 0;
+
+			continue;
+		}
+		/* A comma, new line or end of string terminates a value
+		 */
+		if( number_of_digits != 0 )
+		{
+			last_cpu_index = value;
+
+			if( in_range == 0 )
+			{
+				first_cpu_index = value;
+			}
+			if( ( first_cpu_index > last_cpu_index )
+			 || ( last_cpu_index >= NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_CPUS ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid CPU range value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			for( cpu_index = first_cpu_index;
+			     cpu_index <= last_cpu_index;
+			     cpu_index++ )
+			{
+				cpu_mask[ cpu_index / 8 ] |= (uint8_t) ( 1 << ( cpu_index % 8 ) );
+			}
+		}
+		else if( in_range != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported CPU list.",
+			 function );
+
+			return( -1 );
+		}
+		in_range         = 0;
+		number_of_digits = 0;
+		value            = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of nodes
+ * Returns 1 if successful or -1 on error
+ */
+int numa_topology_get_number_of_nodes(
+     numa_topology_t *numa_topology,
+     int *number_of_nodes,
+     libcerror_error_t **error )
+{
+	static char *function = "numa_topology_get_number_of_nodes";
+
+	if( numa_topology == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NUMA topology.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nodes = numa_topology->number_of_nodes;
+
+	return( 1 );
+}
+
+/* Binds the calling thread to the CPUs of a node
+ * Memory the thread touches first after it is bound, such as its file
+ * and chunk buffers, is allocated from the memory of the node
+ * Returns 1 if successful or -1 on error
+ */
+int numa_topology_bind_thread_to_node(
+     numa_topology_t *numa_topology,
+     int node_index,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_NUMA_TOPOLOGY_SYSFS )
+	cpu_set_t cpu_set;
+
+	uint8_t *cpu_mask        = NULL;
+	int cpu_index            = 0;
+#elif defined( WINAPI )
+	DWORD_PTR affinity_mask  = 0;
+	uint8_t *cpu_mask        = NULL;
+	int cpu_index            = 0;
+#endif
+	static char *function    = "numa_topology_bind_thread_to_node";
+
+	if( numa_topology == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NUMA topology.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= numa_topology->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_NUMA_TOPOLOGY_SYSFS )
+	cpu_mask = &( numa_topology->cpu_masks[ node_index * NUMA_TOPOLOGY_CPU_MASK_SIZE ] );
+
+	CPU_ZERO(
+	 &cpu_set );
+
+	for( cpu_index = 0;
+	     ( cpu_index < NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_CPUS )
+	  && ( cpu_index < CPU_SETSIZE );
+	     cpu_index++ )
+	{
+		if( ( cpu_mask[ cpu_index / 8 ] & ( 1 << ( cpu_index % 8 ) ) ) != 0 )
+		{
+			CPU_SET(
+			 cpu_index,
+			 &cpu_set );
+		}
+	}
+	/* A process identifier of 0 represents the calling thread
+	 */
+	if( sched_setaffinity(
+	     0,
+	     sizeof( cpu_set_t ),
+	     &cpu_set ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set affinity of thread to node: %d.",
+		 function,
+		 node_index );
+
+		return( -1 );
+	}
+#elif defined( WINAPI )
+	cpu_mask = &( numa_topology->cpu_masks[ node_index * NUMA_TOPOLOGY_CPU_MASK_SIZE ] );
+
+	for( cpu_index = 0;
+	     cpu_index < (int) ( sizeof( DWORD_PTR ) * 8 );
+	     cpu_index++ )
+	{
+		if( ( cpu_mask[ cpu_index / 8 ] & ( 1 << ( cpu_index % 8 ) ) ) != 0 )
+		{
+			affinity_mask |= (DWORD_PTR) 1 << cpu_index;
+		}
+	}
+	if( SetThreadAffinityMask(
+	     GetCurrentThread(),
+	     affinity_mask ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set affinity of thread to node: %d.",
+		 function,
+		 node_index );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
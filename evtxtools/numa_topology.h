@@ -0,0 +1,91 @@
+/*
+ * NUMA topology functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _NUMA_TOPOLOGY_H )
+#define _NUMA_TOPOLOGY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of NUMA nodes
+ */
+#define NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_NODES	64
+
+/* The maximum number of CPUs
+ */
+#define NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_CPUS	1024
+
+/* The size of the CPU mask of a node
+ */
+#define NUMA_TOPOLOGY_CPU_MASK_SIZE		( NUMA_TOPOLOGY_MAXIMUM_NUMBER_OF_CPUS / 8 )
+
+typedef struct numa_topology numa_topology_t;
+
+struct numa_topology
+{
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The CPU masks of the nodes
+	 * Contains a bit per CPU and NUMA_TOPOLOGY_CPU_MASK_SIZE bytes per node
+	 */
+	uint8_t *cpu_masks;
+};
+
+int numa_topology_initialize(
+     numa_topology_t **numa_topology,
+     libcerror_error_t **error );
+
+int numa_topology_free(
+     numa_topology_t **numa_topology,
+     libcerror_error_t **error );
+
+int numa_topology_read_cpu_list(
+     numa_topology_t *numa_topology,
+     int node_index,
+     const char *cpu_list,
+     size_t cpu_list_size,
+     libcerror_error_t **error );
+
+int numa_topology_get_number_of_nodes(
+     numa_topology_t *numa_topology,
+     int *number_of_nodes,
+     libcerror_error_t **error );
+
+int numa_topology_bind_thread_to_node(
+     numa_topology_t *numa_topology,
+     int node_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _NUMA_TOPOLOGY_H ) */
+
@@ -0,0 +1,2422 @@
+/*
+ * Buffered output writer
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#elif defined( HAVE_VARARGS_H )
+#include <varargs.h>
+#else
+#error Missing headers stdarg.h and varargs.h
+#endif
+
+#if defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "http_bulk_sink.h"
+#include "network_stream.h"
+#include "output_writer.h"
+
+/* Creates an output writer
+ * Make sure the value output_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_initialize(
+     output_writer_t **output_writer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_initialize";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	*output_writer = memory_allocate_structure(
+	                output_writer_t );
+
+	if( *output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_writer,
+	     0,
+	     sizeof( output_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_writer )->buffer = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * OUTPUT_WRITER_BUFFER_SIZE );
+
+	if( ( *output_writer )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_writer )->stream      = stream;
+	( *output_writer )->buffer_size = OUTPUT_WRITER_BUFFER_SIZE;
+	( *output_writer )->flush_size  = OUTPUT_WRITER_BUFFER_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *output_writer != NULL )
+	{
+		memory_free(
+		 *output_writer );
+
+		*output_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output writer
+ * Data that was not flushed is discarded and an output file opened by the writer is closed
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_free(
+     output_writer_t **output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_free";
+	int result            = 1;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_writer != NULL )
+	{
+		if( ( *output_writer )->compressed_output_stream != NULL )
+		{
+			if( compressed_output_stream_free(
+			     &( ( *output_writer )->compressed_output_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressed output stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *output_writer )->http_bulk_sink != NULL )
+		{
+			if( http_bulk_sink_free(
+			     &( ( *output_writer )->http_bulk_sink ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free HTTP bulk sink.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( ( *output_writer )->stream_is_open != 0 )
+		 && ( ( *output_writer )->stream != NULL ) )
+		{
+			if( file_stream_close(
+			     ( *output_writer )->stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *output_writer )->buffer );
+
+		memory_free(
+		 *output_writer );
+
+		*output_writer = NULL;
+	}
+	return( result );
+}
+
+/* Sets the compression of the output file
+ * The compression applies to the output files opened after it is set
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_set_compression(
+     output_writer_t *output_writer,
+     int compression_method,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_set_compression";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_method != COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_NONE )
+	 && ( compression_method != COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_GZIP )
+	 && ( compression_method != COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_ZSTD ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid compression level value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->compression_method            = compression_method;
+	output_writer->compression_level             = compression_level;
+	output_writer->number_of_compression_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the flush interval
+ * The buffered data is written at the end of a record when the flush interval has
+ * elapsed since the last flush, even if the buffer is not full
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_set_flush_interval(
+     output_writer_t *output_writer,
+     int flush_interval,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_set_flush_interval";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( flush_interval < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid flush interval value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->flush_interval  = flush_interval;
+	output_writer->last_flush_time = time(
+	                                  NULL );
+
+	return( 1 );
+}
+
+/* Opens an output file that is written instead of the output stream
+ * The filename can also be a network address: tcp://host:port, syslog://host:port
+ * or unix:path. The data written to a TCP address is sent in batches prefixed with
+ * their 32-bit big-endian size, every record written to a syslog address is sent
+ * as a separate message
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_open(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream           = NULL;
+	static char *function  = "output_writer_open";
+	size_t location_offset = 0;
+	int protocol           = 0;
+	int result             = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->stream_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer - output file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	result = network_stream_get_protocol(
+	          filename,
+	          &protocol,
+	          &location_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine network protocol of filename.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The compressed output stream writes to the stream directly
+		 * and would bypass the framing
+		 */
+		if( output_writer->compression_method != COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_NONE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: compression is not supported with network output.",
+			 function );
+
+			return( -1 );
+		}
+		/* The HTTP bulk sink has no output stream, it connects when
+		 * the first bulk request is sent
+		 */
+		if( protocol != NETWORK_STREAM_PROTOCOL_HTTP )
+		{
+			if( network_stream_open(
+			     filename,
+			     &stream,
+			     &protocol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open network output.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		stream = file_stream_open_wide(
+		          filename,
+		          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+		stream = file_stream_open(
+		          filename,
+		          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+		if( stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open output file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( output_writer_flush(
+	     output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		if( stream != NULL )
+		{
+			file_stream_close(
+			 stream );
+		}
+		return( -1 );
+	}
+	if( output_writer->compression_method != COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_NONE )
+	{
+		if( compressed_output_stream_initialize(
+		     &( output_writer->compressed_output_stream ),
+		     stream,
+		     output_writer->compression_method,
+		     output_writer->compression_level,
+		     output_writer->number_of_compression_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed output stream.",
+			 function );
+
+			file_stream_close(
+			 stream );
+
+			return( -1 );
+		}
+	}
+	if( protocol == NETWORK_STREAM_PROTOCOL_SYSLOG )
+	{
+		if( network_stream_get_hostname(
+		     output_writer->syslog_hostname,
+		     256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hostname.",
+			 function );
+
+			file_stream_close(
+			 stream );
+
+			return( -1 );
+		}
+		output_writer->framing = OUTPUT_WRITER_FRAMING_SYSLOG;
+	}
+	else if( protocol == NETWORK_STREAM_PROTOCOL_TCP )
+	{
+		output_writer->framing = OUTPUT_WRITER_FRAMING_LENGTH_PREFIXED;
+	}
+	else if( protocol == NETWORK_STREAM_PROTOCOL_HTTP )
+	{
+		if( http_bulk_sink_initialize(
+		     &( output_writer->http_bulk_sink ),
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create HTTP bulk sink.",
+			 function );
+
+			return( -1 );
+		}
+		/* The records are batched into bulk requests of a larger size
+		 */
+		output_writer->framing    = OUTPUT_WRITER_FRAMING_HTTP_BULK;
+		output_writer->flush_size = HTTP_BULK_SINK_BATCH_SIZE;
+	}
+	output_writer->stream         = stream;
+	output_writer->stream_is_open = 1;
+	output_writer->output_offset  = 0;
+
+	return( 1 );
+}
+
+/* Opens an existing output file to continue writing at a specific offset
+ * The data after the offset, written by an interrupted export, is truncated
+ * Network output and compression are not supported since their data cannot be rewritten
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_open_resume(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     uint64_t output_offset,
+     libcerror_error_t **error )
+{
+	FILE *stream           = NULL;
+	static char *function  = "output_writer_open_resume";
+	size_t location_offset = 0;
+	int protocol           = 0;
+	int result             = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->stream_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer - output file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->compression_method != COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_NONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: compression is not supported when resuming output.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_offset > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid output offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = network_stream_get_protocol(
+	          filename,
+	          &protocol,
+	          &location_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine network protocol of filename.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: network output cannot be resumed.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_seek_offset(
+	     stream,
+	     0,
+	     SEEK_END ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek end of output file.",
+		 function );
+
+		goto on_error;
+	}
+	/* An output file that is smaller than the offset was not written by
+	 * the interrupted export and is not extended
+	 */
+#if defined( WINAPI )
+	if( (uint64_t) _ftelli64( stream ) < output_offset )
+#else
+	if( (uint64_t) ftello( stream ) < output_offset )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid output file - size is smaller than the output offset.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	result = _chsize_s(
+	          _fileno( stream ),
+	          (__int64) output_offset );
+#else
+	result = ftruncate(
+	          fileno( stream ),
+	          (off_t) output_offset );
+#endif
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to truncate output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_seek_offset(
+	     stream,
+	     (off_t) output_offset,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek output offset: %" PRIu64 " in output file.",
+		 function,
+		 output_offset );
+
+		goto on_error;
+	}
+	output_writer->stream         = stream;
+	output_writer->stream_is_open = 1;
+	output_writer->output_offset  = output_offset;
+	output_writer->buffer_offset  = 0;
+	output_writer->record_offset  = 0;
+
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 stream );
+
+	return( -1 );
+}
+
+/* Opens an output file to append to, it is created if it does not exist
+ * A compressed output file is continued with a new compressed stream
+ * that follows the existing data
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_open_append(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "output_writer_open_append";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->stream_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer - output file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_APPEND ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_APPEND );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_flush(
+	     output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer->compression_method != COMPRESSED_OUTPUT_STREAM_COMPRESSION_METHOD_NONE )
+	{
+		if( compressed_output_stream_initialize(
+		     &( output_writer->compressed_output_stream ),
+		     stream,
+		     output_writer->compression_method,
+		     output_writer->compression_level,
+		     output_writer->number_of_compression_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed output stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	output_writer->stream         = stream;
+	output_writer->stream_is_open = 1;
+	output_writer->output_offset  = 0;
+
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 stream );
+
+	return( -1 );
+}
+
+/* Opens an already opened stream that is written instead of the output stream
+ * The writer takes over the stream and closes it when the output is closed
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_open_stream(
+     output_writer_t *output_writer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_open_stream";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->stream_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer - output file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_flush(
+	     output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->stream         = stream;
+	output_writer->stream_is_open = 1;
+
+	return( 1 );
+}
+
+/* Flushes the buffered data and closes the output file opened by the writer
+ * Returns 0 if successful or -1 on error
+ */
+int output_writer_close(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_close";
+	int result            = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->stream_is_open == 0 )
+	{
+		return( 0 );
+	}
+	if( output_writer_flush(
+	     output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		result = -1;
+	}
+	if( output_writer->compressed_output_stream != NULL )
+	{
+		if( compressed_output_stream_finish(
+		     output_writer->compressed_output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to finish compressed output stream.",
+			 function );
+
+			result = -1;
+		}
+		if( compressed_output_stream_free(
+		     &( output_writer->compressed_output_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed output stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( output_writer->http_bulk_sink != NULL )
+	{
+		if( http_bulk_sink_finish(
+		     output_writer->http_bulk_sink,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to finish HTTP bulk sink.",
+			 function );
+
+			result = -1;
+		}
+		if( http_bulk_sink_free(
+		     &( output_writer->http_bulk_sink ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free HTTP bulk sink.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( output_writer->stream != NULL )
+	{
+		if( file_stream_close(
+		     output_writer->stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* Data that could not be flushed cannot be written once the stream is closed
+	 */
+	output_writer->stream         = NULL;
+	output_writer->stream_is_open = 0;
+	output_writer->buffer_offset  = 0;
+	output_writer->record_offset  = 0;
+	output_writer->flush_size     = OUTPUT_WRITER_BUFFER_SIZE;
+	output_writer->framing        = OUTPUT_WRITER_FRAMING_NONE;
+
+	return( result );
+}
+
+/* Frames the record at the end of the buffer as a syslog message
+ * The message uses the RFC 5424 format and the octet counting framing of RFC 6587
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_frame_syslog_record(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	char frame_header[ 320 ];
+	char message_header[ 320 ];
+
+	static char *function        = "output_writer_frame_syslog_record";
+	size_t buffer_index          = 0;
+	size_t frame_header_size     = 0;
+	size_t message_header_length = 0;
+	size_t record_size           = 0;
+	int print_count              = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->record_offset >= output_writer->buffer_offset )
+	{
+		return( 1 );
+	}
+	record_size = output_writer->buffer_offset - output_writer->record_offset;
+
+	/* The trailing end-of-line characters of the record are not part of the message
+	 */
+	while( ( record_size > 0 )
+	    && ( ( output_writer->buffer[ output_writer->record_offset + record_size - 1 ] == (uint8_t) '\n' )
+	     ||  ( output_writer->buffer[ output_writer->record_offset + record_size - 1 ] == (uint8_t) '\r' ) ) )
+	{
+		record_size--;
+	}
+	output_writer->buffer_offset = output_writer->record_offset + record_size;
+
+	if( record_size == 0 )
+	{
+		return( 1 );
+	}
+	/* The timestamp, process identifier, message identifier and structured data
+	 * are not provided, the written time is part of the record
+	 */
+	print_count = narrow_string_snprintf(
+	               message_header,
+	               320,
+	               "<%d>1 - %s %s - - - ",
+	               OUTPUT_WRITER_SYSLOG_PRIORITY,
+	               output_writer->syslog_hostname,
+	               OUTPUT_WRITER_SYSLOG_APPLICATION_NAME );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 320 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set message header.",
+		 function );
+
+		return( -1 );
+	}
+	message_header_length = (size_t) print_count;
+
+	print_count = narrow_string_snprintf(
+	               frame_header,
+	               320,
+	               "%" PRIzu " %s",
+	               message_header_length + record_size,
+	               message_header );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 320 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set frame header.",
+		 function );
+
+		return( -1 );
+	}
+	frame_header_size = (size_t) print_count;
+
+	if( output_writer_resize_buffer(
+	     output_writer,
+	     frame_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record is moved backwards since the source and destination overlap
+	 */
+	for( buffer_index = output_writer->buffer_offset;
+	     buffer_index > output_writer->record_offset;
+	     buffer_index-- )
+	{
+		output_writer->buffer[ buffer_index + frame_header_size - 1 ] = output_writer->buffer[ buffer_index - 1 ];
+	}
+	if( memory_copy(
+	     &( output_writer->buffer[ output_writer->record_offset ] ),
+	     frame_header,
+	     frame_header_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy frame header.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset += frame_header_size;
+	output_writer->record_offset  = output_writer->buffer_offset;
+
+	return( 1 );
+}
+
+/* Writes the buffered data to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_flush(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	uint8_t batch_header[ 4 ];
+
+	static char *function = "output_writer_flush";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->framing == OUTPUT_WRITER_FRAMING_SYSLOG )
+	{
+		if( output_writer_frame_syslog_record(
+		     output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to frame syslog record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( output_writer->buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+	if( output_writer->http_bulk_sink != NULL )
+	{
+		if( http_bulk_sink_send(
+		     output_writer->http_bulk_sink,
+		     output_writer->buffer,
+		     output_writer->buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to send buffer to HTTP bulk sink.",
+			 function );
+
+			return( -1 );
+		}
+		output_writer->output_offset += output_writer->buffer_offset;
+	}
+	else if( output_writer->compressed_output_stream != NULL )
+	{
+		if( compressed_output_stream_write(
+		     output_writer->compressed_output_stream,
+		     output_writer->buffer,
+		     output_writer->buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer to compressed output stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( output_writer->framing == OUTPUT_WRITER_FRAMING_LENGTH_PREFIXED )
+		{
+			if( output_writer->buffer_offset > (size_t) UINT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid buffer offset value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint32_big_endian(
+			 batch_header,
+			 (uint32_t) output_writer->buffer_offset );
+
+			if( file_stream_write(
+			     output_writer->stream,
+			     batch_header,
+			     4 ) != 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write batch header to stream.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( file_stream_write(
+		     output_writer->stream,
+		     output_writer->buffer,
+		     output_writer->buffer_offset ) != output_writer->buffer_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer to stream.",
+			 function );
+
+			return( -1 );
+		}
+		output_writer->output_offset += output_writer->buffer_offset;
+	}
+	output_writer->buffer_offset = 0;
+	output_writer->record_offset = 0;
+
+	if( output_writer->flush_interval > 0 )
+	{
+		output_writer->last_flush_time = time(
+		                                  NULL );
+	}
+	return( 1 );
+}
+
+/* Writes the buffered data and flushes the output stream
+ * A compressed output stream is flushed so that the data written so far can be decompressed
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_flush_stream(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_flush_stream";
+
+	if( output_writer_flush(
+	     output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->compressed_output_stream != NULL )
+	{
+		if( compressed_output_stream_flush(
+		     output_writer->compressed_output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush compressed output stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( output_writer->stream != NULL )
+	{
+		fflush(
+		 output_writer->stream );
+	}
+	return( 1 );
+}
+
+/* Writes the buffered data to the output stream when the buffer is full
+ * This function is called between records so that a record is written as a whole
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_flush_when_full(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_flush_when_full";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->framing == OUTPUT_WRITER_FRAMING_SYSLOG )
+	{
+		if( output_writer_frame_syslog_record(
+		     output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to frame syslog record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( output_writer->buffer_offset >= output_writer->flush_size )
+	 || ( ( output_writer->flush_interval > 0 )
+	  &&  ( output_writer->buffer_offset > 0 )
+	  &&  ( ( time( NULL ) - output_writer->last_flush_time ) >= (time_t) output_writer->flush_interval ) ) )
+	{
+		if( output_writer_flush(
+		     output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Resizes the buffer to contain at least the additional data size
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_resize_buffer(
+     output_writer_t *output_writer,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "output_writer_resize_buffer";
+	size_t buffer_size    = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( ( (size_t) SSIZE_MAX / 2 ) - output_writer->buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size <= ( output_writer->buffer_size - output_writer->buffer_offset ) )
+	{
+		return( 1 );
+	}
+	buffer_size = output_writer->buffer_size;
+
+	while( data_size > ( buffer_size - output_writer->buffer_offset ) )
+	{
+		buffer_size *= 2;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            output_writer->buffer,
+	                            sizeof( uint8_t ) * buffer_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer      = reallocation;
+	output_writer->buffer_size = buffer_size;
+
+	return( 1 );
+}
+
+/* Writes data as-is
+ * The buffer is resized when the data does not fit, the data is only written
+ * to the output stream on flush, which allows to discard a partially written value
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_data(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_data";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_resize_buffer(
+	     output_writer,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( output_writer->buffer[ output_writer->buffer_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset += data_size;
+
+	return( 1 );
+}
+
+/* Writes an ASCII string as-is
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_ascii_string(
+     output_writer_t *output_writer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_ascii_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a system string as-is
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_system_string(
+     output_writer_t *output_writer,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_system_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( output_writer_printf(
+	     output_writer,
+	     "%" PRIs_SYSTEM "",
+	     string ) < 0 )
+#else
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#define VARARGS( function, type, argument ) \
+	function( output_writer_t *output_writer, type argument, ... )
+#define VASTART( argument_list, type, name ) \
+	va_start( argument_list, name )
+#define VAEND( argument_list ) \
+	va_end( argument_list )
+
+#elif defined( HAVE_VARARGS_H )
+#define VARARGS( function, type, argument ) \
+	function( output_writer_t *output_writer, va_alist ) va_dcl
+#define VASTART( argument_list, type, name ) \
+	{ type name; va_start( argument_list ); name = va_arg( argument_list, type )
+#define VAEND( argument_list ) \
+	va_end( argument_list ); }
+
+#endif
+
+/* Prints a formatted string into the buffer
+ * Returns the number of printed characters if successful or -1 on error
+ */
+int VARARGS(
+     output_writer_printf,
+     char *,
+     format )
+{
+	va_list argument_list;
+
+	size_t print_size = 0;
+	int print_count   = 0;
+
+	if( output_writer == NULL )
+	{
+		return( -1 );
+	}
+	print_size = output_writer->buffer_size - output_writer->buffer_offset;
+
+	VASTART(
+	 argument_list,
+	 char *,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               (char *) &( output_writer->buffer[ output_writer->buffer_offset ] ),
+	               print_size,
+	               format,
+	               argument_list );
+
+	VAEND(
+	 argument_list );
+
+	if( print_count < 0 )
+	{
+		return( -1 );
+	}
+	/* The formatted string did not fit, it is printed again after resizing the buffer
+	 */
+	if( (size_t) print_count >= print_size )
+	{
+		if( output_writer_resize_buffer(
+		     output_writer,
+		     (size_t) print_count + 1,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		print_size = output_writer->buffer_size - output_writer->buffer_offset;
+
+		VASTART(
+		 argument_list,
+		 char *,
+		 format );
+
+		print_count = narrow_string_vsnprintf(
+		               (char *) &( output_writer->buffer[ output_writer->buffer_offset ] ),
+		               print_size,
+		               format,
+		               argument_list );
+
+		VAEND(
+		 argument_list );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= print_size ) )
+		{
+			return( -1 );
+		}
+	}
+	output_writer->buffer_offset += (size_t) print_count;
+
+	return( print_count );
+}
+
+#undef VARARGS
+#undef VASTART
+#undef VAEND
+
+/* Writes an UTF-8 encoded string as a quoted JSON string
+ * The quotation mark, reverse solidus and control characters are escaped
+ * The string is written up to the end of string character or the size
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_json_string(
+     output_writer_t *output_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t escaped_character[ 7 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "output_writer_write_json_string";
+	size_t escaped_character_size  = 0;
+	size_t string_index            = 0;
+	size_t run_start_index         = 0;
+	uint8_t character              = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < utf8_string_size;
+	     string_index++ )
+	{
+		character = utf8_string[ string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( ( character >= 0x20 )
+		 && ( character != (uint8_t) '"' )
+		 && ( character != (uint8_t) '\\' ) )
+		{
+			continue;
+		}
+		if( string_index > run_start_index )
+		{
+			if( output_writer_write_data(
+			     output_writer,
+			     &( utf8_string[ run_start_index ] ),
+			     string_index - run_start_index,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		run_start_index = string_index + 1;
+
+		escaped_character[ 0 ] = (uint8_t) '\\';
+		escaped_character_size = 2;
+
+		switch( character )
+		{
+			case (uint8_t) '"':
+			case (uint8_t) '\\':
+				escaped_character[ 1 ] = character;
+				break;
+
+			case (uint8_t) '\b':
+				escaped_character[ 1 ] = (uint8_t) 'b';
+				break;
+
+			case (uint8_t) '\f':
+				escaped_character[ 1 ] = (uint8_t) 'f';
+				break;
+
+			case (uint8_t) '\n':
+				escaped_character[ 1 ] = (uint8_t) 'n';
+				break;
+
+			case (uint8_t) '\r':
+				escaped_character[ 1 ] = (uint8_t) 'r';
+				break;
+
+			case (uint8_t) '\t':
+				escaped_character[ 1 ] = (uint8_t) 't';
+				break;
+
+			default:
+				escaped_character[ 1 ] = (uint8_t) 'u';
+				escaped_character[ 2 ] = (uint8_t) '0';
+				escaped_character[ 3 ] = (uint8_t) '0';
+				escaped_character[ 4 ] = (uint8_t) hexadecimal_digits[ character >> 4 ];
+				escaped_character[ 5 ] = (uint8_t) hexadecimal_digits[ character & 0x0f ];
+				escaped_character_size = 6;
+				break;
+		}
+		if( output_writer_write_data(
+		     output_writer,
+		     escaped_character,
+		     escaped_character_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( string_index > run_start_index )
+	{
+		if( output_writer_write_data(
+		     output_writer,
+		     &( utf8_string[ run_start_index ] ),
+		     string_index - run_start_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes an object member name followed by the name separator
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_json_member_name(
+     output_writer_t *output_writer,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_json_member_name";
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_json_string(
+	     output_writer,
+	     (uint8_t *) name,
+	     narrow_string_length(
+	      name ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write name.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_data(
+	     output_writer,
+	     (uint8_t *) ":",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write name separator.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an unsigned integer as a JSON number
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_unsigned_integer(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t number_string[ 20 ];
+
+	static char *function      = "output_writer_write_unsigned_integer";
+	size_t number_string_index = 20;
+
+	do
+	{
+		number_string_index--;
+
+		number_string[ number_string_index ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
+
+		value_64bit /= 10;
+	}
+	while( value_64bit > 0 );
+
+	if( output_writer_write_data(
+	     output_writer,
+	     &( number_string[ number_string_index ] ),
+	     20 - number_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write number.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Quotes the data written since the value offset as a CSV value
+ * The value is enclosed in quotation marks and the quotation marks of the value are doubled
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_quote_csv_value(
+     output_writer_t *output_writer,
+     size_t value_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "output_writer_quote_csv_value";
+	size_t destination_offset = 0;
+	size_t number_of_quotes   = 0;
+	size_t source_offset      = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_offset > output_writer->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( source_offset = value_offset;
+	     source_offset < output_writer->buffer_offset;
+	     source_offset++ )
+	{
+		if( output_writer->buffer[ source_offset ] == (uint8_t) '"' )
+		{
+			number_of_quotes++;
+		}
+	}
+	/* Reserve the space of the doubled and enclosing quotation marks
+	 */
+	source_offset = output_writer->buffer_offset;
+
+	for( destination_offset = 0;
+	     destination_offset < ( number_of_quotes + 2 );
+	     destination_offset++ )
+	{
+		if( output_writer_write_data(
+		     output_writer,
+		     (uint8_t *) "\"",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write quotation mark.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Move the value backwards so that it can be shifted in place
+	 */
+	destination_offset = output_writer->buffer_offset - 1;
+
+	while( source_offset > value_offset )
+	{
+		source_offset--;
+		destination_offset--;
+
+		output_writer->buffer[ destination_offset ] = output_writer->buffer[ source_offset ];
+
+		if( output_writer->buffer[ source_offset ] == (uint8_t) '"' )
+		{
+			destination_offset--;
+
+			output_writer->buffer[ destination_offset ] = (uint8_t) '"';
+		}
+	}
+	output_writer->buffer[ value_offset ] = (uint8_t) '"';
+
+	return( 1 );
+}
+
+/* Replaces the separator and control characters written since the value offset by spaces
+ * This keeps a value on a single line within its column of a timeline format
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_replace_separators(
+     output_writer_t *output_writer,
+     size_t value_offset,
+     uint8_t separator,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_replace_separators";
+	size_t buffer_offset  = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_offset > output_writer->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_offset = value_offset;
+	     buffer_offset < output_writer->buffer_offset;
+	     buffer_offset++ )
+	{
+		if( ( output_writer->buffer[ buffer_offset ] < 0x20 )
+		 || ( output_writer->buffer[ buffer_offset ] == 0x7f )
+		 || ( output_writer->buffer[ buffer_offset ] == separator ) )
+		{
+			output_writer->buffer[ buffer_offset ] = (uint8_t) ' ';
+		}
+	}
+	return( 1 );
+}
+
+
+/* Writes a value as a Protocol Buffers base 128 varint
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_protobuf_varint(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t varint_data[ 10 ];
+
+	static char *function    = "output_writer_write_protobuf_varint";
+	size_t varint_data_index = 0;
+
+	while( value_64bit >= 0x80 )
+	{
+		varint_data[ varint_data_index++ ] = (uint8_t) ( value_64bit & 0x7f ) | 0x80;
+
+		value_64bit >>= 7;
+	}
+	varint_data[ varint_data_index++ ] = (uint8_t) value_64bit;
+
+	if( output_writer_write_data(
+	     output_writer,
+	     varint_data,
+	     varint_data_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write varint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the key of a Protocol Buffers field, which consists of the field number and wire type
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_protobuf_key(
+     output_writer_t *output_writer,
+     uint32_t field_number,
+     uint8_t wire_type,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_protobuf_key";
+
+	if( ( field_number == 0 )
+	 || ( field_number > 0x1fffffffUL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid field number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_protobuf_varint(
+	     output_writer,
+	     ( (uint64_t) field_number << 3 ) | ( wire_type & 0x07 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a Protocol Buffers fixed64 field
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_protobuf_fixed64(
+     output_writer_t *output_writer,
+     uint32_t field_number,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 8 ];
+
+	static char *function = "output_writer_write_protobuf_fixed64";
+
+	if( output_writer_write_protobuf_key(
+	     output_writer,
+	     field_number,
+	     OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_FIXED64,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 value_data,
+	 value_64bit );
+
+	if( output_writer_write_data(
+	     output_writer,
+	     value_data,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a Protocol Buffers length delimited field, such as a string or bytes
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_protobuf_bytes(
+     output_writer_t *output_writer,
+     uint32_t field_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_protobuf_bytes";
+
+	if( output_writer_write_protobuf_key(
+	     output_writer,
+	     field_number,
+	     OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_LENGTH_DELIMITED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_protobuf_varint(
+	     output_writer,
+	     (uint64_t) data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write length.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( output_writer_write_data(
+		     output_writer,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prefixes the data written since the message offset with its size as a varint
+ * This delimits an embedded message or a message of a length delimited stream
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_delimit_protobuf_message(
+     output_writer_t *output_writer,
+     size_t message_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "output_writer_delimit_protobuf_message";
+	size_t buffer_index     = 0;
+	size_t message_size     = 0;
+	size_t varint_data_size = 0;
+	uint64_t value_64bit    = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_offset > output_writer->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	message_size = output_writer->buffer_offset - message_offset;
+
+	/* Appending the size reserves the space of the varint
+	 */
+	if( output_writer_write_protobuf_varint(
+	     output_writer,
+	     (uint64_t) message_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message size.",
+		 function );
+
+		return( -1 );
+	}
+	varint_data_size = output_writer->buffer_offset - message_offset - message_size;
+
+	/* The message is moved backwards since the source and destination overlap
+	 */
+	for( buffer_index = message_offset + message_size;
+	     buffer_index > message_offset;
+	     buffer_index-- )
+	{
+		output_writer->buffer[ buffer_index + varint_data_size - 1 ] = output_writer->buffer[ buffer_index - 1 ];
+	}
+	value_64bit = (uint64_t) message_size;
+
+	for( buffer_index = message_offset;
+	     buffer_index < ( message_offset + varint_data_size - 1 );
+	     buffer_index++ )
+	{
+		output_writer->buffer[ buffer_index ] = (uint8_t) ( value_64bit & 0x7f ) | 0x80;
+
+		value_64bit >>= 7;
+	}
+	output_writer->buffer[ buffer_index ] = (uint8_t) value_64bit;
+
+	return( 1 );
+}
@@ -0,0 +1,296 @@
+/*
+ * Buffered output writer
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_WRITER_H )
+#define _OUTPUT_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <time.h>
+
+#include "compressed_output_stream.h"
+#include "evtxtools_libcerror.h"
+#include "http_bulk_sink.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial size of the output buffer
+ * The buffered data is written to the output stream when it exceeds this size
+ * at the end of a record
+ */
+#define OUTPUT_WRITER_BUFFER_SIZE		65536
+
+/* The syslog priority of the messages, which is the user-level facility (1)
+ * with the informational severity (6)
+ */
+#define OUTPUT_WRITER_SYSLOG_PRIORITY		14
+
+/* The syslog application name of the messages
+ */
+#define OUTPUT_WRITER_SYSLOG_APPLICATION_NAME	"evtxtools"
+
+enum OUTPUT_WRITER_FRAMINGS
+{
+	OUTPUT_WRITER_FRAMING_NONE		= 0,
+	OUTPUT_WRITER_FRAMING_HTTP_BULK		= (int) 'h',
+	OUTPUT_WRITER_FRAMING_LENGTH_PREFIXED	= (int) 'l',
+	OUTPUT_WRITER_FRAMING_SYSLOG		= (int) 's'
+};
+
+/* The Protocol Buffers wire types
+ */
+enum OUTPUT_WRITER_PROTOBUF_WIRE_TYPES
+{
+	OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_VARINT			= 0,
+	OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_FIXED64		= 1,
+	OUTPUT_WRITER_PROTOBUF_WIRE_TYPE_LENGTH_DELIMITED	= 2
+};
+
+typedef struct output_writer output_writer_t;
+
+struct output_writer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* Value to indicate the output stream was opened by the writer
+	 */
+	int stream_is_open;
+
+	/* The output buffer
+	 */
+	uint8_t *buffer;
+
+	/* The output buffer size
+	 */
+	size_t buffer_size;
+
+	/* The output buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The size of the buffered data at which it is written to the output
+	 */
+	size_t flush_size;
+
+	/* The compression method of the output file
+	 */
+	int compression_method;
+
+	/* The compression level of the output file
+	 */
+	int compression_level;
+
+	/* The number of threads used to compress the output file
+	 */
+	int number_of_compression_threads;
+
+	/* The compressed output stream
+	 * Compresses the buffered data before it is written to the output file
+	 */
+	compressed_output_stream_t *compressed_output_stream;
+
+	/* The framing of the data written to a network output
+	 */
+	int framing;
+
+	/* The HTTP bulk sink
+	 * Sends the buffered data as bulk requests instead of writing it to the output stream
+	 */
+	http_bulk_sink_t *http_bulk_sink;
+
+	/* The offset of the start of the current record in the output buffer
+	 */
+	size_t record_offset;
+
+	/* The number of bytes written to the output file
+	 */
+	uint64_t output_offset;
+
+	/* The flush interval in seconds, 0 represents no interval
+	 */
+	int flush_interval;
+
+	/* The time of the last flush
+	 */
+	time_t last_flush_time;
+
+	/* The hostname used in the syslog messages
+	 */
+	char syslog_hostname[ 256 ];
+};
+
+int output_writer_initialize(
+     output_writer_t **output_writer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int output_writer_free(
+     output_writer_t **output_writer,
+     libcerror_error_t **error );
+
+int output_writer_set_compression(
+     output_writer_t *output_writer,
+     int compression_method,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int output_writer_set_flush_interval(
+     output_writer_t *output_writer,
+     int flush_interval,
+     libcerror_error_t **error );
+
+int output_writer_open(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int output_writer_open_resume(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     uint64_t output_offset,
+     libcerror_error_t **error );
+
+int output_writer_open_append(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int output_writer_open_stream(
+     output_writer_t *output_writer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int output_writer_close(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_frame_syslog_record(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_flush(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_flush_stream(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_flush_when_full(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_resize_buffer(
+     output_writer_t *output_writer,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_writer_write_data(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_writer_write_ascii_string(
+     output_writer_t *output_writer,
+     const char *string,
+     libcerror_error_t **error );
+
+int output_writer_write_system_string(
+     output_writer_t *output_writer,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int output_writer_printf(
+     output_writer_t *output_writer,
+     char *format,
+     ... );
+
+int output_writer_write_json_string(
+     output_writer_t *output_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int output_writer_write_json_member_name(
+     output_writer_t *output_writer,
+     const char *name,
+     libcerror_error_t **error );
+
+int output_writer_write_unsigned_integer(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int output_writer_quote_csv_value(
+     output_writer_t *output_writer,
+     size_t value_offset,
+     libcerror_error_t **error );
+
+int output_writer_replace_separators(
+     output_writer_t *output_writer,
+     size_t value_offset,
+     uint8_t separator,
+     libcerror_error_t **error );
+
+int output_writer_write_protobuf_varint(
+     output_writer_t *output_writer,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int output_writer_write_protobuf_key(
+     output_writer_t *output_writer,
+     uint32_t field_number,
+     uint8_t wire_type,
+     libcerror_error_t **error );
+
+int output_writer_write_protobuf_fixed64(
+     output_writer_t *output_writer,
+     uint32_t field_number,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int output_writer_write_protobuf_bytes(
+     output_writer_t *output_writer,
+     uint32_t field_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_writer_delimit_protobuf_message(
+     output_writer_t *output_writer,
+     size_t message_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_WRITER_H ) */
+
@@ -0,0 +1,1473 @@
+/*
+ * Time partitioned output writer
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( WINAPI )
+#include <direct.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libcpath.h"
+#include "filetime_formatter.h"
+#include "output_writer.h"
+#include "partition_writer.h"
+
+/* Creates a partition writer
+ * Make sure the value partition_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_initialize(
+     partition_writer_t **partition_writer,
+     const system_character_t *directory_name,
+     int granularity,
+     libcerror_error_t **error )
+{
+	static char *function        = "partition_writer_initialize";
+	size_t directory_name_length = 0;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( granularity != PARTITION_WRITER_GRANULARITY_DAY )
+	 && ( granularity != PARTITION_WRITER_GRANULARITY_HOUR ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported granularity.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = system_string_length(
+	                         directory_name );
+
+	/* The partition directories are joined to the directory name
+	 * so trailing path separators are removed
+	 */
+	while( ( directory_name_length > 1 )
+	    && ( directory_name[ directory_name_length - 1 ] == (system_character_t) LIBCPATH_SEPARATOR ) )
+	{
+		directory_name_length--;
+	}
+	if( directory_name_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	*partition_writer = memory_allocate_structure(
+	                     partition_writer_t );
+
+	if( *partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *partition_writer,
+	     0,
+	     sizeof( partition_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition writer.",
+		 function );
+
+		memory_free(
+		 *partition_writer );
+
+		*partition_writer = NULL;
+
+		return( -1 );
+	}
+	( *partition_writer )->directory_name = system_string_allocate(
+	                                         directory_name_length + 1 );
+
+	if( ( *partition_writer )->directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *partition_writer )->directory_name,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	( *partition_writer )->directory_name[ directory_name_length ] = 0;
+
+	if( filetime_formatter_initialize(
+	     &( ( *partition_writer )->filetime_formatter ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create FILETIME formatter.",
+		 function );
+
+		goto on_error;
+	}
+	( *partition_writer )->directory_name_length         = directory_name_length;
+	( *partition_writer )->granularity                   = granularity;
+	( *partition_writer )->number_of_compression_threads = 1;
+	( *partition_writer )->maximum_number_of_open_files  = PARTITION_WRITER_DEFAULT_MAXIMUM_NUMBER_OF_OPEN_FILES;
+
+	return( 1 );
+
+on_error:
+	if( *partition_writer != NULL )
+	{
+		if( ( *partition_writer )->directory_name != NULL )
+		{
+			memory_free(
+			 ( *partition_writer )->directory_name );
+		}
+		memory_free(
+		 *partition_writer );
+
+		*partition_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a partition writer
+ * Data that was not flushed is discarded and the open partition files are closed
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_free(
+     partition_writer_t **partition_writer,
+     libcerror_error_t **error )
+{
+	partition_writer_partition_t *partition = NULL;
+	static char *function                   = "partition_writer_free";
+	int partition_index                     = 0;
+	int result                              = 1;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_writer != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < ( *partition_writer )->number_of_partitions;
+		     partition_index++ )
+		{
+			partition = ( *partition_writer )->partitions[ partition_index ];
+
+			if( partition->output_writer != NULL )
+			{
+				if( output_writer_free(
+				     &( partition->output_writer ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free output writer of partition: %d.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( partition->filename != NULL )
+			{
+				memory_free(
+				 partition->filename );
+			}
+			memory_free(
+			 partition );
+		}
+		if( ( *partition_writer )->partitions != NULL )
+		{
+			memory_free(
+			 ( *partition_writer )->partitions );
+		}
+		if( filetime_formatter_free(
+		     &( ( *partition_writer )->filetime_formatter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free FILETIME formatter.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *partition_writer )->directory_name );
+
+		memory_free(
+		 *partition_writer );
+
+		*partition_writer = NULL;
+	}
+	return( result );
+}
+
+/* Sets the extension of the partition files
+ * The compression extension is optional and follows the extension
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_set_extension(
+     partition_writer_t *partition_writer,
+     const system_character_t *extension,
+     const system_character_t *compression_extension,
+     libcerror_error_t **error )
+{
+	static char *function               = "partition_writer_set_extension";
+	size_t compression_extension_length = 0;
+	size_t extension_length             = 0;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension.",
+		 function );
+
+		return( -1 );
+	}
+	extension_length = system_string_length(
+	                    extension );
+
+	if( compression_extension != NULL )
+	{
+		compression_extension_length = system_string_length(
+		                                compression_extension );
+	}
+	if( ( extension_length + compression_extension_length ) >= 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+		 "%s: invalid extension value too large.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     partition_writer->extension,
+	     extension,
+	     extension_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy extension.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_extension != NULL )
+	{
+		if( system_string_copy(
+		     &( partition_writer->extension[ extension_length ] ),
+		     compression_extension,
+		     compression_extension_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy compression extension.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	partition_writer->extension[ extension_length + compression_extension_length ] = 0;
+
+	return( 1 );
+}
+
+/* Sets the compression of the partition files
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_set_compression(
+     partition_writer_t *partition_writer,
+     int compression_method,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "partition_writer_set_compression";
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	partition_writer->compression_method            = compression_method;
+	partition_writer->compression_level             = compression_level;
+	partition_writer->number_of_compression_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the flush interval of the partition files
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_set_flush_interval(
+     partition_writer_t *partition_writer,
+     int flush_interval,
+     libcerror_error_t **error )
+{
+	static char *function = "partition_writer_set_flush_interval";
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( flush_interval < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid flush interval value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	partition_writer->flush_interval = flush_interval;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of open partition files
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_set_maximum_number_of_open_files(
+     partition_writer_t *partition_writer,
+     int maximum_number_of_open_files,
+     libcerror_error_t **error )
+{
+	static char *function = "partition_writer_set_maximum_number_of_open_files";
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_files <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of open files value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	partition_writer->maximum_number_of_open_files = maximum_number_of_open_files;
+
+	return( 1 );
+}
+
+/* Determines the bucket of a FILETIME and the range of FILETIMEs in the bucket
+ * The range is used to test if subsequent records belong to the same bucket
+ * without determining their bucket
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_get_bucket_time_range(
+     partition_writer_t *partition_writer,
+     uint64_t filetime,
+     uint64_t *bucket,
+     uint64_t *first_filetime,
+     uint64_t *last_filetime,
+     libcerror_error_t **error )
+{
+	static char *function         = "partition_writer_get_bucket_time_range";
+	uint64_t intervals_per_bucket = 0;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_writer->granularity == PARTITION_WRITER_GRANULARITY_HOUR )
+	{
+		intervals_per_bucket = PARTITION_WRITER_INTERVALS_PER_HOUR;
+	}
+	else
+	{
+		intervals_per_bucket = PARTITION_WRITER_INTERVALS_PER_DAY;
+	}
+	*bucket         = filetime / intervals_per_bucket;
+	*first_filetime = *bucket * intervals_per_bucket;
+	*last_filetime  = *first_filetime + ( intervals_per_bucket - 1 );
+
+	return( 1 );
+}
+
+/* Creates a directory, a directory that already exists is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_make_directory(
+     const system_character_t *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function = "partition_writer_make_directory";
+	int result            = 0;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = _wmkdir(
+	          directory_name );
+#elif defined( WINAPI )
+	result = _mkdir(
+	          directory_name );
+#else
+	result = mkdir(
+	          directory_name,
+	          0755 );
+#endif
+	if( ( result != 0 )
+	 && ( errno != EEXIST ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates the directories and the filename of the partition file of a partition
+ * The partition file is named part-N where N is the first number for which
+ * no file exists, so that an earlier export into the same directory is kept
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_create_filename(
+     partition_writer_t *partition_writer,
+     partition_writer_partition_t *partition,
+     libcerror_error_t **error )
+{
+	system_character_t partition_name[ 32 ];
+	system_character_t part_name[ 48 ];
+
+	system_character_t *directory_name = NULL;
+	system_character_t *filename       = NULL;
+	FILE *stream                       = NULL;
+	static char *function              = "partition_writer_create_filename";
+	size_t directory_name_size         = 0;
+	size_t extension_length            = 0;
+	size_t filename_size               = 0;
+	uint64_t number_of_days            = 0;
+	int hour                           = 0;
+	int part_number                    = 0;
+	int print_count                    = 0;
+	int result                         = 0;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition->filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition - filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	extension_length = system_string_length(
+	                    partition_writer->extension );
+
+	if( partition_writer->granularity == PARTITION_WRITER_GRANULARITY_HOUR )
+	{
+		number_of_days = partition->bucket / 24;
+		hour           = (int) ( partition->bucket % 24 );
+	}
+	else
+	{
+		number_of_days = partition->bucket;
+	}
+	if( filetime_formatter_set_date(
+	     partition_writer->filetime_formatter,
+	     number_of_days,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date of partition.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = system_string_sprintf(
+	               partition_name,
+	               32,
+	               _SYSTEM_STRING( "dt=%04d-%02d-%02d" ),
+	               (int) partition_writer->filetime_formatter->year,
+	               (int) partition_writer->filetime_formatter->month,
+	               (int) partition_writer->filetime_formatter->day_of_month );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set day partition name.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_join_wide(
+		  &directory_name,
+		  &directory_name_size,
+		  partition_writer->directory_name,
+		  partition_writer->directory_name_length,
+		  partition_name,
+		  (size_t) print_count,
+		  error );
+#else
+	result = libcpath_path_join(
+		  &directory_name,
+		  &directory_name_size,
+		  partition_writer->directory_name,
+		  partition_writer->directory_name_length,
+		  partition_name,
+		  (size_t) print_count,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create day partition directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( partition_writer_make_directory(
+	     directory_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create day partition directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( partition_writer->granularity == PARTITION_WRITER_GRANULARITY_HOUR )
+	{
+		print_count = system_string_sprintf(
+		               partition_name,
+		               32,
+		               _SYSTEM_STRING( "hr=%02d" ),
+		               hour );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 32 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set hour partition name.",
+			 function );
+
+			goto on_error;
+		}
+		filename = directory_name;
+
+		directory_name = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+			  &directory_name,
+			  &directory_name_size,
+			  filename,
+			  system_string_length(
+			   filename ),
+			  partition_name,
+			  (size_t) print_count,
+			  error );
+#else
+		result = libcpath_path_join(
+			  &directory_name,
+			  &directory_name_size,
+			  filename,
+			  system_string_length(
+			   filename ),
+			  partition_name,
+			  (size_t) print_count,
+			  error );
+#endif
+		memory_free(
+		 filename );
+
+		filename = NULL;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hour partition directory name.",
+			 function );
+
+			goto on_error;
+		}
+		if( partition_writer_make_directory(
+		     directory_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to create hour partition directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( part_number = 0;
+	     part_number < PARTITION_WRITER_MAXIMUM_NUMBER_OF_PARTS;
+	     part_number++ )
+	{
+		print_count = system_string_sprintf(
+		               part_name,
+		               32,
+		               _SYSTEM_STRING( "part-%d" ),
+		               part_number );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 32 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set part name.",
+			 function );
+
+			goto on_error;
+		}
+		/* The extension consists of at most 15 characters
+		 */
+		if( system_string_copy(
+		     &( part_name[ print_count ] ),
+		     partition_writer->extension,
+		     extension_length + 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy extension to part name.",
+			 function );
+
+			goto on_error;
+		}
+		print_count += (int) extension_length;
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_size - 1,
+			  part_name,
+			  (size_t) print_count,
+			  error );
+#else
+		result = libcpath_path_join(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_size - 1,
+			  part_name,
+			  (size_t) print_count,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition filename.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		stream = file_stream_open_wide(
+		          filename,
+		          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+		stream = file_stream_open(
+		          filename,
+		          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+		if( stream == NULL )
+		{
+			if( errno == ENOENT )
+			{
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if partition file exists.",
+			 function );
+
+			goto on_error;
+		}
+		file_stream_close(
+		 stream );
+
+		memory_free(
+		 filename );
+
+		filename = NULL;
+	}
+	if( part_number >= PARTITION_WRITER_MAXIMUM_NUMBER_OF_PARTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of parts value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 directory_name );
+
+	partition->filename = filename;
+
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( directory_name != NULL )
+	{
+		memory_free(
+		 directory_name );
+	}
+	return( -1 );
+}
+
+/* Closes the partition file that was least recently used
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_close_least_recently_used(
+     partition_writer_t *partition_writer,
+     libcerror_error_t **error )
+{
+	partition_writer_partition_t *least_recently_used_partition = NULL;
+	partition_writer_partition_t *partition                     = NULL;
+	static char *function                                       = "partition_writer_close_least_recently_used";
+	int partition_index                                         = 0;
+	int result                                                  = 1;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	/* The maximum number of open files is small so a linear search suffices
+	 */
+	for( partition_index = 0;
+	     partition_index < partition_writer->number_of_partitions;
+	     partition_index++ )
+	{
+		partition = partition_writer->partitions[ partition_index ];
+
+		if( partition->output_writer == NULL )
+		{
+			continue;
+		}
+		if( ( least_recently_used_partition == NULL )
+		 || ( partition->last_use < least_recently_used_partition->last_use ) )
+		{
+			least_recently_used_partition = partition;
+		}
+	}
+	if( least_recently_used_partition == NULL )
+	{
+		return( 1 );
+	}
+	if( output_writer_close(
+	     least_recently_used_partition->output_writer,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close partition file.",
+		 function );
+
+		result = -1;
+	}
+	if( output_writer_free(
+	     &( least_recently_used_partition->output_writer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output writer of partition.",
+		 function );
+
+		result = -1;
+	}
+	partition_writer->number_of_open_files -= 1;
+
+	return( result );
+}
+
+/* Retrieves the partition of a bucket, the partition is created if it does not exist
+ * Returns 1 if the partition was created, 0 if it already existed or -1 on error
+ */
+int partition_writer_get_partition(
+     partition_writer_t *partition_writer,
+     uint64_t bucket,
+     partition_writer_partition_t **partition,
+     libcerror_error_t **error )
+{
+	partition_writer_partition_t **partitions   = NULL;
+	partition_writer_partition_t *new_partition = NULL;
+	static char *function                       = "partition_writer_get_partition";
+	size_t partitions_size                      = 0;
+	int number_of_allocated_partitions          = 0;
+	int partition_index                         = 0;
+	int search_first_index                      = 0;
+	int search_last_index                       = 0;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	/* The partitions are sorted by bucket, which allows a binary search
+	 */
+	search_first_index = 0;
+	search_last_index  = partition_writer->number_of_partitions;
+
+	while( search_first_index < search_last_index )
+	{
+		partition_index = search_first_index + ( ( search_last_index - search_first_index ) / 2 );
+
+		if( partition_writer->partitions[ partition_index ]->bucket < bucket )
+		{
+			search_first_index = partition_index + 1;
+		}
+		else
+		{
+			search_last_index = partition_index;
+		}
+	}
+	if( ( search_first_index < partition_writer->number_of_partitions )
+	 && ( partition_writer->partitions[ search_first_index ]->bucket == bucket ) )
+	{
+		*partition = partition_writer->partitions[ search_first_index ];
+
+		return( 0 );
+	}
+	if( partition_writer->number_of_partitions >= partition_writer->number_of_allocated_partitions )
+	{
+		if( partition_writer->number_of_allocated_partitions == 0 )
+		{
+			number_of_allocated_partitions = 64;
+		}
+		else
+		{
+			number_of_allocated_partitions = partition_writer->number_of_allocated_partitions * 2;
+		}
+		if( number_of_allocated_partitions > PARTITION_WRITER_MAXIMUM_NUMBER_OF_PARTITIONS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of partitions value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		partitions_size = sizeof( partition_writer_partition_t * ) * number_of_allocated_partitions;
+
+		partitions = (partition_writer_partition_t **) memory_reallocate(
+		                                                partition_writer->partitions,
+		                                                partitions_size );
+
+		if( partitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize partitions.",
+			 function );
+
+			return( -1 );
+		}
+		partition_writer->partitions                     = partitions;
+		partition_writer->number_of_allocated_partitions = number_of_allocated_partitions;
+	}
+	new_partition = memory_allocate_structure(
+	                 partition_writer_partition_t );
+
+	if( new_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     new_partition,
+	     0,
+	     sizeof( partition_writer_partition_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition.",
+		 function );
+
+		memory_free(
+		 new_partition );
+
+		return( -1 );
+	}
+	new_partition->bucket = bucket;
+
+	if( partition_writer_create_filename(
+	     partition_writer,
+	     new_partition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filename of partition.",
+		 function );
+
+		memory_free(
+		 new_partition );
+
+		return( -1 );
+	}
+	/* The records are mostly in time order so a new partition is
+	 * typically appended and few partitions are moved
+	 */
+	for( partition_index = partition_writer->number_of_partitions;
+	     partition_index > search_first_index;
+	     partition_index-- )
+	{
+		partition_writer->partitions[ partition_index ] = partition_writer->partitions[ partition_index - 1 ];
+	}
+	partition_writer->partitions[ search_first_index ] = new_partition;
+
+	partition_writer->number_of_partitions += 1;
+
+	*partition = new_partition;
+
+	return( 1 );
+}
+
+/* Retrieves the output writer of the partition a FILETIME belongs to
+ * The partition file is opened when needed, which can close the least
+ * recently used partition file
+ * Returns 1 if the partition file was created, 0 if it already existed or -1 on error
+ */
+int partition_writer_get_output_writer(
+     partition_writer_t *partition_writer,
+     uint64_t filetime,
+     output_writer_t **output_writer,
+     libcerror_error_t **error )
+{
+	partition_writer_partition_t *partition = NULL;
+	static char *function                   = "partition_writer_get_output_writer";
+	uint64_t bucket                         = 0;
+	uint64_t first_filetime                 = 0;
+	uint64_t last_filetime                  = 0;
+	int result                              = 0;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_writer_get_bucket_time_range(
+	     partition_writer,
+	     filetime,
+	     &bucket,
+	     &first_filetime,
+	     &last_filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bucket.",
+		 function );
+
+		return( -1 );
+	}
+	result = partition_writer_get_partition(
+	          partition_writer,
+	          bucket,
+	          &partition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition->output_writer == NULL )
+	{
+		if( partition_writer->number_of_open_files >= partition_writer->maximum_number_of_open_files )
+		{
+			if( partition_writer_close_least_recently_used(
+			     partition_writer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close least recently used partition file.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( output_writer_initialize(
+		     &( partition->output_writer ),
+		     stdout,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create output writer of partition.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_writer_set_compression(
+		     partition->output_writer,
+		     partition_writer->compression_method,
+		     partition_writer->compression_level,
+		     partition_writer->number_of_compression_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set compression of output writer of partition.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_writer_set_flush_interval(
+		     partition->output_writer,
+		     partition_writer->flush_interval,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set flush interval of output writer of partition.",
+			 function );
+
+			goto on_error;
+		}
+		/* A partition file that was closed before is appended to
+		 */
+		if( output_writer_open_append(
+		     partition->output_writer,
+		     partition->filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open partition file.",
+			 function );
+
+			goto on_error;
+		}
+		partition_writer->number_of_open_files += 1;
+	}
+	partition_writer->use_counter += 1;
+
+	partition->last_use = partition_writer->use_counter;
+
+	*output_writer = partition->output_writer;
+
+	return( result );
+
+on_error:
+	if( partition->output_writer != NULL )
+	{
+		output_writer_free(
+		 &( partition->output_writer ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Flushes the buffered data and closes the open partition files
+ * Returns 1 if successful or -1 on error
+ */
+int partition_writer_close(
+     partition_writer_t *partition_writer,
+     libcerror_error_t **error )
+{
+	partition_writer_partition_t *partition = NULL;
+	static char *function                   = "partition_writer_close";
+	int partition_index                     = 0;
+	int result                              = 1;
+
+	if( partition_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition writer.",
+		 function );
+
+		return( -1 );
+	}
+	for( partition_index = 0;
+	     partition_index < partition_writer->number_of_partitions;
+	     partition_index++ )
+	{
+		partition = partition_writer->partitions[ partition_index ];
+
+		if( partition->output_writer == NULL )
+		{
+			continue;
+		}
+		if( output_writer_close(
+		     partition->output_writer,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close partition file: %d.",
+			 function,
+			 partition_index );
+
+			result = -1;
+		}
+		if( output_writer_free(
+		     &( partition->output_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output writer of partition: %d.",
+			 function,
+			 partition_index );
+
+			result = -1;
+		}
+	}
+	partition_writer->number_of_open_files = 0;
+
+	return( result );
+}
+
@@ -0,0 +1,225 @@
+/*
+ * Time partitioned output writer
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PARTITION_WRITER_H )
+#define _PARTITION_WRITER_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "filetime_formatter.h"
+#include "output_writer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum number of partition files that are open at the same time
+ * The least recently used partition file is closed when the maximum is reached
+ */
+#define PARTITION_WRITER_DEFAULT_MAXIMUM_NUMBER_OF_OPEN_FILES	32
+
+/* The maximum number of part files of a partition, which are numbered
+ * so that an export does not overwrite the files of a previous export
+ */
+#define PARTITION_WRITER_MAXIMUM_NUMBER_OF_PARTS		1000
+
+/* The maximum number of partitions, which covers more than a century of hours
+ */
+#define PARTITION_WRITER_MAXIMUM_NUMBER_OF_PARTITIONS		( 1024 * 1024 )
+
+/* The number of FILETIME intervals of 100 nano seconds in an hour and a day
+ */
+#define PARTITION_WRITER_INTERVALS_PER_HOUR			(uint64_t) 36000000000UL
+#define PARTITION_WRITER_INTERVALS_PER_DAY			(uint64_t) 864000000000UL
+
+enum PARTITION_WRITER_GRANULARITIES
+{
+	PARTITION_WRITER_GRANULARITY_NONE	= 0,
+	PARTITION_WRITER_GRANULARITY_DAY	= (int) 'd',
+	PARTITION_WRITER_GRANULARITY_HOUR	= (int) 'h'
+};
+
+typedef struct partition_writer_partition partition_writer_partition_t;
+
+struct partition_writer_partition
+{
+	/* The bucket, which is the number of hours or days since January 1, 1601
+	 */
+	uint64_t bucket;
+
+	/* The filename of the partition file
+	 */
+	system_character_t *filename;
+
+	/* The output writer
+	 * Contains NULL if the partition file is closed
+	 */
+	output_writer_t *output_writer;
+
+	/* The value of the use counter when the partition was last used
+	 */
+	uint64_t last_use;
+};
+
+typedef struct partition_writer partition_writer_t;
+
+struct partition_writer
+{
+	/* The output directory name
+	 */
+	system_character_t *directory_name;
+
+	/* The output directory name length
+	 */
+	size_t directory_name_length;
+
+	/* The granularity
+	 */
+	int granularity;
+
+	/* The extension of the partition files, such as .ndjson.gz
+	 */
+	system_character_t extension[ 16 ];
+
+	/* The compression method of the partition files
+	 */
+	int compression_method;
+
+	/* The compression level of the partition files
+	 */
+	int compression_level;
+
+	/* The number of threads used to compress a partition file
+	 */
+	int number_of_compression_threads;
+
+	/* The flush interval in seconds, 0 represents no interval
+	 */
+	int flush_interval;
+
+	/* The partitions sorted by bucket
+	 */
+	partition_writer_partition_t **partitions;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The number of allocated partitions
+	 */
+	int number_of_allocated_partitions;
+
+	/* The number of open partition files
+	 */
+	int number_of_open_files;
+
+	/* The maximum number of open partition files
+	 */
+	int maximum_number_of_open_files;
+
+	/* The use counter, which orders the uses of the partitions
+	 */
+	uint64_t use_counter;
+
+	/* The FILETIME formatter that determines the date of a bucket
+	 */
+	filetime_formatter_t *filetime_formatter;
+};
+
+int partition_writer_initialize(
+     partition_writer_t **partition_writer,
+     const system_character_t *directory_name,
+     int granularity,
+     libcerror_error_t **error );
+
+int partition_writer_free(
+     partition_writer_t **partition_writer,
+     libcerror_error_t **error );
+
+int partition_writer_set_extension(
+     partition_writer_t *partition_writer,
+     const system_character_t *extension,
+     const system_character_t *compression_extension,
+     libcerror_error_t **error );
+
+int partition_writer_set_compression(
+     partition_writer_t *partition_writer,
+     int compression_method,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int partition_writer_set_flush_interval(
+     partition_writer_t *partition_writer,
+     int flush_interval,
+     libcerror_error_t **error );
+
+int partition_writer_set_maximum_number_of_open_files(
+     partition_writer_t *partition_writer,
+     int maximum_number_of_open_files,
+     libcerror_error_t **error );
+
+int partition_writer_get_bucket_time_range(
+     partition_writer_t *partition_writer,
+     uint64_t filetime,
+     uint64_t *bucket,
+     uint64_t *first_filetime,
+     uint64_t *last_filetime,
+     libcerror_error_t **error );
+
+int partition_writer_make_directory(
+     const system_character_t *directory_name,
+     libcerror_error_t **error );
+
+int partition_writer_create_filename(
+     partition_writer_t *partition_writer,
+     partition_writer_partition_t *partition,
+     libcerror_error_t **error );
+
+int partition_writer_close_least_recently_used(
+     partition_writer_t *partition_writer,
+     libcerror_error_t **error );
+
+int partition_writer_get_partition(
+     partition_writer_t *partition_writer,
+     uint64_t bucket,
+     partition_writer_partition_t **partition,
+     libcerror_error_t **error );
+
+int partition_writer_get_output_writer(
+     partition_writer_t *partition_writer,
+     uint64_t filetime,
+     output_writer_t **output_writer,
+     libcerror_error_t **error );
+
+int partition_writer_close(
+     partition_writer_t *partition_writer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PARTITION_WRITER_H ) */
+
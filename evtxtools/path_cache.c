@@ -0,0 +1,989 @@
+/*
+ * Path cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcdirectory.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_string_no_case.h"
+#include "path_cache.h"
+
+/* Creates a path cache
+ * Make sure the value path_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int path_cache_initialize(
+     path_cache_t **path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "path_cache_initialize";
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*path_cache = memory_allocate_structure(
+	               path_cache_t );
+
+	if( *path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_cache,
+	     0,
+	     sizeof( path_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path cache.",
+		 function );
+
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+
+		return( -1 );
+	}
+	if( path_cache_resize_buckets(
+	     *path_cache,
+	     PATH_CACHE_INITIAL_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *path_cache != NULL )
+	{
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path cache
+ * Returns 1 if successful or -1 on error
+ */
+int path_cache_free(
+     path_cache_t **path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "path_cache_free";
+	int result            = 1;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		if( path_cache_empty(
+		     *path_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty path cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *path_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->buckets );
+		}
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a path cache
+ * Returns 1 if successful or -1 on error
+ */
+int path_cache_empty(
+     path_cache_t *path_cache,
+     libcerror_error_t **error )
+{
+	path_cache_entry_t *cache_entry = NULL;
+	static char *function           = "path_cache_empty";
+	int bucket_index                = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < path_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( path_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = path_cache->buckets[ bucket_index ];
+
+			path_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			/* The directory path is owned by the entry that marks the directory as read
+			 */
+			if( cache_entry->name != NULL )
+			{
+				memory_free(
+				 cache_entry->name );
+			}
+			else if( cache_entry->directory_path != NULL )
+			{
+				memory_free(
+				 cache_entry->directory_path );
+			}
+			memory_free(
+			 cache_entry );
+		}
+	}
+	path_cache->number_of_entries = 0;
+
+	return( 1 );
+}
+
+/* Case folds a character
+ * The character is folded in the same way as the names are compared
+ * Returns the case folded character
+ */
+system_character_t path_cache_fold_character(
+                    system_character_t character )
+{
+	return( evtxtools_string_no_case_fold_character(
+	         character,
+	         0 ) );
+}
+
+/* Calculates the hash of a directory path and case folded name
+ * Returns the 32-bit hash
+ */
+uint32_t path_cache_get_hash(
+          const system_character_t *directory_path,
+          size_t directory_path_length,
+          const system_character_t *name,
+          size_t name_length )
+{
+	size_t string_index = 0;
+	uint32_t hash       = 0x811c9dc5UL;
+
+	/* The 32-bit FNV-1a hash of the directory path, a separator and the case folded name
+	 */
+	for( string_index = 0;
+	     string_index < directory_path_length;
+	     string_index++ )
+	{
+		hash ^= (uint32_t) directory_path[ string_index ];
+		hash *= 0x01000193UL;
+	}
+	hash *= 0x01000193UL;
+
+	for( string_index = 0;
+	     string_index < name_length;
+	     string_index++ )
+	{
+		hash ^= (uint32_t) path_cache_fold_character(
+		                    name[ string_index ] );
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Resizes the hash table buckets
+ * Returns 1 if successful or -1 on error
+ */
+int path_cache_resize_buckets(
+     path_cache_t *path_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	path_cache_entry_t **buckets    = NULL;
+	path_cache_entry_t *cache_entry = NULL;
+	static char *function           = "path_cache_resize_buckets";
+	int bucket_index                = 0;
+	int new_bucket_index            = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) SSIZE_MAX / sizeof( path_cache_entry_t * ) ) )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (path_cache_entry_t **) memory_allocate(
+	                                   sizeof( path_cache_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( new_bucket_index = 0;
+	     new_bucket_index < number_of_buckets;
+	     new_bucket_index++ )
+	{
+		buckets[ new_bucket_index ] = NULL;
+	}
+	for( bucket_index = 0;
+	     bucket_index < path_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( path_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = path_cache->buckets[ bucket_index ];
+
+			path_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			new_bucket_index = (int) ( cache_entry->hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+			cache_entry->next_bucket_entry = buckets[ new_bucket_index ];
+			buckets[ new_bucket_index ]    = cache_entry;
+		}
+	}
+	if( path_cache->buckets != NULL )
+	{
+		memory_free(
+		 path_cache->buckets );
+	}
+	path_cache->buckets           = buckets;
+	path_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a directory entry by name ignoring case
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int path_cache_get_entry(
+     path_cache_t *path_cache,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     path_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	path_cache_entry_t *cache_entry = NULL;
+	static char *function           = "path_cache_get_entry";
+	uint32_t hash                   = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = NULL;
+
+	hash = path_cache_get_hash(
+	        directory_path,
+	        directory_path_length,
+	        name,
+	        name_length );
+
+	cache_entry = path_cache->buckets[ hash & (uint32_t) ( path_cache->number_of_buckets - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->hash == hash )
+		 && ( cache_entry->name != NULL )
+		 && ( cache_entry->type == type )
+		 && ( cache_entry->name_length == name_length )
+		 && ( cache_entry->directory_path_length == directory_path_length )
+		 && ( memory_compare(
+		       cache_entry->directory_path,
+		       directory_path,
+		       sizeof( system_character_t ) * directory_path_length ) == 0 )
+		 && ( evtxtools_string_no_case_compare(
+		       cache_entry->name,
+		       name,
+		       name_length,
+		       0 ) == 1 ) )
+		{
+			*entry = cache_entry;
+
+			return( 1 );
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Determines if the entries of a directory were read
+ * Returns 1 if the directory was read, 0 if not or -1 on error
+ */
+int path_cache_has_directory(
+     path_cache_t *path_cache,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     libcerror_error_t **error )
+{
+	path_cache_entry_t *cache_entry = NULL;
+	static char *function           = "path_cache_has_directory";
+	uint32_t hash                   = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	hash = path_cache_get_hash(
+	        directory_path,
+	        directory_path_length,
+	        NULL,
+	        0 );
+
+	cache_entry = path_cache->buckets[ hash & (uint32_t) ( path_cache->number_of_buckets - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->hash == hash )
+		 && ( cache_entry->name == NULL )
+		 && ( cache_entry->directory_path_length == directory_path_length )
+		 && ( memory_compare(
+		       cache_entry->directory_path,
+		       directory_path,
+		       sizeof( system_character_t ) * directory_path_length ) == 0 ) )
+		{
+			return( 1 );
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Appends an entry to the cache
+ * The cache takes over management of the entry on success
+ * Returns 1 if successful or -1 on error
+ */
+int path_cache_append_entry(
+     path_cache_t *path_cache,
+     path_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "path_cache_append_entry";
+	int bucket_index      = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_cache->number_of_entries >= path_cache->number_of_buckets )
+	{
+		if( path_cache_resize_buckets(
+		     path_cache,
+		     path_cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_index = (int) ( entry->hash & (uint32_t) ( path_cache->number_of_buckets - 1 ) );
+
+	entry->next_bucket_entry = path_cache->buckets[ bucket_index ];
+
+	path_cache->buckets[ bucket_index ] = entry;
+
+	path_cache->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the entries of a directory into the cache
+ * The directory is marked as read so that it is enumerated only once
+ * Returns 1 if successful or -1 on error
+ */
+int path_cache_read_directory(
+     path_cache_t *path_cache,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	path_cache_entry_t *cache_entry                  = NULL;
+	path_cache_entry_t *directory_cache_entry        = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	static char *function                            = "path_cache_read_directory";
+	size_t directory_entry_name_length               = 0;
+	uint8_t directory_entry_type                     = 0;
+	int result                                       = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entry that marks the directory as read owns the copy of the directory path
+	 * that is referenced by the entries of the directory
+	 */
+	directory_cache_entry = memory_allocate_structure(
+	                         path_cache_entry_t );
+
+	if( directory_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     directory_cache_entry,
+	     0,
+	     sizeof( path_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory cache entry.",
+		 function );
+
+		memory_free(
+		 directory_cache_entry );
+
+		return( -1 );
+	}
+	directory_cache_entry->directory_path = system_string_allocate(
+	                                         directory_path_length + 1 );
+
+	if( directory_cache_entry->directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     directory_cache_entry->directory_path,
+	     directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	directory_cache_entry->directory_path[ directory_path_length ] = 0;
+
+	directory_cache_entry->directory_path_length = directory_path_length;
+	directory_cache_entry->hash                  = path_cache_get_hash(
+	                                                directory_path,
+	                                                directory_path_length,
+	                                                NULL,
+	                                                0 );
+
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+		  directory,
+		  directory_cache_entry->directory_path,
+		  error );
+#else
+	result = libcdirectory_directory_open(
+		  directory,
+		  directory_cache_entry->directory_path,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 directory_cache_entry->directory_path );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	/* The directory is marked as read before its entries are added
+	 * if reading the entries fails the cache is emptied
+	 */
+	if( path_cache_append_entry(
+	     path_cache,
+	     directory_cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error_empty_cache;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error_empty_cache;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+			  directory_entry,
+			  (wchar_t **) &directory_entry_name,
+			  error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+			  directory_entry,
+			  (char **) &directory_entry_name,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error_empty_cache;
+		}
+		directory_entry_name_length = system_string_length(
+		                               directory_entry_name );
+
+		if( directory_entry_name_length == 0 )
+		{
+			continue;
+		}
+		cache_entry = memory_allocate_structure(
+		               path_cache_entry_t );
+
+		if( cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entry.",
+			 function );
+
+			goto on_error_empty_cache;
+		}
+		cache_entry->name = system_string_allocate(
+		                     directory_entry_name_length + 1 );
+
+		if( cache_entry->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entry name.",
+			 function );
+
+			goto on_error_empty_cache;
+		}
+		if( system_string_copy(
+		     cache_entry->name,
+		     directory_entry_name,
+		     directory_entry_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy cache entry name.",
+			 function );
+
+			goto on_error_empty_cache;
+		}
+		cache_entry->name[ directory_entry_name_length ] = 0;
+
+		cache_entry->directory_path        = directory_cache_entry->directory_path;
+		cache_entry->directory_path_length = directory_path_length;
+		cache_entry->name_length           = directory_entry_name_length;
+		cache_entry->type                  = directory_entry_type;
+		cache_entry->hash                  = path_cache_get_hash(
+		                                      directory_path,
+		                                      directory_path_length,
+		                                      directory_entry_name,
+		                                      directory_entry_name_length );
+		cache_entry->next_bucket_entry     = NULL;
+
+		if( path_cache_append_entry(
+		     path_cache,
+		     cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append cache entry.",
+			 function );
+
+			goto on_error_empty_cache;
+		}
+		cache_entry = NULL;
+	}
+	while( result == 1 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error_empty_cache;
+	}
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error_empty_cache;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error_empty_cache;
+	}
+	return( 1 );
+
+on_error_empty_cache:
+	/* The directory cache entry is managed by the cache
+	 */
+	directory_cache_entry = NULL;
+
+	path_cache_empty(
+	 path_cache,
+	 NULL );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		if( cache_entry->name != NULL )
+		{
+			memory_free(
+			 cache_entry->name );
+		}
+		memory_free(
+		 cache_entry );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( directory_cache_entry != NULL )
+	{
+		if( directory_cache_entry->directory_path != NULL )
+		{
+			memory_free(
+			 directory_cache_entry->directory_path );
+		}
+		memory_free(
+		 directory_cache_entry );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,148 @@
+/*
+ * Path cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PATH_CACHE_H )
+#define _PATH_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of hash table buckets, must be a power of 2
+ */
+#define PATH_CACHE_INITIAL_NUMBER_OF_BUCKETS	256
+
+typedef struct path_cache_entry path_cache_entry_t;
+
+struct path_cache_entry
+{
+	/* The directory path
+	 * The directory path is owned by the entry that marks the directory as read
+	 */
+	system_character_t *directory_path;
+
+	/* The directory path length
+	 */
+	size_t directory_path_length;
+
+	/* The (directory entry) name
+	 * Contains NULL if the entry marks the directory as read
+	 */
+	system_character_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The (directory entry) type
+	 */
+	uint8_t type;
+
+	/* The hash of the directory path and case folded name
+	 */
+	uint32_t hash;
+
+	/* The next entry in the same hash table bucket
+	 */
+	path_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct path_cache path_cache_t;
+
+struct path_cache
+{
+	/* The hash table buckets
+	 */
+	path_cache_entry_t **buckets;
+
+	/* The number of hash table buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int path_cache_initialize(
+     path_cache_t **path_cache,
+     libcerror_error_t **error );
+
+int path_cache_free(
+     path_cache_t **path_cache,
+     libcerror_error_t **error );
+
+int path_cache_empty(
+     path_cache_t *path_cache,
+     libcerror_error_t **error );
+
+system_character_t path_cache_fold_character(
+                    system_character_t character );
+
+uint32_t path_cache_get_hash(
+          const system_character_t *directory_path,
+          size_t directory_path_length,
+          const system_character_t *name,
+          size_t name_length );
+
+int path_cache_resize_buckets(
+     path_cache_t *path_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int path_cache_get_entry(
+     path_cache_t *path_cache,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     path_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int path_cache_has_directory(
+     path_cache_t *path_cache,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     libcerror_error_t **error );
+
+int path_cache_append_entry(
+     path_cache_t *path_cache,
+     path_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int path_cache_read_directory(
+     path_cache_t *path_cache,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PATH_CACHE_H ) */
+
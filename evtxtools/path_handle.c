@@ -26,8 +26,8 @@
 #include <types.h>
 #include <wide_string.h>
 
-#include "evtxtools_libcdirectory.h"
 #include "evtxtools_libcerror.h"
+#include "path_cache.h"
 #include "path_handle.h"
 
 /* Creates a path handle
@@ -88,6 +88,24 @@ int path_handle_initialize(
 		 "%s: unable to clear path handle.",
 		 function );
 
+		memory_free(
+		 *path_handle );
+
+		*path_handle = NULL;
+
+		return( -1 );
+	}
+	if( path_cache_initialize(
+	     &( ( *path_handle )->path_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path cache.",
+		 function );
+
 		goto on_error;
 	}
 	return( 1 );
@@ -131,6 +149,19 @@ int path_handle_free(
 			memory_free(
 			 ( *path_handle )->system_root_path );
 		}
+		if( path_cache_free(
+		     &( ( *path_handle )->path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free path cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *path_handle );
 
@@ -142,6 +173,7 @@ int path_handle_free(
 /* Retrieves the name of a directory entry by name ignoring case
  * If a corresponding entry is found entry name is update
  * This function is needed to find case insensitive directory entries on a case sensitive system
+ * The entries of a directory are read into the path cache on the first look up in the directory
  * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
  */
 int path_handle_get_directory_entry_name_by_name_no_case(
@@ -153,12 +185,9 @@ int path_handle_get_directory_entry_name_by_name_no_case(
      uint8_t entry_type,
      libcerror_error_t **error )
 {
-	libcdirectory_directory_t *directory             = NULL;
-	libcdirectory_directory_entry_t *directory_entry = NULL;
-	system_character_t *directory_entry_name         = NULL;
-	static char *function                            = "path_handle_get_directory_entry_name_by_name_no_case";
-	size_t directory_entry_name_length               = 0;
-	int result                                       = 0;
+	path_cache_entry_t *cache_entry = NULL;
+	static char *function           = "path_handle_get_directory_entry_name_by_name_no_case";
+	int result                      = 0;
 
 	if( path_handle == NULL )
 	{
@@ -171,35 +200,24 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 
 		return( -1 );
 	}
-	if( path_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( entry_name == NULL )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name_size > (size_t) SSIZE_MAX )
+	if( path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid entry name size value exceeds maximum.",
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
@@ -215,114 +233,93 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 
 		return( -1 );
 	}
-	if( libcdirectory_directory_initialize(
-	     &directory,
-	     error ) != 1 )
+	if( ( entry_name_size == 0 )
+	 || ( entry_name_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry name size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcdirectory_directory_open_wide(
-		  directory,
-		  path,
-		  error );
-#else
-	result = libcdirectory_directory_open(
-		  directory,
-		  path,
-		  error );
-#endif
-	if( result != 1 )
+	/* The path length can include the end of string character
+	 */
+	while( ( path_length > 0 )
+	    && ( path[ path_length - 1 ] == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
-		 function,
-		 path );
-
-		goto on_error;
+		path_length--;
 	}
-	if( libcdirectory_directory_entry_initialize(
-	     &directory_entry,
-	     error ) != 1 )
+	result = path_cache_get_entry(
+	          path_handle->path_cache,
+	          path,
+	          path_length,
+	          entry_name,
+	          entry_name_size - 1,
+	          entry_type,
+	          &cache_entry,
+	          error );
+
+	if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory entry.",
-		 function );
+		result = path_cache_has_directory(
+		          path_handle->path_cache,
+		          path,
+		          path_length,
+		          error );
 
-		goto on_error;
+		if( result == 0 )
+		{
+			if( path_cache_read_directory(
+			     path_handle->path_cache,
+			     path,
+			     path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory: %" PRIs_SYSTEM ".",
+				 function,
+				 path );
+
+				return( -1 );
+			}
+			result = path_cache_get_entry(
+			          path_handle->path_cache,
+			          path,
+			          path_length,
+			          entry_name,
+			          entry_name_size - 1,
+			          entry_type,
+			          &cache_entry,
+			          error );
+		}
+		else if( result == 1 )
+		{
+			/* The directory was read before and does not contain the entry
+			 */
+			result = 0;
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcdirectory_directory_has_entry_wide(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#else
-	result = libcdirectory_directory_has_entry(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#endif
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
 		 function,
 		 entry_name );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result != 0 )
 	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcdirectory_directory_entry_get_name_wide(
-			  directory_entry,
-			  (wchar_t **) &directory_entry_name,
-			  error );
-#else
-		result = libcdirectory_directory_entry_get_name(
-			  directory_entry,
-			  (char **) &directory_entry_name,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry name.",
-			 function );
-
-			goto on_error;
-		}
-		directory_entry_name_length = system_string_length(
-					       directory_entry_name );
-
-		if( ( directory_entry_name_length + 1 ) != entry_name_size )
+		if( ( cache_entry->name_length + 1 ) != entry_name_size )
 		{
 			libcerror_error_set(
 			 error,
@@ -331,12 +328,12 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 			 "%s: entry name length value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( system_string_copy(
 		     entry_name,
-		     directory_entry_name,
-		     directory_entry_name_length ) == NULL )
+		     cache_entry->name,
+		     cache_entry->name_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -345,63 +342,9 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 			 "%s: unable to set entry name.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libcdirectory_directory_entry_free(
-	     &directory_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free directory entry.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdirectory_directory_close(
-	     directory,
-	     error ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close directory.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdirectory_directory_free(
-	     &directory,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free directory.",
-		 function );
-
-		goto on_error;
-	}
 	return( result );
-
-on_error:
-	if( directory_entry != NULL )
-	{
-		libcdirectory_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
-	if( directory != NULL )
-	{
-		libcdirectory_directory_free(
-		 &directory,
-		 NULL );
-	}
-	return( -1 );
 }
 
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "evtxtools_libcerror.h"
+#include "path_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -42,6 +43,10 @@ struct path_handle
 	/* The %SystemRoot% path size
 	 */
 	size_t system_root_path_size;
+
+	/* The path cache
+	 */
+	path_cache_t *path_cache;
 };
 
 int path_handle_initialize(
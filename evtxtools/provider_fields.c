@@ -0,0 +1,441 @@
+/*
+ * Built-in event data field definitions of well-known providers
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "provider_fields.h"
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4624 (an account was successfully logged on) version 0
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4624_0[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "TargetUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "TargetUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "LogonType", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "LogonProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "AuthenticationPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "WorkstationName", PROVIDER_FIELD_TYPE_STRING },
+	{ "LogonGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "TransmittedServices", PROVIDER_FIELD_TYPE_STRING },
+	{ "LmPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "KeyLength", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "ProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpAddress", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpPort", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4624 version 1
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4624_1[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "TargetUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "TargetUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "LogonType", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "LogonProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "AuthenticationPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "WorkstationName", PROVIDER_FIELD_TYPE_STRING },
+	{ "LogonGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "TransmittedServices", PROVIDER_FIELD_TYPE_STRING },
+	{ "LmPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "KeyLength", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "ProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpAddress", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpPort", PROVIDER_FIELD_TYPE_STRING },
+	{ "ImpersonationLevel", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4624 version 2
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4624_2[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "TargetUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "TargetUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "LogonType", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "LogonProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "AuthenticationPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "WorkstationName", PROVIDER_FIELD_TYPE_STRING },
+	{ "LogonGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "TransmittedServices", PROVIDER_FIELD_TYPE_STRING },
+	{ "LmPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "KeyLength", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "ProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpAddress", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpPort", PROVIDER_FIELD_TYPE_STRING },
+	{ "ImpersonationLevel", PROVIDER_FIELD_TYPE_STRING },
+	{ "RestrictedAdminMode", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetOutboundUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetOutboundDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "VirtualAccount", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetLinkedLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "ElevatedToken", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4625 (an account failed to log on) version 0
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4625_0[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "TargetUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "TargetUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "Status", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "FailureReason", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubStatus", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "LogonType", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "LogonProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "AuthenticationPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "WorkstationName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TransmittedServices", PROVIDER_FIELD_TYPE_STRING },
+	{ "LmPackageName", PROVIDER_FIELD_TYPE_STRING },
+	{ "KeyLength", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "ProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpAddress", PROVIDER_FIELD_TYPE_STRING },
+	{ "IpPort", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4672 (special privileges assigned to new logon) version 0
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4672_0[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "PrivilegeList", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4688 (a new process has been created) version 0
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4688_0[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "NewProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "NewProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TokenElevationType", PROVIDER_FIELD_TYPE_STRING },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER } };
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4688 version 1
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4688_1[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "NewProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "NewProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TokenElevationType", PROVIDER_FIELD_TYPE_STRING },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "CommandLine", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Security-Auditing event 4688 version 2
+ */
+static const provider_field_definition_t provider_fields_security_auditing_4688_2[ ] = {
+	{ "SubjectUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "SubjectUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "SubjectLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "NewProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "NewProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TokenElevationType", PROVIDER_FIELD_TYPE_STRING },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "CommandLine", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetUserSid", PROVIDER_FIELD_TYPE_SID },
+	{ "TargetUserName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetDomainName", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetLogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "ParentProcessName", PROVIDER_FIELD_TYPE_STRING },
+	{ "MandatoryLabel", PROVIDER_FIELD_TYPE_SID } };
+
+/* The fields of Microsoft-Windows-PowerShell event 4103 (module logging) version 1
+ */
+static const provider_field_definition_t provider_fields_powershell_4103_1[ ] = {
+	{ "ContextInfo", PROVIDER_FIELD_TYPE_STRING },
+	{ "UserData", PROVIDER_FIELD_TYPE_STRING },
+	{ "Payload", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-PowerShell event 4104 (script block logging) version 1
+ */
+static const provider_field_definition_t provider_fields_powershell_4104_1[ ] = {
+	{ "MessageNumber", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "MessageTotal", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "ScriptBlockText", PROVIDER_FIELD_TYPE_STRING },
+	{ "ScriptBlockId", PROVIDER_FIELD_TYPE_GUID },
+	{ "Path", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-PowerShell events 4105 and 4106 (script block invocation) version 1
+ */
+static const provider_field_definition_t provider_fields_powershell_4105_1[ ] = {
+	{ "ScriptBlockId", PROVIDER_FIELD_TYPE_GUID },
+	{ "RunspaceId", PROVIDER_FIELD_TYPE_GUID } };
+
+/* The fields of Microsoft-Windows-Sysmon event 1 (process creation) version 5
+ */
+static const provider_field_definition_t provider_fields_sysmon_1_5[ ] = {
+	{ "RuleName", PROVIDER_FIELD_TYPE_STRING },
+	{ "UtcTime", PROVIDER_FIELD_TYPE_STRING },
+	{ "ProcessGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "Image", PROVIDER_FIELD_TYPE_STRING },
+	{ "FileVersion", PROVIDER_FIELD_TYPE_STRING },
+	{ "Description", PROVIDER_FIELD_TYPE_STRING },
+	{ "Product", PROVIDER_FIELD_TYPE_STRING },
+	{ "Company", PROVIDER_FIELD_TYPE_STRING },
+	{ "OriginalFileName", PROVIDER_FIELD_TYPE_STRING },
+	{ "CommandLine", PROVIDER_FIELD_TYPE_STRING },
+	{ "CurrentDirectory", PROVIDER_FIELD_TYPE_STRING },
+	{ "User", PROVIDER_FIELD_TYPE_STRING },
+	{ "LogonGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "LogonId", PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER },
+	{ "TerminalSessionId", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "IntegrityLevel", PROVIDER_FIELD_TYPE_STRING },
+	{ "Hashes", PROVIDER_FIELD_TYPE_STRING },
+	{ "ParentProcessGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "ParentProcessId", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "ParentImage", PROVIDER_FIELD_TYPE_STRING },
+	{ "ParentCommandLine", PROVIDER_FIELD_TYPE_STRING },
+	{ "ParentUser", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Sysmon event 3 (network connection) version 5
+ */
+static const provider_field_definition_t provider_fields_sysmon_3_5[ ] = {
+	{ "RuleName", PROVIDER_FIELD_TYPE_STRING },
+	{ "UtcTime", PROVIDER_FIELD_TYPE_STRING },
+	{ "ProcessGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "Image", PROVIDER_FIELD_TYPE_STRING },
+	{ "User", PROVIDER_FIELD_TYPE_STRING },
+	{ "Protocol", PROVIDER_FIELD_TYPE_STRING },
+	{ "Initiated", PROVIDER_FIELD_TYPE_BOOLEAN },
+	{ "SourceIsIpv6", PROVIDER_FIELD_TYPE_BOOLEAN },
+	{ "SourceIp", PROVIDER_FIELD_TYPE_STRING },
+	{ "SourceHostname", PROVIDER_FIELD_TYPE_STRING },
+	{ "SourcePort", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "SourcePortName", PROVIDER_FIELD_TYPE_STRING },
+	{ "DestinationIsIpv6", PROVIDER_FIELD_TYPE_BOOLEAN },
+	{ "DestinationIp", PROVIDER_FIELD_TYPE_STRING },
+	{ "DestinationHostname", PROVIDER_FIELD_TYPE_STRING },
+	{ "DestinationPort", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "DestinationPortName", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Sysmon event 5 (process terminated) version 3
+ */
+static const provider_field_definition_t provider_fields_sysmon_5_3[ ] = {
+	{ "RuleName", PROVIDER_FIELD_TYPE_STRING },
+	{ "UtcTime", PROVIDER_FIELD_TYPE_STRING },
+	{ "ProcessGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "Image", PROVIDER_FIELD_TYPE_STRING },
+	{ "User", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The fields of Microsoft-Windows-Sysmon event 11 (file created) version 2
+ */
+static const provider_field_definition_t provider_fields_sysmon_11_2[ ] = {
+	{ "RuleName", PROVIDER_FIELD_TYPE_STRING },
+	{ "UtcTime", PROVIDER_FIELD_TYPE_STRING },
+	{ "ProcessGuid", PROVIDER_FIELD_TYPE_GUID },
+	{ "ProcessId", PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER },
+	{ "Image", PROVIDER_FIELD_TYPE_STRING },
+	{ "TargetFilename", PROVIDER_FIELD_TYPE_STRING },
+	{ "CreationUtcTime", PROVIDER_FIELD_TYPE_STRING },
+	{ "User", PROVIDER_FIELD_TYPE_STRING } };
+
+/* The field definitions of the events of well-known providers that are exported
+ * in high volume, such that their event data can be named without the (Windows)
+ * Registry files and resource files of the provider
+ * The definitions are sorted by provider identifier, event identifier and event version
+ */
+static const provider_fields_definition_t provider_fields_definitions[ ] = {
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4624, 0, provider_fields_security_auditing_4624_0, 20 },
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4624, 1, provider_fields_security_auditing_4624_1, 21 },
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4624, 2, provider_fields_security_auditing_4624_2, 27 },
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4625, 0, provider_fields_security_auditing_4625_0, 21 },
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4672, 0, provider_fields_security_auditing_4672_0, 5 },
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4688, 0, provider_fields_security_auditing_4688_0, 8 },
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4688, 1, provider_fields_security_auditing_4688_1, 9 },
+	{ { 0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d },
+	  4688, 2, provider_fields_security_auditing_4688_2, 15 },
+	{ { 0x3b, 0x85, 0xc1, 0xa0, 0x40, 0x5c, 0x15, 0x4b, 0x87, 0x66, 0x3c, 0xf1, 0xc5, 0x8f, 0x98, 0x5a },
+	  4103, 1, provider_fields_powershell_4103_1, 3 },
+	{ { 0x3b, 0x85, 0xc1, 0xa0, 0x40, 0x5c, 0x15, 0x4b, 0x87, 0x66, 0x3c, 0xf1, 0xc5, 0x8f, 0x98, 0x5a },
+	  4104, 1, provider_fields_powershell_4104_1, 5 },
+	{ { 0x3b, 0x85, 0xc1, 0xa0, 0x40, 0x5c, 0x15, 0x4b, 0x87, 0x66, 0x3c, 0xf1, 0xc5, 0x8f, 0x98, 0x5a },
+	  4105, 1, provider_fields_powershell_4105_1, 2 },
+	{ { 0x3b, 0x85, 0xc1, 0xa0, 0x40, 0x5c, 0x15, 0x4b, 0x87, 0x66, 0x3c, 0xf1, 0xc5, 0x8f, 0x98, 0x5a },
+	  4106, 1, provider_fields_powershell_4105_1, 2 },
+	{ { 0x5f, 0x38, 0x70, 0x57, 0x2a, 0xc2, 0xe0, 0x43, 0xbf, 0x4c, 0x06, 0xf5, 0x69, 0x8f, 0xfb, 0xd9 },
+	  1, 5, provider_fields_sysmon_1_5, 23 },
+	{ { 0x5f, 0x38, 0x70, 0x57, 0x2a, 0xc2, 0xe0, 0x43, 0xbf, 0x4c, 0x06, 0xf5, 0x69, 0x8f, 0xfb, 0xd9 },
+	  3, 5, provider_fields_sysmon_3_5, 18 },
+	{ { 0x5f, 0x38, 0x70, 0x57, 0x2a, 0xc2, 0xe0, 0x43, 0xbf, 0x4c, 0x06, 0xf5, 0x69, 0x8f, 0xfb, 0xd9 },
+	  5, 3, provider_fields_sysmon_5_3, 6 },
+	{ { 0x5f, 0x38, 0x70, 0x57, 0x2a, 0xc2, 0xe0, 0x43, 0xbf, 0x4c, 0x06, 0xf5, 0x69, 0x8f, 0xfb, 0xd9 },
+	  11, 2, provider_fields_sysmon_11_2, 8 } };
+
+/* Compares a fields definition with a provider identifier, event identifier and event version
+ * Returns a negative value if the definition sorts before, 0 if equal or a positive value if after
+ */
+int provider_fields_compare_definition(
+     const provider_fields_definition_t *fields_definition,
+     const uint8_t *provider_identifier,
+     uint32_t event_identifier,
+     uint8_t event_version )
+{
+	int result = 0;
+
+	result = memory_compare(
+	          fields_definition->provider_identifier,
+	          provider_identifier,
+	          16 );
+
+	if( result != 0 )
+	{
+		return( result );
+	}
+	if( fields_definition->event_identifier < event_identifier )
+	{
+		return( -1 );
+	}
+	else if( fields_definition->event_identifier > event_identifier )
+	{
+		return( 1 );
+	}
+	if( fields_definition->event_version < event_version )
+	{
+		return( -1 );
+	}
+	else if( fields_definition->event_version > event_version )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the field definitions of a specific provider event
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int provider_fields_get_definition(
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     const provider_fields_definition_t **fields_definition,
+     libcerror_error_t **error )
+{
+	static char *function     = "provider_fields_get_definition";
+	int definition_index      = 0;
+	int lower_index           = 0;
+	int number_of_definitions = 0;
+	int result                = 0;
+	int upper_index           = 0;
+
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid provider identifier size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( fields_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fields definition.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_definitions = (int) ( sizeof( provider_fields_definitions ) / sizeof( provider_fields_definition_t ) );
+
+	lower_index = 0;
+	upper_index = number_of_definitions;
+
+	while( lower_index < upper_index )
+	{
+		definition_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		result = provider_fields_compare_definition(
+		          &( provider_fields_definitions[ definition_index ] ),
+		          provider_identifier,
+		          event_identifier,
+		          event_version );
+
+		if( result < 0 )
+		{
+			lower_index = definition_index + 1;
+		}
+		else if( result > 0 )
+		{
+			upper_index = definition_index;
+		}
+		else
+		{
+			*fields_definition = &( provider_fields_definitions[ definition_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
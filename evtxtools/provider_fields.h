@@ -0,0 +1,103 @@
+/*
+ * Built-in event data field definitions of well-known providers
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PROVIDER_FIELDS_H )
+#define _PROVIDER_FIELDS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum PROVIDER_FIELD_TYPES
+{
+	PROVIDER_FIELD_TYPE_STRING		= 0,
+	PROVIDER_FIELD_TYPE_UNSIGNED_INTEGER	= 1,
+	PROVIDER_FIELD_TYPE_HEXADECIMAL_INTEGER	= 2,
+	PROVIDER_FIELD_TYPE_BOOLEAN		= 3,
+	PROVIDER_FIELD_TYPE_GUID		= 4,
+	PROVIDER_FIELD_TYPE_SID			= 5,
+	PROVIDER_FIELD_TYPE_DATE_TIME		= 6
+};
+
+typedef struct provider_field_definition provider_field_definition_t;
+
+struct provider_field_definition
+{
+	/* The field name
+	 */
+	const char *name;
+
+	/* The field type
+	 */
+	int type;
+};
+
+typedef struct provider_fields_definition provider_fields_definition_t;
+
+struct provider_fields_definition
+{
+	/* The provider identifier
+	 * The identifier is a little-endian GUID
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The event version
+	 */
+	uint8_t event_version;
+
+	/* The field definitions, by the index of the event data string
+	 */
+	const provider_field_definition_t *field_definitions;
+
+	/* The number of field definitions
+	 */
+	int number_of_field_definitions;
+};
+
+int provider_fields_compare_definition(
+     const provider_fields_definition_t *fields_definition,
+     const uint8_t *provider_identifier,
+     uint32_t event_identifier,
+     uint8_t event_version );
+
+int provider_fields_get_definition(
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     const provider_fields_definition_t **fields_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PROVIDER_FIELDS_H ) */
+
@@ -0,0 +1,367 @@
+/*
+ * Query request
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "query_request.h"
+
+/* Creates a query request
+ * Make sure the value query_request is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int query_request_initialize(
+     query_request_t **query_request,
+     libcerror_error_t **error )
+{
+	static char *function = "query_request_initialize";
+
+	if( query_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid query request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*query_request = memory_allocate_structure(
+	                  query_request_t );
+
+	if( *query_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create query request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *query_request,
+	     0,
+	     sizeof( query_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear query request.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *query_request != NULL )
+	{
+		memory_free(
+		 *query_request );
+
+		*query_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a query request
+ * Returns 1 if successful or -1 on error
+ */
+int query_request_free(
+     query_request_t **query_request,
+     libcerror_error_t **error )
+{
+	static char *function = "query_request_free";
+
+	if( query_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_request != NULL )
+	{
+		memory_free(
+		 *query_request );
+
+		*query_request = NULL;
+	}
+	return( 1 );
+}
+
+/* Parses a request line
+ * The request is either:
+ *   list
+ *   query source [format=format] [since=identifier] [after=time] [offset=number] [limit=number] [filter=expression]
+ * where the filter expression, which can contain spaces, extends to the end of the line
+ * Returns 1 if successful, 0 if the request is not valid or -1 on error
+ */
+int query_request_parse(
+     query_request_t *query_request,
+     const char *line,
+     size_t line_length,
+     libcerror_error_t **error )
+{
+	char *token           = NULL;
+	char *value           = NULL;
+	static char *function = "query_request_parse";
+	size_t line_index     = 0;
+	size_t token_length   = 0;
+
+	if( query_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query request.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_length >= QUERY_REQUEST_MAXIMUM_LINE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid line length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     query_request,
+	     0,
+	     sizeof( query_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear query request.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     query_request->line,
+	     line,
+	     line_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy line.",
+		 function );
+
+		return( -1 );
+	}
+	query_request->line[ line_length ] = 0;
+
+	while( line_index < line_length )
+	{
+		while( ( line_index < line_length )
+		    && ( ( query_request->line[ line_index ] == ' ' )
+		     || ( query_request->line[ line_index ] == '\t' ) ) )
+		{
+			line_index++;
+		}
+		if( line_index >= line_length )
+		{
+			break;
+		}
+		token        = &( query_request->line[ line_index ] );
+		token_length = 0;
+
+		while( ( line_index < line_length )
+		    && ( query_request->line[ line_index ] != ' ' )
+		    && ( query_request->line[ line_index ] != '\t' ) )
+		{
+			line_index++;
+			token_length++;
+		}
+		/* The filter expression extends to the end of the line
+		 */
+		if( ( query_request->command == QUERY_REQUEST_COMMAND_QUERY )
+		 && ( token_length >= 7 )
+		 && ( narrow_string_compare(
+		       token,
+		       "filter=",
+		       7 ) == 0 ) )
+		{
+			query_request->filter_expression = &( token[ 7 ] );
+
+			break;
+		}
+		query_request->line[ line_index ] = 0;
+
+		if( line_index < line_length )
+		{
+			line_index++;
+		}
+		if( query_request->command == QUERY_REQUEST_COMMAND_NONE )
+		{
+			if( ( token_length == 4 )
+			 && ( narrow_string_compare(
+			       token,
+			       "list",
+			       4 ) == 0 ) )
+			{
+				query_request->command = QUERY_REQUEST_COMMAND_LIST;
+			}
+			else if( ( token_length == 5 )
+			      && ( narrow_string_compare(
+			            token,
+			            "query",
+			            5 ) == 0 ) )
+			{
+				query_request->command = QUERY_REQUEST_COMMAND_QUERY;
+			}
+			else
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		if( query_request->command != QUERY_REQUEST_COMMAND_QUERY )
+		{
+			return( 0 );
+		}
+		if( query_request->source == NULL )
+		{
+			query_request->source = token;
+
+			continue;
+		}
+		value = narrow_string_search_character(
+		         token,
+		         '=',
+		         token_length );
+
+		if( ( value == NULL )
+		 || ( value[ 1 ] == 0 ) )
+		{
+			return( 0 );
+		}
+		*value = 0;
+
+		value++;
+
+		token_length = (size_t) ( value - token ) - 1;
+
+		if( ( token_length == 6 )
+		 && ( narrow_string_compare(
+		       token,
+		       "format",
+		       6 ) == 0 ) )
+		{
+			query_request->export_format = value;
+		}
+		else if( ( token_length == 5 )
+		      && ( narrow_string_compare(
+		            token,
+		            "since",
+		            5 ) == 0 ) )
+		{
+			query_request->since_record_identifier = value;
+		}
+		else if( ( token_length == 5 )
+		      && ( narrow_string_compare(
+		            token,
+		            "after",
+		            5 ) == 0 ) )
+		{
+			query_request->since_written_time = value;
+		}
+		else if( ( token_length == 6 )
+		      && ( narrow_string_compare(
+		            token,
+		            "offset",
+		            6 ) == 0 ) )
+		{
+			query_request->record_offset = value;
+		}
+		else if( ( token_length == 5 )
+		      && ( narrow_string_compare(
+		            token,
+		            "limit",
+		            5 ) == 0 ) )
+		{
+			query_request->maximum_number_of_records = value;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	if( query_request->command == QUERY_REQUEST_COMMAND_NONE )
+	{
+		return( 0 );
+	}
+	if( ( query_request->command == QUERY_REQUEST_COMMAND_QUERY )
+	 && ( query_request->source == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( query_request->filter_expression != NULL )
+	 && ( query_request->filter_expression[ 0 ] == 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Query request
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _QUERY_REQUEST_H )
+#define _QUERY_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a request line including the end-of-string character
+ */
+#define QUERY_REQUEST_MAXIMUM_LINE_SIZE		4096
+
+enum QUERY_REQUEST_COMMANDS
+{
+	QUERY_REQUEST_COMMAND_NONE		= 0,
+	QUERY_REQUEST_COMMAND_LIST		= (int) 'l',
+	QUERY_REQUEST_COMMAND_QUERY		= (int) 'q'
+};
+
+typedef struct query_request query_request_t;
+
+struct query_request
+{
+	/* The command
+	 */
+	int command;
+
+	/* The source, either the index of the source or its filename
+	 */
+	const char *source;
+
+	/* The export format
+	 */
+	const char *export_format;
+
+	/* The record identifier after which records are exported
+	 */
+	const char *since_record_identifier;
+
+	/* The written time after which records are exported
+	 */
+	const char *since_written_time;
+
+	/* The number of records that are skipped
+	 */
+	const char *record_offset;
+
+	/* The maximum number of records
+	 */
+	const char *maximum_number_of_records;
+
+	/* The filter expression
+	 */
+	const char *filter_expression;
+
+	/* The request line
+	 * The values of the request point into the line
+	 */
+	char line[ QUERY_REQUEST_MAXIMUM_LINE_SIZE ];
+};
+
+int query_request_initialize(
+     query_request_t **query_request,
+     libcerror_error_t **error );
+
+int query_request_free(
+     query_request_t **query_request,
+     libcerror_error_t **error );
+
+int query_request_parse(
+     query_request_t *query_request,
+     const char *line,
+     size_t line_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _QUERY_REQUEST_H ) */
+
@@ -0,0 +1,1779 @@
+/*
+ * Query server
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "export_handle.h"
+#include "log_handle.h"
+#include "message_handle.h"
+#include "network_stream.h"
+#include "query_request.h"
+#include "query_server.h"
+
+#define QUERY_SERVER_NOTIFY_STREAM		stdout
+
+/* Creates a query server
+ * Make sure the value query_server is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_initialize(
+     query_server_t **query_server,
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_initialize";
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_server != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid query server value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	*query_server = memory_allocate_structure(
+	                 query_server_t );
+
+	if( *query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create query server.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *query_server,
+	     0,
+	     sizeof( query_server_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear query server.",
+		 function );
+
+		memory_free(
+		 *query_server );
+
+		*query_server = NULL;
+
+		return( -1 );
+	}
+	if( query_request_initialize(
+	     &( ( *query_server )->query_request ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create query request.",
+		 function );
+
+		goto on_error;
+	}
+	( *query_server )->export_handle            = export_handle;
+	( *query_server )->maximum_cache_size       = (size64_t) QUERY_SERVER_DEFAULT_CACHE_SIZE;
+	( *query_server )->default_export_format    = export_handle->export_format;
+	( *query_server )->listen_socket_descriptor = -1;
+	( *query_server )->notify_stream            = QUERY_SERVER_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *query_server != NULL )
+	{
+		memory_free(
+		 *query_server );
+
+		*query_server = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a query server
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_free(
+     query_server_t **query_server,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_free";
+	int result            = 1;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_server != NULL )
+	{
+		if( query_server_close_sources(
+		     *query_server,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close sources.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+		if( query_server_close(
+		     *query_server,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close query server.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( query_request_free(
+		     &( ( *query_server )->query_request ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free query request.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *query_server );
+
+		*query_server = NULL;
+	}
+	return( result );
+}
+
+/* Signals the query server to abort
+ * A connection that is being handled is completed first
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_signal_abort(
+     query_server_t *query_server,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_signal_abort";
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	query_server->abort = 1;
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+	/* Shutting down the listening socket makes a blocked accept return
+	 */
+	if( query_server->listen_socket_descriptor != -1 )
+	{
+		if( network_stream_shutdown_socket(
+		     query_server->listen_socket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to shut down listening socket.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum size of the shared chunk cache in bytes
+ * This function needs to be used before the sources are opened
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int query_server_set_maximum_cache_size(
+     query_server_t *query_server,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_set_maximum_cache_size";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_server->cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid query server - cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_handle_copy_decimal_string_to_uint64(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit > 0 ) )
+	{
+		query_server->maximum_cache_size = (size64_t) value_64bit;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Opens a source file
+ * The source file is attached to the shared chunk cache and, if requested, an index
+ * file is kept beside it so that a subsequent start does not need to read all the chunks
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_open_source(
+     query_server_t *query_server,
+     query_server_source_t *source,
+     const system_character_t *filename,
+     uint8_t event_log_type_from_filename,
+     libcerror_error_t **error )
+{
+	system_character_t *index_filename = NULL;
+	static char *function              = "query_server_open_source";
+	size_t filename_length             = 0;
+	size_t index_filename_size         = 0;
+	int default_event_log_type         = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( source->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source - file already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	default_event_log_type = query_server->export_handle->event_log_type;
+
+	if( event_log_type_from_filename != 0 )
+	{
+		if( export_handle_set_event_log_type_from_filename(
+		     query_server->export_handle,
+		     filename,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set event log type from filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	source->event_log_type = query_server->export_handle->event_log_type;
+
+	query_server->export_handle->event_log_type = default_event_log_type;
+
+	if( libevtx_file_initialize(
+	     &( source->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     source->file,
+	     query_server->export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in file.",
+		 function );
+
+		goto on_error;
+	}
+	if( query_server->cache != NULL )
+	{
+		if( libevtx_file_set_cache(
+		     source->file,
+		     query_server->cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cache in file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( query_server->use_index_files != 0 )
+	{
+		filename_length = system_string_length(
+		                   filename );
+
+		index_filename_size = filename_length + system_string_length( QUERY_SERVER_INDEX_FILE_SUFFIX ) + 1;
+
+		index_filename = system_string_allocate(
+		                  index_filename_size );
+
+		if( index_filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     index_filename,
+		     filename,
+		     filename_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     &( index_filename[ filename_length ] ),
+		     QUERY_SERVER_INDEX_FILE_SUFFIX,
+		     index_filename_size - filename_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy index file suffix.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libevtx_file_set_index_filename_wide(
+		     source->file,
+		     index_filename,
+		     error ) != 1 )
+#else
+		if( libevtx_file_set_index_filename(
+		     source->file,
+		     index_filename,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index filename in file.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 index_filename );
+
+		index_filename = NULL;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     source->file,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     source->file,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	source->filename = filename;
+
+	return( 1 );
+
+on_error:
+	if( index_filename != NULL )
+	{
+		memory_free(
+		 index_filename );
+	}
+	if( source->file != NULL )
+	{
+		libevtx_file_free(
+		 &( source->file ),
+		 NULL );
+	}
+	query_server->export_handle->event_log_type = default_event_log_type;
+
+	return( -1 );
+}
+
+/* Opens the source files
+ * The files remain open until the sources are closed. A file that cannot be
+ * opened is reported and skipped
+ * Returns 1 if successful, 0 if one or more files could not be opened or -1 on error
+ */
+int query_server_open_sources(
+     query_server_t *query_server,
+     const system_character_t * const *filenames,
+     int number_of_filenames,
+     uint8_t event_log_type_from_filename,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *file_error = NULL;
+	static char *function         = "query_server_open_sources";
+	int filename_index            = 0;
+	int number_of_failed_files    = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_server->sources != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid query server - sources already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filenames <= 0 )
+	 || ( (size_t) number_of_filenames > ( (size_t) SSIZE_MAX / sizeof( query_server_source_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_cache_initialize(
+	     &( query_server->cache ),
+	     query_server->maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	query_server->sources = (query_server_source_t *) memory_allocate(
+	                                                   sizeof( query_server_source_t ) * number_of_filenames );
+
+	if( query_server->sources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sources.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     query_server->sources,
+	     0,
+	     sizeof( query_server_source_t ) * number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sources.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( query_server->abort != 0 )
+		{
+			break;
+		}
+		if( query_server_open_source(
+		     query_server,
+		     &( query_server->sources[ query_server->number_of_sources ] ),
+		     filenames[ filename_index ],
+		     event_log_type_from_filename,
+		     &file_error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open file: %" PRIs_SYSTEM ".\n",
+			 filenames[ filename_index ] );
+
+			libcnotify_print_error_backtrace(
+			 file_error );
+			libcerror_error_free(
+			 &file_error );
+
+			number_of_failed_files++;
+		}
+		else
+		{
+			query_server->number_of_sources++;
+		}
+	}
+	if( number_of_failed_files != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( query_server->sources != NULL )
+	{
+		memory_free(
+		 query_server->sources );
+
+		query_server->sources = NULL;
+	}
+	if( query_server->cache != NULL )
+	{
+		libevtx_cache_free(
+		 &( query_server->cache ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the source files
+ * Returns 0 if successful or -1 on error
+ */
+int query_server_close_sources(
+     query_server_t *query_server,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_close_sources";
+	int result            = 0;
+	int source_index      = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_server->message_handle_is_open != 0 )
+	{
+		query_server->message_handle_is_open = 0;
+
+		if( message_handle_close_input(
+		     query_server->export_handle->message_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input of message handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( query_server->sources != NULL )
+	{
+		for( source_index = 0;
+		     source_index < query_server->number_of_sources;
+		     source_index++ )
+		{
+			if( libevtx_file_close(
+			     query_server->sources[ source_index ].file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file: %d.",
+				 function,
+				 source_index );
+
+				result = -1;
+			}
+			if( libevtx_file_free(
+			     &( query_server->sources[ source_index ].file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file: %d.",
+				 function,
+				 source_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 query_server->sources );
+
+		query_server->sources           = NULL;
+		query_server->number_of_sources = 0;
+	}
+	/* The files attached to the cache must be closed before the cache is freed
+	 */
+	if( query_server->cache != NULL )
+	{
+		if( libevtx_cache_free(
+		     &( query_server->cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+
+/* Retrieves a source by name
+ * The name is either the index of the source or its filename
+ * Returns 1 if successful, 0 if no such source or -1 on error
+ */
+int query_server_get_source(
+     query_server_t *query_server,
+     const char *name,
+     query_server_source_t **source,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_get_source";
+	size_t name_index     = 0;
+	size_t name_length    = 0;
+	int source_index      = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	/* A name of at most 9 digits is the index of the source
+	 */
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( ( name[ name_index ] < '0' )
+		 || ( name[ name_index ] > '9' ) )
+		{
+			break;
+		}
+		source_index *= 10;
+		source_index += name[ name_index ] - '0';
+	}
+	if( ( name_length > 0 )
+	 && ( name_length <= 9 )
+	 && ( name_index == name_length ) )
+	{
+		if( source_index >= query_server->number_of_sources )
+		{
+			return( 0 );
+		}
+		*source = &( query_server->sources[ source_index ] );
+
+		return( 1 );
+	}
+	for( source_index = 0;
+	     source_index < query_server->number_of_sources;
+	     source_index++ )
+	{
+		if( ( narrow_string_length( query_server->sources[ source_index ].filename ) == name_length )
+		 && ( narrow_string_compare(
+		       query_server->sources[ source_index ].filename,
+		       name,
+		       name_length ) == 0 ) )
+		{
+			*source = &( query_server->sources[ source_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Opens the query server
+ * Creates the listening UNIX domain socket
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_open(
+     query_server_t *query_server,
+     const char *socket_path,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_open";
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_server->listen_socket_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid query server - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( network_stream_listen_unix(
+	     socket_path,
+	     &( query_server->listen_socket_descriptor ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to listen on socket.",
+		 function );
+
+		query_server->listen_socket_descriptor = -1;
+
+		return( -1 );
+	}
+	query_server->socket_path = socket_path;
+
+	return( 1 );
+}
+
+/* Closes the query server
+ * Closes the listening socket and removes its path
+ * Returns 0 if successful or -1 on error
+ */
+int query_server_close(
+     query_server_t *query_server,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_close";
+	int result            = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_server->listen_socket_descriptor != -1 )
+	{
+		if( network_stream_close_socket(
+		     query_server->listen_socket_descriptor,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close listening socket.",
+			 function );
+
+			result = -1;
+		}
+		query_server->listen_socket_descriptor = -1;
+
+		if( query_server->socket_path != NULL )
+		{
+			unlink(
+			 query_server->socket_path );
+
+			query_server->socket_path = NULL;
+		}
+	}
+	return( result );
+}
+
+/* Sets the record selection of the export handle from a query request
+ * Returns 1 if successful, 0 if the request contains an unsupported value or -1 on error
+ */
+int query_server_set_record_selection(
+     query_server_t *query_server,
+     query_request_t *query_request,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_set_record_selection";
+	int result            = 1;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query request.",
+		 function );
+
+		return( -1 );
+	}
+	/* The selection of a previous query is not retained
+	 */
+	if( export_handle_clear_record_selection(
+	     query_server->export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear record selection.",
+		 function );
+
+		return( -1 );
+	}
+	query_server->export_handle->export_format = query_server->default_export_format;
+
+	if( query_request->export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+		          query_server->export_handle,
+		          (const system_character_t *) query_request->export_format,
+		          error );
+	}
+	if( ( result == 1 )
+	 && ( query_request->since_record_identifier != NULL ) )
+	{
+		result = export_handle_set_since_record_identifier(
+		          query_server->export_handle,
+		          (const system_character_t *) query_request->since_record_identifier,
+		          error );
+	}
+	if( ( result == 1 )
+	 && ( query_request->since_written_time != NULL ) )
+	{
+		result = export_handle_set_since_written_time(
+		          query_server->export_handle,
+		          (const system_character_t *) query_request->since_written_time,
+		          error );
+	}
+	if( ( result == 1 )
+	 && ( query_request->record_offset != NULL ) )
+	{
+		result = export_handle_set_record_offset(
+		          query_server->export_handle,
+		          (const system_character_t *) query_request->record_offset,
+		          error );
+	}
+	if( ( result == 1 )
+	 && ( query_request->maximum_number_of_records != NULL ) )
+	{
+		result = export_handle_set_maximum_number_of_records(
+		          query_server->export_handle,
+		          (const system_character_t *) query_request->maximum_number_of_records,
+		          error );
+	}
+	if( ( result == 1 )
+	 && ( query_request->filter_expression != NULL ) )
+	{
+		/* An expression that cannot be compiled is an unsupported value
+		 * of the request rather than a failure of the server
+		 */
+		if( export_handle_set_filter_expression(
+		     query_server->export_handle,
+		     (const system_character_t *) query_request->filter_expression,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			result = 0;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record selection.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Opens the input of the message handle for an event log type
+ * The input, with its cached resource files, message strings and template definitions,
+ * remains open for subsequent queries and is only reopened when the event log type changes
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_open_message_handle_input(
+     query_server_t *query_server,
+     int event_log_type,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_open_message_handle_input";
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( query_server->message_handle_is_open != 0 )
+	 && ( query_server->message_handle_event_log_type == event_log_type ) )
+	{
+		return( 1 );
+	}
+	if( query_server->message_handle_is_open != 0 )
+	{
+		query_server->message_handle_is_open = 0;
+
+		if( message_handle_close_input(
+		     query_server->export_handle->message_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input of message handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	query_server->export_handle->event_log_type = event_log_type;
+
+	if( export_handle_open_message_handle_input(
+	     query_server->export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	query_server->message_handle_event_log_type = event_log_type;
+	query_server->message_handle_is_open        = 1;
+
+	return( 1 );
+}
+
+/* Writes the list of sources to the stream
+ * Every source is written on a separate line containing its index, number of records
+ * and filename separated by tabs
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_list_sources(
+     query_server_t *query_server,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "query_server_list_sources";
+	int number_of_records = 0;
+	int source_index      = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( source_index = 0;
+	     source_index < query_server->number_of_sources;
+	     source_index++ )
+	{
+		if( libevtx_file_get_number_of_records(
+		     query_server->sources[ source_index ].file,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records of source: %d.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( fprintf(
+		     stream,
+		     "%d\t%d\t%" PRIs_SYSTEM "\n",
+		     source_index,
+		     number_of_records,
+		     query_server->sources[ source_index ].filename ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write source: %d.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the records of a source selected by a query request to the stream
+ * A status line is written before the records, which is either OK or ERROR followed
+ * by the reason. The stream is taken over by the output of the export handle, in which
+ * case it is set to NULL, and closed when the export is complete
+ * Returns 1 if successful, 0 if the query was rejected or -1 on error
+ */
+int query_server_query_source(
+     query_server_t *query_server,
+     query_request_t *query_request,
+     FILE **stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	query_server_source_t *source = NULL;
+	static char *function         = "query_server_query_source";
+	int result                    = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query request.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream == NULL )
+	 || ( *stream == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	result = query_server_get_source(
+	          query_server,
+	          query_request->source,
+	          &source,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 *stream,
+		 "ERROR no such source: %s\n",
+		 query_request->source );
+
+		return( 0 );
+	}
+	result = query_server_set_record_selection(
+	          query_server,
+	          query_request,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record selection.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 *stream,
+		 "ERROR unsupported query value\n" );
+
+		return( 0 );
+	}
+	if( query_server_open_message_handle_input(
+	     query_server,
+	     source->event_log_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( fprintf(
+	     *stream,
+	     "OK\n" ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write status.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_open_output_stream(
+	     query_server->export_handle,
+	     *stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output stream.",
+		 function );
+
+		return( -1 );
+	}
+	*stream = NULL;
+
+	result = export_handle_export_resident_file(
+	          query_server->export_handle,
+	          source->file,
+	          source->filename,
+	          log_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export source.",
+		 function );
+
+		export_handle_close_output(
+		 query_server->export_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( export_handle_close_output(
+	     query_server->export_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Handles a connection
+ * Reads the request line and writes the response, the connection is closed afterwards
+ * Returns 1 if successful, 0 if the request was rejected or -1 on error
+ */
+int query_server_handle_connection(
+     query_server_t *query_server,
+     int socket_descriptor,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	char line[ QUERY_REQUEST_MAXIMUM_LINE_SIZE ];
+
+	FILE *stream          = NULL;
+	static char *function = "query_server_handle_connection";
+	size_t line_length    = 0;
+	int result            = 0;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	result = network_stream_read_line(
+	          socket_descriptor,
+	          line,
+	          QUERY_REQUEST_MAXIMUM_LINE_SIZE,
+	          &line_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read request.",
+		 function );
+
+		network_stream_close_socket(
+		 socket_descriptor,
+		 NULL );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = query_request_parse(
+		          query_server->query_request,
+		          line,
+		          line_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse request.",
+			 function );
+
+			network_stream_close_socket(
+			 socket_descriptor,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	/* The socket is closed if the stream cannot be opened
+	 */
+	if( network_stream_open_socket(
+	     socket_descriptor,
+	     &stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open stream of connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_server->export_handle->verbose != 0 )
+	{
+		fprintf(
+		 query_server->notify_stream,
+		 "Request\t\t\t\t: %s\n",
+		 ( result != 0 ) ? line : "(invalid)" );
+	}
+	if( result == 0 )
+	{
+		fprintf(
+		 stream,
+		 "ERROR invalid request\n" );
+	}
+	else if( query_server->query_request->command == QUERY_REQUEST_COMMAND_LIST )
+	{
+		if( fprintf(
+		     stream,
+		     "OK\n" ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write status.",
+			 function );
+
+			goto on_error;
+		}
+		if( query_server_list_sources(
+		     query_server,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to list sources.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = query_server_query_source(
+		          query_server,
+		          query_server->query_request,
+		          &stream,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to query source.",
+			 function );
+
+			/* The status line was not written if the stream was not taken over
+			 */
+			if( stream != NULL )
+			{
+				fprintf(
+				 stream,
+				 "ERROR query failed\n" );
+			}
+			goto on_error;
+		}
+	}
+	if( stream != NULL )
+	{
+		if( file_stream_close(
+		     stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close stream of connection.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Runs the query server
+ * The connections are handled one after the other, since the message handle and
+ * its caches are shared by all the queries, until abort is signalled. A query that
+ * fails is reported and does not stop the server
+ * Returns 1 if successful or -1 on error
+ */
+int query_server_run(
+     query_server_t *query_server,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *connection_error = NULL;
+	static char *function               = "query_server_run";
+	int result                          = 0;
+	int socket_descriptor               = -1;
+
+	if( query_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query server.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_server->listen_socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid query server - not open.",
+		 function );
+
+		return( -1 );
+	}
+	while( query_server->abort == 0 )
+	{
+		if( network_stream_accept(
+		     query_server->listen_socket_descriptor,
+		     &socket_descriptor,
+		     error ) != 1 )
+		{
+			/* The accept fails when the listening socket is shut down on abort
+			 */
+			if( query_server->abort != 0 )
+			{
+				libcerror_error_free(
+				 error );
+
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to accept connection.",
+			 function );
+
+			return( -1 );
+		}
+		result = query_server_handle_connection(
+		          query_server,
+		          socket_descriptor,
+		          log_handle,
+		          &connection_error );
+
+		query_server->number_of_queries++;
+
+		if( result != 1 )
+		{
+			query_server->number_of_failed_queries++;
+		}
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to handle connection.\n" );
+
+			libcnotify_print_error_backtrace(
+			 connection_error );
+			libcerror_error_free(
+			 &connection_error );
+		}
+	}
+	if( query_server->export_handle->verbose != 0 )
+	{
+		fprintf(
+		 query_server->notify_stream,
+		 "Handled queries\t\t\t: %d\n",
+		 query_server->number_of_queries );
+
+		fprintf(
+		 query_server->notify_stream,
+		 "Failed queries\t\t\t: %d\n",
+		 query_server->number_of_failed_queries );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+
@@ -0,0 +1,230 @@
+/*
+ * Query server
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _QUERY_SERVER_H )
+#define _QUERY_SERVER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "export_handle.h"
+#include "log_handle.h"
+#include "network_stream.h"
+#include "query_request.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The suffix of the index file that is kept beside a source file
+ */
+#define QUERY_SERVER_INDEX_FILE_SUFFIX		_SYSTEM_STRING( ".idx" )
+
+/* The default maximum size of the shared chunk cache in bytes
+ */
+#define QUERY_SERVER_DEFAULT_CACHE_SIZE		( 256 * 1024 * 1024 )
+
+typedef struct query_server_source query_server_source_t;
+
+struct query_server_source
+{
+	/* The filename
+	 * The filename is not copied and must remain valid while the source is open
+	 */
+	const system_character_t *filename;
+
+	/* The libevtx file
+	 */
+	libevtx_file_t *file;
+
+	/* The event log type
+	 */
+	int event_log_type;
+};
+
+typedef struct query_server query_server_t;
+
+struct query_server
+{
+	/* The export handle
+	 * Contains the message handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The shared chunk cache of the source files
+	 */
+	libevtx_cache_t *cache;
+
+	/* The maximum size of the shared chunk cache in bytes
+	 */
+	size64_t maximum_cache_size;
+
+	/* Value to indicate an index file is kept beside every source file
+	 */
+	int use_index_files;
+
+	/* The sources
+	 */
+	query_server_source_t *sources;
+
+	/* The number of sources
+	 */
+	int number_of_sources;
+
+	/* The export format that is used if a query does not specify one
+	 */
+	uint8_t default_export_format;
+
+	/* The event log type of the opened input of the message handle
+	 */
+	int message_handle_event_log_type;
+
+	/* Value to indicate the input of the message handle is open
+	 */
+	int message_handle_is_open;
+
+	/* The query request
+	 */
+	query_request_t *query_request;
+
+	/* The path of the listening socket
+	 */
+	const char *socket_path;
+
+	/* The listening socket descriptor
+	 */
+	int listen_socket_descriptor;
+
+	/* The number of handled queries
+	 */
+	int number_of_queries;
+
+	/* The number of failed queries
+	 */
+	int number_of_failed_queries;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int query_server_initialize(
+     query_server_t **query_server,
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int query_server_free(
+     query_server_t **query_server,
+     libcerror_error_t **error );
+
+int query_server_signal_abort(
+     query_server_t *query_server,
+     libcerror_error_t **error );
+
+int query_server_set_maximum_cache_size(
+     query_server_t *query_server,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int query_server_open_source(
+     query_server_t *query_server,
+     query_server_source_t *source,
+     const system_character_t *filename,
+     uint8_t event_log_type_from_filename,
+     libcerror_error_t **error );
+
+int query_server_open_sources(
+     query_server_t *query_server,
+     const system_character_t * const *filenames,
+     int number_of_filenames,
+     uint8_t event_log_type_from_filename,
+     libcerror_error_t **error );
+
+int query_server_close_sources(
+     query_server_t *query_server,
+     libcerror_error_t **error );
+
+#if defined( HAVE_NETWORK_STREAM_SUPPORT )
+
+int query_server_get_source(
+     query_server_t *query_server,
+     const char *name,
+     query_server_source_t **source,
+     libcerror_error_t **error );
+
+int query_server_open(
+     query_server_t *query_server,
+     const char *socket_path,
+     libcerror_error_t **error );
+
+int query_server_close(
+     query_server_t *query_server,
+     libcerror_error_t **error );
+
+int query_server_set_record_selection(
+     query_server_t *query_server,
+     query_request_t *query_request,
+     libcerror_error_t **error );
+
+int query_server_open_message_handle_input(
+     query_server_t *query_server,
+     int event_log_type,
+     libcerror_error_t **error );
+
+int query_server_list_sources(
+     query_server_t *query_server,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int query_server_query_source(
+     query_server_t *query_server,
+     query_request_t *query_request,
+     FILE **stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int query_server_handle_connection(
+     query_server_t *query_server,
+     int socket_descriptor,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int query_server_run(
+     query_server_t *query_server,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_NETWORK_STREAM_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _QUERY_SERVER_H ) */
+
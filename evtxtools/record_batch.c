@@ -0,0 +1,265 @@
+/*
+ * Record batch
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "record_batch.h"
+
+/* Creates a record batch
+ * Make sure the value record_batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_batch_initialize(
+     record_batch_t **record_batch,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "record_batch_initialize";
+	size_t array_size     = 0;
+
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_records <= 0 )
+	 || ( (size_t) maximum_number_of_records > ( (size_t) SSIZE_MAX / sizeof( system_character_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*record_batch = memory_allocate_structure(
+	                 record_batch_t );
+
+	if( *record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_batch,
+	     0,
+	     sizeof( record_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record batch.",
+		 function );
+
+		memory_free(
+		 *record_batch );
+
+		*record_batch = NULL;
+
+		return( -1 );
+	}
+	array_size = sizeof( system_character_t * ) * maximum_number_of_records;
+
+	( *record_batch )->event_xml_strings = (system_character_t **) memory_allocate(
+	                                                                array_size );
+
+	if( ( *record_batch )->event_xml_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event XML strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *record_batch )->event_xml_strings,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event XML strings.",
+		 function );
+
+		goto on_error;
+	}
+	array_size = sizeof( int ) * maximum_number_of_records;
+
+	( *record_batch )->export_results = (int *) memory_allocate(
+	                                             array_size );
+
+	if( ( *record_batch )->export_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export results.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_batch )->maximum_number_of_records = maximum_number_of_records;
+
+	return( 1 );
+
+on_error:
+	if( *record_batch != NULL )
+	{
+		if( ( *record_batch )->event_xml_strings != NULL )
+		{
+			memory_free(
+			 ( *record_batch )->event_xml_strings );
+		}
+		memory_free(
+		 *record_batch );
+
+		*record_batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record batch
+ * Returns 1 if successful or -1 on error
+ */
+int record_batch_free(
+     record_batch_t **record_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "record_batch_free";
+	int result            = 1;
+
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_batch != NULL )
+	{
+		if( record_batch_clear(
+		     *record_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear record batch.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *record_batch )->export_results );
+
+		memory_free(
+		 ( *record_batch )->event_xml_strings );
+
+		memory_free(
+		 *record_batch );
+
+		*record_batch = NULL;
+	}
+	return( result );
+}
+
+/* Clears a record batch for reuse
+ * Frees the event XML strings but retains the allocated arrays
+ * Returns 1 if successful or -1 on error
+ */
+int record_batch_clear(
+     record_batch_t *record_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "record_batch_clear";
+	int record_index      = 0;
+
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < record_batch->maximum_number_of_records;
+	     record_index++ )
+	{
+		if( record_batch->event_xml_strings[ record_index ] != NULL )
+		{
+			memory_free(
+			 record_batch->event_xml_strings[ record_index ] );
+
+			record_batch->event_xml_strings[ record_index ] = NULL;
+		}
+		record_batch->export_results[ record_index ] = 0;
+	}
+	record_batch->number_of_records = 0;
+	record_batch->result            = 0;
+
+	return( 1 );
+}
+
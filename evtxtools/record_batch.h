@@ -0,0 +1,87 @@
+/*
+ * Record batch
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_BATCH_H )
+#define _RECORD_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct record_batch record_batch_t;
+
+struct record_batch
+{
+	/* The index of the batch
+	 */
+	int batch_index;
+
+	/* The index of the first record of the batch
+	 */
+	int first_record_index;
+
+	/* The number of records of the batch
+	 */
+	int number_of_records;
+
+	/* The maximum number of records of the batch
+	 */
+	int maximum_number_of_records;
+
+	/* The event XML strings of the records
+	 */
+	system_character_t **event_xml_strings;
+
+	/* The export results of the records
+	 */
+	int *export_results;
+
+	/* The result of rendering the batch
+	 * A value of -1 indicates the worker failed and did not render all records
+	 */
+	int result;
+};
+
+int record_batch_initialize(
+     record_batch_t **record_batch,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+int record_batch_free(
+     record_batch_t **record_batch,
+     libcerror_error_t **error );
+
+int record_batch_clear(
+     record_batch_t *record_batch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_BATCH_H ) */
+
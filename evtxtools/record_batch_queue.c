@@ -0,0 +1,376 @@
+/*
+ * Bounded lock-free record batch queue
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( WINAPI )
+#include <sched.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "record_batch.h"
+#include "record_batch_queue.h"
+
+#if defined( WINAPI ) && !defined( __GNUC__ )
+
+#define RECORD_BATCH_QUEUE_ATOMIC_LOAD( value ) \
+	(uint32_t) InterlockedCompareExchange( (volatile LONG *) value, 0, 0 )
+
+#define RECORD_BATCH_QUEUE_ATOMIC_STORE( value, new_value ) \
+	InterlockedExchange( (volatile LONG *) value, (LONG) new_value )
+
+#define RECORD_BATCH_QUEUE_ATOMIC_COMPARE_EXCHANGE( value, expected_value, new_value ) \
+	( InterlockedCompareExchange( (volatile LONG *) value, (LONG) new_value, (LONG) expected_value ) == (LONG) expected_value )
+
+#else
+
+#define RECORD_BATCH_QUEUE_ATOMIC_LOAD( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define RECORD_BATCH_QUEUE_ATOMIC_STORE( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#define RECORD_BATCH_QUEUE_ATOMIC_COMPARE_EXCHANGE( value, expected_value, new_value ) \
+	__sync_bool_compare_and_swap( value, expected_value, new_value )
+
+#endif /* defined( WINAPI ) && !defined( __GNUC__ ) */
+
+/* Creates a record batch queue
+ * The number of slots is the maximum number of batches rounded up to a power of 2
+ * Make sure the value record_batch_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_batch_queue_initialize(
+     record_batch_queue_t **record_batch_queue,
+     int maximum_number_of_batches,
+     libcerror_error_t **error )
+{
+	static char *function    = "record_batch_queue_initialize";
+	uint32_t number_of_slots = 0;
+	uint32_t slot_index      = 0;
+
+	if( record_batch_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_batch_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record batch queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_batches <= 0 )
+	 || ( maximum_number_of_batches > RECORD_BATCH_QUEUE_MAXIMUM_NUMBER_OF_SLOTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of batches value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A single slot cannot distinguish a free from a used slot
+	 */
+	number_of_slots = 2;
+
+	while( number_of_slots < (uint32_t) maximum_number_of_batches )
+	{
+		number_of_slots <<= 1;
+	}
+	*record_batch_queue = memory_allocate_structure(
+	                       record_batch_queue_t );
+
+	if( *record_batch_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record batch queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_batch_queue,
+	     0,
+	     sizeof( record_batch_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record batch queue.",
+		 function );
+
+		memory_free(
+		 *record_batch_queue );
+
+		*record_batch_queue = NULL;
+
+		return( -1 );
+	}
+	( *record_batch_queue )->slots = (record_batch_queue_slot_t *) memory_allocate(
+	                                                                sizeof( record_batch_queue_slot_t ) * number_of_slots );
+
+	if( ( *record_batch_queue )->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < number_of_slots;
+	     slot_index++ )
+	{
+		( *record_batch_queue )->slots[ slot_index ].sequence     = slot_index;
+		( *record_batch_queue )->slots[ slot_index ].record_batch = NULL;
+	}
+	( *record_batch_queue )->slot_mask = number_of_slots - 1;
+
+	return( 1 );
+
+on_error:
+	if( *record_batch_queue != NULL )
+	{
+		memory_free(
+		 *record_batch_queue );
+
+		*record_batch_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record batch queue
+ * The record batches in the queue are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int record_batch_queue_free(
+     record_batch_queue_t **record_batch_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "record_batch_queue_free";
+
+	if( record_batch_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_batch_queue != NULL )
+	{
+		memory_free(
+		 ( *record_batch_queue )->slots );
+
+		memory_free(
+		 *record_batch_queue );
+
+		*record_batch_queue = NULL;
+	}
+	return( 1 );
+}
+
+/* Tries to push a record batch onto the queue
+ * Multiple threads can push concurrently, without taking a lock
+ * A NULL record batch can be pushed as an end of work marker
+ * Returns 1 if successful, 0 if the queue is full or -1 on error
+ */
+int record_batch_queue_try_push(
+     record_batch_queue_t *record_batch_queue,
+     record_batch_t *record_batch,
+     libcerror_error_t **error )
+{
+	record_batch_queue_slot_t *slot = NULL;
+	static char *function           = "record_batch_queue_try_push";
+	uint32_t position               = 0;
+	uint32_t sequence               = 0;
+	int32_t difference              = 0;
+
+	if( record_batch_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch queue.",
+		 function );
+
+		return( -1 );
+	}
+	position = RECORD_BATCH_QUEUE_ATOMIC_LOAD(
+	            &( record_batch_queue->enqueue_position ) );
+
+	for( ;; )
+	{
+		slot = &( record_batch_queue->slots[ position & record_batch_queue->slot_mask ] );
+
+		sequence = RECORD_BATCH_QUEUE_ATOMIC_LOAD(
+		            &( slot->sequence ) );
+
+		difference = (int32_t) ( sequence - position );
+
+		if( difference == 0 )
+		{
+			if( RECORD_BATCH_QUEUE_ATOMIC_COMPARE_EXCHANGE(
+			     &( record_batch_queue->enqueue_position ),
+			     position,
+			     position + 1 ) )
+			{
+				break;
+			}
+		}
+		else if( difference < 0 )
+		{
+			/* The slot still contains a batch of the previous lap
+			 */
+			return( 0 );
+		}
+		position = RECORD_BATCH_QUEUE_ATOMIC_LOAD(
+		            &( record_batch_queue->enqueue_position ) );
+	}
+	slot->record_batch = record_batch;
+
+	RECORD_BATCH_QUEUE_ATOMIC_STORE(
+	 &( slot->sequence ),
+	 position + 1 );
+
+	return( 1 );
+}
+
+/* Tries to pop a record batch from the queue
+ * Multiple threads can pop concurrently, without taking a lock
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int record_batch_queue_try_pop(
+     record_batch_queue_t *record_batch_queue,
+     record_batch_t **record_batch,
+     libcerror_error_t **error )
+{
+	record_batch_queue_slot_t *slot = NULL;
+	static char *function           = "record_batch_queue_try_pop";
+	uint32_t position               = 0;
+	uint32_t sequence               = 0;
+	int32_t difference              = 0;
+
+	if( record_batch_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	position = RECORD_BATCH_QUEUE_ATOMIC_LOAD(
+	            &( record_batch_queue->dequeue_position ) );
+
+	for( ;; )
+	{
+		slot = &( record_batch_queue->slots[ position & record_batch_queue->slot_mask ] );
+
+		sequence = RECORD_BATCH_QUEUE_ATOMIC_LOAD(
+		            &( slot->sequence ) );
+
+		difference = (int32_t) ( sequence - ( position + 1 ) );
+
+		if( difference == 0 )
+		{
+			if( RECORD_BATCH_QUEUE_ATOMIC_COMPARE_EXCHANGE(
+			     &( record_batch_queue->dequeue_position ),
+			     position,
+			     position + 1 ) )
+			{
+				break;
+			}
+		}
+		else if( difference < 0 )
+		{
+			/* The slot has not been filled yet
+			 */
+			return( 0 );
+		}
+		position = RECORD_BATCH_QUEUE_ATOMIC_LOAD(
+		            &( record_batch_queue->dequeue_position ) );
+	}
+	*record_batch = slot->record_batch;
+
+	/* Mark the slot free for the enqueue position of the next lap
+	 */
+	RECORD_BATCH_QUEUE_ATOMIC_STORE(
+	 &( slot->sequence ),
+	 position + record_batch_queue->slot_mask + 1 );
+
+	return( 1 );
+}
+
+/* Yields the processor to other threads while waiting on a queue
+ */
+void record_batch_queue_yield(
+      void )
+{
+#if defined( WINAPI )
+	SwitchToThread();
+
+#elif defined( HAVE_MULTI_THREAD_SUPPORT )
+	sched_yield();
+#endif
+}
+
@@ -0,0 +1,119 @@
+/*
+ * Bounded lock-free record batch queue
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_BATCH_QUEUE_H )
+#define _RECORD_BATCH_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "record_batch.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of slots of a record batch queue
+ */
+#define RECORD_BATCH_QUEUE_MAXIMUM_NUMBER_OF_SLOTS	65536
+
+/* The size of a cache line, used to keep the enqueue and dequeue positions apart
+ */
+#define RECORD_BATCH_QUEUE_CACHE_LINE_SIZE		64
+
+typedef struct record_batch_queue_slot record_batch_queue_slot_t;
+
+struct record_batch_queue_slot
+{
+	/* The sequence number
+	 * Equals the enqueue position when the slot is free
+	 * and the enqueue position + 1 when the slot contains a batch
+	 */
+	uint32_t sequence;
+
+	/* The record batch
+	 */
+	record_batch_t *record_batch;
+};
+
+typedef struct record_batch_queue record_batch_queue_t;
+
+struct record_batch_queue
+{
+	/* The slots
+	 */
+	record_batch_queue_slot_t *slots;
+
+	/* The slot mask, the number of slots - 1
+	 */
+	uint32_t slot_mask;
+
+	/* Padding to keep the enqueue position in its own cache line
+	 */
+	uint8_t padding1[ RECORD_BATCH_QUEUE_CACHE_LINE_SIZE ];
+
+	/* The enqueue position
+	 */
+	uint32_t enqueue_position;
+
+	/* Padding to keep the dequeue position in its own cache line
+	 */
+	uint8_t padding2[ RECORD_BATCH_QUEUE_CACHE_LINE_SIZE ];
+
+	/* The dequeue position
+	 */
+	uint32_t dequeue_position;
+
+	/* Padding to keep the dequeue position in its own cache line
+	 */
+	uint8_t padding3[ RECORD_BATCH_QUEUE_CACHE_LINE_SIZE ];
+};
+
+int record_batch_queue_initialize(
+     record_batch_queue_t **record_batch_queue,
+     int maximum_number_of_batches,
+     libcerror_error_t **error );
+
+int record_batch_queue_free(
+     record_batch_queue_t **record_batch_queue,
+     libcerror_error_t **error );
+
+int record_batch_queue_try_push(
+     record_batch_queue_t *record_batch_queue,
+     record_batch_t *record_batch,
+     libcerror_error_t **error );
+
+int record_batch_queue_try_pop(
+     record_batch_queue_t *record_batch_queue,
+     record_batch_t **record_batch,
+     libcerror_error_t **error );
+
+void record_batch_queue_yield(
+      void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_BATCH_QUEUE_H ) */
+
@@ -0,0 +1,343 @@
+/*
+ * Record hash set
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "record_hash_set.h"
+
+/* Creates a record hash set
+ * Make sure the value record_hash_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_hash_set_initialize(
+     record_hash_set_t **record_hash_set,
+     libcerror_error_t **error )
+{
+	static char *function = "record_hash_set_initialize";
+
+	if( record_hash_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record hash set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_hash_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record hash set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_hash_set = memory_allocate_structure(
+	                    record_hash_set_t );
+
+	if( *record_hash_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record hash set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_hash_set,
+	     0,
+	     sizeof( record_hash_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record hash set.",
+		 function );
+
+		memory_free(
+		 *record_hash_set );
+
+		*record_hash_set = NULL;
+
+		return( -1 );
+	}
+	if( record_hash_set_resize_slots(
+	     *record_hash_set,
+	     RECORD_HASH_SET_INITIAL_NUMBER_OF_SLOTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize slots.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_hash_set != NULL )
+	{
+		memory_free(
+		 *record_hash_set );
+
+		*record_hash_set = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record hash set
+ * Returns 1 if successful or -1 on error
+ */
+int record_hash_set_free(
+     record_hash_set_t **record_hash_set,
+     libcerror_error_t **error )
+{
+	static char *function = "record_hash_set_free";
+
+	if( record_hash_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record hash set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_hash_set != NULL )
+	{
+		if( ( *record_hash_set )->slots != NULL )
+		{
+			memory_free(
+			 ( *record_hash_set )->slots );
+		}
+		memory_free(
+		 *record_hash_set );
+
+		*record_hash_set = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the slots of a record hash set and reinserts the hashes
+ * Returns 1 if successful or -1 on error
+ */
+int record_hash_set_resize_slots(
+     record_hash_set_t *record_hash_set,
+     size_t number_of_slots,
+     libcerror_error_t **error )
+{
+	uint64_t *slots       = NULL;
+	static char *function = "record_hash_set_resize_slots";
+	size_t slot_index     = 0;
+	size_t new_slot_index = 0;
+
+	if( record_hash_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record hash set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots == 0 )
+	 || ( number_of_slots > ( (size_t) SSIZE_MAX / sizeof( uint64_t ) ) )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( number_of_slots <= record_hash_set->number_of_hashes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (uint64_t *) memory_allocate(
+	                      sizeof( uint64_t ) * number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( uint64_t ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < record_hash_set->number_of_slots;
+	     slot_index++ )
+	{
+		if( record_hash_set->slots[ slot_index ] == 0 )
+		{
+			continue;
+		}
+		new_slot_index = (size_t) ( record_hash_set->slots[ slot_index ] & (uint64_t) ( number_of_slots - 1 ) );
+
+		while( slots[ new_slot_index ] != 0 )
+		{
+			new_slot_index = ( new_slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ new_slot_index ] = record_hash_set->slots[ slot_index ];
+	}
+	if( record_hash_set->slots != NULL )
+	{
+		memory_free(
+		 record_hash_set->slots );
+	}
+	record_hash_set->slots           = slots;
+	record_hash_set->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Inserts a hash into the record hash set
+ * Returns 1 if successful, 0 if the hash was already present or -1 on error
+ */
+int record_hash_set_insert(
+     record_hash_set_t *record_hash_set,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "record_hash_set_insert";
+	size_t slot_index     = 0;
+
+	if( record_hash_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record hash set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_hash_set->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record hash set - missing slots.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value 0 marks an unused slot and is tracked separately
+	 */
+	if( hash == 0 )
+	{
+		if( record_hash_set->has_zero_hash != 0 )
+		{
+			return( 0 );
+		}
+		record_hash_set->has_zero_hash = 1;
+
+		return( 1 );
+	}
+	slot_index = (size_t) ( hash & (uint64_t) ( record_hash_set->number_of_slots - 1 ) );
+
+	while( record_hash_set->slots[ slot_index ] != 0 )
+	{
+		if( record_hash_set->slots[ slot_index ] == hash )
+		{
+			return( 0 );
+		}
+		slot_index = ( slot_index + 1 ) & ( record_hash_set->number_of_slots - 1 );
+	}
+	record_hash_set->slots[ slot_index ] = hash;
+
+	record_hash_set->number_of_hashes += 1;
+
+	/* Keep the load factor at or below 50%
+	 */
+	if( record_hash_set->number_of_hashes > ( record_hash_set->number_of_slots / 2 ) )
+	{
+		if( record_hash_set->number_of_slots > ( (size_t) SSIZE_MAX / ( 2 * sizeof( uint64_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid record hash set - number of slots value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( record_hash_set_resize_slots(
+		     record_hash_set,
+		     record_hash_set->number_of_slots * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,83 @@
+/*
+ * Record hash set
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_HASH_SET_H )
+#define _RECORD_HASH_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of hash set slots, must be a power of 2
+ */
+#define RECORD_HASH_SET_INITIAL_NUMBER_OF_SLOTS	1024
+
+typedef struct record_hash_set record_hash_set_t;
+
+struct record_hash_set
+{
+	/* The slots
+	 * A slot value of 0 marks an unused slot
+	 */
+	uint64_t *slots;
+
+	/* The number of slots
+	 */
+	size_t number_of_slots;
+
+	/* The number of hashes
+	 */
+	size_t number_of_hashes;
+
+	/* Value to indicate the hash 0 was inserted
+	 */
+	uint8_t has_zero_hash;
+};
+
+int record_hash_set_initialize(
+     record_hash_set_t **record_hash_set,
+     libcerror_error_t **error );
+
+int record_hash_set_free(
+     record_hash_set_t **record_hash_set,
+     libcerror_error_t **error );
+
+int record_hash_set_resize_slots(
+     record_hash_set_t *record_hash_set,
+     size_t number_of_slots,
+     libcerror_error_t **error );
+
+int record_hash_set_insert(
+     record_hash_set_t *record_hash_set,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_HASH_SET_H ) */
+
@@ -0,0 +1,1085 @@
+/*
+ * Record statistics
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "chunk_sampler.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "record_statistics.h"
+
+/* The number of FILETIME intervals of 100 nano seconds in an hour
+ */
+#define RECORD_STATISTICS_INTERVALS_PER_HOUR	(uint64_t) 36000000000UL
+
+/* Creates record statistics
+ * Make sure the value record_statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_initialize(
+     record_statistics_t **record_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "record_statistics_initialize";
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_statistics = memory_allocate_structure(
+	                      record_statistics_t );
+
+	if( *record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_statistics,
+	     0,
+	     sizeof( record_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record statistics.",
+		 function );
+
+		memory_free(
+		 *record_statistics );
+
+		*record_statistics = NULL;
+
+		return( -1 );
+	}
+	( *record_statistics )->last_chunk_index = -1;
+
+	if( record_statistics_grow_event_identifiers(
+	     *record_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event identifiers hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_statistics_grow_providers(
+	     *record_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create providers hash table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_statistics != NULL )
+	{
+		record_statistics_free(
+		 record_statistics,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees record statistics
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_free(
+     record_statistics_t **record_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "record_statistics_free";
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_statistics != NULL )
+	{
+		if( ( *record_statistics )->event_identifiers != NULL )
+		{
+			memory_free(
+			 ( *record_statistics )->event_identifiers );
+		}
+		if( ( *record_statistics )->providers != NULL )
+		{
+			memory_free(
+			 ( *record_statistics )->providers );
+		}
+		memory_free(
+		 *record_statistics );
+
+		*record_statistics = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two event identifier entries by their number of records in descending order
+ * Entries with the same number of records are ordered by event identifier
+ * Returns -1, 0 or 1 as qsort requires
+ */
+int record_statistics_event_identifier_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const record_statistics_event_identifier_t *first_event_identifier  = (const record_statistics_event_identifier_t *) first_entry;
+	const record_statistics_event_identifier_t *second_event_identifier = (const record_statistics_event_identifier_t *) second_entry;
+
+	if( first_event_identifier->number_of_records > second_event_identifier->number_of_records )
+	{
+		return( -1 );
+	}
+	else if( first_event_identifier->number_of_records < second_event_identifier->number_of_records )
+	{
+		return( 1 );
+	}
+	if( first_event_identifier->event_identifier < second_event_identifier->event_identifier )
+	{
+		return( -1 );
+	}
+	else if( first_event_identifier->event_identifier > second_event_identifier->event_identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two provider entries by their number of records in descending order
+ * Entries with the same number of records are ordered by provider identifier
+ * Returns -1, 0 or 1 as qsort requires
+ */
+int record_statistics_provider_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const record_statistics_provider_t *first_provider  = (const record_statistics_provider_t *) first_entry;
+	const record_statistics_provider_t *second_provider = (const record_statistics_provider_t *) second_entry;
+	int result                                          = 0;
+
+	if( first_provider->number_of_records > second_provider->number_of_records )
+	{
+		return( -1 );
+	}
+	else if( first_provider->number_of_records < second_provider->number_of_records )
+	{
+		return( 1 );
+	}
+	result = memory_compare(
+	          first_provider->provider_identifier,
+	          second_provider->provider_identifier,
+	          RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Doubles the number of entries of the event identifiers hash table
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_grow_event_identifiers(
+     record_statistics_t *record_statistics,
+     libcerror_error_t **error )
+{
+	record_statistics_event_identifier_t *event_identifiers = NULL;
+	static char *function                                   = "record_statistics_grow_event_identifiers";
+	uint32_t entry_index                                    = 0;
+	uint32_t entry_mask                                     = 0;
+	int event_identifiers_size                              = 0;
+	int old_entry_index                                     = 0;
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_statistics->event_identifiers_size == 0 )
+	{
+		event_identifiers_size = RECORD_STATISTICS_INITIAL_NUMBER_OF_ENTRIES;
+	}
+	else if( record_statistics->event_identifiers_size > ( ( INT_MAX / 2 ) / (int) sizeof( record_statistics_event_identifier_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record statistics - event identifiers size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	else
+	{
+		event_identifiers_size = record_statistics->event_identifiers_size * 2;
+	}
+	event_identifiers = (record_statistics_event_identifier_t *) memory_allocate(
+	                                                              sizeof( record_statistics_event_identifier_t ) * event_identifiers_size );
+
+	if( event_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event identifiers hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     event_identifiers,
+	     0,
+	     sizeof( record_statistics_event_identifier_t ) * event_identifiers_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event identifiers hash table.",
+		 function );
+
+		memory_free(
+		 event_identifiers );
+
+		return( -1 );
+	}
+	entry_mask = (uint32_t) event_identifiers_size - 1;
+
+	for( old_entry_index = 0;
+	     old_entry_index < record_statistics->event_identifiers_size;
+	     old_entry_index++ )
+	{
+		if( record_statistics->event_identifiers[ old_entry_index ].number_of_records == 0 )
+		{
+			continue;
+		}
+		entry_index = ( record_statistics->event_identifiers[ old_entry_index ].event_identifier * (uint32_t) 0x9e3779b1UL ) & entry_mask;
+
+		while( event_identifiers[ entry_index ].number_of_records != 0 )
+		{
+			entry_index = ( entry_index + 1 ) & entry_mask;
+		}
+		event_identifiers[ entry_index ] = record_statistics->event_identifiers[ old_entry_index ];
+	}
+	if( record_statistics->event_identifiers != NULL )
+	{
+		memory_free(
+		 record_statistics->event_identifiers );
+	}
+	record_statistics->event_identifiers      = event_identifiers;
+	record_statistics->event_identifiers_size = event_identifiers_size;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a provider identifier string
+ * Returns the 32-bit FNV-1a hash
+ */
+static uint32_t record_statistics_hash_provider_identifier(
+                 const uint8_t *provider_identifier )
+{
+	uint32_t hash     = (uint32_t) 0x811c9dc5UL;
+	size_t data_index = 0;
+
+	for( data_index = 0;
+	     data_index < ( RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE - 1 );
+	     data_index++ )
+	{
+		hash ^= provider_identifier[ data_index ];
+		hash *= (uint32_t) 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Doubles the number of entries of the providers hash table
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_grow_providers(
+     record_statistics_t *record_statistics,
+     libcerror_error_t **error )
+{
+	record_statistics_provider_t *providers = NULL;
+	static char *function                   = "record_statistics_grow_providers";
+	uint32_t entry_index                    = 0;
+	uint32_t entry_mask                     = 0;
+	int old_entry_index                     = 0;
+	int providers_size                      = 0;
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_statistics->providers_size == 0 )
+	{
+		providers_size = RECORD_STATISTICS_INITIAL_NUMBER_OF_ENTRIES;
+	}
+	else if( record_statistics->providers_size > ( ( INT_MAX / 2 ) / (int) sizeof( record_statistics_provider_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record statistics - providers size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	else
+	{
+		providers_size = record_statistics->providers_size * 2;
+	}
+	providers = (record_statistics_provider_t *) memory_allocate(
+	                                              sizeof( record_statistics_provider_t ) * providers_size );
+
+	if( providers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create providers hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     providers,
+	     0,
+	     sizeof( record_statistics_provider_t ) * providers_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear providers hash table.",
+		 function );
+
+		memory_free(
+		 providers );
+
+		return( -1 );
+	}
+	entry_mask = (uint32_t) providers_size - 1;
+
+	for( old_entry_index = 0;
+	     old_entry_index < record_statistics->providers_size;
+	     old_entry_index++ )
+	{
+		if( record_statistics->providers[ old_entry_index ].number_of_records == 0 )
+		{
+			continue;
+		}
+		entry_index = record_statistics_hash_provider_identifier(
+		               record_statistics->providers[ old_entry_index ].provider_identifier ) & entry_mask;
+
+		while( providers[ entry_index ].number_of_records != 0 )
+		{
+			entry_index = ( entry_index + 1 ) & entry_mask;
+		}
+		providers[ entry_index ] = record_statistics->providers[ old_entry_index ];
+	}
+	if( record_statistics->providers != NULL )
+	{
+		memory_free(
+		 record_statistics->providers );
+	}
+	record_statistics->providers      = providers;
+	record_statistics->providers_size = providers_size;
+
+	return( 1 );
+}
+
+/* Adds a record to the count of an event identifier
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_add_event_identifier(
+     record_statistics_t *record_statistics,
+     uint32_t event_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "record_statistics_add_event_identifier";
+	uint32_t entry_index  = 0;
+	uint32_t entry_mask   = 0;
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table is kept at most half full so that probe sequences remain short
+	 */
+	if( ( record_statistics->number_of_event_identifiers + 1 ) > ( record_statistics->event_identifiers_size / 2 ) )
+	{
+		if( record_statistics_grow_event_identifiers(
+		     record_statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to grow event identifiers hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry_mask  = (uint32_t) record_statistics->event_identifiers_size - 1;
+	entry_index = ( event_identifier * (uint32_t) 0x9e3779b1UL ) & entry_mask;
+
+	while( ( record_statistics->event_identifiers[ entry_index ].number_of_records != 0 )
+	    && ( record_statistics->event_identifiers[ entry_index ].event_identifier != event_identifier ) )
+	{
+		entry_index = ( entry_index + 1 ) & entry_mask;
+	}
+	if( record_statistics->event_identifiers[ entry_index ].number_of_records == 0 )
+	{
+		record_statistics->event_identifiers[ entry_index ].event_identifier = event_identifier;
+
+		record_statistics->number_of_event_identifiers += 1;
+	}
+	record_statistics->event_identifiers[ entry_index ].number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Adds a record to the count of a provider identifier
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_add_provider_identifier(
+     record_statistics_t *record_statistics,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libcerror_error_t **error )
+{
+	static char *function = "record_statistics_add_provider_identifier";
+	uint32_t entry_index  = 0;
+	uint32_t entry_mask   = 0;
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_statistics->number_of_providers + 1 ) > ( record_statistics->providers_size / 2 ) )
+	{
+		if( record_statistics_grow_providers(
+		     record_statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to grow providers hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry_mask  = (uint32_t) record_statistics->providers_size - 1;
+	entry_index = record_statistics_hash_provider_identifier(
+	               provider_identifier ) & entry_mask;
+
+	while( ( record_statistics->providers[ entry_index ].number_of_records != 0 )
+	    && ( memory_compare(
+	          record_statistics->providers[ entry_index ].provider_identifier,
+	          provider_identifier,
+	          RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE ) != 0 ) )
+	{
+		entry_index = ( entry_index + 1 ) & entry_mask;
+	}
+	if( record_statistics->providers[ entry_index ].number_of_records == 0 )
+	{
+		if( memory_copy(
+		     record_statistics->providers[ entry_index ].provider_identifier,
+		     provider_identifier,
+		     RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier.",
+			 function );
+
+			return( -1 );
+		}
+		record_statistics->number_of_providers += 1;
+	}
+	record_statistics->providers[ entry_index ].number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Adds a record to the statistics
+ * Only values that are available from the System element are used,
+ * so that the XML document of the record does not need to be decoded
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_add_record(
+     record_statistics_t *record_statistics,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE ];
+
+	static char *function           = "record_statistics_add_record";
+	size_t provider_identifier_size = 0;
+	uint64_t written_time           = 0;
+	off64_t record_offset           = 0;
+	int64_t chunk_index             = 0;
+	uint32_t event_identifier       = 0;
+	uint32_t record_size            = 0;
+	uint8_t event_level             = 0;
+	int result                      = 0;
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_statistics->is_sorted != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record statistics - hash tables already sorted.",
+		 function );
+
+		return( -1 );
+	}
+	/* A record without an EventID or Level element is counted separately
+	 */
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_free(
+		 error );
+
+		record_statistics->number_of_records_without_event_identifier += 1;
+	}
+	else if( record_statistics_add_event_identifier(
+	          record_statistics,
+	          event_identifier,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add event identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_event_level(
+	     record,
+	     &event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_free(
+		 error );
+
+		record_statistics->number_of_records_without_event_level += 1;
+	}
+	else
+	{
+		record_statistics->event_level_counts[ event_level ] += 1;
+	}
+	result = libevtx_record_get_utf8_provider_identifier_size(
+	          record,
+	          &provider_identifier_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( provider_identifier_size != RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE ) )
+	{
+		record_statistics->number_of_records_without_provider_identifier += 1;
+	}
+	else
+	{
+		if( libevtx_record_get_utf8_provider_identifier(
+		     record,
+		     provider_identifier,
+		     RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider identifier.",
+			 function );
+
+			return( -1 );
+		}
+		if( record_statistics_add_provider_identifier(
+		     record_statistics,
+		     provider_identifier,
+		     RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add provider identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The written time, offset and size are read from the event record header
+	 */
+	if( libevtx_record_get_written_time(
+	     record,
+	     &written_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		return( -1 );
+	}
+	record_statistics->hour_counts[ ( written_time / RECORD_STATISTICS_INTERVALS_PER_HOUR ) % 24 ] += 1;
+
+	if( libevtx_record_get_offset(
+	     record,
+	     &record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_size(
+	     record,
+	     &record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset >= RECORD_STATISTICS_FILE_HEADER_SIZE )
+	{
+		/* The records are passed in order, hence a chunk is counted when its first record is added
+		 */
+		chunk_index = ( (int64_t) record_offset - RECORD_STATISTICS_FILE_HEADER_SIZE ) / RECORD_STATISTICS_CHUNK_SIZE;
+
+		if( chunk_index != record_statistics->last_chunk_index )
+		{
+			record_statistics->number_of_chunks += 1;
+			record_statistics->last_chunk_index  = chunk_index;
+		}
+	}
+	record_statistics->records_size      += record_size;
+	record_statistics->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Prints the record statistics to a stream
+ * The hash tables are sorted by the number of records, hence no records
+ * can be added after the statistics are printed
+ * Returns 1 if successful or -1 on error
+ */
+int record_statistics_fprint(
+     record_statistics_t *record_statistics,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	const char *event_level_name = NULL;
+	static char *function        = "record_statistics_fprint";
+	uint64_t chunk_data_size     = 0;
+	uint64_t fill_ratio          = 0;
+	int entry_index              = 0;
+	int event_level              = 0;
+	int hour                     = 0;
+
+	if( record_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* The used entries sort before the unused entries since these have
+	 * no records, hence the first entries of the hash tables contain the values
+	 */
+	if( record_statistics->is_sorted == 0 )
+	{
+		qsort(
+		 record_statistics->event_identifiers,
+		 (size_t) record_statistics->event_identifiers_size,
+		 sizeof( record_statistics_event_identifier_t ),
+		 &record_statistics_event_identifier_compare );
+
+		qsort(
+		 record_statistics->providers,
+		 (size_t) record_statistics->providers_size,
+		 sizeof( record_statistics_provider_t ),
+		 &record_statistics_provider_compare );
+
+		record_statistics->is_sorted = 1;
+	}
+	fprintf(
+	 stream,
+	 "Record statistics:\n" );
+
+	/* The counts of a sample are scaled to estimates of the counts of all chunks
+	 */
+	if( record_statistics->chunk_sampler != NULL )
+	{
+		fprintf(
+		 stream,
+		 "\tEstimated from a sample of\t: %d of %d chunks\n",
+		 record_statistics->chunk_sampler->number_of_sampled_chunks,
+		 record_statistics->chunk_sampler->number_of_chunks );
+	}
+
+	fprintf(
+	 stream,
+	 "\tNumber of records\t\t: %" PRIu64 "\n",
+	 chunk_sampler_scale_count(
+	  record_statistics->chunk_sampler,
+	  record_statistics->number_of_records ) );
+
+	fprintf(
+	 stream,
+	 "\tNumber of chunks with records\t: %" PRIu64 "\n",
+	 chunk_sampler_scale_count(
+	  record_statistics->chunk_sampler,
+	  record_statistics->number_of_chunks ) );
+
+	if( record_statistics->number_of_chunks > 0 )
+	{
+		chunk_data_size = record_statistics->number_of_chunks
+		                * ( RECORD_STATISTICS_CHUNK_SIZE - RECORD_STATISTICS_CHUNK_HEADER_SIZE );
+
+		fill_ratio = ( record_statistics->records_size * 1000 ) / chunk_data_size;
+
+		fprintf(
+		 stream,
+		 "\tChunk fill ratio\t\t: %" PRIu64 ".%" PRIu64 "%%\n",
+		 fill_ratio / 10,
+		 fill_ratio % 10 );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "Records per event identifier:\n" );
+
+	for( entry_index = 0;
+	     entry_index < record_statistics->number_of_event_identifiers;
+	     entry_index++ )
+	{
+		fprintf(
+		 stream,
+		 "\t%" PRIu32 "\t\t\t\t: %" PRIu64 "\n",
+		 record_statistics->event_identifiers[ entry_index ].event_identifier,
+		 chunk_sampler_scale_count(
+		  record_statistics->chunk_sampler,
+		  record_statistics->event_identifiers[ entry_index ].number_of_records ) );
+	}
+	if( record_statistics->number_of_records_without_event_identifier > 0 )
+	{
+		fprintf(
+		 stream,
+		 "\t(None)\t\t\t\t: %" PRIu64 "\n",
+		 chunk_sampler_scale_count(
+		  record_statistics->chunk_sampler,
+		  record_statistics->number_of_records_without_event_identifier ) );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "Records per provider identifier:\n" );
+
+	for( entry_index = 0;
+	     entry_index < record_statistics->number_of_providers;
+	     entry_index++ )
+	{
+		fprintf(
+		 stream,
+		 "\t%s\t: %" PRIu64 "\n",
+		 (char *) record_statistics->providers[ entry_index ].provider_identifier,
+		 chunk_sampler_scale_count(
+		  record_statistics->chunk_sampler,
+		  record_statistics->providers[ entry_index ].number_of_records ) );
+	}
+	if( record_statistics->number_of_records_without_provider_identifier > 0 )
+	{
+		fprintf(
+		 stream,
+		 "\t(None)\t\t\t\t\t: %" PRIu64 "\n",
+		 chunk_sampler_scale_count(
+		  record_statistics->chunk_sampler,
+		  record_statistics->number_of_records_without_provider_identifier ) );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "Records per event level:\n" );
+
+	for( event_level = 0;
+	     event_level < 256;
+	     event_level++ )
+	{
+		if( record_statistics->event_level_counts[ event_level ] == 0 )
+		{
+			continue;
+		}
+		switch( event_level )
+		{
+			case LIBEVTX_EVENT_LEVEL_CRITICAL:
+				event_level_name = "Critical";
+				break;
+
+			case LIBEVTX_EVENT_LEVEL_ERROR:
+				event_level_name = "Error";
+				break;
+
+			case LIBEVTX_EVENT_LEVEL_WARNING:
+				event_level_name = "Warning";
+				break;
+
+			case 0:
+			case LIBEVTX_EVENT_LEVEL_INFORMATION:
+				event_level_name = "Information";
+				break;
+
+			case LIBEVTX_EVENT_LEVEL_VERBOSE:
+				event_level_name = "Verbose";
+				break;
+
+			default:
+				event_level_name = "(Unknown)";
+				break;
+		}
+		fprintf(
+		 stream,
+		 "\t%s (%d)\t\t\t: %" PRIu64 "\n",
+		 event_level_name,
+		 event_level,
+		 chunk_sampler_scale_count(
+		  record_statistics->chunk_sampler,
+		  record_statistics->event_level_counts[ event_level ] ) );
+	}
+	if( record_statistics->number_of_records_without_event_level > 0 )
+	{
+		fprintf(
+		 stream,
+		 "\t(None)\t\t\t\t: %" PRIu64 "\n",
+		 chunk_sampler_scale_count(
+		  record_statistics->chunk_sampler,
+		  record_statistics->number_of_records_without_event_level ) );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "Records per hour of the day (UTC):\n" );
+
+	for( hour = 0;
+	     hour < 24;
+	     hour++ )
+	{
+		fprintf(
+		 stream,
+		 "\t%02d:00 - %02d:59\t\t\t: %" PRIu64 "\n",
+		 hour,
+		 hour,
+		 chunk_sampler_scale_count(
+		  record_statistics->chunk_sampler,
+		  record_statistics->hour_counts[ hour ] ) );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -0,0 +1,210 @@
+/*
+ * Record statistics
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_STATISTICS_H )
+#define _RECORD_STATISTICS_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "chunk_sampler.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a provider identifier string formatted as:
+ * {XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX} including the end of string character
+ */
+#define RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE	39
+
+/* The initial number of entries of a counter table
+ * The number of entries must be a power of 2
+ */
+#define RECORD_STATISTICS_INITIAL_NUMBER_OF_ENTRIES		256
+
+/* The chunk layout used to determine the chunk fill ratio
+ */
+#define RECORD_STATISTICS_FILE_HEADER_SIZE			4096
+#define RECORD_STATISTICS_CHUNK_SIZE				65536
+#define RECORD_STATISTICS_CHUNK_HEADER_SIZE			512
+
+typedef struct record_statistics_event_identifier record_statistics_event_identifier_t;
+
+struct record_statistics_event_identifier
+{
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The number of records
+	 * Contains 0 if the entry is not used
+	 */
+	uint64_t number_of_records;
+};
+
+typedef struct record_statistics_provider record_statistics_provider_t;
+
+struct record_statistics_provider
+{
+	/* The UTF-8 encoded provider identifier string
+	 */
+	uint8_t provider_identifier[ RECORD_STATISTICS_PROVIDER_IDENTIFIER_STRING_SIZE ];
+
+	/* The number of records
+	 * Contains 0 if the entry is not used
+	 */
+	uint64_t number_of_records;
+};
+
+typedef struct record_statistics record_statistics_t;
+
+/* The record statistics are gathered in a single pass over the records
+ * The event identifiers and providers are counted in open addressing hash tables
+ */
+struct record_statistics
+{
+	/* The number of records
+	 */
+	uint64_t number_of_records;
+
+	/* The number of records per event level
+	 */
+	uint64_t event_level_counts[ 256 ];
+
+	/* The number of records without an event level
+	 */
+	uint64_t number_of_records_without_event_level;
+
+	/* The number of records per hour of the day (UTC) of the written time
+	 */
+	uint64_t hour_counts[ 24 ];
+
+	/* The event identifiers hash table
+	 */
+	record_statistics_event_identifier_t *event_identifiers;
+
+	/* The number of entries of the event identifiers hash table
+	 */
+	int event_identifiers_size;
+
+	/* The number of event identifiers
+	 */
+	int number_of_event_identifiers;
+
+	/* The number of records without an event identifier
+	 */
+	uint64_t number_of_records_without_event_identifier;
+
+	/* The providers hash table
+	 */
+	record_statistics_provider_t *providers;
+
+	/* The number of entries of the providers hash table
+	 */
+	int providers_size;
+
+	/* The number of providers
+	 */
+	int number_of_providers;
+
+	/* The number of records without a provider identifier
+	 */
+	uint64_t number_of_records_without_provider_identifier;
+
+	/* The number of chunks that contain records
+	 */
+	uint64_t number_of_chunks;
+
+	/* The index of the chunk of the last record
+	 */
+	int64_t last_chunk_index;
+
+	/* The total size of the records
+	 */
+	uint64_t records_size;
+
+	/* The chunk sampler of the sampled chunks the records were read from
+	 * The counts are scaled to estimates of the counts of all chunks when printed
+	 * Contains NULL if the records of all chunks were read
+	 */
+	chunk_sampler_t *chunk_sampler;
+
+	/* Value to indicate the hash tables were sorted for printing
+	 * Records cannot be added once the hash tables are sorted
+	 */
+	uint8_t is_sorted;
+};
+
+int record_statistics_initialize(
+     record_statistics_t **record_statistics,
+     libcerror_error_t **error );
+
+int record_statistics_free(
+     record_statistics_t **record_statistics,
+     libcerror_error_t **error );
+
+int record_statistics_event_identifier_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int record_statistics_provider_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int record_statistics_grow_event_identifiers(
+     record_statistics_t *record_statistics,
+     libcerror_error_t **error );
+
+int record_statistics_grow_providers(
+     record_statistics_t *record_statistics,
+     libcerror_error_t **error );
+
+int record_statistics_add_event_identifier(
+     record_statistics_t *record_statistics,
+     uint32_t event_identifier,
+     libcerror_error_t **error );
+
+int record_statistics_add_provider_identifier(
+     record_statistics_t *record_statistics,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libcerror_error_t **error );
+
+int record_statistics_add_record(
+     record_statistics_t *record_statistics,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+int record_statistics_fprint(
+     record_statistics_t *record_statistics,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_STATISTICS_H ) */
+
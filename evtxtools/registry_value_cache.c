@@ -0,0 +1,740 @@
+/*
+ * Registry value cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#elif !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#include <ctype.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "registry_value_cache.h"
+
+/* Creates a registry value cache
+ * Make sure the value registry_value_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_initialize(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "registry_value_cache_initialize";
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *registry_value_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid registry value cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*registry_value_cache = memory_allocate_structure(
+	                         registry_value_cache_t );
+
+	if( *registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create registry value cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *registry_value_cache,
+	     0,
+	     sizeof( registry_value_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear registry value cache.",
+		 function );
+
+		memory_free(
+		 *registry_value_cache );
+
+		*registry_value_cache = NULL;
+
+		return( -1 );
+	}
+	if( registry_value_cache_resize_buckets(
+	     *registry_value_cache,
+	     REGISTRY_VALUE_CACHE_INITIAL_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *registry_value_cache != NULL )
+	{
+		memory_free(
+		 *registry_value_cache );
+
+		*registry_value_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a registry value cache
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_free(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "registry_value_cache_free";
+	int result            = 1;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *registry_value_cache != NULL )
+	{
+		if( registry_value_cache_empty(
+		     *registry_value_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty registry value cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *registry_value_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *registry_value_cache )->buckets );
+		}
+		memory_free(
+		 *registry_value_cache );
+
+		*registry_value_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a registry value cache
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_empty(
+     registry_value_cache_t *registry_value_cache,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "registry_value_cache_empty";
+	int bucket_index                          = 0;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < registry_value_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( registry_value_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = registry_value_cache->buckets[ bucket_index ];
+
+			registry_value_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			/* The key name and value name are stored in a single allocation
+			 */
+			if( cache_entry->key_name != NULL )
+			{
+				memory_free(
+				 cache_entry->key_name );
+			}
+			if( cache_entry->value_string != NULL )
+			{
+				memory_free(
+				 cache_entry->value_string );
+			}
+			memory_free(
+			 cache_entry );
+		}
+	}
+	registry_value_cache->number_of_entries = 0;
+
+	return( 1 );
+}
+
+/* Case folds a character
+ * Returns the case folded character
+ */
+system_character_t registry_value_cache_fold_character(
+                    system_character_t character )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	return( (system_character_t) towlower( (wint_t) character ) );
+#else
+	return( (system_character_t) tolower( (int) (unsigned char) character ) );
+#endif
+}
+
+/* Calculates the hash of a key type, case folded key name and case folded value name
+ * Returns the 32-bit hash
+ */
+uint32_t registry_value_cache_get_hash(
+          uint32_t key_type,
+          const system_character_t *key_name,
+          size_t key_name_length,
+          const system_character_t *value_name,
+          size_t value_name_length )
+{
+	size_t string_index = 0;
+	uint32_t hash       = 0x811c9dc5UL;
+
+	/* The 32-bit FNV-1a hash of the key type, the case folded key name, a separator
+	 * and the case folded value name, since Windows Registry names are case insensitive
+	 */
+	hash ^= key_type;
+	hash *= 0x01000193UL;
+
+	for( string_index = 0;
+	     string_index < key_name_length;
+	     string_index++ )
+	{
+		hash ^= (uint32_t) registry_value_cache_fold_character(
+		                    key_name[ string_index ] );
+		hash *= 0x01000193UL;
+	}
+	hash *= 0x01000193UL;
+
+	for( string_index = 0;
+	     string_index < value_name_length;
+	     string_index++ )
+	{
+		hash ^= (uint32_t) registry_value_cache_fold_character(
+		                    value_name[ string_index ] );
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Resizes the hash table buckets
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_resize_buckets(
+     registry_value_cache_t *registry_value_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t **buckets    = NULL;
+	registry_value_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "registry_value_cache_resize_buckets";
+	int bucket_index                          = 0;
+	int new_bucket_index                      = 0;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) SSIZE_MAX / sizeof( registry_value_cache_entry_t * ) ) )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (registry_value_cache_entry_t **) memory_allocate(
+	                                             sizeof( registry_value_cache_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( new_bucket_index = 0;
+	     new_bucket_index < number_of_buckets;
+	     new_bucket_index++ )
+	{
+		buckets[ new_bucket_index ] = NULL;
+	}
+	for( bucket_index = 0;
+	     bucket_index < registry_value_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( registry_value_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = registry_value_cache->buckets[ bucket_index ];
+
+			registry_value_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			new_bucket_index = (int) ( cache_entry->hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+			cache_entry->next_bucket_entry = buckets[ new_bucket_index ];
+			buckets[ new_bucket_index ]    = cache_entry;
+		}
+	}
+	if( registry_value_cache->buckets != NULL )
+	{
+		memory_free(
+		 registry_value_cache->buckets );
+	}
+	registry_value_cache->buckets           = buckets;
+	registry_value_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a value by key type, key name and value name ignoring case
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int registry_value_cache_get_entry(
+     registry_value_cache_t *registry_value_cache,
+     uint32_t key_type,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     registry_value_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "registry_value_cache_get_entry";
+	size_t name_index                         = 0;
+	uint32_t hash                             = 0;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = NULL;
+
+	hash = registry_value_cache_get_hash(
+	        key_type,
+	        key_name,
+	        key_name_length,
+	        value_name,
+	        value_name_length );
+
+	cache_entry = registry_value_cache->buckets[ hash & (uint32_t) ( registry_value_cache->number_of_buckets - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->hash == hash )
+		 && ( cache_entry->key_type == key_type )
+		 && ( cache_entry->key_name_length == key_name_length )
+		 && ( cache_entry->value_name_length == value_name_length ) )
+		{
+			for( name_index = 0;
+			     name_index < key_name_length;
+			     name_index++ )
+			{
+				if( registry_value_cache_fold_character(
+				     cache_entry->key_name[ name_index ] ) != registry_value_cache_fold_character(
+				                                               key_name[ name_index ] ) )
+				{
+					break;
+				}
+			}
+			if( name_index == key_name_length )
+			{
+				for( name_index = 0;
+				     name_index < value_name_length;
+				     name_index++ )
+				{
+					if( registry_value_cache_fold_character(
+					     cache_entry->value_name[ name_index ] ) != registry_value_cache_fold_character(
+					                                                 value_name[ name_index ] ) )
+					{
+						break;
+					}
+				}
+				if( name_index == value_name_length )
+				{
+					*entry = cache_entry;
+
+					return( 1 );
+				}
+			}
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Appends a value to the cache
+ * The key name, value name and value string are copied. A value string of NULL
+ * marks the value as not available
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_append_value(
+     registry_value_cache_t *registry_value_cache,
+     uint32_t key_type,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t *value_string,
+     size_t value_string_size,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "registry_value_cache_append_value";
+	int bucket_index                          = 0;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_name_length > (size_t) ( SSIZE_MAX / 2 ) )
+	 || ( value_name_length > (size_t) ( SSIZE_MAX / 2 ) )
+	 || ( ( key_name_length + value_name_length ) > (size_t) ( ( SSIZE_MAX / sizeof( system_character_t ) ) - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key name and value name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_string != NULL )
+	 && ( ( value_string_size == 0 )
+	  ||  ( value_string_size > (size_t) ( SSIZE_MAX / sizeof( system_character_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( registry_value_cache->number_of_entries >= registry_value_cache->number_of_buckets )
+	{
+		if( registry_value_cache_resize_buckets(
+		     registry_value_cache,
+		     registry_value_cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	cache_entry = memory_allocate_structure(
+	               registry_value_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     cache_entry,
+	     0,
+	     sizeof( registry_value_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		memory_free(
+		 cache_entry );
+
+		return( -1 );
+	}
+	/* The key name and value name are stored in a single allocation
+	 */
+	cache_entry->key_name = system_string_allocate(
+	                         key_name_length + value_name_length + 2 );
+
+	if( cache_entry->key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key name.",
+		 function );
+
+		goto on_error;
+	}
+	cache_entry->value_name = &( cache_entry->key_name[ key_name_length + 1 ] );
+
+	if( key_name_length > 0 )
+	{
+		if( system_string_copy(
+		     cache_entry->key_name,
+		     key_name,
+		     key_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy key name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	cache_entry->key_name[ key_name_length ] = 0;
+
+	if( value_name_length > 0 )
+	{
+		if( system_string_copy(
+		     cache_entry->value_name,
+		     value_name,
+		     value_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	cache_entry->value_name[ value_name_length ] = 0;
+
+	if( value_string != NULL )
+	{
+		cache_entry->value_string = system_string_allocate(
+		                             value_string_size );
+
+		if( cache_entry->value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     cache_entry->value_string,
+		     value_string,
+		     value_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value string.",
+			 function );
+
+			goto on_error;
+		}
+		cache_entry->value_string[ value_string_size - 1 ] = 0;
+
+		cache_entry->value_string_size = value_string_size;
+	}
+	cache_entry->key_type          = key_type;
+	cache_entry->key_name_length   = key_name_length;
+	cache_entry->value_name_length = value_name_length;
+	cache_entry->hash              = registry_value_cache_get_hash(
+	                                  key_type,
+	                                  key_name,
+	                                  key_name_length,
+	                                  value_name,
+	                                  value_name_length );
+
+	bucket_index = (int) ( cache_entry->hash & (uint32_t) ( registry_value_cache->number_of_buckets - 1 ) );
+
+	cache_entry->next_bucket_entry = registry_value_cache->buckets[ bucket_index ];
+
+	registry_value_cache->buckets[ bucket_index ] = cache_entry;
+
+	registry_value_cache->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		if( cache_entry->value_string != NULL )
+		{
+			memory_free(
+			 cache_entry->value_string );
+		}
+		if( cache_entry->key_name != NULL )
+		{
+			memory_free(
+			 cache_entry->key_name );
+		}
+		memory_free(
+		 cache_entry );
+	}
+	return( -1 );
+}
+
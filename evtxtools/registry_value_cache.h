@@ -0,0 +1,150 @@
+/*
+ * Registry value cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _REGISTRY_VALUE_CACHE_H )
+#define _REGISTRY_VALUE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of hash table buckets, must be a power of 2
+ */
+#define REGISTRY_VALUE_CACHE_INITIAL_NUMBER_OF_BUCKETS	64
+
+typedef struct registry_value_cache_entry registry_value_cache_entry_t;
+
+struct registry_value_cache_entry
+{
+	/* The key type
+	 */
+	uint32_t key_type;
+
+	/* The key name, such as the event source or provider identifier
+	 */
+	system_character_t *key_name;
+
+	/* The key name length
+	 */
+	size_t key_name_length;
+
+	/* The value name
+	 */
+	system_character_t *value_name;
+
+	/* The value name length
+	 */
+	size_t value_name_length;
+
+	/* The value string
+	 * Contains NULL if the value is not available
+	 */
+	system_character_t *value_string;
+
+	/* The value string size
+	 */
+	size_t value_string_size;
+
+	/* The hash of the key type, case folded key name and value name
+	 */
+	uint32_t hash;
+
+	/* The next entry in the same hash table bucket
+	 */
+	registry_value_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct registry_value_cache registry_value_cache_t;
+
+struct registry_value_cache
+{
+	/* The hash table buckets
+	 */
+	registry_value_cache_entry_t **buckets;
+
+	/* The number of hash table buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int registry_value_cache_initialize(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error );
+
+int registry_value_cache_free(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error );
+
+int registry_value_cache_empty(
+     registry_value_cache_t *registry_value_cache,
+     libcerror_error_t **error );
+
+system_character_t registry_value_cache_fold_character(
+                    system_character_t character );
+
+uint32_t registry_value_cache_get_hash(
+          uint32_t key_type,
+          const system_character_t *key_name,
+          size_t key_name_length,
+          const system_character_t *value_name,
+          size_t value_name_length );
+
+int registry_value_cache_resize_buckets(
+     registry_value_cache_t *registry_value_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int registry_value_cache_get_entry(
+     registry_value_cache_t *registry_value_cache,
+     uint32_t key_type,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     registry_value_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int registry_value_cache_append_value(
+     registry_value_cache_t *registry_value_cache,
+     uint32_t key_type,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t *value_string,
+     size_t value_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _REGISTRY_VALUE_CACHE_H ) */
+
@@ -20,29 +20,93 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
 #include <wide_string.h>
 
-#if defined( TIME_WITH_SYS_TIME )
-#include <sys/time.h>
-#include <time.h>
-#elif defined( HAVE_SYS_TIME_H )
-#include <sys/time.h>
-#else
-#include <time.h>
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
 #endif
 
 #include "evtxtools_libbfio.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libexe.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libwrc.h"
+#include "evtxtools_probes.h"
 #include "message_string.h"
+#include "message_string_cache.h"
 #include "resource_file.h"
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define HAVE_RESOURCE_FILE_MEMORY_MAPPED_FILE
+#endif
+
+/* Frees a reference to memory mapped file data
+ * The file data is unmapped when the last reference is freed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_mapped_data_free(
+     resource_file_mapped_data_t **mapped_data,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_mapped_data_free";
+	int result            = 1;
+
+	if( mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_data != NULL )
+	{
+		( *mapped_data )->number_of_references -= 1;
+
+		if( ( *mapped_data )->number_of_references <= 0 )
+		{
+#if defined( HAVE_RESOURCE_FILE_MEMORY_MAPPED_FILE )
+			if( munmap(
+			     ( *mapped_data )->data,
+			     ( *mapped_data )->data_size ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to unmap file.",
+				 function );
+
+				result = -1;
+			}
+#endif
+			memory_free(
+			 *mapped_data );
+		}
+		*mapped_data = NULL;
+	}
+	return( result );
+}
+
 /* Creates a resource file
  * Make sure the value resource_file is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -135,9 +199,9 @@ int resource_file_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( message_string_cache_initialize(
 	     &( ( *resource_file )->message_string_cache ),
-	     16,
+	     MESSAGE_STRING_CACHE_DEFAULT_MAXIMUM_CACHED_SIZE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -215,7 +279,7 @@ int resource_file_free(
 				result = -1;
 			}
 		}
-		if( libfcache_cache_free(
+		if( message_string_cache_free(
 		     &( ( *resource_file )->message_string_cache ),
 		     error ) != 1 )
 		{
@@ -267,16 +331,22 @@ int resource_file_free(
 	return( result );
 }
 
-/* Opens the resource file
- * Returns 1 if successful or -1 on error
+/* Memory maps the resource file
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
  */
-int resource_file_open(
+int resource_file_open_memory_mapped(
      resource_file_t *resource_file,
      const system_character_t *filename,
      libcerror_error_t **error )
 {
-	static char *function    = "resource_file_open";
-	uint32_t virtual_address = 0;
+#if defined( HAVE_RESOURCE_FILE_MEMORY_MAPPED_FILE )
+	struct stat file_statistics;
+
+	void *mapped_data     = NULL;
+	size_t mapped_size    = 0;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "resource_file_open_memory_mapped";
 
 	if( resource_file == NULL )
 	{
@@ -289,30 +359,127 @@ int resource_file_open(
 
 		return( -1 );
 	}
-	if( resource_file->is_open != 0 )
+	if( resource_file->mapped_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid resource file already open.",
+		 "%s: invalid resource file - mapped data value already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libexe_file_open_wide(
-	     resource_file->exe_file,
-	     filename,
-	     LIBEXE_OPEN_READ,
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_RESOURCE_FILE_MEMORY_MAPPED_FILE )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	/* Only regular files are mapped, other files are read by libexe
+	 */
+	if( ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	mapped_size = (size_t) file_statistics.st_size;
+
+	mapped_data = mmap(
+	               NULL,
+	               mapped_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		return( 0 );
+	}
+	resource_file->mapped_data = memory_allocate_structure(
+	                              resource_file_mapped_data_t );
+
+	if( resource_file->mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped data.",
+		 function );
+
+		goto on_error;
+	}
+	resource_file->mapped_data->data                 = (uint8_t *) mapped_data;
+	resource_file->mapped_data->data_size            = mapped_size;
+	resource_file->mapped_data->number_of_references = 1;
+
+	if( libbfio_memory_range_initialize(
+	     &( resource_file->file_io_handle ),
 	     error ) != 1 )
-#else
-	if( libexe_file_open(
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     resource_file->file_io_handle,
+	     (uint8_t *) mapped_data,
+	     mapped_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_file_open_file_io_handle(
 	     resource_file->exe_file,
-	     filename,
+	     resource_file->file_io_handle,
 	     LIBEXE_OPEN_READ,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
@@ -323,12 +490,167 @@ int resource_file_open(
 
 		goto on_error;
 	}
-	if( libexe_file_get_section_by_name(
-	     resource_file->exe_file,
-	     ".rsrc",
-	     5,
-	     &( resource_file->resource_section ),
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( resource_file->file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( resource_file->file_io_handle ),
+		 NULL );
+	}
+	if( resource_file->mapped_data != NULL )
+	{
+		memory_free(
+		 resource_file->mapped_data );
+
+		resource_file->mapped_data = NULL;
+	}
+	munmap(
+	 mapped_data,
+	 mapped_size );
+
+	return( -1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Opens the resource file
+ * Only the EXE file headers are read, the resource section is opened on first use
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_open(
+     resource_file_t *resource_file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_open";
+	int result            = 0;
+
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file already open.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_open_memory_mapped(
+	          resource_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open memory mapped EXE file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libexe_file_open_wide(
+		     resource_file->exe_file,
+		     filename,
+		     LIBEXE_OPEN_READ,
+		     error ) != 1 )
+#else
+		if( libexe_file_open(
+		     resource_file->exe_file,
+		     filename,
+		     LIBEXE_OPEN_READ,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open EXE file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	resource_file->missing_resources = 0;
+	resource_file->is_open           = 1;
+
+	EVTXTOOLS_PROBE_RESOURCE_FILE_OPEN(
+	 filename,
+	 result );
+
+	return( 1 );
+}
+
+/* Opens the resource stream of the resource (.rsrc) section if not already open
+ * Returns 1 if successful, 0 if the file has no resource section or -1 on error
+ */
+int resource_file_open_resource_stream(
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	static char *function    = "resource_file_open_resource_stream";
+	uint32_t virtual_address = 0;
+	int result               = 0;
+
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->resource_stream_is_open != 0 )
+	{
+		return( 1 );
+	}
+	if( ( resource_file->missing_resources & RESOURCE_FILE_RESOURCE_SECTION ) != 0 )
+	{
+		return( 0 );
+	}
+	result = libexe_file_get_section_by_name(
+	          resource_file->exe_file,
+	          ".rsrc",
+	          5,
+	          &( resource_file->resource_section ),
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -339,6 +661,12 @@ int resource_file_open(
 
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		resource_file->missing_resources |= RESOURCE_FILE_RESOURCE_SECTION;
+
+		return( 0 );
+	}
 	if( libexe_section_get_virtual_address(
 	     resource_file->resource_section,
 	     &virtual_address,
@@ -396,7 +724,7 @@ int resource_file_open(
 
 		goto on_error;
 	}
-	resource_file->is_open = 1;
+	resource_file->resource_stream_is_open = 1;
 
 	return( 1 );
 
@@ -413,10 +741,6 @@ on_error:
 		 &( resource_file->resource_section ),
 		 NULL );
 	}
-	libexe_file_close(
-	 resource_file->exe_file,
-	 NULL );
-
 	return( -1 );
 }
 
@@ -443,7 +767,7 @@ int resource_file_close(
 	}
 	if( resource_file->is_open != 0 )
 	{
-		if( libfcache_cache_empty(
+		if( message_string_cache_empty(
 		     resource_file->message_string_cache,
 		     error ) != 1 )
 		{
@@ -504,18 +828,22 @@ int resource_file_close(
 				result = -1;
 			}
 		}
-		if( libwrc_stream_close(
-		     resource_file->resource_stream,
-		     error ) != 0 )
+		if( resource_file->resource_stream_is_open != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close resource stream.",
-			 function );
+			if( libwrc_stream_close(
+			     resource_file->resource_stream,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close resource stream.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
+			resource_file->resource_stream_is_open = 0;
 		}
 		if( resource_file->resource_section_file_io_handle != NULL )
 		{
@@ -562,14 +890,48 @@ int resource_file_close(
 
 			result = -1;
 		}
-		resource_file->is_open = 0;
-	}
-	return( result );
-}
-
-/* Retrieves an available language identifier from the resource
- * This function will look for the preferred languague identifier otherwise default to the first
- * Returns 1 if successful or -1 on error
+		if( resource_file->file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( resource_file->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The file data remains mapped while template definitions reference it
+		 */
+		if( resource_file_mapped_data_free(
+		     &( resource_file->mapped_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped data.",
+			 function );
+
+			result = -1;
+		}
+		resource_file->mapped_wevt_template_data      = NULL;
+		resource_file->mapped_wevt_template_data_size = 0;
+		resource_file->missing_resources = 0;
+		resource_file->is_open           = 0;
+	}
+	return( result );
+}
+
+/* Retrieves an available language identifier from the resource
+ * This function will look for the preferred languague identifier otherwise default to the first
+ * Returns 1 if successful or -1 on error
  */
 int resource_file_get_resource_available_languague_identifier(
      resource_file_t *resource_file,
@@ -774,6 +1136,7 @@ on_error:
 }
 
 /* Retrieves a message string from the cache
+ * A cached message string without a string indicates the message string is not available
  * Returns 1 if successful, 0 if not available or -1 error
  */
 int resource_file_get_message_string_from_cache(
@@ -782,10 +1145,8 @@ int resource_file_get_message_string_from_cache(
      message_string_t **message_string,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "resource_file_get_message_string_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	static char *function = "resource_file_get_message_string_from_cache";
+	int result            = 0;
 
 	if( resource_file == NULL )
 	{
@@ -809,55 +1170,23 @@ int resource_file_get_message_string_from_cache(
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     resource_file->message_string_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) message_string,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message string from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( ( *message_string != NULL )
-		 && ( message_string_identifier == ( *message_string )->identifier ) )
-		{
-			result = 1;
+	result = message_string_cache_get_message_string_by_identifier(
+	          resource_file->message_string_cache,
+	          message_string_identifier,
+	          message_string,
+	          error );
 
-			break;
-		}
-	}
-	if( result == 0 )
+	if( result == -1 )
 	{
-		*message_string = NULL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string: 0x%08" PRIx32 " from cache.",
+		 function,
+		 message_string_identifier );
+
+		return( -1 );
 	}
 	return( result );
 }
@@ -873,7 +1202,6 @@ int resource_file_get_message_string(
 {
 	static char *function        = "resource_file_get_message_string";
 	uint32_t language_identifier = 0;
-	time_t timestamp             = 0;
 	int result                   = 0;
 
 	if( resource_file == NULL )
@@ -900,25 +1228,49 @@ int resource_file_get_message_string(
 	}
 	if( resource_file->message_table_resource == NULL )
 	{
-		result = libwrc_stream_get_resource_by_type(
-		          resource_file->resource_stream,
-		          LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE,
-		          &( resource_file->message_table_resource ),
+		if( ( resource_file->missing_resources & RESOURCE_FILE_RESOURCE_MESSAGE_TABLE ) != 0 )
+		{
+			return( 0 );
+		}
+		result = resource_file_open_resource_stream(
+		          resource_file,
 		          error );
 
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message table resource.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open resource stream.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		else if( result != 0 )
+		{
+			result = libwrc_stream_get_resource_by_type(
+			          resource_file->resource_stream,
+			          LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE,
+			          &( resource_file->message_table_resource ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message table resource.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
 		{
+			resource_file->missing_resources |= RESOURCE_FILE_RESOURCE_MESSAGE_TABLE;
+
 			return( 0 );
 		}
 	}
@@ -939,129 +1291,103 @@ int resource_file_get_message_string(
 
 		return( -1 );
 	}
-	else if( result == 0 )
+	else if( result != 0 )
 	{
-		if( resource_file_get_resource_available_languague_identifier(
-		     resource_file,
-		     resource_file->message_table_resource,
-		     &language_identifier,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve an available language identifier.",
-			 function );
-
-			return( -1 );
-		}
-		*message_string = NULL;
+		EVTXTOOLS_PROBE_MESSAGE_CACHE_HIT(
+		 message_string_identifier );
 
-		if( message_string_initialize(
-		     message_string,
-		     message_string_identifier,
-		     error ) != 1 )
+		/* The message string was looked up before but is not available
+		 */
+		if( ( *message_string )->string == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create message string.",
-			 function );
+			*message_string = NULL;
 
-			return( -1 );
+			result = 0;
 		}
-		result = message_string_get_from_message_table_resource(
-		          *message_string,
-		          resource_file->message_table_resource,
-		          language_identifier,
-		          error );
+		return( result );
+	}
+	if( resource_file_get_resource_available_languague_identifier(
+	     resource_file,
+	     resource_file->message_table_resource,
+	     &language_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve an available language identifier.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
-			 function,
-			 message_string_identifier );
+		return( -1 );
+	}
+	*message_string = NULL;
 
-			message_string_free(
-			 message_string,
-			 NULL );
+	if( message_string_initialize(
+	     message_string,
+	     message_string_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message string.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			if( libfcache_date_time_get_timestamp(
-			     &timestamp,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache timestamp.",
-				 function );
+		return( -1 );
+	}
+	result = message_string_get_from_message_table_resource(
+	          *message_string,
+	          resource_file->message_table_resource,
+	          language_identifier,
+	          error );
 
-				message_string_free(
-				 message_string,
-				 NULL );
+	EVTXTOOLS_PROBE_MESSAGE_LOOKUP(
+	 message_string_identifier,
+	 language_identifier,
+	 result );
 
-				return( -1 );
-			}
-			if( libfcache_cache_set_value_by_index(
-			     resource_file->message_string_cache,
-			     resource_file->next_message_string_cache_index,
-			     0,
-			     resource_file->next_message_string_cache_index,
-			     timestamp,
-			     (intptr_t *) *message_string,
-			     (int (*)(intptr_t **, libcerror_error_t **)) &message_string_free,
-			     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set message string in cache entry: %d.",
-				 function,
-				 resource_file->next_message_string_cache_index );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+		 function,
+		 message_string_identifier );
 
-				message_string_free(
-				 message_string,
-				 NULL );
+		message_string_free(
+		 message_string,
+		 NULL );
 
-				return( -1 );
-			}
-			resource_file->next_message_string_cache_index++;
+		return( -1 );
+	}
+	/* A message string that is not available is cached as well
+	 * so that the message table is searched only once per identifier
+	 * The cache manages the message string from here on, also on error
+	 */
+	if( message_string_cache_append_message_string(
+	     resource_file->message_string_cache,
+	     *message_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append message string: 0x%08" PRIx32 " to cache.",
+		 function,
+		 message_string_identifier );
 
-			if( resource_file->next_message_string_cache_index == 16 )
-			{
-				resource_file->next_message_string_cache_index = 0;
-			}
-			message_string = NULL;
-		}
-		if( message_string != NULL )
-		{
-			if( message_string_free(
-			     message_string,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free message string.",
-				 function );
+		*message_string = NULL;
 
-				return( -1 );
-			}
-		}
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		*message_string = NULL;
 	}
 	return( result );
 }
@@ -1091,26 +1417,50 @@ int resource_file_get_mui_file_type(
 	}
 	if( resource_file->mui_resource == NULL )
 	{
-		result = libwrc_stream_get_resource_by_utf8_name(
-		          resource_file->resource_stream,
-		          (uint8_t *) "MUI",
-		          3,
-		          &( resource_file->mui_resource ),
+		if( ( resource_file->missing_resources & RESOURCE_FILE_RESOURCE_MUI ) != 0 )
+		{
+			return( 0 );
+		}
+		result = resource_file_open_resource_stream(
+		          resource_file,
 		          error );
 
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve MUI resource.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open resource stream.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		else if( result != 0 )
 		{
+			result = libwrc_stream_get_resource_by_utf8_name(
+			          resource_file->resource_stream,
+			          (uint8_t *) "MUI",
+			          3,
+			          &( resource_file->mui_resource ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve MUI resource.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
+		{
+			resource_file->missing_resources |= RESOURCE_FILE_RESOURCE_MUI;
+
 			return( 0 );
 		}
 	}
@@ -1174,26 +1524,50 @@ int resource_file_get_provider(
 	}
 	if( resource_file->wevt_template_resource == NULL )
 	{
-		result = libwrc_stream_get_resource_by_utf8_name(
-		          resource_file->resource_stream,
-		          (uint8_t *) "WEVT_TEMPLATE",
-		          13,
-		          &( resource_file->wevt_template_resource ),
+		if( ( resource_file->missing_resources & RESOURCE_FILE_RESOURCE_WEVT_TEMPLATE ) != 0 )
+		{
+			return( 0 );
+		}
+		result = resource_file_open_resource_stream(
+		          resource_file,
 		          error );
 
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve WEVT_TEMPLATE resource.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open resource stream.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		else if( result != 0 )
 		{
+			result = libwrc_stream_get_resource_by_utf8_name(
+			          resource_file->resource_stream,
+			          (uint8_t *) "WEVT_TEMPLATE",
+			          13,
+			          &( resource_file->wevt_template_resource ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve WEVT_TEMPLATE resource.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
+		{
+			resource_file->missing_resources |= RESOURCE_FILE_RESOURCE_WEVT_TEMPLATE;
+
 			return( 0 );
 		}
 	}
@@ -1535,3 +1909,432 @@ on_error:
 	return( -1 );
 }
 
+
+/* Retrieves an entry of a resource directory in the memory mapped resource (.rsrc) section data
+ * The entry is matched by name if set, otherwise by identifier, where an identifier
+ * of 0xffffffff matches the first entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_get_mapped_resource_directory_entry(
+     const uint8_t *section_data,
+     size_t section_data_size,
+     uint32_t directory_offset,
+     const char *name,
+     size_t name_length,
+     uint32_t identifier,
+     uint32_t *entry_value,
+     libcerror_error_t **error )
+{
+	static char *function                 = "resource_file_get_mapped_resource_directory_entry";
+	size_t entry_offset                   = 0;
+	size_t name_index                     = 0;
+	size_t name_offset                    = 0;
+	uint32_t entry_identifier             = 0;
+	uint16_t entry_name_length            = 0;
+	uint16_t number_of_identifier_entries = 0;
+	uint16_t number_of_named_entries      = 0;
+	int entry_index                       = 0;
+	int number_of_entries                 = 0;
+
+	if( section_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_data_size < 16 )
+	 || ( (size_t) directory_offset > ( section_data_size - 16 ) ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( section_data[ directory_offset + 12 ] ),
+	 number_of_named_entries );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( section_data[ directory_offset + 14 ] ),
+	 number_of_identifier_entries );
+
+	number_of_entries = (int) number_of_named_entries + (int) number_of_identifier_entries;
+	entry_offset      = (size_t) directory_offset + 16;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entry_offset > ( section_data_size - 8 ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( section_data[ entry_offset ] ),
+		 entry_identifier );
+
+		if( name != NULL )
+		{
+			/* A named entry contains the offset of the name relative to the start of the section
+			 */
+			if( ( entry_identifier & 0x80000000UL ) != 0 )
+			{
+				name_offset = (size_t) ( entry_identifier & 0x7fffffffUL );
+
+				if( name_offset > ( section_data_size - 2 ) )
+				{
+					return( 0 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( section_data[ name_offset ] ),
+				 entry_name_length );
+
+				name_offset += 2;
+
+				if( ( (size_t) entry_name_length == name_length )
+				 && ( name_length <= ( ( section_data_size - name_offset ) / 2 ) ) )
+				{
+					/* The name is stored as UTF-16 little-endian
+					 */
+					for( name_index = 0;
+					     name_index < name_length;
+					     name_index++ )
+					{
+						if( ( section_data[ name_offset + ( name_index * 2 ) ] != (uint8_t) name[ name_index ] )
+						 || ( section_data[ name_offset + ( name_index * 2 ) + 1 ] != 0 ) )
+						{
+							break;
+						}
+					}
+					if( name_index == name_length )
+					{
+						break;
+					}
+				}
+			}
+		}
+		else if( ( identifier == 0xffffffffUL )
+		      || ( entry_identifier == identifier ) )
+		{
+			break;
+		}
+		entry_offset += 8;
+	}
+	if( entry_index >= number_of_entries )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( section_data[ entry_offset + 4 ] ),
+	 *entry_value );
+
+	return( 1 );
+}
+
+/* Retrieves the WEVT_TEMPLATE resource data from the memory mapped file data
+ * The resource is located using the section table and the resource directory in the mapped
+ * file data, in the language the WEVT_TEMPLATE resource was read with by libwrc.
+ * On success a reference to the mapped data is added, that must be freed with
+ * resource_file_mapped_data_free
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_get_mapped_wevt_template_data(
+     resource_file_t *resource_file,
+     const uint8_t **wevt_template_data,
+     size_t *wevt_template_data_size,
+     resource_file_mapped_data_t **mapped_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *data              = NULL;
+	const uint8_t *section_data      = NULL;
+	static char *function            = "resource_file_get_mapped_wevt_template_data";
+	size_t data_size                 = 0;
+	size_t section_offset            = 0;
+	uint32_t coff_header_offset      = 0;
+	uint32_t entry_value             = 0;
+	uint32_t language_identifier     = 0;
+	uint32_t resource_data_offset    = 0;
+	uint32_t resource_data_size      = 0;
+	uint32_t section_data_offset     = 0;
+	uint32_t section_data_size       = 0;
+	uint32_t section_virtual_address = 0;
+	uint16_t number_of_sections      = 0;
+	uint16_t optional_header_size    = 0;
+	uint16_t section_index           = 0;
+	int result                       = 0;
+
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( wevt_template_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid WEVT_TEMPLATE data.",
+		 function );
+
+		return( -1 );
+	}
+	if( wevt_template_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid WEVT_TEMPLATE data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_file->mapped_data == NULL )
+	 || ( resource_file->wevt_template_resource == NULL ) )
+	{
+		return( 0 );
+	}
+	if( resource_file->mapped_wevt_template_data == NULL )
+	{
+		if( ( resource_file->missing_resources & RESOURCE_FILE_RESOURCE_MAPPED_WEVT_TEMPLATE ) != 0 )
+		{
+			return( 0 );
+		}
+		/* The resource is marked missing until it has been located
+		 */
+		resource_file->missing_resources |= RESOURCE_FILE_RESOURCE_MAPPED_WEVT_TEMPLATE;
+
+		if( resource_file_get_resource_available_languague_identifier(
+		     resource_file,
+		     resource_file->wevt_template_resource,
+		     &language_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve an available language identifier.",
+			 function );
+
+			return( -1 );
+		}
+		data      = resource_file->mapped_data->data;
+		data_size = resource_file->mapped_data->data_size;
+
+		if( ( data_size < 64 )
+		 || ( data[ 0 ] != (uint8_t) 'M' )
+		 || ( data[ 1 ] != (uint8_t) 'Z' ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 0x3c ] ),
+		 coff_header_offset );
+
+		if( (size_t) coff_header_offset > ( data_size - 24 ) )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     &( data[ coff_header_offset ] ),
+		     "PE\0\0",
+		     4 ) != 0 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ coff_header_offset + 6 ] ),
+		 number_of_sections );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ coff_header_offset + 20 ] ),
+		 optional_header_size );
+
+		section_offset = (size_t) coff_header_offset + 24 + optional_header_size;
+
+		for( section_index = 0;
+		     section_index < number_of_sections;
+		     section_index++ )
+		{
+			if( section_offset > ( data_size - 40 ) )
+			{
+				return( 0 );
+			}
+			if( memory_compare(
+			     &( data[ section_offset ] ),
+			     ".rsrc\0",
+			     6 ) == 0 )
+			{
+				break;
+			}
+			section_offset += 40;
+		}
+		if( section_index >= number_of_sections )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ section_offset + 12 ] ),
+		 section_virtual_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ section_offset + 16 ] ),
+		 section_data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ section_offset + 20 ] ),
+		 section_data_offset );
+
+		if( (size_t) section_data_offset >= data_size )
+		{
+			return( 0 );
+		}
+		if( (size_t) section_data_size > ( data_size - section_data_offset ) )
+		{
+			section_data_size = (uint32_t) ( data_size - section_data_offset );
+		}
+		section_data = &( data[ section_data_offset ] );
+
+		/* The resource directory contains the type, the name and the language levels
+		 */
+		result = resource_file_get_mapped_resource_directory_entry(
+		          section_data,
+		          (size_t) section_data_size,
+		          0,
+		          "WEVT_TEMPLATE",
+		          13,
+		          0,
+		          &entry_value,
+		          error );
+
+		if( ( result == 1 )
+		 && ( ( entry_value & 0x80000000UL ) != 0 ) )
+		{
+			result = resource_file_get_mapped_resource_directory_entry(
+			          section_data,
+			          (size_t) section_data_size,
+			          entry_value & 0x7fffffffUL,
+			          NULL,
+			          0,
+			          0xffffffffUL,
+			          &entry_value,
+			          error );
+		}
+		if( ( result == 1 )
+		 && ( ( entry_value & 0x80000000UL ) != 0 ) )
+		{
+			result = resource_file_get_mapped_resource_directory_entry(
+			          section_data,
+			          (size_t) section_data_size,
+			          entry_value & 0x7fffffffUL,
+			          NULL,
+			          0,
+			          language_identifier,
+			          &entry_value,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve WEVT_TEMPLATE resource directory entry.",
+			 function );
+
+			return( -1 );
+		}
+		/* The language level entry contains the offset of the resource data descriptor
+		 */
+		if( ( result != 1 )
+		 || ( ( entry_value & 0x80000000UL ) != 0 )
+		 || ( section_data_size < 16 )
+		 || ( entry_value > ( section_data_size - 16 ) ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( section_data[ entry_value ] ),
+		 resource_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( section_data[ entry_value + 4 ] ),
+		 resource_data_size );
+
+		/* The resource data descriptor contains a virtual address
+		 */
+		if( resource_data_offset < section_virtual_address )
+		{
+			return( 0 );
+		}
+		resource_data_offset -= section_virtual_address;
+
+		if( ( resource_data_offset >= section_data_size )
+		 || ( resource_data_size > ( section_data_size - resource_data_offset ) )
+		 || ( resource_data_size < 16 ) )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     &( section_data[ resource_data_offset ] ),
+		     "CRIM",
+		     4 ) != 0 )
+		{
+			return( 0 );
+		}
+		resource_file->mapped_wevt_template_data      = &( section_data[ resource_data_offset ] );
+		resource_file->mapped_wevt_template_data_size = (size_t) resource_data_size;
+		resource_file->missing_resources             &= ~( RESOURCE_FILE_RESOURCE_MAPPED_WEVT_TEMPLATE );
+	}
+	*wevt_template_data      = resource_file->mapped_wevt_template_data;
+	*wevt_template_data_size = resource_file->mapped_wevt_template_data_size;
+
+	resource_file->mapped_data->number_of_references += 1;
+
+	*mapped_data = resource_file->mapped_data;
+
+	return( 1 );
+}
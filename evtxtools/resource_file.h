@@ -28,14 +28,44 @@
 #include "evtxtools_libbfio.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libexe.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libwrc.h"
 #include "message_string.h"
+#include "message_string_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The resource file missing resource flags
+ */
+enum RESOURCE_FILE_RESOURCE_FLAGS
+{
+	RESOURCE_FILE_RESOURCE_SECTION		= 0x01,
+	RESOURCE_FILE_RESOURCE_MESSAGE_TABLE	= 0x02,
+	RESOURCE_FILE_RESOURCE_MUI		= 0x04,
+	RESOURCE_FILE_RESOURCE_WEVT_TEMPLATE	= 0x08,
+	RESOURCE_FILE_RESOURCE_MAPPED_WEVT_TEMPLATE	= 0x10
+};
+
+typedef struct resource_file_mapped_data resource_file_mapped_data_t;
+
+struct resource_file_mapped_data
+{
+	/* The memory mapped file data
+	 */
+	uint8_t *data;
+
+	/* The memory mapped file data size
+	 */
+	size_t data_size;
+
+	/* The number of references
+	 * The resource file holds a reference and so does every template definition
+	 * that references the WEVT_TEMPLATE resource data
+	 */
+	int number_of_references;
+};
+
 typedef struct resource_file resource_file_t;
 
 struct resource_file
@@ -48,6 +78,22 @@ struct resource_file
 	 */
 	size_t name_size;
 
+	/* The file IO handle of the memory mapped file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The memory mapped file data
+	 */
+	resource_file_mapped_data_t *mapped_data;
+
+	/* The WEVT_TEMPLATE resource data in the memory mapped file data
+	 */
+	const uint8_t *mapped_wevt_template_data;
+
+	/* The WEVT_TEMPLATE resource data size
+	 */
+	size_t mapped_wevt_template_data_size;
+
 	/* The libexe file
 	 */
 	libexe_file_t *exe_file;
@@ -64,6 +110,10 @@ struct resource_file
 	 */
 	libwrc_stream_t *resource_stream;
 
+	/* Value to indicate if the resource stream is open
+	 */
+	int resource_stream_is_open;
+
 	/* The preferred language identifier
 	 */
 	uint32_t preferred_language_identifier;
@@ -80,19 +130,23 @@ struct resource_file
 	 */
 	libwrc_resource_t *wevt_template_resource;
 
-	/* The message string cache
+	/* The resources that were found to be missing
 	 */
-	libfcache_cache_t *message_string_cache;
+	uint8_t missing_resources;
 
-	/* The next available message string cache index
+	/* The message string cache
 	 */
-	int next_message_string_cache_index;
+	message_string_cache_t *message_string_cache;
 
 	/* Value to indicate if the message file is open
 	 */
 	int is_open;
 };
 
+int resource_file_mapped_data_free(
+     resource_file_mapped_data_t **mapped_data,
+     libcerror_error_t **error );
+
 int resource_file_initialize(
      resource_file_t **resource_file,
      uint32_t preferred_language_identifier,
@@ -102,11 +156,20 @@ int resource_file_free(
      resource_file_t **resource_file,
      libcerror_error_t **error );
 
+int resource_file_open_memory_mapped(
+     resource_file_t *resource_file,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int resource_file_open(
      resource_file_t *resource_file,
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int resource_file_open_resource_stream(
+     resource_file_t *resource_file,
+     libcerror_error_t **error );
+
 int resource_file_close(
      resource_file_t *resource_file,
      libcerror_error_t **error );
@@ -174,6 +237,23 @@ int resource_file_get_event_message_identifier(
      uint32_t *message_identifier,
      libcerror_error_t **error );
 
+int resource_file_get_mapped_resource_directory_entry(
+     const uint8_t *section_data,
+     size_t section_data_size,
+     uint32_t directory_offset,
+     const char *name,
+     size_t name_length,
+     uint32_t identifier,
+     uint32_t *entry_value,
+     libcerror_error_t **error );
+
+int resource_file_get_mapped_wevt_template_data(
+     resource_file_t *resource_file,
+     const uint8_t **wevt_template_data,
+     size_t *wevt_template_data_size,
+     resource_file_mapped_data_t **mapped_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1104 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_string_no_case.h"
+#include "resource_file.h"
+#include "resource_file_cache.h"
+
+/* Creates a resource file cache
+ * Make sure the value resource_file_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_initialize";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file_cache = memory_allocate_structure(
+	                        resource_file_cache_t );
+
+	if( *resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *resource_file_cache,
+	     0,
+	     sizeof( resource_file_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	( *resource_file_cache )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *resource_file_cache != NULL )
+	{
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a resource file cache
+ * The cached resource files are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_free";
+	int result            = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		if( resource_file_cache_empty(
+		     *resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty resource file cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a resource file cache
+ * The cached resource files and resource file paths are freed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_path_entry_t *path_entry = NULL;
+	static char *function                        = "resource_file_cache_empty";
+	int bucket_index                             = 0;
+	int result                                   = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( resource_file_cache->least_recently_used_entry != NULL )
+	{
+		if( resource_file_cache_remove_least_recently_used_entry(
+		     resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( bucket_index = 0;
+	     bucket_index < RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		while( resource_file_cache->path_buckets[ bucket_index ] != NULL )
+		{
+			path_entry = resource_file_cache->path_buckets[ bucket_index ];
+
+			resource_file_cache->path_buckets[ bucket_index ] = path_entry->next_bucket_entry;
+
+			if( path_entry->path != NULL )
+			{
+				memory_free(
+				 path_entry->path );
+			}
+			memory_free(
+			 path_entry->name );
+
+			memory_free(
+			 path_entry );
+		}
+	}
+	resource_file_cache->number_of_path_entries = 0;
+
+	return( result );
+}
+
+/* Sets the maximum number of entries
+ * The least recently used entries are removed if the cache contains more entries
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_set_maximum_number_of_entries(
+     resource_file_cache_t *resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_set_maximum_number_of_entries";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	while( resource_file_cache->number_of_entries > maximum_number_of_entries )
+	{
+		if( resource_file_cache_remove_least_recently_used_entry(
+		     resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	resource_file_cache->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a resource file name
+ * The name is normalized by ignoring the case of ASCII characters and
+ * by treating / and \ as the same path segment separator
+ * Returns the 32-bit FNV-1a hash of the normalized name
+ */
+uint32_t resource_file_cache_get_name_hash(
+          const system_character_t *name,
+          size_t name_length )
+{
+	size_t name_index        = 0;
+	uint32_t character_value = 0;
+	uint32_t name_hash       = 0x811c9dc5UL;
+
+	if( name == NULL )
+	{
+		return( 0 );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		character_value = (uint32_t) name[ name_index ];
+
+		if( ( character_value >= (uint32_t) 'A' )
+		 && ( character_value <= (uint32_t) 'Z' ) )
+		{
+			character_value += (uint32_t) 'a' - (uint32_t) 'A';
+		}
+		else if( character_value == (uint32_t) '/' )
+		{
+			character_value = (uint32_t) '\\';
+		}
+		name_hash ^= character_value;
+		name_hash *= 0x01000193UL;
+	}
+	return( name_hash );
+}
+
+/* Compares two resource file names
+ * The names are normalized in the same way as resource_file_cache_get_name_hash
+ * Returns 1 if the names are equal or 0 if not
+ */
+int resource_file_cache_compare_name(
+     const system_character_t *first_name,
+     const system_character_t *second_name,
+     size_t name_length )
+{
+	return( evtxtools_string_no_case_compare(
+	         first_name,
+	         second_name,
+	         name_length,
+	         EVTXTOOLS_STRING_NO_CASE_FLAG_ASCII_ONLY | EVTXTOOLS_STRING_NO_CASE_FLAG_PATH_SEPARATORS ) );
+}
+
+/* Retrieves a resource file by its name
+ * The resource file becomes the most recently used entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_cache_get_resource_file_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "resource_file_cache_get_resource_file_by_name";
+	uint32_t name_hash                       = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file = NULL;
+
+	name_hash = resource_file_cache_get_name_hash(
+	             name,
+	             name_length );
+
+	cache_entry = resource_file_cache->buckets[ name_hash & ( RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->name_hash == name_hash )
+		 && ( cache_entry->resource_file->name_size == ( name_length + 1 ) )
+		 && ( resource_file_cache_compare_name(
+		       cache_entry->resource_file->name,
+		       name,
+		       name_length ) == 1 ) )
+		{
+			break;
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	if( cache_entry == NULL )
+	{
+		return( 0 );
+	}
+	if( cache_entry != resource_file_cache->most_recently_used_entry )
+	{
+		/* Unlink the entry from the used list
+		 */
+		cache_entry->previous_used_entry->next_used_entry = cache_entry->next_used_entry;
+
+		if( cache_entry->next_used_entry != NULL )
+		{
+			cache_entry->next_used_entry->previous_used_entry = cache_entry->previous_used_entry;
+		}
+		else
+		{
+			resource_file_cache->least_recently_used_entry = cache_entry->previous_used_entry;
+		}
+		/* Prepend the entry to the used list
+		 */
+		cache_entry->previous_used_entry = NULL;
+		cache_entry->next_used_entry     = resource_file_cache->most_recently_used_entry;
+
+		resource_file_cache->most_recently_used_entry->previous_used_entry = cache_entry;
+		resource_file_cache->most_recently_used_entry                      = cache_entry;
+	}
+	*resource_file = cache_entry->resource_file;
+
+	return( 1 );
+}
+
+/* Appends a resource file to the cache
+ * The cache takes over management of the resource file, also on error
+ * The least recently used entry is removed if the cache is full
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_append_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "resource_file_cache_append_resource_file";
+	int bucket_index                         = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file - missing name.",
+		 function );
+
+		goto on_error;
+	}
+	while( resource_file_cache->number_of_entries >= resource_file_cache->maximum_number_of_entries )
+	{
+		if( resource_file_cache_remove_least_recently_used_entry(
+		     resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	cache_entry = memory_allocate_structure(
+	               resource_file_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	cache_entry->resource_file = resource_file;
+	cache_entry->name_hash     = resource_file_cache_get_name_hash(
+	                              resource_file->name,
+	                              resource_file->name_size - 1 );
+
+	bucket_index = (int) ( cache_entry->name_hash & ( RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS - 1 ) );
+
+	cache_entry->next_bucket_entry               = resource_file_cache->buckets[ bucket_index ];
+	resource_file_cache->buckets[ bucket_index ] = cache_entry;
+
+	cache_entry->previous_used_entry = NULL;
+	cache_entry->next_used_entry     = resource_file_cache->most_recently_used_entry;
+
+	if( resource_file_cache->most_recently_used_entry != NULL )
+	{
+		resource_file_cache->most_recently_used_entry->previous_used_entry = cache_entry;
+	}
+	else
+	{
+		resource_file_cache->least_recently_used_entry = cache_entry;
+	}
+	resource_file_cache->most_recently_used_entry = cache_entry;
+
+	resource_file_cache->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	resource_file_free(
+	 &resource_file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Removes the least recently used entry and frees its resource file
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_remove_least_recently_used_entry(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t **bucket_entry = NULL;
+	resource_file_cache_entry_t *cache_entry   = NULL;
+	static char *function                      = "resource_file_cache_remove_least_recently_used_entry";
+	int result                                 = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry = resource_file_cache->least_recently_used_entry;
+
+	if( cache_entry == NULL )
+	{
+		return( 1 );
+	}
+	bucket_entry = &( resource_file_cache->buckets[ cache_entry->name_hash & ( RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS - 1 ) ] );
+
+	while( *bucket_entry != cache_entry )
+	{
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	*bucket_entry = cache_entry->next_bucket_entry;
+
+	resource_file_cache->least_recently_used_entry = cache_entry->previous_used_entry;
+
+	if( cache_entry->previous_used_entry != NULL )
+	{
+		cache_entry->previous_used_entry->next_used_entry = NULL;
+	}
+	else
+	{
+		resource_file_cache->most_recently_used_entry = NULL;
+	}
+	resource_file_cache->number_of_entries -= 1;
+
+	if( resource_file_free(
+	     &( cache_entry->resource_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource file.",
+		 function );
+
+		result = -1;
+	}
+	memory_free(
+	 cache_entry );
+
+	return( result );
+}
+
+/* Retrieves the path entry of a resource file by its name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_cache_get_path_entry_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_cache_path_entry_t **path_entry,
+     libcerror_error_t **error )
+{
+	resource_file_cache_path_entry_t *safe_path_entry = NULL;
+	static char *function                             = "resource_file_cache_get_path_entry_by_name";
+	uint32_t name_hash                                = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path entry.",
+		 function );
+
+		return( -1 );
+	}
+	*path_entry = NULL;
+
+	if( resource_file_cache->number_of_path_entries == 0 )
+	{
+		return( 0 );
+	}
+	name_hash = resource_file_cache_get_name_hash(
+	             name,
+	             name_length );
+
+	safe_path_entry = resource_file_cache->path_buckets[ name_hash & ( RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS - 1 ) ];
+
+	while( safe_path_entry != NULL )
+	{
+		if( ( safe_path_entry->name_hash == name_hash )
+		 && ( safe_path_entry->name_size == ( name_length + 1 ) )
+		 && ( resource_file_cache_compare_name(
+		       safe_path_entry->name,
+		       name,
+		       name_length ) == 1 ) )
+		{
+			*path_entry = safe_path_entry;
+
+			return( 1 );
+		}
+		safe_path_entry = safe_path_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Retrieves the cause of a missing resource file by its name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_cache_get_missing_cause_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     int *cause,
+     libcerror_error_t **error )
+{
+	resource_file_cache_path_entry_t *path_entry = NULL;
+	static char *function                        = "resource_file_cache_get_missing_cause_by_name";
+	int result                                   = 0;
+
+	if( cause == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cause.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_cache_get_path_entry_by_name(
+	          resource_file_cache,
+	          name,
+	          name_length,
+	          &path_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( path_entry->path != NULL ) )
+	{
+		return( 0 );
+	}
+	*cause = path_entry->cause;
+
+	return( 1 );
+}
+
+/* Retrieves the path of a resource file by its name
+ * The path is managed by the cache
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_cache_get_path_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t **path,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	resource_file_cache_path_entry_t *path_entry = NULL;
+	static char *function                        = "resource_file_cache_get_path_by_name";
+	int result                                   = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_cache_get_path_entry_by_name(
+	          resource_file_cache,
+	          name,
+	          name_length,
+	          &path_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( path_entry->path == NULL ) )
+	{
+		return( 0 );
+	}
+	*path      = path_entry->path;
+	*path_size = path_entry->path_size;
+
+	return( 1 );
+}
+
+/* Appends a path entry of a resource file to the cache
+ * A NULL path marks the resource file as missing
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_append_path_entry(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *path,
+     size_t path_length,
+     int cause,
+     libcerror_error_t **error )
+{
+	resource_file_cache_path_entry_t *path_entry = NULL;
+	static char *function                        = "resource_file_cache_append_path_entry";
+	int bucket_index                             = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path != NULL )
+	{
+		if( ( path_length == 0 )
+		 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid path length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( cause != RESOURCE_FILE_CACHE_MISSING_CAUSE_NOT_FOUND )
+	      && ( cause != RESOURCE_FILE_CACHE_MISSING_CAUSE_OPEN_FAILED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cause.",
+		 function );
+
+		return( -1 );
+	}
+	path_entry = memory_allocate_structure(
+	              resource_file_cache_path_entry_t );
+
+	if( path_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     path_entry,
+	     0,
+	     sizeof( resource_file_cache_path_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path entry.",
+		 function );
+
+		memory_free(
+		 path_entry );
+
+		return( -1 );
+	}
+	path_entry->name_size = name_length + 1;
+
+	path_entry->name = system_string_allocate(
+	                    path_entry->name_size );
+
+	if( path_entry->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     path_entry->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	path_entry->name[ name_length ] = 0;
+
+	if( path != NULL )
+	{
+		path_entry->path_size = path_length + 1;
+
+		path_entry->path = system_string_allocate(
+		                    path_entry->path_size );
+
+		if( path_entry->path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     path_entry->path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			goto on_error;
+		}
+		path_entry->path[ path_length ] = 0;
+	}
+	else
+	{
+		path_entry->cause = cause;
+	}
+	path_entry->name_hash = resource_file_cache_get_name_hash(
+	                         name,
+	                         name_length );
+
+	bucket_index = (int) ( path_entry->name_hash & ( RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS - 1 ) );
+
+	path_entry->next_bucket_entry                     = resource_file_cache->path_buckets[ bucket_index ];
+	resource_file_cache->path_buckets[ bucket_index ] = path_entry;
+
+	resource_file_cache->number_of_path_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( path_entry != NULL )
+	{
+		if( path_entry->path != NULL )
+		{
+			memory_free(
+			 path_entry->path );
+		}
+		if( path_entry->name != NULL )
+		{
+			memory_free(
+			 path_entry->name );
+		}
+		memory_free(
+		 path_entry );
+	}
+	return( -1 );
+}
+
+/* Appends the name of a missing resource file to the cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_append_missing_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     int cause,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_append_missing_name";
+
+	if( resource_file_cache_append_path_entry(
+	     resource_file_cache,
+	     name,
+	     name_length,
+	     NULL,
+	     0,
+	     cause,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the path of a resource file to the cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_append_path(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_append_path";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_append_path_entry(
+	     resource_file_cache,
+	     name,
+	     name_length,
+	     path,
+	     path_length,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
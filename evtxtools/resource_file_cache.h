@@ -0,0 +1,239 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RESOURCE_FILE_CACHE_H )
+#define _RESOURCE_FILE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "resource_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of hash table buckets, must be a power of 2
+ */
+#define RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS		256
+
+/* The default maximum number of cached resource files
+ */
+#define RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES	64
+
+/* The causes of a resource file being missing
+ */
+enum RESOURCE_FILE_CACHE_MISSING_CAUSES
+{
+	RESOURCE_FILE_CACHE_MISSING_CAUSE_NOT_FOUND	= 1,
+	RESOURCE_FILE_CACHE_MISSING_CAUSE_OPEN_FAILED	= 2
+};
+
+typedef struct resource_file_cache_entry resource_file_cache_entry_t;
+
+struct resource_file_cache_entry
+{
+	/* The resource file
+	 */
+	resource_file_t *resource_file;
+
+	/* The hash of the normalized resource file name
+	 */
+	uint32_t name_hash;
+
+	/* The next entry in the same hash table bucket
+	 */
+	resource_file_cache_entry_t *next_bucket_entry;
+
+	/* The previous (more recently used) entry
+	 */
+	resource_file_cache_entry_t *previous_used_entry;
+
+	/* The next (less recently used) entry
+	 */
+	resource_file_cache_entry_t *next_used_entry;
+};
+
+typedef struct resource_file_cache_path_entry resource_file_cache_path_entry_t;
+
+struct resource_file_cache_path_entry
+{
+	/* The resource file name
+	 */
+	system_character_t *name;
+
+	/* The resource file name size
+	 */
+	size_t name_size;
+
+	/* The hash of the normalized resource file name
+	 */
+	uint32_t name_hash;
+
+	/* The resource file path
+	 * Contains NULL if the resource file is missing
+	 */
+	system_character_t *path;
+
+	/* The resource file path size
+	 */
+	size_t path_size;
+
+	/* The cause of the resource file being missing
+	 */
+	int cause;
+
+	/* The next entry in the same hash table bucket
+	 */
+	resource_file_cache_path_entry_t *next_bucket_entry;
+};
+
+typedef struct resource_file_cache resource_file_cache_t;
+
+struct resource_file_cache
+{
+	/* The hash table buckets
+	 */
+	resource_file_cache_entry_t *buckets[ RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used entry
+	 */
+	resource_file_cache_entry_t *most_recently_used_entry;
+
+	/* The least recently used entry
+	 */
+	resource_file_cache_entry_t *least_recently_used_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The hash table buckets of the resource file paths, including missing resource files
+	 * The paths are not limited by the maximum number of entries
+	 * so that the resource files path is searched at most once for every name
+	 */
+	resource_file_cache_path_entry_t *path_buckets[ RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The number of path entries
+	 */
+	int number_of_path_entries;
+};
+
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_set_maximum_number_of_entries(
+     resource_file_cache_t *resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+uint32_t resource_file_cache_get_name_hash(
+          const system_character_t *name,
+          size_t name_length );
+
+int resource_file_cache_compare_name(
+     const system_character_t *first_name,
+     const system_character_t *second_name,
+     size_t name_length );
+
+int resource_file_cache_get_resource_file_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
+int resource_file_cache_append_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_t *resource_file,
+     libcerror_error_t **error );
+
+int resource_file_cache_remove_least_recently_used_entry(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_path_entry_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_cache_path_entry_t **path_entry,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_missing_cause_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     int *cause,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_path_by_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t **path,
+     size_t *path_size,
+     libcerror_error_t **error );
+
+int resource_file_cache_append_path_entry(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *path,
+     size_t path_length,
+     int cause,
+     libcerror_error_t **error );
+
+int resource_file_cache_append_missing_name(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     int cause,
+     libcerror_error_t **error );
+
+int resource_file_cache_append_path(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RESOURCE_FILE_CACHE_H ) */
+
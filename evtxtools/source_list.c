@@ -0,0 +1,811 @@
+/*
+ * Source list
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtxtools_libcdirectory.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libcpath.h"
+#include "source_list.h"
+
+/* Creates a source list
+ * Make sure the value source_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_initialize(
+     source_list_t **source_list,
+     libcerror_error_t **error )
+{
+	static char *function = "source_list_initialize";
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*source_list = memory_allocate_structure(
+	                source_list_t );
+
+	if( *source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *source_list,
+	     0,
+	     sizeof( source_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear source list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *source_list != NULL )
+	{
+		memory_free(
+		 *source_list );
+
+		*source_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a source list
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_free(
+     source_list_t **source_list,
+     libcerror_error_t **error )
+{
+	static char *function = "source_list_free";
+	int filename_index    = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_list != NULL )
+	{
+		if( ( *source_list )->filenames != NULL )
+		{
+			for( filename_index = 0;
+			     filename_index < ( *source_list )->number_of_filenames;
+			     filename_index++ )
+			{
+				memory_free(
+				 ( *source_list )->filenames[ filename_index ] );
+			}
+			memory_free(
+			 ( *source_list )->filenames );
+		}
+		memory_free(
+		 *source_list );
+
+		*source_list = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a copy of a filename to the source list
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_append_filename(
+     source_list_t *source_list,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	system_character_t **reallocation = NULL;
+	system_character_t *safe_filename = NULL;
+	static char *function             = "source_list_append_filename";
+	int number_of_allocated_filenames = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_list->number_of_filenames >= source_list->number_of_allocated_filenames )
+	{
+		if( source_list->number_of_allocated_filenames > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid source list - number of filenames value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_filenames = source_list->number_of_allocated_filenames * 2;
+
+		if( number_of_allocated_filenames == 0 )
+		{
+			number_of_allocated_filenames = 64;
+		}
+		reallocation = (system_character_t **) memory_reallocate(
+		                                        source_list->filenames,
+		                                        sizeof( system_character_t * ) * number_of_allocated_filenames );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize filenames.",
+			 function );
+
+			return( -1 );
+		}
+		source_list->filenames                     = reallocation;
+		source_list->number_of_allocated_filenames = number_of_allocated_filenames;
+	}
+	safe_filename = system_string_allocate(
+	                 filename_length + 1 );
+
+	if( safe_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     safe_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 safe_filename );
+
+		return( -1 );
+	}
+	safe_filename[ filename_length ] = 0;
+
+	source_list->filenames[ source_list->number_of_filenames ] = safe_filename;
+
+	source_list->number_of_filenames += 1;
+
+	return( 1 );
+}
+
+/* Compares two filenames
+ * Used to sort the filenames of a directory
+ * Returns -1 if the first filename sorts before the second, 1 if after or 0 if equal
+ */
+int source_list_filename_compare(
+     const void *first_filename,
+     const void *second_filename )
+{
+	const system_character_t *first_string  = *( (system_character_t * const *) first_filename );
+	const system_character_t *second_string = *( (system_character_t * const *) second_filename );
+	size_t first_string_length              = 0;
+	size_t second_string_length             = 0;
+	int result                              = 0;
+
+	first_string_length = system_string_length(
+	                       first_string );
+
+	second_string_length = system_string_length(
+	                        second_string );
+
+	result = system_string_compare(
+	          first_string,
+	          second_string,
+	          ( first_string_length < second_string_length ) ? first_string_length : second_string_length );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( first_string_length < second_string_length )
+	{
+		return( -1 );
+	}
+	else if( first_string_length > second_string_length )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the EVTX files of a directory into the source list
+ * Only the files with the extension .evtx, in any case, are added.
+ * The files are added in order of their filename
+ * Returns 1 if successful, 0 if the directory could not be opened or -1 on error
+ */
+int source_list_read_directory(
+     source_list_t *source_list,
+     const system_character_t *directory_name,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	system_character_t *filename                     = NULL;
+	static char *function                            = "source_list_read_directory";
+	size_t directory_entry_name_length               = 0;
+	size_t directory_name_length                     = 0;
+	size_t filename_size                             = 0;
+	uint8_t directory_entry_type                     = 0;
+	int first_filename_index                         = 0;
+	int result                                       = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = system_string_length(
+	                         directory_name );
+
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+		  directory,
+		  directory_name,
+		  NULL );
+#else
+	result = libcdirectory_directory_open(
+		  directory,
+		  directory_name,
+		  NULL );
+#endif
+	if( result != 1 )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+
+		return( 0 );
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	first_filename_index = source_list->number_of_filenames;
+
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
+		if( directory_entry_type != LIBCDIRECTORY_ENTRY_TYPE_FILE )
+		{
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+			  directory_entry,
+			  (wchar_t **) &directory_entry_name,
+			  error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+			  directory_entry,
+			  (char **) &directory_entry_name,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry_name_length = system_string_length(
+		                               directory_entry_name );
+
+		if( directory_entry_name_length <= 5 )
+		{
+			continue;
+		}
+		if( system_string_compare_no_case(
+		     &( directory_entry_name[ directory_entry_name_length - 5 ] ),
+		     _SYSTEM_STRING( ".evtx" ),
+		     5 ) != 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#else
+		result = libcpath_path_join(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( source_list_append_filename(
+		     source_list,
+		     filename,
+		     filename_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filename.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 filename );
+
+		filename = NULL;
+		result   = 1;
+	}
+	while( result == 1 );
+
+	/* The order of the directory entries depends on the file system
+	 */
+	qsort(
+	 &( source_list->filenames[ first_filename_index ] ),
+	 (size_t) ( source_list->number_of_filenames - first_filename_index ),
+	 sizeof( system_character_t * ),
+	 &source_list_filename_compare );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the filenames of a list file into the source list
+ * The list file contains a filename per line, empty lines and lines
+ * that start with # are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_read_file(
+     source_list_t *source_list,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ SOURCE_LIST_MAXIMUM_LINE_SIZE ];
+
+	FILE *stream          = NULL;
+	static char *function = "source_list_read_file";
+	size_t line_length    = 0;
+	int line_number       = 0;
+
+	if( source_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source list.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open list file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	for( ;; )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( file_stream_get_string_wide(
+		     stream,
+		     line,
+		     SOURCE_LIST_MAXIMUM_LINE_SIZE ) == NULL )
+#else
+		if( file_stream_get_string(
+		     stream,
+		     line,
+		     SOURCE_LIST_MAXIMUM_LINE_SIZE ) == NULL )
+#endif
+		{
+			break;
+		}
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != (system_character_t) '\n' )
+		 && ( file_stream_at_end( stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: line: %d exceeds maximum size.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == (system_character_t) '#' ) )
+		{
+			continue;
+		}
+		if( source_list_append_filename(
+		     source_list,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filename of line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close list file.",
+		 function );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Reads the source list from a directory or a list file
+ * Returns 1 if successful or -1 on error
+ */
+int source_list_read(
+     source_list_t *source_list,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+	static char *function = "source_list_read";
+	int result            = 0;
+
+	result = source_list_read_directory(
+	          source_list,
+	          name,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* The name does not refer to a directory
+		 */
+		if( source_list_read_file(
+		     source_list,
+		     name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read list file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,93 @@
+/*
+ * Source list
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SOURCE_LIST_H )
+#define _SOURCE_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a line in a source list file
+ */
+#define SOURCE_LIST_MAXIMUM_LINE_SIZE		4096
+
+typedef struct source_list source_list_t;
+
+struct source_list
+{
+	/* The filenames
+	 */
+	system_character_t **filenames;
+
+	/* The number of filenames
+	 */
+	int number_of_filenames;
+
+	/* The number of allocated filenames
+	 */
+	int number_of_allocated_filenames;
+};
+
+int source_list_initialize(
+     source_list_t **source_list,
+     libcerror_error_t **error );
+
+int source_list_free(
+     source_list_t **source_list,
+     libcerror_error_t **error );
+
+int source_list_append_filename(
+     source_list_t *source_list,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int source_list_filename_compare(
+     const void *first_filename,
+     const void *second_filename );
+
+int source_list_read_directory(
+     source_list_t *source_list,
+     const system_character_t *directory_name,
+     libcerror_error_t **error );
+
+int source_list_read_file(
+     source_list_t *source_list,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int source_list_read(
+     source_list_t *source_list,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SOURCE_LIST_H ) */
+
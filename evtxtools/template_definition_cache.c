@@ -0,0 +1,587 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "template_definition_cache.h"
+
+/* Creates a template definition cache
+ * Make sure the value template_definition_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_initialize";
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition_cache = memory_allocate_structure(
+	                              template_definition_cache_t );
+
+	if( *template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *template_definition_cache,
+	     0,
+	     sizeof( template_definition_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template definition cache.",
+		 function );
+
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+
+		return( -1 );
+	}
+	if( template_definition_cache_resize_buckets(
+	     *template_definition_cache,
+	     TEMPLATE_DEFINITION_CACHE_INITIAL_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *template_definition_cache != NULL )
+	{
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a template definition cache
+ * The cached template definitions are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_free";
+	int result            = 1;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		if( template_definition_cache_empty(
+		     *template_definition_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty template definition cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *template_definition_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *template_definition_cache )->buckets );
+		}
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a template definition cache
+ * The cached template definitions are freed
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_empty(
+     template_definition_cache_t *template_definition_cache,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "template_definition_cache_empty";
+	int bucket_index                               = 0;
+	int result                                     = 1;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < template_definition_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( template_definition_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = template_definition_cache->buckets[ bucket_index ];
+
+			template_definition_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			if( cache_entry->template_definition != NULL )
+			{
+				if( libevtx_template_definition_free(
+				     &( cache_entry->template_definition ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free template definition.",
+					 function );
+
+					result = -1;
+				}
+			}
+			/* The template definition references the mapped data hence it is freed afterwards
+			 */
+			if( cache_entry->mapped_data != NULL )
+			{
+				if( resource_file_mapped_data_free(
+				     &( cache_entry->mapped_data ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free mapped data.",
+					 function );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 cache_entry );
+		}
+	}
+	template_definition_cache->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Calculates the hash of a provider and event identifier
+ * Returns the 32-bit hash
+ */
+uint32_t template_definition_cache_get_key_hash(
+          const uint8_t *provider_identifier,
+          uint32_t event_identifier )
+{
+	uint32_t key_hash  = 0x811c9dc5UL;
+	uint8_t byte_index = 0;
+
+	/* The events of a provider mostly have consecutive identifiers
+	 * hence the provider identifier is hashed with FNV-1a and
+	 * the event identifier is mixed in afterwards
+	 */
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		key_hash ^= provider_identifier[ byte_index ];
+		key_hash *= 0x01000193UL;
+	}
+	key_hash ^= event_identifier * 0x9e3779b1UL;
+	key_hash ^= key_hash >> 16;
+
+	return( key_hash );
+}
+
+/* Resizes the hash table buckets
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_resize_buckets(
+     template_definition_cache_t *template_definition_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t **buckets    = NULL;
+	template_definition_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "template_definition_cache_resize_buckets";
+	uint32_t key_hash                              = 0;
+	int bucket_index                               = 0;
+	int new_bucket_index                           = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) SSIZE_MAX / sizeof( template_definition_cache_entry_t * ) ) )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (template_definition_cache_entry_t **) memory_allocate(
+	                                                  sizeof( template_definition_cache_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( new_bucket_index = 0;
+	     new_bucket_index < number_of_buckets;
+	     new_bucket_index++ )
+	{
+		buckets[ new_bucket_index ] = NULL;
+	}
+	for( bucket_index = 0;
+	     bucket_index < template_definition_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( template_definition_cache->buckets[ bucket_index ] != NULL )
+		{
+			cache_entry = template_definition_cache->buckets[ bucket_index ];
+
+			template_definition_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+
+			key_hash = template_definition_cache_get_key_hash(
+			            cache_entry->provider_identifier,
+			            cache_entry->event_identifier );
+
+			new_bucket_index = (int) ( key_hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+			cache_entry->next_bucket_entry = buckets[ new_bucket_index ];
+			buckets[ new_bucket_index ]    = cache_entry;
+		}
+	}
+	if( template_definition_cache->buckets != NULL )
+	{
+		memory_free(
+		 template_definition_cache->buckets );
+	}
+	template_definition_cache->buckets           = buckets;
+	template_definition_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the template definition of an event of a specific provider
+ * The template definition is managed by the cache and is set to NULL
+ * if the cache records the event has no template definition
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int template_definition_cache_get_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "template_definition_cache_get_template_definition";
+	uint32_t key_hash                              = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition = NULL;
+
+	key_hash = template_definition_cache_get_key_hash(
+	            provider_identifier,
+	            event_identifier );
+
+	cache_entry = template_definition_cache->buckets[ key_hash & (uint32_t) ( template_definition_cache->number_of_buckets - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->event_identifier == event_identifier )
+		 && ( memory_compare(
+		       cache_entry->provider_identifier,
+		       provider_identifier,
+		       16 ) == 0 ) )
+		{
+			*template_definition = cache_entry->template_definition;
+
+			return( 1 );
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Appends the template definition of an event of a specific provider to the cache
+ * A NULL template definition records that the event has no template definition
+ * The cache takes over management of the template definition and the reference
+ * to the mapped data, also on error
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_append_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t *template_definition,
+     resource_file_mapped_data_t *mapped_data,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "template_definition_cache_append_template_definition";
+	uint32_t key_hash                              = 0;
+	int bucket_index                               = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( template_definition_cache->number_of_entries >= template_definition_cache->number_of_buckets )
+	{
+		if( template_definition_cache_resize_buckets(
+		     template_definition_cache,
+		     template_definition_cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	cache_entry = memory_allocate_structure(
+	               template_definition_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     cache_entry->provider_identifier,
+	     provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	key_hash = template_definition_cache_get_key_hash(
+	            provider_identifier,
+	            event_identifier );
+
+	bucket_index = (int) ( key_hash & (uint32_t) ( template_definition_cache->number_of_buckets - 1 ) );
+
+	cache_entry->event_identifier    = event_identifier;
+	cache_entry->template_definition = template_definition;
+	cache_entry->mapped_data         = mapped_data;
+	cache_entry->next_bucket_entry   = template_definition_cache->buckets[ bucket_index ];
+
+	template_definition_cache->buckets[ bucket_index ] = cache_entry;
+
+	template_definition_cache->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		memory_free(
+		 cache_entry );
+	}
+	if( template_definition != NULL )
+	{
+		libevtx_template_definition_free(
+		 &template_definition,
+		 NULL );
+	}
+	if( mapped_data != NULL )
+	{
+		resource_file_mapped_data_free(
+		 &mapped_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
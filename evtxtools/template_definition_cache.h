@@ -0,0 +1,128 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TEMPLATE_DEFINITION_CACHE_H )
+#define _TEMPLATE_DEFINITION_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "resource_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of hash table buckets, must be a power of 2
+ */
+#define TEMPLATE_DEFINITION_CACHE_INITIAL_NUMBER_OF_BUCKETS	64
+
+typedef struct template_definition_cache_entry template_definition_cache_entry_t;
+
+struct template_definition_cache_entry
+{
+	/* The provider identifier
+	 * Contains a little-endian GUID
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The template definition
+	 * Contains NULL if the event has no template definition
+	 */
+	libevtx_template_definition_t *template_definition;
+
+	/* The mapped data of the resource file referenced by the template definition
+	 * Contains NULL if the template definition contains a copy of the template data
+	 */
+	resource_file_mapped_data_t *mapped_data;
+
+	/* The next entry in the same hash table bucket
+	 */
+	template_definition_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct template_definition_cache template_definition_cache_t;
+
+struct template_definition_cache
+{
+	/* The hash table buckets
+	 */
+	template_definition_cache_entry_t **buckets;
+
+	/* The number of hash table buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_empty(
+     template_definition_cache_t *template_definition_cache,
+     libcerror_error_t **error );
+
+uint32_t template_definition_cache_get_key_hash(
+          const uint8_t *provider_identifier,
+          uint32_t event_identifier );
+
+int template_definition_cache_resize_buckets(
+     template_definition_cache_t *template_definition_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int template_definition_cache_get_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
+int template_definition_cache_append_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t *template_definition,
+     resource_file_mapped_data_t *mapped_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TEMPLATE_DEFINITION_CACHE_H ) */
+
@@ -0,0 +1,885 @@
+/*
+ * C++ interface to the Library to access the Windows XML Event Log (EVTX) format
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_HPP )
+#define _LIBEVTX_HPP
+
+/* The C++ interface is header-only and requires C++17
+ * Errors are reported by throwing evtx::error
+ */
+#include <libevtx.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace evtx
+{
+
+/* The error thrown when a libevtx function fails
+ */
+class error : public std::runtime_error
+{
+public:
+	explicit error(
+	          libevtx_error_t *libevtx_error )
+	 : std::runtime_error( describe( libevtx_error ) )
+	{
+		libevtx_error_free(
+		 &libevtx_error );
+	}
+
+private:
+	static std::string describe(
+	                    libevtx_error_t *libevtx_error )
+	{
+		char description[ 512 ];
+
+		if( ( libevtx_error == nullptr )
+		 || ( libevtx_error_sprint(
+		       libevtx_error,
+		       description,
+		       sizeof( description ) ) < 0 ) )
+		{
+			return( "libevtx: unknown error" );
+		}
+		return( description );
+	}
+};
+
+namespace detail
+{
+
+/* Throws an error if the result of a libevtx function indicates one
+ * Returns the result otherwise, which is 1 or 0 for functions that
+ * return 0 if the value is not available
+ */
+inline int check(
+            int result,
+            libevtx_error_t *libevtx_error )
+{
+	if( result == -1 )
+	{
+		throw error( libevtx_error );
+	}
+	return( result );
+}
+
+} /* namespace detail */
+
+/* A view of bytes that are owned by libevtx
+ */
+class bytes
+{
+public:
+	constexpr bytes() noexcept = default;
+
+	constexpr bytes(
+	           const uint8_t *data,
+	           size_t size ) noexcept
+	 : data_( data ),
+	   size_( size )
+	{
+	}
+
+	constexpr const uint8_t *data() const noexcept
+	{
+		return( data_ );
+	}
+
+	constexpr size_t size() const noexcept
+	{
+		return( size_ );
+	}
+
+	constexpr bool empty() const noexcept
+	{
+		return( size_ == 0 );
+	}
+
+	constexpr const uint8_t *begin() const noexcept
+	{
+		return( data_ );
+	}
+
+	constexpr const uint8_t *end() const noexcept
+	{
+		return( data_ + size_ );
+	}
+
+	constexpr uint8_t operator[](
+	                   size_t index ) const noexcept
+	{
+		return( data_[ index ] );
+	}
+
+private:
+	const uint8_t *data_ = nullptr;
+	size_t size_         = 0;
+};
+
+/* A non-owning view of a record
+ * The views returned by the accessors are valid as long as the record is
+ */
+class record_view
+{
+public:
+	constexpr record_view() noexcept = default;
+
+	explicit constexpr record_view(
+	                    libevtx_record_t *libevtx_record ) noexcept
+	 : record_( libevtx_record )
+	{
+	}
+
+	libevtx_record_t *get() const noexcept
+	{
+		return( record_ );
+	}
+
+	explicit operator bool() const noexcept
+	{
+		return( record_ != nullptr );
+	}
+
+	uint64_t identifier() const
+	{
+		return( get_value<uint64_t>( &libevtx_record_get_identifier ) );
+	}
+
+	/* The written time as a FILETIME value
+	 */
+	uint64_t written_time() const
+	{
+		return( get_value<uint64_t>( &libevtx_record_get_written_time ) );
+	}
+
+	uint32_t event_identifier() const
+	{
+		return( get_value<uint32_t>( &libevtx_record_get_event_identifier ) );
+	}
+
+	uint8_t event_level() const
+	{
+		return( get_value<uint8_t>( &libevtx_record_get_event_level ) );
+	}
+
+	uint16_t task() const
+	{
+		return( get_value<uint16_t>( &libevtx_record_get_task ) );
+	}
+
+	uint8_t opcode() const
+	{
+		return( get_value<uint8_t>( &libevtx_record_get_opcode ) );
+	}
+
+	uint64_t keywords() const
+	{
+		return( get_value<uint64_t>( &libevtx_record_get_keywords ) );
+	}
+
+	uint32_t process_identifier() const
+	{
+		return( get_value<uint32_t>( &libevtx_record_get_process_identifier ) );
+	}
+
+	uint32_t thread_identifier() const
+	{
+		return( get_value<uint32_t>( &libevtx_record_get_thread_identifier ) );
+	}
+
+	/* The raw data of the record, which is not decoded
+	 * The view is valid until the raw data is retrieved again
+	 */
+	bytes raw_data() const
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+		const uint8_t *data            = nullptr;
+		size_t data_size               = 0;
+
+		detail::check(
+		 libevtx_record_get_raw_data(
+		  record_,
+		  &data,
+		  &data_size,
+		  &libevtx_error ),
+		 libevtx_error );
+
+		return( bytes( data, data_size ) );
+	}
+
+	/* The binary data of the EventData, empty if not available
+	 */
+	bytes data() const
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+		const uint8_t *data            = nullptr;
+		size_t data_size               = 0;
+
+		if( detail::check(
+		     libevtx_record_get_data_reference(
+		      record_,
+		      &data,
+		      &data_size,
+		      &libevtx_error ),
+		     libevtx_error ) == 0 )
+		{
+			return( bytes() );
+		}
+		return( bytes( data, data_size ) );
+	}
+
+	/* The number of EventData strings
+	 */
+	int number_of_strings() const
+	{
+		load_strings();
+
+		return( number_of_strings_ );
+	}
+
+	/* A specific UTF-8 encoded EventData string
+	 * The view does not include the end of string character and
+	 * is empty for a string without a value
+	 */
+	std::string_view string(
+	                  int string_index ) const
+	{
+		load_strings();
+
+		if( ( string_index < 0 )
+		 || ( string_index >= number_of_strings_ ) )
+		{
+			throw std::out_of_range( "evtx::record_view::string: invalid string index" );
+		}
+		if( string_sizes_[ string_index ] == 0 )
+		{
+			return( std::string_view() );
+		}
+		return( std::string_view(
+		         reinterpret_cast<const char *>( &( strings_[ string_offsets_[ string_index ] ] ) ),
+		         string_sizes_[ string_index ] - 1 ) );
+	}
+
+	/* The first UTF-8 encoded EventData string with a specific name
+	 * The C API copies the string, hence it is returned by value
+	 */
+	std::string string_by_name(
+	             std::string_view name ) const
+	{
+		return( get_string(
+		         [ &name ]( libevtx_record_t *record, size_t *size, libevtx_error_t **libevtx_error )
+		         {
+		             return( libevtx_record_get_utf8_string_size_by_name(
+		                      record,
+		                      reinterpret_cast<const uint8_t *>( name.data() ),
+		                      name.size(),
+		                      size,
+		                      libevtx_error ) );
+		         },
+		         [ &name ]( libevtx_record_t *record, uint8_t *string, size_t size, libevtx_error_t **libevtx_error )
+		         {
+		             return( libevtx_record_get_utf8_string_by_name(
+		                      record,
+		                      reinterpret_cast<const uint8_t *>( name.data() ),
+		                      name.size(),
+		                      string,
+		                      size,
+		                      libevtx_error ) );
+		         } ) );
+	}
+
+	std::string provider_identifier() const
+	{
+		return( get_string(
+		         &libevtx_record_get_utf8_provider_identifier_size,
+		         &libevtx_record_get_utf8_provider_identifier ) );
+	}
+
+	std::string source_name() const
+	{
+		return( get_string(
+		         &libevtx_record_get_utf8_source_name_size,
+		         &libevtx_record_get_utf8_source_name ) );
+	}
+
+	std::string computer_name() const
+	{
+		return( get_string(
+		         &libevtx_record_get_utf8_computer_name_size,
+		         &libevtx_record_get_utf8_computer_name ) );
+	}
+
+	std::string channel_name() const
+	{
+		return( get_string(
+		         &libevtx_record_get_utf8_channel_name_size,
+		         &libevtx_record_get_utf8_channel_name ) );
+	}
+
+	std::string xml() const
+	{
+		return( get_string(
+		         &libevtx_record_get_utf8_xml_string_size,
+		         &libevtx_record_get_utf8_xml_string ) );
+	}
+
+protected:
+	void reset(
+	      libevtx_record_t *libevtx_record ) noexcept
+	{
+		record_            = libevtx_record;
+		strings_           = nullptr;
+		string_offsets_    = nullptr;
+		string_sizes_      = nullptr;
+		number_of_strings_ = -1;
+	}
+
+private:
+	template<typename Value, typename Function>
+	Value get_value(
+	       Function function ) const
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+		Value value                    = 0;
+
+		detail::check(
+		 function(
+		  record_,
+		  &value,
+		  &libevtx_error ),
+		 libevtx_error );
+
+		return( value );
+	}
+
+	/* Retrieves a string using its size and get functions
+	 * Returns an empty string if the value is not available
+	 */
+	template<typename SizeFunction, typename GetFunction>
+	std::string get_string(
+	             SizeFunction size_function,
+	             GetFunction get_function ) const
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+		std::string string;
+		size_t string_size             = 0;
+
+		if( ( detail::check(
+		       size_function(
+		        record_,
+		        &string_size,
+		        &libevtx_error ),
+		       libevtx_error ) == 0 )
+		 || ( string_size <= 1 ) )
+		{
+			return( string );
+		}
+		/* The string is retrieved directly into the buffer of the std::string
+		 */
+		string.resize(
+		 string_size );
+
+		detail::check(
+		 get_function(
+		  record_,
+		  reinterpret_cast<uint8_t *>( string.data() ),
+		  string_size,
+		  &libevtx_error ),
+		 libevtx_error );
+
+		string.resize(
+		 string_size - 1 );
+
+		return( string );
+	}
+
+	void load_strings() const
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+
+		if( number_of_strings_ >= 0 )
+		{
+			return;
+		}
+		detail::check(
+		 libevtx_record_get_utf8_strings(
+		  record_,
+		  &strings_,
+		  &number_of_strings_,
+		  &string_offsets_,
+		  &string_sizes_,
+		  &libevtx_error ),
+		 libevtx_error );
+	}
+
+	libevtx_record_t *record_ = nullptr;
+
+	/* The strings buffers, owned by the record
+	 */
+	mutable const uint8_t *strings_       = nullptr;
+	mutable const size_t *string_offsets_ = nullptr;
+	mutable const size_t *string_sizes_   = nullptr;
+	mutable int number_of_strings_        = -1;
+};
+
+/* An owned record, the record is freed on destruction
+ */
+class record : public record_view
+{
+public:
+	record() noexcept = default;
+
+	explicit record(
+	          libevtx_record_t *libevtx_record ) noexcept
+	 : record_view( libevtx_record )
+	{
+	}
+
+	record(
+	 const record & ) = delete;
+
+	record &operator=(
+	         const record & ) = delete;
+
+	record(
+	 record &&other ) noexcept
+	 : record_view( other.release() )
+	{
+	}
+
+	record &operator=(
+	         record &&other ) noexcept
+	{
+		if( this != &other )
+		{
+			free();
+
+			reset(
+			 other.release() );
+		}
+		return( *this );
+	}
+
+	~record()
+	{
+		free();
+	}
+
+	/* Releases the ownership of the record
+	 */
+	libevtx_record_t *release() noexcept
+	{
+		libevtx_record_t *libevtx_record = get();
+
+		reset(
+		 nullptr );
+
+		return( libevtx_record );
+	}
+
+private:
+	void free() noexcept
+	{
+		libevtx_record_t *libevtx_record = release();
+
+		if( libevtx_record != nullptr )
+		{
+			libevtx_record_free(
+			 &libevtx_record,
+			 nullptr );
+		}
+	}
+};
+
+class file;
+
+/* The records of a file as a range
+ * The records are retrieved as the borrowed record of the file, or as owned
+ * records if the file does not support borrowed records, hence a record
+ * obtained from the iterator is only valid until the iterator is advanced
+ */
+class record_range
+{
+public:
+	class iterator
+	{
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type        = record_view;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = const record_view *;
+		using reference         = const record_view &;
+
+		iterator() noexcept = default;
+
+		iterator(
+		 libevtx_file_t *file,
+		 int record_index,
+		 bool use_borrowed_records ) noexcept
+		 : file_( file ),
+		   record_index_( record_index ),
+		   use_borrowed_records_( use_borrowed_records )
+		{
+		}
+
+		iterator(
+		 const iterator &other ) noexcept
+		 : file_( other.file_ ),
+		   record_index_( other.record_index_ ),
+		   use_borrowed_records_( other.use_borrowed_records_ )
+		{
+		}
+
+		iterator &operator=(
+		           const iterator &other ) noexcept
+		{
+			if( this != &other )
+			{
+				file_                 = other.file_;
+				record_index_         = other.record_index_;
+				use_borrowed_records_ = other.use_borrowed_records_;
+				record_               = record_view();
+				owned_record_         = record();
+			}
+			return( *this );
+		}
+
+		reference operator*()
+		{
+			load();
+
+			return( record_ );
+		}
+
+		pointer operator->()
+		{
+			load();
+
+			return( &record_ );
+		}
+
+		iterator &operator++() noexcept
+		{
+			record_index_ += 1;
+			record_        = record_view();
+			owned_record_  = record();
+
+			return( *this );
+		}
+
+		bool operator==(
+		      const iterator &other ) const noexcept
+		{
+			return( record_index_ == other.record_index_ );
+		}
+
+		bool operator!=(
+		      const iterator &other ) const noexcept
+		{
+			return( record_index_ != other.record_index_ );
+		}
+
+	private:
+		void load()
+		{
+			libevtx_error_t *libevtx_error   = nullptr;
+			libevtx_record_t *libevtx_record = nullptr;
+
+			if( record_ )
+			{
+				return;
+			}
+			if( !use_borrowed_records_ )
+			{
+				detail::check(
+				 libevtx_file_get_record_by_index(
+				  file_,
+				  record_index_,
+				  &libevtx_record,
+				  &libevtx_error ),
+				 libevtx_error );
+
+				owned_record_ = record( libevtx_record );
+				record_       = record_view( libevtx_record );
+
+				return;
+			}
+			detail::check(
+			 libevtx_file_get_borrowed_record_by_index(
+			  file_,
+			  record_index_,
+			  &libevtx_record,
+			  &libevtx_error ),
+			 libevtx_error );
+
+			record_ = record_view( libevtx_record );
+		}
+
+		libevtx_file_t *file_      = nullptr;
+		int record_index_          = 0;
+		bool use_borrowed_records_ = true;
+		record_view record_;
+
+		/* The record when owned records are used instead of borrowed records
+		 */
+		record owned_record_;
+	};
+
+	record_range(
+	 libevtx_file_t *file,
+	 int number_of_records,
+	 bool use_borrowed_records = true ) noexcept
+	 : file_( file ),
+	   number_of_records_( number_of_records ),
+	   use_borrowed_records_( use_borrowed_records )
+	{
+	}
+
+	iterator begin() const noexcept
+	{
+		return( iterator( file_, 0, use_borrowed_records_ ) );
+	}
+
+	iterator end() const noexcept
+	{
+		return( iterator( file_, number_of_records_, use_borrowed_records_ ) );
+	}
+
+	int size() const noexcept
+	{
+		return( number_of_records_ );
+	}
+
+private:
+	libevtx_file_t *file_;
+	int number_of_records_;
+	bool use_borrowed_records_;
+};
+
+/* An owned file, the file is closed and freed on destruction
+ */
+class file
+{
+public:
+	file()
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+
+		detail::check(
+		 libevtx_file_initialize(
+		  &file_,
+		  &libevtx_error ),
+		 libevtx_error );
+	}
+
+	explicit file(
+	          const std::string &filename,
+	          int access_flags = LIBEVTX_OPEN_READ )
+	 : file()
+	{
+		open(
+		 filename,
+		 access_flags );
+	}
+
+	file(
+	 const file & ) = delete;
+
+	file &operator=(
+	       const file & ) = delete;
+
+	file(
+	 file &&other ) noexcept
+	 : file_( std::exchange( other.file_, nullptr ) ),
+	   is_open_( std::exchange( other.is_open_, false ) ),
+	   is_thread_safe_( std::exchange( other.is_thread_safe_, false ) )
+	{
+	}
+
+	file &operator=(
+	       file &&other ) noexcept
+	{
+		if( this != &other )
+		{
+			free();
+
+			file_           = std::exchange( other.file_, nullptr );
+			is_open_        = std::exchange( other.is_open_, false );
+			is_thread_safe_ = std::exchange( other.is_thread_safe_, false );
+		}
+		return( *this );
+	}
+
+	~file()
+	{
+		free();
+	}
+
+	libevtx_file_t *get() const noexcept
+	{
+		return( file_ );
+	}
+
+	void open(
+	      const std::string &filename,
+	      int access_flags = LIBEVTX_OPEN_READ )
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+
+		detail::check(
+		 libevtx_file_open(
+		  file_,
+		  filename.c_str(),
+		  access_flags,
+		  &libevtx_error ),
+		 libevtx_error );
+
+		is_open_        = true;
+		is_thread_safe_ = ( access_flags & LIBEVTX_ACCESS_FLAG_THREAD_SAFE ) != 0;
+	}
+
+	void close()
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+
+		if( !is_open_ )
+		{
+			return;
+		}
+		is_open_ = false;
+
+		detail::check(
+		 libevtx_file_close(
+		  file_,
+		  &libevtx_error ),
+		 libevtx_error );
+	}
+
+	void signal_abort()
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+
+		detail::check(
+		 libevtx_file_signal_abort(
+		  file_,
+		  &libevtx_error ),
+		 libevtx_error );
+	}
+
+	int number_of_records() const
+	{
+		libevtx_error_t *libevtx_error = nullptr;
+		int number_of_records          = 0;
+
+		detail::check(
+		 libevtx_file_get_number_of_records(
+		  file_,
+		  &number_of_records,
+		  &libevtx_error ),
+		 libevtx_error );
+
+		return( number_of_records );
+	}
+
+	/* Retrieves a specific record as an owned record
+	 */
+	record record_at(
+	        int record_index ) const
+	{
+		libevtx_error_t *libevtx_error   = nullptr;
+		libevtx_record_t *libevtx_record = nullptr;
+
+		detail::check(
+		 libevtx_file_get_record_by_index(
+		  file_,
+		  record_index,
+		  &libevtx_record,
+		  &libevtx_error ),
+		 libevtx_error );
+
+		return( evtx::record( libevtx_record ) );
+	}
+
+	/* Retrieves the record with a specific identifier
+	 * Returns an empty record if no such record
+	 */
+	record record_by_identifier(
+	        uint64_t identifier ) const
+	{
+		libevtx_error_t *libevtx_error   = nullptr;
+		libevtx_record_t *libevtx_record = nullptr;
+
+		detail::check(
+		 libevtx_file_get_record_by_identifier(
+		  file_,
+		  identifier,
+		  &libevtx_record,
+		  &libevtx_error ),
+		 libevtx_error );
+
+		return( evtx::record( libevtx_record ) );
+	}
+
+	/* The records as a range of borrowed records
+	 * If the file was opened with LIBEVTX_ACCESS_FLAG_THREAD_SAFE, which does
+	 * not support borrowed records, the range uses owned records instead
+	 */
+	record_range records() const
+	{
+		return( record_range( file_, number_of_records(), !is_thread_safe_ ) );
+	}
+
+private:
+	void free() noexcept
+	{
+		if( file_ == nullptr )
+		{
+			return;
+		}
+		if( is_open_ )
+		{
+			libevtx_file_close(
+			 file_,
+			 nullptr );
+		}
+		libevtx_file_free(
+		 &file_,
+		 nullptr );
+
+		is_open_        = false;
+		is_thread_safe_ = false;
+	}
+
+	libevtx_file_t *file_ = nullptr;
+	bool is_open_         = false;
+	bool is_thread_safe_  = false;
+};
+
+} /* namespace evtx */
+
+#endif /* !defined( _LIBEVTX_HPP ) */
+
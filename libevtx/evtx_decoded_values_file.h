@@ -0,0 +1,163 @@
+/*
+ * The decoded values file definition of a Windows XML Event Log (EVTX) file
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTX_DECODED_VALUES_FILE_H )
+#define _EVTX_DECODED_VALUES_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct evtx_decoded_values_file_header evtx_decoded_values_file_header_t;
+
+struct evtx_decoded_values_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Consists of: "EvtxDec\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The calculated file header checksum of the decoded file
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_checksum[ 4 ];
+
+	/* The size of the decoded file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The modification time of the decoded file as a POSIX timestamp
+	 * Consists of 8 bytes
+	 * Contains 0 if not available
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The number of record entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_record_entries[ 4 ];
+
+	/* The number of string entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_string_entries[ 4 ];
+
+	/* The strings data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t strings_data_size[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+
+	/* The entries checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC32 of the data following the header
+	 */
+	uint8_t entries_checksum[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC32 of the preceding header data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct evtx_decoded_values_file_record_entry evtx_decoded_values_file_record_entry_t;
+
+struct evtx_decoded_values_file_record_entry
+{
+	/* The record file offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_offset[ 8 ];
+
+	/* The event identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t event_identifier[ 4 ];
+
+	/* The index of the channel name string entry
+	 * Consists of 4 bytes
+	 */
+	uint8_t channel_name_index[ 4 ];
+
+	/* The index of the computer name string entry
+	 * Consists of 4 bytes
+	 */
+	uint8_t computer_name_index[ 4 ];
+
+	/* The event level
+	 * Consists of 1 byte
+	 */
+	uint8_t event_level;
+
+	/* The System values flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding[ 2 ];
+
+	/* The provider identifier
+	 * Consists of 16 bytes
+	 * Contains a little-endian GUID
+	 */
+	uint8_t provider_identifier[ 16 ];
+};
+
+typedef struct evtx_decoded_values_file_string_entry evtx_decoded_values_file_string_entry_t;
+
+struct evtx_decoded_values_file_string_entry
+{
+	/* The offset of the string in the strings data
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_offset[ 4 ];
+
+	/* The size of the string
+	 * Consists of 4 bytes
+	 * Contains the size of the UTF-16 little-endian string without end of string character
+	 */
+	uint8_t data_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTX_DECODED_VALUES_FILE_H ) */
+
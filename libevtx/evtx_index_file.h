@@ -0,0 +1,217 @@
+/*
+ * The index file definition of a Windows XML Event Log (EVTX) file
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTX_INDEX_FILE_H )
+#define _EVTX_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct evtx_index_file_header evtx_index_file_header_t;
+
+struct evtx_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Consists of: "EvtxIdx\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The calculated file header checksum of the indexed file
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_checksum[ 4 ];
+
+	/* The size of the indexed file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The modification time of the indexed file as a POSIX timestamp
+	 * Consists of 8 bytes
+	 * Contains 0 if not available
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The chunks data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t chunks_data_size[ 8 ];
+
+	/* The first record identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t first_record_identifier[ 8 ];
+
+	/* The last record identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_record_identifier[ 8 ];
+
+	/* The identifier of the last record in the records list
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_indexed_record_identifier[ 8 ];
+
+	/* The IO handle flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t io_handle_flags[ 4 ];
+
+	/* The number of chunk entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_chunk_entries[ 4 ];
+
+	/* The number of record entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_record_entries[ 4 ];
+
+	/* The number of recovered record entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_recovered_record_entries[ 4 ];
+
+	/* The number of value filter entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_value_filter_entries[ 4 ];
+
+	/* The entries checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC32 of the data following the header
+	 */
+	uint8_t entries_checksum[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC32 of the preceding header data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct evtx_index_file_chunk_entry evtx_index_file_chunk_entry_t;
+
+struct evtx_index_file_chunk_entry
+{
+	/* The chunk index
+	 * Consists of 4 bytes
+	 */
+	uint8_t chunk_index[ 4 ];
+
+	/* The chunk descriptor flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The stored chunk header checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_checksum[ 4 ];
+
+	/* The stored event records checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t event_records_checksum[ 4 ];
+
+	/* The number of records in the records table of the chunk
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_records[ 4 ];
+
+	/* The smallest identifier of the records in the chunk
+	 * Consists of 8 bytes
+	 */
+	uint8_t minimum_record_identifier[ 8 ];
+
+	/* The largest identifier of the records in the chunk
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_record_identifier[ 8 ];
+
+	/* The smallest written time of the records in the chunk
+	 * Consists of 8 bytes
+	 */
+	uint8_t minimum_written_time[ 8 ];
+
+	/* The largest written time of the records in the chunk
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_written_time[ 8 ];
+
+	/* The event identifiers bitmap of the chunk summary
+	 * Consists of 32 bytes
+	 */
+	uint8_t event_identifiers_bitmap[ 32 ];
+
+	/* The provider identifiers bitmap of the chunk summary
+	 * Consists of 32 bytes
+	 */
+	uint8_t provider_identifiers_bitmap[ 32 ];
+};
+
+typedef struct evtx_index_file_record_entry evtx_index_file_record_entry_t;
+
+struct evtx_index_file_record_entry
+{
+	/* The record file offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_offset[ 8 ];
+
+	/* The records list element data size
+	 * Consists of 8 bytes
+	 * Contains the chunk index, the index of the record within the chunk and the recovered flag
+	 */
+	uint8_t element_data_size[ 8 ];
+};
+
+typedef struct evtx_index_file_value_filter_entry evtx_index_file_value_filter_entry_t;
+
+struct evtx_index_file_value_filter_entry
+{
+	/* The chunk index
+	 * Consists of 4 bytes
+	 */
+	uint8_t chunk_index[ 4 ];
+
+	/* The value filter data
+	 * Consists of 4096 bytes
+	 */
+	uint8_t data[ 4096 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTX_INDEX_FILE_H ) */
+
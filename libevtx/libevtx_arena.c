@@ -0,0 +1,310 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_arena.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+
+/* The size of the block header, aligned so that the block data is aligned
+ */
+#define LIBEVTX_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( libevtx_arena_block_t ) + ( LIBEVTX_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBEVTX_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * The blocks are allocated on demand
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_initialize(
+     libevtx_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > ( (size_t) SSIZE_MAX - LIBEVTX_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libevtx_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libevtx_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All allocations of the arena are released at once
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_free(
+     libevtx_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libevtx_arena_block_t *block = NULL;
+	static char *function        = "libevtx_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		while( ( *arena )->blocks != NULL )
+		{
+			block = ( *arena )->blocks;
+
+			( *arena )->blocks = block->next_block;
+
+			memory_free(
+			 block );
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets an arena
+ * All allocations of the arena are released, the first allocated block is retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_reset(
+     libevtx_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libevtx_arena_block_t *block = NULL;
+	static char *function        = "libevtx_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( arena->blocks != NULL )
+	    && ( arena->blocks->next_block != NULL ) )
+	{
+		block = arena->blocks;
+
+		arena->blocks = block->next_block;
+
+		memory_free(
+		 block );
+
+		arena->number_of_blocks -= 1;
+	}
+	if( arena->blocks != NULL )
+	{
+		arena->blocks->used_data_size = 0;
+	}
+	return( 1 );
+}
+
+/* Allocates data from an arena
+ * The data is aligned to LIBEVTX_ARENA_ALIGNMENT and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_allocate(
+     libevtx_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error )
+{
+	libevtx_arena_block_t *block = NULL;
+	static char *function        = "libevtx_arena_allocate";
+	size_t aligned_size          = 0;
+	size_t data_size             = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > ( (size_t) SSIZE_MAX - LIBEVTX_ARENA_BLOCK_HEADER_SIZE - LIBEVTX_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + ( LIBEVTX_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBEVTX_ARENA_ALIGNMENT - 1 );
+
+	block = arena->blocks;
+
+	if( ( block == NULL )
+	 || ( aligned_size > ( block->data_size - block->used_data_size ) ) )
+	{
+		/* Allocations larger than the block size get a block of their own
+		 */
+		data_size = arena->block_size;
+
+		if( data_size < aligned_size )
+		{
+			data_size = aligned_size;
+		}
+		block = (libevtx_arena_block_t *) memory_allocate(
+		                                   LIBEVTX_ARENA_BLOCK_HEADER_SIZE + data_size );
+
+		if( block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block.",
+			 function );
+
+			return( -1 );
+		}
+		block->data           = &( ( (uint8_t *) block )[ LIBEVTX_ARENA_BLOCK_HEADER_SIZE ] );
+		block->data_size      = data_size;
+		block->used_data_size = 0;
+
+		/* A block of its own is added after the current block so that
+		 * the remaining data of the current block can still be used
+		 */
+		if( ( arena->blocks != NULL )
+		 && ( data_size > arena->block_size ) )
+		{
+			block->next_block         = arena->blocks->next_block;
+			arena->blocks->next_block = block;
+		}
+		else
+		{
+			block->next_block = arena->blocks;
+			arena->blocks     = block;
+		}
+		arena->number_of_blocks += 1;
+	}
+	*data = (void *) &( block->data[ block->used_data_size ] );
+
+	block->used_data_size += aligned_size;
+
+	return( 1 );
+}
+
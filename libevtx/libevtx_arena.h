@@ -0,0 +1,97 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_ARENA_H )
+#define _LIBEVTX_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_arena_block libevtx_arena_block_t;
+
+struct libevtx_arena_block
+{
+	/* The next (previously allocated) block
+	 */
+	libevtx_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+};
+
+typedef struct libevtx_arena libevtx_arena_t;
+
+struct libevtx_arena
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The blocks
+	 * The first block is the block allocations are taken from
+	 */
+	libevtx_arena_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+};
+
+int libevtx_arena_initialize(
+     libevtx_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libevtx_arena_free(
+     libevtx_arena_t **arena,
+     libcerror_error_t **error );
+
+int libevtx_arena_reset(
+     libevtx_arena_t *arena,
+     libcerror_error_t **error );
+
+int libevtx_arena_allocate(
+     libevtx_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_ARENA_H ) */
+
@@ -0,0 +1,360 @@
+/*
+ * Arena pool functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_arena.h"
+#include "libevtx_arena_pool.h"
+#include "libevtx_libcerror.h"
+
+/* Creates an arena pool
+ * Make sure the value arena_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_pool_initialize(
+     libevtx_arena_pool_t **arena_pool,
+     size_t block_size,
+     int maximum_number_of_arenas,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_arena_pool_initialize";
+
+	if( arena_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_arenas < 0 )
+	 || ( (size_t) maximum_number_of_arenas > ( (size_t) SSIZE_MAX / sizeof( libevtx_arena_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of arenas value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena_pool = memory_allocate_structure(
+	               libevtx_arena_pool_t );
+
+	if( *arena_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena_pool,
+	     0,
+	     sizeof( libevtx_arena_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena pool.",
+		 function );
+
+		memory_free(
+		 *arena_pool );
+
+		*arena_pool = NULL;
+
+		return( -1 );
+	}
+	if( maximum_number_of_arenas > 0 )
+	{
+		( *arena_pool )->arenas = (libevtx_arena_t **) memory_allocate(
+		                                                sizeof( libevtx_arena_t * ) * maximum_number_of_arenas );
+
+		if( ( *arena_pool )->arenas == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create arenas.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *arena_pool )->block_size               = block_size;
+	( *arena_pool )->maximum_number_of_arenas = maximum_number_of_arenas;
+
+	return( 1 );
+
+on_error:
+	if( *arena_pool != NULL )
+	{
+		memory_free(
+		 *arena_pool );
+
+		*arena_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena pool and the arenas available for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_pool_free(
+     libevtx_arena_pool_t **arena_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_arena_pool_free";
+	int arena_index       = 0;
+	int result            = 1;
+
+	if( arena_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena_pool != NULL )
+	{
+		if( ( *arena_pool )->arenas != NULL )
+		{
+			for( arena_index = 0;
+			     arena_index < ( *arena_pool )->number_of_arenas;
+			     arena_index++ )
+			{
+				if( libevtx_arena_free(
+				     &( ( *arena_pool )->arenas[ arena_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free arena: %d.",
+					 function,
+					 arena_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *arena_pool )->arenas );
+		}
+		memory_free(
+		 *arena_pool );
+
+		*arena_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves an arena from the pool
+ * A new arena is created if no arena is available for reuse
+ * The arena must be returned with libevtx_arena_pool_release_arena
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_pool_get_arena(
+     libevtx_arena_pool_t *arena_pool,
+     libevtx_arena_t **arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_arena_pool_get_arena";
+
+	if( arena_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena_pool->number_of_arenas > 0 )
+	{
+		arena_pool->number_of_arenas -= 1;
+
+		*arena = arena_pool->arenas[ arena_pool->number_of_arenas ];
+
+		arena_pool->arenas[ arena_pool->number_of_arenas ] = NULL;
+	}
+	else
+	{
+		if( libevtx_arena_initialize(
+		     arena,
+		     arena_pool->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Returns an arena to the pool
+ * The arena is reset, its first block is retained so that its memory can be reused
+ * The arena is freed if the pool already retains its maximum number of arenas
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_arena_pool_release_arena(
+     libevtx_arena_pool_t *arena_pool,
+     libevtx_arena_t **arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_arena_pool_release_arena";
+
+	if( arena_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena == NULL )
+	{
+		return( 1 );
+	}
+	if( arena_pool->number_of_arenas < arena_pool->maximum_number_of_arenas )
+	{
+		if( libevtx_arena_reset(
+		     *arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset arena.",
+			 function );
+
+			return( -1 );
+		}
+		arena_pool->arenas[ arena_pool->number_of_arenas ] = *arena;
+
+		arena_pool->number_of_arenas += 1;
+
+		*arena = NULL;
+	}
+	else
+	{
+		if( libevtx_arena_free(
+		     arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,81 @@
+/*
+ * Arena pool functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_ARENA_POOL_H )
+#define _LIBEVTX_ARENA_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_arena.h"
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_arena_pool libevtx_arena_pool_t;
+
+struct libevtx_arena_pool
+{
+	/* The block size of the arenas
+	 */
+	size_t block_size;
+
+	/* The (reset) arenas available for reuse
+	 */
+	libevtx_arena_t **arenas;
+
+	/* The number of arenas available for reuse
+	 */
+	int number_of_arenas;
+
+	/* The maximum number of arenas retained for reuse
+	 */
+	int maximum_number_of_arenas;
+};
+
+int libevtx_arena_pool_initialize(
+     libevtx_arena_pool_t **arena_pool,
+     size_t block_size,
+     int maximum_number_of_arenas,
+     libcerror_error_t **error );
+
+int libevtx_arena_pool_free(
+     libevtx_arena_pool_t **arena_pool,
+     libcerror_error_t **error );
+
+int libevtx_arena_pool_get_arena(
+     libevtx_arena_pool_t *arena_pool,
+     libevtx_arena_t **arena,
+     libcerror_error_t **error );
+
+int libevtx_arena_pool_release_arena(
+     libevtx_arena_pool_t *arena_pool,
+     libevtx_arena_t **arena,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_ARENA_POOL_H ) */
+
@@ -0,0 +1,1486 @@
+/*
+ * Asynchronous chunk reader functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libevtx_async_reader.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+/* Creates an asynchronous chunk reader
+ * The asynchronous chunk reader keeps multiple chunk reads in flight using io_uring
+ * on Linux or overlapped unbuffered reads on Windows
+ * Make sure the value async_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_initialize(
+     libevtx_async_reader_t **async_reader,
+     size_t chunk_size,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_initialize";
+	size_t array_size     = 0;
+	int slot_index        = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth <= 0 )
+	 || ( queue_depth > LIBEVTX_MAXIMUM_ASYNC_READ_QUEUE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*async_reader = memory_allocate_structure(
+	                 libevtx_async_reader_t );
+
+	if( *async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create asynchronous reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *async_reader,
+	     0,
+	     sizeof( libevtx_async_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear asynchronous reader.",
+		 function );
+
+		memory_free(
+		 *async_reader );
+
+		*async_reader = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_IO_URING )
+	( *async_reader )->file_descriptor = -1;
+	( *async_reader )->ring_descriptor = -1;
+
+#elif defined( WINAPI )
+	( *async_reader )->file_handle = INVALID_HANDLE_VALUE;
+#endif
+	array_size = sizeof( libevtx_async_reader_slot_t ) * queue_depth;
+
+	( *async_reader )->slots = (libevtx_async_reader_slot_t *) memory_allocate(
+	                                                            array_size );
+
+	if( ( *async_reader )->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *async_reader )->slots,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 ( *async_reader )->slots );
+
+		( *async_reader )->slots = NULL;
+
+		goto on_error;
+	}
+	( *async_reader )->chunk_size       = chunk_size;
+	( *async_reader )->queue_depth      = queue_depth;
+	( *async_reader )->last_file_offset = -1;
+
+	for( slot_index = 0;
+	     slot_index < queue_depth;
+	     slot_index++ )
+	{
+		( *async_reader )->slots[ slot_index ].file_offset = -1;
+
+#if defined( WINAPI )
+		/* Unbuffered reads require sector aligned buffers
+		 */
+		( *async_reader )->slots[ slot_index ].data = (uint8_t *) VirtualAlloc(
+		                                                           NULL,
+		                                                           chunk_size,
+		                                                           MEM_COMMIT | MEM_RESERVE,
+		                                                           PAGE_READWRITE );
+#else
+		( *async_reader )->slots[ slot_index ].data = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * chunk_size );
+#endif
+		if( ( *async_reader )->slots[ slot_index ].data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slot: %d data.",
+			 function,
+			 slot_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBEVTX_IO_URING )
+		( *async_reader )->slots[ slot_index ].io_vector.iov_base = (void *) ( *async_reader )->slots[ slot_index ].data;
+		( *async_reader )->slots[ slot_index ].io_vector.iov_len  = chunk_size;
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *async_reader )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *async_reader != NULL )
+	{
+		libevtx_async_reader_free(
+		 async_reader,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an asynchronous chunk reader
+ * The chunk reads in flight are completed before the asynchronous chunk reader is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_free(
+     libevtx_async_reader_t **async_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_free";
+	int result            = 1;
+	int slot_index        = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_reader != NULL )
+	{
+		if( libevtx_async_reader_close(
+		     *async_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close asynchronous reader.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *async_reader )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *async_reader )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *async_reader )->slots != NULL )
+		{
+			/* The slot data is only freed if no read is in flight
+			 * otherwise the kernel could still write into it
+			 */
+			if( ( *async_reader )->number_of_submitted_reads == 0 )
+			{
+				for( slot_index = 0;
+				     slot_index < ( *async_reader )->queue_depth;
+				     slot_index++ )
+				{
+					if( ( *async_reader )->slots[ slot_index ].data != NULL )
+					{
+#if defined( WINAPI )
+						VirtualFree(
+						 ( *async_reader )->slots[ slot_index ].data,
+						 0,
+						 MEM_RELEASE );
+#else
+						memory_free(
+						 ( *async_reader )->slots[ slot_index ].data );
+#endif
+					}
+				}
+				memory_free(
+				 ( *async_reader )->slots );
+			}
+		}
+		memory_free(
+		 *async_reader );
+
+		*async_reader = NULL;
+	}
+	return( result );
+}
+
+/* Opens the asynchronous chunk reader
+ * The file is opened separately from the file IO handle of the file
+ * Returns 1 if successful, 0 if asynchronous reads are not supported or -1 on error
+ */
+int libevtx_async_reader_open(
+     libevtx_async_reader_t *async_reader,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_open";
+
+#if defined( WINAPI ) && !defined( HAVE_LIBEVTX_IO_URING )
+	int slot_index        = 0;
+#endif
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_reader->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous reader - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_IO_URING )
+	async_reader->file_descriptor = open(
+	                                 filename,
+	                                 O_RDONLY );
+
+	if( async_reader->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &( async_reader->parameters ),
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		goto on_error;
+	}
+	/* io_uring can be unavailable in the kernel or disabled by a seccomp policy
+	 * in which case the chunks are read synchronously
+	 */
+	async_reader->ring_descriptor = (int) syscall(
+	                                       __NR_io_uring_setup,
+	                                       (unsigned int) async_reader->queue_depth,
+	                                       &( async_reader->parameters ) );
+
+	if( async_reader->ring_descriptor == -1 )
+	{
+		close(
+		 async_reader->file_descriptor );
+
+		async_reader->file_descriptor = -1;
+
+		return( 0 );
+	}
+	async_reader->submission_ring_size = (size_t) async_reader->parameters.sq_off.array
+	                                   + ( async_reader->parameters.sq_entries * sizeof( uint32_t ) );
+
+	async_reader->submission_ring = (uint8_t *) mmap(
+	                                             NULL,
+	                                             async_reader->submission_ring_size,
+	                                             PROT_READ | PROT_WRITE,
+	                                             MAP_SHARED,
+	                                             async_reader->ring_descriptor,
+	                                             IORING_OFF_SQ_RING );
+
+	if( async_reader->submission_ring == MAP_FAILED )
+	{
+		async_reader->submission_ring = NULL;
+
+		goto on_unsupported;
+	}
+	async_reader->submission_entries_size = async_reader->parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	async_reader->submission_entries = (struct io_uring_sqe *) mmap(
+	                                                            NULL,
+	                                                            async_reader->submission_entries_size,
+	                                                            PROT_READ | PROT_WRITE,
+	                                                            MAP_SHARED,
+	                                                            async_reader->ring_descriptor,
+	                                                            IORING_OFF_SQES );
+
+	if( async_reader->submission_entries == MAP_FAILED )
+	{
+		async_reader->submission_entries = NULL;
+
+		goto on_unsupported;
+	}
+	async_reader->completion_ring_size = (size_t) async_reader->parameters.cq_off.cqes
+	                                   + ( async_reader->parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+	async_reader->completion_ring = (uint8_t *) mmap(
+	                                             NULL,
+	                                             async_reader->completion_ring_size,
+	                                             PROT_READ | PROT_WRITE,
+	                                             MAP_SHARED,
+	                                             async_reader->ring_descriptor,
+	                                             IORING_OFF_CQ_RING );
+
+	if( async_reader->completion_ring == MAP_FAILED )
+	{
+		async_reader->completion_ring = NULL;
+
+		goto on_unsupported;
+	}
+	async_reader->is_open = 1;
+
+	return( 1 );
+
+on_unsupported:
+	if( libevtx_async_reader_close(
+	     async_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+
+on_error:
+	libevtx_async_reader_close(
+	 async_reader,
+	 NULL );
+
+	return( -1 );
+
+#elif defined( WINAPI )
+	async_reader->file_handle = CreateFileA(
+	                             (LPCSTR) filename,
+	                             GENERIC_READ,
+	                             FILE_SHARE_READ | FILE_SHARE_WRITE,
+	                             NULL,
+	                             OPEN_EXISTING,
+	                             FILE_FLAG_OVERLAPPED | FILE_FLAG_NO_BUFFERING,
+	                             NULL );
+
+	if( async_reader->file_handle == INVALID_HANDLE_VALUE )
+	{
+		return( 0 );
+	}
+	for( slot_index = 0;
+	     slot_index < async_reader->queue_depth;
+	     slot_index++ )
+	{
+		async_reader->slots[ slot_index ].overlapped.hEvent = CreateEvent(
+		                                                       NULL,
+		                                                       TRUE,
+		                                                       FALSE,
+		                                                       NULL );
+
+		if( async_reader->slots[ slot_index ].overlapped.hEvent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create slot: %d event.",
+			 function,
+			 slot_index );
+
+			libevtx_async_reader_close(
+			 async_reader,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	async_reader->is_open = 1;
+
+	return( 1 );
+
+#else
+	/* Asynchronous reads are not supported on this platform
+	 */
+	return( 0 );
+#endif
+}
+
+/* Closes the asynchronous chunk reader
+ * Waits for the chunk reads in flight to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_close(
+     libevtx_async_reader_t *async_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_close";
+	int result            = 1;
+
+#if defined( WINAPI ) && !defined( HAVE_LIBEVTX_IO_URING )
+	int slot_index        = 0;
+#endif
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_async_reader_wait_for_all_slots(
+	     async_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to wait for reads in flight.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVTX_IO_URING )
+	if( async_reader->completion_ring != NULL )
+	{
+		munmap(
+		 async_reader->completion_ring,
+		 async_reader->completion_ring_size );
+
+		async_reader->completion_ring = NULL;
+	}
+	if( async_reader->submission_entries != NULL )
+	{
+		munmap(
+		 async_reader->submission_entries,
+		 async_reader->submission_entries_size );
+
+		async_reader->submission_entries = NULL;
+	}
+	if( async_reader->submission_ring != NULL )
+	{
+		munmap(
+		 async_reader->submission_ring,
+		 async_reader->submission_ring_size );
+
+		async_reader->submission_ring = NULL;
+	}
+	if( async_reader->ring_descriptor != -1 )
+	{
+		close(
+		 async_reader->ring_descriptor );
+
+		async_reader->ring_descriptor = -1;
+	}
+	if( async_reader->file_descriptor != -1 )
+	{
+		close(
+		 async_reader->file_descriptor );
+
+		async_reader->file_descriptor = -1;
+	}
+#elif defined( WINAPI )
+	for( slot_index = 0;
+	     slot_index < async_reader->queue_depth;
+	     slot_index++ )
+	{
+		if( async_reader->slots[ slot_index ].overlapped.hEvent != NULL )
+		{
+			CloseHandle(
+			 async_reader->slots[ slot_index ].overlapped.hEvent );
+
+			async_reader->slots[ slot_index ].overlapped.hEvent = NULL;
+		}
+	}
+	if( async_reader->file_handle != INVALID_HANDLE_VALUE )
+	{
+		CloseHandle(
+		 async_reader->file_handle );
+
+		async_reader->file_handle = INVALID_HANDLE_VALUE;
+	}
+#endif
+	async_reader->is_open = 0;
+
+	return( result );
+}
+
+/* Submits the read of a chunk into a slot
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_submit_slot(
+     libevtx_async_reader_t *async_reader,
+     int slot_index,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libevtx_async_reader_slot_t *slot = NULL;
+	static char *function             = "libevtx_async_reader_submit_slot";
+
+#if defined( HAVE_LIBEVTX_IO_URING )
+	struct io_uring_sqe *entry        = NULL;
+	uint32_t *submission_array        = NULL;
+	uint32_t *submission_tail         = NULL;
+	uint32_t entry_index              = 0;
+	uint32_t ring_mask                = 0;
+	uint32_t tail                     = 0;
+	int result                        = 0;
+#endif
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= async_reader->queue_depth ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot = &( async_reader->slots[ slot_index ] );
+
+	slot->file_offset = file_offset;
+	slot->state       = LIBEVTX_ASYNC_READER_SLOT_STATE_FAILED;
+
+#if defined( HAVE_LIBEVTX_IO_URING )
+	submission_tail  = (uint32_t *) &( async_reader->submission_ring[ async_reader->parameters.sq_off.tail ] );
+	submission_array = (uint32_t *) &( async_reader->submission_ring[ async_reader->parameters.sq_off.array ] );
+	ring_mask        = *( (uint32_t *) &( async_reader->submission_ring[ async_reader->parameters.sq_off.ring_mask ] ) );
+
+	/* The submission queue tail is only written while holding the mutex
+	 */
+	tail        = *submission_tail;
+	entry_index = tail & ring_mask;
+	entry       = &( async_reader->submission_entries[ entry_index ] );
+
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( struct io_uring_sqe ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear submission entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry->opcode    = IORING_OP_READV;
+	entry->fd        = async_reader->file_descriptor;
+	entry->off       = (uint64_t) file_offset;
+	entry->addr      = (uint64_t) (intptr_t) &( slot->io_vector );
+	entry->len       = 1;
+	entry->user_data = (uint64_t) slot_index;
+
+	submission_array[ entry_index ] = entry_index;
+
+	__atomic_store_n(
+	 submission_tail,
+	 tail + 1,
+	 __ATOMIC_RELEASE );
+
+	do
+	{
+		result = (int) syscall(
+		                __NR_io_uring_enter,
+		                async_reader->ring_descriptor,
+		                1,
+		                0,
+		                0,
+		                NULL,
+		                0 );
+	}
+#if defined( EINTR )
+	while( ( result == -1 )
+	    && ( errno == EINTR ) );
+#else
+	while( 0 );
+#endif
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to submit read at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	slot->state = LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED;
+
+	async_reader->number_of_submitted_reads += 1;
+
+#elif defined( WINAPI )
+	slot->overlapped.Internal     = 0;
+	slot->overlapped.InternalHigh = 0;
+	slot->overlapped.Offset       = (DWORD) ( file_offset & 0xffffffffUL );
+	slot->overlapped.OffsetHigh   = (DWORD) ( file_offset >> 32 );
+
+	ResetEvent(
+	 slot->overlapped.hEvent );
+
+	/* A read that cannot be submitted leaves the slot failed
+	 * hence the chunk is read synchronously by the consumer
+	 */
+	if( ReadFile(
+	     async_reader->file_handle,
+	     (LPVOID) slot->data,
+	     (DWORD) async_reader->chunk_size,
+	     NULL,
+	     &( slot->overlapped ) ) != 0 )
+	{
+		slot->state = LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED;
+
+		async_reader->number_of_submitted_reads += 1;
+	}
+	else if( GetLastError() == ERROR_IO_PENDING )
+	{
+		slot->state = LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED;
+
+		async_reader->number_of_submitted_reads += 1;
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits for the read of a slot to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_wait_for_slot(
+     libevtx_async_reader_t *async_reader,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	static char *function             = "libevtx_async_reader_wait_for_slot";
+
+#if defined( HAVE_LIBEVTX_IO_URING )
+	libevtx_async_reader_slot_t *slot = NULL;
+	struct io_uring_cqe *entries      = NULL;
+	uint32_t *completion_head         = NULL;
+	uint32_t *completion_tail         = NULL;
+	uint64_t completed_slot_index     = 0;
+	uint32_t head                     = 0;
+	uint32_t ring_mask                = 0;
+	int32_t read_result               = 0;
+	int result                        = 0;
+
+#elif defined( WINAPI )
+	libevtx_async_reader_slot_t *slot = NULL;
+	DWORD read_count                  = 0;
+#endif
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= async_reader->queue_depth ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_IO_URING )
+	slot            = &( async_reader->slots[ slot_index ] );
+	completion_head = (uint32_t *) &( async_reader->completion_ring[ async_reader->parameters.cq_off.head ] );
+	completion_tail = (uint32_t *) &( async_reader->completion_ring[ async_reader->parameters.cq_off.tail ] );
+	ring_mask       = *( (uint32_t *) &( async_reader->completion_ring[ async_reader->parameters.cq_off.ring_mask ] ) );
+	entries         = (struct io_uring_cqe *) &( async_reader->completion_ring[ async_reader->parameters.cq_off.cqes ] );
+
+	/* The completions are reaped in the order the kernel reports them
+	 * until the read of the slot has completed
+	 */
+	while( slot->state == LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED )
+	{
+		head = *completion_head;
+
+		if( head == __atomic_load_n(
+		             completion_tail,
+		             __ATOMIC_ACQUIRE ) )
+		{
+			result = (int) syscall(
+			                __NR_io_uring_enter,
+			                async_reader->ring_descriptor,
+			                0,
+			                1,
+			                IORING_ENTER_GETEVENTS,
+			                NULL,
+			                0 );
+
+#if defined( EINTR )
+			if( ( result == -1 )
+			 && ( errno == EINTR ) )
+			{
+				continue;
+			}
+#endif
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to wait for read completion.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		completed_slot_index = entries[ head & ring_mask ].user_data;
+		read_result          = entries[ head & ring_mask ].res;
+
+		__atomic_store_n(
+		 completion_head,
+		 head + 1,
+		 __ATOMIC_RELEASE );
+
+		if( ( completed_slot_index < (uint64_t) async_reader->queue_depth )
+		 && ( async_reader->slots[ completed_slot_index ].state == LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED ) )
+		{
+			/* A short read is treated as failed and the chunk is read synchronously
+			 */
+			if( read_result == (int32_t) async_reader->chunk_size )
+			{
+				async_reader->slots[ completed_slot_index ].state = LIBEVTX_ASYNC_READER_SLOT_STATE_LOADED;
+			}
+			else
+			{
+				async_reader->slots[ completed_slot_index ].state = LIBEVTX_ASYNC_READER_SLOT_STATE_FAILED;
+			}
+			async_reader->number_of_submitted_reads -= 1;
+		}
+	}
+#elif defined( WINAPI )
+	slot = &( async_reader->slots[ slot_index ] );
+
+	if( slot->state == LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED )
+	{
+		if( ( GetOverlappedResult(
+		       async_reader->file_handle,
+		       &( slot->overlapped ),
+		       &read_count,
+		       TRUE ) != 0 )
+		 && ( read_count == (DWORD) async_reader->chunk_size ) )
+		{
+			slot->state = LIBEVTX_ASYNC_READER_SLOT_STATE_LOADED;
+		}
+		else
+		{
+			slot->state = LIBEVTX_ASYNC_READER_SLOT_STATE_FAILED;
+		}
+		async_reader->number_of_submitted_reads -= 1;
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits for all the reads in flight to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_wait_for_all_slots(
+     libevtx_async_reader_t *async_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_wait_for_all_slots";
+	int slot_index        = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_reader->slots == NULL )
+	{
+		return( 1 );
+	}
+	for( slot_index = 0;
+	     slot_index < async_reader->queue_depth;
+	     slot_index++ )
+	{
+		if( async_reader->slots[ slot_index ].state != LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED )
+		{
+			continue;
+		}
+		if( libevtx_async_reader_wait_for_slot(
+		     async_reader,
+		     slot_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for slot: %d.",
+			 function,
+			 slot_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Submits the read of a chunk if it is not already in flight
+ * This function does not grab the mutex
+ * Returns 1 if successful, 0 if the read was not submitted or -1 on error
+ */
+int libevtx_async_reader_submit_read(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_submit_read";
+	int free_slot_index   = -1;
+	int slot_index        = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( async_reader->is_open == 0 )
+	 || ( file_offset < 0 )
+	 || ( (size64_t) file_offset >= async_reader->file_size )
+	 || ( (size64_t) async_reader->chunk_size > ( async_reader->file_size - (size64_t) file_offset ) ) )
+	{
+		return( 0 );
+	}
+	for( slot_index = 0;
+	     slot_index < async_reader->queue_depth;
+	     slot_index++ )
+	{
+		if( async_reader->slots[ slot_index ].state == LIBEVTX_ASYNC_READER_SLOT_STATE_EMPTY )
+		{
+			if( free_slot_index == -1 )
+			{
+				free_slot_index = slot_index;
+			}
+		}
+		else if( async_reader->slots[ slot_index ].file_offset == file_offset )
+		{
+			return( 1 );
+		}
+		/* Chunks before the last chunk read by the consumer are not expected
+		 * to be retrieved hence their slots can be reused
+		 */
+		else if( ( async_reader->slots[ slot_index ].state != LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED )
+		      && ( async_reader->slots[ slot_index ].file_offset < async_reader->last_file_offset )
+		      && ( free_slot_index == -1 ) )
+		{
+			free_slot_index = slot_index;
+		}
+	}
+	if( free_slot_index == -1 )
+	{
+		return( 0 );
+	}
+	if( libevtx_async_reader_submit_slot(
+	     async_reader,
+	     free_slot_index,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to submit read at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the file size
+ * The chunks read before are discarded since the file could have been modified
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_set_file_size(
+     libevtx_async_reader_t *async_reader,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_set_file_size";
+	int result            = 1;
+	int slot_index        = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevtx_async_reader_wait_for_all_slots(
+	     async_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to wait for reads in flight.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		for( slot_index = 0;
+		     slot_index < async_reader->queue_depth;
+		     slot_index++ )
+		{
+			async_reader->slots[ slot_index ].file_offset = -1;
+			async_reader->slots[ slot_index ].state       = LIBEVTX_ASYNC_READER_SLOT_STATE_EMPTY;
+		}
+		async_reader->file_size        = file_size;
+		async_reader->last_file_offset = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Submits the read of a chunk
+ * Returns 1 if successful, 0 if the read was not submitted or -1 on error
+ */
+int libevtx_async_reader_submit(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_submit";
+	int result            = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_async_reader_submit_read(
+	          async_reader,
+	          file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to submit read at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Schedules the reads of the chunks that follow a chunk read by the consumer
+ * The reads are only submitted if the chunk directly follows the previous chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_reader_schedule(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_schedule";
+	off64_t read_offset   = 0;
+	int is_sequential     = 0;
+	int read_index        = 0;
+	int result            = 1;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( async_reader->last_file_offset >= 0 )
+	 && ( file_offset == ( async_reader->last_file_offset + (off64_t) async_reader->chunk_size ) ) )
+	{
+		is_sequential = 1;
+	}
+	async_reader->last_file_offset = file_offset;
+
+	if( is_sequential != 0 )
+	{
+		read_offset = file_offset;
+
+		for( read_index = 0;
+		     read_index < async_reader->queue_depth;
+		     read_index++ )
+		{
+			read_offset += (off64_t) async_reader->chunk_size;
+
+			result = libevtx_async_reader_submit_read(
+			          async_reader,
+			          read_offset,
+			          error );
+
+			if( result != 1 )
+			{
+				break;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to submit read at offset: %" PRIi64 ".",
+			 function,
+			 read_offset );
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data of a chunk that was read asynchronously
+ * Waits for the read if it is still in flight
+ * Returns 1 if successful, 0 if the chunk was not read asynchronously or -1 on error
+ */
+int libevtx_async_reader_get_chunk_data(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_reader_get_chunk_data";
+	int result            = 0;
+	int slot_index        = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != async_reader->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( slot_index = 0;
+	     slot_index < async_reader->queue_depth;
+	     slot_index++ )
+	{
+		if( ( async_reader->slots[ slot_index ].state != LIBEVTX_ASYNC_READER_SLOT_STATE_EMPTY )
+		 && ( async_reader->slots[ slot_index ].file_offset == file_offset ) )
+		{
+			break;
+		}
+	}
+	if( slot_index < async_reader->queue_depth )
+	{
+		if( libevtx_async_reader_wait_for_slot(
+		     async_reader,
+		     slot_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for slot: %d.",
+			 function,
+			 slot_index );
+
+			result = -1;
+		}
+		else if( async_reader->slots[ slot_index ].state == LIBEVTX_ASYNC_READER_SLOT_STATE_LOADED )
+		{
+			if( memory_copy(
+			     data,
+			     async_reader->slots[ slot_index ].data,
+			     data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk data.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				result = 1;
+			}
+		}
+		if( async_reader->slots[ slot_index ].state != LIBEVTX_ASYNC_READER_SLOT_STATE_SUBMITTED )
+		{
+			async_reader->slots[ slot_index ].file_offset = -1;
+			async_reader->slots[ slot_index ].state       = LIBEVTX_ASYNC_READER_SLOT_STATE_EMPTY;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
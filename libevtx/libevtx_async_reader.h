@@ -0,0 +1,222 @@
+/*
+ * Asynchronous chunk reader functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_ASYNC_READER_H )
+#define _LIBEVTX_ASYNC_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYS_UIO_H ) && defined( HAVE_SYS_MMAN_H ) && !defined( WINAPI )
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#if defined( __NR_io_uring_setup ) && defined( __NR_io_uring_enter )
+#define HAVE_LIBEVTX_IO_URING
+#endif
+#endif
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_async_reader_slot libevtx_async_reader_slot_t;
+
+struct libevtx_async_reader_slot
+{
+	/* The (chunk) file offset
+	 */
+	off64_t file_offset;
+
+	/* The chunk data
+	 */
+	uint8_t *data;
+
+	/* The state
+	 */
+	int state;
+
+#if defined( HAVE_LIBEVTX_IO_URING )
+	/* The IO vector that describes the chunk data
+	 */
+	struct iovec io_vector;
+
+#elif defined( WINAPI )
+	/* The overlapped read
+	 */
+	OVERLAPPED overlapped;
+#endif
+};
+
+typedef struct libevtx_async_reader libevtx_async_reader_t;
+
+struct libevtx_async_reader
+{
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The queue depth, the maximum number of chunk reads in flight
+	 */
+	int queue_depth;
+
+	/* The slots, one for every chunk read in flight
+	 */
+	libevtx_async_reader_slot_t *slots;
+
+	/* The number of chunk reads in flight
+	 */
+	int number_of_submitted_reads;
+
+	/* The file offset of the last chunk read by the consumer
+	 * Contains -1 if not set
+	 */
+	off64_t last_file_offset;
+
+	/* Value to indicate the reader is open
+	 */
+	uint8_t is_open;
+
+#if defined( HAVE_LIBEVTX_IO_URING )
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The io_uring (ring) file descriptor
+	 */
+	int ring_descriptor;
+
+	/* The mapped submission queue ring
+	 */
+	uint8_t *submission_ring;
+
+	/* The mapped submission queue ring size
+	 */
+	size_t submission_ring_size;
+
+	/* The mapped submission queue entries
+	 */
+	struct io_uring_sqe *submission_entries;
+
+	/* The mapped submission queue entries size
+	 */
+	size_t submission_entries_size;
+
+	/* The mapped completion queue ring
+	 */
+	uint8_t *completion_ring;
+
+	/* The mapped completion queue ring size
+	 */
+	size_t completion_ring_size;
+
+	/* The submission and completion queue ring offsets
+	 */
+	struct io_uring_params parameters;
+
+#elif defined( WINAPI )
+	/* The file handle opened for unbuffered overlapped reads
+	 */
+	HANDLE file_handle;
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the slots
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevtx_async_reader_initialize(
+     libevtx_async_reader_t **async_reader,
+     size_t chunk_size,
+     int queue_depth,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_free(
+     libevtx_async_reader_t **async_reader,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_open(
+     libevtx_async_reader_t *async_reader,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_close(
+     libevtx_async_reader_t *async_reader,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_submit_slot(
+     libevtx_async_reader_t *async_reader,
+     int slot_index,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_wait_for_slot(
+     libevtx_async_reader_t *async_reader,
+     int slot_index,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_wait_for_all_slots(
+     libevtx_async_reader_t *async_reader,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_submit_read(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_set_file_size(
+     libevtx_async_reader_t *async_reader,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_submit(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_schedule(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_async_reader_get_chunk_data(
+     libevtx_async_reader_t *async_reader,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_ASYNC_READER_H ) */
+
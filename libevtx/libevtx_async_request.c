@@ -0,0 +1,644 @@
+/*
+ * Asynchronous request functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libevtx_async_request.h"
+#include "libevtx_definitions.h"
+#include "libevtx_file.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_record.h"
+
+/* Creates an asynchronous request
+ * Make sure the value async_request is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_request_initialize(
+     libevtx_async_request_t **async_request,
+     libevtx_file_t *file,
+     int type,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_request_initialize";
+
+	if( async_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type != LIBEVTX_ASYNC_REQUEST_TYPE_OPEN )
+	 && ( type != LIBEVTX_ASYNC_REQUEST_TYPE_GET_RECORDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported type.",
+		 function );
+
+		return( -1 );
+	}
+	*async_request = memory_allocate_structure(
+	                  libevtx_async_request_t );
+
+	if( *async_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create asynchronous request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *async_request,
+	     0,
+	     sizeof( libevtx_async_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear asynchronous request.",
+		 function );
+
+		goto on_error;
+	}
+	( *async_request )->type = type;
+	( *async_request )->file = file;
+
+	return( 1 );
+
+on_error:
+	if( *async_request != NULL )
+	{
+		memory_free(
+		 *async_request );
+
+		*async_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an asynchronous request
+ * The thread of the request, if any, is joined first
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_request_free(
+     libevtx_async_request_t **async_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_request_free";
+	int result            = 1;
+
+	if( async_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_request != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *async_request )->thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( ( *async_request )->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread.",
+				 function );
+
+				/* The thread could still be using the asynchronous request
+				 */
+				return( -1 );
+			}
+		}
+#endif
+		if( ( *async_request )->filename != NULL )
+		{
+			memory_free(
+			 ( *async_request )->filename );
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( ( *async_request )->filename_wide != NULL )
+		{
+			memory_free(
+			 ( *async_request )->filename_wide );
+		}
+#endif
+		memory_free(
+		 *async_request );
+
+		*async_request = NULL;
+	}
+	return( result );
+}
+
+/* Sets the filename of an open request
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_request_set_filename(
+     libevtx_async_request_t *async_request,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_request_set_filename";
+
+	if( async_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_request->filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous request - filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	async_request->filename = narrow_string_allocate(
+	                           filename_length + 1 );
+
+	if( async_request->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     async_request->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	async_request->filename[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( async_request->filename != NULL )
+	{
+		memory_free(
+		 async_request->filename );
+
+		async_request->filename = NULL;
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the wide filename of an open request
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_request_set_filename_wide(
+     libevtx_async_request_t *async_request,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_async_request_set_filename_wide";
+
+	if( async_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_request->filename_wide != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous request - wide filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( ( SSIZE_MAX / sizeof( wchar_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	async_request->filename_wide = wide_string_allocate(
+	                                filename_length + 1 );
+
+	if( async_request->filename_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create wide filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     async_request->filename_wide,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy wide filename.",
+		 function );
+
+		goto on_error;
+	}
+	async_request->filename_wide[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( async_request->filename_wide != NULL )
+	{
+		memory_free(
+		 async_request->filename_wide );
+
+		async_request->filename_wide = NULL;
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Runs an open request
+ * The result of the open is reported to the open callback
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_request_run_open(
+     libevtx_async_request_t *async_request )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libevtx_async_request_run_open";
+	int result               = -1;
+
+	if( async_request == NULL )
+	{
+		return( -1 );
+	}
+	if( async_request->filename != NULL )
+	{
+		result = libevtx_file_open(
+		          async_request->file,
+		          async_request->filename,
+		          async_request->access_flags,
+		          &error );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	else if( async_request->filename_wide != NULL )
+	{
+		result = libevtx_file_open_wide(
+		          async_request->file,
+		          async_request->filename_wide,
+		          async_request->access_flags,
+		          &error );
+	}
+#endif
+	else
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid asynchronous request - missing filename.",
+		 function );
+	}
+	if( async_request->open_callback != NULL )
+	{
+		async_request->open_callback(
+		 async_request->file,
+		 result,
+		 error,
+		 async_request->user_data );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Runs a get records request
+ * The records are passed to the records callback in batches of at most
+ * LIBEVTX_ASYNC_RECORDS_BATCH_SIZE records, the callback takes ownership of the records
+ * On error the callback is called with the error and without records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_request_run_get_records(
+     libevtx_async_request_t *async_request )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	libevtx_record_t **records             = NULL;
+	static char *function                  = "libevtx_async_request_run_get_records";
+	int batch_index                        = 0;
+	int is_last_batch                      = 0;
+	int last_record_index                  = 0;
+	int number_of_batch_records            = 0;
+	int record_index                       = 0;
+	int result                             = 0;
+
+	if( async_request == NULL )
+	{
+		return( -1 );
+	}
+	if( async_request->records_callback == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid asynchronous request - missing records callback.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file = (libevtx_internal_file_t *) async_request->file;
+
+	records = (libevtx_record_t **) memory_allocate(
+	                                 sizeof( libevtx_record_t * ) * LIBEVTX_ASYNC_RECORDS_BATCH_SIZE );
+
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     records,
+	     0,
+	     sizeof( libevtx_record_t * ) * LIBEVTX_ASYNC_RECORDS_BATCH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records.",
+		 function );
+
+		goto on_error;
+	}
+	record_index      = async_request->first_record_index;
+	last_record_index = async_request->first_record_index + async_request->number_of_records;
+
+	/* A request without records still reports a single, empty, last batch
+	 */
+	do
+	{
+		number_of_batch_records = 0;
+
+		while( ( number_of_batch_records < LIBEVTX_ASYNC_RECORDS_BATCH_SIZE )
+		    && ( record_index < last_record_index ) )
+		{
+			if( internal_file->io_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevtx_file_get_record_by_index(
+			     async_request->file,
+			     record_index,
+			     &( records[ number_of_batch_records ] ),
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			number_of_batch_records++;
+			record_index++;
+		}
+		if( record_index >= last_record_index )
+		{
+			is_last_batch = 1;
+		}
+		/* The callback takes ownership of the records
+		 */
+		result = async_request->records_callback(
+		          async_request->file,
+		          records,
+		          number_of_batch_records,
+		          is_last_batch,
+		          NULL,
+		          async_request->user_data );
+
+		for( batch_index = 0;
+		     batch_index < number_of_batch_records;
+		     batch_index++ )
+		{
+			records[ batch_index ] = NULL;
+		}
+	}
+	while( ( result == 1 )
+	    && ( is_last_batch == 0 ) );
+
+	memory_free(
+	 records );
+
+	return( 1 );
+
+on_error:
+	if( records != NULL )
+	{
+		for( batch_index = 0;
+		     batch_index < number_of_batch_records;
+		     batch_index++ )
+		{
+			libevtx_record_free(
+			 &( records[ batch_index ] ),
+			 NULL );
+		}
+		memory_free(
+		 records );
+	}
+	if( async_request->records_callback != NULL )
+	{
+		async_request->records_callback(
+		 async_request->file,
+		 NULL,
+		 0,
+		 1,
+		 error,
+		 async_request->user_data );
+	}
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Runs an asynchronous request
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_async_request_run(
+     libevtx_async_request_t *async_request )
+{
+	if( async_request == NULL )
+	{
+		return( -1 );
+	}
+	if( async_request->type == LIBEVTX_ASYNC_REQUEST_TYPE_OPEN )
+	{
+		return( libevtx_async_request_run_open(
+		         async_request ) );
+	}
+	return( libevtx_async_request_run_get_records(
+	         async_request ) );
+}
+
@@ -0,0 +1,140 @@
+/*
+ * Asynchronous request functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_ASYNC_REQUEST_H )
+#define _LIBEVTX_ASYNC_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_async_request libevtx_async_request_t;
+
+struct libevtx_async_request
+{
+	/* The request type
+	 */
+	int type;
+
+	/* The file
+	 */
+	libevtx_file_t *file;
+
+	/* The filename of an open request
+	 */
+	char *filename;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide filename of an open request
+	 */
+	wchar_t *filename_wide;
+#endif
+
+	/* The access flags of an open request
+	 */
+	int access_flags;
+
+	/* The index of the first record of a get records request
+	 */
+	int first_record_index;
+
+	/* The number of records of a get records request
+	 */
+	int number_of_records;
+
+	/* The open completion callback
+	 */
+	void (*open_callback)(
+	       libevtx_file_t *file,
+	       int result,
+	       libcerror_error_t *error,
+	       void *user_data );
+
+	/* The records batch callback
+	 */
+	int (*records_callback)(
+	       libevtx_file_t *file,
+	       libevtx_record_t **records,
+	       int number_of_records,
+	       int is_last_batch,
+	       libcerror_error_t *error,
+	       void *user_data );
+
+	/* The callback user data
+	 */
+	void *user_data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 * Contains NULL if the request is run by the executor of the caller
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int libevtx_async_request_initialize(
+     libevtx_async_request_t **async_request,
+     libevtx_file_t *file,
+     int type,
+     libcerror_error_t **error );
+
+int libevtx_async_request_free(
+     libevtx_async_request_t **async_request,
+     libcerror_error_t **error );
+
+int libevtx_async_request_set_filename(
+     libevtx_async_request_t *async_request,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libevtx_async_request_set_filename_wide(
+     libevtx_async_request_t *async_request,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libevtx_async_request_run_open(
+     libevtx_async_request_t *async_request );
+
+int libevtx_async_request_run_get_records(
+     libevtx_async_request_t *async_request );
+
+int libevtx_async_request_run(
+     libevtx_async_request_t *async_request );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_ASYNC_REQUEST_H ) */
+
@@ -0,0 +1,1012 @@
+/*
+ * Buffer pool functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#include "libevtx_buffer_pool.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if !defined( WINAPI ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( MAP_ANONYMOUS )
+#define HAVE_LIBEVTX_BUFFER_POOL_MMAP
+#endif
+
+/* Creates a buffer pool
+ * Make sure the value buffer_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_initialize(
+     libevtx_buffer_pool_t **buffer_pool,
+     size_t buffer_size,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_initialize";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer_pool = memory_allocate_structure(
+	                libevtx_buffer_pool_t );
+
+	if( *buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *buffer_pool,
+	     0,
+	     sizeof( libevtx_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer pool.",
+		 function );
+
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+
+		return( -1 );
+	}
+	( *buffer_pool )->buffer_size = buffer_size;
+
+	if( buffer_size <= (size_t) LIBEVTX_BUFFER_POOL_SLAB_SIZE )
+	{
+		( *buffer_pool )->number_of_buffers_per_slab = (int) ( LIBEVTX_BUFFER_POOL_SLAB_SIZE / buffer_size );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *buffer_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libevtx_buffer_pool_set_maximum_number_of_buffers(
+	     *buffer_pool,
+	     maximum_number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of buffers.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *buffer_pool != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *buffer_pool )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *buffer_pool )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *buffer_pool )->buffers != NULL )
+		{
+			memory_free(
+			 ( *buffer_pool )->buffers );
+		}
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a buffer pool, the buffers available for reuse and the large page slabs
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_free(
+     libevtx_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_free";
+	int buffer_index      = 0;
+	int result            = 1;
+	int slab_index        = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		if( ( *buffer_pool )->buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *buffer_pool )->number_of_buffers;
+			     buffer_index++ )
+			{
+				memory_free(
+				 ( *buffer_pool )->buffers[ buffer_index ] );
+			}
+			memory_free(
+			 ( *buffer_pool )->buffers );
+		}
+		if( ( *buffer_pool )->slabs != NULL )
+		{
+			for( slab_index = 0;
+			     slab_index < ( *buffer_pool )->number_of_slabs;
+			     slab_index++ )
+			{
+				if( libevtx_buffer_pool_free_slab(
+				     &( ( *buffer_pool )->slabs[ slab_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free slab: %d.",
+					 function,
+					 slab_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *buffer_pool )->slabs );
+		}
+		if( ( *buffer_pool )->slab_buffers != NULL )
+		{
+			memory_free(
+			 ( *buffer_pool )->slab_buffers );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *buffer_pool )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *buffer_pool )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( result );
+}
+
+/* Allocates a large page slab and carves it into buffers that are available for reuse
+ * The slab is backed by explicit huge pages if available, otherwise by transparent
+ * huge pages on Linux or by regular pages
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_allocate_slab(
+     libevtx_buffer_pool_t *buffer_pool,
+     libcerror_error_t **error )
+{
+	uint8_t **reallocation = NULL;
+	uint8_t *slab          = NULL;
+	static char *function  = "libevtx_buffer_pool_allocate_slab";
+	int buffer_index       = 0;
+
+#if defined( WINAPI )
+	SIZE_T large_page_size = 0;
+
+#elif defined( HAVE_LIBEVTX_BUFFER_POOL_MMAP )
+	uint8_t *mapped_data   = NULL;
+	size_t alignment_size  = 0;
+#endif
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_pool->number_of_buffers_per_slab <= 0 )
+	 || ( buffer_pool->number_of_slabs >= ( ( INT_MAX / buffer_pool->number_of_buffers_per_slab ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer pool - number of slabs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* Large pages require the SeLockMemoryPrivilege, without it
+	 * the slab is allocated from regular pages
+	 */
+	large_page_size = GetLargePageMinimum();
+
+	if( ( large_page_size != 0 )
+	 && ( ( LIBEVTX_BUFFER_POOL_SLAB_SIZE % large_page_size ) == 0 ) )
+	{
+		slab = (uint8_t *) VirtualAlloc(
+		                    NULL,
+		                    LIBEVTX_BUFFER_POOL_SLAB_SIZE,
+		                    MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+		                    PAGE_READWRITE );
+	}
+	if( slab == NULL )
+	{
+		slab = (uint8_t *) VirtualAlloc(
+		                    NULL,
+		                    LIBEVTX_BUFFER_POOL_SLAB_SIZE,
+		                    MEM_COMMIT | MEM_RESERVE,
+		                    PAGE_READWRITE );
+	}
+#elif defined( HAVE_LIBEVTX_BUFFER_POOL_MMAP )
+#if defined( MAP_HUGETLB )
+	/* Explicit huge pages are only available if they were reserved by the system administrator
+	 */
+	mapped_data = (uint8_t *) mmap(
+	                           NULL,
+	                           LIBEVTX_BUFFER_POOL_SLAB_SIZE,
+	                           PROT_READ | PROT_WRITE,
+	                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+	                           -1,
+	                           0 );
+
+	if( mapped_data != (uint8_t *) MAP_FAILED )
+	{
+		slab = mapped_data;
+	}
+#endif
+	if( slab == NULL )
+	{
+		/* Transparent huge pages require the slab to be aligned to the huge page size
+		 * hence twice the slab size is mapped and the unaligned parts are unmapped
+		 */
+		mapped_data = (uint8_t *) mmap(
+		                           NULL,
+		                           2 * LIBEVTX_BUFFER_POOL_SLAB_SIZE,
+		                           PROT_READ | PROT_WRITE,
+		                           MAP_PRIVATE | MAP_ANONYMOUS,
+		                           -1,
+		                           0 );
+
+		if( mapped_data != (uint8_t *) MAP_FAILED )
+		{
+			alignment_size = (size_t) ( (intptr_t) mapped_data % LIBEVTX_BUFFER_POOL_SLAB_SIZE );
+
+			if( alignment_size != 0 )
+			{
+				alignment_size = LIBEVTX_BUFFER_POOL_SLAB_SIZE - alignment_size;
+
+				munmap(
+				 (void *) mapped_data,
+				 alignment_size );
+			}
+			slab = &( mapped_data[ alignment_size ] );
+
+			munmap(
+			 (void *) &( slab[ LIBEVTX_BUFFER_POOL_SLAB_SIZE ] ),
+			 LIBEVTX_BUFFER_POOL_SLAB_SIZE - alignment_size );
+
+#if defined( HAVE_MADVISE ) && defined( MADV_HUGEPAGE )
+			/* Transparent huge pages that are disabled by the system administrator
+			 * are not considered an error
+			 */
+			madvise(
+			 (void *) slab,
+			 LIBEVTX_BUFFER_POOL_SLAB_SIZE,
+			 MADV_HUGEPAGE );
+#endif
+		}
+	}
+#else
+	slab = (uint8_t *) memory_allocate(
+	                    LIBEVTX_BUFFER_POOL_SLAB_SIZE );
+#endif
+	if( slab == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slab.",
+		 function );
+
+		goto on_error;
+	}
+	reallocation = (uint8_t **) memory_reallocate(
+	                             buffer_pool->slabs,
+	                             sizeof( uint8_t * ) * ( buffer_pool->number_of_slabs + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize slabs.",
+		 function );
+
+		goto on_error;
+	}
+	buffer_pool->slabs = reallocation;
+
+	reallocation = (uint8_t **) memory_reallocate(
+	                             buffer_pool->slab_buffers,
+	                             sizeof( uint8_t * ) * ( buffer_pool->number_of_slabs + 1 ) * buffer_pool->number_of_buffers_per_slab );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize slab buffers.",
+		 function );
+
+		goto on_error;
+	}
+	buffer_pool->slab_buffers = reallocation;
+
+	buffer_pool->slabs[ buffer_pool->number_of_slabs ] = slab;
+
+	buffer_pool->number_of_slabs += 1;
+
+	for( buffer_index = 0;
+	     buffer_index < buffer_pool->number_of_buffers_per_slab;
+	     buffer_index++ )
+	{
+		buffer_pool->slab_buffers[ buffer_pool->number_of_slab_buffers ] = &( slab[ buffer_index * buffer_pool->buffer_size ] );
+
+		buffer_pool->number_of_slab_buffers += 1;
+	}
+	return( 1 );
+
+on_error:
+	if( slab != NULL )
+	{
+		libevtx_buffer_pool_free_slab(
+		 &slab,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a large page slab
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_free_slab(
+     uint8_t **slab,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_free_slab";
+	int result            = 1;
+
+	if( slab == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab.",
+		 function );
+
+		return( -1 );
+	}
+	if( *slab != NULL )
+	{
+#if defined( WINAPI )
+		if( VirtualFree(
+		     (LPVOID) *slab,
+		     0,
+		     MEM_RELEASE ) == 0 )
+		{
+			result = -1;
+		}
+#elif defined( HAVE_LIBEVTX_BUFFER_POOL_MMAP )
+		if( munmap(
+		     (void *) *slab,
+		     LIBEVTX_BUFFER_POOL_SLAB_SIZE ) != 0 )
+		{
+			result = -1;
+		}
+#else
+		memory_free(
+		 *slab );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_GENERIC,
+			 "%s: unable to release slab memory.",
+			 function );
+		}
+		*slab = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a buffer from the pool
+ * A new buffer is allocated if no buffer is available for reuse, when large pages
+ * are used a new slab is allocated and a buffer is allocated from the heap only
+ * if the slab cannot be allocated
+ * The buffer must be returned with libevtx_buffer_pool_release_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_get_buffer(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_get_buffer";
+	int result            = 1;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( buffer_pool->number_of_slab_buffers == 0 )
+	 && ( buffer_pool->number_of_buffers == 0 )
+	 && ( buffer_pool->use_large_pages != 0 ) )
+	{
+		/* The buffer is allocated from the heap if the slab cannot be allocated
+		 */
+		libevtx_buffer_pool_allocate_slab(
+		 buffer_pool,
+		 NULL );
+	}
+	if( buffer_pool->number_of_slab_buffers > 0 )
+	{
+		buffer_pool->number_of_slab_buffers -= 1;
+
+		*buffer = buffer_pool->slab_buffers[ buffer_pool->number_of_slab_buffers ];
+
+		buffer_pool->slab_buffers[ buffer_pool->number_of_slab_buffers ] = NULL;
+	}
+	else if( buffer_pool->number_of_buffers > 0 )
+	{
+		buffer_pool->number_of_buffers -= 1;
+
+		*buffer = buffer_pool->buffers[ buffer_pool->number_of_buffers ];
+
+		buffer_pool->buffers[ buffer_pool->number_of_buffers ] = NULL;
+	}
+	else
+	{
+		*buffer = (uint8_t *) memory_allocate(
+		                       buffer_pool->buffer_size );
+
+		if( *buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Returns a buffer to the pool
+ * A buffer of a slab is always retained, another buffer is freed if the pool
+ * already retains its maximum number of buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_release_buffer(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_release_buffer";
+	int result            = 1;
+	int slab_index        = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( slab_index = 0;
+	     slab_index < buffer_pool->number_of_slabs;
+	     slab_index++ )
+	{
+		if( ( *buffer >= buffer_pool->slabs[ slab_index ] )
+		 && ( *buffer < &( buffer_pool->slabs[ slab_index ][ LIBEVTX_BUFFER_POOL_SLAB_SIZE ] ) ) )
+		{
+			break;
+		}
+	}
+	if( slab_index < buffer_pool->number_of_slabs )
+	{
+		if( buffer_pool->number_of_slab_buffers >= ( buffer_pool->number_of_slabs * buffer_pool->number_of_buffers_per_slab ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer pool - number of slab buffers value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			buffer_pool->slab_buffers[ buffer_pool->number_of_slab_buffers ] = *buffer;
+
+			buffer_pool->number_of_slab_buffers += 1;
+		}
+	}
+	else if( buffer_pool->number_of_buffers < buffer_pool->maximum_number_of_buffers )
+	{
+		buffer_pool->buffers[ buffer_pool->number_of_buffers ] = *buffer;
+
+		buffer_pool->number_of_buffers += 1;
+	}
+	else
+	{
+		memory_free(
+		 *buffer );
+	}
+	*buffer = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the maximum number of buffers retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_get_maximum_number_of_buffers(
+     libevtx_buffer_pool_t *buffer_pool,
+     int *maximum_number_of_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_get_maximum_number_of_buffers";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of buffers.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_number_of_buffers = buffer_pool->maximum_number_of_buffers;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of buffers retained for reuse
+ * Buffers that exceed the new maximum are freed, this does not apply to the buffers of slabs
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_set_maximum_number_of_buffers(
+     libevtx_buffer_pool_t *buffer_pool,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error )
+{
+	uint8_t **reallocation = NULL;
+	static char *function  = "libevtx_buffer_pool_set_maximum_number_of_buffers";
+	int buffer_index       = 0;
+	int result             = 1;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_buffers < 0 )
+	 || ( (size_t) maximum_number_of_buffers > ( (size_t) SSIZE_MAX / sizeof( uint8_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( buffer_index = maximum_number_of_buffers;
+	     buffer_index < buffer_pool->number_of_buffers;
+	     buffer_index++ )
+	{
+		memory_free(
+		 buffer_pool->buffers[ buffer_index ] );
+
+		buffer_pool->buffers[ buffer_index ] = NULL;
+	}
+	if( buffer_pool->number_of_buffers > maximum_number_of_buffers )
+	{
+		buffer_pool->number_of_buffers = maximum_number_of_buffers;
+	}
+	if( maximum_number_of_buffers == 0 )
+	{
+		if( buffer_pool->buffers != NULL )
+		{
+			memory_free(
+			 buffer_pool->buffers );
+
+			buffer_pool->buffers = NULL;
+		}
+	}
+	else if( maximum_number_of_buffers != buffer_pool->maximum_number_of_buffers )
+	{
+		reallocation = (uint8_t **) memory_reallocate(
+		                             buffer_pool->buffers,
+		                             sizeof( uint8_t * ) * maximum_number_of_buffers );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffers.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			buffer_pool->buffers = reallocation;
+		}
+	}
+	if( result == 1 )
+	{
+		buffer_pool->maximum_number_of_buffers = maximum_number_of_buffers;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the value to indicate new buffers are carved from large page slabs
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_get_use_large_pages(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t *use_large_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_get_use_large_pages";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( use_large_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid use large pages.",
+		 function );
+
+		return( -1 );
+	}
+	*use_large_pages = buffer_pool->use_large_pages;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate new buffers are carved from large page slabs
+ * Slabs that were already allocated are retained until the pool is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_buffer_pool_set_use_large_pages(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t use_large_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_buffer_pool_set_use_large_pages";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( use_large_pages != 0 )
+	 && ( buffer_pool->number_of_buffers_per_slab == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported buffer size exceeds slab size.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_pool->use_large_pages = use_large_pages;
+
+	return( 1 );
+}
+
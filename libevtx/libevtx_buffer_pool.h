@@ -0,0 +1,145 @@
+/*
+ * Buffer pool functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_BUFFER_POOL_H )
+#define _LIBEVTX_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a large page slab, which is the size of a huge page on x86-64
+ */
+#define LIBEVTX_BUFFER_POOL_SLAB_SIZE		( 2 * 1024 * 1024 )
+
+typedef struct libevtx_buffer_pool libevtx_buffer_pool_t;
+
+struct libevtx_buffer_pool
+{
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffers available for reuse
+	 */
+	uint8_t **buffers;
+
+	/* The number of buffers available for reuse
+	 */
+	int number_of_buffers;
+
+	/* The maximum number of buffers retained for reuse
+	 */
+	int maximum_number_of_buffers;
+
+	/* Value to indicate new buffers are carved from large page slabs
+	 */
+	uint8_t use_large_pages;
+
+	/* The large page slabs
+	 */
+	uint8_t **slabs;
+
+	/* The number of large page slabs
+	 */
+	int number_of_slabs;
+
+	/* The number of buffers per large page slab
+	 */
+	int number_of_buffers_per_slab;
+
+	/* The slab buffers available for reuse
+	 * Buffers carved from a slab are always retained since they cannot be freed individually
+	 */
+	uint8_t **slab_buffers;
+
+	/* The number of slab buffers available for reuse
+	 */
+	int number_of_slab_buffers;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the buffers
+	 * A chunk evicted from a shared chunk cache can release its buffer from another thread
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevtx_buffer_pool_initialize(
+     libevtx_buffer_pool_t **buffer_pool,
+     size_t buffer_size,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_free(
+     libevtx_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_allocate_slab(
+     libevtx_buffer_pool_t *buffer_pool,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_free_slab(
+     uint8_t **slab,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_get_buffer(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_release_buffer(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_get_maximum_number_of_buffers(
+     libevtx_buffer_pool_t *buffer_pool,
+     int *maximum_number_of_buffers,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_set_maximum_number_of_buffers(
+     libevtx_buffer_pool_t *buffer_pool,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_get_use_large_pages(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t *use_large_pages,
+     libcerror_error_t **error );
+
+int libevtx_buffer_pool_set_use_large_pages(
+     libevtx_buffer_pool_t *buffer_pool,
+     uint8_t use_large_pages,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_BUFFER_POOL_H ) */
+
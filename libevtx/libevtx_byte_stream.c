@@ -26,7 +26,19 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_types.h"
 
+#if defined( LIBEVTX_BYTE_STREAM_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( LIBEVTX_BYTE_STREAM_HAVE_SSE2 )
+#include <emmintrin.h>
+
+#elif defined( LIBEVTX_BYTE_STREAM_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
 /* Checks if a byte stream is filled with 0-byte values
+ * The byte stream is checked 128 (AVX2) or 64 (SSE2 or NEON) bytes at a time if available at compile time
  * Returns 1 if true, 0 if not or -1 on error
  */
 int libevtx_byte_stream_check_for_zero_byte_fill(
@@ -38,6 +50,16 @@ int libevtx_byte_stream_check_for_zero_byte_fill(
 	uint8_t *byte_stream_index                   = NULL;
 	static char *function                        = "libevtx_byte_stream_check_for_zero_byte_fill";
 
+#if defined( LIBEVTX_BYTE_STREAM_HAVE_AVX2 )
+	__m256i stream_vector_256bit                 = _mm256_setzero_si256();
+
+#elif defined( LIBEVTX_BYTE_STREAM_HAVE_SSE2 )
+	__m128i stream_vector                        = _mm_setzero_si128();
+
+#elif defined( LIBEVTX_BYTE_STREAM_HAVE_NEON )
+	uint8x16_t stream_vector                     = vdupq_n_u8( 0 );
+#endif
+
 	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
@@ -62,6 +84,82 @@ int libevtx_byte_stream_check_for_zero_byte_fill(
 	}
 	byte_stream_index = (uint8_t *) byte_stream;
 
+	/* The vectors of a block are combined so that only a single test
+	 * is needed per block
+	 */
+#if defined( LIBEVTX_BYTE_STREAM_HAVE_AVX2 )
+	while( byte_stream_size >= 128 )
+	{
+		stream_vector_256bit = _mm256_or_si256(
+		                        _mm256_or_si256(
+		                         _mm256_loadu_si256(
+		                          (const __m256i *) byte_stream_index ),
+		                         _mm256_loadu_si256(
+		                          (const __m256i *) &( byte_stream_index[ 32 ] ) ) ),
+		                        _mm256_or_si256(
+		                         _mm256_loadu_si256(
+		                          (const __m256i *) &( byte_stream_index[ 64 ] ) ),
+		                         _mm256_loadu_si256(
+		                          (const __m256i *) &( byte_stream_index[ 96 ] ) ) ) );
+
+		if( _mm256_testz_si256(
+		     stream_vector_256bit,
+		     stream_vector_256bit ) == 0 )
+		{
+			return( 0 );
+		}
+		byte_stream_index += 128;
+		byte_stream_size  -= 128;
+	}
+#elif defined( LIBEVTX_BYTE_STREAM_HAVE_SSE2 )
+	while( byte_stream_size >= 64 )
+	{
+		stream_vector = _mm_or_si128(
+		                 _mm_or_si128(
+		                  _mm_loadu_si128(
+		                   (const __m128i *) byte_stream_index ),
+		                  _mm_loadu_si128(
+		                   (const __m128i *) &( byte_stream_index[ 16 ] ) ) ),
+		                 _mm_or_si128(
+		                  _mm_loadu_si128(
+		                   (const __m128i *) &( byte_stream_index[ 32 ] ) ),
+		                  _mm_loadu_si128(
+		                   (const __m128i *) &( byte_stream_index[ 48 ] ) ) ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      stream_vector,
+		      _mm_setzero_si128() ) ) != 0xffff )
+		{
+			return( 0 );
+		}
+		byte_stream_index += 64;
+		byte_stream_size  -= 64;
+	}
+#elif defined( LIBEVTX_BYTE_STREAM_HAVE_NEON )
+	while( byte_stream_size >= 64 )
+	{
+		stream_vector = vorrq_u8(
+		                 vorrq_u8(
+		                  vld1q_u8(
+		                   byte_stream_index ),
+		                  vld1q_u8(
+		                   &( byte_stream_index[ 16 ] ) ) ),
+		                 vorrq_u8(
+		                  vld1q_u8(
+		                   &( byte_stream_index[ 32 ] ) ),
+		                  vld1q_u8(
+		                   &( byte_stream_index[ 48 ] ) ) ) );
+
+		if( vmaxvq_u8(
+		     stream_vector ) != 0 )
+		{
+			return( 0 );
+		}
+		byte_stream_index += 64;
+		byte_stream_size  -= 64;
+	}
+#endif
 	/* Only optimize for byte stream larger than the alignment
 	 */
 	if( byte_stream_size > ( 2 * sizeof( libevtx_aligned_t ) ) )
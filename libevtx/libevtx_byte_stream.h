@@ -31,6 +31,20 @@
 extern "C" {
 #endif
 
+/* The vector instructions used to check for 0-byte fill, determined at compile time
+ */
+#if defined( __AVX2__ )
+#define LIBEVTX_BYTE_STREAM_HAVE_AVX2
+#endif
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEVTX_BYTE_STREAM_HAVE_SSE2
+#endif
+
+#if defined( __ARM_NEON ) && defined( __aarch64__ )
+#define LIBEVTX_BYTE_STREAM_HAVE_NEON
+#endif
+
 int libevtx_byte_stream_check_for_zero_byte_fill(
      const uint8_t *data,
      size_t data_size,
@@ -0,0 +1,1578 @@
+/*
+ * Shared chunk cache functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_cache.h"
+#include "libevtx_chunk.h"
+#include "libevtx_definitions.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+/* Creates a shared chunk cache
+ * The cache retains the chunks of the files attached to it up to the maximum size,
+ * the least recently used chunks are evicted first
+ * Make sure the value cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_cache_initialize(
+     libevtx_cache_t **cache,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_cache_t *internal_cache = NULL;
+	static char *function                    = "libevtx_cache_initialize";
+	size64_t number_of_chunks                = 0;
+	int bucket_index                         = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = memory_allocate_structure(
+	                  libevtx_internal_cache_t );
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache,
+	     0,
+	     sizeof( libevtx_internal_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache.",
+		 function );
+
+		memory_free(
+		 internal_cache );
+
+		return( -1 );
+	}
+	number_of_chunks = maximum_size / ( 64 * 1024 );
+
+	internal_cache->number_of_buckets = LIBEVTX_CACHE_MINIMUM_NUMBER_OF_BUCKETS;
+
+	while( ( internal_cache->number_of_buckets < LIBEVTX_CACHE_MAXIMUM_NUMBER_OF_BUCKETS )
+	    && ( (size64_t) internal_cache->number_of_buckets < number_of_chunks ) )
+	{
+		internal_cache->number_of_buckets *= 2;
+	}
+	internal_cache->buckets = (int *) memory_allocate(
+	                                   sizeof( int ) * internal_cache->number_of_buckets );
+
+	if( internal_cache->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < internal_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		internal_cache->buckets[ bucket_index ] = -1;
+	}
+	internal_cache->maximum_size     = maximum_size;
+	internal_cache->free_entry_index = -1;
+
+	if( libevtx_template_cache_initialize(
+	     &( internal_cache->template_cache ),
+	     LIBEVTX_DEFAULT_NUMBER_OF_CACHED_TEMPLATES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template cache.",
+		 function );
+
+		goto on_error;
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_cache->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*cache = (libevtx_cache_t *) internal_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_cache != NULL )
+	{
+		if( internal_cache->template_cache != NULL )
+		{
+			libevtx_template_cache_free(
+			 &( internal_cache->template_cache ),
+			 NULL );
+		}
+		if( internal_cache->buckets != NULL )
+		{
+			memory_free(
+			 internal_cache->buckets );
+		}
+		memory_free(
+		 internal_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a shared chunk cache
+ * The files attached to the cache must be closed before the cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_cache_free(
+     libevtx_cache_t **cache,
+     libcerror_error_t **error )
+{
+	libevtx_internal_cache_t *internal_cache = NULL;
+	static char *function                    = "libevtx_cache_free";
+	int entry_index                          = 0;
+	int result                               = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		internal_cache = (libevtx_internal_cache_t *) *cache;
+
+		if( internal_cache->number_of_attached_files != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid cache - %d files still attached.",
+			 function,
+			 internal_cache->number_of_attached_files );
+
+			return( -1 );
+		}
+		*cache = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_cache->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_cache->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < internal_cache->number_of_entries;
+			     entry_index++ )
+			{
+				if( internal_cache->entries[ entry_index ].chunk != NULL )
+				{
+					if( libevtx_chunk_free(
+					     &( internal_cache->entries[ entry_index ].chunk ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free chunk of entry: %d.",
+						 function,
+						 entry_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 internal_cache->entries );
+		}
+		if( internal_cache->buckets != NULL )
+		{
+			memory_free(
+			 internal_cache->buckets );
+		}
+		if( internal_cache->pinned_entry_indexes != NULL )
+		{
+			memory_free(
+			 internal_cache->pinned_entry_indexes );
+		}
+		if( libevtx_template_cache_free(
+		     &( internal_cache->template_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_cache );
+	}
+	return( result );
+}
+
+/* Grabs the cache mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_grab(
+     libevtx_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_cache_grab";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the cache mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_release(
+     libevtx_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_cache_release";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum size of the cached chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_cache_get_maximum_size(
+     libevtx_cache_t *cache,
+     size64_t *maximum_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_cache_t *internal_cache = NULL;
+	static char *function                    = "libevtx_cache_get_maximum_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libevtx_internal_cache_t *) cache;
+
+	if( maximum_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_size = internal_cache->maximum_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the cached chunks
+ * The size can exceed the maximum size while the chunks in use by the files cannot be evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_cache_get_size(
+     libevtx_cache_t *cache,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_cache_t *internal_cache = NULL;
+	static char *function                    = "libevtx_cache_get_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libevtx_internal_cache_t *) cache;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_cache_grab(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab cache.",
+		 function );
+
+		return( -1 );
+	}
+	*size = internal_cache->size;
+
+	if( libevtx_internal_cache_release(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of cached chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_cache_get_number_of_chunks(
+     libevtx_cache_t *cache,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	libevtx_internal_cache_t *internal_cache = NULL;
+	static char *function                    = "libevtx_cache_get_number_of_chunks";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libevtx_internal_cache_t *) cache;
+
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_cache_grab(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab cache.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = internal_cache->number_of_used_entries;
+
+	if( libevtx_internal_cache_release(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the hash bucket of a chunk
+ * Returns the bucket index
+ */
+int libevtx_internal_cache_get_bucket_index(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index )
+{
+	uint32_t hash = 0;
+
+	hash   = ( (uint32_t) file_identifier << 16 ) | chunk_index;
+	hash  *= 0x9e3779b1UL;
+	hash  ^= hash >> 16;
+
+	return( (int) ( hash & (uint32_t) ( internal_cache->number_of_buckets - 1 ) ) );
+}
+
+/* Determines the size of a chunk in memory
+ * Memory mapped chunk data is not accounted for since it is owned by the IO handle
+ * Returns the size of the chunk
+ */
+size_t libevtx_internal_cache_get_chunk_size(
+        libevtx_chunk_t *chunk )
+{
+	size_t chunk_size = 0;
+
+	chunk_size = sizeof( libevtx_chunk_t )
+	           + ( (size_t) chunk->records_table_size * ( ( 2 * sizeof( uint32_t ) ) + ( 2 * sizeof( uint64_t ) ) + sizeof( libevtx_record_values_t * ) ) );
+
+	if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_DATA_IS_MAPPED ) == 0 )
+	{
+		chunk_size += chunk->data_size;
+	}
+	return( chunk_size );
+}
+
+/* Finds the entry of a chunk
+ * The cache must be grabbed by the caller
+ * Returns the entry index or -1 if not available
+ */
+int libevtx_internal_cache_find_entry(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index )
+{
+	libevtx_cache_entry_t *entry = NULL;
+	int entry_index              = 0;
+
+	entry_index = internal_cache->buckets[ libevtx_internal_cache_get_bucket_index(
+	                                        internal_cache,
+	                                        file_identifier,
+	                                        chunk_index ) ];
+
+	while( entry_index != -1 )
+	{
+		entry = &( internal_cache->entries[ entry_index ] );
+
+		if( ( entry->file_identifier == file_identifier )
+		 && ( entry->chunk_index == chunk_index ) )
+		{
+			break;
+		}
+		entry_index = entry->next_entry_index;
+	}
+	return( entry_index );
+}
+
+/* Removes an entry and frees its chunk
+ * The cache must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_remove_entry(
+     libevtx_internal_cache_t *internal_cache,
+     int entry_index,
+     int requesting_file_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_cache_entry_t *entry = NULL;
+	static char *function        = "libevtx_internal_cache_remove_entry";
+	int bucket_index             = 0;
+	int previous_entry_index     = -1;
+	int search_entry_index       = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_cache->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_cache->entries[ entry_index ] );
+
+	bucket_index = libevtx_internal_cache_get_bucket_index(
+	                internal_cache,
+	                entry->file_identifier,
+	                entry->chunk_index );
+
+	search_entry_index = internal_cache->buckets[ bucket_index ];
+
+	while( ( search_entry_index != -1 )
+	    && ( search_entry_index != entry_index ) )
+	{
+		previous_entry_index = search_entry_index;
+		search_entry_index   = internal_cache->entries[ search_entry_index ].next_entry_index;
+	}
+	if( search_entry_index != entry_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d in bucket: %d.",
+		 function,
+		 entry_index,
+		 bucket_index );
+
+		return( -1 );
+	}
+	if( previous_entry_index == -1 )
+	{
+		internal_cache->buckets[ bucket_index ] = entry->next_entry_index;
+	}
+	else
+	{
+		internal_cache->entries[ previous_entry_index ].next_entry_index = entry->next_entry_index;
+	}
+	/* The arena pool of the IO handle of another file cannot be accessed
+	 * since the other file can be used by another thread, the buffer pool
+	 * is protected by its own mutex and must be accessed since the chunk data
+	 * can be carved from one of its slabs
+	 */
+	if( entry->file_identifier != requesting_file_identifier )
+	{
+		entry->chunk->arena_pool = NULL;
+	}
+	internal_cache->size -= entry->size;
+
+	internal_cache->number_of_used_entries -= 1;
+
+	entry->next_entry_index          = internal_cache->free_entry_index;
+	internal_cache->free_entry_index = entry_index;
+
+	if( libevtx_chunk_free(
+	     &( entry->chunk ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Evicts chunks until the additional size fits within the maximum size
+ * The clock hand passes over the entries and evicts the first entry that
+ * was not referenced since the last pass, entries pinned by a file are skipped
+ * The cache must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_evict(
+     libevtx_internal_cache_t *internal_cache,
+     size_t additional_size,
+     int requesting_file_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_cache_entry_t *entry = NULL;
+	static char *function        = "libevtx_internal_cache_evict";
+	int entry_index              = 0;
+	int number_of_iterations     = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* Two passes are sufficient to clear the referenced flags and evict,
+	 * if no entry is evicted within these the remaining entries are pinned
+	 */
+	while( ( internal_cache->number_of_used_entries > 0 )
+	    && ( ( internal_cache->size + additional_size ) > internal_cache->maximum_size )
+	    && ( number_of_iterations < ( 2 * internal_cache->number_of_entries ) ) )
+	{
+		if( internal_cache->clock_hand >= internal_cache->number_of_entries )
+		{
+			internal_cache->clock_hand = 0;
+		}
+		entry_index = internal_cache->clock_hand;
+		entry       = &( internal_cache->entries[ entry_index ] );
+
+		internal_cache->clock_hand += 1;
+
+		number_of_iterations++;
+
+		if( entry->chunk == NULL )
+		{
+			continue;
+		}
+		if( internal_cache->pinned_entry_indexes[ entry->file_identifier ] == entry_index )
+		{
+			continue;
+		}
+		if( entry->is_referenced != 0 )
+		{
+			entry->is_referenced = 0;
+
+			continue;
+		}
+		if( libevtx_internal_cache_remove_entry(
+		     internal_cache,
+		     entry_index,
+		     requesting_file_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		number_of_iterations = 0;
+	}
+	return( 1 );
+}
+
+/* Appends an entry for a chunk
+ * The cache takes over management of the chunk
+ * The cache must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_append_entry(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libevtx_cache_entry_t *entry = NULL;
+	void *reallocation           = NULL;
+	static char *function        = "libevtx_internal_cache_append_entry";
+	size_t chunk_size            = 0;
+	int bucket_index             = 0;
+	int number_of_entries        = 0;
+	int safe_entry_index         = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_cache_find_entry(
+	     internal_cache,
+	     file_identifier,
+	     chunk_index ) != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache - chunk: %" PRIu16 " of file: %d already cached.",
+		 function,
+		 chunk_index,
+		 file_identifier );
+
+		return( -1 );
+	}
+	chunk_size = libevtx_internal_cache_get_chunk_size(
+	              chunk );
+
+	if( libevtx_internal_cache_evict(
+	     internal_cache,
+	     chunk_size,
+	     file_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->free_entry_index == -1 )
+	{
+		if( internal_cache->number_of_entries == 0 )
+		{
+			number_of_entries = 16;
+		}
+		else if( internal_cache->number_of_entries < ( INT_MAX / 2 ) )
+		{
+			number_of_entries = internal_cache->number_of_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid cache - number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_cache->entries,
+		                sizeof( libevtx_cache_entry_t ) * number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_cache->entries = (libevtx_cache_entry_t *) reallocation;
+
+		if( memory_set(
+		     &( internal_cache->entries[ internal_cache->number_of_entries ] ),
+		     0,
+		     sizeof( libevtx_cache_entry_t ) * ( number_of_entries - internal_cache->number_of_entries ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			return( -1 );
+		}
+		/* Link the new entries into the free entries list in order
+		 */
+		for( safe_entry_index = number_of_entries - 1;
+		     safe_entry_index >= internal_cache->number_of_entries;
+		     safe_entry_index-- )
+		{
+			internal_cache->entries[ safe_entry_index ].next_entry_index = internal_cache->free_entry_index;
+			internal_cache->free_entry_index                             = safe_entry_index;
+		}
+		internal_cache->number_of_entries = number_of_entries;
+	}
+	safe_entry_index = internal_cache->free_entry_index;
+	entry            = &( internal_cache->entries[ safe_entry_index ] );
+
+	internal_cache->free_entry_index = entry->next_entry_index;
+
+	bucket_index = libevtx_internal_cache_get_bucket_index(
+	                internal_cache,
+	                file_identifier,
+	                chunk_index );
+
+	entry->chunk            = chunk;
+	entry->size             = chunk_size;
+	entry->file_identifier  = file_identifier;
+	entry->chunk_index      = chunk_index;
+	entry->is_referenced    = 1;
+	entry->next_entry_index = internal_cache->buckets[ bucket_index ];
+
+	internal_cache->buckets[ bucket_index ] = safe_entry_index;
+
+	internal_cache->size                   += chunk_size;
+	internal_cache->number_of_used_entries += 1;
+
+	*entry_index = safe_entry_index;
+
+	return( 1 );
+}
+
+/* Attaches a file to the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_attach_file(
+     libevtx_internal_cache_t *internal_cache,
+     int *file_identifier,
+     libcerror_error_t **error )
+{
+	void *reallocation       = NULL;
+	static char *function    = "libevtx_internal_cache_attach_file";
+	int file_slot_index      = 0;
+	int number_of_file_slots = 0;
+	int result               = 1;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_cache_grab(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_slot_index = 0;
+	     file_slot_index < internal_cache->number_of_file_slots;
+	     file_slot_index++ )
+	{
+		if( internal_cache->pinned_entry_indexes[ file_slot_index ] == LIBEVTX_CACHE_FILE_SLOT_UNUSED )
+		{
+			break;
+		}
+	}
+	if( file_slot_index >= internal_cache->number_of_file_slots )
+	{
+		number_of_file_slots = internal_cache->number_of_file_slots + 8;
+
+		/* The file identifier is stored in the upper bits of the bucket hash
+		 */
+		if( number_of_file_slots > (int) UINT16_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid cache - number of file slots value exceeds maximum.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			reallocation = memory_reallocate(
+			                internal_cache->pinned_entry_indexes,
+			                sizeof( int ) * number_of_file_slots );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize pinned entry indexes.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				internal_cache->pinned_entry_indexes = (int *) reallocation;
+
+				while( internal_cache->number_of_file_slots < number_of_file_slots )
+				{
+					internal_cache->pinned_entry_indexes[ internal_cache->number_of_file_slots ] = LIBEVTX_CACHE_FILE_SLOT_UNUSED;
+
+					internal_cache->number_of_file_slots += 1;
+				}
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_cache->pinned_entry_indexes[ file_slot_index ] = -1;
+
+		internal_cache->number_of_attached_files += 1;
+
+		*file_identifier = file_slot_index;
+	}
+	if( libevtx_internal_cache_release(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Removes the chunks of a file
+ * The cache must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_remove_file_entries(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_cache_remove_file_entries";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_identifier < 0 )
+	 || ( file_identifier >= internal_cache->number_of_file_slots )
+	 || ( internal_cache->pinned_entry_indexes[ file_identifier ] == LIBEVTX_CACHE_FILE_SLOT_UNUSED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file identifier value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache->pinned_entry_indexes[ file_identifier ] = -1;
+
+	for( entry_index = 0;
+	     entry_index < internal_cache->number_of_entries;
+	     entry_index++ )
+	{
+		if( ( internal_cache->entries[ entry_index ].chunk != NULL )
+		 && ( internal_cache->entries[ entry_index ].file_identifier == file_identifier ) )
+		{
+			if( libevtx_internal_cache_remove_entry(
+			     internal_cache,
+			     entry_index,
+			     file_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove entry: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Detaches a file from the cache
+ * The chunks of the file are removed from the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_detach_file(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_cache_detach_file";
+	int result            = 1;
+
+	if( libevtx_internal_cache_grab(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_cache_remove_file_entries(
+	     internal_cache,
+	     file_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove chunks of file: %d.",
+		 function,
+		 file_identifier );
+
+		result = -1;
+	}
+	else
+	{
+		internal_cache->pinned_entry_indexes[ file_identifier ] = LIBEVTX_CACHE_FILE_SLOT_UNUSED;
+
+		internal_cache->number_of_attached_files -= 1;
+	}
+	if( libevtx_internal_cache_release(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Removes the chunks of a file from the cache
+ * Used when the cached chunks of the file have become outdated
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_remove_file_chunks(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_cache_remove_file_chunks";
+	int result            = 1;
+
+	if( libevtx_internal_cache_grab(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_cache_remove_file_entries(
+	     internal_cache,
+	     file_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove chunks of file: %d.",
+		 function,
+		 file_identifier );
+
+		result = -1;
+	}
+	if( libevtx_internal_cache_release(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific chunk of a file, the chunk is read if not cached
+ * The chunk is pinned for the file, hence it is not evicted and remains valid
+ * until the next chunk of the file is retrieved or the file is detached
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_get_chunk_by_index(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *safe_chunk = NULL;
+	static char *function       = "libevtx_internal_cache_get_chunk_by_index";
+	off64_t chunk_offset        = 0;
+	int entry_index             = 0;
+	int result                  = 1;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_cache_grab(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_identifier < 0 )
+	 || ( file_identifier >= internal_cache->number_of_file_slots )
+	 || ( internal_cache->pinned_entry_indexes[ file_identifier ] == LIBEVTX_CACHE_FILE_SLOT_UNUSED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file identifier value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The previously retrieved chunk of the file is no longer in use
+		 */
+		internal_cache->pinned_entry_indexes[ file_identifier ] = -1;
+
+		entry_index = libevtx_internal_cache_find_entry(
+		               internal_cache,
+		               file_identifier,
+		               chunk_index );
+
+		if( entry_index != -1 )
+		{
+			internal_cache->entries[ entry_index ].is_referenced = 1;
+
+			internal_cache->pinned_entry_indexes[ file_identifier ] = entry_index;
+
+			*chunk = internal_cache->entries[ entry_index ].chunk;
+		}
+	}
+	if( libevtx_internal_cache_release(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result != 1 )
+	 || ( entry_index != -1 ) )
+	{
+		return( result );
+	}
+	/* The chunk is read without holding the cache so that other files
+	 * can access the cache, the chunks of a file are not retrieved concurrently
+	 */
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_chunk_cache_misses,
+	 1 );
+
+	chunk_offset = io_handle->chunks_data_offset
+	             + ( (off64_t) chunk_index * io_handle->chunk_size );
+
+	if( libevtx_chunk_initialize(
+	     &safe_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_chunk_read(
+	     safe_chunk,
+	     io_handle,
+	     file_io_handle,
+	     chunk_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	if( libevtx_internal_cache_insert_chunk(
+	     internal_cache,
+	     file_identifier,
+	     chunk_index,
+	     safe_chunk,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert chunk: %" PRIu16 " in cache.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	*chunk = safe_chunk;
+
+	return( 1 );
+
+on_error:
+	if( safe_chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &safe_chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Inserts a chunk of a file
+ * The cache takes over management of the chunk if successful
+ * If pin_chunk is set the chunk is pinned for the file until the next chunk of the file is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_cache_insert_chunk(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     uint8_t pin_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_cache_insert_chunk";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( libevtx_internal_cache_grab(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_identifier < 0 )
+	 || ( file_identifier >= internal_cache->number_of_file_slots )
+	 || ( internal_cache->pinned_entry_indexes[ file_identifier ] == LIBEVTX_CACHE_FILE_SLOT_UNUSED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file identifier value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( libevtx_internal_cache_append_entry(
+	          internal_cache,
+	          file_identifier,
+	          chunk_index,
+	          chunk,
+	          &entry_index,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( pin_chunk != 0 )
+	{
+		internal_cache->pinned_entry_indexes[ file_identifier ] = entry_index;
+	}
+	if( libevtx_internal_cache_release(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
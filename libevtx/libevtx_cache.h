@@ -0,0 +1,249 @@
+/*
+ * Shared chunk cache functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_CACHE_H )
+#define _LIBEVTX_INTERNAL_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_extern.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_template_cache.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_cache_entry libevtx_cache_entry_t;
+
+struct libevtx_cache_entry
+{
+	/* The chunk
+	 * Contains NULL if the entry is not used
+	 */
+	libevtx_chunk_t *chunk;
+
+	/* The size of the chunk in memory
+	 */
+	size_t size;
+
+	/* The identifier of the file the chunk belongs to
+	 */
+	int file_identifier;
+
+	/* The index of the next entry in the same hash bucket or in the free entries list
+	 */
+	int next_entry_index;
+
+	/* The chunk index
+	 */
+	uint16_t chunk_index;
+
+	/* Value to indicate the chunk was accessed since the clock hand last passed the entry
+	 */
+	uint8_t is_referenced;
+};
+
+typedef struct libevtx_internal_cache libevtx_internal_cache_t;
+
+struct libevtx_internal_cache
+{
+	/* The maximum size of the cached chunks
+	 */
+	size64_t maximum_size;
+
+	/* The size of the cached chunks
+	 */
+	size64_t size;
+
+	/* The entries
+	 */
+	libevtx_cache_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_entries;
+
+	/* The number of used entries
+	 */
+	int number_of_used_entries;
+
+	/* The index of the first free entry
+	 */
+	int free_entry_index;
+
+	/* The hash buckets
+	 * Contains the index of the first entry of every bucket
+	 */
+	int *buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The index of the entry the clock hand points to
+	 */
+	int clock_hand;
+
+	/* The indexes of the entry pinned by every attached file
+	 * A file slot contains LIBEVTX_CACHE_FILE_SLOT_UNUSED if no file is attached
+	 * or -1 if the attached file has no pinned entry
+	 */
+	int *pinned_entry_indexes;
+
+	/* The number of file slots
+	 */
+	int number_of_file_slots;
+
+	/* The number of attached files
+	 */
+	int number_of_attached_files;
+
+	/* The template cache shared by the attached files
+	 */
+	libevtx_template_cache_t *template_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBEVTX_EXTERN \
+int libevtx_cache_initialize(
+     libevtx_cache_t **cache,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_cache_free(
+     libevtx_cache_t **cache,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_cache_get_maximum_size(
+     libevtx_cache_t *cache,
+     size64_t *maximum_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_cache_get_size(
+     libevtx_cache_t *cache,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_cache_get_number_of_chunks(
+     libevtx_cache_t *cache,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_grab(
+     libevtx_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_release(
+     libevtx_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_get_bucket_index(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index );
+
+size_t libevtx_internal_cache_get_chunk_size(
+        libevtx_chunk_t *chunk );
+
+int libevtx_internal_cache_find_entry(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index );
+
+int libevtx_internal_cache_remove_entry(
+     libevtx_internal_cache_t *internal_cache,
+     int entry_index,
+     int requesting_file_identifier,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_evict(
+     libevtx_internal_cache_t *internal_cache,
+     size_t additional_size,
+     int requesting_file_identifier,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_append_entry(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_attach_file(
+     libevtx_internal_cache_t *internal_cache,
+     int *file_identifier,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_detach_file(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_remove_file_entries(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_remove_file_chunks(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_get_chunk_by_index(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int libevtx_internal_cache_insert_chunk(
+     libevtx_internal_cache_t *internal_cache,
+     int file_identifier,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     uint8_t pin_chunk,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_CACHE_H ) */
+
@@ -0,0 +1,1628 @@
+/*
+ * Carver functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libevtx_carver.h"
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_batch.h"
+#include "libevtx_codepage.h"
+#include "libevtx_definitions.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_record.h"
+#include "libevtx_record_values.h"
+
+#include "evtx_chunk.h"
+
+/* Creates a carver
+ * Make sure the value carver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_initialize(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_initialize";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = memory_allocate_structure(
+	                   libevtx_internal_carver_t );
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_carver,
+	     0,
+	     sizeof( libevtx_internal_carver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carver.",
+		 function );
+
+		memory_free(
+		 internal_carver );
+
+		return( -1 );
+	}
+	if( libevtx_io_handle_initialize(
+	     &( internal_carver->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The header checksum is validated when searching for the chunks,
+	 * the event records checksum is validated when the chunks are read
+	 */
+	internal_carver->io_handle->validation_mode = LIBEVTX_VALIDATE_FULL;
+	internal_carver->number_of_threads          = 1;
+
+	*carver = (libevtx_carver_t *) internal_carver;
+
+	return( 1 );
+
+on_error:
+	if( internal_carver != NULL )
+	{
+		memory_free(
+		 internal_carver );
+	}
+	return( -1 );
+}
+
+/* Frees a carver
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_free(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_free";
+	int result                                 = 1;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		internal_carver = (libevtx_internal_carver_t *) *carver;
+		*carver         = NULL;
+
+		if( libevtx_io_handle_free(
+		     &( internal_carver->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_carver );
+	}
+	return( result );
+}
+
+/* Signals the carver to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_signal_abort(
+     libevtx_carver_t *carver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_signal_abort";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->io_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the ASCII codepage used for the carved records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_set_ascii_codepage(
+     libevtx_carver_t *carver,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_set_ascii_codepage";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEVTX_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_io_handle_set_ascii_codepage(
+	     internal_carver->io_handle,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the number of threads used to read the chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_set_number_of_threads(
+     libevtx_carver_t *carver,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_set_number_of_threads";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEVTX_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_carver->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Carves the records from the chunks in a file
+ * Returns 1 if successful, 0 if the carving was stopped by the callback or -1 on error
+ */
+int libevtx_carver_carve_file(
+     libevtx_carver_t *carver,
+     const char *filename,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libevtx_carver_carve_file";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevtx_carver_carve_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Carves the records from the chunks in a file
+ * Returns 1 if successful, 0 if the carving was stopped by the callback or -1 on error
+ */
+int libevtx_carver_carve_file_wide(
+     libevtx_carver_t *carver,
+     const wchar_t *filename,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libevtx_carver_carve_file_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevtx_carver_carve_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Carves the records from the chunks in a file using a Basic File IO (bfio) handle
+ * The data is read sequentially in large blocks and searched for chunk headers
+ * at 512-byte alignment. The chunks with a valid header checksum are read and
+ * parsed in batches by multiple threads and their records, including the records
+ * recovered from the free space of the chunks, are passed to the callback in file order
+ * The record passed to the callback is only valid during the callback and must not be freed
+ * The callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful, 0 if the carving was stopped by the callback or -1 on error
+ */
+int libevtx_carver_carve_file_io_handle(
+     libevtx_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_batch_t *chunk_batch         = NULL;
+	libevtx_internal_carver_t *internal_carver = NULL;
+	off64_t *chunk_offsets                     = NULL;
+	uint8_t *read_buffer                       = NULL;
+	static char *function                      = "libevtx_carver_carve_file_io_handle";
+	off64_t chunk_offset                       = 0;
+	off64_t file_offset                        = 0;
+	off64_t next_chunk_offset                  = 0;
+	size64_t file_size                         = 0;
+	size_t buffer_offset                       = 0;
+	size_t read_size                           = 0;
+	ssize_t read_count                         = 0;
+	int file_io_handle_is_open                 = 0;
+	int file_io_handle_opened_in_library       = 0;
+	int number_of_chunk_offsets                = 0;
+	int result                                 = 1;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	internal_carver->io_handle->abort           = 0;
+	internal_carver->number_of_chunks           = 0;
+	internal_carver->number_of_corrupted_chunks = 0;
+	internal_carver->number_of_records          = 0;
+
+	if( libevtx_chunk_batch_initialize(
+	     &chunk_batch,
+	     internal_carver->io_handle,
+	     file_io_handle,
+	     internal_carver->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk batch.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_offsets = (off64_t *) memory_allocate(
+	                             sizeof( off64_t ) * chunk_batch->maximum_number_of_chunks );
+
+	if( chunk_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk offsets.",
+		 function );
+
+		goto on_error;
+	}
+	read_buffer = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * LIBEVTX_CARVER_READ_BUFFER_SIZE );
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunk batch reads the chunks with its own file IO handles,
+	 * so the sequential reads of the file IO handle are not disturbed
+	 */
+	while( ( result == 1 )
+	    && ( (size64_t) file_offset < file_size ) )
+	{
+		if( internal_carver->io_handle->abort != 0 )
+		{
+			break;
+		}
+		read_size = LIBEVTX_CARVER_READ_BUFFER_SIZE;
+
+		if( (size64_t) read_size > ( file_size - file_offset ) )
+		{
+			read_size = (size_t) ( file_size - file_offset );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              read_buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		for( buffer_offset = 0;
+		     ( buffer_offset + LIBEVTX_CARVER_CHUNK_ALIGNMENT ) <= read_size;
+		     buffer_offset += LIBEVTX_CARVER_CHUNK_ALIGNMENT )
+		{
+			chunk_offset = file_offset + (off64_t) buffer_offset;
+
+			/* Chunks do not overlap
+			 */
+			if( chunk_offset < next_chunk_offset )
+			{
+				continue;
+			}
+			if( (size64_t) ( chunk_offset + internal_carver->io_handle->chunk_size ) > file_size )
+			{
+				break;
+			}
+			result = libevtx_carver_check_chunk_header(
+			          &( read_buffer[ buffer_offset ] ),
+			          read_size - buffer_offset,
+			          internal_carver->io_handle->chunk_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check chunk header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				result = 1;
+
+				continue;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: found chunk at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+			}
+#endif
+			chunk_offsets[ number_of_chunk_offsets++ ] = chunk_offset;
+
+			next_chunk_offset = chunk_offset + internal_carver->io_handle->chunk_size;
+
+			if( number_of_chunk_offsets == chunk_batch->maximum_number_of_chunks )
+			{
+				result = libevtx_internal_carver_carve_chunks(
+				          internal_carver,
+				          chunk_batch,
+				          file_io_handle,
+				          chunk_offsets,
+				          number_of_chunk_offsets,
+				          callback,
+				          user_data,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to carve chunks.",
+					 function );
+
+					goto on_error;
+				}
+				number_of_chunk_offsets = 0;
+
+				if( result == 0 )
+				{
+					break;
+				}
+			}
+		}
+		file_offset += read_size;
+	}
+	if( ( result == 1 )
+	 && ( number_of_chunk_offsets > 0 )
+	 && ( internal_carver->io_handle->abort == 0 ) )
+	{
+		result = libevtx_internal_carver_carve_chunks(
+		          internal_carver,
+		          chunk_batch,
+		          file_io_handle,
+		          chunk_offsets,
+		          number_of_chunk_offsets,
+		          callback,
+		          user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to carve chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 read_buffer );
+
+	read_buffer = NULL;
+
+	memory_free(
+	 chunk_offsets );
+
+	chunk_offsets = NULL;
+
+	if( libevtx_chunk_batch_free(
+	     &chunk_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	if( chunk_offsets != NULL )
+	{
+		memory_free(
+		 chunk_offsets );
+	}
+	if( chunk_batch != NULL )
+	{
+		libevtx_chunk_batch_free(
+		 &chunk_batch,
+		 NULL );
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Checks if the data contains a chunk header
+ * The signature, header checksum, header size and free space offset are checked,
+ * so that libevtx_chunk_read does not fail on the header of a chunk that is accepted
+ * Returns 1 if the data contains a chunk header, 0 if not or -1 on error
+ */
+int libevtx_carver_check_chunk_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_carver_check_chunk_header";
+	uint32_t calculated_checksum = 0;
+	uint32_t free_space_offset   = 0;
+	uint32_t header_size         = 0;
+	uint32_t stored_checksum     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 512 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (evtx_chunk_header_t *) data )->signature,
+	     evtx_chunk_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->free_space_offset,
+	 free_space_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->checksum,
+	 stored_checksum );
+
+	if( ( header_size != 128 )
+	 || ( free_space_offset < 512 )
+	 || ( free_space_offset > chunk_size ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) &( data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the chunks at the chunk offsets and passes their records to the callback
+ * Returns 1 if successful, 0 if the carving was stopped by the callback or -1 on error
+ */
+int libevtx_internal_carver_carve_chunks(
+     libevtx_internal_carver_t *internal_carver,
+     libevtx_chunk_batch_t *chunk_batch,
+     libbfio_handle_t *file_io_handle,
+     const off64_t *chunk_offsets,
+     int number_of_chunks,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_carver_carve_chunks";
+	uint16_t number_of_records             = 0;
+	uint16_t record_index                  = 0;
+	int read_result                        = 0;
+	int result                             = 1;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_batch_read_at_offsets(
+	     chunk_batch,
+	     chunk_offsets,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk batch.",
+		 function );
+
+		goto on_error;
+	}
+	while( result == 1 )
+	{
+		if( internal_carver->io_handle->abort != 0 )
+		{
+			break;
+		}
+		result = libevtx_chunk_batch_get_next_chunk(
+		          chunk_batch,
+		          &chunk,
+		          &read_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk from batch.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = 1;
+
+			break;
+		}
+		if( read_result != 1 )
+		{
+			if( libevtx_chunk_free(
+			     &chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		internal_carver->number_of_chunks += 1;
+
+		/* The event records data of a chunk in unallocated space is often
+		 * partially overwritten, the records of the chunk are validated
+		 * individually when they are read
+		 */
+		if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+		{
+			internal_carver->number_of_corrupted_chunks += 1;
+		}
+		if( libevtx_chunk_get_number_of_records(
+		     chunk,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libevtx_chunk_get_record(
+			     chunk,
+			     record_index,
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			result = libevtx_internal_carver_carve_record(
+			          internal_carver,
+			          chunk,
+			          record_values,
+			          file_io_handle,
+			          callback,
+			          user_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to carve record: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			if( libevtx_chunk_get_number_of_recovered_records(
+			     chunk,
+			     &number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of recovered records.",
+				 function );
+
+				goto on_error;
+			}
+			for( record_index = 0;
+			     record_index < number_of_records;
+			     record_index++ )
+			{
+				if( libevtx_chunk_get_recovered_record(
+				     chunk,
+				     record_index,
+				     &record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve recovered record: %" PRIu16 ".",
+					 function,
+					 record_index );
+
+					goto on_error;
+				}
+				result = libevtx_internal_carver_carve_record(
+				          internal_carver,
+				          chunk,
+				          record_values,
+				          file_io_handle,
+				          callback,
+				          user_data,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to carve recovered record: %" PRIu16 ".",
+					 function,
+					 record_index );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+			}
+		}
+		if( libevtx_chunk_free(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Passes a record of a carved chunk to the callback
+ * Records of which the XML document cannot be read are skipped
+ * Returns 1 if successful, 0 if the carving was stopped by the callback or -1 on error
+ */
+int libevtx_internal_carver_carve_record(
+     libevtx_internal_carver_t *internal_carver,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libbfio_handle_t *file_io_handle,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function    = "libevtx_internal_carver_carve_record";
+	int callback_result      = 0;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	/* The XML document is read while the chunk data is available
+	 */
+	if( record_values->xml_document == NULL )
+	{
+		if( libevtx_record_values_read_xml_document(
+		     record_values,
+		     internal_carver->io_handle,
+		     chunk->data,
+		     chunk->data_size,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read XML document of record at offset: %" PRIi64 ".\n",
+				 function,
+				 record_values->offset );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			return( 1 );
+		}
+	}
+	/* The record values are owned by the chunk
+	 */
+	if( libevtx_record_initialize(
+	     &record,
+	     internal_carver->io_handle,
+	     file_io_handle,
+	     record_values,
+	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->number_of_records += 1;
+
+	callback_result = callback(
+	                   record,
+	                   user_data );
+
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback failed for record at offset: %" PRIi64 ".",
+		 function,
+		 record_values->offset );
+
+		return( -1 );
+	}
+	else if( callback_result == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of carved chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_get_number_of_chunks(
+     libevtx_carver_t *carver,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_get_number_of_chunks";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = internal_carver->number_of_chunks;
+
+	return( 1 );
+}
+
+/* Retrieves the number of carved chunks of which the event records checksum does not match
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_get_number_of_corrupted_chunks(
+     libevtx_carver_t *carver,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_get_number_of_corrupted_chunks";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = internal_carver->number_of_corrupted_chunks;
+
+	return( 1 );
+}
+
+/* Retrieves the number of carved records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_get_number_of_records(
+     libevtx_carver_t *carver,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_get_number_of_records";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_carver->number_of_records;
+
+	return( 1 );
+}
+
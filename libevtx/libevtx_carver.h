@@ -0,0 +1,179 @@
+/*
+ * Carver functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_CARVER_H )
+#define _LIBEVTX_INTERNAL_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_batch.h"
+#include "libevtx_extern.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_record_values.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_internal_carver libevtx_internal_carver_t;
+
+struct libevtx_internal_carver
+{
+	/* The IO handle
+	 */
+	libevtx_io_handle_t *io_handle;
+
+	/* The number of threads used to read the chunks
+	 */
+	int number_of_threads;
+
+	/* The number of carved chunks
+	 */
+	int number_of_chunks;
+
+	/* The number of carved chunks of which the event records checksum does not match
+	 */
+	int number_of_corrupted_chunks;
+
+	/* The number of carved records
+	 */
+	int number_of_records;
+};
+
+LIBEVTX_EXTERN \
+int libevtx_carver_initialize(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_free(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_signal_abort(
+     libevtx_carver_t *carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_set_ascii_codepage(
+     libevtx_carver_t *carver,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_set_number_of_threads(
+     libevtx_carver_t *carver,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_carve_file(
+     libevtx_carver_t *carver,
+     const char *filename,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_carver_carve_file_wide(
+     libevtx_carver_t *carver,
+     const wchar_t *filename,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVTX_EXTERN \
+int libevtx_carver_carve_file_io_handle(
+     libevtx_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libevtx_carver_check_chunk_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t chunk_size,
+     libcerror_error_t **error );
+
+int libevtx_internal_carver_carve_chunks(
+     libevtx_internal_carver_t *internal_carver,
+     libevtx_chunk_batch_t *chunk_batch,
+     libbfio_handle_t *file_io_handle,
+     const off64_t *chunk_offsets,
+     int number_of_chunks,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libevtx_internal_carver_carve_record(
+     libevtx_internal_carver_t *internal_carver,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libbfio_handle_t *file_io_handle,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_get_number_of_chunks(
+     libevtx_carver_t *carver,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_get_number_of_corrupted_chunks(
+     libevtx_carver_t *carver,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_get_number_of_records(
+     libevtx_carver_t *carver,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_CARVER_H ) */
+
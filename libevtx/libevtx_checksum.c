@@ -20,20 +20,39 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
+#if defined( __ARM_FEATURE_CRC32 )
+#include <arm_acle.h>
+#endif
+
+#include "libevtx_checksum.h"
 #include "libevtx_libcerror.h"
 
-/* Table of CRC-32 values of 8-bit values
+/* The primes of the 64-bit xxHash
+ */
+#define LIBEVTX_CHECKSUM_XXHASH64_PRIME1	(uint64_t) 0x9e3779b185ebca87ULL
+#define LIBEVTX_CHECKSUM_XXHASH64_PRIME2	(uint64_t) 0xc2b2ae3d27d4eb4fULL
+#define LIBEVTX_CHECKSUM_XXHASH64_PRIME3	(uint64_t) 0x165667b19e3779f9ULL
+#define LIBEVTX_CHECKSUM_XXHASH64_PRIME4	(uint64_t) 0x85ebca77c2b2ae63ULL
+#define LIBEVTX_CHECKSUM_XXHASH64_PRIME5	(uint64_t) 0x27d4eb2f165667c5ULL
+
+#define libevtx_checksum_rotate_left64( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+/* Tables of CRC-32 values of 8-bit values
+ * Table 0 is the classic byte-wise table, tables 1 to 7 are used
+ * to process 8 bytes per iteration (slicing-by-8)
  */
-uint32_t libevtx_checksum_crc32_table[ 256 ];
+uint32_t libevtx_checksum_crc32_table[ 8 ][ 256 ];
 
 /* Value to indicate the CRC-32 table been computed
  */
 int libevtx_checksum_crc32_table_computed = 0;
 
-/* Initializes the internal CRC-32 table
- * The table speeds up the CRC-32 calculation
+/* Initializes the internal CRC-32 tables
+ * The tables speed up the CRC-32 calculation
  */
 void libevtx_checksum_initialize_crc32_table(
       void )
@@ -41,6 +60,7 @@ void libevtx_checksum_initialize_crc32_table(
 	uint32_t crc32             = 0;
 	uint32_t crc32_table_index = 0;
 	uint8_t bit_iterator       = 0;
+	uint8_t slice_index        = 0;
 
 	for( crc32_table_index = 0;
 	     crc32_table_index < 256;
@@ -61,11 +81,97 @@ void libevtx_checksum_initialize_crc32_table(
 				crc32 = crc32 >> 1;
 			}
 		}
-		libevtx_checksum_crc32_table[ crc32_table_index ] = crc32;
+		libevtx_checksum_crc32_table[ 0 ][ crc32_table_index ] = crc32;
+	}
+	for( crc32_table_index = 0;
+	     crc32_table_index < 256;
+	     crc32_table_index++ )
+	{
+		crc32 = libevtx_checksum_crc32_table[ 0 ][ crc32_table_index ];
+
+		for( slice_index = 1;
+		     slice_index < 8;
+		     slice_index++ )
+		{
+			crc32 = libevtx_checksum_crc32_table[ 0 ][ crc32 & 0x000000ffUL ] ^ ( crc32 >> 8 );
+
+			libevtx_checksum_crc32_table[ slice_index ][ crc32_table_index ] = crc32;
+		}
 	}
 	libevtx_checksum_crc32_table_computed = 1;
 }
 
+/* Updates a (weak) CRC-32 with the data in a buffer
+ * Uses the ARMv8 CRC32 instructions if available at compile time,
+ * otherwise processes 8 bytes per iteration (slicing-by-8)
+ * Returns the updated CRC-32
+ */
+uint32_t libevtx_checksum_update_crc32(
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size )
+{
+	size_t buffer_offset = 0;
+
+#if !defined( __ARM_FEATURE_CRC32 )
+	uint32_t value_32bit = 0;
+
+	if( libevtx_checksum_crc32_table_computed == 0 )
+	{
+		libevtx_checksum_initialize_crc32_table();
+	}
+#endif
+	while( ( size - buffer_offset ) >= 8 )
+	{
+#if defined( __ARM_FEATURE_CRC32 )
+		crc32 = __crc32w(
+		         crc32,
+		         (uint32_t) buffer[ buffer_offset ]
+		         | ( (uint32_t) buffer[ buffer_offset + 1 ] << 8 )
+		         | ( (uint32_t) buffer[ buffer_offset + 2 ] << 16 )
+		         | ( (uint32_t) buffer[ buffer_offset + 3 ] << 24 ) );
+		crc32 = __crc32w(
+		         crc32,
+		         (uint32_t) buffer[ buffer_offset + 4 ]
+		         | ( (uint32_t) buffer[ buffer_offset + 5 ] << 8 )
+		         | ( (uint32_t) buffer[ buffer_offset + 6 ] << 16 )
+		         | ( (uint32_t) buffer[ buffer_offset + 7 ] << 24 ) );
+#else
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit );
+
+		crc32 ^= value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset + 4 ] ),
+		 value_32bit );
+
+		crc32 = libevtx_checksum_crc32_table[ 7 ][ crc32 & 0x000000ffUL ]
+		      ^ libevtx_checksum_crc32_table[ 6 ][ ( crc32 >> 8 ) & 0x000000ffUL ]
+		      ^ libevtx_checksum_crc32_table[ 5 ][ ( crc32 >> 16 ) & 0x000000ffUL ]
+		      ^ libevtx_checksum_crc32_table[ 4 ][ crc32 >> 24 ]
+		      ^ libevtx_checksum_crc32_table[ 3 ][ value_32bit & 0x000000ffUL ]
+		      ^ libevtx_checksum_crc32_table[ 2 ][ ( value_32bit >> 8 ) & 0x000000ffUL ]
+		      ^ libevtx_checksum_crc32_table[ 1 ][ ( value_32bit >> 16 ) & 0x000000ffUL ]
+		      ^ libevtx_checksum_crc32_table[ 0 ][ value_32bit >> 24 ];
+#endif
+		buffer_offset += 8;
+	}
+	while( buffer_offset < size )
+	{
+#if defined( __ARM_FEATURE_CRC32 )
+		crc32 = __crc32b(
+		         crc32,
+		         buffer[ buffer_offset ] );
+#else
+		crc32 = libevtx_checksum_crc32_table[ 0 ][ ( crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL ] ^ ( crc32 >> 8 );
+#endif
+		buffer_offset++;
+	}
+	return( crc32 );
+}
+
 /* Calculates the CRC-32 of a buffer
  * Based on RFC 1952
  * Returns 1 if successful or -1 on error
@@ -77,9 +183,7 @@ int libevtx_checksum_calculate_little_endian_crc32(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	static char *function      = "libevtx_checksum_calculate_little_endian_crc32";
-	size_t buffer_offset       = 0;
-	uint32_t crc32_table_index = 0;
+	static char *function = "libevtx_checksum_calculate_little_endian_crc32";
 
 	if( crc32 == NULL )
 	{
@@ -116,19 +220,12 @@ int libevtx_checksum_calculate_little_endian_crc32(
 	}
 	*crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
 
-        if( libevtx_checksum_crc32_table_computed == 0 )
-	{
-		libevtx_checksum_initialize_crc32_table();
-	}
-        for( buffer_offset = 0;
-	     buffer_offset < size;
-	     buffer_offset++ )
-	{
-		crc32_table_index = ( *crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL;
+	*crc32 = libevtx_checksum_update_crc32(
+	          *crc32,
+	          buffer,
+	          size );
 
-		*crc32 = libevtx_checksum_crc32_table[ crc32_table_index ] ^ ( *crc32 >> 8 );
-        }
-        *crc32 ^= 0xffffffffUL;
+	*crc32 ^= 0xffffffffUL;
 
 	return( 1 );
 }
@@ -144,9 +241,7 @@ int libevtx_checksum_calculate_little_endian_weak_crc32(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	static char *function      = "libevtx_checksum_calculate_little_endian_weak_crc32";
-	size_t buffer_offset       = 0;
-	uint32_t crc32_table_index = 0;
+	static char *function = "libevtx_checksum_calculate_little_endian_weak_crc32";
 
 	if( crc32 == NULL )
 	{
@@ -183,18 +278,211 @@ int libevtx_checksum_calculate_little_endian_weak_crc32(
 	}
 	*crc32 = initial_value;
 
-        if( libevtx_checksum_crc32_table_computed == 0 )
+	*crc32 = libevtx_checksum_update_crc32(
+	          *crc32,
+	          buffer,
+	          size );
+	return( 1 );
+}
+
+/* Processes a 64-bit value of the input with an accumulator of the 64-bit xxHash
+ * Returns the updated accumulator
+ */
+uint64_t libevtx_checksum_xxhash64_round(
+          uint64_t accumulator,
+          uint64_t value )
+{
+	accumulator += value * LIBEVTX_CHECKSUM_XXHASH64_PRIME2;
+	accumulator  = libevtx_checksum_rotate_left64( accumulator, 31 );
+	accumulator *= LIBEVTX_CHECKSUM_XXHASH64_PRIME1;
+
+	return( accumulator );
+}
+
+/* Merges an accumulator into the 64-bit xxHash
+ * Returns the updated hash
+ */
+uint64_t libevtx_checksum_xxhash64_merge_round(
+          uint64_t hash,
+          uint64_t accumulator )
+{
+	hash ^= libevtx_checksum_xxhash64_round(
+	         0,
+	         accumulator );
+
+	hash = ( hash * LIBEVTX_CHECKSUM_XXHASH64_PRIME1 ) + LIBEVTX_CHECKSUM_XXHASH64_PRIME4;
+
+	return( hash );
+}
+
+/* Calculates the 64-bit xxHash (XXH64) of a buffer
+ * The hash is a fast non-cryptographic hash used to compare data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_checksum_calculate_xxhash64(
+     uint64_t *hash,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t seed,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_checksum_calculate_xxhash64";
+	size_t buffer_offset  = 0;
+	uint64_t accumulator1 = 0;
+	uint64_t accumulator2 = 0;
+	uint64_t accumulator3 = 0;
+	uint64_t accumulator4 = 0;
+	uint64_t safe_hash    = 0;
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+
+	if( hash == NULL )
 	{
-		libevtx_checksum_initialize_crc32_table();
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
 	}
-        for( buffer_offset = 0;
-	     buffer_offset < size;
-	     buffer_offset++ )
+	if( size > (size_t) SSIZE_MAX )
 	{
-		crc32_table_index = ( *crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size >= 32 )
+	{
+		accumulator1 = seed + LIBEVTX_CHECKSUM_XXHASH64_PRIME1 + LIBEVTX_CHECKSUM_XXHASH64_PRIME2;
+		accumulator2 = seed + LIBEVTX_CHECKSUM_XXHASH64_PRIME2;
+		accumulator3 = seed;
+		accumulator4 = seed - LIBEVTX_CHECKSUM_XXHASH64_PRIME1;
+
+		/* Process 32 bytes per iteration in 4 independent lanes
+		 */
+		while( ( size - buffer_offset ) >= 32 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 value_64bit );
+
+			accumulator1 = libevtx_checksum_xxhash64_round(
+			                accumulator1,
+			                value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( buffer[ buffer_offset + 8 ] ),
+			 value_64bit );
 
-		*crc32 = libevtx_checksum_crc32_table[ crc32_table_index ] ^ ( *crc32 >> 8 );
-        }
-        return( 1 );
+			accumulator2 = libevtx_checksum_xxhash64_round(
+			                accumulator2,
+			                value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( buffer[ buffer_offset + 16 ] ),
+			 value_64bit );
+
+			accumulator3 = libevtx_checksum_xxhash64_round(
+			                accumulator3,
+			                value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( buffer[ buffer_offset + 24 ] ),
+			 value_64bit );
+
+			accumulator4 = libevtx_checksum_xxhash64_round(
+			                accumulator4,
+			                value_64bit );
+
+			buffer_offset += 32;
+		}
+		safe_hash = libevtx_checksum_rotate_left64( accumulator1, 1 )
+		          + libevtx_checksum_rotate_left64( accumulator2, 7 )
+		          + libevtx_checksum_rotate_left64( accumulator3, 12 )
+		          + libevtx_checksum_rotate_left64( accumulator4, 18 );
+
+		safe_hash = libevtx_checksum_xxhash64_merge_round(
+		             safe_hash,
+		             accumulator1 );
+
+		safe_hash = libevtx_checksum_xxhash64_merge_round(
+		             safe_hash,
+		             accumulator2 );
+
+		safe_hash = libevtx_checksum_xxhash64_merge_round(
+		             safe_hash,
+		             accumulator3 );
+
+		safe_hash = libevtx_checksum_xxhash64_merge_round(
+		             safe_hash,
+		             accumulator4 );
+	}
+	else
+	{
+		safe_hash = seed + LIBEVTX_CHECKSUM_XXHASH64_PRIME5;
+	}
+	safe_hash += (uint64_t) size;
+
+	while( ( size - buffer_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_64bit );
+
+		safe_hash ^= libevtx_checksum_xxhash64_round(
+		              0,
+		              value_64bit );
+
+		safe_hash = ( libevtx_checksum_rotate_left64( safe_hash, 27 ) * LIBEVTX_CHECKSUM_XXHASH64_PRIME1 ) + LIBEVTX_CHECKSUM_XXHASH64_PRIME4;
+
+		buffer_offset += 8;
+	}
+	if( ( size - buffer_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit );
+
+		safe_hash ^= (uint64_t) value_32bit * LIBEVTX_CHECKSUM_XXHASH64_PRIME1;
+		safe_hash  = ( libevtx_checksum_rotate_left64( safe_hash, 23 ) * LIBEVTX_CHECKSUM_XXHASH64_PRIME2 ) + LIBEVTX_CHECKSUM_XXHASH64_PRIME3;
+
+		buffer_offset += 4;
+	}
+	while( buffer_offset < size )
+	{
+		safe_hash ^= (uint64_t) buffer[ buffer_offset ] * LIBEVTX_CHECKSUM_XXHASH64_PRIME5;
+		safe_hash  = libevtx_checksum_rotate_left64( safe_hash, 11 ) * LIBEVTX_CHECKSUM_XXHASH64_PRIME1;
+
+		buffer_offset += 1;
+	}
+	/* Avalanche the bits of the hash
+	 */
+	safe_hash ^= safe_hash >> 33;
+	safe_hash *= LIBEVTX_CHECKSUM_XXHASH64_PRIME2;
+	safe_hash ^= safe_hash >> 29;
+	safe_hash *= LIBEVTX_CHECKSUM_XXHASH64_PRIME3;
+	safe_hash ^= safe_hash >> 32;
+
+	*hash = safe_hash;
+
+	return( 1 );
 }
 
@@ -31,9 +31,16 @@
 extern "C" {
 #endif
 
+extern int libevtx_checksum_crc32_table_computed;
+
 void libevtx_checksum_initialize_crc32_table(
       void );
 
+uint32_t libevtx_checksum_update_crc32(
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size );
+
 int libevtx_checksum_calculate_little_endian_crc32(
      uint32_t *crc32,
      uint8_t *buffer,
@@ -48,6 +55,21 @@ int libevtx_checksum_calculate_little_endian_weak_crc32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+uint64_t libevtx_checksum_xxhash64_round(
+          uint64_t accumulator,
+          uint64_t value );
+
+uint64_t libevtx_checksum_xxhash64_merge_round(
+          uint64_t hash,
+          uint64_t accumulator );
+
+int libevtx_checksum_calculate_xxhash64(
+     uint64_t *hash,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t seed,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
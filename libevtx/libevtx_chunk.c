@@ -23,16 +23,29 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libevtx_arena.h"
+#include "libevtx_arena_pool.h"
+#include "libevtx_async_reader.h"
+#include "libevtx_buffer_pool.h"
 #include "libevtx_byte_stream.h"
 #include "libevtx_checksum.h"
 #include "libevtx_chunk.h"
+#include "libevtx_chunk_prefetcher.h"
 #include "libevtx_definitions.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
+#include "libevtx_memory_usage.h"
+#include "libevtx_probes.h"
+#include "libevtx_read_buffer.h"
 #include "libevtx_record_values.h"
+#include "libevtx_signature.h"
+#include "libevtx_statistics.h"
+#include "libevtx_system_fields.h"
+#include "libevtx_system_values.h"
+#include "libevtx_template_cache.h"
 
 #include "evtx_chunk.h"
 #include "evtx_event_record.h"
@@ -104,20 +117,6 @@ int libevtx_chunk_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *chunk )->records_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunk records array.",
-		 function );
-
-		goto on_error;
-	}
 	if( libcdata_array_initialize(
 	     &( ( *chunk )->recovered_records_array ),
 	     0,
@@ -137,13 +136,6 @@ int libevtx_chunk_initialize(
 on_error:
 	if( *chunk != NULL )
 	{
-		if( ( *chunk )->records_array != NULL )
-		{
-			libcdata_array_free(
-			 &( ( *chunk )->records_array ),
-			 NULL,
-			 NULL );
-		}
 		memory_free(
 		 *chunk );
 
@@ -160,6 +152,7 @@ int libevtx_chunk_free(
      libcerror_error_t **error )
 {
 	static char *function = "libevtx_chunk_free";
+	uint16_t record_index = 0;
 	int result            = 1;
 
 	if( chunk == NULL )
@@ -189,24 +182,130 @@ int libevtx_chunk_free(
 
 			result = -1;
 		}
-		if( libcdata_array_free(
-		     &( ( *chunk )->records_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
-		     error ) != 1 )
+		if( ( *chunk )->records_values != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the chunk records array.",
-			 function );
+			for( record_index = 0;
+			     record_index < ( *chunk )->number_of_records;
+			     record_index++ )
+			{
+				if( ( *chunk )->records_values[ record_index ] == NULL )
+				{
+					continue;
+				}
+				if( libevtx_record_values_free(
+				     &( ( *chunk )->records_values[ record_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record values: %" PRIu16 ".",
+					 function,
+					 record_index );
 
-			result = -1;
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *chunk )->records_values );
+		}
+		if( ( *chunk )->record_written_times != NULL )
+		{
+			memory_free(
+			 ( *chunk )->record_written_times );
+		}
+		if( ( *chunk )->record_identifiers != NULL )
+		{
+			memory_free(
+			 ( *chunk )->record_identifiers );
+		}
+		if( ( *chunk )->record_sizes != NULL )
+		{
+			memory_free(
+			 ( *chunk )->record_sizes );
 		}
-		if( ( *chunk )->data != NULL )
+		if( ( *chunk )->record_offsets != NULL )
 		{
 			memory_free(
-			 ( *chunk )->data );
+			 ( *chunk )->record_offsets );
+		}
+		/* The record values of the records are released at once with the arena
+		 * An arena retrieved from the arena pool is reset and returned for reuse
+		 */
+		if( ( *chunk )->records_arena != NULL )
+		{
+			if( ( *chunk )->arena_pool != NULL )
+			{
+				if( libevtx_arena_pool_release_arena(
+				     ( *chunk )->arena_pool,
+				     &( ( *chunk )->records_arena ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release the chunk records arena.",
+					 function );
+
+					result = -1;
+				}
+			}
+			else
+			{
+				if( libevtx_arena_free(
+				     &( ( *chunk )->records_arena ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free the chunk records arena.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		libevtx_memory_usage_remove(
+		 ( *chunk )->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_RECORDS_INDEX,
+		 ( *chunk )->accounted_records_index_size );
+
+		libevtx_memory_usage_remove(
+		 ( *chunk )->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+		 ( *chunk )->accounted_data_size );
+
+		/* Memory mapped chunk data is owned by the IO handle
+		 */
+		if( ( ( *chunk )->data != NULL )
+		 && ( ( ( *chunk )->flags & LIBEVTX_CHUNK_FLAG_DATA_IS_MAPPED ) == 0 ) )
+		{
+			if( ( *chunk )->buffer_pool != NULL )
+			{
+				if( libevtx_buffer_pool_release_buffer(
+				     ( *chunk )->buffer_pool,
+				     &( ( *chunk )->data ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release chunk data.",
+					 function );
+
+					result = -1;
+				}
+			}
+			else
+			{
+				memory_free(
+				 ( *chunk )->data );
+			}
 		}
 		memory_free(
 		 *chunk );
@@ -216,46 +315,19 @@ int libevtx_chunk_free(
 	return( result );
 }
 
-/* Reads the chunk
- * Returns 1 if successful, 0 if the chunk is 0-byte filled or -1 on error
+/* Reads the chunk data
+ * The chunk data references the memory mapped file data if available
+ * Returns 1 if successful, 0 if the chunk is stored in the sparse tail of the file or -1 on error
  */
-int libevtx_chunk_read(
+int libevtx_chunk_read_data(
      libevtx_chunk_t *chunk,
      libevtx_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	libevtx_record_values_t *record_values      = NULL;
-	uint8_t *chunk_data                         = NULL;
-	static char *function                       = "libevtx_chunk_read";
-	size_t chunk_data_offset                    = 0;
-	size_t chunk_data_size                      = 0;
-	size_t xml_data_offset                      = 0;
-	size_t xml_data_size                        = 0;
-	ssize_t read_count                          = 0;
-	uint64_t calculated_number_of_event_records = 0;
-	uint64_t first_event_record_identifier      = 0;
-	uint64_t first_event_record_number          = 0;
-	uint64_t last_event_record_identifier       = 0;
-	uint64_t last_event_record_number           = 0;
-	uint64_t number_of_event_records            = 0;
-	uint32_t calculated_checksum                = 0;
-	uint32_t event_records_checksum             = 0;
-	uint32_t free_space_offset                  = 0;
-	uint32_t header_size                        = 0;
-	uint32_t last_event_record_offset           = 0;
-	uint32_t stored_checksum                    = 0;
-	int entry_index                             = 0;
-	int result                                  = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT ) || defined( HAVE_VERBOSE_OUTPUT )
-	uint64_t calculated_chunk_number            = 0;
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	ssize_t free_space_size                     = 0;
-	uint32_t value_32bit                        = 0;
-#endif
+	static char *function = "libevtx_chunk_read_data";
+	int result            = 0;
 
 	if( chunk == NULL )
 	{
@@ -290,679 +362,2506 @@ int libevtx_chunk_read(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT ) || defined( HAVE_VERBOSE_OUTPUT )
-	calculated_chunk_number = (uint64_t) ( ( file_offset - io_handle->chunk_size ) / io_handle->chunk_size );
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading chunk: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 calculated_chunk_number,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek chunk offset: %" PRIi64 ".",
-		 function,
-		 file_offset );
-
-		goto on_error;
-	}
-	chunk->file_offset = file_offset;
-
-	chunk->data = (uint8_t *) memory_allocate(
-	                           (size_t) io_handle->chunk_size );
-
-	if( chunk->data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create chunk data.",
-		 function );
-
-		goto on_error;
-	}
-	chunk->data_size = (size_t) io_handle->chunk_size;
-
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              chunk->data,
-	              chunk->data_size,
-	              error );
-
-	if( read_count != (ssize_t) chunk->data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read chunk data.",
-		 function );
-
-		goto on_error;
-	}
-	chunk_data      = chunk->data;
-	chunk_data_size = chunk->data_size;
+	chunk->file_offset  = file_offset;
+	chunk->memory_usage = &( io_handle->memory_usage );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( io_handle->sparse_tail_offset >= 0 )
+	 && ( file_offset >= io_handle->sparse_tail_offset ) )
 	{
-		libcnotify_printf(
-		 "%s: chunk header data:\n",
-		 function );
-		libcnotify_print_data(
-		 chunk_data,
-		 sizeof( evtx_chunk_header_t ),
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		/* The chunk is stored in the unallocated tail of a sparse file
+		 * and is 0-byte filled, hence there is no need to read it
+		 */
+		return( 0 );
 	}
-#endif
-	result = libevtx_byte_stream_check_for_zero_byte_fill(
-	          chunk_data,
-	          chunk_data_size,
-	          error );
-
-	if( result == -1 )
+	if( ( io_handle->mapped_data != NULL )
+	 && ( file_offset >= 0 )
+	 && ( (size64_t) file_offset <= io_handle->mapped_data_size )
+	 && ( (size64_t) io_handle->chunk_size <= ( io_handle->mapped_data_size - (size64_t) file_offset ) ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine of chunk is 0-byte filled.",
-		 function );
+		/* The chunk data references the memory mapped file data
+		 */
+		chunk->data      = &( io_handle->mapped_data[ file_offset ] );
+		chunk->data_size = (size_t) io_handle->chunk_size;
 
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		return( 0 );
+		chunk->flags |= LIBEVTX_CHUNK_FLAG_DATA_IS_MAPPED;
 	}
-	if( memory_compare(
-	     ( (evtx_chunk_header_t *) chunk_data )->signature,
-	     evtx_chunk_signature,
-	     8 ) != 0 )
+	else
 	{
-#if defined( HAVE_VERBOSE_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( io_handle->chunk_buffer_pool != NULL )
 		{
-			libcnotify_printf(
-			 "%s: unsupported chunk signature.\n",
-			 function );
+			if( libevtx_buffer_pool_get_buffer(
+			     io_handle->chunk_buffer_pool,
+			     &( chunk->data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk data from buffer pool.",
+				 function );
+
+				goto on_error;
+			}
+			chunk->buffer_pool = io_handle->chunk_buffer_pool;
 		}
-#endif
-		chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
-	}
-	else
-	{
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->first_event_record_number,
-		 first_event_record_number );
+		else
+		{
+			chunk->data = (uint8_t *) memory_allocate(
+			                           (size_t) io_handle->chunk_size );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_number,
-		 last_event_record_number );
+			if( chunk->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create chunk data.",
+				 function );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->first_event_record_identifier,
-		 first_event_record_identifier );
+				goto on_error;
+			}
+			LIBEVTX_COUNTER_ADD(
+			 io_handle->statistics.number_of_allocations,
+			 1 );
+		}
+		chunk->data_size           = (size_t) io_handle->chunk_size;
+		chunk->accounted_data_size = chunk->data_size;
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_identifier,
-		 last_event_record_identifier );
+		libevtx_memory_usage_add(
+		 chunk->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+		 chunk->accounted_data_size );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->header_size,
-		 header_size );
+		result = 0;
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_offset,
-		 last_event_record_offset );
+		if( io_handle->chunk_prefetcher != NULL )
+		{
+			result = libevtx_chunk_prefetcher_get_chunk_data(
+			          io_handle->chunk_prefetcher,
+			          file_offset,
+			          chunk->data,
+			          chunk->data_size,
+			          error );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->free_space_offset,
-		 free_space_offset );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve read-ahead chunk data at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->event_records_checksum,
-		 event_records_checksum );
+				goto on_error;
+			}
+		}
+		else if( io_handle->async_reader != NULL )
+		{
+			result = libevtx_async_reader_get_chunk_data(
+			          io_handle->async_reader,
+			          file_offset,
+			          chunk->data,
+			          chunk->data_size,
+			          error );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evtx_chunk_header_t *) chunk_data )->checksum,
-		 stored_checksum );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve asynchronously read chunk data at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+				goto on_error;
+			}
+		}
+		else if( io_handle->read_buffer != NULL )
 		{
-			libcnotify_printf(
-			 "%s: signature\t\t\t\t\t\t: %c%c%c%c%c%c%c\\x%02x\n",
-			 function,
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 0 ],
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 1 ],
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 2 ],
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 3 ],
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 4 ],
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 5 ] ,
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 6 ],
-			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 7 ] );
-
-			libcnotify_printf(
-			 "%s: first event record number\t\t\t\t: %" PRIu64 "\n",
-			 function,
-			 first_event_record_number );
-
-			libcnotify_printf(
-			 "%s: last event record number\t\t\t\t: %" PRIu64 "\n",
-			 function,
-			 last_event_record_number );
-
-			libcnotify_printf(
-			 "%s: first event record identifier\t\t\t: %" PRIu64 "\n",
-			 function,
-			 first_event_record_identifier );
-
-			libcnotify_printf(
-			 "%s: last event record identifier\t\t\t: %" PRIu64 "\n",
-			 function,
-			 last_event_record_identifier );
-
-			libcnotify_printf(
-			 "%s: header size\t\t\t\t\t\t: %" PRIu32 "\n",
-			 function,
-			 header_size );
-
-			libcnotify_printf(
-			 "%s: last event record offset\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 last_event_record_offset );
-
-			libcnotify_printf(
-			 "%s: free space offset\t\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 free_space_offset );
-
-			libcnotify_printf(
-			 "%s: event records checksum\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 event_records_checksum );
-
-			libcnotify_printf(
-			 "%s: unknown1:\n",
-			 function );
-			libcnotify_print_data(
-			 ( (evtx_chunk_header_t *) chunk_data )->unknown1,
-			 64,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (evtx_chunk_header_t *) chunk_data )->unknown2,
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: unknown2\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
+			result = libevtx_read_buffer_get_chunk_data(
+			          io_handle->read_buffer,
+			          file_offset,
+			          chunk->data,
+			          chunk->data_size,
+			          error );
 
-			libcnotify_printf(
-			 "%s: checksum\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 stored_checksum );
-
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		if( header_size != 128 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported header size: %" PRIu32 ".",
-			 function,
-			 header_size );
-
-			goto on_error;
-		}
-		if( libevtx_checksum_calculate_little_endian_crc32(
-		     &calculated_checksum,
-		     chunk_data,
-		     120,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to calculate CRC-32 checksum.",
-			 function );
-
-			goto on_error;
-		}
-		if( libevtx_checksum_calculate_little_endian_crc32(
-		     &calculated_checksum,
-		     &( chunk_data[ 128 ] ),
-		     384,
-		     calculated_checksum,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to calculate CRC-32 checksum.",
-			 function );
-
-			goto on_error;
-		}
-		if( stored_checksum != calculated_checksum )
-		{
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( result == -1 )
 			{
-				libcnotify_printf(
-				 "%s: mismatch in chunk: %" PRIu64 " header CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve buffered chunk data at offset: %" PRIi64 ".",
 				 function,
-				 calculated_chunk_number,
-				 stored_checksum,
-				 calculated_checksum );
-			}
-#endif
-			chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
-		}
-		chunk_data_offset = sizeof( evtx_chunk_header_t );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: chunk table data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( chunk_data[ chunk_data_offset ] ),
-			 384,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif
-		chunk_data_offset += 384;
-/* TODO can free_space_offset be 0 ? */
-
-		if( ( free_space_offset < chunk_data_offset )
-		 || ( free_space_offset > chunk_data_size ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid free space offset value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( libevtx_checksum_calculate_little_endian_crc32(
-		     &calculated_checksum,
-		     &( chunk_data[ 512 ] ),
-		     free_space_offset - chunk_data_offset,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to calculate CRC-32 checksum.",
-			 function );
+				 file_offset );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		if( event_records_checksum != calculated_checksum )
+		if( result == 0 )
 		{
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( libevtx_io_handle_read_data_at_offset(
+			     io_handle,
+			     file_io_handle,
+			     file_offset,
+			     chunk->data,
+			     chunk->data_size,
+			     error ) != 1 )
 			{
-				libcnotify_printf(
-				 "%s: mismatch in chunk: %" PRIu64 " event records CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk data at offset: %" PRIi64 ".",
 				 function,
-				 calculated_chunk_number,
-				 event_records_checksum,
-				 calculated_checksum );
+				 file_offset );
+
+				goto on_error;
 			}
-#endif
-			chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
 		}
-		while( chunk_data_offset <= last_event_record_offset )
+		if( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_NO_CACHE ) != 0 )
 		{
-			if( libevtx_record_values_initialize(
-			     &record_values,
+			if( libevtx_io_handle_release_cached_data(
+			     io_handle,
+			     file_offset,
+			     (size64_t) chunk->data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create record values.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release cached chunk data at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
 
 				goto on_error;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-				 function,
-				 file_offset + chunk_data_offset,
-				 file_offset + chunk_data_offset );
-			}
-#endif
-			result = libevtx_record_values_read_header(
-				  record_values,
-				  io_handle,
-				  chunk_data,
-				  chunk_data_size,
-				  chunk_data_offset,
-				  error );
-
-			if( result == -1 )
+		}
+		if( io_handle->chunk_prefetcher != NULL )
+		{
+			if( libevtx_chunk_prefetcher_schedule(
+			     io_handle->chunk_prefetcher,
+			     file_offset,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read record values header at offset: %" PRIi64 ".",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to schedule read-ahead after chunk at offset: %" PRIi64 ".",
 				 function,
-				 file_offset + chunk_data_offset );
+				 file_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-				}
-#endif
-				libcerror_error_free(
-				 error );
-			}
-			if( result != 1 )
-			{
-				break;
+				goto on_error;
 			}
-			chunk_data_offset += record_values->data_size;
-
-			if( libcdata_array_append_entry(
-			     chunk->records_array,
-			     &entry_index,
-			     (intptr_t *) record_values,
+		}
+		else if( io_handle->async_reader != NULL )
+		{
+			if( libevtx_async_reader_schedule(
+			     io_handle->async_reader,
+			     file_offset,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append record values to records array.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to schedule asynchronous reads after chunk at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
 
 				goto on_error;
 			}
-			record_values = NULL;
-
-			number_of_event_records++;
 		}
-		if( first_event_record_number > last_event_record_number )
+	}
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_chunks_read,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	libevtx_memory_usage_remove(
+	 chunk->memory_usage,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 chunk->accounted_data_size );
+
+	chunk->accounted_data_size = 0;
+
+	if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_DATA_IS_MAPPED ) != 0 )
+	{
+		chunk->data   = NULL;
+		chunk->flags &= ~( LIBEVTX_CHUNK_FLAG_DATA_IS_MAPPED );
+	}
+	else if( chunk->data != NULL )
+	{
+		if( chunk->buffer_pool != NULL )
 		{
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: invalid chunk: %" PRIu64 " first event record number: %" PRIu64 " exceeds last event record number: %" PRIu64 ".\n",
-				 function,
-				 calculated_chunk_number,
-				 first_event_record_number,
-				 last_event_record_number );
-			}
-#endif
-			chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+			libevtx_buffer_pool_release_buffer(
+			 chunk->buffer_pool,
+			 &( chunk->data ),
+			 NULL );
 		}
-		else if( result == 1 )
+		else
 		{
-			calculated_number_of_event_records = last_event_record_number - first_event_record_number + 1;
+			memory_free(
+			 chunk->data );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: calculated number of records\t\t\t: %" PRIu64 "\n",
-				 function,
-				 calculated_number_of_event_records );
-			}
-#endif
-			if( number_of_event_records != calculated_number_of_event_records )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: mismatch in chunk: %" PRIu64 " number of event records ( %" PRIu64 " != %" PRIu64 " ).\n",
-					 function,
-					 calculated_chunk_number,
-					 number_of_event_records,
-					 calculated_number_of_event_records );
-				}
-#endif
-				chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
-			}
-		}
-		if( first_event_record_identifier > last_event_record_identifier )
-		{
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: in chunk: %" PRIu64 " first event record identifier: %" PRIu64 " exceeds last event record identifier: %" PRIu64 ".\n",
-				 function,
-				 calculated_chunk_number,
-				 first_event_record_identifier,
-				 last_event_record_identifier );
-			}
-#endif
-			/* TODO mark this as corruption ? */
+			chunk->data = NULL;
 		}
 	}
-	if( chunk_data_offset < chunk_data_size )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		free_space_size = chunk_data_size - chunk_data_offset;
+	chunk->buffer_pool = NULL;
 
-		if( libcnotify_verbose != 0 )
+	return( -1 );
+}
+
+/* Determines if the chunk data is consistent
+ * The chunk data is consistent if it is 0-byte filled or if the header
+ * and event records checksums match
+ * Returns 1 if consistent, 0 if not or -1 on error
+ */
+int libevtx_chunk_data_is_consistent(
+     uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_chunk_data_is_consistent";
+	uint32_t calculated_checksum = 0;
+	uint32_t free_space_offset   = 0;
+	uint32_t stored_checksum     = 0;
+	int result                   = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data_size < 512 )
+	 || ( chunk_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (evtx_chunk_header_t *) chunk_data )->signature,
+	     evtx_chunk_signature,
+	     8 ) != 0 )
+	{
+		result = libevtx_byte_stream_check_for_zero_byte_fill(
+		          chunk_data,
+		          chunk_data_size,
+		          error );
+
+		if( result == -1 )
 		{
-			libcnotify_printf(
-			 "%s: free space data:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine of chunk is 0-byte filled.",
 			 function );
-			libcnotify_print_data(
-			 &( chunk_data[ chunk_data_offset ] ),
-			 free_space_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			return( -1 );
 		}
-#endif
-		while( chunk_data_offset < chunk_data_size )
+		return( result );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->checksum,
+	 stored_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     chunk_data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk_data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->free_space_offset,
+	 free_space_offset );
+
+	if( ( free_space_offset < 512 )
+	 || ( (size_t) free_space_offset > chunk_data_size ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->event_records_checksum,
+	 stored_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk_data[ 512 ] ),
+	     free_space_offset - 512,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the chunk data of a file that is actively written (live)
+ * The chunk is read once into its buffer and re-read directly from the file
+ * IO handle if the chunk is inconsistent, which happens when the chunk is
+ * written while it is read, or if the record identifiers in the chunk header
+ * no longer contain those of the first consistent read of the chunk. The chunk
+ * is re-read at most LIBEVTX_MAXIMUM_NUMBER_OF_CHUNK_REREADS times
+ * Returns 1 if successful, 0 if the chunk is stored in the sparse tail of the file or -1 on error
+ */
+int libevtx_chunk_read_live_data(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint64_t *live_record_identifiers      = NULL;
+	static char *function                  = "libevtx_chunk_read_live_data";
+	uint64_t chunk_index                   = 0;
+	uint64_t first_event_record_identifier = 0;
+	uint64_t last_event_record_identifier  = 0;
+	uint64_t start_time                    = 0;
+	uint8_t record_identifiers_changed     = 0;
+	int number_of_rereads                  = 0;
+	int result                             = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_chunk_read_data(
+	          chunk,
+	          io_handle,
+	          file_io_handle,
+	          file_offset,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk data at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+		}
+		return( result );
+	}
+	if( ( file_offset >= io_handle->chunks_data_offset )
+	 && ( io_handle->chunk_size != 0 )
+	 && ( io_handle->live_chunk_record_identifiers != NULL ) )
+	{
+		chunk_index = (uint64_t) ( file_offset - io_handle->chunks_data_offset ) / io_handle->chunk_size;
+
+		if( chunk_index < (uint64_t) io_handle->number_of_live_chunks )
+		{
+			live_record_identifiers = &( io_handle->live_chunk_record_identifiers[ chunk_index * 2 ] );
+		}
+	}
+	do
+	{
+		if( number_of_rereads > 0 )
 		{
-/* TODO optimize scan ? */
-			if( memory_compare(
-			     &( chunk_data[ chunk_data_offset ] ),
-			     evtx_event_record_signature,
-			     4 ) == 0 )
+			/* The chunk is re-read directly since the read-ahead and buffered
+			 * chunk data can contain the same inconsistent data
+			 */
+			if( libevtx_io_handle_read_data_at_offset(
+			     io_handle,
+			     file_io_handle,
+			     file_offset,
+			     chunk->data,
+			     chunk->data_size,
+			     error ) != 1 )
 			{
-				if( record_values == NULL )
-				{
-					if( libevtx_record_values_initialize(
-					     &record_values,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-						 "%s: unable to create record values.",
-						 function );
-
-						goto on_error;
-					}
-				}
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: reading recovered record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-					 function,
-					 file_offset + chunk_data_offset,
-					 file_offset + chunk_data_offset );
-				}
-#endif
-				if( libevtx_record_values_read_header(
-				     record_values,
-				     io_handle,
-				     chunk_data,
-				     chunk_data_size,
-				     chunk_data_offset,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read record values header at offset: %" PRIi64 ".",
-					 function,
-					 file_offset + chunk_data_offset );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to re-read chunk data at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						if( ( error != NULL )
-						 && ( *error != NULL ) )
-						{
-							libcnotify_print_error_backtrace(
-							 *error );
-						}
-					}
-#endif
-					libcerror_error_free(
-					 error );
-				}
-				else
-				{
-					xml_data_offset = chunk_data_offset + sizeof( evtx_event_record_header_t );
-					xml_data_size   = 0;
+				return( -1 );
+			}
+			LIBEVTX_COUNTER_ADD(
+			 io_handle->statistics.number_of_chunk_rereads,
+			 1 );
+		}
+		record_identifiers_changed = 0;
 
-					if( record_values->data_size > ( sizeof( evtx_event_record_header_t ) + 4 ) )
-					{
-						xml_data_size = record_values->data_size - ( sizeof( evtx_event_record_header_t ) + 4 );
-					}
-					result = 0;
+		start_time = libevtx_statistics_get_time();
 
-					if( xml_data_size > 0 )
-					{
-						if( ( xml_data_size >= 5 )
-						 && ( chunk_data[ xml_data_offset ] == 0x0a ) )
-						{
-							result = 1;
-						}
-						else if( ( xml_data_size >= 4 )
-						      && ( chunk_data[ xml_data_offset ] == 0x0f )
-						      && ( chunk_data[ xml_data_offset + 1 ] == 0x01 )
-						      && ( chunk_data[ xml_data_offset + 2 ] == 0x01 )
-						      && ( chunk_data[ xml_data_offset + 3 ] == 0x00 ) )
-						{
-							result = 1;
-						}
-/* TODO what about 0x00 allow it ? */
-					}
-					if( result != 0 )
-					{
-						chunk_data_offset += record_values->data_size - 4;
+		result = libevtx_chunk_data_is_consistent(
+		          chunk->data,
+		          chunk->data_size,
+		          error );
 
-						if( libcdata_array_append_entry(
-						     chunk->recovered_records_array,
-						     &entry_index,
-						     (intptr_t *) record_values,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-							 "%s: unable to append record values to recovered records array.",
-							 function );
-
-							goto on_error;
-						}
-						record_values = NULL;
-					}
-				}
+		LIBEVTX_COUNTER_ADD(
+		 io_handle->statistics.checksum_time,
+		 libevtx_statistics_get_time() - start_time );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if chunk data at offset: %" PRIi64 " is consistent.",
+			 function,
+			 file_offset );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( live_record_identifiers != NULL )
+		      && ( memory_compare(
+		            ( (evtx_chunk_header_t *) chunk->data )->signature,
+		            evtx_chunk_signature,
+		            8 ) == 0 ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (evtx_chunk_header_t *) chunk->data )->first_event_record_identifier,
+			 first_event_record_identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (evtx_chunk_header_t *) chunk->data )->last_event_record_identifier,
+			 last_event_record_identifier );
+
+			if( ( live_record_identifiers[ 0 ] == 0 )
+			 && ( live_record_identifiers[ 1 ] == 0 ) )
+			{
+				live_record_identifiers[ 0 ] = first_event_record_identifier;
+				live_record_identifiers[ 1 ] = last_event_record_identifier;
 			}
-			chunk_data_offset += 4;
+			/* Records can be appended to the chunk but records that were read
+			 * before can only be removed by rewriting the chunk
+			 */
+			else if( ( live_record_identifiers[ 0 ] != first_event_record_identifier )
+			      || ( live_record_identifiers[ 1 ] > last_event_record_identifier ) )
+			{
+				record_identifiers_changed = 1;
+
+				result = 0;
+			}
+		}
+		if( result != 0 )
+		{
+			/* The checksums of consistent chunk data do not need to be validated again
+			 */
+			chunk->flags |= LIBEVTX_CHUNK_FLAG_HEADER_CHECKSUM_VALIDATED
+			              | LIBEVTX_CHUNK_FLAG_EVENT_RECORDS_CHECKSUM_VALIDATED;
+
+			break;
+		}
+		number_of_rereads++;
+	}
+	while( number_of_rereads <= LIBEVTX_MAXIMUM_NUMBER_OF_CHUNK_REREADS );
+
+	if( record_identifiers_changed != 0 )
+	{
+		/* The chunk was rewritten since it was first read, hence its records
+		 * no longer correspond with the records read before
+		 */
+		chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+	}
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( ( result == 0 )
+	 && ( libcnotify_verbose != 0 ) )
+	{
+		libcnotify_printf(
+		 "%s: chunk at offset: %" PRIi64 " is still inconsistent after: %d re-reads.\n",
+		 function,
+		 file_offset,
+		 LIBEVTX_MAXIMUM_NUMBER_OF_CHUNK_REREADS );
+	}
+#endif
+	return( 1 );
+}
+
+/* Appends a record to the records table
+ * The records table is grown by doubling its size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_append_record(
+     libevtx_chunk_t *chunk,
+     uint32_t chunk_data_offset,
+     uint32_t data_size,
+     uint64_t identifier,
+     uint64_t written_time,
+     libcerror_error_t **error )
+{
+	void *reallocation          = NULL;
+	static char *function       = "libevtx_chunk_append_record";
+	size_t records_index_size   = 0;
+	uint32_t records_table_size = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->records_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk - records values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->number_of_records == UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk - number of records value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->number_of_records >= chunk->records_table_size )
+	{
+		if( chunk->records_table_size == 0 )
+		{
+			records_table_size = 64;
+		}
+		else
+		{
+			records_table_size = (uint32_t) chunk->records_table_size * 2;
+		}
+		if( records_table_size > (uint32_t) UINT16_MAX )
+		{
+			records_table_size = (uint32_t) UINT16_MAX;
+		}
+		reallocation = memory_reallocate(
+		                chunk->record_offsets,
+		                sizeof( uint32_t ) * records_table_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record offsets.",
+			 function );
+
+			return( -1 );
+		}
+		chunk->record_offsets = (uint32_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                chunk->record_sizes,
+		                sizeof( uint32_t ) * records_table_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record sizes.",
+			 function );
+
+			return( -1 );
+		}
+		chunk->record_sizes = (uint32_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                chunk->record_identifiers,
+		                sizeof( uint64_t ) * records_table_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		chunk->record_identifiers = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                chunk->record_written_times,
+		                sizeof( uint64_t ) * records_table_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record written times.",
+			 function );
+
+			return( -1 );
+		}
+		chunk->record_written_times = (uint64_t *) reallocation;
+
+		/* Every entry of the records table consists of an offset, size, identifier and written time
+		 */
+		records_index_size = ( ( 2 * sizeof( uint32_t ) ) + ( 2 * sizeof( uint64_t ) ) )
+		                   * (size_t) ( records_table_size - chunk->records_table_size );
+
+		chunk->accounted_records_index_size += records_index_size;
+
+		libevtx_memory_usage_add(
+		 chunk->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_RECORDS_INDEX,
+		 records_index_size );
+
+		/* The table size is only updated once all the columns were resized
+		 */
+		chunk->records_table_size = (uint16_t) records_table_size;
+	}
+	chunk->record_offsets[ chunk->number_of_records ]       = chunk_data_offset;
+	chunk->record_sizes[ chunk->number_of_records ]         = data_size;
+	chunk->record_identifiers[ chunk->number_of_records ]   = identifier;
+	chunk->record_written_times[ chunk->number_of_records ] = written_time;
+
+	chunk->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Reads the chunk
+ * Returns 1 if successful, 0 if the chunk is 0-byte filled or -1 on error
+ */
+int libevtx_chunk_read(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t record_header_values;
+	uint8_t *chunk_data                         = NULL;
+	static char *function                       = "libevtx_chunk_read";
+	size_t chunk_data_offset                    = 0;
+	size_t chunk_data_size                      = 0;
+	uint64_t calculated_number_of_event_records = 0;
+	uint64_t chunk_index                        = 0;
+	uint64_t first_event_record_identifier      = 0;
+	uint64_t first_event_record_number          = 0;
+	uint64_t last_event_record_identifier       = 0;
+	uint64_t last_event_record_number           = 0;
+	uint64_t number_of_event_records            = 0;
+	uint64_t start_time                         = 0;
+	uint32_t event_records_checksum             = 0;
+	uint32_t free_space_offset                  = 0;
+	uint32_t header_size                        = 0;
+	uint32_t last_event_record_offset           = 0;
+	uint32_t stored_checksum                    = 0;
+	uint8_t free_space_is_checked               = 0;
+	uint8_t free_space_is_empty                 = 0;
+	uint8_t skip_allocated_records              = 0;
+	int result                                  = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT ) || defined( HAVE_VERBOSE_OUTPUT )
+	uint64_t calculated_chunk_number            = 0;
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                        = 0;
+#endif
+#if defined( LIBEVTX_PROBES_ENABLED )
+	uint64_t read_start_time                    = 0;
+#endif
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) || defined( HAVE_VERBOSE_OUTPUT )
+	calculated_chunk_number = (uint64_t) ( ( file_offset - io_handle->chunk_size ) / io_handle->chunk_size );
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading chunk: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 calculated_chunk_number,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+#if defined( LIBEVTX_PROBES_ENABLED )
+	read_start_time = libevtx_statistics_get_time();
+#endif
+	LIBEVTX_PROBE_CHUNK_READ_START(
+	 file_offset,
+	 io_handle->chunk_size );
+
+	if( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_LIVE ) != 0 )
+	{
+		result = libevtx_chunk_read_live_data(
+		          chunk,
+		          io_handle,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	else
+	{
+		result = libevtx_chunk_read_data(
+		          chunk,
+		          io_handle,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	LIBEVTX_PROBE_CHUNK_READ_DONE(
+	 file_offset,
+	 io_handle->chunk_size,
+	 libevtx_statistics_get_time() - read_start_time,
+	 result );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk data at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The records arena is retrieved from the arena pool of the IO handle
+	 * so that the memory of the record values is reused across chunks
+	 */
+	if( chunk->records_arena == NULL )
+	{
+		if( io_handle->records_arena_pool != NULL )
+		{
+			if( libevtx_arena_pool_get_arena(
+			     io_handle->records_arena_pool,
+			     &( chunk->records_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk records arena from arena pool.",
+				 function );
+
+				goto on_error;
+			}
+			chunk->arena_pool = io_handle->records_arena_pool;
+		}
+		else
+		{
+			if( libevtx_arena_initialize(
+			     &( chunk->records_arena ),
+			     LIBEVTX_RECORD_VALUES_ARENA_BLOCK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk records arena.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	chunk_data      = chunk->data;
+	chunk_data_size = chunk->data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: chunk header data:\n",
+		 function );
+		libcnotify_print_data(
+		 chunk_data,
+		 sizeof( evtx_chunk_header_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	/* The signature is checked first since only chunks without a valid
+	 * signature need to be scanned for 0-byte fill
+	 */
+	if( memory_compare(
+	     ( (evtx_chunk_header_t *) chunk_data )->signature,
+	     evtx_chunk_signature,
+	     8 ) != 0 )
+	{
+		result = libevtx_byte_stream_check_for_zero_byte_fill(
+		          chunk_data,
+		          chunk_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine of chunk is 0-byte filled.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			return( 0 );
+		}
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported chunk signature.\n",
+			 function );
+		}
+#endif
+		/* There are no checksums to validate without a valid header
+		 */
+		chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED
+		              | LIBEVTX_CHUNK_FLAG_HEADER_CHECKSUM_VALIDATED
+		              | LIBEVTX_CHUNK_FLAG_EVENT_RECORDS_CHECKSUM_VALIDATED;
+	}
+	else
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->first_event_record_number,
+		 first_event_record_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_number,
+		 last_event_record_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->first_event_record_identifier,
+		 first_event_record_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_identifier,
+		 last_event_record_identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->header_size,
+		 header_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_offset,
+		 last_event_record_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->free_space_offset,
+		 free_space_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->event_records_checksum,
+		 event_records_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->checksum,
+		 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: signature\t\t\t\t\t\t: %c%c%c%c%c%c%c\\x%02x\n",
+			 function,
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 0 ],
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 1 ],
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 2 ],
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 3 ],
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 4 ],
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 5 ] ,
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 6 ],
+			 ( (evtx_chunk_header_t *) chunk_data )->signature[ 7 ] );
+
+			libcnotify_printf(
+			 "%s: first event record number\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 first_event_record_number );
+
+			libcnotify_printf(
+			 "%s: last event record number\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 last_event_record_number );
+
+			libcnotify_printf(
+			 "%s: first event record identifier\t\t\t: %" PRIu64 "\n",
+			 function,
+			 first_event_record_identifier );
+
+			libcnotify_printf(
+			 "%s: last event record identifier\t\t\t: %" PRIu64 "\n",
+			 function,
+			 last_event_record_identifier );
+
+			libcnotify_printf(
+			 "%s: header size\t\t\t\t\t\t: %" PRIu32 "\n",
+			 function,
+			 header_size );
+
+			libcnotify_printf(
+			 "%s: last event record offset\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 last_event_record_offset );
+
+			libcnotify_printf(
+			 "%s: free space offset\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 free_space_offset );
+
+			libcnotify_printf(
+			 "%s: event records checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 event_records_checksum );
+
+			libcnotify_printf(
+			 "%s: unknown1:\n",
+			 function );
+			libcnotify_print_data(
+			 ( (evtx_chunk_header_t *) chunk_data )->unknown1,
+			 64,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (evtx_chunk_header_t *) chunk_data )->unknown2,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: unknown2\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+
+			libcnotify_printf(
+			 "%s: checksum\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 stored_checksum );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( header_size != 128 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported header size: %" PRIu32 ".",
+			 function,
+			 header_size );
+
+			goto on_error;
+		}
+		chunk->header_checksum        = stored_checksum;
+		chunk->event_records_checksum = event_records_checksum;
+
+		/* With full validation the header checksum is validated together
+		 * with the event records checksum once the free space offset is known
+		 */
+		if( io_handle->validation_mode == LIBEVTX_VALIDATE_HEADER_ONLY )
+		{
+			start_time = libevtx_statistics_get_time();
+
+			if( libevtx_chunk_validate_header_checksum(
+			     chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to validate chunk header checksum.",
+				 function );
+
+				goto on_error;
+			}
+			LIBEVTX_COUNTER_ADD(
+			 io_handle->statistics.checksum_time,
+			 libevtx_statistics_get_time() - start_time );
+		}
+		chunk_data_offset = sizeof( evtx_chunk_header_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: chunk table data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( chunk_data[ chunk_data_offset ] ),
+			 384,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		chunk_data_offset += 384;
+/* TODO can free_space_offset be 0 ? */
+
+		if( ( free_space_offset < chunk_data_offset )
+		 || ( free_space_offset > chunk_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid free space offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		chunk->free_space_offset = free_space_offset;
+
+		if( io_handle->validation_mode == LIBEVTX_VALIDATE_FULL )
+		{
+			start_time = libevtx_statistics_get_time();
+
+			if( libevtx_chunk_validate_data(
+			     chunk,
+			     &free_space_is_empty,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to validate chunk data.",
+				 function );
+
+				goto on_error;
+			}
+			free_space_is_checked = 1;
+
+			LIBEVTX_COUNTER_ADD(
+			 io_handle->statistics.checksum_time,
+			 libevtx_statistics_get_time() - start_time );
+		}
+		/* In recovered only mode the allocated records are skipped and the free space
+		 * is scanned directly. If the file is not dirty, the allocated records of chunks
+		 * outside the indicated range are considered recovered hence these are still read
+		 */
+		if( ( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_RECOVERED_ONLY ) != 0 )
+		 && ( file_offset >= io_handle->chunks_data_offset )
+		 && ( io_handle->chunk_size != 0 ) )
+		{
+			chunk_index = (uint64_t) ( file_offset - io_handle->chunks_data_offset ) / io_handle->chunk_size;
+
+			if( ( chunk_index < (uint64_t) io_handle->number_of_chunks )
+			 || ( ( io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+			{
+				skip_allocated_records = 1;
+			}
+		}
+		if( skip_allocated_records != 0 )
+		{
+			chunk_data_offset = free_space_offset;
+		}
+		else
+		{
+			while( chunk_data_offset <= last_event_record_offset )
+			{
+				/* Only the record header is read here, the record values
+				 * are created on demand by libevtx_chunk_get_record
+				 */
+				if( memory_set(
+				     &record_header_values,
+				     0,
+				     sizeof( libevtx_record_values_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear record header values.",
+					 function );
+
+					goto on_error;
+				}
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: reading record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+					 function,
+					 file_offset + chunk_data_offset,
+					 file_offset + chunk_data_offset );
+				}
+#endif
+				result = libevtx_record_values_read_header(
+					  &record_header_values,
+					  io_handle,
+					  chunk_data,
+					  chunk_data_size,
+					  chunk_data_offset,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read record values header at offset: %" PRIi64 ".",
+					 function,
+					 file_offset + chunk_data_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+							libcnotify_print_error_backtrace(
+							 *error );
+						}
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+				if( result != 1 )
+				{
+					break;
+				}
+				if( libevtx_chunk_append_record(
+				     chunk,
+				     (uint32_t) chunk_data_offset,
+				     record_header_values.data_size,
+				     record_header_values.identifier,
+				     record_header_values.written_time,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record to records table.",
+					 function );
+
+					goto on_error;
+				}
+				chunk_data_offset += record_header_values.data_size;
+
+				number_of_event_records++;
+			}
+			if( first_event_record_number > last_event_record_number )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: invalid chunk: %" PRIu64 " first event record number: %" PRIu64 " exceeds last event record number: %" PRIu64 ".\n",
+					 function,
+					 calculated_chunk_number,
+					 first_event_record_number,
+					 last_event_record_number );
+				}
+#endif
+				chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+			}
+			else if( result == 1 )
+			{
+				calculated_number_of_event_records = last_event_record_number - first_event_record_number + 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: calculated number of records\t\t\t: %" PRIu64 "\n",
+					 function,
+					 calculated_number_of_event_records );
+				}
+#endif
+				if( number_of_event_records != calculated_number_of_event_records )
+				{
+#if defined( HAVE_VERBOSE_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: mismatch in chunk: %" PRIu64 " number of event records ( %" PRIu64 " != %" PRIu64 " ).\n",
+						 function,
+						 calculated_chunk_number,
+						 number_of_event_records,
+						 calculated_number_of_event_records );
+					}
+#endif
+					chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+				}
+			}
+			if( first_event_record_identifier > last_event_record_identifier )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: in chunk: %" PRIu64 " first event record identifier: %" PRIu64 " exceeds last event record identifier: %" PRIu64 ".\n",
+					 function,
+					 calculated_chunk_number,
+					 first_event_record_identifier,
+					 last_event_record_identifier );
+				}
+#endif
+				/* TODO mark this as corruption ? */
+			}
+		}
+	}
+	/* A 0-byte filled free space, as determined by the validation of the chunk
+	 * data, contains no recoverable records hence it does not need to be scanned
+	 */
+	if( ( free_space_is_checked != 0 )
+	 && ( free_space_is_empty != 0 )
+	 && ( chunk_data_offset >= (size_t) chunk->free_space_offset ) )
+	{
+		chunk_data_offset = chunk_data_size;
+	}
+	if( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_DEFERRED_RECOVERY ) != 0 )
+	{
+		/* The free space is scanned for recovered records when these are first requested
+		 */
+		chunk->recovery_scan_offset = (uint32_t) chunk_data_offset;
+		chunk->flags               |= LIBEVTX_CHUNK_FLAG_RECOVERY_IS_PENDING;
+	}
+	else if( chunk_data_offset < chunk_data_size )
+	{
+		chunk->recovery_scan_offset = (uint32_t) chunk_data_offset;
+
+		if( libevtx_chunk_read_recovered_records(
+		     chunk,
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovered records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libevtx_memory_usage_remove(
+	 chunk->memory_usage,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 chunk->accounted_data_size );
+
+	chunk->accounted_data_size = 0;
+
+	if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_DATA_IS_MAPPED ) != 0 )
+	{
+		chunk->data   = NULL;
+		chunk->flags &= ~( LIBEVTX_CHUNK_FLAG_DATA_IS_MAPPED );
+	}
+	else if( chunk->data != NULL )
+	{
+		if( chunk->buffer_pool != NULL )
+		{
+			libevtx_buffer_pool_release_buffer(
+			 chunk->buffer_pool,
+			 &( chunk->data ),
+			 NULL );
+		}
+		else
+		{
+			memory_free(
+			 chunk->data );
+
+			chunk->data = NULL;
+		}
+	}
+	chunk->buffer_pool = NULL;
+
+	return( -1 );
+}
+
+/* Reads the recovered records from the free space of the chunk
+ * The free space is scanned from the recovery scan offset for event record signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_read_recovered_records(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	uint8_t *chunk_data                    = NULL;
+	static char *function                  = "libevtx_chunk_read_recovered_records";
+	size_t chunk_data_offset               = 0;
+	size_t chunk_data_size                 = 0;
+	size_t xml_data_offset                 = 0;
+	size_t xml_data_size                   = 0;
+	int entry_index                        = 0;
+	int result                             = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	ssize_t free_space_size                = 0;
+#endif
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->records_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing records arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data        = chunk->data;
+	chunk_data_size   = chunk->data_size;
+	chunk_data_offset = (size_t) chunk->recovery_scan_offset;
+
+	chunk->flags &= ~( LIBEVTX_CHUNK_FLAG_RECOVERY_IS_PENDING );
+
+	if( chunk_data_offset >= chunk_data_size )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	free_space_size = chunk_data_size - chunk_data_offset;
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: free space data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( chunk_data[ chunk_data_offset ] ),
+		 free_space_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	while( chunk_data_offset < chunk_data_size )
+	{
+		result = libevtx_signature_find_event_record(
+		          chunk_data,
+		          chunk_data_size,
+		          chunk_data_offset,
+		          &chunk_data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find event record signature in free space.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		/* Most event record signatures in free space are false positives
+		 * hence these are rejected before the header is read
+		 */
+		result = libevtx_record_values_check_header(
+		          chunk_data,
+		          chunk_data_size,
+		          chunk_data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check record values header at offset: %" PRIi64 ".",
+			 function,
+			 chunk->file_offset + chunk_data_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			chunk_data_offset += 4;
+
+			continue;
+		}
+		if( record_values == NULL )
+		{
+			if( libevtx_record_values_initialize_from_arena(
+			     &record_values,
+			     chunk->records_arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading recovered record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 chunk->file_offset + chunk_data_offset,
+			 chunk->file_offset + chunk_data_offset );
+		}
+#endif
+		record_values->offset = chunk->file_offset + (off64_t) chunk_data_offset;
+
+		if( libevtx_record_values_read_header(
+		     record_values,
+		     io_handle,
+		     chunk_data,
+		     chunk_data_size,
+		     chunk_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record values header at offset: %" PRIi64 ".",
+			 function,
+			 chunk->file_offset + chunk_data_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			xml_data_offset = chunk_data_offset + sizeof( evtx_event_record_header_t );
+			xml_data_size   = 0;
+
+			if( record_values->data_size > ( sizeof( evtx_event_record_header_t ) + 4 ) )
+			{
+				xml_data_size = record_values->data_size - ( sizeof( evtx_event_record_header_t ) + 4 );
+			}
+			result = 0;
+
+			if( xml_data_size > 0 )
+			{
+				if( ( xml_data_size >= 5 )
+				 && ( chunk_data[ xml_data_offset ] == 0x0a ) )
+				{
+					result = 1;
+				}
+				else if( ( xml_data_size >= 4 )
+				      && ( chunk_data[ xml_data_offset ] == 0x0f )
+				      && ( chunk_data[ xml_data_offset + 1 ] == 0x01 )
+				      && ( chunk_data[ xml_data_offset + 2 ] == 0x01 )
+				      && ( chunk_data[ xml_data_offset + 3 ] == 0x00 ) )
+				{
+					result = 1;
+				}
+/* TODO what about 0x00 allow it ? */
+			}
+			if( result != 0 )
+			{
+				chunk_data_offset += record_values->data_size - 4;
+
+				if( libcdata_array_append_entry(
+				     chunk->recovered_records_array,
+				     &entry_index,
+				     (intptr_t *) record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record values to recovered records array.",
+					 function );
+
+					goto on_error;
+				}
+				record_values = NULL;
+			}
+		}
+		chunk_data_offset += 4;
+	}
+	if( record_values != NULL )
+	{
+		if( libevtx_record_values_free(
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Validates the chunk header checksum
+ * Sets LIBEVTX_CHUNK_FLAG_IS_CORRUPTED if the checksum does not match
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_validate_header_checksum(
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_chunk_validate_header_checksum";
+	uint32_t calculated_checksum = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_HEADER_CHECKSUM_VALIDATED ) != 0 )
+	{
+		return( 1 );
+	}
+	if( chunk->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->data_size < 512 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     chunk->data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk->data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->header_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in chunk at offset: %" PRIi64 " header CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 chunk->file_offset,
+			 chunk->header_checksum,
+			 calculated_checksum );
+		}
+#endif
+		LIBEVTX_PROBE_CHUNK_HEADER_CHECKSUM_MISMATCH(
+		 chunk->file_offset,
+		 chunk->header_checksum,
+		 calculated_checksum );
+
+		chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+	}
+	chunk->flags |= LIBEVTX_CHUNK_FLAG_HEADER_CHECKSUM_VALIDATED;
+
+	return( 1 );
+}
+
+/* Validates the chunk event records checksum
+ * Sets LIBEVTX_CHUNK_FLAG_IS_CORRUPTED if the checksum does not match
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_validate_event_records_checksum(
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_chunk_validate_event_records_checksum";
+	uint32_t calculated_checksum = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_EVENT_RECORDS_CHECKSUM_VALIDATED ) != 0 )
+	{
+		return( 1 );
+	}
+	if( chunk->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->free_space_offset < 512 )
+	 || ( (size_t) chunk->free_space_offset > chunk->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk - free space offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk->data[ 512 ] ),
+	     chunk->free_space_offset - 512,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->event_records_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in chunk at offset: %" PRIi64 " event records CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 chunk->file_offset,
+			 chunk->event_records_checksum,
+			 calculated_checksum );
+		}
+#endif
+		LIBEVTX_PROBE_CHUNK_RECORDS_CHECKSUM_MISMATCH(
+		 chunk->file_offset,
+		 chunk->event_records_checksum,
+		 calculated_checksum );
+
+		chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+	}
+	chunk->flags |= LIBEVTX_CHUNK_FLAG_EVENT_RECORDS_CHECKSUM_VALIDATED;
+
+	return( 1 );
+}
+
+/* Validates the chunk header and event records checksums if not done before
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_validate_checksums(
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_validate_checksums";
+
+	if( libevtx_chunk_validate_header_checksum(
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to validate header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_validate_event_records_checksum(
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to validate event records checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Validates the chunk data in a single forward pass
+ * The header checksum, over the data before offset 512, and the event records
+ * checksum, over the data up to the free space offset, are validated if not done
+ * before, after which the free space is checked for 0-byte fill. The data is
+ * traversed in order so that it is read from memory only once
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_validate_data(
+     libevtx_chunk_t *chunk,
+     uint8_t *free_space_is_empty,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_validate_data";
+	int result            = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_space_is_empty == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space is empty.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_validate_checksums(
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to validate checksums.",
+		 function );
+
+		return( -1 );
+	}
+	/* The checksums validated the free space offset
+	 */
+	result = libevtx_byte_stream_check_for_zero_byte_fill(
+	          &( chunk->data[ chunk->free_space_offset ] ),
+	          chunk->data_size - (size_t) chunk->free_space_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if free space is 0-byte filled.",
+		 function );
+
+		return( -1 );
+	}
+	*free_space_is_empty = (uint8_t) result;
+
+	return( 1 );
+}
+
+/* Verifies the chunk
+ * Only the chunk header and the event records checksums are validated,
+ * the event records themselves are not read
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_verify(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t *verify_result_flags,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_chunk_verify";
+	uint64_t start_time          = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t header_size         = 0;
+	int result                   = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_result_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify result flags.",
+		 function );
+
+		return( -1 );
+	}
+	*verify_result_flags = 0;
+
+	result = libevtx_chunk_read_data(
+	          chunk,
+	          io_handle,
+	          file_io_handle,
+	          file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk data at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*verify_result_flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_EMPTY;
+
+		return( 1 );
+	}
+	if( chunk->data_size < 512 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (evtx_chunk_header_t *) chunk->data )->signature,
+	     evtx_chunk_signature,
+	     8 ) != 0 )
+	{
+		result = libevtx_byte_stream_check_for_zero_byte_fill(
+		          chunk->data,
+		          chunk->data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine of chunk is 0-byte filled.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*verify_result_flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_EMPTY;
+		}
+		else
+		{
+			*verify_result_flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+			                     | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_SIGNATURE;
+		}
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk->data )->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk->data )->free_space_offset,
+	 chunk->free_space_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk->data )->event_records_checksum,
+	 chunk->event_records_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk->data )->checksum,
+	 chunk->header_checksum );
+
+	if( header_size != 128 )
+	{
+		*verify_result_flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                     | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_HEADER;
+
+		return( 1 );
+	}
+	start_time = libevtx_statistics_get_time();
+
+	/* The header checksum is calculated over the first 120 bytes
+	 * of the chunk header and the 384 bytes of the chunk tables
+	 */
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     chunk->data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk->data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->header_checksum != calculated_checksum )
+	{
+		LIBEVTX_PROBE_CHUNK_HEADER_CHECKSUM_MISMATCH(
+		 chunk->file_offset,
+		 chunk->header_checksum,
+		 calculated_checksum );
+
+		*verify_result_flags |= LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                      | LIBEVTX_VERIFY_RESULT_FLAG_HEADER_CHECKSUM_MISMATCH;
+	}
+	if( ( chunk->free_space_offset < 512 )
+	 || ( (size_t) chunk->free_space_offset > chunk->data_size ) )
+	{
+		*verify_result_flags |= LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                      | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_HEADER;
+	}
+	else
+	{
+		if( libevtx_checksum_calculate_little_endian_crc32(
+		     &calculated_checksum,
+		     &( chunk->data[ 512 ] ),
+		     chunk->free_space_offset - 512,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate CRC-32 checksum.",
+			 function );
+
+			return( -1 );
+		}
+		if( chunk->event_records_checksum != calculated_checksum )
+		{
+			LIBEVTX_PROBE_CHUNK_RECORDS_CHECKSUM_MISMATCH(
+			 chunk->file_offset,
+			 chunk->event_records_checksum,
+			 calculated_checksum );
+
+			*verify_result_flags |= LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+			                      | LIBEVTX_VERIFY_RESULT_FLAG_EVENT_RECORDS_CHECKSUM_MISMATCH;
+		}
+	}
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.checksum_time,
+	 libevtx_statistics_get_time() - start_time );
+
+	chunk->flags |= LIBEVTX_CHUNK_FLAG_HEADER_CHECKSUM_VALIDATED
+	              | LIBEVTX_CHUNK_FLAG_EVENT_RECORDS_CHECKSUM_VALIDATED;
+
+	if( ( *verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_get_number_of_records(
+     libevtx_chunk_t *chunk,
+     uint16_t *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_get_number_of_records";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = chunk->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the record at the index
+ * The record values are created from the records table on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_get_record(
+     libevtx_chunk_t *chunk,
+     uint16_t record_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *safe_record_values = NULL;
+	static char *function                       = "libevtx_chunk_get_record";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index >= chunk->number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->records_values == NULL )
+	{
+		chunk->records_values = (libevtx_record_values_t **) memory_allocate(
+		                                                      sizeof( libevtx_record_values_t * ) * chunk->number_of_records );
+
+		if( chunk->records_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create records values.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     chunk->records_values,
+		     0,
+		     sizeof( libevtx_record_values_t * ) * chunk->number_of_records ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear records values.",
+			 function );
+
+			memory_free(
+			 chunk->records_values );
+
+			chunk->records_values = NULL;
+
+			return( -1 );
 		}
-		if( record_values != NULL )
+		chunk->accounted_records_index_size += sizeof( libevtx_record_values_t * ) * chunk->number_of_records;
+
+		libevtx_memory_usage_add(
+		 chunk->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_RECORDS_INDEX,
+		 sizeof( libevtx_record_values_t * ) * chunk->number_of_records );
+	}
+	if( chunk->records_values[ record_index ] == NULL )
+	{
+		/* The records arena is created on demand if the chunk was not read
+		 */
+		if( chunk->records_arena == NULL )
 		{
-			if( libevtx_record_values_free(
-			     &record_values,
+			if( libevtx_arena_initialize(
+			     &( chunk->records_arena ),
+			     LIBEVTX_RECORD_VALUES_ARENA_BLOCK_SIZE,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free record values.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk records arena.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 		}
+		if( libevtx_record_values_initialize_from_arena(
+		     &safe_record_values,
+		     chunk->records_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values: %" PRIu16 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		safe_record_values->offset            = chunk->file_offset + (off64_t) chunk->record_offsets[ record_index ];
+		safe_record_values->chunk_data_offset = (size_t) chunk->record_offsets[ record_index ];
+		safe_record_values->data_size         = chunk->record_sizes[ record_index ];
+		safe_record_values->identifier        = chunk->record_identifiers[ record_index ];
+		safe_record_values->written_time      = chunk->record_written_times[ record_index ];
+		safe_record_values->memory_usage      = chunk->memory_usage;
+		safe_record_values->accounted_size    = sizeof( libevtx_record_values_t );
+
+		libevtx_memory_usage_add(
+		 safe_record_values->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_RECORD_VALUES,
+		 safe_record_values->accounted_size );
+
+		chunk->records_values[ record_index ] = safe_record_values;
 	}
+	*record_values = chunk->records_values[ record_index ];
+
 	return( 1 );
+}
 
-on_error:
-	if( record_values != NULL )
+/* Retrieves the identifier of the record at the index
+ * This does not create the record values
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_get_record_identifier(
+     libevtx_chunk_t *chunk,
+     uint16_t record_index,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_get_record_identifier";
+
+	if( chunk == NULL )
 	{
-		libevtx_record_values_free(
-		 &record_values,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
 	}
-	if( chunk->data != NULL )
+	if( record_index >= chunk->number_of_records )
 	{
-		memory_free(
-		 chunk->data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
 
-		chunk->data = NULL;
+		return( -1 );
 	}
-	return( -1 );
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier = chunk->record_identifiers[ record_index ];
+
+	return( 1 );
 }
 
-/* Retrieves the number of records
+/* Retrieves the written time of the record at the index
+ * This does not create the record values
  * Returns 1 if successful or -1 on error
  */
-int libevtx_chunk_get_number_of_records(
+int libevtx_chunk_get_record_written_time(
      libevtx_chunk_t *chunk,
-     uint16_t *number_of_records,
+     uint16_t record_index,
+     uint64_t *written_time,
      libcerror_error_t **error )
 {
-	static char *function       = "libevtx_chunk_get_number_of_records";
-	int chunk_number_of_records = 0;
+	static char *function = "libevtx_chunk_get_record_written_time";
 
 	if( chunk == NULL )
 	{
@@ -975,57 +2874,94 @@ int libevtx_chunk_get_number_of_records(
 
 		return( -1 );
 	}
-	if( number_of_records == NULL )
+	if( record_index >= chunk->number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( written_time == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of records.",
+		 "%s: invalid written time.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     chunk->records_array,
-	     &chunk_number_of_records,
-	     error ) != 1 )
+	*written_time = chunk->record_written_times[ record_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the data size of the record at the index
+ * This does not create the record values
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_get_record_data_size(
+     libevtx_chunk_t *chunk,
+     uint16_t record_index,
+     uint32_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_get_record_data_size";
+
+	if( chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_number_of_records > (int) UINT16_MAX )
+	if( record_index >= chunk->number_of_records )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid number of chunk records value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	*number_of_records = (uint16_t) chunk_number_of_records;
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = chunk->record_sizes[ record_index ];
 
 	return( 1 );
 }
 
-/* Retrieves the record at the index
+/* Retrieves the chunk data offset of the record at the index
+ * This does not create the record values
  * Returns 1 if successful or -1 on error
  */
-int libevtx_chunk_get_record(
+int libevtx_chunk_get_record_chunk_data_offset(
      libevtx_chunk_t *chunk,
      uint16_t record_index,
-     libevtx_record_values_t **record_values,
+     size_t *chunk_data_offset,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_chunk_get_record";
+	static char *function = "libevtx_chunk_get_record_chunk_data_offset";
 
 	if( chunk == NULL )
 	{
@@ -1038,25 +2974,111 @@ int libevtx_chunk_get_record(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     chunk->records_array,
-	     (int) record_index,
-	     (intptr_t **) record_values,
-	     error ) != 1 )
+	if( record_index >= chunk->number_of_records )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record: %" PRIu16 ".",
-		 function,
-		 record_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
 
 		return( -1 );
 	}
+	*chunk_data_offset = (size_t) chunk->record_offsets[ record_index ];
+
 	return( 1 );
 }
 
+/* Retrieves the index of the record with the identifier
+ * The record identifiers within a chunk are expected to be ascending
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libevtx_chunk_get_record_index_by_identifier(
+     libevtx_chunk_t *chunk,
+     uint64_t identifier,
+     uint16_t *record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_get_record_index_by_identifier";
+	uint32_t lower_index  = 0;
+	uint32_t middle_index = 0;
+	uint32_t table_index  = 0;
+	uint32_t upper_index  = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = (uint32_t) chunk->number_of_records;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( chunk->record_identifiers[ middle_index ] == identifier )
+		{
+			*record_index = (uint16_t) middle_index;
+
+			return( 1 );
+		}
+		else if( chunk->record_identifiers[ middle_index ] < identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	/* Fall back to a linear scan when the identifiers are not ascending
+	 */
+	if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		for( table_index = 0;
+		     table_index < (uint32_t) chunk->number_of_records;
+		     table_index++ )
+		{
+			if( chunk->record_identifiers[ table_index ] == identifier )
+			{
+				*record_index = (uint16_t) table_index;
+
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
 /* Retrieves the number of recovered records
  * Returns 1 if successful or -1 on error
  */
@@ -1161,3 +3183,141 @@ int libevtx_chunk_get_recovered_record(
 	return( 1 );
 }
 
+/* Decodes the System fields of the records of the chunk
+ * The System values of every record are read from its template, where the System values
+ * template cache of the chunk makes that records that share a template only read their
+ * substitution values. The written times are taken from the records table of the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_decode_system_fields(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     uint32_t fields_mask,
+     libevtx_internal_system_fields_t *internal_system_fields,
+     libcerror_error_t **error )
+{
+	libevtx_system_values_t system_values;
+
+	libevtx_string_table_t *string_table            = NULL;
+	libevtx_template_cache_t *shared_template_cache = NULL;
+	static char *function                           = "libevtx_chunk_decode_system_fields";
+	uint32_t system_values_fields_mask              = 0;
+	uint16_t record_index                           = 0;
+	int result                                      = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fields_mask & ~( LIBEVTX_SYSTEM_FIELD_FLAGS_ALL ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported fields mask: 0x%08" PRIx32 ".",
+		 function,
+		 fields_mask );
+
+		return( -1 );
+	}
+	if( libevtx_system_fields_resize(
+	     internal_system_fields,
+	     (int) chunk->number_of_records,
+	     fields_mask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize system fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle != NULL )
+	{
+		shared_template_cache = io_handle->shared_template_cache;
+
+		if( shared_template_cache == NULL )
+		{
+			shared_template_cache = io_handle->template_cache;
+		}
+		string_table = io_handle->string_table;
+	}
+	/* The written time is the only field that does not require the System values
+	 */
+	system_values_fields_mask = fields_mask & ~( LIBEVTX_SYSTEM_FIELD_FLAG_WRITTEN_TIME );
+
+	for( record_index = 0;
+	     record_index < chunk->number_of_records;
+	     record_index++ )
+	{
+		result = 0;
+
+		if( system_values_fields_mask != 0 )
+		{
+			result = libevtx_system_values_read_data(
+			          &system_values,
+			          &( chunk->system_values_template_cache ),
+			          shared_template_cache,
+			          chunk->data,
+			          chunk->data_size,
+			          (size_t) chunk->record_offsets[ record_index ],
+			          (size_t) chunk->record_sizes[ record_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %" PRIu16 " system values.",
+				 function,
+				 record_index );
+
+				return( -1 );
+			}
+		}
+		if( libevtx_system_fields_set_record_values(
+		     internal_system_fields,
+		     (int) record_index,
+		     ( result == 1 ) ? &system_values : NULL,
+		     chunk->record_written_times[ record_index ],
+		     string_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set record: %" PRIu16 " system fields.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -25,16 +25,24 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_arena.h"
+#include "libevtx_arena_pool.h"
+#include "libevtx_buffer_pool.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_memory_usage.h"
 #include "libevtx_record_values.h"
+#include "libevtx_system_fields.h"
+#include "libevtx_system_values.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+extern const uint8_t *evtx_chunk_signature;
+
 typedef struct libevtx_chunk libevtx_chunk_t;
 
 struct libevtx_chunk
@@ -47,18 +55,87 @@ struct libevtx_chunk
 	 */
 	size_t data_size;
 
+	/* The buffer pool the chunk data was retrieved from
+	 */
+	libevtx_buffer_pool_t *buffer_pool;
+
 	/* The (chunk) file offset
 	 */
 	off64_t file_offset;
 
-	/* The records array
+	/* The stored header checksum
+	 */
+	uint32_t header_checksum;
+
+	/* The stored event records checksum
+	 */
+	uint32_t event_records_checksum;
+
+	/* The free space offset
+	 */
+	uint32_t free_space_offset;
+
+	/* The chunk data offset from which the free space is scanned for recovered records
+	 */
+	uint32_t recovery_scan_offset;
+
+	/* The number of records
+	 */
+	uint16_t number_of_records;
+
+	/* The number of allocated entries in the records table
 	 */
-	libcdata_array_t *records_array;
+	uint16_t records_table_size;
+
+	/* The chunk data offsets of the records
+	 */
+	uint32_t *record_offsets;
+
+	/* The data sizes of the records
+	 */
+	uint32_t *record_sizes;
+
+	/* The identifiers of the records
+	 */
+	uint64_t *record_identifiers;
+
+	/* The written times of the records
+	 */
+	uint64_t *record_written_times;
+
+	/* The record values of the records, created on demand
+	 */
+	libevtx_record_values_t **records_values;
 
 	/* The recovered records array
 	 */
 	libcdata_array_t *recovered_records_array;
 
+	/* The arena the record values of the records and recovered records are allocated from
+	 */
+	libevtx_arena_t *records_arena;
+
+	/* The arena pool the records arena was retrieved from
+	 */
+	libevtx_arena_pool_t *arena_pool;
+
+	/* The System values template cache
+	 */
+	libevtx_system_values_template_cache_t system_values_template_cache;
+
+	/* The memory usage the chunk is accounted to
+	 * Contains NULL if the chunk is not accounted
+	 */
+	libevtx_memory_usage_t *memory_usage;
+
+	/* The size of the chunk data accounted to the memory usage
+	 */
+	size_t accounted_data_size;
+
+	/* The size of the records table accounted to the memory usage
+	 */
+	size_t accounted_records_index_size;
+
 	/* Various flags
 	 */
 	uint8_t flags;
@@ -72,6 +149,33 @@ int libevtx_chunk_free(
      libevtx_chunk_t **chunk,
      libcerror_error_t **error );
 
+int libevtx_chunk_read_data(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_chunk_data_is_consistent(
+     uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_read_live_data(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_chunk_append_record(
+     libevtx_chunk_t *chunk,
+     uint32_t chunk_data_offset,
+     uint32_t data_size,
+     uint64_t identifier,
+     uint64_t written_time,
+     libcerror_error_t **error );
+
 int libevtx_chunk_read(
      libevtx_chunk_t *chunk,
      libevtx_io_handle_t *io_handle,
@@ -79,6 +183,36 @@ int libevtx_chunk_read(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libevtx_chunk_read_recovered_records(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_chunk_validate_header_checksum(
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunk_validate_event_records_checksum(
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunk_validate_checksums(
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunk_validate_data(
+     libevtx_chunk_t *chunk,
+     uint8_t *free_space_is_empty,
+     libcerror_error_t **error );
+
+int libevtx_chunk_verify(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t *verify_result_flags,
+     libcerror_error_t **error );
+
 int libevtx_chunk_get_number_of_records(
      libevtx_chunk_t *chunk,
      uint16_t *number_of_records,
@@ -90,6 +224,36 @@ int libevtx_chunk_get_record(
      libevtx_record_values_t **record_values,
      libcerror_error_t **error );
 
+int libevtx_chunk_get_record_identifier(
+     libevtx_chunk_t *chunk,
+     uint16_t record_index,
+     uint64_t *identifier,
+     libcerror_error_t **error );
+
+int libevtx_chunk_get_record_written_time(
+     libevtx_chunk_t *chunk,
+     uint16_t record_index,
+     uint64_t *written_time,
+     libcerror_error_t **error );
+
+int libevtx_chunk_get_record_data_size(
+     libevtx_chunk_t *chunk,
+     uint16_t record_index,
+     uint32_t *data_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_get_record_chunk_data_offset(
+     libevtx_chunk_t *chunk,
+     uint16_t record_index,
+     size_t *chunk_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_chunk_get_record_index_by_identifier(
+     libevtx_chunk_t *chunk,
+     uint64_t identifier,
+     uint16_t *record_index,
+     libcerror_error_t **error );
+
 int libevtx_chunk_get_number_of_recovered_records(
      libevtx_chunk_t *chunk,
      uint16_t *number_of_records,
@@ -101,6 +265,13 @@ int libevtx_chunk_get_recovered_record(
      libevtx_record_values_t **record_values,
      libcerror_error_t **error );
 
+int libevtx_chunk_decode_system_fields(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     uint32_t fields_mask,
+     libevtx_internal_system_fields_t *internal_system_fields,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
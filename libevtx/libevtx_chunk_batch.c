@@ -0,0 +1,1504 @@
+/*
+ * Chunk batch functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_async_reader.h"
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_batch.h"
+#include "libevtx_definitions.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_statistics.h"
+
+/* Creates a chunk batch
+ * Make sure the value chunk_batch is referencing, is set to NULL
+ * Every thread reads the chunks using its own clone of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_initialize(
+     libevtx_chunk_batch_t **chunk_batch,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_initialize";
+	size_t array_size     = 0;
+	int result            = 0;
+	int thread_index      = 0;
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEVTX_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_batch = memory_allocate_structure(
+	                libevtx_chunk_batch_t );
+
+	if( *chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_batch,
+	     0,
+	     sizeof( libevtx_chunk_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk batch.",
+		 function );
+
+		memory_free(
+		 *chunk_batch );
+
+		*chunk_batch = NULL;
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( ( *chunk_batch )->io_handle ),
+	     io_handle,
+	     sizeof( libevtx_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks read by the threads allocate their own chunk data and records arena
+	 * and do not use the read-ahead or read buffer of the file
+	 * The asynchronous chunk reader is shared with the threads
+	 */
+	( *chunk_batch )->io_handle.chunk_buffer_pool  = NULL;
+	( *chunk_batch )->io_handle.chunk_prefetcher   = NULL;
+	( *chunk_batch )->io_handle.read_buffer        = NULL;
+	( *chunk_batch )->io_handle.records_arena_pool = NULL;
+
+	( *chunk_batch )->number_of_threads        = number_of_threads;
+	( *chunk_batch )->tuned_number_of_threads  = number_of_threads;
+	( *chunk_batch )->maximum_number_of_chunks = number_of_threads * LIBEVTX_CHUNK_BATCH_NUMBER_OF_CHUNKS_PER_THREAD;
+
+	array_size = sizeof( libbfio_handle_t * ) * number_of_threads;
+
+	( *chunk_batch )->file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                           array_size );
+
+	if( ( *chunk_batch )->file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_batch )->file_io_handles,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	array_size = sizeof( libevtx_chunk_batch_thread_arguments_t ) * number_of_threads;
+
+	( *chunk_batch )->thread_arguments = (libevtx_chunk_batch_thread_arguments_t *) memory_allocate(
+	                                                                                 array_size );
+
+	if( ( *chunk_batch )->thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread arguments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_batch )->thread_arguments,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread arguments.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	array_size = sizeof( libcthreads_thread_t * ) * number_of_threads;
+
+	( *chunk_batch )->threads = (libcthreads_thread_t **) memory_allocate(
+	                                                       array_size );
+
+	if( ( *chunk_batch )->threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_batch )->threads,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libevtx_range_scheduler_initialize(
+	     &( ( *chunk_batch )->range_scheduler ),
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create range scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	array_size = sizeof( libevtx_chunk_t * ) * ( *chunk_batch )->maximum_number_of_chunks;
+
+	( *chunk_batch )->chunks = (libevtx_chunk_t **) memory_allocate(
+	                                                 array_size );
+
+	if( ( *chunk_batch )->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_batch )->chunks,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		goto on_error;
+	}
+	array_size = sizeof( int ) * ( *chunk_batch )->maximum_number_of_chunks;
+
+	( *chunk_batch )->read_results = (int *) memory_allocate(
+	                                          array_size );
+
+	if( ( *chunk_batch )->read_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read results.",
+		 function );
+
+		goto on_error;
+	}
+	array_size = sizeof( uint32_t ) * ( *chunk_batch )->maximum_number_of_chunks;
+
+	( *chunk_batch )->verify_results = (uint32_t *) memory_allocate(
+	                                                 array_size );
+
+	if( ( *chunk_batch )->verify_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verify results.",
+		 function );
+
+		goto on_error;
+	}
+	array_size = sizeof( off64_t ) * ( *chunk_batch )->maximum_number_of_chunks;
+
+	( *chunk_batch )->chunk_offsets = (off64_t *) memory_allocate(
+	                                               array_size );
+
+	if( ( *chunk_batch )->chunk_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libbfio_handle_clone(
+		     &( ( *chunk_batch )->file_io_handles[ thread_index ] ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          ( *chunk_batch )->file_io_handles[ thread_index ],
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     ( *chunk_batch )->file_io_handles[ thread_index ],
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		( *chunk_batch )->thread_arguments[ thread_index ].chunk_batch  = *chunk_batch;
+		( *chunk_batch )->thread_arguments[ thread_index ].thread_index = thread_index;
+	}
+	/* Make sure the CRC-32 tables are not computed concurrently by the threads
+	 */
+	if( libevtx_checksum_crc32_table_computed == 0 )
+	{
+		libevtx_checksum_initialize_crc32_table();
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_batch != NULL )
+	{
+		libevtx_chunk_batch_free(
+		 chunk_batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a chunk batch
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_free(
+     libevtx_chunk_batch_t **chunk_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_free";
+	int chunk_index       = 0;
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_batch != NULL )
+	{
+		if( ( *chunk_batch )->chunks != NULL )
+		{
+			for( chunk_index = 0;
+			     chunk_index < ( *chunk_batch )->maximum_number_of_chunks;
+			     chunk_index++ )
+			{
+				if( ( *chunk_batch )->chunks[ chunk_index ] != NULL )
+				{
+					if( libevtx_chunk_free(
+					     &( ( *chunk_batch )->chunks[ chunk_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free chunk: %d.",
+						 function,
+						 chunk_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *chunk_batch )->chunks );
+		}
+		if( ( *chunk_batch )->file_io_handles != NULL )
+		{
+			for( thread_index = 0;
+			     thread_index < ( *chunk_batch )->number_of_threads;
+			     thread_index++ )
+			{
+				if( ( *chunk_batch )->file_io_handles[ thread_index ] == NULL )
+				{
+					continue;
+				}
+				if( libbfio_handle_is_open(
+				     ( *chunk_batch )->file_io_handles[ thread_index ],
+				     NULL ) == 1 )
+				{
+					if( libbfio_handle_close(
+					     ( *chunk_batch )->file_io_handles[ thread_index ],
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close file IO handle: %d.",
+						 function,
+						 thread_index );
+
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( ( *chunk_batch )->file_io_handles[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *chunk_batch )->file_io_handles );
+		}
+		if( ( *chunk_batch )->thread_arguments != NULL )
+		{
+			for( thread_index = 0;
+			     thread_index < ( *chunk_batch )->number_of_threads;
+			     thread_index++ )
+			{
+				if( ( *chunk_batch )->thread_arguments[ thread_index ].error != NULL )
+				{
+					libcerror_error_free(
+					 &( ( *chunk_batch )->thread_arguments[ thread_index ].error ) );
+				}
+			}
+			memory_free(
+			 ( *chunk_batch )->thread_arguments );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *chunk_batch )->threads != NULL )
+		{
+			memory_free(
+			 ( *chunk_batch )->threads );
+		}
+#endif
+		if( ( *chunk_batch )->range_scheduler != NULL )
+		{
+			if( libevtx_range_scheduler_free(
+			     &( ( *chunk_batch )->range_scheduler ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free range scheduler.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chunk_batch )->read_results != NULL )
+		{
+			memory_free(
+			 ( *chunk_batch )->read_results );
+		}
+		if( ( *chunk_batch )->verify_results != NULL )
+		{
+			memory_free(
+			 ( *chunk_batch )->verify_results );
+		}
+		if( ( *chunk_batch )->chunk_offsets != NULL )
+		{
+			memory_free(
+			 ( *chunk_batch )->chunk_offsets );
+		}
+		memory_free(
+		 *chunk_batch );
+
+		*chunk_batch = NULL;
+	}
+	return( result );
+}
+
+/* Starts tuning the number of threads used to read the batches
+ * The first batch is read by a single thread, the number of threads is doubled
+ * for every next batch as long as the time per chunk improves
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_start_tuning(
+     libevtx_chunk_batch_t *chunk_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_start_tuning";
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_batch->tuned_number_of_threads  = 1;
+	chunk_batch->is_tuning                = 1;
+	chunk_batch->number_of_tuning_chunks  = 0;
+	chunk_batch->best_chunk_time          = 0;
+	chunk_batch->best_number_of_threads   = 1;
+	chunk_batch->single_thread_chunk_time = 0;
+
+	return( 1 );
+}
+
+/* Tunes the number of threads using the time it took to read the current batch
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_tune(
+     libevtx_chunk_batch_t *chunk_batch,
+     uint64_t batch_time,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_chunk_batch_tune";
+	uint64_t chunk_time        = 0;
+	int next_number_of_threads = 0;
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_batch->is_tuning == 0 )
+	 || ( chunk_batch->number_of_chunks <= 0 ) )
+	{
+		return( 1 );
+	}
+	chunk_time = batch_time / (uint64_t) chunk_batch->number_of_chunks;
+
+	chunk_batch->number_of_tuning_chunks += chunk_batch->number_of_chunks;
+
+	if( ( chunk_batch->tuned_number_of_threads == 1 )
+	 && ( chunk_batch->single_thread_chunk_time == 0 ) )
+	{
+		chunk_batch->single_thread_chunk_time = chunk_time;
+	}
+	/* A batch at the end of the file can contain fewer chunks than the threads
+	 * can read hence its time is not representative
+	 */
+	if( chunk_batch->number_of_chunks < ( chunk_batch->tuned_number_of_threads * LIBEVTX_CHUNK_BATCH_NUMBER_OF_CHUNKS_PER_THREAD ) )
+	{
+		chunk_batch->tuned_number_of_threads = chunk_batch->best_number_of_threads;
+		chunk_batch->is_tuning               = 0;
+
+		return( 1 );
+	}
+	/* Another thread is only added when it improves the time per chunk significantly
+	 */
+	if( ( chunk_batch->best_chunk_time != 0 )
+	 && ( ( chunk_time * 100 ) >= ( chunk_batch->best_chunk_time * ( 100 - LIBEVTX_CHUNK_BATCH_TUNING_MINIMUM_IMPROVEMENT ) ) ) )
+	{
+		chunk_batch->tuned_number_of_threads = chunk_batch->best_number_of_threads;
+		chunk_batch->is_tuning               = 0;
+
+		return( 1 );
+	}
+	chunk_batch->best_chunk_time        = chunk_time;
+	chunk_batch->best_number_of_threads = chunk_batch->tuned_number_of_threads;
+
+	next_number_of_threads = chunk_batch->tuned_number_of_threads * 2;
+
+	if( next_number_of_threads > chunk_batch->number_of_threads )
+	{
+		next_number_of_threads = chunk_batch->number_of_threads;
+	}
+	if( ( next_number_of_threads == chunk_batch->tuned_number_of_threads )
+	 || ( chunk_batch->number_of_tuning_chunks >= LIBEVTX_CHUNK_BATCH_MAXIMUM_NUMBER_OF_TUNING_CHUNKS ) )
+	{
+		chunk_batch->is_tuning = 0;
+
+		return( 1 );
+	}
+	chunk_batch->tuned_number_of_threads = next_number_of_threads;
+
+	return( 1 );
+}
+
+/* Retrieves the tuned values
+ * The single thread chunk time is 0 if it was not measured
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_get_tuned_values(
+     libevtx_chunk_batch_t *chunk_batch,
+     int *number_of_threads,
+     uint64_t *single_thread_chunk_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_get_tuned_values";
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_thread_chunk_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single thread chunk time.",
+		 function );
+
+		return( -1 );
+	}
+	/* When tuning did not finish the best number of threads so far is used
+	 */
+	if( chunk_batch->is_tuning != 0 )
+	{
+		*number_of_threads = chunk_batch->best_number_of_threads;
+	}
+	else
+	{
+		*number_of_threads = chunk_batch->tuned_number_of_threads;
+	}
+	*single_thread_chunk_time = chunk_batch->single_thread_chunk_time;
+
+	return( 1 );
+}
+
+/* Reads the chunks of the batch assigned to a thread
+ * The chunks are assigned by the range scheduler, a thread that has read
+ * its own chunks takes over chunks of the thread with the most chunks left,
+ * since the time needed to read a chunk varies strongly with its content
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_read_thread(
+     libevtx_chunk_batch_thread_arguments_t *thread_arguments )
+{
+	libevtx_chunk_batch_t *chunk_batch = NULL;
+	libevtx_chunk_t *chunk             = NULL;
+	static char *function              = "libevtx_chunk_batch_read_thread";
+	off64_t file_offset                = 0;
+	int chunk_index                    = 0;
+	int result                         = 0;
+
+	if( thread_arguments == NULL )
+	{
+		return( -1 );
+	}
+	chunk_batch = thread_arguments->chunk_batch;
+
+	for( ;; )
+	{
+		result = libevtx_range_scheduler_get_next_index(
+		          chunk_batch->range_scheduler,
+		          thread_arguments->thread_index,
+		          &chunk_index,
+		          &( thread_arguments->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( thread_arguments->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next chunk index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		file_offset = chunk_batch->chunk_offsets[ chunk_index ];
+
+		if( libevtx_chunk_initialize(
+		     &chunk,
+		     &( thread_arguments->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( thread_arguments->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( chunk_batch->verify_only != 0 )
+		{
+			if( libevtx_chunk_verify(
+			     chunk,
+			     &( chunk_batch->io_handle ),
+			     chunk_batch->file_io_handles[ thread_arguments->thread_index ],
+			     file_offset,
+			     &( chunk_batch->verify_results[ chunk_index ] ),
+			     &( thread_arguments->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( thread_arguments->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify chunk at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
+
+				goto on_error;
+			}
+			/* The chunk data is not needed after verification
+			 */
+			if( libevtx_chunk_free(
+			     &chunk,
+			     &( thread_arguments->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( thread_arguments->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+		result = libevtx_chunk_read(
+		          chunk,
+		          &( chunk_batch->io_handle ),
+		          chunk_batch->file_io_handles[ thread_arguments->thread_index ],
+		          file_offset,
+		          &( thread_arguments->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( thread_arguments->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			goto on_error;
+		}
+		chunk_batch->chunks[ chunk_index ]       = chunk;
+		chunk_batch->read_results[ chunk_index ] = result;
+
+		chunk = NULL;
+	}
+	thread_arguments->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	thread_arguments->result = -1;
+
+	return( -1 );
+}
+
+/* Reads the next batch of chunks starting at the file offset
+ * Only chunks that fit entirely before the file size are read
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_read(
+     libevtx_chunk_batch_t *chunk_batch,
+     off64_t file_offset,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_chunk_batch_read";
+	off64_t chunk_offset         = 0;
+	int maximum_number_of_chunks = 0;
+	int number_of_chunks         = 0;
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_batch->verify_only = 0;
+
+	/* While tuning the batch only contains the chunks of the threads that are measured
+	 */
+	maximum_number_of_chunks = chunk_batch->maximum_number_of_chunks;
+
+	if( chunk_batch->is_tuning != 0 )
+	{
+		maximum_number_of_chunks = chunk_batch->tuned_number_of_threads * LIBEVTX_CHUNK_BATCH_NUMBER_OF_CHUNKS_PER_THREAD;
+	}
+	chunk_offset = file_offset;
+
+	while( ( number_of_chunks < maximum_number_of_chunks )
+	    && ( (size64_t) ( chunk_offset + chunk_batch->io_handle.chunk_size ) <= file_size ) )
+	{
+		chunk_batch->chunk_offsets[ number_of_chunks++ ] = chunk_offset;
+
+		chunk_offset += chunk_batch->io_handle.chunk_size;
+	}
+	if( libevtx_chunk_batch_read_chunks(
+	     chunk_batch,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a batch of chunks at specific file offsets
+ * The number of chunks cannot exceed the maximum number of chunks in the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_read_at_offsets(
+     libevtx_chunk_batch_t *chunk_batch,
+     const off64_t *chunk_offsets,
+     int number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_read_at_offsets";
+	int chunk_index       = 0;
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunks < 0 )
+	 || ( number_of_chunks > chunk_batch->maximum_number_of_chunks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_batch->verify_only = 0;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunk_offsets[ chunk_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+			 "%s: invalid chunk offset: %d value less than zero.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		chunk_batch->chunk_offsets[ chunk_index ] = chunk_offsets[ chunk_index ];
+	}
+	if( libevtx_chunk_batch_read_chunks(
+	     chunk_batch,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the chunks at the chunk offsets of the batch
+ * The chunks of the previous batch that were not retrieved are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_read_chunks(
+     libevtx_chunk_batch_t *chunk_batch,
+     int number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_read_chunks";
+	uint64_t start_time   = 0;
+	int chunk_index       = 0;
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunks < 0 )
+	 || ( number_of_chunks > chunk_batch->maximum_number_of_chunks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < chunk_batch->maximum_number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunk_batch->chunks[ chunk_index ] != NULL )
+		{
+			if( libevtx_chunk_free(
+			     &( chunk_batch->chunks[ chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk: %d.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+	}
+	chunk_batch->number_of_chunks = number_of_chunks;
+	chunk_batch->next_chunk_index = 0;
+
+	if( chunk_batch->number_of_chunks == 0 )
+	{
+		return( 1 );
+	}
+	if( chunk_batch->is_tuning != 0 )
+	{
+		start_time = libevtx_statistics_get_time();
+	}
+	if( chunk_batch->io_handle.async_reader != NULL )
+	{
+		/* The reads of the chunks are submitted up front so that they are
+		 * in flight while the threads parse the chunks read before
+		 */
+		for( chunk_index = 0;
+		     chunk_index < chunk_batch->number_of_chunks;
+		     chunk_index++ )
+		{
+			result = libevtx_async_reader_submit(
+			          chunk_batch->io_handle.async_reader,
+			          chunk_batch->chunk_offsets[ chunk_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to submit read of chunk: %d.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		result = 1;
+	}
+	chunk_batch->number_of_active_threads = chunk_batch->tuned_number_of_threads;
+
+	if( chunk_batch->number_of_active_threads > chunk_batch->number_of_chunks )
+	{
+		chunk_batch->number_of_active_threads = chunk_batch->number_of_chunks;
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the chunks are read sequentially
+	 */
+	chunk_batch->number_of_active_threads = 1;
+#endif
+	if( libevtx_range_scheduler_reset(
+	     chunk_batch->range_scheduler,
+	     chunk_batch->number_of_chunks,
+	     chunk_batch->number_of_active_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset range scheduler.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The first thread reads its chunks in the calling thread
+	 */
+	for( thread_index = 1;
+	     thread_index < chunk_batch->number_of_active_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( chunk_batch->threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &libevtx_chunk_batch_read_thread,
+		     (void *) &( chunk_batch->thread_arguments[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			/* Threads that were not created are not joined
+			 */
+			chunk_batch->number_of_active_threads = thread_index;
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		libevtx_chunk_batch_read_thread(
+		 &( chunk_batch->thread_arguments[ 0 ] ) );
+	}
+	for( thread_index = 1;
+	     thread_index < chunk_batch->number_of_active_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( chunk_batch->threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+#else
+	libevtx_chunk_batch_read_thread(
+	 &( chunk_batch->thread_arguments[ 0 ] ) );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( thread_index = 0;
+	     thread_index < chunk_batch->number_of_active_threads;
+	     thread_index++ )
+	{
+		if( chunk_batch->thread_arguments[ thread_index ].result == 1 )
+		{
+			continue;
+		}
+		/* Only the first error is passed to the caller
+		 */
+		if( ( result == 1 )
+		 && ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = chunk_batch->thread_arguments[ thread_index ].error;
+
+			chunk_batch->thread_arguments[ thread_index ].error = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunks in thread: %d.",
+			 function,
+			 thread_index );
+		}
+		else if( chunk_batch->thread_arguments[ thread_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( chunk_batch->thread_arguments[ thread_index ].error ) );
+		}
+		result = -1;
+	}
+	if( ( result == 1 )
+	 && ( chunk_batch->is_tuning != 0 ) )
+	{
+		if( libevtx_chunk_batch_tune(
+		     chunk_batch,
+		     libevtx_statistics_get_time() - start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to tune number of threads.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Verifies the next batch of chunks starting at the file offset
+ * Only chunks that fit entirely before the file size are verified
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_batch_verify(
+     libevtx_chunk_batch_t *chunk_batch,
+     off64_t file_offset,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_verify";
+	off64_t chunk_offset  = 0;
+	int number_of_chunks  = 0;
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_batch->verify_only = 1;
+
+	chunk_offset = file_offset;
+
+	while( ( number_of_chunks < chunk_batch->maximum_number_of_chunks )
+	    && ( (size64_t) ( chunk_offset + chunk_batch->io_handle.chunk_size ) <= file_size ) )
+	{
+		chunk_batch->chunk_offsets[ number_of_chunks++ ] = chunk_offset;
+
+		chunk_offset += chunk_batch->io_handle.chunk_size;
+	}
+	if( libevtx_chunk_batch_read_chunks(
+	     chunk_batch,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify chunks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next verify result of the batch
+ * Returns 1 if successful, 0 if no more verify results are available or -1 on error
+ */
+int libevtx_chunk_batch_get_next_verify_result(
+     libevtx_chunk_batch_t *chunk_batch,
+     off64_t *file_offset,
+     uint32_t *verify_result_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_get_next_verify_result";
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_batch->verify_only == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid chunk batch - chunks were not verified.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_result_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify result flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_batch->next_chunk_index >= chunk_batch->number_of_chunks )
+	{
+		return( 0 );
+	}
+	*file_offset         = chunk_batch->chunk_offsets[ chunk_batch->next_chunk_index ];
+	*verify_result_flags = chunk_batch->verify_results[ chunk_batch->next_chunk_index ];
+
+	chunk_batch->next_chunk_index += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next chunk of the batch
+ * The ownership of the chunk is transferred to the caller
+ * The read result is the return value of libevtx_chunk_read for the chunk
+ * Returns 1 if successful, 0 if no more chunks are available or -1 on error
+ */
+int libevtx_chunk_batch_get_next_chunk(
+     libevtx_chunk_batch_t *chunk_batch,
+     libevtx_chunk_t **chunk,
+     int *read_result,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_batch_get_next_chunk";
+
+	if( chunk_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read result.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_batch->next_chunk_index >= chunk_batch->number_of_chunks )
+	{
+		return( 0 );
+	}
+	*chunk       = chunk_batch->chunks[ chunk_batch->next_chunk_index ];
+	*read_result = chunk_batch->read_results[ chunk_batch->next_chunk_index ];
+
+	chunk_batch->chunks[ chunk_batch->next_chunk_index ] = NULL;
+
+	chunk_batch->next_chunk_index += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,223 @@
+/*
+ * Chunk batch functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_CHUNK_BATCH_H )
+#define _LIBEVTX_CHUNK_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_range_scheduler.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_chunk_batch libevtx_chunk_batch_t;
+typedef struct libevtx_chunk_batch_thread_arguments libevtx_chunk_batch_thread_arguments_t;
+
+struct libevtx_chunk_batch
+{
+	/* The IO handle used by the read threads
+	 * This is a copy of the IO handle of the file without the chunk buffer pool
+	 * as the buffer pool cannot be shared between threads
+	 */
+	libevtx_io_handle_t io_handle;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of threads used to read the current batch
+	 */
+	int number_of_active_threads;
+
+	/* The number of threads used to read the batches
+	 * While the batch is tuned this is doubled for every batch
+	 * until the throughput no longer improves
+	 */
+	int tuned_number_of_threads;
+
+	/* Value to indicate the number of threads is being tuned
+	 */
+	uint8_t is_tuning;
+
+	/* The number of chunks read while tuning
+	 */
+	int number_of_tuning_chunks;
+
+	/* The best time per chunk in nano seconds measured while tuning
+	 */
+	uint64_t best_chunk_time;
+
+	/* The number of threads of the best time per chunk
+	 */
+	int best_number_of_threads;
+
+	/* The time per chunk in nano seconds measured with a single thread
+	 */
+	uint64_t single_thread_chunk_time;
+
+	/* The file IO handles, one for every thread
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* The thread arguments, one for every thread
+	 */
+	libevtx_chunk_batch_thread_arguments_t *thread_arguments;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The threads
+	 */
+	libcthreads_thread_t **threads;
+#endif
+
+	/* The range scheduler that distributes the chunks over the threads
+	 */
+	libevtx_range_scheduler_t *range_scheduler;
+
+	/* The chunks
+	 */
+	libevtx_chunk_t **chunks;
+
+	/* The chunk read results
+	 */
+	int *read_results;
+
+	/* Value to indicate the chunks are only verified and not read
+	 */
+	uint8_t verify_only;
+
+	/* The chunk verify result flags
+	 */
+	uint32_t *verify_results;
+
+	/* The maximum number of chunks in the batch
+	 */
+	int maximum_number_of_chunks;
+
+	/* The number of chunks in the batch
+	 */
+	int number_of_chunks;
+
+	/* The index of the next chunk to retrieve from the batch
+	 */
+	int next_chunk_index;
+
+	/* The file offsets of the chunks in the batch
+	 */
+	off64_t *chunk_offsets;
+};
+
+struct libevtx_chunk_batch_thread_arguments
+{
+	/* The chunk batch
+	 */
+	libevtx_chunk_batch_t *chunk_batch;
+
+	/* The thread index
+	 */
+	int thread_index;
+
+	/* The read result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libevtx_chunk_batch_initialize(
+     libevtx_chunk_batch_t **chunk_batch,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_free(
+     libevtx_chunk_batch_t **chunk_batch,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_start_tuning(
+     libevtx_chunk_batch_t *chunk_batch,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_tune(
+     libevtx_chunk_batch_t *chunk_batch,
+     uint64_t batch_time,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_get_tuned_values(
+     libevtx_chunk_batch_t *chunk_batch,
+     int *number_of_threads,
+     uint64_t *single_thread_chunk_time,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_read_thread(
+     libevtx_chunk_batch_thread_arguments_t *thread_arguments );
+
+int libevtx_chunk_batch_read(
+     libevtx_chunk_batch_t *chunk_batch,
+     off64_t file_offset,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_read_at_offsets(
+     libevtx_chunk_batch_t *chunk_batch,
+     const off64_t *chunk_offsets,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_read_chunks(
+     libevtx_chunk_batch_t *chunk_batch,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_verify(
+     libevtx_chunk_batch_t *chunk_batch,
+     off64_t file_offset,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_get_next_verify_result(
+     libevtx_chunk_batch_t *chunk_batch,
+     off64_t *file_offset,
+     uint32_t *verify_result_flags,
+     libcerror_error_t **error );
+
+int libevtx_chunk_batch_get_next_chunk(
+     libevtx_chunk_batch_t *chunk_batch,
+     libevtx_chunk_t **chunk,
+     int *read_result,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_CHUNK_BATCH_H ) */
+
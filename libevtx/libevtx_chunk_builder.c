@@ -0,0 +1,1786 @@
+/*
+ * Chunk builder functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_builder.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+
+#include "evtx_chunk.h"
+#include "evtx_event_record.h"
+
+/* Creates a chunk builder
+ * Make sure the value chunk_builder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_builder_initialize(
+     libevtx_chunk_builder_t **chunk_builder,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_builder_initialize";
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_builder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk builder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offsets in the chunk data are stored as 16-bit values
+	 */
+	if( ( chunk_size <= LIBEVTX_CHUNK_BUILDER_HEADER_SIZE )
+	 || ( chunk_size > (size_t) 65536 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_builder = memory_allocate_structure(
+	                  libevtx_chunk_builder_t );
+
+	if( *chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_builder,
+	     0,
+	     sizeof( libevtx_chunk_builder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk builder.",
+		 function );
+
+		memory_free(
+		 *chunk_builder );
+
+		*chunk_builder = NULL;
+
+		return( -1 );
+	}
+	( *chunk_builder )->data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * chunk_size );
+
+	if( ( *chunk_builder )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_builder )->data_size = chunk_size;
+
+	( *chunk_builder )->copied_offsets = (uint16_t *) memory_allocate(
+	                                                   sizeof( uint16_t ) * chunk_size );
+
+	if( ( *chunk_builder )->copied_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create copied offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_chunk_builder_reset(
+	     *chunk_builder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset chunk builder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_builder != NULL )
+	{
+		if( ( *chunk_builder )->copied_offsets != NULL )
+		{
+			memory_free(
+			 ( *chunk_builder )->copied_offsets );
+		}
+		if( ( *chunk_builder )->data != NULL )
+		{
+			memory_free(
+			 ( *chunk_builder )->data );
+		}
+		memory_free(
+		 *chunk_builder );
+
+		*chunk_builder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk builder
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_builder_free(
+     libevtx_chunk_builder_t **chunk_builder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_builder_free";
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_builder != NULL )
+	{
+		if( ( *chunk_builder )->copied_offsets != NULL )
+		{
+			memory_free(
+			 ( *chunk_builder )->copied_offsets );
+		}
+		if( ( *chunk_builder )->data != NULL )
+		{
+			memory_free(
+			 ( *chunk_builder )->data );
+		}
+		memory_free(
+		 *chunk_builder );
+
+		*chunk_builder = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets a chunk builder to build a new chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_builder_reset(
+     libevtx_chunk_builder_t *chunk_builder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_builder_reset";
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk_builder->data,
+	     0,
+	     chunk_builder->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_builder_clear_copied_offsets(
+	     chunk_builder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear copied offsets.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_builder->free_space_offset       = LIBEVTX_CHUNK_BUILDER_HEADER_SIZE;
+	chunk_builder->write_offset            = LIBEVTX_CHUNK_BUILDER_HEADER_SIZE;
+	chunk_builder->last_record_offset      = 0;
+	chunk_builder->number_of_records       = 0;
+	chunk_builder->first_record_identifier = 0;
+	chunk_builder->last_record_identifier  = 0;
+
+	return( 1 );
+}
+
+/* Clears the offsets of the names and template definitions that were copied
+ * This function needs to be called before appending records of another chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_builder_clear_copied_offsets(
+     libevtx_chunk_builder_t *chunk_builder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_builder_clear_copied_offsets";
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk_builder->copied_offsets,
+	     0,
+	     sizeof( uint16_t ) * chunk_builder->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear copied offsets.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a record of another chunk
+ * The binary XML of the record is copied with the names and template definitions
+ * it references relocated to this chunk. A name or template definition that was
+ * not copied to this chunk before is stored in the record data
+ * The copied offsets must be cleared when the records are of another chunk than before
+ * Returns 1 if successful, 0 if the record does not fit in the chunk or -1 on error
+ */
+int libevtx_chunk_builder_append_record(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libevtx_chunk_builder_append_record";
+	size_t chunk_data_offset  = 0;
+	size_t end_of_data_offset = 0;
+	size_t record_offset      = 0;
+	size_t record_size        = 0;
+	size_t source_offset      = 0;
+	uint64_t identifier       = 0;
+	int result                = 0;
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The copied offsets are indexed by the offsets in the source chunk data
+	 */
+	if( chunk_data_size > chunk_builder->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_offset >= chunk_data_size )
+	 || ( record_data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
+	 || ( record_data_size > ( chunk_data_size - record_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The string table is restored if the record does not fit
+	 */
+	if( memory_copy(
+	     chunk_builder->string_table,
+	     &( chunk_builder->data[ sizeof( evtx_chunk_header_t ) ] ),
+	     LIBEVTX_CHUNK_BUILDER_NUMBER_OF_STRING_TABLE_ENTRIES * 4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string table.",
+		 function );
+
+		return( -1 );
+	}
+	record_offset               = chunk_builder->free_space_offset;
+	chunk_builder->write_offset = record_offset;
+
+	result = libevtx_chunk_builder_write_data(
+	          chunk_builder,
+	          &( chunk_data[ record_data_offset ] ),
+	          sizeof( evtx_event_record_header_t ),
+	          error );
+
+	if( result == 1 )
+	{
+		chunk_data_offset  = record_data_offset + sizeof( evtx_event_record_header_t );
+		end_of_data_offset = record_data_offset + record_data_size - 4;
+
+		result = libevtx_chunk_builder_copy_tokens(
+		          chunk_builder,
+		          chunk_data,
+		          chunk_data_size,
+		          &chunk_data_offset,
+		          end_of_data_offset,
+		          0,
+		          error );
+	}
+	if( result == 1 )
+	{
+		/* The record ends with a copy of the record size
+		 */
+		result = libevtx_chunk_builder_write_data(
+		          chunk_builder,
+		          &( chunk_data[ end_of_data_offset ] ),
+		          4,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to copy record.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( memory_copy(
+		     &( chunk_builder->data[ sizeof( evtx_chunk_header_t ) ] ),
+		     chunk_builder->string_table,
+		     LIBEVTX_CHUNK_BUILDER_NUMBER_OF_STRING_TABLE_ENTRIES * 4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to restore string table.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     &( chunk_builder->data[ record_offset ] ),
+		     0,
+		     chunk_builder->write_offset - record_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear record data.",
+			 function );
+
+			return( -1 );
+		}
+		/* Names and template definitions copied as part of the record are no longer available
+		 */
+		for( source_offset = 0;
+		     source_offset < chunk_builder->data_size;
+		     source_offset++ )
+		{
+			if( (size_t) chunk_builder->copied_offsets[ source_offset ] >= record_offset )
+			{
+				chunk_builder->copied_offsets[ source_offset ] = 0;
+			}
+		}
+		chunk_builder->write_offset = record_offset;
+
+		return( 0 );
+	}
+	record_size = chunk_builder->write_offset - record_offset;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_event_record_header_t *) &( chunk_builder->data[ record_offset ] ) )->size,
+	 (uint32_t) record_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_builder->data[ chunk_builder->write_offset - 4 ] ),
+	 (uint32_t) record_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_event_record_header_t *) &( chunk_builder->data[ record_offset ] ) )->identifier,
+	 identifier );
+
+	if( chunk_builder->number_of_records == 0 )
+	{
+		chunk_builder->first_record_identifier = identifier;
+	}
+	chunk_builder->last_record_identifier = identifier;
+	chunk_builder->last_record_offset     = record_offset;
+	chunk_builder->free_space_offset      = chunk_builder->write_offset;
+
+	chunk_builder->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Finalizes the chunk
+ * Writes the chunk header and calculates the event records and header checksums
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_builder_finalize(
+     libevtx_chunk_builder_t *chunk_builder,
+     libcerror_error_t **error )
+{
+	evtx_chunk_header_t *chunk_header = NULL;
+	static char *function             = "libevtx_chunk_builder_finalize";
+	uint32_t calculated_checksum      = 0;
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_header = (evtx_chunk_header_t *) chunk_builder->data;
+
+	if( memory_copy(
+	     chunk_header->signature,
+	     evtx_chunk_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The event record numbers of a chunk correspond to the event record identifiers
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 chunk_header->first_event_record_number,
+	 chunk_builder->first_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 chunk_header->last_event_record_number,
+	 chunk_builder->last_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 chunk_header->first_event_record_identifier,
+	 chunk_builder->first_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 chunk_header->last_event_record_identifier,
+	 chunk_builder->last_record_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->header_size,
+	 (uint32_t) sizeof( evtx_chunk_header_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->last_event_record_offset,
+	 (uint32_t) chunk_builder->last_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->free_space_offset,
+	 (uint32_t) chunk_builder->free_space_offset );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk_builder->data[ LIBEVTX_CHUNK_BUILDER_HEADER_SIZE ] ),
+	     chunk_builder->free_space_offset - LIBEVTX_CHUNK_BUILDER_HEADER_SIZE,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate event records CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->event_records_checksum,
+	 calculated_checksum );
+
+	/* The header checksum is calculated over the first 120 bytes
+	 * of the chunk header and the 384 bytes of the chunk tables
+	 */
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     chunk_builder->data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate header CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk_builder->data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate header CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 chunk_header->checksum,
+	 calculated_checksum );
+
+	return( 1 );
+}
+
+/* Writes data at the write offset of the chunk
+ * Returns 1 if successful, 0 if the data does not fit in the chunk or -1 on error
+ */
+int libevtx_chunk_builder_write_data(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_builder_write_data";
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( chunk_builder->data_size - chunk_builder->write_offset ) )
+	{
+		return( 0 );
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( chunk_builder->data[ chunk_builder->write_offset ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_builder->write_offset += data_size;
+	}
+	return( 1 );
+}
+
+/* Copies the binary XML tokens up to the end of data offset
+ * Returns 1 if successful, 0 if the tokens do not fit in the chunk or -1 on error
+ */
+int libevtx_chunk_builder_copy_tokens(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int depth,
+     libcerror_error_t **error )
+{
+	static char *function         = "libevtx_chunk_builder_copy_tokens";
+	size_t safe_chunk_data_offset = 0;
+	size_t token_size             = 0;
+	uint16_t number_of_characters = 0;
+	uint8_t token                 = 0;
+	int result                    = 1;
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	while( safe_chunk_data_offset < end_of_data_offset )
+	{
+		token      = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+		token_size = 0;
+
+		switch( token )
+		{
+			case LIBEVTX_BINARY_XML_TOKEN_END_OF_FILE:
+			case LIBEVTX_BINARY_XML_TOKEN_CLOSE_START_ELEMENT_TAG:
+			case LIBEVTX_BINARY_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG:
+			case LIBEVTX_BINARY_XML_TOKEN_END_ELEMENT_TAG:
+				token_size = 1;
+				break;
+
+			/* The character reference consists of the token and the character value
+			 */
+			case LIBEVTX_BINARY_XML_TOKEN_CHARACTER_REFERENCE:
+				token_size = 3;
+				break;
+
+			/* The substitution consists of the token, the substitution index and the value type,
+			 * the fragment header of the token, major and minor version and flags
+			 */
+			case LIBEVTX_BINARY_XML_TOKEN_NORMAL_SUBSTITUTION:
+			case LIBEVTX_BINARY_XML_TOKEN_OPTIONAL_SUBSTITUTION:
+			case LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER:
+				token_size = 4;
+				break;
+
+			/* The value consists of the token, the value type, the number of characters
+			 * and the UTF-16 little-endian characters
+			 */
+			case LIBEVTX_BINARY_XML_TOKEN_VALUE:
+				if( ( end_of_data_offset - safe_chunk_data_offset ) < 4 )
+				{
+					break;
+				}
+				if( chunk_data[ safe_chunk_data_offset + 1 ] != LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported value type: 0x%02" PRIx8 ".",
+					 function,
+					 chunk_data[ safe_chunk_data_offset + 1 ] );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( chunk_data[ safe_chunk_data_offset + 2 ] ),
+				 number_of_characters );
+
+				token_size = 4 + ( (size_t) number_of_characters * 2 );
+				break;
+
+			/* The CDATA section and processing instruction data consist of the token,
+			 * the number of characters and the UTF-16 little-endian characters
+			 */
+			case LIBEVTX_BINARY_XML_TOKEN_CDATA_SECTION:
+			case LIBEVTX_BINARY_XML_TOKEN_PI_DATA:
+				if( ( end_of_data_offset - safe_chunk_data_offset ) < 3 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+				 number_of_characters );
+
+				token_size = 3 + ( (size_t) number_of_characters * 2 );
+				break;
+
+			/* The attribute, entity reference and processing instruction target
+			 * consist of the token and a name
+			 */
+			case LIBEVTX_BINARY_XML_TOKEN_ATTRIBUTE:
+			case LIBEVTX_BINARY_XML_TOKEN_ENTITY_REFERENCE:
+			case LIBEVTX_BINARY_XML_TOKEN_PI_TARGET:
+				result = libevtx_chunk_builder_write_data(
+				          chunk_builder,
+				          &( chunk_data[ safe_chunk_data_offset ] ),
+				          1,
+				          error );
+
+				if( result == 1 )
+				{
+					safe_chunk_data_offset += 1;
+
+					result = libevtx_chunk_builder_copy_name(
+					          chunk_builder,
+					          chunk_data,
+					          chunk_data_size,
+					          &safe_chunk_data_offset,
+					          end_of_data_offset,
+					          error );
+				}
+				break;
+
+			case LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG:
+				result = libevtx_chunk_builder_copy_element(
+				          chunk_builder,
+				          chunk_data,
+				          chunk_data_size,
+				          &safe_chunk_data_offset,
+				          end_of_data_offset,
+				          depth,
+				          error );
+				break;
+
+			case LIBEVTX_BINARY_XML_TOKEN_TEMPLATE_INSTANCE:
+				result = libevtx_chunk_builder_copy_template_instance(
+				          chunk_builder,
+				          chunk_data,
+				          chunk_data_size,
+				          &safe_chunk_data_offset,
+				          end_of_data_offset,
+				          depth,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported binary XML token: 0x%02" PRIx8 ".",
+				 function,
+				 chunk_data[ safe_chunk_data_offset ] );
+
+				return( -1 );
+		}
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to copy binary XML token: 0x%02" PRIx8 ".",
+				 function,
+				 token );
+			}
+			return( result );
+		}
+		if( ( token == LIBEVTX_BINARY_XML_TOKEN_ATTRIBUTE )
+		 || ( token == LIBEVTX_BINARY_XML_TOKEN_ENTITY_REFERENCE )
+		 || ( token == LIBEVTX_BINARY_XML_TOKEN_PI_TARGET )
+		 || ( token == LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+		 || ( token == LIBEVTX_BINARY_XML_TOKEN_TEMPLATE_INSTANCE ) )
+		{
+			continue;
+		}
+		if( ( token_size == 0 )
+		 || ( token_size > ( end_of_data_offset - safe_chunk_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid binary XML token: 0x%02" PRIx8 " size value out of bounds.",
+			 function,
+			 token );
+
+			return( -1 );
+		}
+		result = libevtx_chunk_builder_write_data(
+		          chunk_builder,
+		          &( chunk_data[ safe_chunk_data_offset ] ),
+		          token_size,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		safe_chunk_data_offset += token_size;
+	}
+	*chunk_data_offset = safe_chunk_data_offset;
+
+	return( 1 );
+}
+
+/* Copies a binary XML element
+ * The element data size and attribute list size are updated to the size of the copied data
+ * Returns 1 if successful, 0 if the element does not fit in the chunk or -1 on error
+ */
+int libevtx_chunk_builder_copy_element(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int depth,
+     libcerror_error_t **error )
+{
+	static char *function         = "libevtx_chunk_builder_copy_element";
+	size_t attributes_data_offset = 0;
+	size_t attributes_end_offset  = 0;
+	size_t element_data_offset    = 0;
+	size_t element_end_offset     = 0;
+	size_t safe_chunk_data_offset = 0;
+	uint32_t attributes_data_size = 0;
+	uint32_t element_data_size    = 0;
+	uint8_t element_token         = 0;
+	int result                    = 0;
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth >= LIBEVTX_CHUNK_BUILDER_MAXIMUM_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	/* The open start element tag consists of the token, dependency identifier,
+	 * element data size and element name
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 11 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	element_token = chunk_data[ safe_chunk_data_offset ];
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 3 ] ),
+	 element_data_size );
+
+	if( (size_t) element_data_size > ( end_of_data_offset - ( safe_chunk_data_offset + 7 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	element_end_offset = safe_chunk_data_offset + 7 + element_data_size;
+
+	result = libevtx_chunk_builder_write_data(
+	          chunk_builder,
+	          &( chunk_data[ safe_chunk_data_offset ] ),
+	          7,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	safe_chunk_data_offset += 7;
+	element_data_offset     = chunk_builder->write_offset;
+
+	result = libevtx_chunk_builder_copy_name(
+	          chunk_builder,
+	          chunk_data,
+	          chunk_data_size,
+	          &safe_chunk_data_offset,
+	          element_end_offset,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( ( element_token & LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA ) != 0 )
+	{
+		if( ( element_end_offset - safe_chunk_data_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chunk_data[ safe_chunk_data_offset ] ),
+		 attributes_data_size );
+
+		if( (size_t) attributes_data_size > ( element_end_offset - ( safe_chunk_data_offset + 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid attributes data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		attributes_end_offset = safe_chunk_data_offset + 4 + attributes_data_size;
+
+		result = libevtx_chunk_builder_write_data(
+		          chunk_builder,
+		          &( chunk_data[ safe_chunk_data_offset ] ),
+		          4,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		safe_chunk_data_offset += 4;
+		attributes_data_offset  = chunk_builder->write_offset;
+
+		result = libevtx_chunk_builder_copy_tokens(
+		          chunk_builder,
+		          chunk_data,
+		          chunk_data_size,
+		          &safe_chunk_data_offset,
+		          attributes_end_offset,
+		          depth,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( chunk_builder->data[ attributes_data_offset - 4 ] ),
+		 (uint32_t) ( chunk_builder->write_offset - attributes_data_offset ) );
+	}
+	result = libevtx_chunk_builder_copy_tokens(
+	          chunk_builder,
+	          chunk_data,
+	          chunk_data_size,
+	          &safe_chunk_data_offset,
+	          element_end_offset,
+	          depth + 1,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	/* The element data size is stored before the element name
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_builder->data[ element_data_offset - 4 ] ),
+	 (uint32_t) ( chunk_builder->write_offset - element_data_offset ) );
+
+	*chunk_data_offset = safe_chunk_data_offset;
+
+	return( 1 );
+}
+
+/* Copies a name
+ * The name consists of the name offset, which is followed by the name itself
+ * the first time the name is used in the chunk
+ * Returns 1 if successful, 0 if the name does not fit in the chunk or -1 on error
+ */
+int libevtx_chunk_builder_copy_name(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     libcerror_error_t **error )
+{
+	uint8_t name_offset_data[ 4 ];
+
+	static char *function         = "libevtx_chunk_builder_copy_name";
+	size_t name_data_size         = 0;
+	size_t safe_chunk_data_offset = 0;
+	size_t string_table_offset    = 0;
+	uint32_t copied_name_offset   = 0;
+	uint32_t name_offset          = 0;
+	uint16_t name_hash            = 0;
+	uint16_t number_of_characters = 0;
+	int result                    = 0;
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset ] ),
+	 name_offset );
+
+	safe_chunk_data_offset += 4;
+
+	/* The name consists of the next name offset, the name hash, the number of characters
+	 * and the UTF-16 little-endian characters including the end of string character
+	 */
+	if( ( (size_t) name_offset < LIBEVTX_CHUNK_BUILDER_HEADER_SIZE )
+	 || ( (size_t) name_offset >= chunk_data_size )
+	 || ( ( chunk_data_size - name_offset ) < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( chunk_data[ name_offset + 4 ] ),
+	 name_hash );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( chunk_data[ name_offset + 6 ] ),
+	 number_of_characters );
+
+	name_data_size = 8 + ( ( (size_t) number_of_characters + 1 ) * 2 );
+
+	if( name_data_size > ( chunk_data_size - name_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name is stored after the name offset the first time it is used in the source chunk
+	 */
+	if( (size_t) name_offset == safe_chunk_data_offset )
+	{
+		if( name_data_size > ( end_of_data_offset - safe_chunk_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_chunk_data_offset += name_data_size;
+	}
+	copied_name_offset = (uint32_t) chunk_builder->copied_offsets[ name_offset ];
+
+	if( copied_name_offset != 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 name_offset_data,
+		 copied_name_offset );
+
+		result = libevtx_chunk_builder_write_data(
+		          chunk_builder,
+		          name_offset_data,
+		          4,
+		          error );
+	}
+	else
+	{
+		/* The name is stored after the name offset the first time it is used in this chunk
+		 */
+		if( ( 4 + name_data_size ) > ( chunk_builder->data_size - chunk_builder->write_offset ) )
+		{
+			return( 0 );
+		}
+		copied_name_offset = (uint32_t) ( chunk_builder->write_offset + 4 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 name_offset_data,
+		 copied_name_offset );
+
+		result = libevtx_chunk_builder_write_data(
+		          chunk_builder,
+		          name_offset_data,
+		          4,
+		          error );
+
+		if( result == 1 )
+		{
+			result = libevtx_chunk_builder_write_data(
+			          chunk_builder,
+			          &( chunk_data[ name_offset ] ),
+			          name_data_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			/* The names with the same hash are chained from the string table
+			 */
+			string_table_offset = sizeof( evtx_chunk_header_t )
+			                    + ( ( name_hash % LIBEVTX_CHUNK_BUILDER_NUMBER_OF_STRING_TABLE_ENTRIES ) * 4 );
+
+			if( memory_copy(
+			     &( chunk_builder->data[ copied_name_offset ] ),
+			     &( chunk_builder->data[ string_table_offset ] ),
+			     4 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy next name offset.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 &( chunk_builder->data[ string_table_offset ] ),
+			 copied_name_offset );
+
+			chunk_builder->copied_offsets[ name_offset ] = (uint16_t) copied_name_offset;
+		}
+	}
+	if( result != 1 )
+	{
+		return( result );
+	}
+	*chunk_data_offset = safe_chunk_data_offset;
+
+	return( 1 );
+}
+
+/* Copies a binary XML template instance
+ * The template definition is stored after the template instance the first time
+ * it is used in the chunk. Binary XML substitution values are copied as binary XML
+ * and their value sizes are updated to the size of the copied data
+ * Returns 1 if successful, 0 if the template instance does not fit in the chunk or -1 on error
+ */
+int libevtx_chunk_builder_copy_template_instance(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int depth,
+     libcerror_error_t **error )
+{
+	uint8_t template_definition_header_data[ 24 ];
+
+	static char *function               = "libevtx_chunk_builder_copy_template_instance";
+	size_t descriptors_offset           = 0;
+	size_t safe_chunk_data_offset       = 0;
+	size_t template_data_offset         = 0;
+	size_t template_end_offset          = 0;
+	size_t value_data_offset            = 0;
+	size_t value_end_offset             = 0;
+	size_t write_data_offset            = 0;
+	uint32_t copied_definition_offset   = 0;
+	uint32_t number_of_values           = 0;
+	uint32_t template_data_size         = 0;
+	uint32_t template_definition_offset = 0;
+	uint32_t value_index                = 0;
+	uint16_t value_data_size            = 0;
+	int result                          = 0;
+
+	if( chunk_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth >= LIBEVTX_CHUNK_BUILDER_MAXIMUM_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	/* The template instance consists of the token, an unknown value,
+	 * the template identifier and the template definition offset
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 10 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 6 ] ),
+	 template_definition_offset );
+
+	result = libevtx_chunk_builder_write_data(
+	          chunk_builder,
+	          &( chunk_data[ safe_chunk_data_offset ] ),
+	          6,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	safe_chunk_data_offset += 10;
+
+	/* The template definition header consists of the next template definition offset,
+	 * the template identifier and the template data size
+	 */
+	if( ( (size_t) template_definition_offset < LIBEVTX_CHUNK_BUILDER_HEADER_SIZE )
+	 || ( (size_t) template_definition_offset >= chunk_data_size )
+	 || ( ( chunk_data_size - template_definition_offset ) < 24 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template definition offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ template_definition_offset + 20 ] ),
+	 template_data_size );
+
+	template_data_offset = (size_t) template_definition_offset + 24;
+
+	if( (size_t) template_data_size > ( chunk_data_size - template_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	template_end_offset = template_data_offset + template_data_size;
+
+	/* The template definition is stored after the template instance the first time
+	 * it is used in the source chunk
+	 */
+	if( (size_t) template_definition_offset == safe_chunk_data_offset )
+	{
+		if( template_end_offset > end_of_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid template data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_chunk_data_offset = template_end_offset;
+	}
+	copied_definition_offset = (uint32_t) chunk_builder->copied_offsets[ template_definition_offset ];
+
+	if( copied_definition_offset != 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 template_definition_header_data,
+		 copied_definition_offset );
+
+		result = libevtx_chunk_builder_write_data(
+		          chunk_builder,
+		          template_definition_header_data,
+		          4,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+	}
+	else
+	{
+		/* The template definition is stored after the template instance the first time
+		 * it is used in this chunk, the template definitions are not chained
+		 */
+		copied_definition_offset = (uint32_t) ( chunk_builder->write_offset + 4 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 template_definition_header_data,
+		 copied_definition_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( template_definition_header_data[ 4 ] ),
+		 0 );
+
+		if( memory_copy(
+		     &( template_definition_header_data[ 8 ] ),
+		     &( chunk_data[ template_definition_offset + 4 ] ),
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy template identifier.",
+			 function );
+
+			return( -1 );
+		}
+		result = libevtx_chunk_builder_write_data(
+		          chunk_builder,
+		          template_definition_header_data,
+		          24,
+		          error );
+
+		if( result == 1 )
+		{
+			/* The template data size is written after the template data was copied
+			 */
+			result = libevtx_chunk_builder_write_data(
+			          chunk_builder,
+			          &( chunk_data[ template_definition_offset + 20 ] ),
+			          4,
+			          error );
+		}
+		if( result != 1 )
+		{
+			return( result );
+		}
+		write_data_offset = chunk_builder->write_offset;
+
+		result = libevtx_chunk_builder_copy_tokens(
+		          chunk_builder,
+		          chunk_data,
+		          chunk_data_size,
+		          &template_data_offset,
+		          template_end_offset,
+		          depth + 1,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( chunk_builder->data[ write_data_offset - 4 ] ),
+		 (uint32_t) ( chunk_builder->write_offset - write_data_offset ) );
+
+		chunk_builder->copied_offsets[ template_definition_offset ] = (uint16_t) copied_definition_offset;
+	}
+	/* The substitution values consist of the number of values, a size and type
+	 * descriptor per value and the value data
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset ] ),
+	 number_of_values );
+
+	if( (size_t) number_of_values > ( ( end_of_data_offset - ( safe_chunk_data_offset + 4 ) ) / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_chunk_builder_write_data(
+	          chunk_builder,
+	          &( chunk_data[ safe_chunk_data_offset ] ),
+	          4 + ( (size_t) number_of_values * 4 ),
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	descriptors_offset = chunk_builder->write_offset - ( (size_t) number_of_values * 4 );
+	value_data_offset  = safe_chunk_data_offset + 4 + ( (size_t) number_of_values * 4 );
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( chunk_data[ safe_chunk_data_offset + 4 + ( (size_t) value_index * 4 ) ] ),
+		 value_data_size );
+
+		if( (size_t) value_data_size > ( end_of_data_offset - value_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value: %" PRIu32 " data size value out of bounds.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		value_end_offset = value_data_offset + value_data_size;
+
+		if( chunk_data[ safe_chunk_data_offset + 4 + ( (size_t) value_index * 4 ) + 2 ] == LIBEVTX_VALUE_TYPE_BINARY_XML )
+		{
+			/* The binary XML substitution value contains a fragment
+			 */
+			write_data_offset = chunk_builder->write_offset;
+
+			result = libevtx_chunk_builder_copy_tokens(
+			          chunk_builder,
+			          chunk_data,
+			          chunk_data_size,
+			          &value_data_offset,
+			          value_end_offset,
+			          depth + 1,
+			          error );
+
+			if( result != 1 )
+			{
+				return( result );
+			}
+			if( ( chunk_builder->write_offset - write_data_offset ) > (size_t) UINT16_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid value: %" PRIu32 " copied data size value exceeds maximum.",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( chunk_builder->data[ descriptors_offset + ( (size_t) value_index * 4 ) ] ),
+			 (uint16_t) ( chunk_builder->write_offset - write_data_offset ) );
+		}
+		else
+		{
+			result = libevtx_chunk_builder_write_data(
+			          chunk_builder,
+			          &( chunk_data[ value_data_offset ] ),
+			          (size_t) value_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				return( result );
+			}
+			value_data_offset = value_end_offset;
+		}
+	}
+	*chunk_data_offset = value_data_offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,168 @@
+/*
+ * Chunk builder functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_CHUNK_BUILDER_H )
+#define _LIBEVTX_CHUNK_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum element and template instance depth that is copied
+ */
+#define LIBEVTX_CHUNK_BUILDER_MAXIMUM_DEPTH		64
+
+/* The size of the chunk header including the string and template tables
+ */
+#define LIBEVTX_CHUNK_BUILDER_HEADER_SIZE		512
+
+/* The number of entries in the string table of the chunk header
+ */
+#define LIBEVTX_CHUNK_BUILDER_NUMBER_OF_STRING_TABLE_ENTRIES	64
+
+typedef struct libevtx_chunk_builder libevtx_chunk_builder_t;
+
+struct libevtx_chunk_builder
+{
+	/* The chunk data
+	 */
+	uint8_t *data;
+
+	/* The chunk data size
+	 */
+	size_t data_size;
+
+	/* The offset of the free space in the chunk data
+	 * Contains the offset after the last record that was appended
+	 */
+	size_t free_space_offset;
+
+	/* The offset in the chunk data the record that is being appended is written to
+	 */
+	size_t write_offset;
+
+	/* The offset of the last record in the chunk data
+	 */
+	size_t last_record_offset;
+
+	/* The number of records
+	 */
+	uint32_t number_of_records;
+
+	/* The first record identifier
+	 */
+	uint64_t first_record_identifier;
+
+	/* The last record identifier
+	 */
+	uint64_t last_record_identifier;
+
+	/* The chunk data offsets of the names and template definitions that were copied,
+	 * indexed by their offset in the source chunk data, 0 if not copied
+	 */
+	uint16_t *copied_offsets;
+
+	/* The string table of the chunk header before the record that is being appended
+	 */
+	uint8_t string_table[ LIBEVTX_CHUNK_BUILDER_NUMBER_OF_STRING_TABLE_ENTRIES * 4 ];
+};
+
+int libevtx_chunk_builder_initialize(
+     libevtx_chunk_builder_t **chunk_builder,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_free(
+     libevtx_chunk_builder_t **chunk_builder,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_reset(
+     libevtx_chunk_builder_t *chunk_builder,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_clear_copied_offsets(
+     libevtx_chunk_builder_t *chunk_builder,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_append_record(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_finalize(
+     libevtx_chunk_builder_t *chunk_builder,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_write_data(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_copy_tokens(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int depth,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_copy_element(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int depth,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_copy_name(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_chunk_builder_copy_template_instance(
+     libevtx_chunk_builder_t *chunk_builder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int depth,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_CHUNK_BUILDER_H ) */
+
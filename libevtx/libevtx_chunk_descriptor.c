@@ -0,0 +1,1151 @@
+/*
+ * Chunk descriptor functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_byte_stream.h"
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_definitions.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_event_data_values.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_value_filter.h"
+
+#include "evtx_chunk.h"
+
+/* Creates a chunk descriptor
+ * Make sure the value chunk_descriptor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_descriptor_initialize(
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_descriptor_initialize";
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_descriptor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_descriptor = memory_allocate_structure(
+	                     libevtx_chunk_descriptor_t );
+
+	if( *chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_descriptor,
+	     0,
+	     sizeof( libevtx_chunk_descriptor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_descriptor != NULL )
+	{
+		memory_free(
+		 *chunk_descriptor );
+
+		*chunk_descriptor = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_descriptor_free(
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_descriptor_free";
+	int result            = 1;
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_descriptor != NULL )
+	{
+		if( ( *chunk_descriptor )->value_filter != NULL )
+		{
+			if( libevtx_value_filter_free(
+			     &( ( *chunk_descriptor )->value_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *chunk_descriptor );
+
+		*chunk_descriptor = NULL;
+	}
+	return( result );
+}
+
+/* Reads the chunk descriptor from the chunk header data
+ * The data should contain the chunk header and the string and template tables (512 bytes)
+ * Returns 1 if successful, 0 if the chunk header is 0-byte filled or -1 on error
+ */
+int libevtx_chunk_descriptor_read_data(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libevtx_chunk_descriptor_read_data";
+	uint64_t first_event_record_number  = 0;
+	uint64_t last_event_record_number   = 0;
+	uint32_t calculated_checksum        = 0;
+	uint32_t header_size                = 0;
+	uint32_t stored_checksum            = 0;
+	int result                          = 0;
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 512 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_descriptor->first_record_identifier = 0;
+	chunk_descriptor->last_record_identifier  = 0;
+	chunk_descriptor->number_of_records       = 0;
+	chunk_descriptor->flags                   = 0;
+
+	/* The signature is checked first since only chunk headers without
+	 * a valid signature need to be scanned for 0-byte fill
+	 */
+	if( memory_compare(
+	     ( (evtx_chunk_header_t *) data )->signature,
+	     evtx_chunk_signature,
+	     8 ) != 0 )
+	{
+		result = libevtx_byte_stream_check_for_zero_byte_fill(
+		          data,
+		          512,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine of chunk header is 0-byte filled.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 0 );
+		}
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported chunk signature.\n",
+			 function );
+		}
+#endif
+		chunk_descriptor->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->first_event_record_number,
+	 first_event_record_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->last_event_record_number,
+	 last_event_record_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->first_event_record_identifier,
+	 chunk_descriptor->first_record_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->last_event_record_identifier,
+	 chunk_descriptor->last_record_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->event_records_checksum,
+	 chunk_descriptor->event_records_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->checksum,
+	 stored_checksum );
+
+	chunk_descriptor->header_checksum = stored_checksum;
+
+	if( header_size != 128 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported chunk: %" PRIu16 " header size: %" PRIu32 ".\n",
+			 function,
+			 chunk_descriptor->chunk_index,
+			 header_size );
+		}
+#endif
+		chunk_descriptor->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+
+		return( 1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) &( data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in chunk: %" PRIu16 " header CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 chunk_descriptor->chunk_index,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		chunk_descriptor->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+	}
+	if( first_event_record_number > last_event_record_number )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: invalid chunk: %" PRIu16 " first event record number: %" PRIu64 " exceeds last event record number: %" PRIu64 ".\n",
+			 function,
+			 chunk_descriptor->chunk_index,
+			 first_event_record_number,
+			 last_event_record_number );
+		}
+#endif
+		chunk_descriptor->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+	}
+	/* A 64 KiB chunk cannot contain more than 65536 / 24 event records
+	 */
+	else if( ( last_event_record_number - first_event_record_number ) < 0x0000ffffUL )
+	{
+		chunk_descriptor->number_of_records = (uint32_t) ( last_event_record_number - first_event_record_number + 1 );
+	}
+	else
+	{
+		chunk_descriptor->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: first event record number\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 first_event_record_number );
+
+		libcnotify_printf(
+		 "%s: last event record number\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 last_event_record_number );
+
+		libcnotify_printf(
+		 "%s: first event record identifier\t\t\t: %" PRIu64 "\n",
+		 function,
+		 chunk_descriptor->first_record_identifier );
+
+		libcnotify_printf(
+		 "%s: last event record identifier\t\t\t: %" PRIu64 "\n",
+		 function,
+		 chunk_descriptor->last_record_identifier );
+
+		libcnotify_printf(
+		 "%s: number of records\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 chunk_descriptor->number_of_records );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the chunk descriptor from the chunk header
+ * Returns 1 if successful, 0 if the chunk header is 0-byte filled or -1 on error
+ */
+int libevtx_chunk_descriptor_read_file_io_handle(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ 512 ];
+
+	static char *function = "libevtx_chunk_descriptor_read_file_io_handle";
+	int result            = 0;
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading chunk: %" PRIu16 " header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 chunk_descriptor->chunk_index,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libevtx_io_handle_read_data_at_offset(
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     header_data,
+	     512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	chunk_descriptor->file_offset = file_offset;
+
+	result = libevtx_chunk_descriptor_read_data(
+	          chunk_descriptor,
+	          header_data,
+	          512,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk header.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of records as indicated by the chunk header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_descriptor_get_number_of_records(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_descriptor_get_number_of_records";
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = chunk_descriptor->number_of_records;
+
+	return( 1 );
+}
+
+/* Compares two chunk descriptors by their first record identifier
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libevtx_chunk_descriptor_compare_by_first_record_identifier(
+     libevtx_chunk_descriptor_t *first_chunk_descriptor,
+     libevtx_chunk_descriptor_t *second_chunk_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_descriptor_compare_by_first_record_identifier";
+
+	if( first_chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_chunk_descriptor->first_record_identifier < second_chunk_descriptor->first_record_identifier )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_chunk_descriptor->first_record_identifier > second_chunk_descriptor->first_record_identifier )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Sets the written time range from the records of a chunk
+ * The checksums, number of records and record identifiers range of the chunk
+ * are set as well so that the chunk can be compared with a later version of it
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_descriptor_set_written_time_range(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function              = "libevtx_chunk_descriptor_set_written_time_range";
+	uint64_t maximum_record_identifier = 0;
+	uint64_t maximum_written_time      = 0;
+	uint64_t minimum_record_identifier = 0;
+	uint64_t minimum_written_time      = 0;
+	uint64_t record_identifier         = 0;
+	uint64_t written_time              = 0;
+	uint16_t number_of_records         = 0;
+	uint16_t record_index              = 0;
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_get_number_of_records(
+	     chunk,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	/* A chunk without records has an empty range that does not overlap
+	 */
+	minimum_record_identifier = (uint64_t) UINT64_MAX;
+	minimum_written_time      = (uint64_t) UINT64_MAX;
+
+	/* The written times are read from the record headers of the chunk
+	 * so that no record values are created
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libevtx_chunk_get_record_written_time(
+		     chunk,
+		     record_index,
+		     &written_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu16 " written time.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( written_time < minimum_written_time )
+		{
+			minimum_written_time = written_time;
+		}
+		if( written_time > maximum_written_time )
+		{
+			maximum_written_time = written_time;
+		}
+		if( libevtx_chunk_get_record_identifier(
+		     chunk,
+		     record_index,
+		     &record_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu16 " identifier.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( record_identifier < minimum_record_identifier )
+		{
+			minimum_record_identifier = record_identifier;
+		}
+		if( record_identifier > maximum_record_identifier )
+		{
+			maximum_record_identifier = record_identifier;
+		}
+	}
+	chunk_descriptor->minimum_written_time      = minimum_written_time;
+	chunk_descriptor->maximum_written_time      = maximum_written_time;
+	chunk_descriptor->minimum_record_identifier = minimum_record_identifier;
+	chunk_descriptor->maximum_record_identifier = maximum_record_identifier;
+	chunk_descriptor->number_of_indexed_records = (uint32_t) number_of_records;
+	chunk_descriptor->header_checksum           = chunk->header_checksum;
+	chunk_descriptor->event_records_checksum    = chunk->event_records_checksum;
+
+	if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 )
+	{
+		chunk_descriptor->flags |= LIBEVTX_CHUNK_DESCRIPTOR_FLAG_IS_CONSISTENT;
+	}
+	else
+	{
+		chunk_descriptor->flags &= ~( LIBEVTX_CHUNK_DESCRIPTOR_FLAG_IS_CONSISTENT );
+	}
+	return( 1 );
+}
+
+/* Determines if the written time range of the chunk overlaps with a specific range
+ * Returns 1 if the ranges overlap, 0 if not or -1 on error
+ */
+int libevtx_chunk_descriptor_overlaps_written_time_range(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     uint64_t first_written_time,
+     uint64_t last_written_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_descriptor_overlaps_written_time_range";
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_descriptor->minimum_written_time > last_written_time )
+	 || ( chunk_descriptor->maximum_written_time < first_written_time ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the bit of a provider identifier in the provider identifiers bitmap
+ * The provider identifier is a GUID of 16 bytes of which the bytes are combined
+ * Returns the bit
+ */
+uint8_t libevtx_chunk_descriptor_get_provider_identifier_bit(
+         const uint8_t *provider_identifier )
+{
+	uint8_t bit        = 0;
+	uint8_t byte_index = 0;
+
+	if( provider_identifier == NULL )
+	{
+		return( 0 );
+	}
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		bit = (uint8_t) ( ( bit << 1 ) | ( bit >> 7 ) ) ^ provider_identifier[ byte_index ];
+	}
+	return( bit );
+}
+
+/* Sets the summary of the event identifiers and provider identifiers from the records of a chunk
+ * The System values of the records are read from the binary XML data, if a record
+ * is not supported by the System values every bit of the summary is set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_descriptor_set_summary(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_chunk_descriptor_set_summary";
+	uint16_t number_of_records             = 0;
+	uint16_t record_index                  = 0;
+	uint8_t bit                            = 0;
+	int result                             = 0;
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_get_number_of_records(
+	     chunk,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk_descriptor->event_identifiers_bitmap,
+	     0,
+	     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event identifiers bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk_descriptor->provider_identifiers_bitmap,
+	     0,
+	     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear provider identifiers bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_descriptor->flags &= ~( LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libevtx_chunk_get_record(
+		     chunk,
+		     record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu16 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		result = libevtx_record_values_read_system_values(
+		          record_values,
+		          io_handle,
+		          &( chunk->system_values_template_cache ),
+		          chunk->data,
+		          chunk->data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu16 " system values.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* The values of the record can only be determined from its XML document
+			 * hence the summary cannot rule out any value
+			 */
+			if( memory_set(
+			     chunk_descriptor->event_identifiers_bitmap,
+			     0xff,
+			     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set event identifiers bitmap.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_set(
+			     chunk_descriptor->provider_identifiers_bitmap,
+			     0xff,
+			     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set provider identifiers bitmap.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		if( ( record_values->system_values.flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER ) != 0 )
+		{
+			bit = (uint8_t) ( record_values->system_values.event_identifier & 0xff );
+
+			chunk_descriptor->event_identifiers_bitmap[ bit / 8 ] |= (uint8_t) ( 1 << ( bit % 8 ) );
+		}
+		if( ( record_values->system_values.flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 )
+		{
+			bit = libevtx_chunk_descriptor_get_provider_identifier_bit(
+			       record_values->system_values.provider_identifier );
+
+			chunk_descriptor->provider_identifiers_bitmap[ bit / 8 ] |= (uint8_t) ( 1 << ( bit % 8 ) );
+		}
+	}
+	chunk_descriptor->flags |= LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY;
+
+	return( 1 );
+}
+
+/* Sets the value filter of the EventData values from the records of a chunk
+ * The EventData values of the records are read from the binary XML data, if a record
+ * is not supported by the EventData values every bit of the value filter is set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_descriptor_set_value_filter(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	libevtx_event_data_values_t event_data_values;
+
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_chunk_descriptor_set_value_filter";
+	uint16_t number_of_records             = 0;
+	uint16_t record_index                  = 0;
+	int result                             = 0;
+	int value_index                        = 0;
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_get_number_of_records(
+	     chunk,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_descriptor->value_filter == NULL )
+	{
+		if( libevtx_value_filter_initialize(
+		     &( chunk_descriptor->value_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( memory_set(
+	          chunk_descriptor->value_filter->data,
+	          0,
+	          LIBEVTX_VALUE_FILTER_DATA_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear value filter data.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libevtx_chunk_get_record(
+		     chunk,
+		     record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu16 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		result = libevtx_event_data_values_read_data(
+		          &event_data_values,
+		          chunk->data,
+		          chunk->data_size,
+		          record_values->chunk_data_offset,
+		          (size_t) record_values->data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu16 " EventData values.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* The values of the record can only be determined from its XML document
+			 * hence the value filter cannot rule out any value
+			 */
+			if( libevtx_value_filter_set_all(
+			     chunk_descriptor->value_filter,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value filter.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		for( value_index = 0;
+		     value_index < event_data_values.number_of_values;
+		     value_index++ )
+		{
+			if( libevtx_value_filter_insert_string(
+			     chunk_descriptor->value_filter,
+			     event_data_values.values[ value_index ].value,
+			     event_data_values.values[ value_index ].value_size,
+			     LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF16_STREAM,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to insert record: %" PRIu16 " EventData value: %d into value filter.",
+				 function,
+				 record_index,
+				 value_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the records of the chunk can contain a specific event identifier
+ * Returns 1 if the chunk can contain the event identifier or 0 if not
+ */
+int libevtx_chunk_descriptor_may_contain_event_identifier(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     uint32_t event_identifier )
+{
+	uint8_t bit = 0;
+
+	if( chunk_descriptor == NULL )
+	{
+		return( 1 );
+	}
+	if( ( chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY ) == 0 )
+	{
+		return( 1 );
+	}
+	bit = (uint8_t) ( event_identifier & 0xff );
+
+	if( ( chunk_descriptor->event_identifiers_bitmap[ bit / 8 ] & (uint8_t) ( 1 << ( bit % 8 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the records of the chunk can contain a specific provider identifier
+ * Returns 1 if the chunk can contain the provider identifier or 0 if not
+ */
+int libevtx_chunk_descriptor_may_contain_provider_identifier(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     const uint8_t *provider_identifier )
+{
+	uint8_t bit = 0;
+
+	if( ( chunk_descriptor == NULL )
+	 || ( provider_identifier == NULL ) )
+	{
+		return( 1 );
+	}
+	if( ( chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY ) == 0 )
+	{
+		return( 1 );
+	}
+	bit = libevtx_chunk_descriptor_get_provider_identifier_bit(
+	       provider_identifier );
+
+	if( ( chunk_descriptor->provider_identifiers_bitmap[ bit / 8 ] & (uint8_t) ( 1 << ( bit % 8 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
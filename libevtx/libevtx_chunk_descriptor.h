@@ -0,0 +1,185 @@
+/*
+ * Chunk descriptor functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_CHUNK_DESCRIPTOR_H )
+#define _LIBEVTX_CHUNK_DESCRIPTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_definitions.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_value_filter.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_chunk_descriptor libevtx_chunk_descriptor_t;
+
+struct libevtx_chunk_descriptor
+{
+	/* The chunk index
+	 */
+	uint16_t chunk_index;
+
+	/* The (chunk) file offset
+	 */
+	off64_t file_offset;
+
+	/* The first event record identifier
+	 */
+	uint64_t first_record_identifier;
+
+	/* The last event record identifier
+	 */
+	uint64_t last_record_identifier;
+
+	/* The number of records as indicated by the chunk header
+	 */
+	uint32_t number_of_records;
+
+	/* The index of the first record of the chunk in the records
+	 */
+	int first_record_index;
+
+	/* The stored chunk header checksum
+	 */
+	uint32_t header_checksum;
+
+	/* The stored event records checksum
+	 */
+	uint32_t event_records_checksum;
+
+	/* The number of records in the records table of the chunk
+	 * when the written time range was set
+	 */
+	uint32_t number_of_indexed_records;
+
+	/* The smallest identifier of the records in the chunk
+	 */
+	uint64_t minimum_record_identifier;
+
+	/* The largest identifier of the records in the chunk
+	 */
+	uint64_t maximum_record_identifier;
+
+	/* The smallest written time of the records in the chunk
+	 */
+	uint64_t minimum_written_time;
+
+	/* The largest written time of the records in the chunk
+	 */
+	uint64_t maximum_written_time;
+
+	/* The event identifiers bitmap of the chunk summary
+	 * Contains a bit per event identifier modulo the number of bits
+	 */
+	uint8_t event_identifiers_bitmap[ LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ];
+
+	/* The provider identifiers bitmap of the chunk summary
+	 * Contains a bit per hash of the provider identifier
+	 */
+	uint8_t provider_identifiers_bitmap[ LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ];
+
+	/* The value filter of the EventData values of the records
+	 * Contains NULL if not set
+	 */
+	libevtx_value_filter_t *value_filter;
+
+	/* Various flags
+	 */
+	uint8_t flags;
+};
+
+int libevtx_chunk_descriptor_initialize(
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_free(
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_read_data(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_read_file_io_handle(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_get_number_of_records(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_compare_by_first_record_identifier(
+     libevtx_chunk_descriptor_t *first_chunk_descriptor,
+     libevtx_chunk_descriptor_t *second_chunk_descriptor,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_set_written_time_range(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_overlaps_written_time_range(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     uint64_t first_written_time,
+     uint64_t last_written_time,
+     libcerror_error_t **error );
+
+uint8_t libevtx_chunk_descriptor_get_provider_identifier_bit(
+         const uint8_t *provider_identifier );
+
+int libevtx_chunk_descriptor_set_summary(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_set_value_filter(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunk_descriptor_may_contain_event_identifier(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     uint32_t event_identifier );
+
+int libevtx_chunk_descriptor_may_contain_provider_identifier(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     const uint8_t *provider_identifier );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_CHUNK_DESCRIPTOR_H ) */
+
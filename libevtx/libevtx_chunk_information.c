@@ -0,0 +1,693 @@
+/*
+ * Chunk information functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_byte_stream.h"
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_information.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+
+#include "evtx_chunk.h"
+
+/* Creates chunk information
+ * Make sure the value chunk_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_initialize(
+     libevtx_chunk_information_t **chunk_information,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_initialize";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = memory_allocate_structure(
+	                              libevtx_internal_chunk_information_t );
+
+	if( internal_chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_chunk_information,
+	     0,
+	     sizeof( libevtx_internal_chunk_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk information.",
+		 function );
+
+		goto on_error;
+	}
+	*chunk_information = (libevtx_chunk_information_t *) internal_chunk_information;
+
+	return( 1 );
+
+on_error:
+	if( internal_chunk_information != NULL )
+	{
+		memory_free(
+		 internal_chunk_information );
+	}
+	return( -1 );
+}
+
+/* Frees chunk information
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_free(
+     libevtx_chunk_information_t **chunk_information,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_free";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_information != NULL )
+	{
+		internal_chunk_information = (libevtx_internal_chunk_information_t *) *chunk_information;
+		*chunk_information         = NULL;
+
+		memory_free(
+		 internal_chunk_information );
+	}
+	return( 1 );
+}
+
+/* Reads the chunk information from the chunk header data
+ * The data should contain the chunk header and the string and template tables (512 bytes)
+ * The flags are set to the verify result flags that can be determined from the chunk header,
+ * the event records are not read and their checksum is not validated
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_read_data(
+     libevtx_internal_chunk_information_t *internal_chunk_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_chunk_information_read_data";
+	uint32_t calculated_checksum = 0;
+	uint32_t header_size         = 0;
+	uint32_t stored_checksum     = 0;
+	int result                   = 0;
+
+	if( internal_chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 512 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information->first_record_number     = 0;
+	internal_chunk_information->last_record_number      = 0;
+	internal_chunk_information->first_record_identifier = 0;
+	internal_chunk_information->last_record_identifier  = 0;
+	internal_chunk_information->number_of_records       = 0;
+	internal_chunk_information->free_space_offset       = 0;
+	internal_chunk_information->flags                   = 0;
+
+	if( memory_compare(
+	     ( (evtx_chunk_header_t *) data )->signature,
+	     evtx_chunk_signature,
+	     8 ) != 0 )
+	{
+		result = libevtx_byte_stream_check_for_zero_byte_fill(
+		          data,
+		          512,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine of chunk header is 0-byte filled.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_chunk_information->flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_EMPTY;
+		}
+		else
+		{
+			internal_chunk_information->flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+			                                  | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_SIGNATURE;
+		}
+		return( 1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->first_event_record_number,
+	 internal_chunk_information->first_record_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->last_event_record_number,
+	 internal_chunk_information->last_record_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->first_event_record_identifier,
+	 internal_chunk_information->first_record_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) data )->last_event_record_identifier,
+	 internal_chunk_information->last_record_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->free_space_offset,
+	 internal_chunk_information->free_space_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) data )->checksum,
+	 stored_checksum );
+
+	if( header_size != 128 )
+	{
+		internal_chunk_information->flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                                  | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_HEADER;
+
+		return( 1 );
+	}
+	/* The header checksum is calculated over the first 120 bytes
+	 * of the chunk header and the 384 bytes of the chunk tables
+	 */
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) &( data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		internal_chunk_information->flags |= LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                                   | LIBEVTX_VERIFY_RESULT_FLAG_HEADER_CHECKSUM_MISMATCH;
+	}
+	if( ( internal_chunk_information->free_space_offset < 512 )
+	 || ( internal_chunk_information->free_space_offset > 0x00010000UL ) )
+	{
+		internal_chunk_information->flags |= LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                                   | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_HEADER;
+	}
+	/* A 64 KiB chunk cannot contain more than 65536 / 24 event records
+	 */
+	if( ( internal_chunk_information->first_record_number > internal_chunk_information->last_record_number )
+	 || ( ( internal_chunk_information->last_record_number - internal_chunk_information->first_record_number ) >= 0x0000ffffUL ) )
+	{
+		internal_chunk_information->flags |= LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                                   | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_HEADER;
+	}
+	else
+	{
+		internal_chunk_information->number_of_records = (uint32_t) ( internal_chunk_information->last_record_number - internal_chunk_information->first_record_number + 1 );
+	}
+	return( 1 );
+}
+
+/* Sets the written time range
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_set_written_time_range(
+     libevtx_internal_chunk_information_t *internal_chunk_information,
+     uint64_t minimum_written_time,
+     uint64_t maximum_written_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_information_set_written_time_range";
+
+	if( internal_chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	if( minimum_written_time > maximum_written_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum written time value exceeds maximum written time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information->minimum_written_time   = minimum_written_time;
+	internal_chunk_information->maximum_written_time   = maximum_written_time;
+	internal_chunk_information->has_written_time_range = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the file offset
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_get_file_offset(
+     libevtx_chunk_information_t *chunk_information,
+     off64_t *file_offset,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_get_file_offset";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = (libevtx_internal_chunk_information_t *) chunk_information;
+
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	*file_offset = internal_chunk_information->file_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the first and last event record number as indicated by the chunk header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_get_record_numbers(
+     libevtx_chunk_information_t *chunk_information,
+     uint64_t *first_record_number,
+     uint64_t *last_record_number,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_get_record_numbers";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = (libevtx_internal_chunk_information_t *) chunk_information;
+
+	if( first_record_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first record number.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_record_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last record number.",
+		 function );
+
+		return( -1 );
+	}
+	*first_record_number = internal_chunk_information->first_record_number;
+	*last_record_number  = internal_chunk_information->last_record_number;
+
+	return( 1 );
+}
+
+/* Retrieves the first and last event record identifier as indicated by the chunk header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_get_record_identifiers(
+     libevtx_chunk_information_t *chunk_information,
+     uint64_t *first_record_identifier,
+     uint64_t *last_record_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_get_record_identifiers";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = (libevtx_internal_chunk_information_t *) chunk_information;
+
+	if( first_record_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first record identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_record_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last record identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*first_record_identifier = internal_chunk_information->first_record_identifier;
+	*last_record_identifier  = internal_chunk_information->last_record_identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records as indicated by the chunk header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_get_number_of_records(
+     libevtx_chunk_information_t *chunk_information,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_get_number_of_records";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = (libevtx_internal_chunk_information_t *) chunk_information;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_chunk_information->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the free space offset relative to the start of the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_get_free_space_offset(
+     libevtx_chunk_information_t *chunk_information,
+     uint32_t *free_space_offset,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_get_free_space_offset";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = (libevtx_internal_chunk_information_t *) chunk_information;
+
+	if( free_space_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space offset.",
+		 function );
+
+		return( -1 );
+	}
+	*free_space_offset = internal_chunk_information->free_space_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * The flags contain the verify result flags that can be determined from the chunk header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_information_get_flags(
+     libevtx_chunk_information_t *chunk_information,
+     uint32_t *flags,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_get_flags";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = (libevtx_internal_chunk_information_t *) chunk_information;
+
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = internal_chunk_information->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the range of the written times of the records
+ * Returns 1 if successful, 0 if the range is not known or -1 on error
+ */
+int libevtx_chunk_information_get_written_time_range(
+     libevtx_chunk_information_t *chunk_information,
+     uint64_t *minimum_written_time,
+     uint64_t *maximum_written_time,
+     libcerror_error_t **error )
+{
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	static char *function                                            = "libevtx_chunk_information_get_written_time_range";
+
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_information = (libevtx_internal_chunk_information_t *) chunk_information;
+
+	if( minimum_written_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum written time.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_written_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum written time.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_chunk_information->has_written_time_range == 0 )
+	{
+		return( 0 );
+	}
+	*minimum_written_time = internal_chunk_information->minimum_written_time;
+	*maximum_written_time = internal_chunk_information->maximum_written_time;
+
+	return( 1 );
+}
+
@@ -0,0 +1,160 @@
+/*
+ * Chunk information functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_CHUNK_INFORMATION_H )
+#define _LIBEVTX_INTERNAL_CHUNK_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_extern.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_internal_chunk_information libevtx_internal_chunk_information_t;
+
+struct libevtx_internal_chunk_information
+{
+	/* The chunk index
+	 */
+	uint16_t chunk_index;
+
+	/* The (chunk) file offset
+	 */
+	off64_t file_offset;
+
+	/* The first event record number
+	 */
+	uint64_t first_record_number;
+
+	/* The last event record number
+	 */
+	uint64_t last_record_number;
+
+	/* The first event record identifier
+	 */
+	uint64_t first_record_identifier;
+
+	/* The last event record identifier
+	 */
+	uint64_t last_record_identifier;
+
+	/* The number of records as indicated by the chunk header
+	 */
+	uint32_t number_of_records;
+
+	/* The free space offset
+	 */
+	uint32_t free_space_offset;
+
+	/* The smallest written time of the records in the chunk
+	 */
+	uint64_t minimum_written_time;
+
+	/* The largest written time of the records in the chunk
+	 */
+	uint64_t maximum_written_time;
+
+	/* Value to indicate the written time range is known
+	 */
+	uint8_t has_written_time_range;
+
+	/* The verify result flags determined from the chunk header
+	 */
+	uint32_t flags;
+};
+
+int libevtx_chunk_information_initialize(
+     libevtx_chunk_information_t **chunk_information,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_free(
+     libevtx_chunk_information_t **chunk_information,
+     libcerror_error_t **error );
+
+int libevtx_chunk_information_read_data(
+     libevtx_internal_chunk_information_t *internal_chunk_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_information_set_written_time_range(
+     libevtx_internal_chunk_information_t *internal_chunk_information,
+     uint64_t minimum_written_time,
+     uint64_t maximum_written_time,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_get_file_offset(
+     libevtx_chunk_information_t *chunk_information,
+     off64_t *file_offset,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_get_record_numbers(
+     libevtx_chunk_information_t *chunk_information,
+     uint64_t *first_record_number,
+     uint64_t *last_record_number,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_get_record_identifiers(
+     libevtx_chunk_information_t *chunk_information,
+     uint64_t *first_record_identifier,
+     uint64_t *last_record_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_get_number_of_records(
+     libevtx_chunk_information_t *chunk_information,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_get_free_space_offset(
+     libevtx_chunk_information_t *chunk_information,
+     uint32_t *free_space_offset,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_get_flags(
+     libevtx_chunk_information_t *chunk_information,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_chunk_information_get_written_time_range(
+     libevtx_chunk_information_t *chunk_information,
+     uint64_t *minimum_written_time,
+     uint64_t *maximum_written_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_CHUNK_INFORMATION_H ) */
+
@@ -0,0 +1,952 @@
+/*
+ * Chunk prefetcher functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_chunk_prefetcher.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+/* Creates a chunk prefetcher
+ * The chunk prefetcher reads the chunks that follow a sequential run of chunk reads
+ * in a background thread using a clone of the file IO handle
+ * Make sure the value chunk_prefetcher is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_prefetcher_initialize(
+     libevtx_chunk_prefetcher_t **chunk_prefetcher,
+     libbfio_handle_t *file_io_handle,
+     size_t chunk_size,
+     size64_t file_size,
+     int depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_prefetcher_initialize";
+	size_t array_size     = 0;
+	int result            = 0;
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_prefetcher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk prefetcher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( depth <= 0 )
+	 || ( depth > LIBEVTX_MAXIMUM_READ_AHEAD_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_prefetcher = memory_allocate_structure(
+	                     libevtx_chunk_prefetcher_t );
+
+	if( *chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk prefetcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_prefetcher,
+	     0,
+	     sizeof( libevtx_chunk_prefetcher_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk prefetcher.",
+		 function );
+
+		memory_free(
+		 *chunk_prefetcher );
+
+		*chunk_prefetcher = NULL;
+
+		return( -1 );
+	}
+	array_size = sizeof( libevtx_chunk_prefetcher_slot_t ) * depth;
+
+	( *chunk_prefetcher )->slots = (libevtx_chunk_prefetcher_slot_t *) memory_allocate(
+	                                                                    array_size );
+
+	if( ( *chunk_prefetcher )->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_prefetcher )->slots,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_prefetcher )->chunk_size       = chunk_size;
+	( *chunk_prefetcher )->file_size        = file_size;
+	( *chunk_prefetcher )->depth            = depth;
+	( *chunk_prefetcher )->last_file_offset = -1;
+
+	if( libbfio_handle_clone(
+	     &( ( *chunk_prefetcher )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *chunk_prefetcher )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *chunk_prefetcher )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *chunk_prefetcher )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *chunk_prefetcher )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *chunk_prefetcher != NULL )
+	{
+		libevtx_chunk_prefetcher_free(
+		 chunk_prefetcher,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a chunk prefetcher
+ * The read thread is stopped before the chunk prefetcher is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_prefetcher_free(
+     libevtx_chunk_prefetcher_t **chunk_prefetcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_prefetcher_free";
+	int result            = 1;
+	int slot_index        = 0;
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_prefetcher != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *chunk_prefetcher )->thread != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     ( *chunk_prefetcher )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+			( *chunk_prefetcher )->abort = 1;
+
+			if( libcthreads_condition_broadcast(
+			     ( *chunk_prefetcher )->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     ( *chunk_prefetcher )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcthreads_thread_join(
+			     &( ( *chunk_prefetcher )->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read thread.",
+				 function );
+
+				/* The read thread could still be using the chunk prefetcher
+				 */
+				return( -1 );
+			}
+		}
+		if( ( *chunk_prefetcher )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *chunk_prefetcher )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chunk_prefetcher )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *chunk_prefetcher )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *chunk_prefetcher )->file_io_handle != NULL )
+		{
+			if( libbfio_handle_is_open(
+			     ( *chunk_prefetcher )->file_io_handle,
+			     NULL ) == 1 )
+			{
+				if( libbfio_handle_close(
+				     ( *chunk_prefetcher )->file_io_handle,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close file IO handle.",
+					 function );
+
+					result = -1;
+				}
+			}
+			if( libbfio_handle_free(
+			     &( ( *chunk_prefetcher )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chunk_prefetcher )->slots != NULL )
+		{
+			for( slot_index = 0;
+			     slot_index < ( *chunk_prefetcher )->depth;
+			     slot_index++ )
+			{
+				if( ( *chunk_prefetcher )->slots[ slot_index ].data != NULL )
+				{
+					memory_free(
+					 ( *chunk_prefetcher )->slots[ slot_index ].data );
+				}
+			}
+			memory_free(
+			 ( *chunk_prefetcher )->slots );
+		}
+		memory_free(
+		 *chunk_prefetcher );
+
+		*chunk_prefetcher = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads the pending chunks of the chunk prefetcher
+ * Chunks that cannot be read are released so that the consumer reads
+ * and reports them itself
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_prefetcher_read_thread(
+     libevtx_chunk_prefetcher_t *chunk_prefetcher )
+{
+	libcerror_error_t *error              = NULL;
+	libevtx_chunk_prefetcher_slot_t *slot = NULL;
+	static char *function                 = "libevtx_chunk_prefetcher_read_thread";
+	ssize_t read_count                    = 0;
+	int slot_index                        = 0;
+
+	if( chunk_prefetcher == NULL )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     chunk_prefetcher->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		slot = NULL;
+
+		while( chunk_prefetcher->abort == 0 )
+		{
+			/* The pending chunk with the lowest offset is read first
+			 */
+			for( slot_index = 0;
+			     slot_index < chunk_prefetcher->depth;
+			     slot_index++ )
+			{
+				if( ( chunk_prefetcher->slots[ slot_index ].state == LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_PENDING )
+				 && ( ( slot == NULL )
+				  || ( chunk_prefetcher->slots[ slot_index ].file_offset < slot->file_offset ) ) )
+				{
+					slot = &( chunk_prefetcher->slots[ slot_index ] );
+				}
+			}
+			if( slot != NULL )
+			{
+				break;
+			}
+			if( libcthreads_condition_wait(
+			     chunk_prefetcher->condition,
+			     chunk_prefetcher->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 chunk_prefetcher->mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		if( chunk_prefetcher->abort != 0 )
+		{
+			libcthreads_mutex_release(
+			 chunk_prefetcher->mutex,
+			 NULL );
+
+			break;
+		}
+		slot->state = LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_READING;
+
+		if( libcthreads_mutex_release(
+		     chunk_prefetcher->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* The slot data is only accessed by this thread while the slot is being read
+		 */
+		read_count = -1;
+
+		if( libbfio_handle_seek_offset(
+		     chunk_prefetcher->file_io_handle,
+		     slot->file_offset,
+		     SEEK_SET,
+		     &error ) != -1 )
+		{
+			read_count = libbfio_handle_read_buffer(
+			              chunk_prefetcher->file_io_handle,
+			              slot->data,
+			              chunk_prefetcher->chunk_size,
+			              &error );
+		}
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     chunk_prefetcher->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count == (ssize_t) chunk_prefetcher->chunk_size )
+		{
+			slot->state = LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_LOADED;
+		}
+		else
+		{
+			slot->state = LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_EMPTY;
+		}
+		if( libcthreads_condition_broadcast(
+		     chunk_prefetcher->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 chunk_prefetcher->mutex,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_release(
+		     chunk_prefetcher->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the data of a chunk that was read ahead
+ * Waits for the chunk if it is pending or currently being read
+ * Returns 1 if successful, 0 if the chunk was not read ahead or -1 on error
+ */
+int libevtx_chunk_prefetcher_get_chunk_data(
+     libevtx_chunk_prefetcher_t *chunk_prefetcher,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libevtx_chunk_prefetcher_get_chunk_data";
+	int result                            = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libevtx_chunk_prefetcher_slot_t *slot = NULL;
+	int slot_index                        = 0;
+#endif
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != chunk_prefetcher->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( chunk_prefetcher->thread == NULL )
+	{
+		return( 0 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < chunk_prefetcher->depth;
+	     slot_index++ )
+	{
+		if( ( chunk_prefetcher->slots[ slot_index ].state != LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_EMPTY )
+		 && ( chunk_prefetcher->slots[ slot_index ].file_offset == file_offset ) )
+		{
+			slot = &( chunk_prefetcher->slots[ slot_index ] );
+
+			break;
+		}
+	}
+	if( slot != NULL )
+	{
+		/* The read thread reads the pending chunks in order of their offset
+		 * hence waiting for a pending chunk is not slower than reading it
+		 */
+		while( ( slot->state == LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_PENDING )
+		    || ( slot->state == LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_READING ) )
+		{
+			if( libcthreads_condition_wait(
+			     chunk_prefetcher->condition,
+			     chunk_prefetcher->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( ( result == 0 )
+		 && ( slot->state == LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_LOADED ) )
+		{
+			if( memory_copy(
+			     data,
+			     slot->data,
+			     data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk data.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				result = 1;
+			}
+		}
+		if( ( slot->state != LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_PENDING )
+		 && ( slot->state != LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_READING ) )
+		{
+			slot->state = LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_EMPTY;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Schedules the chunks to read ahead after the chunk at a specific offset was read
+ * The chunks are only read ahead if the chunk directly follows the previous chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_prefetcher_schedule(
+     libevtx_chunk_prefetcher_t *chunk_prefetcher,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libevtx_chunk_prefetcher_schedule";
+	off64_t last_file_offset              = 0;
+	int result                            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libevtx_chunk_prefetcher_slot_t *slot = NULL;
+	off64_t next_file_offset              = 0;
+	int chunk_is_scheduled                = 0;
+	int read_ahead_index                  = 0;
+	int slot_index                        = 0;
+#endif
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	last_file_offset = chunk_prefetcher->last_file_offset;
+
+	chunk_prefetcher->last_file_offset = file_offset;
+
+	if( ( last_file_offset < 0 )
+	 || ( file_offset != ( last_file_offset + (off64_t) chunk_prefetcher->chunk_size ) ) )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( chunk_prefetcher->thread == NULL )
+	{
+		if( libcthreads_thread_create(
+		     &( chunk_prefetcher->thread ),
+		     NULL,
+		     (int (*)(void *)) &libevtx_chunk_prefetcher_read_thread,
+		     (void *) chunk_prefetcher,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Release the slots of chunks outside the read-ahead window
+	 */
+	for( slot_index = 0;
+	     slot_index < chunk_prefetcher->depth;
+	     slot_index++ )
+	{
+		slot = &( chunk_prefetcher->slots[ slot_index ] );
+
+		if( ( slot->state != LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_EMPTY )
+		 && ( slot->state != LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_READING )
+		 && ( ( slot->file_offset <= file_offset )
+		  || ( slot->file_offset > ( file_offset + ( (off64_t) chunk_prefetcher->depth * chunk_prefetcher->chunk_size ) ) ) ) )
+		{
+			slot->state = LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_EMPTY;
+		}
+	}
+	for( read_ahead_index = 1;
+	     read_ahead_index <= chunk_prefetcher->depth;
+	     read_ahead_index++ )
+	{
+		next_file_offset = file_offset + ( (off64_t) read_ahead_index * chunk_prefetcher->chunk_size );
+
+		if( (size64_t) ( next_file_offset + chunk_prefetcher->chunk_size ) > chunk_prefetcher->file_size )
+		{
+			break;
+		}
+		chunk_is_scheduled = 0;
+		slot               = NULL;
+
+		for( slot_index = 0;
+		     slot_index < chunk_prefetcher->depth;
+		     slot_index++ )
+		{
+			if( chunk_prefetcher->slots[ slot_index ].state == LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_EMPTY )
+			{
+				if( slot == NULL )
+				{
+					slot = &( chunk_prefetcher->slots[ slot_index ] );
+				}
+			}
+			else if( chunk_prefetcher->slots[ slot_index ].file_offset == next_file_offset )
+			{
+				chunk_is_scheduled = 1;
+
+				break;
+			}
+		}
+		if( chunk_is_scheduled != 0 )
+		{
+			continue;
+		}
+		if( slot == NULL )
+		{
+			break;
+		}
+		if( slot->data == NULL )
+		{
+			slot->data = (uint8_t *) memory_allocate(
+			                          chunk_prefetcher->chunk_size );
+
+			if( slot->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create slot data.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		slot->file_offset = next_file_offset;
+		slot->state       = LIBEVTX_CHUNK_PREFETCHER_SLOT_STATE_PENDING;
+	}
+	if( libcthreads_condition_broadcast(
+	     chunk_prefetcher->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * Chunk prefetcher functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_CHUNK_PREFETCHER_H )
+#define _LIBEVTX_CHUNK_PREFETCHER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_chunk_prefetcher_slot libevtx_chunk_prefetcher_slot_t;
+
+struct libevtx_chunk_prefetcher_slot
+{
+	/* The (chunk) file offset
+	 */
+	off64_t file_offset;
+
+	/* The chunk data
+	 */
+	uint8_t *data;
+
+	/* The state
+	 */
+	int state;
+};
+
+typedef struct libevtx_chunk_prefetcher libevtx_chunk_prefetcher_t;
+
+struct libevtx_chunk_prefetcher
+{
+	/* The file IO handle used by the read thread
+	 * This is a clone of the file IO handle of the file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The read-ahead depth, the number of chunks read ahead
+	 */
+	int depth;
+
+	/* The slots, one for every chunk read ahead
+	 */
+	libevtx_chunk_prefetcher_slot_t *slots;
+
+	/* The file offset of the last chunk read by the consumer
+	 * Contains -1 if not set
+	 */
+	off64_t last_file_offset;
+
+	/* Value to indicate the read thread should stop
+	 */
+	uint8_t abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the slots
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a change of the slot states
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The read thread
+	 * Created when sequential access is first detected
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int libevtx_chunk_prefetcher_initialize(
+     libevtx_chunk_prefetcher_t **chunk_prefetcher,
+     libbfio_handle_t *file_io_handle,
+     size_t chunk_size,
+     size64_t file_size,
+     int depth,
+     libcerror_error_t **error );
+
+int libevtx_chunk_prefetcher_free(
+     libevtx_chunk_prefetcher_t **chunk_prefetcher,
+     libcerror_error_t **error );
+
+int libevtx_chunk_prefetcher_read_thread(
+     libevtx_chunk_prefetcher_t *chunk_prefetcher );
+
+int libevtx_chunk_prefetcher_get_chunk_data(
+     libevtx_chunk_prefetcher_t *chunk_prefetcher,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_prefetcher_schedule(
+     libevtx_chunk_prefetcher_t *chunk_prefetcher,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_CHUNK_PREFETCHER_H ) */
+
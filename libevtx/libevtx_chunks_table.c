@@ -23,13 +23,19 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libevtx_cache.h"
 #include "libevtx_chunk.h"
 #include "libevtx_chunks_table.h"
+#include "libevtx_definitions.h"
+#include "libevtx_document_cache.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_memory_usage.h"
+#include "libevtx_probes.h"
+#include "libevtx_record_decoder.h"
 #include "libevtx_record_values.h"
 #include "libevtx_unused.h"
 
@@ -108,9 +114,12 @@ int libevtx_chunks_table_initialize(
 
 		goto on_error;
 	}
-	( *chunks_table )->io_handle     = io_handle;
-	( *chunks_table )->chunks_vector = chunks_vector;
-	( *chunks_table )->chunks_cache  = chunks_cache;
+	( *chunks_table )->io_handle             = io_handle;
+	( *chunks_table )->chunks_vector         = chunks_vector;
+	( *chunks_table )->chunks_cache          = chunks_cache;
+	( *chunks_table )->cache_file_identifier = -1;
+	( *chunks_table )->last_chunk_index      = -1;
+	( *chunks_table )->scan_chunk_index      = -1;
 
 	return( 1 );
 
@@ -132,8 +141,9 @@ int libevtx_chunks_table_free(
      libevtx_chunks_table_t **chunks_table,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_chunks_table_free";
-	int result            = 1;
+	static char *function  = "libevtx_chunks_table_free";
+	int pinned_chunk_index = 0;
+	int result             = 1;
 
 	if( chunks_table == NULL )
 	{
@@ -148,12 +158,831 @@ int libevtx_chunks_table_free(
 	}
 	if( *chunks_table != NULL )
 	{
+		/* The record decoder is freed first to stop its decode threads
+		 */
+		if( ( *chunks_table )->record_decoder != NULL )
+		{
+			if( libevtx_record_decoder_free(
+			     &( ( *chunks_table )->record_decoder ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record decoder.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chunks_table )->scan_chunk != NULL )
+		{
+			if( libevtx_chunk_free(
+			     &( ( *chunks_table )->scan_chunk ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan chunk.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( pinned_chunk_index = 0;
+		     pinned_chunk_index < ( *chunks_table )->number_of_pinned_chunks;
+		     pinned_chunk_index++ )
+		{
+			if( ( *chunks_table )->pinned_chunks[ pinned_chunk_index ] != NULL )
+			{
+				if( libevtx_chunk_free(
+				     &( ( *chunks_table )->pinned_chunks[ pinned_chunk_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free pinned chunk: %d.",
+					 function,
+					 pinned_chunk_index );
+
+					result = -1;
+				}
+			}
+		}
 		memory_free(
 		 *chunks_table );
 
-		*chunks_table = NULL;
+		*chunks_table = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a specific chunk
+ * Pinned chunks are retrieved from the pinned chunks. Chunks that are retrieved
+ * in succession of at least LIBEVTX_SEQUENTIAL_SCAN_THRESHOLD preceding chunks
+ * are considered part of a sequential scan. These are read without the chunks
+ * cache and remain valid until the next scanned chunk is retrieved.
+ * Other chunks are retrieved from the shared chunk cache if the file is attached to one,
+ * otherwise from the chunks vector
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_get_chunk_by_index(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *safe_chunk = NULL;
+	static char *function       = "libevtx_chunks_table_get_chunk_by_index";
+	int pinned_chunk_index      = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	LIBEVTX_COUNTER_ADD(
+	 chunks_table->io_handle->statistics.number_of_chunk_look_ups,
+	 1 );
+
+	if( (int) chunk_index == ( chunks_table->last_chunk_index + 1 ) )
+	{
+		if( chunks_table->sequential_run_length < LIBEVTX_SEQUENTIAL_SCAN_THRESHOLD )
+		{
+			chunks_table->sequential_run_length += 1;
+		}
+	}
+	else if( (int) chunk_index != chunks_table->last_chunk_index )
+	{
+		chunks_table->sequential_run_length = 0;
+	}
+	chunks_table->last_chunk_index = (int) chunk_index;
+
+	pinned_chunk_index = libevtx_chunks_table_find_pinned_chunk(
+	                      chunks_table,
+	                      chunk_index );
+
+	if( pinned_chunk_index != -1 )
+	{
+		if( chunks_table->pinned_chunks[ pinned_chunk_index ] == NULL )
+		{
+			if( libevtx_chunks_table_read_chunk(
+			     chunks_table,
+			     file_io_handle,
+			     chunk_index,
+			     &( chunks_table->pinned_chunks[ pinned_chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read pinned chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			LIBEVTX_PROBE_CHUNK_CACHE_HIT(
+			 chunk_index );
+		}
+		*chunk = chunks_table->pinned_chunks[ pinned_chunk_index ];
+
+		return( 1 );
+	}
+	if( chunks_table->scan_chunk_index == (int) chunk_index )
+	{
+		LIBEVTX_PROBE_CHUNK_CACHE_HIT(
+		 chunk_index );
+
+		*chunk = chunks_table->scan_chunk;
+
+		return( 1 );
+	}
+	if( chunks_table->sequential_run_length >= LIBEVTX_SEQUENTIAL_SCAN_THRESHOLD )
+	{
+		if( libevtx_chunks_table_read_chunk(
+		     chunks_table,
+		     file_io_handle,
+		     chunk_index,
+		     &safe_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( libevtx_chunks_table_reset_scan(
+		     chunks_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset scan chunk.",
+			 function );
+
+			goto on_error;
+		}
+		chunks_table->scan_chunk       = safe_chunk;
+		chunks_table->scan_chunk_index = (int) chunk_index;
+
+		*chunk = safe_chunk;
+
+		return( 1 );
+	}
+	if( libevtx_chunks_table_get_cached_chunk_by_index(
+	     chunks_table,
+	     file_io_handle,
+	     chunk_index,
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( safe_chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &safe_chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a specific chunk without the chunks cache
+ * The chunk is managed by the caller
+ * Make sure the value chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_read_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *safe_chunk = NULL;
+	static char *function       = "libevtx_chunks_table_read_chunk";
+	off64_t chunk_offset        = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	LIBEVTX_COUNTER_ADD(
+	 chunks_table->io_handle->statistics.number_of_chunk_cache_misses,
+	 1 );
+
+	LIBEVTX_PROBE_CHUNK_CACHE_MISS(
+	 chunk_index );
+
+	chunk_offset = chunks_table->io_handle->chunks_data_offset
+	             + ( (off64_t) chunk_index * chunks_table->io_handle->chunk_size );
+
+	if( libevtx_chunk_initialize(
+	     &safe_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_chunk_read(
+	     safe_chunk,
+	     chunks_table->io_handle,
+	     file_io_handle,
+	     chunk_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	*chunk = safe_chunk;
+
+	return( 1 );
+
+on_error:
+	if( safe_chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &safe_chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific chunk from the shared chunk cache if the file is attached to one,
+ * otherwise from the chunks vector
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_get_cached_chunk_by_index(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *safe_chunk = NULL;
+	static char *function       = "libevtx_chunks_table_get_cached_chunk_by_index";
+	int result                  = 0;
+
+#if defined( LIBEVTX_PROBES_ENABLED )
+	uint64_t number_of_misses   = 0;
+#endif
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBEVTX_PROBES_ENABLED )
+	/* The chunk is read by the chunks cache or the shared chunk cache
+	 * if the number of chunk cache misses changes
+	 */
+	number_of_misses = LIBEVTX_COUNTER_GET(
+	                    chunks_table->io_handle->statistics.number_of_chunk_cache_misses );
+#endif
+	if( chunks_table->cache_file_identifier != -1 )
+	{
+		result = libevtx_internal_cache_get_chunk_by_index(
+		          chunks_table->cache,
+		          chunks_table->cache_file_identifier,
+		          chunks_table->io_handle,
+		          file_io_handle,
+		          chunk_index,
+		          &safe_chunk,
+		          error );
+	}
+	else
+	{
+		result = libfdata_vector_get_element_value_by_index(
+		          chunks_table->chunks_vector,
+		          (intptr_t *) file_io_handle,
+		          chunks_table->chunks_cache,
+		          (int) chunk_index,
+		          (intptr_t **) &safe_chunk,
+		          0,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( safe_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+#if defined( LIBEVTX_PROBES_ENABLED )
+	if( LIBEVTX_COUNTER_GET(
+	     chunks_table->io_handle->statistics.number_of_chunk_cache_misses ) == number_of_misses )
+	{
+		LIBEVTX_PROBE_CHUNK_CACHE_HIT(
+		 chunk_index );
+	}
+	else
+	{
+		LIBEVTX_PROBE_CHUNK_CACHE_MISS(
+		 chunk_index );
+	}
+#endif
+	*chunk = safe_chunk;
+
+	return( 1 );
+}
+
+/* Frees the scan chunk
+ * Used when the chunk data has become outdated
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_reset_scan(
+     libevtx_chunks_table_t *chunks_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunks_table_reset_scan";
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	chunks_table->scan_chunk_index = -1;
+
+	if( chunks_table->scan_chunk != NULL )
+	{
+		if( libevtx_chunk_free(
+		     &( chunks_table->scan_chunk ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan chunk.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the entry of a specific pinned chunk
+ * Returns the index of the entry or -1 if the chunk is not pinned
+ */
+int libevtx_chunks_table_find_pinned_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     uint16_t chunk_index )
+{
+	int pinned_chunk_index = 0;
+
+	if( chunks_table == NULL )
+	{
+		return( -1 );
+	}
+	for( pinned_chunk_index = 0;
+	     pinned_chunk_index < chunks_table->number_of_pinned_chunks;
+	     pinned_chunk_index++ )
+	{
+		if( chunks_table->pinned_chunk_indexes[ pinned_chunk_index ] == chunk_index )
+		{
+			return( pinned_chunk_index );
+		}
+	}
+	return( -1 );
+}
+
+/* Pins a specific chunk
+ * A pinned chunk is read once and kept outside the chunks cache until it is unpinned,
+ * hence it is not evicted by the chunks cache. A chunk can be pinned multiple times,
+ * in which case it needs to be unpinned the same number of times
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_pin_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk = NULL;
+	static char *function  = "libevtx_chunks_table_pin_chunk";
+	int pinned_chunk_index = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	pinned_chunk_index = libevtx_chunks_table_find_pinned_chunk(
+	                      chunks_table,
+	                      chunk_index );
+
+	if( pinned_chunk_index != -1 )
+	{
+		chunks_table->pinned_chunk_reference_counts[ pinned_chunk_index ] += 1;
+
+		return( 1 );
+	}
+	if( chunks_table->number_of_pinned_chunks >= LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_PINNED_CHUNKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: unable to pin chunk: %" PRIu16 " maximum number of pinned chunks reached.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( chunks_table->scan_chunk_index == (int) chunk_index )
+	{
+		/* The scan chunk is taken over as pinned chunk
+		 */
+		chunk = chunks_table->scan_chunk;
+
+		chunks_table->scan_chunk       = NULL;
+		chunks_table->scan_chunk_index = -1;
+	}
+	else if( libevtx_chunks_table_read_chunk(
+	          chunks_table,
+	          file_io_handle,
+	          chunk_index,
+	          &chunk,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	pinned_chunk_index = chunks_table->number_of_pinned_chunks;
+
+	chunks_table->pinned_chunks[ pinned_chunk_index ]                 = chunk;
+	chunks_table->pinned_chunk_indexes[ pinned_chunk_index ]          = chunk_index;
+	chunks_table->pinned_chunk_reference_counts[ pinned_chunk_index ] = 1;
+
+	chunks_table->number_of_pinned_chunks += 1;
+
+	return( 1 );
+}
+
+/* Unpins a specific chunk
+ * The chunk is freed when it was unpinned as many times as it was pinned
+ * Returns 1 if successful, 0 if the chunk was not pinned or -1 on error
+ */
+int libevtx_chunks_table_unpin_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk = NULL;
+	static char *function  = "libevtx_chunks_table_unpin_chunk";
+	int last_entry_index   = 0;
+	int pinned_chunk_index = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	pinned_chunk_index = libevtx_chunks_table_find_pinned_chunk(
+	                      chunks_table,
+	                      chunk_index );
+
+	if( pinned_chunk_index == -1 )
+	{
+		return( 0 );
+	}
+	chunks_table->pinned_chunk_reference_counts[ pinned_chunk_index ] -= 1;
+
+	if( chunks_table->pinned_chunk_reference_counts[ pinned_chunk_index ] > 0 )
+	{
+		return( 1 );
 	}
-	return( result );
+	chunk = chunks_table->pinned_chunks[ pinned_chunk_index ];
+
+	/* The last entry is moved into the entry of the unpinned chunk
+	 */
+	last_entry_index = chunks_table->number_of_pinned_chunks - 1;
+
+	chunks_table->pinned_chunks[ pinned_chunk_index ]                 = chunks_table->pinned_chunks[ last_entry_index ];
+	chunks_table->pinned_chunk_indexes[ pinned_chunk_index ]          = chunks_table->pinned_chunk_indexes[ last_entry_index ];
+	chunks_table->pinned_chunk_reference_counts[ pinned_chunk_index ] = chunks_table->pinned_chunk_reference_counts[ last_entry_index ];
+
+	chunks_table->pinned_chunks[ last_entry_index ]                 = NULL;
+	chunks_table->pinned_chunk_indexes[ last_entry_index ]          = 0;
+	chunks_table->pinned_chunk_reference_counts[ last_entry_index ] = 0;
+
+	chunks_table->number_of_pinned_chunks -= 1;
+
+	if( chunk != NULL )
+	{
+		if( libevtx_chunk_free(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pinned chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Frees the data of the pinned chunks
+ * Used when the chunk data has become outdated, the chunks remain pinned
+ * and are read again on their next retrieval
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_reset_pinned(
+     libevtx_chunks_table_t *chunks_table,
+     libcerror_error_t **error )
+{
+	static char *function  = "libevtx_chunks_table_reset_pinned";
+	int pinned_chunk_index = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	for( pinned_chunk_index = 0;
+	     pinned_chunk_index < chunks_table->number_of_pinned_chunks;
+	     pinned_chunk_index++ )
+	{
+		if( chunks_table->pinned_chunks[ pinned_chunk_index ] != NULL )
+		{
+			if( libevtx_chunk_free(
+			     &( chunks_table->pinned_chunks[ pinned_chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pinned chunk: %d.",
+				 function,
+				 pinned_chunk_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Prefetches a specific chunk into the chunks cache
+ * The chunk is read into the shared chunk cache if the file is attached to one,
+ * otherwise into the chunks cache, unless it is pinned or the scan chunk.
+ * Prefetching does not count as part of a sequential scan
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_prefetch_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk = NULL;
+	static char *function  = "libevtx_chunks_table_prefetch_chunk";
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunks_table->scan_chunk_index == (int) chunk_index )
+	 || ( libevtx_chunks_table_find_pinned_chunk(
+	       chunks_table,
+	       chunk_index ) != -1 ) )
+	{
+		return( 1 );
+	}
+	LIBEVTX_COUNTER_ADD(
+	 chunks_table->io_handle->statistics.number_of_chunk_look_ups,
+	 1 );
+
+	if( libevtx_chunks_table_get_cached_chunk_by_index(
+	     chunks_table,
+	     file_io_handle,
+	     chunk_index,
+	     &chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
 /* Reads a chunk
@@ -176,11 +1005,12 @@ int libevtx_chunks_table_read_record(
 	libevtx_chunks_table_t *chunks_table         = NULL;
 	libevtx_record_values_t *chunk_record_values = NULL;
 	libevtx_record_values_t *record_values       = NULL;
-	static char *function                        = "libevtx_io_handle_read_chunk";
+	static char *function                        = "libevtx_chunks_table_read_record";
 	size_t calculated_chunk_data_offset          = 0;
-	size_t chunk_data_offset                     = 0;
+	uint16_t chunk_index                         = 0;
 	uint16_t number_of_records                   = 0;
 	uint16_t record_index                        = 0;
+	int result                                   = 0;
 
 	LIBEVTX_UNREFERENCED_PARAMETER( data_range_file_index );
 	LIBEVTX_UNREFERENCED_PARAMETER( data_range_flags );
@@ -199,47 +1029,58 @@ int libevtx_chunks_table_read_record(
 	}
 	chunks_table = (libevtx_chunks_table_t *) io_handle;
 
-	/* The chunk index is stored in the data range size
-	*/
-	if( data_range_size > (uint64_t) UINT16_MAX )
+	if( chunks_table->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data range size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     chunks_table->chunks_vector,
-	     (intptr_t *) file_io_handle,
-	     chunks_table->chunks_cache,
-	     (uint16_t) data_range_size,
-	     (intptr_t **) &chunk,
-	     0,
-	     error ) != 1 )
+	/* This function is only called by the records list if the record is not cached
+	 */
+	LIBEVTX_COUNTER_ADD(
+	 chunks_table->io_handle->statistics.number_of_record_cache_misses,
+	 1 );
+
+	/* The chunk index, the index of the record within the chunk and the recovered flag
+	 * are stored in the data range size
+	 */
+	if( ( data_range_size & ~LIBEVTX_RECORD_ELEMENT_DATA_SIZE_MASK ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve chunk: %" PRIu64 ".",
-		 function,
-		 data_range_size );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data range size value out of bounds.",
+		 function );
 
 		goto on_error;
 	}
-	if( chunk == NULL )
+	chunk_index  = (uint16_t) ( data_range_size & 0x0000ffffUL );
+	record_index = (uint16_t) ( ( data_range_size >> LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ) & 0x0000ffffUL );
+
+	LIBEVTX_PROBE_RECORD_CACHE_MISS(
+	 chunk_index,
+	 record_index );
+
+	if( libevtx_chunks_table_get_chunk_by_index(
+	     chunks_table,
+	     file_io_handle,
+	     chunk_index,
+	     &chunk,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing chunk: %" PRIu64 ".",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 ".",
 		 function,
-		 data_range_size );
+		 chunk_index );
 
 		goto on_error;
 	}
@@ -257,63 +1098,65 @@ int libevtx_chunks_table_read_record(
 	}
 	calculated_chunk_data_offset = (size_t) ( data_range_offset - chunk->file_offset );
 
-	if( libevtx_chunk_get_number_of_records(
-	     chunk,
-	     &number_of_records,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records from chunk.",
-		 function );
-
-		goto on_error;
-	}
-/* TODO optimize determining the corresponding record */
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	if( ( data_range_size & LIBEVTX_RECORD_ELEMENT_FLAG_RECOVERED ) == 0 )
 	{
-		if( libevtx_chunk_get_record(
+		if( libevtx_chunk_get_number_of_records(
 		     chunk,
-		     record_index,
-		     &chunk_record_values,
+		     &number_of_records,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %" PRIu16 " from chunk.",
-			 function,
-			 record_index );
+			 "%s: unable to retrieve number of records from chunk.",
+			 function );
 
 			goto on_error;
 		}
-		if( chunk_record_values == NULL )
+		if( record_index < number_of_records )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing record: %" PRIu16 ".",
-			 function,
-			 record_index );
-
-			goto on_error;
-		}
-		chunk_data_offset = chunk_record_values->chunk_data_offset;
+			if( libevtx_chunk_get_record(
+			     chunk,
+			     record_index,
+			     &chunk_record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %" PRIu16 " from chunk.",
+				 function,
+				 record_index );
 
-		if( calculated_chunk_data_offset == chunk_data_offset )
-		{
-			break;
+				goto on_error;
+			}
 		}
 	}
-/* TODO allow to control look up in normal vs recovered */
-	if( calculated_chunk_data_offset != chunk_data_offset )
+	else
 	{
+		/* The free space of a chunk that was read while the recovered records
+		 * were deferred is scanned on first access of a recovered record
+		 */
+		if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_RECOVERY_IS_PENDING ) != 0 )
+		{
+			if( libevtx_chunk_read_recovered_records(
+			     chunk,
+			     chunks_table->io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read recovered records of chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
 		if( libevtx_chunk_get_number_of_recovered_records(
 		     chunk,
 		     &number_of_records,
@@ -328,9 +1171,7 @@ int libevtx_chunks_table_read_record(
 
 			goto on_error;
 		}
-		for( record_index = 0;
-		     record_index < number_of_records;
-		     record_index++ )
+		if( record_index < number_of_records )
 		{
 			if( libevtx_chunk_get_recovered_record(
 			     chunk,
@@ -348,27 +1189,10 @@ int libevtx_chunks_table_read_record(
 
 				goto on_error;
 			}
-			if( chunk_record_values == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing recovered record: %" PRIu16 ".",
-				 function,
-				 record_index );
-
-				goto on_error;
-			}
-			chunk_data_offset = chunk_record_values->chunk_data_offset;
-
-			if( calculated_chunk_data_offset == chunk_data_offset )
-			{
-				break;
-			}
 		}
 	}
-	if( calculated_chunk_data_offset != chunk_data_offset )
+	if( ( chunk_record_values == NULL )
+	 || ( chunk_record_values->chunk_data_offset != calculated_chunk_data_offset ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -380,46 +1204,219 @@ int libevtx_chunks_table_read_record(
 
 		goto on_error;
 	}
-	/* The record values are managed by the chunk and freed after usage
-	 * A copy is created to make sure that the records values that are passed
-	 * to the records list can be managed by the list
+	/* The record values could have been retained by the document cache
+	 * after they were released by the records cache
 	 */
-	if( libevtx_record_values_clone(
-	     &record_values,
-	     chunk_record_values,
-	     error ) != 1 )
+	if( chunks_table->document_cache != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record values.",
-		 function );
+		result = libevtx_document_cache_take_record_values(
+		          chunks_table->document_cache,
+		          chunk_record_values->offset,
+		          &record_values,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values from document cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			LIBEVTX_COUNTER_ADD(
+			 chunks_table->io_handle->statistics.number_of_document_cache_hits,
+			 1 );
+		}
 	}
-	if( libevtx_record_values_read_xml_document(
-	     record_values,
-	     chunks_table->io_handle,
-	     chunk->data,
-	     chunk->data_size,
-	     error ) != 1 )
+	if( record_values == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read record values XML document.",
-		 function );
+		/* The record values are managed by the chunk and freed after usage
+		 * A copy is created to make sure that the records values that are passed
+		 * to the records list can be managed by the list
+		 */
+		if( libevtx_record_values_clone(
+		     &record_values,
+		     chunk_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		LIBEVTX_COUNTER_ADD(
+		 chunks_table->io_handle->statistics.number_of_allocations,
+		 1 );
+
+		record_values->memory_usage   = &( chunks_table->io_handle->memory_usage );
+		record_values->accounted_size = sizeof( libevtx_record_values_t );
+
+		libevtx_memory_usage_add(
+		 record_values->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_RECORD_VALUES,
+		 record_values->accounted_size );
+
+		result = 0;
+
+		if( chunks_table->io_handle->decode_depth == LIBEVTX_DECODE_DEPTH_SYSTEM )
+		{
+			result = libevtx_record_values_read_system_values(
+			          record_values,
+			          chunks_table->io_handle,
+			          &( chunk->system_values_template_cache ),
+			          chunk->data,
+			          chunk->data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record values System values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( ( chunks_table->record_decoder != NULL )
+		      && ( ( data_range_size & LIBEVTX_RECORD_ELEMENT_FLAG_RECOVERED ) == 0 ) )
+		{
+			/* The XML document could have been decoded in the background
+			 * while the preceding record was processed
+			 */
+			if( record_values->xml_document == NULL )
+			{
+				result = libevtx_record_decoder_take_xml_document(
+				          chunks_table->record_decoder,
+				          chunk->file_offset,
+				          record_index,
+				          &( record_values->xml_document ),
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve XML document from record decoder.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					LIBEVTX_COUNTER_ADD(
+					 chunks_table->io_handle->statistics.number_of_allocations,
+					 1 );
+
+					LIBEVTX_COUNTER_ADD(
+					 chunks_table->io_handle->statistics.number_of_xml_documents_read,
+					 1 );
+
+					LIBEVTX_COUNTER_ADD(
+					 chunks_table->io_handle->statistics.number_of_background_decoded_records,
+					 1 );
+
+					/* The decode time of the background decoded XML document does not delay the read
+					 * hence only its depth and number of nodes are checked against the decode budget
+					 */
+					result = libevtx_record_values_check_decode_budget(
+					          record_values,
+					          chunks_table->io_handle,
+					          0,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to check decode budget.",
+						 function );
+
+						goto on_error;
+					}
+					else if( result != 0 )
+					{
+						if( libevtx_record_values_account_xml_document(
+						     record_values,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+							 "%s: unable to account XML document.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					result = 0;
+				}
+			}
+			if( libevtx_record_decoder_schedule(
+			     chunks_table->record_decoder,
+			     chunk,
+			     record_index + 1,
+			     chunks_table->io_handle->ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to schedule records in record decoder.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Fall back to the XML document if the binary XML data
+		 * is not supported by the System values
+		 */
+		if( ( result == 0 )
+		 && ( record_values->xml_document == NULL ) )
+		{
+			if( libevtx_record_values_read_xml_document(
+			     record_values,
+			     chunks_table->io_handle,
+			     chunk->data,
+			     chunk->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record values XML document.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
+	record_values->document_cache = chunks_table->document_cache;
+
 	if( libfdata_list_element_set_element_value(
 	     list_element,
 	     (intptr_t *) file_io_handle,
 	     cache,
 	     (intptr_t *) record_values,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_document_cache_release_record_values,
 	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
 	     error ) != 1 )
 	{
@@ -25,16 +25,23 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_cache.h"
+#include "libevtx_chunk.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_decoder.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of pinned chunks
+ */
+#define LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_PINNED_CHUNKS	64
+
 typedef struct libevtx_chunks_table libevtx_chunks_table_t;
 
 struct libevtx_chunks_table
@@ -50,6 +57,63 @@ struct libevtx_chunks_table
 	/* The chunks cache
 	 */
 	libfcache_cache_t *chunks_cache;
+
+	/* The shared chunk cache
+	 */
+	libevtx_internal_cache_t *cache;
+
+	/* The identifier of the file in the shared chunk cache
+	 * Contains -1 if the chunks are retrieved from the chunks cache
+	 */
+	int cache_file_identifier;
+
+	/* The index of the last retrieved chunk
+	 * Contains -1 if no chunk was retrieved
+	 */
+	int last_chunk_index;
+
+	/* The number of chunks retrieved in succession of the previous chunk
+	 */
+	int sequential_run_length;
+
+	/* The chunk retrieved during a sequential scan
+	 * Sequentially scanned chunks bypass the chunks cache so that they
+	 * do not evict the chunks of random access
+	 */
+	libevtx_chunk_t *scan_chunk;
+
+	/* The index of the scan chunk
+	 * Contains -1 if not set
+	 */
+	int scan_chunk_index;
+
+	/* The pinned chunks
+	 * Pinned chunks bypass the chunks cache so that they are not evicted
+	 * An entry contains NULL if the pinned chunk is read on the next retrieval
+	 */
+	libevtx_chunk_t *pinned_chunks[ LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_PINNED_CHUNKS ];
+
+	/* The indexes of the pinned chunks
+	 */
+	uint16_t pinned_chunk_indexes[ LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_PINNED_CHUNKS ];
+
+	/* The number of times every pinned chunk was pinned
+	 */
+	int pinned_chunk_reference_counts[ LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_PINNED_CHUNKS ];
+
+	/* The number of pinned chunks
+	 */
+	int number_of_pinned_chunks;
+
+	/* The record decoder
+	 * Contains NULL if records are not decoded in the background
+	 */
+	libevtx_record_decoder_t *record_decoder;
+
+	/* The document cache
+	 * Contains NULL if the record values are freed when they are released by the records cache
+	 */
+	struct libevtx_document_cache *document_cache;
 };
 
 int libevtx_chunks_table_initialize(
@@ -63,6 +127,56 @@ int libevtx_chunks_table_free(
      libevtx_chunks_table_t **chunks_table,
      libcerror_error_t **error );
 
+int libevtx_chunks_table_get_chunk_by_index(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_read_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_get_cached_chunk_by_index(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_reset_scan(
+     libevtx_chunks_table_t *chunks_table,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_find_pinned_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     uint16_t chunk_index );
+
+int libevtx_chunks_table_pin_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_unpin_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     uint16_t chunk_index,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_reset_pinned(
+     libevtx_chunks_table_t *chunks_table,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_prefetch_chunk(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     libcerror_error_t **error );
+
 int libevtx_chunks_table_read_record(
      intptr_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -0,0 +1,396 @@
+/*
+ * Codepage table functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_codepage.h"
+#include "libevtx_codepage_table.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+
+/* Sets the codepage of the codepage table
+ * The UTF-8 encoded characters of all 256 byte values are determined once,
+ * byte values that are not a character on their own are marked as such
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_codepage_table_set_codepage(
+     libevtx_codepage_table_t *codepage_table,
+     int codepage,
+     libcerror_error_t **error )
+{
+	uint8_t byte_stream[ 1 ];
+
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libevtx_codepage_table_set_codepage";
+	size_t byte_stream_index                     = 0;
+	size_t utf8_character_size                   = 0;
+	uint16_t byte_value                          = 0;
+	uint8_t is_double_byte_codepage              = 0;
+
+	if( codepage_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codepage table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     codepage_table,
+	     0,
+	     sizeof( libevtx_codepage_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear codepage table.",
+		 function );
+
+		return( -1 );
+	}
+	/* In the double-byte codepages the byte values of 0x80 and above
+	 * can be the lead byte of a double-byte character
+	 */
+	if( ( codepage == LIBEVTX_CODEPAGE_WINDOWS_932 )
+	 || ( codepage == LIBEVTX_CODEPAGE_WINDOWS_936 )
+	 || ( codepage == LIBEVTX_CODEPAGE_WINDOWS_949 )
+	 || ( codepage == LIBEVTX_CODEPAGE_WINDOWS_950 ) )
+	{
+		is_double_byte_codepage = 1;
+	}
+	codepage_table->codepage = codepage;
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( ( is_double_byte_codepage != 0 )
+		 && ( byte_value >= 0x80 ) )
+		{
+			continue;
+		}
+		byte_stream[ 0 ]  = (uint8_t) byte_value;
+		byte_stream_index = 0;
+
+		/* Byte values that are not defined in the codepage are not an error
+		 */
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     byte_stream,
+		     1,
+		     &byte_stream_index,
+		     codepage,
+		     NULL ) != 1 )
+		{
+			continue;
+		}
+		if( byte_stream_index != 1 )
+		{
+			continue;
+		}
+		utf8_character_size = 0;
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     codepage_table->utf8_characters[ byte_value ],
+		     4,
+		     &utf8_character_size,
+		     NULL ) != 1 )
+		{
+			continue;
+		}
+		codepage_table->utf8_character_sizes[ byte_value ] = (uint8_t) utf8_character_size;
+	}
+	return( 1 );
+}
+
+/* Determines the number of bytes of 7-bit ASCII characters at the start of a byte stream
+ * The byte stream is checked 8 bytes at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_codepage_table_get_ascii_prefix_size(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *prefix_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libevtx_codepage_table_get_ascii_prefix_size";
+	size_t byte_stream_index = 0;
+	uint64_t value_64bit     = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefix_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix size.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 7-bit ASCII character does not have the most significant bit set
+	 */
+	while( ( byte_stream_size - byte_stream_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( byte_stream[ byte_stream_index ] ),
+		 value_64bit );
+
+		if( ( value_64bit & 0x8080808080808080ULL ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 8;
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( byte_stream[ byte_stream_index ] >= 0x80 )
+		{
+			break;
+		}
+		byte_stream_index++;
+	}
+	*prefix_size = byte_stream_index;
+
+	return( 1 );
+}
+
+/* Copies a byte stream to an UTF-8 string using the codepage table
+ * The 7-bit ASCII characters are copied as-is and the other characters
+ * are looked up in the codepage table. The UTF-8 string is not terminated
+ * Returns 1 if successful, 0 if the byte stream contains a byte value that is
+ * not a character on its own or -1 on error
+ */
+int libevtx_codepage_table_copy_to_utf8_string(
+     const libevtx_codepage_table_t *codepage_table,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libevtx_codepage_table_copy_to_utf8_string";
+	size_t byte_stream_index    = 0;
+	size_t prefix_size          = 0;
+	size_t safe_utf8_index      = 0;
+	uint8_t byte_value          = 0;
+	uint8_t utf8_character_size = 0;
+
+	if( codepage_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codepage table.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_utf8_index = *utf8_string_index;
+
+	if( safe_utf8_index > utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		byte_value = byte_stream[ byte_stream_index ];
+
+		if( byte_value < 0x80 )
+		{
+			if( libevtx_codepage_table_get_ascii_prefix_size(
+			     &( byte_stream[ byte_stream_index ] ),
+			     byte_stream_size - byte_stream_index,
+			     &prefix_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve ASCII prefix size.",
+				 function );
+
+				return( -1 );
+			}
+			if( prefix_size > ( utf8_string_size - safe_utf8_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( utf8_string[ safe_utf8_index ] ),
+			     &( byte_stream[ byte_stream_index ] ),
+			     prefix_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy ASCII characters.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_index += prefix_size;
+			safe_utf8_index   += prefix_size;
+
+			continue;
+		}
+		utf8_character_size = codepage_table->utf8_character_sizes[ byte_value ];
+
+		if( utf8_character_size == 0 )
+		{
+			return( 0 );
+		}
+		if( (size_t) utf8_character_size > ( utf8_string_size - safe_utf8_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( utf8_string[ safe_utf8_index ] ),
+		     codepage_table->utf8_characters[ byte_value ],
+		     (size_t) utf8_character_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy character.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_index += 1;
+		safe_utf8_index   += (size_t) utf8_character_size;
+	}
+	*utf8_string_index = safe_utf8_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,81 @@
+/*
+ * Codepage table functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_CODEPAGE_TABLE_H )
+#define _LIBEVTX_CODEPAGE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_codepage_table libevtx_codepage_table_t;
+
+/* The codepage table contains the UTF-8 encoded character of every byte value
+ * of a codepage so that ASCII strings are converted without per-byte codepage lookups
+ */
+struct libevtx_codepage_table
+{
+	/* The codepage
+	 */
+	int codepage;
+
+	/* The UTF-8 encoded characters of the byte values
+	 */
+	uint8_t utf8_characters[ 256 ][ 4 ];
+
+	/* The sizes of the UTF-8 encoded characters of the byte values
+	 * Contains 0 if the byte value is not a character on its own,
+	 * such as the lead byte of a double-byte character
+	 */
+	uint8_t utf8_character_sizes[ 256 ];
+};
+
+int libevtx_codepage_table_set_codepage(
+     libevtx_codepage_table_t *codepage_table,
+     int codepage,
+     libcerror_error_t **error );
+
+int libevtx_codepage_table_get_ascii_prefix_size(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *prefix_size,
+     libcerror_error_t **error );
+
+int libevtx_codepage_table_copy_to_utf8_string(
+     const libevtx_codepage_table_t *codepage_table,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_CODEPAGE_TABLE_H ) */
+
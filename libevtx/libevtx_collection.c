@@ -0,0 +1,1852 @@
+/*
+ * Collection functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_codepage.h"
+#include "libevtx_collection.h"
+#include "libevtx_definitions.h"
+#include "libevtx_file.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_range_scheduler.h"
+#include "libevtx_record.h"
+#include "libevtx_record_values.h"
+
+/* Creates a collection
+ * Make sure the value collection is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_initialize(
+     libevtx_collection_t **collection,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_initialize";
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *collection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid collection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = memory_allocate_structure(
+	                       libevtx_internal_collection_t );
+
+	if( internal_collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create collection.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_collection,
+	     0,
+	     sizeof( libevtx_internal_collection_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear collection.",
+		 function );
+
+		memory_free(
+		 internal_collection );
+
+		return( -1 );
+	}
+	internal_collection->ascii_codepage    = LIBEVTX_CODEPAGE_WINDOWS_1252;
+	internal_collection->number_of_threads = 1;
+
+	*collection = (libevtx_collection_t *) internal_collection;
+
+	return( 1 );
+}
+
+/* Frees a collection
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_free(
+     libevtx_collection_t **collection,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_free";
+	int result                                         = 1;
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *collection != NULL )
+	{
+		internal_collection = (libevtx_internal_collection_t *) *collection;
+
+		if( internal_collection->streams != NULL )
+		{
+			if( libevtx_collection_close(
+			     *collection,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close collection.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*collection = NULL;
+
+		memory_free(
+		 internal_collection );
+	}
+	return( result );
+}
+
+/* Signals the collection to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_signal_abort(
+     libevtx_collection_t *collection,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_signal_abort";
+	int stream_index                                   = 0;
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	internal_collection->abort = 1;
+
+	if( internal_collection->streams != NULL )
+	{
+		for( stream_index = 0;
+		     stream_index < internal_collection->number_of_streams;
+		     stream_index++ )
+		{
+			if( internal_collection->streams[ stream_index ].file == NULL )
+			{
+				continue;
+			}
+			if( libevtx_file_signal_abort(
+			     internal_collection->streams[ stream_index ].file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal file: %d to abort.",
+				 function,
+				 stream_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the ASCII codepage of the files
+ * The codepage is applied to the files that are opened afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_set_ascii_codepage(
+     libevtx_collection_t *collection,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_set_ascii_codepage";
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( ( ascii_codepage != LIBEVTX_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to open the files
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_set_number_of_threads(
+     libevtx_collection_t *collection,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_set_number_of_threads";
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEVTX_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_collection->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate files that cannot be opened are skipped
+ * When set the open of the collection succeeds if some of the files cannot
+ * be opened, the errors of these files can be retrieved per file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_set_ignore_open_errors(
+     libevtx_collection_t *collection,
+     uint8_t ignore_open_errors,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_set_ignore_open_errors";
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	internal_collection->ignore_open_errors = ignore_open_errors;
+
+	return( 1 );
+}
+
+/* Opens the file of a stream of the collection
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_collection_open_stream(
+     libevtx_internal_collection_t *internal_collection,
+     int stream_index,
+     libcerror_error_t **error )
+{
+	libevtx_collection_stream_t *stream    = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_internal_collection_open_stream";
+	int result                             = 0;
+
+	if( internal_collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream_index < 0 )
+	 || ( stream_index >= internal_collection->number_of_streams ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	stream = &( internal_collection->streams[ stream_index ] );
+
+	if( libevtx_file_initialize(
+	     &( stream->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     stream->file,
+	     internal_collection->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in file: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_collection->filenames_wide != NULL )
+	{
+		result = libevtx_file_open_wide(
+		          stream->file,
+		          internal_collection->filenames_wide[ stream_index ],
+		          LIBEVTX_OPEN_READ,
+		          error );
+	}
+	else
+#endif
+	{
+		result = libevtx_file_open(
+		          stream->file,
+		          internal_collection->filenames[ stream_index ],
+		          LIBEVTX_OPEN_READ,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) stream->file;
+
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &( stream->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	/* Every chunk is read once in order
+	 */
+	if( libevtx_io_handle_advise_sequential_access(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise sequential access of file: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	stream->chunk_offset = internal_file->io_handle->chunks_data_offset;
+
+	return( 1 );
+}
+
+/* Opens the files of the collection assigned to a thread
+ * The files are assigned to the threads in turn
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_open_thread(
+     libevtx_collection_open_thread_arguments_t *thread_arguments )
+{
+	libevtx_collection_stream_t *stream                = NULL;
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_open_thread";
+	int result                                         = 0;
+	int stream_index                                   = 0;
+
+	if( thread_arguments == NULL )
+	{
+		return( -1 );
+	}
+	internal_collection = thread_arguments->internal_collection;
+
+	/* The time needed to open a file depends on its size, hence a thread
+	 * that has opened its own files takes over files of the other threads
+	 */
+	for( ;; )
+	{
+		result = libevtx_range_scheduler_get_next_index(
+		          thread_arguments->range_scheduler,
+		          thread_arguments->thread_index,
+		          &stream_index,
+		          &( thread_arguments->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( thread_arguments->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next file index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libevtx_internal_collection_open_stream(
+		     internal_collection,
+		     stream_index,
+		     &( thread_arguments->error ) ) != 1 )
+		{
+			if( internal_collection->ignore_open_errors == 0 )
+			{
+				goto on_error;
+			}
+			/* The file is skipped and its error is retained
+			 */
+			stream = &( internal_collection->streams[ stream_index ] );
+
+			stream->open_error = thread_arguments->error;
+
+			thread_arguments->error = NULL;
+
+			if( stream->file != NULL )
+			{
+				libevtx_file_free(
+				 &( stream->file ),
+				 NULL );
+			}
+		}
+	}
+	thread_arguments->result = 1;
+
+	return( 1 );
+
+on_error:
+	thread_arguments->result = -1;
+
+	return( -1 );
+}
+
+/* Opens the files of the collection using the filenames set by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_collection_open_files(
+     libevtx_internal_collection_t *internal_collection,
+     int number_of_files,
+     libcerror_error_t **error )
+{
+	libevtx_collection_open_thread_arguments_t *thread_arguments = NULL;
+	libevtx_range_scheduler_t *range_scheduler                   = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t **threads                               = NULL;
+#endif
+
+	static char *function                                        = "libevtx_internal_collection_open_files";
+	size_t array_size                                            = 0;
+	int result                                                   = 1;
+	int stream_index                                             = 0;
+	int thread_index                                             = 0;
+
+	if( internal_collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_collection->streams != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid collection - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_files <= 0 )
+	 || ( (size_t) number_of_files > ( (size_t) SSIZE_MAX / sizeof( libevtx_collection_stream_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	array_size = sizeof( libevtx_collection_stream_t ) * number_of_files;
+
+	internal_collection->streams = (libevtx_collection_stream_t *) memory_allocate(
+	                                                                array_size );
+
+	if( internal_collection->streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create streams.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_collection->streams,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear streams.",
+		 function );
+
+		goto on_error;
+	}
+	internal_collection->number_of_streams = number_of_files;
+
+	array_size = sizeof( int ) * number_of_files;
+
+	internal_collection->heap = (int *) memory_allocate(
+	                                     array_size );
+
+	if( internal_collection->heap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create heap.",
+		 function );
+
+		goto on_error;
+	}
+	internal_collection->heap_size      = 0;
+	internal_collection->heap_is_filled = 0;
+	internal_collection->abort          = 0;
+
+	internal_collection->number_of_active_threads = internal_collection->number_of_threads;
+
+	if( internal_collection->number_of_active_threads > number_of_files )
+	{
+		internal_collection->number_of_active_threads = number_of_files;
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	internal_collection->number_of_active_threads = 1;
+#endif
+	array_size = sizeof( libevtx_collection_open_thread_arguments_t ) * internal_collection->number_of_active_threads;
+
+	thread_arguments = (libevtx_collection_open_thread_arguments_t *) memory_allocate(
+	                                                                   array_size );
+
+	if( thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread arguments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     thread_arguments,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread arguments.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_range_scheduler_initialize(
+	     &range_scheduler,
+	     internal_collection->number_of_active_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create range scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_range_scheduler_reset(
+	     range_scheduler,
+	     number_of_files,
+	     internal_collection->number_of_active_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset range scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < internal_collection->number_of_active_threads;
+	     thread_index++ )
+	{
+		thread_arguments[ thread_index ].internal_collection = internal_collection;
+		thread_arguments[ thread_index ].range_scheduler     = range_scheduler;
+		thread_arguments[ thread_index ].thread_index        = thread_index;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	array_size = sizeof( libcthreads_thread_t * ) * internal_collection->number_of_active_threads;
+
+	threads = (libcthreads_thread_t **) memory_allocate(
+	                                     array_size );
+
+	if( threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     threads,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first thread opens its files in the calling thread
+	 */
+	for( thread_index = 1;
+	     thread_index < internal_collection->number_of_active_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &libevtx_collection_open_thread,
+		     (void *) &( thread_arguments[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			/* The files opened by the threads that were created are freed on error
+			 */
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		libevtx_collection_open_thread(
+		 &( thread_arguments[ 0 ] ) );
+	}
+	for( thread_index = 1;
+	     thread_index < internal_collection->number_of_active_threads;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 threads );
+
+	threads = NULL;
+#else
+	/* Without multi-threading support the files are opened sequentially
+	 */
+	libevtx_collection_open_thread(
+	 &( thread_arguments[ 0 ] ) );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( thread_index = 0;
+	     thread_index < internal_collection->number_of_active_threads;
+	     thread_index++ )
+	{
+		if( thread_arguments[ thread_index ].result == 1 )
+		{
+			continue;
+		}
+		/* Only the first error is passed to the caller
+		 */
+		if( ( result == 1 )
+		 && ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = thread_arguments[ thread_index ].error;
+
+			thread_arguments[ thread_index ].error = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open files in thread: %d.",
+			 function,
+			 thread_index );
+		}
+		else if( thread_arguments[ thread_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( thread_arguments[ thread_index ].error ) );
+		}
+		result = -1;
+	}
+	memory_free(
+	 thread_arguments );
+
+	thread_arguments = NULL;
+
+	if( libevtx_range_scheduler_free(
+	     &range_scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free range scheduler.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+#endif
+	if( range_scheduler != NULL )
+	{
+		libevtx_range_scheduler_free(
+		 &range_scheduler,
+		 NULL );
+	}
+	if( thread_arguments != NULL )
+	{
+		memory_free(
+		 thread_arguments );
+	}
+	if( internal_collection->streams != NULL )
+	{
+		for( stream_index = 0;
+		     stream_index < internal_collection->number_of_streams;
+		     stream_index++ )
+		{
+			if( internal_collection->streams[ stream_index ].file != NULL )
+			{
+				libevtx_file_free(
+				 &( internal_collection->streams[ stream_index ].file ),
+				 NULL );
+			}
+			if( internal_collection->streams[ stream_index ].open_error != NULL )
+			{
+				libcerror_error_free(
+				 &( internal_collection->streams[ stream_index ].open_error ) );
+			}
+		}
+		memory_free(
+		 internal_collection->streams );
+
+		internal_collection->streams = NULL;
+	}
+	if( internal_collection->heap != NULL )
+	{
+		memory_free(
+		 internal_collection->heap );
+
+		internal_collection->heap = NULL;
+	}
+	internal_collection->number_of_streams = 0;
+
+	return( -1 );
+}
+
+/* Opens the files of a collection
+ * The files are opened for reading, using multiple threads if set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_open(
+     libevtx_collection_t *collection,
+     const char * const *filenames,
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_open";
+	int filename_index                                 = 0;
+	int result                                         = 0;
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( filenames[ filename_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+	}
+	internal_collection->filenames = filenames;
+
+	result = libevtx_internal_collection_open_files(
+	          internal_collection,
+	          number_of_filenames,
+	          error );
+
+	internal_collection->filenames = NULL;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens the files of a collection
+ * The files are opened for reading, using multiple threads if set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_open_wide(
+     libevtx_collection_t *collection,
+     const wchar_t * const *filenames,
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_open_wide";
+	int filename_index                                 = 0;
+	int result                                         = 0;
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( filenames[ filename_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+	}
+	internal_collection->filenames_wide = filenames;
+
+	result = libevtx_internal_collection_open_files(
+	          internal_collection,
+	          number_of_filenames,
+	          error );
+
+	internal_collection->filenames_wide = NULL;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Closes the files of a collection
+ * Returns 0 if successful or -1 on error
+ */
+int libevtx_collection_close(
+     libevtx_collection_t *collection,
+     libcerror_error_t **error )
+{
+	libevtx_collection_stream_t *stream                = NULL;
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_close";
+	int result                                         = 0;
+	int stream_index                                   = 0;
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( internal_collection->streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid collection - missing streams.",
+		 function );
+
+		return( -1 );
+	}
+	for( stream_index = 0;
+	     stream_index < internal_collection->number_of_streams;
+	     stream_index++ )
+	{
+		stream = &( internal_collection->streams[ stream_index ] );
+
+		if( stream->chunk != NULL )
+		{
+			if( libevtx_chunk_free(
+			     &( stream->chunk ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk of file: %d.",
+				 function,
+				 stream_index );
+
+				result = -1;
+			}
+		}
+		if( stream->file != NULL )
+		{
+			if( libevtx_file_free(
+			     &( stream->file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file: %d.",
+				 function,
+				 stream_index );
+
+				result = -1;
+			}
+		}
+		if( stream->open_error != NULL )
+		{
+			libcerror_error_free(
+			 &( stream->open_error ) );
+		}
+	}
+	memory_free(
+	 internal_collection->streams );
+
+	internal_collection->streams = NULL;
+
+	if( internal_collection->heap != NULL )
+	{
+		memory_free(
+		 internal_collection->heap );
+
+		internal_collection->heap = NULL;
+	}
+	internal_collection->number_of_streams = 0;
+	internal_collection->heap_size         = 0;
+	internal_collection->heap_is_filled    = 0;
+
+	return( result );
+}
+
+/* Retrieves the number of files in the collection
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_collection_get_number_of_files(
+     libevtx_collection_t *collection,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_get_number_of_files";
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = internal_collection->number_of_streams;
+
+	return( 1 );
+}
+
+/* Retrieves the error string of a file that could not be opened
+ * Returns 1 if successful, 0 if the file was opened or -1 on error
+ */
+int libevtx_collection_get_file_open_error_string(
+     libevtx_collection_t *collection,
+     int file_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libevtx_collection_stream_t *stream                = NULL;
+	libevtx_internal_collection_t *internal_collection = NULL;
+	static char *function                              = "libevtx_collection_get_file_open_error_string";
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( internal_collection->streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid collection - missing streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( file_index >= internal_collection->number_of_streams ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	stream = &( internal_collection->streams[ file_index ] );
+
+	if( stream->open_error == NULL )
+	{
+		return( 0 );
+	}
+	if( libcerror_error_backtrace_sprint(
+	     stream->open_error,
+	     string,
+	     string_size ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to print error of file: %d.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Seeks the next record of a stream
+ * The chunks that do not contain records are skipped. If the file is not
+ * dirty the chunks outside the range indicated by the file header are not read
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevtx_collection_stream_seek_next_record(
+     libevtx_collection_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_collection_stream_seek_next_record";
+	int result                             = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* A file that could not be opened has no records
+	 */
+	if( stream->open_error != NULL )
+	{
+		return( 0 );
+	}
+	internal_file = (libevtx_internal_file_t *) stream->file;
+
+	if( ( internal_file == NULL )
+	 || ( internal_file->io_handle == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	while( stream->record_index >= stream->number_of_records )
+	{
+		/* Only a single chunk of every file is kept in memory
+		 */
+		if( stream->chunk != NULL )
+		{
+			if( libevtx_chunk_free(
+			     &( stream->chunk ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		stream->number_of_records = 0;
+		stream->record_index      = 0;
+
+		if( internal_file->io_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+		if( ( stream->chunk_offset + internal_file->io_handle->chunk_size ) > (off64_t) stream->file_size )
+		{
+			return( 0 );
+		}
+		if( ( stream->chunk_index >= (uint32_t) internal_file->io_handle->number_of_chunks )
+		 && ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) == 0 ) )
+		{
+			return( 0 );
+		}
+		if( libevtx_chunk_initialize(
+		     &( stream->chunk ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %" PRIu32 ".",
+			 function,
+			 stream->chunk_index );
+
+			return( -1 );
+		}
+		result = libevtx_chunk_read(
+		          stream->chunk,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          stream->chunk_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu32 ".",
+			 function,
+			 stream->chunk_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libevtx_chunk_get_number_of_records(
+			     stream->chunk,
+			     &( stream->number_of_records ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu32 " number of records.",
+				 function,
+				 stream->chunk_index );
+
+				return( -1 );
+			}
+		}
+		stream->chunk_offset += internal_file->io_handle->chunk_size;
+		stream->chunk_index  += 1;
+	}
+	if( libevtx_chunk_get_record(
+	     stream->chunk,
+	     stream->record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %" PRIu16 ".",
+		 function,
+		 stream->record_index );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record: %" PRIu16 ".",
+		 function,
+		 stream->record_index );
+
+		return( -1 );
+	}
+	stream->written_time = record_values->written_time;
+
+	return( 1 );
+}
+
+/* Compares the streams referenced by two heap entries
+ * The streams are ordered by the written time of their current record,
+ * streams with the same written time are ordered by their index
+ * Returns -1 if the first stream precedes the second, 1 if it follows or 0 if equal
+ */
+int libevtx_collection_heap_compare(
+     libevtx_internal_collection_t *internal_collection,
+     int first_heap_index,
+     int second_heap_index )
+{
+	int first_stream_index  = 0;
+	int second_stream_index = 0;
+
+	first_stream_index  = internal_collection->heap[ first_heap_index ];
+	second_stream_index = internal_collection->heap[ second_heap_index ];
+
+	if( internal_collection->streams[ first_stream_index ].written_time < internal_collection->streams[ second_stream_index ].written_time )
+	{
+		return( -1 );
+	}
+	if( internal_collection->streams[ first_stream_index ].written_time > internal_collection->streams[ second_stream_index ].written_time )
+	{
+		return( 1 );
+	}
+	if( first_stream_index < second_stream_index )
+	{
+		return( -1 );
+	}
+	if( first_stream_index > second_stream_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Moves a heap entry down until both of its children follow it
+ */
+void libevtx_collection_heap_sift_down(
+      libevtx_internal_collection_t *internal_collection,
+      int heap_index )
+{
+	int child_heap_index = 0;
+	int stream_index     = 0;
+
+	for( ;; )
+	{
+		child_heap_index = ( 2 * heap_index ) + 1;
+
+		if( child_heap_index >= internal_collection->heap_size )
+		{
+			break;
+		}
+		if( ( ( child_heap_index + 1 ) < internal_collection->heap_size )
+		 && ( libevtx_collection_heap_compare(
+		       internal_collection,
+		       child_heap_index + 1,
+		       child_heap_index ) < 0 ) )
+		{
+			child_heap_index += 1;
+		}
+		if( libevtx_collection_heap_compare(
+		     internal_collection,
+		     heap_index,
+		     child_heap_index ) <= 0 )
+		{
+			break;
+		}
+		stream_index = internal_collection->heap[ heap_index ];
+
+		internal_collection->heap[ heap_index ]       = internal_collection->heap[ child_heap_index ];
+		internal_collection->heap[ child_heap_index ] = stream_index;
+
+		heap_index = child_heap_index;
+	}
+}
+
+/* Fills the heap with the streams that contain records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_collection_fill_heap(
+     libevtx_internal_collection_t *internal_collection,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_collection_fill_heap";
+	int heap_index        = 0;
+	int result            = 0;
+	int stream_index      = 0;
+
+	if( internal_collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection->heap_size = 0;
+
+	for( stream_index = 0;
+	     stream_index < internal_collection->number_of_streams;
+	     stream_index++ )
+	{
+		result = libevtx_collection_stream_seek_next_record(
+		          &( internal_collection->streams[ stream_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to seek first record of file: %d.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_collection->heap[ internal_collection->heap_size ] = stream_index;
+
+			internal_collection->heap_size += 1;
+		}
+	}
+	for( heap_index = ( internal_collection->heap_size / 2 ) - 1;
+	     heap_index >= 0;
+	     heap_index-- )
+	{
+		libevtx_collection_heap_sift_down(
+		 internal_collection,
+		 heap_index );
+	}
+	internal_collection->heap_is_filled = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next record of the collection
+ * The records of the files are merged in order of their written time, which
+ * assumes the records of each individual file are stored in that order
+ * The record is independent of the chunks read by the collection but must be
+ * freed before the collection is closed
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevtx_collection_get_next_record(
+     libevtx_collection_t *collection,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_collection_stream_t *stream                = NULL;
+	libevtx_internal_collection_t *internal_collection = NULL;
+	libevtx_internal_file_t *internal_file             = NULL;
+	libevtx_record_values_t *record_values             = NULL;
+	static char *function                              = "libevtx_collection_get_next_record";
+	int result                                         = 0;
+	int stream_index                                   = 0;
+
+	if( collection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid collection.",
+		 function );
+
+		return( -1 );
+	}
+	internal_collection = (libevtx_internal_collection_t *) collection;
+
+	if( internal_collection->streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid collection - missing streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_collection->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_collection->heap_is_filled == 0 )
+	{
+		if( libevtx_internal_collection_fill_heap(
+		     internal_collection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill heap.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_collection->heap_size == 0 )
+	{
+		return( 0 );
+	}
+	stream_index  = internal_collection->heap[ 0 ];
+	stream        = &( internal_collection->streams[ stream_index ] );
+	internal_file = (libevtx_internal_file_t *) stream->file;
+
+	if( libevtx_file_read_chunk_record_values(
+	     internal_file,
+	     stream->chunk,
+	     stream->record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record: %" PRIu16 " of file: %d.",
+		 function,
+		 stream->record_index,
+		 stream_index );
+
+		goto on_error;
+	}
+	if( libevtx_record_initialize(
+	     record,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     record_values,
+	     LIBEVTX_RECORD_FLAGS_DEFAULT | LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	/* The record values are now managed by the record
+	 */
+	record_values = NULL;
+
+	stream->record_index += 1;
+
+	result = libevtx_collection_stream_seek_next_record(
+	          stream,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to seek next record of file: %d.",
+		 function,
+		 stream_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		internal_collection->heap_size -= 1;
+
+		internal_collection->heap[ 0 ] = internal_collection->heap[ internal_collection->heap_size ];
+	}
+	libevtx_collection_heap_sift_down(
+	 internal_collection,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( *record != NULL )
+	{
+		libevtx_record_free(
+		 record,
+		 NULL );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,272 @@
+/*
+ * Collection functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_COLLECTION_H )
+#define _LIBEVTX_INTERNAL_COLLECTION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_extern.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_range_scheduler.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_collection_stream libevtx_collection_stream_t;
+typedef struct libevtx_collection_open_thread_arguments libevtx_collection_open_thread_arguments_t;
+typedef struct libevtx_internal_collection libevtx_internal_collection_t;
+
+/* The records of a file of the collection, read one chunk at a time
+ */
+struct libevtx_collection_stream
+{
+	/* The file
+	 */
+	libevtx_file_t *file;
+
+	/* The size of the file
+	 */
+	size64_t file_size;
+
+	/* The current chunk
+	 */
+	libevtx_chunk_t *chunk;
+
+	/* The index of the next chunk
+	 */
+	uint32_t chunk_index;
+
+	/* The offset of the next chunk
+	 */
+	off64_t chunk_offset;
+
+	/* The number of records in the current chunk
+	 */
+	uint16_t number_of_records;
+
+	/* The index of the current record in the current chunk
+	 */
+	uint16_t record_index;
+
+	/* The written time of the current record
+	 */
+	uint64_t written_time;
+
+	/* The error of a file that could not be opened
+	 */
+	libcerror_error_t *open_error;
+};
+
+struct libevtx_collection_open_thread_arguments
+{
+	/* The collection
+	 */
+	libevtx_internal_collection_t *internal_collection;
+
+	/* The range scheduler that distributes the files over the threads
+	 */
+	libevtx_range_scheduler_t *range_scheduler;
+
+	/* The thread index
+	 */
+	int thread_index;
+
+	/* The open result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+struct libevtx_internal_collection
+{
+	/* The ASCII codepage of the files
+	 */
+	int ascii_codepage;
+
+	/* The number of threads used to open the files
+	 */
+	int number_of_threads;
+
+	/* The number of threads used by the current open
+	 */
+	int number_of_active_threads;
+
+	/* Value to indicate files that cannot be opened are skipped
+	 */
+	uint8_t ignore_open_errors;
+
+	/* The narrow character filenames of the current open
+	 */
+	const char * const *filenames;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide character filenames of the current open
+	 */
+	const wchar_t * const *filenames_wide;
+#endif
+
+	/* The streams, one for every file
+	 */
+	libevtx_collection_stream_t *streams;
+
+	/* The number of streams
+	 */
+	int number_of_streams;
+
+	/* The heap of the indexes of the streams that have a current record
+	 * ordered by the written time of the current record
+	 */
+	int *heap;
+
+	/* The number of entries in the heap
+	 */
+	int heap_size;
+
+	/* Value to indicate the heap was filled
+	 */
+	uint8_t heap_is_filled;
+
+	/* Value to indicate the merge should be aborted
+	 */
+	uint8_t abort;
+};
+
+LIBEVTX_EXTERN \
+int libevtx_collection_initialize(
+     libevtx_collection_t **collection,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_free(
+     libevtx_collection_t **collection,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_signal_abort(
+     libevtx_collection_t *collection,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_set_ascii_codepage(
+     libevtx_collection_t *collection,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_set_number_of_threads(
+     libevtx_collection_t *collection,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_set_ignore_open_errors(
+     libevtx_collection_t *collection,
+     uint8_t ignore_open_errors,
+     libcerror_error_t **error );
+
+int libevtx_internal_collection_open_stream(
+     libevtx_internal_collection_t *internal_collection,
+     int stream_index,
+     libcerror_error_t **error );
+
+int libevtx_collection_open_thread(
+     libevtx_collection_open_thread_arguments_t *thread_arguments );
+
+int libevtx_internal_collection_open_files(
+     libevtx_internal_collection_t *internal_collection,
+     int number_of_files,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_open(
+     libevtx_collection_t *collection,
+     const char * const *filenames,
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_collection_open_wide(
+     libevtx_collection_t *collection,
+     const wchar_t * const *filenames,
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVTX_EXTERN \
+int libevtx_collection_close(
+     libevtx_collection_t *collection,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_get_number_of_files(
+     libevtx_collection_t *collection,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_get_file_open_error_string(
+     libevtx_collection_t *collection,
+     int file_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libevtx_collection_stream_seek_next_record(
+     libevtx_collection_stream_t *stream,
+     libcerror_error_t **error );
+
+int libevtx_collection_heap_compare(
+     libevtx_internal_collection_t *internal_collection,
+     int first_heap_index,
+     int second_heap_index );
+
+void libevtx_collection_heap_sift_down(
+      libevtx_internal_collection_t *internal_collection,
+      int heap_index );
+
+int libevtx_internal_collection_fill_heap(
+     libevtx_internal_collection_t *internal_collection,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_collection_get_next_record(
+     libevtx_collection_t *collection,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_COLLECTION_H ) */
+
@@ -0,0 +1,400 @@
+/*
+ * Decode budget functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_decode_budget.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfwevt.h"
+
+/* Determines if the decode budget limits any of the decode costs
+ * Returns 1 if limited or 0 if not
+ */
+int libevtx_decode_budget_is_limited(
+     const libevtx_decode_budget_t *decode_budget )
+{
+	if( decode_budget == NULL )
+	{
+		return( 0 );
+	}
+	if( ( decode_budget->maximum_depth == 0 )
+	 && ( decode_budget->maximum_number_of_nodes == 0 )
+	 && ( decode_budget->maximum_decoded_size == 0 )
+	 && ( decode_budget->maximum_decode_time == 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Checks the binary XML data of a record against the decode budget before it is decoded
+ * The decoded size contains the template definition a template instance references
+ * and the number of substitution values is counted as nodes, both can be determined
+ * without decoding the binary XML
+ * Returns 1 if within budget, 0 if the budget is exceeded or -1 on error
+ */
+int libevtx_decode_budget_check_binary_xml(
+     const libevtx_decode_budget_t *decode_budget,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t data_offset,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libevtx_decode_budget_check_binary_xml";
+	size_t decoded_size                 = 0;
+	size_t end_of_data_offset           = 0;
+	size_t values_offset                = 0;
+	uint32_t number_of_values           = 0;
+	uint32_t template_data_size         = 0;
+	uint32_t template_definition_offset = 0;
+
+	if( decode_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset > chunk_data_size )
+	 || ( data_size > ( chunk_data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	decoded_size       = data_size;
+	end_of_data_offset = data_offset + data_size;
+
+	/* A fragment header followed by a template instance token that contains
+	 * the template identifier and the offset of the template definition
+	 */
+	if( ( data_size >= 14 )
+	 && ( chunk_data[ data_offset ] == LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER )
+	 && ( chunk_data[ data_offset + 4 ] == LIBEVTX_BINARY_XML_TOKEN_TEMPLATE_INSTANCE ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chunk_data[ data_offset + 10 ] ),
+		 template_definition_offset );
+
+		values_offset = data_offset + 14;
+
+		/* The template definition header consists of the next template definition offset,
+		 * the template identifier and the template data size
+		 */
+		if( ( (size_t) template_definition_offset < chunk_data_size )
+		 && ( ( chunk_data_size - template_definition_offset ) >= 24 ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_data[ template_definition_offset + 20 ] ),
+			 template_data_size );
+
+			/* The template definition is stored in the record data the first time it is used in the chunk
+			 */
+			if( (size_t) template_definition_offset == values_offset )
+			{
+				values_offset += 24 + (size_t) template_data_size;
+			}
+			else
+			{
+				decoded_size += template_data_size;
+			}
+		}
+		if( ( values_offset < end_of_data_offset )
+		 && ( ( end_of_data_offset - values_offset ) >= 4 ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_data[ values_offset ] ),
+			 number_of_values );
+
+			if( ( decode_budget->maximum_number_of_nodes > 0 )
+			 && ( number_of_values > (uint32_t) decode_budget->maximum_number_of_nodes ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	if( ( decode_budget->maximum_decoded_size > 0 )
+	 && ( decoded_size > decode_budget->maximum_decoded_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Checks a specific XML tag and its elements against the maximum depth and number of nodes
+ * The number of nodes is incremented with the elements and attributes counted,
+ * the elements are no longer counted once the budget is exceeded
+ * Returns 1 if within budget, 0 if the budget is exceeded or -1 on error
+ */
+int libevtx_decode_budget_check_xml_tag(
+     const libevtx_decode_budget_t *decode_budget,
+     libfwevt_xml_tag_t *xml_tag,
+     int xml_tag_depth,
+     int *number_of_nodes,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *element_xml_tag = NULL;
+	static char *function               = "libevtx_decode_budget_check_xml_tag";
+	int element_index                   = 0;
+	int number_of_attributes            = 0;
+	int number_of_elements              = 0;
+	int result                          = 0;
+
+	if( decode_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	/* The depth of the root XML tag is 1
+	 */
+	if( ( decode_budget->maximum_depth > 0 )
+	 && ( xml_tag_depth > decode_budget->maximum_depth ) )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     xml_tag,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nodes += 1 + number_of_attributes;
+
+	if( ( decode_budget->maximum_number_of_nodes > 0 )
+	 && ( *number_of_nodes > decode_budget->maximum_number_of_nodes ) )
+	{
+		return( 0 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     xml_tag,
+		     element_index,
+		     &element_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libevtx_decode_budget_check_xml_tag(
+		          decode_budget,
+		          element_xml_tag,
+		          xml_tag_depth + 1,
+		          number_of_nodes,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Checks a decoded XML document against the decode budget
+ * The decode time cannot be checked while the binary XML is decoded,
+ * hence a record that exceeds the maximum decode time is only detected afterwards
+ * Returns 1 if within budget, 0 if the budget is exceeded or -1 on error
+ */
+int libevtx_decode_budget_check_xml_document(
+     const libevtx_decode_budget_t *decode_budget,
+     libfwevt_xml_document_t *xml_document,
+     uint64_t decode_time,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *root_xml_tag = NULL;
+	static char *function            = "libevtx_decode_budget_check_xml_document";
+	int number_of_nodes              = 0;
+	int result                       = 0;
+
+	if( decode_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decode_budget->maximum_decode_time > 0 )
+	 && ( decode_time > decode_budget->maximum_decode_time ) )
+	{
+		return( 0 );
+	}
+	if( ( decode_budget->maximum_depth == 0 )
+	 && ( decode_budget->maximum_number_of_nodes == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libfwevt_xml_document_get_root_xml_tag(
+	     xml_document,
+	     &root_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_decode_budget_check_xml_tag(
+	          decode_budget,
+	          root_xml_tag,
+	          1,
+	          &number_of_nodes,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check root XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
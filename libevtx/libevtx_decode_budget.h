@@ -0,0 +1,90 @@
+/*
+ * Decode budget functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_DECODE_BUDGET_H )
+#define _LIBEVTX_DECODE_BUDGET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libfwevt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_decode_budget libevtx_decode_budget_t;
+
+/* The decode budget limits the decode cost of a single record
+ * A value of 0 indicates the corresponding cost is not limited
+ */
+struct libevtx_decode_budget
+{
+	/* The maximum element depth of the XML document
+	 */
+	int maximum_depth;
+
+	/* The maximum number of nodes
+	 * The nodes are the elements, attributes and substitution values
+	 */
+	int maximum_number_of_nodes;
+
+	/* The maximum decoded size
+	 * The size of the binary XML data of the record and of the template definition it references
+	 */
+	size_t maximum_decoded_size;
+
+	/* The maximum decode time in nanoseconds
+	 */
+	uint64_t maximum_decode_time;
+};
+
+int libevtx_decode_budget_is_limited(
+     const libevtx_decode_budget_t *decode_budget );
+
+int libevtx_decode_budget_check_binary_xml(
+     const libevtx_decode_budget_t *decode_budget,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t data_offset,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_decode_budget_check_xml_tag(
+     const libevtx_decode_budget_t *decode_budget,
+     libfwevt_xml_tag_t *xml_tag,
+     int xml_tag_depth,
+     int *number_of_nodes,
+     libcerror_error_t **error );
+
+int libevtx_decode_budget_check_xml_document(
+     const libevtx_decode_budget_t *decode_budget,
+     libfwevt_xml_document_t *xml_document,
+     uint64_t decode_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_DECODE_BUDGET_H ) */
+
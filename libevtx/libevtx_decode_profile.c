@@ -0,0 +1,1194 @@
+/*
+ * Decode profile functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libevtx_decode_profile.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+/* The 32-bit FNV-1a hash parameters
+ */
+#define LIBEVTX_DECODE_PROFILE_FNV1A_OFFSET_BASIS	0x811c9dc5UL
+#define LIBEVTX_DECODE_PROFILE_FNV1A_PRIME		0x01000193UL
+
+/* The initial number of slots, entries and chunks
+ */
+#define LIBEVTX_DECODE_PROFILE_INITIAL_NUMBER_OF_SLOTS	64
+#define LIBEVTX_DECODE_PROFILE_INITIAL_NUMBER_OF_ENTRIES	16
+#define LIBEVTX_DECODE_PROFILE_INITIAL_NUMBER_OF_CHUNKS	64
+
+/* Creates a decode profile
+ * Make sure the value decode_profile is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_initialize(
+     libevtx_decode_profile_t **decode_profile,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decode_profile_initialize";
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decode_profile != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decode profile value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decode_profile = memory_allocate_structure(
+	                   libevtx_decode_profile_t );
+
+	if( *decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decode profile.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decode_profile,
+	     0,
+	     sizeof( libevtx_decode_profile_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decode profile.",
+		 function );
+
+		memory_free(
+		 *decode_profile );
+
+		*decode_profile = NULL;
+
+		return( -1 );
+	}
+	( *decode_profile )->is_sorted = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *decode_profile )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *decode_profile != NULL )
+	{
+		memory_free(
+		 *decode_profile );
+
+		*decode_profile = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decode profile
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_free(
+     libevtx_decode_profile_t **decode_profile,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decode_profile_free";
+	int result            = 1;
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decode_profile != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *decode_profile )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *decode_profile )->chunk_values != NULL )
+		{
+			memory_free(
+			 ( *decode_profile )->chunk_values );
+		}
+		if( ( *decode_profile )->slots != NULL )
+		{
+			memory_free(
+			 ( *decode_profile )->slots );
+		}
+		if( ( *decode_profile )->entries != NULL )
+		{
+			memory_free(
+			 ( *decode_profile )->entries );
+		}
+		memory_free(
+		 *decode_profile );
+
+		*decode_profile = NULL;
+	}
+	return( result );
+}
+
+/* Empties a decode profile
+ * The allocated memory is retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_empty(
+     libevtx_decode_profile_t *decode_profile,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decode_profile_empty";
+	int result            = 1;
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( decode_profile->slots != NULL )
+	{
+		if( memory_set(
+		     decode_profile->slots,
+		     0,
+		     sizeof( int ) * decode_profile->number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slots.",
+			 function );
+
+			result = -1;
+		}
+	}
+	decode_profile->number_of_entries = 0;
+	decode_profile->number_of_chunks  = 0;
+	decode_profile->is_sorted         = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Resizes the slots of a decode profile and reinserts the entries
+ * The caller is responsible for holding the mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_resize_slots(
+     libevtx_decode_profile_t *decode_profile,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	int *slots            = NULL;
+	static char *function = "libevtx_decode_profile_resize_slots";
+	int entry_index       = 0;
+	int slot_index        = 0;
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of slots must be a power of 2
+	 */
+	if( ( number_of_slots <= 0 )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( (size_t) number_of_slots > ( (size_t) SSIZE_MAX / sizeof( int ) ) )
+	 || ( number_of_slots < decode_profile->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (int *) memory_allocate(
+	                 sizeof( int ) * number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( int ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < decode_profile->number_of_entries;
+	     entry_index++ )
+	{
+		slot_index = (int) ( decode_profile->entries[ entry_index ].hash & (uint32_t) ( number_of_slots - 1 ) );
+
+		while( slots[ slot_index ] != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ slot_index ] = entry_index + 1;
+	}
+	if( decode_profile->slots != NULL )
+	{
+		memory_free(
+		 decode_profile->slots );
+	}
+	decode_profile->slots           = slots;
+	decode_profile->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Adds values to the entry of a specific key and to the values of a specific chunk
+ * The entry is created if it does not exist, the chunk is ignored if the chunk index is -1
+ * The values are stored in the order of the LIBEVTX_DECODE_PROFILE_VALUES definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_add_values(
+     libevtx_decode_profile_t *decode_profile,
+     const libevtx_decode_profile_key_t *key,
+     int chunk_index,
+     const uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libevtx_decode_profile_entry_t *entry = NULL;
+	void *reallocation                    = NULL;
+	uint64_t *chunk_values                = NULL;
+	static char *function                 = "libevtx_decode_profile_add_values";
+	size_t byte_index                     = 0;
+	uint32_t hash                         = LIBEVTX_DECODE_PROFILE_FNV1A_OFFSET_BASIS;
+	int entry_index                       = 0;
+	int number_of_chunks                  = 0;
+	int number_of_entries                 = 0;
+	int slot_index                        = 0;
+	int value_index                       = 0;
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		hash ^= (uint32_t) key->provider_identifier[ byte_index ];
+		hash *= LIBEVTX_DECODE_PROFILE_FNV1A_PRIME;
+	}
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		hash ^= (uint32_t) key->template_identifier[ byte_index ];
+		hash *= LIBEVTX_DECODE_PROFILE_FNV1A_PRIME;
+	}
+	for( byte_index = 0;
+	     byte_index < 32;
+	     byte_index += 8 )
+	{
+		hash ^= ( key->event_identifier >> byte_index ) & 0x000000ffUL;
+		hash *= LIBEVTX_DECODE_PROFILE_FNV1A_PRIME;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( decode_profile->number_of_slots > 0 )
+	{
+		slot_index = (int) ( hash & (uint32_t) ( decode_profile->number_of_slots - 1 ) );
+
+		while( decode_profile->slots[ slot_index ] != 0 )
+		{
+			entry_index = decode_profile->slots[ slot_index ] - 1;
+
+			if( ( decode_profile->entries[ entry_index ].hash == hash )
+			 && ( decode_profile->entries[ entry_index ].key.event_identifier == key->event_identifier )
+			 && ( memory_compare(
+			       decode_profile->entries[ entry_index ].key.provider_identifier,
+			       key->provider_identifier,
+			       16 ) == 0 )
+			 && ( memory_compare(
+			       decode_profile->entries[ entry_index ].key.template_identifier,
+			       key->template_identifier,
+			       16 ) == 0 ) )
+			{
+				entry = &( decode_profile->entries[ entry_index ] );
+
+				break;
+			}
+			slot_index = ( slot_index + 1 ) & ( decode_profile->number_of_slots - 1 );
+		}
+	}
+	if( entry == NULL )
+	{
+		/* Keep the load factor of the slots below 50%
+		 */
+		if( ( decode_profile->number_of_entries + 1 ) > ( decode_profile->number_of_slots / 2 ) )
+		{
+			if( decode_profile->number_of_slots > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of slots value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevtx_decode_profile_resize_slots(
+			     decode_profile,
+			     ( decode_profile->number_of_slots == 0 ) ? LIBEVTX_DECODE_PROFILE_INITIAL_NUMBER_OF_SLOTS : decode_profile->number_of_slots * 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize slots.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( decode_profile->number_of_entries >= decode_profile->number_of_allocated_entries )
+		{
+			if( decode_profile->number_of_allocated_entries == 0 )
+			{
+				number_of_entries = LIBEVTX_DECODE_PROFILE_INITIAL_NUMBER_OF_ENTRIES;
+			}
+			else
+			{
+				number_of_entries = decode_profile->number_of_allocated_entries * 2;
+			}
+			if( (size_t) number_of_entries > ( (size_t) SSIZE_MAX / sizeof( libevtx_decode_profile_entry_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of entries value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                decode_profile->entries,
+			                sizeof( libevtx_decode_profile_entry_t ) * number_of_entries );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize entries.",
+				 function );
+
+				goto on_error;
+			}
+			decode_profile->entries                     = (libevtx_decode_profile_entry_t *) reallocation;
+			decode_profile->number_of_allocated_entries = number_of_entries;
+		}
+		entry_index = decode_profile->number_of_entries;
+		entry       = &( decode_profile->entries[ entry_index ] );
+
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( libevtx_decode_profile_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( entry->key ),
+		     key,
+		     sizeof( libevtx_decode_profile_key_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			goto on_error;
+		}
+		entry->hash = hash;
+
+		slot_index = (int) ( hash & (uint32_t) ( decode_profile->number_of_slots - 1 ) );
+
+		while( decode_profile->slots[ slot_index ] != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & ( decode_profile->number_of_slots - 1 );
+		}
+		decode_profile->slots[ slot_index ] = entry_index + 1;
+
+		decode_profile->number_of_entries += 1;
+	}
+	if( chunk_index >= decode_profile->number_of_allocated_chunks )
+	{
+		number_of_chunks = decode_profile->number_of_allocated_chunks;
+
+		if( number_of_chunks == 0 )
+		{
+			number_of_chunks = LIBEVTX_DECODE_PROFILE_INITIAL_NUMBER_OF_CHUNKS;
+		}
+		while( chunk_index >= number_of_chunks )
+		{
+			if( number_of_chunks > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of chunks value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_chunks *= 2;
+		}
+		if( (size_t) number_of_chunks > ( (size_t) SSIZE_MAX / ( sizeof( uint64_t ) * LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = memory_reallocate(
+		                decode_profile->chunk_values,
+		                sizeof( uint64_t ) * LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES * number_of_chunks );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize chunk values.",
+			 function );
+
+			goto on_error;
+		}
+		decode_profile->chunk_values               = (uint64_t *) reallocation;
+		decode_profile->number_of_allocated_chunks = number_of_chunks;
+	}
+	if( chunk_index >= decode_profile->number_of_chunks )
+	{
+		/* The chunks without decoded records have no values
+		 */
+		if( memory_set(
+		     &( decode_profile->chunk_values[ decode_profile->number_of_chunks * LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ] ),
+		     0,
+		     sizeof( uint64_t ) * LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES * ( chunk_index + 1 - decode_profile->number_of_chunks ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk values.",
+			 function );
+
+			goto on_error;
+		}
+		decode_profile->number_of_chunks = chunk_index + 1;
+	}
+	if( chunk_index >= 0 )
+	{
+		chunk_values = &( decode_profile->chunk_values[ chunk_index * LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ] );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		entry->values[ value_index ] += values[ value_index ];
+
+		if( chunk_values != NULL )
+		{
+			chunk_values[ value_index ] += values[ value_index ];
+		}
+	}
+	decode_profile->is_sorted = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 decode_profile->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Compares two decode profile entries by their decode cost in descending order
+ * The decode cost is the sum of the decode and parse time, entries with the same
+ * decode cost are ordered by their number of bytes in descending order
+ * Returns -1 if the first entry sorts before the second, 1 if after or 0 if equal
+ */
+static int libevtx_decode_profile_compare_entries(
+            const void *first_entry,
+            const void *second_entry )
+{
+	const libevtx_decode_profile_entry_t *first_decode_profile_entry  = (const libevtx_decode_profile_entry_t *) first_entry;
+	const libevtx_decode_profile_entry_t *second_decode_profile_entry = (const libevtx_decode_profile_entry_t *) second_entry;
+	uint64_t first_decode_cost                                        = 0;
+	uint64_t second_decode_cost                                       = 0;
+
+	first_decode_cost = first_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]
+	                  + first_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ];
+
+	second_decode_cost = second_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]
+	                   + second_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ];
+
+	if( first_decode_cost > second_decode_cost )
+	{
+		return( -1 );
+	}
+	if( first_decode_cost < second_decode_cost )
+	{
+		return( 1 );
+	}
+	if( first_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ] > second_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ] )
+	{
+		return( -1 );
+	}
+	if( first_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ] < second_decode_profile_entry->values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ] )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_get_number_of_entries(
+     libevtx_decode_profile_t *decode_profile,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decode_profile_get_number_of_entries";
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_entries = decode_profile->number_of_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * The entries are ranked by their decode cost, where entry 0 is the most costly
+ * The values are stored in the order of the LIBEVTX_DECODE_PROFILE_VALUES definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_get_entry_by_index(
+     libevtx_decode_profile_t *decode_profile,
+     int entry_index,
+     libevtx_decode_profile_key_t *key,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libevtx_decode_profile_entry_t *entry = NULL;
+	static char *function                 = "libevtx_decode_profile_get_entry_by_index";
+	int value_index                       = 0;
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( entry_index < 0 )
+	 || ( entry_index >= decode_profile->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The entries are sorted on demand, after which the slots are rebuilt
+	 * since these reference the entries by index
+	 */
+	if( decode_profile->is_sorted == 0 )
+	{
+		if( decode_profile->number_of_entries > 1 )
+		{
+			qsort(
+			 decode_profile->entries,
+			 (size_t) decode_profile->number_of_entries,
+			 sizeof( libevtx_decode_profile_entry_t ),
+			 &libevtx_decode_profile_compare_entries );
+
+			if( libevtx_decode_profile_resize_slots(
+			     decode_profile,
+			     decode_profile->number_of_slots,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to rebuild slots.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		decode_profile->is_sorted = 1;
+	}
+	entry = &( decode_profile->entries[ entry_index ] );
+
+	if( memory_copy(
+	     key,
+	     &( entry->key ),
+	     sizeof( libevtx_decode_profile_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( value_index >= LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES )
+		{
+			break;
+		}
+		values[ value_index ] = entry->values[ value_index ];
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 decode_profile->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of chunks
+ * This is the index of the last chunk that contains a decoded record + 1
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_get_number_of_chunks(
+     libevtx_decode_profile_t *decode_profile,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decode_profile_get_number_of_chunks";
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_chunks = decode_profile->number_of_chunks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the values of a specific chunk
+ * The values are stored in the order of the LIBEVTX_DECODE_PROFILE_VALUES definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decode_profile_get_chunk_values(
+     libevtx_decode_profile_t *decode_profile,
+     int chunk_index,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decode_profile_get_chunk_values";
+	int result            = 1;
+	int value_index       = 0;
+
+	if( decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( chunk_index < 0 )
+	 || ( chunk_index >= decode_profile->number_of_chunks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			if( value_index >= LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES )
+			{
+				break;
+			}
+			values[ value_index ] = decode_profile->chunk_values[ ( chunk_index * LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ) + value_index ];
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decode_profile->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,180 @@
+/*
+ * Decode profile functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_DECODE_PROFILE_H )
+#define _LIBEVTX_DECODE_PROFILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_decode_profile_key libevtx_decode_profile_key_t;
+
+struct libevtx_decode_profile_key
+{
+	/* The provider identifier
+	 * Contains a little-endian GUID or 0-byte values if not available
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The template identifier
+	 * Contains a little-endian GUID or 0-byte values if the record
+	 * does not start with a template instance
+	 */
+	uint8_t template_identifier[ 16 ];
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+};
+
+typedef struct libevtx_decode_profile_entry libevtx_decode_profile_entry_t;
+
+struct libevtx_decode_profile_entry
+{
+	/* The key
+	 */
+	libevtx_decode_profile_key_t key;
+
+	/* The hash of the key
+	 */
+	uint32_t hash;
+
+	/* The values
+	 * Stored in the order of the LIBEVTX_DECODE_PROFILE_VALUES definitions
+	 */
+	uint64_t values[ LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ];
+};
+
+typedef struct libevtx_decode_profile libevtx_decode_profile_t;
+
+struct libevtx_decode_profile
+{
+	/* The entries
+	 */
+	libevtx_decode_profile_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The slots
+	 * An open addressing hash table that contains the entry index + 1
+	 * of a key or 0 if the slot is unused
+	 */
+	int *slots;
+
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* Value to indicate the entries are sorted by their decode cost
+	 */
+	uint8_t is_sorted;
+
+	/* The chunk values
+	 * Contains LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES values per chunk
+	 */
+	uint64_t *chunk_values;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The number of allocated chunks
+	 */
+	int number_of_allocated_chunks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * Records of the same file can be decoded from different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevtx_decode_profile_initialize(
+     libevtx_decode_profile_t **decode_profile,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_free(
+     libevtx_decode_profile_t **decode_profile,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_empty(
+     libevtx_decode_profile_t *decode_profile,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_resize_slots(
+     libevtx_decode_profile_t *decode_profile,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_add_values(
+     libevtx_decode_profile_t *decode_profile,
+     const libevtx_decode_profile_key_t *key,
+     int chunk_index,
+     const uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_get_number_of_entries(
+     libevtx_decode_profile_t *decode_profile,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_get_entry_by_index(
+     libevtx_decode_profile_t *decode_profile,
+     int entry_index,
+     libevtx_decode_profile_key_t *key,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_get_number_of_chunks(
+     libevtx_decode_profile_t *decode_profile,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+int libevtx_decode_profile_get_chunk_values(
+     libevtx_decode_profile_t *decode_profile,
+     int chunk_index,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_DECODE_PROFILE_H ) */
+
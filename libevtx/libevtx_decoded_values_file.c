@@ -0,0 +1,1736 @@
+/*
+ * Decoded values file functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_checksum.h"
+#include "libevtx_decoded_values_file.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_query_index.h"
+#include "libevtx_system_values.h"
+
+#include "evtx_decoded_values_file.h"
+
+const uint8_t *evtx_decoded_values_file_signature = (uint8_t *) "EvtxDec";
+
+/* Creates a decoded values file
+ * Make sure the value decoded_values_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decoded_values_file_initialize(
+     libevtx_decoded_values_file_t **decoded_values_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decoded_values_file_initialize";
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoded_values_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoded values file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decoded_values_file = memory_allocate_structure(
+	                        libevtx_decoded_values_file_t );
+
+	if( *decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decoded_values_file,
+	     0,
+	     sizeof( libevtx_decoded_values_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decoded_values_file != NULL )
+	{
+		memory_free(
+		 *decoded_values_file );
+
+		*decoded_values_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoded values file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decoded_values_file_free(
+     libevtx_decoded_values_file_t **decoded_values_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_decoded_values_file_free";
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoded_values_file != NULL )
+	{
+		if( ( *decoded_values_file )->write_string_slots != NULL )
+		{
+			memory_free(
+			 ( *decoded_values_file )->write_string_slots );
+		}
+		if( ( *decoded_values_file )->write_strings_data != NULL )
+		{
+			memory_free(
+			 ( *decoded_values_file )->write_strings_data );
+		}
+		if( ( *decoded_values_file )->write_string_entries_data != NULL )
+		{
+			memory_free(
+			 ( *decoded_values_file )->write_string_entries_data );
+		}
+		if( ( *decoded_values_file )->write_record_entries_data != NULL )
+		{
+			memory_free(
+			 ( *decoded_values_file )->write_record_entries_data );
+		}
+		if( ( *decoded_values_file )->data != NULL )
+		{
+			memory_free(
+			 ( *decoded_values_file )->data );
+		}
+		memory_free(
+		 *decoded_values_file );
+
+		*decoded_values_file = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a decoded values file
+ * The decoded values file is only used if it was created for the same file, which is determined
+ * by the file size, the calculated file header checksum and, if available, the modification time
+ * Returns 1 if successful, 0 if the decoded values file does not exist or cannot be used or -1 on error
+ */
+int libevtx_decoded_values_file_read(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     libbfio_handle_t *decoded_values_file_io_handle,
+     uint32_t file_header_checksum,
+     int64_t modification_time,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data                     = NULL;
+	static char *function             = "libevtx_decoded_values_file_read";
+	size64_t decoded_values_file_size = 0;
+	ssize_t read_count                = 0;
+	int decoded_values_file_is_open   = 0;
+	int result                        = 0;
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_values_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoded values file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_values_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          decoded_values_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if decoded values file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     decoded_values_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	decoded_values_file_is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     decoded_values_file_io_handle,
+	     &decoded_values_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoded values file size.",
+		 function );
+
+		goto on_error;
+	}
+	result = 0;
+
+	if( ( decoded_values_file_size >= sizeof( evtx_decoded_values_file_header_t ) )
+	 && ( decoded_values_file_size <= (size64_t) SSIZE_MAX ) )
+	{
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * (size_t) decoded_values_file_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create decoded values file data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              decoded_values_file_io_handle,
+		              data,
+		              (size_t) decoded_values_file_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) decoded_values_file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read decoded values file data.",
+			 function );
+
+			goto on_error;
+		}
+		result = libevtx_decoded_values_file_read_data(
+		          decoded_values_file,
+		          data,
+		          (size_t) decoded_values_file_size,
+		          file_header_checksum,
+		          modification_time,
+		          file_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read decoded values file data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* The entries reference the data hence it is retained
+			 */
+			decoded_values_file->data = data;
+		}
+		else
+		{
+			memory_free(
+			 data );
+		}
+		data = NULL;
+	}
+	decoded_values_file_is_open = 0;
+
+	if( libbfio_handle_close(
+	     decoded_values_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( decoded_values_file_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 decoded_values_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the decoded values file data
+ * The entries are read in place and reference the data hence the data
+ * must remain valid while the decoded values file is used
+ * Returns 1 if successful, 0 if the decoded values file data cannot be used or -1 on error
+ */
+int libevtx_decoded_values_file_read_data(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t file_header_checksum,
+     int64_t modification_time,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data            = NULL;
+	static char *function                = "libevtx_decoded_values_file_read_data";
+	size64_t stored_file_size            = 0;
+	size_t entries_data_size             = 0;
+	uint64_t previous_file_offset        = 0;
+	uint64_t record_file_offset          = 0;
+	uint64_t stored_modification_time    = 0;
+	uint32_t calculated_checksum         = 0;
+	uint32_t channel_name_index          = 0;
+	uint32_t computer_name_index         = 0;
+	uint32_t entry_index                 = 0;
+	uint32_t format_version              = 0;
+	uint32_t number_of_record_entries    = 0;
+	uint32_t number_of_string_entries    = 0;
+	uint32_t stored_checksum             = 0;
+	uint32_t stored_file_header_checksum = 0;
+	uint32_t string_data_offset          = 0;
+	uint32_t string_data_size            = 0;
+	uint32_t strings_data_size           = 0;
+	uint8_t flags                        = 0;
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( evtx_decoded_values_file_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (evtx_decoded_values_file_header_t *) data )->signature,
+	     evtx_decoded_values_file_signature,
+	     8 ) != 0 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported decoded values file signature.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->checksum,
+	 stored_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) data,
+	     sizeof( evtx_decoded_values_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in decoded values file header CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->file_header_checksum,
+	 stored_file_header_checksum );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->file_size,
+	 stored_file_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->modification_time,
+	 stored_modification_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->number_of_record_entries,
+	 number_of_record_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->number_of_string_entries,
+	 number_of_string_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->strings_data_size,
+	 strings_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->entries_checksum,
+	 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: file header checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_file_header_checksum );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 stored_file_size );
+
+		libcnotify_printf(
+		 "%s: number of record entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_record_entries );
+
+		libcnotify_printf(
+		 "%s: number of string entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_string_entries );
+
+		libcnotify_printf(
+		 "%s: strings data size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 strings_data_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( format_version != LIBEVTX_DECODED_VALUES_FILE_FORMAT_VERSION )
+	{
+		return( 0 );
+	}
+	/* The decoded values file is considered stale if the file has changed since it was written
+	 */
+	if( ( stored_file_size != file_size )
+	 || ( stored_file_header_checksum != file_header_checksum )
+	 || ( ( stored_modification_time != 0 )
+	  &&  ( modification_time != 0 )
+	  &&  ( (int64_t) stored_modification_time != modification_time ) ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: decoded values file was created for another file or the file has changed.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	if( ( (size_t) number_of_record_entries > ( (size_t) SSIZE_MAX / sizeof( evtx_decoded_values_file_record_entry_t ) ) )
+	 || ( (size_t) number_of_string_entries > ( (size_t) SSIZE_MAX / sizeof( evtx_decoded_values_file_string_entry_t ) ) ) )
+	{
+		return( 0 );
+	}
+	entries_data_size = data_size - sizeof( evtx_decoded_values_file_header_t );
+
+	if( ( (size_t) number_of_record_entries * sizeof( evtx_decoded_values_file_record_entry_t ) ) > entries_data_size )
+	{
+		return( 0 );
+	}
+	entries_data_size -= (size_t) number_of_record_entries * sizeof( evtx_decoded_values_file_record_entry_t );
+
+	if( ( (size_t) number_of_string_entries * sizeof( evtx_decoded_values_file_string_entry_t ) ) > entries_data_size )
+	{
+		return( 0 );
+	}
+	entries_data_size -= (size_t) number_of_string_entries * sizeof( evtx_decoded_values_file_string_entry_t );
+
+	if( entries_data_size != (size_t) strings_data_size )
+	{
+		return( 0 );
+	}
+	entry_data = &( data[ sizeof( evtx_decoded_values_file_header_t ) ] );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) entry_data,
+	     data_size - sizeof( evtx_decoded_values_file_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in decoded values file entries CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	/* The entries are validated once so that they can be used in place
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_string_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_decoded_values_file_string_entry_t *) &( entry_data[ ( (size_t) number_of_record_entries * sizeof( evtx_decoded_values_file_record_entry_t ) ) + ( (size_t) entry_index * sizeof( evtx_decoded_values_file_string_entry_t ) ) ] ) )->data_offset,
+		 string_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_decoded_values_file_string_entry_t *) &( entry_data[ ( (size_t) number_of_record_entries * sizeof( evtx_decoded_values_file_record_entry_t ) ) + ( (size_t) entry_index * sizeof( evtx_decoded_values_file_string_entry_t ) ) ] ) )->data_size,
+		 string_data_size );
+
+		if( ( ( string_data_size % 2 ) != 0 )
+		 || ( string_data_offset > strings_data_size )
+		 || ( string_data_size > ( strings_data_size - string_data_offset ) ) )
+		{
+			return( 0 );
+		}
+	}
+	/* The record entries are stored in ascending record file offset order
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_record_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_decoded_values_file_record_entry_t *) &( entry_data[ (size_t) entry_index * sizeof( evtx_decoded_values_file_record_entry_t ) ] ) )->file_offset,
+		 record_file_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_decoded_values_file_record_entry_t *) &( entry_data[ (size_t) entry_index * sizeof( evtx_decoded_values_file_record_entry_t ) ] ) )->channel_name_index,
+		 channel_name_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_decoded_values_file_record_entry_t *) &( entry_data[ (size_t) entry_index * sizeof( evtx_decoded_values_file_record_entry_t ) ] ) )->computer_name_index,
+		 computer_name_index );
+
+		flags = ( (evtx_decoded_values_file_record_entry_t *) &( entry_data[ (size_t) entry_index * sizeof( evtx_decoded_values_file_record_entry_t ) ] ) )->flags;
+
+		if( ( record_file_offset > (uint64_t) INT64_MAX )
+		 || ( ( entry_index > 0 )
+		  &&  ( record_file_offset <= previous_file_offset ) ) )
+		{
+			return( 0 );
+		}
+		if( ( ( ( flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME ) != 0 )
+		  &&  ( channel_name_index >= number_of_string_entries ) )
+		 || ( ( ( flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 )
+		  &&  ( computer_name_index >= number_of_string_entries ) ) )
+		{
+			return( 0 );
+		}
+		previous_file_offset = record_file_offset;
+	}
+	decoded_values_file->record_entries_data      = entry_data;
+	decoded_values_file->number_of_record_entries = number_of_record_entries;
+
+	entry_data += (size_t) number_of_record_entries * sizeof( evtx_decoded_values_file_record_entry_t );
+
+	decoded_values_file->string_entries_data      = entry_data;
+	decoded_values_file->number_of_string_entries = number_of_string_entries;
+
+	entry_data += (size_t) number_of_string_entries * sizeof( evtx_decoded_values_file_string_entry_t );
+
+	decoded_values_file->strings_data      = entry_data;
+	decoded_values_file->strings_data_size = strings_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the System values of a specific record
+ * The record entries are searched by record file offset
+ * The channel and computer name of the System values reference the decoded values file data
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libevtx_decoded_values_file_get_system_values_by_offset(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     off64_t record_offset,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error )
+{
+	const evtx_decoded_values_file_record_entry_t *record_entry = NULL;
+	const evtx_decoded_values_file_string_entry_t *string_entry = NULL;
+	static char *function                                        = "libevtx_decoded_values_file_get_system_values_by_offset";
+	uint64_t record_file_offset                                  = 0;
+	uint32_t lower_entry_index                                   = 0;
+	uint32_t middle_entry_index                                  = 0;
+	uint32_t string_data_offset                                  = 0;
+	uint32_t string_data_size                                    = 0;
+	uint32_t string_entry_index                                  = 0;
+	uint32_t upper_entry_index                                   = 0;
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid System values.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_values_file->record_entries_data == NULL )
+	{
+		return( 0 );
+	}
+	upper_entry_index = decoded_values_file->number_of_record_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		record_entry = (const evtx_decoded_values_file_record_entry_t *) &( decoded_values_file->record_entries_data[ (size_t) middle_entry_index * sizeof( evtx_decoded_values_file_record_entry_t ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 record_entry->file_offset,
+		 record_file_offset );
+
+		if( record_file_offset == (uint64_t) record_offset )
+		{
+			break;
+		}
+		else if( record_file_offset < (uint64_t) record_offset )
+		{
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+		}
+	}
+	if( lower_entry_index >= upper_entry_index )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     system_values,
+	     0,
+	     sizeof( libevtx_system_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear System values.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 record_entry->event_identifier,
+	 system_values->event_identifier );
+
+	system_values->event_level = record_entry->event_level;
+	system_values->flags       = record_entry->flags;
+
+	if( memory_copy(
+	     system_values->provider_identifier,
+	     record_entry->provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	/* The string entry indexes were validated when the data was read
+	 */
+	if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 record_entry->channel_name_index,
+		 string_entry_index );
+
+		string_entry = (const evtx_decoded_values_file_string_entry_t *) &( decoded_values_file->string_entries_data[ (size_t) string_entry_index * sizeof( evtx_decoded_values_file_string_entry_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 string_entry->data_offset,
+		 string_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 string_entry->data_size,
+		 string_data_size );
+
+		system_values->channel_name      = &( decoded_values_file->strings_data[ string_data_offset ] );
+		system_values->channel_name_size = (size_t) string_data_size;
+	}
+	if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 record_entry->computer_name_index,
+		 string_entry_index );
+
+		string_entry = (const evtx_decoded_values_file_string_entry_t *) &( decoded_values_file->string_entries_data[ (size_t) string_entry_index * sizeof( evtx_decoded_values_file_string_entry_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 string_entry->data_offset,
+		 string_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 string_entry->data_size,
+		 string_data_size );
+
+		system_values->computer_name      = &( decoded_values_file->strings_data[ string_data_offset ] );
+		system_values->computer_name_size = (size_t) string_data_size;
+	}
+	return( 1 );
+}
+
+/* Appends a string that is written
+ * Strings are stored once, a string that was appended before returns its existing string entry index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decoded_values_file_append_string(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *string_entry_index,
+     libcerror_error_t **error )
+{
+	uint8_t *string_entry          = NULL;
+	uint32_t *string_slots         = NULL;
+	void *reallocation             = NULL;
+	static char *function          = "libevtx_decoded_values_file_append_string";
+	size_t allocated_size          = 0;
+	uint32_t entry_index           = 0;
+	uint32_t hash                  = 0;
+	uint32_t number_of_slots       = 0;
+	uint32_t slot_index            = 0;
+	uint32_t stored_data_offset    = 0;
+	uint32_t stored_data_size      = 0;
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream == NULL )
+	 && ( utf16_stream_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) ( UINT32_MAX - decoded_values_file->strings_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string entry index.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libevtx_query_index_hash_data(
+	        utf16_stream,
+	        utf16_stream_size );
+
+	if( decoded_values_file->write_number_of_string_slots > 0 )
+	{
+		slot_index = hash & ( decoded_values_file->write_number_of_string_slots - 1 );
+
+		while( decoded_values_file->write_string_slots[ slot_index ] != 0 )
+		{
+			entry_index  = decoded_values_file->write_string_slots[ slot_index ] - 1;
+			string_entry = &( decoded_values_file->write_string_entries_data[ (size_t) entry_index * sizeof( evtx_decoded_values_file_string_entry_t ) ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (evtx_decoded_values_file_string_entry_t *) string_entry )->data_offset,
+			 stored_data_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (evtx_decoded_values_file_string_entry_t *) string_entry )->data_size,
+			 stored_data_size );
+
+			if( ( (size_t) stored_data_size == utf16_stream_size )
+			 && ( ( utf16_stream_size == 0 )
+			  ||  ( memory_compare(
+			         &( decoded_values_file->write_strings_data[ stored_data_offset ] ),
+			         utf16_stream,
+			         utf16_stream_size ) == 0 ) ) )
+			{
+				*string_entry_index = entry_index;
+
+				return( 1 );
+			}
+			slot_index = ( slot_index + 1 ) & ( decoded_values_file->write_number_of_string_slots - 1 );
+		}
+	}
+	/* The slots are kept at most half full
+	 */
+	entry_index = decoded_values_file->number_of_string_entries;
+
+	if( ( (uint64_t) entry_index + 1 ) * 2 > (uint64_t) decoded_values_file->write_number_of_string_slots )
+	{
+		if( decoded_values_file->write_number_of_string_slots > ( UINT32_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of string slots value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_slots = decoded_values_file->write_number_of_string_slots * 2;
+
+		if( number_of_slots == 0 )
+		{
+			number_of_slots = LIBEVTX_DECODED_VALUES_FILE_INITIAL_NUMBER_OF_STRING_SLOTS;
+		}
+		if( (size_t) number_of_slots > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of string slots value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		string_slots = (uint32_t *) memory_allocate(
+		                             sizeof( uint32_t ) * number_of_slots );
+
+		if( string_slots == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string slots.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     string_slots,
+		     0,
+		     sizeof( uint32_t ) * number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear string slots.",
+			 function );
+
+			memory_free(
+			 string_slots );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < decoded_values_file->number_of_string_entries;
+		     entry_index++ )
+		{
+			string_entry = &( decoded_values_file->write_string_entries_data[ (size_t) entry_index * sizeof( evtx_decoded_values_file_string_entry_t ) ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (evtx_decoded_values_file_string_entry_t *) string_entry )->data_offset,
+			 stored_data_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (evtx_decoded_values_file_string_entry_t *) string_entry )->data_size,
+			 stored_data_size );
+
+			slot_index = libevtx_query_index_hash_data(
+			              &( decoded_values_file->write_strings_data[ stored_data_offset ] ),
+			              (size_t) stored_data_size ) & ( number_of_slots - 1 );
+
+			while( string_slots[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+			}
+			string_slots[ slot_index ] = entry_index + 1;
+		}
+		if( decoded_values_file->write_string_slots != NULL )
+		{
+			memory_free(
+			 decoded_values_file->write_string_slots );
+		}
+		decoded_values_file->write_string_slots           = string_slots;
+		decoded_values_file->write_number_of_string_slots = number_of_slots;
+
+		entry_index = decoded_values_file->number_of_string_entries;
+	}
+	if( entry_index >= decoded_values_file->write_allocated_number_of_string_entries )
+	{
+		allocated_size = (size_t) decoded_values_file->write_number_of_string_slots / 2;
+
+		if( allocated_size > ( (size_t) SSIZE_MAX / sizeof( evtx_decoded_values_file_string_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of string entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                decoded_values_file->write_string_entries_data,
+		                sizeof( evtx_decoded_values_file_string_entry_t ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string entries data.",
+			 function );
+
+			return( -1 );
+		}
+		decoded_values_file->write_string_entries_data                = (uint8_t *) reallocation;
+		decoded_values_file->write_allocated_number_of_string_entries = (uint32_t) allocated_size;
+	}
+	if( utf16_stream_size > (size_t) ( decoded_values_file->write_allocated_strings_data_size - decoded_values_file->strings_data_size ) )
+	{
+		allocated_size = ( (size_t) decoded_values_file->strings_data_size + utf16_stream_size ) * 2;
+
+		if( allocated_size < 1024 )
+		{
+			allocated_size = 1024;
+		}
+		if( allocated_size > (size_t) UINT32_MAX )
+		{
+			allocated_size = (size_t) UINT32_MAX;
+		}
+		reallocation = memory_reallocate(
+		                decoded_values_file->write_strings_data,
+		                sizeof( uint8_t ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize strings data.",
+			 function );
+
+			return( -1 );
+		}
+		decoded_values_file->write_strings_data                = (uint8_t *) reallocation;
+		decoded_values_file->write_allocated_strings_data_size = (uint32_t) allocated_size;
+	}
+	if( utf16_stream_size > 0 )
+	{
+		if( memory_copy(
+		     &( decoded_values_file->write_strings_data[ decoded_values_file->strings_data_size ] ),
+		     utf16_stream,
+		     utf16_stream_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	string_entry = &( decoded_values_file->write_string_entries_data[ (size_t) entry_index * sizeof( evtx_decoded_values_file_string_entry_t ) ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_string_entry_t *) string_entry )->data_offset,
+	 decoded_values_file->strings_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_string_entry_t *) string_entry )->data_size,
+	 (uint32_t) utf16_stream_size );
+
+	slot_index = hash & ( decoded_values_file->write_number_of_string_slots - 1 );
+
+	while( decoded_values_file->write_string_slots[ slot_index ] != 0 )
+	{
+		slot_index = ( slot_index + 1 ) & ( decoded_values_file->write_number_of_string_slots - 1 );
+	}
+	decoded_values_file->write_string_slots[ slot_index ] = entry_index + 1;
+
+	decoded_values_file->strings_data_size        += (uint32_t) utf16_stream_size;
+	decoded_values_file->number_of_string_entries += 1;
+
+	*string_entry_index = entry_index;
+
+	return( 1 );
+}
+
+/* Appends the System values of a record that is written
+ * The records must be appended in ascending record file offset order
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decoded_values_file_append_system_values(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     off64_t record_offset,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error )
+{
+	uint8_t *record_entry          = NULL;
+	void *reallocation             = NULL;
+	static char *function          = "libevtx_decoded_values_file_append_system_values";
+	size_t allocated_size          = 0;
+	uint64_t previous_file_offset  = 0;
+	uint32_t channel_name_index    = 0;
+	uint32_t computer_name_index   = 0;
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_values_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoded values file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid System values.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_values_file->number_of_record_entries > 0 )
+	{
+		record_entry = &( decoded_values_file->write_record_entries_data[ (size_t) ( decoded_values_file->number_of_record_entries - 1 ) * sizeof( evtx_decoded_values_file_record_entry_t ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_decoded_values_file_record_entry_t *) record_entry )->file_offset,
+		 previous_file_offset );
+
+		if( (uint64_t) record_offset <= previous_file_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( decoded_values_file->number_of_record_entries == UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of record entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME ) != 0 )
+	{
+		if( libevtx_decoded_values_file_append_string(
+		     decoded_values_file,
+		     system_values->channel_name,
+		     system_values->channel_name_size,
+		     &channel_name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append channel name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 )
+	{
+		if( libevtx_decoded_values_file_append_string(
+		     decoded_values_file,
+		     system_values->computer_name,
+		     system_values->computer_name_size,
+		     &computer_name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append computer name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( decoded_values_file->number_of_record_entries >= decoded_values_file->write_allocated_number_of_record_entries )
+	{
+		allocated_size = (size_t) decoded_values_file->write_allocated_number_of_record_entries * 2;
+
+		if( allocated_size < 1024 )
+		{
+			allocated_size = 1024;
+		}
+		if( allocated_size > (size_t) UINT32_MAX )
+		{
+			allocated_size = (size_t) UINT32_MAX;
+		}
+		if( allocated_size > ( (size_t) SSIZE_MAX / sizeof( evtx_decoded_values_file_record_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of record entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                decoded_values_file->write_record_entries_data,
+		                sizeof( evtx_decoded_values_file_record_entry_t ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record entries data.",
+			 function );
+
+			return( -1 );
+		}
+		decoded_values_file->write_record_entries_data                = (uint8_t *) reallocation;
+		decoded_values_file->write_allocated_number_of_record_entries = (uint32_t) allocated_size;
+	}
+	record_entry = &( decoded_values_file->write_record_entries_data[ (size_t) decoded_values_file->number_of_record_entries * sizeof( evtx_decoded_values_file_record_entry_t ) ] );
+
+	if( memory_set(
+	     record_entry,
+	     0,
+	     sizeof( evtx_decoded_values_file_record_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record entry.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_decoded_values_file_record_entry_t *) record_entry )->file_offset,
+	 (uint64_t) record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_record_entry_t *) record_entry )->event_identifier,
+	 system_values->event_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_record_entry_t *) record_entry )->channel_name_index,
+	 channel_name_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_record_entry_t *) record_entry )->computer_name_index,
+	 computer_name_index );
+
+	( (evtx_decoded_values_file_record_entry_t *) record_entry )->event_level = system_values->event_level;
+	/* The keywords are not stored in the decoded values file
+	 */
+	( (evtx_decoded_values_file_record_entry_t *) record_entry )->flags       = system_values->flags & ~( LIBEVTX_SYSTEM_VALUES_FLAG_HAS_KEYWORDS );
+
+	if( memory_copy(
+	     ( (evtx_decoded_values_file_record_entry_t *) record_entry )->provider_identifier,
+	     system_values->provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	decoded_values_file->number_of_record_entries += 1;
+
+	return( 1 );
+}
+
+/* Writes a decoded values file
+ * The appended entries are assembled into the decoded values file data before
+ * they are written, hence the entries can be retrieved even if writing fails
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_decoded_values_file_write(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     libbfio_handle_t *decoded_values_file_io_handle,
+     uint32_t file_header_checksum,
+     int64_t modification_time,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data                   = NULL;
+	static char *function           = "libevtx_decoded_values_file_write";
+	size_t data_offset              = 0;
+	size_t data_size                = 0;
+	size_t record_entries_data_size = 0;
+	size_t string_entries_data_size = 0;
+	ssize_t write_count             = 0;
+	uint32_t checksum               = 0;
+	int decoded_values_file_is_open = 0;
+
+	if( decoded_values_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_values_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoded values file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_values_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded values file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	record_entries_data_size = (size_t) decoded_values_file->number_of_record_entries * sizeof( evtx_decoded_values_file_record_entry_t );
+	string_entries_data_size = (size_t) decoded_values_file->number_of_string_entries * sizeof( evtx_decoded_values_file_string_entry_t );
+
+	data_size = sizeof( evtx_decoded_values_file_header_t )
+	          + record_entries_data_size
+	          + string_entries_data_size
+	          + (size_t) decoded_values_file->strings_data_size;
+
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid decoded values file data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoded values file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     sizeof( evtx_decoded_values_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoded values file header.",
+		 function );
+
+		memory_free(
+		 data );
+
+		return( -1 );
+	}
+	data_offset = sizeof( evtx_decoded_values_file_header_t );
+
+	if( record_entries_data_size > 0 )
+	{
+		memory_copy(
+		 &( data[ data_offset ] ),
+		 decoded_values_file->write_record_entries_data,
+		 record_entries_data_size );
+	}
+	data_offset += record_entries_data_size;
+
+	if( string_entries_data_size > 0 )
+	{
+		memory_copy(
+		 &( data[ data_offset ] ),
+		 decoded_values_file->write_string_entries_data,
+		 string_entries_data_size );
+	}
+	data_offset += string_entries_data_size;
+
+	if( decoded_values_file->strings_data_size > 0 )
+	{
+		memory_copy(
+		 &( data[ data_offset ] ),
+		 decoded_values_file->write_strings_data,
+		 (size_t) decoded_values_file->strings_data_size );
+	}
+	memory_copy(
+	 ( (evtx_decoded_values_file_header_t *) data )->signature,
+	 evtx_decoded_values_file_signature,
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->format_version,
+	 LIBEVTX_DECODED_VALUES_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->file_header_checksum,
+	 file_header_checksum );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->file_size,
+	 (uint64_t) file_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->modification_time,
+	 (uint64_t) modification_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->number_of_record_entries,
+	 decoded_values_file->number_of_record_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->number_of_string_entries,
+	 decoded_values_file->number_of_string_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->strings_data_size,
+	 decoded_values_file->strings_data_size );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &checksum,
+	     &( data[ sizeof( evtx_decoded_values_file_header_t ) ] ),
+	     data_size - sizeof( evtx_decoded_values_file_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		memory_free(
+		 data );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->entries_checksum,
+	 checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &checksum,
+	     data,
+	     sizeof( evtx_decoded_values_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		memory_free(
+		 data );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_decoded_values_file_header_t *) data )->checksum,
+	 checksum );
+
+	/* The entries now reference the assembled data and the write buffers are no longer needed
+	 */
+	decoded_values_file->data = data;
+
+	data_offset = sizeof( evtx_decoded_values_file_header_t );
+
+	decoded_values_file->record_entries_data = &( data[ data_offset ] );
+
+	data_offset += record_entries_data_size;
+
+	decoded_values_file->string_entries_data = &( data[ data_offset ] );
+
+	data_offset += string_entries_data_size;
+
+	decoded_values_file->strings_data = &( data[ data_offset ] );
+
+	if( decoded_values_file->write_string_slots != NULL )
+	{
+		memory_free(
+		 decoded_values_file->write_string_slots );
+
+		decoded_values_file->write_string_slots = NULL;
+	}
+	decoded_values_file->write_number_of_string_slots = 0;
+
+	if( decoded_values_file->write_strings_data != NULL )
+	{
+		memory_free(
+		 decoded_values_file->write_strings_data );
+
+		decoded_values_file->write_strings_data = NULL;
+	}
+	decoded_values_file->write_allocated_strings_data_size = 0;
+
+	if( decoded_values_file->write_string_entries_data != NULL )
+	{
+		memory_free(
+		 decoded_values_file->write_string_entries_data );
+
+		decoded_values_file->write_string_entries_data = NULL;
+	}
+	decoded_values_file->write_allocated_number_of_string_entries = 0;
+
+	if( decoded_values_file->write_record_entries_data != NULL )
+	{
+		memory_free(
+		 decoded_values_file->write_record_entries_data );
+
+		decoded_values_file->write_record_entries_data = NULL;
+	}
+	decoded_values_file->write_allocated_number_of_record_entries = 0;
+
+	if( libbfio_handle_open(
+	     decoded_values_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	decoded_values_file_is_open = 1;
+
+	write_count = libbfio_handle_write_buffer(
+	               decoded_values_file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write decoded values file data.",
+		 function );
+
+		goto on_error;
+	}
+	decoded_values_file_is_open = 0;
+
+	if( libbfio_handle_close(
+	     decoded_values_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( decoded_values_file_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 decoded_values_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,164 @@
+/*
+ * Decoded values file functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_DECODED_VALUES_FILE_H )
+#define _LIBEVTX_DECODED_VALUES_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_system_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_decoded_values_file libevtx_decoded_values_file_t;
+
+struct libevtx_decoded_values_file
+{
+	/* The data
+	 * Contains the header, the record entries, the string entries and the strings data
+	 * Contains NULL if the data is not managed by the decoded values file
+	 */
+	uint8_t *data;
+
+	/* The record entries data
+	 * The record entries are sorted by record file offset and reference the data
+	 */
+	const uint8_t *record_entries_data;
+
+	/* The number of record entries
+	 */
+	uint32_t number_of_record_entries;
+
+	/* The string entries data
+	 */
+	const uint8_t *string_entries_data;
+
+	/* The number of string entries
+	 */
+	uint32_t number_of_string_entries;
+
+	/* The strings data
+	 * Contains the UTF-16 little-endian strings without end of string character
+	 */
+	const uint8_t *strings_data;
+
+	/* The strings data size
+	 */
+	uint32_t strings_data_size;
+
+	/* The record entries data that is written
+	 */
+	uint8_t *write_record_entries_data;
+
+	/* The allocated number of record entries that are written
+	 */
+	uint32_t write_allocated_number_of_record_entries;
+
+	/* The string entries data that is written
+	 */
+	uint8_t *write_string_entries_data;
+
+	/* The allocated number of string entries that are written
+	 */
+	uint32_t write_allocated_number_of_string_entries;
+
+	/* The strings data that is written
+	 */
+	uint8_t *write_strings_data;
+
+	/* The allocated strings data size that is written
+	 */
+	uint32_t write_allocated_strings_data_size;
+
+	/* The string slots
+	 * An open addressing hash table that contains the string entry index + 1
+	 * of a string that is written or 0 if the slot is unused
+	 */
+	uint32_t *write_string_slots;
+
+	/* The number of string slots
+	 */
+	uint32_t write_number_of_string_slots;
+};
+
+int libevtx_decoded_values_file_initialize(
+     libevtx_decoded_values_file_t **decoded_values_file,
+     libcerror_error_t **error );
+
+int libevtx_decoded_values_file_free(
+     libevtx_decoded_values_file_t **decoded_values_file,
+     libcerror_error_t **error );
+
+int libevtx_decoded_values_file_read(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     libbfio_handle_t *decoded_values_file_io_handle,
+     uint32_t file_header_checksum,
+     int64_t modification_time,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_decoded_values_file_read_data(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t file_header_checksum,
+     int64_t modification_time,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_decoded_values_file_get_system_values_by_offset(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     off64_t record_offset,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error );
+
+int libevtx_decoded_values_file_append_string(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *string_entry_index,
+     libcerror_error_t **error );
+
+int libevtx_decoded_values_file_append_system_values(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     off64_t record_offset,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error );
+
+int libevtx_decoded_values_file_write(
+     libevtx_decoded_values_file_t *decoded_values_file,
+     libbfio_handle_t *decoded_values_file_io_handle,
+     uint32_t file_header_checksum,
+     int64_t modification_time,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_DECODED_VALUES_FILE_H ) */
+
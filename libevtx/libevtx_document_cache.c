@@ -0,0 +1,772 @@
+/*
+ * Decoded document cache functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_document_cache.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_record_values.h"
+
+/* Creates a document cache
+ * The document cache retains the record values, including their decoded XML document
+ * and parsed event data, that are released by the records cache up to the maximum size,
+ * the oldest record values are evicted first
+ * Make sure the value document_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_document_cache_initialize(
+     libevtx_document_cache_t **document_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libevtx_document_cache_initialize";
+	size64_t number_of_records  = 0;
+	int bucket_index            = 0;
+
+	if( document_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid document cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *document_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid document cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*document_cache = memory_allocate_structure(
+	                   libevtx_document_cache_t );
+
+	if( *document_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create document cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *document_cache,
+	     0,
+	     sizeof( libevtx_document_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear document cache.",
+		 function );
+
+		memory_free(
+		 *document_cache );
+
+		*document_cache = NULL;
+
+		return( -1 );
+	}
+	number_of_records = maximum_size / LIBEVTX_DOCUMENT_CACHE_AVERAGE_RECORD_SIZE;
+
+	( *document_cache )->number_of_buckets = LIBEVTX_CACHE_MINIMUM_NUMBER_OF_BUCKETS;
+
+	while( ( ( *document_cache )->number_of_buckets < LIBEVTX_CACHE_MAXIMUM_NUMBER_OF_BUCKETS )
+	    && ( (size64_t) ( *document_cache )->number_of_buckets < number_of_records ) )
+	{
+		( *document_cache )->number_of_buckets *= 2;
+	}
+	( *document_cache )->buckets = (int *) memory_allocate(
+	                                        sizeof( int ) * ( *document_cache )->number_of_buckets );
+
+	if( ( *document_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < ( *document_cache )->number_of_buckets;
+	     bucket_index++ )
+	{
+		( *document_cache )->buckets[ bucket_index ] = -1;
+	}
+	( *document_cache )->maximum_size       = maximum_size;
+	( *document_cache )->free_entry_index   = -1;
+	( *document_cache )->oldest_entry_index = -1;
+	( *document_cache )->newest_entry_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *document_cache != NULL )
+	{
+		memory_free(
+		 *document_cache );
+
+		*document_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a document cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_document_cache_free(
+     libevtx_document_cache_t **document_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_document_cache_free";
+	int result            = 1;
+
+	if( document_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid document cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *document_cache != NULL )
+	{
+		if( libevtx_document_cache_clear(
+		     *document_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear document cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *document_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *document_cache )->entries );
+		}
+		if( ( *document_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *document_cache )->buckets );
+		}
+		memory_free(
+		 *document_cache );
+
+		*document_cache = NULL;
+	}
+	return( result );
+}
+
+/* Clears a document cache
+ * Frees the record values of all the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_document_cache_clear(
+     libevtx_document_cache_t *document_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_document_cache_clear";
+	int result            = 1;
+
+	if( document_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid document cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( document_cache->oldest_entry_index != -1 )
+	{
+		if( libevtx_document_cache_remove_entry(
+		     document_cache,
+		     document_cache->oldest_entry_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 document_cache->oldest_entry_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Determines the hash bucket of a record offset
+ * Returns the bucket index
+ */
+int libevtx_document_cache_get_bucket_index(
+     libevtx_document_cache_t *document_cache,
+     off64_t offset )
+{
+	uint64_t hash = 0;
+
+	hash  = (uint64_t) offset;
+	hash *= 0x9e3779b97f4a7c15ULL;
+	hash ^= hash >> 32;
+
+	return( (int) ( hash & (uint64_t) ( document_cache->number_of_buckets - 1 ) ) );
+}
+
+/* Determines the size of record values in memory
+ * The size of the XML document is estimated by the size of the event record data
+ * as is done for the memory usage
+ * Returns the size of the record values
+ */
+size_t libevtx_document_cache_get_record_values_size(
+        libevtx_record_values_t *record_values )
+{
+	return( sizeof( libevtx_record_values_t ) + (size_t) record_values->data_size );
+}
+
+/* Finds the entry of a record offset
+ * Returns the entry index or -1 if not available
+ */
+int libevtx_document_cache_find_entry(
+     libevtx_document_cache_t *document_cache,
+     off64_t offset )
+{
+	int entry_index = 0;
+
+	entry_index = document_cache->buckets[ libevtx_document_cache_get_bucket_index(
+	                                        document_cache,
+	                                        offset ) ];
+
+	while( entry_index != -1 )
+	{
+		if( document_cache->entries[ entry_index ].offset == offset )
+		{
+			break;
+		}
+		entry_index = document_cache->entries[ entry_index ].next_entry_index;
+	}
+	return( entry_index );
+}
+
+/* Removes an entry
+ * If record values is not NULL the record values of the entry are passed to the caller,
+ * otherwise the record values of the entry are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_document_cache_remove_entry(
+     libevtx_document_cache_t *document_cache,
+     int entry_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_document_cache_entry_t *entry = NULL;
+	static char *function                 = "libevtx_document_cache_remove_entry";
+	int bucket_index                      = 0;
+	int previous_entry_index              = -1;
+	int search_entry_index                = 0;
+
+	if( document_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid document cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= document_cache->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( document_cache->entries[ entry_index ] );
+
+	if( entry->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entry: %d - missing record values.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	bucket_index = libevtx_document_cache_get_bucket_index(
+	                document_cache,
+	                entry->offset );
+
+	search_entry_index = document_cache->buckets[ bucket_index ];
+
+	while( ( search_entry_index != -1 )
+	    && ( search_entry_index != entry_index ) )
+	{
+		previous_entry_index = search_entry_index;
+		search_entry_index   = document_cache->entries[ search_entry_index ].next_entry_index;
+	}
+	if( search_entry_index != entry_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d in bucket: %d.",
+		 function,
+		 entry_index,
+		 bucket_index );
+
+		return( -1 );
+	}
+	if( previous_entry_index == -1 )
+	{
+		document_cache->buckets[ bucket_index ] = entry->next_entry_index;
+	}
+	else
+	{
+		document_cache->entries[ previous_entry_index ].next_entry_index = entry->next_entry_index;
+	}
+	if( entry->older_entry_index == -1 )
+	{
+		document_cache->oldest_entry_index = entry->newer_entry_index;
+	}
+	else
+	{
+		document_cache->entries[ entry->older_entry_index ].newer_entry_index = entry->newer_entry_index;
+	}
+	if( entry->newer_entry_index == -1 )
+	{
+		document_cache->newest_entry_index = entry->older_entry_index;
+	}
+	else
+	{
+		document_cache->entries[ entry->newer_entry_index ].older_entry_index = entry->older_entry_index;
+	}
+	document_cache->size -= entry->size;
+
+	document_cache->number_of_used_entries -= 1;
+
+	entry->next_entry_index          = document_cache->free_entry_index;
+	document_cache->free_entry_index = entry_index;
+
+	if( record_values != NULL )
+	{
+		*record_values       = entry->record_values;
+		entry->record_values = NULL;
+	}
+	else if( libevtx_record_values_free(
+	          &( entry->record_values ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record values of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts record values
+ * The document cache takes over management of the record values and evicts
+ * the oldest record values until the record values fit within the maximum size,
+ * record values that are larger than the maximum size are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_document_cache_insert_record_values(
+     libevtx_document_cache_t *document_cache,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_document_cache_entry_t *entry = NULL;
+	void *reallocation                    = NULL;
+	static char *function                 = "libevtx_document_cache_insert_record_values";
+	size_t record_values_size             = 0;
+	int bucket_index                      = 0;
+	int entry_index                       = 0;
+	int number_of_entries                 = 0;
+
+	if( document_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid document cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values == NULL )
+	 || ( *record_values == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	record_values_size = libevtx_document_cache_get_record_values_size(
+	                      *record_values );
+
+	/* The record values of the same record are replaced
+	 */
+	entry_index = libevtx_document_cache_find_entry(
+	               document_cache,
+	               ( *record_values )->offset );
+
+	if( entry_index != -1 )
+	{
+		if( libevtx_document_cache_remove_entry(
+		     document_cache,
+		     entry_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( (size64_t) record_values_size > document_cache->maximum_size )
+	{
+		( *record_values )->document_cache = NULL;
+
+		return( libevtx_record_values_free(
+		         record_values,
+		         error ) );
+	}
+	while( ( document_cache->oldest_entry_index != -1 )
+	    && ( ( document_cache->size + record_values_size ) > document_cache->maximum_size ) )
+	{
+		if( libevtx_document_cache_remove_entry(
+		     document_cache,
+		     document_cache->oldest_entry_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove oldest entry: %d.",
+			 function,
+			 document_cache->oldest_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( document_cache->free_entry_index == -1 )
+	{
+		if( document_cache->number_of_entries == 0 )
+		{
+			number_of_entries = 16;
+		}
+		else if( document_cache->number_of_entries < ( INT_MAX / 2 ) )
+		{
+			number_of_entries = document_cache->number_of_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid document cache - number of entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = memory_reallocate(
+		                document_cache->entries,
+		                sizeof( libevtx_document_cache_entry_t ) * number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			goto on_error;
+		}
+		document_cache->entries = (libevtx_document_cache_entry_t *) reallocation;
+
+		if( memory_set(
+		     &( document_cache->entries[ document_cache->number_of_entries ] ),
+		     0,
+		     sizeof( libevtx_document_cache_entry_t ) * ( number_of_entries - document_cache->number_of_entries ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			goto on_error;
+		}
+		/* Link the new entries into the free entries list in order
+		 */
+		for( entry_index = number_of_entries - 1;
+		     entry_index >= document_cache->number_of_entries;
+		     entry_index-- )
+		{
+			document_cache->entries[ entry_index ].next_entry_index = document_cache->free_entry_index;
+			document_cache->free_entry_index                        = entry_index;
+		}
+		document_cache->number_of_entries = number_of_entries;
+	}
+	entry_index = document_cache->free_entry_index;
+	entry       = &( document_cache->entries[ entry_index ] );
+
+	document_cache->free_entry_index = entry->next_entry_index;
+
+	bucket_index = libevtx_document_cache_get_bucket_index(
+	                document_cache,
+	                ( *record_values )->offset );
+
+	entry->record_values     = *record_values;
+	entry->offset            = ( *record_values )->offset;
+	entry->size              = record_values_size;
+	entry->next_entry_index  = document_cache->buckets[ bucket_index ];
+	entry->older_entry_index = document_cache->newest_entry_index;
+	entry->newer_entry_index = -1;
+
+	document_cache->buckets[ bucket_index ] = entry_index;
+
+	if( document_cache->newest_entry_index == -1 )
+	{
+		document_cache->oldest_entry_index = entry_index;
+	}
+	else
+	{
+		document_cache->entries[ document_cache->newest_entry_index ].newer_entry_index = entry_index;
+	}
+	document_cache->newest_entry_index = entry_index;
+
+	document_cache->size                   += record_values_size;
+	document_cache->number_of_used_entries += 1;
+
+	*record_values = NULL;
+
+	return( 1 );
+
+on_error:
+	( *record_values )->document_cache = NULL;
+
+	libevtx_record_values_free(
+	 record_values,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Takes the record values of a record offset from the document cache
+ * The caller takes over management of the record values
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_document_cache_take_record_values(
+     libevtx_document_cache_t *document_cache,
+     off64_t offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_document_cache_take_record_values";
+	int entry_index       = 0;
+
+	if( document_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid document cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libevtx_document_cache_find_entry(
+	               document_cache,
+	               offset );
+
+	if( entry_index == -1 )
+	{
+		return( 0 );
+	}
+	if( libevtx_document_cache_remove_entry(
+	     document_cache,
+	     entry_index,
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases record values
+ * Record values of which the XML document was decoded are retained
+ * in the document cache they belong to, other record values are freed
+ * This function is used as the free function of the record values in the records cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_document_cache_release_record_values(
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_document_cache_release_record_values";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_values == NULL )
+	{
+		return( 1 );
+	}
+	if( ( ( *record_values )->document_cache == NULL )
+	 || ( ( *record_values )->xml_document == NULL ) )
+	{
+		return( libevtx_record_values_free(
+		         record_values,
+		         error ) );
+	}
+	if( libevtx_document_cache_insert_record_values(
+	     ( *record_values )->document_cache,
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert record values in document cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,163 @@
+/*
+ * Decoded document cache functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_DOCUMENT_CACHE_H )
+#define _LIBEVTX_DOCUMENT_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_record_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_document_cache_entry libevtx_document_cache_entry_t;
+
+struct libevtx_document_cache_entry
+{
+	/* The record values
+	 * Contains NULL if the entry is not used
+	 */
+	libevtx_record_values_t *record_values;
+
+	/* The offset of the record
+	 */
+	off64_t offset;
+
+	/* The size of the record values in memory
+	 */
+	size_t size;
+
+	/* The index of the next entry in the same hash bucket or in the free entries list
+	 */
+	int next_entry_index;
+
+	/* The index of the entry that was inserted before the entry
+	 * Contains -1 if the entry is the oldest entry
+	 */
+	int older_entry_index;
+
+	/* The index of the entry that was inserted after the entry
+	 * Contains -1 if the entry is the newest entry
+	 */
+	int newer_entry_index;
+};
+
+typedef struct libevtx_document_cache libevtx_document_cache_t;
+
+struct libevtx_document_cache
+{
+	/* The maximum size of the cached record values
+	 */
+	size64_t maximum_size;
+
+	/* The size of the cached record values
+	 */
+	size64_t size;
+
+	/* The entries
+	 */
+	libevtx_document_cache_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_entries;
+
+	/* The number of used entries
+	 */
+	int number_of_used_entries;
+
+	/* The index of the first free entry
+	 */
+	int free_entry_index;
+
+	/* The index of the oldest entry, which is evicted first
+	 */
+	int oldest_entry_index;
+
+	/* The index of the newest entry
+	 */
+	int newest_entry_index;
+
+	/* The hash buckets
+	 * Contains the index of the first entry of every bucket
+	 */
+	int *buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+};
+
+int libevtx_document_cache_initialize(
+     libevtx_document_cache_t **document_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+int libevtx_document_cache_free(
+     libevtx_document_cache_t **document_cache,
+     libcerror_error_t **error );
+
+int libevtx_document_cache_clear(
+     libevtx_document_cache_t *document_cache,
+     libcerror_error_t **error );
+
+int libevtx_document_cache_get_bucket_index(
+     libevtx_document_cache_t *document_cache,
+     off64_t offset );
+
+size_t libevtx_document_cache_get_record_values_size(
+        libevtx_record_values_t *record_values );
+
+int libevtx_document_cache_find_entry(
+     libevtx_document_cache_t *document_cache,
+     off64_t offset );
+
+int libevtx_document_cache_remove_entry(
+     libevtx_document_cache_t *document_cache,
+     int entry_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_document_cache_insert_record_values(
+     libevtx_document_cache_t *document_cache,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_document_cache_take_record_values(
+     libevtx_document_cache_t *document_cache,
+     off64_t offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_document_cache_release_record_values(
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_DOCUMENT_CACHE_H ) */
+
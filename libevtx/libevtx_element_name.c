@@ -0,0 +1,178 @@
+/*
+ * Well-known element name functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_element_name.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfwevt.h"
+
+typedef struct libevtx_element_name_definition libevtx_element_name_definition_t;
+
+struct libevtx_element_name_definition
+{
+	/* The UTF-8 encoded name
+	 */
+	const char *name;
+
+	/* The name size
+	 * The size includes the end of string character
+	 */
+	size_t name_size;
+
+	/* The name identifier
+	 */
+	int identifier;
+};
+
+/* The well-known element names ordered by name size
+ */
+static libevtx_element_name_definition_t libevtx_element_name_definitions[ ] = {
+	{ "Data", 5, LIBEVTX_ELEMENT_NAME_DATA },
+	{ "Task", 5, LIBEVTX_ELEMENT_NAME_TASK },
+	{ "Event", 6, LIBEVTX_ELEMENT_NAME_EVENT },
+	{ "Level", 6, LIBEVTX_ELEMENT_NAME_LEVEL },
+	{ "Opcode", 7, LIBEVTX_ELEMENT_NAME_OPCODE },
+	{ "System", 7, LIBEVTX_ELEMENT_NAME_SYSTEM },
+	{ "Channel", 8, LIBEVTX_ELEMENT_NAME_CHANNEL },
+	{ "EventID", 8, LIBEVTX_ELEMENT_NAME_EVENT_IDENTIFIER },
+	{ "Version", 8, LIBEVTX_ELEMENT_NAME_VERSION },
+	{ "Computer", 9, LIBEVTX_ELEMENT_NAME_COMPUTER },
+	{ "Keywords", 9, LIBEVTX_ELEMENT_NAME_KEYWORDS },
+	{ "Provider", 9, LIBEVTX_ELEMENT_NAME_PROVIDER },
+	{ "Security", 9, LIBEVTX_ELEMENT_NAME_SECURITY },
+	{ "UserData", 9, LIBEVTX_ELEMENT_NAME_USER_DATA },
+	{ "EventData", 10, LIBEVTX_ELEMENT_NAME_EVENT_DATA },
+	{ "Execution", 10, LIBEVTX_ELEMENT_NAME_EXECUTION },
+	{ "BinaryData", 11, LIBEVTX_ELEMENT_NAME_BINARY_DATA },
+	{ "Correlation", 12, LIBEVTX_ELEMENT_NAME_CORRELATION },
+	{ "TimeCreated", 12, LIBEVTX_ELEMENT_NAME_TIME_CREATED },
+	{ "EventRecordID", 14, LIBEVTX_ELEMENT_NAME_EVENT_RECORD_IDENTIFIER },
+	{ "ProcessingErrorData", 20, LIBEVTX_ELEMENT_NAME_PROCESSING_ERROR_DATA },
+	{ NULL, 0, LIBEVTX_ELEMENT_NAME_UNKNOWN } };
+
+/* Determines the identifier of a well-known element name
+ * The name size includes the end of string character
+ * Returns the name identifier or LIBEVTX_ELEMENT_NAME_UNKNOWN if not a well-known name
+ */
+int libevtx_element_name_get_identifier(
+     const uint8_t *utf8_name,
+     size_t utf8_name_size )
+{
+	libevtx_element_name_definition_t *definition = NULL;
+
+	if( ( utf8_name == NULL )
+	 || ( utf8_name_size < 2 )
+	 || ( utf8_name_size > LIBEVTX_ELEMENT_NAME_MAXIMUM_SIZE ) )
+	{
+		return( LIBEVTX_ELEMENT_NAME_UNKNOWN );
+	}
+	for( definition = libevtx_element_name_definitions;
+	     definition->name != NULL;
+	     definition++ )
+	{
+		if( definition->name_size > utf8_name_size )
+		{
+			break;
+		}
+		if( ( definition->name_size == utf8_name_size )
+		 && ( memory_compare(
+		       definition->name,
+		       utf8_name,
+		       utf8_name_size - 1 ) == 0 ) )
+		{
+			return( definition->identifier );
+		}
+	}
+	return( LIBEVTX_ELEMENT_NAME_UNKNOWN );
+}
+
+/* Determines the identifier of the name of a XML tag
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_element_name_get_xml_tag_identifier(
+     libfwevt_xml_tag_t *xml_tag,
+     int *name_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_name[ LIBEVTX_ELEMENT_NAME_MAXIMUM_SIZE ];
+
+	static char *function = "libevtx_element_name_get_xml_tag_identifier";
+	size_t utf8_name_size = 0;
+
+	if( name_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_name_size(
+	     xml_tag,
+	     &utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Names that are longer than the well-known names are not decoded
+	 */
+	if( ( utf8_name_size < 2 )
+	 || ( utf8_name_size > LIBEVTX_ELEMENT_NAME_MAXIMUM_SIZE ) )
+	{
+		*name_identifier = LIBEVTX_ELEMENT_NAME_UNKNOWN;
+
+		return( 1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_name(
+	     xml_tag,
+	     utf8_name,
+	     utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	*name_identifier = libevtx_element_name_get_identifier(
+	                    utf8_name,
+	                    utf8_name_size );
+
+	return( 1 );
+}
+
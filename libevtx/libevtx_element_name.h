@@ -0,0 +1,83 @@
+/*
+ * Well-known element name functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_ELEMENT_NAME_H )
+#define _LIBEVTX_ELEMENT_NAME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libfwevt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a well-known element name
+ * The size includes the end of string character
+ */
+#define LIBEVTX_ELEMENT_NAME_MAXIMUM_SIZE	20
+
+/* The well-known element name identifiers
+ */
+enum LIBEVTX_ELEMENT_NAME_IDENTIFIERS
+{
+	LIBEVTX_ELEMENT_NAME_UNKNOWN			= 0,
+
+	LIBEVTX_ELEMENT_NAME_BINARY_DATA,
+	LIBEVTX_ELEMENT_NAME_CHANNEL,
+	LIBEVTX_ELEMENT_NAME_COMPUTER,
+	LIBEVTX_ELEMENT_NAME_CORRELATION,
+	LIBEVTX_ELEMENT_NAME_DATA,
+	LIBEVTX_ELEMENT_NAME_EVENT,
+	LIBEVTX_ELEMENT_NAME_EVENT_DATA,
+	LIBEVTX_ELEMENT_NAME_EVENT_IDENTIFIER,
+	LIBEVTX_ELEMENT_NAME_EVENT_RECORD_IDENTIFIER,
+	LIBEVTX_ELEMENT_NAME_EXECUTION,
+	LIBEVTX_ELEMENT_NAME_KEYWORDS,
+	LIBEVTX_ELEMENT_NAME_LEVEL,
+	LIBEVTX_ELEMENT_NAME_OPCODE,
+	LIBEVTX_ELEMENT_NAME_PROCESSING_ERROR_DATA,
+	LIBEVTX_ELEMENT_NAME_PROVIDER,
+	LIBEVTX_ELEMENT_NAME_SECURITY,
+	LIBEVTX_ELEMENT_NAME_SYSTEM,
+	LIBEVTX_ELEMENT_NAME_TASK,
+	LIBEVTX_ELEMENT_NAME_TIME_CREATED,
+	LIBEVTX_ELEMENT_NAME_USER_DATA,
+	LIBEVTX_ELEMENT_NAME_VERSION
+};
+
+int libevtx_element_name_get_identifier(
+     const uint8_t *utf8_name,
+     size_t utf8_name_size );
+
+int libevtx_element_name_get_xml_tag_identifier(
+     libfwevt_xml_tag_t *xml_tag,
+     int *name_identifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_ELEMENT_NAME_H ) */
+
@@ -0,0 +1,1029 @@
+/*
+ * EventData values functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_event_data_values.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+#include "libevtx_system_values.h"
+
+#include "evtx_event_record.h"
+
+/* Reads the EventData element values of a record without creating an XML document
+ * The template of the record is walked to determine which substitution values represent
+ * the name and content of the elements of the EventData element
+ * Only elements with an UTF-16 string content or substitution are supported
+ * Returns 1 if successful, 0 if the record data is not supported or -1 on error
+ */
+int libevtx_event_data_values_read_data(
+     libevtx_event_data_values_t *event_data_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	libevtx_event_data_values_template_value_t template_values[ LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_VALUES ];
+
+	static char *function               = "libevtx_event_data_values_read_data";
+	size_t chunk_data_offset            = 0;
+	size_t end_of_data_offset           = 0;
+	size_t template_definition_size     = 0;
+	uint32_t template_definition_offset = 0;
+	int number_of_template_values       = 0;
+	int result                          = 0;
+
+	if( event_data_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid EventData values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_offset >= chunk_data_size )
+	 || ( record_data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
+	 || ( record_data_size > ( chunk_data_size - record_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	event_data_values->number_of_values = 0;
+
+	chunk_data_offset  = record_data_offset + sizeof( evtx_event_record_header_t );
+	end_of_data_offset = record_data_offset + record_data_size - 4;
+
+	/* The event record data consists of a fragment header followed by a template instance
+	 */
+	if( ( end_of_data_offset - chunk_data_offset ) < 14 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data[ chunk_data_offset ] != LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER )
+	 || ( chunk_data[ chunk_data_offset + 4 ] != LIBEVTX_BINARY_XML_TOKEN_TEMPLATE_INSTANCE ) )
+	{
+		return( 0 );
+	}
+	chunk_data_offset += 4;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ chunk_data_offset + 6 ] ),
+	 template_definition_offset );
+
+	chunk_data_offset += 10;
+
+	result = libevtx_event_data_values_read_template_definition(
+	          template_values,
+	          &number_of_template_values,
+	          chunk_data,
+	          chunk_data_size,
+	          (size_t) template_definition_offset,
+	          &template_definition_size,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read template definition.",
+			 function );
+		}
+		return( result );
+	}
+	/* The template definition is stored in the record data the first time it is used in the chunk
+	 */
+	if( (size_t) template_definition_offset == chunk_data_offset )
+	{
+		chunk_data_offset += template_definition_size;
+	}
+	result = libevtx_event_data_values_read_substitution_values(
+	          event_data_values,
+	          template_values,
+	          number_of_template_values,
+	          chunk_data,
+	          chunk_data_size,
+	          chunk_data_offset,
+	          end_of_data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read substitution values.",
+		 function );
+	}
+	return( result );
+}
+
+/* Reads a template definition and determines where the EventData element values are stored
+ * Returns 1 if successful, 0 if the template definition is not supported or -1 on error
+ */
+int libevtx_event_data_values_read_template_definition(
+     libevtx_event_data_values_template_value_t *template_values,
+     int *number_of_template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t template_definition_offset,
+     size_t *template_definition_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libevtx_event_data_values_read_template_definition";
+	size_t chunk_data_offset    = 0;
+	size_t end_of_data_offset   = 0;
+	uint32_t template_data_size = 0;
+	int result                  = 0;
+
+	if( template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition size.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_template_values = 0;
+
+	/* The template definition header consists of the next template definition offset,
+	 * the template identifier and the template data size
+	 */
+	if( ( template_definition_offset >= chunk_data_size )
+	 || ( ( chunk_data_size - template_definition_offset ) < 24 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ template_definition_offset + 20 ] ),
+	 template_data_size );
+
+	chunk_data_offset = template_definition_offset + 24;
+
+	if( (size_t) template_data_size > ( chunk_data_size - chunk_data_offset ) )
+	{
+		return( 0 );
+	}
+	end_of_data_offset = chunk_data_offset + template_data_size;
+
+	if( ( ( end_of_data_offset - chunk_data_offset ) < 4 )
+	 || ( chunk_data[ chunk_data_offset ] != LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER ) )
+	{
+		return( 0 );
+	}
+	chunk_data_offset += 4;
+
+	result = libevtx_event_data_values_read_element(
+	          template_values,
+	          number_of_template_values,
+	          chunk_data,
+	          chunk_data_size,
+	          &chunk_data_offset,
+	          end_of_data_offset,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root element.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition_size = 24 + (size_t) template_data_size;
+
+	return( result );
+}
+
+/* Reads an element of a template definition
+ * Elements that cannot contain an EventData element value are skipped using their data size
+ * Returns 1 if successful, 0 if the element is not supported or -1 on error
+ */
+int libevtx_event_data_values_read_element(
+     libevtx_event_data_values_template_value_t *template_values,
+     int *number_of_template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error )
+{
+	libevtx_event_data_values_template_value_t *template_value = NULL;
+	libevtx_system_values_template_value_t *attribute_value     = NULL;
+	const uint8_t *name_data                                    = NULL;
+	static char *function                                       = "libevtx_event_data_values_read_element";
+	size_t attributes_end_offset                                = 0;
+	size_t element_end_offset                                   = 0;
+	size_t name_data_size                                       = 0;
+	size_t name_offset                                          = 0;
+	size_t safe_chunk_data_offset                               = 0;
+	uint32_t attributes_data_size                               = 0;
+	uint32_t element_data_size                                  = 0;
+	uint32_t element_name_offset                                = 0;
+	uint8_t element_token                                       = 0;
+	uint8_t token                                               = 0;
+	int result                                                  = 0;
+
+	if( template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	/* The open start element tag consists of the token, dependency identifier,
+	 * element data size and element name offset
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 11 ) )
+	{
+		return( 0 );
+	}
+	element_token = chunk_data[ safe_chunk_data_offset ];
+
+	if( ( element_token & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA ) ) != LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 3 ] ),
+	 element_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 7 ] ),
+	 element_name_offset );
+
+	if( (size_t) element_data_size > ( end_of_data_offset - ( safe_chunk_data_offset + 7 ) ) )
+	{
+		return( 0 );
+	}
+	element_end_offset      = safe_chunk_data_offset + 7 + element_data_size;
+	safe_chunk_data_offset += 11;
+
+	if( (size_t) element_name_offset == safe_chunk_data_offset )
+	{
+		result = libevtx_system_values_read_name(
+		          chunk_data,
+		          element_end_offset,
+		          &safe_chunk_data_offset,
+		          &name_data,
+		          &name_data_size,
+		          error );
+	}
+	else
+	{
+		name_offset = (size_t) element_name_offset;
+
+		result = libevtx_system_values_read_name(
+		          chunk_data,
+		          chunk_data_size,
+		          &name_offset,
+		          &name_data,
+		          &name_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element name.",
+			 function );
+		}
+		return( result );
+	}
+	/* Only the Event, Event/EventData and the elements in Event/EventData are walked
+	 */
+	if( element_depth == 0 )
+	{
+		if( libevtx_system_values_compare_name(
+		     name_data,
+		     name_data_size,
+		     "Event",
+		     5 ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	else if( element_depth == 1 )
+	{
+		/* The strings of records with UserData or ProcessingErrorData
+		 * are left to the XML document
+		 */
+		if( ( libevtx_system_values_compare_name(
+		       name_data,
+		       name_data_size,
+		       "UserData",
+		       8 ) == 1 )
+		 || ( libevtx_system_values_compare_name(
+		       name_data,
+		       name_data_size,
+		       "ProcessingErrorData",
+		       19 ) == 1 ) )
+		{
+			return( 0 );
+		}
+		if( libevtx_system_values_compare_name(
+		     name_data,
+		     name_data_size,
+		     "EventData",
+		     9 ) != 1 )
+		{
+			*chunk_data_offset = element_end_offset;
+
+			return( 1 );
+		}
+	}
+	else if( element_depth == 2 )
+	{
+		if( *number_of_template_values >= LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_VALUES )
+		{
+			return( 0 );
+		}
+		template_value = &( template_values[ *number_of_template_values ] );
+
+		template_value->name.substitution_index  = -1;
+		template_value->name.string_data         = NULL;
+		template_value->name.string_data_size    = 0;
+		template_value->value.substitution_index = -1;
+		template_value->value.string_data        = NULL;
+		template_value->value.string_data_size   = 0;
+
+		*number_of_template_values += 1;
+	}
+	else
+	{
+		/* Elements nested in an EventData element are left to the XML document
+		 */
+		return( 0 );
+	}
+	if( ( element_token & LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA ) != 0 )
+	{
+		if( ( element_end_offset - safe_chunk_data_offset ) < 4 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chunk_data[ safe_chunk_data_offset ] ),
+		 attributes_data_size );
+
+		safe_chunk_data_offset += 4;
+
+		if( (size_t) attributes_data_size > ( element_end_offset - safe_chunk_data_offset ) )
+		{
+			return( 0 );
+		}
+		attributes_end_offset = safe_chunk_data_offset + attributes_data_size;
+
+		while( safe_chunk_data_offset < attributes_end_offset )
+		{
+			/* The attribute consists of the token and the attribute name offset
+			 */
+			if( ( attributes_end_offset - safe_chunk_data_offset ) < 5 )
+			{
+				return( 0 );
+			}
+			token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+			if( token != LIBEVTX_BINARY_XML_TOKEN_ATTRIBUTE )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+			 element_name_offset );
+
+			safe_chunk_data_offset += 5;
+
+			if( (size_t) element_name_offset == safe_chunk_data_offset )
+			{
+				result = libevtx_system_values_read_name(
+				          chunk_data,
+				          attributes_end_offset,
+				          &safe_chunk_data_offset,
+				          &name_data,
+				          &name_data_size,
+				          error );
+			}
+			else
+			{
+				name_offset = (size_t) element_name_offset;
+
+				result = libevtx_system_values_read_name(
+				          chunk_data,
+				          chunk_data_size,
+				          &name_offset,
+				          &name_data,
+				          &name_data_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read attribute name.",
+					 function );
+				}
+				return( result );
+			}
+			attribute_value = NULL;
+
+			if( template_value != NULL )
+			{
+				if( libevtx_system_values_compare_name(
+				     name_data,
+				     name_data_size,
+				     "Name",
+				     4 ) == 1 )
+				{
+					attribute_value = &( template_value->name );
+				}
+			}
+			result = libevtx_system_values_read_value(
+			          attribute_value,
+			          chunk_data,
+			          attributes_end_offset,
+			          &safe_chunk_data_offset,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read attribute value.",
+					 function );
+				}
+				return( result );
+			}
+		}
+	}
+	if( safe_chunk_data_offset >= element_end_offset )
+	{
+		return( 0 );
+	}
+	token = chunk_data[ safe_chunk_data_offset ];
+
+	if( token == LIBEVTX_BINARY_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
+	{
+		*chunk_data_offset = safe_chunk_data_offset + 1;
+
+		return( 1 );
+	}
+	else if( token != LIBEVTX_BINARY_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+	{
+		return( 0 );
+	}
+	safe_chunk_data_offset += 1;
+
+	while( safe_chunk_data_offset < element_end_offset )
+	{
+		token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+		if( token == LIBEVTX_BINARY_XML_TOKEN_END_ELEMENT_TAG )
+		{
+			*chunk_data_offset = safe_chunk_data_offset + 1;
+
+			return( 1 );
+		}
+		else if( token == LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+		{
+			result = libevtx_event_data_values_read_element(
+			          template_values,
+			          number_of_template_values,
+			          chunk_data,
+			          chunk_data_size,
+			          &safe_chunk_data_offset,
+			          element_end_offset,
+			          element_depth + 1,
+			          error );
+		}
+		else if( template_value != NULL )
+		{
+			/* The element content should consist of a single string value or substitution,
+			 * other content such as character and entity references is left to the XML document
+			 */
+			if( ( token != LIBEVTX_BINARY_XML_TOKEN_VALUE )
+			 && ( token != LIBEVTX_BINARY_XML_TOKEN_NORMAL_SUBSTITUTION )
+			 && ( token != LIBEVTX_BINARY_XML_TOKEN_OPTIONAL_SUBSTITUTION ) )
+			{
+				return( 0 );
+			}
+			if( ( template_value->value.substitution_index != -1 )
+			 || ( template_value->value.string_data != NULL ) )
+			{
+				return( 0 );
+			}
+			result = libevtx_system_values_read_value(
+			          &( template_value->value ),
+			          chunk_data,
+			          element_end_offset,
+			          &safe_chunk_data_offset,
+			          error );
+		}
+		else
+		{
+			result = libevtx_system_values_read_value(
+			          NULL,
+			          chunk_data,
+			          element_end_offset,
+			          &safe_chunk_data_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read element content.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads the substitution values of the template instance of a record
+ * Returns 1 if successful, 0 if the substitution values are not supported or -1 on error
+ */
+int libevtx_event_data_values_read_substitution_values(
+     libevtx_event_data_values_t *event_data_values,
+     libevtx_event_data_values_template_value_t *template_values,
+     int number_of_template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t substitutions_offset,
+     size_t end_of_data_offset,
+     libcerror_error_t **error )
+{
+	size_t value_data_offsets[ LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_SUBSTITUTIONS + 1 ];
+
+	libevtx_event_data_value_t *event_data_value = NULL;
+	static char *function                        = "libevtx_event_data_values_read_substitution_values";
+	size_t value_data_offset                     = 0;
+	uint32_t number_of_offsets                   = 0;
+	uint32_t number_of_values                    = 0;
+	uint32_t substitution_index                  = 0;
+	uint16_t value_data_size                     = 0;
+	int value_index                              = 0;
+
+	if( event_data_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid EventData values.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_template_values < 0 )
+	 || ( number_of_template_values > LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of template values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	event_data_values->number_of_values = 0;
+
+	/* The substitution values consist of the number of values, a size and type
+	 * descriptor per value and the value data
+	 */
+	if( ( substitutions_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - substitutions_offset ) < 4 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ substitutions_offset ] ),
+	 number_of_values );
+
+	substitutions_offset += 4;
+
+	if( (size_t) number_of_values > ( ( end_of_data_offset - substitutions_offset ) / 4 ) )
+	{
+		return( 0 );
+	}
+	/* The value data offsets are determined in a single pass over the descriptors
+	 */
+	number_of_offsets = number_of_values;
+
+	if( number_of_offsets > LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_SUBSTITUTIONS )
+	{
+		number_of_offsets = LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_SUBSTITUTIONS;
+	}
+	value_data_offset = substitutions_offset + ( (size_t) number_of_values * 4 );
+
+	for( substitution_index = 0;
+	     substitution_index < number_of_offsets;
+	     substitution_index++ )
+	{
+		value_data_offsets[ substitution_index ] = value_data_offset;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( chunk_data[ substitutions_offset + ( (size_t) substitution_index * 4 ) ] ),
+		 value_data_size );
+
+		if( (size_t) value_data_size > ( end_of_data_offset - value_data_offset ) )
+		{
+			return( 0 );
+		}
+		value_data_offset += value_data_size;
+	}
+	value_data_offsets[ number_of_offsets ] = value_data_offset;
+
+	for( value_index = 0;
+	     value_index < number_of_template_values;
+	     value_index++ )
+	{
+		event_data_value = &( event_data_values->values[ value_index ] );
+
+		if( libevtx_event_data_values_get_string_data(
+		     &( template_values[ value_index ].name ),
+		     chunk_data,
+		     substitutions_offset,
+		     value_data_offsets,
+		     number_of_offsets,
+		     &( event_data_value->name ),
+		     &( event_data_value->name_size ) ) != 1 )
+		{
+			return( 0 );
+		}
+		if( libevtx_event_data_values_get_string_data(
+		     &( template_values[ value_index ].value ),
+		     chunk_data,
+		     substitutions_offset,
+		     value_data_offsets,
+		     number_of_offsets,
+		     &( event_data_value->value ),
+		     &( event_data_value->value_size ) ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	event_data_values->number_of_values = number_of_template_values;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 little-endian string data of a template value
+ * The value data offsets contain an offset per substitution value and the end of the value data
+ * A value that is not set or a substitution without a corresponding value results in an empty string
+ * Returns 1 if successful or 0 if the value is not supported
+ */
+int libevtx_event_data_values_get_string_data(
+     libevtx_system_values_template_value_t *template_value,
+     const uint8_t *chunk_data,
+     size_t substitutions_offset,
+     const size_t *value_data_offsets,
+     uint32_t number_of_values,
+     const uint8_t **string_data,
+     size_t *string_data_size )
+{
+	const uint8_t *value_data = NULL;
+	size_t value_data_size    = 0;
+	uint8_t value_type        = 0;
+
+	if( ( template_value == NULL )
+	 || ( chunk_data == NULL )
+	 || ( value_data_offsets == NULL )
+	 || ( string_data == NULL )
+	 || ( string_data_size == NULL ) )
+	{
+		return( 0 );
+	}
+	if( template_value->substitution_index >= 0 )
+	{
+		/* An optional substitution without a corresponding value is not set
+		 */
+		if( (uint32_t) template_value->substitution_index >= number_of_values )
+		{
+			if( number_of_values >= LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_SUBSTITUTIONS )
+			{
+				return( 0 );
+			}
+		}
+		else
+		{
+			value_type = chunk_data[ substitutions_offset + ( (size_t) template_value->substitution_index * 4 ) + 2 ];
+
+			value_data      = &( chunk_data[ value_data_offsets[ template_value->substitution_index ] ] );
+			value_data_size = value_data_offsets[ template_value->substitution_index + 1 ]
+			                - value_data_offsets[ template_value->substitution_index ];
+
+			if( value_type == LIBEVTX_VALUE_TYPE_NULL )
+			{
+				value_data_size = 0;
+			}
+			else if( value_type != LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+			{
+				return( 0 );
+			}
+		}
+	}
+	else if( template_value->string_data != NULL )
+	{
+		value_data      = template_value->string_data;
+		value_data_size = template_value->string_data_size;
+	}
+	/* Ignore trailing end of string characters
+	 */
+	while( ( value_data_size >= 2 )
+	    && ( value_data[ value_data_size - 2 ] == 0 )
+	    && ( value_data[ value_data_size - 1 ] == 0 ) )
+	{
+		value_data_size -= 2;
+	}
+	if( ( value_data_size % 2 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( value_data_size == 0 )
+	{
+		value_data = NULL;
+	}
+	*string_data      = value_data;
+	*string_data_size = value_data_size;
+
+	return( 1 );
+}
+
+/* Compares an UTF-16 little-endian string with an UTF-8 string
+ * The UTF-16 stream should not contain an end of string character
+ * The UTF-8 string size should include the end of string character
+ * If case insensitive is set the comparison is case insensitive for the ASCII characters
+ * Returns 1 if the strings are equal or 0 if not
+ */
+int libevtx_event_data_values_compare_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t case_insensitive )
+{
+	libuna_unicode_character_t stream_character = 0;
+	libuna_unicode_character_t string_character = 0;
+	size_t utf16_stream_index                   = 0;
+	size_t utf8_string_index                    = 0;
+
+	if( ( utf8_string == NULL )
+	 || ( utf8_string_size == 0 ) )
+	{
+		return( 0 );
+	}
+	utf8_string_size -= 1;
+
+	if( utf16_stream == NULL )
+	{
+		return( utf8_string_size == 0 );
+	}
+	while( ( utf16_stream_index < utf16_stream_size )
+	    && ( utf8_string_index < utf8_string_size ) )
+	{
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &stream_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     LIBUNA_ENDIAN_LITTLE,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( libuna_unicode_character_copy_from_utf8(
+		     &string_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( case_insensitive != 0 )
+		{
+			if( ( stream_character >= (libuna_unicode_character_t) 'A' )
+			 && ( stream_character <= (libuna_unicode_character_t) 'Z' ) )
+			{
+				stream_character += (libuna_unicode_character_t) ( 'a' - 'A' );
+			}
+			if( ( string_character >= (libuna_unicode_character_t) 'A' )
+			 && ( string_character <= (libuna_unicode_character_t) 'Z' ) )
+			{
+				string_character += (libuna_unicode_character_t) ( 'a' - 'A' );
+			}
+		}
+		if( stream_character != string_character )
+		{
+			return( 0 );
+		}
+	}
+	if( ( utf16_stream_index != utf16_stream_size )
+	 || ( utf8_string_index != utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
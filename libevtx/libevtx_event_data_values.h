@@ -0,0 +1,153 @@
+/*
+ * EventData values functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_EVENT_DATA_VALUES_H )
+#define _LIBEVTX_EVENT_DATA_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_system_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of EventData values that are read without an XML document
+ */
+#define LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_VALUES		64
+
+/* The maximum number of substitution values that are read without an XML document
+ */
+#define LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_SUBSTITUTIONS	256
+
+typedef struct libevtx_event_data_values_template_value libevtx_event_data_values_template_value_t;
+
+struct libevtx_event_data_values_template_value
+{
+	/* The Name attribute value
+	 */
+	libevtx_system_values_template_value_t name;
+
+	/* The element content value
+	 */
+	libevtx_system_values_template_value_t value;
+};
+
+typedef struct libevtx_event_data_value libevtx_event_data_value_t;
+
+struct libevtx_event_data_value
+{
+	/* The name
+	 * Contains an UTF-16 little-endian string without end of string character
+	 * that references the chunk data
+	 */
+	const uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The value
+	 * Contains an UTF-16 little-endian string without end of string character
+	 * that references the chunk data
+	 */
+	const uint8_t *value;
+
+	/* The value size
+	 */
+	size_t value_size;
+};
+
+typedef struct libevtx_event_data_values libevtx_event_data_values_t;
+
+struct libevtx_event_data_values
+{
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The values
+	 * Contains a value per element of the EventData element
+	 */
+	libevtx_event_data_value_t values[ LIBEVTX_EVENT_DATA_VALUES_MAXIMUM_NUMBER_OF_VALUES ];
+};
+
+int libevtx_event_data_values_read_data(
+     libevtx_event_data_values_t *event_data_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+int libevtx_event_data_values_read_template_definition(
+     libevtx_event_data_values_template_value_t *template_values,
+     int *number_of_template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t template_definition_offset,
+     size_t *template_definition_size,
+     libcerror_error_t **error );
+
+int libevtx_event_data_values_read_element(
+     libevtx_event_data_values_template_value_t *template_values,
+     int *number_of_template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error );
+
+int libevtx_event_data_values_read_substitution_values(
+     libevtx_event_data_values_t *event_data_values,
+     libevtx_event_data_values_template_value_t *template_values,
+     int number_of_template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t substitutions_offset,
+     size_t end_of_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_event_data_values_get_string_data(
+     libevtx_system_values_template_value_t *template_value,
+     const uint8_t *chunk_data,
+     size_t substitutions_offset,
+     const size_t *value_data_offsets,
+     uint32_t number_of_values,
+     const uint8_t **string_data,
+     size_t *string_data_size );
+
+int libevtx_event_data_values_compare_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t case_insensitive );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_EVENT_DATA_VALUES_H ) */
+
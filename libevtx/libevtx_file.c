@@ -20,26 +20,75 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#include "libevtx_async_reader.h"
+#include "libevtx_buffer_pool.h"
 #include "libevtx_chunks_table.h"
 #include "libevtx_codepage.h"
+#include "libevtx_cache.h"
+#include "libevtx_checksum.h"
 #include "libevtx_chunk.h"
+#include "libevtx_chunk_batch.h"
+#include "libevtx_chunk_builder.h"
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_chunk_information.h"
+#include "libevtx_chunk_prefetcher.h"
 #include "libevtx_debug.h"
+#include "libevtx_decode_profile.h"
+#include "libevtx_decoded_values_file.h"
 #include "libevtx_definitions.h"
+#include "libevtx_event_data_values.h"
 #include "libevtx_i18n.h"
+#include "libevtx_identifier_gaps.h"
+#include "libevtx_identifier_index.h"
+#include "libevtx_index_file.h"
+#include "libevtx_indexed_chunks.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_file.h"
 #include "libevtx_libbfio.h"
+#include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_read_buffer.h"
 #include "libevtx_record.h"
+#include "libevtx_query_index.h"
+#include "libevtx_record_filter.h"
 #include "libevtx_record_values.h"
+#include "libevtx_recovered_records_filter.h"
+#include "libevtx_statistics.h"
+#include "libevtx_string_table.h"
+#include "libevtx_system_fields.h"
+#include "libevtx_value_filter.h"
+
+#include "evtx_file_header.h"
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#define HAVE_LIBEVTX_MEMORY_MAPPED_FILE
+#endif
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -130,6 +179,70 @@ int libevtx_file_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->async_requests_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create asynchronous requests array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_file->async_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create asynchronous requests mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_file->async_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create asynchronous requests condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->maximum_number_of_cached_chunks  = LIBEVTX_MAXIMUM_CACHE_ENTRIES_CHUNKS;
+	internal_file->maximum_number_of_cached_records = LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS;
+	internal_file->maximum_document_cache_size      = LIBEVTX_DEFAULT_MAXIMUM_DOCUMENT_CACHE_SIZE;
+	internal_file->number_of_threads                = 1;
+	internal_file->read_ahead_depth                 = LIBEVTX_DEFAULT_READ_AHEAD_DEPTH;
+	internal_file->coalesced_read_size              = LIBEVTX_DEFAULT_COALESCED_READ_SIZE;
+	internal_file->async_read_queue_depth           = LIBEVTX_DEFAULT_ASYNC_READ_QUEUE_DEPTH;
+	internal_file->cache_file_identifier            = -1;
+
 	*file = (libevtx_file_t *) internal_file;
 
 	return( 1 );
@@ -137,6 +250,27 @@ int libevtx_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( internal_file->async_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_file->async_mutex ),
+			 NULL );
+		}
+		if( internal_file->async_requests_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_file->async_requests_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_file->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_file->read_write_lock ),
+			 NULL );
+		}
+#endif
 		if( internal_file->io_handle != NULL )
 		{
 			libevtx_io_handle_free(
@@ -175,6 +309,21 @@ int libevtx_file_free(
 	{
 		internal_file = (libevtx_internal_file_t *) *file;
 
+		/* A pending asynchronous open can still set the file IO handle
+		 */
+		if( libevtx_file_wait_async(
+		     *file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to wait for asynchronous requests.",
+			 function );
+
+			result = -1;
+		}
 		if( internal_file->file_io_handle != NULL )
 		{
 			if( libevtx_file_close(
@@ -206,6 +355,98 @@ int libevtx_file_free(
 
 			result = -1;
 		}
+		if( internal_file->index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->index_data != NULL )
+		{
+			memory_free(
+			 internal_file->index_data );
+		}
+		if( internal_file->decoded_values_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->decoded_values_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoded values file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_file->async_requests_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_async_request_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free asynchronous requests array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( internal_file->async_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free asynchronous requests condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_file->async_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free asynchronous requests mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -251,6 +492,91 @@ int libevtx_file_signal_abort(
 	return( 1 );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Grabs the read/write lock of a file for reading
+ * The time spent waiting for the lock is added to the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_grab_for_read(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_grab_for_read";
+	uint64_t start_time   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = libevtx_statistics_get_time();
+
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	/* The statistics are updated by concurrent readers without locking
+	 * hence the lock wait time is approximate
+	 */
+	if( internal_file->io_handle != NULL )
+	{
+		LIBEVTX_COUNTER_ADD(
+		 internal_file->io_handle->statistics.lock_wait_time,
+		 libevtx_statistics_get_time() - start_time );
+	}
+	return( 1 );
+}
+
+/* Grabs the read/write lock of a file for writing
+ * The time spent waiting for the lock is added to the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_grab_for_write(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_grab_for_write";
+	uint64_t start_time   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = libevtx_statistics_get_time();
+
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( internal_file->io_handle != NULL )
+	{
+		LIBEVTX_COUNTER_ADD(
+		 internal_file->io_handle->statistics.lock_wait_time,
+		 libevtx_statistics_get_time() - start_time );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Opens a file
  * Returns 1 if successful or -1 on error
  */
@@ -264,6 +590,7 @@ int libevtx_file_open(
 	libevtx_internal_file_t *internal_file = NULL;
 	static char *function                  = "libevtx_file_open";
 	size_t filename_length                 = 0;
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -359,6 +686,100 @@ int libevtx_file_open(
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBEVTX_ACCESS_FLAG_MAPPED ) != 0 )
+	{
+		/* If the file cannot be memory mapped the chunks are read using the file IO handle
+		 */
+		if( libevtx_internal_file_map(
+		     internal_file,
+		     filename,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	if( internal_file->io_handle->mapped_data == NULL )
+	{
+		/* If no native file descriptor is available the chunks are read
+		 * using a seek and read of the file IO handle
+		 */
+		if( libevtx_io_handle_open_file_descriptor(
+		     internal_file->io_handle,
+		     filename,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file descriptor: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		if( internal_file->async_read_queue_depth > 0 )
+		{
+			if( libevtx_async_reader_initialize(
+			     &( internal_file->io_handle->async_reader ),
+			     (size_t) internal_file->io_handle->chunk_size,
+			     internal_file->async_read_queue_depth,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create asynchronous reader.",
+				 function );
+
+				goto on_error;
+			}
+			result = libevtx_async_reader_open(
+			          internal_file->io_handle->async_reader,
+			          filename,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open asynchronous reader: %s.",
+				 function,
+				 filename );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				/* If asynchronous reads are not supported the chunks are read synchronously
+				 */
+				if( libevtx_async_reader_free(
+				     &( internal_file->io_handle->async_reader ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free asynchronous reader.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
 	if( libevtx_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -380,14 +801,30 @@ int libevtx_file_open(
 	return( 1 );
 
 on_error:
-	if( file_io_handle != NULL )
+	if( internal_file->io_handle->async_reader != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
+		libevtx_async_reader_free(
+		 &( internal_file->io_handle->async_reader ),
 		 NULL );
 	}
-	return( -1 );
-}
+	if( internal_file->io_handle->mapped_data != NULL )
+	{
+		libevtx_internal_file_unmap(
+		 internal_file,
+		 NULL );
+	}
+	libevtx_io_handle_close_file_descriptor(
+	 internal_file->io_handle,
+	 NULL );
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
@@ -545,6 +982,7 @@ int libevtx_file_open_file_io_handle(
 	int bfio_access_flags                  = 0;
 	int file_io_handle_is_open             = 0;
 	int file_io_handle_opened_in_library   = 0;
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -604,6 +1042,91 @@ int libevtx_file_open_file_io_handle(
 
 		return( -1 );
 	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	 && ( ( access_flags & LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: lazy access cannot be combined with recovered only access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_MAPPED ) != 0 )
+	 && ( ( access_flags & LIBEVTX_ACCESS_FLAG_NO_CACHE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access cannot be combined with no cache access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_MAPPED ) != 0 )
+	 && ( ( access_flags & LIBEVTX_ACCESS_FLAG_LIVE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access cannot be combined with live access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_DEFERRED_RECOVERY ) != 0 )
+	 && ( ( access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_LIVE ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: deferred recovery cannot be combined with lazy, recovered only or live access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_HEADER_ONLY ) != 0 )
+	 && ( ( access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_LIVE | LIBEVTX_ACCESS_FLAG_DEFERRED_RECOVERY ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: header only access cannot be combined with lazy, recovered only, live or deferred recovery access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_DEDUPLICATE_RECOVERED ) != 0 )
+	 && ( ( access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_HEADER_ONLY ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: deduplicating recovered records cannot be combined with lazy, recovered only or header only access.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( access_flags & LIBEVTX_ACCESS_FLAG_THREAD_SAFE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: thread-safe access not supported - library built without multi-threading support.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( ( access_flags & LIBEVTX_ACCESS_FLAG_READ ) != 0 )
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
@@ -641,10 +1164,29 @@ int libevtx_file_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
-	if( libevtx_file_open_read(
+	internal_file->access_flags = access_flags;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
 	     internal_file,
-	     file_io_handle,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libevtx_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -653,11 +1195,57 @@ int libevtx_file_open_file_io_handle(
 		 "%s: unable to read from file handle.",
 		 function );
 
-		goto on_error;
+		result = -1;
+	}
+	else
+	{
+		internal_file->file_io_handle                   = file_io_handle;
+		internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+		/* The decoded values file contains the System values of the records
+		 * of the whole file, hence it is not used for a partition
+		 */
+		if( ( ( internal_file->access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_HEADER_ONLY ) ) == 0 )
+		 && ( internal_file->is_partition == 0 )
+		 && ( internal_file->decoded_values_file_io_handle != NULL ) )
+		{
+			/* The decoded values file only speeds up retrieving the System values
+			 * hence failing to read or write it is not an error
+			 */
+			if( libevtx_internal_file_read_decoded_values_file(
+			     internal_file,
+			     NULL ) != 1 )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to read decoded values file.\n",
+					 function );
+				}
+#endif
+			}
+		}
 	}
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -667,19 +1255,26 @@ on_error:
 		 file_io_handle,
 		 error );
 	}
+	internal_file->access_flags = 0;
+
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Opens a partition of a file using a Basic File IO (bfio) handle
+ * Besides the file header only the chunks in the partition are read and indexed,
+ * hence the record indexes are relative to the start of the partition
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_file_close(
+int libevtx_file_open_partition(
      libevtx_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     uint16_t first_chunk_index,
+     uint16_t number_of_chunks,
+     int access_flags,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_close";
-	int result                             = 0;
+	static char *function                  = "libevtx_file_open_partition";
 
 	if( file == NULL )
 	{
@@ -694,184 +1289,266 @@ int libevtx_file_close(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( number_of_chunks == 0 )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libevtx_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of chunks value zero or less.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( ( (uint32_t) first_chunk_index + (uint32_t) number_of_chunks ) > ( (uint32_t) UINT16_MAX + 1 ) )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
+	/* The chunks outside the partition are not read, hence the partition cannot be
+	 * determined from the chunk headers or followed while the file is written
+	 */
+	if( ( access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_HEADER_ONLY | LIBEVTX_ACCESS_FLAG_LIVE ) ) != 0 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: partition cannot be combined with lazy, header only or live access.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_file->file_io_handle = NULL;
+	internal_file->is_partition                = 1;
+	internal_file->partition_first_chunk_index = first_chunk_index;
+	internal_file->partition_number_of_chunks  = number_of_chunks;
 
-	if( libevtx_io_handle_clear(
-	     internal_file->io_handle,
+	if( libevtx_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open partition.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libfdata_list_free(
-	     &( internal_file->recovered_records_list ),
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	internal_file->is_partition                = 0;
+	internal_file->partition_first_chunk_index = 0;
+	internal_file->partition_number_of_chunks  = 0;
+
+	return( -1 );
+}
+
+/* Opens a file from data stored in memory
+ * The chunks reference the data directly instead of reading a copy,
+ * the data must remain valid and unmodified until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_open_memory(
+     libevtx_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_open_memory";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free recovered records list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libfdata_list_free(
-	     &( internal_file->records_list ),
-	     error ) != 1 )
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free records list.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libfcache_cache_free(
-	     &( internal_file->records_cache ),
-	     error ) != 1 )
+	if( internal_file->io_handle->mapped_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free records cache.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - mapped data value already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libfdata_vector_free(
-	     &( internal_file->chunks_vector ),
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEVTX_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEVTX_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file header and the data outside of the chunks are read
+	 * using a memory range file IO handle
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free chunks vector.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libfcache_cache_free(
-	     &( internal_file->chunks_cache ),
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free chunks cache.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	return( result );
+	/* The chunks reference the data the same way as a memory mapped file
+	 */
+	internal_file->io_handle->mapped_data      = (uint8_t *) data;
+	internal_file->io_handle->mapped_data_size = (size64_t) data_size;
+	internal_file->mapped_data_is_external     = 1;
+
+	if( libevtx_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags & ~( LIBEVTX_ACCESS_FLAG_MAPPED ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from memory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->io_handle->mapped_data != NULL )
+	{
+		libevtx_internal_file_unmap(
+		 internal_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a file for reading
- * Returns 1 if successful or -1 on error
+/* Memory maps a file
+ * Returns 1 if successful, 0 if the file cannot be memory mapped or -1 on error
  */
-int libevtx_file_open_read(
+int libevtx_internal_file_map(
      libevtx_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+     const char *filename,
      libcerror_error_t **error )
 {
-	libevtx_chunk_t *chunk                 = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	libevtx_chunks_table_t *chunks_table   = NULL;
-	static char *function                  = "libevtx_file_open_read";
-	off64_t file_offset                    = 0;
-	size64_t file_size                     = 0;
-	uint16_t chunk_index                   = 0;
-	uint16_t number_of_chunks              = 0;
-	uint16_t number_of_records             = 0;
-	uint16_t record_index                  = 0;
-	int element_index                      = 0;
-	int result                             = 0;
-	int segment_index                      = 0;
+	static char *function = "libevtx_internal_file_map";
 
-#if defined( HAVE_VERBOSE_OUTPUT )
-	uint64_t previous_record_identifier    = 0;
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *trailing_data                 = NULL;
-	size_t trailing_data_size              = 0;
-	ssize_t read_count                     = 0;
+#if defined( HAVE_LIBEVTX_MEMORY_MAPPED_FILE )
+	struct stat file_statistics;
+
+	void *mapped_data     = NULL;
+	int file_descriptor   = -1;
 #endif
 
 	if( internal_file == NULL )
@@ -896,665 +1573,18664 @@ int libevtx_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->chunks_vector != NULL )
+	if( internal_file->io_handle->mapped_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - chunks vector already set.",
+		 "%s: invalid file - mapped data value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->chunks_cache != NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - chunks cache already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->records_list != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - records list already set.",
-		 function );
+#if defined( HAVE_LIBEVTX_MEMORY_MAPPED_FILE )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
 
-		return( -1 );
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
 	}
-	if( internal_file->recovered_records_list != NULL )
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - recovered records list already set.",
-		 function );
+		close(
+		 file_descriptor );
 
-		return( -1 );
+		return( 0 );
 	}
-	if( internal_file->records_cache != NULL )
+	/* Only regular files that fit in the address space are mapped
+	 */
+	if( ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - records cache already set.",
-		 function );
+		close(
+		 file_descriptor );
 
-		return( -1 );
+		return( 0 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
-	     error ) != 1 )
+	if( libevtx_io_handle_determine_sparse_tail_offset(
+	     internal_file->io_handle,
+	     file_descriptor,
+	     (size64_t) file_statistics.st_size,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 "%s: unable to determine sparse tail offset.",
 		 function );
 
-		goto on_error;
+		close(
+		 file_descriptor );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	if( mapped_data == MAP_FAILED )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		return( 0 );
 	}
+	internal_file->io_handle->mapped_data       = (uint8_t *) mapped_data;
+	internal_file->io_handle->mapped_data_size  = (size64_t) file_statistics.st_size;
+	internal_file->io_handle->modification_time = (int64_t) file_statistics.st_mtime;
+
+	return( 1 );
+#else
+	return( 0 );
 #endif
-	if( libevtx_io_handle_read_file_header(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     0,
-	     error ) != 1 )
+}
+
+/* Unmaps a memory mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_unmap(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_unmap";
+	int result            = 1;
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->io_handle->chunks_data_size = file_size
-	                                           - internal_file->io_handle->chunks_data_offset;
-
-/* TODO clone function ? */
-	if( libfdata_vector_initialize(
-	     &( internal_file->chunks_vector ),
-	     (size64_t) internal_file->io_handle->chunk_size,
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_io_handle_read_chunk,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunks vector.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_vector_append_segment(
-	     internal_file->chunks_vector,
-	     &segment_index,
-	     0,
-	     internal_file->io_handle->chunks_data_offset,
-	     internal_file->io_handle->chunks_data_size,
-	     0,
-	     error ) != 1 )
+	if( internal_file->io_handle->mapped_data != NULL )
+	{
+#if defined( HAVE_LIBEVTX_MEMORY_MAPPED_FILE )
+		/* Data provided by the caller is not unmapped
+		 */
+		if( ( internal_file->mapped_data_is_external == 0 )
+		 && ( munmap(
+		       (void *) internal_file->io_handle->mapped_data,
+		       (size_t) internal_file->io_handle->mapped_data_size ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file data.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		internal_file->io_handle->mapped_data      = NULL;
+		internal_file->io_handle->mapped_data_size = 0;
+		internal_file->mapped_data_is_external     = 0;
+	}
+	return( result );
+}
+
+/* Sets the executor that runs the asynchronous requests
+ * The executor is called with the function to run and its arguments and
+ * must return 1 if the function was scheduled or -1 on error
+ * If no executor is set every asynchronous request runs on its own thread
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_async_executor(
+     libevtx_file_t *file,
+     int (*executor)(
+            void (*function)(
+                   void *arguments ),
+            void *arguments,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_async_executor";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to chunks vector.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->chunks_cache ),
-	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_CHUNKS,
-	     error ) != 1 )
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( executor != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunks cache.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: asynchronous executor not supported without multi-threading support.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading chunks:\n" );
+		return( -1 );
 	}
 #endif
-	if( libevtx_chunks_table_initialize(
-	     &chunks_table,
-	     internal_file->io_handle,
-	     internal_file->chunks_vector,
-	     internal_file->chunks_cache,
-	     error ) != 1 )
+	internal_file->async_executor           = executor;
+	internal_file->async_executor_user_data = user_data;
+
+	return( 1 );
+}
+
+/* Runs an asynchronous request and signals its completion
+ * The request is not accessed after its completion was signalled
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_async_worker_function(
+     void *arguments )
+{
+	libevtx_async_request_t *async_request = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libevtx_internal_file_t *internal_file = NULL;
+#endif
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	async_request = (libevtx_async_request_t *) arguments;
+
+	result = libevtx_async_request_run(
+	          async_request );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	internal_file = (libevtx_internal_file_t *) async_request->file;
+
+	if( libcthreads_mutex_grab(
+	     internal_file->async_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	internal_file->number_of_pending_async_requests -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     internal_file->async_condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_file->async_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Runs an asynchronous request on an executor thread
+ */
+void libevtx_internal_file_async_executor_function(
+      void *arguments )
+{
+	libevtx_internal_file_async_worker_function(
+	 arguments );
+}
+
+/* Submits an asynchronous request
+ * The file takes ownership of the request, also on error
+ * Without multi-threading support the request is run on the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_submit_async_request(
+     libevtx_internal_file_t *internal_file,
+     libevtx_async_request_t *async_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_submit_async_request";
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int entry_index       = 0;
+#endif
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunks table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		goto on_error;
 	}
-/* TODO clone function ? */
-	if( libfdata_list_initialize(
-	     &( internal_file->records_list ),
-	     (intptr_t *) chunks_table,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunks_table_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfcache_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	if( async_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->async_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
 		 function );
 
 		goto on_error;
 	}
-	/* The chunks_table is managed by the list */
-
-	if( libfdata_list_initialize(
-	     &( internal_file->recovered_records_list ),
-	     (intptr_t *) chunks_table,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfcache_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	if( libcdata_array_append_entry(
+	     internal_file->async_requests_array,
+	     &entry_index,
+	     (intptr_t *) async_request,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create recovered records list.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append asynchronous request to array.",
 		 function );
 
-		chunks_table = NULL;
+		libcthreads_mutex_release(
+		 internal_file->async_mutex,
+		 NULL );
 
 		goto on_error;
 	}
-	chunks_table = NULL;
+	/* The array now owns the request
+	 */
+	internal_file->number_of_pending_async_requests += 1;
 
-	if( libfcache_cache_initialize(
-	     &( internal_file->records_cache ),
-	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS,
+	if( libcthreads_mutex_release(
+	     internal_file->async_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records cache.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	file_offset = internal_file->io_handle->chunks_data_offset;
-
-	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	if( internal_file->async_executor != NULL )
 	{
-		if( libevtx_chunk_initialize(
-		     &chunk,
-		     error ) != 1 )
+		result = internal_file->async_executor(
+		          &libevtx_internal_file_async_executor_function,
+		          (void *) async_request,
+		          internal_file->async_executor_user_data );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create chunk: %" PRIu16 ".",
-			 function,
-			 chunk_index );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to schedule asynchronous request.",
+			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		result = libevtx_chunk_read(
-		          chunk,
-		          internal_file->io_handle,
-		          file_io_handle,
-		          file_offset,
+	}
+	else
+	{
+		result = libcthreads_thread_create(
+		          &( async_request->thread ),
+		          NULL,
+		          (int (*)(void *)) &libevtx_internal_file_async_worker_function,
+		          (void *) async_request,
 		          error );
 
-		if( result == -1 )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read chunk: %" PRIu16 ".",
-			 function,
-			 chunk_index );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread.",
+			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		else if( result == 0 )
+	}
+	if( result != 1 )
+	{
+		/* The request was not started and is freed by libevtx_file_wait_async
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_file->async_mutex,
+		     NULL ) == 1 )
 		{
-			if( chunk_index < internal_file->io_handle->number_of_chunks )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
-					 function,
-					 chunk_index );
-				}
-#endif
-				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
-			}
+			internal_file->number_of_pending_async_requests -= 1;
+
+			libcthreads_mutex_release(
+			 internal_file->async_mutex,
+			 NULL );
 		}
-		else
-		{
-			if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
-					 function,
-					 chunk_index );
-				}
-#endif
-				if( chunk_index < internal_file->io_handle->number_of_chunks )
-				{
-					internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
-				}
-			}
-			if( ( chunk_index < internal_file->io_handle->number_of_chunks )
-			 || ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 ) )
-			{
-				number_of_chunks++;
-			}
-			if( libevtx_chunk_get_number_of_records(
-			     chunk,
-			     &number_of_records,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu16 " number of records.",
-				 function,
-				 chunk_index );
+		return( -1 );
+	}
+#else
+	libevtx_internal_file_async_worker_function(
+	 (void *) async_request );
 
-				goto on_error;
-			}
-			for( record_index = 0;
-			     record_index < number_of_records;
-			     record_index++ )
-			{
-				if( libevtx_chunk_get_record(
-				     chunk,
-				     record_index,
-				     &record_values,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
+	if( libevtx_async_request_free(
+	     &async_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free asynchronous request.",
+		 function );
 
-					goto on_error;
-				}
-				if( record_values == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing chunk: %" PRIu16 " record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
+		result = -1;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
-					goto on_error;
-				}
-				if( record_values->identifier < internal_file->io_handle->first_record_identifier )
-				{
-					internal_file->io_handle->first_record_identifier = record_values->identifier;
-				}
-				if( record_values->identifier > internal_file->io_handle->last_record_identifier )
-				{
-					internal_file->io_handle->last_record_identifier = record_values->identifier;
-				}
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( ( chunk_index == 0 )
-				 && ( record_index == 0 ) )
-				{
-					previous_record_identifier = record_values->identifier;
-				}
-				else
-				{
-					previous_record_identifier++;
+	return( result );
 
-					if( record_values->identifier != previous_record_identifier )
-					{
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: detected gap in record identifier ( %" PRIu64 " != %" PRIu64 " ).\n",
-							 function,
-							 previous_record_identifier,
-							 record_values->identifier );
-						}
-						previous_record_identifier = record_values->identifier;
-					}
-				}
-#endif
-				/* The chunk index is stored in the element data size
-				 */
-				if( ( chunk_index < internal_file->io_handle->number_of_chunks )
-				 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
-				{
-					if( libfdata_list_append_element(
-					     internal_file->records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to records list.",
-						 function );
+on_error:
+	libevtx_async_request_free(
+	 &async_request,
+	 NULL );
 
-						goto on_error;
-					}
-				}
+	return( -1 );
+}
+
+/* Opens a file asynchronously
+ * The callback is called with the result of libevtx_file_open when the open completes
+ * The file must not be used until the callback was called
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_open_async(
+     libevtx_file_t *file,
+     const char *filename,
+     int access_flags,
+     void (*callback)(
+             libevtx_file_t *file,
+             int result,
+             libcerror_error_t *error,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_async_request_t *async_request = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_open_async";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_async_request_initialize(
+	     &async_request,
+	     file,
+	     LIBEVTX_ASYNC_REQUEST_TYPE_OPEN,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create asynchronous request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_async_request_set_filename(
+	     async_request,
+	     filename,
+	     narrow_string_length(
+	      filename ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in asynchronous request.",
+		 function );
+
+		goto on_error;
+	}
+	async_request->access_flags  = access_flags;
+	async_request->open_callback = callback;
+	async_request->user_data     = user_data;
+
+	if( libevtx_internal_file_submit_async_request(
+	     internal_file,
+	     async_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to submit asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( async_request != NULL )
+	{
+		libevtx_async_request_free(
+		 &async_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file asynchronously
+ * The callback is called with the result of libevtx_file_open_wide when the open completes
+ * The file must not be used until the callback was called
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_open_async_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     int access_flags,
+     void (*callback)(
+             libevtx_file_t *file,
+             int result,
+             libcerror_error_t *error,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_async_request_t *async_request = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_open_async_wide";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_async_request_initialize(
+	     &async_request,
+	     file,
+	     LIBEVTX_ASYNC_REQUEST_TYPE_OPEN,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create asynchronous request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_async_request_set_filename_wide(
+	     async_request,
+	     filename,
+	     wide_string_length(
+	      filename ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in asynchronous request.",
+		 function );
+
+		goto on_error;
+	}
+	async_request->access_flags  = access_flags;
+	async_request->open_callback = callback;
+	async_request->user_data     = user_data;
+
+	if( libevtx_internal_file_submit_async_request(
+	     internal_file,
+	     async_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to submit asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( async_request != NULL )
+	{
+		libevtx_async_request_free(
+		 &async_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves records asynchronously
+ * The callback is called with batches of at most LIBEVTX_ASYNC_RECORDS_BATCH_SIZE records
+ * and takes ownership of the records, it returns 1 to continue, 0 to stop or -1 on error
+ * The last call has is_last_batch set, on error the callback is called once with the error
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_records_async(
+     libevtx_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     int (*callback)(
+            libevtx_file_t *file,
+            libevtx_record_t **records,
+            int number_of_records,
+            int is_last_batch,
+            libcerror_error_t *error,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_async_request_t *async_request = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_records_async";
+	int number_of_file_records             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_file_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_index < 0 )
+	 || ( first_record_index > number_of_file_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_records > ( number_of_file_records - first_record_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_async_request_initialize(
+	     &async_request,
+	     file,
+	     LIBEVTX_ASYNC_REQUEST_TYPE_GET_RECORDS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	async_request->first_record_index = first_record_index;
+	async_request->number_of_records  = number_of_records;
+	async_request->records_callback   = callback;
+	async_request->user_data          = user_data;
+
+	if( libevtx_internal_file_submit_async_request(
+	     internal_file,
+	     async_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to submit asynchronous request.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits for the asynchronous requests of a file to complete
+ * and releases the resources of the completed requests
+ * This function must not be called from an asynchronous callback
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_wait_async(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libevtx_file_wait_async";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libevtx_internal_file_t *internal_file = NULL;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( libcthreads_mutex_grab(
+	     internal_file->async_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_file->number_of_pending_async_requests > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     internal_file->async_condition,
+		     internal_file->async_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 internal_file->async_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_file->async_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Freeing the requests joins their threads
+	 */
+	if( libcdata_array_empty(
+	     internal_file->async_requests_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_async_request_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty asynchronous requests array.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libevtx_file_close(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_close";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( libevtx_file_wait_async(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for asynchronous requests.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libevtx_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	if( internal_file->io_handle->mapped_data != NULL )
+	{
+		if( libevtx_internal_file_unmap(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->io_handle->chunk_prefetcher != NULL )
+	{
+		if( libevtx_chunk_prefetcher_free(
+		     &( internal_file->io_handle->chunk_prefetcher ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk prefetcher.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->io_handle->read_buffer != NULL )
+	{
+		if( libevtx_read_buffer_free(
+		     &( internal_file->io_handle->read_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->query_index != NULL )
+	{
+		if( libevtx_query_index_free(
+		     &( internal_file->query_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free query index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->identifier_index != NULL )
+	{
+		if( libevtx_identifier_index_free(
+		     &( internal_file->identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free identifier index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->borrowed_record != NULL )
+	{
+		/* The borrowed flag is cleared since the file releases the borrowed record
+		 */
+		( (libevtx_internal_record_t *) internal_file->borrowed_record )->flags &= ~LIBEVTX_RECORD_FLAG_BORROWED;
+
+		if( libevtx_record_free(
+		     &( internal_file->borrowed_record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free borrowed record.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->io_handle->async_reader != NULL )
+	{
+		if( libevtx_async_reader_free(
+		     &( internal_file->io_handle->async_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free asynchronous reader.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->io_handle->decoded_values_file != NULL )
+	{
+		if( libevtx_decoded_values_file_free(
+		     &( internal_file->io_handle->decoded_values_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoded values file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libevtx_io_handle_close_file_descriptor(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file descriptor.",
+		 function );
+
+		result = -1;
+	}
+	if( libevtx_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libfdata_list_free(
+	     &( internal_file->recovered_records_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered records list.",
+		 function );
+
+		result = -1;
+	}
+	if( libfdata_list_free(
+	     &( internal_file->records_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free records list.",
+		 function );
+
+		result = -1;
+	}
+	/* The chunks table is freed by the records list
+	 */
+	internal_file->chunks_table = NULL;
+
+	if( libfcache_cache_free(
+	     &( internal_file->records_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free records cache.",
+		 function );
+
+		result = -1;
+	}
+	/* The document cache is freed after the records cache and records list
+	 * since these release their record values into the document cache
+	 */
+	if( internal_file->document_cache != NULL )
+	{
+		if( libevtx_document_cache_free(
+		     &( internal_file->document_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free document cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfdata_vector_free(
+	     &( internal_file->chunks_vector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunks vector.",
+		 function );
+
+		result = -1;
+	}
+	if( libfcache_cache_free(
+	     &( internal_file->chunks_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunks cache.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->cache_file_identifier != -1 )
+	{
+		if( libevtx_internal_cache_detach_file(
+		     internal_file->cache,
+		     internal_file->cache_file_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to detach file from shared chunk cache.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->cache_file_identifier = -1;
+	}
+	if( internal_file->chunk_descriptors_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_file->chunk_descriptors_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk descriptors array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->chunk_written_time_ranges_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_file->chunk_written_time_ranges_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk written time ranges array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->pending_recovery_chunk_indexes != NULL )
+	{
+		memory_free(
+		 internal_file->pending_recovery_chunk_indexes );
+
+		internal_file->pending_recovery_chunk_indexes = NULL;
+	}
+	if( internal_file->identifier_gaps != NULL )
+	{
+		if( libevtx_identifier_gaps_free(
+		     &( internal_file->identifier_gaps ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free identifier gaps.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->recovered_records_filter != NULL )
+	{
+		if( libevtx_recovered_records_filter_free(
+		     &( internal_file->recovered_records_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovered records filter.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->number_of_pending_recovery_chunks     = 0;
+	internal_file->recovery_is_pending                   = 0;
+	internal_file->allocated_records_are_hashed          = 0;
+	internal_file->number_of_duplicate_recovered_records = 0;
+	internal_file->number_of_indexed_records             = 0;
+	internal_file->estimated_number_of_records           = 0;
+	internal_file->is_partition                          = 0;
+	internal_file->partition_first_chunk_index           = 0;
+	internal_file->partition_number_of_chunks            = 0;
+	internal_file->last_indexed_record_identifier = 0;
+	internal_file->access_flags                   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of processors that are available to run threads
+ * The number of processors is 1 if it cannot be determined
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_number_of_processors(
+     int *number_of_processors,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	SYSTEM_INFO system_information;
+#endif
+
+	static char *function = "libevtx_internal_file_get_number_of_processors";
+	long value            = 1;
+
+	if( number_of_processors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of processors.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	GetSystemInfo(
+	 &system_information );
+
+	value = (long) system_information.dwNumberOfProcessors;
+
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	value = sysconf(
+	         _SC_NPROCESSORS_ONLN );
+#endif
+	if( value < 1 )
+	{
+		value = 1;
+	}
+	else if( value > (long) INT_MAX )
+	{
+		value = (long) INT_MAX;
+	}
+	*number_of_processors = (int) value;
+
+	return( 1 );
+}
+
+/* Tunes the read-ahead depth and coalesced read size
+ * The time of a read is modelled as a fixed latency and a transfer time per chunk,
+ * these are derived from the time of single chunk reads and of a coalesced read
+ * of the chunks at the start of the file, which are read again while the file is opened
+ * Returns 1 if successful, 0 if the file contains too few chunks to measure or -1 on error
+ */
+int libevtx_internal_file_tune_read_parameters(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	uint8_t *read_data                = NULL;
+	static char *function             = "libevtx_internal_file_tune_read_parameters";
+	off64_t file_offset               = 0;
+	size64_t number_of_chunks         = 0;
+	size_t chunk_size                 = 0;
+	size_t maximum_number_of_chunks   = 0;
+	size_t number_of_coalesced_chunks = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	uint64_t coalesced_read_time      = 0;
+	uint64_t latency                  = 0;
+	uint64_t single_read_time         = 0;
+	uint64_t start_time               = 0;
+	uint64_t transfer_time            = 0;
+	int read_index                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_size  = (size_t) internal_file->io_handle->chunk_size;
+	file_offset = internal_file->io_handle->chunks_data_offset;
+
+	if( ( chunk_size == 0 )
+	 || ( file_offset < 0 )
+	 || ( (size64_t) file_offset >= file_size ) )
+	{
+		return( 0 );
+	}
+	number_of_chunks = ( file_size - (size64_t) file_offset ) / chunk_size;
+
+	if( number_of_chunks < ( LIBEVTX_AUTO_TUNING_NUMBER_OF_SINGLE_READS + LIBEVTX_AUTO_TUNING_NUMBER_OF_COALESCED_CHUNKS ) )
+	{
+		return( 0 );
+	}
+	read_size = chunk_size * LIBEVTX_AUTO_TUNING_NUMBER_OF_COALESCED_CHUNKS;
+
+	read_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * read_size );
+
+	if( read_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read data.",
+		 function );
+
+		goto on_error;
+	}
+	for( read_index = 0;
+	     read_index < LIBEVTX_AUTO_TUNING_NUMBER_OF_SINGLE_READS;
+	     read_index++ )
+	{
+		start_time = libevtx_statistics_get_time();
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              read_data,
+		              chunk_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) chunk_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		single_read_time += libevtx_statistics_get_time() - start_time;
+
+		file_offset += chunk_size;
+	}
+	single_read_time /= LIBEVTX_AUTO_TUNING_NUMBER_OF_SINGLE_READS;
+
+	start_time = libevtx_statistics_get_time();
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              read_data,
+	              read_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read coalesced chunks at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	coalesced_read_time = libevtx_statistics_get_time() - start_time;
+
+	memory_free(
+	 read_data );
+
+	read_data = NULL;
+
+	if( coalesced_read_time > single_read_time )
+	{
+		transfer_time = ( coalesced_read_time - single_read_time ) / ( LIBEVTX_AUTO_TUNING_NUMBER_OF_COALESCED_CHUNKS - 1 );
+	}
+	if( single_read_time > transfer_time )
+	{
+		latency = single_read_time - transfer_time;
+	}
+	internal_file->chunk_read_time = single_read_time;
+
+	/* When the transfer time is too small to be measured the defaults are retained
+	 */
+	if( transfer_time == 0 )
+	{
+		return( 1 );
+	}
+	/* The coalesced reads are sized for the latency to be a small part of the read time
+	 */
+	maximum_number_of_chunks = (size_t) LIBEVTX_MAXIMUM_COALESCED_READ_SIZE / chunk_size;
+
+	number_of_coalesced_chunks = (size_t) ( ( latency * LIBEVTX_AUTO_TUNING_LATENCY_FACTOR ) / transfer_time );
+
+	if( number_of_coalesced_chunks < 2 )
+	{
+		number_of_coalesced_chunks = 2;
+	}
+	else if( number_of_coalesced_chunks > maximum_number_of_chunks )
+	{
+		number_of_coalesced_chunks = maximum_number_of_chunks;
+	}
+	internal_file->coalesced_read_size = number_of_coalesced_chunks * chunk_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The chunks read ahead cover the chunks that can be transferred during the latency of a read
+	 */
+	if( ( latency / transfer_time ) >= (uint64_t) LIBEVTX_MAXIMUM_READ_AHEAD_DEPTH )
+	{
+		internal_file->read_ahead_depth = LIBEVTX_MAXIMUM_READ_AHEAD_DEPTH;
+	}
+	else
+	{
+		internal_file->read_ahead_depth = 1 + (int) ( latency / transfer_time );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: read latency\t\t\t: %" PRIu64 " ns\n",
+		 function,
+		 latency );
+
+		libcnotify_printf(
+		 "%s: chunk transfer time\t\t: %" PRIu64 " ns\n",
+		 function,
+		 transfer_time );
+
+		libcnotify_printf(
+		 "%s: read-ahead depth\t\t: %d\n",
+		 function,
+		 internal_file->read_ahead_depth );
+
+		libcnotify_printf(
+		 "%s: coalesced read size\t\t: %" PRIzu "\n",
+		 function,
+		 internal_file->coalesced_read_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( read_data != NULL )
+	{
+		memory_free(
+		 read_data );
+	}
+	return( -1 );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_open_read(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                   = NULL;
+	libevtx_chunk_batch_t *chunk_batch       = NULL;
+	libevtx_indexed_chunks_t *indexed_chunks = NULL;
+	libevtx_record_values_t *record_values   = NULL;
+	libevtx_chunks_table_t *chunks_table     = NULL;
+	const uint8_t *index_data                = NULL;
+	uint8_t *index_file_data                 = NULL;
+	static char *function                    = "libevtx_file_open_read";
+	off64_t file_offset                      = 0;
+	size64_t file_size                       = 0;
+	size64_t maximum_number_of_chunks        = 0;
+	size64_t partition_end_offset            = 0;
+	size_t index_data_size                   = 0;
+	size_t record_chunk_data_offset          = 0;
+	uint64_t record_hash                     = 0;
+	uint64_t record_identifier               = 0;
+	uint64_t record_written_time             = 0;
+	uint32_t record_data_size                = 0;
+	uint16_t chunk_index                     = 0;
+	uint16_t number_of_chunks                = 0;
+	uint16_t number_of_records               = 0;
+	uint16_t record_index                    = 0;
+	int element_index                        = 0;
+	int number_of_cache_entries              = 0;
+	int number_of_header_rereads             = 0;
+	int result                               = 0;
+	int segment_index                        = 0;
+	uint8_t index_file_was_read              = 0;
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+	uint64_t previous_record_identifier      = 0;
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int number_of_processors                 = 0;
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t *trailing_data                   = NULL;
+	size_t trailing_data_size                = 0;
+	ssize_t read_count                       = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunks_vector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunks vector already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunks_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunks cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - records list already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_records_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - recovered records list already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - records cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->document_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - document cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunk_descriptors_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunk descriptors array already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunk_written_time_ranges_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunk written time ranges array already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->abort = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	do
+	{
+		if( libevtx_io_handle_read_file_header(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file header.",
+			 function );
+
+			goto on_error;
+		}
+		/* In live mode the file header is re-read until its checksum matches
+		 * since it can be written while it is read
+		 */
+		if( ( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LIVE ) == 0 )
+		 || ( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_FILE_HEADER_CHECKSUM_MISMATCH ) == 0 )
+		 || ( number_of_header_rereads >= LIBEVTX_MAXIMUM_NUMBER_OF_CHUNK_REREADS ) )
+		{
+			break;
+		}
+		internal_file->io_handle->flags &= ~( LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED | LIBEVTX_IO_HANDLE_FLAG_FILE_HEADER_CHECKSUM_MISMATCH );
+
+		number_of_header_rereads++;
+	}
+	while( 1 );
+
+	internal_file->io_handle->chunks_data_size = file_size
+	                                           - internal_file->io_handle->chunks_data_offset;
+
+	/* The chunks of a partition are read up to the end of the partition
+	 * so that no data after the partition is read ahead
+	 */
+	partition_end_offset = file_size;
+
+	if( internal_file->is_partition != 0 )
+	{
+		file_offset = internal_file->io_handle->chunks_data_offset
+		            + ( (off64_t) internal_file->partition_first_chunk_index * internal_file->io_handle->chunk_size );
+
+		if( (size64_t) ( file_offset + internal_file->io_handle->chunk_size ) > file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid partition first chunk index value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		partition_end_offset = (size64_t) file_offset
+		                     + ( (size64_t) internal_file->partition_number_of_chunks * internal_file->io_handle->chunk_size );
+
+		if( partition_end_offset > file_size )
+		{
+			partition_end_offset = file_size;
+
+			internal_file->partition_number_of_chunks = (uint16_t) ( ( partition_end_offset - (size64_t) file_offset )
+			                                          / internal_file->io_handle->chunk_size );
+		}
+	}
+	if( internal_file->io_handle->async_reader != NULL )
+	{
+		if( libevtx_async_reader_set_file_size(
+		     internal_file->io_handle->async_reader,
+		     partition_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set asynchronous reader file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_file->auto_tuning != 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* The number of threads is the upper bound of the number of threads
+		 * that is tuned while the chunks are read
+		 */
+		if( libevtx_internal_file_get_number_of_processors(
+		     &number_of_processors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of processors.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_processors > LIBEVTX_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			number_of_processors = LIBEVTX_MAXIMUM_NUMBER_OF_THREADS;
+		}
+		internal_file->number_of_threads = number_of_processors;
+#endif
+		/* Memory mapped chunks and chunks read asynchronously
+		 * do not use read-ahead or coalesced reads
+		 */
+		if( ( internal_file->io_handle->mapped_data == NULL )
+		 && ( internal_file->io_handle->async_reader == NULL ) )
+		{
+			if( libevtx_internal_file_tune_read_parameters(
+			     internal_file,
+			     file_io_handle,
+			     file_size,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to tune read parameters.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* In recovered only mode the chunks skip the allocated records
+	 * and only scan their free space
+	 */
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_RECOVERED_ONLY;
+	}
+	/* In no cache mode the chunks are released from the page cache
+	 * after they have been read
+	 */
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_NO_CACHE ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_NO_CACHE;
+	}
+	/* In deferred recovery mode the free space of the chunks is scanned
+	 * when the recovered records are first accessed
+	 */
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_DEFERRED_RECOVERY ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_DEFERRED_RECOVERY;
+	}
+	/* In live mode the chunks are re-read until they are consistent
+	 * with the first consistent read of the chunk
+	 */
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LIVE ) != 0 )
+	{
+		if( libevtx_io_handle_reset_live_chunk_record_identifiers(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to reset live chunk record identifiers.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_LIVE;
+	}
+	/* With value filters the EventData values of the records of a chunk
+	 * are added to a Bloom filter when the records of the chunk are read
+	 */
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_VALUE_FILTERS ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS;
+	}
+	/* With XML transcoding the XML string of a record is formatted directly
+	 * from the binary XML instead of from the XML document
+	 */
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_TRANSCODE_XML ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_TRANSCODE_XML;
+	}
+
+/* TODO clone function ? */
+	if( libfdata_vector_initialize(
+	     &( internal_file->chunks_vector ),
+	     (size64_t) internal_file->io_handle->chunk_size,
+	     (intptr_t *) internal_file->io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_io_handle_read_chunk,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     internal_file->chunks_vector,
+	     &segment_index,
+	     0,
+	     internal_file->io_handle->chunks_data_offset,
+	     internal_file->io_handle->chunks_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to chunks vector.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_cache_entries = internal_file->maximum_number_of_cached_chunks;
+
+	if( ( internal_file->maximum_cache_size != 0 )
+	 && ( internal_file->io_handle->chunk_size != 0 ) )
+	{
+		maximum_number_of_chunks = internal_file->maximum_cache_size / internal_file->io_handle->chunk_size;
+
+		if( maximum_number_of_chunks == 0 )
+		{
+			maximum_number_of_chunks = 1;
+		}
+		if( maximum_number_of_chunks < (size64_t) number_of_cache_entries )
+		{
+			number_of_cache_entries = (int) maximum_number_of_chunks;
+		}
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->chunks_cache ),
+	     number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->cache != NULL )
+	{
+		if( libevtx_internal_cache_attach_file(
+		     internal_file->cache,
+		     &( internal_file->cache_file_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to attach file to shared chunk cache.",
+			 function );
+
+			goto on_error;
+		}
+		/* Files that share a chunk cache also share their template skeletons
+		 */
+		internal_file->io_handle->shared_template_cache = internal_file->cache->template_cache;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading chunks:\n" );
+	}
+#endif
+	if( libevtx_chunks_table_initialize(
+	     &chunks_table,
+	     internal_file->io_handle,
+	     internal_file->chunks_vector,
+	     internal_file->chunks_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks table.",
+		 function );
+
+		goto on_error;
+	}
+	chunks_table->cache                 = internal_file->cache;
+	chunks_table->cache_file_identifier = internal_file->cache_file_identifier;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_file->background_decode_depth > 0 )
+	{
+		if( libevtx_record_decoder_initialize(
+		     &( chunks_table->record_decoder ),
+		     (size_t) internal_file->io_handle->chunk_size,
+		     internal_file->background_decode_depth,
+		     internal_file->number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record decoder.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	internal_file->chunks_table = chunks_table;
+
+/* TODO clone function ? */
+	if( libfdata_list_initialize(
+	     &( internal_file->records_list ),
+	     (intptr_t *) chunks_table,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunks_table_free,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfcache_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records list.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks_table is managed by the list */
+
+	if( libfdata_list_initialize(
+	     &( internal_file->recovered_records_list ),
+	     (intptr_t *) chunks_table,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfcache_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered records list.",
+		 function );
+
+		chunks_table = NULL;
+
+		goto on_error;
+	}
+	chunks_table = NULL;
+
+	if( libfcache_cache_initialize(
+	     &( internal_file->records_cache ),
+	     internal_file->maximum_number_of_cached_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records cache.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->number_of_records_cache_entries = internal_file->maximum_number_of_cached_records;
+
+	if( internal_file->maximum_document_cache_size != 0 )
+	{
+		if( libevtx_document_cache_initialize(
+		     &( internal_file->document_cache ),
+		     internal_file->maximum_document_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create document cache.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->chunks_table->document_cache = internal_file->document_cache;
+	}
+
+	if( libcdata_array_initialize(
+	     &( internal_file->chunk_written_time_ranges_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk written time ranges array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Memory mapped chunks are not copied hence there is nothing to read ahead
+	 * Chunks read asynchronously are already read ahead
+	 */
+	if( ( internal_file->read_ahead_depth > 0 )
+	 && ( internal_file->io_handle->mapped_data == NULL )
+	 && ( internal_file->io_handle->async_reader == NULL ) )
+	{
+		if( libevtx_chunk_prefetcher_initialize(
+		     &( internal_file->io_handle->chunk_prefetcher ),
+		     file_io_handle,
+		     (size_t) internal_file->io_handle->chunk_size,
+		     partition_end_offset,
+		     internal_file->read_ahead_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk prefetcher.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* Chunks read ahead or read asynchronously are already read in the background
+	 * hence their reads are not coalesced
+	 */
+	if( ( internal_file->coalesced_read_size >= ( 2 * (size_t) internal_file->io_handle->chunk_size ) )
+	 && ( internal_file->io_handle->mapped_data == NULL )
+	 && ( internal_file->io_handle->chunk_prefetcher == NULL )
+	 && ( internal_file->io_handle->async_reader == NULL ) )
+	{
+		if( libevtx_read_buffer_initialize(
+		     &( internal_file->io_handle->read_buffer ),
+		     file_io_handle,
+		     (size_t) internal_file->io_handle->chunk_size,
+		     partition_end_offset,
+		     internal_file->coalesced_read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_offset = internal_file->io_handle->chunks_data_offset
+	            + ( (off64_t) internal_file->partition_first_chunk_index * internal_file->io_handle->chunk_size );
+
+	chunk_index = internal_file->partition_first_chunk_index;
+
+	/* The index does not retain which recovered records duplicate allocated records
+	 * hence it is not used when these are dropped. The index contains the records
+	 * of the whole file hence it is not used for a partition either
+	 */
+	if( ( ( internal_file->access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_HEADER_ONLY | LIBEVTX_ACCESS_FLAG_DEDUPLICATE_RECOVERED ) ) == 0 )
+	 && ( internal_file->is_partition == 0 )
+	 && ( ( internal_file->index_data != NULL )
+	  || ( internal_file->index_file_io_handle != NULL ) ) )
+	{
+		/* Index data that was provided by the caller takes precedence over the index file
+		 */
+		if( internal_file->index_data != NULL )
+		{
+			index_data      = internal_file->index_data;
+			index_data_size = internal_file->index_data_size;
+
+			result = 1;
+		}
+		else
+		{
+			result = libevtx_index_file_read_file_data(
+			          internal_file->index_file_io_handle,
+			          &index_file_data,
+			          &index_data_size,
+			          error );
+
+			index_data = index_file_data;
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index file data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = libevtx_index_file_read_data(
+			          index_data,
+			          index_data_size,
+			          internal_file->io_handle,
+			          file_size,
+			          internal_file->records_list,
+			          internal_file->recovered_records_list,
+			          internal_file->chunk_written_time_ranges_array,
+			          &( internal_file->last_indexed_record_identifier ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read index.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				/* The records were read from the index file hence the chunks are not read
+				 */
+				file_offset = internal_file->io_handle->chunks_data_offset
+				            + internal_file->io_handle->chunks_data_size;
+
+				index_file_was_read = 1;
+
+				/* The index contains the recovered records hence there is no need
+				 * to defer scanning the free space
+				 */
+				internal_file->io_handle->flags &= ~( LIBEVTX_IO_HANDLE_FLAG_DEFERRED_RECOVERY );
+			}
+			else
+			{
+				/* The index is stale, e.g. because chunks were added or changed,
+				 * hence only the chunks that did not change are taken from the index
+				 */
+				if( libevtx_indexed_chunks_initialize(
+				     &indexed_chunks,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create indexed chunks.",
+					 function );
+
+					goto on_error;
+				}
+				result = libevtx_index_file_read_indexed_chunks(
+				          index_data,
+				          index_data_size,
+				          internal_file->io_handle,
+				          indexed_chunks,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read indexed chunks.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					if( libevtx_indexed_chunks_free(
+					     &indexed_chunks,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free indexed chunks.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				else
+				{
+					/* The recovered records of the chunks that did not change are in the index
+					 * and those of the other chunks are scanned when these are read
+					 */
+					internal_file->io_handle->flags &= ~( LIBEVTX_IO_HANDLE_FLAG_DEFERRED_RECOVERY );
+				}
+			}
+		}
+		if( index_file_data != NULL )
+		{
+			memory_free(
+			 index_file_data );
+
+			index_file_data = NULL;
+		}
+		index_data = NULL;
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	{
+		/* Only the chunk headers are read, the records are enumerated
+		 * when their corresponding chunk is first accessed
+		 */
+		if( libevtx_file_read_chunk_descriptors(
+		     internal_file,
+		     file_io_handle,
+		     file_size,
+		     &file_offset,
+		     &number_of_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk descriptors.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_HEADER_ONLY ) != 0 )
+	{
+		/* Only the headers of the oldest and newest chunk are read
+		 * to estimate the number of records, the records are not available
+		 */
+		if( libevtx_file_read_estimated_number_of_records(
+		     internal_file,
+		     file_io_handle,
+		     file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read estimated number of records.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset = internal_file->io_handle->chunks_data_offset
+		            + internal_file->io_handle->chunks_data_size;
+
+		number_of_chunks = internal_file->io_handle->number_of_chunks;
+	}
+	else if( index_file_was_read == 0 )
+	{
+		/* The chunks are not read in batches when the chunks that did not change
+		 * are taken from the index, since these are skipped one at a time
+		 */
+		if( ( internal_file->number_of_threads > 1 )
+		 && ( indexed_chunks == NULL ) )
+		{
+			/* The chunks are read and parsed in batches by multiple threads
+			 * and the records are added in chunk order
+			 */
+			if( libevtx_chunk_batch_initialize(
+			     &chunk_batch,
+			     internal_file->io_handle,
+			     file_io_handle,
+			     internal_file->number_of_threads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk batch.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_file->auto_tuning != 0 )
+			{
+				if( libevtx_chunk_batch_start_tuning(
+				     chunk_batch,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to start tuning chunk batch.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_DEFERRED_RECOVERY ) != 0 )
+		{
+			maximum_number_of_chunks = 0;
+
+			if( ( internal_file->io_handle->chunk_size != 0 )
+			 && ( (size64_t) file_offset < file_size ) )
+			{
+				maximum_number_of_chunks = ( file_size - file_offset ) / internal_file->io_handle->chunk_size;
+			}
+			if( maximum_number_of_chunks > (size64_t) UINT16_MAX + 1 )
+			{
+				maximum_number_of_chunks = (size64_t) UINT16_MAX + 1;
+			}
+			if( maximum_number_of_chunks > 0 )
+			{
+				internal_file->pending_recovery_chunk_indexes = (uint16_t *) memory_allocate(
+				                                                              sizeof( uint16_t ) * (size_t) maximum_number_of_chunks );
+
+				if( internal_file->pending_recovery_chunk_indexes == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create pending recovery chunk indexes.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			internal_file->number_of_pending_recovery_chunks = 0;
+			internal_file->recovery_is_pending               = 1;
+		}
+		/* The gaps in the record identifiers are determined while the records are indexed
+		 */
+		if( libevtx_identifier_gaps_initialize(
+		     &( internal_file->identifier_gaps ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create identifier gaps.",
+			 function );
+
+			goto on_error;
+		}
+		/* The recovered records are filtered after the allocated records of all
+		 * the chunks have been hashed
+		 */
+		if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_DEDUPLICATE_RECOVERED ) != 0 )
+		{
+			if( libevtx_recovered_records_filter_initialize(
+			     &( internal_file->recovered_records_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create recovered records filter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) partition_end_offset )
+		{
+			result = libevtx_internal_file_report_open_progress(
+			          internal_file,
+			          chunk_index,
+			          file_offset,
+			          file_size,
+			          0,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to report progress.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested at chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			/* The records of a file that has wrapped continue in the chunks
+			 * before the oldest chunk
+			 */
+			if( ( chunk_index != 0 )
+			 && ( chunk_index == internal_file->io_handle->first_chunk_number ) )
+			{
+				if( libevtx_identifier_gaps_start_segment(
+				     internal_file->identifier_gaps,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to start identifier gaps segment.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( indexed_chunks != NULL )
+			{
+				result = libevtx_internal_file_append_indexed_chunk(
+				          internal_file,
+				          indexed_chunks,
+				          file_io_handle,
+				          chunk_index,
+				          file_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append indexed chunk: %" PRIu16 ".",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					number_of_chunks++;
+
+					file_offset += internal_file->io_handle->chunk_size;
+
+					chunk_index++;
+
+					continue;
+				}
+			}
+			if( chunk_batch != NULL )
+			{
+				if( chunk_batch->next_chunk_index >= chunk_batch->number_of_chunks )
+				{
+					if( libevtx_chunk_batch_read(
+					     chunk_batch,
+					     file_offset,
+					     partition_end_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read chunk batch at offset: %" PRIi64 ".",
+						 function,
+						 file_offset );
+
+						goto on_error;
+					}
+				}
+				if( libevtx_chunk_batch_get_next_chunk(
+				     chunk_batch,
+				     &chunk,
+				     &result,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " from batch.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( libevtx_chunk_initialize(
+				     &chunk,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create chunk: %" PRIu16 ".",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				result = libevtx_chunk_read(
+				          chunk,
+				          internal_file->io_handle,
+				          file_io_handle,
+				          file_offset,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( chunk_index < internal_file->io_handle->number_of_chunks )
+				{
+#if defined( HAVE_VERBOSE_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: corruption detected in chunk: %" PRIu16 ".\n",
+						 function,
+						 chunk_index );
+					}
+#endif
+					internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+				}
+			}
+			else
+			{
+				if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+				{
+#if defined( HAVE_VERBOSE_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: corruption detected in chunk: %" PRIu16 ".\n",
+						 function,
+						 chunk_index );
+					}
+#endif
+					if( chunk_index < internal_file->io_handle->number_of_chunks )
+					{
+						internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+					}
+				}
+				if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+				 || ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 ) )
+				{
+					number_of_chunks++;
+				}
+				if( libevtx_chunk_get_number_of_records(
+				     chunk,
+				     &number_of_records,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " number of records.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				for( record_index = 0;
+				     record_index < number_of_records;
+				     record_index++ )
+				{
+					/* The record values are not created to index the records
+					 */
+					if( libevtx_chunk_get_record_identifier(
+					     chunk,
+					     record_index,
+					     &record_identifier,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 " identifier.",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+					if( libevtx_chunk_get_record_chunk_data_offset(
+					     chunk,
+					     record_index,
+					     &record_chunk_data_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 " chunk data offset.",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+					if( internal_file->recovered_records_filter != NULL )
+					{
+						if( libevtx_chunk_get_record_written_time(
+						     chunk,
+						     record_index,
+						     &record_written_time,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 " written time.",
+							 function,
+							 chunk_index,
+							 record_index );
+
+							goto on_error;
+						}
+						if( libevtx_chunk_get_record_data_size(
+						     chunk,
+						     record_index,
+						     &record_data_size,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 " data size.",
+							 function,
+							 chunk_index,
+							 record_index );
+
+							goto on_error;
+						}
+					}
+					if( record_identifier < internal_file->io_handle->first_record_identifier )
+					{
+						internal_file->io_handle->first_record_identifier = record_identifier;
+					}
+					if( record_identifier > internal_file->io_handle->last_record_identifier )
+					{
+						internal_file->io_handle->last_record_identifier = record_identifier;
+					}
+#if defined( HAVE_VERBOSE_OUTPUT )
+					if( ( chunk_index == 0 )
+					 && ( record_index == 0 ) )
+					{
+						previous_record_identifier = record_identifier;
+					}
+					else
+					{
+						previous_record_identifier++;
+
+						if( record_identifier != previous_record_identifier )
+						{
+							if( libcnotify_verbose != 0 )
+							{
+								libcnotify_printf(
+								 "%s: detected gap in record identifier ( %" PRIu64 " != %" PRIu64 " ).\n",
+								 function,
+								 previous_record_identifier,
+								 record_identifier );
+							}
+							previous_record_identifier = record_identifier;
+						}
+					}
+#endif
+					/* The chunk index and the index of the record within the chunk
+					 * are stored in the element data size
+					 */
+					if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+					 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+					{
+						if( record_identifier > internal_file->last_indexed_record_identifier )
+						{
+							internal_file->last_indexed_record_identifier = record_identifier;
+						}
+						if( libevtx_identifier_gaps_append_identifier(
+						     internal_file->identifier_gaps,
+						     record_identifier,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+							 "%s: unable to append record identifier to identifier gaps.",
+							 function );
+
+							goto on_error;
+						}
+						if( internal_file->recovered_records_filter != NULL )
+						{
+							if( libevtx_recovered_records_filter_calculate_hash(
+							     &record_hash,
+							     chunk->data,
+							     chunk->data_size,
+							     record_chunk_data_offset,
+							     (size_t) record_data_size,
+							     record_identifier,
+							     record_written_time,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_GENERIC,
+								 "%s: unable to calculate chunk: %" PRIu16 " record: %" PRIu16 " hash.",
+								 function,
+								 chunk_index,
+								 record_index );
+
+								goto on_error;
+							}
+							if( libevtx_recovered_records_filter_insert_allocated_record(
+							     internal_file->recovered_records_filter,
+							     record_hash,
+							     error ) == -1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+								 "%s: unable to insert chunk: %" PRIu16 " record: %" PRIu16 " hash in recovered records filter.",
+								 function,
+								 chunk_index,
+								 record_index );
+
+								goto on_error;
+							}
+						}
+						if( libfdata_list_append_element(
+						     internal_file->records_list,
+						     &element_index,
+						     0,
+						     file_offset + record_chunk_data_offset,
+						     (size64_t) chunk_index | ( (size64_t) record_index << LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ),
+						     0,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+							 "%s: unable to append element to records list.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					else
+					{
+						/* If the file is not dirty, records found in chunks outside the indicated
+						 * range are considered recovered
+						 */
+						if( libevtx_internal_file_append_recovered_record(
+						     internal_file,
+						     chunk,
+						     file_offset,
+						     record_chunk_data_offset,
+						     (size_t) record_data_size,
+						     record_identifier,
+						     record_written_time,
+						     (size64_t) chunk_index | ( (size64_t) record_index << LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ),
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+							 "%s: unable to append recovered record.",
+							 function );
+
+							goto on_error;
+						}
+					}
+	/* TODO cache record values ? */
+				}
+				if( libevtx_chunk_get_number_of_recovered_records(
+				     chunk,
+				     &number_of_records,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " number of recovered records.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				for( record_index = 0;
+				     record_index < number_of_records;
+				     record_index++ )
+				{
+					if( libevtx_chunk_get_recovered_record(
+					     chunk,
+					     record_index,
+					     &record_values,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+					if( record_values == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+					/* The chunk index and the index of the record within the chunk
+					 * are stored in the element data size
+					 */
+					if( libevtx_internal_file_append_recovered_record(
+					     internal_file,
+					     chunk,
+					     file_offset,
+					     record_values->chunk_data_offset,
+					     (size_t) record_values->data_size,
+					     record_values->identifier,
+					     record_values->written_time,
+					     (size64_t) chunk_index | ( (size64_t) record_index << LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ) | LIBEVTX_RECORD_ELEMENT_FLAG_RECOVERED,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append recovered record.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				/* The free space of the chunk is scanned when the recovered records
+				 * are first accessed
+				 */
+				if( ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_RECOVERY_IS_PENDING ) != 0 )
+				 && ( internal_file->pending_recovery_chunk_indexes != NULL )
+				 && ( (size64_t) internal_file->number_of_pending_recovery_chunks < maximum_number_of_chunks ) )
+				{
+					internal_file->pending_recovery_chunk_indexes[ internal_file->number_of_pending_recovery_chunks++ ] = chunk_index;
+				}
+				/* The records of the chunk have been parsed so the written time range
+				 * is determined here rather than when the chunk is first iterated
+				 */
+				if( libevtx_file_set_chunk_written_time_range(
+				     internal_file,
+				     chunk_index,
+				     chunk,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set chunk: %" PRIu16 " written time range.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				/* The summary of the chunk is stored in the index file so that
+				 * a query after a subsequent open can skip the chunk without reading it
+				 */
+				if( ( internal_file->index_file_io_handle != NULL )
+				 || ( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) != 0 ) )
+				{
+					if( libevtx_file_set_chunk_summary(
+					     internal_file,
+					     chunk_index,
+					     chunk,
+					     error ) == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set chunk: %" PRIu16 " summary.",
+						 function,
+						 chunk_index );
+
+						goto on_error;
+					}
+				}
+			}
+			file_offset += chunk->data_size;
+
+			/* The first chunks are handed to the chunks cache so that they
+			 * are not read and parsed again when their records are accessed
+			 */
+			if( ( result == 1 )
+			 && ( (int) ( chunk_index - internal_file->partition_first_chunk_index ) < number_of_cache_entries )
+			 && ( internal_file->cache_file_identifier != -1 ) )
+			{
+				if( libevtx_internal_cache_insert_chunk(
+				     internal_file->cache,
+				     internal_file->cache_file_identifier,
+				     chunk_index,
+				     chunk,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert chunk: %" PRIu16 " in shared chunk cache.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				/* The chunk is managed by the shared chunk cache
+				 */
+				chunk = NULL;
+			}
+			else if( ( result == 1 )
+			      && ( (int) ( chunk_index - internal_file->partition_first_chunk_index ) < number_of_cache_entries ) )
+			{
+				if( libfdata_vector_set_element_value_by_index(
+				     internal_file->chunks_vector,
+				     (intptr_t *) file_io_handle,
+				     internal_file->chunks_cache,
+				     (int) chunk_index,
+				     (intptr_t *) chunk,
+				     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_free,
+				     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set chunk: %" PRIu16 " as element value.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				/* The chunk is managed by the chunks cache
+				 */
+				chunk = NULL;
+			}
+			else if( libevtx_chunk_free(
+			          &chunk,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			chunk_index++;
+		}
+		if( libevtx_identifier_gaps_finalize(
+		     internal_file->identifier_gaps,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize identifier gaps.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_internal_file_filter_recovered_records(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to filter recovered records.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_batch != NULL )
+		{
+			/* The number of threads that gave the best throughput is used
+			 * for the reads after the file was opened
+			 */
+			if( internal_file->auto_tuning != 0 )
+			{
+				if( libevtx_chunk_batch_get_tuned_values(
+				     chunk_batch,
+				     &( internal_file->number_of_threads ),
+				     &( internal_file->chunk_decode_time ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve tuned values of chunk batch.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libevtx_chunk_batch_free(
+			     &chunk_batch,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk batch.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( indexed_chunks != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of chunks taken from index\t: %d\n",
+			 function,
+			 indexed_chunks->number_of_taken_chunks );
+		}
+#endif
+		if( libevtx_indexed_chunks_free(
+		     &indexed_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free indexed chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->io_handle->chunks_data_size = file_offset
+	                                           - internal_file->io_handle->chunks_data_offset;
+
+	result = libevtx_internal_file_report_open_progress(
+	          internal_file,
+	          chunk_index,
+	          file_offset,
+	          file_size,
+	          1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to report progress.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks of a partition are a subset of the chunks of the file
+	 * hence these are not compared with the number of chunks in the file header
+	 */
+	if( ( index_file_was_read == 0 )
+	 && ( internal_file->is_partition == 0 )
+	 && ( number_of_chunks != internal_file->io_handle->number_of_chunks ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu16 " ).\n",
+			 function,
+			 internal_file->io_handle->number_of_chunks,
+			 chunk_index );
+		}
+#endif
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+	/* The number of records of the whole file is estimated for a partition,
+	 * which only requires the headers of the oldest and newest chunk
+	 */
+	if( internal_file->is_partition != 0 )
+	{
+		if( libevtx_file_read_estimated_number_of_records(
+		     internal_file,
+		     file_io_handle,
+		     file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read estimated number of records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The index file is not written before the recovered records have been scanned,
+	 * nor when recovered records were dropped. The index file of a dirty file is
+	 * written as well since its chunks are compared with the index on every open
+	 */
+	if( ( ( internal_file->access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_DEFERRED_RECOVERY | LIBEVTX_ACCESS_FLAG_HEADER_ONLY | LIBEVTX_ACCESS_FLAG_DEDUPLICATE_RECOVERED ) ) == 0 )
+	 && ( internal_file->is_partition == 0 )
+	 && ( internal_file->index_file_io_handle != NULL )
+	 && ( index_file_was_read == 0 ) )
+	{
+		/* The index file only speeds up a subsequent open hence failing
+		 * to write it, e.g. due to a read-only directory, is not an error
+		 */
+		if( libevtx_index_file_write(
+		     internal_file->index_file_io_handle,
+		     internal_file->io_handle,
+		     file_size,
+		     internal_file->records_list,
+		     internal_file->recovered_records_list,
+		     internal_file->chunk_written_time_ranges_array,
+		     internal_file->last_indexed_record_identifier,
+		     NULL ) != 1 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to write index file.\n",
+				 function );
+			}
+#endif
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( file_offset < (off64_t) file_size )
+		{
+			trailing_data_size = (size_t) ( file_size - file_offset );
+
+			trailing_data = (uint8_t *) memory_allocate(
+			                             sizeof( uint8_t ) * trailing_data_size );
+
+			if( trailing_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create trailing data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     file_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek trailing data offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
+
+				memory_free(
+				 trailing_data );
+
+				trailing_data = NULL;
+
+				goto on_error;
+			}
+			read_count = libbfio_handle_read_buffer(
+				      file_io_handle,
+				      trailing_data,
+				      trailing_data_size,
+				      error );
+
+			if( read_count != (ssize_t) trailing_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trailing data.",
+				 function );
+
+				memory_free(
+				 trailing_data );
+
+				goto on_error;
+			}
+			file_offset += read_count;
+
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 trailing_data,
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			memory_free(
+			 trailing_data );
+
+			trailing_data = NULL;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( trailing_data != NULL )
+	{
+		memory_free(
+		 trailing_data );
+	}
+#endif
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( chunk_batch != NULL )
+	{
+		libevtx_chunk_batch_free(
+		 &chunk_batch,
+		 NULL );
+	}
+	if( indexed_chunks != NULL )
+	{
+		libevtx_indexed_chunks_free(
+		 &indexed_chunks,
+		 NULL );
+	}
+	if( index_file_data != NULL )
+	{
+		memory_free(
+		 index_file_data );
+	}
+	if( internal_file->io_handle->chunk_prefetcher != NULL )
+	{
+		libevtx_chunk_prefetcher_free(
+		 &( internal_file->io_handle->chunk_prefetcher ),
+		 NULL );
+	}
+	if( internal_file->io_handle->read_buffer != NULL )
+	{
+		libevtx_read_buffer_free(
+		 &( internal_file->io_handle->read_buffer ),
+		 NULL );
+	}
+	if( internal_file->chunk_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_file->chunk_descriptors_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		 NULL );
+	}
+	if( internal_file->chunk_written_time_ranges_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_file->chunk_written_time_ranges_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		 NULL );
+	}
+	if( internal_file->pending_recovery_chunk_indexes != NULL )
+	{
+		memory_free(
+		 internal_file->pending_recovery_chunk_indexes );
+
+		internal_file->pending_recovery_chunk_indexes = NULL;
+	}
+	if( internal_file->identifier_gaps != NULL )
+	{
+		libevtx_identifier_gaps_free(
+		 &( internal_file->identifier_gaps ),
+		 NULL );
+	}
+	if( internal_file->recovered_records_filter != NULL )
+	{
+		libevtx_recovered_records_filter_free(
+		 &( internal_file->recovered_records_filter ),
+		 NULL );
+	}
+	internal_file->number_of_pending_recovery_chunks     = 0;
+	internal_file->recovery_is_pending                   = 0;
+	internal_file->allocated_records_are_hashed          = 0;
+	internal_file->number_of_duplicate_recovered_records = 0;
+	internal_file->number_of_indexed_records             = 0;
+	internal_file->estimated_number_of_records           = 0;
+
+	if( internal_file->records_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->records_cache ),
+		 NULL );
+	}
+	if( internal_file->records_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_file->records_list ),
+		 NULL );
+	}
+	if( chunks_table != NULL )
+	{
+		libevtx_chunks_table_free(
+		 &chunks_table,
+		 NULL );
+	}
+	internal_file->chunks_table = NULL;
+
+	/* The document cache is freed after the records cache and records list
+	 * since these release their record values into the document cache
+	 */
+	if( internal_file->document_cache != NULL )
+	{
+		libevtx_document_cache_free(
+		 &( internal_file->document_cache ),
+		 NULL );
+	}
+	if( internal_file->chunks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->chunks_cache ),
+		 NULL );
+	}
+	if( internal_file->cache_file_identifier != -1 )
+	{
+		libevtx_internal_cache_detach_file(
+		 internal_file->cache,
+		 internal_file->cache_file_identifier,
+		 NULL );
+
+		internal_file->cache_file_identifier = -1;
+	}
+	if( internal_file->chunks_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &( internal_file->chunks_vector ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the chunk descriptors
+ * Only the chunk headers are read to determine the records stored in the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_read_chunk_descriptors(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     off64_t *file_offset,
+     uint16_t *number_of_chunks,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_file_read_chunk_descriptors";
+	uint16_t chunk_index                         = 0;
+	int entry_index                              = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunk_descriptors_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunk descriptors array already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->chunk_descriptors_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->number_of_indexed_records = 0;
+
+	while( ( *file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	{
+		result = libevtx_internal_file_report_open_progress(
+		          internal_file,
+		          chunk_index,
+		          *file_offset,
+		          file_size,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report progress.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested at chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( libevtx_chunk_descriptor_initialize(
+		     &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk descriptor: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunk_descriptor->chunk_index = chunk_index;
+
+		result = libevtx_chunk_descriptor_read_file_io_handle(
+		          chunk_descriptor,
+		          internal_file->io_handle,
+		          file_io_handle,
+		          *file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk descriptor: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( chunk_index < internal_file->io_handle->number_of_chunks )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
+					 function,
+					 chunk_index );
+				}
+#endif
+				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+			}
+		}
+		else
+		{
+			if( ( chunk_descriptor->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
+					 function,
+					 chunk_index );
+				}
+#endif
+				if( chunk_index < internal_file->io_handle->number_of_chunks )
+				{
+					internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+				}
+			}
+			if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+			 || ( ( chunk_descriptor->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 ) )
+			{
+				*number_of_chunks += 1;
+			}
+			/* If the file is not dirty, records found in chunks outside the indicated
+			 * range are considered recovered and are not indexed
+			 */
+			if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+			 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+			{
+				if( chunk_descriptor->number_of_records > (uint32_t) ( INT_MAX - internal_file->number_of_indexed_records ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid number of records value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				if( chunk_descriptor->number_of_records > 0 )
+				{
+					if( chunk_descriptor->first_record_identifier < internal_file->io_handle->first_record_identifier )
+					{
+						internal_file->io_handle->first_record_identifier = chunk_descriptor->first_record_identifier;
+					}
+					if( chunk_descriptor->last_record_identifier > internal_file->io_handle->last_record_identifier )
+					{
+						internal_file->io_handle->last_record_identifier = chunk_descriptor->last_record_identifier;
+					}
+				}
+				chunk_descriptor->first_record_index = internal_file->number_of_indexed_records;
+
+				internal_file->number_of_indexed_records += (int) chunk_descriptor->number_of_records;
+
+				if( libcdata_array_append_entry(
+				     internal_file->chunk_descriptors_array,
+				     &entry_index,
+				     (intptr_t *) chunk_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append chunk descriptor: %" PRIu16 " to array.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				chunk_descriptor = NULL;
+			}
+		}
+		if( chunk_descriptor != NULL )
+		{
+			if( libevtx_chunk_descriptor_free(
+			     &chunk_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk descriptor: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		*file_offset += internal_file->io_handle->chunk_size;
+
+		chunk_index++;
+	}
+	return( 1 );
+
+on_error:
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	if( internal_file->chunk_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_file->chunk_descriptors_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		 NULL );
+	}
+	internal_file->number_of_indexed_records = 0;
+
+	return( -1 );
+}
+
+/* Estimates the number of records from the file header and the headers of the oldest and newest chunk
+ * The chunk headers take precedence over the file header, since the file header is not
+ * updated while the file is dirty
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_read_estimated_number_of_records(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_file_read_estimated_number_of_records";
+	off64_t file_offset                          = 0;
+	uint64_t first_record_identifier             = 0;
+	uint64_t next_record_identifier              = 0;
+	uint64_t number_of_records                   = 0;
+	uint16_t chunk_number                        = 0;
+	int chunk_iterator                           = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Record identifiers start at 1
+	 */
+	first_record_identifier = 1;
+	next_record_identifier  = internal_file->io_handle->next_record_identifier;
+
+	if( internal_file->io_handle->number_of_chunks > 0 )
+	{
+		/* The first iteration reads the header of the oldest chunk
+		 * and the second iteration the header of the newest chunk
+		 */
+		for( chunk_iterator = 0;
+		     chunk_iterator < 2;
+		     chunk_iterator++ )
+		{
+			if( chunk_iterator == 0 )
+			{
+				chunk_number = internal_file->io_handle->first_chunk_number;
+			}
+			else
+			{
+				chunk_number = internal_file->io_handle->last_chunk_number;
+			}
+			file_offset = internal_file->io_handle->chunks_data_offset
+			            + ( (off64_t) chunk_number * internal_file->io_handle->chunk_size );
+
+			if( ( file_offset + internal_file->io_handle->chunk_size ) > (off64_t) file_size )
+			{
+				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+
+				continue;
+			}
+			if( libevtx_chunk_descriptor_initialize(
+			     &chunk_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			result = libevtx_chunk_descriptor_read_file_io_handle(
+			          chunk_descriptor,
+			          internal_file->io_handle,
+			          file_io_handle,
+			          file_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk descriptor: %" PRIu16 ".",
+				 function,
+				 chunk_number );
+
+				goto on_error;
+			}
+			else if( ( result == 0 )
+			      || ( ( chunk_descriptor->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 ) )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
+					 function,
+					 chunk_number );
+				}
+#endif
+				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+			}
+			else if( chunk_descriptor->number_of_records > 0 )
+			{
+				if( chunk_iterator == 0 )
+				{
+					first_record_identifier = chunk_descriptor->first_record_identifier;
+				}
 				else
 				{
-					/* If the file is not dirty, records found in chunks outside the indicated
-					 * range are considered recovered
-					 */
-					if( libfdata_list_append_element(
-					     internal_file->recovered_records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
-					     0,
-					     error ) != 1 )
+					next_record_identifier = chunk_descriptor->last_record_identifier + 1;
+				}
+			}
+			if( libevtx_chunk_descriptor_free(
+			     &chunk_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk descriptor.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( next_record_identifier > first_record_identifier )
+	{
+		number_of_records = next_record_identifier - first_record_identifier;
+	}
+	if( number_of_records > (uint64_t) INT_MAX )
+	{
+		number_of_records = (uint64_t) INT_MAX;
+	}
+	internal_file->estimated_number_of_records = (int) number_of_records;
+
+	return( 1 );
+
+on_error:
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the chunk descriptor that contains a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_chunk_descriptor_by_record_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *safe_chunk_descriptor = NULL;
+	static char *function                             = "libevtx_file_get_chunk_descriptor_by_record_index";
+	int entry_index                                   = 0;
+	int lower_entry_index                             = 0;
+	int number_of_entries                             = 0;
+	int upper_entry_index                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= internal_file->number_of_indexed_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->chunk_descriptors_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunk descriptors are stored in ascending order of their first record index
+	 */
+	upper_entry_index = number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->chunk_descriptors_array,
+		     entry_index,
+		     (intptr_t **) &safe_chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk descriptor: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_chunk_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk descriptor: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( record_index < safe_chunk_descriptor->first_record_index )
+		{
+			upper_entry_index = entry_index;
+		}
+		else if( record_index >= ( safe_chunk_descriptor->first_record_index + (int) safe_chunk_descriptor->number_of_records ) )
+		{
+			lower_entry_index = entry_index + 1;
+		}
+		else
+		{
+			*chunk_descriptor = safe_chunk_descriptor;
+
+			return( 1 );
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: no chunk descriptor found for record: %d.",
+	 function,
+	 record_index );
+
+	return( -1 );
+}
+
+/* Retrieves the chunk descriptor of which the record identifier range contains a specific identifier
+ * The chunk descriptors are stored in chunk order, if the chunks have wrapped around the chunk
+ * with the smallest record identifiers is not the first chunk. The chunk descriptors are
+ * determined using a binary search which does not read any chunk data
+ * Returns 1 if successful, 0 if no such chunk descriptor or -1 on error
+ */
+int libevtx_file_get_chunk_descriptor_by_record_identifier(
+     libevtx_internal_file_t *internal_file,
+     uint64_t identifier,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *last_chunk_descriptor = NULL;
+	libevtx_chunk_descriptor_t *safe_chunk_descriptor = NULL;
+	static char *function                             = "libevtx_file_get_chunk_descriptor_by_record_identifier";
+	int entry_index                                   = 0;
+	int first_entry_index                             = 0;
+	int lower_entry_index                             = 0;
+	int middle_entry_index                            = 0;
+	int number_of_entries                             = 0;
+	int upper_entry_index                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->chunk_descriptors_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->chunk_descriptors_array,
+	     number_of_entries - 1,
+	     (intptr_t **) &last_chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk descriptor: %d.",
+		 function,
+		 number_of_entries - 1 );
+
+		return( -1 );
+	}
+	if( last_chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk descriptor: %d.",
+		 function,
+		 number_of_entries - 1 );
+
+		return( -1 );
+	}
+	/* Determine the chunk descriptor with the smallest first record identifier, the chunk
+	 * descriptors before it have a first record identifier greater than that of the last one
+	 */
+	lower_entry_index = 0;
+	upper_entry_index = number_of_entries - 1;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->chunk_descriptors_array,
+		     middle_entry_index,
+		     (intptr_t **) &safe_chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk descriptor: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( safe_chunk_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk descriptor: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( safe_chunk_descriptor->first_record_identifier > last_chunk_descriptor->first_record_identifier )
+		{
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+		}
+	}
+	first_entry_index = lower_entry_index;
+
+	/* Determine the last chunk descriptor, in order of record identifier, with a first
+	 * record identifier equal to or less than the specified identifier
+	 */
+	lower_entry_index = 0;
+	upper_entry_index = number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+		entry_index        = ( first_entry_index + middle_entry_index ) % number_of_entries;
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->chunk_descriptors_array,
+		     entry_index,
+		     (intptr_t **) &safe_chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk descriptor: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_chunk_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk descriptor: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_chunk_descriptor->first_record_identifier <= identifier )
+		{
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+		}
+	}
+	if( lower_entry_index == 0 )
+	{
+		return( 0 );
+	}
+	entry_index = ( first_entry_index + lower_entry_index - 1 ) % number_of_entries;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->chunk_descriptors_array,
+	     entry_index,
+	     (intptr_t **) &safe_chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk descriptor: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( safe_chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk descriptor: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( ( safe_chunk_descriptor->number_of_records == 0 )
+	 || ( identifier > safe_chunk_descriptor->last_record_identifier ) )
+	{
+		return( 0 );
+	}
+	*chunk_descriptor = safe_chunk_descriptor;
+
+	return( 1 );
+}
+
+/* Retrieves the record values of a specific record using the chunk descriptors
+ * The record values are read from the corresponding chunk and stored in the records cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_indexed_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	libevtx_record_values_t *safe_record_values  = NULL;
+	libfcache_cache_value_t *cache_value         = NULL;
+	static char *function                        = "libevtx_file_get_indexed_record_values_by_index";
+	off64_t cache_value_offset                   = 0;
+	int64_t cache_value_timestamp                = 0;
+	int64_t timestamp                            = 0;
+	uint16_t chunk_record_index                  = 0;
+	int cache_entry_index                        = 0;
+	int cache_value_file_index                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_chunk_descriptor_by_record_index(
+	     internal_file,
+	     record_index,
+	     &chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk descriptor for record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	/* The record index is used as the cache value offset
+	 */
+	cache_entry_index = record_index % internal_file->number_of_records_cache_entries;
+
+	if( libfcache_cache_get_value_by_index(
+	     internal_file->records_cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		goto on_error;
+	}
+	if( cache_value != NULL )
+	{
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d identifier.",
+			 function,
+			 cache_entry_index );
+
+			goto on_error;
+		}
+		if( cache_value_offset == (off64_t) record_index )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &safe_record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record values from cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				goto on_error;
+			}
+			if( safe_record_values != NULL )
+			{
+				*record_values = safe_record_values;
+
+				return( 1 );
+			}
+		}
+	}
+	if( libevtx_internal_file_get_chunk_by_index(
+	     internal_file,
+	     chunk_descriptor->chunk_index,
+	     &chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 ".",
+		 function,
+		 chunk_descriptor->chunk_index );
+
+		goto on_error;
+	}
+	chunk_record_index = (uint16_t) ( record_index - chunk_descriptor->first_record_index );
+
+	if( libevtx_file_read_chunk_record_values(
+	     internal_file,
+	     chunk,
+	     chunk_record_index,
+	     &safe_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read record: %" PRIu16 " from chunk: %" PRIu16 ".",
+		 function,
+		 chunk_record_index,
+		 chunk_descriptor->chunk_index );
+
+		goto on_error;
+	}
+	if( libfcache_date_time_get_timestamp(
+	     &timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	/* Record values evicted from the records cache are released into the document cache
+	 */
+	safe_record_values->document_cache = internal_file->document_cache;
+
+	if( libfcache_cache_set_value_by_index(
+	     internal_file->records_cache,
+	     cache_entry_index,
+	     0,
+	     (off64_t) record_index,
+	     timestamp,
+	     (intptr_t *) safe_record_values,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_document_cache_release_record_values,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record values in cache entry: %d.",
+		 function,
+		 cache_entry_index );
+
+		goto on_error;
+	}
+	*record_values = safe_record_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &safe_record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the System values or XML document of record values from the chunk data
+ * Record values of which the XML document was already read are left as is
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_read_chunk_record_values_data(
+     libevtx_internal_file_t *internal_file,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_file_read_chunk_record_values_data";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document != NULL )
+	{
+		return( 1 );
+	}
+	if( internal_file->io_handle->decode_depth == LIBEVTX_DECODE_DEPTH_SYSTEM )
+	{
+		result = libevtx_record_values_read_system_values(
+		          record_values,
+		          internal_file->io_handle,
+		          &( chunk->system_values_template_cache ),
+		          chunk->data,
+		          chunk->data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record values System values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Fall back to the XML document if the binary XML data
+	 * is not supported by the System values
+	 */
+	if( ( result == 0 )
+	 && ( record_values->xml_document == NULL ) )
+	{
+		if( libevtx_record_values_read_xml_document(
+		     record_values,
+		     internal_file->io_handle,
+		     chunk->data,
+		     chunk->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record values XML document.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the record values of a specific record from a chunk
+ * The record values are copied from the chunk and their System values
+ * or XML document are read from the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_read_chunk_record_values(
+     libevtx_internal_file_t *internal_file,
+     libevtx_chunk_t *chunk,
+     uint16_t chunk_record_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *chunk_record_values = NULL;
+	libevtx_record_values_t *safe_record_values  = NULL;
+	static char *function                        = "libevtx_file_read_chunk_record_values";
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_get_record(
+	     chunk,
+	     chunk_record_index,
+	     &chunk_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %" PRIu16 " from chunk.",
+		 function,
+		 chunk_record_index );
+
+		goto on_error;
+	}
+	if( chunk_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record: %" PRIu16 ".",
+		 function,
+		 chunk_record_index );
+
+		goto on_error;
+	}
+	/* Record values that were evicted from the records cache are retained
+	 * by the document cache so they do not need to be decoded again
+	 */
+	if( internal_file->document_cache != NULL )
+	{
+		result = libevtx_document_cache_take_record_values(
+		          internal_file->document_cache,
+		          chunk_record_values->offset,
+		          &safe_record_values,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values from document cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			LIBEVTX_COUNTER_ADD(
+			 internal_file->io_handle->statistics.number_of_document_cache_hits,
+			 1 );
+
+			*record_values = safe_record_values;
+
+			return( 1 );
+		}
+	}
+	/* The record values are managed by the chunk and freed after usage
+	 * A copy is created to make sure that the records values can be managed elsewhere
+	 */
+	if( libevtx_record_values_clone(
+	     &safe_record_values,
+	     chunk_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	LIBEVTX_COUNTER_ADD(
+	 internal_file->io_handle->statistics.number_of_allocations,
+	 1 );
+
+	if( libevtx_file_read_chunk_record_values_data(
+	     internal_file,
+	     chunk,
+	     safe_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values data.",
+		 function );
+
+		goto on_error;
+	}
+	*record_values = safe_record_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &safe_record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determine if the file corrupted
+ * If the validation mode is LIBEVTX_VALIDATE_ON_DEMAND the checksums
+ * of the chunks are validated on the first call
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libevtx_file_is_corrupted(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_is_corrupted";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_is_corrupted(
+	          internal_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file is corrupted.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determine if the file corrupted
+ * If the validation mode is LIBEVTX_VALIDATE_ON_DEMAND the checksums
+ * of the chunks are validated on the first call
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libevtx_internal_file_is_corrupted(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function     = "libevtx_internal_file_is_corrupted";
+	size64_t chunk_offset     = 0;
+	uint32_t last_chunk_index = 0;
+	uint16_t chunk_index      = 0;
+	int result                = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->validation_mode == LIBEVTX_VALIDATE_ON_DEMAND )
+	 && ( internal_file->file_io_handle != NULL )
+	 && ( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_CHECKSUMS_VALIDATED ) == 0 ) )
+	{
+		/* Only chunks inside the range indicated by the file header
+		 * affect the corruption state of the file and of a partition
+		 * only the chunks inside the partition are validated
+		 */
+		last_chunk_index = (uint32_t) internal_file->io_handle->number_of_chunks;
+
+		if( internal_file->is_partition != 0 )
+		{
+			chunk_index = internal_file->partition_first_chunk_index;
+
+			if( ( (uint32_t) chunk_index + internal_file->partition_number_of_chunks ) < last_chunk_index )
+			{
+				last_chunk_index = (uint32_t) chunk_index + internal_file->partition_number_of_chunks;
+			}
+		}
+		while( (uint32_t) chunk_index < last_chunk_index )
+		{
+			chunk_offset = (size64_t) chunk_index * internal_file->io_handle->chunk_size;
+
+			if( ( chunk_offset + internal_file->io_handle->chunk_size ) > internal_file->io_handle->chunks_data_size )
+			{
+				break;
+			}
+			result = libevtx_internal_file_validate_chunk(
+			          internal_file,
+			          chunk_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to validate chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+			}
+			chunk_index++;
+		}
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_CHECKSUMS_VALIDATED;
+	}
+	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determine if a specific chunk is corrupted
+ * The chunk checksums are validated if this was not done before,
+ * independent of the validation mode
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libevtx_file_is_chunk_corrupted(
+     libevtx_file_t *file,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_is_chunk_corrupted";
+	size64_t chunk_offset                  = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = (size64_t) chunk_index * internal_file->io_handle->chunk_size;
+
+	if( ( chunk_offset + internal_file->io_handle->chunk_size ) > internal_file->io_handle->chunks_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_internal_file_validate_chunk(
+	          internal_file,
+	          chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to validate chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of chunks
+ * The number of chunks is determined from the size of the chunks data
+ * and can differ from the number of chunks in the file header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_chunks(
+     libevtx_file_t *file,
+     uint16_t *number_of_chunks,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_chunks";
+	size64_t safe_number_of_chunks         = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	safe_number_of_chunks = internal_file->io_handle->chunks_data_size
+	                      / internal_file->io_handle->chunk_size;
+
+	/* Chunks beyond the 16-bit chunk index cannot be retrieved
+	 */
+	if( safe_number_of_chunks > (size64_t) UINT16_MAX )
+	{
+		safe_number_of_chunks = (size64_t) UINT16_MAX;
+	}
+	*number_of_chunks = (uint16_t) safe_number_of_chunks;
+
+	return( 1 );
+}
+
+/* Retrieves the information of a specific chunk
+ * Only the chunk header is read, the event records are not parsed. The written time range
+ * is only known if the chunk was read before, for example by libevtx_file_iterate_records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_chunk_information(
+     libevtx_file_t *file,
+     uint16_t chunk_index,
+     libevtx_chunk_information_t **chunk_information,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ 512 ];
+
+	libevtx_chunk_descriptor_t *chunk_descriptor                     = NULL;
+	libevtx_internal_chunk_information_t *internal_chunk_information = NULL;
+	libevtx_internal_file_t *internal_file                           = NULL;
+	static char *function                                            = "libevtx_file_get_chunk_information";
+	off64_t file_offset                                              = 0;
+	size64_t chunk_offset                                            = 0;
+	uint64_t maximum_written_time                                    = 0;
+	uint64_t minimum_written_time                                    = 0;
+	int result                                                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = (size64_t) chunk_index * internal_file->io_handle->chunk_size;
+
+	if( ( chunk_offset + internal_file->io_handle->chunk_size ) > internal_file->io_handle->chunks_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset = internal_file->io_handle->chunks_data_offset + (off64_t) chunk_offset;
+
+	if( libevtx_io_handle_read_data_at_offset(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     file_offset,
+	     header_data,
+	     512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu16 " header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk_index,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libevtx_chunk_information_initialize(
+	     (libevtx_chunk_information_t **) &internal_chunk_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk information.",
+		 function );
+
+		goto on_error;
+	}
+	internal_chunk_information->chunk_index = chunk_index;
+	internal_chunk_information->file_offset = file_offset;
+
+	if( libevtx_chunk_information_read_data(
+	     internal_chunk_information,
+	     header_data,
+	     512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu16 " information.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libevtx_file_get_chunk_written_time_range(
+	          internal_file,
+	          chunk_index,
+	          &chunk_descriptor,
+	          error );
+
+	if( result == 1 )
+	{
+		minimum_written_time = chunk_descriptor->minimum_written_time;
+		maximum_written_time = chunk_descriptor->maximum_written_time;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 " written time range.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( minimum_written_time <= maximum_written_time ) )
+	{
+		if( libevtx_chunk_information_set_written_time_range(
+		     internal_chunk_information,
+		     minimum_written_time,
+		     maximum_written_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %" PRIu16 " written time range.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	*chunk_information = (libevtx_chunk_information_t *) internal_chunk_information;
+
+	return( 1 );
+
+on_error:
+	if( internal_chunk_information != NULL )
+	{
+		libevtx_chunk_information_free(
+		 (libevtx_chunk_information_t **) &internal_chunk_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the data of a specific chunk
+ * The chunk is read and validated as for the records of the file. The chunk data
+ * is borrowed from the chunks cache and remains valid until the next chunk of the file
+ * is retrieved, for example when a record is retrieved, or the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_chunk_data(
+     libevtx_file_t *file,
+     uint16_t chunk_index,
+     const uint8_t **chunk_data,
+     size_t *chunk_data_size,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_chunk_data";
+	size64_t chunk_offset                  = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data size.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = (size64_t) chunk_index * internal_file->io_handle->chunk_size;
+
+	if( ( chunk_offset + internal_file->io_handle->chunk_size ) > internal_file->io_handle->chunks_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevtx_internal_file_get_chunk_by_index(
+	     internal_file,
+	     chunk_index,
+	     &chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		result = -1;
+	}
+	else if( ( chunk == NULL )
+	      || ( chunk->data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk: %" PRIu16 " data.",
+		 function,
+		 chunk_index );
+
+		result = -1;
+	}
+	else
+	{
+		*chunk_data      = chunk->data;
+		*chunk_data_size = chunk->data_size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Decodes the System fields of the records of a specific chunk
+ * The chunk is read and validated as for the records of the file. The System values
+ * are read without creating the XML documents of the records, a field is only set
+ * for the records that indicate it in their record flags
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_decode_chunk_system_fields(
+     libevtx_file_t *file,
+     uint16_t chunk_index,
+     uint32_t fields_mask,
+     libevtx_system_fields_t *system_fields,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_decode_chunk_system_fields";
+	size64_t chunk_offset                  = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = (size64_t) chunk_index * internal_file->io_handle->chunk_size;
+
+	if( ( chunk_offset + internal_file->io_handle->chunk_size ) > internal_file->io_handle->chunks_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevtx_internal_file_get_chunk_by_index(
+	     internal_file,
+	     chunk_index,
+	     &chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		result = -1;
+	}
+	else if( ( chunk == NULL )
+	      || ( chunk->data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk: %" PRIu16 " data.",
+		 function,
+		 chunk_index );
+
+		result = -1;
+	}
+	else if( libevtx_chunk_decode_system_fields(
+	          chunk,
+	          internal_file->io_handle,
+	          fields_mask,
+	          (libevtx_internal_system_fields_t *) system_fields,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode chunk: %" PRIu16 " system fields.",
+		 function,
+		 chunk_index );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the range of the record indexes of the records of a specific chunk
+ * The range is determined from the chunk descriptors, which does not read any chunk data,
+ * hence the file needs to be opened with LIBEVTX_OPEN_READ_LAZY
+ * Returns 1 if successful, 0 if the chunk has no indexed records or -1 on error
+ */
+int libevtx_file_get_chunk_records_range(
+     libevtx_file_t *file,
+     uint16_t chunk_index,
+     int *first_record_index,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	libevtx_internal_file_t *internal_file       = NULL;
+	static char *function                        = "libevtx_file_get_chunk_records_range";
+	int entry_index                              = 0;
+	int lower_entry_index                        = 0;
+	int number_of_entries                        = 0;
+	int result                                   = 0;
+	int upper_entry_index                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( first_record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->chunk_descriptors_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file - not opened with lazy access.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_file->chunk_descriptors_array,
+	          &number_of_entries,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk descriptors.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The chunk descriptors are stored in ascending chunk order, chunks that are
+		 * not indexed, such as chunks outside the range of the file header, have no descriptor
+		 */
+		upper_entry_index = number_of_entries;
+
+		while( lower_entry_index < upper_entry_index )
+		{
+			entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+			if( libcdata_array_get_entry_by_index(
+			     internal_file->chunk_descriptors_array,
+			     entry_index,
+			     (intptr_t **) &chunk_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk descriptor: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+
+				break;
+			}
+			if( chunk_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk descriptor: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+
+				break;
+			}
+			if( chunk_index < chunk_descriptor->chunk_index )
+			{
+				upper_entry_index = entry_index;
+			}
+			else if( chunk_index > chunk_descriptor->chunk_index )
+			{
+				lower_entry_index = entry_index + 1;
+			}
+			else
+			{
+				if( chunk_descriptor->number_of_records > 0 )
+				{
+					*first_record_index = chunk_descriptor->first_record_index;
+					*number_of_records  = (int) chunk_descriptor->number_of_records;
+
+					result = 1;
+				}
+				break;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Prefetches the chunks of a range of records into the chunks cache
+ * The reads of the chunks are submitted up front if the file uses asynchronous reads,
+ * after which the chunks are read and parsed into the chunks cache, hence retrieving
+ * the records afterwards does not require reading and parsing the chunks.
+ * The range is truncated to the number of records of the file and to the number
+ * of chunks the chunks cache can hold
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_prefetch_records(
+     libevtx_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_prefetch_records";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_prefetch_records(
+	          internal_file,
+	          first_record_index,
+	          number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to prefetch records: %d.",
+		 function,
+		 first_record_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Prefetches the chunks of a range of records into the chunks cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_prefetch_records(
+     libevtx_internal_file_t *internal_file,
+     int first_record_index,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevtx_internal_file_prefetch_records";
+	off64_t chunk_offset         = 0;
+	uint16_t chunk_index         = 0;
+	uint16_t chunk_record_index  = 0;
+	int last_chunk_index         = 0;
+	int last_record_index        = 0;
+	int maximum_number_of_chunks = 0;
+	int number_of_chunks         = 0;
+	int number_of_file_records   = 0;
+	int pass                     = 0;
+	int record_index             = 0;
+	int result                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_number_of_records(
+	     internal_file,
+	     &number_of_file_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_index < 0 )
+	 || ( first_record_index >= number_of_file_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records > ( number_of_file_records - first_record_index ) )
+	{
+		number_of_records = number_of_file_records - first_record_index;
+	}
+	last_record_index = first_record_index + number_of_records;
+
+	if( internal_file->cache_file_identifier == -1 )
+	{
+		/* Prefetching more chunks than the chunks cache holds would evict
+		 * the chunks prefetched before
+		 */
+		if( libfcache_cache_get_number_of_entries(
+		     internal_file->chunks_cache,
+		     &maximum_number_of_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of chunks cache entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		maximum_number_of_chunks = number_of_records;
+	}
+	/* The first pass submits the reads of the chunks if the file uses asynchronous reads
+	 * the second pass reads the chunks into the chunks cache
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		if( ( pass == 0 )
+		 && ( internal_file->io_handle->async_reader == NULL ) )
+		{
+			continue;
+		}
+		last_chunk_index = -1;
+		number_of_chunks = 0;
+
+		for( record_index = first_record_index;
+		     record_index < last_record_index;
+		     record_index++ )
+		{
+			if( libevtx_internal_file_get_chunk_index_by_record_index(
+			     internal_file,
+			     record_index,
+			     &chunk_index,
+			     &chunk_record_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk index of record: %d.",
+				 function,
+				 record_index );
+
+				return( -1 );
+			}
+			if( (int) chunk_index == last_chunk_index )
+			{
+				continue;
+			}
+			if( number_of_chunks >= maximum_number_of_chunks )
+			{
+				break;
+			}
+			last_chunk_index  = (int) chunk_index;
+			number_of_chunks += 1;
+
+			if( pass == 0 )
+			{
+				chunk_offset = internal_file->io_handle->chunks_data_offset
+				             + ( (off64_t) chunk_index * internal_file->io_handle->chunk_size );
+
+				result = libevtx_async_reader_submit(
+				          internal_file->io_handle->async_reader,
+				          chunk_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to submit read of chunk: %" PRIu16 ".",
+					 function,
+					 chunk_index );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+			}
+			else if( libevtx_chunks_table_prefetch_chunk(
+			          internal_file->chunks_table,
+			          internal_file->file_io_handle,
+			          chunk_index,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to prefetch chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Pins a specific chunk
+ * A pinned chunk is kept outside the chunks cache, hence it is not evicted,
+ * until it is unpinned or the file is closed. A chunk that is pinned multiple
+ * times needs to be unpinned the same number of times
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_pin_chunk(
+     libevtx_file_t *file,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_pin_chunk";
+	size64_t chunk_offset                  = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = (size64_t) chunk_index * internal_file->io_handle->chunk_size;
+
+	if( ( chunk_offset + internal_file->io_handle->chunk_size ) > internal_file->io_handle->chunks_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevtx_chunks_table_pin_chunk(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to pin chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Unpins a specific chunk
+ * Returns 1 if successful, 0 if the chunk was not pinned or -1 on error
+ */
+int libevtx_file_unpin_chunk(
+     libevtx_file_t *file,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_unpin_chunk";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing chunks table.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_chunks_table_unpin_chunk(
+	          internal_file->chunks_table,
+	          chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unpin chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific chunk
+ * The chunk is retrieved from the chunks table, which reads sequentially scanned chunks
+ * without caching them and retrieves other chunks from the shared chunk cache if the file
+ * is attached to one, where it remains valid until the next chunk of the file is retrieved,
+ * otherwise from the chunks vector
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_chunk_by_index(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_get_chunk_by_index";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunks_table_get_chunk_by_index(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     chunk_index,
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 " from chunks table.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Validates the checksums of a specific chunk
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libevtx_internal_file_validate_chunk(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_internal_file_validate_chunk";
+	off64_t chunk_offset                         = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = internal_file->io_handle->chunks_data_offset
+	             + ( (off64_t) chunk_index * internal_file->io_handle->chunk_size );
+
+	/* Read the chunk header first since 0-byte filled chunks cannot
+	 * be retrieved from the chunks vector
+	 */
+	if( libevtx_chunk_descriptor_initialize(
+	     &chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevtx_chunk_descriptor_read_file_io_handle(
+	          chunk_descriptor,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          chunk_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu16 " header.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* A 0-byte filled chunk is considered corrupted if it is inside
+		 * the range indicated by the file header
+		 */
+		if( chunk_index < internal_file->io_handle->number_of_chunks )
+		{
+			result = 1;
+		}
+	}
+	else if( ( chunk_descriptor->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		result = 1;
+	}
+	else
+	{
+		if( libevtx_internal_file_get_chunk_by_index(
+		     internal_file,
+		     chunk_index,
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( libevtx_chunk_validate_checksums(
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to validate chunk: %" PRIu16 " checksums.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+		{
+			result = 1;
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+	if( libevtx_chunk_descriptor_free(
+	     &chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Verifies the file header and chunk checksums
+ * The chunks are verified without reading their event records and in parallel
+ * if the number of threads is more than 1
+ * The callback is called for the file header, with chunk index -1, and for every chunk
+ * in order, with the verify result flags. The callback returns 1 to continue,
+ * 0 to stop or -1 on error. The callback is optional and should not call
+ * other functions of the file
+ * If LIBEVTX_VERIFY_FLAG_STOP_ON_FAILURE is set the verification stops at the first failure
+ * Returns 1 if no failures were found, 0 if a failure was found or -1 on error
+ */
+int libevtx_file_verify(
+     libevtx_file_t *file,
+     uint8_t verify_flags,
+     int (*callback)(
+            int chunk_index,
+            off64_t file_offset,
+            uint32_t verify_result_flags,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_verify";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( ( verify_flags & ~( LIBEVTX_VERIFY_FLAG_STOP_ON_FAILURE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported verify flags: 0x%02" PRIx8 ".",
+		 function,
+		 verify_flags );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_verify(
+	          internal_file,
+	          verify_flags,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify file.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Verifies the file header and chunk checksums
+ * Returns 1 if no failures were found, 0 if a failure was found or -1 on error
+ */
+int libevtx_internal_file_verify(
+     libevtx_internal_file_t *internal_file,
+     uint8_t verify_flags,
+     int (*callback)(
+            int chunk_index,
+            off64_t file_offset,
+            uint32_t verify_result_flags,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk             = NULL;
+	libevtx_chunk_batch_t *chunk_batch = NULL;
+	static char *function              = "libevtx_internal_file_verify";
+	off64_t chunk_offset               = 0;
+	off64_t file_offset                = 0;
+	size64_t chunks_data_end_offset    = 0;
+	uint32_t verify_result_flags       = 0;
+	int callback_result                = 1;
+	int chunk_index                    = 0;
+	int result                         = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file header checksum was calculated when the file was opened
+	 */
+	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_FILE_HEADER_CHECKSUM_MISMATCH ) != 0 )
+	{
+		verify_result_flags = LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED
+		                    | LIBEVTX_VERIFY_RESULT_FLAG_HEADER_CHECKSUM_MISMATCH;
+
+		result = 0;
+	}
+	if( callback != NULL )
+	{
+		callback_result = callback(
+		                   -1,
+		                   0,
+		                   verify_result_flags,
+		                   user_data );
+
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for file header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( result == 0 )
+	 && ( ( verify_flags & LIBEVTX_VERIFY_FLAG_STOP_ON_FAILURE ) != 0 ) )
+	{
+		callback_result = 0;
+	}
+	chunks_data_end_offset = (size64_t) internal_file->io_handle->chunks_data_offset
+	                       + internal_file->io_handle->chunks_data_size;
+
+	if( ( callback_result == 1 )
+	 && ( internal_file->number_of_threads > 1 ) )
+	{
+		/* The chunks are verified in batches by multiple threads
+		 * and the results are reported in chunk order
+		 */
+		if( libevtx_chunk_batch_initialize(
+		     &chunk_batch,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     internal_file->number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_offset = internal_file->io_handle->chunks_data_offset;
+
+	while( ( callback_result == 1 )
+	    && ( (size64_t) ( file_offset + internal_file->io_handle->chunk_size ) <= chunks_data_end_offset ) )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( chunk_batch != NULL )
+		{
+			if( chunk_batch->next_chunk_index >= chunk_batch->number_of_chunks )
+			{
+				if( libevtx_chunk_batch_verify(
+				     chunk_batch,
+				     file_offset,
+				     chunks_data_end_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to verify chunk batch at offset: %" PRIi64 ".",
+					 function,
+					 file_offset );
+
+					goto on_error;
+				}
+			}
+			if( libevtx_chunk_batch_get_next_verify_result(
+			     chunk_batch,
+			     &chunk_offset,
+			     &verify_result_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %d verify result from batch.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libevtx_chunk_initialize(
+			     &chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			if( libevtx_chunk_verify(
+			     chunk,
+			     internal_file->io_handle,
+			     internal_file->file_io_handle,
+			     file_offset,
+			     &verify_result_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify chunk: %d at offset: %" PRIi64 ".",
+				 function,
+				 chunk_index,
+				 file_offset );
+
+				goto on_error;
+			}
+			if( libevtx_chunk_free(
+			     &chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			chunk_offset = file_offset;
+		}
+		/* A 0-byte filled chunk is considered corrupted if it is inside
+		 * the range indicated by the file header
+		 */
+		if( ( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_IS_EMPTY ) != 0 )
+		 && ( chunk_index < (int) internal_file->io_handle->number_of_chunks ) )
+		{
+			verify_result_flags |= LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED;
+		}
+		if( ( verify_result_flags & LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED ) != 0 )
+		{
+			if( chunk_index < (int) internal_file->io_handle->number_of_chunks )
+			{
+				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+			}
+			result = 0;
+		}
+		if( callback != NULL )
+		{
+			callback_result = callback(
+			                   chunk_index,
+			                   chunk_offset,
+			                   verify_result_flags,
+			                   user_data );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback failed for chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( ( result == 0 )
+		 && ( ( verify_flags & LIBEVTX_VERIFY_FLAG_STOP_ON_FAILURE ) != 0 ) )
+		{
+			break;
+		}
+		file_offset += internal_file->io_handle->chunk_size;
+
+		chunk_index++;
+	}
+	if( chunk_batch != NULL )
+	{
+		if( libevtx_chunk_batch_free(
+		     &chunk_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( chunk_batch != NULL )
+	{
+		libevtx_chunk_batch_free(
+		 &chunk_batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_ascii_codepage(
+     libevtx_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_ascii_codepage(
+     libevtx_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEVTX_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_io_handle_set_ascii_codepage(
+	     internal_file->io_handle,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the checksum validation mode
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_validation_mode(
+     libevtx_file_t *file,
+     int *validation_mode,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_validation_mode";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( validation_mode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid validation mode.",
+		 function );
+
+		return( -1 );
+	}
+	*validation_mode = internal_file->io_handle->validation_mode;
+
+	return( 1 );
+}
+
+/* Sets the checksum validation mode
+ * The validation mode applies to chunks that are read after it was set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_validation_mode(
+     libevtx_file_t *file,
+     int validation_mode,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_validation_mode";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( validation_mode != LIBEVTX_VALIDATE_FULL )
+	 && ( validation_mode != LIBEVTX_VALIDATE_NONE )
+	 && ( validation_mode != LIBEVTX_VALIDATE_HEADER_ONLY )
+	 && ( validation_mode != LIBEVTX_VALIDATE_ON_DEMAND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported validation mode.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->validation_mode = validation_mode;
+
+	return( 1 );
+}
+
+/* Retrieves the record decode depth
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_decode_depth(
+     libevtx_file_t *file,
+     int *decode_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_decode_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decode_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode depth.",
+		 function );
+
+		return( -1 );
+	}
+	*decode_depth = internal_file->io_handle->decode_depth;
+
+	return( 1 );
+}
+
+/* Sets the record decode depth
+ * The decode depth applies to records that are read after it was set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_decode_depth(
+     libevtx_file_t *file,
+     int decode_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_decode_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decode_depth != LIBEVTX_DECODE_DEPTH_FULL )
+	 && ( decode_depth != LIBEVTX_DECODE_DEPTH_SYSTEM ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported decode depth.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->decode_depth = decode_depth;
+
+	return( 1 );
+}
+
+/* Retrieves the decode budget of a single record
+ * A value of 0 indicates the corresponding decode cost is not limited
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_decode_budget(
+     libevtx_file_t *file,
+     int *maximum_depth,
+     int *maximum_number_of_nodes,
+     size_t *maximum_decoded_size,
+     uint64_t *maximum_decode_time,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_decode_budget";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum depth.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_decoded_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum decoded size.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_decode_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum decode time.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_depth           = internal_file->io_handle->decode_budget.maximum_depth;
+	*maximum_number_of_nodes = internal_file->io_handle->decode_budget.maximum_number_of_nodes;
+	*maximum_decoded_size    = internal_file->io_handle->decode_budget.maximum_decoded_size;
+	*maximum_decode_time     = internal_file->io_handle->decode_budget.maximum_decode_time;
+
+	return( 1 );
+}
+
+/* Sets the decode budget of a single record
+ * A value of 0 indicates the corresponding decode cost is not limited
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_decode_budget(
+     libevtx_file_t *file,
+     int maximum_depth,
+     int maximum_number_of_nodes,
+     size_t maximum_decoded_size,
+     uint64_t maximum_decode_time,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_decode_budget";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum depth value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_nodes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of nodes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->decode_budget.maximum_depth           = maximum_depth;
+	internal_file->io_handle->decode_budget.maximum_number_of_nodes = maximum_number_of_nodes;
+	internal_file->io_handle->decode_budget.maximum_decoded_size    = maximum_decoded_size;
+	internal_file->io_handle->decode_budget.maximum_decode_time     = maximum_decode_time;
+
+	return( 1 );
+}
+
+/* Retrieves the record iteration order
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_iterate_order(
+     libevtx_file_t *file,
+     int *iterate_order,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_iterate_order";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( iterate_order == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid iterate order.",
+		 function );
+
+		return( -1 );
+	}
+	*iterate_order = internal_file->io_handle->iterate_order;
+
+	return( 1 );
+}
+
+/* Sets the record iteration order
+ * The iteration order applies to libevtx_file_iterate_records and the related
+ * iterate functions, it does not change the order of the record indexes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_iterate_order(
+     libevtx_file_t *file,
+     int iterate_order,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_iterate_order";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( iterate_order != LIBEVTX_ITERATE_BY_CHUNK_OFFSET )
+	 && ( iterate_order != LIBEVTX_ITERATE_BY_RECORD_IDENTIFIER ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported iterate order.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->iterate_order = iterate_order;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum number of chunk buffers retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_chunk_buffer_pool_size(
+     libevtx_file_t *file,
+     int *maximum_number_of_buffers,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_chunk_buffer_pool_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_buffer_pool_get_maximum_number_of_buffers(
+	     internal_file->io_handle->chunk_buffer_pool,
+	     maximum_number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of chunk buffers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of chunk buffers retained for reuse
+ * A value of 0 disables reuse of chunk buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_chunk_buffer_pool_size(
+     libevtx_file_t *file,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_chunk_buffer_pool_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_buffer_pool_set_maximum_number_of_buffers(
+	     internal_file->io_handle->chunk_buffer_pool,
+	     maximum_number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of chunk buffers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value to indicate the chunk buffers are carved from large page slabs
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_chunk_buffer_pool_large_pages(
+     libevtx_file_t *file,
+     uint8_t *use_large_pages,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_chunk_buffer_pool_large_pages";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_buffer_pool_get_use_large_pages(
+	     internal_file->io_handle->chunk_buffer_pool,
+	     use_large_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve use large pages.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the value to indicate the chunk buffers are carved from large page slabs
+ * When enabled the chunk buffers are carved from 2 MiB slabs that are backed by
+ * huge pages where available, which reduces TLB misses when many chunks are cached
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_chunk_buffer_pool_large_pages(
+     libevtx_file_t *file,
+     uint8_t use_large_pages,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_chunk_buffer_pool_large_pages";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_buffer_pool_set_use_large_pages(
+	     internal_file->io_handle->chunk_buffer_pool,
+	     use_large_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use large pages.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache limits
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_cache_limits(
+     libevtx_file_t *file,
+     int *maximum_number_of_cached_chunks,
+     int *maximum_number_of_cached_records,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_cache_limits";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( maximum_number_of_cached_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cached chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cached records.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_number_of_cached_chunks  = internal_file->maximum_number_of_cached_chunks;
+	*maximum_number_of_cached_records = internal_file->maximum_number_of_cached_records;
+	*maximum_cache_size               = internal_file->maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the cache limits
+ * The limits are applied when the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_cache_limits(
+     libevtx_file_t *file,
+     int maximum_number_of_cached_chunks,
+     int maximum_number_of_cached_records,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_cache_limits";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_chunks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of cached chunks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_records <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of cached records value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->maximum_number_of_cached_chunks  = maximum_number_of_cached_chunks;
+	internal_file->maximum_number_of_cached_records = maximum_number_of_cached_records;
+	internal_file->maximum_cache_size               = maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum size of the document cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_maximum_document_cache_size(
+     libevtx_file_t *file,
+     size64_t *maximum_document_cache_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_maximum_document_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( maximum_document_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum document cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_document_cache_size = internal_file->maximum_document_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum size of the document cache
+ * The maximum size is applied when the file is opened
+ * A value of 0 represents the document cache is not used
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_maximum_document_cache_size(
+     libevtx_file_t *file,
+     size64_t maximum_document_cache_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_maximum_document_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->maximum_document_cache_size = maximum_document_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the shared chunk cache
+ * The chunks of the file are cached in the shared chunk cache instead of by the file,
+ * which allows multiple files to share a single chunk cache size limit
+ * The cache is applied when the file is opened and must not be freed before the file is closed
+ * A value of NULL represents the chunks are cached by the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_cache(
+     libevtx_file_t *file,
+     libevtx_cache_t *cache,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_cache";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->cache = (libevtx_internal_cache_t *) cache;
+
+	return( 1 );
+}
+
+/* Retrieves the number of threads used to read the chunks when opening the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_threads(
+     libevtx_file_t *file,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_file->number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to read the chunks when opening the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_number_of_threads(
+     libevtx_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_number_of_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEVTX_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Retrieves the number of chunks read ahead during sequential reads
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_read_ahead_depth(
+     libevtx_file_t *file,
+     int *read_ahead_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_read_ahead_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( read_ahead_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ahead depth.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead_depth = internal_file->read_ahead_depth;
+
+	return( 1 );
+}
+
+/* Sets the number of chunks read ahead during sequential reads
+ * A depth of 0 disables read-ahead, the depth is applied when opening the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_read_ahead_depth(
+     libevtx_file_t *file,
+     int read_ahead_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_read_ahead_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_ahead_depth < 0 )
+	 || ( read_ahead_depth > LIBEVTX_MAXIMUM_READ_AHEAD_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read ahead depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( read_ahead_depth > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->read_ahead_depth = read_ahead_depth;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records decoded ahead in the background
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_background_decode_depth(
+     libevtx_file_t *file,
+     int *background_decode_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_background_decode_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( background_decode_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid background decode depth.",
+		 function );
+
+		return( -1 );
+	}
+	*background_decode_depth = internal_file->background_decode_depth;
+
+	return( 1 );
+}
+
+/* Sets the number of records decoded ahead in the background
+ * A depth of 0 disables background decoding, the depth is applied when opening the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_background_decode_depth(
+     libevtx_file_t *file,
+     int background_decode_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_background_decode_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( background_decode_depth < 0 )
+	 || ( background_decode_depth > LIBEVTX_MAXIMUM_BACKGROUND_DECODE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid background decode depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( background_decode_depth > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->background_decode_depth = background_decode_depth;
+
+	return( 1 );
+}
+
+/* Sets the open progress callback
+ * The callback is called before every granularity number of chunks that is read
+ * when opening the file and after the last chunk was read
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_progress_callback(
+     libevtx_file_t *file,
+     int (*callback)(
+            size64_t processed_size,
+            size64_t total_size,
+            void *user_data ),
+     void *user_data,
+     int granularity,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_progress_callback";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( ( callback != NULL )
+	 && ( ( granularity <= 0 )
+	  || ( granularity > (int) UINT16_MAX ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid granularity value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->progress_callback           = callback;
+	internal_file->progress_callback_user_data = user_data;
+	internal_file->progress_granularity        = granularity;
+
+	return( 1 );
+}
+
+/* Checks the abort flag and reports the open progress
+ * The progress callback is called every granularity number of chunks and for the last chunk
+ * Returns 1 if successful, 0 if the open should be aborted or -1 on error
+ */
+int libevtx_internal_file_report_open_progress(
+     libevtx_internal_file_t *internal_file,
+     uint16_t number_of_chunks_read,
+     off64_t file_offset,
+     size64_t file_size,
+     uint8_t is_last,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_report_open_progress";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_file->progress_callback == NULL )
+	 || ( internal_file->progress_granularity <= 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( is_last == 0 )
+	 && ( ( number_of_chunks_read % (uint16_t) internal_file->progress_granularity ) != 0 ) )
+	{
+		return( 1 );
+	}
+	result = internal_file->progress_callback(
+	          (size64_t) file_offset,
+	          file_size,
+	          internal_file->progress_callback_user_data );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: progress callback failed.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		internal_file->io_handle->abort = 1;
+	}
+	return( result );
+}
+
+/* Retrieves the size of the coalesced reads of sequential chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_coalesced_read_size(
+     libevtx_file_t *file,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_coalesced_read_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	*read_size = internal_file->coalesced_read_size;
+
+	return( 1 );
+}
+
+/* Sets the size of the coalesced reads of sequential chunks
+ * A size smaller than 2 chunks disables coalesced reads, the size is applied when opening the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_coalesced_read_size(
+     libevtx_file_t *file,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_coalesced_read_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size > (size_t) LIBEVTX_MAXIMUM_COALESCED_READ_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->coalesced_read_size = read_size;
+
+	return( 1 );
+}
+
+/* Retrieves the value to indicate if the read parameters are tuned when opening the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_auto_tuning(
+     libevtx_file_t *file,
+     uint8_t *auto_tuning,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_auto_tuning";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( auto_tuning == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid auto tuning.",
+		 function );
+
+		return( -1 );
+	}
+	*auto_tuning = internal_file->auto_tuning;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate if the read parameters are tuned when opening the file
+ * When enabled the number of threads, read-ahead depth and coalesced read size
+ * that were set are replaced by values derived from the measured read latency
+ * and the throughput of the chunks read while the file is opened
+ * This function must be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_auto_tuning(
+     libevtx_file_t *file,
+     uint8_t auto_tuning,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_auto_tuning";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( auto_tuning != 0 )
+	{
+		internal_file->auto_tuning = 1;
+	}
+	else
+	{
+		internal_file->auto_tuning = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the measurements the read parameters were tuned with
+ * The chunk read time is the time of a single chunk read and the chunk decode time
+ * the time per chunk read and parsed by a single thread, in nano seconds
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_file_get_tuning_measurements(
+     libevtx_file_t *file,
+     uint64_t *chunk_read_time,
+     uint64_t *chunk_decode_time,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_tuning_measurements";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( chunk_read_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read time.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_decode_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk decode time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->chunk_read_time == 0 )
+	 && ( internal_file->chunk_decode_time == 0 ) )
+	{
+		return( 0 );
+	}
+	*chunk_read_time   = internal_file->chunk_read_time;
+	*chunk_decode_time = internal_file->chunk_decode_time;
+
+	return( 1 );
+}
+
+/* Retrieves the number of asynchronous chunk reads in flight
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_async_read_queue_depth(
+     libevtx_file_t *file,
+     int *queue_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_async_read_queue_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( queue_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue depth.",
+		 function );
+
+		return( -1 );
+	}
+	*queue_depth = internal_file->async_read_queue_depth;
+
+	return( 1 );
+}
+
+/* Sets the number of asynchronous chunk reads in flight
+ * A queue depth of 0 disables asynchronous reads, the queue depth is applied when opening the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_async_read_queue_depth(
+     libevtx_file_t *file,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_async_read_queue_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth < 0 )
+	 || ( queue_depth > LIBEVTX_MAXIMUM_ASYNC_READ_QUEUE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->async_read_queue_depth = queue_depth;
+
+	return( 1 );
+}
+
+/* Retrieves the value to indicate if the System string values are interned
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_string_interning(
+     libevtx_file_t *file,
+     uint8_t *string_interning,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_string_interning";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_interning == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string interning.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->string_table != NULL )
+	{
+		*string_interning = 1;
+	}
+	else
+	{
+		*string_interning = 0;
+	}
+	return( 1 );
+}
+
+/* Sets the value to indicate if the System string values are interned
+ * When enabled the computer, channel and source name of the records are mapped
+ * to string identifiers that are stable while the file is open
+ * This function must be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_string_interning(
+     libevtx_file_t *file,
+     uint8_t string_interning,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_string_interning";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_interning != 0 )
+	 && ( internal_file->io_handle->string_table == NULL ) )
+	{
+		if( libevtx_string_table_initialize(
+		     &( internal_file->io_handle->string_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create string table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( string_interning == 0 )
+	      && ( internal_file->io_handle->string_table != NULL ) )
+	{
+		if( libevtx_string_table_free(
+		     &( internal_file->io_handle->string_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of interned strings
+ * The string identifiers range from 0 to the number of interned strings - 1
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_interned_strings(
+     libevtx_file_t *file,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_interned_strings";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->string_table == NULL )
+	{
+		*number_of_strings = 0;
+
+		return( 1 );
+	}
+	if( libevtx_string_table_get_number_of_strings(
+	     internal_file->io_handle->string_table,
+	     number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded interned string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_utf8_interned_string_size(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_utf8_interned_string_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - string interning not enabled.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_string_table_get_utf8_string_size(
+	     internal_file->io_handle->string_table,
+	     string_identifier,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %" PRIu32 " size.",
+		 function,
+		 string_identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded interned string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_utf8_interned_string(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_utf8_interned_string";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - string interning not enabled.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_string_table_get_utf8_string(
+	     internal_file->io_handle->string_table,
+	     string_identifier,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %" PRIu32 ".",
+		 function,
+		 string_identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded interned string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_utf16_interned_string_size(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_utf16_interned_string_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - string interning not enabled.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_string_table_get_utf16_string_size(
+	     internal_file->io_handle->string_table,
+	     string_identifier,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string: %" PRIu32 " size.",
+		 function,
+		 string_identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded interned string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_utf16_interned_string(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_utf16_interned_string";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - string interning not enabled.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_string_table_get_utf16_string(
+	     internal_file->io_handle->string_table,
+	     string_identifier,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve UTF-16 string: %" PRIu32 ".",
+		 function,
+		 string_identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value to indicate if the decode costs are profiled
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_decode_profiling(
+     libevtx_file_t *file,
+     uint8_t *decode_profiling,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_decode_profiling";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decode_profiling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decode profiling.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->decode_profile != NULL )
+	{
+		*decode_profiling = 1;
+	}
+	else
+	{
+		*decode_profiling = 0;
+	}
+	return( 1 );
+}
+
+/* Sets the value to indicate if the decode costs are profiled
+ * When enabled the time, bytes and allocations spent decoding the records are
+ * attributed to their provider, event identifier and template and to their chunk
+ * The decode profile is retained when the file is closed and discarded when disabled
+ * This function must be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_decode_profiling(
+     libevtx_file_t *file,
+     uint8_t decode_profiling,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_decode_profiling";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decode_profiling != 0 )
+	 && ( internal_file->io_handle->decode_profile == NULL ) )
+	{
+		if( libevtx_decode_profile_initialize(
+		     &( internal_file->io_handle->decode_profile ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decode profile.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( decode_profiling == 0 )
+	      && ( internal_file->io_handle->decode_profile != NULL ) )
+	{
+		if( libevtx_decode_profile_free(
+		     &( internal_file->io_handle->decode_profile ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decode profile.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of decode profile entries
+ * Every entry contains the decode costs of a provider, event identifier and template
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_decode_profile_entries(
+     libevtx_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_decode_profile_entries";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->decode_profile == NULL )
+	{
+		*number_of_entries = 0;
+
+		return( 1 );
+	}
+	if( libevtx_decode_profile_get_number_of_entries(
+	     internal_file->io_handle->decode_profile,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific decode profile entry
+ * The entries are ranked by the sum of their decode and parse time, where entry 0 is the most costly
+ * The provider and template identifiers are little-endian GUIDs that contain 0-byte values if not available
+ * The values are stored in the order of the LIBEVTX_DECODE_PROFILE_VALUES definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_decode_profile_entry(
+     libevtx_file_t *file,
+     int entry_index,
+     uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t *event_identifier,
+     uint8_t *template_identifier,
+     size_t template_identifier_size,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libevtx_decode_profile_key_t key;
+
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_decode_profile_entry";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - decode profiling not enabled.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( provider_identifier_size < 16 )
+	 || ( provider_identifier_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_identifier_size < 16 )
+	 || ( template_identifier_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_decode_profile_get_entry_by_index(
+	     internal_file->io_handle->decode_profile,
+	     entry_index,
+	     &key,
+	     values,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     provider_identifier,
+	     key.provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     template_identifier,
+	     key.template_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy template identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*event_identifier = key.event_identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the number of decode profile chunks
+ * This is the index of the last chunk that contains a decoded record + 1
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_decode_profile_chunks(
+     libevtx_file_t *file,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_decode_profile_chunks";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->decode_profile == NULL )
+	{
+		*number_of_chunks = 0;
+
+		return( 1 );
+	}
+	if( libevtx_decode_profile_get_number_of_chunks(
+	     internal_file->io_handle->decode_profile,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the decode profile values of a specific chunk
+ * The values are stored in the order of the LIBEVTX_DECODE_PROFILE_VALUES definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_decode_profile_chunk_values(
+     libevtx_file_t *file,
+     int chunk_index,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_decode_profile_chunk_values";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->decode_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - decode profiling not enabled.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_decode_profile_get_chunk_values(
+	     internal_file->io_handle->decode_profile,
+	     chunk_index,
+	     values,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the filename of the index file
+ * The index file contains the records lists of the file so that a subsequent open
+ * does not need to read all the chunks. If the index file does not exist, the chunks
+ * are read and the index file is written. If the index file was created for a previous
+ * version of the file, only the chunks that were added or changed are read and the
+ * index file is replaced. The index file is not used if the file is opened with LIBEVTX_OPEN_READ_LAZY
+ * or LIBEVTX_OPEN_READ_RECOVERED
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_index_filename(
+     libevtx_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_index_filename";
+	size_t filename_length                 = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->index_file_io_handle = index_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the index file
+ * The index file contains the records lists of the file so that a subsequent open
+ * does not need to read all the chunks. If the index file does not exist, the chunks
+ * are read and the index file is written. If the index file was created for a previous
+ * version of the file, only the chunks that were added or changed are read and the
+ * index file is replaced. The index file is not used if the file is opened with LIBEVTX_OPEN_READ_LAZY
+ * or LIBEVTX_OPEN_READ_RECOVERED
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_index_filename_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_index_filename_wide";
+	size_t filename_length                 = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->index_file_io_handle = index_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the filename of the decoded values file
+ * The decoded values file contains the System values of the records, i.e. the event
+ * identifier, level, provider identifier, channel and computer name, so that a subsequent
+ * open does not need to decode the binary XML data to retrieve them. If the decoded values
+ * file does not exist or was created for another version of the file, the System values of
+ * all the records are decoded and the decoded values file is written when the file is opened.
+ * The decoded values file is not used if the file is opened with LIBEVTX_OPEN_READ_LAZY
+ * or LIBEVTX_OPEN_READ_RECOVERED
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_decoded_values_filename(
+     libevtx_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *decoded_values_file_io_handle = NULL;
+	libevtx_internal_file_t *internal_file          = NULL;
+	static char *function                           = "libevtx_file_set_decoded_values_filename";
+	size_t filename_length                          = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &decoded_values_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded values file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     decoded_values_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in decoded values file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->decoded_values_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->decoded_values_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoded values file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->decoded_values_file_io_handle = decoded_values_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( decoded_values_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &decoded_values_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the decoded values file
+ * The decoded values file contains the System values of the records, i.e. the event
+ * identifier, level, provider identifier, channel and computer name, so that a subsequent
+ * open does not need to decode the binary XML data to retrieve them. If the decoded values
+ * file does not exist or was created for another version of the file, the System values of
+ * all the records are decoded and the decoded values file is written when the file is opened.
+ * The decoded values file is not used if the file is opened with LIBEVTX_OPEN_READ_LAZY
+ * or LIBEVTX_OPEN_READ_RECOVERED
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_decoded_values_filename_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *decoded_values_file_io_handle = NULL;
+	libevtx_internal_file_t *internal_file          = NULL;
+	static char *function                           = "libevtx_file_set_decoded_values_filename_wide";
+	size_t filename_length                          = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &decoded_values_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded values file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     decoded_values_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in decoded values file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->decoded_values_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->decoded_values_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoded values file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->decoded_values_file_io_handle = decoded_values_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( decoded_values_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &decoded_values_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the index data
+ * The index data contains the records lists of the file, as retrieved by
+ * libevtx_file_get_index_data, so that the open does not need to read all the chunks.
+ * The index data is copied. If the index data was created for another version of the
+ * file, the chunks are read. The index data takes precedence over the index file and
+ * is not used if the file is opened with LIBEVTX_OPEN_READ_LAZY or LIBEVTX_OPEN_READ_RECOVERED
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_index_data(
+     libevtx_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	uint8_t *index_data                    = NULL;
+	static char *function                  = "libevtx_file_set_index_data";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * data_size );
+
+	if( index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     index_data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy index data.",
+		 function );
+
+		memory_free(
+		 index_data );
+
+		return( -1 );
+	}
+	if( internal_file->index_data != NULL )
+	{
+		memory_free(
+		 internal_file->index_data );
+	}
+	internal_file->index_data      = index_data;
+	internal_file->index_data_size = data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the index data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_index_data_size(
+     libevtx_file_t *file,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_index_data_size";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_HEADER_ONLY | LIBEVTX_ACCESS_FLAG_DEDUPLICATE_RECOVERED ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags - index data requires all records to be read on open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_read_deferred_recovered_records(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred recovered records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevtx_index_file_get_data_size(
+	     internal_file->records_list,
+	     internal_file->recovered_records_list,
+	     internal_file->chunk_written_time_ranges_array,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index data size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index data
+ * The index data contains the records lists of the file and can be passed to
+ * libevtx_file_set_index_data of another file object of the same file, e.g. in
+ * another process, so that its open does not need to read all the chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_index_data(
+     libevtx_file_t *file,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_index_data";
+	size64_t file_size                     = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & ( LIBEVTX_ACCESS_FLAG_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY | LIBEVTX_ACCESS_FLAG_HEADER_ONLY | LIBEVTX_ACCESS_FLAG_DEDUPLICATE_RECOVERED ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags - index data requires all records to be read on open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_read_deferred_recovered_records(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred recovered records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		result = -1;
+	}
+	else if( libevtx_index_file_write_data(
+	          data,
+	          data_size,
+	          internal_file->io_handle,
+	          file_size,
+	          internal_file->records_list,
+	          internal_file->recovered_records_list,
+	          internal_file->chunk_written_time_ranges_array,
+	          internal_file->last_indexed_record_identifier,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_format_version(
+     libevtx_file_t *file,
+     uint16_t *major_version,
+     uint16_t *minor_version,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
+
+		return( -1 );
+	}
+	*major_version = internal_file->io_handle->major_version;
+	*minor_version = internal_file->io_handle->minor_version;
+
+	return( 1 );
+}
+
+/* Retrieves the file version
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_version(
+     libevtx_file_t *file,
+     uint16_t *major_version,
+     uint16_t *minor_version,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
+
+		return( -1 );
+	}
+	*major_version = internal_file->io_handle->major_version;
+	*minor_version = internal_file->io_handle->minor_version;
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_flags(
+     libevtx_file_t *file,
+     uint32_t *flags,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_flags";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = internal_file->io_handle->file_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the statistics
+ * The statistics are stored in the order of the LIBEVTX_STATISTICS definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_statistics(
+     libevtx_file_t *file,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_statistics_get_values(
+	     &( internal_file->io_handle->statistics ),
+	     statistics,
+	     number_of_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_reset_statistics(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_reset_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_statistics_clear(
+	     &( internal_file->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the memory usage
+ * The memory usage is the number of bytes currently allocated for
+ * the chunk data, records index, record values and XML documents
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_memory_usage(
+     libevtx_file_t *file,
+     uint64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	uint64_t values[ LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES ];
+
+	static char *function = "libevtx_file_get_memory_usage";
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_memory_usage_values(
+	     file,
+	     values,
+	     LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage values.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_usage = values[ LIBEVTX_MEMORY_USAGE_TOTAL ];
+
+	return( 1 );
+}
+
+/* Retrieves the memory usage values
+ * The values are stored in the order of the LIBEVTX_MEMORY_USAGE definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_memory_usage_values(
+     libevtx_file_t *file,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_memory_usage_values";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_memory_usage_get_values(
+	     &( internal_file->io_handle->memory_usage ),
+	     values,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Advises that the file is going to be read sequentially, such as when
+ * streaming or exporting the records, so that more data is read ahead
+ * The advice is a hint that is ignored if not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_advise_sequential_access(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_advise_sequential_access";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_io_handle_advise_sequential_access(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise sequential access.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_records";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_number_of_records(
+	          internal_file,
+	          number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_number_of_records(
+     libevtx_internal_file_t *internal_file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_get_number_of_records";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	{
+		if( number_of_records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of records.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_records = internal_file->number_of_indexed_records;
+	}
+	else if( libfdata_list_get_number_of_elements(
+	          internal_file->records_list,
+	          number_of_records,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the estimated number of records
+ * If the file was opened with the header only access flag or as a partition the number
+ * of records of the whole file is estimated from the file header and the headers
+ * of the oldest and newest chunk, otherwise it is the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_estimated_number_of_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_estimated_number_of_records";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_HEADER_ONLY ) != 0 )
+	 || ( internal_file->is_partition != 0 ) )
+	{
+		*number_of_records = internal_file->estimated_number_of_records;
+	}
+	else
+	{
+		result = libevtx_internal_file_get_number_of_records(
+		          internal_file,
+		          number_of_records,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the partition of the file
+ * The total number of chunks is the number of chunks in the file header
+ * Returns 1 if successful, 0 if the file was not opened as a partition or -1 on error
+ */
+int libevtx_file_get_partition(
+     libevtx_file_t *file,
+     uint16_t *first_chunk_index,
+     uint16_t *number_of_chunks,
+     uint16_t *total_number_of_chunks,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_partition";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( total_number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->file_io_handle != NULL )
+	 && ( internal_file->is_partition != 0 ) )
+	{
+		*first_chunk_index      = internal_file->partition_first_chunk_index;
+		*number_of_chunks       = internal_file->partition_number_of_chunks;
+		*total_number_of_chunks = internal_file->io_handle->number_of_chunks;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of record identifier gaps
+ * The gaps are determined while the records are read when the file is opened,
+ * hence the number of gaps is 0 if the records were not read, such as in lazy mode
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_identifier_gaps(
+     libevtx_file_t *file,
+     int *number_of_gaps,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_identifier_gaps";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( number_of_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of gaps.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->identifier_gaps == NULL )
+	{
+		*number_of_gaps = 0;
+	}
+	else
+	{
+		result = libevtx_identifier_gaps_get_number_of_gaps(
+		          internal_file->identifier_gaps,
+		          number_of_gaps,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of gaps.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record identifier gap
+ * The gap type is one of the LIBEVTX_IDENTIFIER_GAP_TYPES definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_identifier_gap(
+     libevtx_file_t *file,
+     int gap_index,
+     uint8_t *gap_type,
+     uint64_t *first_identifier,
+     uint64_t *last_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_identifier_gap";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevtx_identifier_gaps_get_gap(
+	     internal_file->identifier_gaps,
+	     gap_index,
+	     gap_type,
+	     first_identifier,
+	     last_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve gap: %d.",
+		 function,
+		 gap_index );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Creates a record from record values
+ * If the file was opened with the thread-safe access flag the record values are cloned
+ * and managed by the record, so the record does not reference the records cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_create_record(
+     libevtx_internal_file_t *internal_file,
+     libevtx_record_values_t *record_values,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *safe_record_values = NULL;
+	static char *function                       = "libevtx_internal_file_create_record";
+	uint8_t record_flags                        = LIBEVTX_RECORD_FLAGS_DEFAULT;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_THREAD_SAFE ) != 0 )
+	{
+		if( libevtx_record_values_clone(
+		     &safe_record_values,
+		     record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
+
+			goto on_error;
+		}
+		LIBEVTX_COUNTER_ADD(
+		 internal_file->io_handle->statistics.number_of_allocations,
+		 1 );
+
+		record_values = safe_record_values;
+		record_flags |= LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES;
+	}
+	if( libevtx_record_initialize(
+	     record,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     record_values,
+	     record_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( safe_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &safe_record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_record(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_record";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_record(
+	          internal_file,
+	          record_index,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_record(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_file_get_record";
+	int result                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	{
+		result = libevtx_file_get_indexed_record_values_by_index(
+		          internal_file,
+		          record_index,
+		          &record_values,
+		          error );
+	}
+	else
+	{
+		LIBEVTX_COUNTER_ADD(
+		 internal_file->io_handle->statistics.number_of_record_look_ups,
+		 1 );
+
+		result = libfdata_list_get_element_value_by_index(
+		          internal_file->records_list,
+		          (intptr_t *) internal_file->file_io_handle,
+		          internal_file->records_cache,
+		          record_index,
+		          (intptr_t **) &record_values,
+		          0,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_create_record(
+	     internal_file,
+	     record_values,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_record_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_record_by_index";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_record_by_index(
+	          internal_file,
+	          record_index,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_file_get_record_by_index";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_record_values_by_index(
+	     internal_file,
+	     record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_create_record(
+	     internal_file,
+	     record_values,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a range of records
+ * The records are read chunk by chunk and every resulting record manages
+ * its own record values, hence the records do not depend on the records cache
+ * Make sure the records array contains number_of_records entries that are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_records_by_range(
+     libevtx_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     libevtx_record_t **records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_records_by_range";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_records_by_range(
+	          internal_file,
+	          first_record_index,
+	          number_of_records,
+	          records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records: %d.",
+		 function,
+		 first_record_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a range of records
+ * The records are read chunk by chunk and every resulting record manages
+ * its own record values, hence the records do not depend on the records cache
+ * Make sure the records array contains number_of_records entries that are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_records_by_range(
+     libevtx_internal_file_t *internal_file,
+     int first_record_index,
+     int number_of_records,
+     libevtx_record_t **records,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	libevtx_record_values_t *record_values       = NULL;
+	static char *function                        = "libevtx_internal_file_get_records_by_range";
+	size64_t element_size                        = 0;
+	off64_t element_offset                       = 0;
+	uint32_t element_flags                       = 0;
+	uint16_t chunk_index                         = 0;
+	uint16_t chunk_record_index                  = 0;
+	int element_file_index                       = 0;
+	int last_chunk_index                         = -1;
+	int number_of_file_records                   = 0;
+	int range_index                              = 0;
+	int record_index                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_number_of_records(
+	     internal_file,
+	     &number_of_file_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_index < 0 )
+	 || ( first_record_index > number_of_file_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_records > ( number_of_file_records - first_record_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_records;
+	     range_index++ )
+	{
+		if( records[ range_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid record: %d value already set.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+	for( range_index = 0;
+	     range_index < number_of_records;
+	     range_index++ )
+	{
+		record_index = first_record_index + range_index;
+
+		if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+		{
+			/* The records of a chunk are consecutive hence the chunk descriptor
+			 * only needs to be looked up when the range crosses into another chunk
+			 */
+			if( ( chunk_descriptor == NULL )
+			 || ( record_index >= ( chunk_descriptor->first_record_index + (int) chunk_descriptor->number_of_records ) ) )
+			{
+				if( libevtx_file_get_chunk_descriptor_by_record_index(
+				     internal_file,
+				     record_index,
+				     &chunk_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk descriptor for record: %d.",
+					 function,
+					 record_index );
+
+					goto on_error;
+				}
+			}
+			chunk_index        = chunk_descriptor->chunk_index;
+			chunk_record_index = (uint16_t) ( record_index - chunk_descriptor->first_record_index );
+		}
+		else
+		{
+			if( libfdata_list_get_element_by_index(
+			     internal_file->records_list,
+			     record_index,
+			     &element_file_index,
+			     &element_offset,
+			     &element_size,
+			     &element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d element.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			/* The chunk index and the index of the record within the chunk
+			 * are stored in the element data size
+			 */
+			if( ( element_size & ~LIBEVTX_RECORD_ELEMENT_DATA_SIZE_MASK ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid record: %d element size value out of bounds.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			chunk_index        = (uint16_t) ( element_size & 0x0000ffffUL );
+			chunk_record_index = (uint16_t) ( ( element_size >> LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ) & 0x0000ffffUL );
+		}
+		if( (int) chunk_index != last_chunk_index )
+		{
+			if( libevtx_internal_file_get_chunk_by_index(
+			     internal_file,
+			     chunk_index,
+			     &chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			last_chunk_index = (int) chunk_index;
+		}
+		if( libevtx_file_read_chunk_record_values(
+		     internal_file,
+		     chunk,
+		     chunk_record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read record: %" PRIu16 " from chunk: %" PRIu16 ".",
+			 function,
+			 chunk_record_index,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( libevtx_record_initialize(
+		     &( records[ range_index ] ),
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     record_values,
+		     LIBEVTX_RECORD_FLAGS_DEFAULT | LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* The record values are now managed by the record
+		 */
+		record_values = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	while( range_index > 0 )
+	{
+		range_index--;
+
+		libevtx_record_free(
+		 &( records[ range_index ] ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the chunk that contains a specific record
+ * and the index of the record within the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_chunk_index_by_record_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     uint16_t *chunk_index,
+     uint16_t *chunk_record_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_internal_file_get_chunk_index_by_record_index";
+	size64_t element_size                        = 0;
+	off64_t element_offset                       = 0;
+	uint32_t element_flags                       = 0;
+	int element_file_index                       = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	{
+		if( libevtx_file_get_chunk_descriptor_by_record_index(
+		     internal_file,
+		     record_index,
+		     &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk descriptor for record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		*chunk_index        = chunk_descriptor->chunk_index;
+		*chunk_record_index = (uint16_t) ( record_index - chunk_descriptor->first_record_index );
+	}
+	else
+	{
+		if( libfdata_list_get_element_by_index(
+		     internal_file->records_list,
+		     record_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d element.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		/* The chunk index and the index of the record within the chunk
+		 * are stored in the element data size
+		 */
+		if( ( element_size & ~LIBEVTX_RECORD_ELEMENT_DATA_SIZE_MASK ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %d element size value out of bounds.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		*chunk_index        = (uint16_t) ( element_size & 0x0000ffffUL );
+		*chunk_record_index = (uint16_t) ( ( element_size >> LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ) & 0x0000ffffUL );
+	}
+	return( 1 );
+}
+
+/* Retrieves the chunk and the record values of a specific record
+ * The record values are managed by the chunk and remain valid while the chunk is cached
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_chunk_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_chunk_t **chunk,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *safe_chunk                 = NULL;
+	libevtx_record_values_t *safe_record_values = NULL;
+	static char *function                       = "libevtx_internal_file_get_chunk_record_values_by_index";
+	uint16_t chunk_index                        = 0;
+	uint16_t chunk_record_index                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_chunk_index_by_record_index(
+	     internal_file,
+	     record_index,
+	     &chunk_index,
+	     &chunk_record_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk index of record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_chunk_by_index(
+	     internal_file,
+	     chunk_index,
+	     &safe_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_get_record(
+	     safe_chunk,
+	     chunk_record_index,
+	     &safe_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %" PRIu16 " from chunk: %" PRIu16 ".",
+		 function,
+		 chunk_record_index,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( safe_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record: %" PRIu16 ".",
+		 function,
+		 chunk_record_index );
+
+		return( -1 );
+	}
+	*chunk         = safe_chunk;
+	*record_values = safe_record_values;
+
+	return( 1 );
+}
+
+/* Retrieves a specific record as a borrowed record
+ * The borrowed record is owned by the file and refers to the record values stored in the chunk
+ * instead of a copy, hence it is reused and only valid until the next call to this function,
+ * until the file is closed or until it is released using libevtx_file_release_borrowed_record
+ * The borrowed record should not be freed using libevtx_record_free
+ * Not supported if the file was opened with LIBEVTX_ACCESS_FLAG_THREAD_SAFE
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_borrowed_record_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_borrowed_record_by_index";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_borrowed_record_by_index(
+	          internal_file,
+	          record_index,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve borrowed record: %d.",
+		 function,
+		 record_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record as a borrowed record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_borrowed_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                     = NULL;
+	libevtx_internal_record_t *internal_record = NULL;
+	libevtx_record_values_t *record_values     = NULL;
+	static char *function                      = "libevtx_internal_file_get_borrowed_record_by_index";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_THREAD_SAFE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: borrowed records are not supported in thread-safe mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	/* The previously borrowed record can be passed to borrow the next record
+	 */
+	if( ( *record != NULL )
+	 && ( *record != internal_file->borrowed_record ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_chunk_record_values_by_index(
+	     internal_file,
+	     record_index,
+	     &chunk,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d values.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	/* The record values are managed by the chunk and are read in place
+	 * hence they remain valid while the chunk is cached
+	 */
+	if( libevtx_file_read_chunk_record_values_data(
+	     internal_file,
+	     chunk,
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record: %d values data.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( internal_file->borrowed_record == NULL )
+	{
+		if( libevtx_record_initialize(
+		     &( internal_file->borrowed_record ),
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     record_values,
+		     LIBEVTX_RECORD_FLAGS_DEFAULT | LIBEVTX_RECORD_FLAG_BORROWED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create borrowed record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		internal_record = (libevtx_internal_record_t *) internal_file->borrowed_record;
+
+		internal_record->io_handle      = internal_file->io_handle;
+		internal_record->file_io_handle = internal_file->file_io_handle;
+		internal_record->record_values  = record_values;
+	}
+	*record = internal_file->borrowed_record;
+
+	return( 1 );
+}
+
+/* Releases a borrowed record
+ * The borrowed record no longer refers to record values and the record reference is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_release_borrowed_record(
+     libevtx_file_t *file,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_release_borrowed_record";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *record != internal_file->borrowed_record )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record - not borrowed from file.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		( (libevtx_internal_record_t *) internal_file->borrowed_record )->record_values = NULL;
+
+		*record = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the record values of a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_file_get_record_values_by_index";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	{
+		result = libevtx_file_get_indexed_record_values_by_index(
+		          internal_file,
+		          record_index,
+		          record_values,
+		          error );
+	}
+	else
+	{
+		LIBEVTX_COUNTER_ADD(
+		 internal_file->io_handle->statistics.number_of_record_look_ups,
+		 1 );
+
+		result = libfdata_list_get_element_value_by_index(
+		          internal_file->records_list,
+		          (intptr_t *) internal_file->file_io_handle,
+		          internal_file->records_cache,
+		          record_index,
+		          (intptr_t **) record_values,
+		          0,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier of a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_record_identifier_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_file_get_record_identifier_by_index";
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_record_values_by_index(
+	     internal_file,
+	     record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	*identifier = record_values->identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the first record with an identifier equal to or greater than the specified identifier
+ * The records are ordered by chunk, if the chunks have wrapped around the records with
+ * the smallest identifiers are not at the start of the records. The records in order of
+ * their identifier start at the index returned for identifier 0 and continue at index 0
+ * after the last record.
+ * The record indexes are determined using a binary search which reads O(log n) records
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libevtx_file_seek_record_by_identifier(
+     libevtx_file_t *file,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_seek_record_by_identifier";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_seek_record_by_identifier(
+	          internal_file,
+	          identifier,
+	          record_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek record by identifier: %" PRIu64 ".",
+		 function,
+		 identifier );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index of the first record with an identifier equal to or greater than the specified identifier
+ * The records are ordered by chunk, if the chunks have wrapped around the records with
+ * the smallest identifiers are not at the start of the records. The records in order of
+ * their identifier start at the index returned for identifier 0 and continue at index 0
+ * after the last record.
+ * The record indexes are determined using a binary search which reads O(log n) records
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libevtx_internal_file_seek_record_by_identifier(
+     libevtx_internal_file_t *internal_file,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error )
+{
+	static char *function           = "libevtx_internal_file_seek_record_by_identifier";
+	uint64_t last_record_identifier = 0;
+	uint64_t record_identifier      = 0;
+	int first_record_index          = 0;
+	int lower_index                 = 0;
+	int middle_index                = 0;
+	int number_of_records           = 0;
+	int upper_index                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_number_of_records(
+	     internal_file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	if( libevtx_file_get_record_identifier_by_index(
+	     internal_file,
+	     number_of_records - 1,
+	     &last_record_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier of record: %d.",
+		 function,
+		 number_of_records - 1 );
+
+		return( -1 );
+	}
+	/* Determine the index of the record with the smallest identifier,
+	 * the records before it have an identifier greater than that of the last record
+	 */
+	lower_index = 0;
+	upper_index = number_of_records - 1;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libevtx_file_get_record_identifier_by_index(
+		     internal_file,
+		     middle_index,
+		     &record_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of record: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( record_identifier > last_record_identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	first_record_index = lower_index;
+
+	/* Determine the first record, in order of identifier, with an identifier equal to or greater than the specified identifier
+	 */
+	lower_index = 0;
+	upper_index = number_of_records;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libevtx_file_get_record_identifier_by_index(
+		     internal_file,
+		     ( first_record_index + middle_index ) % number_of_records,
+		     &record_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of record: %d.",
+			 function,
+			 ( first_record_index + middle_index ) % number_of_records );
+
+			return( -1 );
+		}
+		if( record_identifier < identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index >= number_of_records )
+	{
+		return( 0 );
+	}
+	*record_index = ( first_record_index + lower_index ) % number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the record with a specific identifier
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libevtx_file_get_record_by_identifier(
+     libevtx_file_t *file,
+     uint64_t identifier,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_record_by_identifier";
+	int record_index                       = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_record_index_by_identifier(
+	          internal_file,
+	          identifier,
+	          &record_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record index by identifier: %" PRIu64 ".",
+		 function,
+		 identifier );
+	}
+	else if( result != 0 )
+	{
+		if( libevtx_internal_file_get_record_by_index(
+		     internal_file,
+		     record_index,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index of the record with a specific identifier
+ * The record is first searched for by identifier range, using the chunk descriptors when
+ * the file was opened with lazy access and otherwise using the records, which reads
+ * O(log n) records. If the identifiers are not ascending in chunk order, such as
+ * in a corrupted log, the identifier index is used, which is built on first use
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libevtx_internal_file_get_record_index_by_identifier(
+     libevtx_internal_file_t *internal_file,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_internal_file_get_record_index_by_identifier";
+	uint64_t record_identifier                   = 0;
+	uint16_t chunk_record_index                  = 0;
+	int result                                   = 0;
+	int safe_record_index                        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	/* None of the records has an identifier greater than the last record identifier
+	 */
+	if( identifier > internal_file->io_handle->last_record_identifier )
+	{
+		return( 0 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	{
+		result = libevtx_file_get_chunk_descriptor_by_record_identifier(
+		          internal_file,
+		          identifier,
+		          &chunk_descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk descriptor by record identifier: %" PRIu64 ".",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libevtx_internal_file_get_chunk_by_index(
+			     internal_file,
+			     chunk_descriptor->chunk_index,
+			     &chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 ".",
+				 function,
+				 chunk_descriptor->chunk_index );
+
+				return( -1 );
+			}
+			result = libevtx_chunk_get_record_index_by_identifier(
+			          chunk,
+			          identifier,
+			          &chunk_record_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record index by identifier: %" PRIu64 " from chunk: %" PRIu16 ".",
+				 function,
+				 identifier,
+				 chunk_descriptor->chunk_index );
+
+				return( -1 );
+			}
+			/* The number of records in the chunk header can be less than the number of records read
+			 */
+			else if( ( result != 0 )
+			      && ( (uint32_t) chunk_record_index < chunk_descriptor->number_of_records ) )
+			{
+				*record_index = chunk_descriptor->first_record_index + (int) chunk_record_index;
+
+				return( 1 );
+			}
+		}
+	}
+	else
+	{
+		result = libevtx_internal_file_seek_record_by_identifier(
+		          internal_file,
+		          identifier,
+		          &safe_record_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek record by identifier: %" PRIu64 ".",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libevtx_file_get_record_identifier_by_index(
+			     internal_file,
+			     safe_record_index,
+			     &record_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve identifier of record: %d.",
+				 function,
+				 safe_record_index );
+
+				return( -1 );
+			}
+			if( record_identifier == identifier )
+			{
+				*record_index = safe_record_index;
+
+				return( 1 );
+			}
+		}
+	}
+	/* The identifier is not found when the identifiers are not ascending in chunk order
+	 */
+	result = libevtx_internal_file_build_identifier_index(
+	          internal_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libevtx_identifier_index_get_record_index(
+	          internal_file->identifier_index,
+	          identifier,
+	          record_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record index from identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a recovered record to the recovered records list
+ * If the file was opened to drop the recovered records that duplicate allocated records,
+ * the recovered record is retained as a candidate until all the allocated records were hashed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_append_recovered_record(
+     libevtx_internal_file_t *internal_file,
+     libevtx_chunk_t *chunk,
+     off64_t chunk_file_offset,
+     size_t record_chunk_data_offset,
+     size_t record_data_size,
+     uint64_t identifier,
+     uint64_t written_time,
+     size64_t element_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_append_recovered_record";
+	uint64_t record_hash  = 0;
+	int element_index     = 0;
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_records_filter != NULL )
+	{
+		if( libevtx_recovered_records_filter_calculate_hash(
+		     &record_hash,
+		     chunk->data,
+		     chunk->data_size,
+		     record_chunk_data_offset,
+		     record_data_size,
+		     identifier,
+		     written_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate recovered record hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_file->allocated_records_are_hashed == 0 )
+		{
+			if( libevtx_recovered_records_filter_append_candidate(
+			     internal_file->recovered_records_filter,
+			     chunk_file_offset + (off64_t) record_chunk_data_offset,
+			     element_data_size,
+			     record_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append recovered record candidate.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		result = libevtx_recovered_records_filter_is_duplicate(
+		          internal_file->recovered_records_filter,
+		          record_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if recovered record is a duplicate.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_file->number_of_duplicate_recovered_records += 1;
+
+			return( 1 );
+		}
+	}
+	if( libfdata_list_append_element(
+	     internal_file->recovered_records_list,
+	     &element_index,
+	     0,
+	     chunk_file_offset + (off64_t) record_chunk_data_offset,
+	     element_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element to recovered records list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the records of a chunk that did not change since the index file was written
+ * The records are appended from the indexed chunks instead of reading the chunk
+ * Returns 1 if the chunk was appended, 0 if the chunk needs to be read or -1 on error
+ */
+int libevtx_internal_file_append_indexed_chunk(
+     libevtx_internal_file_t *internal_file,
+     libevtx_indexed_chunks_t *indexed_chunks,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor        = NULL;
+	libevtx_chunk_descriptor_t *chunk_header_descriptor = NULL;
+	static char *function                               = "libevtx_internal_file_append_indexed_chunk";
+	uint64_t record_identifier                          = 0;
+	uint8_t records_are_allocated                       = 0;
+	int number_of_entries                               = 0;
+	int result                                          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The records of the chunk are allocated records under the same conditions
+	 * as when the records are indexed while opening the file
+	 */
+	if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+	 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+	{
+		records_are_allocated = 1;
+	}
+	if( libevtx_chunk_descriptor_initialize(
+	     &chunk_header_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk header descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_header_descriptor->chunk_index = chunk_index;
+
+	/* A chunk header that cannot be read is handled when the chunk is read
+	 */
+	result = libevtx_chunk_descriptor_read_file_io_handle(
+	          chunk_header_descriptor,
+	          internal_file->io_handle,
+	          file_io_handle,
+	          file_offset,
+	          NULL );
+
+	if( result == 1 )
+	{
+		result = libevtx_indexed_chunks_take_chunk(
+		          indexed_chunks,
+		          chunk_index,
+		          chunk_header_descriptor,
+		          records_are_allocated,
+		          internal_file->records_list,
+		          internal_file->recovered_records_list,
+		          &chunk_descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to take indexed chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+	if( libevtx_chunk_descriptor_free(
+	     &chunk_header_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk header descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( chunk_descriptor->number_of_indexed_records > 0 )
+	{
+		if( chunk_descriptor->minimum_record_identifier < internal_file->io_handle->first_record_identifier )
+		{
+			internal_file->io_handle->first_record_identifier = chunk_descriptor->minimum_record_identifier;
+		}
+		if( chunk_descriptor->maximum_record_identifier > internal_file->io_handle->last_record_identifier )
+		{
+			internal_file->io_handle->last_record_identifier = chunk_descriptor->maximum_record_identifier;
+		}
+		/* The record identifiers of an indexed chunk with allocated records are contiguous
+		 */
+		if( records_are_allocated != 0 )
+		{
+			if( chunk_descriptor->maximum_record_identifier > internal_file->last_indexed_record_identifier )
+			{
+				internal_file->last_indexed_record_identifier = chunk_descriptor->maximum_record_identifier;
+			}
+			for( record_identifier = chunk_descriptor->minimum_record_identifier;
+			     record_identifier <= chunk_descriptor->maximum_record_identifier;
+			     record_identifier++ )
+			{
+				if( libevtx_identifier_gaps_append_identifier(
+				     internal_file->identifier_gaps,
+				     record_identifier,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record identifier to identifier gaps.",
+					 function );
+
+					goto on_error;
+				}
+				if( record_identifier == UINT64_MAX )
+				{
+					break;
+				}
+			}
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->chunk_written_time_ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk written time ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( (int) chunk_index >= number_of_entries )
+	{
+		if( libcdata_array_resize(
+		     internal_file->chunk_written_time_ranges_array,
+		     (int) chunk_index + 1,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize chunk written time ranges array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_file->chunk_written_time_ranges_array,
+	     (int) chunk_index,
+	     (intptr_t *) chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk: %" PRIu16 " written time range in array.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	if( chunk_header_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_header_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the recovered record candidates that do not duplicate allocated records
+ * to the recovered records list, after all the allocated records were hashed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_filter_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function       = "libevtx_internal_file_filter_recovered_records";
+	size64_t element_data_size  = 0;
+	off64_t element_file_offset = 0;
+	uint64_t record_hash        = 0;
+	int candidate_index         = 0;
+	int element_index           = 0;
+	int result                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_records_filter == NULL )
+	{
+		return( 1 );
+	}
+	for( candidate_index = 0;
+	     candidate_index < internal_file->recovered_records_filter->number_of_candidates;
+	     candidate_index++ )
+	{
+		if( libevtx_recovered_records_filter_get_candidate(
+		     internal_file->recovered_records_filter,
+		     candidate_index,
+		     &element_file_offset,
+		     &element_data_size,
+		     &record_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered record candidate: %d.",
+			 function,
+			 candidate_index );
+
+			return( -1 );
+		}
+		result = libevtx_recovered_records_filter_is_duplicate(
+		          internal_file->recovered_records_filter,
+		          record_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if recovered record candidate: %d is a duplicate.",
+			 function,
+			 candidate_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_file->number_of_duplicate_recovered_records += 1;
+
+			continue;
+		}
+		if( libfdata_list_append_element(
+		     internal_file->recovered_records_list,
+		     &element_index,
+		     0,
+		     element_file_offset,
+		     element_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element to recovered records list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_recovered_records_filter_clear_candidates(
+	     internal_file->recovered_records_filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear recovered record candidates.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->allocated_records_are_hashed = 1;
+
+	/* The hashes are only needed afterwards to filter the recovered records
+	 * of which the scan was deferred
+	 */
+	if( internal_file->recovery_is_pending == 0 )
+	{
+		if( libevtx_recovered_records_filter_free(
+		     &( internal_file->recovered_records_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovered records filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the recovered records of which the scan was deferred when the file was opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_read_deferred_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_file_read_deferred_recovered_records";
+	uint16_t chunk_index                   = 0;
+	uint16_t number_of_records             = 0;
+	uint16_t record_index                  = 0;
+	int pending_index                      = 0;
+	int result                             = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovery_is_pending == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have scanned the free space while waiting for the lock
+	 */
+	if( internal_file->recovery_is_pending != 0 )
+	{
+		/* Chunks read from now on scan their free space when they are read
+		 */
+		internal_file->io_handle->flags &= ~( LIBEVTX_IO_HANDLE_FLAG_DEFERRED_RECOVERY );
+
+		for( pending_index = 0;
+		     pending_index < internal_file->number_of_pending_recovery_chunks;
+		     pending_index++ )
+		{
+			chunk_index = internal_file->pending_recovery_chunk_indexes[ pending_index ];
+
+			if( libevtx_internal_file_get_chunk_by_index(
+			     internal_file,
+			     chunk_index,
+			     &chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				result = -1;
+
+				break;
+			}
+			if( chunk == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				result = -1;
+
+				break;
+			}
+			if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_RECOVERY_IS_PENDING ) != 0 )
+			{
+				if( libevtx_chunk_read_recovered_records(
+				     chunk,
+				     internal_file->io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read chunk: %" PRIu16 " recovered records.",
+					 function,
+					 chunk_index );
+
+					result = -1;
+
+					break;
+				}
+			}
+			if( libevtx_chunk_get_number_of_recovered_records(
+			     chunk,
+			     &number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 " number of recovered records.",
+				 function,
+				 chunk_index );
+
+				result = -1;
+
+				break;
+			}
+			for( record_index = 0;
+			     record_index < number_of_records;
+			     record_index++ )
+			{
+				if( libevtx_chunk_get_recovered_record(
+				     chunk,
+				     record_index,
+				     &record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					result = -1;
+
+					break;
+				}
+				if( record_values == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					result = -1;
+
+					break;
+				}
+				/* The chunk index and the index of the record within the chunk
+				 * are stored in the element data size
+				 */
+				if( libevtx_internal_file_append_recovered_record(
+				     internal_file,
+				     chunk,
+				     chunk->file_offset,
+				     record_values->chunk_data_offset,
+				     (size_t) record_values->data_size,
+				     record_values->identifier,
+				     record_values->written_time,
+				     (size64_t) chunk_index | ( (size64_t) record_index << LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ) | LIBEVTX_RECORD_ELEMENT_FLAG_RECOVERED,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append recovered record.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+			if( result != 1 )
+			{
+				break;
+			}
+		}
+		/* The pending state is cleared on failure as well so that the recovered
+		 * records are not appended more than once
+		 */
+		if( internal_file->pending_recovery_chunk_indexes != NULL )
+		{
+			memory_free(
+			 internal_file->pending_recovery_chunk_indexes );
+
+			internal_file->pending_recovery_chunk_indexes = NULL;
+		}
+		internal_file->number_of_pending_recovery_chunks = 0;
+		internal_file->recovery_is_pending               = 0;
+
+		if( internal_file->recovered_records_filter != NULL )
+		{
+			if( libevtx_recovered_records_filter_free(
+			     &( internal_file->recovered_records_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free recovered records filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of recovered records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_recovered_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_recovered_records";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( libevtx_internal_file_read_deferred_recovered_records(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred recovered records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_number_of_recovered_records(
+	          internal_file,
+	          number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of recovered records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_number_of_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_get_number_of_recovered_records";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->recovered_records_list,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of recovered records that were dropped since they duplicate allocated records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_duplicate_recovered_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_duplicate_recovered_records";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	/* The recovered records of which the scan was deferred are filtered when they are read
+	 */
+	if( libevtx_internal_file_read_deferred_recovered_records(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred recovered records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_records = internal_file->number_of_duplicate_recovered_records;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific recovered record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_recovered_record(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_recovered_record";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( libevtx_internal_file_read_deferred_recovered_records(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred recovered records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_recovered_record(
+	          internal_file,
+	          record_index,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered record: %d.",
+		 function,
+		 record_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific recovered record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_recovered_record(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_file_get_recovered_record";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	LIBEVTX_COUNTER_ADD(
+	 internal_file->io_handle->statistics.number_of_record_look_ups,
+	 1 );
+
+	if( libfdata_list_get_element_value_by_index(
+	     internal_file->recovered_records_list,
+	     (intptr_t *) internal_file->file_io_handle,
+	     internal_file->records_cache,
+	     record_index,
+	     (intptr_t **) &record_values,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_create_record(
+	     internal_file,
+	     record_values,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific recovered record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_recovered_record_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_recovered_record_by_index";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( libevtx_internal_file_read_deferred_recovered_records(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred recovered records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_get_recovered_record_by_index(
+	          internal_file,
+	          record_index,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered record: %d.",
+		 function,
+		 record_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific recovered record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_get_recovered_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_file_get_recovered_record_by_index";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	LIBEVTX_COUNTER_ADD(
+	 internal_file->io_handle->statistics.number_of_record_look_ups,
+	 1 );
+
+	if( libfdata_list_get_element_value_by_index(
+	     internal_file->recovered_records_list,
+	     (intptr_t *) internal_file->file_io_handle,
+	     internal_file->records_cache,
+	     record_index,
+	     (intptr_t **) &record_values,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_create_record(
+	     internal_file,
+	     record_values,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Refreshes the file to add records written since the file was opened or last refreshed
+ * The chunk headers are used to determine the chunks that contain records newer than
+ * the last indexed record, these chunks are read in order of their first record identifier
+ * Returns 1 if records were added, 0 if not or -1 on error
+ */
+int libevtx_file_refresh(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_refresh";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_file_refresh(
+	          internal_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to refresh file.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Refreshes the file to add records written since the file was opened or last refreshed
+ * The chunk headers are used to determine the chunks that contain records newer than
+ * the last indexed record, these chunks are read in order of their first record identifier
+ * Returns 1 if records were added, 0 if not or -1 on error
+ */
+int libevtx_internal_file_refresh(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *chunk_descriptors_array    = NULL;
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_internal_file_refresh";
+	off64_t file_offset                          = 0;
+	size64_t file_size                           = 0;
+	size_t record_chunk_data_offset              = 0;
+	uint64_t record_identifier                   = 0;
+	uint16_t chunk_index                         = 0;
+	uint16_t number_of_records                   = 0;
+	uint16_t record_index                        = 0;
+	int element_index                            = 0;
+	int entry_index                              = 0;
+	int number_of_added_records                  = 0;
+	int number_of_entries                        = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_LAZY ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: refresh not supported for a file opened with lazy access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: refresh not supported for a file opened with recovered only access.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->is_partition != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: refresh not supported for a file opened as a partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing records list.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file IO handle is reopened, if opened by the library,
+	 * to determine the current size of the file
+	 */
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_open(
+		     internal_file->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_io_handle_read_file_header(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size > (size64_t) internal_file->io_handle->chunks_data_offset )
+	{
+		internal_file->io_handle->chunks_data_size = file_size
+		                                           - internal_file->io_handle->chunks_data_offset;
+
+		if( internal_file->io_handle->chunk_prefetcher != NULL )
+		{
+			/* The file size is only used when scheduling chunks hence
+			 * it can be changed without synchronizing with the read thread
+			 */
+			internal_file->io_handle->chunk_prefetcher->file_size = file_size;
+		}
+		if( internal_file->io_handle->async_reader != NULL )
+		{
+			if( libevtx_async_reader_set_file_size(
+			     internal_file->io_handle->async_reader,
+			     file_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set asynchronous reader file size.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( internal_file->io_handle->read_buffer != NULL )
+		{
+			if( libevtx_read_buffer_set_file_size(
+			     internal_file->io_handle->read_buffer,
+			     file_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set read buffer file size.",
+				 function );
+
+				goto on_error;
+			}
+		}
+
+		if( libfdata_vector_set_segment_by_index(
+		     internal_file->chunks_vector,
+		     0,
+		     0,
+		     internal_file->io_handle->chunks_data_offset,
+		     internal_file->io_handle->chunks_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment in chunks vector.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The refreshed records can be stored in chunks that were rewritten
+	 * hence the chunks are considered not read yet
+	 */
+	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_LIVE ) != 0 )
+	{
+		if( libevtx_io_handle_reset_live_chunk_record_identifiers(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset live chunk record identifiers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_initialize(
+	     &chunk_descriptors_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunk that contains the last indexed record is read again since
+	 * records can have been added to it
+	 */
+	file_offset = internal_file->io_handle->chunks_data_offset;
+
+	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	{
+		if( libevtx_chunk_descriptor_initialize(
+		     &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk descriptor: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunk_descriptor->chunk_index = chunk_index;
+
+		result = libevtx_chunk_descriptor_read_file_io_handle(
+		          chunk_descriptor,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk descriptor: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		/* If the file is not dirty, records found in chunks outside the indicated
+		 * range are considered recovered and are not indexed
+		 */
+		else if( ( result != 0 )
+		      && ( chunk_descriptor->number_of_records > 0 )
+		      && ( chunk_descriptor->last_record_identifier >= internal_file->last_indexed_record_identifier )
+		      && ( ( chunk_index < internal_file->io_handle->number_of_chunks )
+		       ||  ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) ) )
+		{
+			if( libcdata_array_insert_entry(
+			     chunk_descriptors_array,
+			     &entry_index,
+			     (intptr_t *) chunk_descriptor,
+			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libevtx_chunk_descriptor_compare_by_first_record_identifier,
+			     LIBCDATA_INSERT_FLAG_NON_UNIQUE_ENTRIES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert chunk descriptor: %" PRIu16 " in array.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			chunk_descriptor = NULL;
+		}
+		if( chunk_descriptor != NULL )
+		{
+			if( libevtx_chunk_descriptor_free(
+			     &chunk_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk descriptor: %" PRIu16 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		file_offset += internal_file->io_handle->chunk_size;
+
+		chunk_index++;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     chunk_descriptors_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     chunk_descriptors_array,
+		     entry_index,
+		     (intptr_t **) &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk descriptor: %d.",
+			 function,
+			 entry_index );
+
+			chunk_descriptor = NULL;
+
+			goto on_error;
+		}
+		if( chunk_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk descriptor: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		chunk_index = chunk_descriptor->chunk_index;
+
+		/* The chunk descriptor is managed by the array
+		 */
+		chunk_descriptor = NULL;
+
+		if( libevtx_chunk_initialize(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		file_offset = internal_file->io_handle->chunks_data_offset
+		            + ( (off64_t) chunk_index * internal_file->io_handle->chunk_size );
+
+		result = libevtx_chunk_read(
+		          chunk,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libevtx_chunk_get_number_of_records(
+			     chunk,
+			     &number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 " number of records.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			for( record_index = 0;
+			     record_index < number_of_records;
+			     record_index++ )
+			{
+				/* The record values are not created to index the records
+				 */
+				if( libevtx_chunk_get_record_identifier(
+				     chunk,
+				     record_index,
+				     &record_identifier,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 " identifier.",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					goto on_error;
+				}
+				if( libevtx_chunk_get_record_chunk_data_offset(
+				     chunk,
+				     record_index,
+				     &record_chunk_data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 " chunk data offset.",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					goto on_error;
+				}
+				if( record_identifier <= internal_file->last_indexed_record_identifier )
+				{
+					continue;
+				}
+				internal_file->last_indexed_record_identifier = record_identifier;
+
+				if( record_identifier < internal_file->io_handle->first_record_identifier )
+				{
+					internal_file->io_handle->first_record_identifier = record_identifier;
+				}
+				if( record_identifier > internal_file->io_handle->last_record_identifier )
+				{
+					internal_file->io_handle->last_record_identifier = record_identifier;
+				}
+				/* The chunk index and the index of the record within the chunk
+				 * are stored in the element data size
+				 */
+				if( libfdata_list_append_element(
+				     internal_file->records_list,
+				     &element_index,
+				     0,
+				     file_offset + record_chunk_data_offset,
+				     (size64_t) chunk_index | ( (size64_t) record_index << LIBEVTX_RECORD_ELEMENT_RECORD_INDEX_SHIFT ),
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append element to records list.",
+					 function );
+
+					goto on_error;
+				}
+				number_of_added_records++;
+			}
+			if( libevtx_file_set_chunk_written_time_range(
+			     internal_file,
+			     chunk_index,
+			     chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %" PRIu16 " written time range.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( libevtx_chunk_free(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_free(
+	     &chunk_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_added_records == 0 )
+	{
+		return( 0 );
+	}
+	/* Cached chunks can be outdated since records were added to them
+	 */
+	if( libfcache_cache_clear(
+	     internal_file->chunks_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear chunks cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->cache_file_identifier != -1 )
+	{
+		if( libevtx_internal_cache_remove_file_chunks(
+		     internal_file->cache,
+		     internal_file->cache_file_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to remove chunks from shared chunk cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevtx_chunks_table_reset_scan(
+	     internal_file->chunks_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to reset scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_chunks_table_reset_pinned(
+	     internal_file->chunks_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to reset pinned chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->chunks_table->record_decoder != NULL )
+	{
+		if( libevtx_record_decoder_reset(
+		     internal_file->chunks_table->record_decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset record decoder.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfcache_cache_clear(
+	     internal_file->records_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear records cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* Records of a wrapped file can be stored at the offset of an overwritten record
+	 */
+	if( internal_file->document_cache != NULL )
+	{
+		if( libevtx_document_cache_clear(
+		     internal_file->document_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear document cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	if( chunk_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &chunk_descriptors_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the written time range of a specific chunk
+ * Returns 1 if successful, 0 if the range has not been determined or -1 on error
+ */
+int libevtx_file_get_chunk_written_time_range(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *safe_chunk_descriptor = NULL;
+	static char *function                             = "libevtx_file_get_chunk_written_time_range";
+	int number_of_entries                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->chunk_written_time_ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk written time ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( (int) chunk_index >= number_of_entries )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->chunk_written_time_ranges_array,
+	     (int) chunk_index,
+	     (intptr_t **) &safe_chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 " written time range.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( safe_chunk_descriptor == NULL )
+	{
+		return( 0 );
+	}
+	*chunk_descriptor = safe_chunk_descriptor;
+
+	return( 1 );
+}
+
+/* Sets the written time range of a specific chunk from its records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_chunk_written_time_range(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_file_set_chunk_written_time_range";
+	uint8_t records_flags                        = 0;
+	int number_of_entries                        = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The records of the chunk are allocated records under the same conditions
+	 * as when the records are indexed while opening the file
+	 */
+	if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+	 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+	{
+		records_flags = LIBEVTX_CHUNK_DESCRIPTOR_FLAG_RECORDS_ARE_ALLOCATED;
+	}
+	result = libevtx_file_get_chunk_written_time_range(
+	          internal_file,
+	          chunk_index,
+	          &chunk_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 " written time range.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The range is updated since records can have been added to the chunk
+		 */
+		if( libevtx_chunk_descriptor_set_written_time_range(
+		     chunk_descriptor,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %" PRIu16 " written time range.",
+			 function,
+			 chunk_index );
+
+			chunk_descriptor = NULL;
+
+			goto on_error;
+		}
+		/* The summary and the value filter do not contain the values of the added records
+		 */
+		chunk_descriptor->flags &= ~( LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY | LIBEVTX_CHUNK_DESCRIPTOR_FLAG_RECORDS_ARE_ALLOCATED );
+		chunk_descriptor->flags |= records_flags;
+
+		if( chunk_descriptor->value_filter != NULL )
+		{
+			if( libevtx_value_filter_free(
+			     &( chunk_descriptor->value_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk: %" PRIu16 " value filter.",
+				 function,
+				 chunk_index );
+
+				chunk_descriptor = NULL;
+
+				goto on_error;
+			}
+		}
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->chunk_written_time_ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk written time ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( (int) chunk_index >= number_of_entries )
+	{
+		if( libcdata_array_resize(
+		     internal_file->chunk_written_time_ranges_array,
+		     (int) chunk_index + 1,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize chunk written time ranges array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevtx_chunk_descriptor_initialize(
+	     &chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_descriptor->chunk_index = chunk_index;
+
+	if( libevtx_chunk_descriptor_set_written_time_range(
+	     chunk_descriptor,
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk: %" PRIu16 " written time range.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	chunk_descriptor->flags |= records_flags;
+
+	if( libcdata_array_set_entry_by_index(
+	     internal_file->chunk_written_time_ranges_array,
+	     (int) chunk_index,
+	     (intptr_t *) chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk: %" PRIu16 " written time range in array.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the summary of the event identifiers and provider identifiers of a specific chunk from its records
+ * The summary is stored in the chunk descriptor of the written time range, which must be set first
+ * If value filters are enabled the value filter of the EventData values is set as well
+ * A summary or value filter that was already set is left as is
+ * Returns 1 if successful, 0 if no written time range was set for the chunk or -1 on error
+ */
+int libevtx_file_set_chunk_summary(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_file_set_chunk_summary";
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_file_get_chunk_written_time_range(
+	          internal_file,
+	          chunk_index,
+	          &chunk_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 " written time range.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY ) == 0 )
+	{
+		if( libevtx_chunk_descriptor_set_summary(
+		     chunk_descriptor,
+		     chunk,
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %" PRIu16 " summary.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	if( ( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) != 0 )
+	 && ( chunk_descriptor->value_filter == NULL ) )
+	{
+		if( libevtx_chunk_descriptor_set_value_filter(
+		     chunk_descriptor,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %" PRIu16 " value filter.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if every chunk with records has a summary
+ * Returns 1 if every chunk has a summary, 0 if not or -1 on error
+ */
+int libevtx_internal_file_has_chunk_summaries(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_internal_file_has_chunk_summaries";
+	int entry_index                              = 0;
+	int number_of_entries                        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunk_written_time_ranges_array == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->chunk_written_time_ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk written time ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->chunk_written_time_ranges_array,
+		     entry_index,
+		     (intptr_t **) &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %d written time range.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( chunk_descriptor != NULL )
+		 && ( ( chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY ) == 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the chunk that contains the oldest records
+ * The chunks of a circular log are written in order and wrap around to the first chunk,
+ * so the chunk with the smallest first record identifier in its header is where
+ * the wrap point is. Chunks of which the header indicates no records are ignored
+ * Returns 1 if successful, 0 if no chunk contains records or -1 on error
+ */
+int libevtx_internal_file_get_oldest_chunk_index(
+     libevtx_internal_file_t *internal_file,
+     int number_of_chunks,
+     uint16_t *chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_internal_file_get_oldest_chunk_index";
+	off64_t file_offset                          = 0;
+	uint64_t oldest_record_identifier            = 0;
+	uint16_t oldest_chunk_index                  = 0;
+	int iterated_chunk_index                     = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunks < 0 )
+	 || ( number_of_chunks > ( (int) UINT16_MAX + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_descriptor_initialize(
+	     &chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the chunk headers are read
+	 */
+	file_offset = internal_file->io_handle->chunks_data_offset;
+
+	for( iterated_chunk_index = 0;
+	     iterated_chunk_index < number_of_chunks;
+	     iterated_chunk_index++ )
+	{
+		chunk_descriptor->chunk_index = (uint16_t) iterated_chunk_index;
+
+		result = libevtx_chunk_descriptor_read_file_io_handle(
+		          chunk_descriptor,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %d header.",
+			 function,
+			 iterated_chunk_index );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( chunk_descriptor->number_of_records > 0 ) )
+		{
+			if( ( oldest_record_identifier == 0 )
+			 || ( chunk_descriptor->first_record_identifier < oldest_record_identifier ) )
+			{
+				oldest_record_identifier = chunk_descriptor->first_record_identifier;
+				oldest_chunk_index       = (uint16_t) iterated_chunk_index;
+			}
+		}
+		file_offset += internal_file->io_handle->chunk_size;
+	}
+	if( libevtx_chunk_descriptor_free(
+	     &chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( oldest_record_identifier == 0 )
+	{
+		return( 0 );
+	}
+	*chunk_index = oldest_chunk_index;
+
+	return( 1 );
+
+on_error:
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Iterates the records in a single forward pass
+ * Every chunk is read and parsed once and released before the next chunk is read,
+ * the records list and records cache are not used
+ * If the iterate order is LIBEVTX_ITERATE_BY_RECORD_IDENTIFIER the chunks are read
+ * starting at the chunk with the oldest records and wrapping around at the end of the file
+ * The record passed to the callback is only valid during the callback and must not be freed
+ * The callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful, 0 if the iteration was stopped by the callback or -1 on error
+ */
+int libevtx_file_iterate_records(
+     libevtx_file_t *file,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_file_iterate_records";
+	int result            = 0;
+
+	result = libevtx_file_iterate_records_in_time_range(
+	          file,
+	          0,
+	          (uint64_t) UINT64_MAX,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to iterate records.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Iterates the records with a written time within a specific range
+ * The first and last written time are inclusive
+ * Chunks of which the written time range is known and does not overlap are skipped
+ * without being read, otherwise the range of the chunk is determined when it is read
+ * Returns 1 if successful, 0 if the iteration was stopped by the callback or -1 on error
+ */
+int libevtx_file_iterate_records_in_time_range(
+     libevtx_file_t *file,
+     uint64_t first_written_time,
+     uint64_t last_written_time,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_file_iterate_records_in_time_range";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_file_iterate_records_with_internal_filter(
+	          (libevtx_internal_file_t *) file,
+	          NULL,
+	          first_written_time,
+	          last_written_time,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to iterate records.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Iterates the records that match a record filter
+ * The event identifier, level, provider identifier and channel of a record are
+ * read from its binary XML data where possible, so that records that do not match
+ * are skipped without creating an XML document
+ * The callback behaves the same as for libevtx_file_iterate_records
+ * Returns 1 if successful, 0 if the iteration was stopped by the callback or -1 on error
+ */
+int libevtx_file_iterate_records_with_filter(
+     libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_file_iterate_records_with_filter";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_file_iterate_records_with_internal_filter(
+	          (libevtx_internal_file_t *) file,
+	          (libevtx_internal_record_filter_t *) record_filter,
+	          0,
+	          (uint64_t) UINT64_MAX,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to iterate records.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Iterates the records with a written time within a specific range that match a record filter
+ * The record filter is optional
+ * Returns 1 if successful, 0 if the iteration was stopped by the callback or -1 on error
+ */
+int libevtx_file_iterate_records_with_internal_filter(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     uint64_t first_written_time,
+     uint64_t last_written_time,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	libevtx_record_t *record                     = NULL;
+	libevtx_record_values_t *record_values       = NULL;
+	static char *function                        = "libevtx_file_iterate_records_with_internal_filter";
+	off64_t file_offset                          = 0;
+	size64_t file_size                           = 0;
+	uint64_t record_written_time                 = 0;
+	uint16_t chunk_index                         = 0;
+	uint16_t first_chunk_index                   = 0;
+	uint16_t number_of_records                   = 0;
+	uint16_t record_index                        = 0;
+	int callback_result                          = 1;
+	int iterated_chunk_index                     = 0;
+	int number_of_chunks                         = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_written_time > last_written_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first written time value exceeds last written time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the file is not dirty, records found in chunks outside the indicated
+	 * range are considered recovered
+	 */
+	file_offset = internal_file->io_handle->chunks_data_offset;
+
+	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	{
+		if( ( number_of_chunks >= (int) internal_file->io_handle->number_of_chunks )
+		 && ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) == 0 ) )
+		{
+			break;
+		}
+		if( number_of_chunks > (int) UINT16_MAX )
+		{
+			break;
+		}
+		file_offset += internal_file->io_handle->chunk_size;
+
+		number_of_chunks++;
+	}
+	if( ( internal_file->io_handle->iterate_order == LIBEVTX_ITERATE_BY_RECORD_IDENTIFIER )
+	 && ( number_of_chunks > 1 ) )
+	{
+		if( libevtx_internal_file_get_oldest_chunk_index(
+		     internal_file,
+		     number_of_chunks,
+		     &first_chunk_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve oldest chunk index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Every chunk is read once in order
+	 */
+	if( libevtx_io_handle_advise_sequential_access(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise sequential access.",
+		 function );
+
+		goto on_error;
+	}
+	for( iterated_chunk_index = 0;
+	     iterated_chunk_index < number_of_chunks;
+	     iterated_chunk_index++ )
+	{
+		chunk_index = (uint16_t) ( ( (int) first_chunk_index + iterated_chunk_index ) % number_of_chunks );
+		file_offset = internal_file->io_handle->chunks_data_offset
+		            + ( (off64_t) chunk_index * internal_file->io_handle->chunk_size );
+
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libevtx_internal_file_grab_for_read(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libevtx_file_get_chunk_written_time_range(
+		          internal_file,
+		          chunk_index,
+		          &chunk_descriptor,
+		          error );
+
+		if( result == 1 )
+		{
+			result = libevtx_chunk_descriptor_overlaps_written_time_range(
+			          chunk_descriptor,
+			          first_written_time,
+			          last_written_time,
+			          error );
+		}
+		else if( result == 0 )
+		{
+			/* The written time range of the chunk is not known yet
+			 */
+			result = 1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if chunk: %" PRIu16 " overlaps written time range.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libevtx_chunk_initialize(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		result = libevtx_chunk_read(
+		          chunk,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libevtx_internal_file_grab_for_write(
+			     internal_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			result = libevtx_file_set_chunk_written_time_range(
+			          internal_file,
+			          chunk_index,
+			          chunk,
+			          error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %" PRIu16 " written time range.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			if( libevtx_chunk_get_number_of_records(
+			     chunk,
+			     &number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 " number of records.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			for( record_index = 0;
+			     record_index < number_of_records;
+			     record_index++ )
+			{
+				/* The written time is checked before the record values are created
+				 */
+				if( libevtx_chunk_get_record_written_time(
+				     chunk,
+				     record_index,
+				     &record_written_time,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 " written time.",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					goto on_error;
+				}
+				if( ( record_written_time < first_written_time )
+				 || ( record_written_time > last_written_time ) )
+				{
+					continue;
+				}
+				if( libevtx_chunk_get_record(
+				     chunk,
+				     record_index,
+				     &record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 ".",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					goto on_error;
+				}
+				if( record_values == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing chunk: %" PRIu16 " record: %" PRIu16 ".",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					goto on_error;
+				}
+				/* The search strings are tested on the binary XML data
+				 * so that records without a match are not decoded
+				 */
+				if( internal_record_filter != NULL )
+				{
+					result = libevtx_record_filter_match_record_data(
+					          internal_record_filter,
+					          record_values,
+					          chunk->data,
+					          chunk->data_size,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to determine if chunk: %" PRIu16 " record: %" PRIu16 " data matches record filter.",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+					else if( result == 0 )
+					{
+						continue;
+					}
+				}
+				result = 0;
+
+				if( ( internal_record_filter != NULL )
+				 || ( internal_file->io_handle->decode_depth == LIBEVTX_DECODE_DEPTH_SYSTEM ) )
+				{
+					result = libevtx_record_values_read_system_values(
+					          record_values,
+					          internal_file->io_handle,
+					          &( chunk->system_values_template_cache ),
+					          chunk->data,
+					          chunk->data_size,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read chunk: %" PRIu16 " record: %" PRIu16 " system values.",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+				}
+				/* Fall back to the XML document if the binary XML data
+				 * is not supported by the system values
+				 */
+				if( ( result == 0 )
+				 && ( record_values->xml_document == NULL ) )
+				{
+					if( libevtx_record_values_read_xml_document(
+					     record_values,
+					     internal_file->io_handle,
+					     chunk->data,
+					     chunk->data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read chunk: %" PRIu16 " record: %" PRIu16 " XML document.",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+				}
+				/* A record that exceeds the decode budget is skipped
+				 */
+				if( record_values->is_partially_decoded != 0 )
+				{
+					continue;
+				}
+				if( internal_record_filter != NULL )
+				{
+					if( result != 0 )
+					{
+						result = libevtx_record_filter_match_system_values(
+						          internal_record_filter,
+						          &( record_values->system_values ),
+						          error );
+					}
+					else
+					{
+						result = libevtx_record_filter_match_record_values(
+						          internal_record_filter,
+						          record_values,
+						          error );
+					}
+					if( result == 1 )
+					{
+						result = libevtx_internal_file_match_chunk_record_expression(
+						          internal_file,
+						          internal_record_filter,
+						          chunk,
+						          record_values,
+						          error );
+					}
+					if( result == -1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to recovered records list.",
-						 function );
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to determine if chunk: %" PRIu16 " record: %" PRIu16 " matches record filter.",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+					else if( result == 0 )
+					{
+						continue;
+					}
+				}
+				if( ( record_values->xml_document == NULL )
+				 && ( internal_file->io_handle->decode_depth != LIBEVTX_DECODE_DEPTH_SYSTEM ) )
+				{
+					if( libevtx_record_values_read_xml_document(
+					     record_values,
+					     internal_file->io_handle,
+					     chunk->data,
+					     chunk->data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read chunk: %" PRIu16 " record: %" PRIu16 " XML document.",
+						 function,
+						 chunk_index,
+						 record_index );
+
+						goto on_error;
+					}
+				}
+				/* A record that exceeds the decode budget is skipped
+				 */
+				if( record_values->is_partially_decoded != 0 )
+				{
+					continue;
+				}
+				/* The record values are owned by the chunk
+				 */
+				if( libevtx_record_initialize(
+				     &record,
+				     internal_file->io_handle,
+				     internal_file->file_io_handle,
+				     record_values,
+				     LIBEVTX_RECORD_FLAGS_DEFAULT,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create record.",
+					 function );
+
+					goto on_error;
+				}
+				callback_result = callback(
+				                   record,
+				                   user_data );
+
+				if( libevtx_record_free(
+				     &record,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record.",
+					 function );
+
+					goto on_error;
+				}
+				if( callback_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: callback failed for chunk: %" PRIu16 " record: %" PRIu16 ".",
+					 function,
+					 chunk_index,
+					 record_index );
+
+					goto on_error;
+				}
+				else if( callback_result == 0 )
+				{
+					break;
+				}
+			}
+		}
+		if( libevtx_chunk_free(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( callback_result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
+/* Reads the decoded values file
+ * If the decoded values file does not exist or cannot be used the System values
+ * of all the records are decoded and the decoded values file is written
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_read_decoded_values_file(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                             = NULL;
+	libevtx_decoded_values_file_t *decoded_values_file = NULL;
+	libevtx_record_values_t *record_values             = NULL;
+	static char *function                              = "libevtx_internal_file_read_decoded_values_file";
+	size64_t file_size                                 = 0;
+	int number_of_records                              = 0;
+	int record_index                                   = 0;
+	int result                                         = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->decoded_values_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - decoded values file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->decoded_values_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing decoded values file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_decoded_values_file_initialize(
+	     &decoded_values_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevtx_decoded_values_file_read(
+	          decoded_values_file,
+	          internal_file->decoded_values_file_io_handle,
+	          internal_file->io_handle->file_header_checksum,
+	          internal_file->io_handle->modification_time,
+	          file_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read decoded values file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		internal_file->io_handle->decoded_values_file = decoded_values_file;
+
+		return( 1 );
+	}
+	/* The decoded values file is not written for a dirty file since its chunks can change
+	 * without the file header being updated
+	 */
+	if( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 )
+	{
+		if( libevtx_decoded_values_file_free(
+		     &decoded_values_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoded values file.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libevtx_internal_file_get_number_of_records(
+	     internal_file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	/* The records are stored in chunk order
+	 */
+	if( libevtx_io_handle_advise_sequential_access(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise sequential access.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libevtx_internal_file_get_chunk_record_values_by_index(
+		     internal_file,
+		     record_index,
+		     &chunk,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d values.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		result = libevtx_record_values_read_system_values(
+		          record_values,
+		          internal_file->io_handle,
+		          &( chunk->system_values_template_cache ),
+		          chunk->data,
+		          chunk->data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d system values.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* Records of which the binary XML data is not supported by the System values
+		 * are not stored and are decoded when they are read
+		 */
+		else if( result != 0 )
+		{
+			if( libevtx_decoded_values_file_append_system_values(
+			     decoded_values_file,
+			     record_values->offset,
+			     &( record_values->system_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record: %d system values to decoded values file.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( record_index < number_of_records )
+	{
+		if( libevtx_decoded_values_file_free(
+		     &decoded_values_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoded values file.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	/* The decoded values are retained even if writing the decoded values file fails,
+	 * e.g. due to a read-only directory
+	 */
+	if( libevtx_decoded_values_file_write(
+	     decoded_values_file,
+	     internal_file->decoded_values_file_io_handle,
+	     internal_file->io_handle->file_header_checksum,
+	     internal_file->io_handle->modification_time,
+	     file_size,
+	     NULL ) != 1 )
+	{
+		if( decoded_values_file->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write decoded values file.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to write decoded values file.\n",
+			 function );
+		}
+#endif
+	}
+	internal_file->io_handle->decoded_values_file = decoded_values_file;
+
+	return( 1 );
+
+on_error:
+	if( decoded_values_file != NULL )
+	{
+		libevtx_decoded_values_file_free(
+		 &decoded_values_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the identifier index
+ * The identifier index maps the record identifiers to the record indexes.
+ * An existing identifier index is rebuilt if the number of records has changed
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libevtx_internal_file_build_identifier_index(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_identifier_index_t *identifier_index = NULL;
+	libevtx_record_values_t *record_values       = NULL;
+	static char *function                        = "libevtx_internal_file_build_identifier_index";
+	int number_of_records                        = 0;
+	int record_index                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_number_of_records(
+	     internal_file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->identifier_index != NULL )
+	{
+		/* Records are only added by libevtx_file_refresh
+		 */
+		if( internal_file->identifier_index->number_of_records == number_of_records )
+		{
+			return( 1 );
+		}
+		if( libevtx_identifier_index_free(
+		     &( internal_file->identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free identifier index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevtx_identifier_index_initialize(
+	     &identifier_index,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The records are stored in chunk order
+	 */
+	if( libevtx_io_handle_advise_sequential_access(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise sequential access.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libevtx_internal_file_get_chunk_record_values_by_index(
+		     internal_file,
+		     record_index,
+		     &chunk,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d values.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* A duplicate identifier retains the first record with the identifier
+		 */
+		if( libevtx_identifier_index_append_record(
+		     identifier_index,
+		     record_values->identifier,
+		     record_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d to identifier index.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	if( record_index < number_of_records )
+	{
+		if( libevtx_identifier_index_free(
+		     &identifier_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free identifier index.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	internal_file->identifier_index = identifier_index;
+
+	return( 1 );
+
+on_error:
+	if( identifier_index != NULL )
+	{
+		libevtx_identifier_index_free(
+		 &identifier_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the query index
+ * The query index maps the event identifier, provider identifier and computer
+ * name of the records to the record indexes. The values are read from the binary
+ * XML data of the records without creating an XML document.
+ * An existing query index is rebuilt if the number of records has changed
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libevtx_internal_file_build_query_index(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_query_index_t *query_index     = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_file_build_query_index";
+	uint16_t chunk_index                   = 0;
+	uint16_t chunk_record_index            = 0;
+	int last_chunk_index                   = -1;
+	int number_of_records                  = 0;
+	int record_index                       = 0;
+	int result                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_number_of_records(
+	     internal_file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->query_index != NULL )
+	{
+		/* Records are only added by libevtx_file_refresh
+		 */
+		if( internal_file->query_index->number_of_records == number_of_records )
+		{
+			return( 1 );
+		}
+		if( libevtx_query_index_free(
+		     &( internal_file->query_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free query index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevtx_query_index_initialize(
+	     &query_index,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create query index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The records are stored in chunk order
+	 */
+	if( libevtx_io_handle_advise_sequential_access(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise sequential access.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libevtx_internal_file_get_chunk_record_values_by_index(
+		     internal_file,
+		     record_index,
+		     &chunk,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d values.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( libevtx_internal_file_get_chunk_index_by_record_index(
+		     internal_file,
+		     record_index,
+		     &chunk_index,
+		     &chunk_record_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk index of record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* The summary of a chunk reads the System values of all its records
+		 * which are then reused while the chunk remains cached
+		 */
+		if( (int) chunk_index != last_chunk_index )
+		{
+			if( libevtx_file_set_chunk_summary(
+			     internal_file,
+			     chunk_index,
+			     chunk,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %" PRIu16 " summary.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			last_chunk_index = (int) chunk_index;
+		}
+		result = libevtx_record_values_read_system_values(
+		          record_values,
+		          internal_file->io_handle,
+		          &( chunk->system_values_template_cache ),
+		          chunk->data,
+		          chunk->data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d system values.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = libevtx_query_index_append_system_values(
+			          query_index,
+			          record_index,
+			          &( record_values->system_values ),
+			          error );
+		}
+		else
+		{
+			/* The binary XML data is not supported by the System values
+			 * hence the record needs to be matched on every query
+			 */
+			result = libevtx_query_index_append_unindexed_record(
+			          query_index,
+			          record_index,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d to query index.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	if( record_index < number_of_records )
+	{
+		if( libevtx_query_index_free(
+		     &query_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free query index.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libevtx_query_index_sort(
+	     query_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort query index.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->query_index = query_index;
+
+	return( 1 );
+
+on_error:
+	if( query_index != NULL )
+	{
+		libevtx_query_index_free(
+		 &query_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Marks the records that are candidates to match a record filter in a records bitmap
+ * The candidates are determined by the event identifiers, provider identifier or
+ * computer name of the record filter, in that order of precedence. Records that could
+ * not be indexed are always candidates. If the record filter does not contain any of
+ * these values every record is a candidate.
+ * The query index must be built before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_file_mark_query_records(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     uint8_t *records_bitmap,
+     size_t records_bitmap_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_internal_file_mark_query_records";
+	uint32_t key_value         = 0;
+	int event_identifier_index = 0;
+	int key                    = 0;
+	int result                 = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing query index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->number_of_event_identifiers > 0 )
+	{
+		for( event_identifier_index = 0;
+		     event_identifier_index < internal_record_filter->number_of_event_identifiers;
+		     event_identifier_index++ )
+		{
+			result = libevtx_query_index_mark_records(
+			          internal_file->query_index,
+			          LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER,
+			          internal_record_filter->event_identifiers[ event_identifier_index ],
+			          records_bitmap,
+			          records_bitmap_size,
+			          error );
+
+			if( result != 1 )
+			{
+				break;
+			}
+		}
+		key = LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER;
+	}
+	else if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 )
+	{
+		key_value = libevtx_query_index_hash_data(
+		             internal_record_filter->provider_identifier,
+		             16 );
+
+		key = LIBEVTX_QUERY_INDEX_KEY_PROVIDER_IDENTIFIER;
+	}
+	else if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_COMPUTER_NAME ) != 0 )
+	{
+		key_value = libevtx_query_index_hash_utf16_string(
+		             internal_record_filter->computer_name,
+		             internal_record_filter->computer_name_size );
+
+		key = LIBEVTX_QUERY_INDEX_KEY_COMPUTER_NAME;
+	}
+	else
+	{
+		if( records_bitmap_size > 0 )
+		{
+			if( memory_set(
+			     records_bitmap,
+			     0xff,
+			     records_bitmap_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set records bitmap.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	if( key != LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER )
+	{
+		result = libevtx_query_index_mark_records(
+		          internal_file->query_index,
+		          key,
+		          key_value,
+		          records_bitmap,
+		          records_bitmap_size,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = libevtx_query_index_mark_unindexed_records(
+		          internal_file->query_index,
+		          records_bitmap,
+		          records_bitmap_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the record values of a chunk match the expression of a record filter
+ * The EventData values are read from the binary XML data instead of the XML document
+ * if the expression only requires the XML document to test the EventData element
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libevtx_internal_file_match_chunk_record_expression(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libevtx_event_data_values_t event_data_values;
+
+	static char *function = "libevtx_internal_file_match_chunk_record_expression";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_filter_requires_xml_document(
+	       internal_record_filter ) != 0 ) )
+	{
+		if( libevtx_record_filter_requires_only_event_data(
+		     internal_record_filter ) != 0 )
+		{
+			result = libevtx_event_data_values_read_data(
+			          &event_data_values,
+			          chunk->data,
+			          chunk->data_size,
+			          record_values->chunk_data_offset,
+			          (size_t) record_values->data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read EventData values.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				record_values->event_data_values = &event_data_values;
+			}
+		}
+		/* Fall back to the XML document if the binary XML data
+		 * is not supported by the EventData values
+		 */
+		if( record_values->event_data_values == NULL )
+		{
+			if( libevtx_record_values_read_xml_document(
+			     record_values,
+			     internal_file->io_handle,
+			     chunk->data,
+			     chunk->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read XML document.",
+				 function );
+
+				return( -1 );
+			}
+			/* A record that exceeds the decode budget does not match
+			 */
+			if( record_values->is_partially_decoded != 0 )
+			{
+				return( 0 );
+			}
+		}
+	}
+	result = libevtx_record_filter_match_expression(
+	          internal_record_filter,
+	          record_values,
+	          internal_file->io_handle,
+	          error );
+
+	/* The EventData values reference the chunk data and are not retained
+	 */
+	record_values->event_data_values = NULL;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to match expression.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if the EventData values of the record values of a chunk match one of the match values of a record filter
+ * The EventData values are read from the binary XML data where possible
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libevtx_internal_file_match_chunk_record_match_values(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libevtx_event_data_values_t event_data_values;
+
+	const size_t *utf8_string_offsets = NULL;
+	const size_t *utf8_string_sizes   = NULL;
+	const uint8_t *utf8_strings       = NULL;
+	static char *function             = "libevtx_internal_file_match_chunk_record_match_values";
+	int number_of_strings             = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
 
-						goto on_error;
-					}
-				}
-/* TODO cache record values ? */
-			}
-			if( libevtx_chunk_get_number_of_recovered_records(
-			     chunk,
-			     &number_of_records,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu16 " number of recovered records.",
-				 function,
-				 chunk_index );
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-				goto on_error;
-			}
-			for( record_index = 0;
-			     record_index < number_of_records;
-			     record_index++ )
-			{
-				if( libevtx_chunk_get_recovered_record(
-				     chunk,
-				     record_index,
-				     &record_values,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		result = libevtx_event_data_values_read_data(
+		          &event_data_values,
+		          chunk->data,
+		          chunk->data_size,
+		          record_values->chunk_data_offset,
+		          (size_t) record_values->data_size,
+		          error );
 
-					goto on_error;
-				}
-				if( record_values == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read EventData values.",
+			 function );
 
-					goto on_error;
-				}
-/* TODO check for and remove duplicate identifiers ? */
-				/* The chunk index is stored in the element data size
-				 */
-				if( libfdata_list_append_element(
-				     internal_file->recovered_records_list,
-				     &element_index,
-				     0,
-				     file_offset + record_values->chunk_data_offset,
-				     (size64_t) chunk_index,
-				     0,
-				     error ) != 1 )
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			for( value_index = 0;
+			     value_index < event_data_values.number_of_values;
+			     value_index++ )
+			{
+				if( libevtx_record_filter_match_value_string(
+				     internal_record_filter,
+				     event_data_values.values[ value_index ].value,
+				     event_data_values.values[ value_index ].value_size,
+				     LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF16_STREAM ) != 0 )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append element to recovered records list.",
-					 function );
-
-					goto on_error;
+					return( 1 );
 				}
 			}
+			return( 0 );
 		}
-		file_offset += chunk->data_size;
-
-		if( libevtx_chunk_free(
-		     &chunk,
+		/* Fall back to the XML document if the binary XML data
+		 * is not supported by the EventData values
+		 */
+		if( libevtx_record_values_read_xml_document(
+		     record_values,
+		     internal_file->io_handle,
+		     chunk->data,
+		     chunk->data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free chunk: %" PRIu16 ".",
-			 function,
-			 chunk_index );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read XML document.",
+			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+		/* A record that exceeds the decode budget does not match
+		 */
+		if( record_values->is_partially_decoded != 0 )
+		{
+			return( 0 );
 		}
-		chunk_index++;
 	}
-	internal_file->io_handle->chunks_data_size = file_offset
-	                                           - internal_file->io_handle->chunks_data_offset;
+	if( libevtx_record_values_get_utf8_strings(
+	     record_values,
+	     internal_file->io_handle,
+	     &utf8_strings,
+	     &number_of_strings,
+	     &utf8_string_offsets,
+	     &utf8_string_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 strings.",
+		 function );
 
-	if( number_of_chunks != internal_file->io_handle->number_of_chunks )
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_strings;
+	     value_index++ )
 	{
-#if defined( HAVE_VERBOSE_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( utf8_string_sizes[ value_index ] <= 1 )
 		{
-			libcnotify_printf(
-			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu16 " ).\n",
-			 function,
-			 internal_file->io_handle->number_of_chunks,
-			 chunk_index );
+			continue;
+		}
+		if( libevtx_record_filter_match_value_string(
+		     internal_record_filter,
+		     &( utf8_strings[ utf8_string_offsets[ value_index ] ] ),
+		     utf8_string_sizes[ value_index ] - 1,
+		     LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8 ) != 0 )
+		{
+			return( 1 );
 		}
-#endif
-		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	return( 0 );
+}
+
+/* Determines if the record values of a chunk match a record filter
+ * The System values of the record are read from its binary XML data where possible
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libevtx_internal_file_match_chunk_record(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_internal_file_match_chunk_record";
+	int result            = 0;
+
+	if( internal_record_filter == NULL )
 	{
-		if( file_offset < (off64_t) file_size )
-		{
-			trailing_data_size = (size_t) ( file_size - file_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
 
-			trailing_data = (uint8_t *) memory_allocate(
-			                             sizeof( uint8_t ) * trailing_data_size );
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
 
-			if( trailing_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create trailing data.",
-				 function );
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-				goto on_error;
-			}
-			read_count = libbfio_handle_read_buffer(
-				      file_io_handle,
-				      trailing_data,
-				      trailing_data_size,
-				      error );
+		return( -1 );
+	}
+	/* The search strings are tested on the binary XML data
+	 * so that records without a match are not decoded
+	 */
+	result = libevtx_record_filter_match_record_data(
+	          internal_record_filter,
+	          record_values,
+	          chunk->data,
+	          chunk->data_size,
+	          error );
 
-			if( read_count != (ssize_t) trailing_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read trailing data.",
-				 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if record data matches record filter.",
+		 function );
 
-				memory_free(
-				 trailing_data );
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libevtx_record_values_read_system_values(
+	          record_values,
+	          internal_file->io_handle,
+	          &( chunk->system_values_template_cache ),
+	          chunk->data,
+	          chunk->data_size,
+	          error );
 
-				goto on_error;
-			}
-			file_offset += read_count;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record system values.",
+		 function );
 
-			libcnotify_printf(
-			 "%s: trailing data:\n",
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libevtx_record_filter_match_system_values(
+		          internal_record_filter,
+		          &( record_values->system_values ),
+		          error );
+	}
+	else
+	{
+		/* Fall back to the XML document if the binary XML data
+		 * is not supported by the System values
+		 */
+		if( libevtx_file_read_chunk_record_values_data(
+		     internal_file,
+		     chunk,
+		     record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record values data.",
 			 function );
-			libcnotify_print_data(
-			 trailing_data,
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-			memory_free(
-			 trailing_data );
 
-			trailing_data = NULL;
+			return( -1 );
 		}
+		result = libevtx_record_filter_match_record_values(
+		          internal_record_filter,
+		          record_values,
+		          error );
 	}
-#endif
-	return( 1 );
+	if( result == 1 )
+	{
+		result = libevtx_internal_file_match_chunk_record_expression(
+		          internal_file,
+		          internal_record_filter,
+		          chunk,
+		          record_values,
+		          error );
+	}
+	if( ( result == 1 )
+	 && ( internal_record_filter->number_of_match_values > 0 ) )
+	{
+		result = libevtx_internal_file_match_chunk_record_match_values(
+		          internal_file,
+		          internal_record_filter,
+		          chunk,
+		          record_values,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if record matches record filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if a specific record matches a record filter
+ * The System values of the record are read from its binary XML data where possible
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libevtx_internal_file_match_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     int record_index,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_record_values_t *record_values       = NULL;
+	static char *function                        = "libevtx_internal_file_match_record_by_index";
+	uint16_t chunk_index                         = 0;
+	uint16_t chunk_record_index                  = 0;
+	int result                                   = 0;
 
-on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( trailing_data != NULL )
+	if( libevtx_internal_file_get_chunk_index_by_record_index(
+	     internal_file,
+	     record_index,
+	     &chunk_index,
+	     &chunk_record_index,
+	     error ) != 1 )
 	{
-		memory_free(
-		 trailing_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk index of record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
 	}
-#endif
-	if( chunk != NULL )
+	/* The chunk is not read if the summary and written time range of the chunk
+	 * rule out that any of its records match
+	 */
+	result = libevtx_file_get_chunk_written_time_range(
+	          internal_file,
+	          chunk_index,
+	          &chunk_descriptor,
+	          error );
+
+	if( result == 1 )
 	{
-		libevtx_chunk_free(
-		 &chunk,
-		 NULL );
+		result = libevtx_record_filter_match_chunk_descriptor(
+		          internal_record_filter,
+		          chunk_descriptor,
+		          error );
 	}
-	if( internal_file->records_cache != NULL )
+	else if( result == 0 )
 	{
-		libfcache_cache_free(
-		 &( internal_file->records_cache ),
-		 NULL );
+		result = 1;
 	}
-	if( internal_file->records_list != NULL )
+	if( result == -1 )
 	{
-		libfdata_list_free(
-		 &( internal_file->records_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if chunk: %" PRIu16 " matches record filter.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
 	}
-	if( chunks_table != NULL )
+	else if( result == 0 )
 	{
-		libevtx_chunks_table_free(
-		 &chunks_table,
-		 NULL );
+		return( 0 );
 	}
-	if( internal_file->chunks_cache != NULL )
+	if( libevtx_internal_file_get_chunk_record_values_by_index(
+	     internal_file,
+	     record_index,
+	     &chunk,
+	     &record_values,
+	     error ) != 1 )
 	{
-		libfcache_cache_free(
-		 &( internal_file->chunks_cache ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d values.",
+		 function,
+		 record_index );
+
+		return( -1 );
 	}
-	if( internal_file->chunks_vector != NULL )
+	result = libevtx_internal_file_match_chunk_record(
+	          internal_file,
+	          internal_record_filter,
+	          chunk,
+	          record_values,
+	          error );
+
+	if( result == -1 )
 	{
-		libfdata_vector_free(
-		 &( internal_file->chunks_vector ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if record: %d matches record filter.",
+		 function,
+		 record_index );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Determine if the file corrupted
- * Returns 1 if corrupted, 0 if not or -1 on error
+/* Determines if a specific record matches a record filter
+ * Only the System values of the record are read when the record filter does not require its XML document
+ * Returns 1 if the record matches, 0 if not or -1 on error
  */
-int libevtx_file_is_corrupted(
+int libevtx_file_match_record_by_index(
      libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     int record_index,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_is_corrupted";
+	static char *function                  = "libevtx_file_match_record_by_index";
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -1569,448 +20245,986 @@ int libevtx_file_is_corrupted(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+#endif
+	result = libevtx_internal_file_match_record_by_index(
+	          internal_file,
+	          (libevtx_internal_record_filter_t *) record_filter,
+	          record_index,
+	          error );
+
+	if( result == -1 )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if record: %d matches record filter.",
+		 function,
+		 record_index );
 	}
-	return( 0 );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
-/* Retrieves the file ASCII codepage
+/* Writes a chunk that is being built to the output file
+ * The chunk builder is reset after the chunk was written
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_ascii_codepage(
-     libevtx_file_t *file,
-     int *ascii_codepage,
+int libevtx_internal_file_write_built_chunk(
+     libevtx_chunk_builder_t *chunk_builder,
+     libbfio_handle_t *output_file_io_handle,
+     uint32_t *number_of_chunks,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_ascii_codepage";
+	static char *function = "libevtx_internal_file_write_built_chunk";
+	ssize_t write_count   = 0;
 
-	if( file == NULL )
+	if( chunk_builder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid chunk builder.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
 
-	if( internal_file->io_handle == NULL )
+		return( -1 );
+	}
+	if( chunk_builder->number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	if( libevtx_chunk_builder_finalize(
+	     chunk_builder,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize chunk.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	write_count = libbfio_handle_write_buffer(
+	               output_file_io_handle,
+	               chunk_builder->data,
+	               chunk_builder->data_size,
+	               error );
+
+	if( write_count != (ssize_t) chunk_builder->data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write chunk: %" PRIu32 ".",
+		 function,
+		 *number_of_chunks );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_builder_reset(
+	     chunk_builder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset chunk builder.",
 		 function );
 
 		return( -1 );
 	}
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+	*number_of_chunks += 1;
 
 	return( 1 );
 }
 
-/* Sets the file ASCII codepage
+/* Writes the records that match a record filter to a new file
+ * Chunks of which all records match are copied as-is, the matching records of
+ * other chunks are copied into new chunks
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_set_ascii_codepage(
-     libevtx_file_t *file,
-     int ascii_codepage,
+int libevtx_internal_file_write_filtered(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libbfio_handle_t *output_file_io_handle,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_set_ascii_codepage";
+	libevtx_chunk_builder_t *chunk_builder       = NULL;
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_record_values_t *first_record_values = NULL;
+	libevtx_record_values_t *record_values       = NULL;
+	evtx_file_header_t *file_header              = NULL;
+	uint8_t *file_header_data                    = NULL;
+	uint8_t *records_match                       = NULL;
+	static char *function                        = "libevtx_internal_file_write_filtered";
+	size_t file_header_data_size                 = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	uint32_t calculated_checksum                 = 0;
+	uint32_t file_flags                          = 0;
+	uint32_t number_of_chunks                    = 0;
+	uint16_t chunk_record_index                  = 0;
+	uint16_t number_of_matching_records          = 0;
+	int number_of_records                        = 0;
+	int output_file_io_handle_is_open            = 0;
+	int record_index                             = 0;
+	int result                                   = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->chunks_data_offset < (off64_t) sizeof( evtx_file_header_t ) )
+	 || ( internal_file->io_handle->chunks_data_offset > (off64_t) internal_file->io_handle->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - chunks data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_internal_file_get_number_of_records(
+	     internal_file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file header block of the file is copied and updated
+	 * after the chunks have been written
+	 */
+	file_header_data_size = (size_t) internal_file->io_handle->chunks_data_offset;
+
+	file_header_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * file_header_data_size );
+
+	if( file_header_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     internal_file->file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file header offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              internal_file->file_io_handle,
+	              file_header_data,
+	              file_header_data_size,
+	              error );
+
+	if( read_count != (ssize_t) file_header_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The match result of every record of a chunk is determined before the chunk is written
+	 */
+	records_match = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * ( (size_t) UINT16_MAX + 1 ) );
+
+	if( records_match == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records match.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( libevtx_chunk_builder_initialize(
+	     &chunk_builder,
+	     (size_t) internal_file->io_handle->chunk_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk builder.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( ascii_codepage != LIBEVTX_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1258 ) )
+	if( libbfio_handle_open(
+	     output_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
-
-	return( 1 );
-}
+	output_file_io_handle_is_open = 1;
 
-/* Retrieves the format version
- * Returns 1 if successful or -1 on error
- */
-int libevtx_file_get_format_version(
-     libevtx_file_t *file,
-     uint16_t *major_version,
-     uint16_t *minor_version,
-     libcerror_error_t **error )
-{
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_format_version";
+	write_count = libbfio_handle_write_buffer(
+	               output_file_io_handle,
+	               file_header_data,
+	               file_header_data_size,
+	               error );
 
-	if( file == NULL )
+	if( write_count != (ssize_t) file_header_data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libevtx_internal_file_t *) file;
+	while( record_index < number_of_records )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libevtx_internal_file_get_chunk_record_values_by_index(
+		     internal_file,
+		     record_index,
+		     &chunk,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d values.",
+			 function,
+			 record_index );
 
-	if( internal_file->io_handle == NULL )
+			goto on_error;
+		}
+		if( libevtx_chunk_get_record(
+		     chunk,
+		     0,
+		     &first_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first record of chunk.",
+			 function );
+
+			goto on_error;
+		}
+		/* The records of a chunk are stored consecutively in the records of the file
+		 */
+		if( first_record_values != record_values )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported record: %d not the first record of its chunk.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		number_of_matching_records = 0;
+
+		for( chunk_record_index = 0;
+		     chunk_record_index < chunk->number_of_records;
+		     chunk_record_index++ )
+		{
+			if( libevtx_chunk_get_record(
+			     chunk,
+			     chunk_record_index,
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %" PRIu16 " of chunk.",
+				 function,
+				 chunk_record_index );
+
+				goto on_error;
+			}
+			result = libevtx_internal_file_match_chunk_record(
+			          internal_file,
+			          internal_record_filter,
+			          chunk,
+			          record_values,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if record: %d matches record filter.",
+				 function,
+				 record_index + chunk_record_index );
+
+				goto on_error;
+			}
+			records_match[ chunk_record_index ] = (uint8_t) result;
+
+			if( result != 0 )
+			{
+				number_of_matching_records++;
+			}
+		}
+		if( number_of_matching_records == chunk->number_of_records )
+		{
+			/* The chunk being built contains preceding records and is written first
+			 */
+			if( libevtx_internal_file_write_built_chunk(
+			     chunk_builder,
+			     output_file_io_handle,
+			     &number_of_chunks,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write chunk.",
+				 function );
+
+				goto on_error;
+			}
+			if( chunk->data_size != (size_t) internal_file->io_handle->chunk_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid chunk data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			write_count = libbfio_handle_write_buffer(
+			               output_file_io_handle,
+			               chunk->data,
+			               chunk->data_size,
+			               error );
+
+			if( write_count != (ssize_t) chunk->data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write chunk: %" PRIu32 ".",
+				 function,
+				 number_of_chunks );
+
+				goto on_error;
+			}
+			number_of_chunks++;
+		}
+		else if( number_of_matching_records > 0 )
+		{
+			if( libevtx_chunk_builder_clear_copied_offsets(
+			     chunk_builder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to clear copied offsets of chunk builder.",
+				 function );
+
+				goto on_error;
+			}
+			for( chunk_record_index = 0;
+			     chunk_record_index < chunk->number_of_records;
+			     chunk_record_index++ )
+			{
+				if( records_match[ chunk_record_index ] == 0 )
+				{
+					continue;
+				}
+				if( libevtx_chunk_get_record(
+				     chunk,
+				     chunk_record_index,
+				     &record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve record: %" PRIu16 " of chunk.",
+					 function,
+					 chunk_record_index );
+
+					goto on_error;
+				}
+				result = libevtx_chunk_builder_append_record(
+				          chunk_builder,
+				          chunk->data,
+				          chunk->data_size,
+				          record_values->chunk_data_offset,
+				          (size_t) record_values->data_size,
+				          error );
+
+				if( ( result == 0 )
+				 && ( chunk_builder->number_of_records > 0 ) )
+				{
+					/* The record does not fit and is appended to a new chunk
+					 */
+					if( libevtx_internal_file_write_built_chunk(
+					     chunk_builder,
+					     output_file_io_handle,
+					     &number_of_chunks,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write chunk.",
+						 function );
+
+						goto on_error;
+					}
+					result = libevtx_chunk_builder_append_record(
+					          chunk_builder,
+					          chunk->data,
+					          chunk->data_size,
+					          record_values->chunk_data_offset,
+					          (size_t) record_values->data_size,
+					          error );
+				}
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record: %d to chunk.",
+					 function,
+					 record_index + chunk_record_index );
+
+					goto on_error;
+				}
+			}
+		}
+		record_index += chunk->number_of_records;
+	}
+	if( libevtx_internal_file_write_built_chunk(
+	     chunk_builder,
+	     output_file_io_handle,
+	     &number_of_chunks,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write chunk.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( major_version == NULL )
+	if( number_of_chunks > (uint32_t) UINT16_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( minor_version == NULL )
+	/* The chunks of the new file are numbered from 0 and the file is written consistently
+	 */
+	file_header = (evtx_file_header_t *) file_header_data;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->first_chunk_number,
+	 (uint64_t) 0 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->last_chunk_number,
+	 (uint64_t) ( ( number_of_chunks > 0 ) ? number_of_chunks - 1 : 0 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 file_header->number_of_chunks,
+	 (uint16_t) number_of_chunks );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->file_flags,
+	 file_flags );
+
+	file_flags &= ~( LIBEVTX_FILE_FLAG_IS_DIRTY );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->file_flags,
+	 file_flags );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     file_header_data,
+	     120,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate file header CRC-32 checksum.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*major_version = internal_file->io_handle->major_version;
-	*minor_version = internal_file->io_handle->minor_version;
-
-	return( 1 );
-}
-
-/* Retrieves the file version
- * Returns 1 if successful or -1 on error
- */
-int libevtx_file_get_version(
-     libevtx_file_t *file,
-     uint16_t *major_version,
-     uint16_t *minor_version,
-     libcerror_error_t **error )
-{
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_version";
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->checksum,
+	 calculated_checksum );
 
-	if( file == NULL )
+	if( libbfio_handle_seek_offset(
+	     output_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file header offset: 0 in output file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libevtx_internal_file_t *) file;
+	write_count = libbfio_handle_write_buffer(
+	               output_file_io_handle,
+	               file_header_data,
+	               sizeof( evtx_file_header_t ),
+	               error );
 
-	if( internal_file->io_handle == NULL )
+	if( write_count != (ssize_t) sizeof( evtx_file_header_t ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( major_version == NULL )
+	output_file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     output_file_io_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( minor_version == NULL )
+	if( libevtx_chunk_builder_free(
+	     &chunk_builder,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk builder.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*major_version = internal_file->io_handle->major_version;
-	*minor_version = internal_file->io_handle->minor_version;
+	memory_free(
+	 records_match );
+
+	memory_free(
+	 file_header_data );
 
 	return( 1 );
+
+on_error:
+	if( output_file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 output_file_io_handle,
+		 NULL );
+	}
+	if( chunk_builder != NULL )
+	{
+		libevtx_chunk_builder_free(
+		 &chunk_builder,
+		 NULL );
+	}
+	if( records_match != NULL )
+	{
+		memory_free(
+		 records_match );
+	}
+	if( file_header_data != NULL )
+	{
+		memory_free(
+		 file_header_data );
+	}
+	return( -1 );
 }
 
-/* Retrieves the flags
+/* Writes the records that match a record filter to a new file
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_flags(
+int libevtx_file_write_filtered(
      libevtx_file_t *file,
-     uint32_t *flags,
+     libevtx_record_filter_t *record_filter,
+     const char *filename,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_flags";
+	libbfio_handle_t *output_file_io_handle = NULL;
+	static char *function                   = "libevtx_file_write_filtered";
+	size_t filename_length                  = 0;
 
-	if( file == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( libbfio_file_initialize(
+	     &output_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( flags == NULL )
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     output_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in output file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*flags = internal_file->io_handle->file_flags;
-
-	return( 1 );
-}
-
-/* Retrieves the number of records
- * Returns 1 if successful or -1 on error
- */
-int libevtx_file_get_number_of_records(
-     libevtx_file_t *file,
-     int *number_of_records,
-     libcerror_error_t **error )
-{
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_number_of_records";
-
-	if( file == NULL )
+	if( libevtx_file_write_filtered_file_io_handle(
+	     file,
+	     record_filter,
+	     output_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %s.",
+		 function,
+		 filename );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->records_list,
-	     number_of_records,
+	if( libbfio_handle_free(
+	     &output_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	if( output_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &output_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific record
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the records that match a record filter to a new file
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_record(
+int libevtx_file_write_filtered_wide(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     libevtx_record_filter_t *record_filter,
+     const wchar_t *filename,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	static char *function                  = "libevtx_file_get_record";
+	libbfio_handle_t *output_file_io_handle = NULL;
+	static char *function                   = "libevtx_file_write_filtered_wide";
+	size_t filename_length                  = 0;
 
-	if( file == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( record == NULL )
+	if( libbfio_file_initialize(
+	     &output_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     output_file_io_handle,
+	     filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in output file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_write_filtered_file_io_handle(
+	     file,
+	     record_filter,
+	     output_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %ls.",
 		 function,
-		 record_index );
+		 filename );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libevtx_record_initialize(
-	     record,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     record_values,
-	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+	if( libbfio_handle_free(
+	     &output_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	if( output_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &output_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific record
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the records that match a record filter to a new file using a Basic File IO (bfio) handle
+ * The file IO handle is opened for writing and closed when the file has been written
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_record_by_index(
+int libevtx_file_write_filtered_file_io_handle(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     libevtx_record_filter_t *record_filter,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	static char *function                  = "libevtx_file_get_record_by_index";
+	static char *function                  = "libevtx_file_write_filtered_file_io_handle";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -2025,109 +21239,132 @@ int libevtx_file_get_record_by_index(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( record == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+#endif
+	if( libevtx_internal_file_write_filtered(
+	     internal_file,
+	     (libevtx_internal_record_filter_t *) record_filter,
+	     file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
-		 function,
-		 record_index );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write filtered file.",
+		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libevtx_record_initialize(
-	     record,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     record_values,
-	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the number of recovered records
+/* Retrieves the content hash of a specific record
+ * The content hash is calculated from the chunk data without creating the record
+ * or decoding its binary XML
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_number_of_recovered_records(
-     libevtx_file_t *file,
-     int *number_of_records,
+int libevtx_internal_file_get_record_content_hash_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     uint64_t *content_hash,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_number_of_recovered_records";
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_internal_file_get_record_content_hash_by_index";
+
+	if( libevtx_internal_file_get_chunk_record_values_by_index(
+	     internal_file,
+	     record_index,
+	     &chunk,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d values.",
+		 function,
+		 record_index );
 
-	if( file == NULL )
+		return( -1 );
+	}
+	if( ( record_values->chunk_data_offset >= chunk->data_size )
+	 || ( (size_t) record_values->data_size > ( chunk->data_size - record_values->chunk_data_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record: %d values - data size value out of bounds.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->recovered_records_list,
-	     number_of_records,
+	if( libevtx_checksum_calculate_xxhash64(
+	     content_hash,
+	     &( chunk->data[ record_values->chunk_data_offset ] ),
+	     (size_t) record_values->data_size,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate record: %d content hash.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves a specific recovered record
+/* Retrieves the content hash of a specific record
+ * The content hash is the same as that of libevtx_record_get_content_hash
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_recovered_record(
+int libevtx_file_get_record_content_hash_by_index(
      libevtx_file_t *file,
      int record_index,
-     libevtx_record_t **record,
+     uint64_t *content_hash,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	static char *function                  = "libevtx_file_get_recovered_record";
+	static char *function                  = "libevtx_file_get_record_content_hash_by_index";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -2142,68 +21379,93 @@ int libevtx_file_get_recovered_record(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( record == NULL )
+	if( content_hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid content hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     internal_file->records_cache,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevtx_internal_file_get_record_content_hash_by_index(
+	     internal_file,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     content_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
+		 "%s: unable to retrieve record: %d content hash.",
 		 function,
 		 record_index );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libevtx_record_initialize(
-	     record,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     record_values,
-	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Retrieves a specific recovered record
- * Returns 1 if successful or -1 on error
+/* Queries the records that match a record filter
+ * On the first query a query index of the event identifiers, provider identifiers
+ * and computer names of the records is built, subsequent queries only match the
+ * records that are indexed with one of the values of the record filter.
+ * The recovered records are not queried
+ * The callback behaves the same as for libevtx_file_iterate_records
+ * Returns 1 if successful, 0 if the query was stopped by the callback or -1 on error
  */
-int libevtx_file_get_recovered_record_by_index(
+int libevtx_file_query(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     libevtx_record_filter_t *record_filter,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	static char *function                  = "libevtx_file_get_recovered_record_by_index";
+	libevtx_record_t *record               = NULL;
+	uint8_t *records_bitmap                = NULL;
+	static char *function                  = "libevtx_file_query";
+	size_t records_bitmap_size             = 0;
+	int callback_result                    = 1;
+	int number_of_records                  = 0;
+	int record_index                       = 0;
+	int result                             = 1;
+	int use_chunk_summaries                = 0;
 
 	if( file == NULL )
 	{
@@ -2218,53 +21480,306 @@ int libevtx_file_get_recovered_record_by_index(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( record == NULL )
+	if( record_filter == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid record filter.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_internal_file_grab_for_write(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
-		 function,
-		 record_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	if( libevtx_record_initialize(
-	     record,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     record_values,
-	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+#endif
+	/* If the chunk summaries were read from the index file the records are matched
+	 * per chunk instead of building the query index, which reads every record
+	 */
+	if( internal_file->query_index == NULL )
+	{
+		use_chunk_summaries = libevtx_internal_file_has_chunk_summaries(
+		                       internal_file,
+		                       error );
+	}
+	if( use_chunk_summaries == 1 )
+	{
+		result = libevtx_internal_file_get_number_of_records(
+		          internal_file,
+		          &number_of_records,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			result = -1;
+		}
+	}
+	else if( use_chunk_summaries == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if chunks have summaries.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libevtx_internal_file_build_query_index(
+		          internal_file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to build query index.",
+			 function );
+		}
+		else if( result != 0 )
+		{
+			number_of_records = internal_file->query_index->number_of_records;
+		}
+	}
+	if( result == 1 )
+	{
+		records_bitmap_size = (size_t) ( ( number_of_records + 7 ) / 8 );
+
+		if( records_bitmap_size > 0 )
+		{
+			records_bitmap = (uint8_t *) memory_allocate(
+			                              sizeof( uint8_t ) * records_bitmap_size );
+
+			if( records_bitmap == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create records bitmap.",
+				 function );
+
+				result = -1;
+			}
+			else if( memory_set(
+			          records_bitmap,
+			          ( use_chunk_summaries == 1 ) ? 0xff : 0,
+			          sizeof( uint8_t ) * records_bitmap_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear records bitmap.",
+				 function );
+
+				result = -1;
+			}
+			else if( ( use_chunk_summaries == 0 )
+			      && ( libevtx_internal_file_mark_query_records(
+			          internal_file,
+			          (libevtx_internal_record_filter_t *) record_filter,
+			          records_bitmap,
+			          records_bitmap_size,
+			          error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine query records.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( ( records_bitmap[ record_index / 8 ] & (uint8_t) ( 1 << ( record_index % 8 ) ) ) == 0 )
+		{
+			continue;
+		}
+		if( internal_file->io_handle->abort != 0 )
+		{
+			break;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libevtx_internal_file_grab_for_write(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libevtx_internal_file_match_record_by_index(
+		          internal_file,
+		          (libevtx_internal_record_filter_t *) record_filter,
+		          record_index,
+		          error );
+
+		if( result == 1 )
+		{
+			if( libevtx_internal_file_get_record_by_index(
+			     internal_file,
+			     record_index,
+			     &record,
+			     error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve matching record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		callback_result = callback(
+		                   record,
+		                   user_data );
+
+		if( libevtx_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( callback_result == 0 )
+		{
+			break;
+		}
+	}
+	if( records_bitmap != NULL )
+	{
+		memory_free(
+		 records_bitmap );
+	}
+	if( callback_result == 0 )
+	{
+		return( 0 );
 	}
 	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( records_bitmap != NULL )
+	{
+		memory_free(
+		 records_bitmap );
+	}
+	return( -1 );
 }
 
@@ -25,12 +25,29 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_async_request.h"
+#include "libevtx_cache.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_builder.h"
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_chunk_information.h"
+#include "libevtx_chunks_table.h"
+#include "libevtx_document_cache.h"
 #include "libevtx_extern.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
+#include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_identifier_gaps.h"
+#include "libevtx_identifier_index.h"
+#include "libevtx_indexed_chunks.h"
+#include "libevtx_query_index.h"
+#include "libevtx_record_filter.h"
+#include "libevtx_record_values.h"
+#include "libevtx_recovered_records_filter.h"
 
 #if defined( _MSC_VER ) || defined( __BORLANDC__ ) || defined( __MINGW32_VERSION ) || defined( __MINGW64_VERSION_MAJOR )
 
@@ -64,6 +81,11 @@ struct libevtx_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* Value to indicate the mapped data was provided by the caller
+	 * and is not unmapped when the file is closed
+	 */
+	uint8_t mapped_data_is_external;
+
 	/* The chunks vector
 	 */
 	libfdata_vector_t *chunks_vector;
@@ -72,6 +94,11 @@ struct libevtx_internal_file
 	 */
 	libfcache_cache_t *chunks_cache;
 
+	/* The chunks table
+	 * The chunks table is managed by the records list
+	 */
+	libevtx_chunks_table_t *chunks_table;
+
 	/* The records list
 	 */
 	libfdata_list_t *records_list;
@@ -83,6 +110,237 @@ struct libevtx_internal_file
 	/* The records cache
 	 */
 	libfcache_cache_t *records_cache;
+
+	/* The chunk descriptors array
+	 * Used when the file is opened with the lazy access flag
+	 */
+	libcdata_array_t *chunk_descriptors_array;
+
+	/* The chunk written time ranges array
+	 * Contains a chunk descriptor per chunk index once the written time range
+	 * of the chunk has been determined, otherwise the entry is NULL
+	 */
+	libcdata_array_t *chunk_written_time_ranges_array;
+
+	/* The indexes of the chunks of which the free space has not been scanned
+	 * Used when the file is opened with the deferred recovery access flag
+	 */
+	uint16_t *pending_recovery_chunk_indexes;
+
+	/* The number of pending recovery chunk indexes
+	 */
+	int number_of_pending_recovery_chunks;
+
+	/* Value to indicate the recovered records have not been scanned yet
+	 */
+	uint8_t recovery_is_pending;
+
+	/* The record identifier gaps
+	 * Contains NULL if the records were not read when the file was opened
+	 */
+	libevtx_identifier_gaps_t *identifier_gaps;
+
+	/* The filter of the recovered records that duplicate allocated records
+	 * Used when the file is opened with the deduplicate recovered access flag
+	 */
+	libevtx_recovered_records_filter_t *recovered_records_filter;
+
+	/* Value to indicate the hashes of all the allocated records were inserted
+	 * into the recovered records filter
+	 */
+	uint8_t allocated_records_are_hashed;
+
+	/* The number of recovered records that duplicate allocated records
+	 */
+	int number_of_duplicate_recovered_records;
+
+	/* The number of records indicated by the chunk descriptors
+	 */
+	int number_of_indexed_records;
+
+	/* The number of records estimated from the file and chunk headers
+	 * Used when the file is opened with the header only access flag
+	 */
+	int estimated_number_of_records;
+
+	/* Value to indicate the file was opened as a partition of its chunks
+	 */
+	uint8_t is_partition;
+
+	/* The index of the first chunk of the partition
+	 */
+	uint16_t partition_first_chunk_index;
+
+	/* The number of chunks of the partition
+	 */
+	uint16_t partition_number_of_chunks;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The maximum number of cached chunks
+	 */
+	int maximum_number_of_cached_chunks;
+
+	/* The maximum number of cached records
+	 */
+	int maximum_number_of_cached_records;
+
+	/* The maximum size of the cached chunks data
+	 * A value of 0 represents no size limit
+	 */
+	size64_t maximum_cache_size;
+
+	/* The maximum size of the record values retained in the document cache
+	 * A value of 0 represents the document cache is not used
+	 */
+	size64_t maximum_document_cache_size;
+
+	/* The document cache
+	 * Contains NULL if the document cache is not used
+	 */
+	libevtx_document_cache_t *document_cache;
+
+	/* The shared chunk cache
+	 * Contains NULL if the chunks are cached by the file
+	 */
+	libevtx_internal_cache_t *cache;
+
+	/* The identifier of the file in the shared chunk cache
+	 * Contains -1 if the file is not attached to the shared chunk cache
+	 */
+	int cache_file_identifier;
+
+	/* The number of records cache entries
+	 */
+	int number_of_records_cache_entries;
+
+	/* The number of threads used to read the chunks when opening the file
+	 */
+	int number_of_threads;
+
+	/* The number of chunks read ahead during sequential reads
+	 */
+	int read_ahead_depth;
+
+	/* The number of records decoded ahead in the background
+	 */
+	int background_decode_depth;
+
+	/* The size of the coalesced reads of sequential chunks
+	 */
+	size_t coalesced_read_size;
+
+	/* Value to indicate the number of threads, read-ahead depth and
+	 * coalesced read size are tuned when opening the file
+	 */
+	uint8_t auto_tuning;
+
+	/* The measured time of a single chunk read in nano seconds
+	 * Contains 0 if not measured
+	 */
+	uint64_t chunk_read_time;
+
+	/* The measured time per chunk read and parsed by a single thread in nano seconds
+	 * Contains 0 if not measured
+	 */
+	uint64_t chunk_decode_time;
+
+	/* The number of asynchronous chunk reads in flight
+	 */
+	int async_read_queue_depth;
+
+	/* The open progress callback
+	 * Contains NULL if the progress is not reported
+	 */
+	int (*progress_callback)(
+	       size64_t processed_size,
+	       size64_t total_size,
+	       void *user_data );
+
+	/* The open progress callback user data
+	 */
+	void *progress_callback_user_data;
+
+	/* The number of chunks between calls of the open progress callback
+	 */
+	int progress_granularity;
+
+	/* The index file IO handle
+	 * Contains NULL if no index file is used
+	 */
+	libbfio_handle_t *index_file_io_handle;
+
+	/* The index data
+	 * Contains NULL if no index data is used
+	 */
+	uint8_t *index_data;
+
+	/* The index data size
+	 */
+	size_t index_data_size;
+
+	/* The decoded values file IO handle
+	 * Contains NULL if no decoded values file is used
+	 */
+	libbfio_handle_t *decoded_values_file_io_handle;
+
+	/* The borrowed record
+	 * Reused by every call to libevtx_file_get_borrowed_record_by_index
+	 */
+	libevtx_record_t *borrowed_record;
+
+	/* The query index
+	 * Built by the first call to libevtx_file_query
+	 */
+	libevtx_query_index_t *query_index;
+
+	/* The identifier index
+	 * Built by libevtx_file_get_record_by_identifier if the record is not found by identifier range
+	 */
+	libevtx_identifier_index_t *identifier_index;
+
+	/* The identifier of the last record added to the records list
+	 * Used to determine the records to add when the file is refreshed
+	 */
+	uint64_t last_indexed_record_identifier;
+
+	/* The asynchronous request executor
+	 * Contains NULL if every asynchronous request runs on its own thread
+	 */
+	int (*async_executor)(
+	       void (*function)(
+	              void *arguments ),
+	       void *arguments,
+	       void *user_data );
+
+	/* The asynchronous request executor user data
+	 */
+	void *async_executor_user_data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The asynchronous requests array
+	 * Contains the submitted requests until libevtx_file_wait_async is called
+	 */
+	libcdata_array_t *async_requests_array;
+
+	/* The number of asynchronous requests that have not completed
+	 */
+	int number_of_pending_async_requests;
+
+	/* The asynchronous requests mutex
+	 */
+	libcthreads_mutex_t *async_mutex;
+
+	/* The asynchronous requests condition
+	 */
+	libcthreads_condition_t *async_condition;
+#endif
 };
 
 LIBEVTX_EXTERN \
@@ -100,6 +358,18 @@ int libevtx_file_signal_abort(
      libevtx_file_t *file,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libevtx_internal_file_grab_for_read(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_grab_for_write(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 LIBEVTX_EXTERN \
 int libevtx_file_open(
      libevtx_file_t *file,
@@ -118,6 +388,78 @@ int libevtx_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBEVTX_EXTERN \
+int libevtx_file_set_async_executor(
+     libevtx_file_t *file,
+     int (*executor)(
+            void (*function)(
+                   void *arguments ),
+            void *arguments,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_async_worker_function(
+     void *arguments );
+
+void libevtx_internal_file_async_executor_function(
+      void *arguments );
+
+int libevtx_internal_file_submit_async_request(
+     libevtx_internal_file_t *internal_file,
+     libevtx_async_request_t *async_request,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_open_async(
+     libevtx_file_t *file,
+     const char *filename,
+     int access_flags,
+     void (*callback)(
+             libevtx_file_t *file,
+             int result,
+             libcerror_error_t *error,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_file_open_async_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     int access_flags,
+     void (*callback)(
+             libevtx_file_t *file,
+             int result,
+             libcerror_error_t *error,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_records_async(
+     libevtx_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     int (*callback)(
+            libevtx_file_t *file,
+            libevtx_record_t **records,
+            int number_of_records,
+            int is_last_batch,
+            libcerror_error_t *error,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_wait_async(
+     libevtx_file_t *file,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_open_file_io_handle(
      libevtx_file_t *file,
@@ -125,91 +467,1042 @@ int libevtx_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_file_open_partition(
+     libevtx_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     uint16_t first_chunk_index,
+     uint16_t number_of_chunks,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_open_memory(
+     libevtx_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_map(
+     libevtx_internal_file_t *internal_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_unmap(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_close(
      libevtx_file_t *file,
      libcerror_error_t **error );
 
+int libevtx_internal_file_get_number_of_processors(
+     int *number_of_processors,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_tune_read_parameters(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error );
+
 int libevtx_file_open_read(
      libevtx_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libevtx_file_read_chunk_descriptors(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     off64_t *file_offset,
+     uint16_t *number_of_chunks,
+     libcerror_error_t **error );
+
+int libevtx_file_read_estimated_number_of_records(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_file_get_chunk_descriptor_by_record_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error );
+
+int libevtx_file_get_chunk_descriptor_by_record_identifier(
+     libevtx_internal_file_t *internal_file,
+     uint64_t identifier,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error );
+
+int libevtx_file_get_indexed_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_file_read_chunk_record_values_data(
+     libevtx_internal_file_t *internal_file,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_file_read_chunk_record_values(
+     libevtx_internal_file_t *internal_file,
+     libevtx_chunk_t *chunk,
+     uint16_t chunk_record_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_file_get_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_file_get_record_identifier_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     uint64_t *identifier,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_is_corrupted(
      libevtx_file_t *file,
      libcerror_error_t **error );
 
+int libevtx_internal_file_is_corrupted(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
-int libevtx_file_get_ascii_codepage(
+int libevtx_file_is_chunk_corrupted(
      libevtx_file_t *file,
-     int *ascii_codepage,
+     uint16_t chunk_index,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_set_ascii_codepage(
+int libevtx_file_get_number_of_chunks(
      libevtx_file_t *file,
-     int ascii_codepage,
+     uint16_t *number_of_chunks,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_format_version(
+int libevtx_file_get_chunk_information(
      libevtx_file_t *file,
-     uint16_t *major_version,
-     uint16_t *minor_version,
+     uint16_t chunk_index,
+     libevtx_chunk_information_t **chunk_information,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_version(
+int libevtx_file_get_chunk_data(
      libevtx_file_t *file,
-     uint16_t *major_version,
-     uint16_t *minor_version,
+     uint16_t chunk_index,
+     const uint8_t **chunk_data,
+     size_t *chunk_data_size,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_flags(
+int libevtx_file_decode_chunk_system_fields(
      libevtx_file_t *file,
-     uint32_t *flags,
+     uint16_t chunk_index,
+     uint32_t fields_mask,
+     libevtx_system_fields_t *system_fields,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_number_of_records(
+int libevtx_file_get_chunk_records_range(
      libevtx_file_t *file,
+     uint16_t chunk_index,
+     int *first_record_index,
      int *number_of_records,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_record(
+int libevtx_file_prefetch_records(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     int first_record_index,
+     int number_of_records,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_prefetch_records(
+     libevtx_internal_file_t *internal_file,
+     int first_record_index,
+     int number_of_records,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_record_by_index(
+int libevtx_file_pin_chunk(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     uint16_t chunk_index,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_number_of_recovered_records(
+int libevtx_file_unpin_chunk(
      libevtx_file_t *file,
-     int *number_of_records,
+     uint16_t chunk_index,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_chunk_by_index(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_validate_chunk(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_recovered_record(
+int libevtx_file_verify(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     uint8_t verify_flags,
+     int (*callback)(
+            int chunk_index,
+            off64_t file_offset,
+            uint32_t verify_result_flags,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_verify(
+     libevtx_internal_file_t *internal_file,
+     uint8_t verify_flags,
+     int (*callback)(
+            int chunk_index,
+            off64_t file_offset,
+            uint32_t verify_result_flags,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error );
 
 LIBEVTX_EXTERN \
-int libevtx_file_get_recovered_record_by_index(
+int libevtx_file_get_ascii_codepage(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     int *ascii_codepage,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_ascii_codepage(
+     libevtx_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_validation_mode(
+     libevtx_file_t *file,
+     int *validation_mode,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_validation_mode(
+     libevtx_file_t *file,
+     int validation_mode,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_decode_depth(
+     libevtx_file_t *file,
+     int *decode_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_decode_depth(
+     libevtx_file_t *file,
+     int decode_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_decode_budget(
+     libevtx_file_t *file,
+     int *maximum_depth,
+     int *maximum_number_of_nodes,
+     size_t *maximum_decoded_size,
+     uint64_t *maximum_decode_time,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_decode_budget(
+     libevtx_file_t *file,
+     int maximum_depth,
+     int maximum_number_of_nodes,
+     size_t maximum_decoded_size,
+     uint64_t maximum_decode_time,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_iterate_order(
+     libevtx_file_t *file,
+     int *iterate_order,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_iterate_order(
+     libevtx_file_t *file,
+     int iterate_order,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_chunk_buffer_pool_size(
+     libevtx_file_t *file,
+     int *maximum_number_of_buffers,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_chunk_buffer_pool_size(
+     libevtx_file_t *file,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_chunk_buffer_pool_large_pages(
+     libevtx_file_t *file,
+     uint8_t *use_large_pages,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_chunk_buffer_pool_large_pages(
+     libevtx_file_t *file,
+     uint8_t use_large_pages,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_cache_limits(
+     libevtx_file_t *file,
+     int *maximum_number_of_cached_chunks,
+     int *maximum_number_of_cached_records,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_cache_limits(
+     libevtx_file_t *file,
+     int maximum_number_of_cached_chunks,
+     int maximum_number_of_cached_records,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_maximum_document_cache_size(
+     libevtx_file_t *file,
+     size64_t *maximum_document_cache_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_maximum_document_cache_size(
+     libevtx_file_t *file,
+     size64_t maximum_document_cache_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_cache(
+     libevtx_file_t *file,
+     libevtx_cache_t *cache,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_threads(
+     libevtx_file_t *file,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_number_of_threads(
+     libevtx_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_read_ahead_depth(
+     libevtx_file_t *file,
+     int *read_ahead_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_read_ahead_depth(
+     libevtx_file_t *file,
+     int read_ahead_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_background_decode_depth(
+     libevtx_file_t *file,
+     int *background_decode_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_background_decode_depth(
+     libevtx_file_t *file,
+     int background_decode_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_progress_callback(
+     libevtx_file_t *file,
+     int (*callback)(
+            size64_t processed_size,
+            size64_t total_size,
+            void *user_data ),
+     void *user_data,
+     int granularity,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_report_open_progress(
+     libevtx_internal_file_t *internal_file,
+     uint16_t number_of_chunks_read,
+     off64_t file_offset,
+     size64_t file_size,
+     uint8_t is_last,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_coalesced_read_size(
+     libevtx_file_t *file,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_coalesced_read_size(
+     libevtx_file_t *file,
+     size_t read_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_auto_tuning(
+     libevtx_file_t *file,
+     uint8_t *auto_tuning,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_auto_tuning(
+     libevtx_file_t *file,
+     uint8_t auto_tuning,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_tuning_measurements(
+     libevtx_file_t *file,
+     uint64_t *chunk_read_time,
+     uint64_t *chunk_decode_time,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_async_read_queue_depth(
+     libevtx_file_t *file,
+     int *queue_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_async_read_queue_depth(
+     libevtx_file_t *file,
+     int queue_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_string_interning(
+     libevtx_file_t *file,
+     uint8_t *string_interning,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_string_interning(
+     libevtx_file_t *file,
+     uint8_t string_interning,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_interned_strings(
+     libevtx_file_t *file,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_utf8_interned_string_size(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_utf8_interned_string(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_utf16_interned_string_size(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_utf16_interned_string(
+     libevtx_file_t *file,
+     uint32_t string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_decode_profiling(
+     libevtx_file_t *file,
+     uint8_t *decode_profiling,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_decode_profiling(
+     libevtx_file_t *file,
+     uint8_t decode_profiling,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_decode_profile_entries(
+     libevtx_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_decode_profile_entry(
+     libevtx_file_t *file,
+     int entry_index,
+     uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t *event_identifier,
+     uint8_t *template_identifier,
+     size_t template_identifier_size,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_decode_profile_chunks(
+     libevtx_file_t *file,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_decode_profile_chunk_values(
+     libevtx_file_t *file,
+     int chunk_index,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_index_filename(
+     libevtx_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_index_filename_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_decoded_values_filename(
+     libevtx_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_decoded_values_filename_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_index_data(
+     libevtx_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_index_data_size(
+     libevtx_file_t *file,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_index_data(
+     libevtx_file_t *file,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_format_version(
+     libevtx_file_t *file,
+     uint16_t *major_version,
+     uint16_t *minor_version,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_version(
+     libevtx_file_t *file,
+     uint16_t *major_version,
+     uint16_t *minor_version,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_flags(
+     libevtx_file_t *file,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_statistics(
+     libevtx_file_t *file,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_reset_statistics(
+     libevtx_file_t *file,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_memory_usage(
+     libevtx_file_t *file,
+     uint64_t *memory_usage,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_memory_usage_values(
+     libevtx_file_t *file,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_advise_sequential_access(
+     libevtx_file_t *file,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_number_of_records(
+     libevtx_internal_file_t *internal_file,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_estimated_number_of_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_partition(
+     libevtx_file_t *file,
+     uint16_t *first_chunk_index,
+     uint16_t *number_of_chunks,
+     uint16_t *total_number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_identifier_gaps(
+     libevtx_file_t *file,
+     int *number_of_gaps,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_identifier_gap(
+     libevtx_file_t *file,
+     int gap_index,
+     uint8_t *gap_type,
+     uint64_t *first_identifier,
+     uint64_t *last_identifier,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_create_record(
+     libevtx_internal_file_t *internal_file,
+     libevtx_record_values_t *record_values,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_record(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_record(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_record_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_records_by_range(
+     libevtx_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     libevtx_record_t **records,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_records_by_range(
+     libevtx_internal_file_t *internal_file,
+     int first_record_index,
+     int number_of_records,
+     libevtx_record_t **records,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_chunk_index_by_record_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     uint16_t *chunk_index,
+     uint16_t *chunk_record_index,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_chunk_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_chunk_t **chunk,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_borrowed_record_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_borrowed_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_release_borrowed_record(
+     libevtx_file_t *file,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_seek_record_by_identifier(
+     libevtx_file_t *file,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_seek_record_by_identifier(
+     libevtx_internal_file_t *internal_file,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_record_by_identifier(
+     libevtx_file_t *file,
+     uint64_t identifier,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_record_index_by_identifier(
+     libevtx_internal_file_t *internal_file,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_append_recovered_record(
+     libevtx_internal_file_t *internal_file,
+     libevtx_chunk_t *chunk,
+     off64_t chunk_file_offset,
+     size_t record_chunk_data_offset,
+     size_t record_data_size,
+     uint64_t identifier,
+     uint64_t written_time,
+     size64_t element_data_size,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_append_indexed_chunk(
+     libevtx_internal_file_t *internal_file,
+     libevtx_indexed_chunks_t *indexed_chunks,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_filter_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_read_deferred_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_recovered_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_number_of_duplicate_recovered_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_number_of_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_recovered_record(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_recovered_record(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_recovered_record_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_recovered_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_refresh(
+     libevtx_file_t *file,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_refresh(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libevtx_file_get_chunk_written_time_range(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error );
+
+int libevtx_file_set_chunk_written_time_range(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_file_set_chunk_summary(
+     libevtx_internal_file_t *internal_file,
+     uint16_t chunk_index,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_has_chunk_summaries(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_iterate_records(
+     libevtx_file_t *file,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_iterate_records_in_time_range(
+     libevtx_file_t *file,
+     uint64_t first_written_time,
+     uint64_t last_written_time,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_iterate_records_with_filter(
+     libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_oldest_chunk_index(
+     libevtx_internal_file_t *internal_file,
+     int number_of_chunks,
+     uint16_t *chunk_index,
+     libcerror_error_t **error );
+
+int libevtx_file_iterate_records_with_internal_filter(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     uint64_t first_written_time,
+     uint64_t last_written_time,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_read_decoded_values_file(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_build_identifier_index(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_build_query_index(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_mark_query_records(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     uint8_t *records_bitmap,
+     size_t records_bitmap_size,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_match_chunk_record_expression(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_match_chunk_record_match_values(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_match_chunk_record(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_match_record_by_index(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     int record_index,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_match_record_by_index(
+     libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     int record_index,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_write_built_chunk(
+     libevtx_chunk_builder_t *chunk_builder,
+     libbfio_handle_t *output_file_io_handle,
+     uint32_t *number_of_chunks,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_write_filtered(
+     libevtx_internal_file_t *internal_file,
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libbfio_handle_t *output_file_io_handle,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_write_filtered(
+     libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_file_write_filtered_wide(
+     libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVTX_EXTERN \
+int libevtx_file_write_filtered_file_io_handle(
+     libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevtx_internal_file_get_record_content_hash_by_index(
+     libevtx_internal_file_t *internal_file,
+     int record_index,
+     uint64_t *content_hash,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_record_content_hash_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     uint64_t *content_hash,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_query(
+     libevtx_file_t *file,
+     libevtx_record_filter_t *record_filter,
+     int (*callback)(
+            libevtx_record_t *record,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,4016 @@
+/*
+ * Filter expression functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "libevtx_definitions.h"
+#include "libevtx_event_data_values.h"
+#include "libevtx_filter_expression.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfguid.h"
+#include "libevtx_libuna.h"
+#include "libevtx_record_filter.h"
+#include "libevtx_record_values.h"
+#include "libevtx_system_values.h"
+
+/* The number of days between January 1, 1601 and January 1, 1970
+ */
+#define LIBEVTX_FILTER_FILETIME_DAYS_TO_POSIX_EPOCH	134774
+
+/* Creates a filter expression
+ * Make sure the value expression is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_expression_initialize(
+     libevtx_filter_expression_t **expression,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_expression_initialize";
+
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( *expression != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid expression value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*expression = memory_allocate_structure(
+	               libevtx_filter_expression_t );
+
+	if( *expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create expression.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *expression,
+	     0,
+	     sizeof( libevtx_filter_expression_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear expression.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *expression != NULL )
+	{
+		memory_free(
+		 *expression );
+
+		*expression = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a filter expression
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_expression_free(
+     libevtx_filter_expression_t **expression,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *instruction = NULL;
+	static char *function                     = "libevtx_filter_expression_free";
+	int instruction_index                     = 0;
+
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( *expression != NULL )
+	{
+		if( ( *expression )->instructions != NULL )
+		{
+			for( instruction_index = 0;
+			     instruction_index < ( *expression )->number_of_instructions;
+			     instruction_index++ )
+			{
+				instruction = &( ( ( *expression )->instructions )[ instruction_index ] );
+
+				if( instruction->utf16_string != NULL )
+				{
+					memory_free(
+					 instruction->utf16_string );
+				}
+				if( instruction->utf8_name != NULL )
+				{
+					memory_free(
+					 instruction->utf8_name );
+				}
+				if( instruction->utf8_string != NULL )
+				{
+					memory_free(
+					 instruction->utf8_string );
+				}
+			}
+			memory_free(
+			 ( *expression )->instructions );
+		}
+		memory_free(
+		 *expression );
+
+		*expression = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an instruction to the filter expression
+ * The instruction is cleared except for its opcode and remains owned by the expression
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_expression_append_instruction(
+     libevtx_filter_expression_t *expression,
+     uint8_t opcode,
+     libevtx_filter_instruction_t **instruction,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *reallocation = NULL;
+	static char *function                      = "libevtx_filter_expression_append_instruction";
+	int number_of_allocated_instructions       = 0;
+	int stack_depth                            = 0;
+
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction.",
+		 function );
+
+		return( -1 );
+	}
+	stack_depth = expression->stack_depth;
+
+	if( opcode == LIBEVTX_FILTER_OPCODE_TEST )
+	{
+		stack_depth += 1;
+	}
+	else if( ( opcode == LIBEVTX_FILTER_OPCODE_AND )
+	      || ( opcode == LIBEVTX_FILTER_OPCODE_OR ) )
+	{
+		stack_depth -= 1;
+	}
+	else if( opcode != LIBEVTX_FILTER_OPCODE_NOT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported opcode: %" PRIu8 ".",
+		 function,
+		 opcode );
+
+		return( -1 );
+	}
+	if( stack_depth > LIBEVTX_FILTER_EXPRESSION_MAXIMUM_STACK_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid expression - stack depth value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( expression->number_of_instructions >= expression->number_of_allocated_instructions )
+	{
+		if( expression->number_of_allocated_instructions == 0 )
+		{
+			number_of_allocated_instructions = 8;
+		}
+		else
+		{
+			if( expression->number_of_allocated_instructions > ( ( INT_MAX / 2 ) / (int) sizeof( libevtx_filter_instruction_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid expression - number of instructions value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_instructions = expression->number_of_allocated_instructions * 2;
+		}
+		reallocation = (libevtx_filter_instruction_t *) memory_reallocate(
+		                                                 expression->instructions,
+		                                                 sizeof( libevtx_filter_instruction_t ) * number_of_allocated_instructions );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize instructions.",
+			 function );
+
+			return( -1 );
+		}
+		expression->instructions                     = reallocation;
+		expression->number_of_allocated_instructions = number_of_allocated_instructions;
+	}
+	*instruction = &( ( expression->instructions )[ expression->number_of_instructions ] );
+
+	if( memory_set(
+	     *instruction,
+	     0,
+	     sizeof( libevtx_filter_instruction_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear instruction.",
+		 function );
+
+		*instruction = NULL;
+
+		return( -1 );
+	}
+	( *instruction )->opcode = opcode;
+
+	expression->number_of_instructions += 1;
+	expression->stack_depth             = stack_depth;
+
+	return( 1 );
+}
+
+/* Compiles an UTF-8 encoded XPath subset expression into the filter expression
+ * The supported subset is that of the Windows event log query filters, such as:
+ * *[System[(EventID=4624 or EventID=4625) and TimeCreated[timediff(@SystemTime) <= 86400000]]]
+ * The current time is used to resolve timediff() and should contain a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_expression_compile(
+     libevtx_filter_expression_t *expression,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t current_time,
+     libcerror_error_t **error )
+{
+	libevtx_filter_parser_t parser;
+
+	static char *function = "libevtx_filter_expression_compile";
+
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( expression->number_of_instructions != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid expression - instructions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore trailing end of string characters
+	 */
+	while( ( utf8_string_length > 0 )
+	    && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length--;
+	}
+	parser.string        = utf8_string;
+	parser.string_length = utf8_string_length;
+	parser.string_offset = 0;
+	parser.depth         = 0;
+	parser.current_time  = current_time;
+
+	/* The event selector is optional
+	 */
+	if( ( libevtx_filter_parser_match_token(
+	       &parser,
+	       "*",
+	       1 ) != 0 )
+	 || ( libevtx_filter_parser_match_name(
+	       &parser,
+	       "Event",
+	       5 ) != 0 ) )
+	{
+		if( libevtx_filter_parser_parse_predicate(
+		     &parser,
+		     expression,
+		     LIBEVTX_FILTER_CONTEXT_EVENT,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse Event predicate.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libevtx_filter_parser_parse_or_expression(
+	          &parser,
+	          expression,
+	          LIBEVTX_FILTER_CONTEXT_EVENT,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse expression.",
+		 function );
+
+		goto on_error;
+	}
+	libevtx_filter_parser_skip_whitespace(
+	 &parser );
+
+	if( parser.string_offset < parser.string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - unsupported trailing data at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) parser.string_offset );
+
+		goto on_error;
+	}
+	if( expression->stack_depth != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid expression - stack depth value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* Leave the expression empty so it can be compiled again
+	 */
+	while( expression->number_of_instructions > 0 )
+	{
+		expression->number_of_instructions -= 1;
+
+		if( expression->instructions[ expression->number_of_instructions ].utf16_string != NULL )
+		{
+			memory_free(
+			 expression->instructions[ expression->number_of_instructions ].utf16_string );
+		}
+		if( expression->instructions[ expression->number_of_instructions ].utf8_name != NULL )
+		{
+			memory_free(
+			 expression->instructions[ expression->number_of_instructions ].utf8_name );
+		}
+		if( expression->instructions[ expression->number_of_instructions ].utf8_string != NULL )
+		{
+			memory_free(
+			 expression->instructions[ expression->number_of_instructions ].utf8_string );
+		}
+	}
+	expression->stack_depth = 0;
+	expression->flags       = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the current time
+ * The current time contains a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_expression_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	FILETIME filetime;
+#else
+	time_t posix_time     = 0;
+#endif
+	static char *function = "libevtx_filter_expression_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	GetSystemTimeAsFileTime(
+	 &filetime );
+
+	*current_time = ( (uint64_t) filetime.dwHighDateTime << 32 ) | filetime.dwLowDateTime;
+#else
+	posix_time = time(
+	              NULL );
+
+	if( posix_time == (time_t) -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) posix_time + ( (uint64_t) LIBEVTX_FILTER_FILETIME_DAYS_TO_POSIX_EPOCH * 86400 ) ) * 10000000UL;
+#endif
+	return( 1 );
+}
+
+/* Skips whitespace characters
+ */
+void libevtx_filter_parser_skip_whitespace(
+      libevtx_filter_parser_t *parser )
+{
+	uint8_t character = 0;
+
+	if( parser == NULL )
+	{
+		return;
+	}
+	while( parser->string_offset < parser->string_length )
+	{
+		character = parser->string[ parser->string_offset ];
+
+		if( ( character != (uint8_t) ' ' )
+		 && ( character != (uint8_t) '\t' )
+		 && ( character != (uint8_t) '\n' )
+		 && ( character != (uint8_t) '\r' ) )
+		{
+			break;
+		}
+		parser->string_offset += 1;
+	}
+}
+
+/* Matches a token after any whitespace
+ * The token is consumed if it matches
+ * Returns 1 if the token matches or 0 if not
+ */
+int libevtx_filter_parser_match_token(
+     libevtx_filter_parser_t *parser,
+     const char *token,
+     size_t token_length )
+{
+	if( ( parser == NULL )
+	 || ( token == NULL ) )
+	{
+		return( 0 );
+	}
+	libevtx_filter_parser_skip_whitespace(
+	 parser );
+
+	if( token_length > ( parser->string_length - parser->string_offset ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     &( parser->string[ parser->string_offset ] ),
+	     token,
+	     token_length ) != 0 )
+	{
+		return( 0 );
+	}
+	parser->string_offset += token_length;
+
+	return( 1 );
+}
+
+/* Matches a name after any whitespace
+ * Unlike a token a name only matches if it is not directly followed by a name character
+ * The name is consumed if it matches
+ * Returns 1 if the name matches or 0 if not
+ */
+int libevtx_filter_parser_match_name(
+     libevtx_filter_parser_t *parser,
+     const char *name,
+     size_t name_length )
+{
+	size_t string_offset = 0;
+	uint8_t character    = 0;
+
+	if( parser == NULL )
+	{
+		return( 0 );
+	}
+	string_offset = parser->string_offset;
+
+	if( libevtx_filter_parser_match_token(
+	     parser,
+	     name,
+	     name_length ) == 0 )
+	{
+		return( 0 );
+	}
+	if( parser->string_offset < parser->string_length )
+	{
+		character = parser->string[ parser->string_offset ];
+
+		if( ( ( character >= (uint8_t) 'A' )
+		  &&  ( character <= (uint8_t) 'Z' ) )
+		 || ( ( character >= (uint8_t) 'a' )
+		  &&  ( character <= (uint8_t) 'z' ) )
+		 || ( ( character >= (uint8_t) '0' )
+		  &&  ( character <= (uint8_t) '9' ) )
+		 || ( character == (uint8_t) '_' ) )
+		{
+			parser->string_offset = string_offset;
+
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Matches a token that is required after any whitespace
+ * Returns 1 if the token matches or -1 on error
+ */
+int libevtx_filter_parser_expect_token(
+     libevtx_filter_parser_t *parser,
+     const char *token,
+     size_t token_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_parser_expect_token";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_filter_parser_match_token(
+	     parser,
+	     token,
+	     token_length ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - missing: %s at offset: %" PRIzd ".",
+		 function,
+		 token,
+		 (ssize_t) parser->string_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a comparison operator
+ * The XML escaped forms of < and > are supported as well
+ * Returns 1 if successful or 0 if no comparison operator was found
+ */
+int libevtx_filter_parser_parse_comparison(
+     libevtx_filter_parser_t *parser,
+     uint8_t *comparison )
+{
+	if( ( parser == NULL )
+	 || ( comparison == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_filter_parser_match_token(
+	     parser,
+	     "!=",
+	     2 ) != 0 )
+	{
+		*comparison = LIBEVTX_FILTER_COMPARISON_NOT_EQUAL;
+	}
+	else if( ( libevtx_filter_parser_match_token(
+	            parser,
+	            "<=",
+	            2 ) != 0 )
+	      || ( libevtx_filter_parser_match_token(
+	            parser,
+	            "&lt;=",
+	            5 ) != 0 ) )
+	{
+		*comparison = LIBEVTX_FILTER_COMPARISON_LESS_EQUAL;
+	}
+	else if( ( libevtx_filter_parser_match_token(
+	            parser,
+	            ">=",
+	            2 ) != 0 )
+	      || ( libevtx_filter_parser_match_token(
+	            parser,
+	            "&gt;=",
+	            5 ) != 0 ) )
+	{
+		*comparison = LIBEVTX_FILTER_COMPARISON_GREATER_EQUAL;
+	}
+	else if( ( libevtx_filter_parser_match_token(
+	            parser,
+	            "<",
+	            1 ) != 0 )
+	      || ( libevtx_filter_parser_match_token(
+	            parser,
+	            "&lt;",
+	            4 ) != 0 ) )
+	{
+		*comparison = LIBEVTX_FILTER_COMPARISON_LESS;
+	}
+	else if( ( libevtx_filter_parser_match_token(
+	            parser,
+	            ">",
+	            1 ) != 0 )
+	      || ( libevtx_filter_parser_match_token(
+	            parser,
+	            "&gt;",
+	            4 ) != 0 ) )
+	{
+		*comparison = LIBEVTX_FILTER_COMPARISON_GREATER;
+	}
+	else if( libevtx_filter_parser_match_token(
+	          parser,
+	          "=",
+	          1 ) != 0 )
+	{
+		*comparison = LIBEVTX_FILTER_COMPARISON_EQUAL;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Parses a decimal or hexadecimal (0x prefixed) integer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_integer(
+     libevtx_filter_parser_t *parser,
+     uint64_t *integer_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_parser_parse_integer";
+	size_t string_offset  = 0;
+	uint64_t base         = 10;
+	uint64_t digit        = 0;
+	uint64_t value        = 0;
+	uint8_t character     = 0;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( integer_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libevtx_filter_parser_match_token(
+	       parser,
+	       "0x",
+	       2 ) != 0 )
+	 || ( libevtx_filter_parser_match_token(
+	       parser,
+	       "0X",
+	       2 ) != 0 ) )
+	{
+		base = 16;
+	}
+	string_offset = parser->string_offset;
+
+	while( parser->string_offset < parser->string_length )
+	{
+		character = parser->string[ parser->string_offset ];
+
+		if( ( character >= (uint8_t) '0' )
+		 && ( character <= (uint8_t) '9' ) )
+		{
+			digit = character - (uint8_t) '0';
+		}
+		else if( ( base == 16 )
+		      && ( character >= (uint8_t) 'a' )
+		      && ( character <= (uint8_t) 'f' ) )
+		{
+			digit = character - (uint8_t) 'a' + 10;
+		}
+		else if( ( base == 16 )
+		      && ( character >= (uint8_t) 'A' )
+		      && ( character <= (uint8_t) 'F' ) )
+		{
+			digit = character - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			break;
+		}
+		if( value > ( ( (uint64_t) UINT64_MAX - digit ) / base ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid expression - integer value at offset: %" PRIzd " exceeds maximum.",
+			 function,
+			 (ssize_t) string_offset );
+
+			return( -1 );
+		}
+		value = ( value * base ) + digit;
+
+		parser->string_offset += 1;
+	}
+	if( parser->string_offset == string_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - missing integer at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) string_offset );
+
+		return( -1 );
+	}
+	*integer_value = value;
+
+	return( 1 );
+}
+
+/* Parses a single or double quoted string literal
+ * The string references the expression and does not include the quotes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_string(
+     libevtx_filter_parser_t *parser,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_parser_parse_string";
+	size_t string_offset  = 0;
+	uint8_t quote         = 0;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	libevtx_filter_parser_skip_whitespace(
+	 parser );
+
+	if( parser->string_offset < parser->string_length )
+	{
+		quote = parser->string[ parser->string_offset ];
+	}
+	if( ( quote != (uint8_t) '\'' )
+	 && ( quote != (uint8_t) '"' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - missing string at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) parser->string_offset );
+
+		return( -1 );
+	}
+	string_offset = parser->string_offset + 1;
+
+	for( parser->string_offset = string_offset;
+	     parser->string_offset < parser->string_length;
+	     parser->string_offset++ )
+	{
+		if( parser->string[ parser->string_offset ] == quote )
+		{
+			break;
+		}
+	}
+	if( parser->string_offset >= parser->string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - unterminated string at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) ( string_offset - 1 ) );
+
+		return( -1 );
+	}
+	*utf8_string        = &( parser->string[ string_offset ] );
+	*utf8_string_length = parser->string_offset - string_offset;
+
+	parser->string_offset += 1;
+
+	return( 1 );
+}
+
+/* Parses an ISO 8601 UTC date and time string formatted as:
+ * YYYY-MM-DDThh:mm:ss[.fffffff][Z]
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_date_time(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static const char *format = "dddd-dd-ddTdd:dd:dd";
+
+	static char *function     = "libevtx_filter_parser_parse_date_time";
+	size_t string_index       = 0;
+	uint64_t fraction         = 0;
+	uint64_t fraction_digits  = 0;
+	int64_t days              = 0;
+	uint32_t values[ 6 ]      = { 0, 0, 0, 0, 0, 0 };
+	uint32_t day_of_year      = 0;
+	uint32_t year_of_era      = 0;
+	uint8_t character         = 0;
+	int value_index           = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length < 19 )
+	{
+		goto on_unsupported;
+	}
+	for( string_index = 0;
+	     string_index < 19;
+	     string_index++ )
+	{
+		character = utf8_string[ string_index ];
+
+		if( format[ string_index ] == 'd' )
+		{
+			if( ( character < (uint8_t) '0' )
+			 || ( character > (uint8_t) '9' ) )
+			{
+				goto on_unsupported;
+			}
+			values[ value_index ] = ( values[ value_index ] * 10 ) + ( character - (uint8_t) '0' );
+		}
+		else if( character != (uint8_t) format[ string_index ] )
+		{
+			goto on_unsupported;
+		}
+		else
+		{
+			value_index++;
+		}
+	}
+	if( ( string_index < utf8_string_length )
+	 && ( utf8_string[ string_index ] == (uint8_t) '.' ) )
+	{
+		for( string_index += 1;
+		     string_index < utf8_string_length;
+		     string_index++ )
+		{
+			character = utf8_string[ string_index ];
+
+			if( ( character < (uint8_t) '0' )
+			 || ( character > (uint8_t) '9' ) )
+			{
+				break;
+			}
+			/* The FILETIME has a precision of 100 nano seconds
+			 */
+			if( fraction_digits < 7 )
+			{
+				fraction = ( fraction * 10 ) + ( character - (uint8_t) '0' );
+
+				fraction_digits++;
+			}
+		}
+		while( fraction_digits < 7 )
+		{
+			fraction *= 10;
+
+			fraction_digits++;
+		}
+	}
+	if( ( string_index < utf8_string_length )
+	 && ( utf8_string[ string_index ] == (uint8_t) 'Z' ) )
+	{
+		string_index++;
+	}
+	if( string_index != utf8_string_length )
+	{
+		goto on_unsupported;
+	}
+	if( ( values[ 0 ] < 1601 )
+	 || ( values[ 0 ] > 9999 )
+	 || ( values[ 1 ] < 1 )
+	 || ( values[ 1 ] > 12 )
+	 || ( values[ 2 ] < 1 )
+	 || ( values[ 2 ] > 31 )
+	 || ( values[ 3 ] > 23 )
+	 || ( values[ 4 ] > 59 )
+	 || ( values[ 5 ] > 59 ) )
+	{
+		goto on_unsupported;
+	}
+	/* Determine the number of days since January 1, 1970
+	 * where the year is considered to start in March
+	 */
+	if( values[ 1 ] <= 2 )
+	{
+		values[ 0 ] -= 1;
+	}
+	year_of_era = values[ 0 ] % 400;
+
+	if( values[ 1 ] > 2 )
+	{
+		day_of_year = ( ( 153 * ( values[ 1 ] - 3 ) ) + 2 ) / 5;
+	}
+	else
+	{
+		day_of_year = ( ( 153 * ( values[ 1 ] + 9 ) ) + 2 ) / 5;
+	}
+	day_of_year += values[ 2 ] - 1;
+
+	days = ( (int64_t) ( values[ 0 ] / 400 ) * 146097 )
+	     + ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 )
+	     + day_of_year - 719468;
+
+	days += LIBEVTX_FILTER_FILETIME_DAYS_TO_POSIX_EPOCH;
+
+	*filetime = ( ( (uint64_t) days * 86400 )
+	          + ( (uint64_t) values[ 3 ] * 3600 )
+	          + ( (uint64_t) values[ 4 ] * 60 )
+	          + values[ 5 ] ) * 10000000UL;
+
+	*filetime += fraction;
+
+	return( 1 );
+
+on_unsupported:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported date and time string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Parses an or-expression: and-expression [ or and-expression ]*
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_or_expression(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *instruction = NULL;
+	static char *function                     = "libevtx_filter_parser_parse_or_expression";
+
+	if( libevtx_filter_parser_parse_and_expression(
+	     parser,
+	     expression,
+	     context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse and-expression.",
+		 function );
+
+		return( -1 );
+	}
+	while( libevtx_filter_parser_match_name(
+	        parser,
+	        "or",
+	        2 ) != 0 )
+	{
+		if( libevtx_filter_parser_parse_and_expression(
+		     parser,
+		     expression,
+		     context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse and-expression.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_filter_expression_append_instruction(
+		     expression,
+		     LIBEVTX_FILTER_OPCODE_OR,
+		     &instruction,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append or instruction.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Parses an and-expression: unary-expression [ and unary-expression ]*
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_and_expression(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *instruction = NULL;
+	static char *function                     = "libevtx_filter_parser_parse_and_expression";
+
+	if( libevtx_filter_parser_parse_unary_expression(
+	     parser,
+	     expression,
+	     context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse unary expression.",
+		 function );
+
+		return( -1 );
+	}
+	while( libevtx_filter_parser_match_name(
+	        parser,
+	        "and",
+	        3 ) != 0 )
+	{
+		if( libevtx_filter_parser_parse_unary_expression(
+		     parser,
+		     expression,
+		     context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse unary expression.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_filter_expression_append_instruction(
+		     expression,
+		     LIBEVTX_FILTER_OPCODE_AND,
+		     &instruction,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append and instruction.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Parses an unary expression: not( or-expression ) | ( or-expression ) | test
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_unary_expression(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *instruction = NULL;
+	static char *function                     = "libevtx_filter_parser_parse_unary_expression";
+	int result                                = 1;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( parser->depth >= LIBEVTX_FILTER_EXPRESSION_MAXIMUM_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid expression - nesting depth value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	parser->depth += 1;
+
+	if( libevtx_filter_parser_match_name(
+	     parser,
+	     "not",
+	     3 ) != 0 )
+	{
+		if( ( libevtx_filter_parser_expect_token(
+		       parser,
+		       "(",
+		       1,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_parse_or_expression(
+		       parser,
+		       expression,
+		       context,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_expect_token(
+		       parser,
+		       ")",
+		       1,
+		       error ) != 1 ) )
+		{
+			result = -1;
+		}
+		else if( libevtx_filter_expression_append_instruction(
+		          expression,
+		          LIBEVTX_FILTER_OPCODE_NOT,
+		          &instruction,
+		          error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	else if( libevtx_filter_parser_match_token(
+	          parser,
+	          "(",
+	          1 ) != 0 )
+	{
+		if( ( libevtx_filter_parser_parse_or_expression(
+		       parser,
+		       expression,
+		       context,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_expect_token(
+		       parser,
+		       ")",
+		       1,
+		       error ) != 1 ) )
+		{
+			result = -1;
+		}
+	}
+	else if( libevtx_filter_parser_parse_test(
+	          parser,
+	          expression,
+	          context,
+	          error ) != 1 )
+	{
+		result = -1;
+	}
+	parser->depth -= 1;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse unary expression.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a predicate: [ or-expression ]
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_predicate(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_parser_parse_predicate";
+
+	if( ( libevtx_filter_parser_expect_token(
+	       parser,
+	       "[",
+	       1,
+	       error ) != 1 )
+	 || ( libevtx_filter_parser_parse_or_expression(
+	       parser,
+	       expression,
+	       context,
+	       error ) != 1 )
+	 || ( libevtx_filter_parser_expect_token(
+	       parser,
+	       "]",
+	       1,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse predicate.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a test in a specific context
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_parser_parse_test";
+	int result            = -1;
+
+	switch( context )
+	{
+		case LIBEVTX_FILTER_CONTEXT_EVENT:
+			if( libevtx_filter_parser_match_name(
+			     parser,
+			     "System",
+			     6 ) != 0 )
+			{
+				result = libevtx_filter_parser_parse_predicate(
+				          parser,
+				          expression,
+				          LIBEVTX_FILTER_CONTEXT_SYSTEM,
+				          error );
+			}
+			else if( libevtx_filter_parser_match_name(
+			          parser,
+			          "EventData",
+			          9 ) != 0 )
+			{
+				result = libevtx_filter_parser_parse_predicate(
+				          parser,
+				          expression,
+				          LIBEVTX_FILTER_CONTEXT_EVENT_DATA,
+				          error );
+			}
+			/* System element tests are also supported directly in the Event context
+			 */
+			else
+			{
+				result = libevtx_filter_parser_parse_system_test(
+				          parser,
+				          expression,
+				          error );
+			}
+			break;
+
+		case LIBEVTX_FILTER_CONTEXT_SYSTEM:
+			result = libevtx_filter_parser_parse_system_test(
+			          parser,
+			          expression,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_CONTEXT_PROVIDER:
+		case LIBEVTX_FILTER_CONTEXT_TIME_CREATED:
+		case LIBEVTX_FILTER_CONTEXT_SECURITY:
+			result = libevtx_filter_parser_parse_attribute_test(
+			          parser,
+			          expression,
+			          context,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_CONTEXT_EVENT_DATA:
+			result = libevtx_filter_parser_parse_event_data_test(
+			          parser,
+			          expression,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported context: %d.",
+			 function,
+			 context );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse test.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a System element test
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_system_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *instruction = NULL;
+	const uint8_t *utf8_string                = NULL;
+	static char *function                     = "libevtx_filter_parser_parse_system_test";
+	size_t utf8_string_length                 = 0;
+	uint64_t integer_value                    = 0;
+	uint8_t comparison                        = 0;
+	uint8_t value_type                        = 0;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_filter_parser_match_name(
+	     parser,
+	     "Provider",
+	     8 ) != 0 )
+	{
+		return( libevtx_filter_parser_parse_predicate(
+		         parser,
+		         expression,
+		         LIBEVTX_FILTER_CONTEXT_PROVIDER,
+		         error ) );
+	}
+	else if( libevtx_filter_parser_match_name(
+	          parser,
+	          "TimeCreated",
+	          11 ) != 0 )
+	{
+		return( libevtx_filter_parser_parse_predicate(
+		         parser,
+		         expression,
+		         LIBEVTX_FILTER_CONTEXT_TIME_CREATED,
+		         error ) );
+	}
+	else if( libevtx_filter_parser_match_name(
+	          parser,
+	          "Security",
+	          8 ) != 0 )
+	{
+		return( libevtx_filter_parser_parse_predicate(
+		         parser,
+		         expression,
+		         LIBEVTX_FILTER_CONTEXT_SECURITY,
+		         error ) );
+	}
+	else if( libevtx_filter_parser_match_name(
+	          parser,
+	          "band",
+	          4 ) != 0 )
+	{
+		if( ( libevtx_filter_parser_expect_token(
+		       parser,
+		       "(",
+		       1,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_expect_token(
+		       parser,
+		       "Keywords",
+		       8,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_expect_token(
+		       parser,
+		       ",",
+		       1,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_parse_integer(
+		       parser,
+		       &integer_value,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_expect_token(
+		       parser,
+		       ")",
+		       1,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse band function.",
+			 function );
+
+			return( -1 );
+		}
+		value_type = LIBEVTX_FILTER_VALUE_TYPE_KEYWORDS;
+		comparison = LIBEVTX_FILTER_COMPARISON_BITWISE_AND;
+	}
+	else
+	{
+		if( libevtx_filter_parser_match_name(
+		     parser,
+		     "EventID",
+		     7 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_EVENT_IDENTIFIER;
+		}
+		else if( libevtx_filter_parser_match_name(
+		          parser,
+		          "Level",
+		          5 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_EVENT_LEVEL;
+		}
+		else if( libevtx_filter_parser_match_name(
+		          parser,
+		          "EventRecordID",
+		          13 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_EVENT_RECORD_IDENTIFIER;
+		}
+		else if( libevtx_filter_parser_match_name(
+		          parser,
+		          "Keywords",
+		          8 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_KEYWORDS;
+		}
+		else if( libevtx_filter_parser_match_name(
+		          parser,
+		          "Channel",
+		          7 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_CHANNEL_NAME;
+		}
+		else if( libevtx_filter_parser_match_name(
+		          parser,
+		          "Computer",
+		          8 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_COMPUTER_NAME;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unsupported System element at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) parser->string_offset );
+
+			return( -1 );
+		}
+		if( libevtx_filter_parser_parse_comparison(
+		     parser,
+		     &comparison ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - missing comparison at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) parser->string_offset );
+
+			return( -1 );
+		}
+		if( ( value_type == LIBEVTX_FILTER_VALUE_TYPE_CHANNEL_NAME )
+		 || ( value_type == LIBEVTX_FILTER_VALUE_TYPE_COMPUTER_NAME ) )
+		{
+			if( ( comparison != LIBEVTX_FILTER_COMPARISON_EQUAL )
+			 && ( comparison != LIBEVTX_FILTER_COMPARISON_NOT_EQUAL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid expression - unsupported string comparison at offset: %" PRIzd ".",
+				 function,
+				 (ssize_t) parser->string_offset );
+
+				return( -1 );
+			}
+			if( libevtx_filter_parser_parse_string(
+			     parser,
+			     &utf8_string,
+			     &utf8_string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to parse string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( libevtx_filter_parser_parse_integer(
+		          parser,
+		          &integer_value,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse integer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_filter_expression_append_instruction(
+	     expression,
+	     LIBEVTX_FILTER_OPCODE_TEST,
+	     &instruction,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append test instruction.",
+		 function );
+
+		return( -1 );
+	}
+	instruction->value_type    = value_type;
+	instruction->comparison    = comparison;
+	instruction->integer_value = integer_value;
+
+	if( utf8_string != NULL )
+	{
+		if( libevtx_filter_instruction_set_utf16_string(
+		     instruction,
+		     utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set instruction string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( value_type == LIBEVTX_FILTER_VALUE_TYPE_KEYWORDS )
+	{
+		expression->flags |= LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_XML_DOCUMENT;
+	}
+	return( 1 );
+}
+
+/* Parses a Provider, TimeCreated or Security element attribute test
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_attribute_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *instruction = NULL;
+	libfguid_identifier_t *guid               = NULL;
+	const uint8_t *utf8_string                = NULL;
+	static char *function                     = "libevtx_filter_parser_parse_attribute_test";
+	size_t utf8_string_length                 = 0;
+	uint64_t integer_value                    = 0;
+	uint8_t comparison                        = LIBEVTX_FILTER_COMPARISON_EXISTS;
+	uint8_t is_time_difference                = 0;
+	uint8_t value_type                        = 0;
+	int result                                = 0;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == LIBEVTX_FILTER_CONTEXT_PROVIDER )
+	{
+		if( libevtx_filter_parser_match_name(
+		     parser,
+		     "@Name",
+		     5 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_NAME;
+		}
+		else if( libevtx_filter_parser_match_name(
+		          parser,
+		          "@Guid",
+		          5 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_IDENTIFIER;
+		}
+	}
+	else if( context == LIBEVTX_FILTER_CONTEXT_TIME_CREATED )
+	{
+		if( libevtx_filter_parser_match_name(
+		     parser,
+		     "@SystemTime",
+		     11 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_WRITTEN_TIME;
+		}
+		else if( libevtx_filter_parser_match_name(
+		          parser,
+		          "timediff",
+		          8 ) != 0 )
+		{
+			if( ( libevtx_filter_parser_expect_token(
+			       parser,
+			       "(",
+			       1,
+			       error ) != 1 )
+			 || ( libevtx_filter_parser_expect_token(
+			       parser,
+			       "@SystemTime",
+			       11,
+			       error ) != 1 )
+			 || ( libevtx_filter_parser_expect_token(
+			       parser,
+			       ")",
+			       1,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to parse timediff function.",
+				 function );
+
+				return( -1 );
+			}
+			value_type         = LIBEVTX_FILTER_VALUE_TYPE_WRITTEN_TIME;
+			is_time_difference = 1;
+		}
+	}
+	else if( context == LIBEVTX_FILTER_CONTEXT_SECURITY )
+	{
+		if( libevtx_filter_parser_match_name(
+		     parser,
+		     "@UserID",
+		     7 ) != 0 )
+		{
+			value_type = LIBEVTX_FILTER_VALUE_TYPE_USER_SECURITY_IDENTIFIER;
+		}
+	}
+	if( value_type == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - unsupported attribute at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) parser->string_offset );
+
+		return( -1 );
+	}
+	result = libevtx_filter_parser_parse_comparison(
+	          parser,
+	          &comparison );
+
+	if( ( result == 0 )
+	 && ( value_type == LIBEVTX_FILTER_VALUE_TYPE_WRITTEN_TIME ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - missing comparison at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) parser->string_offset );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( ( value_type != LIBEVTX_FILTER_VALUE_TYPE_WRITTEN_TIME )
+		 && ( comparison != LIBEVTX_FILTER_COMPARISON_EQUAL )
+		 && ( comparison != LIBEVTX_FILTER_COMPARISON_NOT_EQUAL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unsupported string comparison at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) parser->string_offset );
+
+			return( -1 );
+		}
+		if( is_time_difference != 0 )
+		{
+			result = libevtx_filter_parser_parse_integer(
+			          parser,
+			          &integer_value,
+			          error );
+		}
+		else
+		{
+			result = libevtx_filter_parser_parse_string(
+			          parser,
+			          &utf8_string,
+			          &utf8_string_length,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse attribute value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_filter_expression_append_instruction(
+	     expression,
+	     LIBEVTX_FILTER_OPCODE_TEST,
+	     &instruction,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append test instruction.",
+		 function );
+
+		return( -1 );
+	}
+	instruction->value_type = value_type;
+	instruction->comparison = comparison;
+
+	if( is_time_difference != 0 )
+	{
+		/* timediff(@SystemTime) contains the number of milli seconds
+		 * between the written time and the current time, hence
+		 * timediff(@SystemTime) <= value equals written time >= current time - value
+		 */
+		if( integer_value > ( (uint64_t) UINT64_MAX / 10000 ) )
+		{
+			integer_value = (uint64_t) UINT64_MAX;
+		}
+		else
+		{
+			integer_value *= 10000;
+		}
+		if( integer_value > parser->current_time )
+		{
+			instruction->integer_value = 0;
+		}
+		else
+		{
+			instruction->integer_value = parser->current_time - integer_value;
+		}
+		switch( comparison )
+		{
+			case LIBEVTX_FILTER_COMPARISON_LESS:
+				instruction->comparison = LIBEVTX_FILTER_COMPARISON_GREATER;
+				break;
+
+			case LIBEVTX_FILTER_COMPARISON_LESS_EQUAL:
+				instruction->comparison = LIBEVTX_FILTER_COMPARISON_GREATER_EQUAL;
+				break;
+
+			case LIBEVTX_FILTER_COMPARISON_GREATER:
+				instruction->comparison = LIBEVTX_FILTER_COMPARISON_LESS;
+				break;
+
+			case LIBEVTX_FILTER_COMPARISON_GREATER_EQUAL:
+				instruction->comparison = LIBEVTX_FILTER_COMPARISON_LESS_EQUAL;
+				break;
+
+			default:
+				break;
+		}
+	}
+	else if( value_type == LIBEVTX_FILTER_VALUE_TYPE_WRITTEN_TIME )
+	{
+		if( libevtx_filter_parser_parse_date_time(
+		     utf8_string,
+		     utf8_string_length,
+		     &( instruction->integer_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse SystemTime value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( value_type == LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_IDENTIFIER )
+	      && ( utf8_string != NULL ) )
+	{
+		if( libfguid_identifier_initialize(
+		     &guid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create GUID.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfguid_identifier_copy_from_utf8_string(
+		     guid,
+		     utf8_string,
+		     utf8_string_length,
+		     LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy GUID from Guid value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfguid_identifier_copy_to_byte_stream(
+		     guid,
+		     instruction->provider_identifier,
+		     16,
+		     LIBFGUID_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy GUID to byte stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfguid_identifier_free(
+		     &guid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free GUID.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( utf8_string != NULL )
+	{
+		if( libevtx_filter_instruction_set_utf16_string(
+		     instruction,
+		     utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set instruction string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( value_type == LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_NAME )
+	 || ( value_type == LIBEVTX_FILTER_VALUE_TYPE_USER_SECURITY_IDENTIFIER ) )
+	{
+		expression->flags |= LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_XML_DOCUMENT;
+	}
+	return( 1 );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Parses an EventData element test: Data[ [@Name='name'] ] [ comparison 'value' ]
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_parser_parse_event_data_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     libcerror_error_t **error )
+{
+	libevtx_filter_instruction_t *instruction = NULL;
+	const uint8_t *utf8_name                  = NULL;
+	const uint8_t *utf8_string                = NULL;
+	static char *function                     = "libevtx_filter_parser_parse_event_data_test";
+	size_t utf8_name_length                   = 0;
+	size_t utf8_string_length                 = 0;
+	uint8_t comparison                        = LIBEVTX_FILTER_COMPARISON_EXISTS;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_filter_parser_match_name(
+	     parser,
+	     "Data",
+	     4 ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - unsupported EventData element at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) parser->string_offset );
+
+		return( -1 );
+	}
+	if( libevtx_filter_parser_match_token(
+	     parser,
+	     "[",
+	     1 ) != 0 )
+	{
+		if( ( libevtx_filter_parser_expect_token(
+		       parser,
+		       "@Name",
+		       5,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_expect_token(
+		       parser,
+		       "=",
+		       1,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_parse_string(
+		       parser,
+		       &utf8_name,
+		       &utf8_name_length,
+		       error ) != 1 )
+		 || ( libevtx_filter_parser_expect_token(
+		       parser,
+		       "]",
+		       1,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse Data predicate.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_filter_parser_parse_comparison(
+	     parser,
+	     &comparison ) != 0 )
+	{
+		if( ( comparison != LIBEVTX_FILTER_COMPARISON_EQUAL )
+		 && ( comparison != LIBEVTX_FILTER_COMPARISON_NOT_EQUAL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unsupported string comparison at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) parser->string_offset );
+
+			return( -1 );
+		}
+		if( libevtx_filter_parser_parse_string(
+		     parser,
+		     &utf8_string,
+		     &utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse Data value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_filter_expression_append_instruction(
+	     expression,
+	     LIBEVTX_FILTER_OPCODE_TEST,
+	     &instruction,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append test instruction.",
+		 function );
+
+		return( -1 );
+	}
+	instruction->value_type = LIBEVTX_FILTER_VALUE_TYPE_EVENT_DATA;
+	instruction->comparison = comparison;
+
+	if( utf8_name != NULL )
+	{
+		if( libevtx_filter_instruction_set_utf8_string(
+		     &( instruction->utf8_name ),
+		     &( instruction->utf8_name_size ),
+		     utf8_name,
+		     utf8_name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set instruction name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( utf8_string != NULL )
+	{
+		if( libevtx_filter_instruction_set_utf8_string(
+		     &( instruction->utf8_string ),
+		     &( instruction->utf8_string_size ),
+		     utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set instruction string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	expression->flags |= LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_EVENT_DATA;
+
+	return( 1 );
+}
+
+/* Sets the UTF-16 string of an instruction from an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_instruction_set_utf16_string(
+     libevtx_filter_instruction_t *instruction,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_instruction_set_utf16_string";
+
+	if( instruction == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction->utf16_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid instruction - UTF-16 string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string only contains the end of string character
+	 */
+	if( utf8_string_length == 0 )
+	{
+		instruction->utf16_string_size = 1;
+	}
+	else if( libuna_utf16_string_size_from_utf8(
+	          utf8_string,
+	          utf8_string_length,
+	          &( instruction->utf16_string_size ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( instruction->utf16_string_size == 0 )
+	 || ( instruction->utf16_string_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	instruction->utf16_string = (uint16_t *) memory_allocate(
+	                                          sizeof( uint16_t ) * instruction->utf16_string_size );
+
+	if( instruction->utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_length == 0 )
+	{
+		instruction->utf16_string[ 0 ] = 0;
+	}
+	else if( libuna_utf16_string_copy_from_utf8(
+	          instruction->utf16_string,
+	          instruction->utf16_string_size,
+	          utf8_string,
+	          utf8_string_length,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( instruction->utf16_string != NULL )
+	{
+		memory_free(
+		 instruction->utf16_string );
+
+		instruction->utf16_string = NULL;
+	}
+	instruction->utf16_string_size = 0;
+
+	return( -1 );
+}
+
+/* Sets an UTF-8 string of an instruction
+ * The instruction string is terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_filter_instruction_set_utf8_string(
+     uint8_t **instruction_string,
+     size_t *instruction_string_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_instruction_set_utf8_string";
+
+	if( instruction_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *instruction_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid instruction string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > ( (size_t) SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*instruction_string = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * ( utf8_string_length + 1 ) );
+
+	if( *instruction_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create instruction string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		if( memory_copy(
+		     *instruction_string,
+		     utf8_string,
+		     utf8_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy instruction string.",
+			 function );
+
+			memory_free(
+			 *instruction_string );
+
+			*instruction_string = NULL;
+
+			return( -1 );
+		}
+	}
+	( *instruction_string )[ utf8_string_length ] = 0;
+
+	*instruction_string_size = utf8_string_length + 1;
+
+	return( 1 );
+}
+
+/* Compares an integer value with a filter value
+ * Returns 1 if the comparison holds or 0 if not
+ */
+int libevtx_filter_compare_integer(
+     uint8_t comparison,
+     uint64_t value,
+     uint64_t filter_value )
+{
+	switch( comparison )
+	{
+		case LIBEVTX_FILTER_COMPARISON_EQUAL:
+			return( value == filter_value );
+
+		case LIBEVTX_FILTER_COMPARISON_NOT_EQUAL:
+			return( value != filter_value );
+
+		case LIBEVTX_FILTER_COMPARISON_LESS:
+			return( value < filter_value );
+
+		case LIBEVTX_FILTER_COMPARISON_LESS_EQUAL:
+			return( value <= filter_value );
+
+		case LIBEVTX_FILTER_COMPARISON_GREATER:
+			return( value > filter_value );
+
+		case LIBEVTX_FILTER_COMPARISON_GREATER_EQUAL:
+			return( value >= filter_value );
+
+		case LIBEVTX_FILTER_COMPARISON_BITWISE_AND:
+			return( ( value & filter_value ) != 0 );
+
+		case LIBEVTX_FILTER_COMPARISON_EXISTS:
+			return( 1 );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Compares an UTF-8 string of a filter instruction with an UTF-8 string
+ * The sizes should include the end of string character
+ * The comparison is case insensitive for the ASCII characters
+ * Returns 1 if the strings are equal or 0 if not
+ */
+int libevtx_filter_compare_utf8_string(
+     const uint8_t *filter_string,
+     size_t filter_string_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size )
+{
+	size_t character_index   = 0;
+	uint8_t filter_character = 0;
+	uint8_t string_character = 0;
+
+	if( ( filter_string == NULL )
+	 || ( filter_string_size == 0 )
+	 || ( utf8_string == NULL ) )
+	{
+		return( 0 );
+	}
+	/* Ignore trailing end of string characters
+	 */
+	while( ( utf8_string_size > 0 )
+	    && ( utf8_string[ utf8_string_size - 1 ] == 0 ) )
+	{
+		utf8_string_size--;
+	}
+	if( utf8_string_size != ( filter_string_size - 1 ) )
+	{
+		return( 0 );
+	}
+	for( character_index = 0;
+	     character_index < utf8_string_size;
+	     character_index++ )
+	{
+		filter_character = filter_string[ character_index ];
+		string_character = utf8_string[ character_index ];
+
+		if( ( filter_character >= (uint8_t) 'A' )
+		 && ( filter_character <= (uint8_t) 'Z' ) )
+		{
+			filter_character += (uint8_t) ( 'a' - 'A' );
+		}
+		if( ( string_character >= (uint8_t) 'A' )
+		 && ( string_character <= (uint8_t) 'Z' ) )
+		{
+			string_character += (uint8_t) ( 'a' - 'A' );
+		}
+		if( filter_character != string_character )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded string value of a record tested by an instruction
+ * The string is allocated and should be freed by the caller
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_filter_instruction_get_utf16_value(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_record_values_t *record_values,
+     uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_filter_instruction_get_utf16_value";
+	int result            = 0;
+
+	if( instruction == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( instruction->value_type )
+	{
+		case LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_NAME:
+			result = libevtx_record_values_get_utf16_source_name_size(
+			          record_values,
+			          utf16_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_CHANNEL_NAME:
+			result = libevtx_record_values_get_utf16_channel_name_size(
+			          record_values,
+			          utf16_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_COMPUTER_NAME:
+			result = libevtx_record_values_get_utf16_computer_name_size(
+			          record_values,
+			          utf16_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_USER_SECURITY_IDENTIFIER:
+			result = libevtx_record_values_get_utf16_user_security_identifier_size(
+			          record_values,
+			          utf16_string_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported instruction value type: %" PRIu8 ".",
+			 function,
+			 instruction->value_type );
+
+			return( -1 );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( *utf16_string_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( *utf16_string_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	*utf16_string = (uint16_t *) memory_allocate(
+	                              sizeof( uint16_t ) * *utf16_string_size );
+
+	if( *utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	switch( instruction->value_type )
+	{
+		case LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_NAME:
+			result = libevtx_record_values_get_utf16_source_name(
+			          record_values,
+			          *utf16_string,
+			          *utf16_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_CHANNEL_NAME:
+			result = libevtx_record_values_get_utf16_channel_name(
+			          record_values,
+			          *utf16_string,
+			          *utf16_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_COMPUTER_NAME:
+			result = libevtx_record_values_get_utf16_computer_name(
+			          record_values,
+			          *utf16_string,
+			          *utf16_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_USER_SECURITY_IDENTIFIER:
+			result = libevtx_record_values_get_utf16_user_security_identifier(
+			          record_values,
+			          *utf16_string,
+			          *utf16_string_size,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *utf16_string != NULL )
+	{
+		memory_free(
+		 *utf16_string );
+
+		*utf16_string = NULL;
+	}
+	*utf16_string_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the provider identifier of a record
+ * The provider identifier is retrieved from the System values if no XML document was read
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_filter_instruction_get_provider_identifier(
+     libevtx_record_values_t *record_values,
+     uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libcerror_error_t **error )
+{
+	uint16_t provider_identifier_string[ 64 ];
+
+	libfguid_identifier_t *guid            = NULL;
+	static char *function                  = "libevtx_filter_instruction_get_provider_identifier";
+	size_t provider_identifier_string_size = 0;
+	int result                             = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid provider identifier size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		if( libevtx_record_values_has_system_values(
+		     record_values,
+		     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) == 0 )
+		{
+			return( 0 );
+		}
+		if( memory_copy(
+		     provider_identifier,
+		     record_values->system_values.provider_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libevtx_record_values_get_utf16_provider_identifier_size(
+	          record_values,
+	          &provider_identifier_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 provider identifier size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( provider_identifier_string_size == 0 )
+	      || ( provider_identifier_string_size > 64 ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_record_values_get_utf16_provider_identifier(
+	     record_values,
+	     provider_identifier_string,
+	     provider_identifier_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	/* A provider identifier that is not a valid GUID string is considered not available
+	 */
+	result = libfguid_identifier_copy_from_utf16_string(
+	          guid,
+	          provider_identifier_string,
+	          provider_identifier_string_size - 1,
+	          LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 error );
+
+		result = 0;
+	}
+	else if( libfguid_identifier_copy_to_byte_stream(
+	          guid,
+	          provider_identifier,
+	          16,
+	          LIBFGUID_ENDIAN_LITTLE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_free(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free GUID.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Evaluates an EventData test instruction
+ * The test holds if one of the (named) Data elements holds
+ * Returns 1 if the test holds, 0 if not or -1 on error
+ */
+int libevtx_filter_instruction_evaluate_event_data(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "libevtx_filter_instruction_evaluate_event_data";
+	size_t utf8_string_size = 0;
+	uint32_t name_hash      = 0;
+	int number_of_strings   = 0;
+	int result              = 0;
+	int string_index        = 0;
+
+	if( instruction == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction.",
+		 function );
+
+		return( -1 );
+	}
+	/* Without an XML document the test is evaluated with the EventData values
+	 */
+	if( ( record_values != NULL )
+	 && ( record_values->xml_document == NULL )
+	 && ( record_values->event_data_values != NULL ) )
+	{
+		return( libevtx_filter_instruction_evaluate_event_data_values(
+		         instruction,
+		         record_values->event_data_values ) );
+	}
+	/* A record of which the data cannot be parsed does not match
+	 */
+	if( libevtx_record_values_get_number_of_strings(
+	     record_values,
+	     io_handle,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	if( instruction->utf8_name != NULL )
+	{
+		/* The string name hashes rule out most of the Data elements
+		 * without retrieving their names
+		 */
+		if( libevtx_record_values_build_string_name_index(
+		     record_values,
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build string name index.",
+			 function );
+
+			goto on_error;
+		}
+		name_hash = libevtx_record_values_get_string_name_hash(
+		             instruction->utf8_name,
+		             instruction->utf8_name_size - 1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( instruction->utf8_name != NULL )
+		{
+			if( record_values->string_name_hashes[ string_index ] != name_hash )
+			{
+				continue;
+			}
+			if( libevtx_record_values_get_utf8_string_name_size(
+			     record_values,
+			     io_handle,
+			     string_index,
+			     &utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d name size.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			if( utf8_string_size != instruction->utf8_name_size )
+			{
+				continue;
+			}
+			utf8_string = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * utf8_string_size );
+
+			if( utf8_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create string name.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevtx_record_values_get_utf8_string_name(
+			     record_values,
+			     io_handle,
+			     string_index,
+			     utf8_string,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d name.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			/* The Data element name is compared case sensitive
+			 */
+			result = memory_compare(
+			          utf8_string,
+			          instruction->utf8_name,
+			          utf8_string_size );
+
+			memory_free(
+			 utf8_string );
+
+			utf8_string = NULL;
+
+			if( result != 0 )
+			{
+				continue;
+			}
+		}
+		if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_EXISTS )
+		{
+			return( 1 );
+		}
+		if( libevtx_record_values_get_utf8_string_size(
+		     record_values,
+		     io_handle,
+		     string_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d size.",
+			 function,
+			 string_index );
+
+			goto on_error;
+		}
+		if( utf8_string_size == 0 )
+		{
+			result = libevtx_filter_compare_utf8_string(
+			          instruction->utf8_string,
+			          instruction->utf8_string_size,
+			          (uint8_t *) "",
+			          1 );
+		}
+		else
+		{
+			utf8_string = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * utf8_string_size );
+
+			if( utf8_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create string.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevtx_record_values_get_utf8_string(
+			     record_values,
+			     io_handle,
+			     string_index,
+			     utf8_string,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			result = libevtx_filter_compare_utf8_string(
+			          instruction->utf8_string,
+			          instruction->utf8_string_size,
+			          utf8_string,
+			          utf8_string_size );
+
+			memory_free(
+			 utf8_string );
+
+			utf8_string = NULL;
+		}
+		if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_NOT_EQUAL )
+		{
+			result = ( result == 0 );
+		}
+		if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Evaluates an EventData test instruction with the EventData values
+ * The test holds if one of the (named) Data elements holds
+ * Returns 1 if the test holds or 0 if not
+ */
+int libevtx_filter_instruction_evaluate_event_data_values(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_event_data_values_t *event_data_values )
+{
+	libevtx_event_data_value_t *event_data_value = NULL;
+	int result                                   = 0;
+	int value_index                              = 0;
+
+	if( ( instruction == NULL )
+	 || ( event_data_values == NULL ) )
+	{
+		return( 0 );
+	}
+	for( value_index = 0;
+	     value_index < event_data_values->number_of_values;
+	     value_index++ )
+	{
+		event_data_value = &( event_data_values->values[ value_index ] );
+
+		/* The Data element name is compared case sensitive
+		 */
+		if( instruction->utf8_name != NULL )
+		{
+			if( libevtx_event_data_values_compare_utf8_string(
+			     event_data_value->name,
+			     event_data_value->name_size,
+			     instruction->utf8_name,
+			     instruction->utf8_name_size,
+			     0 ) != 1 )
+			{
+				continue;
+			}
+		}
+		if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_EXISTS )
+		{
+			return( 1 );
+		}
+		result = libevtx_event_data_values_compare_utf8_string(
+		          event_data_value->value,
+		          event_data_value->value_size,
+		          instruction->utf8_string,
+		          instruction->utf8_string_size,
+		          1 );
+
+		if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_NOT_EQUAL )
+		{
+			result = ( result == 0 );
+		}
+		if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Evaluates a test instruction
+ * A test of a value the record does not contain does not hold
+ * Returns 1 if the test holds, 0 if not or -1 on error
+ */
+int libevtx_filter_instruction_evaluate(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ 16 ];
+
+	uint16_t *utf16_string    = NULL;
+	const uint8_t *utf16_stream = NULL;
+	static char *function     = "libevtx_filter_instruction_evaluate";
+	size_t utf16_stream_size  = 0;
+	size_t utf16_string_size  = 0;
+	uint64_t keywords         = 0;
+	uint32_t event_identifier = 0;
+	uint8_t event_level       = 0;
+	int result                = 0;
+
+	if( instruction == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	switch( instruction->value_type )
+	{
+		case LIBEVTX_FILTER_VALUE_TYPE_EVENT_IDENTIFIER:
+			/* A record without an EventID element does not match
+			 */
+			if( libevtx_record_values_get_event_identifier(
+			     record_values,
+			     &event_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_free(
+				 error );
+
+				return( 0 );
+			}
+			return( libevtx_filter_compare_integer(
+			         instruction->comparison,
+			         (uint64_t) event_identifier,
+			         instruction->integer_value ) );
+
+		case LIBEVTX_FILTER_VALUE_TYPE_EVENT_LEVEL:
+			/* A record without a Level element does not match
+			 */
+			if( libevtx_record_values_get_event_level(
+			     record_values,
+			     &event_level,
+			     error ) != 1 )
+			{
+				libcerror_error_free(
+				 error );
+
+				return( 0 );
+			}
+			return( libevtx_filter_compare_integer(
+			         instruction->comparison,
+			         (uint64_t) event_level,
+			         instruction->integer_value ) );
+
+		case LIBEVTX_FILTER_VALUE_TYPE_EVENT_RECORD_IDENTIFIER:
+			return( libevtx_filter_compare_integer(
+			         instruction->comparison,
+			         record_values->identifier,
+			         instruction->integer_value ) );
+
+		case LIBEVTX_FILTER_VALUE_TYPE_WRITTEN_TIME:
+			return( libevtx_filter_compare_integer(
+			         instruction->comparison,
+			         record_values->written_time,
+			         instruction->integer_value ) );
+
+		case LIBEVTX_FILTER_VALUE_TYPE_KEYWORDS:
+			result = libevtx_record_values_get_keywords(
+			          record_values,
+			          &keywords,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve keywords.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+			return( libevtx_filter_compare_integer(
+			         instruction->comparison,
+			         keywords,
+			         instruction->integer_value ) );
+
+		case LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_IDENTIFIER:
+			result = libevtx_filter_instruction_get_provider_identifier(
+			          record_values,
+			          provider_identifier,
+			          16,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider identifier.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      || ( instruction->comparison == LIBEVTX_FILTER_COMPARISON_EXISTS ) )
+			{
+				return( result );
+			}
+			result = memory_compare(
+			          provider_identifier,
+			          instruction->provider_identifier,
+			          16 );
+
+			if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_NOT_EQUAL )
+			{
+				return( result != 0 );
+			}
+			return( result == 0 );
+
+		case LIBEVTX_FILTER_VALUE_TYPE_EVENT_DATA:
+			result = libevtx_filter_instruction_evaluate_event_data(
+			          instruction,
+			          record_values,
+			          io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to evaluate EventData test.",
+				 function );
+
+				return( -1 );
+			}
+			return( result );
+
+		case LIBEVTX_FILTER_VALUE_TYPE_CHANNEL_NAME:
+		case LIBEVTX_FILTER_VALUE_TYPE_COMPUTER_NAME:
+			/* Without an XML document the names are compared with the System values
+			 */
+			if( record_values->xml_document == NULL )
+			{
+				if( instruction->value_type == LIBEVTX_FILTER_VALUE_TYPE_CHANNEL_NAME )
+				{
+					if( libevtx_record_values_has_system_values(
+					     record_values,
+					     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME ) == 0 )
+					{
+						return( 0 );
+					}
+					utf16_stream      = record_values->system_values.channel_name;
+					utf16_stream_size = record_values->system_values.channel_name_size;
+				}
+				else
+				{
+					if( libevtx_record_values_has_system_values(
+					     record_values,
+					     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) == 0 )
+					{
+						return( 0 );
+					}
+					utf16_stream      = record_values->system_values.computer_name;
+					utf16_stream_size = record_values->system_values.computer_name_size;
+				}
+				result = libevtx_record_filter_compare_utf16_string_with_utf16_stream(
+				          instruction->utf16_string,
+				          instruction->utf16_string_size,
+				          utf16_stream,
+				          utf16_stream_size );
+
+				if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_NOT_EQUAL )
+				{
+					return( result == 0 );
+				}
+				return( result );
+			}
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_NAME:
+		case LIBEVTX_FILTER_VALUE_TYPE_USER_SECURITY_IDENTIFIER:
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported instruction value type: %" PRIu8 ".",
+			 function,
+			 instruction->value_type );
+
+			return( -1 );
+	}
+	result = libevtx_filter_instruction_get_utf16_value(
+	          instruction,
+	          record_values,
+	          &utf16_string,
+	          &utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_EXISTS )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = libevtx_record_filter_compare_utf16_string_with_utf16_string(
+		          instruction->utf16_string,
+		          instruction->utf16_string_size,
+		          utf16_string,
+		          utf16_string_size );
+
+		if( instruction->comparison == LIBEVTX_FILTER_COMPARISON_NOT_EQUAL )
+		{
+			result = ( result == 0 );
+		}
+	}
+	memory_free(
+	 utf16_string );
+
+	return( result );
+}
+
+/* Evaluates the filter expression for the values of a record
+ * The values tested by the expression are taken from the System values if no XML document
+ * was read, expressions that require the XML document should only be evaluated after
+ * the XML document was read
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libevtx_filter_expression_evaluate(
+     libevtx_filter_expression_t *expression,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t stack[ LIBEVTX_FILTER_EXPRESSION_MAXIMUM_STACK_DEPTH ];
+
+	libevtx_filter_instruction_t *instruction = NULL;
+	static char *function                     = "libevtx_filter_expression_evaluate";
+	int instruction_index                     = 0;
+	int result                                = 0;
+	int stack_depth                           = 0;
+
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( expression->flags & LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_XML_DOCUMENT ) != 0 )
+	{
+		if( ( record_values != NULL )
+		 && ( record_values->xml_document == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid record values - missing XML document.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( expression->flags & LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_EVENT_DATA ) != 0 )
+	{
+		if( ( record_values != NULL )
+		 && ( record_values->xml_document == NULL )
+		 && ( record_values->event_data_values == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid record values - missing XML document and EventData values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( instruction_index = 0;
+	     instruction_index < expression->number_of_instructions;
+	     instruction_index++ )
+	{
+		instruction = &( ( expression->instructions )[ instruction_index ] );
+
+		if( instruction->opcode == LIBEVTX_FILTER_OPCODE_TEST )
+		{
+			if( stack_depth >= LIBEVTX_FILTER_EXPRESSION_MAXIMUM_STACK_DEPTH )
+			{
+				break;
+			}
+			result = libevtx_filter_instruction_evaluate(
+			          instruction,
+			          record_values,
+			          io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to evaluate instruction: %d.",
+				 function,
+				 instruction_index );
+
+				return( -1 );
+			}
+			stack[ stack_depth++ ] = (uint8_t) ( result != 0 );
+		}
+		else if( instruction->opcode == LIBEVTX_FILTER_OPCODE_NOT )
+		{
+			if( stack_depth < 1 )
+			{
+				break;
+			}
+			stack[ stack_depth - 1 ] = (uint8_t) ( stack[ stack_depth - 1 ] == 0 );
+		}
+		else
+		{
+			if( stack_depth < 2 )
+			{
+				break;
+			}
+			stack_depth--;
+
+			if( instruction->opcode == LIBEVTX_FILTER_OPCODE_AND )
+			{
+				stack[ stack_depth - 1 ] = (uint8_t) ( ( stack[ stack_depth - 1 ] != 0 ) && ( stack[ stack_depth ] != 0 ) );
+			}
+			else
+			{
+				stack[ stack_depth - 1 ] = (uint8_t) ( ( stack[ stack_depth - 1 ] != 0 ) || ( stack[ stack_depth ] != 0 ) );
+			}
+		}
+	}
+	if( ( instruction_index != expression->number_of_instructions )
+	 || ( stack_depth != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid expression - stack depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( (int) stack[ 0 ] );
+}
+
+/* Compares the range of values of the records of a chunk with the integer value of a filter instruction
+ * Returns a LIBEVTX_FILTER_CHUNK_RESULT value
+ */
+int libevtx_filter_compare_integer_range(
+     uint8_t comparison,
+     uint64_t minimum_value,
+     uint64_t maximum_value,
+     uint64_t filter_value )
+{
+	int maximum_result = 0;
+	int minimum_result = 0;
+
+	/* A chunk without records has an empty range
+	 */
+	if( minimum_value > maximum_value )
+	{
+		return( LIBEVTX_FILTER_CHUNK_RESULT_NONE );
+	}
+	switch( comparison )
+	{
+		case LIBEVTX_FILTER_COMPARISON_EQUAL:
+		case LIBEVTX_FILTER_COMPARISON_NOT_EQUAL:
+			if( ( filter_value < minimum_value )
+			 || ( filter_value > maximum_value ) )
+			{
+				minimum_result = LIBEVTX_FILTER_CHUNK_RESULT_NONE;
+			}
+			else if( minimum_value == maximum_value )
+			{
+				minimum_result = LIBEVTX_FILTER_CHUNK_RESULT_ALL;
+			}
+			else
+			{
+				return( LIBEVTX_FILTER_CHUNK_RESULT_SOME );
+			}
+			if( comparison == LIBEVTX_FILTER_COMPARISON_NOT_EQUAL )
+			{
+				minimum_result = ( minimum_result == LIBEVTX_FILTER_CHUNK_RESULT_NONE ) ? LIBEVTX_FILTER_CHUNK_RESULT_ALL : LIBEVTX_FILTER_CHUNK_RESULT_NONE;
+			}
+			return( minimum_result );
+
+		/* The values that match these comparisons are a contiguous range
+		 * hence the records match if both the smallest and largest value match
+		 */
+		case LIBEVTX_FILTER_COMPARISON_LESS:
+		case LIBEVTX_FILTER_COMPARISON_LESS_EQUAL:
+		case LIBEVTX_FILTER_COMPARISON_GREATER:
+		case LIBEVTX_FILTER_COMPARISON_GREATER_EQUAL:
+			minimum_result = libevtx_filter_compare_integer(
+			                  comparison,
+			                  minimum_value,
+			                  filter_value );
+
+			maximum_result = libevtx_filter_compare_integer(
+			                  comparison,
+			                  maximum_value,
+			                  filter_value );
+
+			if( ( minimum_result != 0 )
+			 && ( maximum_result != 0 ) )
+			{
+				return( LIBEVTX_FILTER_CHUNK_RESULT_ALL );
+			}
+			else if( ( minimum_result == 0 )
+			      && ( maximum_result == 0 ) )
+			{
+				return( LIBEVTX_FILTER_CHUNK_RESULT_NONE );
+			}
+			break;
+
+		case LIBEVTX_FILTER_COMPARISON_EXISTS:
+			return( LIBEVTX_FILTER_CHUNK_RESULT_ALL );
+
+		default:
+			break;
+	}
+	return( LIBEVTX_FILTER_CHUNK_RESULT_SOME );
+}
+
+/* Evaluates a filter instruction for the records of a chunk
+ * The event identifiers and provider identifiers are tested with the summary of
+ * the chunk and the written times with the written time range of the chunk
+ * Returns a LIBEVTX_FILTER_CHUNK_RESULT value
+ */
+int libevtx_filter_instruction_evaluate_chunk_descriptor(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_chunk_descriptor_t *chunk_descriptor )
+{
+	if( ( instruction == NULL )
+	 || ( chunk_descriptor == NULL ) )
+	{
+		return( LIBEVTX_FILTER_CHUNK_RESULT_SOME );
+	}
+	switch( instruction->value_type )
+	{
+		case LIBEVTX_FILTER_VALUE_TYPE_EVENT_IDENTIFIER:
+			if( ( instruction->comparison == LIBEVTX_FILTER_COMPARISON_EQUAL )
+			 && ( instruction->integer_value <= (uint64_t) UINT32_MAX )
+			 && ( libevtx_chunk_descriptor_may_contain_event_identifier(
+			       chunk_descriptor,
+			       (uint32_t) instruction->integer_value ) == 0 ) )
+			{
+				return( LIBEVTX_FILTER_CHUNK_RESULT_NONE );
+			}
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_PROVIDER_IDENTIFIER:
+			if( ( instruction->comparison == LIBEVTX_FILTER_COMPARISON_EQUAL )
+			 && ( libevtx_chunk_descriptor_may_contain_provider_identifier(
+			       chunk_descriptor,
+			       instruction->provider_identifier ) == 0 ) )
+			{
+				return( LIBEVTX_FILTER_CHUNK_RESULT_NONE );
+			}
+			break;
+
+		case LIBEVTX_FILTER_VALUE_TYPE_WRITTEN_TIME:
+			return( libevtx_filter_compare_integer_range(
+			         instruction->comparison,
+			         chunk_descriptor->minimum_written_time,
+			         chunk_descriptor->maximum_written_time,
+			         instruction->integer_value ) );
+
+		default:
+			break;
+	}
+	return( LIBEVTX_FILTER_CHUNK_RESULT_SOME );
+}
+
+/* Evaluates the filter expression for the records of a chunk without reading the chunk
+ * Tests that cannot be determined from the chunk descriptor are considered to match some records
+ * Returns 1 if records of the chunk can match, 0 if none match or -1 on error
+ */
+int libevtx_filter_expression_evaluate_chunk_descriptor(
+     libevtx_filter_expression_t *expression,
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libcerror_error_t **error )
+{
+	uint8_t stack[ LIBEVTX_FILTER_EXPRESSION_MAXIMUM_STACK_DEPTH ];
+
+	libevtx_filter_instruction_t *instruction = NULL;
+	static char *function                     = "libevtx_filter_expression_evaluate_chunk_descriptor";
+	uint8_t first_result                      = 0;
+	uint8_t second_result                     = 0;
+	int instruction_index                     = 0;
+	int stack_depth                           = 0;
+
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	for( instruction_index = 0;
+	     instruction_index < expression->number_of_instructions;
+	     instruction_index++ )
+	{
+		instruction = &( ( expression->instructions )[ instruction_index ] );
+
+		if( instruction->opcode == LIBEVTX_FILTER_OPCODE_TEST )
+		{
+			if( stack_depth >= LIBEVTX_FILTER_EXPRESSION_MAXIMUM_STACK_DEPTH )
+			{
+				break;
+			}
+			stack[ stack_depth++ ] = (uint8_t) libevtx_filter_instruction_evaluate_chunk_descriptor(
+			                                    instruction,
+			                                    chunk_descriptor );
+		}
+		else if( instruction->opcode == LIBEVTX_FILTER_OPCODE_NOT )
+		{
+			if( stack_depth < 1 )
+			{
+				break;
+			}
+			if( stack[ stack_depth - 1 ] == LIBEVTX_FILTER_CHUNK_RESULT_NONE )
+			{
+				stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_ALL;
+			}
+			else if( stack[ stack_depth - 1 ] == LIBEVTX_FILTER_CHUNK_RESULT_ALL )
+			{
+				stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_NONE;
+			}
+		}
+		else
+		{
+			if( stack_depth < 2 )
+			{
+				break;
+			}
+			stack_depth--;
+
+			first_result  = stack[ stack_depth - 1 ];
+			second_result = stack[ stack_depth ];
+
+			if( instruction->opcode == LIBEVTX_FILTER_OPCODE_AND )
+			{
+				if( ( first_result == LIBEVTX_FILTER_CHUNK_RESULT_NONE )
+				 || ( second_result == LIBEVTX_FILTER_CHUNK_RESULT_NONE ) )
+				{
+					stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_NONE;
+				}
+				else if( ( first_result == LIBEVTX_FILTER_CHUNK_RESULT_ALL )
+				      && ( second_result == LIBEVTX_FILTER_CHUNK_RESULT_ALL ) )
+				{
+					stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_ALL;
+				}
+				else
+				{
+					stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_SOME;
+				}
+			}
+			else
+			{
+				if( ( first_result == LIBEVTX_FILTER_CHUNK_RESULT_ALL )
+				 || ( second_result == LIBEVTX_FILTER_CHUNK_RESULT_ALL ) )
+				{
+					stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_ALL;
+				}
+				else if( ( first_result == LIBEVTX_FILTER_CHUNK_RESULT_NONE )
+				      && ( second_result == LIBEVTX_FILTER_CHUNK_RESULT_NONE ) )
+				{
+					stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_NONE;
+				}
+				else
+				{
+					stack[ stack_depth - 1 ] = LIBEVTX_FILTER_CHUNK_RESULT_SOME;
+				}
+			}
+		}
+	}
+	if( ( instruction_index != expression->number_of_instructions )
+	 || ( stack_depth != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid expression - stack depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack[ 0 ] == LIBEVTX_FILTER_CHUNK_RESULT_NONE )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,347 @@
+/*
+ * Filter expression functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_FILTER_EXPRESSION_H )
+#define _LIBEVTX_FILTER_EXPRESSION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_event_data_values.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_record_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_filter_instruction libevtx_filter_instruction_t;
+
+struct libevtx_filter_instruction
+{
+	/* The opcode
+	 */
+	uint8_t opcode;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The comparison
+	 */
+	uint8_t comparison;
+
+	/* The integer value
+	 * Contains a FILETIME for the written time
+	 */
+	uint64_t integer_value;
+
+	/* The provider identifier
+	 * Contains a little-endian GUID
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The UTF-16 string
+	 * Contains an UTF-16 string with end of string character
+	 */
+	uint16_t *utf16_string;
+
+	/* The UTF-16 string size
+	 */
+	size_t utf16_string_size;
+
+	/* The UTF-8 Data element name
+	 * Contains an UTF-8 string with end of string character
+	 */
+	uint8_t *utf8_name;
+
+	/* The UTF-8 Data element name size
+	 */
+	size_t utf8_name_size;
+
+	/* The UTF-8 string
+	 * Contains an UTF-8 string with end of string character
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string size
+	 */
+	size_t utf8_string_size;
+};
+
+typedef struct libevtx_filter_expression libevtx_filter_expression_t;
+
+struct libevtx_filter_expression
+{
+	/* The instructions
+	 * The instructions are stored in postfix order
+	 */
+	libevtx_filter_instruction_t *instructions;
+
+	/* The number of instructions
+	 */
+	int number_of_instructions;
+
+	/* The number of allocated instructions
+	 */
+	int number_of_allocated_instructions;
+
+	/* The stack depth
+	 * Used while compiling
+	 */
+	int stack_depth;
+
+	/* Various flags
+	 */
+	uint8_t flags;
+};
+
+/* The filter expression contexts
+ */
+enum LIBEVTX_FILTER_CONTEXTS
+{
+	LIBEVTX_FILTER_CONTEXT_EVENT				= 0,
+	LIBEVTX_FILTER_CONTEXT_SYSTEM				= 1,
+	LIBEVTX_FILTER_CONTEXT_PROVIDER				= 2,
+	LIBEVTX_FILTER_CONTEXT_TIME_CREATED			= 3,
+	LIBEVTX_FILTER_CONTEXT_SECURITY				= 4,
+	LIBEVTX_FILTER_CONTEXT_EVENT_DATA			= 5
+};
+
+typedef struct libevtx_filter_parser libevtx_filter_parser_t;
+
+struct libevtx_filter_parser
+{
+	/* The UTF-8 expression string
+	 */
+	const uint8_t *string;
+
+	/* The UTF-8 expression string length
+	 */
+	size_t string_length;
+
+	/* The current offset
+	 */
+	size_t string_offset;
+
+	/* The current nesting depth
+	 */
+	int depth;
+
+	/* The current time
+	 * Contains a FILETIME
+	 */
+	uint64_t current_time;
+};
+
+int libevtx_filter_expression_initialize(
+     libevtx_filter_expression_t **expression,
+     libcerror_error_t **error );
+
+int libevtx_filter_expression_free(
+     libevtx_filter_expression_t **expression,
+     libcerror_error_t **error );
+
+int libevtx_filter_expression_append_instruction(
+     libevtx_filter_expression_t *expression,
+     uint8_t opcode,
+     libevtx_filter_instruction_t **instruction,
+     libcerror_error_t **error );
+
+int libevtx_filter_expression_compile(
+     libevtx_filter_expression_t *expression,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t current_time,
+     libcerror_error_t **error );
+
+int libevtx_filter_expression_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+void libevtx_filter_parser_skip_whitespace(
+      libevtx_filter_parser_t *parser );
+
+int libevtx_filter_parser_match_token(
+     libevtx_filter_parser_t *parser,
+     const char *token,
+     size_t token_length );
+
+int libevtx_filter_parser_match_name(
+     libevtx_filter_parser_t *parser,
+     const char *name,
+     size_t name_length );
+
+int libevtx_filter_parser_expect_token(
+     libevtx_filter_parser_t *parser,
+     const char *token,
+     size_t token_length,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_comparison(
+     libevtx_filter_parser_t *parser,
+     uint8_t *comparison );
+
+int libevtx_filter_parser_parse_integer(
+     libevtx_filter_parser_t *parser,
+     uint64_t *integer_value,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_string(
+     libevtx_filter_parser_t *parser,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_date_time(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_or_expression(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_and_expression(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_unary_expression(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_predicate(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_system_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_attribute_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     int context,
+     libcerror_error_t **error );
+
+int libevtx_filter_parser_parse_event_data_test(
+     libevtx_filter_parser_t *parser,
+     libevtx_filter_expression_t *expression,
+     libcerror_error_t **error );
+
+int libevtx_filter_instruction_set_utf16_string(
+     libevtx_filter_instruction_t *instruction,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libevtx_filter_instruction_set_utf8_string(
+     uint8_t **instruction_string,
+     size_t *instruction_string_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libevtx_filter_compare_integer(
+     uint8_t comparison,
+     uint64_t value,
+     uint64_t filter_value );
+
+int libevtx_filter_compare_utf8_string(
+     const uint8_t *filter_string,
+     size_t filter_string_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size );
+
+int libevtx_filter_instruction_get_utf16_value(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_record_values_t *record_values,
+     uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libevtx_filter_instruction_get_provider_identifier(
+     libevtx_record_values_t *record_values,
+     uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libcerror_error_t **error );
+
+int libevtx_filter_instruction_evaluate_event_data(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_filter_instruction_evaluate_event_data_values(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_event_data_values_t *event_data_values );
+
+int libevtx_filter_instruction_evaluate(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_filter_expression_evaluate(
+     libevtx_filter_expression_t *expression,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_filter_compare_integer_range(
+     uint8_t comparison,
+     uint64_t minimum_value,
+     uint64_t maximum_value,
+     uint64_t filter_value );
+
+int libevtx_filter_instruction_evaluate_chunk_descriptor(
+     libevtx_filter_instruction_t *instruction,
+     libevtx_chunk_descriptor_t *chunk_descriptor );
+
+int libevtx_filter_expression_evaluate_chunk_descriptor(
+     libevtx_filter_expression_t *expression,
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_FILTER_EXPRESSION_H ) */
+
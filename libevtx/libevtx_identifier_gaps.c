@@ -0,0 +1,523 @@
+/*
+ * Record identifier gaps functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_identifier_gaps.h"
+#include "libevtx_libcerror.h"
+
+/* Creates identifier gaps
+ * Make sure the value identifier_gaps is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_initialize(
+     libevtx_identifier_gaps_t **identifier_gaps,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_initialize";
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_gaps != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid identifier gaps value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier_gaps = memory_allocate_structure(
+	                    libevtx_identifier_gaps_t );
+
+	if( *identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier gaps.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *identifier_gaps,
+	     0,
+	     sizeof( libevtx_identifier_gaps_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier gaps.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *identifier_gaps != NULL )
+	{
+		memory_free(
+		 *identifier_gaps );
+
+		*identifier_gaps = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees identifier gaps
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_free(
+     libevtx_identifier_gaps_t **identifier_gaps,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_free";
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_gaps != NULL )
+	{
+		if( ( *identifier_gaps )->gaps != NULL )
+		{
+			memory_free(
+			 ( *identifier_gaps )->gaps );
+		}
+		memory_free(
+		 *identifier_gaps );
+
+		*identifier_gaps = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a gap
+ * A gap of the same type that directly follows the last gap extends the last gap
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_append_gap(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     uint8_t gap_type,
+     uint64_t first_identifier,
+     uint64_t last_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_identifier_gap_t *last_gap     = NULL;
+	libevtx_identifier_gap_t *reallocation = NULL;
+	static char *function                  = "libevtx_identifier_gaps_append_gap";
+	int number_of_allocated_gaps           = 0;
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_gaps->number_of_gaps > 0 )
+	{
+		last_gap = &( identifier_gaps->gaps[ identifier_gaps->number_of_gaps - 1 ] );
+
+		if( ( last_gap->type == gap_type )
+		 && ( last_gap->last_identifier < UINT64_MAX )
+		 && ( ( last_gap->last_identifier + 1 ) == first_identifier ) )
+		{
+			last_gap->last_identifier = last_identifier;
+
+			return( 1 );
+		}
+	}
+	if( identifier_gaps->number_of_gaps >= identifier_gaps->number_of_allocated_gaps )
+	{
+		if( identifier_gaps->number_of_allocated_gaps == 0 )
+		{
+			number_of_allocated_gaps = LIBEVTX_IDENTIFIER_GAPS_INITIAL_NUMBER_OF_GAPS;
+		}
+		else if( identifier_gaps->number_of_allocated_gaps > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated gaps value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_gaps = identifier_gaps->number_of_allocated_gaps * 2;
+		}
+		reallocation = (libevtx_identifier_gap_t *) memory_reallocate(
+		                                             identifier_gaps->gaps,
+		                                             sizeof( libevtx_identifier_gap_t ) * number_of_allocated_gaps );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize gaps.",
+			 function );
+
+			return( -1 );
+		}
+		identifier_gaps->gaps                     = reallocation;
+		identifier_gaps->number_of_allocated_gaps = number_of_allocated_gaps;
+	}
+	last_gap = &( identifier_gaps->gaps[ identifier_gaps->number_of_gaps ] );
+
+	last_gap->first_identifier = first_identifier;
+	last_gap->last_identifier  = last_identifier;
+	last_gap->type             = gap_type;
+
+	identifier_gaps->number_of_gaps += 1;
+
+	return( 1 );
+}
+
+/* Compares an identifier with the previous identifier and appends a gap if they are not consecutive
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_compare_identifier(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     uint64_t previous_identifier,
+     uint64_t identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_compare_identifier";
+	uint8_t gap_type      = 0;
+	uint64_t first        = 0;
+	uint64_t last         = 0;
+
+	if( identifier == previous_identifier )
+	{
+		gap_type = LIBEVTX_IDENTIFIER_GAP_TYPE_DUPLICATE;
+		first    = identifier;
+		last     = identifier;
+	}
+	else if( identifier < previous_identifier )
+	{
+		gap_type = LIBEVTX_IDENTIFIER_GAP_TYPE_OUT_OF_ORDER;
+		first    = identifier;
+		last     = previous_identifier;
+	}
+	else if( identifier > ( previous_identifier + 1 ) )
+	{
+		gap_type = LIBEVTX_IDENTIFIER_GAP_TYPE_MISSING;
+		first    = previous_identifier + 1;
+		last     = identifier - 1;
+	}
+	else
+	{
+		return( 1 );
+	}
+	if( libevtx_identifier_gaps_append_gap(
+	     identifier_gaps,
+	     gap_type,
+	     first,
+	     last,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append gap.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a record identifier in the order the records are read
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_append_identifier(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     uint64_t identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_append_identifier";
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( identifier_gaps->flags & LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_INITIAL_IDENTIFIER ) == 0 )
+	{
+		identifier_gaps->initial_identifier = identifier;
+		identifier_gaps->flags             |= LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_INITIAL_IDENTIFIER;
+	}
+	if( ( identifier_gaps->flags & LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_PREVIOUS_IDENTIFIER ) != 0 )
+	{
+		if( libevtx_identifier_gaps_compare_identifier(
+		     identifier_gaps,
+		     identifier_gaps->previous_identifier,
+		     identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare identifier: %" PRIu64 ".",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+	}
+	identifier_gaps->previous_identifier = identifier;
+	identifier_gaps->flags              |= LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_PREVIOUS_IDENTIFIER;
+
+	return( 1 );
+}
+
+/* Starts a new segment of record identifiers
+ * The chunks of a file that has wrapped are read in the order 0 to the oldest chunk - 1,
+ * which contain the newest records, followed by the oldest chunk to the last chunk.
+ * The first identifier of a new segment is therefore not compared with the previous
+ * identifier, instead the last identifier of the last segment is compared with
+ * the first identifier of the initial segment when finalizing
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_start_segment(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_start_segment";
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( identifier_gaps->flags & LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_INITIAL_IDENTIFIER ) != 0 )
+	{
+		identifier_gaps->flags &= ~( LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_PREVIOUS_IDENTIFIER );
+		identifier_gaps->flags |= LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_SEGMENTS;
+	}
+	return( 1 );
+}
+
+/* Finalizes the identifier gaps after the last record identifier was appended
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_finalize(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_finalize";
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( identifier_gaps->flags & ( LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_PREVIOUS_IDENTIFIER | LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_SEGMENTS ) ) == ( LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_PREVIOUS_IDENTIFIER | LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_SEGMENTS ) )
+	{
+		if( libevtx_identifier_gaps_compare_identifier(
+		     identifier_gaps,
+		     identifier_gaps->previous_identifier,
+		     identifier_gaps->initial_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare initial identifier: %" PRIu64 ".",
+			 function,
+			 identifier_gaps->initial_identifier );
+
+			return( -1 );
+		}
+	}
+	identifier_gaps->flags &= ~( LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_SEGMENTS );
+
+	return( 1 );
+}
+
+/* Retrieves the number of gaps
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_get_number_of_gaps(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     int *number_of_gaps,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_get_number_of_gaps";
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of gaps.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_gaps = identifier_gaps->number_of_gaps;
+
+	return( 1 );
+}
+
+/* Retrieves a specific gap
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_gaps_get_gap(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     int gap_index,
+     uint8_t *gap_type,
+     uint64_t *first_identifier,
+     uint64_t *last_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_gaps_get_gap";
+
+	if( identifier_gaps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier gaps.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( gap_index < 0 )
+	 || ( gap_index >= identifier_gaps->number_of_gaps ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid gap index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( gap_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid gap type.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*gap_type         = identifier_gaps->gaps[ gap_index ].type;
+	*first_identifier = identifier_gaps->gaps[ gap_index ].first_identifier;
+	*last_identifier  = identifier_gaps->gaps[ gap_index ].last_identifier;
+
+	return( 1 );
+}
+
@@ -0,0 +1,145 @@
+/*
+ * Record identifier gaps functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_IDENTIFIER_GAPS_H )
+#define _LIBEVTX_IDENTIFIER_GAPS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of allocated gaps
+ */
+#define LIBEVTX_IDENTIFIER_GAPS_INITIAL_NUMBER_OF_GAPS	16
+
+/* The identifier gaps flags
+ */
+enum LIBEVTX_IDENTIFIER_GAPS_FLAGS
+{
+	LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_PREVIOUS_IDENTIFIER	= 0x01,
+	LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_INITIAL_IDENTIFIER	= 0x02,
+	LIBEVTX_IDENTIFIER_GAPS_FLAG_HAS_SEGMENTS		= 0x04
+};
+
+typedef struct libevtx_identifier_gap libevtx_identifier_gap_t;
+
+struct libevtx_identifier_gap
+{
+	/* The first record identifier of the range
+	 */
+	uint64_t first_identifier;
+
+	/* The last record identifier of the range
+	 */
+	uint64_t last_identifier;
+
+	/* The gap type
+	 */
+	uint8_t type;
+};
+
+typedef struct libevtx_identifier_gaps libevtx_identifier_gaps_t;
+
+struct libevtx_identifier_gaps
+{
+	/* The gaps
+	 */
+	libevtx_identifier_gap_t *gaps;
+
+	/* The number of gaps
+	 */
+	int number_of_gaps;
+
+	/* The number of allocated gaps
+	 */
+	int number_of_allocated_gaps;
+
+	/* The previous record identifier
+	 */
+	uint64_t previous_identifier;
+
+	/* The first record identifier of the initial segment
+	 */
+	uint64_t initial_identifier;
+
+	/* Various flags
+	 */
+	uint8_t flags;
+};
+
+int libevtx_identifier_gaps_initialize(
+     libevtx_identifier_gaps_t **identifier_gaps,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_free(
+     libevtx_identifier_gaps_t **identifier_gaps,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_append_gap(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     uint8_t gap_type,
+     uint64_t first_identifier,
+     uint64_t last_identifier,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_compare_identifier(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     uint64_t previous_identifier,
+     uint64_t identifier,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_append_identifier(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     uint64_t identifier,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_start_segment(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_finalize(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_get_number_of_gaps(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     int *number_of_gaps,
+     libcerror_error_t **error );
+
+int libevtx_identifier_gaps_get_gap(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     int gap_index,
+     uint8_t *gap_type,
+     uint64_t *first_identifier,
+     uint64_t *last_identifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_IDENTIFIER_GAPS_H ) */
+
@@ -0,0 +1,356 @@
+/*
+ * Record identifier index functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libevtx_identifier_index.h"
+#include "libevtx_libcerror.h"
+
+/* The 64-bit Fibonacci hashing multiplier
+ */
+#define LIBEVTX_IDENTIFIER_INDEX_HASH_MULTIPLIER	0x9e3779b97f4a7c15ULL
+
+/* Determines the first slot of an identifier
+ */
+#define libevtx_identifier_index_get_slot( identifier_index, identifier ) \
+	( (uint32_t) ( ( (uint64_t) ( identifier ) * LIBEVTX_IDENTIFIER_INDEX_HASH_MULTIPLIER ) >> 32 ) & ( ( identifier_index )->number_of_slots - 1 ) )
+
+/* Creates an identifier index
+ * The identifier index is an open addressing hash table that contains at least
+ * twice as many slots as records
+ * Make sure the value identifier_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_index_initialize(
+     libevtx_identifier_index_t **identifier_index,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function    = "libevtx_identifier_index_initialize";
+	uint32_t number_of_slots = LIBEVTX_IDENTIFIER_INDEX_MINIMUM_NUMBER_OF_SLOTS;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid identifier index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_records > (int) ( INT32_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_slots < ( (uint32_t) number_of_records * 2 ) )
+	{
+		number_of_slots <<= 1;
+	}
+	if( (size_t) number_of_slots > ( (size_t) SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier_index = memory_allocate_structure(
+	                     libevtx_identifier_index_t );
+
+	if( *identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *identifier_index,
+	     0,
+	     sizeof( libevtx_identifier_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier index.",
+		 function );
+
+		memory_free(
+		 *identifier_index );
+
+		*identifier_index = NULL;
+
+		return( -1 );
+	}
+	( *identifier_index )->identifiers = (uint64_t *) memory_allocate(
+	                                                   sizeof( uint64_t ) * number_of_slots );
+
+	if( ( *identifier_index )->identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	( *identifier_index )->record_indexes = (int *) memory_allocate(
+	                                                 sizeof( int ) * number_of_slots );
+
+	if( ( *identifier_index )->record_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the record indexes need to be cleared to mark the slots as not used
+	 */
+	if( memory_set(
+	     ( *identifier_index )->record_indexes,
+	     0,
+	     sizeof( int ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *identifier_index )->number_of_records = number_of_records;
+	( *identifier_index )->number_of_slots   = number_of_slots;
+
+	return( 1 );
+
+on_error:
+	if( *identifier_index != NULL )
+	{
+		libevtx_identifier_index_free(
+		 identifier_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an identifier index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_identifier_index_free(
+     libevtx_identifier_index_t **identifier_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_index_free";
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_index != NULL )
+	{
+		if( ( *identifier_index )->record_indexes != NULL )
+		{
+			memory_free(
+			 ( *identifier_index )->record_indexes );
+		}
+		if( ( *identifier_index )->identifiers != NULL )
+		{
+			memory_free(
+			 ( *identifier_index )->identifiers );
+		}
+		memory_free(
+		 *identifier_index );
+
+		*identifier_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a record to the identifier index
+ * If the identifier is already in the index the first record with the identifier is retained
+ * Returns 1 if successful, 0 if the identifier is already in the index or -1 on error
+ */
+int libevtx_identifier_index_append_record(
+     libevtx_identifier_index_t *identifier_index,
+     uint64_t identifier,
+     int record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_index_append_record";
+	uint32_t slot         = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= identifier_index->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_index->number_of_entries >= identifier_index->number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid identifier index - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	slot = libevtx_identifier_index_get_slot(
+	        identifier_index,
+	        identifier );
+
+	/* The index contains at least twice as many slots as entries, hence an unused slot is always found
+	 */
+	while( identifier_index->record_indexes[ slot ] != 0 )
+	{
+		if( identifier_index->identifiers[ slot ] == identifier )
+		{
+			return( 0 );
+		}
+		slot = ( slot + 1 ) & ( identifier_index->number_of_slots - 1 );
+	}
+	identifier_index->identifiers[ slot ]    = identifier;
+	identifier_index->record_indexes[ slot ] = record_index + 1;
+
+	identifier_index->number_of_entries++;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the record with a specific identifier
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libevtx_identifier_index_get_record_index(
+     libevtx_identifier_index_t *identifier_index,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_identifier_index_get_record_index";
+	uint32_t slot         = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	slot = libevtx_identifier_index_get_slot(
+	        identifier_index,
+	        identifier );
+
+	while( identifier_index->record_indexes[ slot ] != 0 )
+	{
+		if( identifier_index->identifiers[ slot ] == identifier )
+		{
+			*record_index = identifier_index->record_indexes[ slot ] - 1;
+
+			return( 1 );
+		}
+		slot = ( slot + 1 ) & ( identifier_index->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
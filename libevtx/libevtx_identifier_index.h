@@ -0,0 +1,90 @@
+/*
+ * Record identifier index functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_IDENTIFIER_INDEX_H )
+#define _LIBEVTX_IDENTIFIER_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of slots of the identifier index
+ */
+#define LIBEVTX_IDENTIFIER_INDEX_MINIMUM_NUMBER_OF_SLOTS	16
+
+typedef struct libevtx_identifier_index libevtx_identifier_index_t;
+
+struct libevtx_identifier_index
+{
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The record identifiers per slot
+	 */
+	uint64_t *identifiers;
+
+	/* The record indexes per slot
+	 * Contains the record index + 1 or 0 if the slot is not used
+	 */
+	int *record_indexes;
+
+	/* The number of slots, which is a power of 2
+	 */
+	uint32_t number_of_slots;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libevtx_identifier_index_initialize(
+     libevtx_identifier_index_t **identifier_index,
+     int number_of_records,
+     libcerror_error_t **error );
+
+int libevtx_identifier_index_free(
+     libevtx_identifier_index_t **identifier_index,
+     libcerror_error_t **error );
+
+int libevtx_identifier_index_append_record(
+     libevtx_identifier_index_t *identifier_index,
+     uint64_t identifier,
+     int record_index,
+     libcerror_error_t **error );
+
+int libevtx_identifier_index_get_record_index(
+     libevtx_identifier_index_t *identifier_index,
+     uint64_t identifier,
+     int *record_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_IDENTIFIER_INDEX_H ) */
+
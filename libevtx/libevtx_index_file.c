@@ -0,0 +1,2197 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#else
+#include <stdio.h>
+#endif
+
+#include "libevtx_checksum.h"
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_definitions.h"
+#include "libevtx_index_file.h"
+#include "libevtx_indexed_chunks.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_libfdata.h"
+#include "libevtx_value_filter.h"
+
+#include "evtx_index_file.h"
+
+const uint8_t *evtx_index_file_signature = (uint8_t *) "EvtxIdx";
+
+/* Reads the data of an index file
+ * Returns 1 if successful, 0 if the index file does not exist or cannot be used or -1 on error
+ */
+int libevtx_index_file_read_file_data(
+     libbfio_handle_t *index_file_io_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_data       = NULL;
+	static char *function    = "libevtx_index_file_read_file_data";
+	size64_t index_file_size = 0;
+	ssize_t read_count       = 0;
+	int index_file_is_open   = 0;
+	int result               = 0;
+
+	if( index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if index file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     index_file_io_handle,
+	     &index_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	result = 0;
+
+	if( ( index_file_size >= sizeof( evtx_index_file_header_t ) )
+	 && ( index_file_size <= (size64_t) SSIZE_MAX ) )
+	{
+		safe_data = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * (size_t) index_file_size );
+
+		if( safe_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index file data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              index_file_io_handle,
+		              safe_data,
+		              (size_t) index_file_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) index_file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index file data.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	index_file_is_open = 0;
+
+	if( libbfio_handle_close(
+	     index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		*data      = safe_data;
+		*data_size = (size_t) index_file_size;
+	}
+	return( result );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	if( index_file_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an index file
+ * The index file is only used if it was created for the same file, which is determined
+ * by the file size, the calculated file header checksum and, if available, the modification time
+ * Returns 1 if successful, 0 if the index file does not exist or cannot be used or -1 on error
+ */
+int libevtx_index_file_read(
+     libbfio_handle_t *index_file_io_handle,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t *last_indexed_record_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libevtx_index_file_read";
+	size_t data_size      = 0;
+	int result            = 0;
+
+	result = libevtx_index_file_read_file_data(
+	          index_file_io_handle,
+	          &data,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libevtx_index_file_read_data(
+		          data,
+		          data_size,
+		          io_handle,
+		          file_size,
+		          records_list,
+		          recovered_records_list,
+		          chunk_written_time_ranges_array,
+		          last_indexed_record_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index file data.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 data );
+	}
+	return( result );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Checks the index file data
+ * Validates the signature, format version, checksums and number of entries
+ * Returns 1 if the index file data is valid, 0 if not or -1 on error
+ */
+int libevtx_index_file_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libevtx_index_file_check_data";
+	size_t entries_data_size                    = 0;
+	uint32_t calculated_checksum                = 0;
+	uint32_t format_version                     = 0;
+	uint32_t number_of_chunk_entries            = 0;
+	uint32_t number_of_record_entries           = 0;
+	uint32_t number_of_recovered_record_entries = 0;
+	uint32_t number_of_value_filter_entries     = 0;
+	uint32_t stored_checksum                    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( evtx_index_file_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (evtx_index_file_header_t *) data )->signature,
+	     evtx_index_file_signature,
+	     8 ) != 0 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported index file signature.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->checksum,
+	 stored_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) data,
+	     sizeof( evtx_index_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in index file header CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_chunk_entries,
+	 number_of_chunk_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_record_entries,
+	 number_of_record_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_recovered_record_entries,
+	 number_of_recovered_record_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_value_filter_entries,
+	 number_of_value_filter_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->entries_checksum,
+	 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: number of chunk entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_chunk_entries );
+
+		libcnotify_printf(
+		 "%s: number of record entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_record_entries );
+
+		libcnotify_printf(
+		 "%s: number of recovered record entries\t: %" PRIu32 "\n",
+		 function,
+		 number_of_recovered_record_entries );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( format_version != LIBEVTX_INDEX_FILE_FORMAT_VERSION )
+	{
+		return( 0 );
+	}
+	if( ( number_of_chunk_entries > (uint32_t) UINT16_MAX + 1 )
+	 || ( number_of_record_entries > (uint32_t) INT_MAX )
+	 || ( number_of_recovered_record_entries > (uint32_t) INT_MAX )
+	 || ( number_of_value_filter_entries > number_of_chunk_entries ) )
+	{
+		return( 0 );
+	}
+	entries_data_size = ( (size_t) number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) )
+	                  + ( (size_t) number_of_record_entries * sizeof( evtx_index_file_record_entry_t ) )
+	                  + ( (size_t) number_of_recovered_record_entries * sizeof( evtx_index_file_record_entry_t ) )
+	                  + ( (size_t) number_of_value_filter_entries * sizeof( evtx_index_file_value_filter_entry_t ) );
+
+	if( entries_data_size != ( data_size - sizeof( evtx_index_file_header_t ) ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) &( data[ sizeof( evtx_index_file_header_t ) ] ),
+	     entries_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in index file entries CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads an index file chunk entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_read_chunk_entry(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     const uint8_t *entry_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_index_file_read_chunk_entry";
+	uint32_t chunk_flags  = 0;
+	uint32_t chunk_index  = 0;
+
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->chunk_index,
+	 chunk_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->flags,
+	 chunk_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->header_checksum,
+	 chunk_descriptor->header_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->event_records_checksum,
+	 chunk_descriptor->event_records_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->number_of_records,
+	 chunk_descriptor->number_of_indexed_records );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->minimum_record_identifier,
+	 chunk_descriptor->minimum_record_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->maximum_record_identifier,
+	 chunk_descriptor->maximum_record_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->minimum_written_time,
+	 chunk_descriptor->minimum_written_time );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_chunk_entry_t *) entry_data )->maximum_written_time,
+	 chunk_descriptor->maximum_written_time );
+
+	chunk_descriptor->chunk_index = (uint16_t) chunk_index;
+	chunk_descriptor->flags       = (uint8_t) ( chunk_flags & ( LIBEVTX_CHUNK_DESCRIPTOR_FLAG_IS_CONSISTENT | LIBEVTX_CHUNK_DESCRIPTOR_FLAG_RECORDS_ARE_ALLOCATED ) );
+
+	if( ( chunk_flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY ) != 0 )
+	{
+		if( memory_copy(
+		     chunk_descriptor->event_identifiers_bitmap,
+		     ( (evtx_index_file_chunk_entry_t *) entry_data )->event_identifiers_bitmap,
+		     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk: %" PRIu32 " event identifiers bitmap.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     chunk_descriptor->provider_identifiers_bitmap,
+		     ( (evtx_index_file_chunk_entry_t *) entry_data )->provider_identifiers_bitmap,
+		     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk: %" PRIu32 " provider identifiers bitmap.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		chunk_descriptor->flags |= LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY;
+	}
+	return( 1 );
+}
+
+/* Reads the chunk entries and, if required, the value filter entries of validated index file data
+ * Make sure the chunk descriptors array is empty
+ * Returns 1 if successful, 0 if the chunk entries are invalid or -1 on error
+ */
+int libevtx_index_file_read_chunk_entries(
+     const uint8_t *data,
+     libcdata_array_t *chunk_descriptors_array,
+     uint8_t read_value_filters,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	const uint8_t *entry_data                    = NULL;
+	static char *function                        = "libevtx_index_file_read_chunk_entries";
+	uint32_t chunk_index                         = 0;
+	uint32_t entry_index                         = 0;
+	uint32_t number_of_chunk_entries             = 0;
+	uint32_t number_of_record_entries            = 0;
+	uint32_t number_of_recovered_record_entries  = 0;
+	uint32_t number_of_value_filter_entries      = 0;
+	uint32_t previous_chunk_index                = 0;
+	int number_of_entries                        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     chunk_descriptors_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk descriptors array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_chunk_entries,
+	 number_of_chunk_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_record_entries,
+	 number_of_record_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_recovered_record_entries,
+	 number_of_recovered_record_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_value_filter_entries,
+	 number_of_value_filter_entries );
+
+	entry_data = &( data[ sizeof( evtx_index_file_header_t ) ] );
+
+	/* The chunk entries are stored in ascending chunk index order
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_chunk_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) &( entry_data[ entry_index * sizeof( evtx_index_file_chunk_entry_t ) ] ) )->chunk_index,
+		 chunk_index );
+
+		if( ( chunk_index > (uint32_t) UINT16_MAX )
+		 || ( ( entry_index > 0 )
+		  &&  ( chunk_index <= previous_chunk_index ) ) )
+		{
+			return( 0 );
+		}
+		previous_chunk_index = chunk_index;
+	}
+	if( number_of_chunk_entries > 0 )
+	{
+		if( libcdata_array_resize(
+		     chunk_descriptors_array,
+		     (int) previous_chunk_index + 1,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize chunk descriptors array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_chunk_entries;
+	     entry_index++ )
+	{
+		if( libevtx_chunk_descriptor_initialize(
+		     &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_index_file_read_chunk_entry(
+		     chunk_descriptor,
+		     entry_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		chunk_index = (uint32_t) chunk_descriptor->chunk_index;
+
+		if( libcdata_array_set_entry_by_index(
+		     chunk_descriptors_array,
+		     (int) chunk_index,
+		     (intptr_t *) chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %" PRIu32 " descriptor in array.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunk_descriptor = NULL;
+
+		entry_data += sizeof( evtx_index_file_chunk_entry_t );
+	}
+	/* The value filters are only read if required
+	 */
+	if( read_value_filters == 0 )
+	{
+		return( 1 );
+	}
+	entry_data += ( (size_t) number_of_record_entries + (size_t) number_of_recovered_record_entries ) * sizeof( evtx_index_file_record_entry_t );
+
+	for( entry_index = 0;
+	     entry_index < number_of_value_filter_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_index_file_value_filter_entry_t *) entry_data )->chunk_index,
+		 chunk_index );
+
+		if( libcdata_array_get_entry_by_index(
+		     chunk_descriptors_array,
+		     (int) chunk_index,
+		     (intptr_t **) &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu32 " descriptor.",
+			 function,
+			 chunk_index );
+
+			chunk_descriptor = NULL;
+
+			goto on_error;
+		}
+		if( ( chunk_descriptor == NULL )
+		 || ( chunk_descriptor->value_filter != NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value filter entry: %" PRIu32 " chunk index value out of bounds.",
+			 function,
+			 entry_index );
+
+			chunk_descriptor = NULL;
+
+			goto on_error;
+		}
+		if( libevtx_value_filter_initialize(
+		     &( chunk_descriptor->value_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %" PRIu32 " value filter.",
+			 function,
+			 chunk_index );
+
+			chunk_descriptor = NULL;
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     chunk_descriptor->value_filter->data,
+		     ( (evtx_index_file_value_filter_entry_t *) entry_data )->data,
+		     LIBEVTX_VALUE_FILTER_DATA_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk: %" PRIu32 " value filter.",
+			 function,
+			 chunk_index );
+
+			chunk_descriptor = NULL;
+
+			goto on_error;
+		}
+		chunk_descriptor = NULL;
+
+		entry_data += sizeof( evtx_index_file_value_filter_entry_t );
+	}
+	return( 1 );
+
+on_error:
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the index file data
+ * The records lists and the chunk written time ranges array are only changed
+ * if the index file data was validated
+ * Returns 1 if successful, 0 if the index file data cannot be used or -1 on error
+ */
+int libevtx_index_file_read_data(
+     const uint8_t *data,
+     size_t data_size,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t *last_indexed_record_identifier,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data                    = NULL;
+	static char *function                        = "libevtx_index_file_read_data";
+	size64_t element_data_size                   = 0;
+	size64_t stored_chunks_data_size             = 0;
+	size64_t stored_file_size                    = 0;
+	uint64_t element_offset                      = 0;
+	uint64_t safe_last_indexed_record_identifier = 0;
+	uint64_t stored_modification_time            = 0;
+	uint32_t entry_index                         = 0;
+	uint32_t number_of_chunk_entries             = 0;
+	uint32_t number_of_record_entries            = 0;
+	uint32_t number_of_recovered_record_entries  = 0;
+	uint32_t stored_file_header_checksum         = 0;
+	uint32_t stored_io_handle_flags              = 0;
+	int element_index                            = 0;
+	int result                                   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records list.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records list.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_written_time_ranges_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk written time ranges array.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_indexed_record_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last indexed record identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_index_file_check_data(
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check index file data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->file_header_checksum,
+	 stored_file_header_checksum );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->file_size,
+	 stored_file_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->modification_time,
+	 stored_modification_time );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->chunks_data_size,
+	 stored_chunks_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->io_handle_flags,
+	 stored_io_handle_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_chunk_entries,
+	 number_of_chunk_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_record_entries,
+	 number_of_record_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_recovered_record_entries,
+	 number_of_recovered_record_entries );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file header checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_file_header_checksum );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 stored_file_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	/* The index file is considered stale if the file has changed since it was written
+	 * or if the file is dirty, since the chunks of a dirty file can change without
+	 * the file header being updated
+	 */
+	if( ( stored_file_size != file_size )
+	 || ( stored_file_header_checksum != io_handle->file_header_checksum )
+	 || ( ( stored_modification_time != 0 )
+	  &&  ( io_handle->modification_time != 0 )
+	  &&  ( (int64_t) stored_modification_time != io_handle->modification_time ) )
+	 || ( ( io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: index file was created for another file or the file has changed.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	/* The index file is rebuilt if value filters are required but were not stored
+	 */
+	if( ( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) != 0 )
+	 && ( ( stored_io_handle_flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) == 0 ) )
+	{
+		return( 0 );
+	}
+	result = libevtx_index_file_read_chunk_entries(
+	          data,
+	          chunk_written_time_ranges_array,
+	          (uint8_t) ( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) != 0 ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk entries.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	entry_data = &( data[ sizeof( evtx_index_file_header_t ) + ( (size_t) number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) ) ] );
+
+	for( entry_index = 0;
+	     entry_index < ( number_of_record_entries + number_of_recovered_record_entries );
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) entry_data )->file_offset,
+		 element_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) entry_data )->element_data_size,
+		 element_data_size );
+
+		if( ( element_offset > (uint64_t) INT64_MAX )
+		 || ( ( element_data_size & ~LIBEVTX_RECORD_ELEMENT_DATA_SIZE_MASK ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record entry: %" PRIu32 " value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfdata_list_append_element(
+		     ( entry_index < number_of_record_entries ) ? records_list : recovered_records_list,
+		     &element_index,
+		     0,
+		     (off64_t) element_offset,
+		     element_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element to records list.",
+			 function );
+
+			return( -1 );
+		}
+		entry_data += sizeof( evtx_index_file_record_entry_t );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->first_record_identifier,
+	 io_handle->first_record_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->last_record_identifier,
+	 io_handle->last_record_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->last_indexed_record_identifier,
+	 safe_last_indexed_record_identifier );
+
+	io_handle->chunks_data_size = stored_chunks_data_size;
+	io_handle->flags           |= (uint8_t) ( stored_io_handle_flags & LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED );
+
+	*last_indexed_record_identifier = safe_last_indexed_record_identifier;
+
+	return( 1 );
+}
+
+/* Reads the chunk entries and record entries of index file data that is stale
+ * The indexed chunks are compared with the chunks of the file while it is opened
+ * Returns 1 if successful, 0 if the index file data cannot be used or -1 on error
+ */
+int libevtx_index_file_read_indexed_chunks(
+     const uint8_t *data,
+     size_t data_size,
+     libevtx_io_handle_t *io_handle,
+     libevtx_indexed_chunks_t *indexed_chunks,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data                   = NULL;
+	static char *function                       = "libevtx_index_file_read_indexed_chunks";
+	uint32_t number_of_chunk_entries            = 0;
+	uint32_t number_of_record_entries           = 0;
+	uint32_t number_of_recovered_record_entries = 0;
+	uint32_t stored_io_handle_flags             = 0;
+	int result                                  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( indexed_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indexed chunks.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_index_file_check_data(
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check index file data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->io_handle_flags,
+	 stored_io_handle_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_chunk_entries,
+	 number_of_chunk_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_record_entries,
+	 number_of_record_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_recovered_record_entries,
+	 number_of_recovered_record_entries );
+
+	if( ( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) != 0 )
+	 && ( ( stored_io_handle_flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) == 0 ) )
+	{
+		return( 0 );
+	}
+	result = libevtx_index_file_read_chunk_entries(
+	          data,
+	          indexed_chunks->chunk_descriptors_array,
+	          (uint8_t) ( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) != 0 ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk entries.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     indexed_chunks->chunk_descriptors_array,
+	     &( indexed_chunks->number_of_chunks ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( data[ sizeof( evtx_index_file_header_t ) + ( (size_t) number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) ) ] );
+
+	result = libevtx_indexed_chunks_read_record_entries(
+	          indexed_chunks,
+	          entry_data,
+	          number_of_record_entries,
+	          0,
+	          error );
+
+	if( result == 1 )
+	{
+		entry_data += (size_t) number_of_record_entries * sizeof( evtx_index_file_record_entry_t );
+
+		result = libevtx_indexed_chunks_read_record_entries(
+		          indexed_chunks,
+		          entry_data,
+		          number_of_recovered_record_entries,
+		          1,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the index file data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_get_data_size(
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	static char *function                        = "libevtx_index_file_get_data_size";
+	size_t safe_data_size                        = 0;
+	int entry_index                              = 0;
+	int number_of_chunk_entries                  = 0;
+	int number_of_entries                        = 0;
+	int number_of_record_entries                 = 0;
+	int number_of_recovered_record_entries       = 0;
+	int number_of_value_filter_entries           = 0;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     records_list,
+	     &number_of_record_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     recovered_records_list,
+	     &number_of_recovered_record_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     chunk_written_time_ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk written time ranges.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     chunk_written_time_ranges_array,
+		     entry_index,
+		     (intptr_t **) &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %d written time range.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( chunk_descriptor != NULL )
+		{
+			number_of_chunk_entries++;
+
+			if( chunk_descriptor->value_filter != NULL )
+			{
+				number_of_value_filter_entries++;
+			}
+		}
+	}
+	safe_data_size = sizeof( evtx_index_file_header_t )
+	               + ( (size_t) number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) )
+	               + ( (size_t) number_of_record_entries * sizeof( evtx_index_file_record_entry_t ) )
+	               + ( (size_t) number_of_recovered_record_entries * sizeof( evtx_index_file_record_entry_t ) )
+	               + ( (size_t) number_of_value_filter_entries * sizeof( evtx_index_file_value_filter_entry_t ) );
+
+	if( safe_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index file data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the index file data
+ * Make sure the data is at least the size retrieved by libevtx_index_file_get_data_size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t last_indexed_record_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	uint8_t *entry_data                          = NULL;
+	static char *function                        = "libevtx_index_file_write_data";
+	size64_t element_size                        = 0;
+	size_t required_data_size                    = 0;
+	off64_t element_offset                       = 0;
+	uint32_t checksum                            = 0;
+	uint32_t element_flags                       = 0;
+	int element_file_index                       = 0;
+	int element_index                            = 0;
+	int entry_index                              = 0;
+	int number_of_chunk_entries                  = 0;
+	int number_of_entries                        = 0;
+	int number_of_record_entries                 = 0;
+	int number_of_recovered_record_entries       = 0;
+	int number_of_value_filter_entries           = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_index_file_get_data_size(
+	     records_list,
+	     recovered_records_list,
+	     chunk_written_time_ranges_array,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = required_data_size;
+
+	if( libfdata_list_get_number_of_elements(
+	     records_list,
+	     &number_of_record_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     recovered_records_list,
+	     &number_of_recovered_record_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     chunk_written_time_ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk written time ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file data.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( data[ sizeof( evtx_index_file_header_t ) ] );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     chunk_written_time_ranges_array,
+		     entry_index,
+		     (intptr_t **) &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %d written time range.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( chunk_descriptor == NULL )
+		{
+			continue;
+		}
+		number_of_chunk_entries++;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->chunk_index,
+		 (uint32_t) entry_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->flags,
+		 (uint32_t) ( chunk_descriptor->flags & ( LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY | LIBEVTX_CHUNK_DESCRIPTOR_FLAG_IS_CONSISTENT | LIBEVTX_CHUNK_DESCRIPTOR_FLAG_RECORDS_ARE_ALLOCATED ) ) );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->header_checksum,
+		 chunk_descriptor->header_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->event_records_checksum,
+		 chunk_descriptor->event_records_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->number_of_records,
+		 chunk_descriptor->number_of_indexed_records );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->minimum_record_identifier,
+		 chunk_descriptor->minimum_record_identifier );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->maximum_record_identifier,
+		 chunk_descriptor->maximum_record_identifier );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->minimum_written_time,
+		 chunk_descriptor->minimum_written_time );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (evtx_index_file_chunk_entry_t *) entry_data )->maximum_written_time,
+		 chunk_descriptor->maximum_written_time );
+
+		if( ( chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY ) != 0 )
+		{
+			if( memory_copy(
+			     ( (evtx_index_file_chunk_entry_t *) entry_data )->event_identifiers_bitmap,
+			     chunk_descriptor->event_identifiers_bitmap,
+			     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk: %d event identifiers bitmap.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     ( (evtx_index_file_chunk_entry_t *) entry_data )->provider_identifiers_bitmap,
+			     chunk_descriptor->provider_identifiers_bitmap,
+			     LIBEVTX_CHUNK_SUMMARY_BITMAP_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk: %d provider identifiers bitmap.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+		}
+
+		entry_data += sizeof( evtx_index_file_chunk_entry_t );
+	}
+	for( element_index = 0;
+	     element_index < ( number_of_record_entries + number_of_recovered_record_entries );
+	     element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     ( element_index < number_of_record_entries ) ? records_list : recovered_records_list,
+		     ( element_index < number_of_record_entries ) ? element_index : element_index - number_of_record_entries,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d element.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) entry_data )->file_offset,
+		 (uint64_t) element_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) entry_data )->element_data_size,
+		 (uint64_t) element_size );
+
+		entry_data += sizeof( evtx_index_file_record_entry_t );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     chunk_written_time_ranges_array,
+		     entry_index,
+		     (intptr_t **) &chunk_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %d written time range.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( chunk_descriptor == NULL )
+		 || ( chunk_descriptor->value_filter == NULL ) )
+		{
+			continue;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (evtx_index_file_value_filter_entry_t *) entry_data )->chunk_index,
+		 (uint32_t) entry_index );
+
+		if( memory_copy(
+		     ( (evtx_index_file_value_filter_entry_t *) entry_data )->data,
+		     chunk_descriptor->value_filter->data,
+		     LIBEVTX_VALUE_FILTER_DATA_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk: %d value filter.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		number_of_value_filter_entries++;
+
+		entry_data += sizeof( evtx_index_file_value_filter_entry_t );
+	}
+	memory_copy(
+	 ( (evtx_index_file_header_t *) data )->signature,
+	 evtx_index_file_signature,
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->format_version,
+	 LIBEVTX_INDEX_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->file_header_checksum,
+	 io_handle->file_header_checksum );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->file_size,
+	 (uint64_t) file_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->modification_time,
+	 (uint64_t) io_handle->modification_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->chunks_data_size,
+	 (uint64_t) io_handle->chunks_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->first_record_identifier,
+	 io_handle->first_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->last_record_identifier,
+	 io_handle->last_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->last_indexed_record_identifier,
+	 last_indexed_record_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->io_handle_flags,
+	 (uint32_t) ( io_handle->flags & ( LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED | LIBEVTX_IO_HANDLE_FLAG_VALUE_FILTERS ) ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_chunk_entries,
+	 (uint32_t) number_of_chunk_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_record_entries,
+	 (uint32_t) number_of_record_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_recovered_record_entries,
+	 (uint32_t) number_of_recovered_record_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_value_filter_entries,
+	 (uint32_t) number_of_value_filter_entries );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &checksum,
+	     &( data[ sizeof( evtx_index_file_header_t ) ] ),
+	     data_size - sizeof( evtx_index_file_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->entries_checksum,
+	 checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &checksum,
+	     data,
+	     sizeof( evtx_index_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->checksum,
+	 checksum );
+
+	return( 1 );
+}
+
+/* Writes an index file
+ * The index file is replaced by a temporary index file that is written first
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_write(
+     libbfio_handle_t *index_file_io_handle,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t last_indexed_record_identifier,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *temporary_file_io_handle = NULL;
+	char *filename                             = NULL;
+	char *temporary_filename                   = NULL;
+	uint8_t *data                              = NULL;
+	static char *function                      = "libevtx_index_file_write";
+	size_t data_size                           = 0;
+	size_t filename_size                       = 0;
+	ssize_t write_count                        = 0;
+	int index_file_is_open                     = 0;
+
+	if( index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_index_file_get_data_size(
+	     records_list,
+	     recovered_records_list,
+	     chunk_written_time_ranges_array,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file data size.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_index_file_write_data(
+	     data,
+	     data_size,
+	     io_handle,
+	     file_size,
+	     records_list,
+	     recovered_records_list,
+	     chunk_written_time_ranges_array,
+	     last_indexed_record_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write index file data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The index file data is written to a temporary file that replaces
+	 * the index file so that a reader never sees a partially written index file
+	 */
+	if( libbfio_file_get_name_size(
+	     index_file_io_handle,
+	     &filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( filename_size == 0 )
+	 || ( filename_size > (size_t) ( SSIZE_MAX - 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	filename = (char *) memory_allocate(
+	                     sizeof( char ) * filename_size );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_get_name(
+	     index_file_io_handle,
+	     filename,
+	     filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index filename.",
+		 function );
+
+		goto on_error;
+	}
+	temporary_filename = (char *) memory_allocate(
+	                               sizeof( char ) * ( filename_size + 4 ) );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary index filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     temporary_filename,
+	     filename,
+	     filename_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary index filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( temporary_filename[ filename_size - 1 ] ),
+	     ".tmp",
+	     5 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary index filename extension.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &temporary_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create temporary index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     temporary_file_io_handle,
+	     temporary_filename,
+	     filename_size + 3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set temporary index filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     temporary_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open temporary index file.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_is_open = 1;
+
+	write_count = libbfio_handle_write_buffer(
+	               temporary_file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file data.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_is_open = 0;
+
+	if( libbfio_handle_close(
+	     temporary_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close temporary index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &temporary_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free temporary index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	if( MoveFileExA(
+	     temporary_filename,
+	     filename,
+	     MOVEFILE_REPLACE_EXISTING ) == 0 )
+#else
+	if( rename(
+	     temporary_filename,
+	     filename ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to replace index file with temporary index file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_filename );
+
+	memory_free(
+	 filename );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( index_file_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 temporary_file_io_handle,
+		 NULL );
+	}
+	if( temporary_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &temporary_file_io_handle,
+		 NULL );
+	}
+	if( temporary_filename != NULL )
+	{
+		memory_free(
+		 temporary_filename );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
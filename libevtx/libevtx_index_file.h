@@ -0,0 +1,123 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INDEX_FILE_H )
+#define _LIBEVTX_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_indexed_chunks.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libevtx_index_file_read_file_data(
+     libbfio_handle_t *index_file_io_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libevtx_index_file_read(
+     libbfio_handle_t *index_file_io_handle,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t *last_indexed_record_identifier,
+     libcerror_error_t **error );
+
+int libevtx_index_file_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_index_file_read_chunk_entry(
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     const uint8_t *entry_data,
+     libcerror_error_t **error );
+
+int libevtx_index_file_read_chunk_entries(
+     const uint8_t *data,
+     libcdata_array_t *chunk_descriptors_array,
+     uint8_t read_value_filters,
+     libcerror_error_t **error );
+
+int libevtx_index_file_read_data(
+     const uint8_t *data,
+     size_t data_size,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t *last_indexed_record_identifier,
+     libcerror_error_t **error );
+
+int libevtx_index_file_read_indexed_chunks(
+     const uint8_t *data,
+     size_t data_size,
+     libevtx_io_handle_t *io_handle,
+     libevtx_indexed_chunks_t *indexed_chunks,
+     libcerror_error_t **error );
+
+int libevtx_index_file_get_data_size(
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libevtx_index_file_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t last_indexed_record_identifier,
+     libcerror_error_t **error );
+
+int libevtx_index_file_write(
+     libbfio_handle_t *index_file_io_handle,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcdata_array_t *chunk_written_time_ranges_array,
+     uint64_t last_indexed_record_identifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INDEX_FILE_H ) */
+
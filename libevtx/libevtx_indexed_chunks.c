@@ -0,0 +1,660 @@
+/*
+ * Indexed chunks functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_definitions.h"
+#include "libevtx_indexed_chunks.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfdata.h"
+
+#include "evtx_index_file.h"
+
+/* Creates indexed chunks
+ * The indexed chunks contain the chunk descriptors and the record entries of
+ * an index file that was created for a previous version of the file, so that
+ * the chunks that did not change do not need to be read again
+ * Make sure the value indexed_chunks is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_indexed_chunks_initialize(
+     libevtx_indexed_chunks_t **indexed_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_indexed_chunks_initialize";
+
+	if( indexed_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indexed chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( *indexed_chunks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid indexed chunks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*indexed_chunks = memory_allocate_structure(
+	                   libevtx_indexed_chunks_t );
+
+	if( *indexed_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create indexed chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *indexed_chunks,
+	     0,
+	     sizeof( libevtx_indexed_chunks_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear indexed chunks.",
+		 function );
+
+		memory_free(
+		 *indexed_chunks );
+
+		*indexed_chunks = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *indexed_chunks )->chunk_descriptors_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *indexed_chunks != NULL )
+	{
+		memory_free(
+		 *indexed_chunks );
+
+		*indexed_chunks = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees indexed chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_indexed_chunks_free(
+     libevtx_indexed_chunks_t **indexed_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_indexed_chunks_free";
+	int result            = 1;
+
+	if( indexed_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indexed chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( *indexed_chunks != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *indexed_chunks )->chunk_descriptors_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk descriptors array.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *indexed_chunks )->record_entries != NULL )
+		{
+			memory_free(
+			 ( *indexed_chunks )->record_entries );
+		}
+		if( ( *indexed_chunks )->record_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *indexed_chunks )->record_entry_indexes );
+		}
+		if( ( *indexed_chunks )->recovered_record_entries != NULL )
+		{
+			memory_free(
+			 ( *indexed_chunks )->recovered_record_entries );
+		}
+		if( ( *indexed_chunks )->recovered_record_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *indexed_chunks )->recovered_record_entry_indexes );
+		}
+		memory_free(
+		 *indexed_chunks );
+
+		*indexed_chunks = NULL;
+	}
+	return( result );
+}
+
+/* Reads the record entries of the index file data
+ * The record entries are sorted by chunk, the order of the record entries
+ * of the same chunk is retained
+ * Make sure the chunk descriptors array and number of chunks are set
+ * Returns 1 if successful, 0 if the record entries are invalid or -1 on error
+ */
+int libevtx_indexed_chunks_read_record_entries(
+     libevtx_indexed_chunks_t *indexed_chunks,
+     const uint8_t *data,
+     uint32_t number_of_entries,
+     uint8_t is_recovered,
+     libcerror_error_t **error )
+{
+	uint64_t *record_entries   = NULL;
+	int *record_entry_indexes  = NULL;
+	static char *function      = "libevtx_indexed_chunks_read_record_entries";
+	uint64_t element_data_size = 0;
+	uint64_t element_offset    = 0;
+	uint32_t entry_index       = 0;
+	int chunk_index            = 0;
+	int sorted_entry_index     = 0;
+
+	if( indexed_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indexed chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( is_recovered == 0 )
+	  &&  ( indexed_chunks->record_entry_indexes != NULL ) )
+	 || ( ( is_recovered != 0 )
+	  &&  ( indexed_chunks->recovered_record_entry_indexes != NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid indexed chunks - record entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries > (uint32_t) ( INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	record_entry_indexes = (int *) memory_allocate(
+	                                sizeof( int ) * ( indexed_chunks->number_of_chunks + 1 ) );
+
+	if( record_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     record_entry_indexes,
+	     0,
+	     sizeof( int ) * ( indexed_chunks->number_of_chunks + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		record_entries = (uint64_t *) memory_allocate(
+		                               sizeof( uint64_t ) * 2 * (size_t) number_of_entries );
+
+		if( record_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The number of record entries of every chunk is counted first
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ entry_index * sizeof( evtx_index_file_record_entry_t ) ] ) )->file_offset,
+		 element_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ entry_index * sizeof( evtx_index_file_record_entry_t ) ] ) )->element_data_size,
+		 element_data_size );
+
+		chunk_index = (int) ( element_data_size & 0x0000ffffUL );
+
+		if( ( element_offset > (uint64_t) INT64_MAX )
+		 || ( ( element_data_size & ~LIBEVTX_RECORD_ELEMENT_DATA_SIZE_MASK ) != 0 )
+		 || ( chunk_index >= indexed_chunks->number_of_chunks ) )
+		{
+			memory_free(
+			 record_entry_indexes );
+
+			if( record_entries != NULL )
+			{
+				memory_free(
+				 record_entries );
+			}
+			return( 0 );
+		}
+		record_entry_indexes[ chunk_index + 1 ] += 1;
+	}
+	for( chunk_index = 1;
+	     chunk_index <= indexed_chunks->number_of_chunks;
+	     chunk_index++ )
+	{
+		record_entry_indexes[ chunk_index ] += record_entry_indexes[ chunk_index - 1 ];
+	}
+	/* The record entry index of a chunk is used as the insert position
+	 * and afterwards contains the record entry index of the next chunk
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ entry_index * sizeof( evtx_index_file_record_entry_t ) ] ) )->file_offset,
+		 element_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ entry_index * sizeof( evtx_index_file_record_entry_t ) ] ) )->element_data_size,
+		 element_data_size );
+
+		chunk_index        = (int) ( element_data_size & 0x0000ffffUL );
+		sorted_entry_index = record_entry_indexes[ chunk_index ]++;
+
+		record_entries[ 2 * sorted_entry_index ]     = element_offset;
+		record_entries[ 2 * sorted_entry_index + 1 ] = element_data_size;
+	}
+	for( chunk_index = indexed_chunks->number_of_chunks;
+	     chunk_index > 0;
+	     chunk_index-- )
+	{
+		record_entry_indexes[ chunk_index ] = record_entry_indexes[ chunk_index - 1 ];
+	}
+	record_entry_indexes[ 0 ] = 0;
+
+	if( is_recovered == 0 )
+	{
+		indexed_chunks->record_entries       = record_entries;
+		indexed_chunks->record_entry_indexes = record_entry_indexes;
+	}
+	else
+	{
+		indexed_chunks->recovered_record_entries       = record_entries;
+		indexed_chunks->recovered_record_entry_indexes = record_entry_indexes;
+	}
+	return( 1 );
+
+on_error:
+	if( record_entries != NULL )
+	{
+		memory_free(
+		 record_entries );
+	}
+	if( record_entry_indexes != NULL )
+	{
+		memory_free(
+		 record_entry_indexes );
+	}
+	return( -1 );
+}
+
+/* Appends the record entries of a chunk to a records list
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_indexed_chunks_append_record_entries(
+     uint64_t *record_entries,
+     int first_entry_index,
+     int last_entry_index,
+     libfdata_list_t *records_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_indexed_chunks_append_record_entries";
+	int element_index     = 0;
+	int entry_index       = 0;
+
+	for( entry_index = first_entry_index;
+	     entry_index < last_entry_index;
+	     entry_index++ )
+	{
+		if( libfdata_list_append_element(
+		     records_list,
+		     &element_index,
+		     0,
+		     (off64_t) record_entries[ 2 * entry_index ],
+		     (size64_t) record_entries[ 2 * entry_index + 1 ],
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element to records list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Takes the chunk descriptor of an indexed chunk if the chunk did not change
+ * The chunk did not change if the stored checksums of the chunk header and
+ * of the event records of the chunk are the same and its records are classified
+ * the same, in which case the record entries of the chunk are appended to
+ * the records lists and the chunk descriptor is no longer managed by the indexed chunks
+ * Returns 1 if the chunk was taken, 0 if not or -1 on error
+ */
+int libevtx_indexed_chunks_take_chunk(
+     libevtx_indexed_chunks_t *indexed_chunks,
+     uint16_t chunk_index,
+     libevtx_chunk_descriptor_t *chunk_header_descriptor,
+     uint8_t records_are_allocated,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_descriptor_t *indexed_chunk_descriptor = NULL;
+	static char *function                                = "libevtx_indexed_chunks_take_chunk";
+	int number_of_record_entries                         = 0;
+
+	if( indexed_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indexed chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( indexed_chunks->record_entry_indexes == NULL )
+	 || ( indexed_chunks->recovered_record_entry_indexes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid indexed chunks - missing record entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_header_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk header descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records list.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records list.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( (int) chunk_index >= indexed_chunks->number_of_chunks )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     indexed_chunks->chunk_descriptors_array,
+	     (int) chunk_index,
+	     (intptr_t **) &indexed_chunk_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 " descriptor.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( ( indexed_chunk_descriptor == NULL )
+	 || ( ( indexed_chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_IS_CONSISTENT ) == 0 )
+	 || ( ( chunk_header_descriptor->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 ) )
+	{
+		return( 0 );
+	}
+	/* The stored header checksum covers the first and last record numbers and
+	 * the free space offset of the chunk and the stored event records checksum
+	 * covers the event records data
+	 */
+	if( ( indexed_chunk_descriptor->header_checksum != chunk_header_descriptor->header_checksum )
+	 || ( indexed_chunk_descriptor->event_records_checksum != chunk_header_descriptor->event_records_checksum ) )
+	{
+		return( 0 );
+	}
+	/* The records of a chunk are classified differently when the number of chunks
+	 * or the dirty flag in the file header changed
+	 */
+	if( ( ( records_are_allocated != 0 )
+	  &&  ( ( indexed_chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_RECORDS_ARE_ALLOCATED ) == 0 ) )
+	 || ( ( records_are_allocated == 0 )
+	  &&  ( ( indexed_chunk_descriptor->flags & LIBEVTX_CHUNK_DESCRIPTOR_FLAG_RECORDS_ARE_ALLOCATED ) != 0 ) ) )
+	{
+		return( 0 );
+	}
+	number_of_record_entries = indexed_chunks->record_entry_indexes[ chunk_index + 1 ]
+	                         - indexed_chunks->record_entry_indexes[ chunk_index ];
+
+	if( records_are_allocated == 0 )
+	{
+		if( number_of_record_entries != 0 )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		if( (uint32_t) number_of_record_entries != indexed_chunk_descriptor->number_of_indexed_records )
+		{
+			return( 0 );
+		}
+		/* The gaps in the record identifiers are determined from the record identifiers
+		 * range hence the record identifiers of the chunk must be contiguous
+		 */
+		if( ( number_of_record_entries > 0 )
+		 && ( ( indexed_chunk_descriptor->minimum_record_identifier > indexed_chunk_descriptor->maximum_record_identifier )
+		  ||  ( ( indexed_chunk_descriptor->maximum_record_identifier - indexed_chunk_descriptor->minimum_record_identifier ) != (uint64_t) ( number_of_record_entries - 1 ) ) ) )
+		{
+			return( 0 );
+		}
+	}
+	if( libevtx_indexed_chunks_append_record_entries(
+	     indexed_chunks->record_entries,
+	     indexed_chunks->record_entry_indexes[ chunk_index ],
+	     indexed_chunks->record_entry_indexes[ chunk_index + 1 ],
+	     records_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append chunk: %" PRIu16 " record entries.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libevtx_indexed_chunks_append_record_entries(
+	     indexed_chunks->recovered_record_entries,
+	     indexed_chunks->recovered_record_entry_indexes[ chunk_index ],
+	     indexed_chunks->recovered_record_entry_indexes[ chunk_index + 1 ],
+	     recovered_records_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append chunk: %" PRIu16 " recovered record entries.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	/* The chunk descriptor is managed by the caller
+	 */
+	if( libcdata_array_set_entry_by_index(
+	     indexed_chunks->chunk_descriptors_array,
+	     (int) chunk_index,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk: %" PRIu16 " descriptor.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	indexed_chunks->number_of_taken_chunks += 1;
+
+	*chunk_descriptor = indexed_chunk_descriptor;
+
+	return( 1 );
+}
+
@@ -0,0 +1,112 @@
+/*
+ * Indexed chunks functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INDEXED_CHUNKS_H )
+#define _LIBEVTX_INDEXED_CHUNKS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_indexed_chunks libevtx_indexed_chunks_t;
+
+struct libevtx_indexed_chunks
+{
+	/* The chunk descriptors of the indexed chunks
+	 * Contains NULL for a chunk that was not indexed or that was taken
+	 */
+	libcdata_array_t *chunk_descriptors_array;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The record entries sorted by chunk
+	 * Contains the file offset and element data size of every record
+	 */
+	uint64_t *record_entries;
+
+	/* The index of the first record entry of every chunk
+	 * Contains number of chunks + 1 values
+	 */
+	int *record_entry_indexes;
+
+	/* The recovered record entries sorted by chunk
+	 * Contains the file offset and element data size of every recovered record
+	 */
+	uint64_t *recovered_record_entries;
+
+	/* The index of the first recovered record entry of every chunk
+	 * Contains number of chunks + 1 values
+	 */
+	int *recovered_record_entry_indexes;
+
+	/* The number of chunks that were taken
+	 */
+	int number_of_taken_chunks;
+};
+
+int libevtx_indexed_chunks_initialize(
+     libevtx_indexed_chunks_t **indexed_chunks,
+     libcerror_error_t **error );
+
+int libevtx_indexed_chunks_free(
+     libevtx_indexed_chunks_t **indexed_chunks,
+     libcerror_error_t **error );
+
+int libevtx_indexed_chunks_read_record_entries(
+     libevtx_indexed_chunks_t *indexed_chunks,
+     const uint8_t *data,
+     uint32_t number_of_entries,
+     uint8_t is_recovered,
+     libcerror_error_t **error );
+
+int libevtx_indexed_chunks_append_record_entries(
+     uint64_t *record_entries,
+     int first_entry_index,
+     int last_entry_index,
+     libfdata_list_t *records_list,
+     libcerror_error_t **error );
+
+int libevtx_indexed_chunks_take_chunk(
+     libevtx_indexed_chunks_t *indexed_chunks,
+     uint16_t chunk_index,
+     libevtx_chunk_descriptor_t *chunk_header_descriptor,
+     uint8_t records_are_allocated,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libevtx_chunk_descriptor_t **chunk_descriptor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INDEXED_CHUNKS_H ) */
+
@@ -24,21 +24,57 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libevtx_arena_pool.h"
+#include "libevtx_buffer_pool.h"
 #include "libevtx_checksum.h"
 #include "libevtx_chunk.h"
 #include "libevtx_codepage.h"
+#include "libevtx_codepage_table.h"
 #include "libevtx_debug.h"
+#include "libevtx_decode_profile.h"
+#include "libevtx_decoded_values_file.h"
 #include "libevtx_definitions.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_string_table.h"
+#include "libevtx_template_cache.h"
 #include "libevtx_unused.h"
 
 #include "evtx_file_header.h"
 
+#if defined( HAVE_PREAD ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#define HAVE_LIBEVTX_POSITIONAL_READ
+#endif
+
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#define HAVE_LIBEVTX_SPARSE_FILE_SUPPORT
+#endif
+
 const uint8_t *evtx_file_signature = (uint8_t *) "ElfFile";
 
 /* Creates an IO handle
@@ -101,14 +137,107 @@ int libevtx_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *io_handle )->chunk_size     = 0x00010000UL;
-	( *io_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
+	( *io_handle )->chunk_size         = 0x00010000UL;
+	( *io_handle )->file_descriptor    = -1;
+	( *io_handle )->sparse_tail_offset = -1;
+
+	if( libevtx_io_handle_set_ascii_codepage(
+	     *io_handle,
+	     LIBEVTX_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage.",
+		 function );
+
+		goto on_error;
+	}
+
+	if( libevtx_buffer_pool_initialize(
+	     &( ( *io_handle )->chunk_buffer_pool ),
+	     (size_t) ( *io_handle )->chunk_size,
+	     LIBEVTX_DEFAULT_NUMBER_OF_POOLED_CHUNK_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_arena_pool_initialize(
+	     &( ( *io_handle )->records_arena_pool ),
+	     LIBEVTX_RECORD_VALUES_ARENA_BLOCK_SIZE,
+	     LIBEVTX_DEFAULT_NUMBER_OF_POOLED_RECORDS_ARENAS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records arena pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_template_cache_initialize(
+	     &( ( *io_handle )->template_cache ),
+	     LIBEVTX_DEFAULT_NUMBER_OF_CACHED_TEMPLATES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_handle )->read_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read mutex.",
+		 function );
 
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->template_cache != NULL )
+		{
+			libevtx_template_cache_free(
+			 &( ( *io_handle )->template_cache ),
+			 NULL );
+		}
+		if( ( *io_handle )->records_arena_pool != NULL )
+		{
+			libevtx_arena_pool_free(
+			 &( ( *io_handle )->records_arena_pool ),
+			 NULL );
+		}
+		if( ( *io_handle )->chunk_buffer_pool != NULL )
+		{
+			libevtx_buffer_pool_free(
+			 &( ( *io_handle )->chunk_buffer_pool ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -140,6 +269,138 @@ int libevtx_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->chunk_buffer_pool != NULL )
+		{
+			if( libevtx_buffer_pool_free(
+			     &( ( *io_handle )->chunk_buffer_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk buffer pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->records_arena_pool != NULL )
+		{
+			if( libevtx_arena_pool_free(
+			     &( ( *io_handle )->records_arena_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free records arena pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->template_cache != NULL )
+		{
+			if( libevtx_template_cache_free(
+			     &( ( *io_handle )->template_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free template cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->decoded_values_file != NULL )
+		{
+			if( libevtx_decoded_values_file_free(
+			     &( ( *io_handle )->decoded_values_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoded values file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->live_chunk_record_identifiers != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->live_chunk_record_identifiers );
+		}
+		if( ( *io_handle )->string_table != NULL )
+		{
+			if( libevtx_string_table_free(
+			     &( ( *io_handle )->string_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free string table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->decode_profile != NULL )
+		{
+			if( libevtx_decode_profile_free(
+			     &( ( *io_handle )->decode_profile ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decode profile.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libevtx_io_handle_close_file_descriptor(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *io_handle )->read_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *io_handle )->read_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -155,7 +416,16 @@ int libevtx_io_handle_clear(
      libevtx_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_io_handle_clear";
+	libevtx_arena_pool_t *records_arena_pool = NULL;
+	libevtx_buffer_pool_t *chunk_buffer_pool = NULL;
+	libevtx_decode_profile_t *decode_profile = NULL;
+	libevtx_string_table_t *string_table     = NULL;
+	libevtx_template_cache_t *template_cache = NULL;
+	static char *function                    = "libevtx_io_handle_clear";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_t *read_mutex          = NULL;
+#endif
 
 	if( io_handle == NULL )
 	{
@@ -168,6 +438,54 @@ int libevtx_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The chunk buffer pool is retained so its buffers can be reused
+	 */
+	chunk_buffer_pool = io_handle->chunk_buffer_pool;
+
+	/* The records arena pool is retained so its arenas can be reused
+	 */
+	records_arena_pool = io_handle->records_arena_pool;
+
+	/* The string table is retained so string interning remains enabled,
+	 * the string identifiers are only valid while the file is open
+	 */
+	string_table = io_handle->string_table;
+
+	/* The template cache is retained since its templates are identified by their content
+	 */
+	template_cache = io_handle->template_cache;
+
+	/* The decode profile is retained so the decode costs can be retrieved
+	 * after the file is closed
+	 */
+	decode_profile = io_handle->decode_profile;
+
+	if( string_table != NULL )
+	{
+		if( libevtx_string_table_empty(
+		     string_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty string table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	if( io_handle->live_chunk_record_identifiers != NULL )
+	{
+		memory_free(
+		 io_handle->live_chunk_record_identifiers );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	read_mutex = io_handle->read_mutex;
+#endif
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -182,8 +500,160 @@ int libevtx_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->chunk_size     = 0x00010000UL;
-	io_handle->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
+	io_handle->chunk_size         = 0x00010000UL;
+	io_handle->chunk_buffer_pool  = chunk_buffer_pool;
+	io_handle->decode_profile     = decode_profile;
+	io_handle->file_descriptor    = -1;
+	io_handle->records_arena_pool = records_arena_pool;
+	io_handle->sparse_tail_offset = -1;
+	io_handle->string_table       = string_table;
+	io_handle->template_cache     = template_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	io_handle->read_mutex = read_mutex;
+#endif
+	if( libevtx_io_handle_set_ascii_codepage(
+	     io_handle,
+	     LIBEVTX_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the ASCII codepage
+ * The codepage table is determined once when the codepage is set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_set_ascii_codepage(
+     libevtx_io_handle_t *io_handle,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_set_ascii_codepage";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_codepage_table_set_codepage(
+	     &( io_handle->ascii_codepage_table ),
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set codepage table.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Resets the live chunk record identifiers
+ * The live chunk record identifiers are sized to the number of chunks in the chunks data
+ * and are cleared so that the chunks are considered not read yet
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_reset_live_chunk_record_identifiers(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	uint64_t *reallocation            = NULL;
+	static char *function             = "libevtx_io_handle_reset_live_chunk_record_identifiers";
+	size64_t maximum_number_of_chunks = 0;
+	size_t identifiers_size           = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_chunks = io_handle->chunks_data_size / io_handle->chunk_size;
+
+	if( maximum_number_of_chunks > ( (size64_t) UINT16_MAX + 1 ) )
+	{
+		maximum_number_of_chunks = (size64_t) UINT16_MAX + 1;
+	}
+	if( maximum_number_of_chunks == 0 )
+	{
+		io_handle->number_of_live_chunks = 0;
+
+		return( 1 );
+	}
+	identifiers_size = sizeof( uint64_t ) * 2 * (size_t) maximum_number_of_chunks;
+
+	if( (int) maximum_number_of_chunks > io_handle->number_of_live_chunks )
+	{
+		reallocation = (uint64_t *) memory_reallocate(
+		                             io_handle->live_chunk_record_identifiers,
+		                             identifiers_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize live chunk record identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->live_chunk_record_identifiers = reallocation;
+	}
+	if( memory_set(
+	     io_handle->live_chunk_record_identifiers,
+	     0,
+	     identifiers_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear live chunk record identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->number_of_live_chunks = (int) maximum_number_of_chunks;
 
 	return( 1 );
 }
@@ -207,7 +677,6 @@ int libevtx_io_handle_read_file_header(
 	uint16_t last_chunk_number   = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit         = 0;
 	uint32_t value_32bit         = 0;
 #endif
 
@@ -279,6 +748,10 @@ int libevtx_io_handle_read_file_header(
 
 		goto on_error;
 	}
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_bytes_read,
+	 (uint64_t) read_count );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -313,6 +786,10 @@ int libevtx_io_handle_read_file_header(
 	 ( (evtx_file_header_t *) file_header_data )->last_chunk_number,
 	 last_chunk_number );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_file_header_t *) file_header_data )->next_record_identifier,
+	 io_handle->next_record_identifier );
+
 	byte_stream_copy_to_uint16_little_endian(
 	 ( (evtx_file_header_t *) file_header_data )->minor_version,
 	 io_handle->minor_version );
@@ -362,13 +839,10 @@ int libevtx_io_handle_read_file_header(
 		 function,
 		 last_chunk_number );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (evtx_file_header_t *) file_header_data )->next_record_identifier,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: next record identifier\t\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 io_handle->next_record_identifier );
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (evtx_file_header_t *) file_header_data )->header_size,
@@ -440,6 +914,8 @@ int libevtx_io_handle_read_file_header(
 
 		goto on_error;
 	}
+	io_handle->file_header_checksum = calculated_checksum;
+
 	if( stored_checksum != calculated_checksum )
 	{
 #if defined( HAVE_VERBOSE_OUTPUT )
@@ -452,7 +928,8 @@ int libevtx_io_handle_read_file_header(
 			 calculated_checksum );
 		}
 #endif
-		io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+		io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED
+		                  | LIBEVTX_IO_HANDLE_FLAG_FILE_HEADER_CHECKSUM_MISMATCH;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -494,6 +971,9 @@ int libevtx_io_handle_read_file_header(
 #endif
 		io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
 	}
+	io_handle->first_chunk_number = first_chunk_number;
+	io_handle->last_chunk_number  = last_chunk_number;
+
 	memory_free(
 	 file_header_data );
 
@@ -510,6 +990,540 @@ on_error:
 	return( -1 );
 }
 
+/* Opens a native file descriptor used for positional reads
+ * Positional reads do not depend on the offset of the file IO handle,
+ * hence they do not require a seek or serialization
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_io_handle_open_file_descriptor(
+     libevtx_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_open_file_descriptor";
+
+#if defined( HAVE_LIBEVTX_POSITIONAL_READ ) && defined( HAVE_SYS_STAT_H )
+	struct stat file_statistics;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_POSITIONAL_READ )
+	io_handle->file_descriptor = open(
+	                              filename,
+	                              O_RDONLY );
+
+	if( io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_SYS_STAT_H )
+	if( fstat(
+	     io_handle->file_descriptor,
+	     &file_statistics ) == 0 )
+	{
+		io_handle->modification_time = (int64_t) file_statistics.st_mtime;
+
+		if( ( S_ISREG( file_statistics.st_mode ) != 0 )
+		 && ( file_statistics.st_size > 0 ) )
+		{
+			if( libevtx_io_handle_determine_sparse_tail_offset(
+			     io_handle,
+			     io_handle->file_descriptor,
+			     (size64_t) file_statistics.st_size,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine sparse tail offset.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+#endif
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Closes the native file descriptor used for positional reads
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_close_file_descriptor(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_close_file_descriptor";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_POSITIONAL_READ )
+	if( io_handle->file_descriptor != -1 )
+	{
+		if( close(
+		     io_handle->file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	io_handle->file_descriptor = -1;
+
+	return( result );
+}
+
+/* Determines the offset of the unallocated (hole) tail of a sparse file
+ * Pre-allocated event log files can contain a large 0-byte filled tail
+ * that does not need to be read
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_io_handle_determine_sparse_tail_offset(
+     libevtx_io_handle_t *io_handle,
+     int file_descriptor,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libevtx_io_handle_determine_sparse_tail_offset";
+
+#if defined( HAVE_LIBEVTX_SPARSE_FILE_SUPPORT )
+	off64_t data_offset       = 0;
+	off64_t hole_offset       = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->sparse_tail_offset = -1;
+
+#if defined( HAVE_LIBEVTX_SPARSE_FILE_SUPPORT )
+	/* Walk the data extents of the file, the end of the file is
+	 * considered an implicit hole by SEEK_HOLE
+	 */
+	while( (size64_t) hole_offset < file_size )
+	{
+		data_offset = (off64_t) lseek(
+		                         file_descriptor,
+		                         (off_t) hole_offset,
+		                         SEEK_DATA );
+
+		if( data_offset == -1 )
+		{
+			/* ENXIO indicates there is no data beyond the offset,
+			 * other errors indicate sparse files are not supported
+			 */
+			if( errno == ENXIO )
+			{
+				io_handle->sparse_tail_offset = hole_offset;
+			}
+			break;
+		}
+		hole_offset = (off64_t) lseek(
+		                         file_descriptor,
+		                         (off_t) data_offset,
+		                         SEEK_HOLE );
+
+		if( hole_offset == -1 )
+		{
+			break;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( libcnotify_verbose != 0 )
+	 && ( io_handle->sparse_tail_offset != -1 ) )
+	{
+		libcnotify_printf(
+		 "%s: sparse tail offset\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 io_handle->sparse_tail_offset,
+		 io_handle->sparse_tail_offset );
+	}
+#endif
+	if( io_handle->sparse_tail_offset == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Advises the operating system that the file data is going to be read sequentially
+ * so it can read-ahead more aggressively and drop pages once read
+ * The advice is a hint, if not supported it is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_advise_sequential_access(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_advise_sequential_access";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MADVISE ) && defined( HAVE_SYS_MMAN_H ) && defined( MADV_SEQUENTIAL ) && !defined( WINAPI )
+	if( io_handle->mapped_data != NULL )
+	{
+		/* Data that is not page aligned, such as data provided by the caller,
+		 * is rejected by madvise which is not considered an error
+		 */
+		madvise(
+		 (void *) io_handle->mapped_data,
+		 (size_t) io_handle->mapped_data_size,
+		 MADV_SEQUENTIAL );
+	}
+#endif
+#if defined( HAVE_POSIX_FADVISE ) && defined( HAVE_LIBEVTX_POSITIONAL_READ ) && defined( POSIX_FADV_SEQUENTIAL )
+	if( io_handle->file_descriptor != -1 )
+	{
+		posix_fadvise(
+		 io_handle->file_descriptor,
+		 0,
+		 0,
+		 POSIX_FADV_SEQUENTIAL );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the cached data of a range of the file
+ * This advises the operating system that the data will not be read again,
+ * which prevents large scans from filling the page cache
+ * The advice is a hint, if not supported it is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_release_cached_data(
+     libevtx_io_handle_t *io_handle,
+     off64_t file_offset,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_release_cached_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_FADVISE ) && defined( HAVE_LIBEVTX_POSITIONAL_READ ) && defined( POSIX_FADV_DONTNEED )
+	/* The page cache is shared by all descriptors of the file, hence this
+	 * also releases the data read by the file IO handle or its clones
+	 */
+	if( ( io_handle->file_descriptor != -1 )
+	 && ( data_size > 0 ) )
+	{
+		posix_fadvise(
+		 io_handle->file_descriptor,
+		 (off_t) file_offset,
+		 (off_t) data_size,
+		 POSIX_FADV_DONTNEED );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads data at a specific offset
+ * The data is copied from the memory mapped file data or read with a single
+ * positional read if available, otherwise the seek and read are done as one
+ * operation so that concurrent reads on the same file IO handle do not interfere
+ * with each other's offset
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_read_data_at_offset(
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_read_data_at_offset";
+	ssize_t read_count    = 0;
+	int result            = 1;
+
+#if defined( HAVE_LIBEVTX_POSITIONAL_READ )
+	size_t data_offset    = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->mapped_data != NULL )
+	 && ( file_offset >= 0 )
+	 && ( (size64_t) file_offset <= io_handle->mapped_data_size )
+	 && ( (size64_t) data_size <= ( io_handle->mapped_data_size - (size64_t) file_offset ) ) )
+	{
+		if( memory_copy(
+		     data,
+		     &( io_handle->mapped_data[ file_offset ] ),
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#if defined( HAVE_LIBEVTX_POSITIONAL_READ )
+	if( io_handle->file_descriptor != -1 )
+	{
+		while( data_offset < data_size )
+		{
+			read_count = pread(
+			              io_handle->file_descriptor,
+			              &( data[ data_offset ] ),
+			              data_size - data_offset,
+			              (off_t) ( file_offset + data_offset ) );
+
+#if defined( EINTR )
+			if( ( read_count == -1 )
+			 && ( errno == EINTR ) )
+			{
+				continue;
+			}
+#endif
+			if( read_count <= 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 ".",
+				 function,
+				 file_offset + data_offset );
+
+				return( -1 );
+			}
+			data_offset += (size_t) read_count;
+		}
+		LIBEVTX_COUNTER_ADD(
+		 io_handle->statistics.number_of_bytes_read,
+		 (uint64_t) data_size );
+
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		result = -1;
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              data,
+		              data_size,
+		              error );
+
+		if( read_count != (ssize_t) data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			result = -1;
+		}
+		else
+		{
+			LIBEVTX_COUNTER_ADD(
+			 io_handle->statistics.number_of_bytes_read,
+			 (uint64_t) read_count );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Reads a chunk
  * Callback function for the chunk vector
  * Returns 1 if successful or -1 on error
@@ -535,6 +1549,23 @@ int libevtx_io_handle_read_chunk(
 	LIBEVTX_UNREFERENCED_PARAMETER( element_data_flags );
 	LIBEVTX_UNREFERENCED_PARAMETER( read_flags );
 
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* This function is only called by the chunks vector if the chunk is not cached
+	 */
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_chunk_cache_misses,
+	 1 );
+
 	if( libevtx_chunk_initialize(
 	     &chunk,
 	     error ) != 1 )
@@ -25,10 +25,24 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_arena_pool.h"
+#include "libevtx_async_reader.h"
+#include "libevtx_buffer_pool.h"
+#include "libevtx_chunk_prefetcher.h"
+#include "libevtx_codepage_table.h"
+#include "libevtx_decode_budget.h"
+#include "libevtx_decode_profile.h"
+#include "libevtx_decoded_values_file.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_memory_usage.h"
+#include "libevtx_read_buffer.h"
+#include "libevtx_statistics.h"
+#include "libevtx_string_table.h"
+#include "libevtx_template_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -52,6 +66,18 @@ struct libevtx_io_handle
 	 */
 	uint16_t number_of_chunks;
 
+	/* The first (oldest) chunk number
+	 */
+	uint16_t first_chunk_number;
+
+	/* The last (newest) chunk number
+	 */
+	uint16_t last_chunk_number;
+
+	/* The next record identifier as indicated by the file header
+	 */
+	uint64_t next_record_identifier;
+
 	/* The chunks data offset
 	 */
 	off64_t chunks_data_offset;
@@ -64,13 +90,22 @@ struct libevtx_io_handle
 	 */
 	uint32_t file_flags;
 
+	/* The calculated file header checksum
+	 */
+	uint32_t file_header_checksum;
+
+	/* The modification time of the file as a POSIX timestamp
+	 * Contains 0 if not available
+	 */
+	int64_t modification_time;
+
 	/* The chunk size
 	 */
 	uint32_t chunk_size;
 
 	/* Various flags
 	 */
-	uint8_t flags;
+	uint16_t flags;
 
 	/* The first record identifier
 	 */
@@ -84,9 +119,123 @@ struct libevtx_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The codepage table of the ASCII codepage
+	 */
+	libevtx_codepage_table_t ascii_codepage_table;
+
+	/* The checksum validation mode
+	 */
+	int validation_mode;
+
+	/* The record decode depth
+	 */
+	int decode_depth;
+
+	/* The decode budget of a single record
+	 */
+	libevtx_decode_budget_t decode_budget;
+
+	/* The record iteration order
+	 */
+	int iterate_order;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The chunk buffer pool
+	 */
+	libevtx_buffer_pool_t *chunk_buffer_pool;
+
+	/* The arena pool of the record values of the chunks
+	 */
+	libevtx_arena_pool_t *records_arena_pool;
+
+	/* The memory mapped file data
+	 * Chunks inside the mapping reference this data instead of a copy
+	 */
+	uint8_t *mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The native file descriptor used for positional reads
+	 * Contains -1 if not available
+	 */
+	int file_descriptor;
+
+	/* The offset of the unallocated (hole) tail of a sparse file
+	 * The data from this offset onwards is 0-byte filled and is not read
+	 * Contains -1 if not available
+	 */
+	off64_t sparse_tail_offset;
+
+	/* The chunk prefetcher
+	 * Contains NULL if chunks are not read ahead
+	 */
+	libevtx_chunk_prefetcher_t *chunk_prefetcher;
+
+	/* The read buffer that coalesces the reads of sequential chunks
+	 * Contains NULL if chunks are read individually
+	 */
+	libevtx_read_buffer_t *read_buffer;
+
+	/* The asynchronous chunk reader
+	 * Contains NULL if chunks are read synchronously
+	 */
+	libevtx_async_reader_t *async_reader;
+
+	/* The template cache of the file
+	 * Retains the System values template skeletons across chunks and is retained when the file is closed
+	 */
+	libevtx_template_cache_t *template_cache;
+
+	/* The template cache of the shared chunk cache
+	 * Contains NULL if the file is not attached to a shared chunk cache
+	 */
+	libevtx_template_cache_t *shared_template_cache;
+
+	/* The decoded values file
+	 * Contains the System values of the records that were decoded by a previous open
+	 * Contains NULL if no decoded values file is used
+	 */
+	libevtx_decoded_values_file_t *decoded_values_file;
+
+	/* The first and last record identifiers of the chunks when first read consistently
+	 * Contains 2 values per chunk, which are 0 if the chunk was not read yet
+	 * Contains NULL if the file is not opened in live mode
+	 */
+	uint64_t *live_chunk_record_identifiers;
+
+	/* The number of chunks in the live chunk record identifiers
+	 */
+	int number_of_live_chunks;
+
+	/* The statistics
+	 */
+	libevtx_statistics_t statistics;
+
+	/* The memory usage of the chunks and records
+	 */
+	libevtx_memory_usage_t memory_usage;
+
+	/* The string table that interns the System string values
+	 * Contains NULL if strings are not interned
+	 */
+	libevtx_string_table_t *string_table;
+
+	/* The decode profile that attributes the decode costs of the records
+	 * Contains NULL if the decode costs are not profiled
+	 */
+	libevtx_decode_profile_t *decode_profile;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes the seek and read of file IO handles
+	 * since the file IO handle of the file is shared with the records
+	 */
+	libcthreads_mutex_t *read_mutex;
+#endif
 };
 
 int libevtx_io_handle_initialize(
@@ -101,12 +250,54 @@ int libevtx_io_handle_clear(
      libevtx_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libevtx_io_handle_set_ascii_codepage(
+     libevtx_io_handle_t *io_handle,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libevtx_io_handle_reset_live_chunk_record_identifiers(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libevtx_io_handle_read_file_header(
      libevtx_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libevtx_io_handle_open_file_descriptor(
+     libevtx_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libevtx_io_handle_close_file_descriptor(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_io_handle_determine_sparse_tail_offset(
+     libevtx_io_handle_t *io_handle,
+     int file_descriptor,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_io_handle_advise_sequential_access(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_io_handle_release_cached_data(
+     libevtx_io_handle_t *io_handle,
+     off64_t file_offset,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_io_handle_read_data_at_offset(
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libevtx_io_handle_read_chunk(
      libevtx_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
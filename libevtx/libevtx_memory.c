@@ -0,0 +1,151 @@
+/*
+ * Memory allocator functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/* The default allocator uses the memory functions of the platform
+ * hence the allocator hooks in memory.h are not used by this file
+ */
+#if defined( HAVE_LIBEVTX_ALLOCATOR )
+#undef HAVE_LIBEVTX_ALLOCATOR
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_memory.h"
+
+/* The allocator, the functions are NULL when the default allocator is used
+ */
+static libevtx_memory_allocator_t libevtx_memory_allocator = {
+	NULL,
+	NULL,
+	NULL,
+	NULL };
+
+/* Sets the allocator used for the memory of the library
+ * Either all the functions are set or none, in which case the default allocator is used
+ * This function should be called before any other function of the library
+ * and is not thread-safe
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_set_allocator(
+     void *(*allocate_function)(
+            void *context,
+            size_t size ),
+     void *(*reallocate_function)(
+            void *context,
+            void *buffer,
+            size_t size ),
+     void (*free_function)(
+            void *context,
+            void *buffer ),
+     void *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_set_allocator";
+
+	if( ( allocate_function == NULL )
+	 && ( reallocate_function == NULL )
+	 && ( free_function == NULL ) )
+	{
+		libevtx_memory_allocator.allocate_function   = NULL;
+		libevtx_memory_allocator.reallocate_function = NULL;
+		libevtx_memory_allocator.free_function       = NULL;
+		libevtx_memory_allocator.context             = NULL;
+
+		return( 1 );
+	}
+	if( ( allocate_function == NULL )
+	 || ( reallocate_function == NULL )
+	 || ( free_function == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator functions, either all or none must be set.",
+		 function );
+
+		return( -1 );
+	}
+	libevtx_memory_allocator.allocate_function   = allocate_function;
+	libevtx_memory_allocator.reallocate_function = reallocate_function;
+	libevtx_memory_allocator.free_function       = free_function;
+	libevtx_memory_allocator.context             = context;
+
+	return( 1 );
+}
+
+/* Allocates memory using the allocator
+ * Returns a pointer to the memory or NULL on error
+ */
+void *libevtx_memory_allocate(
+       size_t size )
+{
+	if( libevtx_memory_allocator.allocate_function != NULL )
+	{
+		return( libevtx_memory_allocator.allocate_function(
+		         libevtx_memory_allocator.context,
+		         size ) );
+	}
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates memory using the allocator
+ * Returns a pointer to the memory or NULL on error
+ */
+void *libevtx_memory_reallocate(
+       void *buffer,
+       size_t size )
+{
+	if( libevtx_memory_allocator.reallocate_function != NULL )
+	{
+		return( libevtx_memory_allocator.reallocate_function(
+		         libevtx_memory_allocator.context,
+		         buffer,
+		         size ) );
+	}
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory using the allocator
+ */
+void libevtx_memory_free(
+      void *buffer )
+{
+	if( libevtx_memory_allocator.free_function != NULL )
+	{
+		libevtx_memory_allocator.free_function(
+		 libevtx_memory_allocator.context,
+		 buffer );
+	}
+	else
+	{
+		memory_free(
+		 buffer );
+	}
+}
+
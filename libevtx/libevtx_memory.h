@@ -0,0 +1,94 @@
+/*
+ * Memory allocator functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBEVTX_MEMORY_H )
+#define _LIBEVTX_MEMORY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_extern.h"
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_memory_allocator libevtx_memory_allocator_t;
+
+struct libevtx_memory_allocator
+{
+	/* The allocate function
+	 */
+	void *(*allocate_function)(
+	        void *context,
+	        size_t size );
+
+	/* The reallocate function
+	 */
+	void *(*reallocate_function)(
+	        void *context,
+	        void *buffer,
+	        size_t size );
+
+	/* The free function
+	 */
+	void (*free_function)(
+	       void *context,
+	       void *buffer );
+
+	/* The context passed to the functions
+	 */
+	void *context;
+};
+
+LIBEVTX_EXTERN \
+int libevtx_set_allocator(
+     void *(*allocate_function)(
+            void *context,
+            size_t size ),
+     void *(*reallocate_function)(
+            void *context,
+            void *buffer,
+            size_t size ),
+     void (*free_function)(
+            void *context,
+            void *buffer ),
+     void *context,
+     libcerror_error_t **error );
+
+void *libevtx_memory_allocate(
+       size_t size );
+
+void *libevtx_memory_reallocate(
+       void *buffer,
+       size_t size );
+
+void libevtx_memory_free(
+      void *buffer );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_MEMORY_H ) */
+
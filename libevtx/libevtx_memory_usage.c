@@ -0,0 +1,240 @@
+/*
+ * Memory usage functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_memory_usage.h"
+#include "libevtx_statistics.h"
+
+/* Clears the memory usage
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_memory_usage_clear(
+     libevtx_memory_usage_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_memory_usage_clear";
+	int type              = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sizes are cleared one by one since they can be updated
+	 * by other threads while the memory usage is cleared
+	 */
+	for( type = 0;
+	     type < LIBEVTX_MEMORY_USAGE_NUMBER_OF_TYPES;
+	     type++ )
+	{
+		LIBEVTX_COUNTER_SET(
+		 memory_usage->sizes[ type ],
+		 0 );
+	}
+	LIBEVTX_COUNTER_SET(
+	 memory_usage->total_size,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 memory_usage->peak_size,
+	 0 );
+
+	return( 1 );
+}
+
+/* Adds a number of bytes in use of a specific type
+ * A memory usage of NULL represents the memory is not accounted
+ */
+void libevtx_memory_usage_add(
+      libevtx_memory_usage_t *memory_usage,
+      int type,
+      size_t size )
+{
+	uint64_t peak_size  = 0;
+	uint64_t total_size = 0;
+
+	if( ( memory_usage == NULL )
+	 || ( type < 0 )
+	 || ( type >= LIBEVTX_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		return;
+	}
+	LIBEVTX_COUNTER_ADD(
+	 memory_usage->sizes[ type ],
+	 size );
+
+	total_size = LIBEVTX_COUNTER_ADD(
+	              memory_usage->total_size,
+	              size );
+
+	peak_size = LIBEVTX_COUNTER_GET(
+	             memory_usage->peak_size );
+
+	while( total_size > peak_size )
+	{
+		if( LIBEVTX_COUNTER_COMPARE_AND_SWAP(
+		     memory_usage->peak_size,
+		     peak_size,
+		     total_size ) )
+		{
+			break;
+		}
+		peak_size = LIBEVTX_COUNTER_GET(
+		             memory_usage->peak_size );
+	}
+}
+
+/* Subtracts a number of bytes from a size without the size becoming negative
+ */
+void libevtx_memory_usage_subtract_size(
+      uint64_t *size,
+      size_t value )
+{
+	uint64_t current_size = 0;
+	uint64_t new_size     = 0;
+
+	do
+	{
+		current_size = LIBEVTX_COUNTER_GET(
+		                *size );
+
+		if( current_size > (uint64_t) value )
+		{
+			new_size = current_size - (uint64_t) value;
+		}
+		else
+		{
+			new_size = 0;
+		}
+	}
+	while( !LIBEVTX_COUNTER_COMPARE_AND_SWAP(
+	         *size,
+	         current_size,
+	         new_size ) );
+}
+
+/* Removes a number of bytes in use of a specific type
+ * A memory usage of NULL represents the memory is not accounted
+ */
+void libevtx_memory_usage_remove(
+      libevtx_memory_usage_t *memory_usage,
+      int type,
+      size_t size )
+{
+	if( ( memory_usage == NULL )
+	 || ( type < 0 )
+	 || ( type >= LIBEVTX_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		return;
+	}
+	/* The sizes are cleared when the file is closed, before its chunks
+	 * and records are freed, hence the sizes cannot become negative
+	 */
+	libevtx_memory_usage_subtract_size(
+	 &( memory_usage->sizes[ type ] ),
+	 size );
+
+	libevtx_memory_usage_subtract_size(
+	 &( memory_usage->total_size ),
+	 size );
+}
+
+/* Retrieves the memory usage values
+ * The values are stored in the order of the LIBEVTX_MEMORY_USAGE definitions
+ * If the number of values is smaller than LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES
+ * only the first number of values are stored
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_memory_usage_get_values(
+     libevtx_memory_usage_t *memory_usage,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint64_t safe_values[ LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES ];
+
+	static char *function = "libevtx_memory_usage_get_values";
+	int value_index       = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	safe_values[ LIBEVTX_MEMORY_USAGE_CHUNK_DATA ]    = LIBEVTX_COUNTER_GET( memory_usage->sizes[ LIBEVTX_MEMORY_USAGE_CHUNK_DATA ] );
+	safe_values[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ] = LIBEVTX_COUNTER_GET( memory_usage->sizes[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ] );
+	safe_values[ LIBEVTX_MEMORY_USAGE_RECORD_VALUES ] = LIBEVTX_COUNTER_GET( memory_usage->sizes[ LIBEVTX_MEMORY_USAGE_RECORD_VALUES ] );
+	safe_values[ LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS ] = LIBEVTX_COUNTER_GET( memory_usage->sizes[ LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS ] );
+	safe_values[ LIBEVTX_MEMORY_USAGE_TOTAL ]         = LIBEVTX_COUNTER_GET( memory_usage->total_size );
+	safe_values[ LIBEVTX_MEMORY_USAGE_PEAK ]          = LIBEVTX_COUNTER_GET( memory_usage->peak_size );
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( value_index >= LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES )
+		{
+			break;
+		}
+		values[ value_index ] = safe_values[ value_index ];
+	}
+	return( 1 );
+}
+
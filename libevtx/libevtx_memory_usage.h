@@ -0,0 +1,86 @@
+/*
+ * Memory usage functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_MEMORY_USAGE_H )
+#define _LIBEVTX_MEMORY_USAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The memory usage types that are maintained
+ */
+#define LIBEVTX_MEMORY_USAGE_NUMBER_OF_TYPES		4
+
+typedef struct libevtx_memory_usage libevtx_memory_usage_t;
+
+/* The memory usage is updated with the counter macros
+ */
+struct libevtx_memory_usage
+{
+	/* The number of bytes in use per type
+	 */
+	uint64_t sizes[ LIBEVTX_MEMORY_USAGE_NUMBER_OF_TYPES ];
+
+	/* The total number of bytes in use
+	 */
+	uint64_t total_size;
+
+	/* The largest total number of bytes in use
+	 */
+	uint64_t peak_size;
+};
+
+int libevtx_memory_usage_clear(
+     libevtx_memory_usage_t *memory_usage,
+     libcerror_error_t **error );
+
+void libevtx_memory_usage_add(
+      libevtx_memory_usage_t *memory_usage,
+      int type,
+      size_t size );
+
+void libevtx_memory_usage_subtract_size(
+      uint64_t *size,
+      size_t value );
+
+void libevtx_memory_usage_remove(
+      libevtx_memory_usage_t *memory_usage,
+      int type,
+      size_t size );
+
+int libevtx_memory_usage_get_values(
+     libevtx_memory_usage_t *memory_usage,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_MEMORY_USAGE_H ) */
+
@@ -0,0 +1,1689 @@
+/*
+ * Message resolver functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_message_resolver.h"
+
+/* Creates a message resolver
+ * The callback resolves the message string of a provider, event identifier and language.
+ * On input the UTF-8 string size contains the size of the buffer, on output the size
+ * of the message string including the end of string character. When the buffer is too
+ * small the callback is called again with a buffer of the returned size
+ * The callback returns 1 if successful, 0 if no message is available or -1 on error
+ * Make sure the value message_resolver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_message_resolver_initialize(
+     libevtx_message_resolver_t **message_resolver,
+     int (*callback)(
+            const uint8_t *provider_identifier,
+            size_t provider_identifier_size,
+            const uint8_t *utf8_source_name,
+            size_t utf8_source_name_size,
+            uint32_t event_identifier,
+            uint32_t event_identifier_qualifiers,
+            uint32_t language_identifier,
+            uint8_t *utf8_string,
+            size_t *utf8_string_size,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevtx_internal_message_resolver_t *internal_message_resolver = NULL;
+	static char *function                                          = "libevtx_message_resolver_initialize";
+
+	if( message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_resolver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message resolver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	internal_message_resolver = memory_allocate_structure(
+	                             libevtx_internal_message_resolver_t );
+
+	if( internal_message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message resolver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_message_resolver,
+	     0,
+	     sizeof( libevtx_internal_message_resolver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message resolver.",
+		 function );
+
+		memory_free(
+		 internal_message_resolver );
+
+		return( -1 );
+	}
+	internal_message_resolver->buckets = (libevtx_compiled_message_t **) memory_allocate(
+	                                                                      sizeof( libevtx_compiled_message_t * ) * LIBEVTX_MESSAGE_RESOLVER_NUMBER_OF_BUCKETS );
+
+	if( internal_message_resolver->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_message_resolver->buckets,
+	     0,
+	     sizeof( libevtx_compiled_message_t * ) * LIBEVTX_MESSAGE_RESOLVER_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	internal_message_resolver->callback            = callback;
+	internal_message_resolver->user_data           = user_data;
+	internal_message_resolver->language_identifier = LIBEVTX_MESSAGE_RESOLVER_DEFAULT_LANGUAGE_IDENTIFIER;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_message_resolver->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*message_resolver = (libevtx_message_resolver_t *) internal_message_resolver;
+
+	return( 1 );
+
+on_error:
+	if( internal_message_resolver != NULL )
+	{
+		if( internal_message_resolver->buckets != NULL )
+		{
+			memory_free(
+			 internal_message_resolver->buckets );
+		}
+		memory_free(
+		 internal_message_resolver );
+	}
+	return( -1 );
+}
+
+/* Frees a message resolver
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_message_resolver_free(
+     libevtx_message_resolver_t **message_resolver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_message_resolver_t *internal_message_resolver = NULL;
+	static char *function                                          = "libevtx_message_resolver_free";
+	int result                                                     = 1;
+
+	if( message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_resolver != NULL )
+	{
+		internal_message_resolver = (libevtx_internal_message_resolver_t *) *message_resolver;
+		*message_resolver         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_message_resolver->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libevtx_internal_message_resolver_clear(
+		     internal_message_resolver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear compiled messages.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_message_resolver->string != NULL )
+		{
+			memory_free(
+			 internal_message_resolver->string );
+		}
+		memory_free(
+		 internal_message_resolver->buckets );
+
+		memory_free(
+		 internal_message_resolver );
+	}
+	return( result );
+}
+
+/* Retrieves the language identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_message_resolver_get_language_identifier(
+     libevtx_message_resolver_t *message_resolver,
+     uint32_t *language_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_message_resolver_t *internal_message_resolver = NULL;
+	static char *function                                          = "libevtx_message_resolver_get_language_identifier";
+
+	if( message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_message_resolver = (libevtx_internal_message_resolver_t *) message_resolver;
+
+	if( language_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid language identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*language_identifier = internal_message_resolver->language_identifier;
+
+	return( 1 );
+}
+
+/* Sets the language identifier
+ * The compiled messages are kept per language, changing the language does not empty them
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_message_resolver_set_language_identifier(
+     libevtx_message_resolver_t *message_resolver,
+     uint32_t language_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_message_resolver_t *internal_message_resolver = NULL;
+	static char *function                                          = "libevtx_message_resolver_set_language_identifier";
+
+	if( message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_message_resolver = (libevtx_internal_message_resolver_t *) message_resolver;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_message_resolver->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_message_resolver->language_identifier = language_identifier;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_message_resolver->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of compiled messages
+ * This includes the cached results of messages that are not available
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_message_resolver_get_number_of_messages(
+     libevtx_message_resolver_t *message_resolver,
+     int *number_of_messages,
+     libcerror_error_t **error )
+{
+	libevtx_internal_message_resolver_t *internal_message_resolver = NULL;
+	static char *function                                          = "libevtx_message_resolver_get_number_of_messages";
+
+	if( message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_message_resolver = (libevtx_internal_message_resolver_t *) message_resolver;
+
+	if( number_of_messages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of messages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_messages = internal_message_resolver->number_of_messages;
+
+	return( 1 );
+}
+
+/* Frees a compiled message
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_compiled_message_free(
+     libevtx_compiled_message_t **compiled_message,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_compiled_message_free";
+
+	if( compiled_message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled message.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compiled_message != NULL )
+	{
+		if( ( *compiled_message )->source_name != NULL )
+		{
+			memory_free(
+			 ( *compiled_message )->source_name );
+		}
+		if( ( *compiled_message )->string != NULL )
+		{
+			memory_free(
+			 ( *compiled_message )->string );
+		}
+		if( ( *compiled_message )->format_text != NULL )
+		{
+			memory_free(
+			 ( *compiled_message )->format_text );
+		}
+		if( ( *compiled_message )->operations != NULL )
+		{
+			memory_free(
+			 ( *compiled_message )->operations );
+		}
+		memory_free(
+		 *compiled_message );
+
+		*compiled_message = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a format operation to the compiled message
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_compiled_message_append_operation(
+     libevtx_compiled_message_t *compiled_message,
+     int *number_of_allocated_operations,
+     uint8_t operation_type,
+     size_t text_offset,
+     size_t text_length,
+     libcerror_error_t **error )
+{
+	libevtx_message_operation_t *operation = NULL;
+	void *reallocation                     = NULL;
+	static char *function                  = "libevtx_compiled_message_append_operation";
+	int allocated_operations               = 0;
+
+	if( compiled_message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled message.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocated_operations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocated operations.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive literals are merged into a single operation
+	 */
+	if( ( operation_type == LIBEVTX_MESSAGE_OPERATION_TYPE_LITERAL )
+	 && ( compiled_message->number_of_operations > 0 ) )
+	{
+		operation = &( compiled_message->operations[ compiled_message->number_of_operations - 1 ] );
+
+		if( ( operation->type == LIBEVTX_MESSAGE_OPERATION_TYPE_LITERAL )
+		 && ( ( operation->text_offset + operation->text_length ) == text_offset ) )
+		{
+			operation->text_length += text_length;
+
+			return( 1 );
+		}
+	}
+	if( compiled_message->number_of_operations >= *number_of_allocated_operations )
+	{
+		if( *number_of_allocated_operations > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated operations value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		allocated_operations = *number_of_allocated_operations * 2;
+
+		if( allocated_operations == 0 )
+		{
+			allocated_operations = 8;
+		}
+		reallocation = memory_reallocate(
+		                compiled_message->operations,
+		                sizeof( libevtx_message_operation_t ) * allocated_operations );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize operations.",
+			 function );
+
+			return( -1 );
+		}
+		compiled_message->operations    = (libevtx_message_operation_t *) reallocation;
+		*number_of_allocated_operations = allocated_operations;
+	}
+	operation = &( compiled_message->operations[ compiled_message->number_of_operations ] );
+
+	operation->type               = operation_type;
+	operation->text_offset        = text_offset;
+	operation->text_length        = text_length;
+	operation->value_string_index = 0;
+	operation->next_character     = 0;
+
+	compiled_message->number_of_operations += 1;
+
+	return( 1 );
+}
+
+/* Compiles the message string into format operations
+ * The escape sequences are ASCII characters hence the UTF-8 string is parsed per byte
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_compiled_message_compile(
+     libevtx_compiled_message_t *compiled_message,
+     libcerror_error_t **error )
+{
+	static char *function              = "libevtx_compiled_message_compile";
+	size_t conversion_specifier_length = 0;
+	size_t format_text_length          = 0;
+	size_t string_index                = 0;
+	size_t string_length               = 0;
+	uint8_t character                  = 0;
+	int number_of_allocated_operations = 0;
+	int value_string_index             = 0;
+
+	if( compiled_message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled message.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compiled_message->string == NULL )
+	 || ( compiled_message->string_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compiled message - missing string.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_message->format_text != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled message - format text value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The format text is never longer than the string
+	 */
+	compiled_message->format_text = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * compiled_message->string_size );
+
+	if( compiled_message->format_text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create format text.",
+		 function );
+
+		goto on_error;
+	}
+	string_length = compiled_message->string_size - 1;
+
+	while( string_index < string_length )
+	{
+		character = compiled_message->string[ string_index ];
+
+		if( ( character == (uint8_t) '%' )
+		 && ( ( string_index + 1 ) < string_length ) )
+		{
+			character = compiled_message->string[ string_index + 1 ];
+
+			/* Ignore %0 = end of string, %r = cariage return */
+			if( ( character == (uint8_t) '0' )
+			 || ( character == (uint8_t) 'r' ) )
+			{
+				string_index += 2;
+
+				continue;
+			}
+			/* Replace %n = <new line> */
+			if( character == (uint8_t) 'n' )
+			{
+				if( libevtx_compiled_message_append_operation(
+				     compiled_message,
+				     &number_of_allocated_operations,
+				     LIBEVTX_MESSAGE_OPERATION_TYPE_NEW_LINE,
+				     0,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append new line operation.",
+					 function );
+
+					goto on_error;
+				}
+				string_index += 2;
+
+				continue;
+			}
+			/* Replace:
+			 *  %<space> = <space>
+			 *  %! = !
+			 *  %% = %
+			 *  %. = .
+			 *  %b = <space>
+			 *  %t = <tab>
+			 */
+			if( ( character == (uint8_t) ' ' )
+			 || ( character == (uint8_t) '!' )
+			 || ( character == (uint8_t) '%' )
+			 || ( character == (uint8_t) '.' )
+			 || ( character == (uint8_t) 'b' )
+			 || ( character == (uint8_t) 't' ) )
+			{
+				if( character == (uint8_t) 'b' )
+				{
+					character = (uint8_t) ' ';
+				}
+				else if( character == (uint8_t) 't' )
+				{
+					character = (uint8_t) '\t';
+				}
+				compiled_message->format_text[ format_text_length ] = character;
+
+				if( libevtx_compiled_message_append_operation(
+				     compiled_message,
+				     &number_of_allocated_operations,
+				     LIBEVTX_MESSAGE_OPERATION_TYPE_LITERAL,
+				     format_text_length,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append literal operation.",
+					 function );
+
+					goto on_error;
+				}
+				format_text_length += 1;
+				string_index       += 2;
+
+				continue;
+			}
+			if( ( character < (uint8_t) '1' )
+			 || ( character > (uint8_t) '9' ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported conversion specifier: %%%c.",
+				 function,
+				 (char) character );
+
+				goto on_error;
+			}
+			value_string_index = (int) character - (int) '0';
+
+			conversion_specifier_length = 2;
+
+			if( ( ( string_index + 3 ) < string_length )
+			 && ( compiled_message->string[ string_index + 2 ] >= (uint8_t) '0' )
+			 && ( compiled_message->string[ string_index + 2 ] <= (uint8_t) '9' ) )
+			{
+				value_string_index *= 10;
+				value_string_index += (int) compiled_message->string[ string_index + 2 ] - (int) '0';
+
+				conversion_specifier_length += 1;
+			}
+			value_string_index -= 1;
+
+			if( ( ( string_index + conversion_specifier_length + 3 ) < string_length )
+			 && ( compiled_message->string[ string_index + conversion_specifier_length ] == (uint8_t) '!' ) )
+			{
+				if( ( compiled_message->string[ string_index + conversion_specifier_length + 1 ] != (uint8_t) 's' )
+				 || ( compiled_message->string[ string_index + conversion_specifier_length + 2 ] != (uint8_t) '!' ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported conversion specifier at offset: %" PRIzd ".",
+					 function,
+					 string_index );
+
+					goto on_error;
+				}
+				conversion_specifier_length += 3;
+			}
+			if( libevtx_compiled_message_append_operation(
+			     compiled_message,
+			     &number_of_allocated_operations,
+			     LIBEVTX_MESSAGE_OPERATION_TYPE_SUBSTITUTION,
+			     string_index,
+			     conversion_specifier_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append substitution operation.",
+				 function );
+
+				goto on_error;
+			}
+			string_index += conversion_specifier_length;
+
+			compiled_message->operations[ compiled_message->number_of_operations - 1 ].value_string_index = value_string_index;
+			compiled_message->operations[ compiled_message->number_of_operations - 1 ].next_character     = compiled_message->string[ string_index ];
+		}
+		else
+		{
+			if( character == (uint8_t) '\n' )
+			{
+				if( libevtx_compiled_message_append_operation(
+				     compiled_message,
+				     &number_of_allocated_operations,
+				     LIBEVTX_MESSAGE_OPERATION_TYPE_NEW_LINE,
+				     0,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append new line operation.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* Ignore \r and end of string characters */
+			else if( ( character != 0 )
+			      && ( character != (uint8_t) '\r' ) )
+			{
+				compiled_message->format_text[ format_text_length ] = character;
+
+				if( libevtx_compiled_message_append_operation(
+				     compiled_message,
+				     &number_of_allocated_operations,
+				     LIBEVTX_MESSAGE_OPERATION_TYPE_LITERAL,
+				     format_text_length,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append literal operation.",
+					 function );
+
+					goto on_error;
+				}
+				format_text_length += 1;
+			}
+			string_index += 1;
+		}
+	}
+	compiled_message->format_text[ format_text_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( compiled_message->operations != NULL )
+	{
+		memory_free(
+		 compiled_message->operations );
+
+		compiled_message->operations = NULL;
+	}
+	compiled_message->number_of_operations = 0;
+
+	if( compiled_message->format_text != NULL )
+	{
+		memory_free(
+		 compiled_message->format_text );
+
+		compiled_message->format_text = NULL;
+	}
+	return( -1 );
+}
+
+/* Formats the compiled message with the UTF-8 encoded strings of a record
+ * If the UTF-8 string is NULL only the formatted string size is determined
+ * The formatted string size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_compiled_message_format(
+     libevtx_compiled_message_t *compiled_message,
+     const uint8_t *utf8_strings,
+     int number_of_strings,
+     const size_t *utf8_string_offsets,
+     const size_t *utf8_string_sizes,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *formatted_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_message_operation_t *operation = NULL;
+	const uint8_t *text                    = NULL;
+	static char *function                  = "libevtx_compiled_message_format";
+	size_t string_offset                   = 0;
+	size_t text_length                     = 0;
+	uint8_t last_character                 = 0;
+	int operation_index                    = 0;
+
+	if( compiled_message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled message.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_message->format_text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compiled message - missing format text.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_strings > 0 )
+	 && ( ( utf8_strings == NULL )
+	  ||  ( utf8_string_offsets == NULL )
+	  ||  ( utf8_string_sizes == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( formatted_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid formatted string size.",
+		 function );
+
+		return( -1 );
+	}
+	for( operation_index = 0;
+	     operation_index < compiled_message->number_of_operations;
+	     operation_index++ )
+	{
+		operation   = &( compiled_message->operations[ operation_index ] );
+		text_length = 0;
+
+		if( operation->type == LIBEVTX_MESSAGE_OPERATION_TYPE_LITERAL )
+		{
+			text        = &( compiled_message->format_text[ operation->text_offset ] );
+			text_length = operation->text_length;
+
+			last_character = text[ text_length - 1 ];
+		}
+		else if( operation->type == LIBEVTX_MESSAGE_OPERATION_TYPE_NEW_LINE )
+		{
+			/* Ignore multiple new line characters */
+			if( last_character != (uint8_t) '\n' )
+			{
+				last_character = (uint8_t) '\n';
+
+				text        = (const uint8_t *) "\n";
+				text_length = 1;
+			}
+		}
+		else if( ( operation->value_string_index >= 0 )
+		      && ( operation->value_string_index < number_of_strings ) )
+		{
+			/* The string size includes the end of string character
+			 */
+			if( utf8_string_sizes[ operation->value_string_index ] > 1 )
+			{
+				text        = &( utf8_strings[ utf8_string_offsets[ operation->value_string_index ] ] );
+				text_length = utf8_string_sizes[ operation->value_string_index ] - 1;
+			}
+		}
+		else
+		{
+			/* Strings that are not available are formatted as the conversion specifier
+			 */
+			text        = &( compiled_message->string[ operation->text_offset ] );
+			text_length = operation->text_length;
+
+			last_character = operation->next_character;
+		}
+		if( text_length > 0 )
+		{
+			if( utf8_string != NULL )
+			{
+				if( text_length > ( utf8_string_size - string_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-8 string size too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( memory_copy(
+				     &( utf8_string[ string_offset ] ),
+				     text,
+				     text_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy text of operation: %d.",
+					 function,
+					 operation_index );
+
+					return( -1 );
+				}
+			}
+			string_offset += text_length;
+		}
+	}
+	if( utf8_string != NULL )
+	{
+		if( string_offset >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_offset ] = 0;
+	}
+	*formatted_string_size = string_offset + 1;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a compiled message key
+ * A FNV-1a hash is used over the key values
+ * Returns the hash
+ */
+uint32_t libevtx_message_resolver_calculate_hash(
+          const uint8_t *provider_identifier,
+          const uint8_t *utf8_source_name,
+          size_t utf8_source_name_size,
+          uint32_t event_identifier,
+          uint32_t event_identifier_qualifiers,
+          uint32_t language_identifier )
+{
+	uint32_t hash        = 0x811c9dc5UL;
+	uint32_t value_32bit = 0;
+	size_t data_index    = 0;
+	int byte_index       = 0;
+	int value_index      = 0;
+
+	if( provider_identifier != NULL )
+	{
+		for( data_index = 0;
+		     data_index < 16;
+		     data_index++ )
+		{
+			hash ^= provider_identifier[ data_index ];
+			hash *= 0x01000193UL;
+		}
+	}
+	if( utf8_source_name != NULL )
+	{
+		for( data_index = 0;
+		     data_index < utf8_source_name_size;
+		     data_index++ )
+		{
+			hash ^= utf8_source_name[ data_index ];
+			hash *= 0x01000193UL;
+		}
+	}
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		if( value_index == 0 )
+		{
+			value_32bit = event_identifier;
+		}
+		else if( value_index == 1 )
+		{
+			value_32bit = event_identifier_qualifiers;
+		}
+		else
+		{
+			value_32bit = language_identifier;
+		}
+		for( byte_index = 0;
+		     byte_index < 4;
+		     byte_index++ )
+		{
+			hash ^= value_32bit & 0xff;
+			hash *= 0x01000193UL;
+
+			value_32bit >>= 8;
+		}
+	}
+	return( hash );
+}
+
+/* Frees the compiled messages
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_internal_message_resolver_clear(
+     libevtx_internal_message_resolver_t *internal_message_resolver,
+     libcerror_error_t **error )
+{
+	libevtx_compiled_message_t *compiled_message = NULL;
+	static char *function                        = "libevtx_internal_message_resolver_clear";
+	int bucket_index                             = 0;
+	int result                                   = 1;
+
+	if( internal_message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_message_resolver->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message resolver - missing buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < LIBEVTX_MESSAGE_RESOLVER_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		while( internal_message_resolver->buckets[ bucket_index ] != NULL )
+		{
+			compiled_message = internal_message_resolver->buckets[ bucket_index ];
+
+			internal_message_resolver->buckets[ bucket_index ] = compiled_message->next_message;
+
+			if( libevtx_compiled_message_free(
+			     &compiled_message,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compiled message.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	internal_message_resolver->number_of_messages = 0;
+
+	return( result );
+}
+
+/* Retrieves the compiled message of a provider and event identifier
+ * The message string is resolved by the callback and compiled when it is not cached,
+ * messages that are not available are cached as well
+ * The compiled message is owned by the message resolver
+ * Returns 1 if successful, 0 if no message is available or -1 on error
+ */
+int libevtx_internal_message_resolver_get_compiled_message(
+     libevtx_internal_message_resolver_t *internal_message_resolver,
+     const uint8_t *provider_identifier,
+     const uint8_t *utf8_source_name,
+     size_t utf8_source_name_size,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     libevtx_compiled_message_t **compiled_message,
+     libcerror_error_t **error )
+{
+	libevtx_compiled_message_t *safe_compiled_message = NULL;
+	uint8_t *reallocation                             = NULL;
+	static char *function                             = "libevtx_internal_message_resolver_get_compiled_message";
+	size_t string_size                                = 0;
+	uint32_t hash                                     = 0;
+	int bucket_index                                  = 0;
+	int result                                        = 0;
+
+	if( internal_message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_source_name == NULL )
+	 && ( utf8_source_name_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 source name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_source_name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 source name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled message.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libevtx_message_resolver_calculate_hash(
+	        provider_identifier,
+	        utf8_source_name,
+	        utf8_source_name_size,
+	        event_identifier,
+	        event_identifier_qualifiers,
+	        internal_message_resolver->language_identifier );
+
+	bucket_index = (int) ( hash & ( LIBEVTX_MESSAGE_RESOLVER_NUMBER_OF_BUCKETS - 1 ) );
+
+	for( safe_compiled_message = internal_message_resolver->buckets[ bucket_index ];
+	     safe_compiled_message != NULL;
+	     safe_compiled_message = safe_compiled_message->next_message )
+	{
+		if( ( safe_compiled_message->hash != hash )
+		 || ( safe_compiled_message->event_identifier != event_identifier )
+		 || ( safe_compiled_message->event_identifier_qualifiers != event_identifier_qualifiers )
+		 || ( safe_compiled_message->language_identifier != internal_message_resolver->language_identifier )
+		 || ( safe_compiled_message->source_name_size != utf8_source_name_size ) )
+		{
+			continue;
+		}
+		if( provider_identifier == NULL )
+		{
+			if( safe_compiled_message->has_provider_identifier != 0 )
+			{
+				continue;
+			}
+		}
+		else if( ( safe_compiled_message->has_provider_identifier == 0 )
+		      || ( memory_compare(
+		            safe_compiled_message->provider_identifier,
+		            provider_identifier,
+		            16 ) != 0 ) )
+		{
+			continue;
+		}
+		if( ( utf8_source_name_size > 0 )
+		 && ( memory_compare(
+		       safe_compiled_message->source_name,
+		       utf8_source_name,
+		       utf8_source_name_size ) != 0 ) )
+		{
+			continue;
+		}
+		break;
+	}
+	if( safe_compiled_message != NULL )
+	{
+		*compiled_message = safe_compiled_message;
+
+		if( safe_compiled_message->string == NULL )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	/* The number of compiled messages is bounded by emptying them when the maximum is reached
+	 */
+	if( internal_message_resolver->number_of_messages >= LIBEVTX_MESSAGE_RESOLVER_MAXIMUM_NUMBER_OF_MESSAGES )
+	{
+		if( libevtx_internal_message_resolver_clear(
+		     internal_message_resolver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear compiled messages.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_message_resolver->string == NULL )
+	{
+		internal_message_resolver->string = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * LIBEVTX_MESSAGE_RESOLVER_INITIAL_STRING_SIZE );
+
+		if( internal_message_resolver->string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string.",
+			 function );
+
+			goto on_error;
+		}
+		internal_message_resolver->string_size = LIBEVTX_MESSAGE_RESOLVER_INITIAL_STRING_SIZE;
+	}
+	string_size = internal_message_resolver->string_size;
+
+	result = internal_message_resolver->callback(
+	          provider_identifier,
+	          ( provider_identifier != NULL ) ? 16 : 0,
+	          utf8_source_name,
+	          utf8_source_name_size,
+	          event_identifier,
+	          event_identifier_qualifiers,
+	          internal_message_resolver->language_identifier,
+	          internal_message_resolver->string,
+	          &string_size,
+	          internal_message_resolver->user_data );
+
+	/* The callback is called again when the message string does not fit the buffer
+	 */
+	if( ( result == 1 )
+	 && ( string_size > internal_message_resolver->string_size ) )
+	{
+		if( string_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid string size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_message_resolver->string,
+		                            sizeof( uint8_t ) * string_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string.",
+			 function );
+
+			goto on_error;
+		}
+		internal_message_resolver->string      = reallocation;
+		internal_message_resolver->string_size = string_size;
+
+		result = internal_message_resolver->callback(
+		          provider_identifier,
+		          ( provider_identifier != NULL ) ? 16 : 0,
+		          utf8_source_name,
+		          utf8_source_name_size,
+		          event_identifier,
+		          event_identifier_qualifiers,
+		          internal_message_resolver->language_identifier,
+		          internal_message_resolver->string,
+		          &string_size,
+		          internal_message_resolver->user_data );
+
+		if( ( result == 1 )
+		 && ( string_size > internal_message_resolver->string_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve message string.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result == 1 )
+	 && ( string_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid string size value zero.",
+		 function );
+
+		goto on_error;
+	}
+	safe_compiled_message = memory_allocate_structure(
+	                         libevtx_compiled_message_t );
+
+	if( safe_compiled_message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compiled message.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_compiled_message,
+	     0,
+	     sizeof( libevtx_compiled_message_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compiled message.",
+		 function );
+
+		memory_free(
+		 safe_compiled_message );
+
+		safe_compiled_message = NULL;
+
+		goto on_error;
+	}
+	safe_compiled_message->hash                        = hash;
+	safe_compiled_message->event_identifier            = event_identifier;
+	safe_compiled_message->event_identifier_qualifiers = event_identifier_qualifiers;
+	safe_compiled_message->language_identifier         = internal_message_resolver->language_identifier;
+
+	if( provider_identifier != NULL )
+	{
+		if( memory_copy(
+		     safe_compiled_message->provider_identifier,
+		     provider_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+		safe_compiled_message->has_provider_identifier = 1;
+	}
+	if( utf8_source_name_size > 0 )
+	{
+		safe_compiled_message->source_name = (uint8_t *) memory_allocate(
+		                                                  sizeof( uint8_t ) * utf8_source_name_size );
+
+		if( safe_compiled_message->source_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_compiled_message->source_name,
+		     utf8_source_name,
+		     utf8_source_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source name.",
+			 function );
+
+			goto on_error;
+		}
+		safe_compiled_message->source_name_size = utf8_source_name_size;
+	}
+	if( result == 1 )
+	{
+		safe_compiled_message->string = (uint8_t *) memory_allocate(
+		                                             sizeof( uint8_t ) * string_size );
+
+		if( safe_compiled_message->string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_compiled_message->string,
+		     internal_message_resolver->string,
+		     string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			goto on_error;
+		}
+		/* Make sure the string is terminated
+		 */
+		safe_compiled_message->string[ string_size - 1 ] = 0;
+		safe_compiled_message->string_size               = string_size;
+
+		if( libevtx_compiled_message_compile(
+		     safe_compiled_message,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compile message string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	safe_compiled_message->next_message                = internal_message_resolver->buckets[ bucket_index ];
+	internal_message_resolver->buckets[ bucket_index ] = safe_compiled_message;
+
+	internal_message_resolver->number_of_messages += 1;
+
+	*compiled_message = safe_compiled_message;
+
+	return( result );
+
+on_error:
+	if( safe_compiled_message != NULL )
+	{
+		libevtx_compiled_message_free(
+		 &safe_compiled_message,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Formats the message of a provider and event identifier with the UTF-8 encoded strings of a record
+ * The provider identifier is either NULL or 16 bytes of size
+ * If the UTF-8 string is NULL only the formatted string size is determined
+ * The formatted string size includes the end of string character
+ * Returns 1 if successful, 0 if no message is available or -1 on error
+ */
+int libevtx_message_resolver_format_message(
+     libevtx_message_resolver_t *message_resolver,
+     const uint8_t *provider_identifier,
+     const uint8_t *utf8_source_name,
+     size_t utf8_source_name_size,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     const uint8_t *utf8_strings,
+     int number_of_strings,
+     const size_t *utf8_string_offsets,
+     const size_t *utf8_string_sizes,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *formatted_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_compiled_message_t *compiled_message                   = NULL;
+	libevtx_internal_message_resolver_t *internal_message_resolver = NULL;
+	static char *function                                          = "libevtx_message_resolver_format_message";
+	int result                                                     = 0;
+
+	if( message_resolver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message resolver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_message_resolver = (libevtx_internal_message_resolver_t *) message_resolver;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_message_resolver->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevtx_internal_message_resolver_get_compiled_message(
+	          internal_message_resolver,
+	          provider_identifier,
+	          utf8_source_name,
+	          utf8_source_name_size,
+	          event_identifier,
+	          event_identifier_qualifiers,
+	          &compiled_message,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compiled message.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libevtx_compiled_message_format(
+		     compiled_message,
+		     utf8_strings,
+		     number_of_strings,
+		     utf8_string_offsets,
+		     utf8_string_sizes,
+		     utf8_string,
+		     utf8_string_size,
+		     formatted_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to format message.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_message_resolver->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
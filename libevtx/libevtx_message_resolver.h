@@ -0,0 +1,314 @@
+/*
+ * Message resolver functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_MESSAGE_RESOLVER_H )
+#define _LIBEVTX_INTERNAL_MESSAGE_RESOLVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_extern.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of hash buckets of the compiled messages, which is a power of 2
+ */
+#define LIBEVTX_MESSAGE_RESOLVER_NUMBER_OF_BUCKETS		1024
+
+/* The maximum number of compiled messages, the compiled messages are
+ * emptied when the maximum is reached
+ */
+#define LIBEVTX_MESSAGE_RESOLVER_MAXIMUM_NUMBER_OF_MESSAGES	8192
+
+/* The initial size of the buffer the message string is resolved into
+ */
+#define LIBEVTX_MESSAGE_RESOLVER_INITIAL_STRING_SIZE		1024
+
+/* The default language identifier, US English
+ */
+#define LIBEVTX_MESSAGE_RESOLVER_DEFAULT_LANGUAGE_IDENTIFIER	0x00000409UL
+
+/* The message format operation types
+ */
+enum LIBEVTX_MESSAGE_OPERATION_TYPES
+{
+	LIBEVTX_MESSAGE_OPERATION_TYPE_LITERAL		= 1,
+	LIBEVTX_MESSAGE_OPERATION_TYPE_NEW_LINE		= 2,
+	LIBEVTX_MESSAGE_OPERATION_TYPE_SUBSTITUTION	= 3
+};
+
+typedef struct libevtx_message_operation libevtx_message_operation_t;
+
+struct libevtx_message_operation
+{
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The offset of the text
+	 * For a literal this is relative to the format text,
+	 * for a substitution to the conversion specifier in the string
+	 */
+	size_t text_offset;
+
+	/* The length of the text
+	 */
+	size_t text_length;
+
+	/* The value string index of a substitution
+	 */
+	int value_string_index;
+
+	/* The character after the conversion specifier of a substitution
+	 */
+	uint8_t next_character;
+};
+
+typedef struct libevtx_compiled_message libevtx_compiled_message_t;
+
+struct libevtx_compiled_message
+{
+	/* The hash of the key
+	 */
+	uint32_t hash;
+
+	/* The provider identifier
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* Value to indicate the provider identifier is set
+	 */
+	uint8_t has_provider_identifier;
+
+	/* The UTF-8 encoded source name
+	 * Contains NULL if the record has no source name
+	 */
+	uint8_t *source_name;
+
+	/* The source name size
+	 */
+	size_t source_name_size;
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The event identifier qualifiers
+	 */
+	uint32_t event_identifier_qualifiers;
+
+	/* The language identifier
+	 */
+	uint32_t language_identifier;
+
+	/* The UTF-8 encoded message string
+	 * Contains NULL if no message is available
+	 */
+	uint8_t *string;
+
+	/* The message string size
+	 */
+	size_t string_size;
+
+	/* The format text, the literal text of the string with the escape
+	 * sequences replaced
+	 */
+	uint8_t *format_text;
+
+	/* The format operations
+	 */
+	libevtx_message_operation_t *operations;
+
+	/* The number of format operations
+	 */
+	int number_of_operations;
+
+	/* The next compiled message in the same hash bucket
+	 */
+	libevtx_compiled_message_t *next_message;
+};
+
+typedef struct libevtx_internal_message_resolver libevtx_internal_message_resolver_t;
+
+struct libevtx_internal_message_resolver
+{
+	/* The callback that resolves the message string
+	 */
+	int (*callback)(
+	       const uint8_t *provider_identifier,
+	       size_t provider_identifier_size,
+	       const uint8_t *utf8_source_name,
+	       size_t utf8_source_name_size,
+	       uint32_t event_identifier,
+	       uint32_t event_identifier_qualifiers,
+	       uint32_t language_identifier,
+	       uint8_t *utf8_string,
+	       size_t *utf8_string_size,
+	       void *user_data );
+
+	/* The user data passed to the callback
+	 */
+	void *user_data;
+
+	/* The language identifier
+	 */
+	uint32_t language_identifier;
+
+	/* The hash buckets
+	 * Contains the first compiled message of every bucket
+	 */
+	libevtx_compiled_message_t **buckets;
+
+	/* The number of compiled messages
+	 */
+	int number_of_messages;
+
+	/* The buffer the message string is resolved into
+	 */
+	uint8_t *string;
+
+	/* The allocated size of the buffer the message string is resolved into
+	 */
+	size_t string_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBEVTX_EXTERN \
+int libevtx_message_resolver_initialize(
+     libevtx_message_resolver_t **message_resolver,
+     int (*callback)(
+            const uint8_t *provider_identifier,
+            size_t provider_identifier_size,
+            const uint8_t *utf8_source_name,
+            size_t utf8_source_name_size,
+            uint32_t event_identifier,
+            uint32_t event_identifier_qualifiers,
+            uint32_t language_identifier,
+            uint8_t *utf8_string,
+            size_t *utf8_string_size,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_message_resolver_free(
+     libevtx_message_resolver_t **message_resolver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_message_resolver_get_language_identifier(
+     libevtx_message_resolver_t *message_resolver,
+     uint32_t *language_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_message_resolver_set_language_identifier(
+     libevtx_message_resolver_t *message_resolver,
+     uint32_t language_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_message_resolver_get_number_of_messages(
+     libevtx_message_resolver_t *message_resolver,
+     int *number_of_messages,
+     libcerror_error_t **error );
+
+int libevtx_compiled_message_free(
+     libevtx_compiled_message_t **compiled_message,
+     libcerror_error_t **error );
+
+int libevtx_compiled_message_append_operation(
+     libevtx_compiled_message_t *compiled_message,
+     int *number_of_allocated_operations,
+     uint8_t operation_type,
+     size_t text_offset,
+     size_t text_length,
+     libcerror_error_t **error );
+
+int libevtx_compiled_message_compile(
+     libevtx_compiled_message_t *compiled_message,
+     libcerror_error_t **error );
+
+int libevtx_compiled_message_format(
+     libevtx_compiled_message_t *compiled_message,
+     const uint8_t *utf8_strings,
+     int number_of_strings,
+     const size_t *utf8_string_offsets,
+     const size_t *utf8_string_sizes,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *formatted_string_size,
+     libcerror_error_t **error );
+
+uint32_t libevtx_message_resolver_calculate_hash(
+          const uint8_t *provider_identifier,
+          const uint8_t *utf8_source_name,
+          size_t utf8_source_name_size,
+          uint32_t event_identifier,
+          uint32_t event_identifier_qualifiers,
+          uint32_t language_identifier );
+
+int libevtx_internal_message_resolver_clear(
+     libevtx_internal_message_resolver_t *internal_message_resolver,
+     libcerror_error_t **error );
+
+int libevtx_internal_message_resolver_get_compiled_message(
+     libevtx_internal_message_resolver_t *internal_message_resolver,
+     const uint8_t *provider_identifier,
+     const uint8_t *utf8_source_name,
+     size_t utf8_source_name_size,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     libevtx_compiled_message_t **compiled_message,
+     libcerror_error_t **error );
+
+int libevtx_message_resolver_format_message(
+     libevtx_message_resolver_t *message_resolver,
+     const uint8_t *provider_identifier,
+     const uint8_t *utf8_source_name,
+     size_t utf8_source_name_size,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     const uint8_t *utf8_strings,
+     int number_of_strings,
+     const size_t *utf8_string_offsets,
+     const size_t *utf8_string_sizes,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *formatted_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_MESSAGE_RESOLVER_H ) */
+
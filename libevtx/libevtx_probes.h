@@ -0,0 +1,129 @@
+/*
+ * USDT static tracepoint (probe) definitions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_PROBES_H )
+#define _LIBEVTX_PROBES_H
+
+#include <common.h>
+#include <types.h>
+
+/* The probes are USDT (DTRACE_PROBE) static tracepoints that can be observed
+ * with tools like bpftrace, perf and SystemTap. They are only compiled in
+ * when the library is configured with --enable-probes, otherwise the probe
+ * macros do not evaluate their arguments. Compiled in probes cost a single
+ * no-op instruction unless a tracer is attached
+ */
+#if defined( HAVE_PROBES ) && defined( HAVE_SYS_SDT_H )
+#include <sys/sdt.h>
+
+#define LIBEVTX_PROBES_ENABLED	1
+
+/* Fired before the data of a chunk is read
+ * Arguments: file offset, read size
+ */
+#define LIBEVTX_PROBE_CHUNK_READ_START( file_offset, read_size ) \
+	DTRACE_PROBE2( libevtx, chunk__read__start, file_offset, read_size )
+
+/* Fired after the data of a chunk was read
+ * Arguments: file offset, read size, elapsed time in nanoseconds, result
+ */
+#define LIBEVTX_PROBE_CHUNK_READ_DONE( file_offset, read_size, elapsed_time, result ) \
+	DTRACE_PROBE4( libevtx, chunk__read__done, file_offset, read_size, elapsed_time, result )
+
+/* Fired when the chunk header checksum does not match
+ * Arguments: chunk file offset, stored checksum, calculated checksum
+ */
+#define LIBEVTX_PROBE_CHUNK_HEADER_CHECKSUM_MISMATCH( file_offset, stored_checksum, calculated_checksum ) \
+	DTRACE_PROBE3( libevtx, chunk__header__checksum__mismatch, file_offset, stored_checksum, calculated_checksum )
+
+/* Fired when the chunk event records checksum does not match
+ * Arguments: chunk file offset, stored checksum, calculated checksum
+ */
+#define LIBEVTX_PROBE_CHUNK_RECORDS_CHECKSUM_MISMATCH( file_offset, stored_checksum, calculated_checksum ) \
+	DTRACE_PROBE3( libevtx, chunk__records__checksum__mismatch, file_offset, stored_checksum, calculated_checksum )
+
+/* Fired when a chunk is retrieved without reading it
+ * Arguments: chunk index
+ */
+#define LIBEVTX_PROBE_CHUNK_CACHE_HIT( chunk_index ) \
+	DTRACE_PROBE1( libevtx, chunk__cache__hit, chunk_index )
+
+/* Fired when a chunk is not cached and needs to be read
+ * Arguments: chunk index
+ */
+#define LIBEVTX_PROBE_CHUNK_CACHE_MISS( chunk_index ) \
+	DTRACE_PROBE1( libevtx, chunk__cache__miss, chunk_index )
+
+/* Fired when the record values of a record are not cached and need to be read
+ * Arguments: chunk index, record index in the chunk
+ */
+#define LIBEVTX_PROBE_RECORD_CACHE_MISS( chunk_index, chunk_record_index ) \
+	DTRACE_PROBE2( libevtx, record__cache__miss, chunk_index, chunk_record_index )
+
+/* Fired before the binary XML of a record is decoded into an XML document
+ * Arguments: event record identifier, chunk data offset
+ */
+#define LIBEVTX_PROBE_RECORD_DECODE_START( identifier, chunk_data_offset ) \
+	DTRACE_PROBE2( libevtx, record__decode__start, identifier, chunk_data_offset )
+
+/* Fired after the binary XML of a record was decoded into an XML document
+ * Arguments: event record identifier, elapsed time in nanoseconds, result
+ */
+#define LIBEVTX_PROBE_RECORD_DECODE_DONE( identifier, elapsed_time, result ) \
+	DTRACE_PROBE3( libevtx, record__decode__done, identifier, elapsed_time, result )
+
+/* Fired before the binary XML of a record is transcoded into an XML string
+ * Arguments: event record identifier, chunk data offset
+ */
+#define LIBEVTX_PROBE_RECORD_TRANSCODE_START( identifier, chunk_data_offset ) \
+	DTRACE_PROBE2( libevtx, record__transcode__start, identifier, chunk_data_offset )
+
+/* Fired after the binary XML of a record was transcoded into an XML string
+ * Arguments: event record identifier, elapsed time in nanoseconds, result
+ */
+#define LIBEVTX_PROBE_RECORD_TRANSCODE_DONE( identifier, elapsed_time, result ) \
+	DTRACE_PROBE3( libevtx, record__transcode__done, identifier, elapsed_time, result )
+
+/* Fired when a template instance is parsed by the XML transcoder
+ * Arguments: template definition chunk data offset, template data size, number of substitution values
+ */
+#define LIBEVTX_PROBE_TEMPLATE_PARSE( template_definition_offset, template_data_size, number_of_values ) \
+	DTRACE_PROBE3( libevtx, template__parse, template_definition_offset, template_data_size, number_of_values )
+
+#else
+
+#define LIBEVTX_PROBE_CHUNK_READ_START( file_offset, read_size )
+#define LIBEVTX_PROBE_CHUNK_READ_DONE( file_offset, read_size, elapsed_time, result )
+#define LIBEVTX_PROBE_CHUNK_HEADER_CHECKSUM_MISMATCH( file_offset, stored_checksum, calculated_checksum )
+#define LIBEVTX_PROBE_CHUNK_RECORDS_CHECKSUM_MISMATCH( file_offset, stored_checksum, calculated_checksum )
+#define LIBEVTX_PROBE_CHUNK_CACHE_HIT( chunk_index )
+#define LIBEVTX_PROBE_CHUNK_CACHE_MISS( chunk_index )
+#define LIBEVTX_PROBE_RECORD_CACHE_MISS( chunk_index, chunk_record_index )
+#define LIBEVTX_PROBE_RECORD_DECODE_START( identifier, chunk_data_offset )
+#define LIBEVTX_PROBE_RECORD_DECODE_DONE( identifier, elapsed_time, result )
+#define LIBEVTX_PROBE_RECORD_TRANSCODE_START( identifier, chunk_data_offset )
+#define LIBEVTX_PROBE_RECORD_TRANSCODE_DONE( identifier, elapsed_time, result )
+#define LIBEVTX_PROBE_TEMPLATE_PARSE( template_definition_offset, template_data_size, number_of_values )
+
+#endif /* defined( HAVE_PROBES ) && defined( HAVE_SYS_SDT_H ) */
+
+#endif /* !defined( _LIBEVTX_PROBES_H ) */
+
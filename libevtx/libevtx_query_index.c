@@ -0,0 +1,700 @@
+/*
+ * Query index functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_query_index.h"
+#include "libevtx_system_values.h"
+
+/* The 32-bit FNV-1a offset basis and prime
+ */
+#define LIBEVTX_QUERY_INDEX_HASH_OFFSET_BASIS	0x811c9dc5UL
+#define LIBEVTX_QUERY_INDEX_HASH_PRIME		0x01000193UL
+
+/* Creates a query index
+ * Every record contributes at most one entry per key, hence the entries
+ * are allocated for the number of records up front
+ * Make sure the value query_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_query_index_initialize(
+     libevtx_query_index_t **query_index,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_query_index_initialize";
+	int key               = 0;
+
+	if( query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid query index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( (size_t) number_of_records > ( (size_t) SSIZE_MAX / sizeof( libevtx_query_index_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*query_index = memory_allocate_structure(
+	                libevtx_query_index_t );
+
+	if( *query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create query index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *query_index,
+	     0,
+	     sizeof( libevtx_query_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear query index.",
+		 function );
+
+		memory_free(
+		 *query_index );
+
+		*query_index = NULL;
+
+		return( -1 );
+	}
+	if( number_of_records > 0 )
+	{
+		for( key = 0;
+		     key < LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS;
+		     key++ )
+		{
+			( *query_index )->entries[ key ] = (libevtx_query_index_entry_t *) memory_allocate(
+			                                                                    sizeof( libevtx_query_index_entry_t ) * number_of_records );
+
+			if( ( *query_index )->entries[ key ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create entries: %d.",
+				 function,
+				 key );
+
+				goto on_error;
+			}
+		}
+		( *query_index )->unindexed_record_indexes = (int *) memory_allocate(
+		                                                      sizeof( int ) * number_of_records );
+
+		if( ( *query_index )->unindexed_record_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create unindexed record indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *query_index )->number_of_records = number_of_records;
+
+	return( 1 );
+
+on_error:
+	if( *query_index != NULL )
+	{
+		libevtx_query_index_free(
+		 query_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a query index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_query_index_free(
+     libevtx_query_index_t **query_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_query_index_free";
+	int key               = 0;
+
+	if( query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *query_index != NULL )
+	{
+		for( key = 0;
+		     key < LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS;
+		     key++ )
+		{
+			if( ( *query_index )->entries[ key ] != NULL )
+			{
+				memory_free(
+				 ( *query_index )->entries[ key ] );
+			}
+		}
+		if( ( *query_index )->unindexed_record_indexes != NULL )
+		{
+			memory_free(
+			 ( *query_index )->unindexed_record_indexes );
+		}
+		memory_free(
+		 *query_index );
+
+		*query_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of data
+ * Returns the 32-bit FNV-1a hash
+ */
+uint32_t libevtx_query_index_hash_data(
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t hash      = (uint32_t) LIBEVTX_QUERY_INDEX_HASH_OFFSET_BASIS;
+
+	if( data == NULL )
+	{
+		return( hash );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		hash ^= data[ data_offset ];
+		hash *= (uint32_t) LIBEVTX_QUERY_INDEX_HASH_PRIME;
+	}
+	return( hash );
+}
+
+/* Calculates the hash of an UTF-16 little-endian stream
+ * The stream should not contain an end of string character
+ * The hash is case insensitive for the ASCII characters
+ * Returns the 32-bit FNV-1a hash
+ */
+uint32_t libevtx_query_index_hash_utf16_stream(
+          const uint8_t *utf16_stream,
+          size_t utf16_stream_size )
+{
+	size_t stream_offset       = 0;
+	uint32_t hash              = (uint32_t) LIBEVTX_QUERY_INDEX_HASH_OFFSET_BASIS;
+	uint16_t unicode_character = 0;
+
+	if( utf16_stream == NULL )
+	{
+		return( hash );
+	}
+	for( stream_offset = 0;
+	     ( stream_offset + 1 ) < utf16_stream_size;
+	     stream_offset += 2 )
+	{
+		unicode_character = (uint16_t) utf16_stream[ stream_offset + 1 ] << 8;
+		unicode_character = unicode_character | utf16_stream[ stream_offset ];
+
+		if( ( unicode_character >= (uint16_t) 'A' )
+		 && ( unicode_character <= (uint16_t) 'Z' ) )
+		{
+			unicode_character += (uint16_t) ( 'a' - 'A' );
+		}
+		hash ^= (uint8_t) ( unicode_character & 0x00ff );
+		hash *= (uint32_t) LIBEVTX_QUERY_INDEX_HASH_PRIME;
+		hash ^= (uint8_t) ( unicode_character >> 8 );
+		hash *= (uint32_t) LIBEVTX_QUERY_INDEX_HASH_PRIME;
+	}
+	return( hash );
+}
+
+/* Calculates the hash of an UTF-16 string
+ * Trailing end of string characters are ignored
+ * The hash is case insensitive for the ASCII characters and equals
+ * the hash of the corresponding UTF-16 little-endian stream
+ * Returns the 32-bit FNV-1a hash
+ */
+uint32_t libevtx_query_index_hash_utf16_string(
+          const uint16_t *utf16_string,
+          size_t utf16_string_size )
+{
+	size_t string_index        = 0;
+	uint32_t hash              = (uint32_t) LIBEVTX_QUERY_INDEX_HASH_OFFSET_BASIS;
+	uint16_t unicode_character = 0;
+
+	if( utf16_string == NULL )
+	{
+		return( hash );
+	}
+	while( ( utf16_string_size > 0 )
+	    && ( utf16_string[ utf16_string_size - 1 ] == 0 ) )
+	{
+		utf16_string_size--;
+	}
+	for( string_index = 0;
+	     string_index < utf16_string_size;
+	     string_index++ )
+	{
+		unicode_character = utf16_string[ string_index ];
+
+		if( ( unicode_character >= (uint16_t) 'A' )
+		 && ( unicode_character <= (uint16_t) 'Z' ) )
+		{
+			unicode_character += (uint16_t) ( 'a' - 'A' );
+		}
+		hash ^= (uint8_t) ( unicode_character & 0x00ff );
+		hash *= (uint32_t) LIBEVTX_QUERY_INDEX_HASH_PRIME;
+		hash ^= (uint8_t) ( unicode_character >> 8 );
+		hash *= (uint32_t) LIBEVTX_QUERY_INDEX_HASH_PRIME;
+	}
+	return( hash );
+}
+
+/* Appends the entries of a record to the query index
+ * Values that are not present in the System element values are not indexed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_query_index_append_system_values(
+     libevtx_query_index_t *query_index,
+     int record_index,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error )
+{
+	uint32_t key_values[ LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS ];
+	uint8_t key_flags[ LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS ] = {
+		LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER,
+		LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER,
+		LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME };
+
+	libevtx_query_index_entry_t *entry = NULL;
+	static char *function              = "libevtx_query_index_append_system_values";
+	int key                            = 0;
+
+	if( query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= query_index->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system values.",
+		 function );
+
+		return( -1 );
+	}
+	key_values[ LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER ] = system_values->event_identifier;
+
+	key_values[ LIBEVTX_QUERY_INDEX_KEY_PROVIDER_IDENTIFIER ] = libevtx_query_index_hash_data(
+	                                                             system_values->provider_identifier,
+	                                                             16 );
+
+	key_values[ LIBEVTX_QUERY_INDEX_KEY_COMPUTER_NAME ] = libevtx_query_index_hash_utf16_stream(
+	                                                       system_values->computer_name,
+	                                                       system_values->computer_name_size );
+
+	for( key = 0;
+	     key < LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS;
+	     key++ )
+	{
+		if( ( system_values->flags & key_flags[ key ] ) == 0 )
+		{
+			continue;
+		}
+		if( query_index->number_of_entries[ key ] >= query_index->number_of_records )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid query index - number of entries: %d value out of bounds.",
+			 function,
+			 key );
+
+			return( -1 );
+		}
+		entry = &( query_index->entries[ key ][ query_index->number_of_entries[ key ] ] );
+
+		entry->key_value    = key_values[ key ];
+		entry->record_index = record_index;
+
+		query_index->number_of_entries[ key ] += 1;
+	}
+	query_index->is_sorted = 0;
+
+	return( 1 );
+}
+
+/* Appends a record that could not be indexed to the query index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_query_index_append_unindexed_record(
+     libevtx_query_index_t *query_index,
+     int record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_query_index_append_unindexed_record";
+
+	if( query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= query_index->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_index->number_of_unindexed_records >= query_index->number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid query index - number of unindexed records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	query_index->unindexed_record_indexes[ query_index->number_of_unindexed_records ] = record_index;
+
+	query_index->number_of_unindexed_records += 1;
+
+	return( 1 );
+}
+
+/* Compares two query index entries
+ * Returns -1 if the first entry sorts before the second, 1 if after or 0 if equal
+ */
+static int libevtx_query_index_compare_entries(
+            const void *first_entry,
+            const void *second_entry )
+{
+	const libevtx_query_index_entry_t *first_query_index_entry  = (const libevtx_query_index_entry_t *) first_entry;
+	const libevtx_query_index_entry_t *second_query_index_entry = (const libevtx_query_index_entry_t *) second_entry;
+
+	if( first_query_index_entry->key_value < second_query_index_entry->key_value )
+	{
+		return( -1 );
+	}
+	if( first_query_index_entry->key_value > second_query_index_entry->key_value )
+	{
+		return( 1 );
+	}
+	if( first_query_index_entry->record_index < second_query_index_entry->record_index )
+	{
+		return( -1 );
+	}
+	if( first_query_index_entry->record_index > second_query_index_entry->record_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the entries of the query index by key value and record index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_query_index_sort(
+     libevtx_query_index_t *query_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_query_index_sort";
+	int key               = 0;
+
+	if( query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query index.",
+		 function );
+
+		return( -1 );
+	}
+	for( key = 0;
+	     key < LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS;
+	     key++ )
+	{
+		if( query_index->number_of_entries[ key ] > 1 )
+		{
+			qsort(
+			 query_index->entries[ key ],
+			 (size_t) query_index->number_of_entries[ key ],
+			 sizeof( libevtx_query_index_entry_t ),
+			 &libevtx_query_index_compare_entries );
+		}
+	}
+	query_index->is_sorted = 1;
+
+	return( 1 );
+}
+
+/* Marks the records that have a specific key value in a records bitmap
+ * The records bitmap contains a bit per record, where bit 0 of byte 0 represents record 0
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_query_index_mark_records(
+     libevtx_query_index_t *query_index,
+     int key,
+     uint32_t key_value,
+     uint8_t *records_bitmap,
+     size_t records_bitmap_size,
+     libcerror_error_t **error )
+{
+	libevtx_query_index_entry_t *entries = NULL;
+	static char *function                = "libevtx_query_index_mark_records";
+	int entry_index                      = 0;
+	int lower_bound                      = 0;
+	int record_index                     = 0;
+	int upper_bound                      = 0;
+
+	if( query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query index.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_index->is_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid query index - entries are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key < 0 )
+	 || ( key >= LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_bitmap_size < (size_t) ( ( query_index->number_of_records + 7 ) / 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid records bitmap size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	entries     = query_index->entries[ key ];
+	upper_bound = query_index->number_of_entries[ key ];
+
+	/* Determine the first entry with the key value
+	 */
+	while( lower_bound < upper_bound )
+	{
+		entry_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+		if( entries[ entry_index ].key_value < key_value )
+		{
+			lower_bound = entry_index + 1;
+		}
+		else
+		{
+			upper_bound = entry_index;
+		}
+	}
+	for( entry_index = lower_bound;
+	     entry_index < query_index->number_of_entries[ key ];
+	     entry_index++ )
+	{
+		if( entries[ entry_index ].key_value != key_value )
+		{
+			break;
+		}
+		record_index = entries[ entry_index ].record_index;
+
+		records_bitmap[ record_index / 8 ] |= (uint8_t) ( 1 << ( record_index % 8 ) );
+	}
+	return( 1 );
+}
+
+/* Marks the records that could not be indexed in a records bitmap
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_query_index_mark_unindexed_records(
+     libevtx_query_index_t *query_index,
+     uint8_t *records_bitmap,
+     size_t records_bitmap_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_query_index_mark_unindexed_records";
+	int record_index      = 0;
+	int unindexed_index   = 0;
+
+	if( query_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query index.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_bitmap_size < (size_t) ( ( query_index->number_of_records + 7 ) / 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid records bitmap size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( unindexed_index = 0;
+	     unindexed_index < query_index->number_of_unindexed_records;
+	     unindexed_index++ )
+	{
+		record_index = query_index->unindexed_record_indexes[ unindexed_index ];
+
+		records_bitmap[ record_index / 8 ] |= (uint8_t) ( 1 << ( record_index % 8 ) );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,143 @@
+/*
+ * Query index functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_QUERY_INDEX_H )
+#define _LIBEVTX_QUERY_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_system_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The keys that are indexed
+ */
+#define LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER	0
+#define LIBEVTX_QUERY_INDEX_KEY_PROVIDER_IDENTIFIER	1
+#define LIBEVTX_QUERY_INDEX_KEY_COMPUTER_NAME		2
+
+#define LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS		3
+
+typedef struct libevtx_query_index_entry libevtx_query_index_entry_t;
+
+struct libevtx_query_index_entry
+{
+	/* The key value
+	 * Contains the event identifier or the hash of the provider identifier or computer name
+	 */
+	uint32_t key_value;
+
+	/* The record index
+	 */
+	int record_index;
+};
+
+typedef struct libevtx_query_index libevtx_query_index_t;
+
+struct libevtx_query_index
+{
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The entries per key
+	 * The entries are sorted by key value and record index once the index is sorted
+	 */
+	libevtx_query_index_entry_t *entries[ LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS ];
+
+	/* The number of entries per key
+	 */
+	int number_of_entries[ LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS ];
+
+	/* The indexes of the records of which the System element values could not be read
+	 * without an XML document, these records are not indexed and always need to be matched
+	 */
+	int *unindexed_record_indexes;
+
+	/* The number of unindexed records
+	 */
+	int number_of_unindexed_records;
+
+	/* Value to indicate the entries are sorted
+	 */
+	uint8_t is_sorted;
+};
+
+int libevtx_query_index_initialize(
+     libevtx_query_index_t **query_index,
+     int number_of_records,
+     libcerror_error_t **error );
+
+int libevtx_query_index_free(
+     libevtx_query_index_t **query_index,
+     libcerror_error_t **error );
+
+uint32_t libevtx_query_index_hash_data(
+          const uint8_t *data,
+          size_t data_size );
+
+uint32_t libevtx_query_index_hash_utf16_stream(
+          const uint8_t *utf16_stream,
+          size_t utf16_stream_size );
+
+uint32_t libevtx_query_index_hash_utf16_string(
+          const uint16_t *utf16_string,
+          size_t utf16_string_size );
+
+int libevtx_query_index_append_system_values(
+     libevtx_query_index_t *query_index,
+     int record_index,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error );
+
+int libevtx_query_index_append_unindexed_record(
+     libevtx_query_index_t *query_index,
+     int record_index,
+     libcerror_error_t **error );
+
+int libevtx_query_index_sort(
+     libevtx_query_index_t *query_index,
+     libcerror_error_t **error );
+
+int libevtx_query_index_mark_records(
+     libevtx_query_index_t *query_index,
+     int key,
+     uint32_t key_value,
+     uint8_t *records_bitmap,
+     size_t records_bitmap_size,
+     libcerror_error_t **error );
+
+int libevtx_query_index_mark_unindexed_records(
+     libevtx_query_index_t *query_index,
+     uint8_t *records_bitmap,
+     size_t records_bitmap_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_QUERY_INDEX_H ) */
+
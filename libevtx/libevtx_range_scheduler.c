@@ -0,0 +1,435 @@
+/*
+ * Work-stealing range scheduler functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_range_scheduler.h"
+
+/* Creates a range scheduler
+ * The range scheduler distributes the indexes of a number of items over the workers
+ * Every worker takes the items of its own range and when its range is exhausted,
+ * steals half of the remaining items of the largest range of another worker
+ * Make sure the value range_scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_range_scheduler_initialize(
+     libevtx_range_scheduler_t **range_scheduler,
+     int maximum_number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_range_scheduler_initialize";
+	size_t array_size     = 0;
+
+	if( range_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *range_scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid range scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_workers <= 0 )
+	 || ( maximum_number_of_workers > LIBEVTX_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*range_scheduler = memory_allocate_structure(
+	                    libevtx_range_scheduler_t );
+
+	if( *range_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *range_scheduler,
+	     0,
+	     sizeof( libevtx_range_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear range scheduler.",
+		 function );
+
+		memory_free(
+		 *range_scheduler );
+
+		*range_scheduler = NULL;
+
+		return( -1 );
+	}
+	array_size = sizeof( int ) * maximum_number_of_workers;
+
+	( *range_scheduler )->range_start_indexes = (int *) memory_allocate(
+	                                                     array_size );
+
+	if( ( *range_scheduler )->range_start_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range start indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *range_scheduler )->range_end_indexes = (int *) memory_allocate(
+	                                                   array_size );
+
+	if( ( *range_scheduler )->range_end_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range end indexes.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *range_scheduler )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *range_scheduler )->maximum_number_of_workers = maximum_number_of_workers;
+
+	return( 1 );
+
+on_error:
+	if( *range_scheduler != NULL )
+	{
+		if( ( *range_scheduler )->range_end_indexes != NULL )
+		{
+			memory_free(
+			 ( *range_scheduler )->range_end_indexes );
+		}
+		if( ( *range_scheduler )->range_start_indexes != NULL )
+		{
+			memory_free(
+			 ( *range_scheduler )->range_start_indexes );
+		}
+		memory_free(
+		 *range_scheduler );
+
+		*range_scheduler = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a range scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_range_scheduler_free(
+     libevtx_range_scheduler_t **range_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_range_scheduler_free";
+	int result            = 1;
+
+	if( range_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *range_scheduler != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *range_scheduler )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *range_scheduler )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 ( *range_scheduler )->range_end_indexes );
+
+		memory_free(
+		 ( *range_scheduler )->range_start_indexes );
+
+		memory_free(
+		 *range_scheduler );
+
+		*range_scheduler = NULL;
+	}
+	return( result );
+}
+
+/* Resets the range scheduler
+ * The items are initially divided in contiguous ranges of about equal size,
+ * which keeps adjacent items, such as chunks in the same part of the file,
+ * together with the same worker
+ * This function is not thread-safe and should not be called while workers are active
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_range_scheduler_reset(
+     libevtx_range_scheduler_t *range_scheduler,
+     int number_of_items,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function   = "libevtx_range_scheduler_reset";
+	int number_of_remainder = 0;
+	int range_size          = 0;
+	int range_start_index   = 0;
+	int worker_index        = 0;
+
+	if( range_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of items value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > range_scheduler->maximum_number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	range_size          = number_of_items / number_of_workers;
+	number_of_remainder = number_of_items % number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		range_scheduler->range_start_indexes[ worker_index ] = range_start_index;
+
+		range_start_index += range_size;
+
+		if( worker_index < number_of_remainder )
+		{
+			range_start_index += 1;
+		}
+		range_scheduler->range_end_indexes[ worker_index ] = range_start_index;
+	}
+	range_scheduler->number_of_workers = number_of_workers;
+	range_scheduler->number_of_steals  = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the next item for a specific worker
+ * The item is taken from the start of the range of the worker, if its range
+ * is exhausted, half of the largest remaining range of the other workers,
+ * rounded up, is moved to the worker
+ * Returns 1 if successful, 0 if no items remain or -1 on error
+ */
+int libevtx_range_scheduler_get_next_index(
+     libevtx_range_scheduler_t *range_scheduler,
+     int worker_index,
+     int *item_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "libevtx_range_scheduler_get_next_index";
+	int number_of_stolen    = 0;
+	int range_index         = 0;
+	int range_size          = 0;
+	int result              = 0;
+	int victim_range_size   = 0;
+	int victim_worker_index = -1;
+
+	if( range_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= range_scheduler->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     range_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( range_scheduler->range_start_indexes[ worker_index ] >= range_scheduler->range_end_indexes[ worker_index ] )
+	{
+		for( range_index = 0;
+		     range_index < range_scheduler->number_of_workers;
+		     range_index++ )
+		{
+			range_size = range_scheduler->range_end_indexes[ range_index ]
+			           - range_scheduler->range_start_indexes[ range_index ];
+
+			if( range_size > victim_range_size )
+			{
+				victim_worker_index = range_index;
+				victim_range_size   = range_size;
+			}
+		}
+		if( victim_worker_index != -1 )
+		{
+			number_of_stolen = ( victim_range_size + 1 ) / 2;
+
+			range_scheduler->range_start_indexes[ worker_index ] = range_scheduler->range_end_indexes[ victim_worker_index ] - number_of_stolen;
+			range_scheduler->range_end_indexes[ worker_index ]   = range_scheduler->range_end_indexes[ victim_worker_index ];
+
+			range_scheduler->range_end_indexes[ victim_worker_index ] -= number_of_stolen;
+
+			range_scheduler->number_of_steals += 1;
+		}
+	}
+	if( range_scheduler->range_start_indexes[ worker_index ] < range_scheduler->range_end_indexes[ worker_index ] )
+	{
+		*item_index = range_scheduler->range_start_indexes[ worker_index ];
+
+		range_scheduler->range_start_indexes[ worker_index ] += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     range_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
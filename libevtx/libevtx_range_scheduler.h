@@ -0,0 +1,94 @@
+/*
+ * Work-stealing range scheduler functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_RANGE_SCHEDULER_H )
+#define _LIBEVTX_RANGE_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_range_scheduler libevtx_range_scheduler_t;
+
+struct libevtx_range_scheduler
+{
+	/* The maximum number of workers
+	 */
+	int maximum_number_of_workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The start indexes of the ranges, one for every worker
+	 * The worker takes the items from the start of its range
+	 */
+	int *range_start_indexes;
+
+	/* The end indexes of the ranges, one for every worker
+	 * Other workers steal the items from the end of the range
+	 */
+	int *range_end_indexes;
+
+	/* The number of ranges stolen
+	 */
+	int number_of_steals;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the ranges
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevtx_range_scheduler_initialize(
+     libevtx_range_scheduler_t **range_scheduler,
+     int maximum_number_of_workers,
+     libcerror_error_t **error );
+
+int libevtx_range_scheduler_free(
+     libevtx_range_scheduler_t **range_scheduler,
+     libcerror_error_t **error );
+
+int libevtx_range_scheduler_reset(
+     libevtx_range_scheduler_t *range_scheduler,
+     int number_of_items,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libevtx_range_scheduler_get_next_index(
+     libevtx_range_scheduler_t *range_scheduler,
+     int worker_index,
+     int *item_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RANGE_SCHEDULER_H ) */
+
@@ -0,0 +1,536 @@
+/*
+ * Read buffer functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_read_buffer.h"
+
+/* Creates a read buffer
+ * The read buffer coalesces the reads of a sequential run of chunks into reads
+ * of multiple adjacent chunks using a clone of the file IO handle
+ * Make sure the value read_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_read_buffer_initialize(
+     libevtx_read_buffer_t **read_buffer,
+     libbfio_handle_t *file_io_handle,
+     size_t chunk_size,
+     size64_t file_size,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_read_buffer_initialize";
+	int result            = 0;
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_size < ( 2 * chunk_size ) )
+	 || ( read_size > (size_t) LIBEVTX_MAXIMUM_COALESCED_READ_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_buffer = memory_allocate_structure(
+	                libevtx_read_buffer_t );
+
+	if( *read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_buffer,
+	     0,
+	     sizeof( libevtx_read_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read buffer.",
+		 function );
+
+		memory_free(
+		 *read_buffer );
+
+		*read_buffer = NULL;
+
+		return( -1 );
+	}
+	/* The buffer only contains whole chunks
+	 */
+	( *read_buffer )->size = read_size - ( read_size % chunk_size );
+
+	( *read_buffer )->data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * ( *read_buffer )->size );
+
+	if( ( *read_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_buffer )->chunk_size       = chunk_size;
+	( *read_buffer )->file_size        = file_size;
+	( *read_buffer )->data_file_offset = -1;
+	( *read_buffer )->last_file_offset = -1;
+
+	if( libbfio_handle_clone(
+	     &( ( *read_buffer )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *read_buffer )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *read_buffer )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_buffer )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *read_buffer != NULL )
+	{
+		libevtx_read_buffer_free(
+		 read_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a read buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_read_buffer_free(
+     libevtx_read_buffer_t **read_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_read_buffer_free";
+	int result            = 1;
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_buffer != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *read_buffer )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *read_buffer )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *read_buffer )->file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *read_buffer )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *read_buffer )->data );
+		}
+		memory_free(
+		 *read_buffer );
+
+		*read_buffer = NULL;
+	}
+	return( result );
+}
+
+/* Sets the file size
+ * The data in the buffer is discarded since the file could have been modified
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_read_buffer_set_file_size(
+     libevtx_read_buffer_t *read_buffer,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_read_buffer_set_file_size";
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     read_buffer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_buffer->file_size        = file_size;
+	read_buffer->data_file_offset = -1;
+	read_buffer->data_size        = 0;
+	read_buffer->last_file_offset = -1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     read_buffer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the data of a chunk from the read buffer
+ * If the chunk directly follows the previous chunk and is not in the buffer,
+ * the buffer is filled with the chunk and the chunks that follow it in a single read
+ * Returns 1 if successful, 0 if the chunk is not read by the read buffer or -1 on error
+ */
+int libevtx_read_buffer_get_chunk_data(
+     libevtx_read_buffer_t *read_buffer,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "libevtx_read_buffer_get_chunk_data";
+	size_t buffer_offset          = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	int result                    = 0;
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != read_buffer->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     read_buffer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( read_buffer->data_file_offset >= 0 )
+	 && ( file_offset >= read_buffer->data_file_offset )
+	 && ( (size64_t) ( file_offset - read_buffer->data_file_offset ) <= (size64_t) read_buffer->data_size )
+	 && ( data_size <= ( read_buffer->data_size - (size_t) ( file_offset - read_buffer->data_file_offset ) ) ) )
+	{
+		buffer_offset = (size_t) ( file_offset - read_buffer->data_file_offset );
+
+		result = 1;
+	}
+	else if( ( read_buffer->last_file_offset >= 0 )
+	      && ( file_offset == ( read_buffer->last_file_offset + (off64_t) read_buffer->chunk_size ) )
+	      && ( (size64_t) file_offset < read_buffer->file_size ) )
+	{
+		/* A sequential run of chunk reads fills the buffer with the chunks that follow
+		 */
+		read_size = read_buffer->size;
+
+		if( (size64_t) read_size > ( read_buffer->file_size - (size64_t) file_offset ) )
+		{
+			read_size = (size_t) ( read_buffer->file_size - (size64_t) file_offset );
+		}
+		read_buffer->data_file_offset = -1;
+		read_buffer->data_size        = 0;
+
+		if( read_size >= data_size )
+		{
+			read_count = -1;
+
+			if( libbfio_handle_seek_offset(
+			     read_buffer->file_io_handle,
+			     file_offset,
+			     SEEK_SET,
+			     &read_error ) != -1 )
+			{
+				read_count = libbfio_handle_read_buffer(
+				              read_buffer->file_io_handle,
+				              read_buffer->data,
+				              read_size,
+				              &read_error );
+			}
+			/* If the buffer cannot be filled the chunk is read by the caller
+			 * which reports the error if the chunk itself cannot be read
+			 */
+			if( read_error != NULL )
+			{
+				libcerror_error_free(
+				 &read_error );
+			}
+			if( read_count == (ssize_t) read_size )
+			{
+				read_buffer->data_file_offset = file_offset;
+				read_buffer->data_size        = read_size;
+
+				result = 1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( memory_copy(
+		     data,
+		     &( read_buffer->data[ buffer_offset ] ),
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk data.",
+			 function );
+
+			result = -1;
+		}
+	}
+	read_buffer->last_file_offset = file_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     read_buffer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,111 @@
+/*
+ * Read buffer functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_READ_BUFFER_H )
+#define _LIBEVTX_READ_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_read_buffer libevtx_read_buffer_t;
+
+struct libevtx_read_buffer
+{
+	/* The file IO handle used to read the buffer data
+	 * This is a clone of the file IO handle of the file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The buffer data
+	 */
+	uint8_t *data;
+
+	/* The buffer size, a multitude of the chunk size
+	 */
+	size_t size;
+
+	/* The file offset of the buffer data
+	 * Contains -1 if the buffer contains no data
+	 */
+	off64_t data_file_offset;
+
+	/* The size of the data in the buffer
+	 */
+	size_t data_size;
+
+	/* The file offset of the last chunk read by the consumer
+	 * Contains -1 if not set
+	 */
+	off64_t last_file_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the buffer
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevtx_read_buffer_initialize(
+     libevtx_read_buffer_t **read_buffer,
+     libbfio_handle_t *file_io_handle,
+     size_t chunk_size,
+     size64_t file_size,
+     size_t read_size,
+     libcerror_error_t **error );
+
+int libevtx_read_buffer_free(
+     libevtx_read_buffer_t **read_buffer,
+     libcerror_error_t **error );
+
+int libevtx_read_buffer_set_file_size(
+     libevtx_read_buffer_t *read_buffer,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libevtx_read_buffer_get_chunk_data(
+     libevtx_read_buffer_t *read_buffer,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_READ_BUFFER_H ) */
+
@@ -23,15 +23,20 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libevtx_checksum.h"
 #include "libevtx_definitions.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_message_resolver.h"
 #include "libevtx_record.h"
 #include "libevtx_record_values.h"
+#include "libevtx_string_table.h"
 
 /* Creates a record
  * Make sure the value record is referencing, is set to NULL
+ * If the flag LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES is set the record takes
+ * over management of the record values on success
  * Returns 1 if successful or -1 on error
  */
 int libevtx_record_initialize(
@@ -78,7 +83,7 @@ int libevtx_record_initialize(
 
 		return( -1 );
 	}
-	if( ( flags & ~( LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) ) != 0 )
+	if( ( flags & ~( LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE | LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES | LIBEVTX_RECORD_FLAG_BORROWED ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -206,9 +211,22 @@ int libevtx_record_free(
 	if( *record != NULL )
 	{
 		internal_record = (libevtx_internal_record_t *) *record;
-		*record         = NULL;
 
-		/* The io_handle and record_values references are freed elsewhere
+		if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_BORROWED ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid record - borrowed record is released by the file.",
+			 function );
+
+			return( -1 );
+		}
+		*record = NULL;
+
+		/* The io_handle reference is freed elsewhere
+		 * The record_values reference is freed elsewhere unless managed by the record
 		 */
 		if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
 		{
@@ -242,24 +260,54 @@ int libevtx_record_free(
 				}
 			}
 		}
+		if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES ) != 0 )
+		{
+			if( internal_record->record_values != NULL )
+			{
+				if( libevtx_record_values_free(
+				     &( internal_record->record_values ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record values.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		if( internal_record->raw_data_buffer != NULL )
+		{
+			memory_free(
+			 internal_record->raw_data_buffer );
+		}
 		memory_free(
 		 internal_record );
 	}
 	return( 1 );
 }
 
-/* Retrieves the offset
+/* Retrieves the chunk data that contains the record values
+ * The chunk data references the memory mapped data if available, otherwise
+ * it is read into chunk data buffer, which the caller needs to free
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_offset(
-     libevtx_record_t *record,
-     off64_t *offset,
+int libevtx_record_get_chunk_data(
+     libevtx_internal_record_t *internal_record,
+     const uint8_t **chunk_data,
+     uint8_t **chunk_data_buffer,
+     size_t *chunk_data_size,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_offset";
+	uint8_t *safe_chunk_data_buffer = NULL;
+	static char *function           = "libevtx_record_get_chunk_data";
+	size_t safe_chunk_data_size     = 0;
+	off64_t chunk_file_offset       = 0;
 
-	if( record == NULL )
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -270,8 +318,17 @@ int libevtx_record_get_offset(
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
 
+		return( -1 );
+	}
 	if( internal_record->record_values == NULL )
 	{
 		libcerror_error_set(
@@ -283,85 +340,150 @@ int libevtx_record_get_offset(
 
 		return( -1 );
 	}
-	if( offset == NULL )
+	if( chunk_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid chunk data.",
 		 function );
 
 		return( -1 );
 	}
-	*offset = internal_record->record_values->offset;
-
-	return( 1 );
-}
-
-/* Retrieves the identifier (record number)
- * Returns 1 if successful or -1 on error
- */
-int libevtx_record_get_identifier(
-     libevtx_record_t *record,
-     uint64_t *identifier,
-     libcerror_error_t **error )
-{
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_identifier";
+	if( chunk_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data buffer.",
+		 function );
 
-	if( record == NULL )
+		return( -1 );
+	}
+	if( chunk_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid chunk data size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
+	if( ( internal_record->record_values->offset < 0 )
+	 || ( (size64_t) internal_record->record_values->offset < (size64_t) internal_record->record_values->chunk_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record - record values offset value out of bounds.",
+		 function );
 
-	if( internal_record->record_values == NULL )
+		return( -1 );
+	}
+	chunk_file_offset    = internal_record->record_values->offset - (off64_t) internal_record->record_values->chunk_data_offset;
+	safe_chunk_data_size = (size_t) internal_record->io_handle->chunk_size;
+
+	if( ( internal_record->io_handle->mapped_data != NULL )
+	 && ( (size64_t) chunk_file_offset <= internal_record->io_handle->mapped_data_size )
+	 && ( (size64_t) safe_chunk_data_size <= ( internal_record->io_handle->mapped_data_size - (size64_t) chunk_file_offset ) ) )
+	{
+		*chunk_data        = &( internal_record->io_handle->mapped_data[ chunk_file_offset ] );
+		*chunk_data_buffer = NULL;
+		*chunk_data_size   = safe_chunk_data_size;
+
+		return( 1 );
+	}
+	if( internal_record->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record - missing record values.",
+		 "%s: invalid record - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( identifier == NULL )
+	if( ( safe_chunk_data_size == 0 )
+	 || ( safe_chunk_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid identifier.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record - chunk size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	*identifier = internal_record->record_values->identifier;
+	safe_chunk_data_buffer = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * safe_chunk_data_size );
+
+	if( safe_chunk_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_io_handle_read_data_at_offset(
+	     internal_record->io_handle,
+	     internal_record->file_io_handle,
+	     chunk_file_offset,
+	     safe_chunk_data_buffer,
+	     safe_chunk_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk data at offset: %" PRIi64 ".",
+		 function,
+		 chunk_file_offset );
+
+		goto on_error;
+	}
+	*chunk_data        = safe_chunk_data_buffer;
+	*chunk_data_buffer = safe_chunk_data_buffer;
+	*chunk_data_size   = safe_chunk_data_size;
 
 	return( 1 );
+
+on_error:
+	if( safe_chunk_data_buffer != NULL )
+	{
+		memory_free(
+		 safe_chunk_data_buffer );
+	}
+	return( -1 );
 }
 
-/* Retrieves the 64-bit FILETIME value containing the written time
+/* Reads the XML document of the record values if it was not read before
+ * The XML document is not read if the System values of the record values
+ * contain all the values in system_values_flags
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_written_time(
-     libevtx_record_t *record,
-     uint64_t *filetime,
+int libevtx_record_read_xml_document(
+     libevtx_internal_record_t *internal_record,
+     uint8_t system_values_flags,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_written_time";
+	const uint8_t *chunk_data  = NULL;
+	uint8_t *chunk_data_buffer = NULL;
+	static char *function      = "libevtx_record_read_xml_document";
+	size_t chunk_data_size     = 0;
 
-	if( record == NULL )
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -372,8 +494,6 @@ int libevtx_record_get_written_time(
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
-
 	if( internal_record->record_values == NULL )
 	{
 		libcerror_error_set(
@@ -385,76 +505,104 @@ int libevtx_record_get_written_time(
 
 		return( -1 );
 	}
-	if( filetime == NULL )
+	if( internal_record->record_values->xml_document != NULL )
+	{
+		return( 1 );
+	}
+	if( ( system_values_flags != 0 )
+	 && ( libevtx_record_values_has_system_values(
+	       internal_record->record_values,
+	       system_values_flags ) != 0 ) )
+	{
+		return( 1 );
+	}
+	if( internal_record->record_values->is_partially_decoded != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filetime.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record - partially decoded since it exceeds the decode budget.",
 		 function );
 
 		return( -1 );
 	}
-	*filetime = internal_record->record_values->written_time;
-
-	return( 1 );
-}
-
-/* Retrieves the event identifier
- * Returns 1 if successful or -1 on error
- */
-int libevtx_record_get_event_identifier(
-     libevtx_record_t *record,
-     uint32_t *event_identifier,
-     libcerror_error_t **error )
-{
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_event_identifier";
-
-	if( record == NULL )
+	/* The XML document was deferred by the decode depth and is read from the chunk data
+	 */
+	if( libevtx_record_get_chunk_data(
+	     internal_record,
+	     &chunk_data,
+	     &chunk_data_buffer,
+	     &chunk_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_record = (libevtx_internal_record_t *) record;
-
-	if( libevtx_record_values_get_event_identifier(
+	if( libevtx_record_values_read_xml_document(
 	     internal_record->record_values,
-	     event_identifier,
+	     internal_record->io_handle,
+	     chunk_data,
+	     chunk_data_size,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values XML document.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_record->record_values->is_partially_decoded != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event identifier from record values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record - partially decoded since it exceeds the decode budget.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( chunk_data_buffer != NULL )
+	{
+		memory_free(
+		 chunk_data_buffer );
 	}
 	return( 1 );
+
+on_error:
+	if( chunk_data_buffer != NULL )
+	{
+		memory_free(
+		 chunk_data_buffer );
+	}
+	return( -1 );
 }
 
-/* Retrieves the event identifier qualifiers
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Transcodes the binary XML of the record values into the UTF-8 encoded XML string
+ * if the file was opened with XML transcoding and the XML document was not read before
+ * Returns 1 if successful, 0 if the XML string should be rendered from the XML document or -1 on error
  */
-int libevtx_record_get_event_identifier_qualifiers(
-     libevtx_record_t *record,
-     uint32_t *event_identifier_qualifiers,
+int libevtx_record_transcode_utf8_xml_string(
+     libevtx_internal_record_t *internal_record,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_event_identifier_qualifiers";
-	int result                                 = 0;
+	const uint8_t *chunk_data  = NULL;
+	uint8_t *chunk_data_buffer = NULL;
+	static char *function      = "libevtx_record_transcode_utf8_xml_string";
+	size_t chunk_data_size     = 0;
+	int result                 = 0;
 
-	if( record == NULL )
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -465,11 +613,54 @@ int libevtx_record_get_event_identifier_qualifiers(
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
 
-	result = libevtx_record_values_get_event_identifier_qualifiers(
+		return( -1 );
+	}
+	if( internal_record->record_values->utf8_xml_string != NULL )
+	{
+		return( 1 );
+	}
+	if( ( internal_record->io_handle == NULL )
+	 || ( ( internal_record->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_TRANSCODE_XML ) == 0 ) )
+	{
+		return( 0 );
+	}
+	/* A partially decoded record is not transcoded, reading its XML document fails instead
+	 */
+	if( ( internal_record->record_values->xml_document != NULL )
+	 || ( internal_record->record_values->is_partially_decoded != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_record_get_chunk_data(
+	     internal_record,
+	     &chunk_data,
+	     &chunk_data_buffer,
+	     &chunk_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevtx_record_values_transcode_utf8_xml_string(
 	          internal_record->record_values,
-	          event_identifier_qualifiers,
+	          internal_record->io_handle,
+	          chunk_data,
+	          chunk_data_size,
 	          error );
 
 	if( result == -1 )
@@ -477,25 +668,38 @@ int libevtx_record_get_event_identifier_qualifiers(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event identifier qualifiers from record values.",
+		 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+		 "%s: unable to transcode record values to UTF-8 XML string.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( chunk_data_buffer != NULL )
+	{
+		memory_free(
+		 chunk_data_buffer );
 	}
 	return( result );
+
+on_error:
+	if( chunk_data_buffer != NULL )
+	{
+		memory_free(
+		 chunk_data_buffer );
+	}
+	return( -1 );
 }
 
-/* Retrieves the event level
+/* Retrieves the offset
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_event_level(
+int libevtx_record_get_offset(
      libevtx_record_t *record,
-     uint8_t *event_level,
+     off64_t *offset,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_event_level";
+	static char *function                      = "libevtx_record_get_offset";
 
 	if( record == NULL )
 	{
@@ -510,34 +714,2748 @@ int libevtx_record_get_event_level(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_event_level(
-	     internal_record->record_values,
-	     event_level,
-	     error ) != 1 )
+	if( internal_record->record_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event level from record values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_record->record_values->offset;
+
+	return( 1 );
+}
+
+/* Determines if the record is partially decoded
+ * A record is partially decoded when it exceeds the decode budget, only the values
+ * of its event record header are available
+ * Returns 1 if partially decoded, 0 if not or -1 on error
+ */
+int libevtx_record_is_partially_decoded(
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_is_partially_decoded";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->record_values->is_partially_decoded != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the size
+ * The size includes the event record header and trailing size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_size(
+     libevtx_record_t *record,
+     uint32_t *size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = internal_record->record_values->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the raw data
+ * The raw data contains the event record header, the binary XML and the trailing size
+ * and is not decoded. The data references the memory mapped data if available, otherwise
+ * it is read into a buffer of the record. The data remains valid until the raw data
+ * is retrieved again or the record is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_raw_data(
+     libevtx_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	uint8_t *reallocation                      = NULL;
+	static char *function                      = "libevtx_record_get_raw_data";
+	size_t record_data_size                    = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->record_values->offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record - record values offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	record_data_size = (size_t) internal_record->record_values->data_size;
+
+	if( ( internal_record->io_handle->mapped_data != NULL )
+	 && ( (size64_t) internal_record->record_values->offset <= internal_record->io_handle->mapped_data_size )
+	 && ( (size64_t) record_data_size <= ( internal_record->io_handle->mapped_data_size - (size64_t) internal_record->record_values->offset ) ) )
+	{
+		*data      = &( internal_record->io_handle->mapped_data[ internal_record->record_values->offset ] );
+		*data_size = record_data_size;
+
+		return( 1 );
+	}
+	if( internal_record->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size == 0 )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record - record values data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size > internal_record->raw_data_buffer_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_record->raw_data_buffer,
+		                            sizeof( uint8_t ) * record_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize raw data buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record->raw_data_buffer      = reallocation;
+		internal_record->raw_data_buffer_size = record_data_size;
+	}
+	if( libevtx_io_handle_read_data_at_offset(
+	     internal_record->io_handle,
+	     internal_record->file_io_handle,
+	     internal_record->record_values->offset,
+	     internal_record->raw_data_buffer,
+	     record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data at offset: %" PRIi64 ".",
+		 function,
+		 internal_record->record_values->offset );
+
+		return( -1 );
+	}
+	*data      = internal_record->raw_data_buffer;
+	*data_size = record_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the content hash
+ * The content hash is the 64-bit xxHash (XXH64) of the data of the record, including
+ * its header with the identifier and written time, and its binary XML. The data is not decoded.
+ * Copies of the same record in different files, such as backups and volume shadow copies,
+ * have the same content hash
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_content_hash(
+     libevtx_record_t *record,
+     uint64_t *content_hash,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	uint8_t *record_data                       = NULL;
+	uint8_t *record_data_buffer                = NULL;
+	static char *function                      = "libevtx_record_get_content_hash";
+	size_t record_data_size                    = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->record_values->offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record - record values offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+	record_data_size = (size_t) internal_record->record_values->data_size;
+
+	if( ( internal_record->io_handle->mapped_data != NULL )
+	 && ( (size64_t) internal_record->record_values->offset <= internal_record->io_handle->mapped_data_size )
+	 && ( (size64_t) record_data_size <= ( internal_record->io_handle->mapped_data_size - (size64_t) internal_record->record_values->offset ) ) )
+	{
+		record_data = &( internal_record->io_handle->mapped_data[ internal_record->record_values->offset ] );
+	}
+	else
+	{
+		if( internal_record->file_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid record - missing file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( record_data_size == 0 )
+		 || ( record_data_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record - record values data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		record_data_buffer = (uint8_t *) memory_allocate(
+		                                  sizeof( uint8_t ) * record_data_size );
+
+		if( record_data_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_io_handle_read_data_at_offset(
+		     internal_record->io_handle,
+		     internal_record->file_io_handle,
+		     internal_record->record_values->offset,
+		     record_data_buffer,
+		     record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record data at offset: %" PRIi64 ".",
+			 function,
+			 internal_record->record_values->offset );
+
+			goto on_error;
+		}
+		record_data = record_data_buffer;
+	}
+	if( libevtx_checksum_calculate_xxhash64(
+	     content_hash,
+	     record_data,
+	     record_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate content hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data_buffer != NULL )
+	{
+		memory_free(
+		 record_data_buffer );
+	}
+	return( 1 );
+
+on_error:
+	if( record_data_buffer != NULL )
+	{
+		memory_free(
+		 record_data_buffer );
+	}
+	return( -1 );
+}
+
+/* Retrieves the identifier (record number)
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_identifier(
+     libevtx_record_t *record,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_identifier";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier = internal_record->record_values->identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the 64-bit FILETIME value containing the written time
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_written_time(
+     libevtx_record_t *record,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_written_time";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	*filetime = internal_record->record_values->written_time;
+
+	return( 1 );
+}
+
+/* Retrieves the event identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_event_identifier(
+     libevtx_record_t *record,
+     uint32_t *event_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_event_identifier";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libevtx_record_values_get_event_identifier(
+	     internal_record->record_values,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the event identifier qualifiers
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_event_identifier_qualifiers(
+     libevtx_record_t *record,
+     uint32_t *event_identifier_qualifiers,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_event_identifier_qualifiers";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_event_identifier_qualifiers(
+	          internal_record->record_values,
+	          event_identifier_qualifiers,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the event level
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_event_level(
+     libevtx_record_t *record,
+     uint8_t *event_level,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_event_level";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libevtx_record_values_get_event_level(
+	     internal_record->record_values,
+	     event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the event task
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_task(
+     libevtx_record_t *record,
+     uint16_t *task,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_task";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_task(
+	          internal_record->record_values,
+	          task,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event task from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the event opcode
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_opcode(
+     libevtx_record_t *record,
+     uint8_t *opcode,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_opcode";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_opcode(
+	          internal_record->record_values,
+	          opcode,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event opcode from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the event keywords
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_keywords(
+     libevtx_record_t *record,
+     uint64_t *keywords,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_keywords";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_keywords(
+	          internal_record->record_values,
+	          keywords,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event keywords from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the event version
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_event_version(
+     libevtx_record_t *record,
+     uint8_t *event_version,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_event_version";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_event_version(
+	          internal_record->record_values,
+	          event_version,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event version from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the provider identifier
+ * The identifier is a little-endian GUID and is 16 bytes of size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_provider_identifier(
+     libevtx_record_t *record,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_provider_identifier";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_provider_identifier(
+	          internal_record->record_values,
+	          guid_data,
+	          guid_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded provider identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_provider_identifier_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_provider_identifier_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_provider_identifier_size(
+	          internal_record->record_values,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded provider identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_provider_identifier(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_provider_identifier";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_provider_identifier(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded provider identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_provider_identifier_size(
+     libevtx_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_provider_identifier_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_provider_identifier_size(
+	          internal_record->record_values,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded provider identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_provider_identifier(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_provider_identifier";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_provider_identifier(
+	          internal_record->record_values,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded source name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_source_name_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_source_name_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_source_name_size(
+	          internal_record->record_values,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of source name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded source name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_source_name(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_source_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_source_name(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy source name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded source name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_source_name_size(
+     libevtx_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_source_name_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_source_name_size(
+	          internal_record->record_values,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of source name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded source name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_source_name(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_source_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_source_name(
+	          internal_record->record_values,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy source name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded computer name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_computer_name_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_computer_name_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_computer_name_size(
+	          internal_record->record_values,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of computer name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded computer name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_computer_name(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_computer_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_computer_name(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded computer name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_computer_name_size(
+     libevtx_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_computer_name_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_computer_name_size(
+	          internal_record->record_values,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of computer name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded computer name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_computer_name(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_computer_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_computer_name(
+	          internal_record->record_values,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded channel name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_channel_name_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_channel_name_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_channel_name_size(
+	          internal_record->record_values,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of channel name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded channel name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_channel_name(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_channel_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_channel_name(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy channel name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded channel name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_channel_name_size(
+     libevtx_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_channel_name_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_channel_name_size(
+	          internal_record->record_values,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of channel name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded channel name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_channel_name(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_channel_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_channel_name(
+	          internal_record->record_values,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy channel name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the string identifier of an interned System string value
+ * The string value is interned in the string table of the IO handle
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_interned_string_identifier(
+     libevtx_internal_record_t *internal_record,
+     int string_type,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string_buffer[ 256 ];
+
+	uint8_t *utf8_string        = NULL;
+	static char *function       = "libevtx_record_get_interned_string_identifier";
+	size_t utf8_string_size     = 0;
+	uint8_t system_values_flags = 0;
+	int result                  = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( string_type )
+	{
+		case LIBEVTX_INTERNED_STRING_TYPE_SOURCE_NAME:
+			system_values_flags = 0;
+			break;
+
+		case LIBEVTX_INTERNED_STRING_TYPE_COMPUTER_NAME:
+			system_values_flags = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME;
+			break;
+
+		case LIBEVTX_INTERNED_STRING_TYPE_CHANNEL_NAME:
+			system_values_flags = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported string type.",
+			 function );
+
+			return( -1 );
+	}
+	if( string_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->io_handle->string_table == NULL )
+	{
+		return( 0 );
+	}
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     system_values_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	switch( string_type )
+	{
+		case LIBEVTX_INTERNED_STRING_TYPE_SOURCE_NAME:
+			result = libevtx_record_values_get_utf8_source_name_size(
+			          internal_record->record_values,
+			          &utf8_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_INTERNED_STRING_TYPE_COMPUTER_NAME:
+			result = libevtx_record_values_get_utf8_computer_name_size(
+			          internal_record->record_values,
+			          &utf8_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_INTERNED_STRING_TYPE_CHANNEL_NAME:
+			result = libevtx_record_values_get_utf8_channel_name_size(
+			          internal_record->record_values,
+			          &utf8_string_size,
+			          error );
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( utf8_string_size <= 256 )
+	{
+		utf8_string = utf8_string_buffer;
+	}
+	else
+	{
+		if( utf8_string_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	switch( string_type )
+	{
+		case LIBEVTX_INTERNED_STRING_TYPE_SOURCE_NAME:
+			result = libevtx_record_values_get_utf8_source_name(
+			          internal_record->record_values,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_INTERNED_STRING_TYPE_COMPUTER_NAME:
+			result = libevtx_record_values_get_utf8_computer_name(
+			          internal_record->record_values,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+			break;
+
+		case LIBEVTX_INTERNED_STRING_TYPE_CHANNEL_NAME:
+			result = libevtx_record_values_get_utf8_channel_name(
+			          internal_record->record_values,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_string_table_intern_utf8_string(
+	     internal_record->io_handle->string_table,
+	     utf8_string,
+	     utf8_string_size,
+	     string_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to intern UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string != utf8_string_buffer )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( 1 );
+
+on_error:
+	if( ( utf8_string != NULL )
+	 && ( utf8_string != utf8_string_buffer ) )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves the string identifier of the source name
+ * The identifier refers to an interned string of the file, refer to libevtx_file_get_utf8_interned_string
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_source_name_identifier(
+     libevtx_record_t *record,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_get_source_name_identifier";
+	int result            = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_get_interned_string_identifier(
+	          (libevtx_internal_record_t *) record,
+	          LIBEVTX_INTERNED_STRING_TYPE_SOURCE_NAME,
+	          string_identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string identifier of source name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the string identifier of the computer name
+ * The identifier refers to an interned string of the file, refer to libevtx_file_get_utf8_interned_string
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_computer_name_identifier(
+     libevtx_record_t *record,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_get_computer_name_identifier";
+	int result            = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_get_interned_string_identifier(
+	          (libevtx_internal_record_t *) record,
+	          LIBEVTX_INTERNED_STRING_TYPE_COMPUTER_NAME,
+	          string_identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string identifier of computer name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the string identifier of the channel name
+ * The identifier refers to an interned string of the file, refer to libevtx_file_get_utf8_interned_string
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_channel_name_identifier(
+     libevtx_record_t *record,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_get_channel_name_identifier";
+	int result            = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_get_interned_string_identifier(
+	          (libevtx_internal_record_t *) record,
+	          LIBEVTX_INTERNED_STRING_TYPE_CHANNEL_NAME,
+	          string_identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string identifier of channel name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded user security identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_user_security_identifier_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_user_security_identifier_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_user_security_identifier_size(
+	          internal_record->record_values,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of user security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded user security identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_user_security_identifier(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_user_security_identifier";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_user_security_identifier(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded user security identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_user_security_identifier_size(
+     libevtx_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_user_security_identifier_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_user_security_identifier_size(
+	          internal_record->record_values,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of user security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded user security identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_user_security_identifier(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_user_security_identifier";
+	int result                                 = 0;
 
-/* Retrieves the size of the UTF-8 encoded provider identifier
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_user_security_identifier(
+	          internal_record->record_values,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the process identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_process_identifier(
+     libevtx_record_t *record,
+     uint32_t *process_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_process_identifier";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_process_identifier(
+	          internal_record->record_values,
+	          process_identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve process identifier from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the thread identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_thread_identifier(
+     libevtx_record_t *record,
+     uint32_t *thread_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_thread_identifier";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_thread_identifier(
+	          internal_record->record_values,
+	          thread_identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thread identifier from record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded activity identifier
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_utf8_provider_identifier_size(
+int libevtx_record_get_utf8_activity_identifier_size(
      libevtx_record_t *record,
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_provider_identifier_size";
+	static char *function                      = "libevtx_record_get_utf8_activity_identifier_size";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -553,7 +3471,22 @@ int libevtx_record_get_utf8_provider_identifier_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_provider_identifier_size(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_activity_identifier_size(
 	          internal_record->record_values,
 	          utf8_string_size,
 	          error );
@@ -564,7 +3497,7 @@ int libevtx_record_get_utf8_provider_identifier_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of provider identifier.",
+		 "%s: unable to retrieve UTF-8 string size of activity identifier.",
 		 function );
 
 		return( -1 );
@@ -572,18 +3505,18 @@ int libevtx_record_get_utf8_provider_identifier_size(
 	return( result );
 }
 
-/* Retrieves the UTF-8 encoded provider identifier
+/* Retrieves the UTF-8 encoded activity identifier
  * The size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_utf8_provider_identifier(
+int libevtx_record_get_utf8_activity_identifier(
      libevtx_record_t *record,
      uint8_t *utf8_string,
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_provider_identifier";
+	static char *function                      = "libevtx_record_get_utf8_activity_identifier";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -599,7 +3532,22 @@ int libevtx_record_get_utf8_provider_identifier(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_provider_identifier(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf8_activity_identifier(
 	          internal_record->record_values,
 	          utf8_string,
 	          utf8_string_size,
@@ -611,7 +3559,7 @@ int libevtx_record_get_utf8_provider_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider identifier to UTF-8 string.",
+		 "%s: unable to copy activity identifier to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -619,17 +3567,17 @@ int libevtx_record_get_utf8_provider_identifier(
 	return( result );
 }
 
-/* Retrieves the size of the UTF-16 encoded provider identifier
+/* Retrieves the size of the UTF-16 encoded activity identifier
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_utf16_provider_identifier_size(
+int libevtx_record_get_utf16_activity_identifier_size(
      libevtx_record_t *record,
      size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_provider_identifier_size";
+	static char *function                      = "libevtx_record_get_utf16_activity_identifier_size";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -645,7 +3593,22 @@ int libevtx_record_get_utf16_provider_identifier_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf16_provider_identifier_size(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_activity_identifier_size(
 	          internal_record->record_values,
 	          utf16_string_size,
 	          error );
@@ -656,7 +3619,7 @@ int libevtx_record_get_utf16_provider_identifier_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of provider identifier.",
+		 "%s: unable to retrieve UTF-16 string size of activity identifier.",
 		 function );
 
 		return( -1 );
@@ -664,18 +3627,18 @@ int libevtx_record_get_utf16_provider_identifier_size(
 	return( result );
 }
 
-/* Retrieves the UTF-16 encoded provider identifier
+/* Retrieves the UTF-16 encoded activity identifier
  * The size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_utf16_provider_identifier(
+int libevtx_record_get_utf16_activity_identifier(
      libevtx_record_t *record,
      uint16_t *utf16_string,
      size_t utf16_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_provider_identifier";
+	static char *function                      = "libevtx_record_get_utf16_activity_identifier";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -691,7 +3654,22 @@ int libevtx_record_get_utf16_provider_identifier(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf16_provider_identifier(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_utf16_activity_identifier(
 	          internal_record->record_values,
 	          utf16_string,
 	          utf16_string_size,
@@ -703,7 +3681,7 @@ int libevtx_record_get_utf16_provider_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider identifier to UTF-16 string.",
+		 "%s: unable to copy activity identifier to UTF-16 string.",
 		 function );
 
 		return( -1 );
@@ -711,17 +3689,18 @@ int libevtx_record_get_utf16_provider_identifier(
 	return( result );
 }
 
-/* Retrieves the size of the UTF-8 encoded source name
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Parses the record data with a template definition
+ * This function needs to be called before accessing the strings otherwise
+ * the record data will be parsed without a template definition by default
+ * Returns 1 if successful, 0 if data could not be parsed or -1 on error
  */
-int libevtx_record_get_utf8_source_name_size(
+int libevtx_record_parse_data_with_template_definition(
      libevtx_record_t *record,
-     size_t *utf8_string_size,
+     libevtx_template_definition_t *template_definition,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_source_name_size";
+	static char *function                      = "libevtx_record_parse_data_with_template_definition";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -737,9 +3716,36 @@ int libevtx_record_get_utf8_source_name_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_source_name_size(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_parse_data(
 	          internal_record->record_values,
-	          utf8_string_size,
+	          internal_record->io_handle,
+	          (libevtx_internal_template_definition_t *) template_definition,
 	          error );
 
 	if( result == -1 )
@@ -747,8 +3753,8 @@ int libevtx_record_get_utf8_source_name_size(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of source name.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse data.",
 		 function );
 
 		return( -1 );
@@ -756,19 +3762,16 @@ int libevtx_record_get_utf8_source_name_size(
 	return( result );
 }
 
-/* Retrieves the UTF-8 encoded source name
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf8_source_name(
+int libevtx_record_get_number_of_strings(
      libevtx_record_t *record,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     int *number_of_strings,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_source_name";
-	int result                                 = 0;
+	static char *function                      = "libevtx_record_get_number_of_strings";
 
 	if( record == NULL )
 	{
@@ -783,38 +3786,51 @@ int libevtx_record_get_utf8_source_name(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_source_name(
-	          internal_record->record_values,
-	          utf8_string,
-	          utf8_string_size,
-	          error );
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+
+	if( libevtx_record_values_get_number_of_strings(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     number_of_strings,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy source name to UTF-8 string.",
+		 "%s: unable to retrieve number of strings.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded source name
+/* Retrieves the size of a specific UTF-8 encoded string
  * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf16_source_name_size(
+int libevtx_record_get_utf8_string_size(
      libevtx_record_t *record,
-     size_t *utf16_string_size,
+     int string_index,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_source_name_size";
-	int result                                 = 0;
+	static char *function                      = "libevtx_record_get_utf8_string_size";
 
 	if( record == NULL )
 	{
@@ -829,38 +3845,54 @@ int libevtx_record_get_utf16_source_name_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf16_source_name_size(
-	          internal_record->record_values,
-	          utf16_string_size,
-	          error );
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+
+	if( libevtx_record_values_get_utf8_string_size(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of source name.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve size of UTF-8 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded source name
+/* Retrieves a specific UTF-8 encoded string
  * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf16_source_name(
+int libevtx_record_get_utf8_string(
      libevtx_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_source_name";
-	int result                                 = 0;
+	static char *function                      = "libevtx_record_get_utf8_string";
 
 	if( record == NULL )
 	{
@@ -875,38 +3907,58 @@ int libevtx_record_get_utf16_source_name(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf16_source_name(
-	          internal_record->record_values,
-	          utf16_string,
-	          utf16_string_size,
-	          error );
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+
+	if( libevtx_record_values_get_utf8_string(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy source name to UTF-16 string.",
-		 function );
+		 "%s: unable to retrieve UTF-8 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded computer name
+/* Retrieves the size of the first UTF-8 encoded string with a specific name
+ * The name is the value of the Name attribute of the Data element, the name is compared case sensitive
  * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+ * Returns 1 if successful, 0 if no such string or -1 on error
  */
-int libevtx_record_get_utf8_computer_name_size(
+int libevtx_record_get_utf8_string_size_by_name(
      libevtx_record_t *record,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_computer_name_size";
+	static char *function                      = "libevtx_record_get_utf8_string_size_by_name";
 	int result                                 = 0;
+	int string_index                           = 0;
 
 	if( record == NULL )
 	{
@@ -921,9 +3973,26 @@ int libevtx_record_get_utf8_computer_name_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_computer_name_size(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_string_index_by_utf8_name(
 	          internal_record->record_values,
-	          utf8_string_size,
+	          internal_record->io_handle,
+	          utf8_name,
+	          utf8_name_length,
+	          &string_index,
 	          error );
 
 	if( result == -1 )
@@ -932,27 +4001,52 @@ int libevtx_record_get_utf8_computer_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of computer name.",
+		 "%s: unable to retrieve string index by name.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libevtx_record_values_get_utf8_string_size(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d size.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded computer name
+/* Retrieves the first UTF-8 encoded string with a specific name
+ * The name is the value of the Name attribute of the Data element, the name is compared case sensitive
  * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+ * Returns 1 if successful, 0 if no such string or -1 on error
  */
-int libevtx_record_get_utf8_computer_name(
+int libevtx_record_get_utf8_string_by_name(
      libevtx_record_t *record,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
      uint8_t *utf8_string,
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_computer_name";
+	static char *function                      = "libevtx_record_get_utf8_string_by_name";
 	int result                                 = 0;
+	int string_index                           = 0;
 
 	if( record == NULL )
 	{
@@ -967,10 +4061,26 @@ int libevtx_record_get_utf8_computer_name(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_computer_name(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_string_index_by_utf8_name(
 	          internal_record->record_values,
-	          utf8_string,
-	          utf8_string_size,
+	          internal_record->io_handle,
+	          utf8_name,
+	          utf8_name_length,
+	          &string_index,
 	          error );
 
 	if( result == -1 )
@@ -978,27 +4088,51 @@ int libevtx_record_get_utf8_computer_name(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy computer name to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string index by name.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libevtx_record_values_get_utf8_string(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded computer name
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves all UTF-8 encoded strings
+ * The buffers are owned by the record and the string sizes include the end of string character
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf16_computer_name_size(
+int libevtx_record_get_utf8_strings(
      libevtx_record_t *record,
-     size_t *utf16_string_size,
+     const uint8_t **utf8_strings,
+     int *number_of_strings,
+     const size_t **utf8_string_offsets,
+     const size_t **utf8_string_sizes,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_computer_name_size";
-	int result                                 = 0;
+	static char *function                      = "libevtx_record_get_utf8_strings";
 
 	if( record == NULL )
 	{
@@ -1013,101 +4147,124 @@ int libevtx_record_get_utf16_computer_name_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf16_computer_name_size(
-	          internal_record->record_values,
-	          utf16_string_size,
-	          error );
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( libevtx_record_values_get_utf8_strings(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     utf8_strings,
+	     number_of_strings,
+	     utf8_string_offsets,
+	     utf8_string_sizes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of computer name.",
+		 "%s: unable to retrieve UTF-8 strings.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded computer name
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Formats the message of the record using a message resolver
+ * If the UTF-8 string is NULL only the formatted string size is determined
+ * The formatted string size includes the end of string character
+ * Returns 1 if successful, 0 if no message is available or -1 on error
  */
-int libevtx_record_get_utf16_computer_name(
-     libevtx_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+int libevtx_record_format_message(
+     libevtx_internal_record_t *internal_record,
+     libevtx_message_resolver_t *message_resolver,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *formatted_string_size,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_computer_name";
-	int result                                 = 0;
+	uint8_t provider_identifier[ 16 ];
+
+	const size_t *utf8_string_offsets    = NULL;
+	const size_t *utf8_string_sizes      = NULL;
+	const uint8_t *utf8_strings          = NULL;
+	uint8_t *utf8_source_name            = NULL;
+	static char *function                = "libevtx_record_format_message";
+	size_t utf8_source_name_size         = 0;
+	uint32_t event_identifier            = 0;
+	uint32_t event_identifier_qualifiers = 0;
+	int number_of_strings                = 0;
+	int provider_identifier_result       = 0;
+	int result                           = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
 
-	if( record == NULL )
+		return( -1 );
+	}
+	if( message_resolver == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid message resolver.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
-
-	result = libevtx_record_values_get_utf16_computer_name(
-	          internal_record->record_values,
-	          utf16_string,
-	          utf16_string_size,
-	          error );
-
-	if( result == -1 )
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy computer name to UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( result );
-}
-
-/* Retrieves the size of the UTF-8 encoded user security identifier
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libevtx_record_get_utf8_user_security_identifier_size(
-     libevtx_record_t *record,
-     size_t *utf8_string_size,
-     libcerror_error_t **error )
-{
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_user_security_identifier_size";
-	int result                                 = 0;
+	provider_identifier_result = libevtx_record_values_get_provider_identifier(
+	                              internal_record->record_values,
+	                              provider_identifier,
+	                              16,
+	                              error );
 
-	if( record == NULL )
+	if( provider_identifier_result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_record = (libevtx_internal_record_t *) record;
-
-	result = libevtx_record_values_get_utf8_user_security_identifier_size(
+	result = libevtx_record_values_get_utf8_source_name_size(
 	          internal_record->record_values,
-	          utf8_string_size,
+	          &utf8_source_name_size,
 	          error );
 
 	if( result == -1 )
@@ -1116,45 +4273,108 @@ int libevtx_record_get_utf8_user_security_identifier_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of user security identifier.",
+		 "%s: unable to retrieve UTF-8 source name size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( result );
-}
+	else if( ( result != 0 )
+	      && ( utf8_source_name_size > 0 ) )
+	{
+		utf8_source_name = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * utf8_source_name_size );
 
-/* Retrieves the UTF-8 encoded user security identifier
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libevtx_record_get_utf8_user_security_identifier(
-     libevtx_record_t *record,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
-{
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_user_security_identifier";
-	int result                                 = 0;
+		if( utf8_source_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 source name.",
+			 function );
 
-	if( record == NULL )
+			goto on_error;
+		}
+		if( libevtx_record_values_get_utf8_source_name(
+		     internal_record->record_values,
+		     utf8_source_name,
+		     utf8_source_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 source name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		utf8_source_name_size = 0;
+	}
+	if( libevtx_record_values_get_event_identifier(
+	     internal_record->record_values,
+	     &event_identifier,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_record = (libevtx_internal_record_t *) record;
+	if( libevtx_record_values_get_event_identifier_qualifiers(
+	     internal_record->record_values,
+	     &event_identifier_qualifiers,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers.",
+		 function );
 
-	result = libevtx_record_values_get_utf8_user_security_identifier(
-	          internal_record->record_values,
+		goto on_error;
+	}
+	if( libevtx_record_values_get_utf8_strings(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     &utf8_strings,
+	     &number_of_strings,
+	     &utf8_string_offsets,
+	     &utf8_string_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 strings.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          ( provider_identifier_result != 0 ) ? provider_identifier : NULL,
+	          utf8_source_name,
+	          utf8_source_name_size,
+	          event_identifier,
+	          event_identifier_qualifiers,
+	          utf8_strings,
+	          number_of_strings,
+	          utf8_string_offsets,
+	          utf8_string_sizes,
 	          utf8_string,
 	          utf8_string_size,
+	          formatted_string_size,
 	          error );
 
 	if( result == -1 )
@@ -1162,27 +4382,42 @@ int libevtx_record_get_utf8_user_security_identifier(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy user security identifier to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to format message.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( utf8_source_name != NULL )
+	{
+		memory_free(
+		 utf8_source_name );
 	}
 	return( result );
+
+on_error:
+	if( utf8_source_name != NULL )
+	{
+		memory_free(
+		 utf8_source_name );
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded user security identifier
+/* Retrieves the size of the UTF-8 encoded formatted event message
+ * The message string is resolved by the message resolver and its substitutions are
+ * replaced by the strings of the record
  * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+ * Returns 1 if successful, 0 if no message is available or -1 on error
  */
-int libevtx_record_get_utf16_user_security_identifier_size(
+int libevtx_record_get_utf8_formatted_message_size(
      libevtx_record_t *record,
-     size_t *utf16_string_size,
+     libevtx_message_resolver_t *message_resolver,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_user_security_identifier_size";
-	int result                                 = 0;
+	static char *function = "libevtx_record_get_utf8_formatted_message_size";
+	int result            = 0;
 
 	if( record == NULL )
 	{
@@ -1195,11 +4430,23 @@ int libevtx_record_get_utf16_user_security_identifier_size(
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
 
-	result = libevtx_record_values_get_utf16_user_security_identifier_size(
-	          internal_record->record_values,
-	          utf16_string_size,
+		return( -1 );
+	}
+	result = libevtx_record_format_message(
+	          (libevtx_internal_record_t *) record,
+	          message_resolver,
+	          NULL,
+	          0,
+	          utf8_string_size,
 	          error );
 
 	if( result == -1 )
@@ -1208,7 +4455,7 @@ int libevtx_record_get_utf16_user_security_identifier_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of user security identifier.",
+		 "%s: unable to retrieve size of formatted message.",
 		 function );
 
 		return( -1 );
@@ -1216,19 +4463,22 @@ int libevtx_record_get_utf16_user_security_identifier_size(
 	return( result );
 }
 
-/* Retrieves the UTF-16 encoded user security identifier
+/* Retrieves the UTF-8 encoded formatted event message
+ * The message string is resolved by the message resolver and its substitutions are
+ * replaced by the strings of the record
  * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+ * Returns 1 if successful, 0 if no message is available or -1 on error
  */
-int libevtx_record_get_utf16_user_security_identifier(
+int libevtx_record_get_utf8_formatted_message(
      libevtx_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     libevtx_message_resolver_t *message_resolver,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_user_security_identifier";
-	int result                                 = 0;
+	static char *function        = "libevtx_record_get_utf8_formatted_message";
+	size_t formatted_string_size = 0;
+	int result                   = 0;
 
 	if( record == NULL )
 	{
@@ -1241,12 +4491,23 @@ int libevtx_record_get_utf16_user_security_identifier(
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
 
-	result = libevtx_record_values_get_utf16_user_security_identifier(
-	          internal_record->record_values,
-	          utf16_string,
-	          utf16_string_size,
+		return( -1 );
+	}
+	result = libevtx_record_format_message(
+	          (libevtx_internal_record_t *) record,
+	          message_resolver,
+	          utf8_string,
+	          utf8_string_size,
+	          &formatted_string_size,
 	          error );
 
 	if( result == -1 )
@@ -1254,8 +4515,8 @@ int libevtx_record_get_utf16_user_security_identifier(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy user security identifier to UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve formatted message.",
 		 function );
 
 		return( -1 );
@@ -1263,19 +4524,18 @@ int libevtx_record_get_utf16_user_security_identifier(
 	return( result );
 }
 
-/* Parses the record data with a template definition
- * This function needs to be called before accessing the strings otherwise
- * the record data will be parsed without a template definition by default
- * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+/* Retrieves the size of a specific UTF-16 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_parse_data_with_template_definition(
+int libevtx_record_get_utf16_string_size(
      libevtx_record_t *record,
-     libevtx_template_definition_t *template_definition,
+     int string_index,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_parse_data_with_template_definition";
-	int result                                 = 0;
+	static char *function                      = "libevtx_record_get_utf16_string_size";
 
 	if( record == NULL )
 	{
@@ -1290,47 +4550,54 @@ int libevtx_record_parse_data_with_template_definition(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( template_definition == NULL )
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid template definition.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
 		 function );
 
 		return( -1 );
 	}
-	result = libevtx_record_values_parse_data(
-	          internal_record->record_values,
-	          internal_record->io_handle,
-	          (libevtx_internal_template_definition_t *) template_definition,
-	          error );
 
-	if( result == -1 )
+	if( libevtx_record_values_get_utf16_string_size(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     utf16_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to parse data.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve size of UTF-16 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the number of strings
+/* Retrieves a specific UTF-16 encoded string
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_number_of_strings(
+int libevtx_record_get_utf16_string(
      libevtx_record_t *record,
-     int *number_of_strings,
+     int string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_number_of_strings";
+	static char *function                      = "libevtx_record_get_utf16_string";
 
 	if( record == NULL )
 	{
@@ -1345,36 +4612,54 @@ int libevtx_record_get_number_of_strings(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_number_of_strings(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libevtx_record_values_get_utf16_string(
 	     internal_record->record_values,
 	     internal_record->io_handle,
-	     number_of_strings,
+	     string_index,
+	     utf16_string,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve number of strings.",
-		 function );
+		 "%s: unable to retrieve UTF-16 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded string
+/* Retrieves the size of the UTF-8 encoded name of a specific string
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf8_string_size(
+int libevtx_record_get_utf8_string_name_size(
      libevtx_record_t *record,
      int string_index,
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_string_size";
+	static char *function                      = "libevtx_record_get_utf8_string_name_size";
 
 	if( record == NULL )
 	{
@@ -1389,7 +4674,21 @@ int libevtx_record_get_utf8_string_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf8_string_size(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_get_utf8_string_name_size(
 	     internal_record->record_values,
 	     internal_record->io_handle,
 	     string_index,
@@ -1399,8 +4698,8 @@ int libevtx_record_get_utf8_string_size(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve size of UTF-8 string: %d.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of UTF-8 string: %d name.",
 		 function,
 		 string_index );
 
@@ -1409,11 +4708,11 @@ int libevtx_record_get_utf8_string_size(
 	return( 1 );
 }
 
-/* Retrieves a specific UTF-8 encoded string
+/* Retrieves the UTF-8 encoded name of a specific string
  * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf8_string(
+int libevtx_record_get_utf8_string_name(
      libevtx_record_t *record,
      int string_index,
      uint8_t *utf8_string,
@@ -1421,7 +4720,7 @@ int libevtx_record_get_utf8_string(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_string";
+	static char *function                      = "libevtx_record_get_utf8_string_name";
 
 	if( record == NULL )
 	{
@@ -1436,7 +4735,21 @@ int libevtx_record_get_utf8_string(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf8_string(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_get_utf8_string_name(
 	     internal_record->record_values,
 	     internal_record->io_handle,
 	     string_index,
@@ -1447,8 +4760,8 @@ int libevtx_record_get_utf8_string(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve UTF-8 string: %d.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d name.",
 		 function,
 		 string_index );
 
@@ -1457,18 +4770,17 @@ int libevtx_record_get_utf8_string(
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-16 encoded string
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the size of the data
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_utf16_string_size(
+int libevtx_record_get_data_size(
      libevtx_record_t *record,
-     int string_index,
-     size_t *utf16_string_size,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_string_size";
+	static char *function                      = "libevtx_record_get_data_size";
+	int result                                 = 0;
 
 	if( record == NULL )
 	{
@@ -1483,39 +4795,53 @@ int libevtx_record_get_utf16_string_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf16_string_size(
-	     internal_record->record_values,
-	     internal_record->io_handle,
-	     string_index,
-	     utf16_string_size,
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_data_size(
+	          internal_record->record_values,
+	          internal_record->io_handle,
+	          data_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve size of UTF-16 string: %d.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve data size.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves a specific UTF-16 encoded string
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the data
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_utf16_string(
+int libevtx_record_get_data(
      libevtx_record_t *record,
-     int string_index,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_string";
+	static char *function                      = "libevtx_record_get_data";
+	int result                                 = 0;
 
 	if( record == NULL )
 	{
@@ -1530,37 +4856,55 @@ int libevtx_record_get_utf16_string(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf16_string(
-	     internal_record->record_values,
-	     internal_record->io_handle,
-	     string_index,
-	     utf16_string,
-	     utf16_string_size,
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libevtx_record_values_get_data(
+	          internal_record->record_values,
+	          internal_record->io_handle,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve UTF-16 string: %d.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve data.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the size of the data
+/* Retrieves a reference to the data
+ * The data is not copied into a caller provided buffer, the reference is owned
+ * by the record and is valid as long as the record is
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_data_size(
+int libevtx_record_get_data_reference(
      libevtx_record_t *record,
+     const uint8_t **data,
      size_t *data_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_data_size";
+	static char *function                      = "libevtx_record_get_data_reference";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -1576,9 +4920,24 @@ int libevtx_record_get_data_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_data_size(
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_data_reference(
 	          internal_record->record_values,
 	          internal_record->io_handle,
+	          data,
 	          data_size,
 	          error );
 
@@ -1587,8 +4946,8 @@ int libevtx_record_get_data_size(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve data size.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data reference.",
 		 function );
 
 		return( -1 );
@@ -1596,37 +4955,49 @@ int libevtx_record_get_data_size(
 	return( result );
 }
 
-/* Retrieves the data
+/* Retrieves a range of the data
+ * The range is copied from the data referenced by the record values
+ * so the data is not copied in its entirety
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_get_data(
+int libevtx_record_get_data_range(
      libevtx_record_t *record,
+     size_t data_offset,
      uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_data";
-	int result                                 = 0;
+	const uint8_t *value_data = NULL;
+	static char *function     = "libevtx_record_get_data_range";
+	size_t value_size         = 0;
+	int result                = 0;
 
-	if( record == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
-	result = libevtx_record_values_get_data(
-	          internal_record->record_values,
-	          internal_record->io_handle,
-	          data,
-	          data_size,
+		return( -1 );
+	}
+	result = libevtx_record_get_data_reference(
+	          record,
+	          &value_data,
+	          &value_size,
 	          error );
 
 	if( result == -1 )
@@ -1634,13 +5005,47 @@ int libevtx_record_get_data(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve data.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data reference.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( data_offset > value_size )
+	 || ( data_size > ( value_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset and size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     data,
+	     &( value_data[ data_offset ] ),
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
 /* Retrieves the size of the UTF-8 encoded XML string
@@ -1654,6 +5059,7 @@ int libevtx_record_get_utf8_xml_string_size(
 {
 	libevtx_internal_record_t *internal_record = NULL;
 	static char *function                      = "libevtx_record_get_utf8_xml_string_size";
+	int result                                 = 0;
 
 	if( record == NULL )
 	{
@@ -1668,6 +5074,42 @@ int libevtx_record_get_utf8_xml_string_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
+	/* The XML string is transcoded directly from the binary XML when enabled and possible
+	 * otherwise it is rendered from the XML document
+	 */
+	result = libevtx_record_transcode_utf8_xml_string(
+	          internal_record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+		 "%s: unable to transcode XML string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libevtx_record_read_xml_document(
+		     internal_record,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read XML document.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
 	if( libevtx_record_values_get_utf8_xml_string_size(
 	     internal_record->record_values,
 	     utf8_string_size,
@@ -1711,6 +5153,36 @@ int libevtx_record_get_utf8_xml_string(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The XML document is not needed if the XML string was retained
+	 */
+	if( internal_record->record_values->utf8_xml_string == NULL )
+	{
+		if( libevtx_record_read_xml_document(
+		     internal_record,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read XML document.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libevtx_record_values_get_utf8_xml_string(
 	     internal_record->record_values,
 	     utf8_string,
@@ -1754,6 +5226,21 @@ int libevtx_record_get_utf16_xml_string_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
 	if( libevtx_record_values_get_utf16_xml_string_size(
 	     internal_record->record_values,
 	     utf16_string_size,
@@ -1797,6 +5284,21 @@ int libevtx_record_get_utf16_xml_string(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
+	if( libevtx_record_read_xml_document(
+	     internal_record,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+
 	if( libevtx_record_values_get_utf16_xml_string(
 	     internal_record->record_values,
 	     utf16_string,
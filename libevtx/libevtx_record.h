@@ -29,6 +29,7 @@
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_message_resolver.h"
 #include "libevtx_record_values.h"
 #include "libevtx_types.h"
 
@@ -52,6 +53,14 @@ struct libevtx_internal_record
 	 */
 	libevtx_record_values_t *record_values;
 
+	/* The raw data buffer, used when the data is not memory mapped
+	 */
+	uint8_t *raw_data_buffer;
+
+	/* The allocated size of the raw data buffer
+	 */
+	size_t raw_data_buffer_size;
+
 	/* The flags
 	 */
 	uint8_t flags;
@@ -65,6 +74,28 @@ int libevtx_record_initialize(
      uint8_t flags,
      libcerror_error_t **error );
 
+int libevtx_record_get_chunk_data(
+     libevtx_internal_record_t *internal_record,
+     const uint8_t **chunk_data,
+     uint8_t **chunk_data_buffer,
+     size_t *chunk_data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_read_xml_document(
+     libevtx_internal_record_t *internal_record,
+     uint8_t system_values_flags,
+     libcerror_error_t **error );
+
+int libevtx_record_transcode_utf8_xml_string(
+     libevtx_internal_record_t *internal_record,
+     libcerror_error_t **error );
+
+int libevtx_record_get_interned_string_identifier(
+     libevtx_internal_record_t *internal_record,
+     int string_type,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_free(
      libevtx_record_t **record,
@@ -76,6 +107,30 @@ int libevtx_record_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_is_partially_decoded(
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_size(
+     libevtx_record_t *record,
+     uint32_t *size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_raw_data(
+     libevtx_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_content_hash(
+     libevtx_record_t *record,
+     uint64_t *content_hash,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_identifier(
      libevtx_record_t *record,
@@ -106,6 +161,37 @@ int libevtx_record_get_event_level(
      uint8_t *event_level,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_task(
+     libevtx_record_t *record,
+     uint16_t *task,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_opcode(
+     libevtx_record_t *record,
+     uint8_t *opcode,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_keywords(
+     libevtx_record_t *record,
+     uint64_t *keywords,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_event_version(
+     libevtx_record_t *record,
+     uint8_t *event_version,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_provider_identifier(
+     libevtx_record_t *record,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf8_provider_identifier_size(
      libevtx_record_t *record,
@@ -184,6 +270,50 @@ int libevtx_record_get_utf16_computer_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_channel_name_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_channel_name(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf16_channel_name_size(
+     libevtx_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf16_channel_name(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_source_name_identifier(
+     libevtx_record_t *record,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_computer_name_identifier(
+     libevtx_record_t *record,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_channel_name_identifier(
+     libevtx_record_t *record,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf8_user_security_identifier_size(
      libevtx_record_t *record,
@@ -210,6 +340,44 @@ int libevtx_record_get_utf16_user_security_identifier(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_process_identifier(
+     libevtx_record_t *record,
+     uint32_t *process_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_thread_identifier(
+     libevtx_record_t *record,
+     uint32_t *thread_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_activity_identifier_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_activity_identifier(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf16_activity_identifier_size(
+     libevtx_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf16_activity_identifier(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_parse_data_with_template_definition(
      libevtx_record_t *record,
@@ -237,6 +405,55 @@ int libevtx_record_get_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_string_size_by_name(
+     libevtx_record_t *record,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_string_by_name(
+     libevtx_record_t *record,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_strings(
+     libevtx_record_t *record,
+     const uint8_t **utf8_strings,
+     int *number_of_strings,
+     const size_t **utf8_string_offsets,
+     const size_t **utf8_string_sizes,
+     libcerror_error_t **error );
+
+int libevtx_record_format_message(
+     libevtx_internal_record_t *internal_record,
+     libevtx_message_resolver_t *message_resolver,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *formatted_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_formatted_message_size(
+     libevtx_record_t *record,
+     libevtx_message_resolver_t *message_resolver,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_formatted_message(
+     libevtx_record_t *record,
+     libevtx_message_resolver_t *message_resolver,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_string_size(
      libevtx_record_t *record,
@@ -252,6 +469,21 @@ int libevtx_record_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_string_name_size(
+     libevtx_record_t *record,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_string_name(
+     libevtx_record_t *record,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_data_size(
      libevtx_record_t *record,
@@ -265,6 +497,21 @@ int libevtx_record_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_data_reference(
+     libevtx_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_data_range(
+     libevtx_record_t *record,
+     size_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf8_xml_string_size(
      libevtx_record_t *record,
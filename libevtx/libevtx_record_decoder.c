@@ -0,0 +1,1262 @@
+/*
+ * Record decoder functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_definitions.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_libfwevt.h"
+#include "libevtx_record_decoder.h"
+#include "libevtx_record_values.h"
+
+/* Creates a record decoder
+ * The record decoder decodes the XML documents of the records that follow
+ * the record that was last read, in background threads
+ * Make sure the value record_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_initialize(
+     libevtx_record_decoder_t **record_decoder,
+     size_t chunk_size,
+     int depth,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_decoder_initialize";
+	size_t array_size     = 0;
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( depth <= 0 )
+	 || ( depth > LIBEVTX_MAXIMUM_BACKGROUND_DECODE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEVTX_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*record_decoder = memory_allocate_structure(
+	                   libevtx_record_decoder_t );
+
+	if( *record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_decoder,
+	     0,
+	     sizeof( libevtx_record_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record decoder.",
+		 function );
+
+		memory_free(
+		 *record_decoder );
+
+		*record_decoder = NULL;
+
+		return( -1 );
+	}
+	/* The depth is stored first so that the slots can be freed on error
+	 */
+	( *record_decoder )->depth             = depth;
+	( *record_decoder )->number_of_threads = number_of_threads;
+
+	array_size = sizeof( libevtx_record_decoder_slot_t ) * depth;
+
+	( *record_decoder )->slots = (libevtx_record_decoder_slot_t *) memory_allocate(
+	                                                                array_size );
+
+	if( ( *record_decoder )->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *record_decoder )->slots,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 ( *record_decoder )->slots );
+
+		( *record_decoder )->slots = NULL;
+
+		goto on_error;
+	}
+	( *record_decoder )->chunk_data = (uint8_t *) memory_allocate(
+	                                               chunk_size );
+
+	if( ( *record_decoder )->chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_decoder )->chunk_size        = chunk_size;
+	( *record_decoder )->chunk_file_offset = -1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	array_size = sizeof( libcthreads_thread_t * ) * number_of_threads;
+
+	( *record_decoder )->threads = (libcthreads_thread_t **) memory_allocate(
+	                                                          array_size );
+
+	if( ( *record_decoder )->threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *record_decoder )->threads,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		memory_free(
+		 ( *record_decoder )->threads );
+
+		( *record_decoder )->threads = NULL;
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *record_decoder )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *record_decoder )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 record_decoder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a record decoder
+ * The decode threads are stopped before the record decoder is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_free(
+     libevtx_record_decoder_t **record_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_decoder_free";
+	int result            = 1;
+	int slot_index        = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int thread_index      = 0;
+#endif
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_decoder != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( ( *record_decoder )->threads != NULL )
+		 && ( ( *record_decoder )->threads[ 0 ] != NULL ) )
+		{
+			if( libcthreads_mutex_grab(
+			     ( *record_decoder )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+			( *record_decoder )->abort = 1;
+
+			if( libcthreads_condition_broadcast(
+			     ( *record_decoder )->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     ( *record_decoder )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+			for( thread_index = 0;
+			     thread_index < ( *record_decoder )->number_of_threads;
+			     thread_index++ )
+			{
+				if( ( *record_decoder )->threads[ thread_index ] == NULL )
+				{
+					continue;
+				}
+				if( libcthreads_thread_join(
+				     &( ( *record_decoder )->threads[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join decode thread: %d.",
+					 function,
+					 thread_index );
+
+					/* The decode thread could still be using the record decoder
+					 */
+					return( -1 );
+				}
+			}
+		}
+		if( ( *record_decoder )->threads != NULL )
+		{
+			memory_free(
+			 ( *record_decoder )->threads );
+		}
+		if( ( *record_decoder )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *record_decoder )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *record_decoder )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *record_decoder )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *record_decoder )->slots != NULL )
+		{
+			for( slot_index = 0;
+			     slot_index < ( *record_decoder )->depth;
+			     slot_index++ )
+			{
+				if( ( *record_decoder )->slots[ slot_index ].record_values != NULL )
+				{
+					if( libevtx_record_values_free(
+					     &( ( *record_decoder )->slots[ slot_index ].record_values ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free record values of slot: %d.",
+						 function,
+						 slot_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *record_decoder )->slots );
+		}
+		if( ( *record_decoder )->chunk_data != NULL )
+		{
+			memory_free(
+			 ( *record_decoder )->chunk_data );
+		}
+		memory_free(
+		 *record_decoder );
+
+		*record_decoder = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decodes the queued records of the record decoder
+ * Records that cannot be decoded are marked as failed so that the consumer
+ * decodes and reports them itself
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_decode_thread(
+     libevtx_record_decoder_t *record_decoder )
+{
+	libevtx_io_handle_t io_handle;
+
+	libcerror_error_t *error            = NULL;
+	libevtx_record_decoder_slot_t *slot = NULL;
+	static char *function               = "libevtx_record_decoder_decode_thread";
+	int result                          = 0;
+	int slot_index                      = 0;
+
+	if( record_decoder == NULL )
+	{
+		return( -1 );
+	}
+	/* Every decode thread uses its own IO handle so that the statistics
+	 * of the IO handle of the file are not updated concurrently
+	 */
+	if( memory_set(
+	     &io_handle,
+	     0,
+	     sizeof( libevtx_io_handle_t ) ) == NULL )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     record_decoder->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		slot = NULL;
+
+		while( record_decoder->abort == 0 )
+		{
+			/* The queued record with the lowest index is decoded first
+			 * since it is the next one needed by the consumer
+			 */
+			for( slot_index = 0;
+			     slot_index < record_decoder->depth;
+			     slot_index++ )
+			{
+				if( ( record_decoder->slots[ slot_index ].state == LIBEVTX_RECORD_DECODER_SLOT_STATE_QUEUED )
+				 && ( ( slot == NULL )
+				  || ( record_decoder->slots[ slot_index ].record_index < slot->record_index ) ) )
+				{
+					slot = &( record_decoder->slots[ slot_index ] );
+				}
+			}
+			if( slot != NULL )
+			{
+				break;
+			}
+			if( libcthreads_condition_wait(
+			     record_decoder->condition,
+			     record_decoder->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 record_decoder->mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		if( record_decoder->abort != 0 )
+		{
+			libcthreads_mutex_release(
+			 record_decoder->mutex,
+			 NULL );
+
+			break;
+		}
+		slot->state = LIBEVTX_RECORD_DECODER_SLOT_STATE_DECODING;
+
+		io_handle.ascii_codepage = record_decoder->ascii_codepage;
+
+		if( libcthreads_mutex_release(
+		     record_decoder->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* The slot and the chunk data are not changed while a slot is being decoded
+		 */
+		result = libevtx_record_values_read_xml_document(
+		          slot->record_values,
+		          &io_handle,
+		          record_decoder->chunk_data,
+		          record_decoder->chunk_data_size,
+		          &error );
+
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     record_decoder->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			slot->state = LIBEVTX_RECORD_DECODER_SLOT_STATE_DECODED;
+		}
+		else
+		{
+			slot->state = LIBEVTX_RECORD_DECODER_SLOT_STATE_FAILED;
+		}
+		if( libcthreads_condition_broadcast(
+		     record_decoder->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 record_decoder->mutex,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_release(
+		     record_decoder->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Releases the slots of the record decoder
+ * Waits for the slots that are being decoded
+ * The mutex of the record decoder must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_release_slots(
+     libevtx_record_decoder_t *record_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_decoder_release_slots";
+	int result            = 1;
+	int slot_index        = 0;
+	int slots_in_use      = 0;
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		slots_in_use = 0;
+
+		for( slot_index = 0;
+		     slot_index < record_decoder->depth;
+		     slot_index++ )
+		{
+			if( record_decoder->slots[ slot_index ].state == LIBEVTX_RECORD_DECODER_SLOT_STATE_DECODING )
+			{
+				slots_in_use = 1;
+			}
+			else if( record_decoder->slots[ slot_index ].state != LIBEVTX_RECORD_DECODER_SLOT_STATE_UNUSED )
+			{
+				if( libevtx_record_values_free(
+				     &( record_decoder->slots[ slot_index ].record_values ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record values of slot: %d.",
+					 function,
+					 slot_index );
+
+					result = -1;
+				}
+				record_decoder->slots[ slot_index ].state = LIBEVTX_RECORD_DECODER_SLOT_STATE_UNUSED;
+			}
+		}
+		if( slots_in_use != 0 )
+		{
+			if( libcthreads_condition_wait(
+			     record_decoder->condition,
+			     record_decoder->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( slots_in_use != 0 );
+
+	record_decoder->chunk_file_offset = -1;
+
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Resets the record decoder
+ * Releases the records that were queued or decoded, for example when the
+ * chunks of the file were changed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_reset(
+     libevtx_record_decoder_t *record_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_decoder_reset";
+	int result            = 1;
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_decoder_release_slots(
+	     record_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release slots.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Schedules the records to decode ahead after a record of a chunk was read
+ * The first record index is the index of the record within the chunk that directly
+ * follows the record that was read
+ * The records that were queued or decoded are released when the chunk or the codepage changes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_schedule(
+     libevtx_record_decoder_t *record_decoder,
+     libevtx_chunk_t *chunk,
+     uint16_t first_record_index,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libevtx_record_decoder_schedule";
+	int result                                   = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libevtx_record_decoder_slot_t *slot          = NULL;
+	libevtx_record_values_t *chunk_record_values = NULL;
+	uint32_t next_record_index                   = 0;
+	uint16_t number_of_records                   = 0;
+	int decode_ahead_index                       = 0;
+	int record_is_scheduled                      = 0;
+	int slot_index                               = 0;
+	int thread_index                             = 0;
+#endif
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->data == NULL )
+	 || ( chunk->data_size > record_decoder->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk - data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libevtx_chunk_get_number_of_records(
+	     chunk,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records from chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index >= number_of_records )
+	{
+		return( 1 );
+	}
+	for( thread_index = 0;
+	     thread_index < record_decoder->number_of_threads;
+	     thread_index++ )
+	{
+		if( record_decoder->threads[ thread_index ] != NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_create(
+		     &( record_decoder->threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &libevtx_record_decoder_decode_thread,
+		     (void *) record_decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decode thread: %d.",
+			 function,
+			 thread_index );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The decode threads use a copy of the chunk data so that the chunk
+	 * can be evicted from the chunks cache while its records are decoded
+	 */
+	if( ( chunk->file_offset != record_decoder->chunk_file_offset )
+	 || ( ascii_codepage != record_decoder->ascii_codepage ) )
+	{
+		if( libevtx_record_decoder_release_slots(
+		     record_decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release slots.",
+			 function );
+
+			result = -1;
+		}
+		else if( memory_copy(
+		          record_decoder->chunk_data,
+		          chunk->data,
+		          chunk->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk data.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			record_decoder->chunk_data_size   = chunk->data_size;
+			record_decoder->chunk_file_offset = chunk->file_offset;
+			record_decoder->ascii_codepage    = ascii_codepage;
+		}
+	}
+	if( result == 1 )
+	{
+		/* Release the slots of records outside the decode-ahead window
+		 */
+		for( slot_index = 0;
+		     slot_index < record_decoder->depth;
+		     slot_index++ )
+		{
+			slot = &( record_decoder->slots[ slot_index ] );
+
+			if( ( slot->state != LIBEVTX_RECORD_DECODER_SLOT_STATE_UNUSED )
+			 && ( slot->state != LIBEVTX_RECORD_DECODER_SLOT_STATE_DECODING )
+			 && ( ( slot->record_index < first_record_index )
+			  || ( (int) slot->record_index >= ( (int) first_record_index + record_decoder->depth ) ) ) )
+			{
+				if( libevtx_record_values_free(
+				     &( slot->record_values ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record values of slot: %d.",
+					 function,
+					 slot_index );
+
+					result = -1;
+				}
+				slot->state = LIBEVTX_RECORD_DECODER_SLOT_STATE_UNUSED;
+			}
+		}
+	}
+	for( decode_ahead_index = 0;
+	     ( result == 1 ) && ( decode_ahead_index < record_decoder->depth );
+	     decode_ahead_index++ )
+	{
+		next_record_index = (uint32_t) first_record_index + decode_ahead_index;
+
+		if( next_record_index >= (uint32_t) number_of_records )
+		{
+			break;
+		}
+		record_is_scheduled = 0;
+		slot                = NULL;
+
+		for( slot_index = 0;
+		     slot_index < record_decoder->depth;
+		     slot_index++ )
+		{
+			if( record_decoder->slots[ slot_index ].state == LIBEVTX_RECORD_DECODER_SLOT_STATE_UNUSED )
+			{
+				if( slot == NULL )
+				{
+					slot = &( record_decoder->slots[ slot_index ] );
+				}
+			}
+			else if( record_decoder->slots[ slot_index ].record_index == (uint16_t) next_record_index )
+			{
+				record_is_scheduled = 1;
+
+				break;
+			}
+		}
+		if( record_is_scheduled != 0 )
+		{
+			continue;
+		}
+		if( slot == NULL )
+		{
+			break;
+		}
+		if( libevtx_chunk_get_record(
+		     chunk,
+		     (uint16_t) next_record_index,
+		     &chunk_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu32 " from chunk.",
+			 function,
+			 next_record_index );
+
+			result = -1;
+
+			break;
+		}
+		/* Records of which the XML document was already read are not decoded again
+		 */
+		if( chunk_record_values->xml_document != NULL )
+		{
+			continue;
+		}
+		if( libevtx_record_values_clone(
+		     &( slot->record_values ),
+		     chunk_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		slot->record_index = (uint16_t) next_record_index;
+		slot->state        = LIBEVTX_RECORD_DECODER_SLOT_STATE_QUEUED;
+	}
+	if( libcthreads_condition_broadcast(
+	     record_decoder->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Takes the XML document of a record that was decoded ahead
+ * Waits for the record if it is currently being decoded
+ * Records that are still queued are released since the consumer decodes
+ * them without waiting for a decode thread
+ * On success the caller takes over the ownership of the XML document
+ * Returns 1 if successful, 0 if the record was not decoded ahead or -1 on error
+ */
+int libevtx_record_decoder_take_xml_document(
+     libevtx_record_decoder_t *record_decoder,
+     off64_t chunk_file_offset,
+     uint16_t record_index,
+     libfwevt_xml_document_t **xml_document,
+     libcerror_error_t **error )
+{
+	static char *function               = "libevtx_record_decoder_take_xml_document";
+	int result                          = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libevtx_record_decoder_slot_t *slot = NULL;
+	int slot_index                      = 0;
+#endif
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_document != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML document value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( record_decoder->threads[ 0 ] == NULL )
+	{
+		return( 0 );
+	}
+	if( libcthreads_mutex_grab(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_file_offset == record_decoder->chunk_file_offset )
+	{
+		for( slot_index = 0;
+		     slot_index < record_decoder->depth;
+		     slot_index++ )
+		{
+			if( ( record_decoder->slots[ slot_index ].state != LIBEVTX_RECORD_DECODER_SLOT_STATE_UNUSED )
+			 && ( record_decoder->slots[ slot_index ].record_index == record_index ) )
+			{
+				slot = &( record_decoder->slots[ slot_index ] );
+
+				break;
+			}
+		}
+	}
+	if( slot != NULL )
+	{
+		while( slot->state == LIBEVTX_RECORD_DECODER_SLOT_STATE_DECODING )
+		{
+			if( libcthreads_condition_wait(
+			     record_decoder->condition,
+			     record_decoder->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( slot->state != LIBEVTX_RECORD_DECODER_SLOT_STATE_DECODING )
+		{
+			if( slot->state == LIBEVTX_RECORD_DECODER_SLOT_STATE_DECODED )
+			{
+				*xml_document = slot->record_values->xml_document;
+
+				slot->record_values->xml_document = NULL;
+
+				result = 1;
+			}
+			if( libevtx_record_values_free(
+			     &( slot->record_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values of slot: %d.",
+				 function,
+				 slot_index );
+
+				result = -1;
+			}
+			slot->state = LIBEVTX_RECORD_DECODER_SLOT_STATE_UNUSED;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( *xml_document != NULL )
+		{
+			libfwevt_xml_document_free(
+			 xml_document,
+			 NULL );
+		}
+		return( -1 );
+	}
+	if( ( result == -1 )
+	 && ( *xml_document != NULL ) )
+	{
+		libfwevt_xml_document_free(
+		 xml_document,
+		 NULL );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,160 @@
+/*
+ * Record decoder functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBEVTX_RECORD_DECODER_H )
+#define _LIBEVTX_RECORD_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_libfwevt.h"
+#include "libevtx_record_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_record_decoder_slot libevtx_record_decoder_slot_t;
+
+struct libevtx_record_decoder_slot
+{
+	/* The record values
+	 * This is a copy of the record values of the chunk
+	 */
+	libevtx_record_values_t *record_values;
+
+	/* The index of the record within the chunk
+	 */
+	uint16_t record_index;
+
+	/* The state
+	 */
+	int state;
+};
+
+typedef struct libevtx_record_decoder libevtx_record_decoder_t;
+
+struct libevtx_record_decoder
+{
+	/* The codepage of the ASCII strings of the queued records
+	 */
+	int ascii_codepage;
+
+	/* The chunk data
+	 * This is a copy of the data of the chunk that contains the queued records
+	 */
+	uint8_t *chunk_data;
+
+	/* The chunk data size
+	 */
+	size_t chunk_data_size;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The file offset of the chunk
+	 * Contains -1 if not set
+	 */
+	off64_t chunk_file_offset;
+
+	/* The decode depth, the number of records decoded ahead
+	 */
+	int depth;
+
+	/* The slots, one for every record decoded ahead
+	 */
+	libevtx_record_decoder_slot_t *slots;
+
+	/* The number of decode threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate the decode threads should stop
+	 */
+	uint8_t abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the slots and the chunk data
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a change of the slot states
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The decode threads
+	 * Created when records are first scheduled
+	 */
+	libcthreads_thread_t **threads;
+#endif
+};
+
+int libevtx_record_decoder_initialize(
+     libevtx_record_decoder_t **record_decoder,
+     size_t chunk_size,
+     int depth,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libevtx_record_decoder_free(
+     libevtx_record_decoder_t **record_decoder,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libevtx_record_decoder_decode_thread(
+     libevtx_record_decoder_t *record_decoder );
+
+int libevtx_record_decoder_release_slots(
+     libevtx_record_decoder_t *record_decoder,
+     libcerror_error_t **error );
+
+#endif
+
+int libevtx_record_decoder_reset(
+     libevtx_record_decoder_t *record_decoder,
+     libcerror_error_t **error );
+
+int libevtx_record_decoder_schedule(
+     libevtx_record_decoder_t *record_decoder,
+     libevtx_chunk_t *chunk,
+     uint16_t first_record_index,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libevtx_record_decoder_take_xml_document(
+     libevtx_record_decoder_t *record_decoder,
+     off64_t chunk_file_offset,
+     uint16_t record_index,
+     libfwevt_xml_document_t **xml_document,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RECORD_DECODER_H ) */
+
@@ -0,0 +1,2380 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_definitions.h"
+#include "libevtx_filter_expression.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+#include "libevtx_record_filter.h"
+#include "libevtx_record_values.h"
+#include "libevtx_search_prefilter.h"
+#include "libevtx_system_values.h"
+#include "libevtx_value_filter.h"
+
+/* Creates a record filter
+ * Make sure the value record_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_initialize(
+     libevtx_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libevtx_record_filter_initialize";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = memory_allocate_structure(
+	                          libevtx_internal_record_filter_t );
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_filter,
+	     0,
+	     sizeof( libevtx_internal_record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record filter.",
+		 function );
+
+		goto on_error;
+	}
+	*record_filter = (libevtx_record_filter_t *) internal_record_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_filter != NULL )
+	{
+		memory_free(
+		 internal_record_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_free(
+     libevtx_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libevtx_record_filter_free";
+	int match_value_index                                    = 0;
+	int result                                               = 1;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		internal_record_filter = (libevtx_internal_record_filter_t *) *record_filter;
+		*record_filter         = NULL;
+
+		if( internal_record_filter->event_identifiers != NULL )
+		{
+			memory_free(
+			 internal_record_filter->event_identifiers );
+		}
+		if( internal_record_filter->channel_name != NULL )
+		{
+			memory_free(
+			 internal_record_filter->channel_name );
+		}
+		if( internal_record_filter->computer_name != NULL )
+		{
+			memory_free(
+			 internal_record_filter->computer_name );
+		}
+		if( internal_record_filter->expression != NULL )
+		{
+			if( libevtx_filter_expression_free(
+			     &( internal_record_filter->expression ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free expression.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_record_filter->search_prefilter != NULL )
+		{
+			if( libevtx_search_prefilter_free(
+			     &( internal_record_filter->search_prefilter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free search prefilter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_record_filter->match_values != NULL )
+		{
+			for( match_value_index = 0;
+			     match_value_index < internal_record_filter->number_of_match_values;
+			     match_value_index++ )
+			{
+				if( internal_record_filter->match_values[ match_value_index ].characters != NULL )
+				{
+					memory_free(
+					 internal_record_filter->match_values[ match_value_index ].characters );
+				}
+			}
+			memory_free(
+			 internal_record_filter->match_values );
+		}
+		memory_free(
+		 internal_record_filter );
+	}
+	return( result );
+}
+
+/* Appends an event identifier to match
+ * A record matches if its event identifier equals one of the appended event identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_append_event_identifier(
+     libevtx_record_filter_t *record_filter,
+     uint32_t event_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	uint32_t *reallocation                                   = NULL;
+	static char *function                                    = "libevtx_record_filter_append_event_identifier";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( (size_t) internal_record_filter->number_of_event_identifiers >= ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record filter - number of event identifiers value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = (uint32_t *) memory_reallocate(
+	                             internal_record_filter->event_identifiers,
+	                             sizeof( uint32_t ) * ( internal_record_filter->number_of_event_identifiers + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize event identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->event_identifiers = reallocation;
+
+	internal_record_filter->event_identifiers[ internal_record_filter->number_of_event_identifiers ] = event_identifier;
+
+	internal_record_filter->number_of_event_identifiers += 1;
+
+	return( 1 );
+}
+
+/* Sets the event level to match
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_event_level(
+     libevtx_record_filter_t *record_filter,
+     uint8_t event_level,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libevtx_record_filter_set_event_level";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	internal_record_filter->event_level = event_level;
+	internal_record_filter->flags      |= LIBEVTX_RECORD_FILTER_FLAG_HAS_EVENT_LEVEL;
+
+	return( 1 );
+}
+
+/* Sets the provider identifier to match
+ * The provider identifier is a little-endian GUID and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_provider_identifier(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libevtx_record_filter_set_provider_identifier";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_record_filter->provider_identifier,
+	     guid_data,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->flags |= LIBEVTX_RECORD_FILTER_FLAG_HAS_PROVIDER_IDENTIFIER;
+
+	return( 1 );
+}
+
+/* Sets the UTF-8 encoded channel name to match
+ * The channel name is compared case insensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_utf8_channel_name(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	uint16_t *channel_name                                   = NULL;
+	static char *function                                    = "libevtx_record_filter_set_utf8_channel_name";
+	size_t channel_name_size                                 = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     &channel_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine channel name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( channel_name_size == 0 )
+	 || ( channel_name_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid channel name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	channel_name = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * channel_name_size );
+
+	if( channel_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create channel name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     channel_name,
+	     channel_name_size,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy channel name.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_record_filter->channel_name != NULL )
+	{
+		memory_free(
+		 internal_record_filter->channel_name );
+	}
+	internal_record_filter->channel_name      = channel_name;
+	internal_record_filter->channel_name_size = channel_name_size;
+	internal_record_filter->flags            |= LIBEVTX_RECORD_FILTER_FLAG_HAS_CHANNEL_NAME;
+
+	return( 1 );
+
+on_error:
+	if( channel_name != NULL )
+	{
+		memory_free(
+		 channel_name );
+	}
+	return( -1 );
+}
+
+/* Sets the UTF-16 encoded channel name to match
+ * The channel name is compared case insensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_utf16_channel_name(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	uint16_t *channel_name                                   = NULL;
+	static char *function                                    = "libevtx_record_filter_set_utf16_channel_name";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length >= ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	channel_name = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * ( utf16_string_length + 1 ) );
+
+	if( channel_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create channel name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     channel_name,
+	     utf16_string,
+	     sizeof( uint16_t ) * utf16_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy channel name.",
+		 function );
+
+		memory_free(
+		 channel_name );
+
+		return( -1 );
+	}
+	channel_name[ utf16_string_length ] = 0;
+
+	if( internal_record_filter->channel_name != NULL )
+	{
+		memory_free(
+		 internal_record_filter->channel_name );
+	}
+	internal_record_filter->channel_name      = channel_name;
+	internal_record_filter->channel_name_size = utf16_string_length + 1;
+	internal_record_filter->flags            |= LIBEVTX_RECORD_FILTER_FLAG_HAS_CHANNEL_NAME;
+
+	return( 1 );
+}
+
+/* Sets the UTF-8 encoded computer name to match
+ * The computer name is compared case insensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_utf8_computer_name(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	uint16_t *computer_name                                  = NULL;
+	static char *function                                    = "libevtx_record_filter_set_utf8_computer_name";
+	size_t computer_name_size                                = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     &computer_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine computer name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( computer_name_size == 0 )
+	 || ( computer_name_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid computer name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	computer_name = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * computer_name_size );
+
+	if( computer_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create computer name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     computer_name,
+	     computer_name_size,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_record_filter->computer_name != NULL )
+	{
+		memory_free(
+		 internal_record_filter->computer_name );
+	}
+	internal_record_filter->computer_name      = computer_name;
+	internal_record_filter->computer_name_size = computer_name_size;
+	internal_record_filter->flags             |= LIBEVTX_RECORD_FILTER_FLAG_HAS_COMPUTER_NAME;
+
+	return( 1 );
+
+on_error:
+	if( computer_name != NULL )
+	{
+		memory_free(
+		 computer_name );
+	}
+	return( -1 );
+}
+
+/* Sets the UTF-16 encoded computer name to match
+ * The computer name is compared case insensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_utf16_computer_name(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	uint16_t *computer_name                                  = NULL;
+	static char *function                                    = "libevtx_record_filter_set_utf16_computer_name";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length >= ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	computer_name = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * ( utf16_string_length + 1 ) );
+
+	if( computer_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create computer name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     computer_name,
+	     utf16_string,
+	     sizeof( uint16_t ) * utf16_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name.",
+		 function );
+
+		memory_free(
+		 computer_name );
+
+		return( -1 );
+	}
+	computer_name[ utf16_string_length ] = 0;
+
+	if( internal_record_filter->computer_name != NULL )
+	{
+		memory_free(
+		 internal_record_filter->computer_name );
+	}
+	internal_record_filter->computer_name      = computer_name;
+	internal_record_filter->computer_name_size = utf16_string_length + 1;
+	internal_record_filter->flags             |= LIBEVTX_RECORD_FILTER_FLAG_HAS_COMPUTER_NAME;
+
+	return( 1 );
+}
+
+/* Sets the UTF-8 encoded filter expression to match
+ * The expression is a subset of XPath as used by Windows event log queries, such as:
+ * *[System[EventID=4624] and EventData[Data[@Name='LogonType']='10']]
+ * and is compiled once, a previously set expression is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_utf8_expression(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_filter_expression_t *expression                  = NULL;
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libevtx_record_filter_set_utf8_expression";
+	uint64_t current_time                                    = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( libevtx_filter_expression_get_current_time(
+	     &current_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_filter_expression_initialize(
+	     &expression,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create expression.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_filter_expression_compile(
+	     expression,
+	     utf8_string,
+	     utf8_string_length,
+	     current_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compile expression.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_record_filter->expression != NULL )
+	{
+		if( libevtx_filter_expression_free(
+		     &( internal_record_filter->expression ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free expression.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_record_filter->expression = expression;
+
+	return( 1 );
+
+on_error:
+	if( expression != NULL )
+	{
+		libevtx_filter_expression_free(
+		 &expression,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the UTF-16 encoded filter expression to match
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_set_utf16_expression(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "libevtx_record_filter_set_utf16_expression";
+	size_t utf8_string_size = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_size_from_utf16(
+	     utf16_string,
+	     utf16_string_length,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 expression size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 expression size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 expression.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     utf8_string,
+	     utf8_string_size,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 expression.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_filter_set_utf8_expression(
+	     record_filter,
+	     utf8_string,
+	     utf8_string_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set expression.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Appends an UTF-8 encoded search string to match
+ * A record matches if its data contains one of the appended search strings,
+ * encoded as UTF-16 little-endian or, for strings of ASCII characters, as ASCII
+ * The search strings are compared case sensitive against the data of the record itself,
+ * text that is only stored in a template definition in another record is not searched
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_append_utf8_search_string(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                    = "libevtx_record_filter_append_utf8_search_string";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( internal_record_filter->search_prefilter == NULL )
+	{
+		if( libevtx_search_prefilter_initialize(
+		     &( internal_record_filter->search_prefilter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create search prefilter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_search_prefilter_append_utf8_string(
+	     internal_record_filter->search_prefilter,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append search string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-16 encoded search string to match
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_append_utf16_search_string(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "libevtx_record_filter_append_utf16_search_string";
+	size_t utf8_string_size = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_size_from_utf16(
+	     utf16_string,
+	     utf16_string_length,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 search string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size < 2 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 search string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 search string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     utf8_string,
+	     utf8_string_size,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 search string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_filter_append_utf8_search_string(
+	     record_filter,
+	     utf8_string,
+	     utf8_string_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append search string.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Appends an UTF-8 encoded value to match
+ * A record matches if one of its EventData values, or a token of one of these values,
+ * equals one of the appended values. The tokens of a value are separated by white space
+ * and punctuation other than the '$', '-', '.', '@' and '_' characters
+ * The values are compared case insensitive, where only the ASCII, Latin-1 and basic
+ * Cyrillic characters are case folded
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_append_utf8_match_value(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_filter_t *internal_record_filter = NULL;
+	libevtx_match_value_t *reallocation                      = NULL;
+	static char *function                                    = "libevtx_record_filter_append_utf8_match_value";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libevtx_internal_record_filter_t *) record_filter;
+
+	if( (size_t) internal_record_filter->number_of_match_values >= ( (size_t) SSIZE_MAX / sizeof( libevtx_match_value_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record filter - number of match values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = (libevtx_match_value_t *) memory_reallocate(
+	                                          internal_record_filter->match_values,
+	                                          sizeof( libevtx_match_value_t ) * ( internal_record_filter->number_of_match_values + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize match values.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->match_values = reallocation;
+
+	if( memory_set(
+	     &( internal_record_filter->match_values[ internal_record_filter->number_of_match_values ] ),
+	     0,
+	     sizeof( libevtx_match_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear match value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_match_value_set_utf8_string(
+	     &( internal_record_filter->match_values[ internal_record_filter->number_of_match_values ] ),
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set match value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->number_of_match_values += 1;
+
+	return( 1 );
+}
+
+/* Appends an UTF-16 encoded value to match
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_filter_append_utf16_match_value(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "libevtx_record_filter_append_utf16_match_value";
+	size_t utf8_string_size = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_size_from_utf16(
+	     utf16_string,
+	     utf16_string_length,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 match value size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size < 2 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 match value size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 match value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     utf8_string,
+	     utf8_string_size,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 match value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_filter_append_utf8_match_value(
+	     record_filter,
+	     utf8_string,
+	     utf8_string_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append match value.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Determines if the record filter tests values that are only available from the XML document
+ * Returns 1 if the XML document is required or 0 if not
+ */
+int libevtx_record_filter_requires_xml_document(
+     libevtx_internal_record_filter_t *internal_record_filter )
+{
+	if( ( internal_record_filter == NULL )
+	 || ( internal_record_filter->expression == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_record_filter->expression->flags & ( LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_XML_DOCUMENT | LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_EVENT_DATA ) ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the record filter only requires the XML document to test the EventData element
+ * In which case the EventData values can be used instead of the XML document
+ * Returns 1 if only the EventData element is required or 0 if not
+ */
+int libevtx_record_filter_requires_only_event_data(
+     libevtx_internal_record_filter_t *internal_record_filter )
+{
+	if( ( internal_record_filter == NULL )
+	 || ( internal_record_filter->expression == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_record_filter->expression->flags & ( LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_XML_DOCUMENT | LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_EVENT_DATA ) ) != LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_EVENT_DATA )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if an event identifier matches the event identifiers of the record filter
+ * Returns 1 if the event identifier matches or 0 if not
+ */
+int libevtx_record_filter_match_event_identifier(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     uint32_t event_identifier )
+{
+	int event_identifier_index = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		return( 0 );
+	}
+	if( internal_record_filter->number_of_event_identifiers == 0 )
+	{
+		return( 1 );
+	}
+	for( event_identifier_index = 0;
+	     event_identifier_index < internal_record_filter->number_of_event_identifiers;
+	     event_identifier_index++ )
+	{
+		if( internal_record_filter->event_identifiers[ event_identifier_index ] == event_identifier )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Compares an UTF-16 string of the record filter with an UTF-16 little-endian stream
+ * The filter string size should include the end of string character
+ * The stream should not contain an end of string character
+ * The comparison is case insensitive for the ASCII characters
+ * Returns 1 if the strings are equal or 0 if not
+ */
+int libevtx_record_filter_compare_utf16_string_with_utf16_stream(
+     const uint16_t *filter_string,
+     size_t filter_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size )
+{
+	size_t character_index    = 0;
+	uint16_t filter_character = 0;
+	uint16_t stream_character = 0;
+
+	if( ( filter_string == NULL )
+	 || ( filter_string_size == 0 )
+	 || ( utf16_stream == NULL ) )
+	{
+		return( 0 );
+	}
+	if( utf16_stream_size != ( ( filter_string_size - 1 ) * 2 ) )
+	{
+		return( 0 );
+	}
+	for( character_index = 0;
+	     character_index < ( filter_string_size - 1 );
+	     character_index++ )
+	{
+		filter_character = filter_string[ character_index ];
+		stream_character = (uint16_t) utf16_stream[ ( character_index * 2 ) + 1 ] << 8;
+		stream_character = stream_character | utf16_stream[ character_index * 2 ];
+
+		if( ( filter_character >= (uint16_t) 'A' )
+		 && ( filter_character <= (uint16_t) 'Z' ) )
+		{
+			filter_character += (uint16_t) ( 'a' - 'A' );
+		}
+		if( ( stream_character >= (uint16_t) 'A' )
+		 && ( stream_character <= (uint16_t) 'Z' ) )
+		{
+			stream_character += (uint16_t) ( 'a' - 'A' );
+		}
+		if( filter_character != stream_character )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares an UTF-16 string of the record filter with an UTF-16 string
+ * The sizes should include the end of string character
+ * The comparison is case insensitive for the ASCII characters
+ * Returns 1 if the strings are equal or 0 if not
+ */
+int libevtx_record_filter_compare_utf16_string_with_utf16_string(
+     const uint16_t *filter_string,
+     size_t filter_string_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size )
+{
+	size_t character_index    = 0;
+	uint16_t filter_character = 0;
+	uint16_t string_character = 0;
+
+	if( ( filter_string == NULL )
+	 || ( filter_string_size == 0 )
+	 || ( utf16_string == NULL ) )
+	{
+		return( 0 );
+	}
+	/* Ignore trailing end of string characters
+	 */
+	while( ( utf16_string_size > 0 )
+	    && ( utf16_string[ utf16_string_size - 1 ] == 0 ) )
+	{
+		utf16_string_size--;
+	}
+	if( utf16_string_size != ( filter_string_size - 1 ) )
+	{
+		return( 0 );
+	}
+	for( character_index = 0;
+	     character_index < utf16_string_size;
+	     character_index++ )
+	{
+		filter_character = filter_string[ character_index ];
+		string_character = utf16_string[ character_index ];
+
+		if( ( filter_character >= (uint16_t) 'A' )
+		 && ( filter_character <= (uint16_t) 'Z' ) )
+		{
+			filter_character += (uint16_t) ( 'a' - 'A' );
+		}
+		if( ( string_character >= (uint16_t) 'A' )
+		 && ( string_character <= (uint16_t) 'Z' ) )
+		{
+			string_character += (uint16_t) ( 'a' - 'A' );
+		}
+		if( filter_character != string_character )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares the channel name of the record filter with an UTF-16 little-endian stream
+ * The stream should not contain an end of string character
+ * The comparison is case insensitive for the ASCII characters
+ * Returns 1 if the channel names are equal or 0 if not
+ */
+int libevtx_record_filter_compare_channel_name_with_utf16_stream(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size )
+{
+	if( internal_record_filter == NULL )
+	{
+		return( 0 );
+	}
+	return( libevtx_record_filter_compare_utf16_string_with_utf16_stream(
+	         internal_record_filter->channel_name,
+	         internal_record_filter->channel_name_size,
+	         utf16_stream,
+	         utf16_stream_size ) );
+}
+
+/* Compares the channel name of the record filter with an UTF-16 string
+ * The size should include the end of string character
+ * The comparison is case insensitive for the ASCII characters
+ * Returns 1 if the channel names are equal or 0 if not
+ */
+int libevtx_record_filter_compare_channel_name_with_utf16_string(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size )
+{
+	if( internal_record_filter == NULL )
+	{
+		return( 0 );
+	}
+	return( libevtx_record_filter_compare_utf16_string_with_utf16_string(
+	         internal_record_filter->channel_name,
+	         internal_record_filter->channel_name_size,
+	         utf16_string,
+	         utf16_string_size ) );
+}
+
+/* Compares the computer name of the record filter with an UTF-16 little-endian stream
+ * The stream should not contain an end of string character
+ * The comparison is case insensitive for the ASCII characters
+ * Returns 1 if the computer names are equal or 0 if not
+ */
+int libevtx_record_filter_compare_computer_name_with_utf16_stream(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size )
+{
+	if( internal_record_filter == NULL )
+	{
+		return( 0 );
+	}
+	return( libevtx_record_filter_compare_utf16_string_with_utf16_stream(
+	         internal_record_filter->computer_name,
+	         internal_record_filter->computer_name_size,
+	         utf16_stream,
+	         utf16_stream_size ) );
+}
+
+/* Compares the computer name of the record filter with an UTF-16 string
+ * The size should include the end of string character
+ * The comparison is case insensitive for the ASCII characters
+ * Returns 1 if the computer names are equal or 0 if not
+ */
+int libevtx_record_filter_compare_computer_name_with_utf16_string(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size )
+{
+	if( internal_record_filter == NULL )
+	{
+		return( 0 );
+	}
+	return( libevtx_record_filter_compare_utf16_string_with_utf16_string(
+	         internal_record_filter->computer_name,
+	         internal_record_filter->computer_name_size,
+	         utf16_string,
+	         utf16_string_size ) );
+}
+
+/* Determines if System element values, read without an XML document, match the record filter
+ * Returns 1 if the values match, 0 if not or -1 on error
+ */
+int libevtx_record_filter_match_system_values(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_filter_match_system_values";
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->number_of_event_identifiers > 0 )
+	{
+		if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER ) == 0 )
+		{
+			return( 0 );
+		}
+		if( libevtx_record_filter_match_event_identifier(
+		     internal_record_filter,
+		     system_values->event_identifier ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_EVENT_LEVEL ) != 0 )
+	{
+		if( ( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL ) == 0 )
+		 || ( system_values->event_level != internal_record_filter->event_level ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 )
+	{
+		if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) == 0 )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     system_values->provider_identifier,
+		     internal_record_filter->provider_identifier,
+		     16 ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_CHANNEL_NAME ) != 0 )
+	{
+		if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME ) == 0 )
+		{
+			return( 0 );
+		}
+		if( libevtx_record_filter_compare_channel_name_with_utf16_stream(
+		     internal_record_filter,
+		     system_values->channel_name,
+		     system_values->channel_name_size ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_COMPUTER_NAME ) != 0 )
+	{
+		if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) == 0 )
+		{
+			return( 0 );
+		}
+		if( libevtx_record_filter_compare_computer_name_with_utf16_stream(
+		     internal_record_filter,
+		     system_values->computer_name,
+		     system_values->computer_name_size ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the values of a record, read from its XML document, match the record filter
+ * Records that lack a value the record filter matches on do not match
+ * Returns 1 if the values match, 0 if not or -1 on error
+ */
+int libevtx_record_filter_match_record_values(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ 16 ];
+
+	uint16_t *channel_name    = NULL;
+	uint16_t *computer_name   = NULL;
+	static char *function     = "libevtx_record_filter_match_record_values";
+	size_t channel_name_size  = 0;
+	size_t computer_name_size = 0;
+	uint32_t event_identifier = 0;
+	uint8_t event_level       = 0;
+	int result                = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->number_of_event_identifiers > 0 )
+	{
+		/* A record without an EventID element does not match
+		 */
+		if( libevtx_record_values_get_event_identifier(
+		     record_values,
+		     &event_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		if( libevtx_record_filter_match_event_identifier(
+		     internal_record_filter,
+		     event_identifier ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_EVENT_LEVEL ) != 0 )
+	{
+		/* A record without a Level element does not match
+		 */
+		if( libevtx_record_values_get_event_level(
+		     record_values,
+		     &event_level,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		if( event_level != internal_record_filter->event_level )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 )
+	{
+		/* A record without a valid provider identifier does not match
+		 */
+		result = libevtx_record_values_get_provider_identifier(
+		          record_values,
+		          provider_identifier,
+		          16,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     provider_identifier,
+		     internal_record_filter->provider_identifier,
+		     16 ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_CHANNEL_NAME ) != 0 )
+	{
+		result = libevtx_record_values_get_utf16_channel_name_size(
+		          record_values,
+		          &channel_name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 channel name size.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( channel_name_size == 0 ) )
+		{
+			return( 0 );
+		}
+		if( channel_name_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-16 channel name size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		channel_name = (uint16_t *) memory_allocate(
+		                             sizeof( uint16_t ) * channel_name_size );
+
+		if( channel_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 channel name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_record_values_get_utf16_channel_name(
+		     record_values,
+		     channel_name,
+		     channel_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 channel name.",
+			 function );
+
+			goto on_error;
+		}
+		result = libevtx_record_filter_compare_channel_name_with_utf16_string(
+		          internal_record_filter,
+		          channel_name,
+		          channel_name_size );
+
+		memory_free(
+		 channel_name );
+
+		channel_name = NULL;
+
+		if( result != 1 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_COMPUTER_NAME ) != 0 )
+	{
+		result = libevtx_record_values_get_utf16_computer_name_size(
+		          record_values,
+		          &computer_name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 computer name size.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( computer_name_size == 0 ) )
+		{
+			return( 0 );
+		}
+		if( computer_name_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-16 computer name size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		computer_name = (uint16_t *) memory_allocate(
+		                             sizeof( uint16_t ) * computer_name_size );
+
+		if( computer_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 computer name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_record_values_get_utf16_computer_name(
+		     record_values,
+		     computer_name,
+		     computer_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 computer name.",
+			 function );
+
+			goto on_error;
+		}
+		result = libevtx_record_filter_compare_computer_name_with_utf16_string(
+		          internal_record_filter,
+		          computer_name,
+		          computer_name_size );
+
+		memory_free(
+		 computer_name );
+
+		computer_name = NULL;
+
+		if( result != 1 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( channel_name != NULL )
+	{
+		memory_free(
+		 channel_name );
+	}
+	if( computer_name != NULL )
+	{
+		memory_free(
+		 computer_name );
+	}
+	return( -1 );
+}
+
+/* Determines if the values of a record match the filter expression of the record filter
+ * The values are taken from the System values if the XML document was not read
+ * Returns 1 if the values match or if no expression was set, 0 if not or -1 on error
+ */
+int libevtx_record_filter_match_expression(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_filter_match_expression";
+	int result            = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->expression == NULL )
+	{
+		return( 1 );
+	}
+	result = libevtx_filter_expression_evaluate(
+	          internal_record_filter->expression,
+	          record_values,
+	          io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to evaluate expression.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if records of a chunk can match the record filter without reading the chunk
+ * The event identifiers and provider identifier are tested with the summary of the chunk
+ * and the expression with the summary and written time range of the chunk
+ * Returns 1 if records of the chunk can match, 0 if none match or -1 on error
+ */
+int libevtx_record_filter_match_chunk_descriptor(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_record_filter_match_chunk_descriptor";
+	int event_identifier_index = 0;
+	int match_value_index      = 0;
+	int result                 = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->number_of_event_identifiers > 0 )
+	{
+		for( event_identifier_index = 0;
+		     event_identifier_index < internal_record_filter->number_of_event_identifiers;
+		     event_identifier_index++ )
+		{
+			if( libevtx_chunk_descriptor_may_contain_event_identifier(
+			     chunk_descriptor,
+			     internal_record_filter->event_identifiers[ event_identifier_index ] ) != 0 )
+			{
+				break;
+			}
+		}
+		if( event_identifier_index >= internal_record_filter->number_of_event_identifiers )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_record_filter->flags & LIBEVTX_RECORD_FILTER_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 )
+	{
+		if( libevtx_chunk_descriptor_may_contain_provider_identifier(
+		     chunk_descriptor,
+		     internal_record_filter->provider_identifier ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( internal_record_filter->number_of_match_values > 0 )
+	{
+		for( match_value_index = 0;
+		     match_value_index < internal_record_filter->number_of_match_values;
+		     match_value_index++ )
+		{
+			if( libevtx_value_filter_may_contain_match_value(
+			     chunk_descriptor->value_filter,
+			     &( internal_record_filter->match_values[ match_value_index ] ) ) != 0 )
+			{
+				break;
+			}
+		}
+		if( match_value_index >= internal_record_filter->number_of_match_values )
+		{
+			return( 0 );
+		}
+	}
+	if( internal_record_filter->expression == NULL )
+	{
+		return( 1 );
+	}
+	result = libevtx_filter_expression_evaluate_chunk_descriptor(
+	          internal_record_filter->expression,
+	          chunk_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to evaluate expression.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if a value, or one of the tokens of the value, equals one of the match values of the record filter
+ * Returns 1 if the value matches or 0 if not
+ */
+int libevtx_record_filter_match_value_string(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type )
+{
+	int match_value_index = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		return( 0 );
+	}
+	for( match_value_index = 0;
+	     match_value_index < internal_record_filter->number_of_match_values;
+	     match_value_index++ )
+	{
+		if( libevtx_match_value_match_string(
+		     &( internal_record_filter->match_values[ match_value_index ] ),
+		     string,
+		     string_size,
+		     string_type ) != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if the data of a record contains one of the search strings of the record filter
+ * This is tested on the binary XML data before the record is decoded
+ * Returns 1 if the data contains a search string or if no search strings were appended, 0 if not or -1 on error
+ */
+int libevtx_record_filter_match_record_data(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_record_values_t *record_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_filter_match_record_data";
+	int result            = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->search_prefilter == NULL )
+	{
+		return( 1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->chunk_data_offset >= chunk_data_size )
+	 || ( (size_t) record_values->data_size > ( chunk_data_size - record_values->chunk_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record values - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_search_prefilter_scan(
+	          internal_record_filter->search_prefilter,
+	          &( chunk_data[ record_values->chunk_data_offset ] ),
+	          (size_t) record_values->data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan record data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,284 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_RECORD_FILTER_H )
+#define _LIBEVTX_INTERNAL_RECORD_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk_descriptor.h"
+#include "libevtx_extern.h"
+#include "libevtx_filter_expression.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_record_values.h"
+#include "libevtx_search_prefilter.h"
+#include "libevtx_system_values.h"
+#include "libevtx_types.h"
+#include "libevtx_value_filter.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_internal_record_filter libevtx_internal_record_filter_t;
+
+struct libevtx_internal_record_filter
+{
+	/* The event identifiers
+	 */
+	uint32_t *event_identifiers;
+
+	/* The number of event identifiers
+	 */
+	int number_of_event_identifiers;
+
+	/* The event level
+	 */
+	uint8_t event_level;
+
+	/* The provider identifier
+	 * Contains a little-endian GUID
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The channel name
+	 * Contains an UTF-16 string with end of string character
+	 */
+	uint16_t *channel_name;
+
+	/* The channel name size
+	 */
+	size_t channel_name_size;
+
+	/* The computer name
+	 * Contains an UTF-16 string with end of string character
+	 */
+	uint16_t *computer_name;
+
+	/* The computer name size
+	 */
+	size_t computer_name_size;
+
+	/* The filter expression
+	 */
+	libevtx_filter_expression_t *expression;
+
+	/* The search prefilter
+	 * Contains the encoded search strings
+	 */
+	libevtx_search_prefilter_t *search_prefilter;
+
+	/* The match values
+	 */
+	libevtx_match_value_t *match_values;
+
+	/* The number of match values
+	 */
+	int number_of_match_values;
+
+	/* Various flags
+	 */
+	uint8_t flags;
+};
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_initialize(
+     libevtx_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_free(
+     libevtx_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_append_event_identifier(
+     libevtx_record_filter_t *record_filter,
+     uint32_t event_identifier,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_event_level(
+     libevtx_record_filter_t *record_filter,
+     uint8_t event_level,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_provider_identifier(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_utf8_channel_name(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_utf16_channel_name(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_utf8_computer_name(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_utf16_computer_name(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_utf8_expression(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_set_utf16_expression(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_append_utf8_search_string(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_append_utf16_search_string(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_append_utf8_match_value(
+     libevtx_record_filter_t *record_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_filter_append_utf16_match_value(
+     libevtx_record_filter_t *record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libevtx_record_filter_requires_xml_document(
+     libevtx_internal_record_filter_t *internal_record_filter );
+
+int libevtx_record_filter_requires_only_event_data(
+     libevtx_internal_record_filter_t *internal_record_filter );
+
+int libevtx_record_filter_match_event_identifier(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     uint32_t event_identifier );
+
+int libevtx_record_filter_compare_utf16_string_with_utf16_stream(
+     const uint16_t *filter_string,
+     size_t filter_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size );
+
+int libevtx_record_filter_compare_utf16_string_with_utf16_string(
+     const uint16_t *filter_string,
+     size_t filter_string_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size );
+
+int libevtx_record_filter_compare_channel_name_with_utf16_stream(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size );
+
+int libevtx_record_filter_compare_channel_name_with_utf16_string(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size );
+
+int libevtx_record_filter_compare_computer_name_with_utf16_stream(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size );
+
+int libevtx_record_filter_compare_computer_name_with_utf16_string(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size );
+
+int libevtx_record_filter_match_system_values(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_system_values_t *system_values,
+     libcerror_error_t **error );
+
+int libevtx_record_filter_match_record_values(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_record_filter_match_record_data(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_record_values_t *record_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_filter_match_expression(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_record_filter_match_chunk_descriptor(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     libevtx_chunk_descriptor_t *chunk_descriptor,
+     libcerror_error_t **error );
+
+int libevtx_record_filter_match_value_string(
+     libevtx_internal_record_filter_t *internal_record_filter,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_RECORD_FILTER_H ) */
+
@@ -25,15 +25,28 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libevtx_arena.h"
 #include "libevtx_byte_stream.h"
+#include "libevtx_decode_budget.h"
+#include "libevtx_decode_profile.h"
+#include "libevtx_decoded_values_file.h"
+#include "libevtx_definitions.h"
+#include "libevtx_element_name.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfdatetime.h"
+#include "libevtx_libfguid.h"
 #include "libevtx_libfvalue.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_libuna.h"
+#include "libevtx_probes.h"
 #include "libevtx_record_values.h"
+#include "libevtx_statistics.h"
+#include "libevtx_system_values.h"
 #include "libevtx_template_definition.h"
+#include "libevtx_utf16_stream.h"
+#include "libevtx_xml_transcoder.h"
 
 #include "evtx_event_record.h"
 
@@ -112,6 +125,173 @@ on_error:
 	return( -1 );
 }
 
+/* Creates record values that are allocated from an arena
+ * The record values and their buffers are released when the arena is freed,
+ * libevtx_record_values_free only frees the XML document and arrays
+ * Make sure the value record_values is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_initialize_from_arena(
+     libevtx_record_values_t **record_values,
+     libevtx_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *safe_record_values = NULL;
+	static char *function                       = "libevtx_record_values_initialize_from_arena";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_arena_allocate(
+	     arena,
+	     sizeof( libevtx_record_values_t ),
+	     (void **) &safe_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     safe_record_values,
+	     0,
+	     sizeof( libevtx_record_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record values.",
+		 function );
+
+		return( -1 );
+	}
+	safe_record_values->arena = arena;
+
+	*record_values = safe_record_values;
+
+	return( 1 );
+}
+
+/* Allocates data that is owned by the record values
+ * The data is allocated from the arena of the record values, if set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_allocate_data(
+     libevtx_record_values_t *record_values,
+     size_t data_size,
+     void **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_allocate_data";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->arena != NULL )
+	{
+		if( libevtx_arena_allocate(
+		     record_values->arena,
+		     data_size,
+		     data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate data from arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		*data = memory_allocate(
+		         data_size );
+
+		if( *data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Frees record values
  * Returns 1 if successful or -1 on error
  */
@@ -135,6 +315,16 @@ int libevtx_record_values_free(
 	}
 	if( *record_values != NULL )
 	{
+		libevtx_memory_usage_remove(
+		 ( *record_values )->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_RECORD_VALUES,
+		 ( *record_values )->accounted_size );
+
+		libevtx_memory_usage_remove(
+		 ( *record_values )->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+		 ( *record_values )->accounted_xml_size );
+
 		if( ( *record_values )->string_identifiers_array != NULL )
 		{
 			if( libcdata_array_free(
@@ -185,9 +375,48 @@ int libevtx_record_values_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 *record_values );
-
+		if( ( *record_values )->utf8_xml_string != NULL )
+		{
+			memory_free(
+			 ( *record_values )->utf8_xml_string );
+		}
+		if( ( *record_values )->utf16_xml_string != NULL )
+		{
+			memory_free(
+			 ( *record_values )->utf16_xml_string );
+		}
+		/* Record values allocated from an arena are released with the arena
+		 */
+		if( ( *record_values )->arena == NULL )
+		{
+			if( ( *record_values )->channel_name_data != NULL )
+			{
+				memory_free(
+				 ( *record_values )->channel_name_data );
+			}
+			if( ( *record_values )->utf8_strings != NULL )
+			{
+				memory_free(
+				 ( *record_values )->utf8_strings );
+			}
+			if( ( *record_values )->utf8_string_offsets != NULL )
+			{
+				memory_free(
+				 ( *record_values )->utf8_string_offsets );
+			}
+			if( ( *record_values )->string_name_hashes != NULL )
+			{
+				memory_free(
+				 ( *record_values )->string_name_hashes );
+			}
+			if( ( *record_values )->computer_name_data != NULL )
+			{
+				memory_free(
+				 ( *record_values )->computer_name_data );
+			}
+			memory_free(
+			 *record_values );
+		}
 		*record_values = NULL;
 	}
 	return( result );
@@ -259,8 +488,124 @@ int libevtx_record_values_clone(
 
 		goto on_error;
 	}
-	( *destination_record_values )->xml_document = NULL;
+	/* The cached XML tags and values reference the XML document of the source
+	 * and are resolved again from the XML document of the destination
+	 */
+	( *destination_record_values )->xml_document                   = NULL;
+	( *destination_record_values )->system_xml_tag                 = NULL;
+	( *destination_record_values )->event_data_xml_tag             = NULL;
+	( *destination_record_values )->processing_error_data_xml_tag  = NULL;
+	( *destination_record_values )->user_data_xml_tag              = NULL;
+	( *destination_record_values )->provider_xml_tag               = NULL;
+	( *destination_record_values )->provider_identifier_value      = NULL;
+	( *destination_record_values )->provider_name_value            = NULL;
+	( *destination_record_values )->event_identifier_xml_tag       = NULL;
+	( *destination_record_values )->level_value                    = NULL;
+	( *destination_record_values )->task_value                     = NULL;
+	( *destination_record_values )->oppcode_value                  = NULL;
+	( *destination_record_values )->keywords_value                 = NULL;
+	( *destination_record_values )->version_value                  = NULL;
+	( *destination_record_values )->event_record_identifier_value  = NULL;
+	( *destination_record_values )->channel_value                  = NULL;
+	( *destination_record_values )->computer_value                 = NULL;
+	( *destination_record_values )->user_security_identifier_value = NULL;
+	( *destination_record_values )->process_identifier_value       = NULL;
+	( *destination_record_values )->thread_identifier_value        = NULL;
+	( *destination_record_values )->activity_identifier_value      = NULL;
+	( *destination_record_values )->string_identifiers_array       = NULL;
+	( *destination_record_values )->strings_array                  = NULL;
+	( *destination_record_values )->binary_data_value              = NULL;
+	( *destination_record_values )->data_parsed                    = 0;
+	( *destination_record_values )->string_name_hashes             = NULL;
+	( *destination_record_values )->string_name_index_table        = NULL;
+	( *destination_record_values )->string_name_index_table_size   = 0;
+	( *destination_record_values )->string_name_index_built        = 0;
+	( *destination_record_values )->root_xml_tags_resolved         = 0;
+	( *destination_record_values )->system_xml_tags_resolved       = 0;
+	( *destination_record_values )->system_scalars.flags           = 0;
+	( *destination_record_values )->utf8_xml_string                = NULL;
+	( *destination_record_values )->utf8_xml_string_size           = 0;
+	( *destination_record_values )->utf16_xml_string               = NULL;
+	( *destination_record_values )->utf16_xml_string_size          = 0;
+	( *destination_record_values )->utf8_strings                   = NULL;
+	( *destination_record_values )->utf8_string_offsets            = NULL;
+	( *destination_record_values )->number_of_utf8_strings         = 0;
+	( *destination_record_values )->utf8_strings_converted         = 0;
+	( *destination_record_values )->arena                          = NULL;
+	( *destination_record_values )->memory_usage                   = NULL;
+	( *destination_record_values )->accounted_size                 = 0;
+	( *destination_record_values )->accounted_xml_size             = 0;
+	( *destination_record_values )->document_cache                 = NULL;
+	( *destination_record_values )->channel_name_data              = NULL;
+	( *destination_record_values )->computer_name_data             = NULL;
+	( *destination_record_values )->system_values.channel_name     = NULL;
+	( *destination_record_values )->system_values.computer_name    = NULL;
+	( *destination_record_values )->event_data_values              = NULL;
+
+	if( source_record_values->channel_name_data != NULL )
+	{
+		( *destination_record_values )->channel_name_data = (uint8_t *) memory_allocate(
+		                                                     sizeof( uint8_t ) * source_record_values->system_values.channel_name_size );
+
+		if( ( *destination_record_values )->channel_name_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination channel name data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_record_values )->channel_name_data,
+		     source_record_values->channel_name_data,
+		     source_record_values->system_values.channel_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy channel name data.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_record_values )->system_values.channel_name = ( *destination_record_values )->channel_name_data;
+	}
+	if( source_record_values->computer_name_data != NULL )
+	{
+		( *destination_record_values )->computer_name_data = (uint8_t *) memory_allocate(
+		                                                      sizeof( uint8_t ) * source_record_values->system_values.computer_name_size );
+
+		if( ( *destination_record_values )->computer_name_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination computer name data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_record_values )->computer_name_data,
+		     source_record_values->computer_name_data,
+		     source_record_values->system_values.computer_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy computer name data.",
+			 function );
 
+			goto on_error;
+		}
+		( *destination_record_values )->system_values.computer_name = ( *destination_record_values )->computer_name_data;
+	}
 	if( source_record_values->xml_document != NULL )
 	{
 		if( libfwevt_xml_document_clone(
@@ -283,6 +628,16 @@ int libevtx_record_values_clone(
 on_error:
 	if( *destination_record_values != NULL )
 	{
+		if( ( *destination_record_values )->computer_name_data != NULL )
+		{
+			memory_free(
+			 ( *destination_record_values )->computer_name_data );
+		}
+		if( ( *destination_record_values )->channel_name_data != NULL )
+		{
+			memory_free(
+			 ( *destination_record_values )->channel_name_data );
+		}
 		memory_free(
 		 *destination_record_values );
 
@@ -291,51 +646,24 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the record values header
- * Returns 1 if successful, 0 if not or -1 on error
+/* Checks if the chunk data contains a plausible record values header
+ * This is intended to cheaply reject false positive event record signatures,
+ * such as found when scanning free space, before reading the header
+ * Returns 1 if the header is plausible, 0 if not or -1 on error
  */
-int libevtx_record_values_read_header(
-     libevtx_record_values_t *record_values,
-     libevtx_io_handle_t *io_handle,
+int libevtx_record_values_check_header(
      const uint8_t *chunk_data,
      size_t chunk_data_size,
      size_t chunk_data_offset,
      libcerror_error_t **error )
 {
-	const uint8_t *event_record_data  = NULL;
-	static char *function             = "libevtx_record_values_read_header";
-	size_t event_record_data_size     = 0;
-	uint32_t size_copy                = 0;
-	int result                        = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	system_character_t filetime_string[ 32 ];
-
-	libfdatetime_filetime_t *filetime = NULL;
-#endif
-
-	if( record_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
-		 function );
-
-		return( -1 );
-	}
-	if( io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
-		 function );
+	const uint8_t *event_record_data = NULL;
+	static char *function            = "libevtx_record_values_check_header";
+	size_t event_record_data_size    = 0;
+	uint64_t identifier              = 0;
+	uint32_t data_size               = 0;
+	uint32_t size_copy               = 0;
 
-		return( -1 );
-	}
 	if( chunk_data == NULL )
 	{
 		libcerror_error_set(
@@ -356,37 +684,155 @@ int libevtx_record_values_read_header(
 		 "%s: invalid chunk data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	/* The checks below mirror those of libevtx_record_values_read_header
+	 * but do not set an error, since a failed check is a common outcome
+	 */
 	if( chunk_data_offset >= chunk_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid chunk data offset value out of bounds.",
-		 function );
-
-		goto on_error;
+		return( 0 );
 	}
 	event_record_data      = &( chunk_data[ chunk_data_offset ] );
 	event_record_data_size = chunk_data_size - chunk_data_offset;
 
 	if( event_record_data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid event record data size value too small.",
-		 function );
-
-		goto on_error;
+		return( 0 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
+	if( memory_compare(
+	     ( (evtx_event_record_header_t *) event_record_data )->signature,
+	     evtx_event_record_signature,
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_event_record_header_t *) event_record_data )->size,
+	 data_size );
+
+	if( ( data_size < sizeof( evtx_event_record_header_t ) )
+	 || ( data_size > ( event_record_data_size - 4 ) ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( event_record_data[ data_size - 4 ] ),
+	 size_copy );
+
+	if( data_size != size_copy )
+	{
+		return( 0 );
+	}
+	/* The event record identifiers start at 1
+	 */
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_event_record_header_t *) event_record_data )->identifier,
+	 identifier );
+
+	if( identifier == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the record values header
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libevtx_record_values_read_header(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t chunk_data_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *event_record_data  = NULL;
+	static char *function             = "libevtx_record_values_read_header";
+	size_t event_record_data_size     = 0;
+	uint32_t size_copy                = 0;
+	int result                        = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	system_character_t filetime_string[ 32 ];
+
+	libfdatetime_filetime_t *filetime = NULL;
+#endif
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_data_offset >= chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	event_record_data      = &( chunk_data[ chunk_data_offset ] );
+	event_record_data_size = chunk_data_size - chunk_data_offset;
+
+	if( event_record_data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event record data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
 		 "%s: event record header data:\n",
 		 function );
 		libcnotify_print_data(
@@ -578,6 +1024,10 @@ int libevtx_record_values_read_header(
 
 		goto on_error;
 	}
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_record_headers_read,
+	 1 );
+
 	return( 1 );
 
 on_error:
@@ -593,6 +1043,8 @@ on_error:
 }
 
 /* Reads the record values XML document
+ * If the record exceeds the decode budget of the IO handle the XML document is not read
+ * and the record values are marked as partially decoded
  * Returns 1 if successful or -1 on error
  */
 int libevtx_record_values_read_xml_document(
@@ -602,10 +1054,19 @@ int libevtx_record_values_read_xml_document(
      size_t chunk_data_size,
      libcerror_error_t **error )
 {
-	static char *function         = "libevtx_record_values_read_xml_document";
-	size_t chunk_data_offset      = 0;
-	size_t event_record_data_size = 0;
-	uint8_t flags                 = 0;
+	static char *function              = "libevtx_record_values_read_xml_document";
+	size_t chunk_data_offset           = 0;
+	size_t event_record_data_size      = 0;
+	uint64_t decode_time               = 0;
+	uint64_t measure_start_time        = 0;
+	uint8_t flags                      = 0;
+	uint8_t measure_decode_time        = 0;
+	int number_of_xml_tags             = 0;
+	int result                         = 0;
+
+#if defined( LIBEVTX_PROBES_ENABLED )
+	uint64_t decode_start_time         = 0;
+#endif
 
 	if( record_values == NULL )
 	{
@@ -640,6 +1101,12 @@ int libevtx_record_values_read_xml_document(
 
 		return( -1 );
 	}
+	/* A record that exceeded the decode budget is not decoded again
+	 */
+	if( record_values->is_partially_decoded != 0 )
+	{
+		return( 1 );
+	}
 	if( chunk_data == NULL )
 	{
 		libcerror_error_set(
@@ -700,6 +1167,52 @@ int libevtx_record_values_read_xml_document(
 
 		goto on_error;
 	}
+	if( libevtx_decode_budget_is_limited(
+	     &( io_handle->decode_budget ) ) != 0 )
+	{
+		result = libevtx_decode_budget_check_binary_xml(
+		          &( io_handle->decode_budget ),
+		          chunk_data,
+		          chunk_data_size,
+		          chunk_data_offset,
+		          event_record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check binary XML against decode budget.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libevtx_record_values_set_partially_decoded(
+			     record_values,
+			     io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set partially decoded.",
+				 function );
+
+				goto on_error;
+			}
+			return( 1 );
+		}
+		measure_decode_time = (uint8_t) ( io_handle->decode_budget.maximum_decode_time > 0 );
+	}
+	if( io_handle->decode_profile != NULL )
+	{
+		measure_decode_time = 1;
+	}
 	if( libfwevt_xml_document_initialize(
 	     &( record_values->xml_document ),
 	     error ) != 1 )
@@ -713,6 +1226,10 @@ int libevtx_record_values_read_xml_document(
 
 		goto on_error;
 	}
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_allocations,
+	 1 );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -728,14 +1245,36 @@ int libevtx_record_values_read_xml_document(
 	flags = LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS
 	      | LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DEPENDENCY_IDENTIFIERS;
 
-	if( libfwevt_xml_document_read(
-	     record_values->xml_document,
-	     chunk_data,
-	     chunk_data_size,
-	     chunk_data_offset,
-	     io_handle->ascii_codepage,
-	     flags,
-	     error ) != 1 )
+#if defined( LIBEVTX_PROBES_ENABLED )
+	decode_start_time = libevtx_statistics_get_time();
+#endif
+	if( measure_decode_time != 0 )
+	{
+		measure_start_time = libevtx_statistics_get_time();
+	}
+	LIBEVTX_PROBE_RECORD_DECODE_START(
+	 record_values->identifier,
+	 chunk_data_offset );
+
+	result = libfwevt_xml_document_read(
+	          record_values->xml_document,
+	          chunk_data,
+	          chunk_data_size,
+	          chunk_data_offset,
+	          io_handle->ascii_codepage,
+	          flags,
+	          error );
+
+	if( measure_decode_time != 0 )
+	{
+		decode_time = libevtx_statistics_get_time() - measure_start_time;
+	}
+	LIBEVTX_PROBE_RECORD_DECODE_DONE(
+	 record_values->identifier,
+	 libevtx_statistics_get_time() - decode_start_time,
+	 result );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -746,6 +1285,107 @@ int libevtx_record_values_read_xml_document(
 
 		goto on_error;
 	}
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_xml_documents_read,
+	 1 );
+
+	/* A fragment header followed by a template instance token
+	 */
+	if( ( event_record_data_size >= 5 )
+	 && ( chunk_data[ chunk_data_offset ] == 0x0f )
+	 && ( chunk_data[ chunk_data_offset + 4 ] == 0x0c ) )
+	{
+		LIBEVTX_COUNTER_ADD(
+		 io_handle->statistics.number_of_template_expansions,
+		 1 );
+	}
+	result = libevtx_record_values_check_decode_budget(
+	          record_values,
+	          io_handle,
+	          decode_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check decode budget.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( libevtx_record_values_account_xml_document(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to account XML document.",
+		 function );
+
+		goto on_error;
+	}
+	/* The decode costs are attributed to the provider, event identifier and template,
+	 * the XML tags are counted as allocations since each is allocated separately
+	 */
+	if( io_handle->decode_profile != NULL )
+	{
+		if( libevtx_record_values_set_decode_profile_key(
+		     record_values,
+		     chunk_data,
+		     chunk_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set decode profile key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_record_values_get_number_of_xml_tags(
+		     record_values,
+		     &number_of_xml_tags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of XML tags.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_record_values_profile_decode_cost(
+		     record_values,
+		     io_handle,
+		     LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME,
+		     decode_time,
+		     (uint64_t) event_record_data_size,
+		     1 + (uint64_t) number_of_xml_tags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to profile decode cost.",
+			 function );
+
+			goto on_error;
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -780,18 +1420,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the event identifier
+/* Accounts the XML document of the record values to their memory usage
+ * The size of the XML document is estimated by the size of its binary XML data
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_event_identifier(
+int libevtx_record_values_account_xml_document(
      libevtx_record_values_t *record_values,
-     uint32_t *event_identifier,
      libcerror_error_t **error )
 {
-	libfvalue_value_t *event_identifier_value = NULL;
-	libfwevt_xml_tag_t *root_xml_tag          = NULL;
-	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                    = "libevtx_record_values_get_event_identifier";
+	static char *function         = "libevtx_record_values_account_xml_document";
+	size_t event_record_data_size = 0;
 
 	if( record_values == NULL )
 	{
@@ -815,238 +1453,149 @@ int libevtx_record_values_get_event_identifier(
 
 		return( -1 );
 	}
-	if( record_values->event_identifier_xml_tag == NULL )
+	if( record_values->data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfwevt_xml_tag_get_element_by_utf8_name(
-		     root_xml_tag,
-		     (uint8_t *) "System",
-		     6,
-		     &system_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfwevt_xml_tag_get_element_by_utf8_name(
-		     system_xml_tag,
-		     (uint8_t *) "EventID",
-		     7,
-		     &( record_values->event_identifier_xml_tag ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventID XML element.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( libfwevt_xml_tag_get_value(
-	     record_values->event_identifier_xml_tag,
-	     &event_identifier_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve EventID XML element value.",
-		 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record values - data size value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_value_copy_to_32bit(
-	     event_identifier_value,
-	     0,
-	     event_identifier,
-	     error ) != 1 )
+	if( record_values->memory_usage != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy value to event identifier.",
-		 function );
+		event_record_data_size = record_values->data_size
+		                       - ( sizeof( evtx_event_record_header_t ) + 4 );
 
-		return( -1 );
+		record_values->accounted_xml_size += event_record_data_size;
+
+		libevtx_memory_usage_add(
+		 record_values->memory_usage,
+		 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+		 event_record_data_size );
 	}
 	return( 1 );
 }
 
-/* Retrieves the event identifier qualifiers
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Counts the XML tags of a specific XML tag including its elements and attributes
+ * The number of XML tags is incremented with the number counted
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_event_identifier_qualifiers(
-     libevtx_record_values_t *record_values,
-     uint32_t *event_identifier_qualifiers,
+int libevtx_record_values_count_xml_tags(
+     libfwevt_xml_tag_t *xml_tag,
+     int *number_of_xml_tags,
      libcerror_error_t **error )
 {
-	libfvalue_value_t *qualifiers_value    = NULL;
-	libfwevt_xml_tag_t *qualifiers_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag       = NULL;
-	libfwevt_xml_tag_t *system_xml_tag     = NULL;
-	static char *function                  = "libevtx_record_values_get_event_identifier_qualifiers";
-	int result                             = 0;
+	libfwevt_xml_tag_t *element_xml_tag = NULL;
+	static char *function               = "libevtx_record_values_count_xml_tags";
+	int element_index                   = 0;
+	int number_of_attributes            = 0;
+	int number_of_elements              = 0;
 
-	if( record_values == NULL )
+	if( xml_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
+		 "%s: invalid XML tag.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( number_of_xml_tags == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of XML tags.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->event_identifier_xml_tag == NULL )
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     xml_tag,
+	     &number_of_attributes,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfwevt_xml_tag_get_element_by_utf8_name(
-		     root_xml_tag,
-		     (uint8_t *) "System",
-		     6,
-		     &system_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfwevt_xml_tag_get_element_by_utf8_name(
-		     system_xml_tag,
-		     (uint8_t *) "EventID",
-		     7,
-		     &( record_values->event_identifier_xml_tag ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventID XML element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-	          record_values->event_identifier_xml_tag,
-	          (uint8_t *) "Qualifiers",
-	          10,
-	          &qualifiers_xml_tag,
-	          error );
-
-	if( result == -1 )
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve Qualifiers XML attribute.",
+		 "%s: unable to retrieve number of elements.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	*number_of_xml_tags += 1 + number_of_attributes;
+
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
 	{
-		if( libfwevt_xml_tag_get_value(
-		     qualifiers_xml_tag,
-		     &qualifiers_value,
+		if( libfwevt_xml_tag_get_element_by_index(
+		     xml_tag,
+		     element_index,
+		     &element_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Qualifiers XML element value.",
-			 function );
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
-		if( libfvalue_value_copy_to_32bit(
-		     qualifiers_value,
-		     0,
-		     event_identifier_qualifiers,
+		if( libevtx_record_values_count_xml_tags(
+		     element_xml_tag,
+		     number_of_xml_tags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to qualifiers.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to count XML tags of element: %d.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the event level
+/* Retrieves the number of XML tags of the XML document
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_event_level(
+int libevtx_record_values_get_number_of_xml_tags(
      libevtx_record_values_t *record_values,
-     uint8_t *event_level,
+     int *number_of_xml_tags,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *level_xml_tag  = NULL;
-	libfwevt_xml_tag_t *root_xml_tag   = NULL;
-	libfwevt_xml_tag_t *system_xml_tag = NULL;
-	static char *function              = "libevtx_record_values_get_event_level";
+	libfwevt_xml_tag_t *root_xml_tag = NULL;
+	static char *function            = "libevtx_record_values_get_number_of_xml_tags";
+	int safe_number_of_xml_tags      = 0;
 
 	if( record_values == NULL )
 	{
@@ -1070,101 +1619,67 @@ int libevtx_record_values_get_event_level(
 
 		return( -1 );
 	}
-	if( record_values->level_value == NULL )
+	if( number_of_xml_tags == NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfwevt_xml_tag_get_element_by_utf8_name(
-		     root_xml_tag,
-		     (uint8_t *) "System",
-		     6,
-		     &system_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfwevt_xml_tag_get_element_by_utf8_name(
-		     system_xml_tag,
-		     (uint8_t *) "Level",
-		     5,
-		     &level_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Level XML element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of XML tags.",
+		 function );
 
-			return( -1 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     level_xml_tag,
-		     &( record_values->level_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Level XML element value.",
-			 function );
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_root_xml_tag(
+	     record_values->xml_document,
+	     &root_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root XML element.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( libfvalue_value_copy_to_8bit(
-	     record_values->level_value,
-	     0,
-	     event_level,
+	if( libevtx_record_values_count_xml_tags(
+	     root_xml_tag,
+	     &safe_number_of_xml_tags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy value to event level.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to count XML tags.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_xml_tags = safe_number_of_xml_tags;
+
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded provider identifier
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Sets the decode profile key of the record values
+ * The template identifier is read from the template definition of the template instance
+ * the binary XML data starts with, the provider and event identifiers are set to 0 if not available
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_provider_identifier_size(
+int libevtx_record_values_set_decode_profile_key(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_identifier_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag                = NULL;
-	libfwevt_xml_tag_t *system_xml_tag              = NULL;
-	static char *function                           = "libevtx_record_values_get_utf8_provider_identifier_size";
-	int result                                      = 0;
+	libcerror_error_t *event_identifier_error = NULL;
+	static char *function                     = "libevtx_record_values_set_decode_profile_key";
+	size_t chunk_data_offset                  = 0;
+	size_t event_record_data_size             = 0;
+	uint32_t template_definition_offset       = 0;
+	int result                                = 0;
 
 	if( record_values == NULL )
 	{
@@ -1177,150 +1692,134 @@ int libevtx_record_values_get_utf8_provider_identifier_size(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record values - data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->provider_xml_tag == NULL )
+	if( memory_set(
+	     &( record_values->decode_profile_key ),
+	     0,
+	     sizeof( libevtx_decode_profile_key_t ) ) == NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decode profile key.",
+		 function );
 
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
+		return( -1 );
+	}
+	record_values->has_decode_profile_key = 0;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
-		          error );
+	chunk_data_offset      = record_values->chunk_data_offset
+	                       + sizeof( evtx_event_record_header_t );
+	event_record_data_size = record_values->data_size
+	                       - ( sizeof( evtx_event_record_header_t ) + 4 );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
-			 function );
+	/* A fragment header followed by a template instance token that contains
+	 * the template identifier and the offset of the template definition
+	 */
+	if( ( event_record_data_size >= 14 )
+	 && ( chunk_data_size >= 14 )
+	 && ( chunk_data_offset <= ( chunk_data_size - 14 ) )
+	 && ( chunk_data[ chunk_data_offset ] == 0x0f )
+	 && ( chunk_data[ chunk_data_offset + 4 ] == 0x0c ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chunk_data[ chunk_data_offset + 10 ] ),
+		 template_definition_offset );
+
+		if( ( chunk_data_size >= 20 )
+		 && ( (size_t) template_definition_offset <= ( chunk_data_size - 20 ) ) )
+		{
+			if( memory_copy(
+			     record_values->decode_profile_key.template_identifier,
+			     &( chunk_data[ template_definition_offset + 4 ] ),
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy template identifier.",
+				 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
+				return( -1 );
+			}
 		}
 	}
-	if( record_values->provider_name_value == NULL )
-	{
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          record_values->provider_xml_tag,
-		          (uint8_t *) "Guid",
-		          4,
-		          &provider_identifier_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Guid XML attribute.",
-			 function );
-
-			return( -1 );
-		}
-		if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_identifier_xml_tag,
-		     &( record_values->provider_identifier_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider GUID XML element value.",
-			 function );
+	result = libevtx_record_values_get_provider_identifier(
+	          record_values,
+	          record_values->decode_profile_key.provider_identifier,
+	          16,
+	          error );
 
-			return( -1 );
-		}
-	}
-	if( libfvalue_value_get_utf8_string_size(
-	     record_values->provider_identifier_value,
-	     0,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of provider identifier.",
+		 "%s: unable to retrieve provider identifier.",
 		 function );
 
 		return( -1 );
 	}
+	/* A record without an EventID element is attributed to event identifier 0
+	 */
+	if( libevtx_record_values_get_event_identifier(
+	     record_values,
+	     &( record_values->decode_profile_key.event_identifier ),
+	     &event_identifier_error ) != 1 )
+	{
+		libcerror_error_free(
+		 &event_identifier_error );
+
+		record_values->decode_profile_key.event_identifier = 0;
+	}
+	record_values->has_decode_profile_key = 1;
+
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded provider identifier
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Adds a decode cost of the record values to the decode profile of the IO handle
+ * The value index is either LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME or
+ * LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME, the record is only counted once it is decoded
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_provider_identifier(
+int libevtx_record_values_profile_decode_cost(
      libevtx_record_values_t *record_values,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     libevtx_io_handle_t *io_handle,
+     int value_index,
+     uint64_t decode_cost_time,
+     uint64_t number_of_bytes,
+     uint64_t number_of_allocations,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_identifier_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag                = NULL;
-	libfwevt_xml_tag_t *system_xml_tag              = NULL;
-	static char *function                           = "libevtx_record_values_get_utf8_provider_identifier";
-	int result                                      = 0;
+	uint64_t values[ LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ];
+
+	static char *function = "libevtx_record_values_profile_decode_cost";
+	uint64_t chunk_index  = 0;
+	int safe_chunk_index  = -1;
 
 	if( record_values == NULL )
 	{
@@ -1333,129 +1832,82 @@ int libevtx_record_values_get_utf8_provider_identifier(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( record_values->has_decode_profile_key == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 "%s: invalid record values - missing decode profile key.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->provider_xml_tag == NULL )
+	if( io_handle == NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
+		return( -1 );
 	}
-	if( record_values->provider_name_value == NULL )
+	if( ( value_index != LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME )
+	 && ( value_index != LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ) )
 	{
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          record_values->provider_xml_tag,
-		          (uint8_t *) "Guid",
-		          4,
-		          &provider_identifier_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value index.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Guid XML attribute.",
-			 function );
+		return( -1 );
+	}
+	if( io_handle->decode_profile == NULL )
+	{
+		return( 1 );
+	}
+	/* Records that are not stored in a chunk of the file, such as carved records,
+	 * are not attributed to a chunk
+	 */
+	if( ( record_values->offset >= io_handle->chunks_data_offset )
+	 && ( io_handle->chunk_size != 0 ) )
+	{
+		chunk_index = (uint64_t) ( record_values->offset - io_handle->chunks_data_offset ) / io_handle->chunk_size;
 
-			return( -1 );
-		}
-		if( result == 0 )
+		if( chunk_index <= (uint64_t) INT_MAX )
 		{
-			return( 0 );
+			safe_chunk_index = (int) chunk_index;
 		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_identifier_xml_tag,
-		     &( record_values->provider_identifier_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider GUID XML element value.",
-			 function );
+	}
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ]     = 0;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]           = 0;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ]            = 0;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ]       = number_of_bytes;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_ALLOCATIONS ] = number_of_allocations;
 
-			return( -1 );
-		}
+	values[ value_index ] = decode_cost_time;
+
+	if( value_index == LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME )
+	{
+		values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ] = 1;
 	}
-	if( libfvalue_value_copy_to_utf8_string(
-	     record_values->provider_identifier_value,
-	     0,
-	     utf8_string,
-	     utf8_string_size,
+	if( libevtx_decode_profile_add_values(
+	     io_handle->decode_profile,
+	     &( record_values->decode_profile_key ),
+	     safe_chunk_index,
+	     values,
+	     LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider identifier to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add values to decode profile.",
 		 function );
 
 		return( -1 );
@@ -1463,20 +1915,16 @@ int libevtx_record_values_get_utf8_provider_identifier(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded provider identifier
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Marks the record values as partially decoded since they exceed the decode budget
+ * The XML document is freed if it was decoded
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf16_provider_identifier_size(
+int libevtx_record_values_set_partially_decoded(
      libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
+     libevtx_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_identifier_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag                = NULL;
-	libfwevt_xml_tag_t *system_xml_tag              = NULL;
-	static char *function                           = "libevtx_record_values_get_utf16_provider_identifier_size";
-	int result                                      = 0;
+	static char *function = "libevtx_record_values_set_partially_decoded";
 
 	if( record_values == NULL )
 	{
@@ -1489,149 +1937,136 @@ int libevtx_record_values_get_utf16_provider_identifier_size(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->provider_xml_tag == NULL )
+	if( record_values->xml_document != NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
+		if( libfwevt_xml_document_free(
+		     &( record_values->xml_document ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free XML document.",
 			 function );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
+	}
+	record_values->is_partially_decoded = 1;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
+	LIBEVTX_COUNTER_ADD(
+	 io_handle->statistics.number_of_over_budget_records,
+	 1 );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
-		          error );
+	return( 1 );
+}
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
-			 function );
+/* Checks the decoded XML document of the record values against the decode budget
+ * of the IO handle, the record values are marked as partially decoded if the budget is exceeded
+ * Returns 1 if within budget, 0 if the budget is exceeded or -1 on error
+ */
+int libevtx_record_values_check_decode_budget(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     uint64_t decode_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_check_decode_budget";
+	int result            = 0;
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-	}
-	if( record_values->provider_name_value == NULL )
+	if( record_values == NULL )
 	{
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          record_values->provider_xml_tag,
-		          (uint8_t *) "Guid",
-		          4,
-		          &provider_identifier_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Guid XML attribute.",
-			 function );
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-			return( -1 );
-		}
-		if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_identifier_xml_tag,
-		     &( record_values->provider_identifier_value ),
+		return( -1 );
+	}
+	if( libevtx_decode_budget_is_limited(
+	     &( io_handle->decode_budget ) ) == 0 )
+	{
+		return( 1 );
+	}
+	result = libevtx_decode_budget_check_xml_document(
+	          &( io_handle->decode_budget ),
+	          record_values->xml_document,
+	          decode_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check XML document against decode budget.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libevtx_record_values_set_partially_decoded(
+		     record_values,
+		     io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider GUID XML element value.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set partially decoded.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf16_string_size(
-	     record_values->provider_identifier_value,
-	     0,
-	     utf16_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of provider identifier.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the UTF-16 encoded provider identifier
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Reads the record values System values
+ * The System values are read from the binary XML data without decoding the XML document
+ * or from the decoded values file of the IO handle if it contains the record
+ * The IO handle and template cache are optional, the template cache should be the template cache of the chunk
+ * The template cache of the IO handle is used to share the walked templates across chunks
+ * Returns 1 if successful, 0 if the binary XML data is not supported or -1 on error
  */
-int libevtx_record_values_get_utf16_provider_identifier(
+int libevtx_record_values_read_system_values(
      libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     libevtx_io_handle_t *io_handle,
+     libevtx_system_values_template_cache_t *template_cache,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_identifier_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag                = NULL;
-	libfwevt_xml_tag_t *system_xml_tag              = NULL;
-	static char *function                           = "libevtx_record_values_get_utf16_provider_identifier";
+	libevtx_template_cache_t *shared_template_cache = NULL;
+	static char *function                           = "libevtx_record_values_read_system_values";
 	int result                                      = 0;
 
 	if( record_values == NULL )
@@ -1645,38 +2080,17 @@ int libevtx_record_values_get_utf16_provider_identifier(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( record_values->system_values_read != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	if( record_values->provider_xml_tag == NULL )
+	if( ( io_handle != NULL )
+	 && ( io_handle->decoded_values_file != NULL ) )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
+		result = libevtx_decoded_values_file_get_system_values_by_offset(
+		          io_handle->decoded_values_file,
+		          record_values->offset,
+		          &( record_values->system_values ),
 		          error );
 
 		if( result == -1 )
@@ -1685,110 +2099,189 @@ int libevtx_record_values_get_utf16_provider_identifier(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
+			 "%s: unable to retrieve decoded System values.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result == 0 )
+	}
+	if( result == 0 )
+	{
+		/* The template cache of a shared chunk cache takes precedence over that of the file
+		 */
+		if( io_handle != NULL )
 		{
-			return( 0 );
+			shared_template_cache = io_handle->shared_template_cache;
+
+			if( shared_template_cache == NULL )
+			{
+				shared_template_cache = io_handle->template_cache;
+			}
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
+		result = libevtx_system_values_read_data(
+		          &( record_values->system_values ),
+		          template_cache,
+		          shared_template_cache,
+		          chunk_data,
+		          chunk_data_size,
+		          record_values->chunk_data_offset,
+		          (size_t) record_values->data_size,
 		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read System values.",
+		 function );
 
-		if( result == -1 )
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The strings of the System values reference the chunk data
+	 * and are copied since the chunk can be freed before the record values
+	 */
+	if( ( record_values->system_values.flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME ) != 0 )
+	{
+		if( libevtx_record_values_allocate_data(
+		     record_values,
+		     sizeof( uint8_t ) * record_values->system_values.channel_name_size,
+		     (void **) &( record_values->channel_name_data ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create channel name data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result == 0 )
+		if( memory_copy(
+		     record_values->channel_name_data,
+		     record_values->system_values.channel_name,
+		     record_values->system_values.channel_name_size ) == NULL )
 		{
-			return( 0 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy channel name data.",
+			 function );
+
+			goto on_error;
 		}
 	}
-	if( record_values->provider_name_value == NULL )
-	{
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          record_values->provider_xml_tag,
-		          (uint8_t *) "Guid",
-		          4,
-		          &provider_identifier_xml_tag,
-		          error );
+	record_values->system_values.channel_name = record_values->channel_name_data;
 
-		if( result == -1 )
+	if( ( record_values->system_values.flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 )
+	{
+		if( libevtx_record_values_allocate_data(
+		     record_values,
+		     sizeof( uint8_t ) * record_values->system_values.computer_name_size,
+		     (void **) &( record_values->computer_name_data ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Guid XML attribute.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create computer name data.",
 			 function );
 
-			return( -1 );
-		}
-		if( result == 0 )
-		{
-			return( 0 );
+			goto on_error;
 		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_identifier_xml_tag,
-		     &( record_values->provider_identifier_value ),
-		     error ) != 1 )
+		if( memory_copy(
+		     record_values->computer_name_data,
+		     record_values->system_values.computer_name,
+		     record_values->system_values.computer_name_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider GUID XML element value.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy computer name data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	if( libfvalue_value_copy_to_utf16_string(
-	     record_values->provider_identifier_value,
-	     0,
-	     utf16_string,
-	     utf16_string_size,
-	     error ) != 1 )
+	record_values->system_values.computer_name = record_values->computer_name_data;
+
+	record_values->system_values_read = 1;
+
+	return( 1 );
+
+on_error:
+	if( record_values->computer_name_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider identifier to UTF-16 string.",
-		 function );
+		if( record_values->arena == NULL )
+		{
+			memory_free(
+			 record_values->computer_name_data );
+		}
+		record_values->computer_name_data = NULL;
+	}
+	if( record_values->channel_name_data != NULL )
+	{
+		if( record_values->arena == NULL )
+		{
+			memory_free(
+			 record_values->channel_name_data );
+		}
+		record_values->channel_name_data = NULL;
+	}
+	memory_set(
+	 &( record_values->system_values ),
+	 0,
+	 sizeof( libevtx_system_values_t ) );
 
-		return( -1 );
+	return( -1 );
+}
+
+/* Determines if the record values has System values
+ * Returns 1 if the System values were read and contain all the values in system_values_flags or 0 if not
+ */
+int libevtx_record_values_has_system_values(
+     libevtx_record_values_t *record_values,
+     uint8_t system_values_flags )
+{
+	if( record_values == NULL )
+	{
+		return( 0 );
+	}
+	if( record_values->system_values_read == 0 )
+	{
+		return( 0 );
+	}
+	if( ( record_values->system_values.flags & system_values_flags ) != system_values_flags )
+	{
+		return( 0 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded source name
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Resolves the root XML sub elements of the record values
+ * The XML elements are determined in a single pass over the root XML element
+ * by their name identifier and cached in the record values
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_source_name_size(
+int libevtx_record_values_resolve_root_xml_tags(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag          = NULL;
-	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf8_source_name_size";
-	int result                                = 0;
+	libfwevt_xml_tag_t *element_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag    = NULL;
+	static char *function               = "libevtx_record_values_resolve_root_xml_tags";
+	int element_index                   = 0;
+	int name_identifier                 = 0;
+	int number_of_elements              = 0;
 
 	if( record_values == NULL )
 	{
@@ -1812,160 +2305,131 @@ int libevtx_record_values_get_utf8_source_name_size(
 
 		return( -1 );
 	}
-	if( record_values->provider_xml_tag == NULL )
+	if( record_values->root_xml_tags_resolved != 0 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
+		return( 1 );
+	}
+	if( libfwevt_xml_document_get_root_xml_tag(
+	     record_values->xml_document,
+	     &root_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root XML element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     root_xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of root sub elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     root_xml_tag,
+		     element_index,
+		     &element_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
+			 "%s: unable to retrieve root sub element: %d.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
-		          error );
-
-		if( result == -1 )
+		if( libevtx_element_name_get_xml_tag_identifier(
+		     element_xml_tag,
+		     &name_identifier,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
-			 function );
+			 "%s: unable to retrieve root sub element: %d name identifier.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-	}
-	if( record_values->provider_name_value == NULL )
-	{
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          record_values->provider_xml_tag,
-		          (uint8_t *) "EventSourceName",
-		          15,
-		          &provider_name_xml_tag,
-		          error );
-
-		if( result == -1 )
+		/* Only the first sub element with a specific name is used
+		 */
+		switch( name_identifier )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventSourceName XML attribute.",
-			 function );
+			case LIBEVTX_ELEMENT_NAME_EVENT_DATA:
+				if( record_values->event_data_xml_tag == NULL )
+				{
+					record_values->event_data_xml_tag = element_xml_tag;
+				}
+				break;
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-				  record_values->provider_xml_tag,
-				  (uint8_t *) "Name",
-				  4,
-				  &provider_name_xml_tag,
-				  error );
+			case LIBEVTX_ELEMENT_NAME_PROCESSING_ERROR_DATA:
+				if( record_values->processing_error_data_xml_tag == NULL )
+				{
+					record_values->processing_error_data_xml_tag = element_xml_tag;
+				}
+				break;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve Name XML attribute.",
-				 function );
+			case LIBEVTX_ELEMENT_NAME_SYSTEM:
+				if( record_values->system_xml_tag == NULL )
+				{
+					record_values->system_xml_tag = element_xml_tag;
+				}
+				break;
 
-				return( -1 );
-			}
-		}
-		if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_name_xml_tag,
-		     &( record_values->provider_name_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider name XML element value.",
-			 function );
+			case LIBEVTX_ELEMENT_NAME_USER_DATA:
+				if( record_values->user_data_xml_tag == NULL )
+				{
+					record_values->user_data_xml_tag = element_xml_tag;
+				}
+				break;
 
-			return( -1 );
+			default:
+				break;
 		}
 	}
-	if( libfvalue_value_get_utf8_string_size(
-	     record_values->provider_name_value,
-	     0,
-	     utf8_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of provider name.",
-		 function );
+	record_values->root_xml_tags_resolved = 1;
 
-		return( -1 );
-	}
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded source name
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Resolves the System XML elements of the record values
+ * The XML elements and values are determined in a single pass over
+ * the System XML element and cached in the record values
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_source_name(
+int libevtx_record_values_resolve_system_xml_tags(
      libevtx_record_values_t *record_values,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag          = NULL;
-	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf8_source_name";
-	int result                                = 0;
+	libfvalue_value_t **element_value     = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag = NULL;
+	libfwevt_xml_tag_t *element_xml_tag   = NULL;
+	static char *function                 = "libevtx_record_values_resolve_system_xml_tags";
+	int element_index                     = 0;
+	int name_identifier                   = 0;
+	int number_of_elements                = 0;
+	int result                            = 0;
 
 	if( record_values == NULL )
 	{
@@ -1989,49 +2453,295 @@ int libevtx_record_values_get_utf8_source_name(
 
 		return( -1 );
 	}
-	if( record_values->provider_xml_tag == NULL )
+	if( record_values->system_xml_tags_resolved != 0 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
+		return( 1 );
+	}
+	if( libevtx_record_values_resolve_root_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve root XML sub elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->system_xml_tag == NULL )
+	{
+		record_values->system_xml_tags_resolved = 1;
+
+		return( 1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     record_values->system_xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of System sub elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     record_values->system_xml_tag,
+		     element_index,
+		     &element_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
+			 "%s: unable to retrieve System sub element: %d.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
+		if( libevtx_element_name_get_xml_tag_identifier(
+		     element_xml_tag,
+		     &name_identifier,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
+			 "%s: unable to retrieve System sub element: %d name identifier.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		element_value = NULL;
+
+		switch( name_identifier )
 		{
-			return( 0 );
+			case LIBEVTX_ELEMENT_NAME_CHANNEL:
+				element_value = &( record_values->channel_value );
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_COMPUTER:
+				element_value = &( record_values->computer_value );
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_CORRELATION:
+				if( record_values->activity_identifier_value == NULL )
+				{
+					result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+					          element_xml_tag,
+					          (uint8_t *) "ActivityID",
+					          10,
+					          &attribute_xml_tag,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve ActivityID XML attribute.",
+						 function );
+
+						return( -1 );
+					}
+					else if( result != 0 )
+					{
+						element_xml_tag = attribute_xml_tag;
+						element_value   = &( record_values->activity_identifier_value );
+					}
+				}
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_EVENT_IDENTIFIER:
+				if( record_values->event_identifier_xml_tag == NULL )
+				{
+					record_values->event_identifier_xml_tag = element_xml_tag;
+				}
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_EVENT_RECORD_IDENTIFIER:
+				element_value = &( record_values->event_record_identifier_value );
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_EXECUTION:
+				if( record_values->process_identifier_value == NULL )
+				{
+					result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+					          element_xml_tag,
+					          (uint8_t *) "ProcessID",
+					          9,
+					          &attribute_xml_tag,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve ProcessID XML attribute.",
+						 function );
+
+						return( -1 );
+					}
+					else if( result != 0 )
+					{
+						if( libfwevt_xml_tag_get_value(
+						     attribute_xml_tag,
+						     &( record_values->process_identifier_value ),
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve ProcessID XML attribute value.",
+							 function );
+
+							return( -1 );
+						}
+					}
+				}
+				if( record_values->thread_identifier_value == NULL )
+				{
+					result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+					          element_xml_tag,
+					          (uint8_t *) "ThreadID",
+					          8,
+					          &attribute_xml_tag,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve ThreadID XML attribute.",
+						 function );
+
+						return( -1 );
+					}
+					else if( result != 0 )
+					{
+						if( libfwevt_xml_tag_get_value(
+						     attribute_xml_tag,
+						     &( record_values->thread_identifier_value ),
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve ThreadID XML attribute value.",
+							 function );
+
+							return( -1 );
+						}
+					}
+				}
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_KEYWORDS:
+				element_value = &( record_values->keywords_value );
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_LEVEL:
+				element_value = &( record_values->level_value );
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_OPCODE:
+				element_value = &( record_values->oppcode_value );
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_PROVIDER:
+				if( record_values->provider_xml_tag == NULL )
+				{
+					record_values->provider_xml_tag = element_xml_tag;
+				}
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_SECURITY:
+				if( record_values->user_security_identifier_value == NULL )
+				{
+					result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+					          element_xml_tag,
+					          (uint8_t *) "UserID",
+					          6,
+					          &attribute_xml_tag,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve UserID XML attribute.",
+						 function );
+
+						return( -1 );
+					}
+					else if( result != 0 )
+					{
+						element_xml_tag = attribute_xml_tag;
+						element_value   = &( record_values->user_security_identifier_value );
+					}
+				}
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_TASK:
+				element_value = &( record_values->task_value );
+				break;
+
+			case LIBEVTX_ELEMENT_NAME_VERSION:
+				element_value = &( record_values->version_value );
+				break;
+
+			default:
+				break;
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
+		if( ( element_value != NULL )
+		 && ( *element_value == NULL ) )
+		{
+			if( libfwevt_xml_tag_get_value(
+			     element_xml_tag,
+			     element_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve System sub element: %d value.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( record_values->provider_xml_tag != NULL )
+	{
+		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+		          record_values->provider_xml_tag,
+		          (uint8_t *) "Guid",
+		          4,
+		          &attribute_xml_tag,
 		          error );
 
 		if( result == -1 )
@@ -2040,23 +2750,33 @@ int libevtx_record_values_get_utf8_source_name(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
+			 "%s: unable to retrieve Guid XML attribute.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		else if( result != 0 )
 		{
-			return( 0 );
+			if( libfwevt_xml_tag_get_value(
+			     attribute_xml_tag,
+			     &( record_values->provider_identifier_value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider GUID XML element value.",
+				 function );
+
+				return( -1 );
+			}
 		}
-	}
-	if( record_values->provider_name_value == NULL )
-	{
 		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
 		          record_values->provider_xml_tag,
 		          (uint8_t *) "EventSourceName",
 		          15,
-		          &provider_name_xml_tag,
+		          &attribute_xml_tag,
 		          error );
 
 		if( result == -1 )
@@ -2073,11 +2793,11 @@ int libevtx_record_values_get_utf8_source_name(
 		else if( result == 0 )
 		{
 			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-				  record_values->provider_xml_tag,
-				  (uint8_t *) "Name",
-				  4,
-				  &provider_name_xml_tag,
-				  error );
+			          record_values->provider_xml_tag,
+			          (uint8_t *) "Name",
+			          4,
+			          &attribute_xml_tag,
+			          error );
 
 			if( result == -1 )
 			{
@@ -2091,58 +2811,59 @@ int libevtx_record_values_get_utf8_source_name(
 				return( -1 );
 			}
 		}
-		if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_name_xml_tag,
-		     &( record_values->provider_name_value ),
-		     error ) != 1 )
+		if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider name XML element value.",
-			 function );
+			if( libfwevt_xml_tag_get_value(
+			     attribute_xml_tag,
+			     &( record_values->provider_name_value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider name XML element value.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
 	}
-	if( libfvalue_value_copy_to_utf8_string(
-	     record_values->provider_name_value,
-	     0,
-	     utf8_string,
-	     utf8_string_size,
+	if( libevtx_record_values_decode_system_scalars(
+	     record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider name to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode System scalar values.",
 		 function );
 
 		return( -1 );
 	}
+	record_values->system_xml_tags_resolved = 1;
+
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded source name
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Decodes the System scalar values of the record values
+ * The values are copied once from the resolved System XML elements into
+ * native integers, so that the getters and filters do not need to convert
+ * the values on every call. A value that cannot be converted is not decoded
+ * and the corresponding getter reports the conversion error instead
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf16_source_name_size(
+int libevtx_record_values_decode_system_scalars(
      libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag          = NULL;
-	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf16_source_name_size";
-	int result                                = 0;
+	libevtx_record_system_scalars_t *system_scalars = NULL;
+	libfvalue_value_t *event_identifier_value       = NULL;
+	libfvalue_value_t *qualifiers_value             = NULL;
+	libfwevt_xml_tag_t *qualifiers_xml_tag          = NULL;
+	static char *function                           = "libevtx_record_values_decode_system_scalars";
+	int result                                      = 0;
 
 	if( record_values == NULL )
 	{
@@ -2155,38 +2876,31 @@ int libevtx_record_values_get_utf16_source_name_size(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
-		 function );
+	system_scalars = &( record_values->system_scalars );
 
-		return( -1 );
-	}
-	if( record_values->provider_xml_tag == NULL )
+	system_scalars->flags = 0;
+
+	if( record_values->event_identifier_xml_tag != NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
+		if( libfwevt_xml_tag_get_value(
+		     record_values->event_identifier_xml_tag,
+		     &event_identifier_value,
+		     NULL ) == 1 )
+		{
+			if( libfvalue_value_copy_to_32bit(
+			     event_identifier_value,
+			     0,
+			     &( system_scalars->event_identifier ),
+			     NULL ) == 1 )
+			{
+				system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_IDENTIFIER;
+			}
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
+		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+		          record_values->event_identifier_xml_tag,
+		          (uint8_t *) "Qualifiers",
+		          10,
+		          &qualifiers_xml_tag,
 		          error );
 
 		if( result == -1 )
@@ -2195,109 +2909,239 @@ int libevtx_record_values_get_utf16_source_name_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
+			 "%s: unable to retrieve Qualifiers XML attribute.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		else if( result != 0 )
 		{
-			return( 0 );
+			if( libfwevt_xml_tag_get_value(
+			     qualifiers_xml_tag,
+			     &qualifiers_value,
+			     NULL ) == 1 )
+			{
+				if( libfvalue_value_copy_to_32bit(
+				     qualifiers_value,
+				     0,
+				     &( system_scalars->qualifiers ),
+				     NULL ) == 1 )
+				{
+					system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_QUALIFIERS;
+				}
+			}
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
-		          error );
-
-		if( result == -1 )
+	}
+	if( record_values->level_value != NULL )
+	{
+		if( libfvalue_value_copy_to_8bit(
+		     record_values->level_value,
+		     0,
+		     &( system_scalars->event_level ),
+		     NULL ) == 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
-			 function );
-
-			return( -1 );
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_LEVEL;
 		}
-		else if( result == 0 )
+	}
+	if( record_values->task_value != NULL )
+	{
+		if( libfvalue_value_copy_to_16bit(
+		     record_values->task_value,
+		     0,
+		     &( system_scalars->task ),
+		     NULL ) == 1 )
 		{
-			return( 0 );
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_TASK;
 		}
 	}
-	if( record_values->provider_name_value == NULL )
+	if( record_values->oppcode_value != NULL )
 	{
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          record_values->provider_xml_tag,
-		          (uint8_t *) "EventSourceName",
-		          15,
-		          &provider_name_xml_tag,
-		          error );
+		if( libfvalue_value_copy_to_8bit(
+		     record_values->oppcode_value,
+		     0,
+		     &( system_scalars->opcode ),
+		     NULL ) == 1 )
+		{
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_OPCODE;
+		}
+	}
+	if( record_values->keywords_value != NULL )
+	{
+		if( libfvalue_value_copy_to_64bit(
+		     record_values->keywords_value,
+		     0,
+		     &( system_scalars->keywords ),
+		     NULL ) == 1 )
+		{
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_KEYWORDS;
+		}
+	}
+	if( record_values->version_value != NULL )
+	{
+		if( libfvalue_value_copy_to_8bit(
+		     record_values->version_value,
+		     0,
+		     &( system_scalars->event_version ),
+		     NULL ) == 1 )
+		{
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_VERSION;
+		}
+	}
+	if( record_values->event_record_identifier_value != NULL )
+	{
+		if( libfvalue_value_copy_to_64bit(
+		     record_values->event_record_identifier_value,
+		     0,
+		     &( system_scalars->event_record_identifier ),
+		     NULL ) == 1 )
+		{
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_RECORD_IDENTIFIER;
+		}
+	}
+	if( record_values->process_identifier_value != NULL )
+	{
+		if( libfvalue_value_copy_to_32bit(
+		     record_values->process_identifier_value,
+		     0,
+		     &( system_scalars->process_identifier ),
+		     NULL ) == 1 )
+		{
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_PROCESS_IDENTIFIER;
+		}
+	}
+	if( record_values->thread_identifier_value != NULL )
+	{
+		if( libfvalue_value_copy_to_32bit(
+		     record_values->thread_identifier_value,
+		     0,
+		     &( system_scalars->thread_identifier ),
+		     NULL ) == 1 )
+		{
+			system_scalars->flags |= LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_THREAD_IDENTIFIER;
+		}
+	}
+	return( 1 );
+}
 
-		if( result == -1 )
+/* Retrieves the event identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_event_identifier(
+     libevtx_record_values_t *record_values,
+     uint32_t *event_identifier,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *event_identifier_value = NULL;
+	static char *function                     = "libevtx_record_values_get_event_identifier";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER ) != 0 ) )
+	{
+		if( event_identifier == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventSourceName XML attribute.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid event identifier.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-				  record_values->provider_xml_tag,
-				  (uint8_t *) "Name",
-				  4,
-				  &provider_name_xml_tag,
-				  error );
+		*event_identifier = record_values->system_values.event_identifier;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve Name XML attribute.",
-				 function );
+		return( 1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_name_xml_tag,
-		     &( record_values->provider_name_value ),
-		     error ) != 1 )
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_IDENTIFIER ) != 0 )
+	{
+		if( event_identifier == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider name XML element value.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid event identifier.",
 			 function );
 
 			return( -1 );
 		}
+		*event_identifier = record_values->system_scalars.event_identifier;
+
+		return( 1 );
 	}
-	if( libfvalue_value_get_utf16_string_size(
-	     record_values->provider_name_value,
-	     0,
-	     utf16_string_size,
+	if( record_values->event_identifier_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing EventID XML element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     record_values->event_identifier_xml_tag,
+	     &event_identifier_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of provider name.",
+		 "%s: unable to retrieve EventID XML element value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_copy_to_32bit(
+	     event_identifier_value,
+	     0,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to event identifier.",
 		 function );
 
 		return( -1 );
@@ -2305,21 +3149,18 @@ int libevtx_record_values_get_utf16_source_name_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded source name
- * The size should include the end of string character
+/* Retrieves the event identifier qualifiers
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_source_name(
+int libevtx_record_values_get_event_identifier_qualifiers(
      libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint32_t *event_identifier_qualifiers,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag          = NULL;
-	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf16_source_name";
-	int result                                = 0;
+	libfvalue_value_t *qualifiers_value    = NULL;
+	libfwevt_xml_tag_t *qualifiers_xml_tag = NULL;
+	static char *function                  = "libevtx_record_values_get_event_identifier_qualifiers";
+	int result                             = 0;
 
 	if( record_values == NULL )
 	{
@@ -2343,160 +3184,109 @@ int libevtx_record_values_get_utf16_source_name(
 
 		return( -1 );
 	}
-	if( record_values->provider_xml_tag == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_QUALIFIERS ) != 0 )
+	{
+		if( event_identifier_qualifiers == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid event identifier qualifiers.",
 			 function );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
+		*event_identifier_qualifiers = record_values->system_scalars.qualifiers;
 
-		if( result == -1 )
+		return( 1 );
+	}
+	if( record_values->event_identifier_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing EventID XML element.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+	          record_values->event_identifier_xml_tag,
+	          (uint8_t *) "Qualifiers",
+	          10,
+	          &qualifiers_xml_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Qualifiers XML attribute.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfwevt_xml_tag_get_value(
+		     qualifiers_xml_tag,
+		     &qualifiers_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
+			 "%s: unable to retrieve Qualifiers XML element value.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Provider",
-		          8,
-		          &( record_values->provider_xml_tag ),
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Provider XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-	}
-	if( record_values->provider_name_value == NULL )
-	{
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          record_values->provider_xml_tag,
-		          (uint8_t *) "EventSourceName",
-		          15,
-		          &provider_name_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventSourceName XML attribute.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-				  record_values->provider_xml_tag,
-				  (uint8_t *) "Name",
-				  4,
-				  &provider_name_xml_tag,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve Name XML attribute.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     provider_name_xml_tag,
-		     &( record_values->provider_name_value ),
+		if( libfvalue_value_copy_to_32bit(
+		     qualifiers_value,
+		     0,
+		     event_identifier_qualifiers,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider name XML element value.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to qualifiers.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf16_string(
-	     record_values->provider_name_value,
-	     0,
-	     utf16_string,
-	     utf16_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider name to UTF-16 string.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the size of the UTF-8 encoded computer name
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the event level
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_computer_name_size(
+int libevtx_record_values_get_event_level(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
+     uint8_t *event_level,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *computer_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_computer_name_size";
-	int result                           = 0;
+	static char *function = "libevtx_record_values_get_event_level";
 
 	if( record_values == NULL )
 	{
@@ -2509,6 +3299,26 @@ int libevtx_record_values_get_utf8_computer_name_size(
 
 		return( -1 );
 	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL ) != 0 ) )
+	{
+		if( event_level == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid event level.",
+			 function );
+
+			return( -1 );
+		}
+		*event_level = record_values->system_values.event_level;
+
+		return( 1 );
+	}
 	if( record_values->xml_document == NULL )
 	{
 		libcerror_error_set(
@@ -2520,92 +3330,58 @@ int libevtx_record_values_get_utf8_computer_name_size(
 
 		return( -1 );
 	}
-	if( record_values->computer_value == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_LEVEL ) != 0 )
+	{
+		if( event_level == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid event level.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Computer",
-		          8,
-		          &computer_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Computer XML element.",
-			 function );
+		*event_level = record_values->system_scalars.event_level;
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     computer_xml_tag,
-		     &( record_values->computer_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve computer XML element value.",
-			 function );
+		return( 1 );
+	}
+	if( record_values->level_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing Level XML element.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( libfvalue_value_get_utf8_string_size(
-	     record_values->computer_value,
+	if( libfvalue_value_copy_to_8bit(
+	     record_values->level_value,
 	     0,
-	     utf8_string_size,
+	     event_level,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of computer name.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to event level.",
 		 function );
 
 		return( -1 );
@@ -2613,21 +3389,15 @@ int libevtx_record_values_get_utf8_computer_name_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded computer name
- * The size should include the end of string character
+/* Retrieves the event task
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_computer_name(
+int libevtx_record_values_get_task(
      libevtx_record_values_t *record_values,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     uint16_t *task,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *computer_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_computer_name";
-	int result                           = 0;
+	static char *function = "libevtx_record_values_get_task";
 
 	if( record_values == NULL )
 	{
@@ -2651,93 +3421,51 @@ int libevtx_record_values_get_utf8_computer_name(
 
 		return( -1 );
 	}
-	if( record_values->computer_value == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Computer",
-		          8,
-		          &computer_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_TASK ) != 0 )
+	{
+		if( task == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Computer XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid task.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     computer_xml_tag,
-		     &( record_values->computer_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve computer XML element value.",
-			 function );
+		*task = record_values->system_scalars.task;
 
-			return( -1 );
-		}
+		return( 1 );
 	}
-	if( libfvalue_value_copy_to_utf8_string(
-	     record_values->computer_value,
+	if( record_values->task_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_16bit(
+	     record_values->task_value,
 	     0,
-	     utf8_string,
-	     utf8_string_size,
+	     task,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy computer name to UTF-8 string.",
+		 "%s: unable to copy value to event task.",
 		 function );
 
 		return( -1 );
@@ -2745,20 +3473,15 @@ int libevtx_record_values_get_utf8_computer_name(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded computer name
- * The returned size includes the end of string character
+/* Retrieves the event opcode
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_computer_name_size(
+int libevtx_record_values_get_opcode(
      libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
+     uint8_t *opcode,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *computer_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	static char *function                = "libevtx_record_values_get_utf16_computer_name_size";
-	int result                           = 0;
+	static char *function = "libevtx_record_values_get_opcode";
 
 	if( record_values == NULL )
 	{
@@ -2782,92 +3505,51 @@ int libevtx_record_values_get_utf16_computer_name_size(
 
 		return( -1 );
 	}
-	if( record_values->computer_value == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Computer",
-		          8,
-		          &computer_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_OPCODE ) != 0 )
+	{
+		if( opcode == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Computer XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid opcode.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     computer_xml_tag,
-		     &( record_values->computer_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve computer XML element value.",
-			 function );
+		*opcode = record_values->system_scalars.opcode;
 
-			return( -1 );
-		}
+		return( 1 );
 	}
-	if( libfvalue_value_get_utf16_string_size(
-	     record_values->computer_value,
+	if( record_values->oppcode_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_8bit(
+	     record_values->oppcode_value,
 	     0,
-	     utf16_string_size,
+	     opcode,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of computer name.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to event opcode.",
 		 function );
 
 		return( -1 );
@@ -2875,21 +3557,15 @@ int libevtx_record_values_get_utf16_computer_name_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded computer name
- * The size should include the end of string character
+/* Retrieves the keywords
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_computer_name(
+int libevtx_record_values_get_keywords(
      libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint64_t *keywords,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *computer_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	static char *function                = "libevtx_record_values_get_utf16_computer_name";
-	int result                           = 0;
+	static char *function = "libevtx_record_values_get_keywords";
 
 	if( record_values == NULL )
 	{
@@ -2913,93 +3589,51 @@ int libevtx_record_values_get_utf16_computer_name(
 
 		return( -1 );
 	}
-	if( record_values->computer_value == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Computer",
-		          8,
-		          &computer_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_KEYWORDS ) != 0 )
+	{
+		if( keywords == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Computer XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid keywords.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     computer_xml_tag,
-		     &( record_values->computer_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve computer XML element value.",
-			 function );
+		*keywords = record_values->system_scalars.keywords;
 
-			return( -1 );
-		}
+		return( 1 );
 	}
-	if( libfvalue_value_copy_to_utf16_string(
-	     record_values->computer_value,
+	if( record_values->keywords_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_64bit(
+	     record_values->keywords_value,
 	     0,
-	     utf16_string,
-	     utf16_string_size,
+	     keywords,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy computer name to UTF-16 string.",
+		 "%s: unable to copy value to keywords.",
 		 function );
 
 		return( -1 );
@@ -3007,21 +3641,15 @@ int libevtx_record_values_get_utf16_computer_name(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded user security identifier
- * The returned size includes the end of string character
+/* Retrieves the event version
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_user_security_identifier_size(
+int libevtx_record_values_get_event_version(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
+     uint8_t *event_version,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *security_xml_tag = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	libfwevt_xml_tag_t *user_id_xml_tag  = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_user_security_identifier_size";
-	int result                           = 0;
+	static char *function = "libevtx_record_values_get_event_version";
 
 	if( record_values == NULL )
 	{
@@ -3045,114 +3673,51 @@ int libevtx_record_values_get_utf8_user_security_identifier_size(
 
 		return( -1 );
 	}
-	if( record_values->user_security_identifier_value == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Security",
-		          8,
-		          &security_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Security XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          security_xml_tag,
-		          (uint8_t *) "UserID",
-		          6,
-		          &user_id_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_VERSION ) != 0 )
+	{
+		if( event_version == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UserID XML attribute.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid event version.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     user_id_xml_tag,
-		     &( record_values->user_security_identifier_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve user identifier XML element value.",
-			 function );
+		*event_version = record_values->system_scalars.event_version;
 
-			return( -1 );
-		}
+		return( 1 );
 	}
-	if( libfvalue_value_get_utf8_string_size(
-	     record_values->user_security_identifier_value,
+	if( record_values->version_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_8bit(
+	     record_values->version_value,
 	     0,
-	     utf8_string_size,
+	     event_version,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of user security identifier.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to event version.",
 		 function );
 
 		return( -1 );
@@ -3160,22 +3725,22 @@ int libevtx_record_values_get_utf8_user_security_identifier_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded user security identifier
- * The size should include the end of string character
+/* Retrieves the provider identifier
+ * The identifier is a little-endian GUID and is 16 bytes of size
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_user_security_identifier(
+int libevtx_record_values_get_provider_identifier(
      libevtx_record_values_t *record_values,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     uint8_t *guid_data,
+     size_t guid_data_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *security_xml_tag = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	libfwevt_xml_tag_t *user_id_xml_tag  = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_user_security_identifier";
-	int result                           = 0;
+	uint16_t provider_identifier_string[ 64 ];
+
+	libfguid_identifier_t *provider_identifier_guid = NULL;
+	static char *function                           = "libevtx_record_values_get_provider_identifier";
+	size_t provider_identifier_string_size          = 0;
+	int result                                      = 0;
 
 	if( record_values == NULL )
 	{
@@ -3188,148 +3753,169 @@ int libevtx_record_values_get_utf8_user_security_identifier(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( guid_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->user_security_identifier_value == NULL )
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 ) )
+	{
+		if( memory_copy(
+		     guid_data,
+		     record_values->system_values.provider_identifier,
+		     16 ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier.",
 			 function );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
+		return( 1 );
+	}
+	/* The XML document stores the provider identifier as a string
+	 */
+	result = libevtx_record_values_get_utf16_provider_identifier_size(
+	          record_values,
+	          &provider_identifier_string_size,
+	          error );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 provider identifier size.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Security",
-		          8,
-		          &security_xml_tag,
-		          error );
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( provider_identifier_string_size == 0 )
+	      || ( provider_identifier_string_size > 64 ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_record_values_get_utf16_provider_identifier(
+	     record_values,
+	     provider_identifier_string,
+	     provider_identifier_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 provider identifier.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Security XML element.",
-			 function );
+		goto on_error;
+	}
+	if( libfguid_identifier_initialize(
+	     &provider_identifier_guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create provider identifier GUID.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          security_xml_tag,
-		          (uint8_t *) "UserID",
-		          6,
-		          &user_id_xml_tag,
-		          error );
+		goto on_error;
+	}
+	/* A provider identifier that is not a valid GUID string is not available
+	 */
+	result = libfguid_identifier_copy_from_utf16_string(
+	          provider_identifier_guid,
+	          provider_identifier_string,
+	          provider_identifier_string_size - 1,
+	          LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+	          error );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UserID XML attribute.",
-			 function );
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 error );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     user_id_xml_tag,
-		     &( record_values->user_security_identifier_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve user identifier XML element value.",
-			 function );
+		result = 0;
+	}
+	else if( libfguid_identifier_copy_to_byte_stream(
+	          provider_identifier_guid,
+	          guid_data,
+	          guid_data_size,
+	          LIBFGUID_ENDIAN_LITTLE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier GUID to byte stream.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
-	if( libfvalue_value_copy_to_utf8_string(
-	     record_values->user_security_identifier_value,
-	     0,
-	     utf8_string,
-	     utf8_string_size,
+	if( libfguid_identifier_free(
+	     &provider_identifier_guid,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy user security identifier to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free provider identifier GUID.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
+	return( result );
+
+on_error:
+	if( provider_identifier_guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &provider_identifier_guid,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded user security identifier
+/* Retrieves the size of the UTF-8 encoded provider identifier
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_user_security_identifier_size(
+int libevtx_record_values_get_utf8_provider_identifier_size(
      libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *security_xml_tag = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	libfwevt_xml_tag_t *user_id_xml_tag  = NULL;
-	static char *function                = "libevtx_record_values_get_utf16_user_security_identifier_size";
-	int result                           = 0;
+	static char *function = "libevtx_record_values_get_utf8_provider_identifier_size";
 
 	if( record_values == NULL )
 	{
@@ -3342,6 +3928,26 @@ int libevtx_record_values_get_utf16_user_security_identifier_size(
 
 		return( -1 );
 	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 ) )
+	{
+		if( utf8_string_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_size = LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE;
+
+		return( 1 );
+	}
 	if( record_values->xml_document == NULL )
 	{
 		libcerror_error_set(
@@ -3353,114 +3959,34 @@ int libevtx_record_values_get_utf16_user_security_identifier_size(
 
 		return( -1 );
 	}
-	if( record_values->user_security_identifier_value == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Security",
-		          8,
-		          &security_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Security XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          security_xml_tag,
-		          (uint8_t *) "UserID",
-		          6,
-		          &user_id_xml_tag,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UserID XML attribute.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     user_id_xml_tag,
-		     &( record_values->user_security_identifier_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve user identifier XML element value.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( libfvalue_value_get_utf16_string_size(
-	     record_values->user_security_identifier_value,
+	if( record_values->provider_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf8_string_size(
+	     record_values->provider_identifier_value,
 	     0,
-	     utf16_string_size,
+	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of user security identifier.",
+		 "%s: unable to retrieve UTF-8 string size of provider identifier.",
 		 function );
 
 		return( -1 );
@@ -3468,22 +3994,17 @@ int libevtx_record_values_get_utf16_user_security_identifier_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded user security identifier
+/* Retrieves the UTF-8 encoded provider identifier
  * The size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_user_security_identifier(
+int libevtx_record_values_get_utf8_provider_identifier(
      libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *root_xml_tag     = NULL;
-	libfwevt_xml_tag_t *security_xml_tag = NULL;
-	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	libfwevt_xml_tag_t *user_id_xml_tag  = NULL;
-	static char *function                = "libevtx_record_values_get_utf16_user_security_identifier";
-	int result                           = 0;
+	static char *function = "libevtx_record_values_get_utf8_provider_identifier";
 
 	if( record_values == NULL )
 	{
@@ -3496,6 +4017,28 @@ int libevtx_record_values_get_utf16_user_security_identifier(
 
 		return( -1 );
 	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 ) )
+	{
+		if( libevtx_system_values_copy_provider_identifier_to_string(
+		     &( record_values->system_values ),
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( record_values->xml_document == NULL )
 	{
 		libcerror_error_set(
@@ -3507,105 +4050,236 @@ int libevtx_record_values_get_utf16_user_security_identifier(
 
 		return( -1 );
 	}
-	if( record_values->user_security_identifier_value == NULL )
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          root_xml_tag,
-		          (uint8_t *) "System",
-		          6,
-		          &system_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( record_values->provider_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf8_string(
+	     record_values->provider_identifier_value,
+	     0,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded provider identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_provider_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_provider_identifier_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 ) )
+	{
+		if( utf16_string_size == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve System XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string size.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-		          system_xml_tag,
-		          (uint8_t *) "Security",
-		          8,
-		          &security_xml_tag,
-		          error );
+		*utf16_string_size = LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE;
 
-		if( result == -1 )
+		return( 1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->provider_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf16_string_size(
+	     record_values->provider_identifier_value,
+	     0,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded provider identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_provider_identifier(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier_string[ LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE ];
+
+	static char *function = "libevtx_record_values_get_utf16_provider_identifier";
+	size_t string_index   = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 ) )
+	{
+		if( utf16_string == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve Security XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-		          security_xml_tag,
-		          (uint8_t *) "UserID",
-		          6,
-		          &user_id_xml_tag,
-		          error );
-
-		if( result == -1 )
+		if( utf16_string_size < LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UserID XML attribute.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-16 string size value too small.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     user_id_xml_tag,
-		     &( record_values->user_security_identifier_value ),
+		if( libevtx_system_values_copy_provider_identifier_to_string(
+		     &( record_values->system_values ),
+		     provider_identifier_string,
+		     LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve user identifier XML element value.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier to string.",
 			 function );
 
 			return( -1 );
 		}
+		for( string_index = 0;
+		     string_index < LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE;
+		     string_index++ )
+		{
+			utf16_string[ string_index ] = (uint16_t) provider_identifier_string[ string_index ];
+		}
+		return( 1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->provider_identifier_value == NULL )
+	{
+		return( 0 );
 	}
 	if( libfvalue_value_copy_to_utf16_string(
-	     record_values->user_security_identifier_value,
+	     record_values->provider_identifier_value,
 	     0,
 	     utf16_string,
 	     utf16_string_size,
@@ -3615,7 +4289,7 @@ int libevtx_record_values_get_utf16_user_security_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy user security identifier to UTF-16 string.",
+		 "%s: unable to copy provider identifier to UTF-16 string.",
 		 function );
 
 		return( -1 );
@@ -3623,31 +4297,16 @@ int libevtx_record_values_get_utf16_user_security_identifier(
 	return( 1 );
 }
 
-/* Parses a data XML tag for the record values using the template
- * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+/* Retrieves the size of the UTF-8 encoded source name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_parse_data_xml_tag_by_template(
+int libevtx_record_values_get_utf8_source_name_size(
      libevtx_record_values_t *record_values,
-     libfwevt_xml_tag_t *data_xml_tag,
-     libfwevt_xml_tag_t *template_xml_tag,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *sub_data_xml_tag     = NULL;
-	libfwevt_xml_tag_t *sub_template_xml_tag = NULL;
-	uint8_t *data_name                       = NULL;
-	uint8_t *template_name                   = NULL;
-	static char *function                    = "libevtx_record_values_parse_data_xml_tag_by_template";
-	size_t data_name_size                    = 0;
-	size_t template_name_size                = 0;
-	uint8_t template_xml_tag_flags           = 0;
-	int attribute_index                      = 0;
-	int entry_index                          = 0;
-	int sub_element_index                    = 0;
-	int number_of_data_attributes            = 0;
-	int number_of_data_elements              = 0;
-	int number_of_template_attributes        = 0;
-	int number_of_template_elements          = 0;
-	int result                               = 0;
+	static char *function = "libevtx_record_values_get_utf8_source_name_size";
 
 	if( record_values == NULL )
 	{
@@ -3660,407 +4319,3050 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_number_of_attributes(
-	     data_xml_tag,
-	     &number_of_data_attributes,
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of data attributes.",
+		 "%s: unable to resolve System XML elements.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( template_xml_tag != NULL )
+	if( record_values->provider_name_value == NULL )
 	{
-		if( libfwevt_xml_tag_get_number_of_attributes(
-		     template_xml_tag,
-		     &number_of_template_attributes,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of template attributes.",
-			 function );
-
-			goto on_error;
-		}
-		if( number_of_data_attributes != number_of_template_attributes )
-		{
-			return( 0 );
-		}
+		return( 0 );
 	}
-	if( libfwevt_xml_tag_get_number_of_elements(
-	     data_xml_tag,
-	     &number_of_data_elements,
+	if( libfvalue_value_get_utf8_string_size(
+	     record_values->provider_name_value,
+	     0,
+	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of data elements.",
+		 "%s: unable to retrieve UTF-8 string size of provider name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( template_xml_tag != NULL )
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded source name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_source_name(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_source_name";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->provider_name_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf8_string(
+	     record_values->provider_name_value,
+	     0,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded source name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_source_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_source_name_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->provider_name_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf16_string_size(
+	     record_values->provider_name_value,
+	     0,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of provider name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded source name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_source_name(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_source_name";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->provider_name_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf16_string(
+	     record_values->provider_name_value,
+	     0,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded computer name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_computer_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_computer_name_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 ) )
+	{
+		if( libevtx_utf16_stream_get_utf8_string_size(
+		     record_values->system_values.computer_name,
+		     record_values->system_values.computer_name_size,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of computer name.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->computer_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf8_string_size(
+	     record_values->computer_value,
+	     0,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of computer name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded computer name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_computer_name(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_computer_name";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 ) )
+	{
+		if( libevtx_utf16_stream_copy_to_utf8_string(
+		     record_values->system_values.computer_name,
+		     record_values->system_values.computer_name_size,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy computer name to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->computer_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf8_string(
+	     record_values->computer_value,
+	     0,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded computer name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_computer_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_computer_name_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 ) )
+	{
+		if( libuna_utf16_string_size_from_utf16_stream(
+		     record_values->system_values.computer_name,
+		     record_values->system_values.computer_name_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size of computer name.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->computer_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf16_string_size(
+	     record_values->computer_value,
+	     0,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of computer name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded computer name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_computer_name(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_computer_name";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->xml_document == NULL )
+	 && ( libevtx_record_values_has_system_values(
+	       record_values,
+	       LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 ) )
+	{
+		if( libuna_utf16_string_copy_from_utf16_stream(
+		     utf16_string,
+		     utf16_string_size,
+		     record_values->system_values.computer_name,
+		     record_values->system_values.computer_name_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy computer name to UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->computer_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf16_string(
+	     record_values->computer_value,
+	     0,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded channel name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_channel_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_channel_name_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->channel_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf8_string_size(
+	     record_values->channel_value,
+	     0,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of channel name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded channel name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_channel_name(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_channel_name";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->channel_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf8_string(
+	     record_values->channel_value,
+	     0,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy channel name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded channel name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_channel_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_channel_name_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->channel_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf16_string_size(
+	     record_values->channel_value,
+	     0,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of channel name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded channel name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_channel_name(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_channel_name";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->channel_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf16_string(
+	     record_values->channel_value,
+	     0,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy channel name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded user security identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_user_security_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_user_security_identifier_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->user_security_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf8_string_size(
+	     record_values->user_security_identifier_value,
+	     0,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of user security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded user security identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_user_security_identifier(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_user_security_identifier";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->user_security_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf8_string(
+	     record_values->user_security_identifier_value,
+	     0,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded user security identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_user_security_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_user_security_identifier_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->user_security_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf16_string_size(
+	     record_values->user_security_identifier_value,
+	     0,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of user security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded user security identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_user_security_identifier(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_user_security_identifier";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->user_security_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf16_string(
+	     record_values->user_security_identifier_value,
+	     0,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the process identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_process_identifier(
+     libevtx_record_values_t *record_values,
+     uint32_t *process_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_process_identifier";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_PROCESS_IDENTIFIER ) != 0 )
+	{
+		if( process_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid process identifier.",
+			 function );
+
+			return( -1 );
+		}
+		*process_identifier = record_values->system_scalars.process_identifier;
+
+		return( 1 );
+	}
+	if( record_values->process_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_32bit(
+	     record_values->process_identifier_value,
+	     0,
+	     process_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to process identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the thread identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_thread_identifier(
+     libevtx_record_values_t *record_values,
+     uint32_t *thread_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_thread_identifier";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values->system_scalars.flags & LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_THREAD_IDENTIFIER ) != 0 )
+	{
+		if( thread_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid thread identifier.",
+			 function );
+
+			return( -1 );
+		}
+		*thread_identifier = record_values->system_scalars.thread_identifier;
+
+		return( 1 );
+	}
+	if( record_values->thread_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_32bit(
+	     record_values->thread_identifier_value,
+	     0,
+	     thread_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to thread identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded activity identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_activity_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_activity_identifier_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->activity_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf8_string_size(
+	     record_values->activity_identifier_value,
+	     0,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of activity identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded activity identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_activity_identifier(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_activity_identifier";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->activity_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf8_string(
+	     record_values->activity_identifier_value,
+	     0,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy activity identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded activity identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_activity_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_activity_identifier_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->activity_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_utf16_string_size(
+	     record_values->activity_identifier_value,
+	     0,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of activity identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded activity identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_activity_identifier(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_activity_identifier";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_resolve_system_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve System XML elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->activity_identifier_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_copy_to_utf16_string(
+	     record_values->activity_identifier_value,
+	     0,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy activity identifier to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a data XML tag for the record values using the template
+ * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+ */
+int libevtx_record_values_parse_data_xml_tag_by_template(
+     libevtx_record_values_t *record_values,
+     libfwevt_xml_tag_t *data_xml_tag,
+     libfwevt_xml_tag_t *template_xml_tag,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *sub_data_xml_tag     = NULL;
+	libfwevt_xml_tag_t *sub_template_xml_tag = NULL;
+	uint8_t *data_name                       = NULL;
+	uint8_t *template_name                   = NULL;
+	static char *function                    = "libevtx_record_values_parse_data_xml_tag_by_template";
+	size_t data_name_size                    = 0;
+	size_t template_name_size                = 0;
+	uint8_t template_xml_tag_flags           = 0;
+	int attribute_index                      = 0;
+	int entry_index                          = 0;
+	int sub_element_index                    = 0;
+	int number_of_data_attributes            = 0;
+	int number_of_data_elements              = 0;
+	int number_of_template_attributes        = 0;
+	int number_of_template_elements          = 0;
+	int result                               = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     data_xml_tag,
+	     &number_of_data_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data attributes.",
+		 function );
+
+		goto on_error;
+	}
+	if( template_xml_tag != NULL )
+	{
+		if( libfwevt_xml_tag_get_number_of_attributes(
+		     template_xml_tag,
+		     &number_of_template_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template attributes.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_data_attributes != number_of_template_attributes )
+		{
+			return( 0 );
+		}
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     data_xml_tag,
+	     &number_of_data_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data elements.",
+		 function );
+
+		goto on_error;
+	}
+	if( template_xml_tag != NULL )
+	{
+		if( libfwevt_xml_tag_get_number_of_elements(
+		     template_xml_tag,
+		     &number_of_template_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template elements.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_data_elements != number_of_template_elements )
+		{
+			return( 0 );
+		}
+	}
+	if( template_xml_tag != NULL )
+	{
+		if( libfwevt_xml_tag_get_utf8_name_size(
+		     data_xml_tag,
+		     &data_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data element name size.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_get_utf8_name_size(
+		     template_xml_tag,
+		     &template_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template element name size.",
+			 function );
+
+			goto on_error;
+		}
+		if( data_name_size != template_name_size )
+		{
+			return( 0 );
+		}
+		data_name = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * data_name_size );
+
+		if( data_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data name.",
+			 function );
+
+			goto on_error;
+		}
+		template_name = (uint8_t *) memory_allocate(
+		                             sizeof( uint8_t ) * template_name_size );
+
+		if( template_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create template name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_get_utf8_name(
+		     data_xml_tag,
+		     data_name,
+		     data_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data element name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_get_utf8_name(
+		     template_xml_tag,
+		     template_name,
+		     template_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template element name.",
+			 function );
+
+			goto on_error;
+		}
+		result = memory_compare(
+			  data_name,
+			  template_name,
+			  sizeof( uint8_t ) * template_name_size );
+
+		memory_free(
+		 template_name );
+
+		template_name = NULL;
+
+		memory_free(
+		 data_name );
+
+		data_name = NULL;
+
+		if( result != 0 )
+		{
+			return( 0 );
+		}
+	}
+	for( attribute_index = 0;
+	     attribute_index < number_of_data_attributes;
+	     attribute_index++ )
+	{
+		if( libfwevt_xml_tag_get_attribute_by_index(
+		     data_xml_tag,
+		     attribute_index,
+		     &sub_data_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data attribute: %d.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( template_xml_tag != NULL )
+		{
+			if( libfwevt_xml_tag_get_attribute_by_index(
+			     template_xml_tag,
+			     attribute_index,
+			     &sub_template_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template attribute: %d.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+		}
+		result = libevtx_record_values_parse_data_xml_tag_by_template(
+		          record_values,
+		          sub_data_xml_tag,
+		          sub_template_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse event data attribute: %d XML tag.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+	}
+	if( number_of_data_elements == 0 )
+	{
+		if( template_xml_tag != NULL )
+		{
+			if( libfwevt_xml_tag_get_flags(
+			     template_xml_tag,
+			     &template_xml_tag_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template XML tag flags.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libfwevt_xml_tag_get_flags(
+			     data_xml_tag,
+			     &template_xml_tag_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element XML tag flags.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( template_xml_tag_flags == LIBFWEVT_XML_TAG_FLAG_IS_TEMPLATE_DEFINITION )
+		{
+			if( libcdata_array_append_entry(
+			     record_values->string_identifiers_array,
+			     &entry_index,
+			     (intptr_t *) template_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append template XML tag to string identifiers array.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     record_values->strings_array,
+			     &entry_index,
+			     (intptr_t *) data_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data XML tag to strings array.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else for( sub_element_index = 0;
+	          sub_element_index < number_of_data_elements;
+	          sub_element_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     data_xml_tag,
+		     sub_element_index,
+		     &sub_data_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data sub element: %d.",
+			 function,
+			 sub_element_index );
+
+			goto on_error;
+		}
+		if( template_xml_tag != NULL )
+		{
+			if( libfwevt_xml_tag_get_element_by_index(
+			     template_xml_tag,
+			     sub_element_index,
+			     &sub_template_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template sub element: %d.",
+				 function,
+				 sub_element_index );
+
+				goto on_error;
+			}
+		}
+		result = libevtx_record_values_parse_data_xml_tag_by_template(
+		          record_values,
+		          sub_data_xml_tag,
+		          sub_template_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse event data sub element: %d XML tag.",
+			 function,
+			 sub_element_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( template_name != NULL )
+	{
+		memory_free(
+		 template_name );
+	}
+	if( data_name != NULL )
+	{
+		memory_free(
+		 data_name );
+	}
+	return( -1 );
+}
+
+/* Resizes the string identifiers and strings arrays
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_resize_strings_arrays(
+     libevtx_record_values_t *record_values,
+     int number_of_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_resize_strings_arrays";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of strings value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_resize(
+	     record_values->string_identifiers_array,
+	     number_of_strings,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string identifiers array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_resize(
+	     record_values->strings_array,
+	     number_of_strings,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize strings array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a data XML tag for the record values using the compiled nodes of the template definition
+ * The nodes are walked once, the XML tags of a node that does not match
+ * and its sub nodes are skipped like libevtx_record_values_parse_data_xml_tag_by_template does
+ * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+ */
+int libevtx_record_values_parse_data_xml_tag_by_template_definition(
+     libevtx_record_values_t *record_values,
+     libfwevt_xml_tag_t *data_xml_tag,
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error )
+{
+	libevtx_template_node_t *node       = NULL;
+	libfwevt_xml_tag_t **data_xml_tags  = NULL;
+	libfwevt_xml_tag_t *node_xml_tag    = NULL;
+	libfwevt_xml_tag_t *parent_xml_tag  = NULL;
+	uint8_t *data_name                  = NULL;
+	uint8_t *reallocation               = NULL;
+	static char *function               = "libevtx_record_values_parse_data_xml_tag_by_template_definition";
+	size_t data_name_allocated_size     = 0;
+	size_t data_name_size               = 0;
+	int node_index                      = 0;
+	int number_of_data_attributes       = 0;
+	int number_of_data_elements         = 0;
+	int number_of_strings               = 0;
+	int result                          = 1;
+	int string_index                    = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_template_definition->nodes == NULL )
+	 || ( internal_template_definition->number_of_nodes <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid template definition - missing nodes.",
+		 function );
+
+		return( -1 );
+	}
+	data_xml_tags = (libfwevt_xml_tag_t **) memory_allocate(
+	                                         sizeof( libfwevt_xml_tag_t * ) * internal_template_definition->number_of_nodes );
+
+	if( data_xml_tags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data XML tags.",
+		 function );
+
+		goto on_error;
+	}
+	/* The strings arrays are sized once for all the value nodes of the template
+	 * definition instead of growing them for every value of the record
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     record_values->strings_array,
+	     &string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_strings = string_index + internal_template_definition->number_of_value_nodes;
+
+	if( libevtx_record_values_resize_strings_arrays(
+	     record_values,
+	     number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize strings arrays.",
+		 function );
+
+		goto on_error;
+	}
+	while( node_index < internal_template_definition->number_of_nodes )
+	{
+		node = &( internal_template_definition->nodes[ node_index ] );
+
+		/* A node is only visited when its parent node matched
+		 */
+		if( node->parent_node_index >= 0 )
+		{
+			parent_xml_tag = data_xml_tags[ node->parent_node_index ];
+		}
+		if( node->type == LIBEVTX_TEMPLATE_NODE_TYPE_VALUE )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     record_values->string_identifiers_array,
+			     string_index,
+			     (intptr_t *) node->xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set template XML tag: %d in string identifiers array.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     record_values->strings_array,
+			     string_index,
+			     (intptr_t *) parent_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data XML tag: %d in strings array.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			string_index++;
+			node_index++;
+
+			continue;
+		}
+		if( node->parent_node_index < 0 )
+		{
+			node_xml_tag = data_xml_tag;
+		}
+		else if( node->type == LIBEVTX_TEMPLATE_NODE_TYPE_ATTRIBUTE )
+		{
+			if( libfwevt_xml_tag_get_attribute_by_index(
+			     parent_xml_tag,
+			     node->xml_tag_index,
+			     &node_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data attribute: %d.",
+				 function,
+				 node->xml_tag_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libfwevt_xml_tag_get_element_by_index(
+			     parent_xml_tag,
+			     node->xml_tag_index,
+			     &node_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data sub element: %d.",
+				 function,
+				 node->xml_tag_index );
+
+				goto on_error;
+			}
+		}
+		if( libfwevt_xml_tag_get_number_of_attributes(
+		     node_xml_tag,
+		     &number_of_data_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data attributes.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_get_number_of_elements(
+		     node_xml_tag,
+		     &number_of_data_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data elements.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_get_utf8_name_size(
+		     node_xml_tag,
+		     &data_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data element name size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( number_of_data_attributes != node->number_of_attributes )
+		 || ( number_of_data_elements != node->number_of_elements )
+		 || ( data_name_size != node->name_size ) )
+		{
+			if( node->parent_node_index < 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			node_index = node->next_node_index;
+
+			continue;
+		}
+		/* The data name buffer is reused for all the nodes of the record
+		 */
+		if( data_name_size > data_name_allocated_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            data_name,
+			                            sizeof( uint8_t ) * data_name_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data name.",
+				 function );
+
+				goto on_error;
+			}
+			data_name                = reallocation;
+			data_name_allocated_size = data_name_size;
+		}
+		if( libfwevt_xml_tag_get_utf8_name(
+		     node_xml_tag,
+		     data_name,
+		     data_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data element name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     data_name,
+		     node->name,
+		     sizeof( uint8_t ) * node->name_size ) != 0 )
+		{
+			if( node->parent_node_index < 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			node_index = node->next_node_index;
+
+			continue;
+		}
+		data_xml_tags[ node_index ] = node_xml_tag;
+
+		node_index++;
+	}
+	/* Value nodes of sub elements that did not match are not set
+	 */
+	if( string_index < number_of_strings )
+	{
+		if( libevtx_record_values_resize_strings_arrays(
+		     record_values,
+		     string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize strings arrays.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( data_name != NULL )
+	{
+		memory_free(
+		 data_name );
+	}
+	memory_free(
+	 data_xml_tags );
+
+	return( result );
+
+on_error:
+	if( data_name != NULL )
+	{
+		memory_free(
+		 data_name );
+	}
+	if( data_xml_tags != NULL )
+	{
+		memory_free(
+		 data_xml_tags );
+	}
+	return( -1 );
+}
+
+/* Parses the record values data
+ * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+ */
+int libevtx_record_values_parse_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *element_xml_tag       = NULL;
+	libfwevt_xml_tag_t *event_data_xml_tag    = NULL;
+	libfwevt_xml_tag_t *user_data_xml_tag     = NULL;
+	static char *function                     = "libevtx_record_values_parse_data";
+	uint64_t parse_start_time                 = 0;
+	int number_of_elements                    = 0;
+	int number_of_strings                     = 0;
+	int result                                = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values - data already parsed.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->string_identifiers_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values - string identifiers array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->strings_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values - strings array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle != NULL )
+	 && ( io_handle->decode_profile != NULL ) )
+	{
+		parse_start_time = libevtx_statistics_get_time();
+	}
+	if( libcdata_array_initialize(
+	     &( record_values->string_identifiers_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string identifiers array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( record_values->strings_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create strings array.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_template_definition != NULL )
+	{
+		if( internal_template_definition->xml_document == NULL )
+		{
+			if( libevtx_template_definition_read(
+			     internal_template_definition,
+			     io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read template definition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The template is compiled once and reused for all the records of the event
+		 */
+		if( internal_template_definition->nodes == NULL )
+		{
+			if( libevtx_template_definition_compile(
+			     internal_template_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compile template definition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libevtx_record_values_resolve_root_xml_tags(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve root XML sub elements.",
+		 function );
+
+		goto on_error;
+	}
+	event_data_xml_tag = record_values->event_data_xml_tag;
+
+	if( event_data_xml_tag == NULL )
 	{
-		if( libfwevt_xml_tag_get_number_of_elements(
-		     template_xml_tag,
-		     &number_of_template_elements,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of template elements.",
-			 function );
+		event_data_xml_tag = record_values->processing_error_data_xml_tag;
+	}
+	result = ( event_data_xml_tag != NULL );
 
-			goto on_error;
-		}
-		if( number_of_data_elements != number_of_template_elements )
+	if( result != 0 )
+	{
+		/* The EventData templates start with the EventData or ProcessingErrorData
+		 */
+		if( internal_template_definition != NULL )
 		{
-			return( 0 );
+			result = libevtx_record_values_parse_data_xml_tag_by_template_definition(
+				  record_values,
+				  event_data_xml_tag,
+				  internal_template_definition,
+				  error );
 		}
-	}
-	if( template_xml_tag != NULL )
-	{
-		if( libfwevt_xml_tag_get_utf8_name_size(
-		     data_xml_tag,
-		     &data_name_size,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data element name size.",
-			 function );
-
-			goto on_error;
+			result = libevtx_record_values_parse_data_xml_tag_by_template(
+				  record_values,
+				  event_data_xml_tag,
+				  NULL,
+				  error );
 		}
-		if( libfwevt_xml_tag_get_utf8_name_size(
-		     template_xml_tag,
-		     &template_name_size,
-		     error ) != 1 )
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template element name size.",
+			 "%s: unable to parse event data root element.",
 			 function );
 
 			goto on_error;
 		}
-		if( data_name_size != template_name_size )
-		{
-			return( 0 );
-		}
-		data_name = (uint8_t *) memory_allocate(
-		                         sizeof( uint8_t ) * data_name_size );
+	}
+	else
+	{
+		user_data_xml_tag = record_values->user_data_xml_tag;
 
-		if( data_name == NULL )
+		if( user_data_xml_tag != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data name.",
-			 function );
+			result = 0;
 
-			goto on_error;
-		}
-		template_name = (uint8_t *) memory_allocate(
-		                             sizeof( uint8_t ) * template_name_size );
+			/* The UserData templates start with the EventXML tag
+			 */
+			if( libfwevt_xml_tag_get_number_of_elements(
+			     user_data_xml_tag,
+			     &number_of_elements,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of user data elements.",
+				 function );
 
-		if( template_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create template name.",
-			 function );
+				goto on_error;
+			}
+			if( number_of_elements == 1 )
+			{
+				if( libfwevt_xml_tag_get_element_by_index(
+				     user_data_xml_tag,
+				     0,
+				     &element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve user data element: 0.",
+					 function );
 
-			goto on_error;
+					goto on_error;
+				}
+				if( internal_template_definition != NULL )
+				{
+					result = libevtx_record_values_parse_data_xml_tag_by_template_definition(
+						  record_values,
+						  element_xml_tag,
+						  internal_template_definition,
+						  error );
+				}
+				else
+				{
+					result = libevtx_record_values_parse_data_xml_tag_by_template(
+						  record_values,
+						  element_xml_tag,
+						  NULL,
+						  error );
+				}
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to parse user data element: 0.",
+					 function );
+
+					goto on_error;
+				}
+			}
 		}
-		if( libfwevt_xml_tag_get_utf8_name(
-		     data_xml_tag,
-		     data_name,
-		     data_name_size,
+	}
+	/* The arrays and every parsed string are counted as allocations
+	 */
+	if( ( io_handle != NULL )
+	 && ( io_handle->decode_profile != NULL )
+	 && ( record_values->has_decode_profile_key != 0 ) )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     record_values->strings_array,
+		     &number_of_strings,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data element name.",
+			 "%s: unable to retrieve number of strings.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfwevt_xml_tag_get_utf8_name(
-		     template_xml_tag,
-		     template_name,
-		     template_name_size,
+		if( libevtx_record_values_profile_decode_cost(
+		     record_values,
+		     io_handle,
+		     LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME,
+		     libevtx_statistics_get_time() - parse_start_time,
+		     0,
+		     2 + (uint64_t) number_of_strings,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template element name.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to profile parse cost.",
 			 function );
 
 			goto on_error;
 		}
-		result = memory_compare(
-			  data_name,
-			  template_name,
-			  sizeof( uint8_t ) * template_name_size );
+	}
+	record_values->data_parsed = 1;
 
-		memory_free(
-		 template_name );
+	return( result );
 
-		template_name = NULL;
+on_error:
+	if( record_values->strings_array != NULL )
+	{
+		libcdata_array_free(
+		 &( record_values->strings_array ),
+		 NULL,
+		 NULL );
+	}
+	if( record_values->string_identifiers_array != NULL )
+	{
+		libcdata_array_free(
+		 &( record_values->string_identifiers_array ),
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
 
-		memory_free(
-		 data_name );
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_number_of_strings(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_number_of_strings";
 
-		data_name = NULL;
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-		if( result != 0 )
-		{
-			return( 0 );
-		}
+		return( -1 );
 	}
-	for( attribute_index = 0;
-	     attribute_index < number_of_data_attributes;
-	     attribute_index++ )
+	if( record_values->xml_document == NULL )
 	{
-		if( libfwevt_xml_tag_get_attribute_by_index(
-		     data_xml_tag,
-		     attribute_index,
-		     &sub_data_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data attribute: %d.",
-			 function,
-			 attribute_index );
-
-			goto on_error;
-		}
-		if( template_xml_tag != NULL )
-		{
-			if( libfwevt_xml_tag_get_attribute_by_index(
-			     template_xml_tag,
-			     attribute_index,
-			     &sub_template_xml_tag,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template attribute: %d.",
-				 function,
-				 attribute_index );
-
-				goto on_error;
-			}
-		}
-		result = libevtx_record_values_parse_data_xml_tag_by_template(
-		          record_values,
-		          sub_data_xml_tag,
-		          sub_template_xml_tag,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to parse event data attribute: %d XML tag.",
-			 function,
-			 attribute_index );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( number_of_data_elements == 0 )
+	if( libcdata_array_get_number_of_entries(
+	     record_values->strings_array,
+	     number_of_strings,
+	     error ) != 1 )
 	{
-		if( template_xml_tag != NULL )
-		{
-			if( libfwevt_xml_tag_get_flags(
-			     template_xml_tag,
-			     &template_xml_tag_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template XML tag flags.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		else
-		{
-			if( libfwevt_xml_tag_get_flags(
-			     data_xml_tag,
-			     &template_xml_tag_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve element XML tag flags.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-		}
-		if( template_xml_tag_flags == LIBFWEVT_XML_TAG_FLAG_IS_TEMPLATE_DEFINITION )
-		{
-			if( libcdata_array_append_entry(
-			     record_values->string_identifiers_array,
-			     &entry_index,
-			     (intptr_t *) template_xml_tag,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append template XML tag to string identifiers array.",
-				 function );
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_string_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf8_string_size";
 
-				goto on_error;
-			}
-			if( libcdata_array_append_entry(
-			     record_values->strings_array,
-			     &entry_index,
-			     (intptr_t *) data_xml_tag,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append data XML tag to strings array.",
-				 function );
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-				goto on_error;
-			}
-		}
+		return( -1 );
 	}
-	else for( sub_element_index = 0;
-	          sub_element_index < number_of_data_elements;
-	          sub_element_index++ )
+	if( record_values->xml_document == NULL )
 	{
-		if( libfwevt_xml_tag_get_element_by_index(
-		     data_xml_tag,
-		     sub_element_index,
-		     &sub_data_xml_tag,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data sub element: %d.",
-			 function,
-			 sub_element_index );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( template_xml_tag != NULL )
-		{
-			if( libfwevt_xml_tag_get_element_by_index(
-			     template_xml_tag,
-			     sub_element_index,
-			     &sub_template_xml_tag,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template sub element: %d.",
-				 function,
-				 sub_element_index );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
 
-				goto on_error;
-			}
-		}
-		result = libevtx_record_values_parse_data_xml_tag_by_template(
-		          record_values,
-		          sub_data_xml_tag,
-		          sub_template_xml_tag,
-		          error );
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_value_size(
+	     string_xml_tag,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value size.",
+		 function,
+		 string_index );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_string(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf8_string";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to parse event data sub element: %d XML tag.",
-			 function,
-			 sub_element_index );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	return( 1 );
-
-on_error:
-	if( template_name != NULL )
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
 	{
-		memory_free(
-		 template_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
 	}
-	if( data_name != NULL )
+	if( libfwevt_xml_tag_get_utf8_value(
+	     string_xml_tag,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
-		memory_free(
-		 data_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Parses the record values data
- * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+/* Retrieves all UTF-8 encoded strings
+ * The strings are converted once and stored consecutively in a buffer that is
+ * owned by the record values. The string sizes include the end of string character
+ * and are 0 for a string without a value
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_parse_data(
+int libevtx_record_values_get_utf8_strings(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     libevtx_internal_template_definition_t *internal_template_definition,
+     const uint8_t **utf8_strings,
+     int *number_of_strings,
+     const size_t **utf8_string_offsets,
+     const size_t **utf8_string_sizes,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *element_xml_tag       = NULL;
-	libfwevt_xml_tag_t *event_data_xml_tag    = NULL;
-	libfwevt_xml_tag_t *root_xml_tag          = NULL;
-	libfwevt_xml_tag_t *template_root_xml_tag = NULL;
-	libfwevt_xml_tag_t *user_data_xml_tag     = NULL;
-	static char *function                     = "libevtx_record_values_parse_data";
-	int number_of_elements                    = 0;
-	int result                                = 0;
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf8_strings";
+	size_t *string_sizes               = NULL;
+	size_t utf8_strings_size           = 0;
+	int string_index                   = 0;
 
 	if( record_values == NULL )
 	{
@@ -4073,285 +7375,377 @@ int libevtx_record_values_parse_data(
 
 		return( -1 );
 	}
-	if( record_values->data_parsed != 0 )
+	if( record_values->xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record values - data already parsed.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->string_identifiers_array != NULL )
+	if( utf8_strings == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record values - string identifiers array value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->strings_array != NULL )
+	if( number_of_strings == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record values - strings array value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( record_values->string_identifiers_array ),
-	     0,
-	     error ) != 1 )
+	if( utf8_string_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create string identifiers array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string offsets.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( record_values->strings_array ),
-	     0,
-	     error ) != 1 )
+	if( utf8_string_sizes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create strings array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string sizes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_template_definition != NULL )
+	if( record_values->utf8_strings_converted == 0 )
 	{
-		if( internal_template_definition->xml_document == NULL )
+		if( record_values->data_parsed == 0 )
 		{
-			if( libevtx_template_definition_read(
-			     internal_template_definition,
+			if( libevtx_record_values_parse_data(
+			     record_values,
 			     io_handle,
+			     NULL,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read template definition.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to parse data.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     internal_template_definition->xml_document,
-		     &template_root_xml_tag,
+		if( libcdata_array_get_number_of_entries(
+		     record_values->strings_array,
+		     &( record_values->number_of_utf8_strings ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template root XML element.",
+			 "%s: unable to retrieve number of strings.",
 			 function );
 
 			goto on_error;
 		}
-	}
-	if( libfwevt_xml_document_get_root_xml_tag(
-	     record_values->xml_document,
-	     &root_xml_tag,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root XML element.",
-		 function );
-
-		goto on_error;
-	}
-	result = libfwevt_xml_tag_get_element_by_utf8_name(
-		  root_xml_tag,
-		  (uint8_t *) "EventData",
-		  9,
-		  &event_data_xml_tag,
-		  error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve EventData XML element.",
-		 function );
-
-		goto on_error;
-	}
-	else if( result == 0 )
-	{
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "ProcessingErrorData",
-			  19,
-			  &event_data_xml_tag,
-			  error );
-
-		if( result == -1 )
+		if( ( record_values->number_of_utf8_strings < 0 )
+		 || ( (size_t) record_values->number_of_utf8_strings > ( (size_t) SSIZE_MAX / ( 2 * sizeof( size_t ) ) ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve ProcessingErrorData XML element.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of strings value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
-	}
-	if( result != 0 )
-	{
-		/* The EventData templates start with the EventData or ProcessingErrorData
-		 */
-		result = libevtx_record_values_parse_data_xml_tag_by_template(
-			  record_values,
-			  event_data_xml_tag,
-			  template_root_xml_tag,
-			  error );
-
-		if( result == -1 )
+		if( record_values->number_of_utf8_strings > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to parse event data root element.",
-			 function );
+			if( libevtx_record_values_allocate_data(
+			     record_values,
+			     sizeof( size_t ) * 2 * record_values->number_of_utf8_strings,
+			     (void **) &( record_values->utf8_string_offsets ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create UTF-8 string offsets.",
+				 function );
 
-			goto on_error;
-		}
-	}
-	else
-	{
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "UserData",
-			  8,
-			  &user_data_xml_tag,
-			  error );
+				goto on_error;
+			}
+			string_sizes = &( record_values->utf8_string_offsets[ record_values->number_of_utf8_strings ] );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UserData XML element.",
-			 function );
+			/* Determine the sizes of all strings first so that they can be stored in a single buffer
+			 */
+			for( string_index = 0;
+			     string_index < record_values->number_of_utf8_strings;
+			     string_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     record_values->strings_array,
+				     string_index,
+				     (intptr_t **) &string_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve string: %d.",
+					 function,
+					 string_index );
 
-			goto on_error;
+					goto on_error;
+				}
+				if( libfwevt_xml_tag_get_utf8_value_size(
+				     string_xml_tag,
+				     &( string_sizes[ string_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve string: %d value size.",
+					 function,
+					 string_index );
+
+					goto on_error;
+				}
+				if( string_sizes[ string_index ] > ( (size_t) SSIZE_MAX - utf8_strings_size ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid UTF-8 strings size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				record_values->utf8_string_offsets[ string_index ] = utf8_strings_size;
+
+				utf8_strings_size += string_sizes[ string_index ];
+			}
 		}
-		else if( result != 0 )
+		if( utf8_strings_size > 0 )
 		{
-			result = 0;
-
-			/* The UserData templates start with the EventXML tag
-			 */
-			if( libfwevt_xml_tag_get_number_of_elements(
-			     user_data_xml_tag,
-			     &number_of_elements,
+			if( libevtx_record_values_allocate_data(
+			     record_values,
+			     sizeof( uint8_t ) * utf8_strings_size,
+			     (void **) &( record_values->utf8_strings ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of user data elements.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create UTF-8 strings.",
 				 function );
 
 				goto on_error;
 			}
-			if( number_of_elements == 1 )
+			for( string_index = 0;
+			     string_index < record_values->number_of_utf8_strings;
+			     string_index++ )
 			{
-				if( libfwevt_xml_tag_get_element_by_index(
-				     user_data_xml_tag,
-				     0,
-				     &element_xml_tag,
+				if( string_sizes[ string_index ] == 0 )
+				{
+					continue;
+				}
+				if( libcdata_array_get_entry_by_index(
+				     record_values->strings_array,
+				     string_index,
+				     (intptr_t **) &string_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve user data element: 0.",
-					 function );
+					 "%s: unable to retrieve string: %d.",
+					 function,
+					 string_index );
+
+					goto on_error;
+				}
+				if( libfwevt_xml_tag_get_utf8_value(
+				     string_xml_tag,
+				     &( record_values->utf8_strings[ record_values->utf8_string_offsets[ string_index ] ] ),
+				     string_sizes[ string_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve string: %d value.",
+					 function,
+					 string_index );
 
 					goto on_error;
 				}
-				result = libevtx_record_values_parse_data_xml_tag_by_template(
-					  record_values,
-					  element_xml_tag,
-					  template_root_xml_tag,
-					  error );
+			}
+		}
+		record_values->utf8_strings_converted = 1;
+	}
+	*utf8_strings        = record_values->utf8_strings;
+	*number_of_strings   = record_values->number_of_utf8_strings;
+	*utf8_string_offsets = record_values->utf8_string_offsets;
+	*utf8_string_sizes   = NULL;
+
+	if( record_values->utf8_string_offsets != NULL )
+	{
+		*utf8_string_sizes = &( record_values->utf8_string_offsets[ record_values->number_of_utf8_strings ] );
+	}
+	return( 1 );
+
+on_error:
+	if( record_values->utf8_strings != NULL )
+	{
+		if( record_values->arena == NULL )
+		{
+			memory_free(
+			 record_values->utf8_strings );
+		}
+		record_values->utf8_strings = NULL;
+	}
+	if( record_values->utf8_string_offsets != NULL )
+	{
+		if( record_values->arena == NULL )
+		{
+			memory_free(
+			 record_values->utf8_string_offsets );
+		}
+		record_values->utf8_string_offsets = NULL;
+	}
+	record_values->number_of_utf8_strings = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_string_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf16_string_size";
 
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to parse user data element: 0.",
-					 function );
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-					goto on_error;
-				}
-			}
-		}
+		return( -1 );
 	}
-	record_values->data_parsed = 1;
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
 
-	return( result );
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
 
-on_error:
-	if( record_values->strings_array != NULL )
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
 	{
-		libcdata_array_free(
-		 &( record_values->strings_array ),
-		 NULL,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
 	}
-	if( record_values->string_identifiers_array != NULL )
+	if( libfwevt_xml_tag_get_utf16_value_size(
+	     string_xml_tag,
+	     utf16_string_size,
+	     error ) != 1 )
 	{
-		libcdata_array_free(
-		 &( record_values->string_identifiers_array ),
-		 NULL,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value size.",
+		 function,
+		 string_index );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the number of strings
+/* Retrieves a specific UTF-16 encoded string
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_number_of_strings(
+int libevtx_record_values_get_utf16_string(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     int *number_of_strings,
+     int string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_number_of_strings";
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf16_string";
 
 	if( record_values == NULL )
 	{
@@ -4393,36 +7787,57 @@ int libevtx_record_values_get_number_of_strings(
 			return( -1 );
 		}
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libcdata_array_get_entry_by_index(
 	     record_values->strings_array,
-	     number_of_strings,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings.",
-		 function );
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf16_value(
+	     string_xml_tag,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded string
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the XML tag that contains the name of a specific string
+ * The name is the value of the Name attribute of the string element, such as
+ * <Data Name="SubjectUserSid">, or otherwise the name of the element itself
+ * Returns 1 if the name is the value of the XML tag, 0 if the name is the name of the XML tag or -1 on error
  */
-int libevtx_record_values_get_utf8_string_size(
+int libevtx_record_values_get_string_name_xml_tag(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
      int string_index,
-     size_t *utf8_string_size,
+     libfwevt_xml_tag_t **name_xml_tag,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *string_xml_tag = NULL;
-	static char *function              = "libevtx_record_values_get_utf8_string_size";
+	libfwevt_xml_tag_t *attribute_xml_tag = NULL;
+	libfwevt_xml_tag_t *string_xml_tag    = NULL;
+	static char *function                 = "libevtx_record_values_get_string_name_xml_tag";
+	int result                            = 0;
 
 	if( record_values == NULL )
 	{
@@ -4446,6 +7861,17 @@ int libevtx_record_values_get_utf8_string_size(
 
 		return( -1 );
 	}
+	if( name_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name XML tag.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_values->data_parsed == 0 )
 	{
 		if( libevtx_record_values_parse_data(
@@ -4480,38 +7906,209 @@ int libevtx_record_values_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_utf8_value_size(
-	     string_xml_tag,
-	     utf8_string_size,
-	     error ) != 1 )
+	result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+	          string_xml_tag,
+	          (uint8_t *) "Name",
+	          4,
+	          &attribute_xml_tag,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value size.",
+		 "%s: unable to retrieve string: %d Name attribute.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*name_xml_tag = attribute_xml_tag;
+	}
+	else
+	{
+		*name_xml_tag = string_xml_tag;
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of a specific string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_string_name_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *name_xml_tag = NULL;
+	static char *function            = "libevtx_record_values_get_utf8_string_name_size";
+	int result                       = 0;
+
+	result = libevtx_record_values_get_string_name_xml_tag(
+	          record_values,
+	          io_handle,
+	          string_index,
+	          &name_xml_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d name XML tag.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libfwevt_xml_tag_get_utf8_value_size(
+		          name_xml_tag,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwevt_xml_tag_get_utf8_name_size(
+		          name_xml_tag,
+		          utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d name size.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded name of a specific string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_string_name(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *name_xml_tag = NULL;
+	static char *function            = "libevtx_record_values_get_utf8_string_name";
+	int result                       = 0;
+
+	result = libevtx_record_values_get_string_name_xml_tag(
+	          record_values,
+	          io_handle,
+	          string_index,
+	          &name_xml_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d name XML tag.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libfwevt_xml_tag_get_utf8_value(
+		          name_xml_tag,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwevt_xml_tag_get_utf8_name(
+		          name_xml_tag,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d name.",
 		 function,
 		 string_index );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 encoded string name
+ * The hash is a 32-bit FNV-1a of the string without the end of string character
+ * Returns the hash
+ */
+uint32_t libevtx_record_values_get_string_name_hash(
+          const uint8_t *utf8_string,
+          size_t utf8_string_length )
+{
+	uint32_t hash        = 0x811c9dc5UL;
+	size_t string_offset = 0;
+
+	if( utf8_string == NULL )
+	{
+		return( hash );
+	}
+	for( string_offset = 0;
+	     string_offset < utf8_string_length;
+	     string_offset++ )
+	{
+		hash ^= (uint32_t) utf8_string[ string_offset ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
 }
 
-/* Retrieves a specific UTF-8 encoded string
- * The size should include the end of string character
+/* Builds the string name index of the record values
+ * The index maps the hash of the name of every string to its string index
+ * and is built once when a string is first retrieved by name
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_string(
+int libevtx_record_values_build_string_name_index(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     int string_index,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *string_xml_tag = NULL;
-	static char *function              = "libevtx_record_values_get_utf8_string";
+	uint8_t *name_string    = NULL;
+	static char *function   = "libevtx_record_values_build_string_name_index";
+	size_t name_string_size = 0;
+	size_t string_name_size = 0;
+	uint32_t hash           = 0;
+	int number_of_strings   = 0;
+	int slot_index          = 0;
+	int string_index        = 0;
+	int table_size          = 0;
 
 	if( record_values == NULL )
 	{
@@ -4524,83 +8121,227 @@ int libevtx_record_values_get_utf8_string(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( record_values->string_name_index_built != 0 )
+	{
+		return( 1 );
+	}
+	if( libevtx_record_values_get_number_of_strings(
+	     record_values,
+	     io_handle,
+	     &number_of_strings,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( record_values->data_parsed == 0 )
+	if( number_of_strings > 0 )
 	{
-		if( libevtx_record_values_parse_data(
+		/* The table has at least twice the number of strings as slots
+		 */
+		table_size = 8;
+
+		while( table_size < ( 2 * number_of_strings ) )
+		{
+			if( table_size > ( (int) ( SSIZE_MAX / ( sizeof( uint32_t ) + sizeof( int ) ) ) / 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of strings value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			table_size *= 2;
+		}
+		if( libevtx_record_values_allocate_data(
 		     record_values,
-		     io_handle,
-		     NULL,
+		     ( sizeof( uint32_t ) * number_of_strings ) + ( sizeof( int ) * table_size ),
+		     (void **) &( record_values->string_name_hashes ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse data.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string name index.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		record_values->string_name_index_table      = (int *) &( record_values->string_name_hashes[ number_of_strings ] );
+		record_values->string_name_index_table_size = table_size;
+
+		if( memory_set(
+		     record_values->string_name_index_table,
+		     0,
+		     sizeof( int ) * table_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear string name index table.",
+			 function );
+
+			goto on_error;
+		}
+		for( string_index = 0;
+		     string_index < number_of_strings;
+		     string_index++ )
+		{
+			if( libevtx_record_values_get_utf8_string_name_size(
+			     record_values,
+			     io_handle,
+			     string_index,
+			     &string_name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d name size.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			if( string_name_size > name_string_size )
+			{
+				if( string_name_size > (size_t) SSIZE_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid string: %d name size value exceeds maximum.",
+					 function,
+					 string_index );
+
+					goto on_error;
+				}
+				if( name_string != NULL )
+				{
+					memory_free(
+					 name_string );
+				}
+				name_string = (uint8_t *) memory_allocate(
+				                           sizeof( uint8_t ) * string_name_size );
+
+				if( name_string == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create name string.",
+					 function );
+
+					goto on_error;
+				}
+				name_string_size = string_name_size;
+			}
+			hash = libevtx_record_values_get_string_name_hash(
+			        NULL,
+			        0 );
+
+			if( string_name_size > 1 )
+			{
+				if( libevtx_record_values_get_utf8_string_name(
+				     record_values,
+				     io_handle,
+				     string_index,
+				     name_string,
+				     string_name_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve string: %d name.",
+					 function,
+					 string_index );
+
+					goto on_error;
+				}
+				hash = libevtx_record_values_get_string_name_hash(
+				        name_string,
+				        string_name_size - 1 );
+			}
+			record_values->string_name_hashes[ string_index ] = hash;
+
+			/* Strings with the same name keep the order of their string index
+			 * along the probe sequence, so that a lookup finds the first one
+			 */
+			slot_index = (int) ( hash & (uint32_t) ( table_size - 1 ) );
+
+			while( record_values->string_name_index_table[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( table_size - 1 );
+			}
+			record_values->string_name_index_table[ slot_index ] = string_index + 1;
 		}
 	}
-	if( libcdata_array_get_entry_by_index(
-	     record_values->strings_array,
-	     string_index,
-	     (intptr_t **) &string_xml_tag,
-	     error ) != 1 )
+	if( name_string != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d.",
-		 function,
-		 string_index );
+		memory_free(
+		 name_string );
+	}
+	record_values->string_name_index_built = 1;
 
-		return( -1 );
+	return( 1 );
+
+on_error:
+	if( name_string != NULL )
+	{
+		memory_free(
+		 name_string );
 	}
-	if( libfwevt_xml_tag_get_utf8_value(
-	     string_xml_tag,
-	     utf8_string,
-	     utf8_string_size,
-	     error ) != 1 )
+	/* The string name hashes allocated from an arena are released with the arena
+	 */
+	if( ( record_values->arena == NULL )
+	 && ( record_values->string_name_hashes != NULL ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value.",
-		 function,
-		 string_index );
-
-		return( -1 );
+		memory_free(
+		 record_values->string_name_hashes );
 	}
-	return( 1 );
+	record_values->string_name_hashes           = NULL;
+	record_values->string_name_index_table      = NULL;
+	record_values->string_name_index_table_size = 0;
+
+	return( -1 );
 }
 
-/* Retrieves the size of a specific UTF-16 encoded string
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the index of the first string with a specific UTF-8 encoded name
+ * The name is compared case sensitive
+ * Returns 1 if successful, 0 if no such string or -1 on error
  */
-int libevtx_record_values_get_utf16_string_size(
+int libevtx_record_values_get_string_index_by_utf8_name(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     int string_index,
-     size_t *utf16_string_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *string_xml_tag = NULL;
-	static char *function              = "libevtx_record_values_get_utf16_string_size";
+	uint8_t name_buffer[ 128 ];
+
+	uint8_t *name_string   = NULL;
+	static char *function  = "libevtx_record_values_get_string_index_by_utf8_name";
+	size_t name_size       = 0;
+	uint32_t hash          = 0;
+	int entry_string_index = 0;
+	int result             = 0;
+	int slot_index         = 0;
 
 	if( record_values == NULL )
 	{
@@ -4613,83 +8354,176 @@ int libevtx_record_values_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->data_parsed == 0 )
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
-		if( libevtx_record_values_parse_data(
-		     record_values,
-		     io_handle,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse data.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     record_values->strings_array,
-	     string_index,
-	     (intptr_t **) &string_xml_tag,
-	     error ) != 1 )
+	if( string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d.",
-		 function,
-		 string_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_utf16_value_size(
-	     string_xml_tag,
-	     utf16_string_size,
+	if( libevtx_record_values_build_string_name_index(
+	     record_values,
+	     io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value size.",
-		 function,
-		 string_index );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build string name index.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( record_values->string_name_index_table_size == 0 )
+	{
+		return( 0 );
+	}
+	hash = libevtx_record_values_get_string_name_hash(
+	        utf8_string,
+	        utf8_string_length );
+
+	slot_index = (int) ( hash & (uint32_t) ( record_values->string_name_index_table_size - 1 ) );
+
+	while( record_values->string_name_index_table[ slot_index ] != 0 )
+	{
+		entry_string_index = record_values->string_name_index_table[ slot_index ] - 1;
+
+		if( record_values->string_name_hashes[ entry_string_index ] == hash )
+		{
+			/* The name is compared to rule out a hash collision
+			 */
+			if( libevtx_record_values_get_utf8_string_name_size(
+			     record_values,
+			     io_handle,
+			     entry_string_index,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d name size.",
+				 function,
+				 entry_string_index );
+
+				goto on_error;
+			}
+			if( name_size == ( utf8_string_length + 1 ) )
+			{
+				if( name_size <= 128 )
+				{
+					name_string = name_buffer;
+				}
+				else
+				{
+					name_string = (uint8_t *) memory_allocate(
+					                           sizeof( uint8_t ) * name_size );
+
+					if( name_string == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to create name string.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( libevtx_record_values_get_utf8_string_name(
+				     record_values,
+				     io_handle,
+				     entry_string_index,
+				     name_string,
+				     name_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve string: %d name.",
+					 function,
+					 entry_string_index );
+
+					goto on_error;
+				}
+				result = memory_compare(
+				          name_string,
+				          utf8_string,
+				          utf8_string_length );
+
+				if( name_string != name_buffer )
+				{
+					memory_free(
+					 name_string );
+				}
+				name_string = NULL;
+
+				if( result == 0 )
+				{
+					*string_index = entry_string_index;
+
+					return( 1 );
+				}
+			}
+		}
+		slot_index = ( slot_index + 1 ) & ( record_values->string_name_index_table_size - 1 );
+	}
+	return( 0 );
+
+on_error:
+	if( ( name_string != NULL )
+	 && ( name_string != name_buffer ) )
+	{
+		memory_free(
+		 name_string );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific UTF-16 encoded string
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the size of the data
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_string(
+int libevtx_record_values_get_data_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     int string_index,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     size_t *data_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *string_xml_tag = NULL;
-	static char *function              = "libevtx_record_values_get_utf16_string";
+	libfwevt_xml_tag_t *binary_data_tag    = NULL;
+	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
+	static char *function                  = "libevtx_record_values_get_data_size";
+	int result                             = 0;
 
 	if( record_values == NULL )
 	{
@@ -4731,54 +8565,94 @@ int libevtx_record_values_get_utf16_string(
 			return( -1 );
 		}
 	}
-	if( libcdata_array_get_entry_by_index(
-	     record_values->strings_array,
-	     string_index,
-	     (intptr_t **) &string_xml_tag,
-	     error ) != 1 )
+	if( record_values->binary_data_value == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d.",
-		 function,
-		 string_index );
+		if( libevtx_record_values_resolve_root_xml_tags(
+		     record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resolve root XML sub elements.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		event_data_xml_tag = record_values->event_data_xml_tag;
+
+		if( event_data_xml_tag == NULL )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  event_data_xml_tag,
+			  (uint8_t *) "BinaryData",
+			  10,
+			  &binary_data_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     binary_data_tag,
+		     &( record_values->binary_data_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element value.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( libfwevt_xml_tag_get_utf16_value(
-	     string_xml_tag,
-	     utf16_string,
-	     utf16_string_size,
+	if( libfvalue_value_get_data_size(
+	     record_values->binary_data_value,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve size of binary data.",
+		 function );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of the data
+/* Retrieves the data
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_data_size(
+int libevtx_record_values_get_data(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     size_t *data_size,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *binary_data_tag    = NULL;
 	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag       = NULL;
-	static char *function                  = "libevtx_record_values_get_data_size";
+	static char *function                  = "libevtx_record_values_get_data";
 	int result                             = 0;
 
 	if( record_values == NULL )
@@ -4823,39 +8697,22 @@ int libevtx_record_values_get_data_size(
 	}
 	if( record_values->binary_data_value == NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
+		if( libevtx_record_values_resolve_root_xml_tags(
+		     record_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
+			 "%s: unable to resolve root XML sub elements.",
 			 function );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "EventData",
-			  9,
-			  &event_data_xml_tag,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventData XML element.",
-			 function );
+		event_data_xml_tag = record_values->event_data_xml_tag;
 
-			return( -1 );
-		}
-		else if( result == 0 )
+		if( event_data_xml_tag == NULL )
 		{
 			return( 0 );
 		}
@@ -4896,10 +8753,73 @@ int libevtx_record_values_get_data_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_data_size(
+	if( libfvalue_value_copy_data(
 	     record_values->binary_data_value,
+	     data,
 	     data_size,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy binary data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a reference to the data
+ * The data is not copied and remains owned by the record values,
+ * the reference is valid as long as the record values are
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_data_reference(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data   = NULL;
+	static char *function = "libevtx_record_values_get_data_reference";
+	size_t value_size     = 0;
+	int encoding          = 0;
+	int result            = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Retrieving the data size also looks up the binary data value
+	 */
+	result = libevtx_record_values_get_data_size(
+	          record_values,
+	          io_handle,
+	          &value_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -4910,24 +8830,178 @@ int libevtx_record_values_get_data_size(
 
 		return( -1 );
 	}
-	return( 1 );
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_data(
+	     record_values->binary_data_value,
+	     &value_data,
+	     &value_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve binary data.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = value_data;
+	*data_size = value_size;
+
+	return( 1 );
+}
+
+/* Transcodes the binary XML of the record values directly into the UTF-8 encoded XML string
+ * The XML string is retained until it is retrieved
+ * Returns 1 if successful, 0 if the binary XML is not supported by the transcoder or -1 on error
+ */
+int libevtx_record_values_transcode_utf8_xml_string(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error )
+{
+	libevtx_xml_transcoder_t *xml_transcoder = NULL;
+	static char *function                    = "libevtx_record_values_transcode_utf8_xml_string";
+	int result                               = 0;
+
+#if defined( LIBEVTX_PROBES_ENABLED )
+	uint64_t transcode_start_time            = 0;
+#endif
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->utf8_xml_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values - UTF-8 XML string already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_xml_transcoder_initialize(
+	     &xml_transcoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create XML transcoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( io_handle != NULL )
+	{
+		xml_transcoder->ascii_codepage_table = &( io_handle->ascii_codepage_table );
+	}
+#if defined( LIBEVTX_PROBES_ENABLED )
+	transcode_start_time = libevtx_statistics_get_time();
+#endif
+	LIBEVTX_PROBE_RECORD_TRANSCODE_START(
+	 record_values->identifier,
+	 record_values->chunk_data_offset );
+
+	result = libevtx_xml_transcoder_transcode_record(
+	          xml_transcoder,
+	          chunk_data,
+	          chunk_data_size,
+	          record_values->chunk_data_offset,
+	          (size_t) record_values->data_size,
+	          error );
+
+	LIBEVTX_PROBE_RECORD_TRANSCODE_DONE(
+	 record_values->identifier,
+	 libevtx_statistics_get_time() - transcode_start_time,
+	 result );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+		 "%s: unable to transcode record to UTF-8 XML string.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The record values take over the XML string of the transcoder
+		 */
+		record_values->utf8_xml_string      = xml_transcoder->string;
+		record_values->utf8_xml_string_size = xml_transcoder->string_size;
+
+		if( record_values->memory_usage != NULL )
+		{
+			record_values->accounted_xml_size += record_values->utf8_xml_string_size;
+
+			libevtx_memory_usage_add(
+			 record_values->memory_usage,
+			 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+			 record_values->utf8_xml_string_size );
+		}
+		xml_transcoder->string                = NULL;
+		xml_transcoder->string_size           = 0;
+		xml_transcoder->allocated_string_size = 0;
+	}
+	if( libevtx_xml_transcoder_free(
+	     &xml_transcoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free XML transcoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( xml_transcoder != NULL )
+	{
+		libevtx_xml_transcoder_free(
+		 &xml_transcoder,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the data
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the size of the UTF-8 encoded XML string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_data(
+int libevtx_record_values_get_utf8_xml_string_size(
      libevtx_record_values_t *record_values,
-     libevtx_io_handle_t *io_handle,
-     uint8_t *data,
-     size_t data_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *binary_data_tag    = NULL;
-	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag       = NULL;
-	static char *function                  = "libevtx_record_values_get_data";
-	int result                             = 0;
+	uint8_t *xml_string    = NULL;
+	static char *function  = "libevtx_record_values_get_utf8_xml_string_size";
+	size_t xml_string_size = 0;
 
 	if( record_values == NULL )
 	{
@@ -4940,165 +9014,101 @@ int libevtx_record_values_get_data(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->data_parsed == 0 )
-	{
-		if( libevtx_record_values_parse_data(
-		     record_values,
-		     io_handle,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse data.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( record_values->binary_data_value == NULL )
+	/* The XML string is rendered once and retained until it is retrieved
+	 * since determining its size requires the same effort as rendering it
+	 */
+	if( record_values->utf8_xml_string == NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
+		if( libfwevt_xml_document_get_utf8_xml_string_size(
 		     record_values->xml_document,
-		     &root_xml_tag,
+		     &xml_string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
+			 "%s: unable to retrieve UTF-8 string size of XML document.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "EventData",
-			  9,
-			  &event_data_xml_tag,
-			  error );
-
-		if( result == -1 )
+		if( ( xml_string_size == 0 )
+		 || ( xml_string_size > ( (size_t) SSIZE_MAX / sizeof( uint8_t ) ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventData XML element.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 XML string size value out of bounds.",
 			 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
+			goto on_error;
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  event_data_xml_tag,
-			  (uint8_t *) "BinaryData",
-			  10,
-			  &binary_data_tag,
-			  error );
+		xml_string = (uint8_t *) memory_allocate(
+		                        sizeof( uint8_t ) * xml_string_size );
 
-		if( result == -1 )
+		if( xml_string == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 XML string.",
 			 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
+			goto on_error;
 		}
-		if( libfwevt_xml_tag_get_value(
-		     binary_data_tag,
-		     &( record_values->binary_data_value ),
+		if( libfwevt_xml_document_get_utf8_xml_string(
+		     record_values->xml_document,
+		     xml_string,
+		     xml_string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element value.",
+			 "%s: unable to retrieve UTF-8 string of XML document.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-	}
-	if( libfvalue_value_copy_data(
-	     record_values->binary_data_value,
-	     data,
-	     data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy binary data.",
-		 function );
+		record_values->utf8_xml_string      = xml_string;
+		record_values->utf8_xml_string_size = xml_string_size;
 
-		return( -1 );
-	}
-	return( 1 );
-}
+		if( record_values->memory_usage != NULL )
+		{
+			record_values->accounted_xml_size += record_values->utf8_xml_string_size;
 
-/* Retrieves the size of the UTF-8 encoded XML string
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libevtx_record_values_get_utf8_xml_string_size(
-     libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libevtx_record_values_get_utf8_xml_string_size";
+			libevtx_memory_usage_add(
+			 record_values->memory_usage,
+			 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+			 record_values->utf8_xml_string_size );
+		}
+	}
+	*utf8_string_size = record_values->utf8_xml_string_size;
 
-	if( record_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
-		 function );
+	return( 1 );
 
-		return( -1 );
-	}
-	if( libfwevt_xml_document_get_utf8_xml_string_size(
-	     record_values->xml_document,
-	     utf8_string_size,
-	     error ) != 1 )
+on_error:
+	if( xml_string != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of XML document.",
-		 function );
-
-		return( -1 );
+		memory_free(
+		 xml_string );
 	}
-	return( 1 );
+	return( -1 );
 }
 
 /* Retrieves the UTF-8 encoded XML string
@@ -5124,6 +9134,61 @@ int libevtx_record_values_get_utf8_xml_string(
 
 		return( -1 );
 	}
+	if( record_values->utf8_xml_string != NULL )
+	{
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_size < record_values->utf8_xml_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     record_values->utf8_xml_string,
+		     sizeof( uint8_t ) * record_values->utf8_xml_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 XML string.",
+			 function );
+
+			return( -1 );
+		}
+		if( record_values->memory_usage != NULL )
+		{
+			record_values->accounted_xml_size -= record_values->utf8_xml_string_size;
+
+			libevtx_memory_usage_remove(
+			 record_values->memory_usage,
+			 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+			 record_values->utf8_xml_string_size );
+		}
+		memory_free(
+		 record_values->utf8_xml_string );
+
+		record_values->utf8_xml_string      = NULL;
+		record_values->utf8_xml_string_size = 0;
+
+		return( 1 );
+	}
 	if( libfwevt_xml_document_get_utf8_xml_string(
 	     record_values->xml_document,
 	     utf8_string,
@@ -5151,7 +9216,9 @@ int libevtx_record_values_get_utf16_xml_string_size(
      size_t *utf16_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_utf16_xml_string_size";
+	uint16_t *xml_string   = NULL;
+	static char *function  = "libevtx_record_values_get_utf16_xml_string_size";
+	size_t xml_string_size = 0;
 
 	if( record_values == NULL )
 	{
@@ -5164,21 +9231,101 @@ int libevtx_record_values_get_utf16_xml_string_size(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf16_xml_string_size(
-	     record_values->xml_document,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( utf16_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
 		 function );
 
 		return( -1 );
 	}
+	/* The XML string is rendered once and retained until it is retrieved
+	 * since determining its size requires the same effort as rendering it
+	 */
+	if( record_values->utf16_xml_string == NULL )
+	{
+		if( libfwevt_xml_document_get_utf16_xml_string_size(
+		     record_values->xml_document,
+		     &xml_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size of XML document.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( xml_string_size == 0 )
+		 || ( xml_string_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 XML string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		xml_string = (uint16_t *) memory_allocate(
+		                        sizeof( uint16_t ) * xml_string_size );
+
+		if( xml_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 XML string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_get_utf16_xml_string(
+		     record_values->xml_document,
+		     xml_string,
+		     xml_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string of XML document.",
+			 function );
+
+			goto on_error;
+		}
+		record_values->utf16_xml_string      = xml_string;
+		record_values->utf16_xml_string_size = xml_string_size;
+
+		if( record_values->memory_usage != NULL )
+		{
+			record_values->accounted_xml_size += record_values->utf16_xml_string_size;
+
+			libevtx_memory_usage_add(
+			 record_values->memory_usage,
+			 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+			 record_values->utf16_xml_string_size );
+		}
+	}
+	*utf16_string_size = record_values->utf16_xml_string_size;
+
 	return( 1 );
+
+on_error:
+	if( xml_string != NULL )
+	{
+		memory_free(
+		 xml_string );
+	}
+	return( -1 );
 }
 
 /* Retrieves the UTF-16 encoded XML string
@@ -5204,6 +9351,61 @@ int libevtx_record_values_get_utf16_xml_string(
 
 		return( -1 );
 	}
+	if( record_values->utf16_xml_string != NULL )
+	{
+		if( utf16_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf16_string_size < record_values->utf16_xml_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-16 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf16_string,
+		     record_values->utf16_xml_string,
+		     sizeof( uint16_t ) * record_values->utf16_xml_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 XML string.",
+			 function );
+
+			return( -1 );
+		}
+		if( record_values->memory_usage != NULL )
+		{
+			record_values->accounted_xml_size -= record_values->utf16_xml_string_size;
+
+			libevtx_memory_usage_remove(
+			 record_values->memory_usage,
+			 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+			 record_values->utf16_xml_string_size );
+		}
+		memory_free(
+		 record_values->utf16_xml_string );
+
+		record_values->utf16_xml_string      = NULL;
+		record_values->utf16_xml_string_size = 0;
+
+		return( 1 );
+	}
 	if( libfwevt_xml_document_get_utf16_xml_string(
 	     record_values->xml_document,
 	     utf16_string,
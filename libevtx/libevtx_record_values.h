@@ -25,11 +25,16 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_arena.h"
+#include "libevtx_decode_profile.h"
+#include "libevtx_event_data_values.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfvalue.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_memory_usage.h"
+#include "libevtx_system_values.h"
 #include "libevtx_template_definition.h"
 #include "libevtx_types.h"
 
@@ -39,6 +44,55 @@ extern "C" {
 
 extern const uint8_t evtx_event_record_signature[ 4 ];
 
+typedef struct libevtx_record_system_scalars libevtx_record_system_scalars_t;
+
+struct libevtx_record_system_scalars
+{
+	/* The keywords
+	 */
+	uint64_t keywords;
+
+	/* The event record identifier
+	 */
+	uint64_t event_record_identifier;
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The event identifier qualifiers
+	 */
+	uint32_t qualifiers;
+
+	/* The process identifier
+	 */
+	uint32_t process_identifier;
+
+	/* The thread identifier
+	 */
+	uint32_t thread_identifier;
+
+	/* The task
+	 */
+	uint16_t task;
+
+	/* The event level
+	 */
+	uint8_t event_level;
+
+	/* The opcode
+	 */
+	uint8_t opcode;
+
+	/* The event version
+	 */
+	uint8_t event_version;
+
+	/* Various flags
+	 */
+	uint16_t flags;
+};
+
 typedef struct libevtx_record_values libevtx_record_values_t;
 
 struct libevtx_record_values
@@ -67,6 +121,22 @@ struct libevtx_record_values
 	 */
 	libfwevt_xml_document_t *xml_document;
 
+	/* Reference to the System XML tag
+	 */
+	libfwevt_xml_tag_t *system_xml_tag;
+
+	/* Reference to the EventData XML tag
+	 */
+	libfwevt_xml_tag_t *event_data_xml_tag;
+
+	/* Reference to the ProcessingErrorData XML tag
+	 */
+	libfwevt_xml_tag_t *processing_error_data_xml_tag;
+
+	/* Reference to the UserData XML tag
+	 */
+	libfwevt_xml_tag_t *user_data_xml_tag;
+
 	/* Reference to the provider XML tag
 	 */
 	libfwevt_xml_tag_t *provider_xml_tag;
@@ -99,6 +169,14 @@ struct libevtx_record_values
 	 */
 	libfvalue_value_t *keywords_value;
 
+	/* Reference to the version value
+	 */
+	libfvalue_value_t *version_value;
+
+	/* Reference to the event record identifier value
+	 */
+	libfvalue_value_t *event_record_identifier_value;
+
 	/* Reference to the channel value
 	 */
 	libfvalue_value_t *channel_value;
@@ -111,6 +189,23 @@ struct libevtx_record_values
 	 */
 	libfvalue_value_t *user_security_identifier_value;
 
+	/* Reference to the process identifier (Execution ProcessID) value
+	 */
+	libfvalue_value_t *process_identifier_value;
+
+	/* Reference to the thread identifier (Execution ThreadID) value
+	 */
+	libfvalue_value_t *thread_identifier_value;
+
+	/* Reference to the activity identifier (Correlation ActivityID) value
+	 */
+	libfvalue_value_t *activity_identifier_value;
+
+	/* The System scalar values
+	 * Decoded once when the System XML elements are resolved
+	 */
+	libevtx_record_system_scalars_t system_scalars;
+
 	/* The string identifiers array
 	 */
 	libcdata_array_t *string_identifiers_array;
@@ -126,12 +221,150 @@ struct libevtx_record_values
 	/* Value to indicate the data was parsed
 	 */
 	uint8_t data_parsed;
+
+	/* The string name hashes
+	 * Contains the hash of the UTF-8 encoded name of every string, followed
+	 * by the string name index table
+	 */
+	uint32_t *string_name_hashes;
+
+	/* The string name index table
+	 * An open addressing hash table that contains the string index + 1
+	 * of a string name or 0 if the slot is unused
+	 */
+	int *string_name_index_table;
+
+	/* The number of entries in the string name index table
+	 */
+	int string_name_index_table_size;
+
+	/* Value to indicate the string name index was built
+	 */
+	uint8_t string_name_index_built;
+
+	/* The System values
+	 * Used instead of the XML document when the record is decoded up to the System element
+	 */
+	libevtx_system_values_t system_values;
+
+	/* The EventData values
+	 * Used instead of the XML document when a filter expression tests the EventData element
+	 * Only set while the filter expression is evaluated, since the values reference the chunk data
+	 */
+	libevtx_event_data_values_t *event_data_values;
+
+	/* The channel name data
+	 * Contains a copy of the UTF-16 little-endian channel name of the System values
+	 */
+	uint8_t *channel_name_data;
+
+	/* The computer name data
+	 * Contains a copy of the UTF-16 little-endian computer name of the System values
+	 */
+	uint8_t *computer_name_data;
+
+	/* Value to indicate the root XML sub elements were resolved
+	 */
+	uint8_t root_xml_tags_resolved;
+
+	/* Value to indicate the System XML elements were resolved
+	 */
+	uint8_t system_xml_tags_resolved;
+
+	/* The UTF-8 encoded XML string
+	 * Retained from retrieving the size until retrieving the string
+	 */
+	uint8_t *utf8_xml_string;
+
+	/* The UTF-8 encoded XML string size
+	 */
+	size_t utf8_xml_string_size;
+
+	/* The UTF-16 encoded XML string
+	 * Retained from retrieving the size until retrieving the string
+	 */
+	uint16_t *utf16_xml_string;
+
+	/* The UTF-16 encoded XML string size
+	 */
+	size_t utf16_xml_string_size;
+
+	/* Value to indicate the System values were read
+	 */
+	uint8_t system_values_read;
+
+	/* The UTF-8 encoded strings
+	 * Contains the strings, including their end of string character, stored consecutively
+	 */
+	uint8_t *utf8_strings;
+
+	/* The offsets of the UTF-8 encoded strings
+	 * The sizes of the strings are stored directly after the offsets
+	 */
+	size_t *utf8_string_offsets;
+
+	/* The number of UTF-8 encoded strings
+	 */
+	int number_of_utf8_strings;
+
+	/* Value to indicate the UTF-8 encoded strings were converted
+	 */
+	uint8_t utf8_strings_converted;
+
+	/* The arena the record values were allocated from
+	 * The channel name, computer name and UTF-8 strings data are allocated from the arena as well
+	 * Contains NULL if the record values were allocated individually
+	 */
+	libevtx_arena_t *arena;
+
+	/* The memory usage the record values are accounted to
+	 * Contains NULL if the record values are not accounted
+	 */
+	libevtx_memory_usage_t *memory_usage;
+
+	/* The size of the record values accounted to the memory usage
+	 */
+	size_t accounted_size;
+
+	/* The size of the XML document and XML strings accounted to the memory usage
+	 */
+	size_t accounted_xml_size;
+
+	/* The key the decode costs of the record values are attributed to
+	 * Only set when the decode costs are profiled
+	 */
+	libevtx_decode_profile_key_t decode_profile_key;
+
+	/* Value to indicate the decode profile key was set
+	 */
+	uint8_t has_decode_profile_key;
+
+	/* Value to indicate the record values were partially decoded
+	 * The XML document is not decoded when the record exceeds the decode budget
+	 */
+	uint8_t is_partially_decoded;
+
+	/* The document cache the record values are retained in when they are released by the records cache
+	 * Contains NULL if the record values are freed when they are released
+	 */
+	struct libevtx_document_cache *document_cache;
 };
 
 int libevtx_record_values_initialize(
      libevtx_record_values_t **record_values,
      libcerror_error_t **error );
 
+int libevtx_record_values_initialize_from_arena(
+     libevtx_record_values_t **record_values,
+     libevtx_arena_t *arena,
+     libcerror_error_t **error );
+
+int libevtx_record_values_allocate_data(
+     libevtx_record_values_t *record_values,
+     size_t data_size,
+     void **data,
+     libcerror_error_t **error );
+
 int libevtx_record_values_free(
      libevtx_record_values_t **record_values,
      libcerror_error_t **error );
@@ -141,6 +374,12 @@ int libevtx_record_values_clone(
      libevtx_record_values_t *source_record_values,
      libcerror_error_t **error );
 
+int libevtx_record_values_check_header(
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t chunk_data_offset,
+     libcerror_error_t **error );
+
 int libevtx_record_values_read_header(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -156,6 +395,70 @@ int libevtx_record_values_read_xml_document(
      size_t chunk_data_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_account_xml_document(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_record_values_count_xml_tags(
+     libfwevt_xml_tag_t *xml_tag,
+     int *number_of_xml_tags,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_number_of_xml_tags(
+     libevtx_record_values_t *record_values,
+     int *number_of_xml_tags,
+     libcerror_error_t **error );
+
+int libevtx_record_values_set_decode_profile_key(
+     libevtx_record_values_t *record_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_profile_decode_cost(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int value_index,
+     uint64_t decode_cost_time,
+     uint64_t number_of_bytes,
+     uint64_t number_of_allocations,
+     libcerror_error_t **error );
+
+int libevtx_record_values_set_partially_decoded(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_record_values_check_decode_budget(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     uint64_t decode_time,
+     libcerror_error_t **error );
+
+int libevtx_record_values_read_system_values(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libevtx_system_values_template_cache_t *template_cache,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_has_system_values(
+     libevtx_record_values_t *record_values,
+     uint8_t system_values_flags );
+
+int libevtx_record_values_resolve_root_xml_tags(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_record_values_resolve_system_xml_tags(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_record_values_decode_system_scalars(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_event_identifier(
      libevtx_record_values_t *record_values,
      uint32_t *event_identifier,
@@ -171,6 +474,32 @@ int libevtx_record_values_get_event_level(
      uint8_t *event_level,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_task(
+     libevtx_record_values_t *record_values,
+     uint16_t *task,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_opcode(
+     libevtx_record_values_t *record_values,
+     uint8_t *opcode,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_keywords(
+     libevtx_record_values_t *record_values,
+     uint64_t *keywords,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_event_version(
+     libevtx_record_values_t *record_values,
+     uint8_t *event_version,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_provider_identifier(
+     libevtx_record_values_t *record_values,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf8_provider_identifier_size(
      libevtx_record_values_t *record_values,
      size_t *utf8_string_size,
@@ -237,6 +566,28 @@ int libevtx_record_values_get_utf16_computer_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_channel_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_channel_name(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf16_channel_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf16_channel_name(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf8_user_security_identifier_size(
      libevtx_record_values_t *record_values,
      size_t *utf8_string_size,
@@ -259,6 +610,49 @@ int libevtx_record_values_get_utf16_user_security_identifier(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_process_identifier(
+     libevtx_record_values_t *record_values,
+     uint32_t *process_identifier,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_thread_identifier(
+     libevtx_record_values_t *record_values,
+     uint32_t *thread_identifier,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_activity_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_activity_identifier(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf16_activity_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf16_activity_identifier(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_resize_strings_arrays(
+     libevtx_record_values_t *record_values,
+     int number_of_strings,
+     libcerror_error_t **error );
+
+int libevtx_record_values_parse_data_xml_tag_by_template_definition(
+     libevtx_record_values_t *record_values,
+     libfwevt_xml_tag_t *data_xml_tag,
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error );
+
 int libevtx_record_values_parse_data(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -286,6 +680,15 @@ int libevtx_record_values_get_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_strings(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t **utf8_strings,
+     int *number_of_strings,
+     const size_t **utf8_string_offsets,
+     const size_t **utf8_string_sizes,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf16_string_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -301,6 +704,45 @@ int libevtx_record_values_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_string_name_xml_tag(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     libfwevt_xml_tag_t **name_xml_tag,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_string_name_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_string_name(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+uint32_t libevtx_record_values_get_string_name_hash(
+          const uint8_t *utf8_string,
+          size_t utf8_string_length );
+
+int libevtx_record_values_build_string_name_index(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_string_index_by_utf8_name(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_data_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -314,6 +756,20 @@ int libevtx_record_values_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_data_reference(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_transcode_utf8_xml_string(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf8_xml_string_size(
      libevtx_record_values_t *record_values,
      size_t *utf8_string_size,
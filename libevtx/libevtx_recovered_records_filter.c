@@ -0,0 +1,674 @@
+/*
+ * Recovered records filter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_checksum.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_recovered_records_filter.h"
+
+/* Creates a recovered records filter
+ * Make sure the value recovered_records_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_recovered_records_filter_initialize(
+     libevtx_recovered_records_filter_t **recovered_records_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_recovered_records_filter_initialize";
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovered_records_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid recovered records filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*recovered_records_filter = memory_allocate_structure(
+	                             libevtx_recovered_records_filter_t );
+
+	if( *recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create recovered records filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *recovered_records_filter,
+	     0,
+	     sizeof( libevtx_recovered_records_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear recovered records filter.",
+		 function );
+
+		memory_free(
+		 *recovered_records_filter );
+
+		*recovered_records_filter = NULL;
+
+		return( -1 );
+	}
+	if( libevtx_recovered_records_filter_resize_slots(
+	     *recovered_records_filter,
+	     LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_SLOTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize slots.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *recovered_records_filter != NULL )
+	{
+		memory_free(
+		 *recovered_records_filter );
+
+		*recovered_records_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a recovered records filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_recovered_records_filter_free(
+     libevtx_recovered_records_filter_t **recovered_records_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_recovered_records_filter_free";
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovered_records_filter != NULL )
+	{
+		if( ( *recovered_records_filter )->candidates != NULL )
+		{
+			memory_free(
+			 ( *recovered_records_filter )->candidates );
+		}
+		if( ( *recovered_records_filter )->slots != NULL )
+		{
+			memory_free(
+			 ( *recovered_records_filter )->slots );
+		}
+		memory_free(
+		 *recovered_records_filter );
+
+		*recovered_records_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a record from its identifier, written time and data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_recovered_records_filter_calculate_hash(
+     uint64_t *hash,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     uint64_t identifier,
+     uint64_t written_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_recovered_records_filter_calculate_hash";
+	uint64_t data_hash    = 0;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_offset > chunk_data_size )
+	 || ( record_data_size > ( chunk_data_size - record_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The identifier seeds the hash of the data and the written time is merged into it
+	 */
+	if( libevtx_checksum_calculate_xxhash64(
+	     &data_hash,
+	     &( chunk_data[ record_data_offset ] ),
+	     record_data_size,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hash of record data.",
+		 function );
+
+		return( -1 );
+	}
+	*hash = libevtx_checksum_xxhash64_merge_round(
+	         data_hash,
+	         written_time );
+
+	return( 1 );
+}
+
+/* Resizes the hash slots of a recovered records filter and reinserts the hashes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_recovered_records_filter_resize_slots(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     size_t number_of_slots,
+     libcerror_error_t **error )
+{
+	uint64_t *slots       = NULL;
+	static char *function = "libevtx_recovered_records_filter_resize_slots";
+	size_t slot_index     = 0;
+	size_t new_slot_index = 0;
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots == 0 )
+	 || ( number_of_slots > ( (size_t) SSIZE_MAX / sizeof( uint64_t ) ) )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( number_of_slots <= recovered_records_filter->number_of_hashes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (uint64_t *) memory_allocate(
+	                      sizeof( uint64_t ) * number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( uint64_t ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < recovered_records_filter->number_of_slots;
+	     slot_index++ )
+	{
+		if( recovered_records_filter->slots[ slot_index ] == 0 )
+		{
+			continue;
+		}
+		new_slot_index = (size_t) ( recovered_records_filter->slots[ slot_index ] & (uint64_t) ( number_of_slots - 1 ) );
+
+		while( slots[ new_slot_index ] != 0 )
+		{
+			new_slot_index = ( new_slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ new_slot_index ] = recovered_records_filter->slots[ slot_index ];
+	}
+	if( recovered_records_filter->slots != NULL )
+	{
+		memory_free(
+		 recovered_records_filter->slots );
+	}
+	recovered_records_filter->slots           = slots;
+	recovered_records_filter->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Inserts the hash of an allocated record
+ * Returns 1 if successful, 0 if the hash was already present or -1 on error
+ */
+int libevtx_recovered_records_filter_insert_allocated_record(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_recovered_records_filter_insert_allocated_record";
+	size_t slot_index     = 0;
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_filter->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid recovered records filter - missing slots.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value 0 marks an unused slot and is tracked separately
+	 */
+	if( hash == 0 )
+	{
+		if( recovered_records_filter->has_zero_hash != 0 )
+		{
+			return( 0 );
+		}
+		recovered_records_filter->has_zero_hash = 1;
+
+		return( 1 );
+	}
+	slot_index = (size_t) ( hash & (uint64_t) ( recovered_records_filter->number_of_slots - 1 ) );
+
+	while( recovered_records_filter->slots[ slot_index ] != 0 )
+	{
+		if( recovered_records_filter->slots[ slot_index ] == hash )
+		{
+			return( 0 );
+		}
+		slot_index = ( slot_index + 1 ) & ( recovered_records_filter->number_of_slots - 1 );
+	}
+	recovered_records_filter->slots[ slot_index ] = hash;
+
+	recovered_records_filter->number_of_hashes += 1;
+
+	/* Keep the load factor at or below 50%
+	 */
+	if( recovered_records_filter->number_of_hashes > ( recovered_records_filter->number_of_slots / 2 ) )
+	{
+		if( recovered_records_filter->number_of_slots > ( (size_t) SSIZE_MAX / ( 2 * sizeof( uint64_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid recovered records filter - number of slots value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_recovered_records_filter_resize_slots(
+		     recovered_records_filter,
+		     recovered_records_filter->number_of_slots * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if a recovered record duplicates an allocated record
+ * Returns 1 if the hash is that of an allocated record, 0 if not or -1 on error
+ */
+int libevtx_recovered_records_filter_is_duplicate(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_recovered_records_filter_is_duplicate";
+	size_t slot_index     = 0;
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_filter->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid recovered records filter - missing slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == 0 )
+	{
+		return( (int) recovered_records_filter->has_zero_hash );
+	}
+	slot_index = (size_t) ( hash & (uint64_t) ( recovered_records_filter->number_of_slots - 1 ) );
+
+	while( recovered_records_filter->slots[ slot_index ] != 0 )
+	{
+		if( recovered_records_filter->slots[ slot_index ] == hash )
+		{
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( recovered_records_filter->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Appends a recovered record that is filtered after all the allocated records were inserted
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_recovered_records_filter_append_candidate(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     off64_t file_offset,
+     size64_t element_data_size,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	libevtx_recovered_record_candidate_t *candidate    = NULL;
+	libevtx_recovered_record_candidate_t *reallocation = NULL;
+	static char *function                              = "libevtx_recovered_records_filter_append_candidate";
+	int number_of_allocated_candidates                 = 0;
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_filter->number_of_candidates >= recovered_records_filter->number_of_allocated_candidates )
+	{
+		if( recovered_records_filter->number_of_allocated_candidates == 0 )
+		{
+			number_of_allocated_candidates = LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES;
+		}
+		else if( recovered_records_filter->number_of_allocated_candidates > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated candidates value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_candidates = recovered_records_filter->number_of_allocated_candidates * 2;
+		}
+		reallocation = (libevtx_recovered_record_candidate_t *) memory_reallocate(
+		                                                         recovered_records_filter->candidates,
+		                                                         sizeof( libevtx_recovered_record_candidate_t ) * number_of_allocated_candidates );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize candidates.",
+			 function );
+
+			return( -1 );
+		}
+		recovered_records_filter->candidates                     = reallocation;
+		recovered_records_filter->number_of_allocated_candidates = number_of_allocated_candidates;
+	}
+	candidate = &( recovered_records_filter->candidates[ recovered_records_filter->number_of_candidates ] );
+
+	candidate->file_offset       = file_offset;
+	candidate->element_data_size = element_data_size;
+	candidate->hash              = hash;
+
+	recovered_records_filter->number_of_candidates += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific recovered record candidate
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_recovered_records_filter_get_candidate(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     int candidate_index,
+     off64_t *file_offset,
+     size64_t *element_data_size,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libevtx_recovered_record_candidate_t *candidate = NULL;
+	static char *function                           = "libevtx_recovered_records_filter_get_candidate";
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( candidate_index < 0 )
+	 || ( candidate_index >= recovered_records_filter->number_of_candidates ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid candidate index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	candidate = &( recovered_records_filter->candidates[ candidate_index ] );
+
+	*file_offset       = candidate->file_offset;
+	*element_data_size = candidate->element_data_size;
+	*hash              = candidate->hash;
+
+	return( 1 );
+}
+
+/* Clears the recovered record candidates
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_recovered_records_filter_clear_candidates(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_recovered_records_filter_clear_candidates";
+
+	if( recovered_records_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_filter->candidates != NULL )
+	{
+		memory_free(
+		 recovered_records_filter->candidates );
+
+		recovered_records_filter->candidates = NULL;
+	}
+	recovered_records_filter->number_of_candidates           = 0;
+	recovered_records_filter->number_of_allocated_candidates = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,152 @@
+/*
+ * Recovered records filter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBEVTX_RECOVERED_RECORDS_FILTER_H )
+#define _LIBEVTX_RECOVERED_RECORDS_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of hash slots, must be a power of 2
+ */
+#define LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_SLOTS	1024
+
+/* The initial number of allocated candidates
+ */
+#define LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES	64
+
+typedef struct libevtx_recovered_record_candidate libevtx_recovered_record_candidate_t;
+
+struct libevtx_recovered_record_candidate
+{
+	/* The file offset of the record
+	 */
+	off64_t file_offset;
+
+	/* The element data size of the record
+	 * Contains the chunk index, record index and element flags
+	 */
+	size64_t element_data_size;
+
+	/* The hash of the record
+	 */
+	uint64_t hash;
+};
+
+typedef struct libevtx_recovered_records_filter libevtx_recovered_records_filter_t;
+
+struct libevtx_recovered_records_filter
+{
+	/* The hash slots of the allocated records
+	 * A slot value of 0 marks an unused slot
+	 */
+	uint64_t *slots;
+
+	/* The number of hash slots
+	 */
+	size_t number_of_slots;
+
+	/* The number of hashes
+	 */
+	size_t number_of_hashes;
+
+	/* Value to indicate the hash 0 was inserted
+	 */
+	uint8_t has_zero_hash;
+
+	/* The recovered records that are filtered after all the allocated records were inserted
+	 */
+	libevtx_recovered_record_candidate_t *candidates;
+
+	/* The number of candidates
+	 */
+	int number_of_candidates;
+
+	/* The number of allocated candidates
+	 */
+	int number_of_allocated_candidates;
+};
+
+int libevtx_recovered_records_filter_initialize(
+     libevtx_recovered_records_filter_t **recovered_records_filter,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_free(
+     libevtx_recovered_records_filter_t **recovered_records_filter,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_calculate_hash(
+     uint64_t *hash,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     uint64_t identifier,
+     uint64_t written_time,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_resize_slots(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     size_t number_of_slots,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_insert_allocated_record(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_is_duplicate(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_append_candidate(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     off64_t file_offset,
+     size64_t element_data_size,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_get_candidate(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     int candidate_index,
+     off64_t *file_offset,
+     size64_t *element_data_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+int libevtx_recovered_records_filter_clear_candidates(
+     libevtx_recovered_records_filter_t *recovered_records_filter,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RECOVERED_RECORDS_FILTER_H ) */
+
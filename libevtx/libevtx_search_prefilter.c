@@ -0,0 +1,591 @@
+/*
+ * Search prefilter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+#include "libevtx_search_prefilter.h"
+
+/* Creates a search prefilter
+ * Make sure the value search_prefilter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_search_prefilter_initialize(
+     libevtx_search_prefilter_t **search_prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_search_prefilter_initialize";
+
+	if( search_prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *search_prefilter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid search prefilter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*search_prefilter = memory_allocate_structure(
+	                     libevtx_search_prefilter_t );
+
+	if( *search_prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create search prefilter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *search_prefilter,
+	     0,
+	     sizeof( libevtx_search_prefilter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear search prefilter.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *search_prefilter != NULL )
+	{
+		memory_free(
+		 *search_prefilter );
+
+		*search_prefilter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a search prefilter
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_search_prefilter_free(
+     libevtx_search_prefilter_t **search_prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_search_prefilter_free";
+	int pattern_index     = 0;
+
+	if( search_prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *search_prefilter != NULL )
+	{
+		if( ( *search_prefilter )->patterns != NULL )
+		{
+			for( pattern_index = 0;
+			     pattern_index < ( *search_prefilter )->number_of_patterns;
+			     pattern_index++ )
+			{
+				if( ( *search_prefilter )->patterns[ pattern_index ].data != NULL )
+				{
+					memory_free(
+					 ( *search_prefilter )->patterns[ pattern_index ].data );
+				}
+			}
+			memory_free(
+			 ( *search_prefilter )->patterns );
+		}
+		memory_free(
+		 *search_prefilter );
+
+		*search_prefilter = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a pattern
+ * The pattern must be at least 2 bytes in size, a pattern that was already appended is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_search_prefilter_append_pattern(
+     libevtx_search_prefilter_t *search_prefilter,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libevtx_search_pattern_t *patterns = NULL;
+	uint8_t *pattern_data              = NULL;
+	static char *function              = "libevtx_search_prefilter_append_pattern";
+	uint16_t prefix                    = 0;
+	int pattern_index                  = 0;
+
+	if( search_prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 2 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( search_prefilter->number_of_patterns >= ( INT_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid search prefilter - number of patterns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( pattern_index = 0;
+	     pattern_index < search_prefilter->number_of_patterns;
+	     pattern_index++ )
+	{
+		if( ( search_prefilter->patterns[ pattern_index ].data_size == data_size )
+		 && ( memory_compare(
+		       search_prefilter->patterns[ pattern_index ].data,
+		       data,
+		       data_size ) == 0 ) )
+		{
+			return( 1 );
+		}
+	}
+	pattern_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * data_size );
+
+	if( pattern_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pattern data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     pattern_data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy pattern data.",
+		 function );
+
+		goto on_error;
+	}
+	patterns = (libevtx_search_pattern_t *) memory_reallocate(
+	                                         search_prefilter->patterns,
+	                                         sizeof( libevtx_search_pattern_t ) * ( search_prefilter->number_of_patterns + 1 ) );
+
+	if( patterns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize patterns.",
+		 function );
+
+		goto on_error;
+	}
+	search_prefilter->patterns = patterns;
+
+	patterns[ search_prefilter->number_of_patterns ].data      = pattern_data;
+	patterns[ search_prefilter->number_of_patterns ].data_size = data_size;
+
+	search_prefilter->number_of_patterns += 1;
+
+	if( ( search_prefilter->minimum_pattern_size == 0 )
+	 || ( data_size < search_prefilter->minimum_pattern_size ) )
+	{
+		search_prefilter->minimum_pattern_size = data_size;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 data,
+	 prefix );
+
+	search_prefilter->prefix_bitmap[ prefix >> 3 ] |= (uint8_t) ( 1 << ( prefix & 0x07 ) );
+
+	return( 1 );
+
+on_error:
+	if( pattern_data != NULL )
+	{
+		memory_free(
+		 pattern_data );
+	}
+	return( -1 );
+}
+
+/* Appends the patterns of an UTF-8 string
+ * The string is searched for as UTF-16 little-endian, the encoding of strings in binary XML,
+ * and if the string only consists of ASCII characters and is at least 2 characters as ASCII
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_search_prefilter_append_utf8_string(
+     libevtx_search_prefilter_t *search_prefilter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint16_t *utf16_string   = NULL;
+	uint8_t *utf16_stream    = NULL;
+	static char *function    = "libevtx_search_prefilter_append_utf8_string";
+	size_t string_index      = 0;
+	size_t utf16_string_size = 0;
+	uint8_t is_ascii         = 1;
+
+	if( search_prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf16_string_size < 2 )
+	 || ( utf16_string_size > ( (size_t) SSIZE_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf16_string = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * utf16_string_size );
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     utf16_string,
+	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	/* The end of string character is not part of the pattern
+	 */
+	utf16_string_size -= 1;
+
+	utf16_stream = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * utf16_string_size * 2 );
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < utf16_string_size;
+	     string_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( utf16_stream[ string_index * 2 ] ),
+		 utf16_string[ string_index ] );
+	}
+	if( libevtx_search_prefilter_append_pattern(
+	     search_prefilter,
+	     utf16_stream,
+	     utf16_string_size * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append UTF-16 pattern.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_stream );
+
+	utf16_stream = NULL;
+
+	memory_free(
+	 utf16_string );
+
+	utf16_string = NULL;
+
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		if( utf8_string[ string_index ] >= 0x80 )
+		{
+			is_ascii = 0;
+
+			break;
+		}
+	}
+	if( ( is_ascii != 0 )
+	 && ( utf8_string_length >= 2 ) )
+	{
+		if( libevtx_search_prefilter_append_pattern(
+		     search_prefilter,
+		     utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append ASCII pattern.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( utf16_stream != NULL )
+	{
+		memory_free(
+		 utf16_stream );
+	}
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( -1 );
+}
+
+/* Scans data for the patterns
+ * The first 2 bytes at every offset are looked up in the prefix bitmap,
+ * so that only the offsets where a pattern can start are compared
+ * Returns 1 if the data contains one of the patterns, 0 if not or -1 on error
+ */
+int libevtx_search_prefilter_scan(
+     libevtx_search_prefilter_t *search_prefilter,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libevtx_search_pattern_t *pattern = NULL;
+	static char *function             = "libevtx_search_prefilter_scan";
+	size_t data_offset                = 0;
+	size_t last_data_offset           = 0;
+	uint16_t prefix                   = 0;
+	int pattern_index                 = 0;
+
+	if( search_prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( search_prefilter->number_of_patterns == 0 )
+	 || ( data_size < search_prefilter->minimum_pattern_size ) )
+	{
+		return( 0 );
+	}
+	last_data_offset = data_size - search_prefilter->minimum_pattern_size;
+
+	for( data_offset = 0;
+	     data_offset <= last_data_offset;
+	     data_offset++ )
+	{
+		prefix = (uint16_t) data[ data_offset ] | ( (uint16_t) data[ data_offset + 1 ] << 8 );
+
+		if( ( search_prefilter->prefix_bitmap[ prefix >> 3 ] & (uint8_t) ( 1 << ( prefix & 0x07 ) ) ) == 0 )
+		{
+			continue;
+		}
+		for( pattern_index = 0;
+		     pattern_index < search_prefilter->number_of_patterns;
+		     pattern_index++ )
+		{
+			pattern = &( search_prefilter->patterns[ pattern_index ] );
+
+			if( pattern->data_size > ( data_size - data_offset ) )
+			{
+				continue;
+			}
+			if( memory_compare(
+			     &( data[ data_offset ] ),
+			     pattern->data,
+			     pattern->data_size ) == 0 )
+			{
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
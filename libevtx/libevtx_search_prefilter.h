@@ -0,0 +1,100 @@
+/*
+ * Search prefilter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_SEARCH_PREFILTER_H )
+#define _LIBEVTX_SEARCH_PREFILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_search_pattern libevtx_search_pattern_t;
+
+struct libevtx_search_pattern
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libevtx_search_prefilter libevtx_search_prefilter_t;
+
+struct libevtx_search_prefilter
+{
+	/* The patterns
+	 */
+	libevtx_search_pattern_t *patterns;
+
+	/* The number of patterns
+	 */
+	int number_of_patterns;
+
+	/* The smallest pattern data size
+	 */
+	size_t minimum_pattern_size;
+
+	/* The prefix bitmap
+	 * Contains a bit for every combination of the first 2 bytes of the patterns
+	 */
+	uint8_t prefix_bitmap[ 8192 ];
+};
+
+int libevtx_search_prefilter_initialize(
+     libevtx_search_prefilter_t **search_prefilter,
+     libcerror_error_t **error );
+
+int libevtx_search_prefilter_free(
+     libevtx_search_prefilter_t **search_prefilter,
+     libcerror_error_t **error );
+
+int libevtx_search_prefilter_append_pattern(
+     libevtx_search_prefilter_t *search_prefilter,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_search_prefilter_append_utf8_string(
+     libevtx_search_prefilter_t *search_prefilter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libevtx_search_prefilter_scan(
+     libevtx_search_prefilter_t *search_prefilter,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_SEARCH_PREFILTER_H ) */
+
@@ -0,0 +1,169 @@
+/*
+ * Signature scanning functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_signature.h"
+
+#if defined( LIBEVTX_SIGNATURE_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( LIBEVTX_SIGNATURE_HAVE_SSE2 )
+#include <emmintrin.h>
+
+#elif defined( LIBEVTX_SIGNATURE_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* Searches for the event record signature: "**\0\0"
+ * The data is scanned in steps of 4 bytes starting at data_offset, the way the
+ * event records are aligned. Data that cannot contain the signature is skipped
+ * 32 (AVX2) or 16 (SSE2 or NEON) bytes at a time if available at compile time
+ * Returns 1 if the signature was found, 0 if not or -1 on error
+ */
+int libevtx_signature_find_event_record(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     size_t *signature_offset,
+     libcerror_error_t **error )
+{
+#if defined( LIBEVTX_SIGNATURE_HAVE_AVX2 )
+	__m256i data_vector_256bit      = _mm256_setzero_si256();
+	__m256i signature_vector_256bit = _mm256_set1_epi32( 0x00002a2a );
+#endif
+#if defined( LIBEVTX_SIGNATURE_HAVE_AVX2 ) || defined( LIBEVTX_SIGNATURE_HAVE_SSE2 )
+	__m128i data_vector             = _mm_setzero_si128();
+	__m128i signature_vector        = _mm_set1_epi32( 0x00002a2a );
+
+#elif defined( LIBEVTX_SIGNATURE_HAVE_NEON )
+	uint32x4_t data_vector          = vdupq_n_u32( 0 );
+	uint32x4_t signature_vector     = vdupq_n_u32( 0x00002a2aUL );
+#endif
+	static char *function           = "libevtx_signature_find_event_record";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset >= data_size )
+	{
+		return( 0 );
+	}
+	/* The vector loops only skip blocks without a signature, a block that
+	 * contains a signature is searched by the byte-wise loop
+	 */
+#if defined( LIBEVTX_SIGNATURE_HAVE_AVX2 )
+	while( ( data_size - data_offset ) >= 32 )
+	{
+		data_vector_256bit = _mm256_loadu_si256(
+		                      (const __m256i *) &( data[ data_offset ] ) );
+
+		if( _mm256_movemask_epi8(
+		     _mm256_cmpeq_epi32(
+		      data_vector_256bit,
+		      signature_vector_256bit ) ) != 0 )
+		{
+			break;
+		}
+		data_offset += 32;
+	}
+#endif
+#if defined( LIBEVTX_SIGNATURE_HAVE_AVX2 ) || defined( LIBEVTX_SIGNATURE_HAVE_SSE2 )
+	while( ( data_size - data_offset ) >= 16 )
+	{
+		data_vector = _mm_loadu_si128(
+		               (const __m128i *) &( data[ data_offset ] ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi32(
+		      data_vector,
+		      signature_vector ) ) != 0 )
+		{
+			break;
+		}
+		data_offset += 16;
+	}
+#elif defined( LIBEVTX_SIGNATURE_HAVE_NEON )
+	while( ( data_size - data_offset ) >= 16 )
+	{
+		data_vector = vreinterpretq_u32_u8(
+		               vld1q_u8(
+		                &( data[ data_offset ] ) ) );
+
+		if( vmaxvq_u32(
+		     vceqq_u32(
+		      data_vector,
+		      signature_vector ) ) != 0 )
+		{
+			break;
+		}
+		data_offset += 16;
+	}
+#endif
+	while( ( data_size - data_offset ) >= 4 )
+	{
+		if( ( data[ data_offset ] == 0x2a )
+		 && ( data[ data_offset + 1 ] == 0x2a )
+		 && ( data[ data_offset + 2 ] == 0x00 )
+		 && ( data[ data_offset + 3 ] == 0x00 ) )
+		{
+			*signature_offset = data_offset;
+
+			return( 1 );
+		}
+		data_offset += 4;
+	}
+	return( 0 );
+}
+
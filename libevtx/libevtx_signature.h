@@ -0,0 +1,60 @@
+/*
+ * Signature scanning functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_SIGNATURE_H )
+#define _LIBEVTX_SIGNATURE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The vector instructions used to scan for signatures, determined at compile time
+ */
+#if defined( __AVX2__ )
+#define LIBEVTX_SIGNATURE_HAVE_AVX2
+#endif
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEVTX_SIGNATURE_HAVE_SSE2
+#endif
+
+#if defined( __ARM_NEON ) && defined( __aarch64__ ) && !defined( __ARM_BIG_ENDIAN )
+#define LIBEVTX_SIGNATURE_HAVE_NEON
+#endif
+
+int libevtx_signature_find_event_record(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     size_t *signature_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_SIGNATURE_H ) */
+
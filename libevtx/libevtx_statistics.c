@@ -0,0 +1,266 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_statistics.h"
+
+/* Clears the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_statistics_clear(
+     libevtx_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_statistics_clear";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* The counters are cleared one by one since they can be updated
+	 * by other threads while the statistics are cleared
+	 */
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_chunks_read,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_bytes_read,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->checksum_time,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_chunk_look_ups,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_chunk_cache_misses,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_record_look_ups,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_record_cache_misses,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_record_headers_read,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_xml_documents_read,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_template_expansions,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_allocations,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_chunk_rereads,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_background_decoded_records,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_document_cache_hits,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->lock_wait_time,
+	 0 );
+
+	LIBEVTX_COUNTER_SET(
+	 statistics->number_of_over_budget_records,
+	 0 );
+
+	return( 1 );
+}
+
+/* Retrieves the statistics values
+ * The values are stored in the order of the LIBEVTX_STATISTICS definitions
+ * If the number of values is smaller than LIBEVTX_NUMBER_OF_STATISTICS
+ * only the first number of values are stored
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_statistics_get_values(
+     libevtx_statistics_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint64_t safe_values[ LIBEVTX_NUMBER_OF_STATISTICS ];
+
+	static char *function       = "libevtx_statistics_get_values";
+	uint64_t number_of_look_ups = 0;
+	int value_index             = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNKS_READ ]         = LIBEVTX_COUNTER_GET( statistics->number_of_chunks_read );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_BYTES_READ ]          = LIBEVTX_COUNTER_GET( statistics->number_of_bytes_read );
+	safe_values[ LIBEVTX_STATISTIC_CHECKSUM_TIME ]                 = LIBEVTX_COUNTER_GET( statistics->checksum_time );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_HITS ]    = 0;
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_MISSES ]  = LIBEVTX_COUNTER_GET( statistics->number_of_chunk_cache_misses );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_HITS ]   = 0;
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_MISSES ] = LIBEVTX_COUNTER_GET( statistics->number_of_record_cache_misses );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_HEADERS_READ ] = LIBEVTX_COUNTER_GET( statistics->number_of_record_headers_read );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_XML_DOCUMENTS_READ ]  = LIBEVTX_COUNTER_GET( statistics->number_of_xml_documents_read );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_TEMPLATE_EXPANSIONS ] = LIBEVTX_COUNTER_GET( statistics->number_of_template_expansions );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_ALLOCATIONS ]         = LIBEVTX_COUNTER_GET( statistics->number_of_allocations );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_REREADS ]       = LIBEVTX_COUNTER_GET( statistics->number_of_chunk_rereads );
+
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_BACKGROUND_DECODED_RECORDS ] = LIBEVTX_COUNTER_GET( statistics->number_of_background_decoded_records );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_DOCUMENT_CACHE_HITS ]        = LIBEVTX_COUNTER_GET( statistics->number_of_document_cache_hits );
+	safe_values[ LIBEVTX_STATISTIC_LOCK_WAIT_TIME ]                       = LIBEVTX_COUNTER_GET( statistics->lock_wait_time );
+	safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_OVER_BUDGET_RECORDS ]        = LIBEVTX_COUNTER_GET( statistics->number_of_over_budget_records );
+
+	/* The cache is only read from on a look up that is not a miss
+	 */
+	number_of_look_ups = LIBEVTX_COUNTER_GET(
+	                      statistics->number_of_chunk_look_ups );
+
+	if( number_of_look_ups > safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_MISSES ] )
+	{
+		safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_HITS ] = number_of_look_ups
+		                                                            - safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_CACHE_MISSES ];
+	}
+	number_of_look_ups = LIBEVTX_COUNTER_GET(
+	                      statistics->number_of_record_look_ups );
+
+	if( number_of_look_ups > safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_MISSES ] )
+	{
+		safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_HITS ] = number_of_look_ups
+		                                                             - safe_values[ LIBEVTX_STATISTIC_NUMBER_OF_RECORD_CACHE_MISSES ];
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( value_index >= LIBEVTX_NUMBER_OF_STATISTICS )
+		{
+			break;
+		}
+		values[ value_index ] = safe_values[ value_index ];
+	}
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * Returns the clock value or 0 if not available
+ */
+uint64_t libevtx_statistics_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	      + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+#endif
+}
+
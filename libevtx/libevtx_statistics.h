@@ -0,0 +1,175 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_STATISTICS_H )
+#define _LIBEVTX_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( WINAPI ) && !defined( __GNUC__ )
+#include <windows.h>
+#endif
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The counter macros, where the counter is an uint64_t value
+ * Chunks and records are read by multiple threads in multi-threaded builds,
+ * hence the counters are then accessed atomically
+ * LIBEVTX_COUNTER_ADD evaluates to the value of the counter after the addition
+ * LIBEVTX_COUNTER_COMPARE_AND_SWAP evaluates to non-zero if the counter was swapped
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+#define LIBEVTX_COUNTER_ADD( counter, value ) \
+	__atomic_add_fetch( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define LIBEVTX_COUNTER_GET( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#define LIBEVTX_COUNTER_SET( counter, value ) \
+	__atomic_store_n( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define LIBEVTX_COUNTER_COMPARE_AND_SWAP( counter, expected_value, value ) \
+	__sync_bool_compare_and_swap( &( counter ), (uint64_t) ( expected_value ), (uint64_t) ( value ) )
+
+#elif defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+#define LIBEVTX_COUNTER_ADD( counter, value ) \
+	(uint64_t) InterlockedAdd64( (LONG64 volatile *) &( counter ), (LONG64) ( value ) )
+
+#define LIBEVTX_COUNTER_GET( counter ) \
+	(uint64_t) InterlockedCompareExchange64( (LONG64 volatile *) &( counter ), 0, 0 )
+
+#define LIBEVTX_COUNTER_SET( counter, value ) \
+	InterlockedExchange64( (LONG64 volatile *) &( counter ), (LONG64) ( value ) )
+
+#define LIBEVTX_COUNTER_COMPARE_AND_SWAP( counter, expected_value, value ) \
+	( InterlockedCompareExchange64( (LONG64 volatile *) &( counter ), (LONG64) ( value ), (LONG64) ( expected_value ) ) == (LONG64) ( expected_value ) )
+
+#else
+#define LIBEVTX_COUNTER_ADD( counter, value ) \
+	( ( counter ) += (uint64_t) ( value ) )
+
+#define LIBEVTX_COUNTER_GET( counter ) \
+	( counter )
+
+#define LIBEVTX_COUNTER_SET( counter, value ) \
+	( counter ) = (uint64_t) ( value )
+
+#define LIBEVTX_COUNTER_COMPARE_AND_SWAP( counter, expected_value, value ) \
+	( ( ( counter ) == (uint64_t) ( expected_value ) ) ? ( ( counter ) = (uint64_t) ( value ), 1 ) : 0 )
+
+#endif
+
+typedef struct libevtx_statistics libevtx_statistics_t;
+
+/* The statistics are updated with the counter macros
+ */
+struct libevtx_statistics
+{
+	/* The number of chunks read
+	 */
+	uint64_t number_of_chunks_read;
+
+	/* The number of bytes read from the file IO handle
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The time spent calculating checksums in nanoseconds
+	 */
+	uint64_t checksum_time;
+
+	/* The number of chunk look ups
+	 */
+	uint64_t number_of_chunk_look_ups;
+
+	/* The number of chunk look ups that were not in the cache
+	 */
+	uint64_t number_of_chunk_cache_misses;
+
+	/* The number of record look ups
+	 */
+	uint64_t number_of_record_look_ups;
+
+	/* The number of record look ups that were not in the cache
+	 */
+	uint64_t number_of_record_cache_misses;
+
+	/* The number of record headers read
+	 */
+	uint64_t number_of_record_headers_read;
+
+	/* The number of XML documents read
+	 */
+	uint64_t number_of_xml_documents_read;
+
+	/* The number of template instances expanded
+	 */
+	uint64_t number_of_template_expansions;
+
+	/* The number of chunk data, record values and XML document allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The number of chunks that were re-read because they were inconsistent
+	 * Only chunks of files opened in live mode are re-read
+	 */
+	uint64_t number_of_chunk_rereads;
+
+	/* The number of records of which the XML document was decoded in the background
+	 */
+	uint64_t number_of_background_decoded_records;
+
+	/* The number of records of which the record values were retrieved from the document cache
+	 */
+	uint64_t number_of_document_cache_hits;
+
+	/* The time spent waiting to grab the read/write lock of the file in nanoseconds
+	 */
+	uint64_t lock_wait_time;
+
+	/* The number of records that were partially decoded since they exceeded the decode budget
+	 */
+	uint64_t number_of_over_budget_records;
+};
+
+int libevtx_statistics_clear(
+     libevtx_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libevtx_statistics_get_values(
+     libevtx_statistics_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+uint64_t libevtx_statistics_get_time(
+          void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_STATISTICS_H ) */
+
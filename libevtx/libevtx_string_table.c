@@ -0,0 +1,1164 @@
+/*
+ * String table functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_libuna.h"
+#include "libevtx_string_table.h"
+
+/* The 32-bit FNV-1a hash parameters
+ */
+#define LIBEVTX_STRING_TABLE_FNV1A_OFFSET_BASIS	0x811c9dc5UL
+#define LIBEVTX_STRING_TABLE_FNV1A_PRIME	0x01000193UL
+
+/* The initial number of slots, entries and strings data size
+ */
+#define LIBEVTX_STRING_TABLE_INITIAL_NUMBER_OF_SLOTS	64
+#define LIBEVTX_STRING_TABLE_INITIAL_NUMBER_OF_ENTRIES	16
+#define LIBEVTX_STRING_TABLE_INITIAL_STRINGS_DATA_SIZE	4096
+
+/* Creates a string table
+ * Make sure the value string_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_initialize(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_string_table_initialize";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_table = memory_allocate_structure(
+	                 libevtx_string_table_t );
+
+	if( *string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_table,
+	     0,
+	     sizeof( libevtx_string_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string table.",
+		 function );
+
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *string_table )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *string_table != NULL )
+	{
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string table
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_free(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_string_table_free";
+	int result            = 1;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *string_table )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *string_table )->slots != NULL )
+		{
+			memory_free(
+			 ( *string_table )->slots );
+		}
+		if( ( *string_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *string_table )->entries );
+		}
+		if( ( *string_table )->strings_data != NULL )
+		{
+			memory_free(
+			 ( *string_table )->strings_data );
+		}
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( result );
+}
+
+/* Empties a string table
+ * The allocated memory is retained for reuse, previously returned string identifiers become invalid
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_empty(
+     libevtx_string_table_t *string_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_string_table_empty";
+	int result            = 1;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( string_table->slots != NULL )
+	{
+		if( memory_set(
+		     string_table->slots,
+		     0,
+		     sizeof( int ) * string_table->number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slots.",
+			 function );
+
+			result = -1;
+		}
+	}
+	string_table->number_of_entries = 0;
+	string_table->strings_data_size = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Resizes the slots of a string table and reinserts the entries
+ * The caller is responsible for holding the mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_resize_slots(
+     libevtx_string_table_t *string_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	int *slots            = NULL;
+	static char *function = "libevtx_string_table_resize_slots";
+	int entry_index       = 0;
+	int slot_index        = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of slots must be a power of 2
+	 */
+	if( ( number_of_slots <= 0 )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( (size_t) number_of_slots > ( (size_t) SSIZE_MAX / sizeof( int ) ) )
+	 || ( number_of_slots < string_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (int *) memory_allocate(
+	                 sizeof( int ) * number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( int ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < string_table->number_of_entries;
+	     entry_index++ )
+	{
+		slot_index = (int) ( string_table->entries[ entry_index ].hash & (uint32_t) ( number_of_slots - 1 ) );
+
+		while( slots[ slot_index ] != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ slot_index ] = entry_index + 1;
+	}
+	if( string_table->slots != NULL )
+	{
+		memory_free(
+		 string_table->slots );
+	}
+	string_table->slots           = slots;
+	string_table->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Interns an UTF-8 encoded string
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_intern_utf8_string(
+     libevtx_string_table_t *string_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	libevtx_string_table_entry_t *entry = NULL;
+	void *reallocation                  = NULL;
+	static char *function               = "libevtx_string_table_intern_utf8_string";
+	size_t allocated_size               = 0;
+	size_t string_offset                = 0;
+	uint32_t hash                       = LIBEVTX_STRING_TABLE_FNV1A_OFFSET_BASIS;
+	int entry_index                     = 0;
+	int number_of_entries               = 0;
+	int slot_index                      = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) ( SSIZE_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string[ utf8_string_size - 1 ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UTF-8 string - missing end of string character.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string identifier.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_offset = 0;
+	     string_offset < utf8_string_size;
+	     string_offset++ )
+	{
+		hash ^= (uint32_t) utf8_string[ string_offset ];
+		hash *= LIBEVTX_STRING_TABLE_FNV1A_PRIME;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( string_table->number_of_slots > 0 )
+	{
+		slot_index = (int) ( hash & (uint32_t) ( string_table->number_of_slots - 1 ) );
+
+		while( string_table->slots[ slot_index ] != 0 )
+		{
+			entry_index = string_table->slots[ slot_index ] - 1;
+			entry       = &( string_table->entries[ entry_index ] );
+
+			if( ( entry->hash == hash )
+			 && ( entry->string_size == utf8_string_size )
+			 && ( memory_compare(
+			       &( string_table->strings_data[ entry->string_offset ] ),
+			       utf8_string,
+			       utf8_string_size ) == 0 ) )
+			{
+				*string_identifier = (uint32_t) entry_index;
+
+				goto on_found;
+			}
+			slot_index = ( slot_index + 1 ) & ( string_table->number_of_slots - 1 );
+		}
+	}
+	/* Keep the load factor of the slots below 50%
+	 */
+	if( ( string_table->number_of_entries + 1 ) > ( string_table->number_of_slots / 2 ) )
+	{
+		if( string_table->number_of_slots > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of slots value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_string_table_resize_slots(
+		     string_table,
+		     ( string_table->number_of_slots == 0 ) ? LIBEVTX_STRING_TABLE_INITIAL_NUMBER_OF_SLOTS : string_table->number_of_slots * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( string_table->number_of_entries >= string_table->number_of_allocated_entries )
+	{
+		if( string_table->number_of_allocated_entries == 0 )
+		{
+			number_of_entries = LIBEVTX_STRING_TABLE_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else
+		{
+			number_of_entries = string_table->number_of_allocated_entries * 2;
+		}
+		if( (size_t) number_of_entries > ( (size_t) SSIZE_MAX / sizeof( libevtx_string_table_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = memory_reallocate(
+		                string_table->entries,
+		                sizeof( libevtx_string_table_entry_t ) * number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			goto on_error;
+		}
+		string_table->entries                     = (libevtx_string_table_entry_t *) reallocation;
+		string_table->number_of_allocated_entries = number_of_entries;
+	}
+	if( utf8_string_size > ( string_table->strings_data_allocated_size - string_table->strings_data_size ) )
+	{
+		allocated_size = string_table->strings_data_allocated_size;
+
+		if( allocated_size == 0 )
+		{
+			allocated_size = LIBEVTX_STRING_TABLE_INITIAL_STRINGS_DATA_SIZE;
+		}
+		while( utf8_string_size > ( allocated_size - string_table->strings_data_size ) )
+		{
+			if( allocated_size > (size_t) ( SSIZE_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid strings data size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			allocated_size *= 2;
+		}
+		reallocation = memory_reallocate(
+		                string_table->strings_data,
+		                sizeof( uint8_t ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize strings data.",
+			 function );
+
+			goto on_error;
+		}
+		string_table->strings_data                = (uint8_t *) reallocation;
+		string_table->strings_data_allocated_size = allocated_size;
+	}
+	if( memory_copy(
+	     &( string_table->strings_data[ string_table->strings_data_size ] ),
+	     utf8_string,
+	     utf8_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		goto on_error;
+	}
+	entry_index = string_table->number_of_entries;
+	entry       = &( string_table->entries[ entry_index ] );
+
+	entry->string_offset = string_table->strings_data_size;
+	entry->string_size   = utf8_string_size;
+	entry->hash          = hash;
+
+	slot_index = (int) ( hash & (uint32_t) ( string_table->number_of_slots - 1 ) );
+
+	while( string_table->slots[ slot_index ] != 0 )
+	{
+		slot_index = ( slot_index + 1 ) & ( string_table->number_of_slots - 1 );
+	}
+	string_table->slots[ slot_index ] = entry_index + 1;
+
+	string_table->strings_data_size += utf8_string_size;
+	string_table->number_of_entries += 1;
+
+	*string_identifier = (uint32_t) entry_index;
+
+on_found:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 string_table->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_get_number_of_strings(
+     libevtx_string_table_t *string_table,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_string_table_get_number_of_strings";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_strings = string_table->number_of_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_get_utf8_string_size(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_string_table_entry_t *entry = NULL;
+	static char *function               = "libevtx_string_table_get_utf8_string_size";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( string_identifier >= (uint32_t) string_table->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string identifier value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entry = &( string_table->entries[ string_identifier ] );
+
+	*utf8_string_size = entry->string_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 string_table->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_get_utf8_string(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_string_table_entry_t *entry = NULL;
+	static char *function               = "libevtx_string_table_get_utf8_string";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( string_identifier >= (uint32_t) string_table->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string identifier value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entry = &( string_table->entries[ string_identifier ] );
+
+	if( utf8_string_size < entry->string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     utf8_string,
+	     &( string_table->strings_data[ entry->string_offset ] ),
+	     entry->string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 string_table->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_get_utf16_string_size(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_string_table_entry_t *entry = NULL;
+	static char *function               = "libevtx_string_table_get_utf16_string_size";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( string_identifier >= (uint32_t) string_table->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string identifier value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entry = &( string_table->entries[ string_identifier ] );
+
+	if( libuna_utf16_string_size_from_utf8(
+	     &( string_table->strings_data[ entry->string_offset ] ),
+	     entry->string_size,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 string_table->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific UTF-16 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_get_utf16_string(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_string_table_entry_t *entry = NULL;
+	static char *function               = "libevtx_string_table_get_utf16_string";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( string_identifier >= (uint32_t) string_table->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string identifier value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entry = &( string_table->entries[ string_identifier ] );
+
+	if( libuna_utf16_string_copy_from_utf8(
+	     utf16_string,
+	     utf16_string_size,
+	     &( string_table->strings_data[ entry->string_offset ] ),
+	     entry->string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     string_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 string_table->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
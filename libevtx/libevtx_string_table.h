@@ -0,0 +1,162 @@
+/*
+ * String table functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBEVTX_STRING_TABLE_H )
+#define _LIBEVTX_STRING_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_string_table_entry libevtx_string_table_entry_t;
+
+struct libevtx_string_table_entry
+{
+	/* The offset of the string in the strings data
+	 */
+	size_t string_offset;
+
+	/* The string size
+	 * The size includes the end of string character
+	 */
+	size_t string_size;
+
+	/* The hash of the string
+	 */
+	uint32_t hash;
+};
+
+typedef struct libevtx_string_table libevtx_string_table_t;
+
+struct libevtx_string_table
+{
+	/* The strings data
+	 * Contains the UTF-8 encoded strings including their end of string character
+	 */
+	uint8_t *strings_data;
+
+	/* The strings data size
+	 */
+	size_t strings_data_size;
+
+	/* The allocated strings data size
+	 */
+	size_t strings_data_allocated_size;
+
+	/* The entries
+	 * The index of an entry is the identifier of the string
+	 */
+	libevtx_string_table_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The slots
+	 * An open addressing hash table that contains the entry index + 1
+	 * of a string or 0 if the slot is unused
+	 */
+	int *slots;
+
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * Records of the same file can intern strings from different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevtx_string_table_initialize(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error );
+
+int libevtx_string_table_free(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error );
+
+int libevtx_string_table_empty(
+     libevtx_string_table_t *string_table,
+     libcerror_error_t **error );
+
+int libevtx_string_table_resize_slots(
+     libevtx_string_table_t *string_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libevtx_string_table_intern_utf8_string(
+     libevtx_string_table_t *string_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_number_of_strings(
+     libevtx_string_table_t *string_table,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf8_string_size(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf8_string(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf16_string_size(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf16_string(
+     libevtx_string_table_t *string_table,
+     uint32_t string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_STRING_TABLE_H ) */
+
@@ -0,0 +1,941 @@
+/*
+ * System fields functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_string_table.h"
+#include "libevtx_system_fields.h"
+#include "libevtx_system_values.h"
+#include "libevtx_utf16_stream.h"
+
+/* Creates system fields
+ * Make sure the value system_fields is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_system_fields_initialize(
+     libevtx_system_fields_t **system_fields,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_initialize";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( *system_fields != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid system fields value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = memory_allocate_structure(
+	                          libevtx_internal_system_fields_t );
+
+	if( internal_system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create system fields.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_system_fields,
+	     0,
+	     sizeof( libevtx_internal_system_fields_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear system fields.",
+		 function );
+
+		goto on_error;
+	}
+	*system_fields = (libevtx_system_fields_t *) internal_system_fields;
+
+	return( 1 );
+
+on_error:
+	if( internal_system_fields != NULL )
+	{
+		memory_free(
+		 internal_system_fields );
+	}
+	return( -1 );
+}
+
+/* Frees system fields
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_system_fields_free(
+     libevtx_system_fields_t **system_fields,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_free";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( *system_fields != NULL )
+	{
+		internal_system_fields = (libevtx_internal_system_fields_t *) *system_fields;
+		*system_fields         = NULL;
+
+		if( internal_system_fields->record_flags != NULL )
+		{
+			memory_free(
+			 internal_system_fields->record_flags );
+		}
+		if( internal_system_fields->event_identifiers != NULL )
+		{
+			memory_free(
+			 internal_system_fields->event_identifiers );
+		}
+		if( internal_system_fields->event_levels != NULL )
+		{
+			memory_free(
+			 internal_system_fields->event_levels );
+		}
+		if( internal_system_fields->keywords != NULL )
+		{
+			memory_free(
+			 internal_system_fields->keywords );
+		}
+		if( internal_system_fields->written_times != NULL )
+		{
+			memory_free(
+			 internal_system_fields->written_times );
+		}
+		if( internal_system_fields->provider_identifiers != NULL )
+		{
+			memory_free(
+			 internal_system_fields->provider_identifiers );
+		}
+		if( internal_system_fields->computer_name_identifiers != NULL )
+		{
+			memory_free(
+			 internal_system_fields->computer_name_identifiers );
+		}
+		memory_free(
+		 internal_system_fields );
+	}
+	return( 1 );
+}
+
+/* Resizes the system fields to the number of records of a chunk
+ * The arrays are only reallocated if the number of records exceeds the number of allocated entries,
+ * hence the same system fields can be reused for every chunk of a file
+ * The record flags are cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_system_fields_resize(
+     libevtx_internal_system_fields_t *internal_system_fields,
+     int number_of_records,
+     uint32_t fields_mask,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libevtx_system_fields_resize";
+
+	if( internal_system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_records > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records > internal_system_fields->number_of_allocated_entries )
+	{
+		reallocation = memory_reallocate(
+		                internal_system_fields->record_flags,
+		                sizeof( uint8_t ) * number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record flags.",
+			 function );
+
+			return( -1 );
+		}
+		internal_system_fields->record_flags = (uint8_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_system_fields->event_identifiers,
+		                sizeof( uint32_t ) * number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize event identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		internal_system_fields->event_identifiers = (uint32_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_system_fields->event_levels,
+		                sizeof( uint8_t ) * number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize event levels.",
+			 function );
+
+			return( -1 );
+		}
+		internal_system_fields->event_levels = (uint8_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_system_fields->keywords,
+		                sizeof( uint64_t ) * number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize keywords.",
+			 function );
+
+			return( -1 );
+		}
+		internal_system_fields->keywords = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_system_fields->written_times,
+		                sizeof( uint64_t ) * number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize written times.",
+			 function );
+
+			return( -1 );
+		}
+		internal_system_fields->written_times = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_system_fields->provider_identifiers,
+		                sizeof( uint8_t ) * 16 * number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize provider identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		internal_system_fields->provider_identifiers = (uint8_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_system_fields->computer_name_identifiers,
+		                sizeof( uint32_t ) * number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize computer name identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		internal_system_fields->computer_name_identifiers = (uint32_t *) reallocation;
+
+		/* The number of allocated entries is only updated once all the arrays were resized
+		 */
+		internal_system_fields->number_of_allocated_entries = number_of_records;
+	}
+	if( number_of_records > 0 )
+	{
+		if( memory_set(
+		     internal_system_fields->record_flags,
+		     0,
+		     sizeof( uint8_t ) * number_of_records ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear record flags.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_system_fields->fields_mask                   = fields_mask;
+	internal_system_fields->number_of_records             = number_of_records;
+	internal_system_fields->last_computer_name            = NULL;
+	internal_system_fields->last_computer_name_size       = 0;
+	internal_system_fields->last_computer_name_identifier = 0;
+
+	return( 1 );
+}
+
+/* Sets the values of a specific record
+ * Only the fields of the fields mask are set. The System values are optional
+ * and should be NULL if the record data is not supported by the System values,
+ * in which case only the written time can be set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_system_fields_set_record_values(
+     libevtx_internal_system_fields_t *internal_system_fields,
+     int record_index,
+     libevtx_system_values_t *system_values,
+     uint64_t written_time,
+     libevtx_string_table_t *string_table,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string_buffer[ 256 ];
+
+	uint8_t *utf8_string       = NULL;
+	static char *function      = "libevtx_system_fields_set_record_values";
+	size_t utf8_string_size    = 0;
+	uint32_t fields_mask       = 0;
+	uint32_t string_identifier = 0;
+	uint8_t record_flags       = 0;
+
+	if( internal_system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= internal_system_fields->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	fields_mask = internal_system_fields->fields_mask;
+
+	if( ( fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_WRITTEN_TIME ) != 0 )
+	{
+		internal_system_fields->written_times[ record_index ] = written_time;
+
+		record_flags |= LIBEVTX_SYSTEM_FIELD_FLAG_WRITTEN_TIME;
+	}
+	if( system_values != NULL )
+	{
+		if( ( ( fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_EVENT_IDENTIFIER ) != 0 )
+		 && ( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER ) != 0 ) )
+		{
+			internal_system_fields->event_identifiers[ record_index ] = system_values->event_identifier;
+
+			record_flags |= LIBEVTX_SYSTEM_FIELD_FLAG_EVENT_IDENTIFIER;
+		}
+		if( ( ( fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_EVENT_LEVEL ) != 0 )
+		 && ( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL ) != 0 ) )
+		{
+			internal_system_fields->event_levels[ record_index ] = system_values->event_level;
+
+			record_flags |= LIBEVTX_SYSTEM_FIELD_FLAG_EVENT_LEVEL;
+		}
+		if( ( ( fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_KEYWORDS ) != 0 )
+		 && ( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_KEYWORDS ) != 0 ) )
+		{
+			internal_system_fields->keywords[ record_index ] = system_values->keywords;
+
+			record_flags |= LIBEVTX_SYSTEM_FIELD_FLAG_KEYWORDS;
+		}
+		if( ( ( fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_PROVIDER_IDENTIFIER ) != 0 )
+		 && ( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) != 0 ) )
+		{
+			if( memory_copy(
+			     &( internal_system_fields->provider_identifiers[ (size_t) record_index * 16 ] ),
+			     system_values->provider_identifier,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+			record_flags |= LIBEVTX_SYSTEM_FIELD_FLAG_PROVIDER_IDENTIFIER;
+		}
+		if( ( ( fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_COMPUTER_NAME_IDENTIFIER ) != 0 )
+		 && ( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME ) != 0 )
+		 && ( string_table != NULL ) )
+		{
+			/* The records of a chunk mostly originate from the same computer
+			 * hence the last computer name is compared before it is interned
+			 */
+			if( ( internal_system_fields->last_computer_name != NULL )
+			 && ( internal_system_fields->last_computer_name_size == system_values->computer_name_size )
+			 && ( memory_compare(
+			       internal_system_fields->last_computer_name,
+			       system_values->computer_name,
+			       system_values->computer_name_size ) == 0 ) )
+			{
+				string_identifier = internal_system_fields->last_computer_name_identifier;
+			}
+			else
+			{
+				if( libevtx_utf16_stream_get_utf8_string_size(
+				     system_values->computer_name,
+				     system_values->computer_name_size,
+				     &utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UTF-8 computer name size.",
+					 function );
+
+					goto on_error;
+				}
+				if( utf8_string_size <= 256 )
+				{
+					utf8_string = utf8_string_buffer;
+				}
+				else
+				{
+					if( utf8_string_size > (size_t) SSIZE_MAX )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid UTF-8 computer name size value exceeds maximum.",
+						 function );
+
+						goto on_error;
+					}
+					utf8_string = (uint8_t *) memory_allocate(
+					                           sizeof( uint8_t ) * utf8_string_size );
+
+					if( utf8_string == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to create UTF-8 computer name.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( libevtx_utf16_stream_copy_to_utf8_string(
+				     system_values->computer_name,
+				     system_values->computer_name_size,
+				     utf8_string,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-8 computer name.",
+					 function );
+
+					goto on_error;
+				}
+				if( libevtx_string_table_intern_utf8_string(
+				     string_table,
+				     utf8_string,
+				     utf8_string_size,
+				     &string_identifier,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to intern UTF-8 computer name.",
+					 function );
+
+					goto on_error;
+				}
+				if( utf8_string != utf8_string_buffer )
+				{
+					memory_free(
+					 utf8_string );
+				}
+				utf8_string = NULL;
+
+				internal_system_fields->last_computer_name            = system_values->computer_name;
+				internal_system_fields->last_computer_name_size       = system_values->computer_name_size;
+				internal_system_fields->last_computer_name_identifier = string_identifier;
+			}
+			internal_system_fields->computer_name_identifiers[ record_index ] = string_identifier;
+
+			record_flags |= LIBEVTX_SYSTEM_FIELD_FLAG_COMPUTER_NAME_IDENTIFIER;
+		}
+	}
+	internal_system_fields->record_flags[ record_index ] = record_flags;
+
+	return( 1 );
+
+on_error:
+	if( ( utf8_string != NULL )
+	 && ( utf8_string != utf8_string_buffer ) )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_system_fields_get_number_of_records(
+     libevtx_system_fields_t *system_fields,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_number_of_records";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_system_fields->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the flags of the fields that were decoded per record
+ * The flags contain LIBEVTX_SYSTEM_FIELD_FLAG values, the value of a field of a record
+ * is only set if the corresponding flag of the record is set
+ * The array contains an entry per record and references the system fields
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_system_fields_get_record_flags(
+     libevtx_system_fields_t *system_fields,
+     const uint8_t **record_flags,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_record_flags";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( record_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record flags.",
+		 function );
+
+		return( -1 );
+	}
+	*record_flags = internal_system_fields->record_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the event identifiers
+ * The array contains an entry per record and references the system fields
+ * Returns 1 if successful, 0 if the field was not decoded or -1 on error
+ */
+int libevtx_system_fields_get_event_identifiers(
+     libevtx_system_fields_t *system_fields,
+     const uint32_t **event_identifiers,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_event_identifiers";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( event_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_system_fields->fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_EVENT_IDENTIFIER ) == 0 )
+	{
+		return( 0 );
+	}
+	*event_identifiers = internal_system_fields->event_identifiers;
+
+	return( 1 );
+}
+
+/* Retrieves the event levels
+ * The array contains an entry per record and references the system fields
+ * Returns 1 if successful, 0 if the field was not decoded or -1 on error
+ */
+int libevtx_system_fields_get_event_levels(
+     libevtx_system_fields_t *system_fields,
+     const uint8_t **event_levels,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_event_levels";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( event_levels == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event levels.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_system_fields->fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_EVENT_LEVEL ) == 0 )
+	{
+		return( 0 );
+	}
+	*event_levels = internal_system_fields->event_levels;
+
+	return( 1 );
+}
+
+/* Retrieves the keywords
+ * The array contains an entry per record and references the system fields
+ * Returns 1 if successful, 0 if the field was not decoded or -1 on error
+ */
+int libevtx_system_fields_get_keywords(
+     libevtx_system_fields_t *system_fields,
+     const uint64_t **keywords,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_keywords";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( keywords == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keywords.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_system_fields->fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_KEYWORDS ) == 0 )
+	{
+		return( 0 );
+	}
+	*keywords = internal_system_fields->keywords;
+
+	return( 1 );
+}
+
+/* Retrieves the written times
+ * The written times are stored as FILETIME values
+ * The array contains an entry per record and references the system fields
+ * Returns 1 if successful, 0 if the field was not decoded or -1 on error
+ */
+int libevtx_system_fields_get_written_times(
+     libevtx_system_fields_t *system_fields,
+     const uint64_t **written_times,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_written_times";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( written_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid written times.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_system_fields->fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_WRITTEN_TIME ) == 0 )
+	{
+		return( 0 );
+	}
+	*written_times = internal_system_fields->written_times;
+
+	return( 1 );
+}
+
+/* Retrieves the provider identifiers
+ * The provider identifiers are stored as a little-endian GUID of 16 bytes per record
+ * The array contains an entry per record and references the system fields
+ * Returns 1 if successful, 0 if the field was not decoded or -1 on error
+ */
+int libevtx_system_fields_get_provider_identifiers(
+     libevtx_system_fields_t *system_fields,
+     const uint8_t **provider_identifiers,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_provider_identifiers";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( provider_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_system_fields->fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_PROVIDER_IDENTIFIER ) == 0 )
+	{
+		return( 0 );
+	}
+	*provider_identifiers = internal_system_fields->provider_identifiers;
+
+	return( 1 );
+}
+
+/* Retrieves the string identifiers of the computer names
+ * The identifiers refer to interned strings of the file, refer to libevtx_file_get_utf8_interned_string
+ * The array contains an entry per record and references the system fields
+ * Returns 1 if successful, 0 if the field was not decoded or -1 on error
+ */
+int libevtx_system_fields_get_computer_name_identifiers(
+     libevtx_system_fields_t *system_fields,
+     const uint32_t **computer_name_identifiers,
+     libcerror_error_t **error )
+{
+	libevtx_internal_system_fields_t *internal_system_fields = NULL;
+	static char *function                                    = "libevtx_system_fields_get_computer_name_identifiers";
+
+	if( system_fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system fields.",
+		 function );
+
+		return( -1 );
+	}
+	internal_system_fields = (libevtx_internal_system_fields_t *) system_fields;
+
+	if( computer_name_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid computer name identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_system_fields->fields_mask & LIBEVTX_SYSTEM_FIELD_FLAG_COMPUTER_NAME_IDENTIFIER ) == 0 )
+	{
+		return( 0 );
+	}
+	*computer_name_identifiers = internal_system_fields->computer_name_identifiers;
+
+	return( 1 );
+}
+
@@ -0,0 +1,175 @@
+/*
+ * System fields functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_SYSTEM_FIELDS_H )
+#define _LIBEVTX_INTERNAL_SYSTEM_FIELDS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_extern.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_string_table.h"
+#include "libevtx_system_values.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_internal_system_fields libevtx_internal_system_fields_t;
+
+struct libevtx_internal_system_fields
+{
+	/* The fields mask of the fields that were decoded
+	 */
+	uint32_t fields_mask;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of allocated entries of the arrays
+	 */
+	int number_of_allocated_entries;
+
+	/* The flags of the fields that were decoded per record
+	 */
+	uint8_t *record_flags;
+
+	/* The event identifiers
+	 */
+	uint32_t *event_identifiers;
+
+	/* The event levels
+	 */
+	uint8_t *event_levels;
+
+	/* The keywords
+	 */
+	uint64_t *keywords;
+
+	/* The written times
+	 * Contains FILETIME values
+	 */
+	uint64_t *written_times;
+
+	/* The provider identifiers
+	 * Contains a little-endian GUID of 16 bytes per record
+	 */
+	uint8_t *provider_identifiers;
+
+	/* The string identifiers of the computer names
+	 */
+	uint32_t *computer_name_identifiers;
+
+	/* The last computer name that was interned
+	 * References the chunk data and is reset for every chunk
+	 */
+	const uint8_t *last_computer_name;
+
+	/* The last computer name size
+	 */
+	size_t last_computer_name_size;
+
+	/* The string identifier of the last computer name
+	 */
+	uint32_t last_computer_name_identifier;
+};
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_initialize(
+     libevtx_system_fields_t **system_fields,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_free(
+     libevtx_system_fields_t **system_fields,
+     libcerror_error_t **error );
+
+int libevtx_system_fields_resize(
+     libevtx_internal_system_fields_t *internal_system_fields,
+     int number_of_records,
+     uint32_t fields_mask,
+     libcerror_error_t **error );
+
+int libevtx_system_fields_set_record_values(
+     libevtx_internal_system_fields_t *internal_system_fields,
+     int record_index,
+     libevtx_system_values_t *system_values,
+     uint64_t written_time,
+     libevtx_string_table_t *string_table,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_number_of_records(
+     libevtx_system_fields_t *system_fields,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_record_flags(
+     libevtx_system_fields_t *system_fields,
+     const uint8_t **record_flags,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_event_identifiers(
+     libevtx_system_fields_t *system_fields,
+     const uint32_t **event_identifiers,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_event_levels(
+     libevtx_system_fields_t *system_fields,
+     const uint8_t **event_levels,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_keywords(
+     libevtx_system_fields_t *system_fields,
+     const uint64_t **keywords,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_written_times(
+     libevtx_system_fields_t *system_fields,
+     const uint64_t **written_times,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_provider_identifiers(
+     libevtx_system_fields_t *system_fields,
+     const uint8_t **provider_identifiers,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_system_fields_get_computer_name_identifiers(
+     libevtx_system_fields_t *system_fields,
+     const uint32_t **computer_name_identifiers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_SYSTEM_FIELDS_H ) */
+
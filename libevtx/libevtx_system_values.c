@@ -0,0 +1,1687 @@
+/*
+ * System values functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_checksum.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_system_values.h"
+#include "libevtx_template_cache.h"
+#include "libevtx_value_formatter.h"
+
+#include "evtx_event_record.h"
+
+/* Reads the System element values of a record without creating an XML document
+ * Only the template of the record is walked to determine which substitution
+ * values represent the event identifier, level, provider identifier, channel, computer and keywords
+ * The template cache is optional and retains the walked templates of the chunk,
+ * so that records that share a template only read their substitution values
+ * The shared template cache is optional and retains the walked templates across chunks
+ * Returns 1 if successful, 0 if the record data is not supported or -1 on error
+ */
+int libevtx_system_values_read_data(
+     libevtx_system_values_t *system_values,
+     libevtx_system_values_template_cache_t *template_cache,
+     libevtx_template_cache_t *shared_template_cache,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	libevtx_system_values_template_value_t template_values[ LIBEVTX_NUMBER_OF_SYSTEM_VALUES ];
+
+	libevtx_system_values_template_t *cached_template            = NULL;
+	libevtx_system_values_template_value_t *record_template_values = NULL;
+	static char *function                                        = "libevtx_system_values_read_data";
+	size_t chunk_data_offset                                     = 0;
+	size_t end_of_data_offset                                    = 0;
+	size_t template_definition_size                              = 0;
+	uint32_t template_definition_offset                          = 0;
+	int cache_index                                              = 0;
+	int result                                                   = 0;
+	int value_index                                              = 0;
+
+	if( system_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_offset >= chunk_data_size )
+	 || ( record_data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
+	 || ( record_data_size > ( chunk_data_size - record_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     system_values,
+	     0,
+	     sizeof( libevtx_system_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear system values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < LIBEVTX_NUMBER_OF_SYSTEM_VALUES;
+	     value_index++ )
+	{
+		template_values[ value_index ].substitution_index = -1;
+		template_values[ value_index ].string_data        = NULL;
+		template_values[ value_index ].string_data_size   = 0;
+	}
+	chunk_data_offset  = record_data_offset + sizeof( evtx_event_record_header_t );
+	end_of_data_offset = record_data_offset + record_data_size - 4;
+
+	/* The event record data consists of a fragment header followed by a template instance
+	 */
+	if( ( end_of_data_offset - chunk_data_offset ) < 14 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data[ chunk_data_offset ] != LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER )
+	 || ( chunk_data[ chunk_data_offset + 4 ] != LIBEVTX_BINARY_XML_TOKEN_TEMPLATE_INSTANCE ) )
+	{
+		return( 0 );
+	}
+	chunk_data_offset += 4;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ chunk_data_offset + 6 ] ),
+	 template_definition_offset );
+
+	chunk_data_offset += 10;
+
+	if( ( template_cache != NULL )
+	 && ( template_definition_offset != 0 ) )
+	{
+		/* Event records and therefore template definitions are 8-byte aligned
+		 */
+		cache_index     = (int) ( ( template_definition_offset >> 3 ) % LIBEVTX_SYSTEM_VALUES_NUMBER_OF_CACHED_TEMPLATES );
+		cached_template = &( template_cache->templates[ cache_index ] );
+	}
+	if( ( cached_template != NULL )
+	 && ( cached_template->template_definition_offset == template_definition_offset ) )
+	{
+		if( cached_template->is_supported == 0 )
+		{
+			return( 0 );
+		}
+		record_template_values   = cached_template->template_values;
+		template_definition_size = cached_template->template_definition_size;
+	}
+	else
+	{
+		result = libevtx_system_values_read_shared_template_definition(
+		          template_values,
+		          shared_template_cache,
+		          chunk_data,
+		          chunk_data_size,
+		          (size_t) template_definition_offset,
+		          &template_definition_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read template definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( cached_template != NULL )
+		{
+			if( memory_copy(
+			     cached_template->template_values,
+			     template_values,
+			     sizeof( libevtx_system_values_template_value_t ) * LIBEVTX_NUMBER_OF_SYSTEM_VALUES ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy template values.",
+				 function );
+
+				cached_template->template_definition_offset = 0;
+
+				return( -1 );
+			}
+			cached_template->template_definition_offset = template_definition_offset;
+			cached_template->template_definition_size   = template_definition_size;
+			cached_template->is_supported               = (uint8_t) result;
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+		record_template_values = template_values;
+	}
+	/* The template definition is stored in the record data the first time it is used in the chunk
+	 */
+	if( (size_t) template_definition_offset == chunk_data_offset )
+	{
+		chunk_data_offset += template_definition_size;
+	}
+	result = libevtx_system_values_read_substitution_values(
+	          system_values,
+	          record_template_values,
+	          chunk_data,
+	          chunk_data_size,
+	          chunk_data_offset,
+	          end_of_data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read substitution values.",
+		 function );
+	}
+	return( result );
+}
+
+/* Reads a template definition and determines where the System element values are stored
+ * Returns 1 if successful, 0 if the template definition is not supported or -1 on error
+ */
+int libevtx_system_values_read_template_definition(
+     libevtx_system_values_template_value_t *template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t template_definition_offset,
+     size_t *template_definition_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libevtx_system_values_read_template_definition";
+	size_t chunk_data_offset    = 0;
+	size_t end_of_data_offset   = 0;
+	uint32_t template_data_size = 0;
+	int result                  = 0;
+
+	if( template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template definition header consists of the next template definition offset,
+	 * the template identifier and the template data size
+	 */
+	if( ( template_definition_offset >= chunk_data_size )
+	 || ( ( chunk_data_size - template_definition_offset ) < 24 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ template_definition_offset + 20 ] ),
+	 template_data_size );
+
+	chunk_data_offset = template_definition_offset + 24;
+
+	if( (size_t) template_data_size > ( chunk_data_size - chunk_data_offset ) )
+	{
+		return( 0 );
+	}
+	end_of_data_offset = chunk_data_offset + template_data_size;
+
+	if( ( ( end_of_data_offset - chunk_data_offset ) < 4 )
+	 || ( chunk_data[ chunk_data_offset ] != LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER ) )
+	{
+		return( 0 );
+	}
+	chunk_data_offset += 4;
+
+	result = libevtx_system_values_read_element(
+	          template_values,
+	          chunk_data,
+	          chunk_data_size,
+	          &chunk_data_offset,
+	          end_of_data_offset,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root element.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition_size = 24 + (size_t) template_data_size;
+
+	return( result );
+}
+
+/* Reads a template definition using a shared template cache
+ * Every chunk stores its own copy of the template definitions its records use,
+ * a template with the same identifier, data size and data hash is only walked once
+ * The shared template cache is optional
+ * Returns 1 if successful, 0 if the template definition is not supported or -1 on error
+ */
+int libevtx_system_values_read_shared_template_definition(
+     libevtx_system_values_template_value_t *template_values,
+     libevtx_template_cache_t *shared_template_cache,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t template_definition_offset,
+     size_t *template_definition_size,
+     libcerror_error_t **error )
+{
+	libevtx_template_cache_value_t cached_values[ LIBEVTX_NUMBER_OF_SYSTEM_VALUES ];
+
+	static char *function       = "libevtx_system_values_read_shared_template_definition";
+	uint64_t template_data_hash = 0;
+	uint32_t template_data_size = 0;
+	uint8_t is_supported        = 0;
+	int result                  = 0;
+	int value_index             = 0;
+
+	if( template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Template definitions of which the data does not fit in the chunk are not cached
+	 */
+	if( ( shared_template_cache == NULL )
+	 || ( template_definition_offset >= chunk_data_size )
+	 || ( ( chunk_data_size - template_definition_offset ) < 24 ) )
+	{
+		return( libevtx_system_values_read_template_definition(
+		         template_values,
+		         chunk_data,
+		         chunk_data_size,
+		         template_definition_offset,
+		         template_definition_size,
+		         error ) );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ template_definition_offset + 20 ] ),
+	 template_data_size );
+
+	if( (size_t) template_data_size > ( chunk_data_size - template_definition_offset - 24 ) )
+	{
+		return( libevtx_system_values_read_template_definition(
+		         template_values,
+		         chunk_data,
+		         chunk_data_size,
+		         template_definition_offset,
+		         template_definition_size,
+		         error ) );
+	}
+	if( libevtx_checksum_calculate_xxhash64(
+	     &template_data_hash,
+	     &( chunk_data[ template_definition_offset + 24 ] ),
+	     (size_t) template_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate template data hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template identifier is stored after the next template definition offset
+	 */
+	result = libevtx_template_cache_get_values(
+	          shared_template_cache,
+	          &( chunk_data[ template_definition_offset + 4 ] ),
+	          template_data_size,
+	          template_data_hash,
+	          cached_values,
+	          LIBEVTX_NUMBER_OF_SYSTEM_VALUES,
+	          &is_supported,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached template.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The string data of the cached values is relative to the template definition,
+		 * which has the same data in every chunk
+		 */
+		for( value_index = 0;
+		     value_index < LIBEVTX_NUMBER_OF_SYSTEM_VALUES;
+		     value_index++ )
+		{
+			template_values[ value_index ].substitution_index = cached_values[ value_index ].substitution_index;
+			template_values[ value_index ].string_data_size   = cached_values[ value_index ].string_data_size;
+
+			if( cached_values[ value_index ].string_data_size == 0 )
+			{
+				template_values[ value_index ].string_data = NULL;
+			}
+			else
+			{
+				template_values[ value_index ].string_data = &( chunk_data[ template_definition_offset + cached_values[ value_index ].string_data_offset ] );
+			}
+		}
+		*template_definition_size = 24 + (size_t) template_data_size;
+
+		return( (int) is_supported );
+	}
+	result = libevtx_system_values_read_template_definition(
+	          template_values,
+	          chunk_data,
+	          chunk_data_size,
+	          template_definition_offset,
+	          template_definition_size,
+	          error );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < LIBEVTX_NUMBER_OF_SYSTEM_VALUES;
+	     value_index++ )
+	{
+		cached_values[ value_index ].substitution_index = template_values[ value_index ].substitution_index;
+		cached_values[ value_index ].string_data_offset = 0;
+		cached_values[ value_index ].string_data_size   = 0;
+
+		if( ( template_values[ value_index ].string_data != NULL )
+		 && ( template_values[ value_index ].string_data_size != 0 ) )
+		{
+			/* String data outside the template definition cannot be reused in another chunk
+			 */
+			if( ( template_values[ value_index ].string_data < &( chunk_data[ template_definition_offset + 24 ] ) )
+			 || ( template_values[ value_index ].string_data_size > (size_t) ( &( chunk_data[ template_definition_offset + 24 + template_data_size ] ) - template_values[ value_index ].string_data ) ) )
+			{
+				return( result );
+			}
+			cached_values[ value_index ].string_data_offset = (size_t) ( template_values[ value_index ].string_data - &( chunk_data[ template_definition_offset ] ) );
+			cached_values[ value_index ].string_data_size   = template_values[ value_index ].string_data_size;
+		}
+	}
+	if( libevtx_template_cache_set_values(
+	     shared_template_cache,
+	     &( chunk_data[ template_definition_offset + 4 ] ),
+	     template_data_size,
+	     template_data_hash,
+	     cached_values,
+	     LIBEVTX_NUMBER_OF_SYSTEM_VALUES,
+	     (uint8_t) result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cached template.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads an element of a template definition
+ * Elements that cannot contain a System element value are skipped using their data size
+ * Returns 1 if successful, 0 if the element is not supported or -1 on error
+ */
+int libevtx_system_values_read_element(
+     libevtx_system_values_template_value_t *template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error )
+{
+	libevtx_system_values_template_value_t *template_value = NULL;
+	const uint8_t *name_data                               = NULL;
+	static char *function                                  = "libevtx_system_values_read_element";
+	size_t attributes_end_offset                           = 0;
+	size_t element_end_offset                              = 0;
+	size_t name_data_size                                  = 0;
+	size_t name_offset                                     = 0;
+	size_t safe_chunk_data_offset                          = 0;
+	uint32_t attributes_data_size                          = 0;
+	uint32_t element_data_size                             = 0;
+	uint32_t element_name_offset                           = 0;
+	uint8_t element_token                                  = 0;
+	uint8_t token                                          = 0;
+	int is_provider_element                                = 0;
+	int result                                             = 0;
+	int value_index                                        = -1;
+
+	if( template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	/* The open start element tag consists of the token, dependency identifier,
+	 * element data size and element name offset
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 11 ) )
+	{
+		return( 0 );
+	}
+	element_token = chunk_data[ safe_chunk_data_offset ];
+
+	if( ( element_token & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA ) ) != LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 3 ] ),
+	 element_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 7 ] ),
+	 element_name_offset );
+
+	if( (size_t) element_data_size > ( end_of_data_offset - ( safe_chunk_data_offset + 7 ) ) )
+	{
+		return( 0 );
+	}
+	element_end_offset      = safe_chunk_data_offset + 7 + element_data_size;
+	safe_chunk_data_offset += 11;
+
+	if( (size_t) element_name_offset == safe_chunk_data_offset )
+	{
+		result = libevtx_system_values_read_name(
+		          chunk_data,
+		          element_end_offset,
+		          &safe_chunk_data_offset,
+		          &name_data,
+		          &name_data_size,
+		          error );
+	}
+	else
+	{
+		name_offset = (size_t) element_name_offset;
+
+		result = libevtx_system_values_read_name(
+		          chunk_data,
+		          chunk_data_size,
+		          &name_offset,
+		          &name_data,
+		          &name_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element name.",
+			 function );
+		}
+		return( result );
+	}
+	/* Only the Event, Event/System and the values in Event/System are walked
+	 */
+	if( element_depth == 0 )
+	{
+		if( libevtx_system_values_compare_name(
+		     name_data,
+		     name_data_size,
+		     "Event",
+		     5 ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	else if( element_depth == 1 )
+	{
+		if( libevtx_system_values_compare_name(
+		     name_data,
+		     name_data_size,
+		     "System",
+		     6 ) != 1 )
+		{
+			*chunk_data_offset = element_end_offset;
+
+			return( 1 );
+		}
+	}
+	else if( element_depth == 2 )
+	{
+		if( libevtx_system_values_compare_name(
+		     name_data,
+		     name_data_size,
+		     "EventID",
+		     7 ) == 1 )
+		{
+			value_index = LIBEVTX_SYSTEM_VALUE_EVENT_IDENTIFIER;
+		}
+		else if( libevtx_system_values_compare_name(
+		          name_data,
+		          name_data_size,
+		          "Level",
+		          5 ) == 1 )
+		{
+			value_index = LIBEVTX_SYSTEM_VALUE_EVENT_LEVEL;
+		}
+		else if( libevtx_system_values_compare_name(
+		          name_data,
+		          name_data_size,
+		          "Channel",
+		          7 ) == 1 )
+		{
+			value_index = LIBEVTX_SYSTEM_VALUE_CHANNEL_NAME;
+		}
+		else if( libevtx_system_values_compare_name(
+		          name_data,
+		          name_data_size,
+		          "Computer",
+		          8 ) == 1 )
+		{
+			value_index = LIBEVTX_SYSTEM_VALUE_COMPUTER_NAME;
+		}
+		else if( libevtx_system_values_compare_name(
+		          name_data,
+		          name_data_size,
+		          "Keywords",
+		          8 ) == 1 )
+		{
+			value_index = LIBEVTX_SYSTEM_VALUE_KEYWORDS;
+		}
+		else if( libevtx_system_values_compare_name(
+		          name_data,
+		          name_data_size,
+		          "Provider",
+		          8 ) == 1 )
+		{
+			is_provider_element = 1;
+		}
+		else
+		{
+			*chunk_data_offset = element_end_offset;
+
+			return( 1 );
+		}
+	}
+	else
+	{
+		*chunk_data_offset = element_end_offset;
+
+		return( 1 );
+	}
+	if( ( element_token & LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA ) != 0 )
+	{
+		if( ( element_end_offset - safe_chunk_data_offset ) < 4 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chunk_data[ safe_chunk_data_offset ] ),
+		 attributes_data_size );
+
+		safe_chunk_data_offset += 4;
+
+		if( (size_t) attributes_data_size > ( element_end_offset - safe_chunk_data_offset ) )
+		{
+			return( 0 );
+		}
+		attributes_end_offset = safe_chunk_data_offset + attributes_data_size;
+
+		while( safe_chunk_data_offset < attributes_end_offset )
+		{
+			/* The attribute consists of the token and the attribute name offset
+			 */
+			if( ( attributes_end_offset - safe_chunk_data_offset ) < 5 )
+			{
+				return( 0 );
+			}
+			token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+			if( token != LIBEVTX_BINARY_XML_TOKEN_ATTRIBUTE )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+			 element_name_offset );
+
+			safe_chunk_data_offset += 5;
+
+			if( (size_t) element_name_offset == safe_chunk_data_offset )
+			{
+				result = libevtx_system_values_read_name(
+				          chunk_data,
+				          attributes_end_offset,
+				          &safe_chunk_data_offset,
+				          &name_data,
+				          &name_data_size,
+				          error );
+			}
+			else
+			{
+				name_offset = (size_t) element_name_offset;
+
+				result = libevtx_system_values_read_name(
+				          chunk_data,
+				          chunk_data_size,
+				          &name_offset,
+				          &name_data,
+				          &name_data_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read attribute name.",
+					 function );
+				}
+				return( result );
+			}
+			template_value = NULL;
+
+			if( is_provider_element != 0 )
+			{
+				if( libevtx_system_values_compare_name(
+				     name_data,
+				     name_data_size,
+				     "Guid",
+				     4 ) == 1 )
+				{
+					template_value = &( template_values[ LIBEVTX_SYSTEM_VALUE_PROVIDER_IDENTIFIER ] );
+				}
+			}
+			result = libevtx_system_values_read_value(
+			          template_value,
+			          chunk_data,
+			          attributes_end_offset,
+			          &safe_chunk_data_offset,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read attribute value.",
+					 function );
+				}
+				return( result );
+			}
+		}
+	}
+	if( safe_chunk_data_offset >= element_end_offset )
+	{
+		return( 0 );
+	}
+	token = chunk_data[ safe_chunk_data_offset ];
+
+	if( token == LIBEVTX_BINARY_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
+	{
+		*chunk_data_offset = safe_chunk_data_offset + 1;
+
+		return( 1 );
+	}
+	else if( token != LIBEVTX_BINARY_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+	{
+		return( 0 );
+	}
+	safe_chunk_data_offset += 1;
+
+	while( safe_chunk_data_offset < element_end_offset )
+	{
+		token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+		if( token == LIBEVTX_BINARY_XML_TOKEN_END_ELEMENT_TAG )
+		{
+			*chunk_data_offset = safe_chunk_data_offset + 1;
+
+			return( 1 );
+		}
+		else if( token == LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+		{
+			result = libevtx_system_values_read_element(
+			          template_values,
+			          chunk_data,
+			          chunk_data_size,
+			          &safe_chunk_data_offset,
+			          element_end_offset,
+			          element_depth + 1,
+			          error );
+		}
+		else
+		{
+			template_value = NULL;
+
+			/* Only the first value of the element content is used
+			 */
+			if( value_index != -1 )
+			{
+				if( ( template_values[ value_index ].substitution_index == -1 )
+				 && ( template_values[ value_index ].string_data == NULL ) )
+				{
+					template_value = &( template_values[ value_index ] );
+				}
+			}
+			result = libevtx_system_values_read_value(
+			          template_value,
+			          chunk_data,
+			          element_end_offset,
+			          &safe_chunk_data_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read element content.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads a name
+ * The name consists of the next name offset, the name hash, the number of characters,
+ * the UTF-16 little-endian characters and an end of string character
+ * Returns 1 if successful, 0 if the name is not supported or -1 on error
+ */
+int libevtx_system_values_read_name(
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libevtx_system_values_read_name";
+	size_t safe_chunk_data_offset = 0;
+	uint16_t number_of_characters = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	if( ( safe_chunk_data_offset >= chunk_data_size )
+	 || ( ( chunk_data_size - safe_chunk_data_offset ) < 8 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 6 ] ),
+	 number_of_characters );
+
+	safe_chunk_data_offset += 8;
+
+	if( ( ( (size_t) number_of_characters + 1 ) * 2 ) > ( chunk_data_size - safe_chunk_data_offset ) )
+	{
+		return( 0 );
+	}
+	*name_data      = &( chunk_data[ safe_chunk_data_offset ] );
+	*name_data_size = (size_t) number_of_characters * 2;
+
+	*chunk_data_offset = safe_chunk_data_offset + ( ( (size_t) number_of_characters + 1 ) * 2 );
+
+	return( 1 );
+}
+
+/* Reads a value, an attribute value or element content, of a template definition
+ * If template value is set it is used to store a substitution or string value
+ * Returns 1 if successful, 0 if the value is not supported or -1 on error
+ */
+int libevtx_system_values_read_value(
+     libevtx_system_values_template_value_t *template_value,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *name_data      = NULL;
+	static char *function         = "libevtx_system_values_read_value";
+	size_t name_data_size         = 0;
+	size_t safe_chunk_data_offset = 0;
+	uint32_t value_name_offset    = 0;
+	uint16_t number_of_characters = 0;
+	uint16_t substitution_index   = 0;
+	uint8_t token                 = 0;
+	int result                    = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	if( safe_chunk_data_offset >= chunk_data_size )
+	{
+		return( 0 );
+	}
+	token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+	switch( token )
+	{
+		case LIBEVTX_BINARY_XML_TOKEN_VALUE:
+			/* The value consists of the token, the value type, the number of characters
+			 * and the UTF-16 little-endian characters
+			 */
+			if( ( chunk_data_size - safe_chunk_data_offset ) < 4 )
+			{
+				return( 0 );
+			}
+			if( chunk_data[ safe_chunk_data_offset + 1 ] != LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( chunk_data[ safe_chunk_data_offset + 2 ] ),
+			 number_of_characters );
+
+			safe_chunk_data_offset += 4;
+
+			if( ( (size_t) number_of_characters * 2 ) > ( chunk_data_size - safe_chunk_data_offset ) )
+			{
+				return( 0 );
+			}
+			if( template_value != NULL )
+			{
+				template_value->string_data      = &( chunk_data[ safe_chunk_data_offset ] );
+				template_value->string_data_size = (size_t) number_of_characters * 2;
+			}
+			safe_chunk_data_offset += (size_t) number_of_characters * 2;
+
+			break;
+
+		case LIBEVTX_BINARY_XML_TOKEN_NORMAL_SUBSTITUTION:
+		case LIBEVTX_BINARY_XML_TOKEN_OPTIONAL_SUBSTITUTION:
+			/* The substitution consists of the token, the substitution index and the value type
+			 */
+			if( ( chunk_data_size - safe_chunk_data_offset ) < 4 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+			 substitution_index );
+
+			if( template_value != NULL )
+			{
+				template_value->substitution_index = (int) substitution_index;
+			}
+			safe_chunk_data_offset += 4;
+
+			break;
+
+		case LIBEVTX_BINARY_XML_TOKEN_CDATA_SECTION:
+		case LIBEVTX_BINARY_XML_TOKEN_PI_DATA:
+			if( ( chunk_data_size - safe_chunk_data_offset ) < 3 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+			 number_of_characters );
+
+			safe_chunk_data_offset += 3;
+
+			if( ( (size_t) number_of_characters * 2 ) > ( chunk_data_size - safe_chunk_data_offset ) )
+			{
+				return( 0 );
+			}
+			safe_chunk_data_offset += (size_t) number_of_characters * 2;
+
+			break;
+
+		case LIBEVTX_BINARY_XML_TOKEN_CHARACTER_REFERENCE:
+			if( ( chunk_data_size - safe_chunk_data_offset ) < 3 )
+			{
+				return( 0 );
+			}
+			safe_chunk_data_offset += 3;
+
+			break;
+
+		case LIBEVTX_BINARY_XML_TOKEN_ENTITY_REFERENCE:
+		case LIBEVTX_BINARY_XML_TOKEN_PI_TARGET:
+			if( ( chunk_data_size - safe_chunk_data_offset ) < 5 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+			 value_name_offset );
+
+			safe_chunk_data_offset += 5;
+
+			if( (size_t) value_name_offset == safe_chunk_data_offset )
+			{
+				result = libevtx_system_values_read_name(
+				          chunk_data,
+				          chunk_data_size,
+				          &safe_chunk_data_offset,
+				          &name_data,
+				          &name_data_size,
+				          error );
+
+				if( result != 1 )
+				{
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read name.",
+						 function );
+					}
+					return( result );
+				}
+			}
+			break;
+
+		default:
+			return( 0 );
+	}
+	*chunk_data_offset = safe_chunk_data_offset;
+
+	return( 1 );
+}
+
+/* Reads the substitution values of the template instance of a record
+ * Returns 1 if successful, 0 if the substitution values are not supported or -1 on error
+ */
+int libevtx_system_values_read_substitution_values(
+     libevtx_system_values_t *system_values,
+     libevtx_system_values_template_value_t *template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t substitutions_offset,
+     size_t end_of_data_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data       = NULL;
+	static char *function           = "libevtx_system_values_read_substitution_values";
+	size_t value_data_offset        = 0;
+	uint64_t value_64bit            = 0;
+	uint32_t number_of_values       = 0;
+	uint32_t substitution_index     = 0;
+	uint32_t value_32bit            = 0;
+	uint16_t value_16bit            = 0;
+	uint16_t value_data_size        = 0;
+	uint8_t value_type              = 0;
+	int value_index                 = 0;
+
+	if( system_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system values.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The substitution values consist of the number of values, a size and type
+	 * descriptor per value and the value data
+	 */
+	if( ( substitutions_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - substitutions_offset ) < 4 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ substitutions_offset ] ),
+	 number_of_values );
+
+	substitutions_offset += 4;
+
+	if( (size_t) number_of_values > ( ( end_of_data_offset - substitutions_offset ) / 4 ) )
+	{
+		return( 0 );
+	}
+	for( value_index = 0;
+	     value_index < LIBEVTX_NUMBER_OF_SYSTEM_VALUES;
+	     value_index++ )
+	{
+		value_data      = NULL;
+		value_data_size = 0;
+		value_type      = LIBEVTX_VALUE_TYPE_STRING_UTF16;
+
+		if( template_values[ value_index ].substitution_index >= 0 )
+		{
+			/* An optional substitution without a corresponding value is not set
+			 */
+			if( (uint32_t) template_values[ value_index ].substitution_index >= number_of_values )
+			{
+				continue;
+			}
+			value_data_offset = substitutions_offset + ( (size_t) number_of_values * 4 );
+
+			for( substitution_index = 0;
+			     substitution_index < (uint32_t) template_values[ value_index ].substitution_index;
+			     substitution_index++ )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( chunk_data[ substitutions_offset + ( (size_t) substitution_index * 4 ) ] ),
+				 value_data_size );
+
+				value_data_offset += value_data_size;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( chunk_data[ substitutions_offset + ( (size_t) substitution_index * 4 ) ] ),
+			 value_data_size );
+
+			value_type = chunk_data[ substitutions_offset + ( (size_t) substitution_index * 4 ) + 2 ];
+
+			if( ( value_data_offset > end_of_data_offset )
+			 || ( (size_t) value_data_size > ( end_of_data_offset - value_data_offset ) ) )
+			{
+				return( 0 );
+			}
+			if( ( value_type == LIBEVTX_VALUE_TYPE_NULL )
+			 || ( value_data_size == 0 ) )
+			{
+				continue;
+			}
+			value_data = &( chunk_data[ value_data_offset ] );
+		}
+		else if( template_values[ value_index ].string_data != NULL )
+		{
+			value_data      = template_values[ value_index ].string_data;
+			value_data_size = (uint16_t) template_values[ value_index ].string_data_size;
+		}
+		else
+		{
+			continue;
+		}
+		switch( value_index )
+		{
+			case LIBEVTX_SYSTEM_VALUE_EVENT_IDENTIFIER:
+			case LIBEVTX_SYSTEM_VALUE_EVENT_LEVEL:
+				if( ( value_type == LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_8BIT )
+				 && ( value_data_size == 1 ) )
+				{
+					value_32bit = value_data[ 0 ];
+				}
+				else if( ( value_type == LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_16BIT )
+				      && ( value_data_size == 2 ) )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 value_data,
+					 value_16bit );
+
+					value_32bit = value_16bit;
+				}
+				else if( ( value_type == LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_32BIT )
+				      && ( value_data_size == 4 ) )
+				{
+					byte_stream_copy_to_uint32_little_endian(
+					 value_data,
+					 value_32bit );
+				}
+				else if( value_type == LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+				{
+					if( libevtx_system_values_copy_decimal_string(
+					     value_data,
+					     (size_t) value_data_size,
+					     &value_32bit ) != 1 )
+					{
+						return( 0 );
+					}
+				}
+				else
+				{
+					return( 0 );
+				}
+				if( value_index == LIBEVTX_SYSTEM_VALUE_EVENT_IDENTIFIER )
+				{
+					system_values->event_identifier = value_32bit;
+					system_values->flags           |= LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER;
+				}
+				else
+				{
+					if( value_32bit > (uint32_t) UINT8_MAX )
+					{
+						return( 0 );
+					}
+					system_values->event_level = (uint8_t) value_32bit;
+					system_values->flags      |= LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL;
+				}
+				break;
+
+			case LIBEVTX_SYSTEM_VALUE_PROVIDER_IDENTIFIER:
+				/* A provider identifier stored as a string in the template is left
+				 * to the XML document
+				 */
+				if( ( value_type != LIBEVTX_VALUE_TYPE_GUID )
+				 || ( value_data_size != 16 ) )
+				{
+					return( 0 );
+				}
+				if( memory_copy(
+				     system_values->provider_identifier,
+				     value_data,
+				     16 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy provider identifier.",
+					 function );
+
+					return( -1 );
+				}
+				system_values->flags |= LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER;
+
+				break;
+
+			case LIBEVTX_SYSTEM_VALUE_CHANNEL_NAME:
+			case LIBEVTX_SYSTEM_VALUE_COMPUTER_NAME:
+				if( value_type != LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+				{
+					return( 0 );
+				}
+				/* Ignore trailing end of string characters
+				 */
+				while( ( value_data_size >= 2 )
+				    && ( value_data[ value_data_size - 2 ] == 0 )
+				    && ( value_data[ value_data_size - 1 ] == 0 ) )
+				{
+					value_data_size -= 2;
+				}
+				if( value_data_size == 0 )
+				{
+					break;
+				}
+				if( value_index == LIBEVTX_SYSTEM_VALUE_CHANNEL_NAME )
+				{
+					system_values->channel_name      = value_data;
+					system_values->channel_name_size = (size_t) value_data_size;
+					system_values->flags            |= LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME;
+				}
+				else
+				{
+					system_values->computer_name      = value_data;
+					system_values->computer_name_size = (size_t) value_data_size;
+					system_values->flags             |= LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME;
+				}
+				break;
+
+			case LIBEVTX_SYSTEM_VALUE_KEYWORDS:
+				/* Keywords that are not stored as a 64-bit integer are left
+				 * to the XML document, the other System values remain usable
+				 */
+				if( ( ( value_type != LIBEVTX_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT )
+				  &&  ( value_type != LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_64BIT ) )
+				 || ( value_data_size != 8 ) )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 value_data,
+				 value_64bit );
+
+				system_values->keywords = value_64bit;
+				system_values->flags   |= LIBEVTX_SYSTEM_VALUES_FLAG_HAS_KEYWORDS;
+
+				break;
+		}
+	}
+	return( 1 );
+}
+
+/* Compares an UTF-16 little-endian name with an ASCII string
+ * Returns 1 if the name and the string are equal or 0 if not
+ */
+int libevtx_system_values_compare_name(
+     const uint8_t *name_data,
+     size_t name_data_size,
+     const char *ascii_string,
+     size_t ascii_string_length )
+{
+	size_t string_index = 0;
+
+	if( ( name_data == NULL )
+	 || ( ascii_string == NULL ) )
+	{
+		return( 0 );
+	}
+	if( name_data_size != ( ascii_string_length * 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < ascii_string_length;
+	     string_index++ )
+	{
+		if( ( name_data[ string_index * 2 ] != (uint8_t) ascii_string[ string_index ] )
+		 || ( name_data[ ( string_index * 2 ) + 1 ] != 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian decimal string to a 32-bit value
+ * Returns 1 if successful or 0 if the string does not contain a valid decimal value
+ */
+int libevtx_system_values_copy_decimal_string(
+     const uint8_t *string_data,
+     size_t string_data_size,
+     uint32_t *value_32bit )
+{
+	size_t string_index = 0;
+	uint32_t digit      = 0;
+	uint32_t value      = 0;
+
+	if( ( string_data == NULL )
+	 || ( value_32bit == NULL ) )
+	{
+		return( 0 );
+	}
+	/* Ignore trailing end of string characters
+	 */
+	while( ( string_data_size >= 2 )
+	    && ( string_data[ string_data_size - 2 ] == 0 )
+	    && ( string_data[ string_data_size - 1 ] == 0 ) )
+	{
+		string_data_size -= 2;
+	}
+	if( ( string_data_size == 0 )
+	 || ( ( string_data_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_data_size;
+	     string_index += 2 )
+	{
+		if( ( string_data[ string_index + 1 ] != 0 )
+		 || ( string_data[ string_index ] < (uint8_t) '0' )
+		 || ( string_data[ string_index ] > (uint8_t) '9' ) )
+		{
+			return( 0 );
+		}
+		digit = (uint32_t) ( string_data[ string_index ] - (uint8_t) '0' );
+
+		if( value > ( ( UINT32_MAX - digit ) / 10 ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += digit;
+	}
+	*value_32bit = value;
+
+	return( 1 );
+}
+
+/* Copies the provider identifier to an ASCII string
+ * The provider identifier is formatted in upper case and surrounded by braces,
+ * the same as in the XML document, so that the string can be used as UTF-8
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_system_values_copy_provider_identifier_to_string(
+     libevtx_system_values_t *system_values,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_system_values_copy_provider_identifier_to_string";
+	size_t string_index   = 0;
+
+	if( system_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system values.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( system_values->flags & LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER ) == 0 )
+	{
+		return( 0 );
+	}
+	if( libevtx_value_formatter_copy_guid_to_utf8_string(
+	     system_values->provider_identifier,
+	     16,
+	     string,
+	     string_size,
+	     &string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier to string.",
+		 function );
+
+		return( -1 );
+	}
+	string[ string_index++ ] = 0;
+
+	return( 1 );
+}
+
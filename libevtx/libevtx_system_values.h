@@ -0,0 +1,233 @@
+/*
+ * System values functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_SYSTEM_VALUES_H )
+#define _LIBEVTX_SYSTEM_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_template_cache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The System element values that are probed
+ */
+#define LIBEVTX_SYSTEM_VALUE_EVENT_IDENTIFIER		0
+#define LIBEVTX_SYSTEM_VALUE_EVENT_LEVEL		1
+#define LIBEVTX_SYSTEM_VALUE_PROVIDER_IDENTIFIER	2
+#define LIBEVTX_SYSTEM_VALUE_CHANNEL_NAME		3
+#define LIBEVTX_SYSTEM_VALUE_COMPUTER_NAME		4
+#define LIBEVTX_SYSTEM_VALUE_KEYWORDS			5
+
+#define LIBEVTX_NUMBER_OF_SYSTEM_VALUES			6
+
+/* The size of a provider identifier string formatted as:
+ * {XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX} including the end of string character
+ */
+#define LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE	39
+
+typedef struct libevtx_system_values_template_value libevtx_system_values_template_value_t;
+
+struct libevtx_system_values_template_value
+{
+	/* The substitution index
+	 * Contains -1 if the value is not a substitution
+	 */
+	int substitution_index;
+
+	/* The (UTF-16 little-endian) string data of a value that is stored in the template
+	 */
+	const uint8_t *string_data;
+
+	/* The string data size
+	 */
+	size_t string_data_size;
+};
+
+/* The number of template definitions cached per chunk
+ */
+#define LIBEVTX_SYSTEM_VALUES_NUMBER_OF_CACHED_TEMPLATES	16
+
+typedef struct libevtx_system_values_template libevtx_system_values_template_t;
+
+struct libevtx_system_values_template
+{
+	/* The template definition offset
+	 * Contains 0 if the template is not set
+	 */
+	uint32_t template_definition_offset;
+
+	/* The template definition size
+	 */
+	size_t template_definition_size;
+
+	/* Value to indicate the template definition is supported
+	 */
+	uint8_t is_supported;
+
+	/* The template values
+	 */
+	libevtx_system_values_template_value_t template_values[ LIBEVTX_NUMBER_OF_SYSTEM_VALUES ];
+};
+
+typedef struct libevtx_system_values_template_cache libevtx_system_values_template_cache_t;
+
+struct libevtx_system_values_template_cache
+{
+	/* The templates
+	 * The template values reference the chunk data
+	 */
+	libevtx_system_values_template_t templates[ LIBEVTX_SYSTEM_VALUES_NUMBER_OF_CACHED_TEMPLATES ];
+};
+
+typedef struct libevtx_system_values libevtx_system_values_t;
+
+struct libevtx_system_values
+{
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The event level
+	 */
+	uint8_t event_level;
+
+	/* The provider identifier
+	 * Contains a little-endian GUID
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The channel name
+	 * Contains an UTF-16 little-endian string without end of string character
+	 * that references the chunk data
+	 */
+	const uint8_t *channel_name;
+
+	/* The channel name size
+	 */
+	size_t channel_name_size;
+
+	/* The computer name
+	 * Contains an UTF-16 little-endian string without end of string character
+	 * that references the chunk data
+	 */
+	const uint8_t *computer_name;
+
+	/* The computer name size
+	 */
+	size_t computer_name_size;
+
+	/* The keywords
+	 */
+	uint64_t keywords;
+
+	/* Various flags
+	 */
+	uint8_t flags;
+};
+
+int libevtx_system_values_read_data(
+     libevtx_system_values_t *system_values,
+     libevtx_system_values_template_cache_t *template_cache,
+     libevtx_template_cache_t *shared_template_cache,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+int libevtx_system_values_read_template_definition(
+     libevtx_system_values_template_value_t *template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t template_definition_offset,
+     size_t *template_definition_size,
+     libcerror_error_t **error );
+
+int libevtx_system_values_read_shared_template_definition(
+     libevtx_system_values_template_value_t *template_values,
+     libevtx_template_cache_t *shared_template_cache,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t template_definition_offset,
+     size_t *template_definition_size,
+     libcerror_error_t **error );
+
+int libevtx_system_values_read_element(
+     libevtx_system_values_template_value_t *template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error );
+
+int libevtx_system_values_read_name(
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     libcerror_error_t **error );
+
+int libevtx_system_values_read_value(
+     libevtx_system_values_template_value_t *template_value,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t *chunk_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_system_values_read_substitution_values(
+     libevtx_system_values_t *system_values,
+     libevtx_system_values_template_value_t *template_values,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t substitutions_offset,
+     size_t end_of_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_system_values_compare_name(
+     const uint8_t *name_data,
+     size_t name_data_size,
+     const char *ascii_string,
+     size_t ascii_string_length );
+
+int libevtx_system_values_copy_decimal_string(
+     const uint8_t *string_data,
+     size_t string_data_size,
+     uint32_t *value_32bit );
+
+int libevtx_system_values_copy_provider_identifier_to_string(
+     libevtx_system_values_t *system_values,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_SYSTEM_VALUES_H ) */
+
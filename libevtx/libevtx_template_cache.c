@@ -0,0 +1,490 @@
+/*
+ * Template cache functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_template_cache.h"
+
+/* Creates a template cache
+ * The number of entries is rounded up to a power of 2
+ * Make sure the value template_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_cache_initialize(
+     libevtx_template_cache_t **template_cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_template_cache_initialize";
+	size_t entries_size   = 0;
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > ( 1 << 20 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*template_cache = memory_allocate_structure(
+	                   libevtx_template_cache_t );
+
+	if( *template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *template_cache,
+	     0,
+	     sizeof( libevtx_template_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template cache.",
+		 function );
+
+		memory_free(
+		 *template_cache );
+
+		*template_cache = NULL;
+
+		return( -1 );
+	}
+	( *template_cache )->number_of_entries = 1;
+
+	while( ( *template_cache )->number_of_entries < number_of_entries )
+	{
+		( *template_cache )->number_of_entries *= 2;
+	}
+	entries_size = sizeof( libevtx_template_cache_entry_t ) * ( *template_cache )->number_of_entries;
+
+	( *template_cache )->entries = (libevtx_template_cache_entry_t *) memory_allocate(
+	                                                                   entries_size );
+
+	if( ( *template_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *template_cache )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *template_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *template_cache != NULL )
+	{
+		if( ( *template_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *template_cache )->entries );
+		}
+		memory_free(
+		 *template_cache );
+
+		*template_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a template cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_cache_free(
+     libevtx_template_cache_t **template_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_template_cache_free";
+	int result            = 1;
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_cache != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *template_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *template_cache )->entries );
+
+		memory_free(
+		 *template_cache );
+
+		*template_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the values of a cached template skeleton
+ * The template is identified by its identifier, its data size and the hash of its data
+ * Returns 1 if successful, 0 if the template is not cached or -1 on error
+ */
+int libevtx_template_cache_get_values(
+     libevtx_template_cache_t *template_cache,
+     const uint8_t *template_identifier,
+     uint32_t template_data_size,
+     uint64_t template_data_hash,
+     libevtx_template_cache_value_t *values,
+     int number_of_values,
+     uint8_t *is_supported,
+     libcerror_error_t **error )
+{
+	libevtx_template_cache_entry_t *entry = NULL;
+	static char *function                 = "libevtx_template_cache_get_values";
+	int result                            = 0;
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values <= 0 )
+	 || ( number_of_values > LIBEVTX_TEMPLATE_CACHE_MAXIMUM_NUMBER_OF_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_supported == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is supported.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     template_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = &( template_cache->entries[ template_data_hash & (uint64_t) ( template_cache->number_of_entries - 1 ) ] );
+
+	if( ( entry->is_set != 0 )
+	 && ( entry->template_data_hash == template_data_hash )
+	 && ( entry->template_data_size == template_data_size )
+	 && ( memory_compare(
+	       entry->template_identifier,
+	       template_identifier,
+	       16 ) == 0 ) )
+	{
+		if( memory_copy(
+		     values,
+		     entry->values,
+		     sizeof( libevtx_template_cache_value_t ) * number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy values.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*is_supported = entry->is_supported;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     template_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the values of a template skeleton in the cache
+ * A template that maps to the same entry is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_cache_set_values(
+     libevtx_template_cache_t *template_cache,
+     const uint8_t *template_identifier,
+     uint32_t template_data_size,
+     uint64_t template_data_hash,
+     const libevtx_template_cache_value_t *values,
+     int number_of_values,
+     uint8_t is_supported,
+     libcerror_error_t **error )
+{
+	libevtx_template_cache_entry_t *entry = NULL;
+	static char *function                 = "libevtx_template_cache_set_values";
+	int result                            = 1;
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values <= 0 )
+	 || ( number_of_values > LIBEVTX_TEMPLATE_CACHE_MAXIMUM_NUMBER_OF_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     template_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = &( template_cache->entries[ template_data_hash & (uint64_t) ( template_cache->number_of_entries - 1 ) ] );
+
+	if( ( memory_copy(
+	       entry->template_identifier,
+	       template_identifier,
+	       16 ) == NULL )
+	 || ( memory_copy(
+	       entry->values,
+	       values,
+	       sizeof( libevtx_template_cache_value_t ) * number_of_values ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy template.",
+		 function );
+
+		entry->is_set = 0;
+
+		result = -1;
+	}
+	else
+	{
+		entry->template_data_size = template_data_size;
+		entry->template_data_hash = template_data_hash;
+		entry->is_supported       = is_supported;
+		entry->is_set             = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     template_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
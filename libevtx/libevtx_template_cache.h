@@ -0,0 +1,142 @@
+/*
+ * Template cache functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_TEMPLATE_CACHE_H )
+#define _LIBEVTX_TEMPLATE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of values of a cached template skeleton
+ */
+#define LIBEVTX_TEMPLATE_CACHE_MAXIMUM_NUMBER_OF_VALUES		8
+
+typedef struct libevtx_template_cache_value libevtx_template_cache_value_t;
+
+struct libevtx_template_cache_value
+{
+	/* The substitution index
+	 * Contains -1 if the value is not a substitution
+	 */
+	int substitution_index;
+
+	/* The offset of the string data of a value that is stored in the template
+	 * The offset is relative to the start of the template definition
+	 */
+	size_t string_data_offset;
+
+	/* The string data size
+	 * Contains 0 if the template does not store the value
+	 */
+	size_t string_data_size;
+};
+
+typedef struct libevtx_template_cache_entry libevtx_template_cache_entry_t;
+
+struct libevtx_template_cache_entry
+{
+	/* The template identifier
+	 * Contains a little-endian GUID
+	 */
+	uint8_t template_identifier[ 16 ];
+
+	/* The template data size
+	 */
+	uint32_t template_data_size;
+
+	/* The 64-bit xxHash of the template data
+	 */
+	uint64_t template_data_hash;
+
+	/* Value to indicate the entry is set
+	 */
+	uint8_t is_set;
+
+	/* Value to indicate the template is supported
+	 */
+	uint8_t is_supported;
+
+	/* The values
+	 */
+	libevtx_template_cache_value_t values[ LIBEVTX_TEMPLATE_CACHE_MAXIMUM_NUMBER_OF_VALUES ];
+};
+
+typedef struct libevtx_template_cache libevtx_template_cache_t;
+
+struct libevtx_template_cache
+{
+	/* The entries
+	 */
+	libevtx_template_cache_entry_t *entries;
+
+	/* The number of entries, which is a power of 2
+	 */
+	int number_of_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libevtx_template_cache_initialize(
+     libevtx_template_cache_t **template_cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_template_cache_free(
+     libevtx_template_cache_t **template_cache,
+     libcerror_error_t **error );
+
+int libevtx_template_cache_get_values(
+     libevtx_template_cache_t *template_cache,
+     const uint8_t *template_identifier,
+     uint32_t template_data_size,
+     uint64_t template_data_hash,
+     libevtx_template_cache_value_t *values,
+     int number_of_values,
+     uint8_t *is_supported,
+     libcerror_error_t **error );
+
+int libevtx_template_cache_set_values(
+     libevtx_template_cache_t *template_cache,
+     const uint8_t *template_identifier,
+     uint32_t template_data_size,
+     uint64_t template_data_hash,
+     const libevtx_template_cache_value_t *values,
+     int number_of_values,
+     uint8_t is_supported,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_TEMPLATE_CACHE_H ) */
+
@@ -157,6 +157,19 @@ int libevtx_template_definition_free(
 
 			result = -1;
 		}
+		if( libevtx_template_definition_free_nodes(
+		     internal_template_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compiled nodes.",
+			 function );
+
+			result = -1;
+		}
 		if( internal_template_definition->xml_document != NULL )
 		{
 			if( libfwevt_xml_document_free(
@@ -237,6 +250,87 @@ int libevtx_template_definition_set_data(
 	return( 1 );
 }
 
+/* Sets the resource data
+ * The template is read from the WEVT_TEMPLATE resource data at the template data offset.
+ * The resource data is referenced, not copied, and must remain valid for the lifetime
+ * of the template definition
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_definition_set_resource_data(
+     libevtx_template_definition_t *template_definition,
+     const uint8_t *resource_data,
+     size_t resource_data_size,
+     uint32_t template_data_offset,
+     libcerror_error_t **error )
+{
+	libevtx_internal_template_definition_t *internal_template_definition = NULL;
+	static char *function                                                = "libevtx_template_definition_set_resource_data";
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_template_definition = (libevtx_internal_template_definition_t *) template_definition;
+
+	if( resource_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource data.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid resource data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) template_data_offset >= resource_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_template_read(
+	     internal_template_definition->wevt_template,
+	     resource_data,
+	     resource_data_size,
+	     (size_t) template_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read template.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads the template
  * Returns 1 if successful or -1 on error
  */
@@ -357,3 +451,511 @@ on_error:
 	return( -1 );
 }
 
+/* Frees the compiled nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_definition_free_nodes(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_template_definition_free_nodes";
+	int node_index        = 0;
+
+	if( internal_template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_template_definition->nodes != NULL )
+	{
+		for( node_index = 0;
+		     node_index < internal_template_definition->number_of_nodes;
+		     node_index++ )
+		{
+			if( internal_template_definition->nodes[ node_index ].name != NULL )
+			{
+				memory_free(
+				 internal_template_definition->nodes[ node_index ].name );
+			}
+		}
+		memory_free(
+		 internal_template_definition->nodes );
+
+		internal_template_definition->nodes = NULL;
+	}
+	internal_template_definition->number_of_nodes           = 0;
+	internal_template_definition->number_of_allocated_nodes = 0;
+	internal_template_definition->number_of_value_nodes     = 0;
+
+	return( 1 );
+}
+
+/* Appends a compiled node
+ * The number of attributes, number of elements and name are only retrieved
+ * for attribute and element nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_definition_append_node(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     uint8_t node_type,
+     int parent_node_index,
+     int xml_tag_index,
+     libfwevt_xml_tag_t *xml_tag,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	libevtx_template_node_t *node         = NULL;
+	libevtx_template_node_t *reallocation = NULL;
+	static char *function                 = "libevtx_template_definition_append_node";
+	int number_of_allocated_nodes         = 0;
+
+	if( internal_template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_template_definition->number_of_nodes >= internal_template_definition->number_of_allocated_nodes )
+	{
+		if( internal_template_definition->number_of_allocated_nodes == 0 )
+		{
+			number_of_allocated_nodes = 16;
+		}
+		else if( internal_template_definition->number_of_allocated_nodes < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_nodes = internal_template_definition->number_of_allocated_nodes * 2;
+		}
+		if( ( number_of_allocated_nodes == 0 )
+		 || ( (size_t) number_of_allocated_nodes > ( (size_t) SSIZE_MAX / sizeof( libevtx_template_node_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated nodes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (libevtx_template_node_t *) memory_reallocate(
+		                                            internal_template_definition->nodes,
+		                                            sizeof( libevtx_template_node_t ) * number_of_allocated_nodes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize nodes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_template_definition->nodes                     = reallocation;
+		internal_template_definition->number_of_allocated_nodes = number_of_allocated_nodes;
+	}
+	node = &( internal_template_definition->nodes[ internal_template_definition->number_of_nodes ] );
+
+	if( memory_set(
+	     node,
+	     0,
+	     sizeof( libevtx_template_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node.",
+		 function );
+
+		return( -1 );
+	}
+	*node_index = internal_template_definition->number_of_nodes;
+
+	internal_template_definition->number_of_nodes += 1;
+
+	node->type              = node_type;
+	node->parent_node_index = parent_node_index;
+	node->xml_tag_index     = xml_tag_index;
+	node->next_node_index   = internal_template_definition->number_of_nodes;
+	node->xml_tag           = xml_tag;
+
+	if( node_type == LIBEVTX_TEMPLATE_NODE_TYPE_VALUE )
+	{
+		internal_template_definition->number_of_value_nodes += 1;
+
+		return( 1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     xml_tag,
+	     &( node->number_of_attributes ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     xml_tag,
+	     &( node->number_of_elements ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_name_size(
+	     xml_tag,
+	     &( node->name_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node->name_size == 0 )
+	 || ( node->name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	node->name = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * node->name_size );
+
+	if( node->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_name(
+	     xml_tag,
+	     node->name,
+	     node->name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compiles a XML tag and its sub XML tags into nodes
+ * The nodes are appended in the order libevtx_record_values_parse_data_xml_tag_by_template
+ * visits them: the XML tag, its attributes and then either its value or its elements
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_definition_compile_xml_tag(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t node_type,
+     int parent_node_index,
+     int xml_tag_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *sub_xml_tag = NULL;
+	static char *function           = "libevtx_template_definition_compile_xml_tag";
+	uint8_t xml_tag_flags           = 0;
+	int attribute_index             = 0;
+	int element_index               = 0;
+	int node_index                  = 0;
+	int number_of_attributes        = 0;
+	int number_of_elements          = 0;
+	int value_node_index            = 0;
+
+	if( internal_template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_template_definition_append_node(
+	     internal_template_definition,
+	     node_type,
+	     parent_node_index,
+	     xml_tag_index,
+	     xml_tag,
+	     &node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append node.",
+		 function );
+
+		return( -1 );
+	}
+	/* The nodes can be reallocated by the sub XML tags hence the values are copied
+	 */
+	number_of_attributes = internal_template_definition->nodes[ node_index ].number_of_attributes;
+	number_of_elements   = internal_template_definition->nodes[ node_index ].number_of_elements;
+
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libfwevt_xml_tag_get_attribute_by_index(
+		     xml_tag,
+		     attribute_index,
+		     &sub_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		if( libevtx_template_definition_compile_xml_tag(
+		     internal_template_definition,
+		     sub_xml_tag,
+		     LIBEVTX_TEMPLATE_NODE_TYPE_ATTRIBUTE,
+		     node_index,
+		     attribute_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compile attribute: %d.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+	}
+	if( number_of_elements == 0 )
+	{
+		if( libfwevt_xml_tag_get_flags(
+		     xml_tag,
+		     &xml_tag_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve XML tag flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( xml_tag_flags == LIBFWEVT_XML_TAG_FLAG_IS_TEMPLATE_DEFINITION )
+		{
+			if( libevtx_template_definition_append_node(
+			     internal_template_definition,
+			     LIBEVTX_TEMPLATE_NODE_TYPE_VALUE,
+			     node_index,
+			     0,
+			     xml_tag,
+			     &value_node_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value node.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else for( element_index = 0;
+	          element_index < number_of_elements;
+	          element_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     xml_tag,
+		     element_index,
+		     &sub_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libevtx_template_definition_compile_xml_tag(
+		     internal_template_definition,
+		     sub_xml_tag,
+		     LIBEVTX_TEMPLATE_NODE_TYPE_ELEMENT,
+		     node_index,
+		     element_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compile sub element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	internal_template_definition->nodes[ node_index ].next_node_index = internal_template_definition->number_of_nodes;
+
+	return( 1 );
+}
+
+/* Compiles the XML document of the template into nodes
+ * The nodes allow to match the XML tags of a record in a single pass
+ * instead of comparing the XML tag trees for every record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_template_definition_compile(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *root_xml_tag = NULL;
+	static char *function            = "libevtx_template_definition_compile";
+
+	if( internal_template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_template_definition->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid template definition - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_template_definition->nodes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition - nodes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_root_xml_tag(
+	     internal_template_definition->xml_document,
+	     &root_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root XML element.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_template_definition_compile_xml_tag(
+	     internal_template_definition,
+	     root_xml_tag,
+	     LIBEVTX_TEMPLATE_NODE_TYPE_ELEMENT,
+	     -1,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compile root XML element.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libevtx_template_definition_free_nodes(
+	 internal_template_definition,
+	 NULL );
+
+	return( -1 );
+}
+
@@ -36,6 +36,58 @@
 extern "C" {
 #endif
 
+/* The compiled template node types
+ */
+enum LIBEVTX_TEMPLATE_NODE_TYPES
+{
+	LIBEVTX_TEMPLATE_NODE_TYPE_ATTRIBUTE	= 1,
+	LIBEVTX_TEMPLATE_NODE_TYPE_ELEMENT	= 2,
+	LIBEVTX_TEMPLATE_NODE_TYPE_VALUE	= 3
+};
+
+typedef struct libevtx_template_node libevtx_template_node_t;
+
+struct libevtx_template_node
+{
+	/* The node type
+	 */
+	uint8_t type;
+
+	/* The index of the parent node
+	 * Contains -1 for the root node
+	 */
+	int parent_node_index;
+
+	/* The attribute or element index of the XML tag in the XML tag of the parent node
+	 */
+	int xml_tag_index;
+
+	/* The index of the node that follows the sub nodes
+	 * Used to skip the sub nodes if the XML tag does not match
+	 */
+	int next_node_index;
+
+	/* The number of attributes of the XML tag
+	 */
+	int number_of_attributes;
+
+	/* The number of elements of the XML tag
+	 */
+	int number_of_elements;
+
+	/* The UTF-8 encoded name of the XML tag
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* Reference to the template XML tag
+	 */
+	libfwevt_xml_tag_t *xml_tag;
+};
+
 typedef struct libevtx_internal_template_definition libevtx_internal_template_definition_t;
 
 struct libevtx_internal_template_definition
@@ -47,6 +99,26 @@ struct libevtx_internal_template_definition
 	/* The XML document
 	 */
 	libfwevt_xml_document_t *xml_document;
+
+	/* The compiled nodes
+	 * Contains the XML tags of the XML document in the order they are matched
+	 * against the XML tags of a record, with a value node for every template
+	 * definition (substitution) value
+	 */
+	libevtx_template_node_t *nodes;
+
+	/* The number of compiled nodes
+	 */
+	int number_of_nodes;
+
+	/* The number of allocated compiled nodes
+	 */
+	int number_of_allocated_nodes;
+
+	/* The number of compiled value nodes
+	 * Used to pre-size the strings arrays of a record
+	 */
+	int number_of_value_nodes;
 };
 
 LIBEVTX_EXTERN \
@@ -67,11 +139,44 @@ int libevtx_template_definition_set_data(
      uint32_t data_offset,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_template_definition_set_resource_data(
+     libevtx_template_definition_t *template_definition,
+     const uint8_t *resource_data,
+     size_t resource_data_size,
+     uint32_t template_data_offset,
+     libcerror_error_t **error );
+
 int libevtx_template_definition_read(
      libevtx_internal_template_definition_t *internal_template_definition,
      libevtx_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libevtx_template_definition_free_nodes(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error );
+
+int libevtx_template_definition_append_node(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     uint8_t node_type,
+     int parent_node_index,
+     int xml_tag_index,
+     libfwevt_xml_tag_t *xml_tag,
+     int *node_index,
+     libcerror_error_t **error );
+
+int libevtx_template_definition_compile_xml_tag(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t node_type,
+     int parent_node_index,
+     int xml_tag_index,
+     libcerror_error_t **error );
+
+int libevtx_template_definition_compile(
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
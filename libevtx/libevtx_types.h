@@ -34,13 +34,27 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libevtx_cache {}		libevtx_cache_t;
+typedef struct libevtx_carver {}		libevtx_carver_t;
+typedef struct libevtx_chunk_information {}	libevtx_chunk_information_t;
+typedef struct libevtx_collection {}		libevtx_collection_t;
 typedef struct libevtx_file {}			libevtx_file_t;
+typedef struct libevtx_message_resolver {}	libevtx_message_resolver_t;
 typedef struct libevtx_record {}		libevtx_record_t;
+typedef struct libevtx_record_filter {}		libevtx_record_filter_t;
+typedef struct libevtx_system_fields {}		libevtx_system_fields_t;
 typedef struct libevtx_template_definition {}	libevtx_template_definition_t;
 
 #else
+typedef intptr_t libevtx_cache_t;
+typedef intptr_t libevtx_carver_t;
+typedef intptr_t libevtx_chunk_information_t;
+typedef intptr_t libevtx_collection_t;
 typedef intptr_t libevtx_file_t;
+typedef intptr_t libevtx_message_resolver_t;
 typedef intptr_t libevtx_record_t;
+typedef intptr_t libevtx_record_filter_t;
+typedef intptr_t libevtx_system_fields_t;
 typedef intptr_t libevtx_template_definition_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
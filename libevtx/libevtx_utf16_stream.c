@@ -0,0 +1,366 @@
+/*
+ * UTF-16 stream conversion functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+#include "libevtx_utf16_stream.h"
+
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( LIBEVTX_UTF16_STREAM_HAVE_SSE2 )
+#include <emmintrin.h>
+
+#elif defined( LIBEVTX_UTF16_STREAM_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* Determines if an UTF-16 little-endian stream only contains ASCII characters
+ * The end of string character (0) is not considered an ASCII character,
+ * since the generic conversion treats it and the byte order mark separately
+ * The stream is checked 16 (AVX2) or 8 (SSE2 or NEON) code units at a time if available at compile time
+ * Returns 1 if the stream only contains ASCII characters or 0 if not
+ */
+int libevtx_utf16_stream_is_ascii(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size )
+{
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 )
+	__m256i mask_vector_256bit   = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i stream_vector_256bit = _mm256_setzero_si256();
+	__m256i zero_vector_256bit   = _mm256_setzero_si256();
+#endif
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 ) || defined( LIBEVTX_UTF16_STREAM_HAVE_SSE2 )
+	__m128i mask_vector          = _mm_set1_epi16( (short) 0xff80 );
+	__m128i stream_vector        = _mm_setzero_si128();
+	__m128i zero_vector          = _mm_setzero_si128();
+
+#elif defined( LIBEVTX_UTF16_STREAM_HAVE_NEON )
+	uint16x8_t mask_vector       = vdupq_n_u16( 0xff80 );
+	uint16x8_t stream_vector     = vdupq_n_u16( 0 );
+#endif
+	size_t stream_offset         = 0;
+	uint16_t code_unit           = 0;
+
+	if( ( utf16_stream == NULL )
+	 || ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	/* A code unit is ASCII if it is non-zero and has none of the bits 0xff80 set
+	 */
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 )
+	while( ( utf16_stream_size - stream_offset ) >= 32 )
+	{
+		stream_vector_256bit = _mm256_loadu_si256(
+		                        (const __m256i *) &( utf16_stream[ stream_offset ] ) );
+
+		if( ( _mm256_movemask_epi8(
+		       _mm256_cmpeq_epi16(
+		        _mm256_and_si256(
+		         stream_vector_256bit,
+		         mask_vector_256bit ),
+		        zero_vector_256bit ) ) != -1 )
+		 || ( _mm256_movemask_epi8(
+		       _mm256_cmpeq_epi16(
+		        stream_vector_256bit,
+		        zero_vector_256bit ) ) != 0 ) )
+		{
+			return( 0 );
+		}
+		stream_offset += 32;
+	}
+#endif
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 ) || defined( LIBEVTX_UTF16_STREAM_HAVE_SSE2 )
+	while( ( utf16_stream_size - stream_offset ) >= 16 )
+	{
+		stream_vector = _mm_loadu_si128(
+		                 (const __m128i *) &( utf16_stream[ stream_offset ] ) );
+
+		if( ( _mm_movemask_epi8(
+		       _mm_cmpeq_epi16(
+		        _mm_and_si128(
+		         stream_vector,
+		         mask_vector ),
+		        zero_vector ) ) != 0xffff )
+		 || ( _mm_movemask_epi8(
+		       _mm_cmpeq_epi16(
+		        stream_vector,
+		        zero_vector ) ) != 0 ) )
+		{
+			return( 0 );
+		}
+		stream_offset += 16;
+	}
+#elif defined( LIBEVTX_UTF16_STREAM_HAVE_NEON )
+	while( ( utf16_stream_size - stream_offset ) >= 16 )
+	{
+		stream_vector = vreinterpretq_u16_u8(
+		                 vld1q_u8(
+		                  &( utf16_stream[ stream_offset ] ) ) );
+
+		if( ( vmaxvq_u16(
+		       vandq_u16(
+		        stream_vector,
+		        mask_vector ) ) != 0 )
+		 || ( vminvq_u16(
+		       stream_vector ) == 0 ) )
+		{
+			return( 0 );
+		}
+		stream_offset += 16;
+	}
+#endif
+	while( stream_offset < utf16_stream_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ stream_offset ] ),
+		 code_unit );
+
+		if( ( code_unit == 0 )
+		 || ( code_unit > 0x007f ) )
+		{
+			return( 0 );
+		}
+		stream_offset += 2;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of an UTF-8 string of an UTF-16 little-endian stream
+ * The returned size includes the end of string character
+ * Streams that only contain ASCII characters are handled directly,
+ * other streams are converted by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_utf16_stream_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_utf16_stream_get_utf8_string_size";
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_utf16_stream_is_ascii(
+	     utf16_stream,
+	     utf16_stream_size ) != 0 )
+	{
+		*utf8_string_size = ( utf16_stream_size / 2 ) + 1;
+
+		return( 1 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian stream to an UTF-8 string
+ * The size should include the end of string character
+ * Streams that only contain ASCII characters are narrowed 32 (AVX2) or 16 (SSE2 or NEON)
+ * code units at a time if available at compile time, other streams are converted by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_utf16_stream_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 )
+	__m256i low_vector_256bit  = _mm256_setzero_si256();
+	__m256i high_vector_256bit = _mm256_setzero_si256();
+#endif
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 ) || defined( LIBEVTX_UTF16_STREAM_HAVE_SSE2 )
+	__m128i low_vector         = _mm_setzero_si128();
+	__m128i high_vector        = _mm_setzero_si128();
+
+#elif defined( LIBEVTX_UTF16_STREAM_HAVE_NEON )
+	uint16x8_t low_vector      = vdupq_n_u16( 0 );
+	uint16x8_t high_vector     = vdupq_n_u16( 0 );
+#endif
+	static char *function      = "libevtx_utf16_stream_copy_to_utf8_string";
+	size_t number_of_units     = 0;
+	size_t string_index        = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_utf16_stream_is_ascii(
+	     utf16_stream,
+	     utf16_stream_size ) == 0 )
+	{
+		if( libuna_utf8_string_copy_from_utf16_stream(
+		     utf8_string,
+		     utf8_string_size,
+		     utf16_stream,
+		     utf16_stream_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	number_of_units = utf16_stream_size / 2;
+
+	if( utf8_string_size <= number_of_units )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* All code units are less than 0x80 so narrowing with unsigned saturation is exact
+	 */
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 )
+	while( ( number_of_units - string_index ) >= 32 )
+	{
+		low_vector_256bit = _mm256_loadu_si256(
+		                     (const __m256i *) &( utf16_stream[ string_index * 2 ] ) );
+
+		high_vector_256bit = _mm256_loadu_si256(
+		                      (const __m256i *) &( utf16_stream[ ( string_index * 2 ) + 32 ] ) );
+
+		/* The AVX2 pack operates per 128-bit lane, which the permute restores to stream order
+		 */
+		_mm256_storeu_si256(
+		 (__m256i *) &( utf8_string[ string_index ] ),
+		 _mm256_permute4x64_epi64(
+		  _mm256_packus_epi16(
+		   low_vector_256bit,
+		   high_vector_256bit ),
+		  0xd8 ) );
+
+		string_index += 32;
+	}
+#endif
+#if defined( LIBEVTX_UTF16_STREAM_HAVE_AVX2 ) || defined( LIBEVTX_UTF16_STREAM_HAVE_SSE2 )
+	while( ( number_of_units - string_index ) >= 16 )
+	{
+		low_vector = _mm_loadu_si128(
+		              (const __m128i *) &( utf16_stream[ string_index * 2 ] ) );
+
+		high_vector = _mm_loadu_si128(
+		               (const __m128i *) &( utf16_stream[ ( string_index * 2 ) + 16 ] ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf8_string[ string_index ] ),
+		 _mm_packus_epi16(
+		  low_vector,
+		  high_vector ) );
+
+		string_index += 16;
+	}
+#elif defined( LIBEVTX_UTF16_STREAM_HAVE_NEON )
+	while( ( number_of_units - string_index ) >= 16 )
+	{
+		low_vector = vreinterpretq_u16_u8(
+		              vld1q_u8(
+		               &( utf16_stream[ string_index * 2 ] ) ) );
+
+		high_vector = vreinterpretq_u16_u8(
+		               vld1q_u8(
+		                &( utf16_stream[ ( string_index * 2 ) + 16 ] ) ) );
+
+		vst1q_u8(
+		 &( utf8_string[ string_index ] ),
+		 vcombine_u8(
+		  vmovn_u16(
+		   low_vector ),
+		  vmovn_u16(
+		   high_vector ) ) );
+
+		string_index += 16;
+	}
+#endif
+	while( string_index < number_of_units )
+	{
+		utf8_string[ string_index ] = utf16_stream[ string_index * 2 ];
+
+		string_index++;
+	}
+	utf8_string[ string_index ] = 0;
+
+	return( 1 );
+}
+
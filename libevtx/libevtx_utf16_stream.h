@@ -0,0 +1,70 @@
+/*
+ * UTF-16 stream conversion functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_UTF16_STREAM_H )
+#define _LIBEVTX_UTF16_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The vector instructions used to check and narrow ASCII strings, determined at compile time
+ */
+#if defined( __AVX2__ )
+#define LIBEVTX_UTF16_STREAM_HAVE_AVX2
+#endif
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEVTX_UTF16_STREAM_HAVE_SSE2
+#endif
+
+#if defined( __ARM_NEON ) && defined( __aarch64__ ) && !defined( __ARM_BIG_ENDIAN )
+#define LIBEVTX_UTF16_STREAM_HAVE_NEON
+#endif
+
+int libevtx_utf16_stream_is_ascii(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size );
+
+int libevtx_utf16_stream_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_utf16_stream_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_UTF16_STREAM_H ) */
+
@@ -0,0 +1,698 @@
+/*
+ * Value filter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+#include "libevtx_value_filter.h"
+
+/* Creates a value filter
+ * Make sure the value value_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_filter_initialize(
+     libevtx_value_filter_t **value_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_value_filter_initialize";
+
+	if( value_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*value_filter = memory_allocate_structure(
+	                 libevtx_value_filter_t );
+
+	if( *value_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *value_filter,
+	     0,
+	     sizeof( libevtx_value_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear value filter.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *value_filter != NULL )
+	{
+		memory_free(
+		 *value_filter );
+
+		*value_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a value filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_filter_free(
+     libevtx_value_filter_t **value_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_value_filter_free";
+
+	if( value_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_filter != NULL )
+	{
+		memory_free(
+		 *value_filter );
+
+		*value_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Case folds a character
+ * Only the ASCII, the Latin-1 and the basic Cyrillic upper case characters are folded
+ * Returns the folded character
+ */
+uint32_t libevtx_value_filter_fold_character(
+          uint32_t character )
+{
+	if( ( character >= (uint32_t) 'A' )
+	 && ( character <= (uint32_t) 'Z' ) )
+	{
+		return( character + (uint32_t) ( 'a' - 'A' ) );
+	}
+	if( ( character >= 0x000000c0UL )
+	 && ( character <= 0x000000deUL )
+	 && ( character != 0x000000d7UL ) )
+	{
+		return( character + 0x00000020UL );
+	}
+	if( ( character >= 0x00000400UL )
+	 && ( character <= 0x0000040fUL ) )
+	{
+		return( character + 0x00000050UL );
+	}
+	if( ( character >= 0x00000410UL )
+	 && ( character <= 0x0000042fUL ) )
+	{
+		return( character + 0x00000020UL );
+	}
+	return( character );
+}
+
+/* Determines if a character is part of a token
+ * The tokens of a value are separated by the ASCII characters other than letters, digits
+ * and the '$', '-', '.', '@' and '_' characters, so that user names, host names
+ * and IP addresses remain a single token
+ * Returns 1 if the character is part of a token or 0 if not
+ */
+int libevtx_value_filter_is_token_character(
+     uint32_t character )
+{
+	if( character >= 0x00000080UL )
+	{
+		return( 1 );
+	}
+	if( ( ( character >= (uint32_t) 'a' )
+	  &&  ( character <= (uint32_t) 'z' ) )
+	 || ( ( character >= (uint32_t) 'A' )
+	  &&  ( character <= (uint32_t) 'Z' ) )
+	 || ( ( character >= (uint32_t) '0' )
+	  &&  ( character <= (uint32_t) '9' ) ) )
+	{
+		return( 1 );
+	}
+	if( ( character == (uint32_t) '$' )
+	 || ( character == (uint32_t) '-' )
+	 || ( character == (uint32_t) '.' )
+	 || ( character == (uint32_t) '@' )
+	 || ( character == (uint32_t) '_' ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Adds a character to a 64-bit FNV-1a hash
+ * The initial hash value is 0xcbf29ce484222325
+ * Returns the hash
+ */
+uint64_t libevtx_value_filter_hash_character(
+          uint64_t hash,
+          uint32_t character )
+{
+	hash ^= (uint64_t) character;
+	hash *= (uint64_t) 0x00000100000001b3ULL;
+
+	return( hash );
+}
+
+/* Retrieves the next character of a string
+ * Returns 1 if successful or 0 if the string is not valid
+ */
+int libevtx_value_filter_get_character(
+     const uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     int string_type,
+     uint32_t *character )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	int result                                   = 0;
+
+	if( ( string == NULL )
+	 || ( string_index == NULL )
+	 || ( character == NULL ) )
+	{
+		return( 0 );
+	}
+	if( string_type == LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF16_STREAM )
+	{
+		result = libuna_unicode_character_copy_from_utf16_stream(
+		          &unicode_character,
+		          string,
+		          string_size,
+		          string_index,
+		          LIBUNA_ENDIAN_LITTLE,
+		          NULL );
+	}
+	else if( string_type == LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8 )
+	{
+		result = libuna_unicode_character_copy_from_utf8(
+		          &unicode_character,
+		          string,
+		          string_size,
+		          string_index,
+		          NULL );
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	*character = (uint32_t) unicode_character;
+
+	return( 1 );
+}
+
+/* Inserts a hash into the value filter
+ * The bits are derived from the hash by double hashing
+ */
+void libevtx_value_filter_insert_hash(
+      libevtx_value_filter_t *value_filter,
+      uint64_t hash )
+{
+	uint32_t bit_index   = 0;
+	uint32_t first_hash  = 0;
+	uint32_t second_hash = 0;
+	uint8_t hash_index   = 0;
+
+	if( value_filter == NULL )
+	{
+		return;
+	}
+	first_hash  = (uint32_t) ( hash & 0xffffffffUL );
+	second_hash = (uint32_t) ( hash >> 32 ) | 1;
+
+	for( hash_index = 0;
+	     hash_index < LIBEVTX_VALUE_FILTER_NUMBER_OF_HASHES;
+	     hash_index++ )
+	{
+		bit_index = ( first_hash + ( (uint32_t) hash_index * second_hash ) ) % ( LIBEVTX_VALUE_FILTER_DATA_SIZE * 8 );
+
+		value_filter->data[ bit_index / 8 ] |= (uint8_t) ( 1 << ( bit_index % 8 ) );
+	}
+}
+
+/* Determines if the value filter can contain a hash
+ * Returns 1 if the value filter can contain the hash or 0 if not
+ */
+int libevtx_value_filter_may_contain_hash(
+     libevtx_value_filter_t *value_filter,
+     uint64_t hash )
+{
+	uint32_t bit_index   = 0;
+	uint32_t first_hash  = 0;
+	uint32_t second_hash = 0;
+	uint8_t hash_index   = 0;
+
+	if( value_filter == NULL )
+	{
+		return( 1 );
+	}
+	first_hash  = (uint32_t) ( hash & 0xffffffffUL );
+	second_hash = (uint32_t) ( hash >> 32 ) | 1;
+
+	for( hash_index = 0;
+	     hash_index < LIBEVTX_VALUE_FILTER_NUMBER_OF_HASHES;
+	     hash_index++ )
+	{
+		bit_index = ( first_hash + ( (uint32_t) hash_index * second_hash ) ) % ( LIBEVTX_VALUE_FILTER_DATA_SIZE * 8 );
+
+		if( ( value_filter->data[ bit_index / 8 ] & (uint8_t) ( 1 << ( bit_index % 8 ) ) ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Inserts a value and the tokens of the value into the value filter
+ * The value should not contain an end of string character
+ * If the value is not a valid string every bit of the value filter is set
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_filter_insert_string(
+     libevtx_value_filter_t *value_filter,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_value_filter_insert_string";
+	size_t string_index   = 0;
+	size_t token_length   = 0;
+	uint64_t token_hash   = 0xcbf29ce484222325ULL;
+	uint64_t value_hash   = 0xcbf29ce484222325ULL;
+	uint32_t character    = 0;
+
+	if( value_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string == NULL )
+	 || ( string_size == 0 ) )
+	{
+		return( 1 );
+	}
+	while( string_index < string_size )
+	{
+		if( libevtx_value_filter_get_character(
+		     string,
+		     string_size,
+		     &string_index,
+		     string_type,
+		     &character ) != 1 )
+		{
+			/* The value filter cannot rule out any value of a string that cannot be read
+			 */
+			return( libevtx_value_filter_set_all(
+			         value_filter,
+			         error ) );
+		}
+		if( character == 0 )
+		{
+			break;
+		}
+		value_hash = libevtx_value_filter_hash_character(
+		              value_hash,
+		              libevtx_value_filter_fold_character(
+		               character ) );
+
+		if( libevtx_value_filter_is_token_character(
+		     character ) != 0 )
+		{
+			token_hash = libevtx_value_filter_hash_character(
+			              token_hash,
+			              libevtx_value_filter_fold_character(
+			               character ) );
+
+			token_length++;
+		}
+		else if( token_length > 0 )
+		{
+			libevtx_value_filter_insert_hash(
+			 value_filter,
+			 token_hash );
+
+			token_hash   = 0xcbf29ce484222325ULL;
+			token_length = 0;
+		}
+	}
+	if( token_length > 0 )
+	{
+		libevtx_value_filter_insert_hash(
+		 value_filter,
+		 token_hash );
+	}
+	if( string_index > 0 )
+	{
+		libevtx_value_filter_insert_hash(
+		 value_filter,
+		 value_hash );
+	}
+	return( 1 );
+}
+
+/* Sets every bit of the value filter, which can then not rule out any value
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_filter_set_all(
+     libevtx_value_filter_t *value_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_value_filter_set_all";
+
+	if( value_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     value_filter->data,
+	     0xff,
+	     LIBEVTX_VALUE_FILTER_DATA_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to set value filter data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the value filter can contain a match value
+ * Returns 1 if the value filter can contain the match value or 0 if not
+ */
+int libevtx_value_filter_may_contain_match_value(
+     libevtx_value_filter_t *value_filter,
+     libevtx_match_value_t *match_value )
+{
+	if( ( value_filter == NULL )
+	 || ( match_value == NULL ) )
+	{
+		return( 1 );
+	}
+	return( libevtx_value_filter_may_contain_hash(
+	         value_filter,
+	         match_value->hash ) );
+}
+
+/* Sets the match value from an UTF-8 string
+ * The characters of the string are case folded
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_match_value_set_utf8_string(
+     libevtx_match_value_t *match_value,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint32_t *characters        = NULL;
+	static char *function       = "libevtx_match_value_set_utf8_string";
+	size_t number_of_characters = 0;
+	size_t utf8_string_index    = 0;
+	uint64_t hash               = 0xcbf29ce484222325ULL;
+	uint32_t character          = 0;
+
+	if( match_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match value.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_value->characters != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid match value - characters value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( SSIZE_MAX / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of characters does not exceed the number of bytes of the string
+	 */
+	characters = (uint32_t *) memory_allocate(
+	                           sizeof( uint32_t ) * utf8_string_length );
+
+	if( characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create characters.",
+		 function );
+
+		goto on_error;
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libevtx_value_filter_get_character(
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8,
+		     &character ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( character == 0 )
+		{
+			break;
+		}
+		character = libevtx_value_filter_fold_character(
+		             character );
+
+		hash = libevtx_value_filter_hash_character(
+		        hash,
+		        character );
+
+		characters[ number_of_characters++ ] = character;
+	}
+	if( number_of_characters == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string value contains no characters.",
+		 function );
+
+		goto on_error;
+	}
+	match_value->characters           = characters;
+	match_value->number_of_characters = number_of_characters;
+	match_value->hash                 = hash;
+
+	return( 1 );
+
+on_error:
+	if( characters != NULL )
+	{
+		memory_free(
+		 characters );
+	}
+	return( -1 );
+}
+
+/* Determines if a value or one of the tokens of the value matches the match value
+ * The value should not contain an end of string character
+ * The comparison is case insensitive for the characters that are case folded
+ * Returns 1 if the value matches or 0 if not
+ */
+int libevtx_match_value_match_string(
+     libevtx_match_value_t *match_value,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type )
+{
+	size_t string_index   = 0;
+	size_t token_index    = 0;
+	size_t token_length   = 0;
+	size_t value_index    = 0;
+	uint32_t character    = 0;
+	uint8_t token_differs = 0;
+	uint8_t value_differs = 0;
+
+	if( ( match_value == NULL )
+	 || ( match_value->characters == NULL )
+	 || ( string == NULL ) )
+	{
+		return( 0 );
+	}
+	while( string_index < string_size )
+	{
+		if( libevtx_value_filter_get_character(
+		     string,
+		     string_size,
+		     &string_index,
+		     string_type,
+		     &character ) != 1 )
+		{
+			return( 0 );
+		}
+		if( character == 0 )
+		{
+			break;
+		}
+		if( libevtx_value_filter_is_token_character(
+		     character ) != 0 )
+		{
+			if( token_differs == 0 )
+			{
+				if( ( token_index < match_value->number_of_characters )
+				 && ( match_value->characters[ token_index ] == libevtx_value_filter_fold_character( character ) ) )
+				{
+					token_index++;
+				}
+				else
+				{
+					token_differs = 1;
+				}
+			}
+			token_length++;
+		}
+		else
+		{
+			if( ( token_length > 0 )
+			 && ( token_differs == 0 )
+			 && ( token_index == match_value->number_of_characters ) )
+			{
+				return( 1 );
+			}
+			token_index   = 0;
+			token_length  = 0;
+			token_differs = 0;
+		}
+		if( value_differs == 0 )
+		{
+			if( ( value_index < match_value->number_of_characters )
+			 && ( match_value->characters[ value_index ] == libevtx_value_filter_fold_character( character ) ) )
+			{
+				value_index++;
+			}
+			else
+			{
+				value_differs = 1;
+			}
+		}
+	}
+	if( ( token_length > 0 )
+	 && ( token_differs == 0 )
+	 && ( token_index == match_value->number_of_characters ) )
+	{
+		return( 1 );
+	}
+	if( ( value_differs == 0 )
+	 && ( value_index == match_value->number_of_characters ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,143 @@
+/*
+ * Value filter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_VALUE_FILTER_H )
+#define _LIBEVTX_VALUE_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the value filter data
+ * With 7 hashes the false positive rate is about 1% for 3400 values and tokens
+ */
+#define LIBEVTX_VALUE_FILTER_DATA_SIZE			4096
+
+/* The number of hashes (bits) per value in the value filter
+ */
+#define LIBEVTX_VALUE_FILTER_NUMBER_OF_HASHES		7
+
+/* The string types of the values
+ */
+enum LIBEVTX_VALUE_FILTER_STRING_TYPES
+{
+	LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8			= 1,
+	LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF16_STREAM		= 2
+};
+
+typedef struct libevtx_match_value libevtx_match_value_t;
+
+struct libevtx_match_value
+{
+	/* The case folded characters
+	 */
+	uint32_t *characters;
+
+	/* The number of characters
+	 */
+	size_t number_of_characters;
+
+	/* The hash of the case folded characters
+	 */
+	uint64_t hash;
+};
+
+typedef struct libevtx_value_filter libevtx_value_filter_t;
+
+struct libevtx_value_filter
+{
+	/* The data
+	 * Contains a Bloom filter of the case folded values and the tokens of the values
+	 */
+	uint8_t data[ LIBEVTX_VALUE_FILTER_DATA_SIZE ];
+};
+
+int libevtx_value_filter_initialize(
+     libevtx_value_filter_t **value_filter,
+     libcerror_error_t **error );
+
+int libevtx_value_filter_free(
+     libevtx_value_filter_t **value_filter,
+     libcerror_error_t **error );
+
+uint32_t libevtx_value_filter_fold_character(
+          uint32_t character );
+
+int libevtx_value_filter_is_token_character(
+     uint32_t character );
+
+uint64_t libevtx_value_filter_hash_character(
+          uint64_t hash,
+          uint32_t character );
+
+int libevtx_value_filter_get_character(
+     const uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     int string_type,
+     uint32_t *character );
+
+void libevtx_value_filter_insert_hash(
+      libevtx_value_filter_t *value_filter,
+      uint64_t hash );
+
+int libevtx_value_filter_may_contain_hash(
+     libevtx_value_filter_t *value_filter,
+     uint64_t hash );
+
+int libevtx_value_filter_insert_string(
+     libevtx_value_filter_t *value_filter,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type,
+     libcerror_error_t **error );
+
+int libevtx_value_filter_set_all(
+     libevtx_value_filter_t *value_filter,
+     libcerror_error_t **error );
+
+int libevtx_value_filter_may_contain_match_value(
+     libevtx_value_filter_t *value_filter,
+     libevtx_match_value_t *match_value );
+
+int libevtx_match_value_set_utf8_string(
+     libevtx_match_value_t *match_value,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libevtx_match_value_match_string(
+     libevtx_match_value_t *match_value,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_VALUE_FILTER_H ) */
+
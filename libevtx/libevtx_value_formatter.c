@@ -0,0 +1,811 @@
+/*
+ * Value formatter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_value_formatter.h"
+
+/* The decimal digits of the values 0 to 99, used to emit two digits at a time
+ */
+static const char libevtx_value_formatter_decimal_digit_pairs[ 201 ] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static const char libevtx_value_formatter_lower_case_hexadecimal_digits[ 17 ] =
+	"0123456789abcdef";
+
+static const char libevtx_value_formatter_upper_case_hexadecimal_digits[ 17 ] =
+	"0123456789ABCDEF";
+
+/* The order of the bytes of the little-endian GUID in the string
+ * where 0xff represents a separator
+ */
+static const uint8_t libevtx_value_formatter_guid_byte_order[ 20 ] = {
+	3, 2, 1, 0, 0xff, 5, 4, 0xff, 7, 6, 0xff, 8, 9, 0xff, 10, 11, 12, 13, 14, 15 };
+
+/* Copies a value as a fixed width decimal string, padded with leading zeros
+ * The string must be able to contain number of digits characters
+ */
+void libevtx_value_formatter_copy_fixed_width_decimal(
+     uint64_t value_64bit,
+     int number_of_digits,
+     uint8_t *string )
+{
+	uint8_t pair_index = 0;
+
+	while( number_of_digits >= 2 )
+	{
+		pair_index = (uint8_t) ( ( value_64bit % 100 ) * 2 );
+
+		string[ --number_of_digits ] = (uint8_t) libevtx_value_formatter_decimal_digit_pairs[ pair_index + 1 ];
+		string[ --number_of_digits ] = (uint8_t) libevtx_value_formatter_decimal_digit_pairs[ pair_index ];
+
+		value_64bit /= 100;
+	}
+	if( number_of_digits == 1 )
+	{
+		string[ 0 ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
+	}
+}
+
+/* Checks the UTF-8 string arguments of the formatter functions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_formatter_check_utf8_string(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     size_t required_size,
+     const char *function,
+     libcerror_error_t **error )
+{
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *utf8_string_index > utf8_string_size )
+	 || ( required_size > ( utf8_string_size - *utf8_string_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an integer to an UTF-8 string as a decimal value
+ * No end of string character is added, the UTF-8 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_formatter_copy_integer_to_utf8_string(
+     uint64_t value_64bit,
+     uint8_t is_signed,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	uint8_t string[ LIBEVTX_VALUE_FORMATTER_INTEGER_STRING_SIZE ];
+
+	static char *function = "libevtx_value_formatter_copy_integer_to_utf8_string";
+	size_t string_index   = LIBEVTX_VALUE_FORMATTER_INTEGER_STRING_SIZE;
+	uint8_t is_negative   = 0;
+	uint8_t pair_index    = 0;
+
+	if( ( is_signed != 0 )
+	 && ( (int64_t) value_64bit < 0 ) )
+	{
+		is_negative = 1;
+		value_64bit = ~( value_64bit ) + 1;
+	}
+	while( value_64bit >= 100 )
+	{
+		pair_index = (uint8_t) ( ( value_64bit % 100 ) * 2 );
+
+		string[ --string_index ] = (uint8_t) libevtx_value_formatter_decimal_digit_pairs[ pair_index + 1 ];
+		string[ --string_index ] = (uint8_t) libevtx_value_formatter_decimal_digit_pairs[ pair_index ];
+
+		value_64bit /= 100;
+	}
+	if( value_64bit >= 10 )
+	{
+		pair_index = (uint8_t) ( value_64bit * 2 );
+
+		string[ --string_index ] = (uint8_t) libevtx_value_formatter_decimal_digit_pairs[ pair_index + 1 ];
+		string[ --string_index ] = (uint8_t) libevtx_value_formatter_decimal_digit_pairs[ pair_index ];
+	}
+	else
+	{
+		string[ --string_index ] = (uint8_t) '0' + (uint8_t) value_64bit;
+	}
+	if( is_negative != 0 )
+	{
+		string[ --string_index ] = (uint8_t) '-';
+	}
+	if( libevtx_value_formatter_check_utf8_string(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     LIBEVTX_VALUE_FORMATTER_INTEGER_STRING_SIZE - string_index,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( utf8_string[ *utf8_string_index ] ),
+	     &( string[ string_index ] ),
+	     LIBEVTX_VALUE_FORMATTER_INTEGER_STRING_SIZE - string_index ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy integer string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_index += LIBEVTX_VALUE_FORMATTER_INTEGER_STRING_SIZE - string_index;
+
+	return( 1 );
+}
+
+/* Copies an integer to an UTF-8 string as a lower case hexadecimal value prefixed by 0x
+ * The value is padded with leading zeros to the number of digits
+ * No end of string character is added, the UTF-8 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+     uint64_t value_64bit,
+     int number_of_digits,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_value_formatter_copy_hexadecimal_to_utf8_string";
+	size_t string_index   = 0;
+	int digit_index       = 0;
+
+	if( ( number_of_digits <= 0 )
+	 || ( number_of_digits > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of digits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_value_formatter_check_utf8_string(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     (size_t) number_of_digits + 2,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	string_index = *utf8_string_index;
+
+	utf8_string[ string_index++ ] = (uint8_t) '0';
+	utf8_string[ string_index++ ] = (uint8_t) 'x';
+
+	for( digit_index = number_of_digits - 1;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		utf8_string[ string_index + digit_index ] = (uint8_t) libevtx_value_formatter_lower_case_hexadecimal_digits[ value_64bit & 0x0f ];
+
+		value_64bit >>= 4;
+	}
+	*utf8_string_index = string_index + number_of_digits;
+
+	return( 1 );
+}
+
+/* Copies a boolean to an UTF-8 string as true or false
+ * No end of string character is added, the UTF-8 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_formatter_copy_boolean_to_utf8_string(
+     uint32_t value_32bit,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	const char *boolean_string = "false";
+	static char *function      = "libevtx_value_formatter_copy_boolean_to_utf8_string";
+	size_t boolean_string_size = 5;
+
+	if( value_32bit != 0 )
+	{
+		boolean_string      = "true";
+		boolean_string_size = 4;
+	}
+	if( libevtx_value_formatter_check_utf8_string(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     boolean_string_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( utf8_string[ *utf8_string_index ] ),
+	     boolean_string,
+	     boolean_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy boolean string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_index += boolean_string_size;
+
+	return( 1 );
+}
+
+/* Copies a little-endian GUID to an UTF-8 string
+ * The GUID is formatted in upper case and surrounded by braces
+ * No end of string character is added, the UTF-8 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_value_formatter_copy_guid_to_utf8_string(
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_value_formatter_copy_guid_to_utf8_string";
+	size_t string_index   = 0;
+	uint8_t byte_index    = 0;
+	uint8_t byte_value    = 0;
+	int order_index       = 0;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_value_formatter_check_utf8_string(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     LIBEVTX_VALUE_FORMATTER_GUID_STRING_SIZE,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	string_index = *utf8_string_index;
+
+	utf8_string[ string_index++ ] = (uint8_t) '{';
+
+	for( order_index = 0;
+	     order_index < 20;
+	     order_index++ )
+	{
+		byte_index = libevtx_value_formatter_guid_byte_order[ order_index ];
+
+		if( byte_index == 0xff )
+		{
+			utf8_string[ string_index++ ] = (uint8_t) '-';
+		}
+		else
+		{
+			byte_value = guid_data[ byte_index ];
+
+			utf8_string[ string_index++ ] = (uint8_t) libevtx_value_formatter_upper_case_hexadecimal_digits[ byte_value >> 4 ];
+			utf8_string[ string_index++ ] = (uint8_t) libevtx_value_formatter_upper_case_hexadecimal_digits[ byte_value & 0x0f ];
+		}
+	}
+	utf8_string[ string_index++ ] = (uint8_t) '}';
+
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Copies a NT security identifier (SID) to an UTF-8 string
+ * The SID consists of the revision number, the number of sub authorities,
+ * the 48-bit big-endian authority and the 32-bit little-endian sub authorities
+ * No end of string character is added, the UTF-8 string index is advanced
+ * Returns 1 if successful, 0 if the SID data is not supported or -1 on error
+ */
+int libevtx_value_formatter_copy_sid_to_utf8_string(
+     const uint8_t *sid_data,
+     size_t sid_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	uint8_t string[ LIBEVTX_VALUE_FORMATTER_MAXIMUM_SID_STRING_SIZE ];
+
+	static char *function             = "libevtx_value_formatter_copy_sid_to_utf8_string";
+	size_t string_index               = 0;
+	uint64_t authority                = 0;
+	uint32_t sub_authority            = 0;
+	uint16_t authority_upper          = 0;
+	uint8_t number_of_sub_authorities = 0;
+	uint8_t sub_authority_index       = 0;
+
+	if( sid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sid_data_size < 8 )
+	{
+		return( 0 );
+	}
+	number_of_sub_authorities = sid_data[ 1 ];
+
+	if( ( number_of_sub_authorities > LIBEVTX_VALUE_FORMATTER_MAXIMUM_NUMBER_OF_SUB_AUTHORITIES )
+	 || ( sid_data_size != ( 8 + ( (size_t) number_of_sub_authorities * 4 ) ) ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( sid_data[ 2 ] ),
+	 authority_upper );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( sid_data[ 4 ] ),
+	 sub_authority );
+
+	authority = ( (uint64_t) authority_upper << 32 ) | sub_authority;
+
+	string[ string_index++ ] = (uint8_t) 'S';
+	string[ string_index++ ] = (uint8_t) '-';
+
+	if( libevtx_value_formatter_copy_integer_to_utf8_string(
+	     (uint64_t) sid_data[ 0 ],
+	     0,
+	     string,
+	     LIBEVTX_VALUE_FORMATTER_MAXIMUM_SID_STRING_SIZE,
+	     &string_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	string[ string_index++ ] = (uint8_t) '-';
+
+	if( libevtx_value_formatter_copy_integer_to_utf8_string(
+	     authority,
+	     0,
+	     string,
+	     LIBEVTX_VALUE_FORMATTER_MAXIMUM_SID_STRING_SIZE,
+	     &string_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( sub_authority_index = 0;
+	     sub_authority_index < number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( sid_data[ 8 + ( (size_t) sub_authority_index * 4 ) ] ),
+		 sub_authority );
+
+		string[ string_index++ ] = (uint8_t) '-';
+
+		if( libevtx_value_formatter_copy_integer_to_utf8_string(
+		     (uint64_t) sub_authority,
+		     0,
+		     string,
+		     LIBEVTX_VALUE_FORMATTER_MAXIMUM_SID_STRING_SIZE,
+		     &string_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libevtx_value_formatter_check_utf8_string(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     string_index,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( utf8_string[ *utf8_string_index ] ),
+	     string,
+	     string_index ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy SID string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_index += string_index;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+	 "%s: unable to copy SID component to string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Copies a FILETIME to an UTF-8 string as an ISO 8601 date and time with a nano seconds fraction
+ * No end of string character is added, the UTF-8 string index is advanced
+ * Returns 1 if successful, 0 if the FILETIME is not supported or -1 on error
+ */
+int libevtx_value_formatter_copy_filetime_to_utf8_string(
+     uint64_t filetime,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "libevtx_value_formatter_copy_filetime_to_utf8_string";
+	uint8_t *string         = NULL;
+	uint64_t number_of_days = 0;
+	uint64_t nano_seconds   = 0;
+	uint64_t seconds        = 0;
+	uint32_t day_of_era     = 0;
+	uint32_t day_of_month   = 0;
+	uint32_t day_of_year    = 0;
+	uint32_t era            = 0;
+	uint32_t month          = 0;
+	uint32_t month_index    = 0;
+	uint32_t year           = 0;
+	uint32_t year_of_era    = 0;
+
+	if( libevtx_value_formatter_check_utf8_string(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     LIBEVTX_VALUE_FORMATTER_FILETIME_STRING_SIZE,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	/* The formatted year only supports 4 digits
+	 */
+	if( filetime >= LIBEVTX_VALUE_FORMATTER_MAXIMUM_FILETIME )
+	{
+		return( 0 );
+	}
+	/* The FILETIME contains the number of 100th nano seconds since January 1, 1601
+	 */
+	nano_seconds   = ( filetime % 10000000 ) * 100;
+	seconds        = filetime / 10000000;
+	number_of_days = seconds / 86400;
+	seconds       %= 86400;
+
+	/* Determine the date from the number of days relative to March 1, 1600
+	 * which is the start of a 400 year era
+	 */
+	number_of_days += 306;
+
+	era          = (uint32_t) ( number_of_days / 146097 );
+	day_of_era   = (uint32_t) ( number_of_days % 146097 );
+	year_of_era  = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year  = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+	month_index  = ( ( 5 * day_of_year ) + 2 ) / 153;
+	day_of_month = day_of_year - ( ( ( 153 * month_index ) + 2 ) / 5 ) + 1;
+	month        = ( month_index < 10 ) ? month_index + 3 : month_index - 9;
+	year         = 1600 + year_of_era + ( era * 400 );
+
+	if( month <= 2 )
+	{
+		year += 1;
+	}
+	string = &( utf8_string[ *utf8_string_index ] );
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) year,
+	 4,
+	 &( string[ 0 ] ) );
+
+	string[ 4 ] = (uint8_t) '-';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) month,
+	 2,
+	 &( string[ 5 ] ) );
+
+	string[ 7 ] = (uint8_t) '-';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) day_of_month,
+	 2,
+	 &( string[ 8 ] ) );
+
+	string[ 10 ] = (uint8_t) 'T';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 seconds / 3600,
+	 2,
+	 &( string[ 11 ] ) );
+
+	string[ 13 ] = (uint8_t) ':';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 ( seconds % 3600 ) / 60,
+	 2,
+	 &( string[ 14 ] ) );
+
+	string[ 16 ] = (uint8_t) ':';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 seconds % 60,
+	 2,
+	 &( string[ 17 ] ) );
+
+	string[ 19 ] = (uint8_t) '.';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 nano_seconds,
+	 9,
+	 &( string[ 20 ] ) );
+
+	string[ 29 ] = (uint8_t) 'Z';
+
+	*utf8_string_index += LIBEVTX_VALUE_FORMATTER_FILETIME_STRING_SIZE;
+
+	return( 1 );
+}
+
+/* Copies a SYSTEMTIME to an UTF-8 string as an ISO 8601 date and time with a milli seconds fraction
+ * The SYSTEMTIME consists of the 16-bit little-endian year, month, day of week, day of month,
+ * hours, minutes, seconds and milli seconds
+ * No end of string character is added, the UTF-8 string index is advanced
+ * Returns 1 if successful, 0 if the SYSTEMTIME data is not supported or -1 on error
+ */
+int libevtx_value_formatter_copy_systemtime_to_utf8_string(
+     const uint8_t *systemtime_data,
+     size_t systemtime_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function  = "libevtx_value_formatter_copy_systemtime_to_utf8_string";
+	uint8_t *string        = NULL;
+	uint16_t day_of_month  = 0;
+	uint16_t hours         = 0;
+	uint16_t milli_seconds = 0;
+	uint16_t minutes       = 0;
+	uint16_t month         = 0;
+	uint16_t seconds       = 0;
+	uint16_t year          = 0;
+
+	if( systemtime_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SYSTEMTIME data.",
+		 function );
+
+		return( -1 );
+	}
+	if( systemtime_data_size != 16 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( systemtime_data[ 0 ] ),
+	 year );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( systemtime_data[ 2 ] ),
+	 month );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( systemtime_data[ 6 ] ),
+	 day_of_month );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( systemtime_data[ 8 ] ),
+	 hours );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( systemtime_data[ 10 ] ),
+	 minutes );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( systemtime_data[ 12 ] ),
+	 seconds );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( systemtime_data[ 14 ] ),
+	 milli_seconds );
+
+	if( ( year > 9999 )
+	 || ( month < 1 )
+	 || ( month > 12 )
+	 || ( day_of_month < 1 )
+	 || ( day_of_month > 31 )
+	 || ( hours > 23 )
+	 || ( minutes > 59 )
+	 || ( seconds > 59 )
+	 || ( milli_seconds > 999 ) )
+	{
+		return( 0 );
+	}
+	if( libevtx_value_formatter_check_utf8_string(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     LIBEVTX_VALUE_FORMATTER_SYSTEMTIME_STRING_SIZE,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	string = &( utf8_string[ *utf8_string_index ] );
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) year,
+	 4,
+	 &( string[ 0 ] ) );
+
+	string[ 4 ] = (uint8_t) '-';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) month,
+	 2,
+	 &( string[ 5 ] ) );
+
+	string[ 7 ] = (uint8_t) '-';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) day_of_month,
+	 2,
+	 &( string[ 8 ] ) );
+
+	string[ 10 ] = (uint8_t) 'T';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) hours,
+	 2,
+	 &( string[ 11 ] ) );
+
+	string[ 13 ] = (uint8_t) ':';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) minutes,
+	 2,
+	 &( string[ 14 ] ) );
+
+	string[ 16 ] = (uint8_t) ':';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) seconds,
+	 2,
+	 &( string[ 17 ] ) );
+
+	string[ 19 ] = (uint8_t) '.';
+
+	libevtx_value_formatter_copy_fixed_width_decimal(
+	 (uint64_t) milli_seconds,
+	 3,
+	 &( string[ 20 ] ) );
+
+	string[ 23 ] = (uint8_t) 'Z';
+
+	*utf8_string_index += LIBEVTX_VALUE_FORMATTER_SYSTEMTIME_STRING_SIZE;
+
+	return( 1 );
+}
+
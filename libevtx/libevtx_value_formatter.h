@@ -0,0 +1,136 @@
+/*
+ * Value formatter functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_VALUE_FORMATTER_H )
+#define _LIBEVTX_VALUE_FORMATTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a formatted integer, which is a signed 64-bit decimal value
+ */
+#define LIBEVTX_VALUE_FORMATTER_INTEGER_STRING_SIZE	20
+
+/* The size of a formatted GUID, which is surrounded by braces
+ */
+#define LIBEVTX_VALUE_FORMATTER_GUID_STRING_SIZE	38
+
+/* The size of a formatted FILETIME, which has a nano seconds fraction
+ */
+#define LIBEVTX_VALUE_FORMATTER_FILETIME_STRING_SIZE	30
+
+/* The first FILETIME that cannot be formatted, which is January 1, 10000
+ * since the formatted year consists of 4 digits
+ */
+#define LIBEVTX_VALUE_FORMATTER_MAXIMUM_FILETIME	0x24c85a5ed1c04000ULL
+
+/* The size of a formatted SYSTEMTIME, which has a milli seconds fraction
+ */
+#define LIBEVTX_VALUE_FORMATTER_SYSTEMTIME_STRING_SIZE	24
+
+/* The maximum number of sub authorities of a SID that is formatted
+ */
+#define LIBEVTX_VALUE_FORMATTER_MAXIMUM_NUMBER_OF_SUB_AUTHORITIES	15
+
+/* The maximum size of a formatted SID
+ * S-, the revision number, the 48-bit authority and 15 sub authorities of a separator and 10 digits
+ */
+#define LIBEVTX_VALUE_FORMATTER_MAXIMUM_SID_STRING_SIZE	187
+
+void libevtx_value_formatter_copy_fixed_width_decimal(
+     uint64_t value_64bit,
+     int number_of_digits,
+     uint8_t *string );
+
+int libevtx_value_formatter_check_utf8_string(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     size_t required_size,
+     const char *function,
+     libcerror_error_t **error );
+
+int libevtx_value_formatter_copy_integer_to_utf8_string(
+     uint64_t value_64bit,
+     uint8_t is_signed,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+     uint64_t value_64bit,
+     int number_of_digits,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libevtx_value_formatter_copy_boolean_to_utf8_string(
+     uint32_t value_32bit,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libevtx_value_formatter_copy_guid_to_utf8_string(
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libevtx_value_formatter_copy_sid_to_utf8_string(
+     const uint8_t *sid_data,
+     size_t sid_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libevtx_value_formatter_copy_filetime_to_utf8_string(
+     uint64_t filetime,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libevtx_value_formatter_copy_systemtime_to_utf8_string(
+     const uint8_t *systemtime_data,
+     size_t systemtime_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_VALUE_FORMATTER_H ) */
+
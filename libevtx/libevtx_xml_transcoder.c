@@ -0,0 +1,2109 @@
+/*
+ * Binary XML to XML string transcoder functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_codepage_table.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+#include "libevtx_probes.h"
+#include "libevtx_system_values.h"
+#include "libevtx_value_formatter.h"
+#include "libevtx_xml_transcoder.h"
+
+#include "evtx_event_record.h"
+
+/* Creates a XML transcoder
+ * Make sure the value xml_transcoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_xml_transcoder_initialize(
+     libevtx_xml_transcoder_t **xml_transcoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_xml_transcoder_initialize";
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_transcoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML transcoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*xml_transcoder = memory_allocate_structure(
+	                   libevtx_xml_transcoder_t );
+
+	if( *xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XML transcoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *xml_transcoder,
+	     0,
+	     sizeof( libevtx_xml_transcoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XML transcoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *xml_transcoder != NULL )
+	{
+		memory_free(
+		 *xml_transcoder );
+
+		*xml_transcoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a XML transcoder
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_xml_transcoder_free(
+     libevtx_xml_transcoder_t **xml_transcoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_xml_transcoder_free";
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_transcoder != NULL )
+	{
+		if( ( *xml_transcoder )->string != NULL )
+		{
+			memory_free(
+			 ( *xml_transcoder )->string );
+		}
+		memory_free(
+		 *xml_transcoder );
+
+		*xml_transcoder = NULL;
+	}
+	return( 1 );
+}
+
+/* Transcodes the binary XML of a record into an UTF-8 encoded XML string without creating an XML document
+ * On success the string contains the XML string including the end of string character
+ * Returns 1 if successful, 0 if the record data is not supported or -1 on error
+ */
+int libevtx_xml_transcoder_transcode_record(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libevtx_xml_transcoder_transcode_record";
+	size_t chunk_data_offset  = 0;
+	size_t end_of_data_offset = 0;
+	int result                = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_offset >= chunk_data_size )
+	 || ( record_data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
+	 || ( record_data_size > ( chunk_data_size - record_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	xml_transcoder->chunk_data      = chunk_data;
+	xml_transcoder->chunk_data_size = chunk_data_size;
+	xml_transcoder->string_size     = 0;
+
+	chunk_data_offset  = record_data_offset + sizeof( evtx_event_record_header_t );
+	end_of_data_offset = record_data_offset + record_data_size - 4;
+
+	result = libevtx_xml_transcoder_read_fragment(
+	          xml_transcoder,
+	          &chunk_data_offset,
+	          end_of_data_offset,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fragment.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libevtx_xml_transcoder_append(
+		     xml_transcoder,
+		     (uint8_t *) "",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of string character.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	xml_transcoder->chunk_data      = NULL;
+	xml_transcoder->chunk_data_size = 0;
+
+	return( result );
+
+on_error:
+	xml_transcoder->chunk_data      = NULL;
+	xml_transcoder->chunk_data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads a binary XML fragment
+ * The fragment consists of a fragment header followed by a template instance or an element
+ * Returns 1 if successful, 0 if the fragment is not supported or -1 on error
+ */
+int libevtx_xml_transcoder_read_fragment(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error )
+{
+	static char *function         = "libevtx_xml_transcoder_read_fragment";
+	size_t safe_chunk_data_offset = 0;
+	uint8_t token                 = 0;
+	int result                    = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > xml_transcoder->chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_depth >= LIBEVTX_XML_TRANSCODER_MAXIMUM_DEPTH )
+	{
+		return( 0 );
+	}
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	/* The fragment header consists of the token, major and minor version and flags
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 5 )
+	 || ( xml_transcoder->chunk_data[ safe_chunk_data_offset ] != LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER ) )
+	{
+		return( 0 );
+	}
+	safe_chunk_data_offset += 4;
+
+	token = xml_transcoder->chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+	if( token == LIBEVTX_BINARY_XML_TOKEN_TEMPLATE_INSTANCE )
+	{
+		result = libevtx_xml_transcoder_read_template_instance(
+		          xml_transcoder,
+		          &safe_chunk_data_offset,
+		          end_of_data_offset,
+		          element_depth,
+		          error );
+	}
+	else if( token == LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	{
+		result = libevtx_xml_transcoder_read_element(
+		          xml_transcoder,
+		          NULL,
+		          &safe_chunk_data_offset,
+		          end_of_data_offset,
+		          element_depth,
+		          error );
+	}
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read fragment content.",
+			 function );
+		}
+		return( result );
+	}
+	if( ( safe_chunk_data_offset < end_of_data_offset )
+	 && ( xml_transcoder->chunk_data[ safe_chunk_data_offset ] == LIBEVTX_BINARY_XML_TOKEN_END_OF_FILE ) )
+	{
+		safe_chunk_data_offset += 1;
+	}
+	*chunk_data_offset = safe_chunk_data_offset;
+
+	return( 1 );
+}
+
+/* Reads a binary XML template instance
+ * The template definition is transcoded using the substitution values of the template instance
+ * Returns 1 if successful, 0 if the template instance is not supported or -1 on error
+ */
+int libevtx_xml_transcoder_read_template_instance(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error )
+{
+	libevtx_xml_transcoder_substitutions_t substitutions;
+
+	const uint8_t *chunk_data           = NULL;
+	static char *function               = "libevtx_xml_transcoder_read_template_instance";
+	size_t safe_chunk_data_offset       = 0;
+	size_t template_data_offset         = 0;
+	size_t template_end_offset          = 0;
+	size_t value_data_offset            = 0;
+	uint32_t template_data_size         = 0;
+	uint32_t template_definition_offset = 0;
+	uint32_t value_index                = 0;
+	uint16_t value_data_size            = 0;
+	int result                          = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > xml_transcoder->chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data             = xml_transcoder->chunk_data;
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	/* The template instance consists of the token, an unknown value,
+	 * the template identifier and the template definition offset
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 10 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 6 ] ),
+	 template_definition_offset );
+
+	safe_chunk_data_offset += 10;
+
+	/* The template definition header consists of the next template definition offset,
+	 * the template identifier and the template data size
+	 */
+	if( ( (size_t) template_definition_offset >= xml_transcoder->chunk_data_size )
+	 || ( ( xml_transcoder->chunk_data_size - template_definition_offset ) < 24 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ template_definition_offset + 20 ] ),
+	 template_data_size );
+
+	template_data_offset = (size_t) template_definition_offset + 24;
+
+	if( (size_t) template_data_size > ( xml_transcoder->chunk_data_size - template_data_offset ) )
+	{
+		return( 0 );
+	}
+	template_end_offset = template_data_offset + template_data_size;
+
+	/* The template definition is stored in the record data the first time it is used in the chunk
+	 */
+	if( (size_t) template_definition_offset == safe_chunk_data_offset )
+	{
+		if( template_end_offset > end_of_data_offset )
+		{
+			return( 0 );
+		}
+		safe_chunk_data_offset = template_end_offset;
+	}
+	/* The substitution values consist of the number of values, a size and type
+	 * descriptor per value and the value data
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 4 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset ] ),
+	 substitutions.number_of_values );
+
+	safe_chunk_data_offset += 4;
+
+	if( (size_t) substitutions.number_of_values > ( ( end_of_data_offset - safe_chunk_data_offset ) / 4 ) )
+	{
+		return( 0 );
+	}
+	substitutions.descriptors_offset = safe_chunk_data_offset;
+	substitutions.values_offset      = safe_chunk_data_offset + ( (size_t) substitutions.number_of_values * 4 );
+
+	LIBEVTX_PROBE_TEMPLATE_PARSE(
+	 template_definition_offset,
+	 template_data_size,
+	 substitutions.number_of_values );
+
+	value_data_offset = substitutions.values_offset;
+
+	for( value_index = 0;
+	     value_index < substitutions.number_of_values;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( chunk_data[ substitutions.descriptors_offset + ( (size_t) value_index * 4 ) ] ),
+		 value_data_size );
+
+		if( (size_t) value_data_size > ( end_of_data_offset - value_data_offset ) )
+		{
+			return( 0 );
+		}
+		value_data_offset += value_data_size;
+	}
+	if( ( ( template_end_offset - template_data_offset ) < 4 )
+	 || ( chunk_data[ template_data_offset ] != LIBEVTX_BINARY_XML_TOKEN_FRAGMENT_HEADER ) )
+	{
+		return( 0 );
+	}
+	template_data_offset += 4;
+
+	result = libevtx_xml_transcoder_read_element(
+	          xml_transcoder,
+	          &substitutions,
+	          &template_data_offset,
+	          template_end_offset,
+	          element_depth,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read template definition root element.",
+			 function );
+		}
+		return( result );
+	}
+	*chunk_data_offset = value_data_offset;
+
+	return( 1 );
+}
+
+/* Reads a binary XML element and appends it to the XML string
+ * Elements with mixed content, character and entity references, CDATA sections
+ * or processing instructions are not supported
+ * Returns 1 if successful, 0 if the element is not supported or -1 on error
+ */
+int libevtx_xml_transcoder_read_element(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     libevtx_xml_transcoder_substitutions_t *substitutions,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error )
+{
+	const uint8_t *attribute_name_data = NULL;
+	const uint8_t *chunk_data          = NULL;
+	const uint8_t *name_data           = NULL;
+	static char *function              = "libevtx_xml_transcoder_read_element";
+	size_t attribute_name_data_size    = 0;
+	size_t attributes_end_offset       = 0;
+	size_t element_end_offset          = 0;
+	size_t name_data_size              = 0;
+	size_t name_offset                 = 0;
+	size_t safe_chunk_data_offset      = 0;
+	size_t value_data_offset           = 0;
+	size_t value_data_size             = 0;
+	uint32_t attributes_data_size      = 0;
+	uint32_t element_data_size         = 0;
+	uint32_t element_name_offset       = 0;
+	uint8_t content_type               = 0;
+	uint8_t element_token              = 0;
+	uint8_t token                      = 0;
+	uint8_t value_type                 = 0;
+	int result                         = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > xml_transcoder->chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_depth >= LIBEVTX_XML_TRANSCODER_MAXIMUM_DEPTH )
+	{
+		return( 0 );
+	}
+	chunk_data             = xml_transcoder->chunk_data;
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	/* The open start element tag consists of the token, dependency identifier,
+	 * element data size and element name offset
+	 */
+	if( ( safe_chunk_data_offset >= end_of_data_offset )
+	 || ( ( end_of_data_offset - safe_chunk_data_offset ) < 11 ) )
+	{
+		return( 0 );
+	}
+	element_token = chunk_data[ safe_chunk_data_offset ];
+
+	if( ( element_token & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA ) ) != LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 3 ] ),
+	 element_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 7 ] ),
+	 element_name_offset );
+
+	if( (size_t) element_data_size > ( end_of_data_offset - ( safe_chunk_data_offset + 7 ) ) )
+	{
+		return( 0 );
+	}
+	element_end_offset      = safe_chunk_data_offset + 7 + element_data_size;
+	safe_chunk_data_offset += 11;
+
+	if( (size_t) element_name_offset == safe_chunk_data_offset )
+	{
+		result = libevtx_system_values_read_name(
+		          chunk_data,
+		          element_end_offset,
+		          &safe_chunk_data_offset,
+		          &name_data,
+		          &name_data_size,
+		          error );
+	}
+	else
+	{
+		name_offset = (size_t) element_name_offset;
+
+		result = libevtx_system_values_read_name(
+		          chunk_data,
+		          xml_transcoder->chunk_data_size,
+		          &name_offset,
+		          &name_data,
+		          &name_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element name.",
+			 function );
+		}
+		return( result );
+	}
+	if( libevtx_xml_transcoder_append_indentation(
+	     xml_transcoder,
+	     element_depth,
+	     error ) != 1 )
+	{
+		goto on_append_error;
+	}
+	if( libevtx_xml_transcoder_append(
+	     xml_transcoder,
+	     (uint8_t *) "<",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_append_error;
+	}
+	result = libevtx_xml_transcoder_append_utf16_stream(
+	          xml_transcoder,
+	          name_data,
+	          name_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			goto on_append_error;
+		}
+		return( 0 );
+	}
+	if( ( element_token & LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA ) != 0 )
+	{
+		if( ( element_end_offset - safe_chunk_data_offset ) < 4 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chunk_data[ safe_chunk_data_offset ] ),
+		 attributes_data_size );
+
+		safe_chunk_data_offset += 4;
+
+		if( (size_t) attributes_data_size > ( element_end_offset - safe_chunk_data_offset ) )
+		{
+			return( 0 );
+		}
+		attributes_end_offset = safe_chunk_data_offset + attributes_data_size;
+
+		while( safe_chunk_data_offset < attributes_end_offset )
+		{
+			/* The attribute consists of the token and the attribute name offset
+			 */
+			if( ( attributes_end_offset - safe_chunk_data_offset ) < 5 )
+			{
+				return( 0 );
+			}
+			token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+			if( token != LIBEVTX_BINARY_XML_TOKEN_ATTRIBUTE )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+			 element_name_offset );
+
+			safe_chunk_data_offset += 5;
+
+			if( (size_t) element_name_offset == safe_chunk_data_offset )
+			{
+				result = libevtx_system_values_read_name(
+				          chunk_data,
+				          attributes_end_offset,
+				          &safe_chunk_data_offset,
+				          &attribute_name_data,
+				          &attribute_name_data_size,
+				          error );
+			}
+			else
+			{
+				name_offset = (size_t) element_name_offset;
+
+				result = libevtx_system_values_read_name(
+				          chunk_data,
+				          xml_transcoder->chunk_data_size,
+				          &name_offset,
+				          &attribute_name_data,
+				          &attribute_name_data_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read attribute name.",
+					 function );
+				}
+				return( result );
+			}
+			result = libevtx_xml_transcoder_read_value(
+			          xml_transcoder,
+			          substitutions,
+			          &safe_chunk_data_offset,
+			          attributes_end_offset,
+			          &value_type,
+			          &value_data_offset,
+			          &value_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read attribute value.",
+					 function );
+				}
+				return( result );
+			}
+			/* Attributes without a value are not written
+			 */
+			if( ( value_type == LIBEVTX_VALUE_TYPE_NULL )
+			 || ( value_data_size == 0 ) )
+			{
+				continue;
+			}
+			if( libevtx_xml_transcoder_append(
+			     xml_transcoder,
+			     (uint8_t *) " ",
+			     1,
+			     error ) != 1 )
+			{
+				goto on_append_error;
+			}
+			result = libevtx_xml_transcoder_append_utf16_stream(
+			          xml_transcoder,
+			          attribute_name_data,
+			          attribute_name_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					goto on_append_error;
+				}
+				return( 0 );
+			}
+			if( libevtx_xml_transcoder_append(
+			     xml_transcoder,
+			     (uint8_t *) "=\"",
+			     2,
+			     error ) != 1 )
+			{
+				goto on_append_error;
+			}
+			result = libevtx_xml_transcoder_append_value(
+			          xml_transcoder,
+			          value_type,
+			          value_data_offset,
+			          value_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					goto on_append_error;
+				}
+				return( 0 );
+			}
+			if( libevtx_xml_transcoder_append(
+			     xml_transcoder,
+			     (uint8_t *) "\"",
+			     1,
+			     error ) != 1 )
+			{
+				goto on_append_error;
+			}
+		}
+	}
+	if( safe_chunk_data_offset >= element_end_offset )
+	{
+		return( 0 );
+	}
+	token = chunk_data[ safe_chunk_data_offset ];
+
+	if( token == LIBEVTX_BINARY_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
+	{
+		if( libevtx_xml_transcoder_append(
+		     xml_transcoder,
+		     (uint8_t *) "/>\n",
+		     3,
+		     error ) != 1 )
+		{
+			goto on_append_error;
+		}
+		*chunk_data_offset = safe_chunk_data_offset + 1;
+
+		return( 1 );
+	}
+	else if( token != LIBEVTX_BINARY_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+	{
+		return( 0 );
+	}
+	safe_chunk_data_offset += 1;
+
+	/* The content type is 0 if the element has no content so far,
+	 * 1 if the content consists of text and 2 if it consists of elements
+	 */
+	while( safe_chunk_data_offset < element_end_offset )
+	{
+		token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+		if( token == LIBEVTX_BINARY_XML_TOKEN_END_ELEMENT_TAG )
+		{
+			if( content_type == 0 )
+			{
+				if( libevtx_xml_transcoder_append(
+				     xml_transcoder,
+				     (uint8_t *) "/>\n",
+				     3,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+			}
+			else
+			{
+				if( content_type == 2 )
+				{
+					if( libevtx_xml_transcoder_append_indentation(
+					     xml_transcoder,
+					     element_depth,
+					     error ) != 1 )
+					{
+						goto on_append_error;
+					}
+				}
+				if( libevtx_xml_transcoder_append(
+				     xml_transcoder,
+				     (uint8_t *) "</",
+				     2,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				if( libevtx_xml_transcoder_append_utf16_stream(
+				     xml_transcoder,
+				     name_data,
+				     name_data_size,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				if( libevtx_xml_transcoder_append(
+				     xml_transcoder,
+				     (uint8_t *) ">\n",
+				     2,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+			}
+			*chunk_data_offset = safe_chunk_data_offset + 1;
+
+			return( 1 );
+		}
+		if( token == LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+		{
+			value_type = LIBEVTX_VALUE_TYPE_BINARY_XML;
+		}
+		else
+		{
+			result = libevtx_xml_transcoder_read_value(
+			          xml_transcoder,
+			          substitutions,
+			          &safe_chunk_data_offset,
+			          element_end_offset,
+			          &value_type,
+			          &value_data_offset,
+			          &value_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read element content.",
+					 function );
+				}
+				return( result );
+			}
+			if( ( value_type == LIBEVTX_VALUE_TYPE_NULL )
+			 || ( value_data_size == 0 ) )
+			{
+				continue;
+			}
+		}
+		if( value_type == LIBEVTX_VALUE_TYPE_BINARY_XML )
+		{
+			if( content_type == 1 )
+			{
+				return( 0 );
+			}
+			if( content_type == 0 )
+			{
+				if( libevtx_xml_transcoder_append(
+				     xml_transcoder,
+				     (uint8_t *) ">\n",
+				     2,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				content_type = 2;
+			}
+			if( token == LIBEVTX_BINARY_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+			{
+				result = libevtx_xml_transcoder_read_element(
+				          xml_transcoder,
+				          substitutions,
+				          &safe_chunk_data_offset,
+				          element_end_offset,
+				          element_depth + 1,
+				          error );
+			}
+			else
+			{
+				/* The binary XML substitution value contains a fragment
+				 */
+				result = libevtx_xml_transcoder_read_fragment(
+				          xml_transcoder,
+				          &value_data_offset,
+				          value_data_offset + value_data_size,
+				          element_depth + 1,
+				          error );
+			}
+		}
+		else
+		{
+			if( content_type == 2 )
+			{
+				return( 0 );
+			}
+			if( content_type == 0 )
+			{
+				if( libevtx_xml_transcoder_append(
+				     xml_transcoder,
+				     (uint8_t *) ">",
+				     1,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				content_type = 1;
+			}
+			result = libevtx_xml_transcoder_append_value(
+			          xml_transcoder,
+			          value_type,
+			          value_data_offset,
+			          value_data_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to transcode element content.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	return( 0 );
+
+on_append_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append element to XML string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reads a binary XML value, an attribute value or element content
+ * A substitution is resolved to the corresponding substitution value
+ * Returns 1 if successful, 0 if the value is not supported or -1 on error
+ */
+int libevtx_xml_transcoder_read_value(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     libevtx_xml_transcoder_substitutions_t *substitutions,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     uint8_t *value_type,
+     size_t *value_data_offset,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_data        = NULL;
+	static char *function            = "libevtx_xml_transcoder_read_value";
+	size_t safe_chunk_data_offset    = 0;
+	size_t safe_value_data_offset    = 0;
+	uint16_t number_of_characters    = 0;
+	uint16_t substitution_index      = 0;
+	uint16_t substitution_value_size = 0;
+	uint16_t value_index             = 0;
+	uint8_t token                    = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_data_offset > xml_transcoder->chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data             = xml_transcoder->chunk_data;
+	safe_chunk_data_offset = *chunk_data_offset;
+
+	if( safe_chunk_data_offset >= end_of_data_offset )
+	{
+		return( 0 );
+	}
+	token = chunk_data[ safe_chunk_data_offset ] & ~( LIBEVTX_BINARY_XML_TOKEN_FLAG_HAS_MORE_DATA );
+
+	if( token == LIBEVTX_BINARY_XML_TOKEN_VALUE )
+	{
+		/* The value consists of the token, the value type, the number of characters
+		 * and the UTF-16 little-endian characters
+		 */
+		if( ( end_of_data_offset - safe_chunk_data_offset ) < 4 )
+		{
+			return( 0 );
+		}
+		if( chunk_data[ safe_chunk_data_offset + 1 ] != LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( chunk_data[ safe_chunk_data_offset + 2 ] ),
+		 number_of_characters );
+
+		safe_chunk_data_offset += 4;
+
+		if( ( (size_t) number_of_characters * 2 ) > ( end_of_data_offset - safe_chunk_data_offset ) )
+		{
+			return( 0 );
+		}
+		*value_type        = LIBEVTX_VALUE_TYPE_STRING_UTF16;
+		*value_data_offset = safe_chunk_data_offset;
+		*value_data_size   = (size_t) number_of_characters * 2;
+
+		*chunk_data_offset = safe_chunk_data_offset + ( (size_t) number_of_characters * 2 );
+
+		return( 1 );
+	}
+	if( ( token != LIBEVTX_BINARY_XML_TOKEN_NORMAL_SUBSTITUTION )
+	 && ( token != LIBEVTX_BINARY_XML_TOKEN_OPTIONAL_SUBSTITUTION ) )
+	{
+		return( 0 );
+	}
+	/* The substitution consists of the token, the substitution index and the value type
+	 */
+	if( substitutions == NULL )
+	{
+		return( 0 );
+	}
+	if( ( end_of_data_offset - safe_chunk_data_offset ) < 4 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( chunk_data[ safe_chunk_data_offset + 1 ] ),
+	 substitution_index );
+
+	if( (uint32_t) substitution_index >= substitutions->number_of_values )
+	{
+		return( 0 );
+	}
+	/* The value sizes were validated when the template instance was read
+	 */
+	safe_value_data_offset = substitutions->values_offset;
+
+	for( value_index = 0;
+	     value_index < substitution_index;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( chunk_data[ substitutions->descriptors_offset + ( (size_t) value_index * 4 ) ] ),
+		 substitution_value_size );
+
+		safe_value_data_offset += substitution_value_size;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( chunk_data[ substitutions->descriptors_offset + ( (size_t) substitution_index * 4 ) ] ),
+	 substitution_value_size );
+
+	*value_type        = chunk_data[ substitutions->descriptors_offset + ( (size_t) substitution_index * 4 ) + 2 ];
+	*value_data_offset = safe_value_data_offset;
+	*value_data_size   = (size_t) substitution_value_size;
+
+	*chunk_data_offset = safe_chunk_data_offset + 4;
+
+	return( 1 );
+}
+
+/* Reserves space in the XML string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_xml_transcoder_reserve(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     size_t size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libevtx_xml_transcoder_reserve";
+	size_t allocated_size = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size <= ( xml_transcoder->allocated_string_size - xml_transcoder->string_size ) )
+	{
+		return( 1 );
+	}
+	allocated_size = xml_transcoder->allocated_string_size;
+
+	if( allocated_size == 0 )
+	{
+		allocated_size = LIBEVTX_XML_TRANSCODER_INITIAL_STRING_SIZE;
+	}
+	while( size > ( allocated_size - xml_transcoder->string_size ) )
+	{
+		if( allocated_size > (size_t) ( SSIZE_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid allocated size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		allocated_size *= 2;
+	}
+	reallocation = memory_reallocate(
+	                xml_transcoder->string,
+	                sizeof( uint8_t ) * allocated_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	xml_transcoder->string                = (uint8_t *) reallocation;
+	xml_transcoder->allocated_string_size = allocated_size;
+
+	return( 1 );
+}
+
+/* Appends data to the XML string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_xml_transcoder_append(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_xml_transcoder_append";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_xml_transcoder_reserve(
+	     xml_transcoder,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in string.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( xml_transcoder->string[ xml_transcoder->string_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		xml_transcoder->string_size += data_size;
+	}
+	return( 1 );
+}
+
+/* Appends the indentation of an element to the XML string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_xml_transcoder_append_indentation(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     int element_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_xml_transcoder_append_indentation";
+
+	for( ;
+	     element_depth > 0;
+	     element_depth-- )
+	{
+		if( libevtx_xml_transcoder_append(
+		     xml_transcoder,
+		     (uint8_t *) "  ",
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append indentation.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-16 little-endian stream to the XML string as UTF-8
+ * Trailing end of string characters are ignored
+ * Returns 1 if successful, 0 if the stream contains characters that require escaping or -1 on error
+ */
+int libevtx_xml_transcoder_append_utf16_stream(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ 4 ];
+
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libevtx_xml_transcoder_append_utf16_stream";
+	size_t utf16_stream_index                    = 0;
+	size_t utf8_string_index                     = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( utf16_stream_size >= 2 )
+	    && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	    && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+	{
+		utf16_stream_size -= 2;
+	}
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     LIBUNA_ENDIAN_LITTLE,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		/* Characters that require escaping and control characters are left to the XML document
+		 */
+		if( ( unicode_character == (libuna_unicode_character_t) '<' )
+		 || ( unicode_character == (libuna_unicode_character_t) '>' )
+		 || ( unicode_character == (libuna_unicode_character_t) '&' )
+		 || ( unicode_character == (libuna_unicode_character_t) '"' )
+		 || ( unicode_character == (libuna_unicode_character_t) '\'' )
+		 || ( ( unicode_character < 0x20 )
+		  &&  ( unicode_character != (libuna_unicode_character_t) '\t' )
+		  &&  ( unicode_character != (libuna_unicode_character_t) '\n' )
+		  &&  ( unicode_character != (libuna_unicode_character_t) '\r' ) ) )
+		{
+			return( 0 );
+		}
+		utf8_string_index = 0;
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     utf8_string,
+		     4,
+		     &utf8_string_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( libevtx_xml_transcoder_append(
+		     xml_transcoder,
+		     utf8_string,
+		     utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append character.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( utf16_stream_index != utf16_stream_size )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends an ASCII byte stream to the XML string as UTF-8 using the codepage table
+ * Trailing end of string characters are ignored
+ * Returns 1 if successful, 0 if the stream contains characters that require escaping
+ * or that are not in the codepage table or -1 on error
+ */
+int libevtx_xml_transcoder_append_byte_stream(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libevtx_xml_transcoder_append_byte_stream";
+	size_t byte_stream_index = 0;
+	uint8_t byte_value       = 0;
+	int result               = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) ( SSIZE_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_transcoder->ascii_codepage_table == NULL )
+	{
+		return( 0 );
+	}
+	while( ( byte_stream_size >= 1 )
+	    && ( byte_stream[ byte_stream_size - 1 ] == 0 ) )
+	{
+		byte_stream_size -= 1;
+	}
+	/* Characters that require escaping and control characters are left to the XML document,
+	 * all of these are below 0x40
+	 */
+	for( byte_stream_index = 0;
+	     byte_stream_index < byte_stream_size;
+	     byte_stream_index++ )
+	{
+		byte_value = byte_stream[ byte_stream_index ];
+
+		if( byte_value >= 0x40 )
+		{
+			continue;
+		}
+		if( ( byte_value == (uint8_t) '<' )
+		 || ( byte_value == (uint8_t) '>' )
+		 || ( byte_value == (uint8_t) '&' )
+		 || ( byte_value == (uint8_t) '"' )
+		 || ( byte_value == (uint8_t) '\'' )
+		 || ( ( byte_value < 0x20 )
+		  &&  ( byte_value != (uint8_t) '\t' )
+		  &&  ( byte_value != (uint8_t) '\n' )
+		  &&  ( byte_value != (uint8_t) '\r' ) ) )
+		{
+			return( 0 );
+		}
+	}
+	/* A single byte is at most 4 bytes in UTF-8
+	 */
+	if( libevtx_xml_transcoder_reserve(
+	     xml_transcoder,
+	     byte_stream_size * 4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in string.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_codepage_table_copy_to_utf8_string(
+	          xml_transcoder->ascii_codepage_table,
+	          byte_stream,
+	          byte_stream_size,
+	          xml_transcoder->string,
+	          xml_transcoder->allocated_string_size,
+	          &( xml_transcoder->string_size ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+		 "%s: unable to copy byte stream to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends an integer as a decimal string to the XML string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_xml_transcoder_append_integer(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint64_t value_64bit,
+     uint8_t is_signed,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_xml_transcoder_append_integer";
+
+	if( libevtx_xml_transcoder_reserve(
+	     xml_transcoder,
+	     LIBEVTX_VALUE_FORMATTER_INTEGER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_value_formatter_copy_integer_to_utf8_string(
+	     value_64bit,
+	     is_signed,
+	     xml_transcoder->string,
+	     xml_transcoder->allocated_string_size,
+	     &( xml_transcoder->string_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append integer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an integer as a lower case hexadecimal string prefixed by 0x to the XML string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_xml_transcoder_append_hexadecimal(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint64_t value_64bit,
+     int number_of_digits,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_xml_transcoder_append_hexadecimal";
+
+	if( libevtx_xml_transcoder_reserve(
+	     xml_transcoder,
+	     18,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+	     value_64bit,
+	     number_of_digits,
+	     xml_transcoder->string,
+	     xml_transcoder->allocated_string_size,
+	     &( xml_transcoder->string_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append hexadecimal integer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a FILETIME as an ISO 8601 date and time string with a nano seconds fraction to the XML string
+ * Returns 1 if successful, 0 if the FILETIME is not supported or -1 on error
+ */
+int libevtx_xml_transcoder_append_filetime(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_xml_transcoder_append_filetime";
+	int result            = 0;
+
+	if( libevtx_xml_transcoder_reserve(
+	     xml_transcoder,
+	     LIBEVTX_VALUE_FORMATTER_FILETIME_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in string.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          filetime,
+	          xml_transcoder->string,
+	          xml_transcoder->allocated_string_size,
+	          &( xml_transcoder->string_size ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append date and time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a substitution or string value to the XML string
+ * The value is formatted directly into the XML string without intermediate buffers
+ * Returns 1 if successful, 0 if the value type is not supported or -1 on error
+ */
+int libevtx_xml_transcoder_append_value(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint8_t value_type,
+     size_t value_data_offset,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "libevtx_xml_transcoder_append_value";
+	uint64_t value_64bit      = 0;
+	uint32_t value_32bit      = 0;
+	uint16_t value_16bit      = 0;
+	uint8_t is_signed         = 0;
+	int result                = 0;
+
+	if( xml_transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_offset > xml_transcoder->chunk_data_size )
+	 || ( value_data_size > ( xml_transcoder->chunk_data_size - value_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_data = &( xml_transcoder->chunk_data[ value_data_offset ] );
+
+	switch( value_type )
+	{
+		case LIBEVTX_VALUE_TYPE_NULL:
+			return( 1 );
+
+		case LIBEVTX_VALUE_TYPE_STRING_UTF16:
+			return( libevtx_xml_transcoder_append_utf16_stream(
+			         xml_transcoder,
+			         value_data,
+			         value_data_size,
+			         error ) );
+
+		case LIBEVTX_VALUE_TYPE_STRING_BYTE_STREAM:
+			return( libevtx_xml_transcoder_append_byte_stream(
+			         xml_transcoder,
+			         value_data,
+			         value_data_size,
+			         error ) );
+
+		case LIBEVTX_VALUE_TYPE_INTEGER_8BIT:
+		case LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+			if( value_data_size != 1 )
+			{
+				return( 0 );
+			}
+			if( value_type == LIBEVTX_VALUE_TYPE_INTEGER_8BIT )
+			{
+				value_64bit = (uint64_t) (int64_t) (int8_t) value_data[ 0 ];
+				is_signed   = 1;
+			}
+			else
+			{
+				value_64bit = (uint64_t) value_data[ 0 ];
+			}
+			return( libevtx_xml_transcoder_append_integer(
+			         xml_transcoder,
+			         value_64bit,
+			         is_signed,
+			         error ) );
+
+		case LIBEVTX_VALUE_TYPE_INTEGER_16BIT:
+		case LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+			if( value_data_size != 2 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 value_data,
+			 value_16bit );
+
+			if( value_type == LIBEVTX_VALUE_TYPE_INTEGER_16BIT )
+			{
+				value_64bit = (uint64_t) (int64_t) (int16_t) value_16bit;
+				is_signed   = 1;
+			}
+			else
+			{
+				value_64bit = (uint64_t) value_16bit;
+			}
+			return( libevtx_xml_transcoder_append_integer(
+			         xml_transcoder,
+			         value_64bit,
+			         is_signed,
+			         error ) );
+
+		case LIBEVTX_VALUE_TYPE_INTEGER_32BIT:
+		case LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+		case LIBEVTX_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT:
+			if( value_data_size != 4 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			if( value_type == LIBEVTX_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT )
+			{
+				return( libevtx_xml_transcoder_append_hexadecimal(
+				         xml_transcoder,
+				         (uint64_t) value_32bit,
+				         8,
+				         error ) );
+			}
+			if( value_type == LIBEVTX_VALUE_TYPE_INTEGER_32BIT )
+			{
+				value_64bit = (uint64_t) (int64_t) (int32_t) value_32bit;
+				is_signed   = 1;
+			}
+			else
+			{
+				value_64bit = (uint64_t) value_32bit;
+			}
+			return( libevtx_xml_transcoder_append_integer(
+			         xml_transcoder,
+			         value_64bit,
+			         is_signed,
+			         error ) );
+
+		case LIBEVTX_VALUE_TYPE_INTEGER_64BIT:
+		case LIBEVTX_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+		case LIBEVTX_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT:
+			if( value_data_size != 8 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			if( value_type == LIBEVTX_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT )
+			{
+				return( libevtx_xml_transcoder_append_hexadecimal(
+				         xml_transcoder,
+				         value_64bit,
+				         16,
+				         error ) );
+			}
+			if( value_type == LIBEVTX_VALUE_TYPE_INTEGER_64BIT )
+			{
+				is_signed = 1;
+			}
+			return( libevtx_xml_transcoder_append_integer(
+			         xml_transcoder,
+			         value_64bit,
+			         is_signed,
+			         error ) );
+
+		case LIBEVTX_VALUE_TYPE_BOOLEAN:
+			if( value_data_size != 4 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			result = libevtx_xml_transcoder_reserve(
+			          xml_transcoder,
+			          5,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libevtx_value_formatter_copy_boolean_to_utf8_string(
+				          value_32bit,
+				          xml_transcoder->string,
+				          xml_transcoder->allocated_string_size,
+				          &( xml_transcoder->string_size ),
+				          error );
+			}
+			break;
+
+		case LIBEVTX_VALUE_TYPE_GUID:
+			if( value_data_size != 16 )
+			{
+				return( 0 );
+			}
+			result = libevtx_xml_transcoder_reserve(
+			          xml_transcoder,
+			          LIBEVTX_VALUE_FORMATTER_GUID_STRING_SIZE,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libevtx_value_formatter_copy_guid_to_utf8_string(
+				          value_data,
+				          value_data_size,
+				          xml_transcoder->string,
+				          xml_transcoder->allocated_string_size,
+				          &( xml_transcoder->string_size ),
+				          error );
+			}
+			break;
+
+		case LIBEVTX_VALUE_TYPE_FILETIME:
+			if( value_data_size != 8 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			/* A FILETIME that is not set or that cannot be formatted
+			 * is left to the XML document
+			 */
+			if( value_64bit == 0 )
+			{
+				return( 0 );
+			}
+			return( libevtx_xml_transcoder_append_filetime(
+			         xml_transcoder,
+			         value_64bit,
+			         error ) );
+
+		case LIBEVTX_VALUE_TYPE_SYSTEMTIME:
+			result = libevtx_xml_transcoder_reserve(
+			          xml_transcoder,
+			          LIBEVTX_VALUE_FORMATTER_SYSTEMTIME_STRING_SIZE,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libevtx_value_formatter_copy_systemtime_to_utf8_string(
+				          value_data,
+				          value_data_size,
+				          xml_transcoder->string,
+				          xml_transcoder->allocated_string_size,
+				          &( xml_transcoder->string_size ),
+				          error );
+			}
+			if( result == 0 )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBEVTX_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+			result = libevtx_xml_transcoder_reserve(
+			          xml_transcoder,
+			          LIBEVTX_VALUE_FORMATTER_MAXIMUM_SID_STRING_SIZE,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libevtx_value_formatter_copy_sid_to_utf8_string(
+				          value_data,
+				          value_data_size,
+				          xml_transcoder->string,
+				          xml_transcoder->allocated_string_size,
+				          &( xml_transcoder->string_size ),
+				          error );
+			}
+			if( result == 0 )
+			{
+				return( 0 );
+			}
+			break;
+
+		default:
+			/* Other value types, such as floating point, binary data
+			 * and arrays, are left to the XML document
+			 */
+			return( 0 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,196 @@
+/*
+ * Binary XML to XML string transcoder functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_XML_TRANSCODER_H )
+#define _LIBEVTX_XML_TRANSCODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_codepage_table.h"
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum element depth that is transcoded
+ */
+#define LIBEVTX_XML_TRANSCODER_MAXIMUM_DEPTH		64
+
+/* The initial allocated size of the XML string
+ */
+#define LIBEVTX_XML_TRANSCODER_INITIAL_STRING_SIZE	4096
+
+typedef struct libevtx_xml_transcoder_substitutions libevtx_xml_transcoder_substitutions_t;
+
+struct libevtx_xml_transcoder_substitutions
+{
+	/* The offset of the value descriptors in the chunk data
+	 */
+	size_t descriptors_offset;
+
+	/* The offset of the value data in the chunk data
+	 */
+	size_t values_offset;
+
+	/* The number of values
+	 */
+	uint32_t number_of_values;
+};
+
+typedef struct libevtx_xml_transcoder libevtx_xml_transcoder_t;
+
+struct libevtx_xml_transcoder
+{
+	/* The chunk data
+	 */
+	const uint8_t *chunk_data;
+
+	/* The chunk data size
+	 */
+	size_t chunk_data_size;
+
+	/* The UTF-8 encoded XML string
+	 */
+	uint8_t *string;
+
+	/* The UTF-8 encoded XML string size
+	 * Contains the number of bytes written
+	 */
+	size_t string_size;
+
+	/* The allocated size of the UTF-8 encoded XML string
+	 */
+	size_t allocated_string_size;
+
+	/* The codepage table of the ASCII strings
+	 * Contains NULL if the ASCII strings are left to the XML document
+	 */
+	const libevtx_codepage_table_t *ascii_codepage_table;
+};
+
+int libevtx_xml_transcoder_initialize(
+     libevtx_xml_transcoder_t **xml_transcoder,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_free(
+     libevtx_xml_transcoder_t **xml_transcoder,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_transcode_record(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t record_data_offset,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_read_fragment(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_read_template_instance(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_read_element(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     libevtx_xml_transcoder_substitutions_t *substitutions,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     int element_depth,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_read_value(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     libevtx_xml_transcoder_substitutions_t *substitutions,
+     size_t *chunk_data_offset,
+     size_t end_of_data_offset,
+     uint8_t *value_type,
+     size_t *value_data_offset,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_reserve(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     size_t size,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append_indentation(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     int element_depth,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append_utf16_stream(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append_byte_stream(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append_integer(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint64_t value_64bit,
+     uint8_t is_signed,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append_hexadecimal(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint64_t value_64bit,
+     int number_of_digits,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append_filetime(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int libevtx_xml_transcoder_append_value(
+     libevtx_xml_transcoder_t *xml_transcoder,
+     uint8_t value_type,
+     size_t value_data_offset,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_XML_TRANSCODER_H ) */
+
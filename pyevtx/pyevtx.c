@@ -35,8 +35,10 @@
 #include "pyevtx_file_object_io_handle.h"
 #include "pyevtx_libcerror.h"
 #include "pyevtx_libevtx.h"
+#include "pyevtx_open_many.h"
 #include "pyevtx_python.h"
 #include "pyevtx_record.h"
+#include "pyevtx_record_stream.h"
 #include "pyevtx_records.h"
 #include "pyevtx_strings.h"
 #include "pyevtx_unused.h"
@@ -77,7 +79,7 @@ PyMethodDef pyevtx_module_methods[] = {
 	{ "open",
 	  (PyCFunction) pyevtx_open_new_file,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open(filename, mode='r') -> Object\n"
+	  "open(filename, mode='r', index=None) -> Object\n"
 	  "\n"
 	  "Opens a file." },
 
@@ -88,6 +90,21 @@ PyMethodDef pyevtx_module_methods[] = {
 	  "\n"
 	  "Opens a file using a file-like object." },
 
+	{ "open_bytes",
+	  (PyCFunction) pyevtx_open_new_file_with_bytes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_bytes(data, mode='r') -> Object\n"
+	  "\n"
+	  "Opens a file from a bytes-like object without copying the data." },
+
+	{ "open_many",
+	  (PyCFunction) pyevtx_open_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_many(filenames, threads=1) -> List\n"
+	  "\n"
+	  "Opens multiple files using the number of threads. The list contains a file object\n"
+	  "for every file that was opened and an IOError for every file that could not be opened." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -467,6 +484,29 @@ PyObject *pyevtx_open_new_file_with_file_object(
 	return( pyevtx_file );
 }
 
+/* Creates a new file object and opens it from a bytes-like object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_open_new_file_with_bytes(
+           PyObject *self PYEVTX_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *pyevtx_file = NULL;
+
+	PYEVTX_UNREFERENCED_PARAMETER( self )
+
+	pyevtx_file_init(
+	 (pyevtx_file_t *) pyevtx_file );
+
+	pyevtx_file_open_bytes(
+	 (pyevtx_file_t *) pyevtx_file,
+	 arguments,
+	 keywords );
+
+	return( pyevtx_file );
+}
+
 #if PY_MAJOR_VERSION >= 3
 
 /* The pyevtx module definition
@@ -538,6 +578,15 @@ PyMODINIT_FUNC initpyevtx(
 	}
 	PyEval_InitThreads();
 
+#if defined( Py_GIL_DISABLED )
+	/* The shared state of the file, record and sequence objects is serialized
+	 * by the per file lock and critical sections hence the module does not
+	 * need the GIL to be re-enabled
+	 */
+	PyUnstable_Module_SetGIL(
+	 module,
+	 Py_MOD_GIL_NOT_USED );
+#endif
 	gil_state = PyGILState_Ensure();
 
 	/* Setup the event_levels type object
@@ -625,6 +674,23 @@ PyMODINIT_FUNC initpyevtx(
 	 "records",
 	 (PyObject *) &pyevtx_records_type_object );
 
+	/* Setup the record stream type object
+	 */
+	pyevtx_record_stream_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyevtx_record_stream_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyevtx_record_stream_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "record_stream",
+	 (PyObject *) &pyevtx_record_stream_type_object );
+
 	/* Setup the strings type object
 	 */
 	pyevtx_strings_type_object.tp_new = PyType_GenericNew;
@@ -0,0 +1,1127 @@
+/*
+ * Column functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "pyevtx_columns.h"
+#include "pyevtx_error.h"
+#include "pyevtx_libcerror.h"
+#include "pyevtx_libevtx.h"
+#include "pyevtx_python.h"
+
+/* The record field names
+ */
+const char *pyevtx_column_field_names[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ] = {
+	"offset",
+	"identifier",
+	"written_time",
+	"event_identifier",
+	"event_identifier_qualifiers",
+	"event_level",
+	"provider_identifier",
+	"source_name",
+	"computer_name",
+	"user_security_identifier" };
+
+/* Creates a column
+ * Make sure the value column is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_column_initialize(
+     pyevtx_column_t **column,
+     int field,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_column_initialize";
+	size_t value_size     = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	switch( field )
+	{
+		case PYEVTX_COLUMN_FIELD_OFFSET:
+		case PYEVTX_COLUMN_FIELD_IDENTIFIER:
+		case PYEVTX_COLUMN_FIELD_WRITTEN_TIME:
+			value_size = sizeof( uint64_t );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER:
+		case PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER_QUALIFIERS:
+			value_size = sizeof( uint32_t );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_EVENT_LEVEL:
+			value_size = sizeof( uint8_t );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_PROVIDER_IDENTIFIER:
+		case PYEVTX_COLUMN_FIELD_SOURCE_NAME:
+		case PYEVTX_COLUMN_FIELD_COMPUTER_NAME:
+		case PYEVTX_COLUMN_FIELD_USER_SECURITY_IDENTIFIER:
+			value_size = 0;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field.",
+			 function );
+
+			return( -1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( (size_t) number_of_values > ( (size_t) SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*column = memory_allocate_structure(
+	           pyevtx_column_t );
+
+	if( *column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *column,
+	     0,
+	     sizeof( pyevtx_column_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column.",
+		 function );
+
+		memory_free(
+		 *column );
+
+		*column = NULL;
+
+		return( -1 );
+	}
+	( *column )->field            = field;
+	( *column )->number_of_values = number_of_values;
+	( *column )->value_size       = value_size;
+
+	if( number_of_values > 0 )
+	{
+		if( value_size > 0 )
+		{
+			( *column )->values = (uint8_t *) memory_allocate(
+			                                   value_size * number_of_values );
+
+			if( ( *column )->values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create values.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     ( *column )->values,
+			     0,
+			     value_size * number_of_values ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			( *column )->string_sizes = (size_t *) memory_allocate(
+			                                        sizeof( size_t ) * number_of_values );
+
+			if( ( *column )->string_sizes == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create string sizes.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     ( *column )->string_sizes,
+			     0,
+			     sizeof( size_t ) * number_of_values ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear string sizes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *column != NULL )
+	{
+		pyevtx_column_free(
+		 column,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a column
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_column_free(
+     pyevtx_column_t **column,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_column_free";
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column != NULL )
+	{
+		if( ( *column )->values != NULL )
+		{
+			memory_free(
+			 ( *column )->values );
+		}
+		if( ( *column )->string_data != NULL )
+		{
+			memory_free(
+			 ( *column )->string_data );
+		}
+		if( ( *column )->string_sizes != NULL )
+		{
+			memory_free(
+			 ( *column )->string_sizes );
+		}
+		memory_free(
+		 *column );
+
+		*column = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the values of a column
+ * The allocated string data is retained so that the column can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_column_clear(
+     pyevtx_column_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_column_clear";
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	column->string_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the field of a specific name
+ * Returns 1 if successful, 0 if no such field or -1 on error
+ */
+int pyevtx_column_get_field_by_name(
+     const char *name,
+     int *field,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_column_get_field_by_name";
+	size_t name_length    = 0;
+	int field_index       = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( field == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	for( field_index = 0;
+	     field_index < PYEVTX_COLUMN_NUMBER_OF_FIELDS;
+	     field_index++ )
+	{
+		if( ( narrow_string_length( pyevtx_column_field_names[ field_index ] ) == name_length )
+		 && ( narrow_string_compare(
+		       pyevtx_column_field_names[ field_index ],
+		       name,
+		       name_length ) == 0 ) )
+		{
+			*field = field_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the fields from a sequence of field names
+ * All fields are retrieved if the fields object is NULL or None and
+ * duplicate field names are ignored
+ * Make sure the fields array contains PYEVTX_COLUMN_NUMBER_OF_FIELDS entries
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_column_get_fields_from_object(
+     PyObject *fields_object,
+     int *fields,
+     int *number_of_fields )
+{
+	PyObject *sequence_object  = NULL;
+	PyObject *string_object    = NULL;
+	libcerror_error_t *error   = NULL;
+	const char *field_name     = NULL;
+	static char *function      = "pyevtx_column_get_fields_from_object";
+	Py_ssize_t field_index     = 0;
+	Py_ssize_t number_of_names = 0;
+	int field                  = 0;
+	int result                 = 0;
+	int safe_number_of_fields  = 0;
+	int search_index           = 0;
+
+	if( fields == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_fields == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fields_object == NULL )
+	 || ( fields_object == Py_None ) )
+	{
+		for( field = 0;
+		     field < PYEVTX_COLUMN_NUMBER_OF_FIELDS;
+		     field++ )
+		{
+			fields[ field ] = field;
+		}
+		*number_of_fields = PYEVTX_COLUMN_NUMBER_OF_FIELDS;
+
+		return( 1 );
+	}
+	sequence_object = PySequence_Fast(
+	                   fields_object,
+	                   "fields must be a sequence of strings" );
+
+	if( sequence_object == NULL )
+	{
+		goto on_error;
+	}
+	number_of_names = PySequence_Fast_GET_SIZE(
+	                   sequence_object );
+
+	if( number_of_names > PYEVTX_COLUMN_NUMBER_OF_FIELDS )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: too many fields.",
+		 function );
+
+		goto on_error;
+	}
+	for( field_index = 0;
+	     field_index < number_of_names;
+	     field_index++ )
+	{
+		string_object = PySequence_Fast_GET_ITEM(
+		                 sequence_object,
+		                 field_index );
+
+#if PY_MAJOR_VERSION >= 3
+		field_name = PyUnicode_AsUTF8(
+		              string_object );
+#else
+		field_name = PyString_AsString(
+		              string_object );
+#endif
+		if( field_name == NULL )
+		{
+			goto on_error;
+		}
+		result = pyevtx_column_get_field_by_name(
+		          field_name,
+		          &field,
+		          &error );
+
+		if( result == -1 )
+		{
+			pyevtx_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to determine field.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: unsupported field: %s.",
+			 function,
+			 field_name );
+
+			goto on_error;
+		}
+		for( search_index = 0;
+		     search_index < safe_number_of_fields;
+		     search_index++ )
+		{
+			if( fields[ search_index ] == field )
+			{
+				break;
+			}
+		}
+		if( search_index < safe_number_of_fields )
+		{
+			continue;
+		}
+		fields[ safe_number_of_fields++ ] = field;
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	*number_of_fields = safe_number_of_fields;
+
+	return( 1 );
+
+on_error:
+	if( sequence_object != NULL )
+	{
+		Py_DecRef(
+		 sequence_object );
+	}
+	return( -1 );
+}
+
+/* Sets a string value of the column from a record
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_column_set_string_value_from_record(
+     pyevtx_column_t *column,
+     int value_index,
+     libevtx_record_t *record,
+     int (*get_utf8_string_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf8_string)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	static char *function      = "pyevtx_column_set_string_value_from_record";
+	size_t allocation_size     = 0;
+	size_t utf8_string_size    = 0;
+	int result                 = 0;
+
+	result = get_utf8_string_size(
+	          record,
+	          &utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		column->string_sizes[ value_index ] = 0;
+
+		return( 1 );
+	}
+	if( utf8_string_size > ( (size_t) SSIZE_MAX - column->string_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column->string_data_size + utf8_string_size ) > column->allocated_string_data_size )
+	{
+		allocation_size = column->allocated_string_data_size * 2;
+
+		if( allocation_size < 4096 )
+		{
+			allocation_size = 4096;
+		}
+		while( allocation_size < ( column->string_data_size + utf8_string_size ) )
+		{
+			allocation_size *= 2;
+		}
+		if( allocation_size > (size_t) SSIZE_MAX )
+		{
+			allocation_size = (size_t) SSIZE_MAX;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            column->string_data,
+		                            sizeof( uint8_t ) * allocation_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string data.",
+			 function );
+
+			return( -1 );
+		}
+		column->string_data                = reallocation;
+		column->allocated_string_data_size = allocation_size;
+	}
+	if( get_utf8_string(
+	     record,
+	     &( column->string_data[ column->string_data_size ] ),
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	column->string_sizes[ value_index ] = utf8_string_size;
+	column->string_data_size           += utf8_string_size;
+
+	return( 1 );
+}
+
+/* Sets a value of the column from a record
+ * This function does not require the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_column_set_value_from_record(
+     pyevtx_column_t *column,
+     int value_index,
+     libevtx_record_t *record,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_column_set_value_from_record";
+	uint64_t value_64bit  = 0;
+	off64_t offset        = 0;
+	uint32_t value_32bit  = 0;
+	uint8_t value_8bit    = 0;
+	int result            = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= column->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column->field )
+	{
+		case PYEVTX_COLUMN_FIELD_OFFSET:
+			result = libevtx_record_get_offset(
+			          record,
+			          &offset,
+			          error );
+
+			value_64bit = (uint64_t) offset;
+			break;
+
+		case PYEVTX_COLUMN_FIELD_IDENTIFIER:
+			result = libevtx_record_get_identifier(
+			          record,
+			          &value_64bit,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_WRITTEN_TIME:
+			result = libevtx_record_get_written_time(
+			          record,
+			          &value_64bit,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER:
+			result = libevtx_record_get_event_identifier(
+			          record,
+			          &value_32bit,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER_QUALIFIERS:
+			result = libevtx_record_get_event_identifier_qualifiers(
+			          record,
+			          &value_32bit,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_EVENT_LEVEL:
+			result = libevtx_record_get_event_level(
+			          record,
+			          &value_8bit,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_PROVIDER_IDENTIFIER:
+			result = pyevtx_column_set_string_value_from_record(
+			          column,
+			          value_index,
+			          record,
+			          libevtx_record_get_utf8_provider_identifier_size,
+			          libevtx_record_get_utf8_provider_identifier,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_SOURCE_NAME:
+			result = pyevtx_column_set_string_value_from_record(
+			          column,
+			          value_index,
+			          record,
+			          libevtx_record_get_utf8_source_name_size,
+			          libevtx_record_get_utf8_source_name,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_COMPUTER_NAME:
+			result = pyevtx_column_set_string_value_from_record(
+			          column,
+			          value_index,
+			          record,
+			          libevtx_record_get_utf8_computer_name_size,
+			          libevtx_record_get_utf8_computer_name,
+			          error );
+			break;
+
+		case PYEVTX_COLUMN_FIELD_USER_SECURITY_IDENTIFIER:
+			result = pyevtx_column_set_string_value_from_record(
+			          column,
+			          value_index,
+			          record,
+			          libevtx_record_get_utf8_user_security_identifier_size,
+			          libevtx_record_get_utf8_user_security_identifier,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field.",
+			 function );
+
+			return( -1 );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve %s of record.",
+		 function,
+		 pyevtx_column_field_names[ column->field ] );
+
+		return( -1 );
+	}
+	/* Values that are not available are stored as 0
+	 */
+	if( column->value_size == sizeof( uint64_t ) )
+	{
+		( (uint64_t *) column->values )[ value_index ] = value_64bit;
+	}
+	else if( column->value_size == sizeof( uint32_t ) )
+	{
+		( (uint32_t *) column->values )[ value_index ] = value_32bit;
+	}
+	else if( column->value_size == sizeof( uint8_t ) )
+	{
+		column->values[ value_index ] = value_8bit;
+	}
+	return( 1 );
+}
+
+/* Creates a Python object of a specific value of the column
+ * The string offset contains the offset of the string of the value in the string data
+ * and is advanced past it, hence the values of a string field must be retrieved in order
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_column_get_value_object(
+           pyevtx_column_t *column,
+           int value_index,
+           size_t *string_offset )
+{
+	PyObject *value_object = NULL;
+	static char *function  = "pyevtx_column_get_value_object";
+	uint64_t value_64bit   = 0;
+
+	if( column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= column->number_of_values ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( string_offset == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid string offset.",
+		 function );
+
+		return( NULL );
+	}
+	if( column->value_size == 0 )
+	{
+		if( column->string_sizes[ value_index ] == 0 )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		else
+		{
+			/* Pass the string length without the end of string character
+			 */
+			value_object = PyUnicode_DecodeUTF8(
+			                (char *) &( column->string_data[ *string_offset ] ),
+			                (Py_ssize_t) column->string_sizes[ value_index ] - 1,
+			                NULL );
+
+			*string_offset += column->string_sizes[ value_index ];
+		}
+	}
+	else
+	{
+		if( column->value_size == sizeof( uint64_t ) )
+		{
+			value_64bit = ( (uint64_t *) column->values )[ value_index ];
+		}
+		else if( column->value_size == sizeof( uint32_t ) )
+		{
+			value_64bit = ( (uint32_t *) column->values )[ value_index ];
+		}
+		else
+		{
+			value_64bit = column->values[ value_index ];
+		}
+		if( column->field == PYEVTX_COLUMN_FIELD_OFFSET )
+		{
+			value_object = PyLong_FromLongLong(
+			                (PY_LONG_LONG) value_64bit );
+		}
+		else
+		{
+			value_object = PyLong_FromUnsignedLongLong(
+			                (unsigned PY_LONG_LONG) value_64bit );
+		}
+	}
+	return( value_object );
+}
+
+/* Creates a Python object of the column
+ * Numeric columns are returned as an array.array on Python 3, which supports
+ * the buffer protocol, and as a list otherwise. String columns are returned
+ * as a list that contains None for strings that are not available
+ * Make sure to hold the GIL state before calling this function
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_column_get_object(
+           pyevtx_column_t *column )
+{
+	PyObject *list_object   = NULL;
+	PyObject *value_object  = NULL;
+	static char *function   = "pyevtx_column_get_object";
+	size_t string_offset    = 0;
+	int value_index         = 0;
+
+#if PY_MAJOR_VERSION >= 3
+	PyObject *array_module  = NULL;
+	PyObject *array_object  = NULL;
+	PyObject *bytes_object  = NULL;
+	const char *type_code   = NULL;
+#endif
+
+	if( column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	if( column->value_size > 0 )
+	{
+		switch( column->field )
+		{
+			case PYEVTX_COLUMN_FIELD_OFFSET:
+				type_code = "q";
+				break;
+
+			case PYEVTX_COLUMN_FIELD_IDENTIFIER:
+			case PYEVTX_COLUMN_FIELD_WRITTEN_TIME:
+				type_code = "Q";
+				break;
+
+			case PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER:
+			case PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER_QUALIFIERS:
+				type_code = ( sizeof( unsigned int ) == 4 ) ? "I" : "L";
+				break;
+
+			default:
+				type_code = "B";
+				break;
+		}
+		bytes_object = PyBytes_FromStringAndSize(
+		                (char *) column->values,
+		                (Py_ssize_t) ( column->value_size * column->number_of_values ) );
+
+		if( bytes_object == NULL )
+		{
+			return( NULL );
+		}
+		array_module = PyImport_ImportModule(
+		                "array" );
+
+		if( array_module == NULL )
+		{
+			Py_DecRef(
+			 bytes_object );
+
+			return( NULL );
+		}
+		array_object = PyObject_CallMethod(
+		                array_module,
+		                "array",
+		                "sO",
+		                type_code,
+		                bytes_object );
+
+		Py_DecRef(
+		 array_module );
+
+		Py_DecRef(
+		 bytes_object );
+
+		return( array_object );
+	}
+#endif
+	list_object = PyList_New(
+	               (Py_ssize_t) column->number_of_values );
+
+	if( list_object == NULL )
+	{
+		return( NULL );
+	}
+	for( value_index = 0;
+	     value_index < column->number_of_values;
+	     value_index++ )
+	{
+		value_object = pyevtx_column_get_value_object(
+		                column,
+		                value_index,
+		                &string_offset );
+
+		if( value_object == NULL )
+		{
+			Py_DecRef(
+			 list_object );
+
+			return( NULL );
+		}
+		/* PyList_SetItem steals the reference to value_object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 (Py_ssize_t) value_index,
+		 value_object );
+	}
+	return( list_object );
+}
+
+/* Creates a NumPy datetime64[ns] array object of a written time column
+ * FILETIME values of 0 and values that cannot be represented are set to NaT
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_column_get_datetime64_object(
+           pyevtx_column_t *column )
+{
+	PyObject *array_object     = NULL;
+	PyObject *bytearray_object = NULL;
+	PyObject *numpy_module     = NULL;
+	int64_t *timestamps        = NULL;
+	static char *function      = "pyevtx_column_get_datetime64_object";
+	uint64_t filetime          = 0;
+	int64_t posix_time         = 0;
+	int value_index            = 0;
+
+	if( column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( column->field != PYEVTX_COLUMN_FIELD_WRITTEN_TIME )
+	 || ( column->value_size != sizeof( uint64_t ) ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported column field.",
+		 function );
+
+		return( NULL );
+	}
+	numpy_module = PyImport_ImportModule(
+	                "numpy" );
+
+	if( numpy_module == NULL )
+	{
+		return( NULL );
+	}
+	bytearray_object = PyByteArray_FromStringAndSize(
+	                    NULL,
+	                    (Py_ssize_t) ( sizeof( int64_t ) * column->number_of_values ) );
+
+	if( bytearray_object == NULL )
+	{
+		goto on_error;
+	}
+	timestamps = (int64_t *) PyByteArray_AsString(
+	                          bytearray_object );
+
+	if( ( timestamps == NULL )
+	 && ( column->number_of_values > 0 ) )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < column->number_of_values;
+	     value_index++ )
+	{
+		filetime = ( (uint64_t *) column->values )[ value_index ];
+
+		timestamps[ value_index ] = PYEVTX_COLUMN_DATETIME64_NOT_A_TIME;
+
+		if( filetime == 0 )
+		{
+			continue;
+		}
+		/* The FILETIME is converted into the number of 100-nanosecond
+		 * intervals since January 1, 1970 and then into nanoseconds
+		 */
+		if( filetime >= PYEVTX_COLUMN_FILETIME_POSIX_EPOCH )
+		{
+			if( ( filetime - PYEVTX_COLUMN_FILETIME_POSIX_EPOCH ) > (uint64_t) ( INT64_MAX / 100 ) )
+			{
+				continue;
+			}
+			posix_time = (int64_t) ( filetime - PYEVTX_COLUMN_FILETIME_POSIX_EPOCH );
+		}
+		else
+		{
+			if( ( PYEVTX_COLUMN_FILETIME_POSIX_EPOCH - filetime ) > (uint64_t) ( INT64_MAX / 100 ) )
+			{
+				continue;
+			}
+			posix_time = -( (int64_t) ( PYEVTX_COLUMN_FILETIME_POSIX_EPOCH - filetime ) );
+		}
+		timestamps[ value_index ] = posix_time * 100;
+	}
+	array_object = PyObject_CallMethod(
+	                numpy_module,
+	                "frombuffer",
+	                "Os",
+	                bytearray_object,
+	                "datetime64[ns]" );
+
+	Py_DecRef(
+	 bytearray_object );
+
+	Py_DecRef(
+	 numpy_module );
+
+	return( array_object );
+
+on_error:
+	if( bytearray_object != NULL )
+	{
+		Py_DecRef(
+		 bytearray_object );
+	}
+	Py_DecRef(
+	 numpy_module );
+
+	return( NULL );
+}
+
@@ -0,0 +1,165 @@
+/*
+ * Column functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#if !defined( _PYEVTX_COLUMNS_H )
+#define _PYEVTX_COLUMNS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyevtx_libcerror.h"
+#include "pyevtx_libevtx.h"
+#include "pyevtx_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of 100-nanosecond intervals between the FILETIME epoch
+ * of January 1, 1601 and the POSIX epoch of January 1, 1970
+ */
+#define PYEVTX_COLUMN_FILETIME_POSIX_EPOCH	(uint64_t) 116444736000000000ULL
+
+/* The NumPy datetime64 not a time (NaT) value
+ * which is the smallest 64-bit signed integer
+ */
+#define PYEVTX_COLUMN_DATETIME64_NOT_A_TIME	(int64_t) ( -0x7fffffffffffffffLL - 1 )
+
+/* The record fields that can be retrieved as a column
+ */
+enum PYEVTX_COLUMN_FIELDS
+{
+	PYEVTX_COLUMN_FIELD_OFFSET			= 0,
+	PYEVTX_COLUMN_FIELD_IDENTIFIER,
+	PYEVTX_COLUMN_FIELD_WRITTEN_TIME,
+	PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER,
+	PYEVTX_COLUMN_FIELD_EVENT_IDENTIFIER_QUALIFIERS,
+	PYEVTX_COLUMN_FIELD_EVENT_LEVEL,
+	PYEVTX_COLUMN_FIELD_PROVIDER_IDENTIFIER,
+	PYEVTX_COLUMN_FIELD_SOURCE_NAME,
+	PYEVTX_COLUMN_FIELD_COMPUTER_NAME,
+	PYEVTX_COLUMN_FIELD_USER_SECURITY_IDENTIFIER,
+
+	PYEVTX_COLUMN_NUMBER_OF_FIELDS
+};
+
+typedef struct pyevtx_column pyevtx_column_t;
+
+struct pyevtx_column
+{
+	/* The field
+	 */
+	int field;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The values of a numeric field
+	 */
+	uint8_t *values;
+
+	/* The size of a value of a numeric field
+	 */
+	size_t value_size;
+
+	/* The UTF-8 string data of a string field
+	 * Contains the strings including their end of string character
+	 */
+	uint8_t *string_data;
+
+	/* The string data size
+	 */
+	size_t string_data_size;
+
+	/* The allocated string data size
+	 */
+	size_t allocated_string_data_size;
+
+	/* The string sizes of a string field
+	 * Contains 0 if the string is not available
+	 */
+	size_t *string_sizes;
+};
+
+extern const char *pyevtx_column_field_names[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ];
+
+int pyevtx_column_initialize(
+     pyevtx_column_t **column,
+     int field,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int pyevtx_column_free(
+     pyevtx_column_t **column,
+     libcerror_error_t **error );
+
+int pyevtx_column_clear(
+     pyevtx_column_t *column,
+     libcerror_error_t **error );
+
+int pyevtx_column_get_field_by_name(
+     const char *name,
+     int *field,
+     libcerror_error_t **error );
+
+int pyevtx_column_get_fields_from_object(
+     PyObject *fields_object,
+     int *fields,
+     int *number_of_fields );
+
+int pyevtx_column_set_string_value_from_record(
+     pyevtx_column_t *column,
+     int value_index,
+     libevtx_record_t *record,
+     int (*get_utf8_string_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf8_string)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int pyevtx_column_set_value_from_record(
+     pyevtx_column_t *column,
+     int value_index,
+     libevtx_record_t *record,
+     libcerror_error_t **error );
+
+PyObject *pyevtx_column_get_value_object(
+           pyevtx_column_t *column,
+           int value_index,
+           size_t *string_offset );
+
+PyObject *pyevtx_column_get_object(
+           pyevtx_column_t *column );
+
+PyObject *pyevtx_column_get_datetime64_object(
+           pyevtx_column_t *column );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYEVTX_COLUMNS_H ) */
+
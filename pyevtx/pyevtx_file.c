@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 
@@ -28,15 +29,18 @@
 #endif
 
 #include "pyevtx_codepage.h"
+#include "pyevtx_columns.h"
 #include "pyevtx_error.h"
 #include "pyevtx_file.h"
 #include "pyevtx_file_object_io_handle.h"
+#include "pyevtx_integer.h"
 #include "pyevtx_libbfio.h"
 #include "pyevtx_libcerror.h"
 #include "pyevtx_libclocale.h"
 #include "pyevtx_libevtx.h"
 #include "pyevtx_python.h"
 #include "pyevtx_record.h"
+#include "pyevtx_record_stream.h"
 #include "pyevtx_records.h"
 #include "pyevtx_unused.h"
 
@@ -63,9 +67,12 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	{ "open",
 	  (PyCFunction) pyevtx_file_open,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open(filename, mode='r') -> None\n"
+	  "open(filename, mode='r', index=None) -> None\n"
 	  "\n"
-	  "Opens a file." },
+	  "Opens a file.\n"
+	  "If index contains index data, as retrieved by get_index_data, the records\n"
+	  "are read from it instead of from the chunks. The chunks are still read if\n"
+	  "the index data was created for another version of the file." },
 
 	{ "open_file_object",
 	  (PyCFunction) pyevtx_file_open_file_object,
@@ -74,6 +81,13 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Opens a file using a file-like object." },
 
+	{ "open_bytes",
+	  (PyCFunction) pyevtx_file_open_bytes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_bytes(data, mode='r') -> None\n"
+	  "\n"
+	  "Opens a file from a bytes-like object without copying the data." },
+
 	{ "close",
 	  (PyCFunction) pyevtx_file_close,
 	  METH_NOARGS,
@@ -81,6 +95,14 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Closes a file." },
 
+	{ "refresh",
+	  (PyCFunction) pyevtx_file_refresh,
+	  METH_NOARGS,
+	  "refresh() -> Boolean\n"
+	  "\n"
+	  "Refreshes the file to add records written since the file was opened or last refreshed.\n"
+	  "Returns True if records were added." },
+
 	{ "is_corrupted",
 	  (PyCFunction) pyevtx_file_is_corrupted,
 	  METH_NOARGS,
@@ -103,6 +125,14 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "Sets the codepage for ASCII strings used in the file.\n"
 	  "Expects the codepage to be a string containing a Python codec definition." },
 
+	{ "set_cache_limits",
+	  (PyCFunction) pyevtx_file_set_cache_limits,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_cache_limits(maximum_number_of_cached_chunks, maximum_number_of_cached_records, maximum_cache_size=0) -> None\n"
+	  "\n"
+	  "Sets the cache limits that are applied when the file is opened.\n"
+	  "The maximum cache size is the size of the cached chunks data in bytes, where 0 represents no size limit." },
+
 	{ "get_format_version",
 	  (PyCFunction) pyevtx_file_get_format_version,
 	  METH_NOARGS,
@@ -110,6 +140,14 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the format version." },
 
+	{ "get_memory_usage",
+	  (PyCFunction) pyevtx_file_get_memory_usage,
+	  METH_NOARGS,
+	  "get_memory_usage() -> Integer\n"
+	  "\n"
+	  "Retrieves the memory usage in bytes of the chunk data, records index,\n"
+	  "record values and XML documents that are currently allocated." },
+
 	{ "get_number_of_records",
 	  (PyCFunction) pyevtx_file_get_number_of_records,
 	  METH_NOARGS,
@@ -117,6 +155,25 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the number of records." },
 
+	{ "get_number_of_chunks",
+	  (PyCFunction) pyevtx_file_get_number_of_chunks,
+	  METH_NOARGS,
+	  "get_number_of_chunks() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of chunks." },
+
+	{ "get_chunk_information",
+	  (PyCFunction) pyevtx_file_get_chunk_information,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_chunk_information(chunk_index) -> Dictionary\n"
+	  "\n"
+	  "Retrieves the information of the chunk specified by the index, read from\n"
+	  "the chunk header only: offset, first_record_number, last_record_number,\n"
+	  "first_record_identifier, last_record_identifier, number_of_records,\n"
+	  "free_space_offset and flags (the verify result flags). The written time\n"
+	  "range, minimum_written_time and maximum_written_time as FILETIME integers,\n"
+	  "is None if the records of the chunk were not read before." },
+
 	{ "get_record",
 	  (PyCFunction) pyevtx_file_get_record,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -124,6 +181,14 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the record specified by the index." },
 
+	{ "get_record_by_identifier",
+	  (PyCFunction) pyevtx_file_get_record_by_identifier,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_record_by_identifier(identifier) -> Object or None\n"
+	  "\n"
+	  "Retrieves the record specified by the event record identifier.\n"
+	  "None is returned if no such record exists." },
+
 	{ "get_number_of_recovered_records",
 	  (PyCFunction) pyevtx_file_get_number_of_recovered_records,
 	  METH_NOARGS,
@@ -138,6 +203,56 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the recovered record specified by the index." },
 
+	{ "to_columns",
+	  (PyCFunction) pyevtx_file_to_columns,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "to_columns(fields=None) -> Dictionary\n"
+	  "\n"
+	  "Retrieves the values of all records as columns, by field name.\n"
+	  "Supported fields are: offset, identifier, written_time (as a FILETIME\n"
+	  "integer), event_identifier, event_identifier_qualifiers, event_level,\n"
+	  "provider_identifier, source_name, computer_name and\n"
+	  "user_security_identifier. All fields are retrieved if fields is None.\n"
+	  "Numeric columns are array.array objects, string columns are lists." },
+
+	{ "written_times",
+	  (PyCFunction) pyevtx_file_written_times,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "written_times(as_datetime64=False) -> Object\n"
+	  "\n"
+	  "Retrieves the written times of all records as FILETIME integers in\n"
+	  "an array.array of type 'Q', without creating datetime objects.\n"
+	  "If as_datetime64 is True a NumPy datetime64[ns] array is returned\n"
+	  "instead, where unset and unrepresentable written times are NaT." },
+
+	{ "get_index_data",
+	  (PyCFunction) pyevtx_file_get_index_data,
+	  METH_NOARGS,
+	  "get_index_data() -> Bytes\n"
+	  "\n"
+	  "Retrieves the index data, which contains the records lists of the file.\n"
+	  "The index data can be passed as index to open of another file object of\n"
+	  "the same file, e.g. in a worker process, to skip reading all the chunks." },
+
+	{ "iter_records",
+	  (PyCFunction) pyevtx_file_iter_records,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_records(batch_size=256) -> Object\n"
+	  "\n"
+	  "Retrieves an iterator that yields the records in a single forward pass.\n"
+	  "The records are read batch_size records at a time, chunk by chunk,\n"
+	  "with the GIL released." },
+
+	{ "iter_dicts",
+	  (PyCFunction) pyevtx_file_iter_dicts,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_dicts(fields=None, batch_size=256) -> Object\n"
+	  "\n"
+	  "Retrieves an iterator that yields a dictionary of the field values per\n"
+	  "record, by field name. The field values are extracted batch_size records\n"
+	  "at a time with the GIL released. The supported fields are the same as\n"
+	  "those of to_columns. All fields are retrieved if fields is None." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -156,6 +271,12 @@ PyGetSetDef pyevtx_file_object_get_set_definitions[] = {
 	  "The format version.",
 	  NULL },
 
+	{ "memory_usage",
+	  (getter) pyevtx_file_get_memory_usage,
+	  (setter) 0,
+	  "The memory usage in bytes.",
+	  NULL },
+
 	{ "number_of_records",
 	  (getter) pyevtx_file_get_number_of_records,
 	  (setter) 0,
@@ -299,8 +420,27 @@ int pyevtx_file_init(
 	}
 	/* Make sure libevtx file is set to NULL
 	 */
-	pyevtx_file->file           = NULL;
-	pyevtx_file->file_io_handle = NULL;
+	pyevtx_file->file                            = NULL;
+	pyevtx_file->file_io_handle                  = NULL;
+	pyevtx_file->data_buffer_is_set              = 0;
+	pyevtx_file->records_batch_first_index       = 0;
+	pyevtx_file->records_batch_number_of_records = 0;
+	pyevtx_file->last_record_index               = -1;
+	pyevtx_file->interned_strings                = NULL;
+	pyevtx_file->lock                            = NULL;
+
+	if( memory_set(
+	     pyevtx_file->records_batch,
+	     0,
+	     sizeof( libevtx_record_t * ) * PYEVTX_FILE_RECORDS_BATCH_SIZE ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear records batch.",
+		 function );
+
+		return( -1 );
+	}
 
 	if( libevtx_file_initialize(
 	     &( pyevtx_file->file ),
@@ -317,6 +457,36 @@ int pyevtx_file_init(
 
 		return( -1 );
 	}
+	pyevtx_file->lock = PyThread_allocate_lock();
+
+	if( pyevtx_file->lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to allocate lock.",
+		 function );
+
+		return( -1 );
+	}
+	/* The computer and source names are interned so that the records
+	 * share their Unicode objects
+	 */
+	if( libevtx_file_set_string_interning(
+	     pyevtx_file->file,
+	     1,
+	     &error ) != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to set string interning.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
 	return( 0 );
 }
 
@@ -360,6 +530,19 @@ void pyevtx_file_free(
 
 		return;
 	}
+	if( pyevtx_file_free_records_batch(
+	     pyevtx_file,
+	     &error ) != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free records batch.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+	}
 	if( pyevtx_file->file != NULL )
 	{
 		Py_BEGIN_ALLOW_THREADS
@@ -382,10 +565,62 @@ void pyevtx_file_free(
 			 &error );
 		}
 	}
+	if( pyevtx_file->data_buffer_is_set != 0 )
+	{
+		PyBuffer_Release(
+		 &( pyevtx_file->data_buffer ) );
+
+		pyevtx_file->data_buffer_is_set = 0;
+	}
+	if( pyevtx_file->interned_strings != NULL )
+	{
+		Py_DecRef(
+		 pyevtx_file->interned_strings );
+
+		pyevtx_file->interned_strings = NULL;
+	}
+	if( pyevtx_file->lock != NULL )
+	{
+		PyThread_free_lock(
+		 pyevtx_file->lock );
+
+		pyevtx_file->lock = NULL;
+	}
 	ob_type->tp_free(
 	 (PyObject*) pyevtx_file );
 }
 
+/* Grabs the lock of the file
+ * The lock must only be grabbed while the GIL is released, since
+ * the file IO handle of a file-like object re-acquires the GIL
+ */
+void pyevtx_file_grab_lock(
+      pyevtx_file_t *pyevtx_file )
+{
+	if( ( pyevtx_file == NULL )
+	 || ( pyevtx_file->lock == NULL ) )
+	{
+		return;
+	}
+	PyThread_acquire_lock(
+	 pyevtx_file->lock,
+	 WAIT_LOCK );
+}
+
+/* Releases the lock of the file
+ */
+void pyevtx_file_release_lock(
+      pyevtx_file_t *pyevtx_file )
+{
+	if( ( pyevtx_file == NULL )
+	 || ( pyevtx_file->lock == NULL ) )
+	{
+		return;
+	}
+	PyThread_release_lock(
+	 pyevtx_file->lock );
+}
+
 /* Signals the file to abort the current activity
  * Returns a Python object if successful or NULL on error
  */
@@ -443,11 +678,12 @@ PyObject *pyevtx_file_open(
            PyObject *arguments,
            PyObject *keywords )
 {
+	PyObject *index_object       = NULL;
 	PyObject *string_object      = NULL;
 	libcerror_error_t *error     = NULL;
 	const char *filename_narrow  = NULL;
 	static char *function        = "pyevtx_file_open";
-	static char *keyword_list[]  = { "filename", "mode", NULL };
+	static char *keyword_list[]  = { "filename", "mode", "index", NULL };
 	char *mode                   = NULL;
 	int result                   = 0;
 
@@ -474,10 +710,11 @@ PyObject *pyevtx_file_open(
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "O|s",
+	     "O|sO",
 	     keyword_list,
 	     &string_object,
-	     &mode ) == 0 )
+	     &mode,
+	     &index_object ) == 0 )
 	{
 		return( NULL );
 	}
@@ -492,6 +729,16 @@ PyObject *pyevtx_file_open(
 
 		return( NULL );
 	}
+	if( ( index_object != NULL )
+	 && ( index_object != Py_None ) )
+	{
+		if( pyevtx_file_set_index_data(
+		     pyevtx_file,
+		     index_object ) != 1 )
+		{
+			return( NULL );
+		}
+	}
 	PyErr_Clear();
 
 	result = PyObject_IsInstance(
@@ -516,12 +763,18 @@ PyObject *pyevtx_file_open(
 		                             string_object );
 		Py_BEGIN_ALLOW_THREADS
 
+		pyevtx_file_grab_lock(
+		 pyevtx_file );
+
 		result = libevtx_file_open_wide(
 		          pyevtx_file->file,
 		          filename_wide,
 		          LIBEVTX_OPEN_READ,
 		          &error );
 
+		pyevtx_file_release_lock(
+		 pyevtx_file );
+
 		Py_END_ALLOW_THREADS
 #else
 		utf8_string_object = PyUnicode_AsUTF8String(
@@ -545,12 +798,18 @@ PyObject *pyevtx_file_open(
 #endif
 		Py_BEGIN_ALLOW_THREADS
 
+		pyevtx_file_grab_lock(
+		 pyevtx_file );
+
 		result = libevtx_file_open(
 		          pyevtx_file->file,
 		          filename_narrow,
 		          LIBEVTX_OPEN_READ,
 		          &error );
 
+		pyevtx_file_release_lock(
+		 pyevtx_file );
+
 		Py_END_ALLOW_THREADS
 
 		Py_DecRef(
@@ -607,12 +866,18 @@ PyObject *pyevtx_file_open(
 #endif
 		Py_BEGIN_ALLOW_THREADS
 
+		pyevtx_file_grab_lock(
+		 pyevtx_file );
+
 		result = libevtx_file_open(
 		          pyevtx_file->file,
 		          filename_narrow,
 		          LIBEVTX_OPEN_READ,
 		          &error );
 
+		pyevtx_file_release_lock(
+		 pyevtx_file );
+
 		Py_END_ALLOW_THREADS
 
 		if( result != 1 )
@@ -714,12 +979,18 @@ PyObject *pyevtx_file_open_file_object(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
 	result = libevtx_file_open_file_io_handle(
 	          pyevtx_file->file,
 	          pyevtx_file->file_io_handle,
 	          LIBEVTX_OPEN_READ,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -750,6 +1021,114 @@ on_error:
 	return( NULL );
 }
 
+/* Opens a file from a bytes-like object
+ * The data of the object is referenced, not copied, until the file is closed
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_open_bytes(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *data_object       = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevtx_file_open_bytes";
+	static char *keyword_list[] = { "data", "mode", NULL };
+	char *mode                  = NULL;
+	int result                  = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|s",
+	     keyword_list,
+	     &data_object,
+	     &mode ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( mode != NULL )
+	 && ( mode[ 0 ] != 'r' ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported mode: %s.",
+		 function,
+		 mode );
+
+		return( NULL );
+	}
+	if( pyevtx_file->data_buffer_is_set != 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid file - data buffer already set.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     data_object,
+	     &( pyevtx_file->data_buffer ),
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	pyevtx_file->data_buffer_is_set = 1;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_open_memory(
+	          pyevtx_file->file,
+	          (const uint8_t *) pyevtx_file->data_buffer.buf,
+	          (size_t) pyevtx_file->data_buffer.len,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	PyBuffer_Release(
+	 &( pyevtx_file->data_buffer ) );
+
+	pyevtx_file->data_buffer_is_set = 0;
+
+	return( NULL );
+}
+
 /* Closes a file
  * Returns a Python object if successful or NULL on error
  */
@@ -757,6 +1136,7 @@ PyObject *pyevtx_file_close(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
+	PyObject *list_object    = NULL;
 	libcerror_error_t *error = NULL;
 	static char *function    = "pyevtx_file_close";
 	int result               = 0;
@@ -774,10 +1154,60 @@ PyObject *pyevtx_file_close(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = pyevtx_file_free_records_batch(
+	          pyevtx_file,
+	          &error );
+
+	pyevtx_file->last_record_index = -1;
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free records batch.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	/* The string identifiers of the interned strings are only valid while the file is open
+	 */
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_file )
+
+	list_object = pyevtx_file->interned_strings;
+
+	pyevtx_file->interned_strings = NULL;
+
+	PYEVTX_END_CRITICAL_SECTION
+
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
 	result = libevtx_file_close(
 	          pyevtx_file->file,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 0 )
@@ -797,10 +1227,16 @@ PyObject *pyevtx_file_close(
 	{
 		Py_BEGIN_ALLOW_THREADS
 
+		pyevtx_file_grab_lock(
+		 pyevtx_file );
+
 		result = libbfio_handle_free(
 		          &( pyevtx_file->file_io_handle ),
 		          &error );
 
+		pyevtx_file_release_lock(
+		 pyevtx_file );
+
 		Py_END_ALLOW_THREADS
 
 		if( result != 1 )
@@ -817,21 +1253,32 @@ PyObject *pyevtx_file_close(
 			return( NULL );
 		}
 	}
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_file )
+
+	if( pyevtx_file->data_buffer_is_set != 0 )
+	{
+		PyBuffer_Release(
+		 &( pyevtx_file->data_buffer ) );
+
+		pyevtx_file->data_buffer_is_set = 0;
+	}
+	PYEVTX_END_CRITICAL_SECTION
+
 	Py_IncRef(
 	 Py_None );
 
 	return( Py_None );
 }
 
-/* Determines if the file is corrupted
+/* Refreshes the file
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_is_corrupted(
+PyObject *pyevtx_file_refresh(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
 	libcerror_error_t *error = NULL;
-	static char *function    = "pyevtx_file_is_corrupted";
+	static char *function    = "pyevtx_file_refresh";
 	int result               = 0;
 
 	PYEVTX_UNREFERENCED_PARAMETER( arguments )
@@ -847,10 +1294,16 @@ PyObject *pyevtx_file_is_corrupted(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_file_is_corrupted(
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_refresh(
 	          pyevtx_file->file,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -858,7 +1311,7 @@ PyObject *pyevtx_file_is_corrupted(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to determine if file is corrupted.",
+		 "%s: unable to refresh file.",
 		 function );
 
 		libcerror_error_free(
@@ -879,18 +1332,80 @@ PyObject *pyevtx_file_is_corrupted(
 	return( Py_False );
 }
 
-/* Retrieves the codepage used for ASCII strings in the file
+/* Determines if the file is corrupted
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_get_ascii_codepage(
+PyObject *pyevtx_file_is_corrupted(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
-	PyObject *string_object     = NULL;
-	libcerror_error_t *error    = NULL;
-	const char *codepage_string = NULL;
-	static char *function       = "pyevtx_file_get_ascii_codepage";
-	int ascii_codepage          = 0;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyevtx_file_is_corrupted";
+	int result               = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_is_corrupted(
+	          pyevtx_file->file,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine if file is corrupted.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( result != 0 )
+	{
+		Py_IncRef(
+		 (PyObject *) Py_True );
+
+		return( Py_True );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
+/* Retrieves the codepage used for ASCII strings in the file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_ascii_codepage(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	const char *codepage_string = NULL;
+	static char *function       = "pyevtx_file_get_ascii_codepage";
+	int ascii_codepage          = 0;
 	int result                  = 0;
 
 	PYEVTX_UNREFERENCED_PARAMETER( arguments )
@@ -906,11 +1421,17 @@ PyObject *pyevtx_file_get_ascii_codepage(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
 	result = libevtx_file_get_ascii_codepage(
 	          pyevtx_file->file,
 	          &ascii_codepage,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1015,11 +1536,17 @@ int pyevtx_file_set_ascii_codepage_from_string(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
 	result = libevtx_file_set_ascii_codepage(
 	          pyevtx_file->file,
 	          ascii_codepage,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1191,6 +1718,78 @@ int pyevtx_file_set_ascii_codepage_setter(
 	return( -1 );
 }
 
+/* Sets the cache limits
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_set_cache_limits(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error                 = NULL;
+	static char *function                    = "pyevtx_file_set_cache_limits";
+	static char *keyword_list[]              = { "maximum_number_of_cached_chunks", "maximum_number_of_cached_records", "maximum_cache_size", NULL };
+	unsigned PY_LONG_LONG maximum_cache_size = 0;
+	int maximum_number_of_cached_chunks      = 0;
+	int maximum_number_of_cached_records     = 0;
+	int result                               = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "ii|K",
+	     keyword_list,
+	     &maximum_number_of_cached_chunks,
+	     &maximum_number_of_cached_records,
+	     &maximum_cache_size ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_set_cache_limits(
+	          pyevtx_file->file,
+	          maximum_number_of_cached_chunks,
+	          maximum_number_of_cached_records,
+	          (size64_t) maximum_cache_size,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set cache limits.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Retrieves the format version
  * Returns a Python object if successful or NULL on error
  */
@@ -1221,12 +1820,18 @@ PyObject *pyevtx_file_get_format_version(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
 	result = libevtx_file_get_format_version(
 	          pyevtx_file->file,
 	          &major_version,
 	          &minor_version,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1285,17 +1890,17 @@ PyObject *pyevtx_file_get_format_version(
 	return( string_object );
 }
 
-/* Retrieves the number of records
+/* Retrieves the memory usage
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_get_number_of_records(
+PyObject *pyevtx_file_get_memory_usage(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
 	PyObject *integer_object = NULL;
 	libcerror_error_t *error = NULL;
-	static char *function    = "pyevtx_file_get_number_of_records";
-	int number_of_records    = 0;
+	static char *function    = "pyevtx_file_get_memory_usage";
+	uint64_t memory_usage    = 0;
 	int result               = 0;
 
 	PYEVTX_UNREFERENCED_PARAMETER( arguments )
@@ -1311,11 +1916,17 @@ PyObject *pyevtx_file_get_number_of_records(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_file_get_number_of_records(
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_memory_usage(
 	          pyevtx_file->file,
-	          &number_of_records,
+	          &memory_usage,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1323,7 +1934,7 @@ PyObject *pyevtx_file_get_number_of_records(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of records.",
+		 "%s: unable to retrieve memory usage.",
 		 function );
 
 		libcerror_error_free(
@@ -1331,29 +1942,27 @@ PyObject *pyevtx_file_get_number_of_records(
 
 		return( NULL );
 	}
-#if PY_MAJOR_VERSION >= 3
-	integer_object = PyLong_FromLong(
-	                  (long) number_of_records );
-#else
-	integer_object = PyInt_FromLong(
-	                  (long) number_of_records );
-#endif
+	integer_object = pyevtx_integer_unsigned_new_from_64bit(
+	                  memory_usage );
+
 	return( integer_object );
 }
 
-/* Retrieves a specific record by index
+/* Retrieves the number of records
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_get_record_by_index(
-           PyObject *pyevtx_file,
-           int record_index )
+PyObject *pyevtx_file_get_number_of_records(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
-	PyObject *record_object  = NULL;
+	PyObject *integer_object = NULL;
 	libcerror_error_t *error = NULL;
-	libevtx_record_t *record = NULL;
-	static char *function    = "pyevtx_file_get_record_by_index";
+	static char *function    = "pyevtx_file_get_number_of_records";
+	int number_of_records    = 0;
 	int result               = 0;
 
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
 	if( pyevtx_file == NULL )
 	{
 		PyErr_Format(
@@ -1365,12 +1974,17 @@ PyObject *pyevtx_file_get_record_by_index(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_file_get_record_by_index(
-	          ( (pyevtx_file_t *) pyevtx_file )->file,
-	          record_index,
-	          &record,
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_records(
+	          pyevtx_file->file,
+	          &number_of_records,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1378,79 +1992,35 @@ PyObject *pyevtx_file_get_record_by_index(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve record: %d.",
-		 function,
-		 record_index );
+		 "%s: unable to retrieve number of records.",
+		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
-	}
-	record_object = pyevtx_record_new(
-	                 record,
-	                 pyevtx_file );
-
-	if( record_object == NULL )
-	{
-		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to create record object.",
-		 function );
-
-		goto on_error;
-	}
-	return( record_object );
-
-on_error:
-	if( record != NULL )
-	{
-		libevtx_record_free(
-		 &record,
-		 NULL );
-	}
-	return( NULL );
-}
-
-/* Retrieves a specific record
- * Returns a Python object if successful or NULL on error
- */
-PyObject *pyevtx_file_get_record(
-           pyevtx_file_t *pyevtx_file,
-           PyObject *arguments,
-           PyObject *keywords )
-{
-	PyObject *record_object     = NULL;
-	static char *keyword_list[] = { "record_index", NULL };
-	int record_index            = 0;
-
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
-	     keyword_list,
-	     &record_index ) == 0 )
-	{
 		return( NULL );
 	}
-	record_object = pyevtx_file_get_record_by_index(
-	                 (PyObject *) pyevtx_file,
-	                 record_index );
-
-	return( record_object );
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_records );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_records );
+#endif
+	return( integer_object );
 }
 
-/* Retrieves a sequence and iterator object for the records
+/* Retrieves the number of chunks
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_get_records(
+PyObject *pyevtx_file_get_number_of_chunks(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
-	PyObject *sequence_object = NULL;
+	PyObject *integer_object  = NULL;
 	libcerror_error_t *error  = NULL;
-	static char *function     = "pyevtx_file_get_records";
-	int number_of_records     = 0;
+	static char *function     = "pyevtx_file_get_number_of_chunks";
+	uint16_t number_of_chunks = 0;
 	int result                = 0;
 
 	PYEVTX_UNREFERENCED_PARAMETER( arguments )
@@ -1466,11 +2036,17 @@ PyObject *pyevtx_file_get_records(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_file_get_number_of_records(
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_chunks(
 	          pyevtx_file->file,
-	          &number_of_records,
+	          &number_of_chunks,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1478,7 +2054,7 @@ PyObject *pyevtx_file_get_records(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of records.",
+		 "%s: unable to retrieve number of chunks.",
 		 function );
 
 		libcerror_error_free(
@@ -1486,38 +2062,1725 @@ PyObject *pyevtx_file_get_records(
 
 		return( NULL );
 	}
-	sequence_object = pyevtx_records_new(
-	                   (PyObject *) pyevtx_file,
-	                   &pyevtx_file_get_record_by_index,
-	                   number_of_records );
-
-	if( sequence_object == NULL )
-	{
-		pyevtx_error_raise(
-		 error,
-		 PyExc_MemoryError,
-		 "%s: unable to create sequence object.",
-		 function );
-
-		return( NULL );
-	}
-	return( sequence_object );
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_chunks );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_chunks );
+#endif
+	return( integer_object );
+}
+
+/* Sets an unsigned integer value in a dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_file_set_dictionary_unsigned_integer(
+     PyObject *dictionary_object,
+     const char *key,
+     uint64_t value_64bit )
+{
+	PyObject *integer_object = NULL;
+	int result               = 0;
+
+	integer_object = pyevtx_integer_unsigned_new_from_64bit(
+	                  value_64bit );
+
+	if( integer_object == NULL )
+	{
+		return( -1 );
+	}
+	result = PyDict_SetItemString(
+	          dictionary_object,
+	          key,
+	          integer_object );
+
+	Py_DecRef(
+	 integer_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the information of a specific chunk
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_chunk_information(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libevtx_chunk_information_t *chunk_information = NULL;
+	PyObject *dictionary_object                    = NULL;
+	libcerror_error_t *error                       = NULL;
+	static char *keyword_list[]                    = { "chunk_index", NULL };
+	static char *function                          = "pyevtx_file_get_chunk_information";
+	off64_t file_offset                            = 0;
+	uint64_t first_record_identifier               = 0;
+	uint64_t first_record_number                   = 0;
+	uint64_t last_record_identifier                = 0;
+	uint64_t last_record_number                    = 0;
+	uint64_t maximum_written_time                  = 0;
+	uint64_t minimum_written_time                  = 0;
+	uint32_t flags                                 = 0;
+	uint32_t free_space_offset                     = 0;
+	uint32_t number_of_records                     = 0;
+	int chunk_index                                = 0;
+	int has_written_time_range                     = 0;
+	int result                                     = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &chunk_index ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( chunk_index < 0 )
+	 || ( chunk_index > (int) UINT16_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_chunk_information(
+	          pyevtx_file->file,
+	          (uint16_t) chunk_index,
+	          &chunk_information,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libevtx_chunk_information_get_file_offset(
+		          chunk_information,
+		          &file_offset,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libevtx_chunk_information_get_record_numbers(
+		          chunk_information,
+		          &first_record_number,
+		          &last_record_number,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libevtx_chunk_information_get_record_identifiers(
+		          chunk_information,
+		          &first_record_identifier,
+		          &last_record_identifier,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libevtx_chunk_information_get_number_of_records(
+		          chunk_information,
+		          &number_of_records,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libevtx_chunk_information_get_free_space_offset(
+		          chunk_information,
+		          &free_space_offset,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libevtx_chunk_information_get_flags(
+		          chunk_information,
+		          &flags,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		has_written_time_range = libevtx_chunk_information_get_written_time_range(
+		                          chunk_information,
+		                          &minimum_written_time,
+		                          &maximum_written_time,
+		                          &error );
+
+		if( has_written_time_range == -1 )
+		{
+			result = -1;
+		}
+	}
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve chunk: %d information.",
+		 function,
+		 chunk_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libevtx_chunk_information_free(
+	     &chunk_information,
+	     &error ) != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free chunk information.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		goto on_error;
+	}
+	if( ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "offset",
+	       (uint64_t) file_offset ) != 1 )
+	 || ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "first_record_number",
+	       first_record_number ) != 1 )
+	 || ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "last_record_number",
+	       last_record_number ) != 1 )
+	 || ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "first_record_identifier",
+	       first_record_identifier ) != 1 )
+	 || ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "last_record_identifier",
+	       last_record_identifier ) != 1 )
+	 || ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "number_of_records",
+	       (uint64_t) number_of_records ) != 1 )
+	 || ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "free_space_offset",
+	       (uint64_t) free_space_offset ) != 1 )
+	 || ( pyevtx_file_set_dictionary_unsigned_integer(
+	       dictionary_object,
+	       "flags",
+	       (uint64_t) flags ) != 1 ) )
+	{
+		goto on_error;
+	}
+	if( has_written_time_range != 0 )
+	{
+		if( ( pyevtx_file_set_dictionary_unsigned_integer(
+		       dictionary_object,
+		       "minimum_written_time",
+		       minimum_written_time ) != 1 )
+		 || ( pyevtx_file_set_dictionary_unsigned_integer(
+		       dictionary_object,
+		       "maximum_written_time",
+		       maximum_written_time ) != 1 ) )
+		{
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( ( PyDict_SetItemString(
+		       dictionary_object,
+		       "minimum_written_time",
+		       Py_None ) != 0 )
+		 || ( PyDict_SetItemString(
+		       dictionary_object,
+		       "maximum_written_time",
+		       Py_None ) != 0 ) )
+		{
+			goto on_error;
+		}
+	}
+	return( dictionary_object );
+
+on_error:
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	if( chunk_information != NULL )
+	{
+		libevtx_chunk_information_free(
+		 &chunk_information,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Frees the records in the records batch
+ * The lock of the file must be held
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_file_free_records_batch(
+     pyevtx_file_t *pyevtx_file,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_file_free_records_batch";
+	int batch_index       = 0;
+	int result            = 1;
+
+	if( pyevtx_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	for( batch_index = 0;
+	     batch_index < pyevtx_file->records_batch_number_of_records;
+	     batch_index++ )
+	{
+		if( pyevtx_file->records_batch[ batch_index ] != NULL )
+		{
+			if( libevtx_record_free(
+			     &( pyevtx_file->records_batch[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record: %d.",
+				 function,
+				 pyevtx_file->records_batch_first_index + batch_index );
+
+				result = -1;
+			}
+		}
+	}
+	pyevtx_file->records_batch_first_index       = 0;
+	pyevtx_file->records_batch_number_of_records = 0;
+
+	return( result );
+}
+
+/* Retrieves a specific record using the records batch
+ * If the records are retrieved in sequence the subsequent records are
+ * retrieved at once and handed out from the records batch
+ * The lock of the file must be held
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_file_get_batched_record_by_index(
+     pyevtx_file_t *pyevtx_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_file_get_batched_record_by_index";
+	int batch_index       = 0;
+	int number_of_records = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	batch_index = record_index - pyevtx_file->records_batch_first_index;
+
+	if( ( record_index >= pyevtx_file->records_batch_first_index )
+	 && ( batch_index < pyevtx_file->records_batch_number_of_records )
+	 && ( pyevtx_file->records_batch[ batch_index ] != NULL ) )
+	{
+		*record = pyevtx_file->records_batch[ batch_index ];
+
+		pyevtx_file->records_batch[ batch_index ] = NULL;
+	}
+	else if( record_index == ( pyevtx_file->last_record_index + 1 ) )
+	{
+		if( pyevtx_file_free_records_batch(
+		     pyevtx_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free records batch.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_file_get_number_of_records(
+		     pyevtx_file->file,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( record_index < 0 )
+		 || ( record_index >= number_of_records ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_records -= record_index;
+
+		if( number_of_records > PYEVTX_FILE_RECORDS_BATCH_SIZE )
+		{
+			number_of_records = PYEVTX_FILE_RECORDS_BATCH_SIZE;
+		}
+		if( libevtx_file_get_records_by_range(
+		     pyevtx_file->file,
+		     record_index,
+		     number_of_records,
+		     pyevtx_file->records_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records: %d - %d.",
+			 function,
+			 record_index,
+			 record_index + number_of_records - 1 );
+
+			return( -1 );
+		}
+		pyevtx_file->records_batch_first_index       = record_index;
+		pyevtx_file->records_batch_number_of_records = number_of_records;
+
+		*record = pyevtx_file->records_batch[ 0 ];
+
+		pyevtx_file->records_batch[ 0 ] = NULL;
+	}
+	else if( libevtx_file_get_record_by_index(
+	          pyevtx_file->file,
+	          record_index,
+	          record,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	pyevtx_file->last_record_index = record_index;
+
+	return( 1 );
+}
+
+/* Retrieves the Unicode object of an interned string
+ * The Unicode object is created once and reused for the records of the file
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_file_get_interned_string_object(
+     pyevtx_file_t *pyevtx_file,
+     uint32_t string_identifier,
+     PyObject **string_object )
+{
+	PyObject *unicode_object = NULL;
+	libcerror_error_t *error = NULL;
+	const char *errors       = NULL;
+	static char *function    = "pyevtx_file_get_interned_string_object";
+	char *utf8_string        = NULL;
+	size_t utf8_string_size  = 0;
+	Py_ssize_t list_size     = 0;
+	int result               = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid string object.",
+		 function );
+
+		return( -1 );
+	}
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_file )
+
+	if( pyevtx_file->interned_strings != NULL )
+	{
+		list_size = PyList_Size(
+		             pyevtx_file->interned_strings );
+
+		if( (Py_ssize_t) string_identifier < list_size )
+		{
+			unicode_object = PyList_GetItem(
+			                  pyevtx_file->interned_strings,
+			                  (Py_ssize_t) string_identifier );
+
+			if( unicode_object == Py_None )
+			{
+				unicode_object = NULL;
+			}
+			else if( unicode_object != NULL )
+			{
+				Py_IncRef(
+				 unicode_object );
+			}
+		}
+	}
+	PYEVTX_END_CRITICAL_SECTION
+
+	if( unicode_object != NULL )
+	{
+		*string_object = unicode_object;
+
+		return( 1 );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_utf8_interned_string_size(
+	          pyevtx_file->file,
+	          string_identifier,
+	          &utf8_string_size,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve size of interned string: %" PRIu32 ".",
+		 function,
+		 string_identifier );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( utf8_string_size == 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid interned string: %" PRIu32 " size value out of bounds.",
+		 function,
+		 string_identifier );
+
+		goto on_error;
+	}
+	utf8_string = (char *) PyMem_Malloc(
+	                        sizeof( char ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_utf8_interned_string(
+	          pyevtx_file->file,
+	          string_identifier,
+	          (uint8_t *) utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve interned string: %" PRIu32 ".",
+		 function,
+		 string_identifier );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	unicode_object = PyUnicode_DecodeUTF8(
+	                  utf8_string,
+	                  (Py_ssize_t) utf8_string_size - 1,
+	                  errors );
+
+	if( unicode_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	PyMem_Free(
+	 utf8_string );
+
+	utf8_string = NULL;
+
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_file )
+
+	result = pyevtx_file_set_interned_string_object(
+	          pyevtx_file,
+	          string_identifier,
+	          &unicode_object );
+
+	PYEVTX_END_CRITICAL_SECTION
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	*string_object = unicode_object;
+
+	return( 1 );
+
+on_error:
+	if( unicode_object != NULL )
+	{
+		Py_DecRef(
+		 unicode_object );
+	}
+	if( utf8_string != NULL )
+	{
+		PyMem_Free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Sets an interned string object
+ * If the string was interned by another thread in the meantime the string object
+ * is replaced by the interned string object
+ * Make sure to hold the critical section of the file before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_file_set_interned_string_object(
+     pyevtx_file_t *pyevtx_file,
+     uint32_t string_identifier,
+     PyObject **string_object )
+{
+	PyObject *unicode_object = NULL;
+	static char *function    = "pyevtx_file_set_interned_string_object";
+	Py_ssize_t list_size     = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_object == NULL )
+	 || ( *string_object == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid string object.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyevtx_file->interned_strings == NULL )
+	{
+		pyevtx_file->interned_strings = PyList_New(
+		                                 0 );
+
+		if( pyevtx_file->interned_strings == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create interned strings list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	list_size = PyList_Size(
+	             pyevtx_file->interned_strings );
+
+	if( (Py_ssize_t) string_identifier < list_size )
+	{
+		unicode_object = PyList_GetItem(
+		                  pyevtx_file->interned_strings,
+		                  (Py_ssize_t) string_identifier );
+
+		if( ( unicode_object != NULL )
+		 && ( unicode_object != Py_None ) )
+		{
+			Py_IncRef(
+			 unicode_object );
+
+			Py_DecRef(
+			 *string_object );
+
+			*string_object = unicode_object;
+
+			return( 1 );
+		}
+	}
+	/* The strings interned by other records, that were not retrieved
+	 * as a Unicode object yet, are represented by None
+	 */
+	while( list_size <= (Py_ssize_t) string_identifier )
+	{
+		if( PyList_Append(
+		     pyevtx_file->interned_strings,
+		     Py_None ) != 0 )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to append interned string: %" PRIu32 ".",
+			 function,
+			 string_identifier );
+
+			return( -1 );
+		}
+		list_size++;
+	}
+	/* PyList_SetItem steals the reference to the Unicode object
+	 */
+	Py_IncRef(
+	 *string_object );
+
+	if( PyList_SetItem(
+	     pyevtx_file->interned_strings,
+	     (Py_ssize_t) string_identifier,
+	     *string_object ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to set interned string: %" PRIu32 ".",
+		 function,
+		 string_identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_record_by_index(
+           PyObject *pyevtx_file,
+           int record_index )
+{
+	PyObject *record_object  = NULL;
+	libcerror_error_t *error = NULL;
+	libevtx_record_t *record = NULL;
+	static char *function    = "pyevtx_file_get_record_by_index";
+	int result               = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_file );
+
+	result = pyevtx_file_get_batched_record_by_index(
+	          (pyevtx_file_t *) pyevtx_file,
+	          record_index,
+	          &record,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	record_object = pyevtx_record_new(
+	                 record,
+	                 pyevtx_file );
+
+	if( record_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create record object.",
+		 function );
+
+		goto on_error;
+	}
+	return( record_object );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_record(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *record_object     = NULL;
+	static char *keyword_list[] = { "record_index", NULL };
+	int record_index            = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &record_index ) == 0 )
+	{
+		return( NULL );
+	}
+	record_object = pyevtx_file_get_record_by_index(
+	                 (PyObject *) pyevtx_file,
+	                 record_index );
+
+	return( record_object );
+}
+
+/* Retrieves a specific record by event record identifier
+ * Returns a Python object if successful, Py_None if not available or NULL on error
+ */
+PyObject *pyevtx_file_get_record_by_identifier(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *record_object       = NULL;
+	libcerror_error_t *error      = NULL;
+	libevtx_record_t *record      = NULL;
+	static char *keyword_list[]   = { "identifier", NULL };
+	static char *function         = "pyevtx_file_get_record_by_identifier";
+	unsigned long long identifier = 0;
+	int result                    = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &identifier ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_record_by_identifier(
+	          pyevtx_file->file,
+	          (uint64_t) identifier,
+	          &record,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record: %" PRIu64 ".",
+		 function,
+		 (uint64_t) identifier );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	record_object = pyevtx_record_new(
+	                 record,
+	                 (PyObject *) pyevtx_file );
+
+	if( record_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create record object.",
+		 function );
+
+		libevtx_record_free(
+		 &record,
+		 NULL );
+
+		return( NULL );
+	}
+	return( record_object );
+}
+
+/* Retrieves a sequence and iterator object for the records
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_records(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object = NULL;
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pyevtx_file_get_records";
+	int number_of_records     = 0;
+	int result                = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_records(
+	          pyevtx_file->file,
+	          &number_of_records,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyevtx_records_new(
+	                   (PyObject *) pyevtx_file,
+	                   &pyevtx_file_get_record_by_index,
+	                   number_of_records );
+
+	if( sequence_object == NULL )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
 }
 
 /* Retrieves the number of recovered records
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_get_number_of_recovered_records(
+PyObject *pyevtx_file_get_number_of_recovered_records(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyevtx_file_get_number_of_recovered_records";
+	int number_of_records    = 0;
+	int result               = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_recovered_records(
+	          pyevtx_file->file,
+	          &number_of_records,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_records );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_records );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific recovered record by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_recovered_record_by_index(
+           PyObject *pyevtx_file,
+           int record_index )
+{
+	PyObject *record_object  = NULL;
+	libcerror_error_t *error = NULL;
+	libevtx_record_t *record = NULL;
+	static char *function    = "pyevtx_file_get_recovered_record_by_index";
+	int result               = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_file );
+
+	result = libevtx_file_get_recovered_record_by_index(
+	          ( (pyevtx_file_t *) pyevtx_file )->file,
+	          record_index,
+	          &record,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve recovered record: %d.",
+		 function,
+		 record_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	record_object = pyevtx_record_new(
+	                 record,
+	                 (PyObject *) pyevtx_file );
+
+	if( record_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create recovered record object.",
+		 function );
+
+		goto on_error;
+	}
+	return( record_object );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific recovered record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_recovered_record(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *record_object     = NULL;
+	static char *keyword_list[] = { "record_index", NULL };
+	int record_index            = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &record_index ) == 0 )
+	{
+		return( NULL );
+	}
+	record_object = pyevtx_file_get_recovered_record_by_index(
+	                 (PyObject *) pyevtx_file,
+	                 record_index );
+
+	return( record_object );
+}
+
+/* Retrieves a sequence and iterator object for the recovered records
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_recovered_records(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object = NULL;
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pyevtx_file_get_recovered_records";
+	int number_of_records     = 0;
+	int result                = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_recovered_records(
+	          pyevtx_file->file,
+	          &number_of_records,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyevtx_records_new(
+	                   (PyObject *) pyevtx_file,
+	                   &pyevtx_file_get_recovered_record_by_index,
+	                   number_of_records );
+
+	if( sequence_object == NULL )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
+}
+
+/* Fills the columns with the values of the records
+ * This function does not require the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_file_fill_columns(
+     pyevtx_file_t *pyevtx_file,
+     pyevtx_column_t **columns,
+     int number_of_columns,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *records[ PYEVTX_FILE_RECORDS_BATCH_SIZE ];
+
+	static char *function       = "pyevtx_file_fill_columns";
+	int batch_index             = 0;
+	int batch_number_of_records = 0;
+	int column_index            = 0;
+	int record_index            = 0;
+	int result                  = 1;
+
+	if( pyevtx_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     records,
+	     0,
+	     sizeof( libevtx_record_t * ) * PYEVTX_FILE_RECORDS_BATCH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index += batch_number_of_records )
+	{
+		batch_number_of_records = number_of_records - record_index;
+
+		if( batch_number_of_records > PYEVTX_FILE_RECORDS_BATCH_SIZE )
+		{
+			batch_number_of_records = PYEVTX_FILE_RECORDS_BATCH_SIZE;
+		}
+		if( libevtx_file_get_records_by_range(
+		     pyevtx_file->file,
+		     record_index,
+		     batch_number_of_records,
+		     records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records: %d - %d.",
+			 function,
+			 record_index,
+			 record_index + batch_number_of_records - 1 );
+
+			return( -1 );
+		}
+		for( batch_index = 0;
+		     batch_index < batch_number_of_records;
+		     batch_index++ )
+		{
+			for( column_index = 0;
+			     ( result == 1 ) && ( column_index < number_of_columns );
+			     column_index++ )
+			{
+				if( pyevtx_column_set_value_from_record(
+				     columns[ column_index ],
+				     record_index + batch_index,
+				     records[ batch_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set column: %d value: %d.",
+					 function,
+					 column_index,
+					 record_index + batch_index );
+
+					result = -1;
+				}
+			}
+			if( libevtx_record_free(
+			     &( records[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record: %d.",
+				 function,
+				 record_index + batch_index );
+
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the values of the records as columns
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_to_columns(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyevtx_column_t *columns[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ];
+	int fields[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ];
+
+	PyObject *column_object     = NULL;
+	PyObject *dictionary_object = NULL;
+	PyObject *fields_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevtx_file_to_columns";
+	static char *keyword_list[] = { "fields", NULL };
+	int column_index            = 0;
+	int number_of_columns       = 0;
+	int number_of_fields        = 0;
+	int number_of_records       = 0;
+	int result                  = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &fields_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( memory_set(
+	     columns,
+	     0,
+	     sizeof( pyevtx_column_t * ) * PYEVTX_COLUMN_NUMBER_OF_FIELDS ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear columns.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_records(
+	          pyevtx_file->file,
+	          &number_of_records,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( pyevtx_column_get_fields_from_object(
+	     fields_object,
+	     fields,
+	     &number_of_fields ) != 1 )
+	{
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < number_of_fields;
+	     column_index++ )
+	{
+		if( pyevtx_column_initialize(
+		     &( columns[ column_index ] ),
+		     fields[ column_index ],
+		     number_of_records,
+		     &error ) != 1 )
+		{
+			pyevtx_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to create column: %s.",
+			 function,
+			 pyevtx_column_field_names[ fields[ column_index ] ] );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		number_of_columns++;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = pyevtx_file_fill_columns(
+	          pyevtx_file,
+	          columns,
+	          number_of_columns,
+	          number_of_records,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve values of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < number_of_columns;
+	     column_index++ )
+	{
+		column_object = pyevtx_column_get_object(
+		                 columns[ column_index ] );
+
+		if( column_object == NULL )
+		{
+			goto on_error;
+		}
+		result = PyDict_SetItemString(
+		          dictionary_object,
+		          pyevtx_column_field_names[ columns[ column_index ]->field ],
+		          column_object );
+
+		Py_DecRef(
+		 column_object );
+
+		if( result != 0 )
+		{
+			goto on_error;
+		}
+		pyevtx_column_free(
+		 &( columns[ column_index ] ),
+		 NULL );
+	}
+	return( dictionary_object );
+
+on_error:
+	for( column_index = 0;
+	     column_index < PYEVTX_COLUMN_NUMBER_OF_FIELDS;
+	     column_index++ )
+	{
+		if( columns[ column_index ] != NULL )
+		{
+			pyevtx_column_free(
+			 &( columns[ column_index ] ),
+			 NULL );
+		}
+	}
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves an iterator that yields the records in a single forward pass
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_iter_records(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *stream_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevtx_file_iter_records";
+	static char *keyword_list[] = { "batch_size", NULL };
+	int batch_size              = PYEVTX_RECORD_STREAM_DEFAULT_BATCH_SIZE;
+	int number_of_records       = 0;
+	int result                  = 0;
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|i",
+	     keyword_list,
+	     &batch_size ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_records(
+	          pyevtx_file->file,
+	          &number_of_records,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	stream_object = pyevtx_record_stream_new(
+	                 (PyObject *) pyevtx_file,
+	                 number_of_records,
+	                 batch_size,
+	                 NULL,
+	                 0,
+	                 0 );
+
+	return( stream_object );
+}
+
+/* Retrieves an iterator that yields a dictionary of the field values per record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_iter_dicts(
            pyevtx_file_t *pyevtx_file,
-           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+           PyObject *arguments,
+           PyObject *keywords )
 {
-	PyObject *integer_object = NULL;
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyevtx_file_get_number_of_recovered_records";
-	int number_of_records    = 0;
-	int result               = 0;
+	int fields[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ];
 
-	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+	PyObject *fields_object     = NULL;
+	PyObject *stream_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevtx_file_iter_dicts";
+	static char *keyword_list[] = { "fields", "batch_size", NULL };
+	int batch_size              = PYEVTX_RECORD_STREAM_DEFAULT_BATCH_SIZE;
+	int number_of_fields        = 0;
+	int number_of_records       = 0;
+	int result                  = 0;
 
 	if( pyevtx_file == NULL )
 	{
@@ -1528,13 +3791,36 @@ PyObject *pyevtx_file_get_number_of_recovered_records(
 
 		return( NULL );
 	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|Oi",
+	     keyword_list,
+	     &fields_object,
+	     &batch_size ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyevtx_column_get_fields_from_object(
+	     fields_object,
+	     fields,
+	     &number_of_fields ) != 1 )
+	{
+		return( NULL );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_file_get_number_of_recovered_records(
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_records(
 	          pyevtx_file->file,
 	          &number_of_records,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1542,7 +3828,7 @@ PyObject *pyevtx_file_get_number_of_recovered_records(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of recovered records.",
+		 "%s: unable to retrieve number of records.",
 		 function );
 
 		libcerror_error_free(
@@ -1550,28 +3836,34 @@ PyObject *pyevtx_file_get_number_of_recovered_records(
 
 		return( NULL );
 	}
-#if PY_MAJOR_VERSION >= 3
-	integer_object = PyLong_FromLong(
-	                  (long) number_of_records );
-#else
-	integer_object = PyInt_FromLong(
-	                  (long) number_of_records );
-#endif
-	return( integer_object );
+	stream_object = pyevtx_record_stream_new(
+	                 (PyObject *) pyevtx_file,
+	                 number_of_records,
+	                 batch_size,
+	                 fields,
+	                 number_of_fields,
+	                 1 );
+
+	return( stream_object );
 }
 
-/* Retrieves a specific recovered record by index
+/* Retrieves the written times of all records
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_get_recovered_record_by_index(
-           PyObject *pyevtx_file,
-           int record_index )
+PyObject *pyevtx_file_written_times(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords )
 {
-	PyObject *record_object  = NULL;
-	libcerror_error_t *error = NULL;
-	libevtx_record_t *record = NULL;
-	static char *function    = "pyevtx_file_get_recovered_record_by_index";
-	int result               = 0;
+	PyObject *array_object         = NULL;
+	PyObject *as_datetime64_object = NULL;
+	libcerror_error_t *error       = NULL;
+	pyevtx_column_t *column        = NULL;
+	static char *function          = "pyevtx_file_written_times";
+	static char *keyword_list[]    = { "as_datetime64", NULL };
+	int as_datetime64              = 0;
+	int number_of_records          = 0;
+	int result                     = 0;
 
 	if( pyevtx_file == NULL )
 	{
@@ -1582,14 +3874,38 @@ PyObject *pyevtx_file_get_recovered_record_by_index(
 
 		return( NULL );
 	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &as_datetime64_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( as_datetime64_object != NULL )
+	{
+		as_datetime64 = PyObject_IsTrue(
+		                 as_datetime64_object );
+
+		if( as_datetime64 == -1 )
+		{
+			return( NULL );
+		}
+	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_file_get_recovered_record_by_index(
-	          ( (pyevtx_file_t *) pyevtx_file )->file,
-	          record_index,
-	          &record,
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_number_of_records(
+	          pyevtx_file->file,
+	          &number_of_records,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1597,80 +3913,166 @@ PyObject *pyevtx_file_get_recovered_record_by_index(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve recovered record: %d.",
-		 function,
-		 record_index );
+		 "%s: unable to retrieve number of records.",
+		 function );
 
 		libcerror_error_free(
 		 &error );
 
 		goto on_error;
 	}
-	record_object = pyevtx_record_new(
-	                 record,
-	                 (PyObject *) pyevtx_file );
-
-	if( record_object == NULL )
+	if( pyevtx_column_initialize(
+	     &column,
+	     PYEVTX_COLUMN_FIELD_WRITTEN_TIME,
+	     number_of_records,
+	     &error ) != 1 )
 	{
-		PyErr_Format(
+		pyevtx_error_raise(
+		 error,
 		 PyExc_MemoryError,
-		 "%s: unable to create recovered record object.",
+		 "%s: unable to create column.",
 		 function );
 
+		libcerror_error_free(
+		 &error );
+
 		goto on_error;
 	}
-	return( record_object );
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = pyevtx_file_fill_columns(
+	          pyevtx_file,
+	          &column,
+	          1,
+	          number_of_records,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve written times of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( as_datetime64 != 0 )
+	{
+		array_object = pyevtx_column_get_datetime64_object(
+		                column );
+	}
+	else
+	{
+		array_object = pyevtx_column_get_object(
+		                column );
+	}
+	pyevtx_column_free(
+	 &column,
+	 NULL );
+
+	return( array_object );
 
 on_error:
-	if( record != NULL )
+	if( column != NULL )
 	{
-		libevtx_record_free(
-		 &record,
+		pyevtx_column_free(
+		 &column,
 		 NULL );
 	}
 	return( NULL );
 }
 
-/* Retrieves a specific recovered record
- * Returns a Python object if successful or NULL on error
+
+/* Sets the index data from a bytes-like object
+ * The index data is copied hence the object does not need to be retained
+ * Returns 1 if successful or -1 on error
  */
-PyObject *pyevtx_file_get_recovered_record(
-           pyevtx_file_t *pyevtx_file,
-           PyObject *arguments,
-           PyObject *keywords )
+int pyevtx_file_set_index_data(
+     pyevtx_file_t *pyevtx_file,
+     PyObject *index_object )
 {
-	PyObject *record_object     = NULL;
-	static char *keyword_list[] = { "record_index", NULL };
-	int record_index            = 0;
+	Py_buffer index_buffer;
 
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
-	     keyword_list,
-	     &record_index ) == 0 )
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyevtx_file_set_index_data";
+	int result               = 0;
+
+	if( pyevtx_file == NULL )
 	{
-		return( NULL );
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	record_object = pyevtx_file_get_recovered_record_by_index(
-	                 (PyObject *) pyevtx_file,
-	                 record_index );
+	if( PyObject_GetBuffer(
+	     index_object,
+	     &index_buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( -1 );
+	}
+	Py_BEGIN_ALLOW_THREADS
 
-	return( record_object );
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_set_index_data(
+	          pyevtx_file->file,
+	          (const uint8_t *) index_buffer.buf,
+	          (size_t) index_buffer.len,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &index_buffer );
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set index data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Retrieves a sequence and iterator object for the recovered records
+/* Retrieves the index data
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyevtx_file_get_recovered_records(
+PyObject *pyevtx_file_get_index_data(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
-	PyObject *sequence_object = NULL;
-	libcerror_error_t *error  = NULL;
-	static char *function     = "pyevtx_file_get_recovered_records";
-	int number_of_records     = 0;
-	int result                = 0;
+	PyObject *bytes_object   = NULL;
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	static char *function    = "pyevtx_file_get_index_data";
+	size_t data_size         = 0;
+	int result               = 0;
 
 	PYEVTX_UNREFERENCED_PARAMETER( arguments )
 
@@ -1685,11 +4087,17 @@ PyObject *pyevtx_file_get_recovered_records(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_file_get_number_of_recovered_records(
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_index_data_size(
 	          pyevtx_file->file,
-	          &number_of_records,
+	          &data_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1697,7 +4105,7 @@ PyObject *pyevtx_file_get_recovered_records(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of recovered records.",
+		 "%s: unable to retrieve index data size.",
 		 function );
 
 		libcerror_error_free(
@@ -1705,21 +4113,71 @@ PyObject *pyevtx_file_get_recovered_records(
 
 		return( NULL );
 	}
-	sequence_object = pyevtx_records_new(
-	                   (PyObject *) pyevtx_file,
-	                   &pyevtx_file_get_recovered_record_by_index,
-	                   number_of_records );
+	if( data_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
-	if( sequence_object == NULL )
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) data_size );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) data_size );
+#endif
+	if( bytes_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create Bytes object.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	data = (uint8_t *) PyBytes_AS_STRING(
+	                    bytes_object );
+#else
+	data = (uint8_t *) PyString_AS_STRING(
+	                    bytes_object );
+#endif
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 pyevtx_file );
+
+	result = libevtx_file_get_index_data(
+	          pyevtx_file->file,
+	          data,
+	          data_size,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 pyevtx_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyevtx_error_raise(
 		 error,
-		 PyExc_MemoryError,
-		 "%s: unable to create sequence object.",
+		 PyExc_IOError,
+		 "%s: unable to retrieve index data.",
 		 function );
 
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 bytes_object );
+
 		return( NULL );
 	}
-	return( sequence_object );
+	return( bytes_object );
 }
-
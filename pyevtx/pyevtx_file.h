@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "pyevtx_columns.h"
 #include "pyevtx_libbfio.h"
+#include "pyevtx_libcerror.h"
 #include "pyevtx_libevtx.h"
 #include "pyevtx_python.h"
 
@@ -33,6 +35,11 @@
 extern "C" {
 #endif
 
+/* The maximum number of records retrieved at once when the records
+ * are retrieved in sequence
+ */
+#define PYEVTX_FILE_RECORDS_BATCH_SIZE	64
+
 typedef struct pyevtx_file pyevtx_file_t;
 
 struct pyevtx_file
@@ -48,6 +55,40 @@ struct pyevtx_file
 	/* The libbfio file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
+
+	/* The data buffer of a file opened from a bytes-like object
+	 */
+	Py_buffer data_buffer;
+
+	/* Value to indicate the data buffer is held
+	 */
+	uint8_t data_buffer_is_set;
+
+	/* The records batch
+	 */
+	libevtx_record_t *records_batch[ PYEVTX_FILE_RECORDS_BATCH_SIZE ];
+
+	/* The index of the first record in the records batch
+	 */
+	int records_batch_first_index;
+
+	/* The number of records in the records batch
+	 */
+	int records_batch_number_of_records;
+
+	/* The index of the last retrieved record
+	 */
+	int last_record_index;
+
+	/* The interned strings
+	 * A list of Unicode objects indexed by the string identifier of the interned string
+	 */
+	PyObject *interned_strings;
+
+	/* The lock that serializes the access to the libevtx file and its records
+	 * while the GIL is released
+	 */
+	PyThread_type_lock lock;
 };
 
 extern PyMethodDef pyevtx_file_object_methods[];
@@ -59,6 +100,12 @@ int pyevtx_file_init(
 void pyevtx_file_free(
       pyevtx_file_t *pyevtx_file );
 
+void pyevtx_file_grab_lock(
+      pyevtx_file_t *pyevtx_file );
+
+void pyevtx_file_release_lock(
+      pyevtx_file_t *pyevtx_file );
+
 PyObject *pyevtx_file_signal_abort(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
@@ -73,10 +120,19 @@ PyObject *pyevtx_file_open_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyevtx_file_open_bytes(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyevtx_file_close(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
 
+PyObject *pyevtx_file_refresh(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments );
+
 PyObject *pyevtx_file_is_corrupted(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
@@ -99,14 +155,43 @@ int pyevtx_file_set_ascii_codepage_setter(
      PyObject *string_object,
      void *closure );
 
+PyObject *pyevtx_file_set_cache_limits(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyevtx_file_get_format_version(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
 
+PyObject *pyevtx_file_get_memory_usage(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments );
+
 PyObject *pyevtx_file_get_number_of_records(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
 
+int pyevtx_file_free_records_batch(
+     pyevtx_file_t *pyevtx_file,
+     libcerror_error_t **error );
+
+int pyevtx_file_get_batched_record_by_index(
+     pyevtx_file_t *pyevtx_file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int pyevtx_file_get_interned_string_object(
+     pyevtx_file_t *pyevtx_file,
+     uint32_t string_identifier,
+     PyObject **string_object );
+
+int pyevtx_file_set_interned_string_object(
+     pyevtx_file_t *pyevtx_file,
+     uint32_t string_identifier,
+     PyObject **string_object );
+
 PyObject *pyevtx_file_get_record_by_index(
            PyObject *pyevtx_file,
            int record_index );
@@ -116,6 +201,25 @@ PyObject *pyevtx_file_get_record(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyevtx_file_get_number_of_chunks(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments );
+
+int pyevtx_file_set_dictionary_unsigned_integer(
+     PyObject *dictionary_object,
+     const char *key,
+     uint64_t value_64bit );
+
+PyObject *pyevtx_file_get_chunk_information(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyevtx_file_get_record_by_identifier(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyevtx_file_get_records(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
@@ -137,6 +241,41 @@ PyObject *pyevtx_file_get_recovered_records(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
 
+int pyevtx_file_fill_columns(
+     pyevtx_file_t *pyevtx_file,
+     pyevtx_column_t **columns,
+     int number_of_columns,
+     int number_of_records,
+     libcerror_error_t **error );
+
+PyObject *pyevtx_file_to_columns(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyevtx_file_written_times(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+int pyevtx_file_set_index_data(
+     pyevtx_file_t *pyevtx_file,
+     PyObject *index_object );
+
+PyObject *pyevtx_file_get_index_data(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments );
+
+PyObject *pyevtx_file_iter_records(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyevtx_file_iter_dicts(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -23,6 +23,14 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "pyevtx_error.h"
 #include "pyevtx_file_object_io_handle.h"
 #include "pyevtx_integer.h"
@@ -30,6 +38,10 @@
 #include "pyevtx_libcerror.h"
 #include "pyevtx_python.h"
 
+#if defined( HAVE_FSTAT ) && defined( HAVE_PREAD ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#define HAVE_PYEVTX_NATIVE_FILE_IO
+#endif
+
 /* Creates a file object IO handle
  * Make sure the value file_object_io_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -102,7 +114,8 @@ int pyevtx_file_object_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *file_object_io_handle )->file_object = file_object;
+	( *file_object_io_handle )->file_object     = file_object;
+	( *file_object_io_handle )->file_descriptor = -1;
 
 	Py_IncRef(
 	 ( *file_object_io_handle )->file_object );
@@ -235,6 +248,11 @@ int pyevtx_file_object_io_handle_free(
 		PyGILState_Release(
 		 gil_state );
 
+		if( ( *file_object_io_handle )->read_buffer != NULL )
+		{
+			memory_free(
+			 ( *file_object_io_handle )->read_buffer );
+		}
 		PyMem_Free(
 		 *file_object_io_handle );
 
@@ -317,7 +335,9 @@ int pyevtx_file_object_io_handle_open(
      int access_flags,
      libcerror_error_t **error )
 {
-	static char *function = "pyevtx_file_object_io_handle_open";
+	static char *function      = "pyevtx_file_object_io_handle_open";
+	PyGILState_STATE gil_state = 0;
+	int result                 = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -364,11 +384,70 @@ int pyevtx_file_object_io_handle_open(
 
 		return( -1 );
 	}
-	/* No need to do anything here, because the file object is already open
+	/* The file object is already open, determine how it can be read
 	 */
+	gil_state = PyGILState_Ensure();
+
+	if( pyevtx_file_object_get_offset(
+	     file_object_io_handle->file_object,
+	     &( file_object_io_handle->file_object_offset ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to retrieve current offset in file object.",
+		 function );
+
+		goto on_error;
+	}
+	file_object_io_handle->current_offset        = file_object_io_handle->file_object_offset;
+	file_object_io_handle->file_descriptor       = -1;
+	file_object_io_handle->read_buffer_offset    = 0;
+	file_object_io_handle->read_buffer_data_size = 0;
+
+	result = pyevtx_file_object_get_file_descriptor(
+	          file_object_io_handle->file_object,
+	          &( file_object_io_handle->file_descriptor ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file descriptor of file object.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		file_object_io_handle->file_descriptor = -1;
+	}
+#if PY_MAJOR_VERSION >= 3
+	result = PyObject_HasAttrString(
+	          file_object_io_handle->file_object,
+	          "readinto" );
+
+	file_object_io_handle->has_readinto = (uint8_t) ( result != 0 );
+#else
+	file_object_io_handle->has_readinto = 0;
+#endif
+	PyGILState_Release(
+	 gil_state );
+
 	file_object_io_handle->access_flags = access_flags;
 
 	return( 1 );
+
+on_error:
+	PyGILState_Release(
+	 gil_state );
+
+	return( -1 );
 }
 
 /* Closes the file object IO handle
@@ -404,9 +483,162 @@ int pyevtx_file_object_io_handle_close(
 	}
 	/* Do not close the file object, have Python deal with it
 	 */
-	file_object_io_handle->access_flags = 0;
+	file_object_io_handle->access_flags          = 0;
+	file_object_io_handle->file_descriptor       = -1;
+	file_object_io_handle->read_buffer_data_size = 0;
+
+	return( 0 );
+}
+
+/* Retrieves the file descriptor of the regular file backing the file object
+ * Only io.FileIO and io.BufferedReader objects, or file objects on Python 2,
+ * are considered since other objects can return the descriptor of data they wrap
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int pyevtx_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_PYEVTX_NATIVE_FILE_IO )
+	struct stat file_statistics;
+
+	PyObject *file_io_type      = NULL;
+	PyObject *buffered_io_type  = NULL;
+	PyObject *io_module         = NULL;
+	PyObject *method_result     = NULL;
+	long safe_file_descriptor   = 0;
+	int result                  = 0;
+#endif
+	static char *function       = "pyevtx_file_object_get_file_descriptor";
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PYEVTX_NATIVE_FILE_IO )
+#if PY_MAJOR_VERSION < 3
+	result = PyFile_Check(
+	          file_object );
+#endif
+	if( result == 0 )
+	{
+		io_module = PyImport_ImportModule(
+		             "io" );
+
+		if( io_module == NULL )
+		{
+			PyErr_Clear();
+
+			return( 0 );
+		}
+		file_io_type = PyObject_GetAttrString(
+		                io_module,
+		                "FileIO" );
+
+		buffered_io_type = PyObject_GetAttrString(
+		                    io_module,
+		                    "BufferedReader" );
+
+		Py_DecRef(
+		 io_module );
+
+		if( ( file_io_type != NULL )
+		 && ( buffered_io_type != NULL ) )
+		{
+			result = PyObject_IsInstance(
+			          file_object,
+			          file_io_type );
+
+			if( result == 0 )
+			{
+				result = PyObject_IsInstance(
+				          file_object,
+				          buffered_io_type );
+			}
+		}
+		if( file_io_type != NULL )
+		{
+			Py_DecRef(
+			 file_io_type );
+		}
+		if( buffered_io_type != NULL )
+		{
+			Py_DecRef(
+			 buffered_io_type );
+		}
+		if( result != 1 )
+		{
+			PyErr_Clear();
+
+			return( 0 );
+		}
+	}
+	method_result = PyObject_CallMethod(
+	                 file_object,
+	                 "fileno",
+	                 NULL );
+
+	if( method_result == NULL )
+	{
+		/* The file object is not backed by a file descriptor
+		 */
+		PyErr_Clear();
+
+		return( 0 );
+	}
+	safe_file_descriptor = PyLong_AsLong(
+	                        method_result );
+
+	Py_DecRef(
+	 method_result );
 
+	if( PyErr_Occurred() )
+	{
+		PyErr_Clear();
+
+		return( 0 );
+	}
+	if( ( safe_file_descriptor < 0 )
+	 || ( safe_file_descriptor > (long) INT_MAX ) )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     (int) safe_file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( S_ISREG( file_statistics.st_mode ) == 0 )
+	{
+		return( 0 );
+	}
+	*file_descriptor = (int) safe_file_descriptor;
+
+	return( 1 );
+#else
 	return( 0 );
+#endif
 }
 
 /* Reads a buffer from the file object
@@ -613,7 +845,191 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a buffer from the file object using its readinto method
+ * Make sure to hold the GIL state before calling this function
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t pyevtx_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	PyObject *argument_buffer  = NULL;
+	PyObject *method_name      = NULL;
+	PyObject *method_result    = NULL;
+	static char *function      = "pyevtx_file_object_readinto_buffer";
+	Py_ssize_t safe_read_count = 0;
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	method_name = PyUnicode_FromString(
+	               "readinto" );
+
+	/* The memory view references the buffer, so the data is not copied
+	 */
+	argument_buffer = PyMemoryView_FromMemory(
+	                   (char *) buffer,
+	                   (Py_ssize_t) size,
+	                   PyBUF_WRITE );
+
+	if( argument_buffer == NULL )
+	{
+		pyevtx_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory view of buffer.",
+		 function );
+
+		goto on_error;
+	}
+	PyErr_Clear();
+
+	method_result = PyObject_CallMethodObjArgs(
+	                 file_object,
+	                 method_name,
+	                 argument_buffer,
+	                 NULL );
+
+	if( PyErr_Occurred() )
+	{
+		pyevtx_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file object.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( method_result == NULL )
+	 || ( method_result == Py_None ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing method result.",
+		 function );
+
+		goto on_error;
+	}
+	safe_read_count = PyLong_AsSsize_t(
+	                   method_result );
+
+	if( PyErr_Occurred() )
+	{
+		pyevtx_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to convert method result into read count.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_read_count < 0 )
+	 || ( (size_t) safe_read_count > size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read count value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	Py_DecRef(
+	 method_result );
+
+	Py_DecRef(
+	 argument_buffer );
+
+	Py_DecRef(
+	 method_name );
+
+	return( (ssize_t) safe_read_count );
+
+on_error:
+	if( method_result != NULL )
+	{
+		Py_DecRef(
+		 method_result );
+	}
+	if( argument_buffer != NULL )
+	{
+		/* Make sure the file object no longer references the buffer
+		 */
+		PyObject_CallMethod(
+		 argument_buffer,
+		 "release",
+		 NULL );
+
+		PyErr_Clear();
+
+		Py_DecRef(
+		 argument_buffer );
+	}
+	if( method_name != NULL )
+	{
+		Py_DecRef(
+		 method_name );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: readinto not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
 /* Reads a buffer from the file object IO handle
+ * Regular files are read using their file descriptor without holding the GIL,
+ * other file objects are read via a read-ahead buffer to reduce the number of
+ * Python method calls
  * Returns the number of bytes read if successful, or -1 on error
  */
 ssize_t pyevtx_file_object_io_handle_read(
@@ -622,9 +1038,14 @@ ssize_t pyevtx_file_object_io_handle_read(
          size_t size,
          libcerror_error_t **error )
 {
+	uint8_t *read_buffer       = NULL;
 	static char *function      = "pyevtx_file_object_io_handle_read";
 	PyGILState_STATE gil_state = 0;
+	size_t buffer_offset       = 0;
+	size_t read_size           = 0;
 	ssize_t read_count         = 0;
+	off64_t read_buffer_offset = 0;
+	uint8_t has_gil_state      = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -637,34 +1058,210 @@ ssize_t pyevtx_file_object_io_handle_read(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	read_count = pyevtx_file_object_read_buffer(
-	              file_object_io_handle->file_object,
-	              buffer,
-	              size,
-	              error );
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	if( read_count == -1 )
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	PyGILState_Release(
-	 gil_state );
+#if defined( HAVE_PYEVTX_NATIVE_FILE_IO )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		while( buffer_offset < size )
+		{
+			read_count = pread(
+			              file_object_io_handle->file_descriptor,
+			              &( buffer[ buffer_offset ] ),
+			              size - buffer_offset,
+			              (off_t) file_object_io_handle->current_offset );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file descriptor.",
+				 function );
+
+				return( -1 );
+			}
+			if( read_count == 0 )
+			{
+				break;
+			}
+			file_object_io_handle->current_offset += read_count;
+
+			buffer_offset += (size_t) read_count;
+		}
+		return( (ssize_t) buffer_offset );
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		read_buffer_offset = file_object_io_handle->current_offset - file_object_io_handle->read_buffer_offset;
 
-	return( read_count );
+		if( ( file_object_io_handle->read_buffer_data_size > 0 )
+		 && ( read_buffer_offset >= 0 )
+		 && ( (size_t) read_buffer_offset < file_object_io_handle->read_buffer_data_size ) )
+		{
+			read_size = file_object_io_handle->read_buffer_data_size - (size_t) read_buffer_offset;
+
+			if( read_size > ( size - buffer_offset ) )
+			{
+				read_size = size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( file_object_io_handle->read_buffer[ read_buffer_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+			file_object_io_handle->current_offset += read_size;
+
+			buffer_offset += read_size;
+
+			continue;
+		}
+		if( has_gil_state == 0 )
+		{
+			gil_state = PyGILState_Ensure();
 
-on_error:
-	PyGILState_Release(
-	 gil_state );
+			has_gil_state = 1;
+		}
+		if( file_object_io_handle->file_object_offset != file_object_io_handle->current_offset )
+		{
+			if( pyevtx_file_object_seek_offset(
+			     file_object_io_handle->file_object,
+			     file_object_io_handle->current_offset,
+			     SEEK_SET,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek in file object.",
+				 function );
+
+				goto on_error;
+			}
+			file_object_io_handle->file_object_offset = file_object_io_handle->current_offset;
+		}
+		/* Large reads bypass the read-ahead buffer
+		 */
+		read_size = size - buffer_offset;
 
+		if( read_size >= PYEVTX_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE )
+		{
+			read_buffer = &( buffer[ buffer_offset ] );
+		}
+		else
+		{
+			if( file_object_io_handle->read_buffer == NULL )
+			{
+				file_object_io_handle->read_buffer = (uint8_t *) memory_allocate(
+				                                                  sizeof( uint8_t ) * PYEVTX_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE );
+
+				if( file_object_io_handle->read_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create read-ahead buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			file_object_io_handle->read_buffer_data_size = 0;
+
+			read_buffer = file_object_io_handle->read_buffer;
+			read_size   = PYEVTX_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE;
+		}
+		if( file_object_io_handle->has_readinto != 0 )
+		{
+			read_count = pyevtx_file_object_readinto_buffer(
+			              file_object_io_handle->file_object,
+			              read_buffer,
+			              read_size,
+			              error );
+		}
+		else
+		{
+			read_count = pyevtx_file_object_read_buffer(
+			              file_object_io_handle->file_object,
+			              read_buffer,
+			              read_size,
+			              error );
+		}
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file object.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		file_object_io_handle->file_object_offset += read_count;
+
+		if( read_buffer == file_object_io_handle->read_buffer )
+		{
+			file_object_io_handle->read_buffer_offset    = file_object_io_handle->current_offset;
+			file_object_io_handle->read_buffer_data_size = (size_t) read_count;
+		}
+		else
+		{
+			file_object_io_handle->current_offset += read_count;
+
+			buffer_offset += (size_t) read_count;
+		}
+	}
+	if( has_gil_state != 0 )
+	{
+		PyGILState_Release(
+		 gil_state );
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( has_gil_state != 0 )
+	{
+		PyGILState_Release(
+		 gil_state );
+	}
 	return( -1 );
 }
 
@@ -1130,6 +1727,7 @@ on_error:
 }
 
 /* Seeks a certain offset within the file object IO handle
+ * The file object itself is only repositioned when data is read from it
  * Returns the offset if the seek is successful or -1 on error
  */
 off64_t pyevtx_file_object_io_handle_seek_offset(
@@ -1138,8 +1736,8 @@ off64_t pyevtx_file_object_io_handle_seek_offset(
          int whence,
          libcerror_error_t **error )
 {
-	static char *function      = "pyevtx_file_object_io_handle_seek_offset";
-	PyGILState_STATE gil_state = 0;
+	static char *function = "pyevtx_file_object_io_handle_seek_offset";
+	size64_t size         = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -1152,47 +1750,55 @@ off64_t pyevtx_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	if( pyevtx_file_object_seek_offset(
-	     file_object_io_handle->file_object,
-	     offset,
-	     whence,
-	     error ) != 1 )
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek in file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( pyevtx_file_object_get_offset(
-	     file_object_io_handle->file_object,
-	     &offset,
-	     error ) != 1 )
+	if( whence == SEEK_CUR )
+	{
+		offset += file_object_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( pyevtx_file_object_io_handle_get_size(
+		     file_object_io_handle,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of file object.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to retrieve current offset in file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	PyGILState_Release(
-	 gil_state );
+	file_object_io_handle->current_offset = offset;
 
 	return( offset );
-
-on_error:
-	PyGILState_Release(
-	 gil_state );
-
-	return( -1 );
 }
 
 /* Function to determine if a file exists
@@ -1373,6 +1979,10 @@ int pyevtx_file_object_io_handle_get_size(
      size64_t *size,
      libcerror_error_t **error )
 {
+#if defined( HAVE_PYEVTX_NATIVE_FILE_IO )
+	struct stat file_statistics;
+#endif
+
 	PyObject *method_name      = NULL;
 	static char *function      = "pyevtx_file_object_io_handle_get_size";
 	PyGILState_STATE gil_state = 0;
@@ -1401,6 +2011,38 @@ int pyevtx_file_object_io_handle_get_size(
 
 		return( -1 );
 	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PYEVTX_NATIVE_FILE_IO )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( fstat(
+		     file_object_io_handle->file_descriptor,
+		     &file_statistics ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file statistics.",
+			 function );
+
+			return( -1 );
+		}
+		*size = (size64_t) file_statistics.st_size;
+
+		return( 1 );
+	}
+#endif
 	gil_state = PyGILState_Ensure();
 
 #if PY_MAJOR_VERSION >= 3
@@ -33,6 +33,11 @@
 extern "C" {
 #endif
 
+/* The size of the read-ahead buffer used for file objects that are read
+ * using Python method calls
+ */
+#define PYEVTX_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE	( 16 * 65536 )
+
 typedef struct pyevtx_file_object_io_handle pyevtx_file_object_io_handle_t;
 
 struct pyevtx_file_object_io_handle
@@ -44,6 +49,35 @@ struct pyevtx_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The file descriptor of the regular file backing the file object
+	 * Contains -1 if the file object has to be read using Python method calls
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file object has a readinto method
+	 */
+	uint8_t has_readinto;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The current offset of the file object
+	 */
+	off64_t file_object_offset;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t read_buffer_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t read_buffer_data_size;
 };
 
 int pyevtx_file_object_io_handle_initialize(
@@ -74,12 +108,23 @@ int pyevtx_file_object_io_handle_close(
      pyevtx_file_object_io_handle_t *file_object_io_handle,
      libcerror_error_t **error );
 
+int pyevtx_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
 ssize_t pyevtx_file_object_read_buffer(
          PyObject *file_object,
          uint8_t *buffer,
          size_t size,
          libcerror_error_t **error );
 
+ssize_t pyevtx_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
 ssize_t pyevtx_file_object_io_handle_read(
          pyevtx_file_object_io_handle_t *file_object_io_handle,
          uint8_t *buffer,
@@ -0,0 +1,622 @@
+/*
+ * Opens multiple files in parallel
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyevtx_error.h"
+#include "pyevtx_file.h"
+#include "pyevtx_libcerror.h"
+#include "pyevtx_libevtx.h"
+#include "pyevtx_open_many.h"
+#include "pyevtx_python.h"
+#include "pyevtx_unused.h"
+
+/* Opens the files of the state until no files are left
+ * This function is called without the GIL held and therefore
+ * must not call any Python C API function other than the thread locks
+ */
+void pyevtx_open_many_thread(
+      void *arguments )
+{
+	pyevtx_open_many_state_t *state = NULL;
+	int file_index                  = 0;
+	int is_last_thread              = 0;
+
+	if( arguments == NULL )
+	{
+		return;
+	}
+	state = (pyevtx_open_many_state_t *) arguments;
+
+	do
+	{
+		PyThread_acquire_lock(
+		 state->lock,
+		 WAIT_LOCK );
+
+		file_index = state->next_file_index;
+
+		if( file_index < state->number_of_files )
+		{
+			state->next_file_index += 1;
+		}
+		PyThread_release_lock(
+		 state->lock );
+
+		if( file_index >= state->number_of_files )
+		{
+			break;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( state->filenames_wide[ file_index ] != NULL )
+		{
+			state->results[ file_index ] = libevtx_file_open_wide(
+			                                state->files[ file_index ]->file,
+			                                state->filenames_wide[ file_index ],
+			                                LIBEVTX_OPEN_READ,
+			                                &( state->errors[ file_index ] ) );
+		}
+		else
+#endif
+		{
+			state->results[ file_index ] = libevtx_file_open(
+			                                state->files[ file_index ]->file,
+			                                state->filenames_narrow[ file_index ],
+			                                LIBEVTX_OPEN_READ,
+			                                &( state->errors[ file_index ] ) );
+		}
+	}
+	while( file_index < state->number_of_files );
+
+	PyThread_acquire_lock(
+	 state->lock,
+	 WAIT_LOCK );
+
+	state->number_of_running_threads -= 1;
+
+	is_last_thread = (int) ( state->number_of_running_threads == 0 );
+
+	PyThread_release_lock(
+	 state->lock );
+
+	/* The state is no longer accessed after the done lock is released
+	 * since the caller frees it once it has acquired the done lock
+	 */
+	if( is_last_thread != 0 )
+	{
+		PyThread_release_lock(
+		 state->done_lock );
+	}
+}
+
+/* Creates new file objects and opens them using multiple threads
+ * Returns a Python object if successful or NULL on error
+ *
+ * The list contains a file object for every file that was opened
+ * and an exception object for every file that could not be opened
+ */
+PyObject *pyevtx_open_many(
+           PyObject *self PYEVTX_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyevtx_open_many_state_t state;
+
+	PyObject *exception_traceback = NULL;
+	PyObject *exception_type      = NULL;
+	PyObject *exception_value     = NULL;
+	PyObject *filenames_object    = NULL;
+	PyObject *list_object         = NULL;
+	PyObject *sequence_object     = NULL;
+	PyObject *string_object       = NULL;
+	static char *function         = "pyevtx_open_many";
+	static char *keyword_list[]   = { "filenames", "threads", NULL };
+	Py_ssize_t sequence_size      = 0;
+	size_t array_size             = 0;
+	unsigned long thread_id       = 0;
+	int file_index                = 0;
+	int list_is_complete          = 0;
+	int number_of_threads         = 1;
+	int result                    = 0;
+	int thread_index              = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( self )
+
+	if( memory_set(
+	     &state,
+	     0,
+	     sizeof( pyevtx_open_many_state_t ) ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &filenames_object,
+	     &number_of_threads ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > PYEVTX_OPEN_MANY_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   filenames_object,
+	                   "filenames must be a sequence of strings" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	sequence_size = PySequence_Fast_GET_SIZE(
+	                 sequence_object );
+
+	if( ( sequence_size < 0 )
+	 || ( sequence_size > (Py_ssize_t) INT_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	state.number_of_files = (int) sequence_size;
+
+	list_object = PyList_New(
+	               sequence_size );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list.",
+		 function );
+
+		goto on_error;
+	}
+	if( state.number_of_files == 0 )
+	{
+		Py_DecRef(
+		 sequence_object );
+
+		return( list_object );
+	}
+	array_size = sizeof( void * ) * (size_t) state.number_of_files;
+
+	state.files               = (pyevtx_file_t **) PyMem_Malloc( array_size );
+	state.filenames_narrow    = (const char **) PyMem_Malloc( array_size );
+	state.utf8_string_objects = (PyObject **) PyMem_Malloc( array_size );
+	state.errors              = (libcerror_error_t **) PyMem_Malloc( array_size );
+	state.results             = (int *) PyMem_Malloc( sizeof( int ) * (size_t) state.number_of_files );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	state.filenames_wide      = (const wchar_t **) PyMem_Malloc( array_size );
+#endif
+
+	if( ( state.files == NULL )
+	 || ( state.filenames_narrow == NULL )
+	 || ( state.utf8_string_objects == NULL )
+	 || ( state.errors == NULL )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	 || ( state.filenames_wide == NULL )
+#endif
+	 || ( state.results == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create state arrays.",
+		 function );
+
+		/* Prevent the uninitialized arrays from being accessed on error
+		 */
+		state.number_of_files = 0;
+
+		goto on_error;
+	}
+	memory_set(
+	 state.files,
+	 0,
+	 array_size );
+	memory_set(
+	 state.filenames_narrow,
+	 0,
+	 array_size );
+	memory_set(
+	 state.utf8_string_objects,
+	 0,
+	 array_size );
+	memory_set(
+	 state.errors,
+	 0,
+	 array_size );
+	memory_set(
+	 state.results,
+	 0,
+	 sizeof( int ) * (size_t) state.number_of_files );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_set(
+	 state.filenames_wide,
+	 0,
+	 array_size );
+#endif
+	for( file_index = 0;
+	     file_index < state.number_of_files;
+	     file_index++ )
+	{
+		string_object = PySequence_Fast_GET_ITEM(
+		                 sequence_object,
+		                 (Py_ssize_t) file_index );
+
+		PyErr_Clear();
+
+		result = PyObject_IsInstance(
+		          string_object,
+		          (PyObject *) &PyUnicode_Type );
+
+		if( result == -1 )
+		{
+			pyevtx_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to determine if string object: %d is of type unicode.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			state.filenames_wide[ file_index ] = (wchar_t *) PyUnicode_AsUnicode(
+			                                                  string_object );
+
+			if( state.filenames_wide[ file_index ] == NULL )
+			{
+				goto on_error;
+			}
+#else
+			state.utf8_string_objects[ file_index ] = PyUnicode_AsUTF8String(
+			                                           string_object );
+
+			if( state.utf8_string_objects[ file_index ] == NULL )
+			{
+				pyevtx_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to convert unicode string: %d to UTF-8.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+#if PY_MAJOR_VERSION >= 3
+			state.filenames_narrow[ file_index ] = PyBytes_AsString(
+			                                        state.utf8_string_objects[ file_index ] );
+#else
+			state.filenames_narrow[ file_index ] = PyString_AsString(
+			                                        state.utf8_string_objects[ file_index ] );
+#endif
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+		}
+		else
+		{
+			PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+			result = PyObject_IsInstance(
+			          string_object,
+			          (PyObject *) &PyBytes_Type );
+#else
+			result = PyObject_IsInstance(
+			          string_object,
+			          (PyObject *) &PyString_Type );
+#endif
+			if( result == -1 )
+			{
+				pyevtx_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to determine if string object: %d is of type string.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				PyErr_Format(
+				 PyExc_TypeError,
+				 "%s: unsupported string object type: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+#if PY_MAJOR_VERSION >= 3
+			state.filenames_narrow[ file_index ] = PyBytes_AsString(
+			                                        string_object );
+#else
+			state.filenames_narrow[ file_index ] = PyString_AsString(
+			                                        string_object );
+#endif
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( ( state.filenames_wide[ file_index ] == NULL )
+		 && ( state.filenames_narrow[ file_index ] == NULL ) )
+#else
+		if( state.filenames_narrow[ file_index ] == NULL )
+#endif
+		{
+			goto on_error;
+		}
+		state.files[ file_index ] = PyObject_New(
+		                             struct pyevtx_file,
+		                             &pyevtx_file_type_object );
+
+		if( state.files[ file_index ] == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( pyevtx_file_init(
+		     state.files[ file_index ] ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	if( number_of_threads > state.number_of_files )
+	{
+		number_of_threads = state.number_of_files;
+	}
+	state.number_of_running_threads = number_of_threads;
+
+	state.lock = PyThread_allocate_lock();
+
+	if( state.lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to allocate lock.",
+		 function );
+
+		goto on_error;
+	}
+	state.done_lock = PyThread_allocate_lock();
+
+	if( state.done_lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to allocate done lock.",
+		 function );
+
+		goto on_error;
+	}
+	PyThread_acquire_lock(
+	 state.done_lock,
+	 WAIT_LOCK );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	/* The calling thread is one of the threads that open the files
+	 * so if a thread cannot be started the files are opened by fewer threads
+	 */
+	for( thread_index = 1;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		thread_id = (unsigned long) PyThread_start_new_thread(
+		                             pyevtx_open_many_thread,
+		                             (void *) &state );
+
+		if( thread_id == (unsigned long) -1 )
+		{
+			PyThread_acquire_lock(
+			 state.lock,
+			 WAIT_LOCK );
+
+			state.number_of_running_threads -= 1;
+
+			PyThread_release_lock(
+			 state.lock );
+		}
+	}
+	pyevtx_open_many_thread(
+	 (void *) &state );
+
+	PyThread_acquire_lock(
+	 state.done_lock,
+	 WAIT_LOCK );
+
+	Py_END_ALLOW_THREADS
+
+	PyThread_release_lock(
+	 state.done_lock );
+
+	for( file_index = 0;
+	     file_index < state.number_of_files;
+	     file_index++ )
+	{
+		if( state.results[ file_index ] == 1 )
+		{
+			/* PyList_SET_ITEM steals the reference of the file object
+			 */
+			PyList_SET_ITEM(
+			 list_object,
+			 (Py_ssize_t) file_index,
+			 (PyObject *) state.files[ file_index ] );
+
+			state.files[ file_index ] = NULL;
+
+			continue;
+		}
+		pyevtx_error_raise(
+		 state.errors[ file_index ],
+		 PyExc_IOError,
+		 "%s: unable to open file: %d.",
+		 function,
+		 file_index );
+
+		libcerror_error_free(
+		 &( state.errors[ file_index ] ) );
+
+		PyErr_Fetch(
+		 &exception_type,
+		 &exception_value,
+		 &exception_traceback );
+
+		PyErr_NormalizeException(
+		 &exception_type,
+		 &exception_value,
+		 &exception_traceback );
+
+		Py_XDECREF(
+		 exception_type );
+		Py_XDECREF(
+		 exception_traceback );
+
+		exception_type      = NULL;
+		exception_traceback = NULL;
+
+		if( exception_value == NULL )
+		{
+			PyErr_Format(
+			 PyExc_RuntimeError,
+			 "%s: unable to create exception: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		PyList_SET_ITEM(
+		 list_object,
+		 (Py_ssize_t) file_index,
+		 exception_value );
+
+		exception_value = NULL;
+	}
+	list_is_complete = 1;
+
+on_error:
+	for( file_index = 0;
+	     file_index < state.number_of_files;
+	     file_index++ )
+	{
+		if( ( state.files != NULL )
+		 && ( state.files[ file_index ] != NULL ) )
+		{
+			Py_DecRef(
+			 (PyObject *) state.files[ file_index ] );
+		}
+		if( ( state.utf8_string_objects != NULL )
+		 && ( state.utf8_string_objects[ file_index ] != NULL ) )
+		{
+			Py_DecRef(
+			 state.utf8_string_objects[ file_index ] );
+		}
+		if( ( state.errors != NULL )
+		 && ( state.errors[ file_index ] != NULL ) )
+		{
+			libcerror_error_free(
+			 &( state.errors[ file_index ] ) );
+		}
+	}
+	if( state.done_lock != NULL )
+	{
+		PyThread_free_lock(
+		 state.done_lock );
+	}
+	if( state.lock != NULL )
+	{
+		PyThread_free_lock(
+		 state.lock );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( state.filenames_wide != NULL )
+	{
+		PyMem_Free(
+		 state.filenames_wide );
+	}
+#endif
+	if( state.results != NULL )
+	{
+		PyMem_Free(
+		 state.results );
+	}
+	if( state.errors != NULL )
+	{
+		PyMem_Free(
+		 state.errors );
+	}
+	if( state.utf8_string_objects != NULL )
+	{
+		PyMem_Free(
+		 state.utf8_string_objects );
+	}
+	if( state.filenames_narrow != NULL )
+	{
+		PyMem_Free(
+		 state.filenames_narrow );
+	}
+	if( state.files != NULL )
+	{
+		PyMem_Free(
+		 state.files );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	if( list_is_complete == 0 )
+	{
+		if( list_object != NULL )
+		{
+			Py_DecRef(
+			 list_object );
+		}
+		return( NULL );
+	}
+	return( list_object );
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Opens multiple files in parallel
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYEVTX_OPEN_MANY_H )
+#define _PYEVTX_OPEN_MANY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyevtx_file.h"
+#include "pyevtx_libcerror.h"
+#include "pyevtx_libevtx.h"
+#include "pyevtx_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of threads used to open files
+ */
+#define PYEVTX_OPEN_MANY_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct pyevtx_open_many_state pyevtx_open_many_state_t;
+
+struct pyevtx_open_many_state
+{
+	/* The file objects
+	 */
+	pyevtx_file_t **files;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The wide filenames
+	 * Contains NULL if the filename is a narrow string
+	 */
+	const wchar_t **filenames_wide;
+#endif
+
+	/* The narrow filenames
+	 */
+	const char **filenames_narrow;
+
+	/* The UTF-8 string objects that contain the narrow filenames
+	 * of Unicode string objects
+	 */
+	PyObject **utf8_string_objects;
+
+	/* The errors of the files that could not be opened
+	 */
+	libcerror_error_t **errors;
+
+	/* The results of opening the files
+	 */
+	int *results;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The index of the next file to open
+	 */
+	int next_file_index;
+
+	/* The number of running threads
+	 */
+	int number_of_running_threads;
+
+	/* The lock that protects the next file index
+	 * and the number of running threads
+	 */
+	PyThread_type_lock lock;
+
+	/* The lock that is released when all threads are done
+	 */
+	PyThread_type_lock done_lock;
+};
+
+void pyevtx_open_many_thread(
+      void *arguments );
+
+PyObject *pyevtx_open_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYEVTX_OPEN_MANY_H ) */
+
@@ -72,5 +72,26 @@
 
 #endif /* !defined( Py_TYPE ) */
 
+/* Critical sections only serialize in free-threaded (no GIL) builds
+ * of Python 3.13 or later, otherwise the GIL provides the serialization
+ * Note that the critical section is suspended while the thread state
+ * is released by Py_BEGIN_ALLOW_THREADS
+ */
+#if defined( Py_BEGIN_CRITICAL_SECTION )
+#define PYEVTX_BEGIN_CRITICAL_SECTION( object ) \
+	Py_BEGIN_CRITICAL_SECTION( object )
+
+#define PYEVTX_END_CRITICAL_SECTION \
+	Py_END_CRITICAL_SECTION()
+
+#else
+#define PYEVTX_BEGIN_CRITICAL_SECTION( object ) \
+	{
+
+#define PYEVTX_END_CRITICAL_SECTION \
+	}
+
+#endif /* defined( Py_BEGIN_CRITICAL_SECTION ) */
+
 #endif /* !defined( _PYEVTX_PYTHON_H ) */
 
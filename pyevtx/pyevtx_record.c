@@ -28,6 +28,7 @@
 
 #include "pyevtx_datetime.h"
 #include "pyevtx_error.h"
+#include "pyevtx_file.h"
 #include "pyevtx_integer.h"
 #include "pyevtx_libcerror.h"
 #include "pyevtx_libevtx.h"
@@ -143,6 +144,13 @@ PyMethodDef pyevtx_record_object_methods[] = {
 	  "\n"
 	  "Retrieves the XML string." },
 
+	{ "get_xml_bytes",
+	  (PyCFunction) pyevtx_record_get_xml_bytes,
+	  METH_NOARGS,
+	  "get_xml_bytes() -> Binary string or None\n"
+	  "\n"
+	  "Retrieves the XML string as an UTF-8 encoded binary string." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -233,6 +241,12 @@ PyGetSetDef pyevtx_record_object_get_set_definitions[] = {
 	  "The XML string.",
 	  NULL },
 
+	{ "xml_bytes",
+	  (getter) pyevtx_record_get_xml_bytes,
+	  (setter) 0,
+	  "The XML string as an UTF-8 encoded binary string.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -410,7 +424,9 @@ int pyevtx_record_init(
 	}
 	/* Make sure libevtx record is set to NULL
 	 */
-	pyevtx_record->record = NULL;
+	pyevtx_record->record              = NULL;
+	pyevtx_record->parent_object       = NULL;
+	pyevtx_record->written_time_object = NULL;
 
 	return( 0 );
 }
@@ -466,10 +482,16 @@ void pyevtx_record_free(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_free(
 	          &( pyevtx_record->record ),
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -483,6 +505,11 @@ void pyevtx_record_free(
 		libcerror_error_free(
 		 &error );
 	}
+	if( pyevtx_record->written_time_object != NULL )
+	{
+		Py_DecRef(
+		 pyevtx_record->written_time_object );
+	}
 	if( pyevtx_record->parent_object != NULL )
 	{
 		Py_DecRef(
@@ -518,11 +545,17 @@ PyObject *pyevtx_record_get_offset(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_offset(
 	          pyevtx_record->record,
 	          &offset,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -577,11 +610,17 @@ PyObject *pyevtx_record_get_identifier(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_identifier(
 	          pyevtx_record->record,
 	          &value_64bit,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -627,13 +666,34 @@ PyObject *pyevtx_record_get_written_time(
 
 		return( NULL );
 	}
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_record )
+
+	datetime_object = pyevtx_record->written_time_object;
+
+	if( datetime_object != NULL )
+	{
+		Py_IncRef(
+		 datetime_object );
+	}
+	PYEVTX_END_CRITICAL_SECTION
+
+	if( datetime_object != NULL )
+	{
+		return( datetime_object );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_written_time(
 	          pyevtx_record->record,
 	          &filetime,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -659,6 +719,21 @@ PyObject *pyevtx_record_get_written_time(
 	datetime_object = pyevtx_datetime_new_from_filetime(
 	                   filetime );
 
+	/* The datetime object is immutable hence it can be shared
+	 */
+	if( datetime_object != NULL )
+	{
+		PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_record )
+
+		if( pyevtx_record->written_time_object == NULL )
+		{
+			Py_IncRef(
+			 datetime_object );
+
+			pyevtx_record->written_time_object = datetime_object;
+		}
+		PYEVTX_END_CRITICAL_SECTION
+	}
 	return( datetime_object );
 }
 
@@ -688,11 +763,17 @@ PyObject *pyevtx_record_get_written_time_as_integer(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_written_time(
 	          pyevtx_record->record,
 	          &filetime,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -747,11 +828,17 @@ PyObject *pyevtx_record_get_event_identifier(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_event_identifier(
 	          pyevtx_record->record,
 	          &value_32bit,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -806,11 +893,17 @@ PyObject *pyevtx_record_get_event_identifier_qualifiers(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_event_identifier_qualifiers(
 	          pyevtx_record->record,
 	          &value_32bit,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -865,11 +958,17 @@ PyObject *pyevtx_record_get_event_level(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_event_level(
 	          pyevtx_record->record,
 	          &event_level,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -923,11 +1022,17 @@ PyObject *pyevtx_record_get_provider_identifier(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_provider_identifier_size(
 	          pyevtx_record->record,
 	          &utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -965,12 +1070,18 @@ PyObject *pyevtx_record_get_provider_identifier(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_provider_identifier(
 	          pyevtx_record->record,
 	          (uint8_t *) utf8_string,
 	          utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1017,6 +1128,90 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the Unicode object of an interned System string value
+ * The Unicode object is shared with the other records of the parent file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int pyevtx_record_get_interned_string_object(
+     pyevtx_record_t *pyevtx_record,
+     int (*get_string_identifier)(
+            libevtx_record_t *record,
+            uint32_t *string_identifier,
+            libcerror_error_t **error ),
+     PyObject **string_object )
+{
+	libcerror_error_t *error   = NULL;
+	static char *function      = "pyevtx_record_get_interned_string_object";
+	uint32_t string_identifier = 0;
+	int result                 = 0;
+
+	if( pyevtx_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_string_identifier == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid get string identifier function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pyevtx_record->parent_object == NULL )
+	 || ( PyObject_TypeCheck(
+	       pyevtx_record->parent_object,
+	       &pyevtx_file_type_object ) == 0 ) )
+	{
+		return( 0 );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
+	result = get_string_identifier(
+	          pyevtx_record->record,
+	          &string_identifier,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve string identifier.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( pyevtx_file_get_interned_string_object(
+	     (pyevtx_file_t *) pyevtx_record->parent_object,
+	     string_identifier,
+	     string_object ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the source name
  * Returns a Python object if successful or NULL on error
  */
@@ -1043,13 +1238,32 @@ PyObject *pyevtx_record_get_source_name(
 
 		return( NULL );
 	}
+	result = pyevtx_record_get_interned_string_object(
+	          pyevtx_record,
+	          libevtx_record_get_source_name_identifier,
+	          &string_object );
+
+	if( result == -1 )
+	{
+		return( NULL );
+	}
+	else if( result == 1 )
+	{
+		return( string_object );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_source_name_size(
 	          pyevtx_record->record,
 	          &utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -1087,12 +1301,18 @@ PyObject *pyevtx_record_get_source_name(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_source_name(
 	          pyevtx_record->record,
 	          (uint8_t *) utf8_string,
 	          utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1165,13 +1385,32 @@ PyObject *pyevtx_record_get_computer_name(
 
 		return( NULL );
 	}
+	result = pyevtx_record_get_interned_string_object(
+	          pyevtx_record,
+	          libevtx_record_get_computer_name_identifier,
+	          &string_object );
+
+	if( result == -1 )
+	{
+		return( NULL );
+	}
+	else if( result == 1 )
+	{
+		return( string_object );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_computer_name_size(
 	          pyevtx_record->record,
 	          &utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -1209,12 +1448,18 @@ PyObject *pyevtx_record_get_computer_name(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_computer_name(
 	          pyevtx_record->record,
 	          (uint8_t *) utf8_string,
 	          utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1289,11 +1534,17 @@ PyObject *pyevtx_record_get_user_security_identifier(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_user_security_identifier_size(
 	          pyevtx_record->record,
 	          &utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -1331,12 +1582,18 @@ PyObject *pyevtx_record_get_user_security_identifier(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_user_security_identifier(
 	          pyevtx_record->record,
 	          (uint8_t *) utf8_string,
 	          utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1409,11 +1666,17 @@ PyObject *pyevtx_record_get_number_of_strings(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_number_of_strings(
 	          pyevtx_record->record,
 	          &number_of_strings,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1465,12 +1728,18 @@ PyObject *pyevtx_record_get_string_by_index(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) ( (pyevtx_record_t *) pyevtx_record )->parent_object );
+
 	result = libevtx_record_get_utf8_string_size(
 	          ( (pyevtx_record_t *) pyevtx_record )->record,
 	          string_index,
 	          &utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) ( (pyevtx_record_t *) pyevtx_record )->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -1509,6 +1778,9 @@ PyObject *pyevtx_record_get_string_by_index(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) ( (pyevtx_record_t *) pyevtx_record )->parent_object );
+
 	result = libevtx_record_get_utf8_string(
 	          ( (pyevtx_record_t *) pyevtx_record )->record,
 	          string_index,
@@ -1516,6 +1788,9 @@ PyObject *pyevtx_record_get_string_by_index(
 	          utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) ( (pyevtx_record_t *) pyevtx_record )->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1617,11 +1892,17 @@ PyObject *pyevtx_record_get_strings(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_number_of_strings(
 	          pyevtx_record->record,
 	          &number_of_strings,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1655,6 +1936,7 @@ PyObject *pyevtx_record_get_strings(
 }
 
 /* Retrieves the data
+ * The data is copied directly into the bytes object without an intermediate buffer
  * Returns a Python object if successful or NULL on error
  */
 PyObject *pyevtx_record_get_data(
@@ -1663,7 +1945,7 @@ PyObject *pyevtx_record_get_data(
 {
 	PyObject *bytes_object   = NULL;
 	libcerror_error_t *error = NULL;
-	char *data               = NULL;
+	uint8_t *data            = NULL;
 	static char *function    = "pyevtx_record_get_data";
 	size_t data_size         = 0;
 	int result               = 0;
@@ -1681,11 +1963,17 @@ PyObject *pyevtx_record_get_data(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_data_size(
 	          pyevtx_record->record,
 	          &data_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -1709,26 +1997,56 @@ PyObject *pyevtx_record_get_data(
 
 		return( Py_None );
 	}
-	data = (char *) PyMem_Malloc(
-	                 sizeof( char ) * data_size );
+	if( data_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
-	if( data == NULL )
+		goto on_error;
+	}
+	/* This is a binary string so include the full size
+	 */
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) data_size );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) data_size );
+#endif
+	if( bytes_object == NULL )
 	{
 		PyErr_Format(
 		 PyExc_MemoryError,
-		 "%s: unable to create data.",
+		 "%s: unable to create Bytes object.",
 		 function );
 
 		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	data = (uint8_t *) PyBytes_AS_STRING(
+	                    bytes_object );
+#else
+	data = (uint8_t *) PyString_AS_STRING(
+	                    bytes_object );
+#endif
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_data(
 	          pyevtx_record->record,
-	          (uint8_t *) data,
+	          data,
 	          data_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1744,36 +2062,13 @@ PyObject *pyevtx_record_get_data(
 
 		goto on_error;
 	}
-	/* This is a binary string so include the full size
-	 */
-#if PY_MAJOR_VERSION >= 3
-	bytes_object = PyBytes_FromStringAndSize(
-	                data,
-	                (Py_ssize_t) data_size );
-#else
-	bytes_object = PyString_FromStringAndSize(
-	                data,
-	                (Py_ssize_t) data_size );
-#endif
-	if( bytes_object == NULL )
-	{
-		PyErr_Format(
-		 PyExc_IOError,
-		 "%s: unable to convert data into Bytes object.",
-		 function );
-
-		goto on_error;
-	}
-	PyMem_Free(
-	 data );
-
 	return( bytes_object );
 
 on_error:
-	if( data != NULL )
+	if( bytes_object != NULL )
 	{
-		PyMem_Free(
-		 data );
+		Py_DecRef(
+		 bytes_object );
 	}
 	return( NULL );
 }
@@ -1806,11 +2101,17 @@ PyObject *pyevtx_record_get_xml_string(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_xml_string_size(
 	          pyevtx_record->record,
 	          &utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result == -1 )
@@ -1848,12 +2149,18 @@ PyObject *pyevtx_record_get_xml_string(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	result = libevtx_record_get_utf8_xml_string(
 	          pyevtx_record->record,
 	          (uint8_t *) utf8_string,
 	          utf8_string_size,
 	          &error );
 
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1900,3 +2207,143 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the xml string as an UTF-8 encoded bytes object
+ * The string is copied directly into the bytes object, which avoids an intermediate buffer
+ * and the conversion into a Unicode object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_record_get_xml_bytes(
+           pyevtx_record_t *pyevtx_record,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	PyObject *bytes_object   = NULL;
+	libcerror_error_t *error = NULL;
+	uint8_t *utf8_string     = NULL;
+	static char *function    = "pyevtx_record_get_xml_bytes";
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
+	result = libevtx_record_get_utf8_xml_string_size(
+	          pyevtx_record->record,
+	          &utf8_string_size,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine size of xml string as UTF-8 string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	if( utf8_string_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	/* The bytes object does not include the end of string character
+	 * but its buffer always contains an additional byte for it
+	 */
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) utf8_string_size - 1 );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) utf8_string_size - 1 );
+#endif
+	if( bytes_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create Bytes object.",
+		 function );
+
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	utf8_string = (uint8_t *) PyBytes_AS_STRING(
+	                           bytes_object );
+#else
+	utf8_string = (uint8_t *) PyString_AS_STRING(
+	                           bytes_object );
+#endif
+	Py_BEGIN_ALLOW_THREADS
+
+	pyevtx_file_grab_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
+	result = libevtx_record_get_utf8_xml_string(
+	          pyevtx_record->record,
+	          utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	pyevtx_file_release_lock(
+	 (pyevtx_file_t *) pyevtx_record->parent_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve xml string as UTF-8 string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( bytes_object );
+
+on_error:
+	if( bytes_object != NULL )
+	{
+		Py_DecRef(
+		 bytes_object );
+	}
+	return( NULL );
+}
+
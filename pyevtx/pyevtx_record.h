@@ -47,6 +47,11 @@ struct pyevtx_record
 	/* The parent object
 	 */
 	PyObject *parent_object;
+
+	/* The written time datetime object
+	 * Cached after its first construction
+	 */
+	PyObject *written_time_object;
 };
 
 extern PyMethodDef pyevtx_record_object_methods[];
@@ -94,6 +99,14 @@ PyObject *pyevtx_record_get_provider_identifier(
            pyevtx_record_t *pyevtx_record,
            PyObject *arguments );
 
+int pyevtx_record_get_interned_string_object(
+     pyevtx_record_t *pyevtx_record,
+     int (*get_string_identifier)(
+            libevtx_record_t *record,
+            uint32_t *string_identifier,
+            libcerror_error_t **error ),
+     PyObject **string_object );
+
 PyObject *pyevtx_record_get_source_name(
            pyevtx_record_t *pyevtx_record,
            PyObject *arguments );
@@ -131,6 +144,10 @@ PyObject *pyevtx_record_get_xml_string(
            pyevtx_record_t *pyevtx_record,
            PyObject *arguments );
 
+PyObject *pyevtx_record_get_xml_bytes(
+           pyevtx_record_t *pyevtx_record,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
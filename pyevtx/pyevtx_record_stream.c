@@ -0,0 +1,893 @@
+/*
+ * Python object definition of the streaming iterator object of records
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyevtx_columns.h"
+#include "pyevtx_error.h"
+#include "pyevtx_file.h"
+#include "pyevtx_libcerror.h"
+#include "pyevtx_libevtx.h"
+#include "pyevtx_python.h"
+#include "pyevtx_record.h"
+#include "pyevtx_record_stream.h"
+
+PyTypeObject pyevtx_record_stream_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyevtx.record_stream",
+	/* tp_basicsize */
+	sizeof( pyevtx_record_stream_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyevtx_record_stream_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyevtx streaming iterator object of records",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyevtx_record_stream_iter,
+	/* tp_iternext */
+	(iternextfunc) pyevtx_record_stream_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyevtx_record_stream_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new record stream object
+ * The fields are only used if dictionaries are yielded
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_record_stream_new(
+           PyObject *file_object,
+           int number_of_records,
+           int batch_size,
+           const int *fields,
+           int number_of_fields,
+           uint8_t yield_dictionaries )
+{
+	pyevtx_record_stream_t *pyevtx_record_stream = NULL;
+	libcerror_error_t *error                     = NULL;
+	static char *function                        = "pyevtx_record_stream_new";
+	int field_index                              = 0;
+
+	if( file_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file object.",
+		 function );
+
+		return( NULL );
+	}
+	if( number_of_records < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( batch_size <= 0 )
+	 || ( batch_size > PYEVTX_RECORD_STREAM_MAXIMUM_BATCH_SIZE ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid batch size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( yield_dictionaries != 0 )
+	{
+		if( fields == NULL )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid fields.",
+			 function );
+
+			return( NULL );
+		}
+		if( ( number_of_fields < 0 )
+		 || ( number_of_fields > PYEVTX_COLUMN_NUMBER_OF_FIELDS ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid number of fields value out of bounds.",
+			 function );
+
+			return( NULL );
+		}
+	}
+	pyevtx_record_stream = PyObject_New(
+	                        struct pyevtx_record_stream,
+	                        &pyevtx_record_stream_type_object );
+
+	if( pyevtx_record_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create record stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyevtx_record_stream_init(
+	     pyevtx_record_stream ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize record stream.",
+		 function );
+
+		goto on_error;
+	}
+	pyevtx_record_stream->records = (libevtx_record_t **) PyMem_Malloc(
+	                                                       sizeof( libevtx_record_t * ) * batch_size );
+
+	if( pyevtx_record_stream->records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create records.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     pyevtx_record_stream->records,
+	     0,
+	     sizeof( libevtx_record_t * ) * batch_size ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear records.",
+		 function );
+
+		goto on_error;
+	}
+	if( yield_dictionaries != 0 )
+	{
+		for( field_index = 0;
+		     field_index < number_of_fields;
+		     field_index++ )
+		{
+			if( pyevtx_column_initialize(
+			     &( pyevtx_record_stream->columns[ field_index ] ),
+			     fields[ field_index ],
+			     batch_size,
+			     &error ) != 1 )
+			{
+				pyevtx_error_raise(
+				 error,
+				 PyExc_MemoryError,
+				 "%s: unable to create column: %d.",
+				 function,
+				 field_index );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+			pyevtx_record_stream->number_of_columns++;
+		}
+	}
+	pyevtx_record_stream->file_object        = file_object;
+	pyevtx_record_stream->number_of_records  = number_of_records;
+	pyevtx_record_stream->batch_size         = batch_size;
+	pyevtx_record_stream->yield_dictionaries = yield_dictionaries;
+
+	Py_IncRef(
+	 pyevtx_record_stream->file_object );
+
+	return( (PyObject *) pyevtx_record_stream );
+
+on_error:
+	if( pyevtx_record_stream != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyevtx_record_stream );
+	}
+	return( NULL );
+}
+
+/* Intializes a record stream object
+ * Returns 0 if successful or -1 on error
+ */
+int pyevtx_record_stream_init(
+     pyevtx_record_stream_t *pyevtx_record_stream )
+{
+	static char *function = "pyevtx_record_stream_init";
+
+	if( pyevtx_record_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the record stream values are initialized
+	 */
+	pyevtx_record_stream->file_object             = NULL;
+	pyevtx_record_stream->record_index            = 0;
+	pyevtx_record_stream->number_of_records       = 0;
+	pyevtx_record_stream->batch_size              = 0;
+	pyevtx_record_stream->records                 = NULL;
+	pyevtx_record_stream->batch_index             = 0;
+	pyevtx_record_stream->batch_number_of_records = 0;
+	pyevtx_record_stream->number_of_columns       = 0;
+	pyevtx_record_stream->yield_dictionaries      = 0;
+	pyevtx_record_stream->is_busy                 = 0;
+
+	if( memory_set(
+	     pyevtx_record_stream->columns,
+	     0,
+	     sizeof( pyevtx_column_t * ) * PYEVTX_COLUMN_NUMBER_OF_FIELDS ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     pyevtx_record_stream->string_offsets,
+	     0,
+	     sizeof( size_t ) * PYEVTX_COLUMN_NUMBER_OF_FIELDS ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Frees a record stream object
+ */
+void pyevtx_record_stream_free(
+      pyevtx_record_stream_t *pyevtx_record_stream )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevtx_record_stream_free";
+	int column_index            = 0;
+	int result                  = 0;
+
+	if( pyevtx_record_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record stream.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyevtx_record_stream );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyevtx_record_stream->records != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		pyevtx_file_grab_lock(
+		 (pyevtx_file_t *) pyevtx_record_stream->file_object );
+
+		result = pyevtx_record_stream_free_batch(
+		          pyevtx_record_stream,
+		          &error );
+
+		pyevtx_file_release_lock(
+		 (pyevtx_file_t *) pyevtx_record_stream->file_object );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyevtx_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free batch.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+		PyMem_Free(
+		 pyevtx_record_stream->records );
+	}
+	for( column_index = 0;
+	     column_index < pyevtx_record_stream->number_of_columns;
+	     column_index++ )
+	{
+		pyevtx_column_free(
+		 &( pyevtx_record_stream->columns[ column_index ] ),
+		 NULL );
+	}
+	if( pyevtx_record_stream->file_object != NULL )
+	{
+		Py_DecRef(
+		 pyevtx_record_stream->file_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyevtx_record_stream );
+}
+
+/* Frees the records of the current batch that were not handed out
+ * The lock of the file must be held
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_record_stream_free_batch(
+     pyevtx_record_stream_t *pyevtx_record_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "pyevtx_record_stream_free_batch";
+	int batch_index       = 0;
+	int result            = 1;
+
+	if( pyevtx_record_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( batch_index = 0;
+	     batch_index < pyevtx_record_stream->batch_number_of_records;
+	     batch_index++ )
+	{
+		if( pyevtx_record_stream->records[ batch_index ] != NULL )
+		{
+			if( libevtx_record_free(
+			     &( pyevtx_record_stream->records[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record: %d.",
+				 function,
+				 batch_index );
+
+				result = -1;
+			}
+		}
+	}
+	pyevtx_record_stream->batch_index             = 0;
+	pyevtx_record_stream->batch_number_of_records = 0;
+
+	return( result );
+}
+
+/* Reads the next batch of records
+ * The records of a batch are read chunk by chunk, if dictionaries are yielded
+ * the field values are extracted into the columns and the records are freed
+ * The lock of the file must be held
+ * Returns 1 if successful or -1 on error
+ */
+int pyevtx_record_stream_read_batch(
+     pyevtx_record_stream_t *pyevtx_record_stream,
+     libcerror_error_t **error )
+{
+	static char *function       = "pyevtx_record_stream_read_batch";
+	int batch_index             = 0;
+	int batch_number_of_records = 0;
+	int column_index            = 0;
+	int result                  = 1;
+
+	if( pyevtx_record_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyevtx_record_stream->file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record stream - missing file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyevtx_record_stream_free_batch(
+	     pyevtx_record_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free batch.",
+		 function );
+
+		return( -1 );
+	}
+	batch_number_of_records = pyevtx_record_stream->number_of_records - pyevtx_record_stream->record_index;
+
+	if( batch_number_of_records > pyevtx_record_stream->batch_size )
+	{
+		batch_number_of_records = pyevtx_record_stream->batch_size;
+	}
+	if( batch_number_of_records <= 0 )
+	{
+		return( 1 );
+	}
+	if( libevtx_file_get_records_by_range(
+	     ( (pyevtx_file_t *) pyevtx_record_stream->file_object )->file,
+	     pyevtx_record_stream->record_index,
+	     batch_number_of_records,
+	     pyevtx_record_stream->records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records: %d - %d.",
+		 function,
+		 pyevtx_record_stream->record_index,
+		 pyevtx_record_stream->record_index + batch_number_of_records - 1 );
+
+		return( -1 );
+	}
+	pyevtx_record_stream->batch_number_of_records = batch_number_of_records;
+
+	if( pyevtx_record_stream->yield_dictionaries != 0 )
+	{
+		for( column_index = 0;
+		     column_index < pyevtx_record_stream->number_of_columns;
+		     column_index++ )
+		{
+			if( pyevtx_column_clear(
+			     pyevtx_record_stream->columns[ column_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to clear column: %d.",
+				 function,
+				 column_index );
+
+				result = -1;
+
+				break;
+			}
+			pyevtx_record_stream->string_offsets[ column_index ] = 0;
+		}
+		for( batch_index = 0;
+		     ( result == 1 ) && ( batch_index < batch_number_of_records );
+		     batch_index++ )
+		{
+			for( column_index = 0;
+			     column_index < pyevtx_record_stream->number_of_columns;
+			     column_index++ )
+			{
+				if( pyevtx_column_set_value_from_record(
+				     pyevtx_record_stream->columns[ column_index ],
+				     batch_index,
+				     pyevtx_record_stream->records[ batch_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set column: %d value: %d.",
+					 function,
+					 column_index,
+					 pyevtx_record_stream->record_index + batch_index );
+
+					result = -1;
+
+					break;
+				}
+			}
+			if( libevtx_record_free(
+			     &( pyevtx_record_stream->records[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record: %d.",
+				 function,
+				 pyevtx_record_stream->record_index + batch_index );
+
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			pyevtx_record_stream_free_batch(
+			 pyevtx_record_stream,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	pyevtx_record_stream->record_index += batch_number_of_records;
+
+	return( 1 );
+}
+
+/* Creates a dictionary of the field values of a specific record in the current batch
+ * The dictionaries must be created in order of the records in the batch
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_record_stream_get_dictionary(
+           pyevtx_record_stream_t *pyevtx_record_stream,
+           int batch_index )
+{
+	size_t string_offsets[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ];
+
+	PyObject *dictionary_object = NULL;
+	PyObject *value_object      = NULL;
+	pyevtx_column_t *column     = NULL;
+	static char *function       = "pyevtx_record_stream_get_dictionary";
+	int column_index            = 0;
+	int result                  = 0;
+
+	if( pyevtx_record_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record stream.",
+		 function );
+
+		return( NULL );
+	}
+	/* The string offsets are only advanced if the dictionary was created
+	 * so that a failed dictionary can be created again
+	 */
+	if( memory_copy(
+	     string_offsets,
+	     pyevtx_record_stream->string_offsets,
+	     sizeof( size_t ) * PYEVTX_COLUMN_NUMBER_OF_FIELDS ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to copy string offsets.",
+		 function );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < pyevtx_record_stream->number_of_columns;
+	     column_index++ )
+	{
+		column = pyevtx_record_stream->columns[ column_index ];
+
+		value_object = pyevtx_column_get_value_object(
+		                column,
+		                batch_index,
+		                &( string_offsets[ column_index ] ) );
+
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		result = PyDict_SetItemString(
+		          dictionary_object,
+		          pyevtx_column_field_names[ column->field ],
+		          value_object );
+
+		Py_DecRef(
+		 value_object );
+
+		if( result != 0 )
+		{
+			goto on_error;
+		}
+	}
+	if( memory_copy(
+	     pyevtx_record_stream->string_offsets,
+	     string_offsets,
+	     sizeof( size_t ) * PYEVTX_COLUMN_NUMBER_OF_FIELDS ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to copy string offsets.",
+		 function );
+
+		goto on_error;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
+/* The record stream iter() function
+ */
+PyObject *pyevtx_record_stream_iter(
+           pyevtx_record_stream_t *pyevtx_record_stream )
+{
+	static char *function = "pyevtx_record_stream_iter";
+
+	if( pyevtx_record_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyevtx_record_stream );
+
+	return( (PyObject *) pyevtx_record_stream );
+}
+
+/* The record stream iternext() function
+ */
+PyObject *pyevtx_record_stream_iternext(
+           pyevtx_record_stream_t *pyevtx_record_stream )
+{
+	PyObject *item_object    = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyevtx_record_stream_iternext";
+	uint8_t is_busy          = 0;
+	int result               = 0;
+
+	if( pyevtx_record_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record stream.",
+		 function );
+
+		return( NULL );
+	}
+	/* Like a generator the stream can only be advanced by one thread at a time
+	 */
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_record_stream )
+
+	is_busy = pyevtx_record_stream->is_busy;
+
+	pyevtx_record_stream->is_busy = 1;
+
+	PYEVTX_END_CRITICAL_SECTION
+
+	if( is_busy != 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: record stream already executing.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyevtx_record_stream->batch_index >= pyevtx_record_stream->batch_number_of_records )
+	{
+		if( pyevtx_record_stream->record_index < pyevtx_record_stream->number_of_records )
+		{
+			Py_BEGIN_ALLOW_THREADS
+
+			pyevtx_file_grab_lock(
+			 (pyevtx_file_t *) pyevtx_record_stream->file_object );
+
+			result = pyevtx_record_stream_read_batch(
+			          pyevtx_record_stream,
+			          &error );
+
+			pyevtx_file_release_lock(
+			 (pyevtx_file_t *) pyevtx_record_stream->file_object );
+
+			Py_END_ALLOW_THREADS
+
+			if( result != 1 )
+			{
+				pyevtx_error_raise(
+				 error,
+				 PyExc_IOError,
+				 "%s: unable to read batch.",
+				 function );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+		}
+		if( pyevtx_record_stream->batch_number_of_records == 0 )
+		{
+			PyErr_SetNone(
+			 PyExc_StopIteration );
+
+			goto on_error;
+		}
+	}
+	if( pyevtx_record_stream->yield_dictionaries != 0 )
+	{
+		item_object = pyevtx_record_stream_get_dictionary(
+		               pyevtx_record_stream,
+		               pyevtx_record_stream->batch_index );
+	}
+	else
+	{
+		item_object = pyevtx_record_new(
+		               pyevtx_record_stream->records[ pyevtx_record_stream->batch_index ],
+		               pyevtx_record_stream->file_object );
+
+		/* The record object takes over the record
+		 */
+		if( item_object != NULL )
+		{
+			pyevtx_record_stream->records[ pyevtx_record_stream->batch_index ] = NULL;
+		}
+	}
+	if( item_object == NULL )
+	{
+		goto on_error;
+	}
+	pyevtx_record_stream->batch_index++;
+
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_record_stream )
+
+	pyevtx_record_stream->is_busy = 0;
+
+	PYEVTX_END_CRITICAL_SECTION
+
+	return( item_object );
+
+on_error:
+	PYEVTX_BEGIN_CRITICAL_SECTION( pyevtx_record_stream )
+
+	pyevtx_record_stream->is_busy = 0;
+
+	PYEVTX_END_CRITICAL_SECTION
+
+	return( NULL );
+}
+
@@ -0,0 +1,143 @@
+/*
+ * Python object definition of the streaming iterator object of records
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYEVTX_RECORD_STREAM_H )
+#define _PYEVTX_RECORD_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyevtx_columns.h"
+#include "pyevtx_libcerror.h"
+#include "pyevtx_libevtx.h"
+#include "pyevtx_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of records retrieved at once by a record stream
+ */
+#define PYEVTX_RECORD_STREAM_DEFAULT_BATCH_SIZE		256
+
+/* The maximum number of records retrieved at once by a record stream
+ */
+#define PYEVTX_RECORD_STREAM_MAXIMUM_BATCH_SIZE		65536
+
+typedef struct pyevtx_record_stream pyevtx_record_stream_t;
+
+struct pyevtx_record_stream
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The file object
+	 */
+	PyObject *file_object;
+
+	/* The index of the first record of the next batch
+	 */
+	int record_index;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The maximum number of records in a batch
+	 */
+	int batch_size;
+
+	/* The records of the current batch
+	 * Records that were handed out to a record object are set to NULL
+	 */
+	libevtx_record_t **records;
+
+	/* The index of the next item in the current batch
+	 */
+	int batch_index;
+
+	/* The number of records in the current batch
+	 */
+	int batch_number_of_records;
+
+	/* The columns that contain the field values of the current batch
+	 * Only used if dictionaries are yielded
+	 */
+	pyevtx_column_t *columns[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ];
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The offsets of the strings of the next item in the string data of the columns
+	 */
+	size_t string_offsets[ PYEVTX_COLUMN_NUMBER_OF_FIELDS ];
+
+	/* Value to indicate dictionaries of the field values are yielded instead of records
+	 */
+	uint8_t yield_dictionaries;
+
+	/* Value to indicate the stream is being iterated
+	 */
+	uint8_t is_busy;
+};
+
+extern PyTypeObject pyevtx_record_stream_type_object;
+
+PyObject *pyevtx_record_stream_new(
+           PyObject *file_object,
+           int number_of_records,
+           int batch_size,
+           const int *fields,
+           int number_of_fields,
+           uint8_t yield_dictionaries );
+
+int pyevtx_record_stream_init(
+     pyevtx_record_stream_t *pyevtx_record_stream );
+
+void pyevtx_record_stream_free(
+      pyevtx_record_stream_t *pyevtx_record_stream );
+
+int pyevtx_record_stream_free_batch(
+     pyevtx_record_stream_t *pyevtx_record_stream,
+     libcerror_error_t **error );
+
+int pyevtx_record_stream_read_batch(
+     pyevtx_record_stream_t *pyevtx_record_stream,
+     libcerror_error_t **error );
+
+PyObject *pyevtx_record_stream_get_dictionary(
+           pyevtx_record_stream_t *pyevtx_record_stream,
+           int batch_index );
+
+PyObject *pyevtx_record_stream_iter(
+           pyevtx_record_stream_t *pyevtx_record_stream );
+
+PyObject *pyevtx_record_stream_iternext(
+           pyevtx_record_stream_t *pyevtx_record_stream );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYEVTX_RECORD_STREAM_H ) */
+
@@ -394,6 +394,7 @@ PyObject *pyevtx_strings_iternext(
 {
 	PyObject *string_object = NULL;
 	static char *function   = "pyevtx_strings_iternext";
+	int item_index          = 0;
 
 	if( sequence_object == NULL )
 	{
@@ -431,7 +432,20 @@ PyObject *pyevtx_strings_iternext(
 
 		return( NULL );
 	}
-	if( sequence_object->current_index >= sequence_object->number_of_items )
+	/* Claim the index of the item before retrieving it, since the retrieval
+	 * releases the thread state and with it the critical section
+	 */
+	PYEVTX_BEGIN_CRITICAL_SECTION( sequence_object )
+
+	item_index = sequence_object->current_index;
+
+	if( item_index < sequence_object->number_of_items )
+	{
+		sequence_object->current_index++;
+	}
+	PYEVTX_END_CRITICAL_SECTION
+
+	if( item_index >= sequence_object->number_of_items )
 	{
 		PyErr_SetNone(
 		 PyExc_StopIteration );
@@ -440,11 +454,20 @@ PyObject *pyevtx_strings_iternext(
 	}
 	string_object = sequence_object->get_item_by_index(
 	                 sequence_object->parent_object,
-	                 sequence_object->current_index );
+	                 item_index );
 
-	if( string_object != NULL )
+	if( string_object == NULL )
 	{
-		sequence_object->current_index++;
+		/* Give back the index so that the item can be retrieved again
+		 * if no other item was claimed in the meantime
+		 */
+		PYEVTX_BEGIN_CRITICAL_SECTION( sequence_object )
+
+		if( sequence_object->current_index == ( item_index + 1 ) )
+		{
+			sequence_object->current_index = item_index;
+		}
+		PYEVTX_END_CRITICAL_SECTION
 	}
 	return( string_object );
 }
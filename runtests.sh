@@ -69,6 +69,27 @@ run_configure_make_check()
 	return ${EXIT_SUCCESS};
 }
 
+run_make_bench_check()
+{
+	if ! test -z ${SKIP_BENCH_CHECK};
+	then
+		echo "Running: 'make bench-check' skipped";
+
+		return ${EXIT_SUCCESS};
+	fi
+
+	(cd tests && make bench-check);
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Running: 'make bench-check' failed";
+
+		return ${RESULT};
+	fi
+	return ${EXIT_SUCCESS};
+}
+
 run_configure_make_check_with_asan()
 {
 	local LDCONFIG=`which ldconfig 2> /dev/null`;
@@ -242,6 +263,17 @@ then
 	exit ${EXIT_FAILURE};
 fi
 
+# Test the performance against the baseline, set SKIP_BENCH_CHECK to skip.
+# This uses the build without options since the later builds are instrumented.
+
+run_make_bench_check;
+RESULT=$?;
+
+if test ${RESULT} -ne ${EXIT_SUCCESS};
+then
+	exit ${EXIT_FAILURE};
+fi
+
 if test ${HAVE_ENABLE_VERBOSE_OUTPUT} -eq 0 && test ${HAVE_ENABLE_DEBUG_OUTPUT} -eq 0;
 then
 	# Test "./configure && make && make check" with verbose and debug output.
@@ -164,6 +164,14 @@ SED_SCRIPT="/^$/ {
 		fi
 	fi
 
+	# Make the necessary changes to the Makefile.am of the libraries that use the libevtx allocator
+	if test ${LOCAL_LIB} = "libfcache" || test ${LOCAL_LIB} = "libfdata" || test ${LOCAL_LIB} = "libfwevt";
+	then
+		sed -i'~' '/^AM_CPPFLAGS = /a\
+	-DHAVE_LIBEVTX_ALLOCATOR \\
+' ${LOCAL_LIB_MAKEFILE_AM};
+	fi
+
 	# Remove libyal/libyal.c
 	rm -f ${LOCAL_LIB}/${LOCAL_LIB}.c;
 
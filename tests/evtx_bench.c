@@ -0,0 +1,1606 @@
+/*
+ * Benchmark of the libevtx file, record and XML functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+#include "evtx_bench_generator.h"
+#include "evtx_test_getopt.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_memory.h"
+
+#define EVTX_BENCH_DEFAULT_FILENAME		_SYSTEM_STRING( "evtx_bench.evtx" )
+
+typedef struct evtx_bench_result evtx_bench_result_t;
+
+struct evtx_bench_result
+{
+	/* The name of the benchmark
+	 */
+	const char *name;
+
+	/* The duration of the individual samples in nanoseconds
+	 */
+	uint64_t *samples;
+
+	/* The number of samples
+	 */
+	size_t number_of_samples;
+
+	/* The number of allocated samples
+	 */
+	size_t number_of_allocated_samples;
+
+	/* The total duration in nanoseconds
+	 */
+	uint64_t total_time;
+
+	/* The total number of bytes produced
+	 */
+	uint64_t total_size;
+
+	/* The total number of allocations
+	 */
+	uint64_t number_of_allocations;
+};
+
+/* Prints usage information
+ */
+void evtx_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtx_bench to measure the performance of libevtx.\n\n" );
+
+	fprintf( stream, "Usage: evtx_bench [ -c number_of_chunks ] [ -g ] [ -j results_file ]\n"
+	                 "                  [ -n repetitions ] [ -o output_file ] [ -r corruption_rate ]\n"
+	                 "                  [ -s seed ] [ -t number_of_templates ] [ -h ] [ source ]\n\n" );
+
+	fprintf( stream, "\tsource: an existing EVTX file, if not provided a synthetic file is generated\n\n" );
+	fprintf( stream, "\t-c:     number of chunks of the synthetic file, default is 64\n" );
+	fprintf( stream, "\t-g:     only generate the synthetic file\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     filename of the results in JSON, used by test_bench_check.sh\n" );
+	fprintf( stream, "\t-n:     number of repetitions of every benchmark, default is 5\n" );
+	fprintf( stream, "\t-o:     filename of the synthetic file, default is evtx_bench.evtx\n" );
+	fprintf( stream, "\t-r:     corruption rate, the percentage of the chunk space that contains\n"
+	                 "\t        deleted records, default is 10, the maximum is 90\n" );
+	fprintf( stream, "\t-s:     seed of the synthetic file, default is 1\n" );
+	fprintf( stream, "\t-t:     number of distinct templates of the synthetic file, default is 16\n" );
+}
+
+/* Copies a decimal string to a 32-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_copy_decimal_string(
+     const system_character_t *string,
+     uint32_t maximum_value,
+     uint32_t *value_32bit )
+{
+	size_t string_index = 0;
+	uint64_t value      = 0;
+
+	if( ( string == NULL )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( -1 );
+		}
+		value *= 10;
+		value += string[ string_index ] - (system_character_t) '0';
+
+		if( value > (uint64_t) maximum_value )
+		{
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value;
+
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * Returns the clock value
+ */
+uint64_t evtx_bench_get_time(
+          void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER frequency;
+
+	LARGE_INTEGER counter;
+
+	if( frequency.QuadPart == 0 )
+	{
+		QueryPerformanceFrequency(
+		 &frequency );
+	}
+	QueryPerformanceCounter(
+	 &counter );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+#else
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+#endif
+}
+
+/* Retrieves the number of allocations made so far
+ * Returns the number of allocations
+ */
+uint64_t evtx_bench_get_number_of_allocations(
+          void )
+{
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	return( evtx_test_number_of_malloc_calls + evtx_test_number_of_realloc_calls );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the peak resident set size of the process in KiB
+ * Returns the peak resident set size or 0 if not available
+ */
+uint64_t evtx_bench_get_peak_memory_usage(
+          void )
+{
+#if defined( WINAPI )
+	return( 0 );
+#else
+	struct rusage resource_usage;
+
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) != 0 )
+	{
+		return( 0 );
+	}
+#if defined( __APPLE__ )
+	/* On Mac OS X the maximum resident set size is in bytes
+	 */
+	return( (uint64_t) resource_usage.ru_maxrss / 1024 );
+#else
+	return( (uint64_t) resource_usage.ru_maxrss );
+#endif
+#endif /* defined( WINAPI ) */
+}
+
+/* Initializes a result
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_result_initialize(
+     evtx_bench_result_t *result,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_result_initialize";
+
+	if( memory_set(
+	     result,
+	     0,
+	     sizeof( evtx_bench_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear result.",
+		 function );
+
+		return( -1 );
+	}
+	result->name = name;
+
+	return( 1 );
+}
+
+/* Frees the samples of a result
+ */
+void evtx_bench_result_free(
+      evtx_bench_result_t *result )
+{
+	if( result->samples != NULL )
+	{
+		memory_free(
+		 result->samples );
+
+		result->samples = NULL;
+	}
+}
+
+/* Appends a sample to a result
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_result_append_sample(
+     evtx_bench_result_t *result,
+     uint64_t start_time,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint64_t *samples                  = NULL;
+	static char *function              = "evtx_bench_result_append_sample";
+	size_t number_of_allocated_samples = 0;
+	uint64_t sample                    = 0;
+
+	sample = evtx_bench_get_time() - start_time;
+
+	if( result->number_of_samples >= result->number_of_allocated_samples )
+	{
+		number_of_allocated_samples = result->number_of_allocated_samples * 2;
+
+		if( number_of_allocated_samples == 0 )
+		{
+			number_of_allocated_samples = 1024;
+		}
+		if( number_of_allocated_samples > ( (size_t) SSIZE_MAX / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated samples value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		samples = (uint64_t *) memory_reallocate(
+		                        result->samples,
+		                        sizeof( uint64_t ) * number_of_allocated_samples );
+
+		if( samples == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize samples.",
+			 function );
+
+			return( -1 );
+		}
+		result->samples                     = samples;
+		result->number_of_allocated_samples = number_of_allocated_samples;
+	}
+	result->samples[ result->number_of_samples++ ] = sample;
+
+	result->total_time += sample;
+	result->total_size += size;
+
+	return( 1 );
+}
+
+/* Compares two samples
+ * Returns -1 if the first is smaller, 0 if equal or 1 if the first is larger
+ */
+int evtx_bench_compare_samples(
+     const void *first_sample,
+     const void *second_sample )
+{
+	uint64_t first_value  = *( (const uint64_t *) first_sample );
+	uint64_t second_value = *( (const uint64_t *) second_sample );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Prints the header of the results table
+ */
+void evtx_bench_results_header_fprint(
+      FILE *stream )
+{
+	fprintf(
+	 stream,
+	 "%-22s %10s %12s %12s %10s %10s %10s %12s\n",
+	 "benchmark",
+	 "samples",
+	 "samples/s",
+	 "MiB/s",
+	 "p50 (us)",
+	 "p99 (us)",
+	 "total (ms)",
+	 "allocs/sample" );
+}
+
+/* Prints a result
+ * Sorts the samples to determine the percentiles
+ */
+void evtx_bench_result_fprint(
+      evtx_bench_result_t *result,
+      FILE *stream )
+{
+	double megabytes_per_second = 0.0;
+	double samples_per_second   = 0.0;
+	double total_seconds        = 0.0;
+	uint64_t p50_sample         = 0;
+	uint64_t p99_sample         = 0;
+
+	if( result->number_of_samples == 0 )
+	{
+		fprintf(
+		 stream,
+		 "%-22s %10s\n",
+		 result->name,
+		 "none" );
+
+		return;
+	}
+	qsort(
+	 result->samples,
+	 result->number_of_samples,
+	 sizeof( uint64_t ),
+	 &evtx_bench_compare_samples );
+
+	p50_sample = result->samples[ ( ( result->number_of_samples - 1 ) * 50 ) / 100 ];
+	p99_sample = result->samples[ ( ( result->number_of_samples - 1 ) * 99 ) / 100 ];
+
+	total_seconds = (double) result->total_time / 1000000000.0;
+
+	if( total_seconds > 0.0 )
+	{
+		samples_per_second   = (double) result->number_of_samples / total_seconds;
+		megabytes_per_second = ( (double) result->total_size / ( 1024.0 * 1024.0 ) ) / total_seconds;
+	}
+	fprintf(
+	 stream,
+	 "%-22s %10" PRIu64 " %12.0f ",
+	 result->name,
+	 (uint64_t) result->number_of_samples,
+	 samples_per_second );
+
+	if( result->total_size > 0 )
+	{
+		fprintf(
+		 stream,
+		 "%12.2f ",
+		 megabytes_per_second );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "%12s ",
+		 "-" );
+	}
+	fprintf(
+	 stream,
+	 "%10.2f %10.2f %10.2f ",
+	 (double) p50_sample / 1000.0,
+	 (double) p99_sample / 1000.0,
+	 (double) result->total_time / 1000000.0 );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	fprintf(
+	 stream,
+	 "%12.2f\n",
+	 (double) result->number_of_allocations / (double) result->number_of_samples );
+#else
+	fprintf(
+	 stream,
+	 "%12s\n",
+	 "n/a" );
+#endif
+}
+
+/* Prints the results in JSON
+ * Every benchmark is printed on a separate line so that test_bench_check.sh
+ * can compare the results without a JSON parser. Values that are not
+ * available are printed as null
+ */
+void evtx_bench_results_json_fprint(
+      evtx_bench_result_t *results,
+      int number_of_results,
+      uint32_t number_of_repetitions,
+      uint64_t peak_memory_usage,
+      FILE *stream )
+{
+	evtx_bench_result_t *result = NULL;
+	double total_seconds        = 0.0;
+	int result_index            = 0;
+
+	fprintf(
+	 stream,
+	 "{\n"
+	 "  \"repetitions\": %" PRIu32 ",\n",
+	 number_of_repetitions );
+
+	if( peak_memory_usage > 0 )
+	{
+		fprintf(
+		 stream,
+		 "  \"peak_rss_kib\": %" PRIu64 ",\n",
+		 peak_memory_usage );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "  \"peak_rss_kib\": null,\n" );
+	}
+	fprintf(
+	 stream,
+	 "  \"benchmarks\": [\n" );
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		result = &( results[ result_index ] );
+
+		total_seconds = (double) result->total_time / 1000000000.0;
+
+		fprintf(
+		 stream,
+		 "    { \"name\": \"%s\", \"samples\": %" PRIu64 ", ",
+		 result->name,
+		 (uint64_t) result->number_of_samples );
+
+		if( ( result->number_of_samples > 0 )
+		 && ( total_seconds > 0.0 ) )
+		{
+			fprintf(
+			 stream,
+			 "\"samples_per_second\": %.2f, ",
+			 (double) result->number_of_samples / total_seconds );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\"samples_per_second\": null, " );
+		}
+		if( ( result->total_size > 0 )
+		 && ( total_seconds > 0.0 ) )
+		{
+			fprintf(
+			 stream,
+			 "\"mib_per_second\": %.2f, ",
+			 ( (double) result->total_size / ( 1024.0 * 1024.0 ) ) / total_seconds );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\"mib_per_second\": null, " );
+		}
+#if defined( HAVE_EVTX_TEST_MEMORY )
+		if( result->number_of_samples > 0 )
+		{
+			fprintf(
+			 stream,
+			 "\"allocations_per_sample\": %.2f }",
+			 (double) result->number_of_allocations / (double) result->number_of_samples );
+		}
+		else
+#endif
+		{
+			fprintf(
+			 stream,
+			 "\"allocations_per_sample\": null }" );
+		}
+		if( ( result_index + 1 ) < number_of_results )
+		{
+			fprintf(
+			 stream,
+			 "," );
+		}
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	fprintf(
+	 stream,
+	 "  ]\n"
+	 "}\n" );
+}
+
+/* Writes the results in JSON to a file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_results_json_write(
+     evtx_bench_result_t *results,
+     int number_of_results,
+     uint32_t number_of_repetitions,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "evtx_bench_results_json_write";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          L"w" );
+#else
+	stream = file_stream_open(
+	          filename,
+	          "w" );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open results file.",
+		 function );
+
+		return( -1 );
+	}
+	evtx_bench_results_json_fprint(
+	 results,
+	 number_of_results,
+	 number_of_repetitions,
+	 evtx_bench_get_peak_memory_usage(),
+	 stream );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close results file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_file_open(
+     libevtx_file_t **file,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_file_open";
+
+	if( libevtx_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     *file,
+	     source,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     *file,
+	     source,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libevtx_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_file_close(
+     libevtx_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_file_close";
+	int result            = 1;
+
+	if( libevtx_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libevtx_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Measures opening and closing the file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_open(
+     evtx_bench_result_t *result,
+     const system_character_t *source,
+     int number_of_repetitions,
+     libcerror_error_t **error )
+{
+	libevtx_file_t *file       = NULL;
+	static char *function      = "evtx_bench_open";
+	uint64_t start_allocations = 0;
+	uint64_t start_time        = 0;
+	int repetition             = 0;
+
+	for( repetition = 0;
+	     repetition < number_of_repetitions;
+	     repetition++ )
+	{
+		start_allocations = evtx_bench_get_number_of_allocations();
+		start_time        = evtx_bench_get_time();
+
+		if( evtx_bench_file_open(
+		     &file,
+		     source,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( evtx_bench_file_close(
+		     &file,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( evtx_bench_result_append_sample(
+		     result,
+		     start_time,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		result->number_of_allocations += evtx_bench_get_number_of_allocations() - start_allocations;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: unable to benchmark open.",
+	 function );
+
+	return( -1 );
+}
+
+/* Measures retrieving the records and their identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_iterate(
+     evtx_bench_result_t *result,
+     libevtx_file_t *file,
+     int number_of_repetitions,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record   = NULL;
+	static char *function      = "evtx_bench_iterate";
+	uint64_t identifier        = 0;
+	uint64_t start_allocations = 0;
+	uint64_t start_time        = 0;
+	int number_of_records      = 0;
+	int record_index           = 0;
+	int repetition             = 0;
+
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( repetition = 0;
+	     repetition < number_of_repetitions;
+	     repetition++ )
+	{
+		start_allocations = evtx_bench_get_number_of_allocations();
+
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			start_time = evtx_bench_get_time();
+
+			if( libevtx_file_get_record_by_index(
+			     file,
+			     record_index,
+			     &record,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libevtx_record_get_identifier(
+			     record,
+			     &identifier,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libevtx_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( evtx_bench_result_append_sample(
+			     result,
+			     start_time,
+			     0,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		result->number_of_allocations += evtx_bench_get_number_of_allocations() - start_allocations;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: unable to benchmark record: %d.",
+	 function,
+	 record_index );
+
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Ensures the string buffer can hold a string of a specific size
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_resize_string(
+     uint8_t **string,
+     size_t *string_size,
+     size_t required_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_string = NULL;
+	static char *function       = "evtx_bench_resize_string";
+
+	if( required_size <= *string_size )
+	{
+		return( 1 );
+	}
+	if( required_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocated_string = (uint8_t *) memory_reallocate(
+	                                  *string,
+	                                  sizeof( uint8_t ) * required_size );
+
+	if( reallocated_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	*string      = reallocated_string;
+	*string_size = required_size;
+
+	return( 1 );
+}
+
+/* Measures rendering the records as XML
+ * If recovered is set the recovered records are used
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_xml(
+     evtx_bench_result_t *result,
+     libevtx_file_t *file,
+     uint8_t recovered,
+     int number_of_repetitions,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record   = NULL;
+	uint8_t *string            = NULL;
+	static char *function      = "evtx_bench_xml";
+	size_t string_size         = 0;
+	size_t utf8_string_size    = 0;
+	uint64_t start_allocations = 0;
+	uint64_t start_time        = 0;
+	int number_of_records      = 0;
+	int record_index           = 0;
+	int repetition             = 0;
+	int retrieve_result        = 0;
+
+	if( recovered == 0 )
+	{
+		retrieve_result = libevtx_file_get_number_of_records(
+		                   file,
+		                   &number_of_records,
+		                   error );
+	}
+	else
+	{
+		retrieve_result = libevtx_file_get_number_of_recovered_records(
+		                   file,
+		                   &number_of_records,
+		                   error );
+	}
+	if( retrieve_result != 1 )
+	{
+		goto on_error;
+	}
+	for( repetition = 0;
+	     repetition < number_of_repetitions;
+	     repetition++ )
+	{
+		start_allocations = evtx_bench_get_number_of_allocations();
+
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			start_time = evtx_bench_get_time();
+
+			if( recovered == 0 )
+			{
+				retrieve_result = libevtx_file_get_record_by_index(
+				                   file,
+				                   record_index,
+				                   &record,
+				                   error );
+			}
+			else
+			{
+				retrieve_result = libevtx_file_get_recovered_record_by_index(
+				                   file,
+				                   record_index,
+				                   &record,
+				                   error );
+			}
+			if( retrieve_result != 1 )
+			{
+				goto on_error;
+			}
+			if( libevtx_record_get_utf8_xml_string_size(
+			     record,
+			     &utf8_string_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( evtx_bench_resize_string(
+			     &string,
+			     &string_size,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libevtx_record_get_utf8_xml_string(
+			     record,
+			     string,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libevtx_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( evtx_bench_result_append_sample(
+			     result,
+			     start_time,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		result->number_of_allocations += evtx_bench_get_number_of_allocations() - start_allocations;
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: unable to benchmark record: %d.",
+	 function,
+	 record_index );
+
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	return( -1 );
+}
+
+/* Measures retrieving the values used by the text export
+ * (the event identifier, source name and strings)
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_text(
+     evtx_bench_result_t *result,
+     libevtx_file_t *file,
+     int number_of_repetitions,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record   = NULL;
+	uint8_t *string            = NULL;
+	static char *function      = "evtx_bench_text";
+	size_t record_text_size    = 0;
+	size_t string_size         = 0;
+	size_t utf8_string_size    = 0;
+	uint64_t start_allocations = 0;
+	uint64_t start_time        = 0;
+	uint32_t event_identifier  = 0;
+	int number_of_records      = 0;
+	int number_of_strings      = 0;
+	int record_index           = 0;
+	int repetition             = 0;
+	int retrieve_result        = 0;
+	int string_index           = 0;
+
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( repetition = 0;
+	     repetition < number_of_repetitions;
+	     repetition++ )
+	{
+		start_allocations = evtx_bench_get_number_of_allocations();
+
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			start_time       = evtx_bench_get_time();
+			record_text_size = 0;
+
+			if( libevtx_file_get_record_by_index(
+			     file,
+			     record_index,
+			     &record,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libevtx_record_get_event_identifier(
+			     record,
+			     &event_identifier,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			retrieve_result = libevtx_record_get_utf8_source_name_size(
+			                   record,
+			                   &utf8_string_size,
+			                   error );
+
+			if( retrieve_result == -1 )
+			{
+				goto on_error;
+			}
+			else if( retrieve_result != 0 )
+			{
+				if( evtx_bench_resize_string(
+				     &string,
+				     &string_size,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( libevtx_record_get_utf8_source_name(
+				     record,
+				     string,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				record_text_size += utf8_string_size;
+			}
+			if( libevtx_record_get_number_of_strings(
+			     record,
+			     &number_of_strings,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			for( string_index = 0;
+			     string_index < number_of_strings;
+			     string_index++ )
+			{
+				if( libevtx_record_get_utf8_string_size(
+				     record,
+				     string_index,
+				     &utf8_string_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( evtx_bench_resize_string(
+				     &string,
+				     &string_size,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( libevtx_record_get_utf8_string(
+				     record,
+				     string_index,
+				     string,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				record_text_size += utf8_string_size;
+			}
+			if( libevtx_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( evtx_bench_result_append_sample(
+			     result,
+			     start_time,
+			     record_text_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		result->number_of_allocations += evtx_bench_get_number_of_allocations() - start_allocations;
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: unable to benchmark record: %d.",
+	 function,
+	 record_index );
+
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	evtx_bench_generator_t generator;
+	evtx_bench_result_t results[ 5 ];
+
+	libcerror_error_t *error                   = NULL;
+	libevtx_file_t *file                       = NULL;
+	const system_character_t *output_filename  = EVTX_BENCH_DEFAULT_FILENAME;
+	const system_character_t *results_filename = NULL;
+	const system_character_t *source           = NULL;
+	system_integer_t option                    = 0;
+	uint32_t corruption_rate                   = 10;
+	uint32_t number_of_chunks                  = 64;
+	uint32_t number_of_repetitions             = 5;
+	uint32_t number_of_templates               = 16;
+	uint32_t seed                              = 1;
+	uint8_t generate_only                      = 0;
+	int result_index                           = 0;
+
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:ghj:n:o:r:s:t:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				evtx_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				if( evtx_bench_copy_decimal_string(
+				     optarg,
+				     UINT16_MAX,
+				     &number_of_chunks ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of chunks: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'g':
+				generate_only = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				evtx_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				results_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				if( ( evtx_bench_copy_decimal_string(
+				       optarg,
+				       INT16_MAX,
+				       &number_of_repetitions ) != 1 )
+				 || ( number_of_repetitions == 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of repetitions: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'o':
+				output_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				if( evtx_bench_copy_decimal_string(
+				     optarg,
+				     90,
+				     &corruption_rate ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported corruption rate: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 's':
+				if( evtx_bench_copy_decimal_string(
+				     optarg,
+				     UINT32_MAX,
+				     &seed ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported seed: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 't':
+				if( evtx_bench_copy_decimal_string(
+				     optarg,
+				     EVTX_BENCH_GENERATOR_MAXIMUM_NUMBER_OF_TEMPLATES,
+				     &number_of_templates ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of templates: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( source == NULL )
+	{
+		if( evtx_bench_generator_initialize(
+		     &generator,
+		     (uint16_t) number_of_chunks,
+		     (uint16_t) number_of_templates,
+		     (uint8_t) corruption_rate,
+		     seed,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize generator.\n" );
+
+			goto on_error;
+		}
+		if( evtx_bench_generator_write_file(
+		     &generator,
+		     output_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to generate file: %" PRIs_SYSTEM ".\n",
+			 output_filename );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Generated: %" PRIs_SYSTEM " with %" PRIu32 " chunks, %" PRIu32 " templates, %" PRIu64 " records and %" PRIu64 " deleted records (%" PRIu64 " partially overwritten).\n",
+		 output_filename,
+		 number_of_chunks,
+		 number_of_templates,
+		 generator.number_of_records,
+		 generator.number_of_deleted_records,
+		 generator.number_of_corrupted_records );
+
+		if( generate_only != 0 )
+		{
+			return( EXIT_SUCCESS );
+		}
+		source = output_filename;
+	}
+	for( result_index = 0;
+	     result_index < 5;
+	     result_index++ )
+	{
+		results[ result_index ].samples = NULL;
+	}
+	if( ( evtx_bench_result_initialize(
+	       &( results[ 0 ] ),
+	       "open",
+	       &error ) != 1 )
+	 || ( evtx_bench_result_initialize(
+	       &( results[ 1 ] ),
+	       "record iteration",
+	       &error ) != 1 )
+	 || ( evtx_bench_result_initialize(
+	       &( results[ 2 ] ),
+	       "XML rendering",
+	       &error ) != 1 )
+	 || ( evtx_bench_result_initialize(
+	       &( results[ 3 ] ),
+	       "text export",
+	       &error ) != 1 )
+	 || ( evtx_bench_result_initialize(
+	       &( results[ 4 ] ),
+	       "recovered XML",
+	       &error ) != 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize results.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_open(
+	     &( results[ 0 ] ),
+	     source,
+	     (int) number_of_repetitions,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark open.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_file_open(
+	     &file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( evtx_bench_iterate(
+	     &( results[ 1 ] ),
+	     file,
+	     (int) number_of_repetitions,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark record iteration.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_xml(
+	     &( results[ 2 ] ),
+	     file,
+	     0,
+	     (int) number_of_repetitions,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark XML rendering.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_text(
+	     &( results[ 3 ] ),
+	     file,
+	     (int) number_of_repetitions,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark text export.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_xml(
+	     &( results[ 4 ] ),
+	     file,
+	     1,
+	     (int) number_of_repetitions,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark recovered records.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_file_close(
+	     &file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Benchmark of: %" PRIs_SYSTEM " with %" PRIu32 " repetitions.\n\n",
+	 source,
+	 number_of_repetitions );
+
+	evtx_bench_results_header_fprint(
+	 stdout );
+
+	for( result_index = 0;
+	     result_index < 5;
+	     result_index++ )
+	{
+		evtx_bench_result_fprint(
+		 &( results[ result_index ] ),
+		 stdout );
+	}
+	if( results_filename != NULL )
+	{
+		if( evtx_bench_results_json_write(
+		     results,
+		     5,
+		     number_of_repetitions,
+		     results_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write results: %" PRIs_SYSTEM ".\n",
+			 results_filename );
+
+			goto on_error;
+		}
+	}
+	for( result_index = 0;
+	     result_index < 5;
+	     result_index++ )
+	{
+		evtx_bench_result_free(
+		 &( results[ result_index ] ) );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_close(
+		 file,
+		 NULL );
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( source != NULL )
+	{
+		for( result_index = 0;
+		     result_index < 5;
+		     result_index++ )
+		{
+			evtx_bench_result_free(
+			 &( results[ result_index ] ) );
+		}
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1931 @@
+/*
+ * Synthetic EVTX file generator for benchmarking
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "evtx_bench_generator.h"
+#include "evtx_test_libcerror.h"
+
+#define EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE		4096
+#define EVTX_BENCH_GENERATOR_CHUNK_SIZE			65536
+#define EVTX_BENCH_GENERATOR_CHUNK_HEADER_SIZE		512
+
+/* The maximum size of a single record including an inline template definition
+ */
+#define EVTX_BENCH_GENERATOR_MAXIMUM_RECORD_SIZE	4096
+
+/* The maximum number of template values
+ */
+#define EVTX_BENCH_GENERATOR_MAXIMUM_NUMBER_OF_VALUES	16
+
+/* The base written time: January 1, 2015 00:00:00 UTC as a FILETIME
+ */
+#define EVTX_BENCH_GENERATOR_BASE_WRITTEN_TIME		0x01d025c05ee2c000ULL
+
+typedef struct evtx_bench_generator_buffer evtx_bench_generator_buffer_t;
+
+struct evtx_bench_generator_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The current offset
+	 */
+	size_t offset;
+};
+
+typedef struct evtx_bench_generator_value evtx_bench_generator_value_t;
+
+struct evtx_bench_generator_value
+{
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The value data
+	 */
+	uint8_t data[ 64 ];
+
+	/* The value data size
+	 */
+	uint16_t data_size;
+};
+
+/* Retrieves the next pseudo random value
+ * This uses xorshift32 so that generated files are reproducible on all platforms
+ * Returns the pseudo random value
+ */
+uint32_t evtx_bench_generator_get_random(
+          evtx_bench_generator_t *generator )
+{
+	uint32_t value = generator->random_state;
+
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	generator->random_state = value;
+
+	return( value );
+}
+
+/* Calculates a little-endian CRC-32 as described in RFC 1952
+ * Returns the CRC-32
+ */
+uint32_t evtx_bench_generator_calculate_crc32(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value )
+{
+	size_t data_offset = 0;
+	uint32_t crc32     = 0;
+	uint8_t bit_index  = 0;
+
+	crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		crc32 ^= data[ data_offset ];
+
+		for( bit_index = 0;
+		     bit_index < 8;
+		     bit_index++ )
+		{
+			if( ( crc32 & 1 ) != 0 )
+			{
+				crc32 = (uint32_t) 0xedb88320UL ^ ( crc32 >> 1 );
+			}
+			else
+			{
+				crc32 >>= 1;
+			}
+		}
+	}
+	return( crc32 ^ (uint32_t) 0xffffffffUL );
+}
+
+/* Appends data to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_data(
+     evtx_bench_generator_buffer_t *buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_generator_buffer_append_data";
+
+	if( ( data_size > buffer->data_size )
+	 || ( buffer->offset > ( buffer->data_size - data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: buffer too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( buffer->data[ buffer->offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	buffer->offset += data_size;
+
+	return( 1 );
+}
+
+/* Appends an 8-bit value to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_uint8(
+     evtx_bench_generator_buffer_t *buffer,
+     uint8_t value,
+     libcerror_error_t **error )
+{
+	return( evtx_bench_generator_buffer_append_data(
+	         buffer,
+	         &value,
+	         1,
+	         error ) );
+}
+
+/* Appends a 16-bit little-endian value to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_uint16(
+     evtx_bench_generator_buffer_t *buffer,
+     uint16_t value,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 2 ];
+
+	byte_stream_copy_from_uint16_little_endian(
+	 data,
+	 value );
+
+	return( evtx_bench_generator_buffer_append_data(
+	         buffer,
+	         data,
+	         2,
+	         error ) );
+}
+
+/* Appends a 32-bit little-endian value to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_uint32(
+     evtx_bench_generator_buffer_t *buffer,
+     uint32_t value,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 4 ];
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data,
+	 value );
+
+	return( evtx_bench_generator_buffer_append_data(
+	         buffer,
+	         data,
+	         4,
+	         error ) );
+}
+
+/* Appends a 64-bit little-endian value to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_uint64(
+     evtx_bench_generator_buffer_t *buffer,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 8 ];
+
+	byte_stream_copy_from_uint64_little_endian(
+	 data,
+	 value );
+
+	return( evtx_bench_generator_buffer_append_data(
+	         buffer,
+	         data,
+	         8,
+	         error ) );
+}
+
+/* Sets the 32-bit size value at a specific offset to the number of bytes
+ * that were appended to the buffer after the size value
+ */
+void evtx_bench_generator_buffer_set_size(
+      evtx_bench_generator_buffer_t *buffer,
+      size_t size_offset )
+{
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer->data[ size_offset ] ),
+	 (uint32_t) ( buffer->offset - ( size_offset + 4 ) ) );
+}
+
+/* Appends an ASCII string as UTF-16 little-endian characters to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_utf16_string(
+     evtx_bench_generator_buffer_t *buffer,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_generator_buffer_append_utf16_string";
+	size_t string_index   = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( evtx_bench_generator_buffer_append_uint16(
+		     buffer,
+		     (uint16_t) string[ string_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append character: %" PRIu64 ".",
+			 function,
+			 (uint64_t) string_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends an inline name to the buffer
+ * The name is preceded by its (chunk-relative) offset
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_name(
+     evtx_bench_generator_buffer_t *buffer,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_generator_buffer_append_name";
+	size_t name_index     = 0;
+	size_t name_length    = 0;
+	uint16_t name_hash    = 0;
+
+	name_length = narrow_string_length(
+	               name );
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		name_hash = (uint16_t) ( ( name_hash * 65599 ) + (uint8_t) name[ name_index ] );
+	}
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     (uint32_t) ( buffer->offset + 4 ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint16(
+	     buffer,
+	     name_hash,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint16(
+	     buffer,
+	     (uint16_t) name_length,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_utf16_string(
+	     buffer,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint16(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append name: %s.",
+	 function,
+	 name );
+
+	return( -1 );
+}
+
+/* Appends an element start to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_element_start(
+     evtx_bench_generator_buffer_t *buffer,
+     const char *name,
+     uint8_t has_attributes,
+     size_t *data_size_offset,
+     libcerror_error_t **error )
+{
+	uint8_t token_type = 0x01;
+
+	if( has_attributes != 0 )
+	{
+		token_type = 0x41;
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     token_type,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( evtx_bench_generator_buffer_append_uint16(
+	     buffer,
+	     0xffff,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*data_size_offset = buffer->offset;
+
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( evtx_bench_generator_buffer_append_name(
+	         buffer,
+	         name,
+	         error ) );
+}
+
+/* Appends an element end token to the buffer and sets the element data size
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_element_end(
+     evtx_bench_generator_buffer_t *buffer,
+     uint8_t token_type,
+     size_t data_size_offset,
+     libcerror_error_t **error )
+{
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     token_type,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	evtx_bench_generator_buffer_set_size(
+	 buffer,
+	 data_size_offset );
+
+	return( 1 );
+}
+
+/* Appends an attribute start to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_attribute(
+     evtx_bench_generator_buffer_t *buffer,
+     const char *name,
+     uint8_t is_last_attribute,
+     libcerror_error_t **error )
+{
+	uint8_t token_type = 0x46;
+
+	if( is_last_attribute != 0 )
+	{
+		token_type = 0x06;
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     token_type,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( evtx_bench_generator_buffer_append_name(
+	         buffer,
+	         name,
+	         error ) );
+}
+
+/* Appends a value text to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_value_text(
+     evtx_bench_generator_buffer_t *buffer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	size_t string_length = 0;
+
+	string_length = narrow_string_length(
+	                 string );
+
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x05,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x01,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( evtx_bench_generator_buffer_append_uint16(
+	     buffer,
+	     (uint16_t) string_length,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( evtx_bench_generator_buffer_append_utf16_string(
+	         buffer,
+	         string,
+	         string_length,
+	         error ) );
+}
+
+/* Appends a normal substitution to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_substitution(
+     evtx_bench_generator_buffer_t *buffer,
+     uint16_t substitution_identifier,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x0d,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( evtx_bench_generator_buffer_append_uint16(
+	     buffer,
+	     substitution_identifier,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( evtx_bench_generator_buffer_append_uint8(
+	         buffer,
+	         value_type,
+	         error ) );
+}
+
+/* Appends an element that only contains a substitution to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_substitution_element(
+     evtx_bench_generator_buffer_t *buffer,
+     const char *name,
+     uint16_t substitution_identifier,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	size_t data_size_offset = 0;
+
+	if( evtx_bench_generator_buffer_append_element_start(
+	     buffer,
+	     name,
+	     0,
+	     &data_size_offset,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x02,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( evtx_bench_generator_buffer_append_substitution(
+	     buffer,
+	     substitution_identifier,
+	     value_type,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( evtx_bench_generator_buffer_append_element_end(
+	         buffer,
+	         0x04,
+	         data_size_offset,
+	         error ) );
+}
+
+/* Determines the number of EventData fields of a specific template
+ * Returns the number of fields
+ */
+uint16_t evtx_bench_generator_get_number_of_fields(
+          uint16_t template_index )
+{
+	return( (uint16_t) ( 2 + ( template_index % 6 ) ) );
+}
+
+/* Determines the value type of a specific EventData field
+ * Returns the value type
+ */
+uint8_t evtx_bench_generator_get_field_value_type(
+         uint16_t field_index )
+{
+	if( ( field_index % 2 ) == 0 )
+	{
+		return( 0x01 );
+	}
+	return( 0x08 );
+}
+
+/* Appends a template definition to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_template_definition(
+     evtx_bench_generator_buffer_t *buffer,
+     uint16_t template_index,
+     libcerror_error_t **error )
+{
+	char field_name[ 16 ];
+	uint8_t template_identifier[ 16 ];
+
+	size_t data_size_offsets[ 4 ];
+	size_t attribute_list_size_offset = 0;
+	size_t data_size_offset           = 0;
+	size_t field_data_size_offset     = 0;
+	static char *function             = "evtx_bench_generator_buffer_append_template_definition";
+	uint16_t field_index              = 0;
+	uint16_t number_of_fields         = 0;
+
+	if( memory_set(
+	     template_identifier,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 template_identifier,
+	 template_index );
+
+	template_identifier[ 15 ] = 0xbe;
+
+	/* The next template definition offset
+	 */
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_data(
+	     buffer,
+	     template_identifier,
+	     16,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	data_size_offset = buffer->offset;
+
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The fragment header
+	 */
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0x0001010fUL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* <Event xmlns="...">
+	 */
+	if( evtx_bench_generator_buffer_append_element_start(
+	     buffer,
+	     "Event",
+	     1,
+	     &( data_size_offsets[ 0 ] ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	attribute_list_size_offset = buffer->offset;
+
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_attribute(
+	     buffer,
+	     "xmlns",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_value_text(
+	     buffer,
+	     "http://schemas.microsoft.com/win/2004/08/events/event",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	evtx_bench_generator_buffer_set_size(
+	 buffer,
+	 attribute_list_size_offset );
+
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x02,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* <System>
+	 */
+	if( evtx_bench_generator_buffer_append_element_start(
+	     buffer,
+	     "System",
+	     0,
+	     &( data_size_offsets[ 1 ] ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x02,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* <Provider Name="%1" Guid="%2"/>
+	 */
+	if( evtx_bench_generator_buffer_append_element_start(
+	     buffer,
+	     "Provider",
+	     1,
+	     &( data_size_offsets[ 2 ] ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	attribute_list_size_offset = buffer->offset;
+
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_attribute(
+	     buffer,
+	     "Name",
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution(
+	     buffer,
+	     0,
+	     0x01,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_attribute(
+	     buffer,
+	     "Guid",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution(
+	     buffer,
+	     1,
+	     0x0f,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	evtx_bench_generator_buffer_set_size(
+	 buffer,
+	 attribute_list_size_offset );
+
+	if( evtx_bench_generator_buffer_append_element_end(
+	     buffer,
+	     0x03,
+	     data_size_offsets[ 2 ],
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution_element(
+	     buffer,
+	     "EventID",
+	     2,
+	     0x06,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution_element(
+	     buffer,
+	     "Level",
+	     3,
+	     0x04,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* <TimeCreated SystemTime="%5"/>
+	 */
+	if( evtx_bench_generator_buffer_append_element_start(
+	     buffer,
+	     "TimeCreated",
+	     1,
+	     &( data_size_offsets[ 2 ] ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	attribute_list_size_offset = buffer->offset;
+
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_attribute(
+	     buffer,
+	     "SystemTime",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution(
+	     buffer,
+	     4,
+	     0x11,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	evtx_bench_generator_buffer_set_size(
+	 buffer,
+	 attribute_list_size_offset );
+
+	if( evtx_bench_generator_buffer_append_element_end(
+	     buffer,
+	     0x03,
+	     data_size_offsets[ 2 ],
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution_element(
+	     buffer,
+	     "EventRecordID",
+	     5,
+	     0x0a,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution_element(
+	     buffer,
+	     "Channel",
+	     6,
+	     0x01,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_substitution_element(
+	     buffer,
+	     "Computer",
+	     7,
+	     0x01,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* </System>
+	 */
+	if( evtx_bench_generator_buffer_append_element_end(
+	     buffer,
+	     0x04,
+	     data_size_offsets[ 1 ],
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* <EventData>
+	 */
+	if( evtx_bench_generator_buffer_append_element_start(
+	     buffer,
+	     "EventData",
+	     0,
+	     &( data_size_offsets[ 1 ] ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x02,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	number_of_fields = evtx_bench_generator_get_number_of_fields(
+	                    template_index );
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		/* <Data Name="Field#">%#</Data>
+		 */
+		if( evtx_bench_generator_buffer_append_element_start(
+		     buffer,
+		     "Data",
+		     1,
+		     &field_data_size_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		attribute_list_size_offset = buffer->offset;
+
+		if( evtx_bench_generator_buffer_append_uint32(
+		     buffer,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( evtx_bench_generator_buffer_append_attribute(
+		     buffer,
+		     "Name",
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( narrow_string_snprintf(
+		     field_name,
+		     16,
+		     "Field%" PRIu16 "",
+		     field_index ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set field name.",
+			 function );
+
+			return( -1 );
+		}
+		if( evtx_bench_generator_buffer_append_value_text(
+		     buffer,
+		     field_name,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		evtx_bench_generator_buffer_set_size(
+		 buffer,
+		 attribute_list_size_offset );
+
+		if( evtx_bench_generator_buffer_append_uint8(
+		     buffer,
+		     0x02,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( evtx_bench_generator_buffer_append_substitution(
+		     buffer,
+		     (uint16_t) ( 8 + field_index ),
+		     evtx_bench_generator_get_field_value_type(
+		      field_index ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( evtx_bench_generator_buffer_append_element_end(
+		     buffer,
+		     0x04,
+		     field_data_size_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* </EventData>
+	 */
+	if( evtx_bench_generator_buffer_append_element_end(
+	     buffer,
+	     0x04,
+	     data_size_offsets[ 1 ],
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* </Event>
+	 */
+	if( evtx_bench_generator_buffer_append_element_end(
+	     buffer,
+	     0x04,
+	     data_size_offsets[ 0 ],
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The end of file token
+	 */
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x00,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	evtx_bench_generator_buffer_set_size(
+	 buffer,
+	 data_size_offset );
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append template definition: %" PRIu16 ".",
+	 function,
+	 template_index );
+
+	return( -1 );
+}
+
+/* Sets an UTF-16 little-endian string value
+ */
+void evtx_bench_generator_value_set_string(
+      evtx_bench_generator_value_t *value,
+      const char *string )
+{
+	size_t string_index  = 0;
+	size_t string_length = 0;
+
+	string_length = narrow_string_length(
+	                 string );
+
+	if( string_length > 32 )
+	{
+		string_length = 32;
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( value->data[ string_index * 2 ] ),
+		 (uint16_t) string[ string_index ] );
+	}
+	value->value_type = 0x01;
+	value->data_size  = (uint16_t) ( string_length * 2 );
+}
+
+/* Appends a record to the buffer
+ * If template_definition_offsets is NULL the template definition is always stored inline
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_buffer_append_record(
+     evtx_bench_generator_buffer_t *buffer,
+     evtx_bench_generator_t *generator,
+     uint32_t *template_definition_offsets,
+     uint16_t template_index,
+     uint64_t record_identifier,
+     libcerror_error_t **error )
+{
+	char string[ 32 ];
+
+	evtx_bench_generator_value_t values[ EVTX_BENCH_GENERATOR_MAXIMUM_NUMBER_OF_VALUES ];
+
+	static char *function               = "evtx_bench_generator_buffer_append_record";
+	size_t record_offset                = 0;
+	uint64_t written_time               = 0;
+	uint32_t template_definition_offset = 0;
+	uint16_t field_index                = 0;
+	uint16_t number_of_values           = 0;
+	uint16_t value_index                = 0;
+	uint8_t inline_template             = 0;
+
+	written_time = EVTX_BENCH_GENERATOR_BASE_WRITTEN_TIME
+	             + ( record_identifier * 10000000UL );
+
+	record_offset = buffer->offset;
+
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0x00002a2aUL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint64(
+	     buffer,
+	     record_identifier,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint64(
+	     buffer,
+	     written_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The fragment header and template instance
+	 */
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     0x0001010fUL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x0c,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint8(
+	     buffer,
+	     0x01,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     (uint32_t) ( 0x62650000UL | template_index ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( template_definition_offsets == NULL )
+	 || ( template_definition_offsets[ template_index ] == 0 ) )
+	{
+		template_definition_offset = (uint32_t) ( buffer->offset + 4 );
+		inline_template            = 1;
+
+		if( template_definition_offsets != NULL )
+		{
+			template_definition_offsets[ template_index ] = template_definition_offset;
+		}
+	}
+	else
+	{
+		template_definition_offset = template_definition_offsets[ template_index ];
+	}
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     template_definition_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( inline_template != 0 )
+	{
+		if( evtx_bench_generator_buffer_append_template_definition(
+		     buffer,
+		     template_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* The template instance values
+	 */
+	if( narrow_string_snprintf(
+	     string,
+	     32,
+	     "Bench-Provider-%" PRIu16 "",
+	     (uint16_t) ( template_index % 4 ) ) < 0 )
+	{
+		goto on_error;
+	}
+	evtx_bench_generator_value_set_string(
+	 &( values[ 0 ] ),
+	 string );
+
+	values[ 1 ].value_type = 0x0f;
+	values[ 1 ].data_size  = 16;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 values[ 1 ].data,
+	 0x62656e63UL );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( values[ 1 ].data[ 4 ] ),
+	 (uint32_t) ( template_index % 4 ) );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( values[ 1 ].data[ 8 ] ),
+	 0x0123456789abcdefULL );
+
+	values[ 2 ].value_type = 0x06;
+	values[ 2 ].data_size  = 2;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 values[ 2 ].data,
+	 (uint16_t) ( 1000 + template_index ) );
+
+	values[ 3 ].value_type = 0x04;
+	values[ 3 ].data_size  = 1;
+	values[ 3 ].data[ 0 ]  = (uint8_t) ( 1 + ( evtx_bench_generator_get_random( generator ) % 5 ) );
+
+	values[ 4 ].value_type = 0x11;
+	values[ 4 ].data_size  = 8;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 values[ 4 ].data,
+	 written_time );
+
+	values[ 5 ].value_type = 0x0a;
+	values[ 5 ].data_size  = 8;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 values[ 5 ].data,
+	 record_identifier );
+
+	evtx_bench_generator_value_set_string(
+	 &( values[ 6 ] ),
+	 "Application" );
+
+	evtx_bench_generator_value_set_string(
+	 &( values[ 7 ] ),
+	 "bench-host.example.com" );
+
+	number_of_values = 8 + evtx_bench_generator_get_number_of_fields(
+	                        template_index );
+
+	for( value_index = 8;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		field_index = value_index - 8;
+
+		if( evtx_bench_generator_get_field_value_type(
+		     field_index ) == 0x01 )
+		{
+			if( narrow_string_snprintf(
+			     string,
+			     32,
+			     "value-%08" PRIx32 "",
+			     evtx_bench_generator_get_random( generator ) ) < 0 )
+			{
+				goto on_error;
+			}
+			evtx_bench_generator_value_set_string(
+			 &( values[ value_index ] ),
+			 string );
+		}
+		else
+		{
+			values[ value_index ].value_type = 0x08;
+			values[ value_index ].data_size  = 4;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 values[ value_index ].data,
+			 evtx_bench_generator_get_random( generator ) );
+		}
+	}
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     (uint32_t) number_of_values,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( evtx_bench_generator_buffer_append_uint16(
+		     buffer,
+		     values[ value_index ].data_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( evtx_bench_generator_buffer_append_uint16(
+		     buffer,
+		     (uint16_t) values[ value_index ].value_type,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( evtx_bench_generator_buffer_append_data(
+		     buffer,
+		     values[ value_index ].data,
+		     (size_t) values[ value_index ].data_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* The copy of the size
+	 */
+	if( evtx_bench_generator_buffer_append_uint32(
+	     buffer,
+	     (uint32_t) ( buffer->offset + 4 - record_offset ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer->data[ record_offset + 4 ] ),
+	 (uint32_t) ( buffer->offset - record_offset ) );
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append record: %" PRIu64 ".",
+	 function,
+	 record_identifier );
+
+	return( -1 );
+}
+
+/* Selects a template
+ * The selection is skewed towards the templates with a low index,
+ * similar to event logs in which a few event types are dominant
+ * Returns the template index
+ */
+uint16_t evtx_bench_generator_select_template(
+          evtx_bench_generator_t *generator )
+{
+	uint32_t first_index  = 0;
+	uint32_t second_index = 0;
+
+	first_index  = evtx_bench_generator_get_random( generator ) % generator->number_of_templates;
+	second_index = evtx_bench_generator_get_random( generator ) % generator->number_of_templates;
+
+	if( first_index < second_index )
+	{
+		return( (uint16_t) first_index );
+	}
+	return( (uint16_t) second_index );
+}
+
+/* Initializes the generator
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_initialize(
+     evtx_bench_generator_t *generator,
+     uint16_t number_of_chunks,
+     uint16_t number_of_templates,
+     uint8_t corruption_rate,
+     uint32_t seed,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_generator_initialize";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of chunks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_templates == 0 )
+	 || ( number_of_templates > EVTX_BENCH_GENERATOR_MAXIMUM_NUMBER_OF_TEMPLATES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of templates value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( corruption_rate > 90 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid corruption rate value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     generator,
+	     0,
+	     sizeof( evtx_bench_generator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generator.",
+		 function );
+
+		return( -1 );
+	}
+	generator->number_of_chunks       = number_of_chunks;
+	generator->number_of_templates    = number_of_templates;
+	generator->corruption_rate        = corruption_rate;
+	generator->random_state           = seed;
+	generator->next_record_identifier = 1;
+
+	/* xorshift32 requires a non-zero state
+	 */
+	if( generator->random_state == 0 )
+	{
+		generator->random_state = 0x2545f491UL;
+	}
+	return( 1 );
+}
+
+/* Writes a chunk into the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_write_chunk(
+     evtx_bench_generator_t *generator,
+     uint8_t *chunk_data,
+     libcerror_error_t **error )
+{
+	evtx_bench_generator_buffer_t buffer;
+
+	static char *function                 = "evtx_bench_generator_write_chunk";
+	size_t free_space_offset              = 0;
+	size_t last_record_offset             = 0;
+	size_t record_offset                  = 0;
+	size_t slack_size                     = 0;
+	uint64_t first_record_identifier      = 0;
+	uint32_t checksum                     = 0;
+	uint32_t number_of_records            = 0;
+	uint32_t record_index                 = 0;
+
+	if( memory_set(
+	     chunk_data,
+	     0,
+	     EVTX_BENCH_GENERATOR_CHUNK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     generator->template_definition_offsets,
+	     0,
+	     sizeof( uint32_t ) * EVTX_BENCH_GENERATOR_MAXIMUM_NUMBER_OF_TEMPLATES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template definition offsets.",
+		 function );
+
+		return( -1 );
+	}
+	buffer.data      = chunk_data;
+	buffer.data_size = EVTX_BENCH_GENERATOR_CHUNK_SIZE - 4;
+	buffer.offset    = EVTX_BENCH_GENERATOR_CHUNK_HEADER_SIZE;
+
+	first_record_identifier = generator->next_record_identifier;
+
+	/* Reserve space for the deleted records in the free space
+	 */
+	slack_size = ( ( EVTX_BENCH_GENERATOR_CHUNK_SIZE - EVTX_BENCH_GENERATOR_CHUNK_HEADER_SIZE )
+	           * generator->corruption_rate ) / 100;
+
+	while( ( buffer.offset + EVTX_BENCH_GENERATOR_MAXIMUM_RECORD_SIZE + slack_size ) <= buffer.data_size )
+	{
+		last_record_offset = buffer.offset;
+
+		if( evtx_bench_generator_buffer_append_record(
+		     &buffer,
+		     generator,
+		     generator->template_definition_offsets,
+		     evtx_bench_generator_select_template(
+		      generator ),
+		     generator->next_record_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record.",
+			 function );
+
+			return( -1 );
+		}
+		generator->next_record_identifier += 1;
+
+		number_of_records++;
+	}
+	free_space_offset = buffer.offset;
+
+	/* Write the deleted records in the free space with their template
+	 * definitions inline, since the data they could reference is considered overwritten
+	 */
+	for( record_index = 0;
+	     ( buffer.offset + EVTX_BENCH_GENERATOR_MAXIMUM_RECORD_SIZE ) <= buffer.data_size;
+	     record_index++ )
+	{
+		record_offset = buffer.offset;
+
+		if( evtx_bench_generator_buffer_append_record(
+		     &buffer,
+		     generator,
+		     NULL,
+		     evtx_bench_generator_select_template(
+		      generator ),
+		     first_record_identifier + record_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append deleted record.",
+			 function );
+
+			return( -1 );
+		}
+		/* Every fourth deleted record is partially overwritten
+		 */
+		if( ( record_index % 4 ) == 3 )
+		{
+			if( memory_set(
+			     &( chunk_data[ record_offset + ( ( buffer.offset - record_offset ) / 2 ) ] ),
+			     0,
+			     buffer.offset - ( record_offset + ( ( buffer.offset - record_offset ) / 2 ) ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to overwrite deleted record.",
+				 function );
+
+				return( -1 );
+			}
+			generator->number_of_corrupted_records += 1;
+		}
+		generator->number_of_deleted_records += 1;
+	}
+	generator->number_of_records += number_of_records;
+
+	/* The chunk header
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 chunk_data,
+	 0x006b6e6843666c45ULL );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk_data[ 8 ] ),
+	 first_record_identifier );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk_data[ 16 ] ),
+	 generator->next_record_identifier - 1 );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk_data[ 24 ] ),
+	 first_record_identifier );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk_data[ 32 ] ),
+	 generator->next_record_identifier - 1 );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 40 ] ),
+	 128 );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 44 ] ),
+	 (uint32_t) last_record_offset );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 48 ] ),
+	 (uint32_t) free_space_offset );
+
+	checksum = evtx_bench_generator_calculate_crc32(
+	            &( chunk_data[ EVTX_BENCH_GENERATOR_CHUNK_HEADER_SIZE ] ),
+	            free_space_offset - EVTX_BENCH_GENERATOR_CHUNK_HEADER_SIZE,
+	            0 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 52 ] ),
+	 checksum );
+
+	checksum = evtx_bench_generator_calculate_crc32(
+	            chunk_data,
+	            120,
+	            0 );
+
+	checksum = evtx_bench_generator_calculate_crc32(
+	            &( chunk_data[ 128 ] ),
+	            EVTX_BENCH_GENERATOR_CHUNK_HEADER_SIZE - 128,
+	            checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 124 ] ),
+	 checksum );
+
+	return( 1 );
+}
+
+/* Writes a synthetic EVTX file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_generator_write_file(
+     evtx_bench_generator_t *generator,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE ];
+
+	FILE *stream          = NULL;
+	uint8_t *chunk_data   = NULL;
+	static char *function = "evtx_bench_generator_write_file";
+	uint32_t checksum     = 0;
+	uint16_t chunk_index  = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * EVTX_BENCH_GENERATOR_CHUNK_SIZE );
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          L"wb" );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file header is written last since it contains the next record identifier
+	 */
+	if( memory_set(
+	     file_header_data,
+	     0,
+	     EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_write(
+	     stream,
+	     file_header_data,
+	     EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE ) != EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < generator->number_of_chunks;
+	     chunk_index++ )
+	{
+		if( evtx_bench_generator_write_chunk(
+		     generator,
+		     chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( file_stream_write(
+		     stream,
+		     chunk_data,
+		     EVTX_BENCH_GENERATOR_CHUNK_SIZE ) != EVTX_BENCH_GENERATOR_CHUNK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header_data,
+	 0x00656c6946666c45ULL );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_header_data[ 16 ] ),
+	 (uint64_t) ( generator->number_of_chunks - 1 ) );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_header_data[ 24 ] ),
+	 generator->next_record_identifier );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 32 ] ),
+	 128 );
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 36 ] ),
+	 1 );
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 38 ] ),
+	 3 );
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 40 ] ),
+	 EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE );
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 42 ] ),
+	 generator->number_of_chunks );
+
+	checksum = evtx_bench_generator_calculate_crc32(
+	            file_header_data,
+	            120,
+	            0 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 124 ] ),
+	 checksum );
+
+	/* Reopen the file to overwrite the file header
+	 */
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          L"r+b" );
+#else
+	stream = file_stream_open(
+	          filename,
+	          "r+b" );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to reopen file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_write(
+	     stream,
+	     file_header_data,
+	     EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE ) != EVTX_BENCH_GENERATOR_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 chunk_data );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,101 @@
+/*
+ * Synthetic EVTX file generator for benchmarking
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTX_BENCH_GENERATOR_H )
+#define _EVTX_BENCH_GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtx_test_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of templates
+ */
+#define EVTX_BENCH_GENERATOR_MAXIMUM_NUMBER_OF_TEMPLATES	256
+
+typedef struct evtx_bench_generator evtx_bench_generator_t;
+
+struct evtx_bench_generator
+{
+	/* The number of chunks
+	 */
+	uint16_t number_of_chunks;
+
+	/* The number of (distinct) templates
+	 */
+	uint16_t number_of_templates;
+
+	/* The corruption rate
+	 * Contains the percentage of the chunk records space that is filled with
+	 * deleted records in the free space, of which every fourth is partially overwritten
+	 * The maximum supported value is 90
+	 */
+	uint8_t corruption_rate;
+
+	/* The pseudo random state
+	 */
+	uint32_t random_state;
+
+	/* The (chunk-relative) template definition offsets
+	 * Contains 0 if the template was not yet written in the current chunk
+	 */
+	uint32_t template_definition_offsets[ EVTX_BENCH_GENERATOR_MAXIMUM_NUMBER_OF_TEMPLATES ];
+
+	/* The next record identifier
+	 */
+	uint64_t next_record_identifier;
+
+	/* The number of records written
+	 */
+	uint64_t number_of_records;
+
+	/* The number of deleted records written
+	 */
+	uint64_t number_of_deleted_records;
+
+	/* The number of corrupted deleted records written
+	 */
+	uint64_t number_of_corrupted_records;
+};
+
+int evtx_bench_generator_initialize(
+     evtx_bench_generator_t *generator,
+     uint16_t number_of_chunks,
+     uint16_t number_of_templates,
+     uint8_t corruption_rate,
+     uint32_t seed,
+     libcerror_error_t **error );
+
+int evtx_bench_generator_write_file(
+     evtx_bench_generator_t *generator,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTX_BENCH_GENERATOR_H ) */
+
@@ -0,0 +1,961 @@
+/*
+ * Micro benchmark of the libevtx low-level functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <x86intrin.h>
+
+#define EVTX_MICROBENCH_HAVE_TSC
+#endif
+
+#include "evtx_test_getopt.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_byte_stream.h"
+#include "../libevtx/libevtx_checksum.h"
+#include "../libevtx/libevtx_io_handle.h"
+#include "../libevtx/libevtx_record_values.h"
+#include "../libevtx/libevtx_signature.h"
+#include "../libevtx/libevtx_utf16_stream.h"
+
+/* The size of the largest benchmarked buffer, the size of a chunk
+ */
+#define EVTX_MICROBENCH_MAXIMUM_DATA_SIZE	65536
+
+/* The size of the event records of the record header benchmark
+ */
+#define EVTX_MICROBENCH_RECORD_SIZE		256
+
+/* The number of bytes of the UTF-16 strings of the conversion benchmark
+ */
+#define EVTX_MICROBENCH_STRING_SIZE		64
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+typedef struct evtx_microbench_context evtx_microbench_context_t;
+
+struct evtx_microbench_context
+{
+	/* The IO handle of the record header benchmark
+	 */
+	libevtx_io_handle_t *io_handle;
+
+	/* The record values of the record header benchmark
+	 */
+	libevtx_record_values_t *record_values;
+
+	/* The UTF-8 string of the conversion benchmark
+	 */
+	uint8_t utf8_string[ ( EVTX_MICROBENCH_STRING_SIZE * 2 ) + 1 ];
+
+	/* The result of the last call, which keeps the calls from being optimized out
+	 */
+	uint64_t sink;
+};
+
+/* A benchmarked kernel, which processes data_size bytes of data
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*evtx_microbench_kernel_t)(
+              evtx_microbench_context_t *context,
+              const uint8_t *data,
+              size_t data_size,
+              libcerror_error_t **error );
+
+/* Prints usage information
+ */
+void evtx_microbench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtx_microbench to measure the performance of the libevtx low-level\n"
+	                 "functions, such as the checksum, 0-byte fill and signature scans.\n\n" );
+
+	fprintf( stream, "Usage: evtx_microbench [ -f frequency ] [ -t milliseconds ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-f:     the CPU frequency in MHz, used to determine the cycles per byte,\n"
+	                 "\t        by default the time-stamp counter is used, if available\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-t:     the minimum duration of every benchmark in milliseconds,\n"
+	                 "\t        default is 200\n" );
+}
+
+/* Copies a decimal string to a 32-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_microbench_copy_decimal_string(
+     const system_character_t *string,
+     uint32_t maximum_value,
+     uint32_t *value_32bit )
+{
+	size_t string_index = 0;
+	uint64_t value      = 0;
+
+	if( ( string == NULL )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( -1 );
+		}
+		value *= 10;
+		value += string[ string_index ] - (system_character_t) '0';
+
+		if( value > (uint64_t) maximum_value )
+		{
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value;
+
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * Returns the clock value
+ */
+uint64_t evtx_microbench_get_time(
+          void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER frequency;
+
+	LARGE_INTEGER counter;
+
+	if( frequency.QuadPart == 0 )
+	{
+		QueryPerformanceFrequency(
+		 &frequency );
+	}
+	QueryPerformanceCounter(
+	 &counter );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+#else
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+#endif
+}
+
+/* Retrieves the current value of the cycle counter
+ * Returns the counter value or 0 if not available
+ */
+uint64_t evtx_microbench_get_cycles(
+          void )
+{
+#if defined( EVTX_MICROBENCH_HAVE_TSC )
+	return( (uint64_t) __rdtsc() );
+#else
+	return( 0 );
+#endif
+}
+
+/* Calculates the CRC-32 of the data
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_microbench_kernel_crc32(
+     evtx_microbench_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint32_t crc32 = 0;
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &crc32,
+	     (uint8_t *) data,
+	     data_size,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	context->sink += crc32;
+
+	return( 1 );
+}
+
+/* Checks the data for 0-byte fill
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_microbench_kernel_zero_byte_fill(
+     evtx_microbench_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	int result = 0;
+
+	result = libevtx_byte_stream_check_for_zero_byte_fill(
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	context->sink += (uint64_t) result;
+
+	return( 1 );
+}
+
+/* Scans the data for an event record signature
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_microbench_kernel_signature_scan(
+     evtx_microbench_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	size_t signature_offset = 0;
+	int result              = 0;
+
+	result = libevtx_signature_find_event_record(
+	          data,
+	          data_size,
+	          0,
+	          &signature_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	context->sink += (uint64_t) signature_offset + (uint64_t) result;
+
+	return( 1 );
+}
+
+/* Reads the headers of the event records in the data
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_microbench_kernel_record_header(
+     evtx_microbench_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     ( data_offset + EVTX_MICROBENCH_RECORD_SIZE ) <= data_size;
+	     data_offset += EVTX_MICROBENCH_RECORD_SIZE )
+	{
+		if( libevtx_record_values_read_header(
+		     context->record_values,
+		     context->io_handle,
+		     data,
+		     data_size,
+		     data_offset,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		context->sink += context->record_values->identifier;
+	}
+	return( 1 );
+}
+
+/* Converts the UTF-16 little-endian strings in the data to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_microbench_kernel_utf16_to_utf8(
+     evtx_microbench_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	size_t data_offset      = 0;
+	size_t utf8_string_size = 0;
+
+	for( data_offset = 0;
+	     ( data_offset + EVTX_MICROBENCH_STRING_SIZE ) <= data_size;
+	     data_offset += EVTX_MICROBENCH_STRING_SIZE )
+	{
+		if( libevtx_utf16_stream_get_utf8_string_size(
+		     &( data[ data_offset ] ),
+		     EVTX_MICROBENCH_STRING_SIZE,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( utf8_string_size > sizeof( context->utf8_string ) )
+		{
+			return( -1 );
+		}
+		if( libevtx_utf16_stream_copy_to_utf8_string(
+		     &( data[ data_offset ] ),
+		     EVTX_MICROBENCH_STRING_SIZE,
+		     context->utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		context->sink += context->utf8_string[ 0 ];
+	}
+	return( 1 );
+}
+
+/* Prints the header of the results table
+ */
+void evtx_microbench_results_header_fprint(
+      FILE *stream )
+{
+	fprintf(
+	 stream,
+	 "%-22s %8s %6s %12s %10s %12s %10s\n",
+	 "kernel",
+	 "size",
+	 "align",
+	 "iterations",
+	 "ns/byte",
+	 "cycles/byte",
+	 "MiB/s" );
+}
+
+/* Measures a kernel
+ * The kernel is called repeatedly until the minimum duration has passed
+ * after a warm-up call. The cycles per byte are determined by the frequency
+ * if set, otherwise by the time-stamp counter, if available
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_microbench_run(
+     const char *name,
+     evtx_microbench_kernel_t kernel,
+     evtx_microbench_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     size_t alignment,
+     uint64_t minimum_time,
+     uint32_t frequency,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function           = "evtx_microbench_run";
+	double cycles_per_byte          = 0.0;
+	double megabytes_per_second     = 0.0;
+	double nanoseconds_per_byte     = 0.0;
+	uint64_t elapsed_cycles         = 0;
+	uint64_t elapsed_time           = 0;
+	uint64_t number_of_iterations   = 0;
+	uint64_t start_cycles           = 0;
+	uint64_t start_time             = 0;
+	uint64_t total_size             = 0;
+	int iteration_index             = 0;
+
+	if( kernel(
+	     context,
+	     &( data[ alignment ] ),
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run kernel: %s.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	start_time   = evtx_microbench_get_time();
+	start_cycles = evtx_microbench_get_cycles();
+
+	/* The clock is read after every 16 calls so that it does not dominate small sizes
+	 */
+	do
+	{
+		for( iteration_index = 0;
+		     iteration_index < 16;
+		     iteration_index++ )
+		{
+			if( kernel(
+			     context,
+			     &( data[ alignment ] ),
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to run kernel: %s.",
+				 function,
+				 name );
+
+				return( -1 );
+			}
+		}
+		number_of_iterations += 16;
+
+		elapsed_time = evtx_microbench_get_time() - start_time;
+	}
+	while( elapsed_time < minimum_time );
+
+	elapsed_cycles = evtx_microbench_get_cycles() - start_cycles;
+
+	total_size = number_of_iterations * (uint64_t) data_size;
+
+	if( total_size > 0 )
+	{
+		nanoseconds_per_byte = (double) elapsed_time / (double) total_size;
+
+		if( frequency != 0 )
+		{
+			cycles_per_byte = ( nanoseconds_per_byte * (double) frequency ) / 1000.0;
+		}
+		else
+		{
+			cycles_per_byte = (double) elapsed_cycles / (double) total_size;
+		}
+	}
+	if( elapsed_time > 0 )
+	{
+		megabytes_per_second = ( (double) total_size / ( 1024.0 * 1024.0 ) ) / ( (double) elapsed_time / 1000000000.0 );
+	}
+	fprintf(
+	 stream,
+	 "%-22s %8" PRIzu " %6" PRIzu " %12" PRIu64 " %10.4f ",
+	 name,
+	 data_size,
+	 alignment,
+	 number_of_iterations,
+	 nanoseconds_per_byte );
+
+	if( ( frequency != 0 )
+	 || ( elapsed_cycles != 0 ) )
+	{
+		fprintf(
+		 stream,
+		 "%12.4f ",
+		 cycles_per_byte );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "%12s ",
+		 "n/a" );
+	}
+	fprintf(
+	 stream,
+	 "%10.1f\n",
+	 megabytes_per_second );
+
+	return( 1 );
+}
+
+/* Fills the data with event records of EVTX_MICROBENCH_RECORD_SIZE bytes
+ */
+void evtx_microbench_fill_records(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset     = 0;
+	uint64_t identifier    = 1;
+	uint64_t written_time  = 0x01d0000000000000ULL;
+
+	for( data_offset = 0;
+	     ( data_offset + EVTX_MICROBENCH_RECORD_SIZE ) <= data_size;
+	     data_offset += EVTX_MICROBENCH_RECORD_SIZE )
+	{
+		data[ data_offset ]     = 0x2a;
+		data[ data_offset + 1 ] = 0x2a;
+		data[ data_offset + 2 ] = 0x00;
+		data[ data_offset + 3 ] = 0x00;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 4 ] ),
+		 EVTX_MICROBENCH_RECORD_SIZE );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 identifier );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 written_time );
+
+		/* The binary XML fragment header
+		 */
+		data[ data_offset + 24 ] = 0x0f;
+		data[ data_offset + 25 ] = 0x01;
+		data[ data_offset + 26 ] = 0x01;
+		data[ data_offset + 27 ] = 0x00;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + EVTX_MICROBENCH_RECORD_SIZE - 4 ] ),
+		 EVTX_MICROBENCH_RECORD_SIZE );
+
+		identifier   += 1;
+		written_time += 10000000;
+	}
+}
+
+/* Fills the data with UTF-16 little-endian strings of EVTX_MICROBENCH_STRING_SIZE bytes
+ * The strings contain only ASCII characters or, every 8th character, a Latin-1 character
+ */
+void evtx_microbench_fill_strings(
+      uint8_t *data,
+      size_t data_size,
+      uint8_t is_ascii )
+{
+	const char *ascii_string = "C:\\Windows\\System32\\svchost.exe -k netsvcs -p -s Schedule";
+	size_t character_index   = 0;
+	size_t data_offset       = 0;
+	size_t string_length     = 57;
+
+	for( data_offset = 0;
+	     ( data_offset + 2 ) <= data_size;
+	     data_offset += 2 )
+	{
+		character_index = ( data_offset % EVTX_MICROBENCH_STRING_SIZE ) / 2;
+
+		if( ( is_ascii == 0 )
+		 && ( ( character_index % 8 ) == 7 ) )
+		{
+			/* U+00FC LATIN SMALL LETTER U WITH DIAERESIS
+			 */
+			data[ data_offset ]     = 0xfc;
+			data[ data_offset + 1 ] = 0x00;
+		}
+		else
+		{
+			data[ data_offset ]     = (uint8_t) ascii_string[ character_index % string_length ];
+			data[ data_offset + 1 ] = 0x00;
+		}
+	}
+}
+
+/* Fills the data with pseudo random bytes without event record signatures
+ */
+void evtx_microbench_fill_random(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t value     = 1;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( value >> 16 );
+
+		/* Prevent false positive signatures at the offsets that are scanned
+		 */
+		if( ( data_offset >= 1 )
+		 && ( data[ data_offset ] == 0x2a )
+		 && ( data[ data_offset - 1 ] == 0x2a ) )
+		{
+			data[ data_offset ] = 0x2b;
+		}
+	}
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+	evtx_microbench_context_t context;
+
+	size_t crc32_alignments[ 3 ] = { 0, 1, 4 };
+	size_t crc32_sizes[ 4 ]      = { 64, 512, 4096, 65536 };
+
+	libcerror_error_t *error     = NULL;
+	uint8_t *allocated_data      = NULL;
+	uint8_t *data                = NULL;
+	system_integer_t option      = 0;
+	uint64_t minimum_time        = 0;
+	uint32_t frequency           = 0;
+	uint32_t milliseconds        = 200;
+	int alignment_index          = 0;
+	int size_index               = 0;
+
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "f:ht:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				evtx_microbench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'f':
+				if( evtx_microbench_copy_decimal_string(
+				     optarg,
+				     100000,
+				     &frequency ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported frequency: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'h':
+				evtx_microbench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 't':
+				if( ( evtx_microbench_copy_decimal_string(
+				       optarg,
+				       600000,
+				       &milliseconds ) != 1 )
+				 || ( milliseconds == 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported duration: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+		}
+	}
+	minimum_time = (uint64_t) milliseconds * 1000000;
+
+	if( memory_set(
+	     &context,
+	     0,
+	     sizeof( evtx_microbench_context_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear context.\n" );
+
+		goto on_error;
+	}
+	/* The data is aligned to 64 bytes so that the alignments are relative to a cache line
+	 */
+	allocated_data = (uint8_t *) memory_allocate(
+	                              EVTX_MICROBENCH_MAXIMUM_DATA_SIZE + 128 );
+
+	if( allocated_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create data.\n" );
+
+		goto on_error;
+	}
+	data = (uint8_t *) ( ( (intptr_t) allocated_data + 63 ) & ~( (intptr_t) 63 ) );
+
+	if( libevtx_io_handle_initialize(
+	     &( context.io_handle ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create IO handle.\n" );
+
+		goto on_error;
+	}
+	if( libevtx_record_values_initialize(
+	     &( context.record_values ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create record values.\n" );
+
+		goto on_error;
+	}
+#if defined( EVTX_MICROBENCH_HAVE_TSC )
+	fprintf(
+	 stdout,
+	 "Cycles are %s.\n\n",
+	 ( frequency != 0 ) ? "determined by the frequency" : "time-stamp counter (reference) cycles" );
+#else
+	fprintf(
+	 stdout,
+	 "Cycles are %s.\n\n",
+	 ( frequency != 0 ) ? "determined by the frequency" : "not available, use -f to set the frequency" );
+#endif
+	evtx_microbench_results_header_fprint(
+	 stdout );
+
+	/* The CRC-32 is calculated over pseudo random data
+	 */
+	evtx_microbench_fill_random(
+	 data,
+	 EVTX_MICROBENCH_MAXIMUM_DATA_SIZE + 64 );
+
+	for( size_index = 0;
+	     size_index < 4;
+	     size_index++ )
+	{
+		for( alignment_index = 0;
+		     alignment_index < 3;
+		     alignment_index++ )
+		{
+			if( evtx_microbench_run(
+			     "crc32",
+			     &evtx_microbench_kernel_crc32,
+			     &context,
+			     data,
+			     crc32_sizes[ size_index ],
+			     crc32_alignments[ alignment_index ],
+			     minimum_time,
+			     frequency,
+			     stdout,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	/* The signature scan over data without signatures scans all the data
+	 */
+	if( evtx_microbench_run(
+	     "signature scan",
+	     &evtx_microbench_kernel_signature_scan,
+	     &context,
+	     data,
+	     EVTX_MICROBENCH_MAXIMUM_DATA_SIZE,
+	     0,
+	     minimum_time,
+	     frequency,
+	     stdout,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The 0-byte fill check over 0-byte filled data checks all the data
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     EVTX_MICROBENCH_MAXIMUM_DATA_SIZE + 64 ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear data.\n" );
+
+		goto on_error;
+	}
+	for( alignment_index = 0;
+	     alignment_index < 2;
+	     alignment_index++ )
+	{
+		if( evtx_microbench_run(
+		     "zero byte fill",
+		     &evtx_microbench_kernel_zero_byte_fill,
+		     &context,
+		     data,
+		     EVTX_MICROBENCH_MAXIMUM_DATA_SIZE,
+		     crc32_alignments[ alignment_index ],
+		     minimum_time,
+		     frequency,
+		     stdout,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	evtx_microbench_fill_records(
+	 data,
+	 EVTX_MICROBENCH_MAXIMUM_DATA_SIZE );
+
+	if( evtx_microbench_run(
+	     "record header",
+	     &evtx_microbench_kernel_record_header,
+	     &context,
+	     data,
+	     EVTX_MICROBENCH_MAXIMUM_DATA_SIZE,
+	     0,
+	     minimum_time,
+	     frequency,
+	     stdout,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	evtx_microbench_fill_strings(
+	 data,
+	 EVTX_MICROBENCH_MAXIMUM_DATA_SIZE,
+	 1 );
+
+	if( evtx_microbench_run(
+	     "UTF-16 to UTF-8 ASCII",
+	     &evtx_microbench_kernel_utf16_to_utf8,
+	     &context,
+	     data,
+	     EVTX_MICROBENCH_MAXIMUM_DATA_SIZE,
+	     0,
+	     minimum_time,
+	     frequency,
+	     stdout,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	evtx_microbench_fill_strings(
+	 data,
+	 EVTX_MICROBENCH_MAXIMUM_DATA_SIZE,
+	 0 );
+
+	if( evtx_microbench_run(
+	     "UTF-16 to UTF-8 Latin",
+	     &evtx_microbench_kernel_utf16_to_utf8,
+	     &context,
+	     data,
+	     EVTX_MICROBENCH_MAXIMUM_DATA_SIZE,
+	     0,
+	     minimum_time,
+	     frequency,
+	     stdout,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libevtx_record_values_free(
+	     &( context.record_values ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free record values.\n" );
+
+		goto on_error;
+	}
+	if( libevtx_io_handle_free(
+	     &( context.io_handle ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free IO handle.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 allocated_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( context.record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &( context.record_values ),
+		 NULL );
+	}
+	if( context.io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &( context.io_handle ),
+		 NULL );
+	}
+	if( allocated_data != NULL )
+	{
+		memory_free(
+		 allocated_data );
+	}
+	return( EXIT_FAILURE );
+#else
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	fprintf(
+	 stderr,
+	 "The micro benchmarks require the internal functions of libevtx.\n" );
+
+	return( EXIT_FAILURE );
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+}
+
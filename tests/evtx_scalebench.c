@@ -0,0 +1,1269 @@
+/*
+ * Benchmark of the scalability of concurrent read access to libevtx files
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "evtx_bench_generator.h"
+#include "evtx_test_getopt.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libcthreads.h"
+#include "evtx_test_libevtx.h"
+
+#define EVTX_SCALEBENCH_DEFAULT_FILENAME		_SYSTEM_STRING( "evtx_scalebench.evtx" )
+
+#define EVTX_SCALEBENCH_MAXIMUM_NUMBER_OF_THREADS	64
+
+enum EVTX_SCALEBENCH_SCENARIOS
+{
+	EVTX_SCALEBENCH_SCENARIO_SHARED_FILE		= 0,
+	EVTX_SCALEBENCH_SCENARIO_INDEPENDENT_FILES	= 1,
+	EVTX_SCALEBENCH_SCENARIO_PARALLEL_EXPORT	= 2,
+
+	EVTX_SCALEBENCH_NUMBER_OF_SCENARIOS		= 3
+};
+
+typedef struct evtx_scalebench_worker evtx_scalebench_worker_t;
+
+struct evtx_scalebench_worker
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The scenario
+	 */
+	int scenario;
+
+	/* The file
+	 */
+	libevtx_file_t *file;
+
+	/* Value to indicate the file is owned by the worker
+	 */
+	uint8_t owns_file;
+
+	/* The number of records of the file
+	 */
+	int number_of_records;
+
+	/* The index of the first record of a parallel export
+	 */
+	int first_record_index;
+
+	/* The number of operations
+	 */
+	int number_of_operations;
+
+	/* The state of the pseudo random record index generator
+	 */
+	uint32_t random_state;
+
+	/* The duration of the individual operations in nanoseconds
+	 */
+	uint64_t *samples;
+
+	/* The number of samples
+	 */
+	int number_of_samples;
+
+	/* The XML string
+	 */
+	uint8_t *string;
+
+	/* The XML string size
+	 */
+	size_t string_size;
+
+	/* The total number of bytes produced
+	 */
+	uint64_t total_size;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct evtx_scalebench_result evtx_scalebench_result_t;
+
+struct evtx_scalebench_result
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of operations of all threads
+	 */
+	uint64_t number_of_operations;
+
+	/* The elapsed wall clock time in nanoseconds
+	 */
+	uint64_t elapsed_time;
+
+	/* The 99th percentile of the operation duration in nanoseconds
+	 */
+	uint64_t p99_sample;
+
+	/* The time spent waiting for the file locks in nanoseconds
+	 */
+	uint64_t lock_wait_time;
+
+	/* The total number of bytes produced
+	 */
+	uint64_t total_size;
+};
+
+const char *evtx_scalebench_scenario_names[ EVTX_SCALEBENCH_NUMBER_OF_SCENARIOS ] = {
+	"shared file",
+	"independent files",
+	"parallel export" };
+
+/* Prints usage information
+ */
+void evtx_scalebench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtx_scalebench to measure the scalability of concurrent read access\n"
+	                 "with libevtx.\n\n" );
+
+	fprintf( stream, "Usage: evtx_scalebench [ -c number_of_chunks ] [ -n number_of_operations ]\n"
+	                 "                       [ -o output_file ] [ -s seed ] [ -t number_of_threads ]\n"
+	                 "                       [ -h ] [ source ]\n\n" );
+
+	fprintf( stream, "\tsource: an existing EVTX file, if not provided a synthetic file is generated\n\n" );
+	fprintf( stream, "\t-c:     number of chunks of the synthetic file, default is 64\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-n:     number of random record reads per thread, default is 10000\n" );
+	fprintf( stream, "\t-o:     filename of the synthetic file, default is evtx_scalebench.evtx\n" );
+	fprintf( stream, "\t-s:     seed of the synthetic file and the random reads, default is 1\n" );
+	fprintf( stream, "\t-t:     maximum number of threads, the number of threads is doubled\n"
+	                 "\t        from 1 up to the maximum, default is 8\n" );
+}
+
+/* Copies a decimal string to a 32-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_scalebench_copy_decimal_string(
+     const system_character_t *string,
+     uint32_t maximum_value,
+     uint32_t *value_32bit )
+{
+	size_t string_index = 0;
+	uint64_t value      = 0;
+
+	if( ( string == NULL )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( -1 );
+		}
+		value *= 10;
+		value += string[ string_index ] - (system_character_t) '0';
+
+		if( value > (uint64_t) maximum_value )
+		{
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value;
+
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * Returns the clock value
+ */
+uint64_t evtx_scalebench_get_time(
+          void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER frequency;
+
+	LARGE_INTEGER counter;
+
+	if( frequency.QuadPart == 0 )
+	{
+		QueryPerformanceFrequency(
+		 &frequency );
+	}
+	QueryPerformanceCounter(
+	 &counter );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+#else
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+#endif
+}
+
+/* Compares two samples
+ * Returns -1 if the first is smaller, 0 if equal or 1 if the first is larger
+ */
+int evtx_scalebench_compare_samples(
+     const void *first_sample,
+     const void *second_sample )
+{
+	uint64_t first_value  = *( (const uint64_t *) first_sample );
+	uint64_t second_value = *( (const uint64_t *) second_sample );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_scalebench_file_open(
+     libevtx_file_t **file,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_scalebench_file_open";
+
+	if( libevtx_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     *file,
+	     source,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     *file,
+	     source,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libevtx_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_scalebench_file_close(
+     libevtx_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_scalebench_file_close";
+	int result            = 1;
+
+	if( libevtx_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libevtx_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the time spent waiting for the locks of a file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_scalebench_file_get_lock_wait_time(
+     libevtx_file_t *file,
+     uint64_t *lock_wait_time,
+     libcerror_error_t **error )
+{
+	uint64_t statistics[ LIBEVTX_NUMBER_OF_STATISTICS ];
+
+	static char *function = "evtx_scalebench_file_get_lock_wait_time";
+
+	if( libevtx_file_get_statistics(
+	     file,
+	     statistics,
+	     LIBEVTX_NUMBER_OF_STATISTICS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	*lock_wait_time = statistics[ LIBEVTX_STATISTIC_LOCK_WAIT_TIME ];
+
+	return( 1 );
+}
+
+/* Frees the resources of a worker
+ */
+void evtx_scalebench_worker_free(
+      evtx_scalebench_worker_t *worker )
+{
+	if( worker->owns_file != 0 )
+	{
+		if( worker->file != NULL )
+		{
+			evtx_scalebench_file_close(
+			 &( worker->file ),
+			 NULL );
+		}
+		worker->owns_file = 0;
+	}
+	worker->file = NULL;
+
+	if( worker->samples != NULL )
+	{
+		memory_free(
+		 worker->samples );
+
+		worker->samples = NULL;
+	}
+	if( worker->string != NULL )
+	{
+		memory_free(
+		 worker->string );
+
+		worker->string      = NULL;
+		worker->string_size = 0;
+	}
+	if( worker->error != NULL )
+	{
+		libcerror_error_free(
+		 &( worker->error ) );
+	}
+}
+
+/* Reads a record and renders it as XML if the worker exports
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_scalebench_worker_read_record(
+     evtx_scalebench_worker_t *worker,
+     int record_index,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	uint8_t *string          = NULL;
+	static char *function    = "evtx_scalebench_worker_read_record";
+	size_t utf8_string_size  = 0;
+	uint64_t identifier      = 0;
+
+	if( libevtx_file_get_record_by_index(
+	     worker->file,
+	     record_index,
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	if( worker->scenario != EVTX_SCALEBENCH_SCENARIO_PARALLEL_EXPORT )
+	{
+		if( libevtx_record_get_identifier(
+		     record,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libevtx_record_get_utf8_xml_string_size(
+		     record,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve XML string size of record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( utf8_string_size > worker->string_size )
+		{
+			string = (uint8_t *) memory_reallocate(
+			                      worker->string,
+			                      sizeof( uint8_t ) * utf8_string_size );
+
+			if( string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize string.",
+				 function );
+
+				goto on_error;
+			}
+			worker->string      = string;
+			worker->string_size = utf8_string_size;
+		}
+		if( libevtx_record_get_utf8_xml_string(
+		     record,
+		     worker->string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve XML string of record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		worker->total_size += utf8_string_size;
+	}
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the operations of a worker
+ * The random reads use a linear congruential generator so every run reads the same records
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_scalebench_worker_run(
+     evtx_scalebench_worker_t *worker )
+{
+	uint64_t start_time = 0;
+	int operation_index = 0;
+	int record_index    = 0;
+
+	for( operation_index = 0;
+	     operation_index < worker->number_of_operations;
+	     operation_index++ )
+	{
+		if( worker->scenario == EVTX_SCALEBENCH_SCENARIO_PARALLEL_EXPORT )
+		{
+			record_index = worker->first_record_index + operation_index;
+		}
+		else
+		{
+			worker->random_state = ( worker->random_state * 1103515245UL ) + 12345;
+
+			record_index = (int) ( ( worker->random_state >> 8 ) % (uint32_t) worker->number_of_records );
+		}
+		start_time = evtx_scalebench_get_time();
+
+		if( evtx_scalebench_worker_read_record(
+		     worker,
+		     record_index,
+		     &( worker->error ) ) != 1 )
+		{
+			return( -1 );
+		}
+		worker->samples[ worker->number_of_samples++ ] = evtx_scalebench_get_time() - start_time;
+	}
+	return( 1 );
+}
+
+/* Measures a scenario with a specific number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_scalebench_run_scenario(
+     evtx_scalebench_result_t *result,
+     int scenario,
+     const system_character_t *source,
+     libevtx_file_t *shared_file,
+     int number_of_records,
+     int number_of_threads,
+     int number_of_operations,
+     uint32_t seed,
+     libcerror_error_t **error )
+{
+	evtx_scalebench_worker_t workers[ EVTX_SCALEBENCH_MAXIMUM_NUMBER_OF_THREADS ];
+
+	uint64_t *samples         = NULL;
+	static char *function     = "evtx_scalebench_run_scenario";
+	uint64_t lock_wait_time   = 0;
+	uint64_t start_time       = 0;
+	int first_record_index    = 0;
+	int number_of_samples     = 0;
+	int worker_index          = 0;
+	int worker_result         = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int number_of_started_workers = 0;
+#endif
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > EVTX_SCALEBENCH_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( evtx_scalebench_worker_t ) * EVTX_SCALEBENCH_MAXIMUM_NUMBER_OF_THREADS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		workers[ worker_index ].scenario          = scenario;
+		workers[ worker_index ].number_of_records = number_of_records;
+		workers[ worker_index ].random_state      = seed + (uint32_t) worker_index;
+
+		if( scenario == EVTX_SCALEBENCH_SCENARIO_PARALLEL_EXPORT )
+		{
+			/* The records are partitioned in consecutive ranges, one per thread
+			 */
+			workers[ worker_index ].first_record_index   = first_record_index;
+			workers[ worker_index ].number_of_operations = ( number_of_records / number_of_threads )
+			                                             + ( ( worker_index < ( number_of_records % number_of_threads ) ) ? 1 : 0 );
+
+			first_record_index += workers[ worker_index ].number_of_operations;
+		}
+		else
+		{
+			workers[ worker_index ].number_of_operations = number_of_operations;
+		}
+		if( scenario == EVTX_SCALEBENCH_SCENARIO_INDEPENDENT_FILES )
+		{
+			if( evtx_scalebench_file_open(
+			     &( workers[ worker_index ].file ),
+			     source,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			workers[ worker_index ].owns_file = 1;
+		}
+		else
+		{
+			workers[ worker_index ].file = shared_file;
+		}
+		if( workers[ worker_index ].number_of_operations > 0 )
+		{
+			workers[ worker_index ].samples = (uint64_t *) memory_allocate(
+			                                                sizeof( uint64_t ) * workers[ worker_index ].number_of_operations );
+
+			if( workers[ worker_index ].samples == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create samples of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( libevtx_file_reset_statistics(
+		     workers[ worker_index ].file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset statistics of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	start_time = evtx_scalebench_get_time();
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The calling thread runs the first worker
+	 */
+	for( worker_index = 1;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( workers[ worker_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &evtx_scalebench_worker_run,
+		     (void *) &( workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			worker_result = -1;
+
+			break;
+		}
+		number_of_started_workers++;
+	}
+	if( worker_result == 1 )
+	{
+		worker_result = evtx_scalebench_worker_run(
+		                 &( workers[ 0 ] ) );
+	}
+	for( worker_index = 1;
+	     worker_index <= number_of_started_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( workers[ worker_index ].thread ),
+		     NULL ) != 1 )
+		{
+			worker_result = -1;
+		}
+	}
+#else
+	if( number_of_threads != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of threads without multi-threading support.",
+		 function );
+
+		goto on_error;
+	}
+	worker_result = evtx_scalebench_worker_run(
+	                 &( workers[ 0 ] ) );
+#endif
+	result->elapsed_time = evtx_scalebench_get_time() - start_time;
+
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].error != NULL )
+		{
+			libcerror_error_backtrace_fprint(
+			 workers[ worker_index ].error,
+			 stderr );
+
+			worker_result = -1;
+		}
+	}
+	if( worker_result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run workers.",
+		 function );
+
+		goto on_error;
+	}
+	result->number_of_threads    = number_of_threads;
+	result->number_of_operations = 0;
+	result->total_size           = 0;
+	result->lock_wait_time       = 0;
+	result->p99_sample           = 0;
+
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		result->number_of_operations += (uint64_t) workers[ worker_index ].number_of_samples;
+		result->total_size           += workers[ worker_index ].total_size;
+
+		/* The workers of the shared file scenarios share the statistics
+		 */
+		if( ( worker_index == 0 )
+		 || ( workers[ worker_index ].owns_file != 0 ) )
+		{
+			if( evtx_scalebench_file_get_lock_wait_time(
+			     workers[ worker_index ].file,
+			     &lock_wait_time,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			result->lock_wait_time += lock_wait_time;
+		}
+	}
+	if( result->number_of_operations > 0 )
+	{
+		samples = (uint64_t *) memory_allocate(
+		                        sizeof( uint64_t ) * (size_t) result->number_of_operations );
+
+		if( samples == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create samples.",
+			 function );
+
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_threads;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].number_of_samples == 0 )
+			{
+				continue;
+			}
+			if( memory_copy(
+			     &( samples[ number_of_samples ] ),
+			     workers[ worker_index ].samples,
+			     sizeof( uint64_t ) * workers[ worker_index ].number_of_samples ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy samples of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			number_of_samples += workers[ worker_index ].number_of_samples;
+		}
+		qsort(
+		 samples,
+		 (size_t) number_of_samples,
+		 sizeof( uint64_t ),
+		 &evtx_scalebench_compare_samples );
+
+		result->p99_sample = samples[ ( ( number_of_samples - 1 ) * 99 ) / 100 ];
+
+		memory_free(
+		 samples );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		evtx_scalebench_worker_free(
+		 &( workers[ worker_index ] ) );
+	}
+	return( 1 );
+
+on_error:
+	if( samples != NULL )
+	{
+		memory_free(
+		 samples );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		evtx_scalebench_worker_free(
+		 &( workers[ worker_index ] ) );
+	}
+	return( -1 );
+}
+
+/* Prints the header of the results table
+ */
+void evtx_scalebench_results_header_fprint(
+      FILE *stream )
+{
+	fprintf(
+	 stream,
+	 "%-18s %8s %12s %12s %10s %10s %14s\n",
+	 "scenario",
+	 "threads",
+	 "records",
+	 "records/s",
+	 "speedup",
+	 "p99 (us)",
+	 "lock wait (ms)" );
+}
+
+/* Prints a result
+ * The speedup is relative to the throughput of a single thread
+ */
+void evtx_scalebench_result_fprint(
+      evtx_scalebench_result_t *result,
+      const char *scenario_name,
+      double single_thread_records_per_second,
+      FILE *stream )
+{
+	double records_per_second = 0.0;
+	double speedup            = 0.0;
+	double total_seconds      = 0.0;
+
+	total_seconds = (double) result->elapsed_time / 1000000000.0;
+
+	if( total_seconds > 0.0 )
+	{
+		records_per_second = (double) result->number_of_operations / total_seconds;
+	}
+	if( single_thread_records_per_second > 0.0 )
+	{
+		speedup = records_per_second / single_thread_records_per_second;
+	}
+	fprintf(
+	 stream,
+	 "%-18s %8d %12" PRIu64 " %12.0f %9.2fx %10.1f %14.3f\n",
+	 scenario_name,
+	 result->number_of_threads,
+	 result->number_of_operations,
+	 records_per_second,
+	 speedup,
+	 (double) result->p99_sample / 1000.0,
+	 (double) result->lock_wait_time / 1000000.0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	evtx_bench_generator_t generator;
+	evtx_scalebench_result_t result;
+
+	libcerror_error_t *error                  = NULL;
+	libevtx_file_t *file                      = NULL;
+	const system_character_t *output_filename = EVTX_SCALEBENCH_DEFAULT_FILENAME;
+	const system_character_t *source          = NULL;
+	system_integer_t option                   = 0;
+	double single_thread_records_per_second   = 0.0;
+	uint32_t maximum_number_of_threads        = 8;
+	uint32_t number_of_chunks                 = 64;
+	uint32_t number_of_operations             = 10000;
+	uint32_t seed                             = 1;
+	int number_of_records                     = 0;
+	int number_of_threads                     = 0;
+	int scenario                              = 0;
+
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:hn:o:s:t:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				evtx_scalebench_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				if( ( evtx_scalebench_copy_decimal_string(
+				       optarg,
+				       UINT16_MAX,
+				       &number_of_chunks ) != 1 )
+				 || ( number_of_chunks == 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of chunks: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'h':
+				evtx_scalebench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'n':
+				if( ( evtx_scalebench_copy_decimal_string(
+				       optarg,
+				       INT32_MAX / EVTX_SCALEBENCH_MAXIMUM_NUMBER_OF_THREADS,
+				       &number_of_operations ) != 1 )
+				 || ( number_of_operations == 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of operations: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'o':
+				output_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				if( evtx_scalebench_copy_decimal_string(
+				     optarg,
+				     UINT32_MAX,
+				     &seed ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported seed: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 't':
+				if( ( evtx_scalebench_copy_decimal_string(
+				       optarg,
+				       EVTX_SCALEBENCH_MAXIMUM_NUMBER_OF_THREADS,
+				       &maximum_number_of_threads ) != 1 )
+				 || ( maximum_number_of_threads == 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( maximum_number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading support is not available, only 1 thread is used.\n" );
+
+		maximum_number_of_threads = 1;
+	}
+#endif
+	if( source == NULL )
+	{
+		if( evtx_bench_generator_initialize(
+		     &generator,
+		     (uint16_t) number_of_chunks,
+		     16,
+		     0,
+		     seed,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize generator.\n" );
+
+			goto on_error;
+		}
+		if( evtx_bench_generator_write_file(
+		     &generator,
+		     output_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to generate file: %" PRIs_SYSTEM ".\n",
+			 output_filename );
+
+			goto on_error;
+		}
+		source = output_filename;
+	}
+	if( evtx_scalebench_file_open(
+	     &file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve number of records.\n" );
+
+		goto on_error;
+	}
+	if( number_of_records == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "No records in: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Scalability benchmark of: %" PRIs_SYSTEM " with %d records and %" PRIu32 " random reads per thread.\n\n",
+	 source,
+	 number_of_records,
+	 number_of_operations );
+
+	evtx_scalebench_results_header_fprint(
+	 stdout );
+
+	for( scenario = 0;
+	     scenario < EVTX_SCALEBENCH_NUMBER_OF_SCENARIOS;
+	     scenario++ )
+	{
+		single_thread_records_per_second = 0.0;
+
+		for( number_of_threads = 1;
+		     number_of_threads <= (int) maximum_number_of_threads;
+		     number_of_threads *= 2 )
+		{
+			if( evtx_scalebench_run_scenario(
+			     &result,
+			     scenario,
+			     source,
+			     file,
+			     number_of_records,
+			     number_of_threads,
+			     (int) number_of_operations,
+			     seed,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to benchmark %s with %d threads.\n",
+				 evtx_scalebench_scenario_names[ scenario ],
+				 number_of_threads );
+
+				goto on_error;
+			}
+			if( ( number_of_threads == 1 )
+			 && ( result.elapsed_time > 0 ) )
+			{
+				single_thread_records_per_second = (double) result.number_of_operations / ( (double) result.elapsed_time / 1000000000.0 );
+			}
+			evtx_scalebench_result_fprint(
+			 &result,
+			 evtx_scalebench_scenario_names[ scenario ],
+			 single_thread_records_per_second,
+			 stdout );
+		}
+	}
+	if( evtx_scalebench_file_close(
+	     &file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_close(
+		 file,
+		 NULL );
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
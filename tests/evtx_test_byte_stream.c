@@ -0,0 +1,199 @@
+/*
+ * Library byte stream functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_byte_stream.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_byte_stream_check_for_zero_byte_fill function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_byte_stream_check_for_zero_byte_fill(
+     void )
+{
+	uint8_t byte_stream[ 520 ];
+
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_index = 0;
+	size_t start_offset      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     byte_stream,
+	     0,
+	     520 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_byte_stream_check_for_zero_byte_fill(
+	          byte_stream,
+	          520,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_byte_stream_check_for_zero_byte_fill(
+	          byte_stream,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a non 0-byte value at every offset and with different start offsets
+	 * to cover the vector, aligned and byte-wise code paths
+	 */
+	for( start_offset = 0;
+	     start_offset < 8;
+	     start_offset++ )
+	{
+		for( byte_stream_index = start_offset;
+		     byte_stream_index < 520;
+		     byte_stream_index++ )
+		{
+			byte_stream[ byte_stream_index ] = 0x01;
+
+			result = libevtx_byte_stream_check_for_zero_byte_fill(
+			          &( byte_stream[ start_offset ] ),
+			          520 - start_offset,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			byte_stream[ byte_stream_index ] = 0;
+		}
+	}
+	/* Test error cases
+	 */
+	result = libevtx_byte_stream_check_for_zero_byte_fill(
+	          NULL,
+	          520,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_byte_stream_check_for_zero_byte_fill(
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_byte_stream_check_for_zero_byte_fill",
+	 evtx_test_byte_stream_check_for_zero_byte_fill );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,925 @@
+/*
+ * Library carver type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_carver.h"
+#include "../libevtx/libevtx_checksum.h"
+
+/* Counts the carved records
+ * Returns 1 to continue
+ */
+int evtx_test_carver_count_records(
+     libevtx_record_t *record EVTX_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( record )
+
+	*( (int *) user_data ) += 1;
+
+	return( 1 );
+}
+
+/* Tests the libevtx_carver_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_carver_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevtx_carver_t *carver        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_carver_initialize(
+	          &carver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_carver_free(
+	          &carver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_carver_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carver = (libevtx_carver_t *) 0x12345678UL;
+
+	result = libevtx_carver_initialize(
+	          &carver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carver = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_carver_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libevtx_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_carver_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libevtx_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libevtx_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_carver_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_carver_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_carver_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_carver_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_carver_set_ascii_codepage(
+     libevtx_carver_t *carver )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_carver_set_ascii_codepage(
+	          carver,
+	          LIBEVTX_CODEPAGE_WINDOWS_1250,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_carver_set_ascii_codepage(
+	          carver,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_carver_set_ascii_codepage(
+	          NULL,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_carver_set_ascii_codepage(
+	          carver,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_carver_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_carver_set_number_of_threads(
+     libevtx_carver_t *carver )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_carver_set_number_of_threads(
+	          carver,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_carver_set_number_of_threads(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_carver_set_number_of_threads(
+	          carver,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Raw data of the size of 4 chunks
+ */
+uint8_t evtx_test_carver_data[ 4 * 65536 ];
+
+/* Writes a chunk header without event records into the data
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_carver_write_chunk_header(
+     uint8_t *data,
+     libcerror_error_t **error )
+{
+	uint32_t checksum = 0;
+
+	if( memory_copy(
+	     data,
+	     "ElfChnk\0",
+	     8 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The header size
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 40 ] ),
+	 128 );
+
+	/* The free space offset
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 48 ] ),
+	 512 );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &checksum,
+	     data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &checksum,
+	     &( data[ 128 ] ),
+	     384,
+	     checksum,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 124 ] ),
+	 checksum );
+
+	return( 1 );
+}
+
+/* Tests the libevtx_carver_check_chunk_header function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_carver_check_chunk_header(
+     void )
+{
+	uint8_t chunk_header_data[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 chunk_header_data,
+	                 0,
+	                 512 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = libevtx_carver_check_chunk_header(
+	          chunk_header_data,
+	          512,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_carver_write_chunk_header(
+	          chunk_header_data,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_carver_check_chunk_header(
+	          chunk_header_data,
+	          512,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a chunk header with a checksum mismatch
+	 */
+	chunk_header_data[ 200 ] = 0xff;
+
+	result = libevtx_carver_check_chunk_header(
+	          chunk_header_data,
+	          512,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_carver_check_chunk_header(
+	          NULL,
+	          512,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_carver_check_chunk_header(
+	          chunk_header_data,
+	          511,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_carver_carve_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_carver_carve_file_io_handle(
+     libevtx_carver_t *carver )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	int number_of_chunks             = 0;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 * The chunk header is aligned to 512 bytes but not to the chunk size
+	 */
+	result = evtx_test_carver_write_chunk_header(
+	          &( evtx_test_carver_data[ 2 * 65536 + 1024 ] ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_carver_data,
+	          sizeof( uint8_t ) * 4 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_carver_carve_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          &evtx_test_carver_count_records,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_carver_get_number_of_chunks(
+	          carver,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_carver_carve_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &evtx_test_carver_count_records,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_carver_carve_file_io_handle(
+	          carver,
+	          NULL,
+	          &evtx_test_carver_count_records,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_carver_carve_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libevtx_carver_t *carver = NULL;
+	int result               = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "libevtx_carver_initialize",
+	 evtx_test_carver_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_carver_free",
+	 evtx_test_carver_free );
+
+	/* Initialize carver for tests
+	 */
+	result = libevtx_carver_initialize(
+	          &carver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_carver_set_ascii_codepage",
+	 evtx_test_carver_set_ascii_codepage,
+	 carver );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_carver_set_number_of_threads",
+	 evtx_test_carver_set_number_of_threads,
+	 carver );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_carver_check_chunk_header",
+	 evtx_test_carver_check_chunk_header );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_carver_carve_file_io_handle",
+	 evtx_test_carver_carve_file_io_handle,
+	 carver );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libevtx_carver_free(
+	          &carver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libevtx_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
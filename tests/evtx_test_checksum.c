@@ -0,0 +1,421 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_checksum.h"
+
+uint8_t evtx_test_checksum_data1[ 64 ] = {
+	0x07, 0x8a, 0x0d, 0x90, 0x13, 0x96, 0x19, 0x9c, 0x1f, 0xa2, 0x25, 0xa8, 0x2b, 0xae, 0x31, 0xb4,
+	0x37, 0xba, 0x3d, 0xc0, 0x43, 0xc6, 0x49, 0xcc, 0x4f, 0xd2, 0x55, 0xd8, 0x5b, 0xde, 0x61, 0xe4,
+	0x67, 0xea, 0x6d, 0xf0, 0x73, 0xf6, 0x79, 0xfc, 0x7f, 0x02, 0x85, 0x08, 0x8b, 0x0e, 0x91, 0x14,
+	0x97, 0x1a, 0x9d, 0x20, 0xa3, 0x26, 0xa9, 0x2c, 0xaf, 0x32, 0xb5, 0x38, 0xbb, 0x3e, 0xc1, 0x44 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_checksum_calculate_little_endian_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_checksum_calculate_little_endian_crc32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t crc32           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &crc32,
+	          evtx_test_checksum_data1,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0x38e4dbb5UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that is not a multiple of 8
+	 */
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &crc32,
+	          evtx_test_checksum_data1,
+	          13,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0xe7be5425UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          NULL,
+	          evtx_test_checksum_data1,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &crc32,
+	          NULL,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &crc32,
+	          evtx_test_checksum_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_checksum_calculate_little_endian_weak_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_checksum_calculate_little_endian_weak_crc32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t crc32           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_checksum_calculate_little_endian_weak_crc32(
+	          &crc32,
+	          evtx_test_checksum_data1,
+	          64,
+	          0x12345678UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0x76928977UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_checksum_calculate_little_endian_weak_crc32(
+	          NULL,
+	          evtx_test_checksum_data1,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_checksum_calculate_little_endian_weak_crc32(
+	          &crc32,
+	          NULL,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_checksum_calculate_xxhash64 function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_checksum_calculate_xxhash64(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_checksum_calculate_xxhash64(
+	          &hash,
+	          evtx_test_checksum_data1,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xef46db3751d8e999ULL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_checksum_calculate_xxhash64(
+	          &hash,
+	          evtx_test_checksum_data1,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x50d4159a0411632eULL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that is not a multiple of 32 with a seed
+	 */
+	result = libevtx_checksum_calculate_xxhash64(
+	          &hash,
+	          evtx_test_checksum_data1,
+	          45,
+	          0x12345678UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xed1e6151e64166d2ULL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_checksum_calculate_xxhash64(
+	          NULL,
+	          evtx_test_checksum_data1,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_checksum_calculate_xxhash64(
+	          &hash,
+	          NULL,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_checksum_calculate_little_endian_crc32",
+	 evtx_test_checksum_calculate_little_endian_crc32 );
+
+	EVTX_TEST_RUN(
+	 "libevtx_checksum_calculate_little_endian_weak_crc32",
+	 evtx_test_checksum_calculate_little_endian_weak_crc32 );
+
+	EVTX_TEST_RUN(
+	 "libevtx_checksum_calculate_xxhash64",
+	 evtx_test_checksum_calculate_xxhash64 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -19,8 +19,10 @@
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,7 +35,9 @@
 #include "evtx_test_memory.h"
 #include "evtx_test_unused.h"
 
+#include "../libevtx/libevtx_checksum.h"
 #include "../libevtx/libevtx_chunk.h"
+#include "../libevtx/libevtx_definitions.h"
 
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
@@ -270,17 +274,695 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_chunk_data_is_consistent function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_data_is_consistent(
+     void )
+{
+	uint8_t chunk_data[ 1024 ];
+
+	libcerror_error_t *error     = NULL;
+	uint32_t calculated_checksum = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     chunk_data,
+	     0,
+	     1024 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_data_is_consistent(
+	          chunk_data,
+	          1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test chunk data with a header checksum that does not match
+	 */
+	if( memory_copy(
+	     chunk_data,
+	     "ElfChnk\x00",
+	     8 ) == NULL )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 48 ] ),
+	 512 );
+
+	result = libevtx_chunk_data_is_consistent(
+	          chunk_data,
+	          1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test chunk data with matching checksums, the event records checksum
+	 * of an empty chunk is 0
+	 */
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &calculated_checksum,
+	          chunk_data,
+	          120,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &calculated_checksum,
+	          &( chunk_data[ 128 ] ),
+	          384,
+	          calculated_checksum,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 124 ] ),
+	 calculated_checksum );
+
+	result = libevtx_chunk_data_is_consistent(
+	          chunk_data,
+	          1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test chunk data with an event records checksum that does not match
+	 */
+	chunk_data[ 52 ] = 0xff;
+
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &calculated_checksum,
+	          chunk_data,
+	          120,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &calculated_checksum,
+	          &( chunk_data[ 128 ] ),
+	          384,
+	          calculated_checksum,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ 124 ] ),
+	 calculated_checksum );
+
+	result = libevtx_chunk_data_is_consistent(
+	          chunk_data,
+	          1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_data_is_consistent(
+	          NULL,
+	          1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_data_is_consistent(
+	          chunk_data,
+	          256,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_validate_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_validate_data(
+     void )
+{
+	uint8_t chunk_data[ 1024 ];
+
+	libcerror_error_t *error    = NULL;
+	libevtx_chunk_t *chunk      = NULL;
+	uint8_t free_space_is_empty = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     chunk_data,
+	     0,
+	     1024 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libevtx_chunk_initialize(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The checksums are marked as validated so that only the free space is checked
+	 */
+	chunk->data              = chunk_data;
+	chunk->data_size         = 1024;
+	chunk->free_space_offset = 512;
+	chunk->flags             = LIBEVTX_CHUNK_FLAG_HEADER_CHECKSUM_VALIDATED
+	                         | LIBEVTX_CHUNK_FLAG_EVENT_RECORDS_CHECKSUM_VALIDATED;
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_validate_data(
+	          chunk,
+	          &free_space_is_empty,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "free_space_is_empty",
+	 free_space_is_empty,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test free space that is not 0-byte filled
+	 */
+	chunk_data[ 1000 ] = 0x2a;
+
+	result = libevtx_chunk_validate_data(
+	          chunk,
+	          &free_space_is_empty,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "free_space_is_empty",
+	 free_space_is_empty,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_validate_data(
+	          NULL,
+	          &free_space_is_empty,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_validate_data(
+	          chunk,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	chunk->data  = NULL;
+	chunk->flags = 0;
+
+	result = libevtx_chunk_free(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		chunk->data = NULL;
+
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libevtx_chunk_get_number_of_records function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_chunk_get_number_of_records(
+int evtx_test_chunk_get_number_of_records(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libevtx_chunk_t *chunk       = NULL;
+	uint16_t number_of_records   = 0;
+	int number_of_records_is_set = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_initialize(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_get_number_of_records(
+	          chunk,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_records_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_records_is_set != 0 )
+	{
+		result = libevtx_chunk_get_number_of_records(
+		          chunk,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_chunk_free(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_get_record_chunk_data_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_get_record_chunk_data_offset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_chunk_t *chunk   = NULL;
+	size_t chunk_data_offset = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_initialize(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_append_record(
+	          chunk,
+	          512,
+	          32,
+	          1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_append_record(
+	          chunk,
+	          544,
+	          32,
+	          2,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_get_record_chunk_data_offset(
+	          chunk,
+	          1,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 (size_t) 544 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record values are not created
+	 */
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk->records_values",
+	 chunk->records_values );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_get_record_chunk_data_offset(
+	          NULL,
+	          1,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_get_record_chunk_data_offset(
+	          chunk,
+	          2,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_get_record_chunk_data_offset(
+	          chunk,
+	          1,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_free(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_get_record_index_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_get_record_index_by_identifier(
      void )
 {
-	libcerror_error_t *error     = NULL;
-	libevtx_chunk_t *chunk       = NULL;
-	uint16_t number_of_records   = 0;
-	int number_of_records_is_set = 0;
-	int result                   = 0;
+	libcerror_error_t *error               = NULL;
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	uint64_t record_identifier             = 0;
+	uint16_t record_index                  = 0;
+	int result                             = 0;
 
 	/* Initialize test
 	 */
@@ -301,29 +983,99 @@ int evtx_test_chunk_get_number_of_records(
 	 "error",
 	 error );
 
+	for( record_identifier = 1;
+	     record_identifier <= 100;
+	     record_identifier++ )
+	{
+		result = libevtx_chunk_append_record(
+		          chunk,
+		          (uint32_t) ( 512 + ( ( record_identifier - 1 ) * 32 ) ),
+		          32,
+		          record_identifier,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Test regular cases
 	 */
-	result = libevtx_chunk_get_number_of_records(
+	result = libevtx_chunk_get_record_index_by_identifier(
 	          chunk,
-	          &number_of_records,
+	          42,
+	          &record_index,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "record_index",
+	 record_index,
+	 41 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_records_is_set = result;
+	result = libevtx_chunk_get_record_index_by_identifier(
+	          chunk,
+	          101,
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_get_record(
+	          chunk,
+	          41,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "record_values->identifier",
+	 record_values->identifier,
+	 (uint64_t) 42 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "record_values->data_size",
+	 record_values->data_size,
+	 (uint32_t) 32 );
 
 	/* Test error cases
 	 */
-	result = libevtx_chunk_get_number_of_records(
+	result = libevtx_chunk_get_record_index_by_identifier(
 	          NULL,
-	          &number_of_records,
+	          42,
+	          &record_index,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -338,25 +1090,42 @@ int evtx_test_chunk_get_number_of_records(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_records_is_set != 0 )
-	{
-		result = libevtx_chunk_get_number_of_records(
-		          chunk,
-		          NULL,
-		          &error );
+	result = libevtx_chunk_get_record_index_by_identifier(
+	          chunk,
+	          42,
+	          NULL,
+	          &error );
 
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_get_record(
+	          chunk,
+	          100,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_chunk_free(
@@ -516,6 +1285,109 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_chunk_read_recovered_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_read_recovered_records(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_chunk_t *chunk   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_initialize(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_read_recovered_records(
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The chunk has not been read hence it has no data
+	 */
+	result = libevtx_chunk_read_recovered_records(
+	          chunk,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_free(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 /* The main program
@@ -543,20 +1415,40 @@ int main(
 	 "libevtx_chunk_free",
 	 evtx_test_chunk_free );
 
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_data_is_consistent",
+	 evtx_test_chunk_data_is_consistent );
+
 	/* TODO: add tests for libevtx_chunk_read */
 
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_validate_data",
+	 evtx_test_chunk_validate_data );
+
 	EVTX_TEST_RUN(
 	 "libevtx_chunk_get_number_of_records",
 	 evtx_test_chunk_get_number_of_records );
 
 	/* TODO: add tests for libevtx_chunk_get_record */
 
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_get_record_chunk_data_offset",
+	 evtx_test_chunk_get_record_chunk_data_offset );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_get_record_index_by_identifier",
+	 evtx_test_chunk_get_record_index_by_identifier );
+
 	EVTX_TEST_RUN(
 	 "libevtx_chunk_get_number_of_recovered_records",
 	 evtx_test_chunk_get_number_of_recovered_records );
 
 	/* TODO: add tests for libevtx_chunk_get_recovered_record */
 
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_read_recovered_records",
+	 evtx_test_chunk_read_recovered_records );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
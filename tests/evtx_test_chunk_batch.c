@@ -0,0 +1,1000 @@
+/*
+ * Library chunk_batch type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_chunk.h"
+#include "../libevtx/libevtx_chunk_batch.h"
+#include "../libevtx/libevtx_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Three 0-byte filled chunks
+ */
+uint8_t evtx_test_chunk_batch_data[ 3 * 65536 ];
+
+/* Tests the libevtx_chunk_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_batch_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libevtx_chunk_batch_t *chunk_batch = NULL;
+	libevtx_io_handle_t *io_handle     = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_chunk_batch_data,
+	          sizeof( uint8_t ) * 3 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_batch_initialize(
+	          &chunk_batch,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_batch",
+	 chunk_batch );
+
+	result = libevtx_chunk_batch_free(
+	          &chunk_batch,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_batch",
+	 chunk_batch );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_batch_initialize(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_batch = (libevtx_chunk_batch_t *) 0x12345678UL;
+
+	result = libevtx_chunk_batch_initialize(
+	          &chunk_batch,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	chunk_batch = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_initialize(
+	          &chunk_batch,
+	          NULL,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_initialize(
+	          &chunk_batch,
+	          io_handle,
+	          NULL,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_initialize(
+	          &chunk_batch,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_batch != NULL )
+	{
+		libevtx_chunk_batch_free(
+		 &chunk_batch,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_batch_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_batch_read and libevtx_chunk_batch_get_next_chunk functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_batch_read(
+     void )
+{
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libevtx_chunk_batch_t *chunk_batch = NULL;
+	libevtx_chunk_t *chunk             = NULL;
+	libevtx_io_handle_t *io_handle     = NULL;
+	int chunk_index                    = 0;
+	int read_result                    = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_chunk_batch_data,
+	          sizeof( uint8_t ) * 3 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_batch_initialize(
+	          &chunk_batch,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_batch_read(
+	          chunk_batch,
+	          0,
+	          3 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_batch->number_of_chunks",
+	 chunk_batch->number_of_chunks,
+	 3 );
+
+	for( chunk_index = 0;
+	     chunk_index < 3;
+	     chunk_index++ )
+	{
+		result = libevtx_chunk_batch_get_next_chunk(
+		          chunk_batch,
+		          &chunk,
+		          &read_result,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "chunk",
+		 chunk );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The chunks are 0-byte filled
+		 */
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "read_result",
+		 read_result,
+		 0 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT64(
+		 "chunk->file_offset",
+		 (int64_t) chunk->file_offset,
+		 (int64_t) chunk_index * 65536 );
+
+		result = libevtx_chunk_free(
+		          &chunk,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_chunk_batch_get_next_chunk(
+	          chunk_batch,
+	          &chunk,
+	          &read_result,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading a batch that only partially fits
+	 */
+	result = libevtx_chunk_batch_read(
+	          chunk_batch,
+	          65536,
+	          2 * 65536 + 512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_batch->number_of_chunks",
+	 chunk_batch->number_of_chunks,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_batch_read(
+	          NULL,
+	          0,
+	          3 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_read(
+	          chunk_batch,
+	          -1,
+	          3 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_get_next_chunk(
+	          NULL,
+	          &chunk,
+	          &read_result,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_get_next_chunk(
+	          chunk_batch,
+	          NULL,
+	          &read_result,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_get_next_chunk(
+	          chunk_batch,
+	          &chunk,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_batch_free(
+	          &chunk_batch,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( chunk_batch != NULL )
+	{
+		libevtx_chunk_batch_free(
+		 &chunk_batch,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_batch_read_at_offsets function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_batch_read_at_offsets(
+     void )
+{
+	off64_t chunk_offsets[ 2 ]         = { 2 * 65536, 0 };
+	off64_t invalid_chunk_offsets[ 2 ] = { 0, -1 };
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libevtx_chunk_batch_t *chunk_batch = NULL;
+	libevtx_chunk_t *chunk             = NULL;
+	libevtx_io_handle_t *io_handle     = NULL;
+	int chunk_index                    = 0;
+	int read_result                    = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_chunk_batch_data,
+	          sizeof( uint8_t ) * 3 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_batch_initialize(
+	          &chunk_batch,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_batch_read_at_offsets(
+	          chunk_batch,
+	          chunk_offsets,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_batch->number_of_chunks",
+	 chunk_batch->number_of_chunks,
+	 2 );
+
+	/* The chunks are returned in the order of the offsets
+	 */
+	for( chunk_index = 0;
+	     chunk_index < 2;
+	     chunk_index++ )
+	{
+		result = libevtx_chunk_batch_get_next_chunk(
+		          chunk_batch,
+		          &chunk,
+		          &read_result,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "chunk",
+		 chunk );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT64(
+		 "chunk->file_offset",
+		 (int64_t) chunk->file_offset,
+		 (int64_t) chunk_offsets[ chunk_index ] );
+
+		result = libevtx_chunk_free(
+		          &chunk,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_chunk_batch_get_next_chunk(
+	          chunk_batch,
+	          &chunk,
+	          &read_result,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_batch_read_at_offsets(
+	          NULL,
+	          chunk_offsets,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_read_at_offsets(
+	          chunk_batch,
+	          NULL,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_read_at_offsets(
+	          chunk_batch,
+	          chunk_offsets,
+	          chunk_batch->maximum_number_of_chunks + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_batch_read_at_offsets(
+	          chunk_batch,
+	          invalid_chunk_offsets,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_batch_free(
+	          &chunk_batch,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( chunk_batch != NULL )
+	{
+		libevtx_chunk_batch_free(
+		 &chunk_batch,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_batch_initialize",
+	 evtx_test_chunk_batch_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_batch_free",
+	 evtx_test_chunk_batch_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_batch_read",
+	 evtx_test_chunk_batch_read );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_batch_read_at_offsets",
+	 evtx_test_chunk_batch_read_at_offsets );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,520 @@
+/*
+ * Library chunk_builder type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_chunk_builder.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* An event record with a template instance that contains its template definition
+ * and the element names, stored at offset 512 of the chunk data
+ */
+uint8_t evtx_test_chunk_builder_record_data[ 199 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x07, 0x00,
+	0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+	0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x49, 0x00, 0x00, 0x00, 0x0f, 0x01,
+	0x01, 0x00, 0x41, 0xff, 0xff, 0x3d, 0x00, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x39, 0x12, 0x05, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00,
+	0x00, 0x1b, 0x00, 0x00, 0x00, 0x06, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x12,
+	0x04, 0x00, 0x41, 0x00, 0x74, 0x00, 0x74, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x01,
+	0x02, 0x0e, 0x01, 0x00, 0x21, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x25,
+	0x00, 0x21, 0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x0f, 0x01, 0x01,
+	0x00, 0x01, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x39, 0x12, 0x05, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00 };
+
+/* Tests the libevtx_chunk_builder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_builder_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_chunk_builder_t *chunk_builder = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_builder_initialize(
+	          &chunk_builder,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_builder",
+	 chunk_builder );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_builder->free_space_offset",
+	 chunk_builder->free_space_offset,
+	 (size_t) 512 );
+
+	result = libevtx_chunk_builder_free(
+	          &chunk_builder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_builder",
+	 chunk_builder );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_builder_initialize(
+	          NULL,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_builder = (libevtx_chunk_builder_t *) 0x12345678UL;
+
+	result = libevtx_chunk_builder_initialize(
+	          &chunk_builder,
+	          65536,
+	          &error );
+
+	chunk_builder = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_builder_initialize(
+	          &chunk_builder,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_builder_initialize(
+	          &chunk_builder,
+	          65537,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_builder != NULL )
+	{
+		libevtx_chunk_builder_free(
+		 &chunk_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_builder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_builder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_builder_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_builder_append_record and libevtx_chunk_builder_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_builder_append_record(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_chunk_builder_t *chunk_builder = NULL;
+	uint8_t *chunk_data                    = NULL;
+	size_t first_record_size               = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	chunk_data = (uint8_t *) memory_allocate(
+	                          65536 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	result = memory_set(
+	          chunk_data,
+	          0,
+	          65536 ) != NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_copy(
+	          &( chunk_data[ 512 ] ),
+	          evtx_test_chunk_builder_record_data,
+	          199 ) != NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_chunk_builder_initialize(
+	          &chunk_builder,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_builder_append_record(
+	          chunk_builder,
+	          chunk_data,
+	          65536,
+	          512,
+	          199,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_record_size = chunk_builder->free_space_offset - 512;
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "first_record_size",
+	 first_record_size,
+	 (size_t) 199 );
+
+	/* The template definition and names of the second record refer to those of the first record
+	 */
+	result = libevtx_chunk_builder_append_record(
+	          chunk_builder,
+	          chunk_data,
+	          65536,
+	          512,
+	          199,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_builder->number_of_records",
+	 chunk_builder->number_of_records,
+	 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_builder->last_record_offset",
+	 chunk_builder->last_record_offset,
+	 (size_t) 512 + first_record_size );
+
+	result = ( chunk_builder->free_space_offset - chunk_builder->last_record_offset ) < first_record_size;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_chunk_builder_finalize(
+	          chunk_builder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          chunk_builder->data,
+	          "ElfChnk",
+	          8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_builder_append_record(
+	          NULL,
+	          chunk_data,
+	          65536,
+	          512,
+	          199,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_builder_append_record(
+	          chunk_builder,
+	          NULL,
+	          65536,
+	          512,
+	          199,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_builder_append_record(
+	          chunk_builder,
+	          chunk_data,
+	          65536,
+	          65536 - 100,
+	          199,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_builder_free(
+	          &chunk_builder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 chunk_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_builder != NULL )
+	{
+		libevtx_chunk_builder_free(
+		 &chunk_builder,
+		 NULL );
+	}
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_builder_initialize",
+	 evtx_test_chunk_builder_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_builder_free",
+	 evtx_test_chunk_builder_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_builder_append_record",
+	 evtx_test_chunk_builder_append_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1147 @@
+/*
+ * Library chunk_descriptor type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_chunk.h"
+#include "../libevtx/libevtx_chunk_descriptor.h"
+
+uint8_t evtx_test_chunk_descriptor_data1[ 512 ] = {
+	0x45, 0x6c, 0x66, 0x43, 0x68, 0x6e, 0x6b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00 };
+
+uint8_t evtx_test_chunk_descriptor_data2[ 512 ] = {
+	0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_chunk_descriptor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_descriptor_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 1;
+	int number_of_memset_fail_tests              = 1;
+	int test_number                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_descriptor_initialize(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_descriptor_free(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_descriptor_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_descriptor = (libevtx_chunk_descriptor_t *) 0x12345678UL;
+
+	result = libevtx_chunk_descriptor_initialize(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_descriptor = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_chunk_descriptor_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_chunk_descriptor_initialize(
+		          &chunk_descriptor,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( chunk_descriptor != NULL )
+			{
+				libevtx_chunk_descriptor_free(
+				 &chunk_descriptor,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "chunk_descriptor",
+			 chunk_descriptor );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_chunk_descriptor_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_chunk_descriptor_initialize(
+		          &chunk_descriptor,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( chunk_descriptor != NULL )
+			{
+				libevtx_chunk_descriptor_free(
+				 &chunk_descriptor,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "chunk_descriptor",
+			 chunk_descriptor );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_descriptor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_descriptor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_descriptor_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_descriptor_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_descriptor_read_data(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	uint32_t number_of_records                   = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_descriptor_initialize(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_descriptor_read_data(
+	          chunk_descriptor,
+	          evtx_test_chunk_descriptor_data1,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_descriptor_get_number_of_records(
+	          chunk_descriptor,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_descriptor->first_record_identifier",
+	 chunk_descriptor->first_record_identifier,
+	 (uint64_t) 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_descriptor->last_record_identifier",
+	 chunk_descriptor->last_record_identifier,
+	 (uint64_t) 3 );
+
+	/* Test with an unsupported header size
+	 */
+	if( memory_copy(
+	     data,
+	     evtx_test_chunk_descriptor_data1,
+	     512 ) == NULL )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 40 ] ),
+	 256 );
+
+	result = libevtx_chunk_descriptor_read_data(
+	          chunk_descriptor,
+	          data,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "chunk_descriptor->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED",
+	 (int) ( chunk_descriptor->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ),
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_descriptor->number_of_records",
+	 chunk_descriptor->number_of_records,
+	 (uint32_t) 0 );
+
+	/* Test with 0-byte filled data
+	 */
+	result = libevtx_chunk_descriptor_read_data(
+	          chunk_descriptor,
+	          evtx_test_chunk_descriptor_data2,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_descriptor_read_data(
+	          NULL,
+	          evtx_test_chunk_descriptor_data1,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_descriptor_read_data(
+	          chunk_descriptor,
+	          NULL,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_descriptor_read_data(
+	          chunk_descriptor,
+	          evtx_test_chunk_descriptor_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_descriptor_read_data(
+	          chunk_descriptor,
+	          evtx_test_chunk_descriptor_data1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_descriptor_free(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_descriptor_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_descriptor_get_number_of_records(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	uint32_t number_of_records                   = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_descriptor_initialize(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_descriptor_get_number_of_records(
+	          chunk_descriptor,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_descriptor_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_descriptor_get_number_of_records(
+	          chunk_descriptor,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_descriptor_free(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_descriptor_set_written_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_descriptor_set_written_time_range(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_descriptor_initialize(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_initialize(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_descriptor_set_written_time_range(
+	          chunk_descriptor,
+	          chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A chunk without records does not overlap any range
+	 */
+	result = libevtx_chunk_descriptor_overlaps_written_time_range(
+	          chunk_descriptor,
+	          0,
+	          (uint64_t) UINT64_MAX,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_descriptor_set_written_time_range(
+	          NULL,
+	          chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_descriptor_set_written_time_range(
+	          chunk_descriptor,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_free(
+	          &chunk,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk",
+	 chunk );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_descriptor_free(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_descriptor_overlaps_written_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_descriptor_overlaps_written_time_range(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_descriptor_initialize(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk_descriptor->minimum_written_time = 100;
+	chunk_descriptor->maximum_written_time = 200;
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_descriptor_overlaps_written_time_range(
+	          chunk_descriptor,
+	          150,
+	          300,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_descriptor_overlaps_written_time_range(
+	          chunk_descriptor,
+	          200,
+	          200,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_descriptor_overlaps_written_time_range(
+	          chunk_descriptor,
+	          201,
+	          300,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_descriptor_overlaps_written_time_range(
+	          chunk_descriptor,
+	          0,
+	          99,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_descriptor_overlaps_written_time_range(
+	          NULL,
+	          0,
+	          (uint64_t) UINT64_MAX,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_descriptor_free(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_descriptor_may_contain_event_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_descriptor_may_contain_event_identifier(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_descriptor_t *chunk_descriptor = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_descriptor_initialize(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without a summary
+	 */
+	result = libevtx_chunk_descriptor_may_contain_event_identifier(
+	          chunk_descriptor,
+	          4624 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test with a summary
+	 */
+	chunk_descriptor->event_identifiers_bitmap[ ( 4624 & 0xff ) / 8 ] = (uint8_t) ( 1 << ( ( 4624 & 0xff ) % 8 ) );
+
+	chunk_descriptor->flags |= LIBEVTX_CHUNK_DESCRIPTOR_FLAG_HAS_SUMMARY;
+
+	result = libevtx_chunk_descriptor_may_contain_event_identifier(
+	          chunk_descriptor,
+	          4624 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_chunk_descriptor_may_contain_event_identifier(
+	          chunk_descriptor,
+	          4625 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_descriptor_may_contain_event_identifier(
+	          NULL,
+	          4625 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_descriptor_free(
+	          &chunk_descriptor,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_descriptor",
+	 chunk_descriptor );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_descriptor != NULL )
+	{
+		libevtx_chunk_descriptor_free(
+		 &chunk_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_descriptor_initialize",
+	 evtx_test_chunk_descriptor_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_descriptor_free",
+	 evtx_test_chunk_descriptor_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_descriptor_read_data",
+	 evtx_test_chunk_descriptor_read_data );
+
+	/* TODO: add tests for libevtx_chunk_descriptor_read_file_io_handle */
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_descriptor_get_number_of_records",
+	 evtx_test_chunk_descriptor_get_number_of_records );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_descriptor_set_written_time_range",
+	 evtx_test_chunk_descriptor_set_written_time_range );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_descriptor_overlaps_written_time_range",
+	 evtx_test_chunk_descriptor_overlaps_written_time_range );
+
+	/* TODO: add tests for libevtx_chunk_descriptor_set_summary */
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_descriptor_may_contain_event_identifier",
+	 evtx_test_chunk_descriptor_may_contain_event_identifier );
+
+	/* TODO: add tests for libevtx_chunk_descriptor_may_contain_provider_identifier */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
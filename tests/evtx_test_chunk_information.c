@@ -0,0 +1,868 @@
+/*
+ * Library chunk_information type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_chunk_information.h"
+
+uint8_t evtx_test_chunk_information_data1[ 512 ] = {
+	0x45, 0x6c, 0x66, 0x43, 0x68, 0x6e, 0x6b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00 };
+
+uint8_t evtx_test_chunk_information_data2[ 512 ] = {
+	0x00 };
+
+uint8_t evtx_test_chunk_information_data3[ 512 ] = {
+	0x45, 0x6c, 0x66, 0x43, 0x68, 0x6e, 0x6b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_chunk_information_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_information_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libevtx_chunk_information_t *chunk_information = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 1;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_information_initialize(
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_information",
+	 chunk_information );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_free(
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_information",
+	 chunk_information );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_information_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_information = (libevtx_chunk_information_t *) 0x12345678UL;
+
+	result = libevtx_chunk_information_initialize(
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_information = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_chunk_information_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_chunk_information_initialize(
+		          &chunk_information,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( chunk_information != NULL )
+			{
+				libevtx_chunk_information_free(
+				 &chunk_information,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "chunk_information",
+			 chunk_information );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_chunk_information_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_chunk_information_initialize(
+		          &chunk_information,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( chunk_information != NULL )
+			{
+				libevtx_chunk_information_free(
+				 &chunk_information,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "chunk_information",
+			 chunk_information );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_information != NULL )
+	{
+		libevtx_chunk_information_free(
+		 &chunk_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_information_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_information_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_information_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_information_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_information_read_data(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libevtx_chunk_information_t *chunk_information = NULL;
+	uint64_t first_value                           = 0;
+	uint64_t last_value                            = 0;
+	uint32_t flags                                 = 0;
+	uint32_t value_32bit                           = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_information_initialize(
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_information",
+	 chunk_information );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_information_read_data(
+	          (libevtx_internal_chunk_information_t *) chunk_information,
+	          evtx_test_chunk_information_data1,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_get_record_numbers(
+	          chunk_information,
+	          &first_value,
+	          &last_value,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "first_record_number",
+	 first_value,
+	 (uint64_t) 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "last_record_number",
+	 last_value,
+	 (uint64_t) 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_get_record_identifiers(
+	          chunk_information,
+	          &first_value,
+	          &last_value,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "first_record_identifier",
+	 first_value,
+	 (uint64_t) 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "last_record_identifier",
+	 last_value,
+	 (uint64_t) 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_get_number_of_records(
+	          chunk_information,
+	          &value_32bit,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 value_32bit,
+	 (uint32_t) 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_get_free_space_offset(
+	          chunk_information,
+	          &value_32bit,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "free_space_offset",
+	 value_32bit,
+	 (uint32_t) 0x00000300UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The test data does not contain a valid header checksum
+	 */
+	result = libevtx_chunk_information_get_flags(
+	          chunk_information,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) ( LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED | LIBEVTX_VERIFY_RESULT_FLAG_HEADER_CHECKSUM_MISMATCH ) );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with 0-byte filled data
+	 */
+	result = libevtx_chunk_information_read_data(
+	          (libevtx_internal_chunk_information_t *) chunk_information,
+	          evtx_test_chunk_information_data2,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_get_flags(
+	          chunk_information,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) LIBEVTX_VERIFY_RESULT_FLAG_IS_EMPTY );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an unsupported header size
+	 */
+	result = libevtx_chunk_information_read_data(
+	          (libevtx_internal_chunk_information_t *) chunk_information,
+	          evtx_test_chunk_information_data3,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_get_flags(
+	          chunk_information,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) ( LIBEVTX_VERIFY_RESULT_FLAG_IS_CORRUPTED | LIBEVTX_VERIFY_RESULT_FLAG_INVALID_HEADER ) );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_information_read_data(
+	          NULL,
+	          evtx_test_chunk_information_data1,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_information_read_data(
+	          (libevtx_internal_chunk_information_t *) chunk_information,
+	          NULL,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_information_read_data(
+	          (libevtx_internal_chunk_information_t *) chunk_information,
+	          evtx_test_chunk_information_data1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_information_get_record_numbers(
+	          chunk_information,
+	          NULL,
+	          &last_value,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_information_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_information_free(
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_information",
+	 chunk_information );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_information != NULL )
+	{
+		libevtx_chunk_information_free(
+		 &chunk_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_information_get_written_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_information_get_written_time_range(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libevtx_chunk_information_t *chunk_information = NULL;
+	uint64_t maximum_written_time                  = 0;
+	uint64_t minimum_written_time                  = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_chunk_information_initialize(
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_information",
+	 chunk_information );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_information_get_written_time_range(
+	          chunk_information,
+	          &minimum_written_time,
+	          &maximum_written_time,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_set_written_time_range(
+	          (libevtx_internal_chunk_information_t *) chunk_information,
+	          0x01cb3d2c5b2e1a00UL,
+	          0x01cb3d2c6c4f3b00UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_information_get_written_time_range(
+	          chunk_information,
+	          &minimum_written_time,
+	          &maximum_written_time,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "minimum_written_time",
+	 minimum_written_time,
+	 (uint64_t) 0x01cb3d2c5b2e1a00UL );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_written_time",
+	 maximum_written_time,
+	 (uint64_t) 0x01cb3d2c6c4f3b00UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_information_set_written_time_range(
+	          (libevtx_internal_chunk_information_t *) chunk_information,
+	          2,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_information_get_written_time_range(
+	          NULL,
+	          &minimum_written_time,
+	          &maximum_written_time,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_information_get_written_time_range(
+	          chunk_information,
+	          &minimum_written_time,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_information_free(
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_information",
+	 chunk_information );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_information != NULL )
+	{
+		libevtx_chunk_information_free(
+		 &chunk_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_information_initialize",
+	 evtx_test_chunk_information_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_information_free",
+	 evtx_test_chunk_information_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_information_read_data",
+	 evtx_test_chunk_information_read_data );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_information_get_written_time_range",
+	 evtx_test_chunk_information_get_written_time_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,652 @@
+/*
+ * Library chunk_prefetcher type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_chunk_prefetcher.h"
+#include "../libevtx/libevtx_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Four chunks, each filled with its chunk number
+ */
+uint8_t evtx_test_chunk_prefetcher_data[ 4 * 65536 ];
+
+/* Tests the libevtx_chunk_prefetcher_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_prefetcher_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_prefetcher_t *chunk_prefetcher = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_chunk_prefetcher_data,
+	          sizeof( uint8_t ) * 4 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_prefetcher_initialize(
+	          &chunk_prefetcher,
+	          file_io_handle,
+	          65536,
+	          4 * 65536,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_prefetcher",
+	 chunk_prefetcher );
+
+	result = libevtx_chunk_prefetcher_free(
+	          &chunk_prefetcher,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_prefetcher",
+	 chunk_prefetcher );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_prefetcher_initialize(
+	          NULL,
+	          file_io_handle,
+	          65536,
+	          4 * 65536,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_prefetcher = (libevtx_chunk_prefetcher_t *) 0x12345678UL;
+
+	result = libevtx_chunk_prefetcher_initialize(
+	          &chunk_prefetcher,
+	          file_io_handle,
+	          65536,
+	          4 * 65536,
+	          2,
+	          &error );
+
+	chunk_prefetcher = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_prefetcher_initialize(
+	          &chunk_prefetcher,
+	          NULL,
+	          65536,
+	          4 * 65536,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_prefetcher_initialize(
+	          &chunk_prefetcher,
+	          file_io_handle,
+	          0,
+	          4 * 65536,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_prefetcher_initialize(
+	          &chunk_prefetcher,
+	          file_io_handle,
+	          65536,
+	          4 * 65536,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_prefetcher_initialize(
+	          &chunk_prefetcher,
+	          file_io_handle,
+	          65536,
+	          4 * 65536,
+	          LIBEVTX_MAXIMUM_READ_AHEAD_DEPTH + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_prefetcher != NULL )
+	{
+		libevtx_chunk_prefetcher_free(
+		 &chunk_prefetcher,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_prefetcher_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_prefetcher_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_prefetcher_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_prefetcher_schedule and libevtx_chunk_prefetcher_get_chunk_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_prefetcher_schedule(
+     void )
+{
+	uint8_t chunk_data[ 65536 ];
+
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_prefetcher_t *chunk_prefetcher = NULL;
+	size_t data_offset                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 4 * 65536;
+	     data_offset++ )
+	{
+		evtx_test_chunk_prefetcher_data[ data_offset ] = (uint8_t) ( 1 + ( data_offset / 65536 ) );
+	}
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_chunk_prefetcher_data,
+	          sizeof( uint8_t ) * 4 * 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_prefetcher_initialize(
+	          &chunk_prefetcher,
+	          file_io_handle,
+	          65536,
+	          4 * 65536,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_prefetcher_schedule(
+	          chunk_prefetcher,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A single chunk read does not start the read-ahead
+	 */
+	result = libevtx_chunk_prefetcher_get_chunk_data(
+	          chunk_prefetcher,
+	          65536,
+	          chunk_data,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_prefetcher_schedule(
+	          chunk_prefetcher,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libevtx_chunk_prefetcher_get_chunk_data(
+	          chunk_prefetcher,
+	          2 * 65536,
+	          chunk_data,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "memory_compare",
+	 memory_compare( chunk_data, &( evtx_test_chunk_prefetcher_data[ 2 * 65536 ] ), 65536 ),
+	 0 );
+
+	/* A chunk is only returned once
+	 */
+	result = libevtx_chunk_prefetcher_get_chunk_data(
+	          chunk_prefetcher,
+	          2 * 65536,
+	          chunk_data,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_prefetcher_get_chunk_data(
+	          chunk_prefetcher,
+	          3 * 65536,
+	          chunk_data,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "memory_compare",
+	 memory_compare( chunk_data, &( evtx_test_chunk_prefetcher_data[ 3 * 65536 ] ), 65536 ),
+	 0 );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_prefetcher_schedule(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_prefetcher_get_chunk_data(
+	          NULL,
+	          0,
+	          chunk_data,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_prefetcher_get_chunk_data(
+	          chunk_prefetcher,
+	          0,
+	          NULL,
+	          65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_prefetcher_get_chunk_data(
+	          chunk_prefetcher,
+	          0,
+	          chunk_data,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_prefetcher_free(
+	          &chunk_prefetcher,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_prefetcher",
+	 chunk_prefetcher );
+
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_prefetcher != NULL )
+	{
+		libevtx_chunk_prefetcher_free(
+		 &chunk_prefetcher,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_prefetcher_initialize",
+	 evtx_test_chunk_prefetcher_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_prefetcher_free",
+	 evtx_test_chunk_prefetcher_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_prefetcher_schedule",
+	 evtx_test_chunk_prefetcher_schedule );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
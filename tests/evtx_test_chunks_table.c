@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -75,6 +76,148 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_chunks_table_reset_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunks_table_reset_scan(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunks_table_reset_scan(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunks_table_unpin_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunks_table_unpin_chunk(
+     void )
+{
+	libevtx_chunks_table_t chunks_table;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &chunks_table,
+	     0,
+	     sizeof( libevtx_chunks_table_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_chunks_table_unpin_chunk(
+	          &chunks_table,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunks_table_unpin_chunk(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunks_table_reset_pinned function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunks_table_reset_pinned(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunks_table_reset_pinned(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 /* The main program
@@ -100,6 +243,22 @@ int main(
 	 "libevtx_chunks_table_free",
 	 evtx_test_chunks_table_free );
 
+	/* TODO: add tests for libevtx_chunks_table_get_chunk_by_index */
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunks_table_reset_scan",
+	 evtx_test_chunks_table_reset_scan );
+
+	/* TODO: add tests for libevtx_chunks_table_pin_chunk */
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunks_table_unpin_chunk",
+	 evtx_test_chunks_table_unpin_chunk );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunks_table_reset_pinned",
+	 evtx_test_chunks_table_reset_pinned );
+
 	/* TODO: add tests for libevtx_chunks_table_read_record */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
@@ -0,0 +1,504 @@
+/*
+ * Library codepage_table functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_codepage_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_codepage_table_set_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_codepage_table_set_codepage(
+     void )
+{
+	libevtx_codepage_table_t codepage_table;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_codepage_table_set_codepage(
+	          &codepage_table,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "codepage_table.codepage",
+	 codepage_table.codepage,
+	 LIBEVTX_CODEPAGE_WINDOWS_1252 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "codepage_table.utf8_character_sizes[ 'A' ]",
+	 codepage_table.utf8_character_sizes[ 'A' ],
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "codepage_table.utf8_characters[ 'A' ][ 0 ]",
+	 codepage_table.utf8_characters[ 'A' ][ 0 ],
+	 'A' );
+
+	/* 0xe9 is LATIN SMALL LETTER E WITH ACUTE in Windows 1252
+	 */
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "codepage_table.utf8_character_sizes[ 0xe9 ]",
+	 codepage_table.utf8_character_sizes[ 0xe9 ],
+	 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "codepage_table.utf8_characters[ 0xe9 ][ 0 ]",
+	 codepage_table.utf8_characters[ 0xe9 ][ 0 ],
+	 0xc3 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "codepage_table.utf8_characters[ 0xe9 ][ 1 ]",
+	 codepage_table.utf8_characters[ 0xe9 ][ 1 ],
+	 0xa9 );
+
+	/* In Windows 932 the byte values of 0x80 and above are not converted on their own
+	 */
+	result = libevtx_codepage_table_set_codepage(
+	          &codepage_table,
+	          LIBEVTX_CODEPAGE_WINDOWS_932,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "codepage_table.utf8_character_sizes[ 'A' ]",
+	 codepage_table.utf8_character_sizes[ 'A' ],
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "codepage_table.utf8_character_sizes[ 0x82 ]",
+	 codepage_table.utf8_character_sizes[ 0x82 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_codepage_table_set_codepage(
+	          NULL,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_codepage_table_get_ascii_prefix_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_codepage_table_get_ascii_prefix_size(
+     void )
+{
+	uint8_t byte_stream[ 20 ] = {
+		'A', 'p', 'p', 'l', 'i', 'c', 'a', 't', 'i', 'o', 'n', ' ', 'c', 'a', 'f', 0xe9,
+		' ', 'l', 'o', 'g' };
+
+	libcerror_error_t *error = NULL;
+	size_t prefix_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_codepage_table_get_ascii_prefix_size(
+	          byte_stream,
+	          20,
+	          &prefix_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "prefix_size",
+	 prefix_size,
+	 (size_t) 15 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_codepage_table_get_ascii_prefix_size(
+	          &( byte_stream[ 16 ] ),
+	          4,
+	          &prefix_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "prefix_size",
+	 prefix_size,
+	 (size_t) 4 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_codepage_table_get_ascii_prefix_size(
+	          &( byte_stream[ 15 ] ),
+	          5,
+	          &prefix_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "prefix_size",
+	 prefix_size,
+	 (size_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_codepage_table_get_ascii_prefix_size(
+	          NULL,
+	          20,
+	          &prefix_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_codepage_table_get_ascii_prefix_size(
+	          byte_stream,
+	          20,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_codepage_table_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_codepage_table_copy_to_utf8_string(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		'c', 'a', 'f', 0xe9, ' ', 'l', 'o', 'g' };
+
+	uint8_t expected_utf8_string[ 9 ] = {
+		'c', 'a', 'f', 0xc3, 0xa9, ' ', 'l', 'o', 'g' };
+
+	uint8_t utf8_string[ 16 ];
+
+	libevtx_codepage_table_t codepage_table;
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_codepage_table_set_codepage(
+	          &codepage_table,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_codepage_table_copy_to_utf8_string(
+	          &codepage_table,
+	          byte_stream,
+	          8,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 9 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          9 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a byte value that is not a character on its own
+	 */
+	result = libevtx_codepage_table_set_codepage(
+	          &codepage_table,
+	          LIBEVTX_CODEPAGE_WINDOWS_932,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_codepage_table_copy_to_utf8_string(
+	          &codepage_table,
+	          byte_stream,
+	          8,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_codepage_table_copy_to_utf8_string(
+	          NULL,
+	          byte_stream,
+	          8,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_codepage_table_copy_to_utf8_string(
+	          &codepage_table,
+	          byte_stream,
+	          8,
+	          utf8_string,
+	          2,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_codepage_table_copy_to_utf8_string(
+	          &codepage_table,
+	          byte_stream,
+	          8,
+	          utf8_string,
+	          16,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_codepage_table_set_codepage",
+	 evtx_test_codepage_table_set_codepage );
+
+	EVTX_TEST_RUN(
+	 "libevtx_codepage_table_get_ascii_prefix_size",
+	 evtx_test_codepage_table_get_ascii_prefix_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_codepage_table_copy_to_utf8_string",
+	 evtx_test_codepage_table_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1088 @@
+/*
+ * Library collection type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_collection.h"
+
+/* Tests the libevtx_collection_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libevtx_collection_t *collection = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_collection_initialize(
+	          &collection,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "collection",
+	 collection );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_collection_free(
+	          &collection,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "collection",
+	 collection );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	collection = (libevtx_collection_t *) 0x12345678UL;
+
+	result = libevtx_collection_initialize(
+	          &collection,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	collection = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_collection_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_collection_initialize(
+		          &collection,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( collection != NULL )
+			{
+				libevtx_collection_free(
+				 &collection,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "collection",
+			 collection );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_collection_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_collection_initialize(
+		          &collection,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( collection != NULL )
+			{
+				libevtx_collection_free(
+				 &collection,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "collection",
+			 collection );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( collection != NULL )
+	{
+		libevtx_collection_free(
+		 &collection,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_collection_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_collection_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_set_ascii_codepage(
+     libevtx_collection_t *collection )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_collection_set_ascii_codepage(
+	          collection,
+	          LIBEVTX_CODEPAGE_WINDOWS_1250,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_collection_set_ascii_codepage(
+	          collection,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_set_ascii_codepage(
+	          NULL,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_set_ascii_codepage(
+	          collection,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_collection_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_set_number_of_threads(
+     libevtx_collection_t *collection )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_collection_set_number_of_threads(
+	          collection,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_set_number_of_threads(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_set_number_of_threads(
+	          collection,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_collection_open function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_open(
+     libevtx_collection_t *collection )
+{
+	const char *filenames[ 1 ] = { NULL };
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_open(
+	          NULL,
+	          filenames,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_open(
+	          collection,
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_open(
+	          collection,
+	          filenames,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_open(
+	          collection,
+	          filenames,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_collection_set_ignore_open_errors and libevtx_collection_get_file_open_error_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_set_ignore_open_errors(
+     libevtx_collection_t *collection )
+{
+	char error_string[ 512 ];
+
+	const char *filenames[ 1 ] = { "evtx_test_collection_missing.evtx" };
+	libcerror_error_t *error   = NULL;
+	libevtx_record_t *record   = NULL;
+	int number_of_files        = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_collection_set_ignore_open_errors(
+	          collection,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The open succeeds if a file cannot be opened
+	 */
+	result = libevtx_collection_open(
+	          collection,
+	          filenames,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_collection_get_number_of_files(
+	          collection,
+	          &number_of_files,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_collection_get_file_open_error_string(
+	          collection,
+	          0,
+	          error_string,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "error_string[ 0 ]",
+	 (int) error_string[ 0 ],
+	 0 );
+
+	/* A file that could not be opened has no records
+	 */
+	result = libevtx_collection_get_next_record(
+	          collection,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_get_file_open_error_string(
+	          NULL,
+	          0,
+	          error_string,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_get_file_open_error_string(
+	          collection,
+	          1,
+	          error_string,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_get_file_open_error_string(
+	          collection,
+	          0,
+	          NULL,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_set_ignore_open_errors(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_collection_close(
+	          collection,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_collection_set_ignore_open_errors(
+	          collection,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_collection_get_number_of_files function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_get_number_of_files(
+     libevtx_collection_t *collection )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_files      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_collection_get_number_of_files(
+	          collection,
+	          &number_of_files,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_get_number_of_files(
+	          NULL,
+	          &number_of_files,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_collection_get_number_of_files(
+	          collection,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_collection_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_get_next_record(
+     libevtx_collection_t *collection )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_record_t *record = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_collection_get_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The collection is not open
+	 */
+	result = libevtx_collection_get_next_record(
+	          collection,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_collection_heap_sift_down function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_collection_heap_sift_down(
+     void )
+{
+	libevtx_collection_stream_t streams[ 5 ];
+	libevtx_internal_collection_t internal_collection;
+	int heap[ 5 ];
+
+	uint64_t expected_written_times[ 5 ] = { 10, 20, 20, 30, 40 };
+	int expected_stream_indexes[ 5 ]     = { 3, 1, 4, 0, 2 };
+	uint64_t written_times[ 5 ]          = { 30, 20, 40, 10, 20 };
+	int heap_index                       = 0;
+	int stream_index                     = 0;
+
+	memory_set(
+	 &internal_collection,
+	 0,
+	 sizeof( libevtx_internal_collection_t ) );
+
+	memory_set(
+	 streams,
+	 0,
+	 sizeof( libevtx_collection_stream_t ) * 5 );
+
+	for( stream_index = 0;
+	     stream_index < 5;
+	     stream_index++ )
+	{
+		streams[ stream_index ].written_time = written_times[ stream_index ];
+
+		heap[ stream_index ] = stream_index;
+	}
+	internal_collection.streams           = streams;
+	internal_collection.number_of_streams = 5;
+	internal_collection.heap              = heap;
+	internal_collection.heap_size         = 5;
+
+	for( heap_index = 1;
+	     heap_index >= 0;
+	     heap_index-- )
+	{
+		libevtx_collection_heap_sift_down(
+		 &internal_collection,
+		 heap_index );
+	}
+	/* Test that the streams are removed in order of written time
+	 * and the streams with the same written time in order of their index
+	 */
+	for( heap_index = 0;
+	     heap_index < 5;
+	     heap_index++ )
+	{
+		stream_index = internal_collection.heap[ 0 ];
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "stream_index",
+		 stream_index,
+		 expected_stream_indexes[ heap_index ] );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "written_time",
+		 streams[ stream_index ].written_time,
+		 expected_written_times[ heap_index ] );
+
+		internal_collection.heap_size -= 1;
+
+		internal_collection.heap[ 0 ] = internal_collection.heap[ internal_collection.heap_size ];
+
+		libevtx_collection_heap_sift_down(
+		 &internal_collection,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error         = NULL;
+	libevtx_collection_t *collection = NULL;
+	int result                       = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "libevtx_collection_initialize",
+	 evtx_test_collection_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_collection_free",
+	 evtx_test_collection_free );
+
+	/* Initialize collection for tests
+	 */
+	result = libevtx_collection_initialize(
+	          &collection,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "collection",
+	 collection );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_collection_set_ascii_codepage",
+	 evtx_test_collection_set_ascii_codepage,
+	 collection );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_collection_set_number_of_threads",
+	 evtx_test_collection_set_number_of_threads,
+	 collection );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_collection_open",
+	 evtx_test_collection_open,
+	 collection );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_collection_set_ignore_open_errors",
+	 evtx_test_collection_set_ignore_open_errors,
+	 collection );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_collection_get_number_of_files",
+	 evtx_test_collection_get_number_of_files,
+	 collection );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_collection_get_next_record",
+	 evtx_test_collection_get_next_record,
+	 collection );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_collection_heap_sift_down",
+	 evtx_test_collection_heap_sift_down );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libevtx_collection_free(
+	          &collection,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "collection",
+	 collection );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( collection != NULL )
+	{
+		libevtx_collection_free(
+		 &collection,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
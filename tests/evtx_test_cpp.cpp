@@ -0,0 +1,213 @@
+/*
+ * Library C++ interface test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <exception>
+#include <utility>
+
+#include <libevtx.hpp>
+
+#include "evtx_test_macros.h"
+
+/* Tests opening a non-existing file
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_cpp_file_open(
+     void )
+{
+	try
+	{
+		evtx::file file(
+		            "" );
+	}
+	catch( const evtx::error & )
+	{
+		return( 1 );
+	}
+	catch( const std::exception &exception )
+	{
+		fprintf(
+		 stdout,
+		 "Unexpected exception: %s\n",
+		 exception.what() );
+
+		return( 0 );
+	}
+	fprintf(
+	 stdout,
+	 "Opening an empty filename did not throw evtx::error.\n" );
+
+	return( 0 );
+}
+
+/* Tests the evtx::file, evtx::record_range and evtx::record classes
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_cpp_file_records(
+     const char *source,
+     int access_flags )
+{
+	try
+	{
+		evtx::file file(
+		            source,
+		            access_flags );
+
+		uint64_t first_identifier = 0;
+		int number_of_records     = file.number_of_records();
+		int record_index          = 0;
+
+		for( const evtx::record_view &record_view : file.records() )
+		{
+			if( !record_view )
+			{
+				fprintf(
+				 stdout,
+				 "Missing record: %d.\n",
+				 record_index );
+
+				return( 0 );
+			}
+			if( record_index == 0 )
+			{
+				first_identifier = record_view.identifier();
+			}
+			record_view.written_time();
+			record_view.event_identifier();
+			record_view.computer_name();
+
+			if( record_view.xml().empty() )
+			{
+				fprintf(
+				 stdout,
+				 "Missing XML string of record: %d.\n",
+				 record_index );
+
+				return( 0 );
+			}
+			record_index++;
+		}
+		if( record_index != number_of_records )
+		{
+			fprintf(
+			 stdout,
+			 "Number of records in range: %d does not match number of records: %d.\n",
+			 record_index,
+			 number_of_records );
+
+			return( 0 );
+		}
+		if( number_of_records > 0 )
+		{
+			evtx::record record = file.record_at(
+			                       0 );
+
+			evtx::record moved_record = std::move(
+			                             record );
+
+			if( record
+			 || !moved_record )
+			{
+				fprintf(
+				 stdout,
+				 "Invalid owned record after move.\n" );
+
+				return( 0 );
+			}
+			if( moved_record.identifier() != first_identifier )
+			{
+				fprintf(
+				 stdout,
+				 "Identifier of owned record does not match identifier of record in range.\n" );
+
+				return( 0 );
+			}
+			for( int string_index = 0;
+			     string_index < moved_record.number_of_strings();
+			     string_index++ )
+			{
+				moved_record.string(
+				 string_index );
+			}
+		}
+		file.close();
+	}
+	catch( const std::exception &exception )
+	{
+		fprintf(
+		 stdout,
+		 "Unexpected exception: %s\n",
+		 exception.what() );
+
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	const char *source = NULL;
+
+	if( argc > 1 )
+	{
+		source = argv[ argc - 1 ];
+	}
+	EVTX_TEST_RUN(
+	 "evtx::file::open",
+	 evtx_test_cpp_file_open );
+
+	if( source != NULL )
+	{
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "evtx::file::records",
+		 evtx_test_cpp_file_records,
+		 source,
+		 LIBEVTX_OPEN_READ );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+		/* In thread-safe mode the range uses owned records
+		 */
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "evtx::file::records thread-safe",
+		 evtx_test_cpp_file_records,
+		 source,
+		 LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_THREAD_SAFE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,460 @@
+/*
+ * Library decode_budget functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_decode_budget.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* A chunk data fragment that contains a template definition with 100 bytes of data
+ * at offset 32 and a record at offset 160 with a template instance that references
+ * the template definition followed by 10 substitution values
+ */
+uint8_t evtx_test_decode_budget_chunk_data[ 256 ];
+
+/* Initializes the test chunk data
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decode_budget_initialize_chunk_data(
+     void )
+{
+	if( memory_set(
+	     evtx_test_decode_budget_chunk_data,
+	     0,
+	     256 ) == NULL )
+	{
+		return( 0 );
+	}
+	/* The template definition data size
+	 */
+	evtx_test_decode_budget_chunk_data[ 52 ] = 100;
+
+	/* The fragment header and template instance with the template definition offset
+	 */
+	evtx_test_decode_budget_chunk_data[ 160 ] = 0x0f;
+	evtx_test_decode_budget_chunk_data[ 161 ] = 0x01;
+	evtx_test_decode_budget_chunk_data[ 162 ] = 0x01;
+	evtx_test_decode_budget_chunk_data[ 164 ] = 0x0c;
+	evtx_test_decode_budget_chunk_data[ 170 ] = 32;
+
+	/* The number of substitution values
+	 */
+	evtx_test_decode_budget_chunk_data[ 174 ] = 10;
+
+	return( 1 );
+}
+
+/* Tests the libevtx_decode_budget_is_limited function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decode_budget_is_limited(
+     void )
+{
+	libevtx_decode_budget_t decode_budget;
+
+	int result = 0;
+
+	if( memory_set(
+	     &decode_budget,
+	     0,
+	     sizeof( libevtx_decode_budget_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_decode_budget_is_limited(
+	          &decode_budget );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	decode_budget.maximum_decode_time = 1000000;
+
+	result = libevtx_decode_budget_is_limited(
+	          &decode_budget );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_decode_budget_is_limited(
+	          NULL );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_decode_budget_check_binary_xml function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decode_budget_check_binary_xml(
+     void )
+{
+	libevtx_decode_budget_t decode_budget;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_decode_budget_initialize_chunk_data();
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( memory_set(
+	     &decode_budget,
+	     0,
+	     sizeof( libevtx_decode_budget_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          evtx_test_decode_budget_chunk_data,
+	          256,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The decoded size contains the referenced template definition
+	 */
+	decode_budget.maximum_decoded_size = 120;
+
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          evtx_test_decode_budget_chunk_data,
+	          256,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	decode_budget.maximum_decoded_size = 140;
+
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          evtx_test_decode_budget_chunk_data,
+	          256,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The substitution values are counted as nodes
+	 */
+	decode_budget.maximum_number_of_nodes = 5;
+
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          evtx_test_decode_budget_chunk_data,
+	          256,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	decode_budget.maximum_number_of_nodes = 10;
+
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          evtx_test_decode_budget_chunk_data,
+	          256,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_decode_budget_check_binary_xml(
+	          NULL,
+	          evtx_test_decode_budget_chunk_data,
+	          256,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          NULL,
+	          256,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          evtx_test_decode_budget_chunk_data,
+	          (size_t) SSIZE_MAX + 1,
+	          160,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_budget_check_binary_xml(
+	          &decode_budget,
+	          evtx_test_decode_budget_chunk_data,
+	          256,
+	          240,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_decode_budget_check_xml_document function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decode_budget_check_xml_document(
+     void )
+{
+	libevtx_decode_budget_t decode_budget;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &decode_budget,
+	     0,
+	     sizeof( libevtx_decode_budget_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test error cases
+	 */
+	result = libevtx_decode_budget_check_xml_document(
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_budget_check_xml_document(
+	          &decode_budget,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_decode_budget_is_limited",
+	 evtx_test_decode_budget_is_limited );
+
+	EVTX_TEST_RUN(
+	 "libevtx_decode_budget_check_binary_xml",
+	 evtx_test_decode_budget_check_binary_xml );
+
+	/* TODO: add tests for libevtx_decode_budget_check_xml_tag */
+
+	EVTX_TEST_RUN(
+	 "libevtx_decode_budget_check_xml_document",
+	 evtx_test_decode_budget_check_xml_document );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,848 @@
+/*
+ * Library decode_profile type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_decode_profile.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_decode_profile_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decode_profile_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_decode_profile_t *decode_profile = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_decode_profile_initialize(
+	          &decode_profile,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "decode_profile",
+	 decode_profile );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decode_profile_free(
+	          &decode_profile,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "decode_profile",
+	 decode_profile );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_decode_profile_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decode_profile = (libevtx_decode_profile_t *) 0x12345678UL;
+
+	result = libevtx_decode_profile_initialize(
+	          &decode_profile,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decode_profile = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_decode_profile_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_decode_profile_initialize(
+		          &decode_profile,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( decode_profile != NULL )
+			{
+				libevtx_decode_profile_free(
+				 &decode_profile,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "decode_profile",
+			 decode_profile );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_decode_profile_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_decode_profile_initialize(
+		          &decode_profile,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( decode_profile != NULL )
+			{
+				libevtx_decode_profile_free(
+				 &decode_profile,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "decode_profile",
+			 decode_profile );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decode_profile != NULL )
+	{
+		libevtx_decode_profile_free(
+		 &decode_profile,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_decode_profile_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decode_profile_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_decode_profile_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_decode_profile_add_values function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decode_profile_add_values(
+     void )
+{
+	uint64_t values[ LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES ];
+
+	libevtx_decode_profile_key_t first_key;
+	libevtx_decode_profile_key_t key;
+	libevtx_decode_profile_key_t second_key;
+
+	libcerror_error_t *error                 = NULL;
+	libevtx_decode_profile_t *decode_profile = NULL;
+	int number_of_chunks                     = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &first_key,
+	     0,
+	     sizeof( libevtx_decode_profile_key_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     first_key.provider_identifier,
+	     0x01,
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     first_key.template_identifier,
+	     0xaa,
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	first_key.event_identifier = 4624;
+
+	if( memory_copy(
+	     &second_key,
+	     &first_key,
+	     sizeof( libevtx_decode_profile_key_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	second_key.event_identifier = 4688;
+
+	result = libevtx_decode_profile_initialize(
+	          &decode_profile,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "decode_profile",
+	 decode_profile );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ]     = 1;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]           = 100;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ]            = 0;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ]       = 500;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_ALLOCATIONS ] = 20;
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          &first_key,
+	          0,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ] = 300;
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          &second_key,
+	          2,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Adding values to an existing key without a chunk
+	 */
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ] = 250;
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          &first_key,
+	          -1,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decode_profile_get_number_of_entries(
+	          decode_profile,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The most costly entry is ranked first
+	 */
+	result = libevtx_decode_profile_get_entry_by_index(
+	          decode_profile,
+	          0,
+	          &key,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "key.event_identifier",
+	 key.event_identifier,
+	 (uint32_t) 4624 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ],
+	 (uint64_t) 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ],
+	 (uint64_t) 350 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ],
+	 (uint64_t) 1000 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decode_profile_get_entry_by_index(
+	          decode_profile,
+	          1,
+	          &key,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "key.event_identifier",
+	 key.event_identifier,
+	 (uint32_t) 4688 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ],
+	 (uint64_t) 300 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sorted entries can still be looked up by key
+	 */
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ]     = 1;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]           = 100;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_PARSE_TIME ]            = 0;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_BYTES ]       = 500;
+	values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_ALLOCATIONS ] = 20;
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          &second_key,
+	          2,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decode_profile_get_entry_by_index(
+	          decode_profile,
+	          0,
+	          &key,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "key.event_identifier",
+	 key.event_identifier,
+	 (uint32_t) 4688 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ],
+	 (uint64_t) 400 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decode_profile_get_number_of_entries(
+	          decode_profile,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The chunks without decoded records have no values
+	 */
+	result = libevtx_decode_profile_get_number_of_chunks(
+	          decode_profile,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decode_profile_get_chunk_values(
+	          decode_profile,
+	          1,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ],
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decode_profile_get_chunk_values(
+	          decode_profile,
+	          2,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_NUMBER_OF_RECORDS ],
+	 (uint64_t) 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ]",
+	 values[ LIBEVTX_DECODE_PROFILE_VALUE_DECODE_TIME ],
+	 (uint64_t) 400 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_decode_profile_add_values(
+	          NULL,
+	          &first_key,
+	          0,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          NULL,
+	          0,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          &first_key,
+	          -2,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          &first_key,
+	          0,
+	          NULL,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_profile_add_values(
+	          decode_profile,
+	          &first_key,
+	          0,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_profile_get_entry_by_index(
+	          decode_profile,
+	          2,
+	          &key,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decode_profile_get_chunk_values(
+	          decode_profile,
+	          3,
+	          values,
+	          LIBEVTX_NUMBER_OF_DECODE_PROFILE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_decode_profile_free(
+	          &decode_profile,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "decode_profile",
+	 decode_profile );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decode_profile != NULL )
+	{
+		libevtx_decode_profile_free(
+		 &decode_profile,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_decode_profile_initialize",
+	 evtx_test_decode_profile_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_decode_profile_free",
+	 evtx_test_decode_profile_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_decode_profile_add_values",
+	 evtx_test_decode_profile_add_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,872 @@
+/*
+ * Library decoded_values_file type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libbfio.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/evtx_decoded_values_file.h"
+#include "../libevtx/libevtx_decoded_values_file.h"
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_system_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* WKS-01 as an UTF-16 little-endian stream
+ */
+uint8_t evtx_test_decoded_values_file_computer_name[ 12 ] = {
+	0x57, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x31, 0x00 };
+
+/* System as an UTF-16 little-endian stream
+ */
+uint8_t evtx_test_decoded_values_file_channel_name[ 12 ] = {
+	0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d, 0x00 };
+
+/* Tests the libevtx_decoded_values_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decoded_values_file_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libevtx_decoded_values_file_t *decoded_values_file = NULL;
+	int result                                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_decoded_values_file_initialize(
+	          &decoded_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "decoded_values_file",
+	 decoded_values_file );
+
+	result = libevtx_decoded_values_file_free(
+	          &decoded_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "decoded_values_file",
+	 decoded_values_file );
+
+	/* Test error cases
+	 */
+	result = libevtx_decoded_values_file_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decoded_values_file = (libevtx_decoded_values_file_t *) 0x12345678UL;
+
+	result = libevtx_decoded_values_file_initialize(
+	          &decoded_values_file,
+	          &error );
+
+	decoded_values_file = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoded_values_file != NULL )
+	{
+		libevtx_decoded_values_file_free(
+		 &decoded_values_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_decoded_values_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decoded_values_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_decoded_values_file_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_decoded_values_file_append_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decoded_values_file_append_string(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libevtx_decoded_values_file_t *decoded_values_file = NULL;
+	uint32_t string_entry_index                        = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_decoded_values_file_initialize(
+	          &decoded_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_decoded_values_file_append_string(
+	          decoded_values_file,
+	          evtx_test_decoded_values_file_computer_name,
+	          12,
+	          &string_entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "string_entry_index",
+	 string_entry_index,
+	 (uint32_t) 0 );
+
+	result = libevtx_decoded_values_file_append_string(
+	          decoded_values_file,
+	          evtx_test_decoded_values_file_channel_name,
+	          12,
+	          &string_entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "string_entry_index",
+	 string_entry_index,
+	 (uint32_t) 1 );
+
+	/* A string that was appended before is stored once
+	 */
+	result = libevtx_decoded_values_file_append_string(
+	          decoded_values_file,
+	          evtx_test_decoded_values_file_computer_name,
+	          12,
+	          &string_entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "string_entry_index",
+	 string_entry_index,
+	 (uint32_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_string_entries",
+	 decoded_values_file->number_of_string_entries,
+	 (uint32_t) 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "strings_data_size",
+	 decoded_values_file->strings_data_size,
+	 (uint32_t) 24 );
+
+	/* Test error cases
+	 */
+	result = libevtx_decoded_values_file_append_string(
+	          NULL,
+	          evtx_test_decoded_values_file_computer_name,
+	          12,
+	          &string_entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decoded_values_file_append_string(
+	          decoded_values_file,
+	          NULL,
+	          12,
+	          &string_entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decoded_values_file_append_string(
+	          decoded_values_file,
+	          evtx_test_decoded_values_file_computer_name,
+	          12,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_decoded_values_file_free(
+	          &decoded_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoded_values_file != NULL )
+	{
+		libevtx_decoded_values_file_free(
+		 &decoded_values_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_decoded_values_file_append_system_values, libevtx_decoded_values_file_write,
+ * libevtx_decoded_values_file_read_data and libevtx_decoded_values_file_get_system_values_by_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_decoded_values_file_system_values(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libbfio_handle_t *decoded_values_file_io_handle     = NULL;
+	libcerror_error_t *error                            = NULL;
+	libevtx_decoded_values_file_t *decoded_values_file  = NULL;
+	libevtx_decoded_values_file_t *read_values_file     = NULL;
+	libevtx_system_values_t system_values;
+	size_t data_size                                    = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_decoded_values_file_initialize(
+	          &decoded_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decoded_values_file_initialize(
+	          &read_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The memory range has no data set, hence the decoded values file
+	 * cannot be opened for writing
+	 */
+	result = libbfio_memory_range_initialize(
+	          &decoded_values_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          &system_values,
+	          0,
+	          sizeof( libevtx_system_values_t ) ) != NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	system_values.event_identifier   = 4624;
+	system_values.event_level        = 4;
+	system_values.computer_name      = evtx_test_decoded_values_file_computer_name;
+	system_values.computer_name_size = 12;
+	system_values.flags              = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER
+	                                 | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL
+	                                 | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME;
+
+	/* Test regular cases
+	 */
+	result = libevtx_decoded_values_file_append_system_values(
+	          decoded_values_file,
+	          4096 + 512,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	system_values.event_identifier = 4625;
+
+	result = libevtx_decoded_values_file_append_system_values(
+	          decoded_values_file,
+	          4096 + 1024,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records must be appended in ascending record file offset order
+	 */
+	result = libevtx_decoded_values_file_append_system_values(
+	          decoded_values_file,
+	          4096 + 1024,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The entries are assembled even if writing fails
+	 */
+	result = libevtx_decoded_values_file_write(
+	          decoded_values_file,
+	          decoded_values_file_io_handle,
+	          0x12345678UL,
+	          0,
+	          (size64_t) 69632,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "decoded_values_file->data",
+	 decoded_values_file->data );
+
+	result = libevtx_decoded_values_file_get_system_values_by_offset(
+	          decoded_values_file,
+	          4096 + 1024,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "system_values.event_identifier",
+	 system_values.event_identifier,
+	 (uint32_t) 4625 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "system_values.computer_name_size",
+	 system_values.computer_name_size,
+	 (size_t) 12 );
+
+	result = memory_compare(
+	          system_values.computer_name,
+	          evtx_test_decoded_values_file_computer_name,
+	          12 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_decoded_values_file_get_system_values_by_offset(
+	          decoded_values_file,
+	          4096 + 768,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The assembled data is read in place
+	 */
+	data_size = sizeof( evtx_decoded_values_file_header_t )
+	          + ( 2 * sizeof( evtx_decoded_values_file_record_entry_t ) )
+	          + sizeof( evtx_decoded_values_file_string_entry_t )
+	          + 12;
+
+	result = memory_copy(
+	          data,
+	          decoded_values_file->data,
+	          data_size ) != NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The data was created for another file
+	 */
+	result = libevtx_decoded_values_file_read_data(
+	          read_values_file,
+	          data,
+	          data_size,
+	          0x12345678UL,
+	          0,
+	          (size64_t) 65536,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decoded_values_file_read_data(
+	          read_values_file,
+	          data,
+	          data_size,
+	          0x12345678UL,
+	          0,
+	          (size64_t) 69632,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decoded_values_file_get_system_values_by_offset(
+	          read_values_file,
+	          4096 + 512,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "system_values.event_identifier",
+	 system_values.event_identifier,
+	 (uint32_t) 4624 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "system_values.event_level",
+	 system_values.event_level,
+	 (uint8_t) 4 );
+
+	/* The data is not used if its checksum does not match
+	 */
+	data[ data_size - 1 ] ^= 0xff;
+
+	result = libevtx_decoded_values_file_read_data(
+	          read_values_file,
+	          data,
+	          data_size,
+	          0x12345678UL,
+	          0,
+	          (size64_t) 69632,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_decoded_values_file_get_system_values_by_offset(
+	          NULL,
+	          4096 + 512,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decoded_values_file_get_system_values_by_offset(
+	          decoded_values_file,
+	          -1,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_decoded_values_file_read_data(
+	          read_values_file,
+	          NULL,
+	          data_size,
+	          0x12345678UL,
+	          0,
+	          (size64_t) 69632,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &decoded_values_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decoded_values_file_free(
+	          &read_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_decoded_values_file_free(
+	          &decoded_values_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoded_values_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &decoded_values_file_io_handle,
+		 NULL );
+	}
+	if( read_values_file != NULL )
+	{
+		libevtx_decoded_values_file_free(
+		 &read_values_file,
+		 NULL );
+	}
+	if( decoded_values_file != NULL )
+	{
+		libevtx_decoded_values_file_free(
+		 &decoded_values_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_decoded_values_file_initialize",
+	 evtx_test_decoded_values_file_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_decoded_values_file_free",
+	 evtx_test_decoded_values_file_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_decoded_values_file_append_string",
+	 evtx_test_decoded_values_file_append_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_decoded_values_file_system_values",
+	 evtx_test_decoded_values_file_system_values );
+
+	/* TODO: add tests for libevtx_decoded_values_file_read */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,834 @@
+/*
+ * Library document_cache type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_document_cache.h"
+#include "../libevtx/libevtx_record_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Creates record values with a specific offset and data size
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_document_cache_create_record_values(
+     libevtx_record_values_t **record_values,
+     off64_t offset,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libevtx_record_values_initialize(
+	     record_values,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *record_values )->offset    = offset;
+	( *record_values )->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Tests the libevtx_document_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_document_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libevtx_document_cache_t *document_cache   = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 2;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_document_cache_initialize(
+	          &document_cache,
+	          1024 * 1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "document_cache",
+	 document_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_document_cache_free(
+	          &document_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "document_cache",
+	 document_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_document_cache_initialize(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	document_cache = (libevtx_document_cache_t *) 0x12345678UL;
+
+	result = libevtx_document_cache_initialize(
+	          &document_cache,
+	          1024 * 1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	document_cache = NULL;
+
+	result = libevtx_document_cache_initialize(
+	          &document_cache,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_document_cache_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_document_cache_initialize(
+		          &document_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( document_cache != NULL )
+			{
+				libevtx_document_cache_free(
+				 &document_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "document_cache",
+			 document_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_document_cache_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_document_cache_initialize(
+		          &document_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( document_cache != NULL )
+			{
+				libevtx_document_cache_free(
+				 &document_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "document_cache",
+			 document_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( document_cache != NULL )
+	{
+		libevtx_document_cache_free(
+		 &document_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_document_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_document_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_document_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_document_cache_insert_record_values and
+ * libevtx_document_cache_take_record_values functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_document_cache_insert_and_take_record_values(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_document_cache_t *document_cache = NULL;
+	libevtx_record_values_t *record_values   = NULL;
+	libevtx_record_values_t *taken_values    = NULL;
+	libevtx_record_values_t *inserted_values = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_document_cache_initialize(
+	          &document_cache,
+	          1024 * 1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "document_cache",
+	 document_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_document_cache_create_record_values(
+	          &record_values,
+	          4096 + 512,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	inserted_values = record_values;
+
+	/* Test regular cases
+	 */
+	result = libevtx_document_cache_insert_record_values(
+	          document_cache,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_document_cache_take_record_values(
+	          document_cache,
+	          4096 + 512,
+	          &taken_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "taken_values",
+	 (int) ( taken_values == inserted_values ),
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "document_cache->size",
+	 document_cache->size,
+	 (uint64_t) 0 );
+
+	result = libevtx_record_values_free(
+	          &taken_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the record values are no longer cached after they were taken
+	 */
+	result = libevtx_document_cache_take_record_values(
+	          document_cache,
+	          4096 + 512,
+	          &taken_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "taken_values",
+	 taken_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_document_cache_insert_record_values(
+	          NULL,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_document_cache_insert_record_values(
+	          document_cache,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_document_cache_take_record_values(
+	          NULL,
+	          4096 + 512,
+	          &taken_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_document_cache_take_record_values(
+	          document_cache,
+	          4096 + 512,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_document_cache_free(
+	          &document_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "document_cache",
+	 document_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( taken_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &taken_values,
+		 NULL );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( document_cache != NULL )
+	{
+		libevtx_document_cache_free(
+		 &document_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that the oldest record values are evicted when the maximum size is exceeded
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_document_cache_evict_record_values(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_document_cache_t *document_cache = NULL;
+	libevtx_record_values_t *record_values   = NULL;
+	libevtx_record_values_t *taken_values    = NULL;
+	size_t record_values_size                = 0;
+	off64_t record_offset                    = 0;
+	int result                               = 0;
+
+	record_values_size = sizeof( libevtx_record_values_t ) + 256;
+
+	/* Initialize test
+	 */
+	result = libevtx_document_cache_initialize(
+	          &document_cache,
+	          (size64_t) ( 2 * record_values_size ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "document_cache",
+	 document_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( record_offset = 4096 + 512;
+	     record_offset < 4096 + 512 + ( 3 * 1024 );
+	     record_offset += 1024 )
+	{
+		result = evtx_test_document_cache_create_record_values(
+		          &record_values,
+		          record_offset,
+		          256,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libevtx_document_cache_insert_record_values(
+		          document_cache,
+		          &record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "document_cache->number_of_used_entries",
+	 document_cache->number_of_used_entries,
+	 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "document_cache->size",
+	 document_cache->size,
+	 (uint64_t) ( 2 * record_values_size ) );
+
+	/* The oldest record values were evicted
+	 */
+	result = libevtx_document_cache_take_record_values(
+	          document_cache,
+	          4096 + 512,
+	          &taken_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_document_cache_take_record_values(
+	          document_cache,
+	          4096 + 512 + ( 2 * 1024 ),
+	          &taken_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "taken_values",
+	 taken_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_free(
+	          &taken_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Record values larger than the maximum size are not cached
+	 */
+	result = evtx_test_document_cache_create_record_values(
+	          &record_values,
+	          4096 + 512,
+	          4 * record_values_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_document_cache_insert_record_values(
+	          document_cache,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "document_cache->number_of_used_entries",
+	 document_cache->number_of_used_entries,
+	 1 );
+
+	/* Test libevtx_document_cache_clear
+	 */
+	result = libevtx_document_cache_clear(
+	          document_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "document_cache->number_of_used_entries",
+	 document_cache->number_of_used_entries,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "document_cache->size",
+	 document_cache->size,
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevtx_document_cache_free(
+	          &document_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( taken_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &taken_values,
+		 NULL );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( document_cache != NULL )
+	{
+		libevtx_document_cache_free(
+		 &document_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_document_cache_initialize",
+	 evtx_test_document_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_document_cache_free",
+	 evtx_test_document_cache_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_document_cache_insert_record_values",
+	 evtx_test_document_cache_insert_and_take_record_values );
+
+	EVTX_TEST_RUN(
+	 "libevtx_document_cache_evict_record_values",
+	 evtx_test_document_cache_evict_record_values );
+
+	/* TODO: add tests for libevtx_document_cache_release_record_values */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
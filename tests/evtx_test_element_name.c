@@ -0,0 +1,259 @@
+/*
+ * Library element_name functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_element_name.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_element_name_get_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_element_name_get_identifier(
+     void )
+{
+	int name_identifier = 0;
+
+	/* Test regular cases
+	 */
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "Data",
+	                   5 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_DATA );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "EventData",
+	                   10 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_EVENT_DATA );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "EventID",
+	                   8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_EVENT_IDENTIFIER );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "System",
+	                   7 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_SYSTEM );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "ProcessingErrorData",
+	                   20 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_PROCESSING_ERROR_DATA );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "UserData",
+	                   9 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_USER_DATA );
+
+	/* Test names that are not well-known
+	 */
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "Unknown",
+	                   8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_UNKNOWN );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "Systems",
+	                   8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_UNKNOWN );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "system",
+	                   7 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_UNKNOWN );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "EventData",
+	                   9 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_UNKNOWN );
+
+	/* Test error cases
+	 */
+	name_identifier = libevtx_element_name_get_identifier(
+	                   NULL,
+	                   10 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_UNKNOWN );
+
+	name_identifier = libevtx_element_name_get_identifier(
+	                   (uint8_t *) "EventData",
+	                   (size_t) SSIZE_MAX + 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_identifier",
+	 name_identifier,
+	 LIBEVTX_ELEMENT_NAME_UNKNOWN );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_element_name_get_xml_tag_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_element_name_get_xml_tag_identifier(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int name_identifier      = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_element_name_get_xml_tag_identifier(
+	          NULL,
+	          &name_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_element_name_get_xml_tag_identifier(
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_element_name_get_identifier",
+	 evtx_test_element_name_get_identifier );
+
+	EVTX_TEST_RUN(
+	 "libevtx_element_name_get_xml_tag_identifier",
+	 evtx_test_element_name_get_xml_tag_identifier );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,385 @@
+/*
+ * Library event_data_values functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_event_data_values.h"
+
+uint8_t evtx_test_event_data_values_data1[ 493 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x34, 0x12,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x0f, 0x01,
+	0x01, 0x00, 0x01, 0xff, 0xff, 0x78, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00,
+	0x00, 0x02, 0x01, 0xff, 0xff, 0x0b, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d,
+	0x00, 0x00, 0x00, 0x02, 0x41, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x69,
+	0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x46, 0xb2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x05, 0x01, 0x04, 0x00, 0x54, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x06, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x47, 0x00, 0x75,
+	0x00, 0x69, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0f, 0x03, 0x01, 0xff, 0xff, 0x22,
+	0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x45,
+	0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x49, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02,
+	0x0d, 0x01, 0x00, 0x06, 0x04, 0x01, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x02, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x32, 0x00, 0x00,
+	0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x43, 0x00, 0x68,
+	0x00, 0x61, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01,
+	0x08, 0x00, 0x53, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00,
+	0x79, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74,
+	0x00, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x01, 0xff, 0xff, 0x1c,
+	0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x44,
+	0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x03, 0x00, 0x01, 0x04, 0x04,
+	0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x02, 0x00, 0x06, 0x00, 0x01, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3a, 0x5b, 0x55, 0x9c, 0x8c, 0x4d, 0x43, 0x8c, 0x3b,
+	0xd2, 0x48, 0x2f, 0x55, 0xb1, 0x0a, 0x10, 0x12, 0x04, 0xed, 0x01, 0x00, 0x00 };
+
+uint8_t evtx_test_event_data_values_data2[ 64 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_event_data_values_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_event_data_values_read_data(
+     void )
+{
+	libevtx_event_data_values_t event_data_values;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_event_data_values_read_data(
+	          &event_data_values,
+	          evtx_test_event_data_values_data1,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "event_data_values.number_of_values",
+	 event_data_values.number_of_values,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "event_data_values.values[ 0 ].name_size",
+	 event_data_values.values[ 0 ].name_size,
+	 (size_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "event_data_values.values[ 0 ].value_size",
+	 event_data_values.values[ 0 ].value_size,
+	 (size_t) 0 );
+
+	/* Test with binary XML data that is not supported
+	 */
+	result = libevtx_event_data_values_read_data(
+	          &event_data_values,
+	          evtx_test_event_data_values_data2,
+	          64,
+	          0,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_event_data_values_read_data(
+	          NULL,
+	          evtx_test_event_data_values_data1,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_event_data_values_read_data(
+	          &event_data_values,
+	          NULL,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_event_data_values_read_data(
+	          &event_data_values,
+	          evtx_test_event_data_values_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_event_data_values_read_data(
+	          &event_data_values,
+	          evtx_test_event_data_values_data1,
+	          493,
+	          0,
+	          494,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_event_data_values_compare_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_event_data_values_compare_utf8_string(
+     void )
+{
+	uint8_t utf16_stream[ 8 ] = {
+		'T', 0, 'e', 0, 's', 0, 't', 0 };
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_event_data_values_compare_utf8_string(
+	          utf16_stream,
+	          8,
+	          (uint8_t *) "Test",
+	          5,
+	          0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_event_data_values_compare_utf8_string(
+	          utf16_stream,
+	          8,
+	          (uint8_t *) "test",
+	          5,
+	          0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_event_data_values_compare_utf8_string(
+	          utf16_stream,
+	          8,
+	          (uint8_t *) "test",
+	          5,
+	          1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_event_data_values_compare_utf8_string(
+	          utf16_stream,
+	          8,
+	          (uint8_t *) "Tes",
+	          4,
+	          0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test an empty string
+	 */
+	result = libevtx_event_data_values_compare_utf8_string(
+	          NULL,
+	          0,
+	          (uint8_t *) "",
+	          1,
+	          0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_event_data_values_compare_utf8_string(
+	          NULL,
+	          0,
+	          (uint8_t *) "Test",
+	          5,
+	          0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_event_data_values_compare_utf8_string(
+	          utf16_stream,
+	          8,
+	          NULL,
+	          5,
+	          0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_event_data_values_read_data",
+	 evtx_test_event_data_values_read_data );
+
+	/* TODO: add tests for libevtx_event_data_values_read_template_definition */
+
+	/* TODO: add tests for libevtx_event_data_values_read_element */
+
+	/* TODO: add tests for libevtx_event_data_values_read_substitution_values */
+
+	/* TODO: add tests for libevtx_event_data_values_get_string_data */
+
+	EVTX_TEST_RUN(
+	 "libevtx_event_data_values_compare_utf8_string",
+	 evtx_test_event_data_values_compare_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -71,6 +72,7 @@ int libevtx_file_open_file_io_handle(
 int evtx_test_file_open_source(
      libevtx_file_t **file,
      libbfio_handle_t *file_io_handle,
+     int access_flags,
      libcerror_error_t **error )
 {
 	static char *function = "evtx_test_file_open_source";
@@ -114,7 +116,7 @@ int evtx_test_file_open_source(
 	result = libevtx_file_open_file_io_handle(
 	          *file,
 	          file_io_handle,
-	          LIBEVTX_OPEN_READ,
+	          access_flags,
 	          error );
 
 	if( result != 1 )
@@ -1002,58 +1004,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_file_close function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_close(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test error cases
-	 */
-	result = libevtx_file_close(
-	          NULL,
-	          &error );
-
-	EVTX_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libevtx_file_open and libevtx_file_close functions
+/* Tests the libevtx_file_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_open_close(
+int evtx_test_file_open_memory(
      const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	libevtx_file_t *file     = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	uint8_t *data                    = NULL;
+	size64_t file_size               = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
-	result = libevtx_file_initialize(
-	          &file,
+	result = libbfio_file_initialize(
+	          &file_io_handle,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1062,29 +1031,29 @@ int evtx_test_file_open_close(
 	 1 );
 
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+	 "file_io_handle",
+	 file_io_handle );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
-	 */
+	string_length = system_string_length(
+	                 source );
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevtx_file_open_wide(
-	          file,
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
 	          source,
-	          LIBEVTX_OPEN_READ,
+	          string_length,
 	          &error );
 #else
-	result = libevtx_file_open(
-	          file,
+	result = libbfio_file_set_name(
+	          file_io_handle,
 	          source,
-	          LIBEVTX_OPEN_READ,
+	          string_length,
 	          &error );
 #endif
-
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1094,34 +1063,24 @@ int evtx_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libevtx_file_close(
-	          file,
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevtx_file_open_wide(
-	          file,
-	          source,
-	          LIBEVTX_OPEN_READ,
-	          &error );
-#else
-	result = libevtx_file_open(
-	          file,
-	          source,
-	          LIBEVTX_OPEN_READ,
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
 	          &error );
-#endif
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1132,8 +1091,35 @@ int evtx_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libevtx_file_close(
-	          file,
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) 0 );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) file_size );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              (size_t) file_size,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1145,10 +1131,8 @@ int evtx_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libevtx_file_free(
-	          &file,
+	result = libbfio_handle_free(
+	          &file_io_handle,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1157,6 +1141,19 @@ int evtx_test_file_open_close(
 	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "file",
 	 file );
 
@@ -1164,36 +1161,13 @@ int evtx_test_file_open_close(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( file != NULL )
-	{
-		libevtx_file_free(
-		 &file,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libevtx_file_signal_abort function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_signal_abort(
-     libevtx_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
+	/* Test open
 	 */
-	result = libevtx_file_signal_abort(
+	result = libevtx_file_open_memory(
 	          file,
+	          data,
+	          (size_t) file_size,
+	          LIBEVTX_OPEN_READ,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1205,10 +1179,13 @@ int evtx_test_file_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open when already opened
 	 */
-	result = libevtx_file_signal_abort(
-	          NULL,
+	result = libevtx_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          LIBEVTX_OPEN_READ,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1223,51 +1200,45 @@ int evtx_test_file_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libevtx_file_close(
+	          file,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-/* Tests the libevtx_file_get_ascii_codepage function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_get_ascii_codepage(
-     libevtx_file_t *file )
-{
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int ascii_codepage_is_set = 0;
-	int result                = 0;
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libevtx_file_get_ascii_codepage(
-	          file,
-	          &ascii_codepage,
+	result = libevtx_file_open_memory(
+	          NULL,
+	          data,
+	          (size_t) file_size,
+	          LIBEVTX_OPEN_READ,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	ascii_codepage_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libevtx_file_get_ascii_codepage(
+	result = libevtx_file_open_memory(
+	          file,
 	          NULL,
-	          &ascii_codepage,
+	          (size_t) file_size,
+	          LIBEVTX_OPEN_READ,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1282,100 +1253,7578 @@ int evtx_test_file_get_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	if( ascii_codepage_is_set != 0 )
-	{
-		result = libevtx_file_get_ascii_codepage(
-		          file,
-		          NULL,
-		          &error );
+	result = libevtx_file_open_memory(
+	          file,
+	          data,
+	          0,
+	          LIBEVTX_OPEN_READ,
+	          &error );
 
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	libcerror_error_free(
+	 &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	result = libevtx_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          -1,
+	          &error );
 
-/* Tests the libevtx_file_set_ascii_codepage function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_set_ascii_codepage(
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open_file_io_handle function with the thread-safe access flag
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_thread_safe(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	libevtx_record_t *record         = NULL;
+	size_t string_length             = 0;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_THREAD_SAFE,
+	          &error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving a record that manages its own record values
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          0,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#else
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open_file_io_handle function with recovered only access
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_recovered(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	size_t string_length             = 0;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_RECOVERED,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The allocated records are not indexed
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_LAZY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_NO_CACHE | LIBEVTX_ACCESS_FLAG_MAPPED,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open_file_io_handle function with live access
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_live(
+     const system_character_t *source )
+{
+	uint64_t statistics[ LIBEVTX_NUMBER_OF_STATISTICS ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	size_t string_length             = 0;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_LIVE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The chunks of a file that is not written while it is read are consistent
+	 */
+	result = libevtx_file_get_statistics(
+	          file,
+	          statistics,
+	          LIBEVTX_NUMBER_OF_STATISTICS,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_REREADS ]",
+	 statistics[ LIBEVTX_STATISTIC_NUMBER_OF_CHUNK_REREADS ],
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_LIVE | LIBEVTX_ACCESS_FLAG_MAPPED,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Counts the calls of the open progress callback
+ * The open is aborted when the count reaches 0, i.e. at the first call if the count starts at -1
+ * Returns 1 to continue, 0 to abort or -1 on error
+ */
+int evtx_test_file_open_progress_callback(
+     size64_t processed_size,
+     size64_t total_size,
+     void *user_data )
+{
+	int *number_of_calls = (int *) user_data;
+
+	if( ( processed_size > total_size )
+	 || ( number_of_calls == NULL ) )
+	{
+		return( -1 );
+	}
+	*number_of_calls += 1;
+
+	if( *number_of_calls == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests opening a file with a progress callback
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_progress(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	size_t string_length             = 0;
+	int number_of_calls              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with the progress reported for every chunk
+	 * The callback is also called after the last chunk
+	 */
+	result = libevtx_file_set_progress_callback(
+	          file,
+	          &evtx_test_file_open_progress_callback,
+	          &number_of_calls,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_calls",
+	 number_of_calls,
+	 0 );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open aborted by the progress callback
+	 */
+	number_of_calls = -1;
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_calls",
+	 number_of_calls,
+	 0 );
+
+	/* Test removing the progress callback
+	 */
+	result = libevtx_file_set_progress_callback(
+	          file,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_set_progress_callback(
+	          NULL,
+	          &evtx_test_file_open_progress_callback,
+	          &number_of_calls,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_progress_callback(
+	          file,
+	          &evtx_test_file_open_progress_callback,
+	          &number_of_calls,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open_file_io_handle function with deferred recovery
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_deferred_recovery(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libevtx_file_t *file                     = NULL;
+	size_t string_length                     = 0;
+	int deferred_number_of_recovered_records = 0;
+	int deferred_number_of_records           = 0;
+	int number_of_recovered_records          = 0;
+	int number_of_records                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Determine the reference values with the free space scanned on open
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_DEFERRED_RECOVERY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &deferred_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "deferred_number_of_records",
+	 deferred_number_of_records,
+	 number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The free space is scanned when the recovered records are first accessed
+	 */
+	result = libevtx_file_get_number_of_recovered_records(
+	          file,
+	          &deferred_number_of_recovered_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "deferred_number_of_recovered_records",
+	 deferred_number_of_recovered_records,
+	 number_of_recovered_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The recovered records are only added once
+	 */
+	result = libevtx_file_get_number_of_recovered_records(
+	          file,
+	          &deferred_number_of_recovered_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "deferred_number_of_recovered_records",
+	 deferred_number_of_recovered_records,
+	 number_of_recovered_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_DEFERRED_RECOVERY | LIBEVTX_ACCESS_FLAG_LAZY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_DEFERRED_RECOVERY | LIBEVTX_ACCESS_FLAG_RECOVERED_ONLY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open_file_io_handle function with header only access
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_header_only(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libevtx_file_t *file                     = NULL;
+	size_t string_length                     = 0;
+	int estimated_number_of_records          = 0;
+	int number_of_records                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Without the header only access flag the estimate is the number of records
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_estimated_number_of_records(
+	          file,
+	          &estimated_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "estimated_number_of_records",
+	 estimated_number_of_records,
+	 number_of_records );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_HEADER_ONLY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_estimated_number_of_records(
+	          file,
+	          &estimated_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "estimated_number_of_records",
+	 estimated_number_of_records,
+	 -1 );
+
+	/* The records are not read in header only mode
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_HEADER_ONLY | LIBEVTX_ACCESS_FLAG_LAZY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_estimated_number_of_records(
+	          NULL,
+	          &estimated_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_estimated_number_of_records(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates and opens a source file with specific access flags
+ * The file IO handle is created for the source
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_file_open_source_with_access_flags(
+     libevtx_file_t **file,
+     libbfio_handle_t **file_io_handle,
+     const system_character_t *source,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_test_file_open_source_with_access_flags";
+	size_t string_length  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     *file_io_handle,
+	     source,
+	     string_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     *file_io_handle,
+	     source,
+	     string_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file name.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtx_test_file_open_source(
+	     file,
+	     *file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libevtx_file_open_file_io_handle function with XML transcoding
+ * The XML strings of the records must be identical to those rendered from the XML document
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_transcode_xml(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libbfio_handle_t *transcode_file_io_handle  = NULL;
+	libcerror_error_t *error                    = NULL;
+	libevtx_file_t *file                        = NULL;
+	libevtx_file_t *transcode_file              = NULL;
+	libevtx_record_t *record                    = NULL;
+	libevtx_record_t *transcode_record          = NULL;
+	uint8_t *transcode_utf8_string              = NULL;
+	uint8_t *utf8_string                        = NULL;
+	size_t transcode_utf8_string_size           = 0;
+	size_t utf8_string_size                     = 0;
+	int number_of_records                       = 0;
+	int record_index                            = 0;
+	int result                                  = 0;
+	int transcode_number_of_records             = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_file_open_source_with_access_flags(
+	          &file,
+	          &file_io_handle,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_file_open_source_with_access_flags(
+	          &transcode_file,
+	          &transcode_file_io_handle,
+	          source,
+	          LIBEVTX_OPEN_READ_TRANSCODE_XML,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          transcode_file,
+	          &transcode_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "transcode_number_of_records",
+	 transcode_number_of_records,
+	 number_of_records );
+
+	/* Test that the transcoded XML strings are identical to the rendered XML strings
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_record_by_index(
+		          transcode_file,
+		          record_index,
+		          &transcode_record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_xml_string_size(
+		          record,
+		          &utf8_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_xml_string_size(
+		          transcode_record,
+		          &transcode_utf8_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "transcode_utf8_string_size",
+		 transcode_utf8_string_size,
+		 utf8_string_size );
+
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "utf8_string",
+		 utf8_string );
+
+		transcode_utf8_string = (uint8_t *) memory_allocate(
+		                                     sizeof( uint8_t ) * utf8_string_size );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "transcode_utf8_string",
+		 transcode_utf8_string );
+
+		result = libevtx_record_get_utf8_xml_string(
+		          record,
+		          utf8_string,
+		          utf8_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_xml_string(
+		          transcode_record,
+		          transcode_utf8_string,
+		          utf8_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          transcode_utf8_string,
+		          utf8_string,
+		          utf8_string_size );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 transcode_utf8_string );
+
+		transcode_utf8_string = NULL;
+
+		memory_free(
+		 utf8_string );
+
+		utf8_string = NULL;
+
+		result = libevtx_record_free(
+		          &transcode_record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_file_close(
+	          transcode_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_free(
+	          &transcode_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &transcode_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( transcode_utf8_string != NULL )
+	{
+		memory_free(
+		 transcode_utf8_string );
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	if( transcode_record != NULL )
+	{
+		libevtx_record_free(
+		 &transcode_record,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( transcode_file != NULL )
+	{
+		libevtx_file_free(
+		 &transcode_file,
+		 NULL );
+	}
+	if( transcode_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &transcode_file_io_handle,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open_partition function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_partition(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libevtx_file_t *file                     = NULL;
+	size_t string_length                     = 0;
+	uint16_t first_chunk_index               = 0;
+	uint16_t number_of_chunks                = 0;
+	uint16_t partition_number_of_chunks      = 0;
+	uint16_t total_number_of_chunks          = 0;
+	int number_of_partition_records          = 0;
+	int number_of_records                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_chunks(
+	          file,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A file that was not opened as a partition has no partition
+	 */
+	result = libevtx_file_get_partition(
+	          file,
+	          &first_chunk_index,
+	          &partition_number_of_chunks,
+	          &total_number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_chunks > 0 )
+	{
+		/* Test open of a partition that contains all the chunks
+		 */
+		result = libevtx_file_open_partition(
+		          file,
+		          file_io_handle,
+		          0,
+		          number_of_chunks,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_records(
+		          file,
+		          &number_of_partition_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "number_of_partition_records",
+		 number_of_partition_records,
+		 number_of_records );
+
+		result = libevtx_file_get_partition(
+		          file,
+		          &first_chunk_index,
+		          &partition_number_of_chunks,
+		          &total_number_of_chunks,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "first_chunk_index",
+		 first_chunk_index,
+		 0 );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "partition_number_of_chunks",
+		 partition_number_of_chunks,
+		 number_of_chunks );
+
+		result = libevtx_file_close(
+		          file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_open_partition(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          1,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_open_partition(
+	          file,
+	          file_io_handle,
+	          0,
+	          0,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_open_partition(
+	          file,
+	          file_io_handle,
+	          UINT16_MAX,
+	          2,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_open_partition(
+	          file,
+	          file_io_handle,
+	          0,
+	          1,
+	          LIBEVTX_OPEN_READ_LAZY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_partition(
+	          NULL,
+	          &first_chunk_index,
+	          &partition_number_of_chunks,
+	          &total_number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_partition(
+	          file,
+	          NULL,
+	          &partition_number_of_chunks,
+	          &total_number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_partition(
+	          file,
+	          &first_chunk_index,
+	          NULL,
+	          &total_number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_partition(
+	          file,
+	          &first_chunk_index,
+	          &partition_number_of_chunks,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_file_close(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open and libevtx_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_file_open_wide(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#else
+	result = libevtx_file_open(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#endif
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_file_open_wide(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#else
+	result = libevtx_file_open(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#endif
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_signal_abort(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_signal_abort(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_signal_abort(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_ascii_codepage(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int ascii_codepage_is_set = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ascii_codepage_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( ascii_codepage_is_set != 0 )
+	{
+		result = libevtx_file_get_ascii_codepage(
+		          file,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_ascii_codepage(
+     libevtx_file_t *file )
+{
+	int supported_codepages[ 15 ] = {
+		LIBEVTX_CODEPAGE_ASCII,
+		LIBEVTX_CODEPAGE_WINDOWS_874,
+		LIBEVTX_CODEPAGE_WINDOWS_932,
+		LIBEVTX_CODEPAGE_WINDOWS_936,
+		LIBEVTX_CODEPAGE_WINDOWS_949,
+		LIBEVTX_CODEPAGE_WINDOWS_950,
+		LIBEVTX_CODEPAGE_WINDOWS_1250,
+		LIBEVTX_CODEPAGE_WINDOWS_1251,
+		LIBEVTX_CODEPAGE_WINDOWS_1252,
+		LIBEVTX_CODEPAGE_WINDOWS_1253,
+		LIBEVTX_CODEPAGE_WINDOWS_1254,
+		LIBEVTX_CODEPAGE_WINDOWS_1255,
+		LIBEVTX_CODEPAGE_WINDOWS_1256,
+		LIBEVTX_CODEPAGE_WINDOWS_1257,
+		LIBEVTX_CODEPAGE_WINDOWS_1258 };
+
+	int unsupported_codepages[ 17 ] = {
+		LIBEVTX_CODEPAGE_ISO_8859_1,
+		LIBEVTX_CODEPAGE_ISO_8859_2,
+		LIBEVTX_CODEPAGE_ISO_8859_3,
+		LIBEVTX_CODEPAGE_ISO_8859_4,
+		LIBEVTX_CODEPAGE_ISO_8859_5,
+		LIBEVTX_CODEPAGE_ISO_8859_6,
+		LIBEVTX_CODEPAGE_ISO_8859_7,
+		LIBEVTX_CODEPAGE_ISO_8859_8,
+		LIBEVTX_CODEPAGE_ISO_8859_9,
+		LIBEVTX_CODEPAGE_ISO_8859_10,
+		LIBEVTX_CODEPAGE_ISO_8859_11,
+		LIBEVTX_CODEPAGE_ISO_8859_13,
+		LIBEVTX_CODEPAGE_ISO_8859_14,
+		LIBEVTX_CODEPAGE_ISO_8859_15,
+		LIBEVTX_CODEPAGE_ISO_8859_16,
+		LIBEVTX_CODEPAGE_KOI8_R,
+		LIBEVTX_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = libevtx_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_set_ascii_codepage(
+	          NULL,
+	          LIBEVTX_CODEPAGE_ASCII,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = libevtx_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_file_set_ascii_codepage(
+	          file,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_validation_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_validation_mode(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int validation_mode      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_validation_mode(
+	          file,
+	          &validation_mode,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "validation_mode",
+	 validation_mode,
+	 LIBEVTX_VALIDATE_FULL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_validation_mode(
+	          NULL,
+	          &validation_mode,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_validation_mode(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_validation_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_validation_mode(
+     libevtx_file_t *file )
+{
+	int supported_validation_modes[ 4 ] = {
+		LIBEVTX_VALIDATE_FULL,
+		LIBEVTX_VALIDATE_NONE,
+		LIBEVTX_VALIDATE_HEADER_ONLY,
+		LIBEVTX_VALIDATE_ON_DEMAND };
+
+	libcerror_error_t *error = NULL;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set validation mode
+	 */
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libevtx_file_set_validation_mode(
+		          file,
+		          supported_validation_modes[ index ],
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_set_validation_mode(
+	          NULL,
+	          LIBEVTX_VALIDATE_FULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_validation_mode(
+	          file,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_set_validation_mode(
+	          file,
+	          LIBEVTX_VALIDATE_FULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_decode_depth function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_decode_depth(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int decode_depth         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_decode_depth(
+	          file,
+	          &decode_depth,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "decode_depth",
+	 decode_depth,
+	 LIBEVTX_DECODE_DEPTH_FULL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_decode_depth(
+	          NULL,
+	          &decode_depth,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_decode_depth(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_decode_depth function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_decode_depth(
+     libevtx_file_t *file )
+{
+	int supported_decode_depths[ 2 ] = {
+		LIBEVTX_DECODE_DEPTH_FULL,
+		LIBEVTX_DECODE_DEPTH_SYSTEM };
+
+	libcerror_error_t *error = NULL;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set decode depth
+	 */
+	for( index = 0;
+	     index < 2;
+	     index++ )
+	{
+		result = libevtx_file_set_decode_depth(
+		          file,
+		          supported_decode_depths[ index ],
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_set_decode_depth(
+	          NULL,
+	          LIBEVTX_DECODE_DEPTH_FULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_decode_depth(
+	          file,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_set_decode_depth(
+	          file,
+	          LIBEVTX_DECODE_DEPTH_FULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_iterate_order function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_iterate_order(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int iterate_order        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_iterate_order(
+	          file,
+	          &iterate_order,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "iterate_order",
+	 iterate_order,
+	 LIBEVTX_ITERATE_BY_CHUNK_OFFSET );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_iterate_order(
+	          NULL,
+	          &iterate_order,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_iterate_order(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_iterate_order function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_iterate_order(
+     libevtx_file_t *file )
+{
+	int supported_iterate_orders[ 2 ] = {
+		LIBEVTX_ITERATE_BY_CHUNK_OFFSET,
+		LIBEVTX_ITERATE_BY_RECORD_IDENTIFIER };
+
+	libcerror_error_t *error = NULL;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set iterate order
+	 */
+	for( index = 0;
+	     index < 2;
+	     index++ )
+	{
+		result = libevtx_file_set_iterate_order(
+		          file,
+		          supported_iterate_orders[ index ],
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_set_iterate_order(
+	          NULL,
+	          LIBEVTX_ITERATE_BY_CHUNK_OFFSET,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_iterate_order(
+	          file,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_set_iterate_order(
+	          file,
+	          LIBEVTX_ITERATE_BY_CHUNK_OFFSET,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_cache_limits function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_cache_limits(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error             = NULL;
+	size64_t maximum_cache_size          = 0;
+	int maximum_number_of_cached_chunks  = 0;
+	int maximum_number_of_cached_records = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_cache_limits(
+	          file,
+	          &maximum_number_of_cached_chunks,
+	          &maximum_number_of_cached_records,
+	          &maximum_cache_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_cached_chunks",
+	 maximum_number_of_cached_chunks,
+	 16 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_cached_records",
+	 maximum_number_of_cached_records,
+	 64 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_cache_size",
+	 (uint64_t) maximum_cache_size,
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_cache_limits(
+	          NULL,
+	          &maximum_number_of_cached_chunks,
+	          &maximum_number_of_cached_records,
+	          &maximum_cache_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_limits(
+	          file,
+	          NULL,
+	          &maximum_number_of_cached_records,
+	          &maximum_cache_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_limits(
+	          file,
+	          &maximum_number_of_cached_chunks,
+	          NULL,
+	          &maximum_cache_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_limits(
+	          file,
+	          &maximum_number_of_cached_chunks,
+	          &maximum_number_of_cached_records,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_cache_limits function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_cache_limits(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error    = NULL;
+	libevtx_file_t *closed_file = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_initialize(
+	          &closed_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file",
+	 closed_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_set_cache_limits(
+	          closed_file,
+	          256,
+	          1024,
+	          4 * 1024 * 1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_set_cache_limits(
+	          NULL,
+	          256,
+	          1024,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_cache_limits(
+	          closed_file,
+	          0,
+	          1024,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_cache_limits(
+	          closed_file,
+	          256,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The limits cannot be changed while the file is open
+	 */
+	result = libevtx_file_set_cache_limits(
+	          file,
+	          256,
+	          1024,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &closed_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "closed_file",
+	 closed_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file != NULL )
+	{
+		libevtx_file_free(
+		 &closed_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_number_of_threads(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_threads(
+	          file,
+	          &number_of_threads,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_number_of_threads(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_number_of_threads(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_set_number_of_threads(
+	          file,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_set_number_of_threads(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_number_of_threads(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_string_interning and libevtx_file_set_string_interning functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_string_interning(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_strings    = 0;
+	int result               = 0;
+	uint8_t string_interning = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_string_interning(
+	          file,
+	          &string_interning,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "string_interning",
+	 string_interning,
+	 0 );
+
+	result = libevtx_file_get_number_of_interned_strings(
+	          file,
+	          &number_of_strings,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_string_interning(
+	          NULL,
+	          &string_interning,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_string_interning(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test setting string interning of an open file
+	 */
+	result = libevtx_file_set_string_interning(
+	          file,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test retrieving an interned string when string interning is not enabled
+	 */
+	result = libevtx_file_get_utf8_interned_string_size(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_auto_tuning and libevtx_file_set_auto_tuning functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_auto_tuning(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	uint64_t chunk_decode_time = 0;
+	uint64_t chunk_read_time   = 0;
+	int result                 = 0;
+	uint8_t auto_tuning        = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_auto_tuning(
+	          file,
+	          &auto_tuning,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "auto_tuning",
+	 auto_tuning,
+	 0 );
+
+	/* The file was opened without auto tuning hence nothing was measured
+	 */
+	result = libevtx_file_get_tuning_measurements(
+	          file,
+	          &chunk_read_time,
+	          &chunk_decode_time,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_auto_tuning(
+	          NULL,
+	          &auto_tuning,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_auto_tuning(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_tuning_measurements(
+	          file,
+	          NULL,
+	          &chunk_decode_time,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test setting auto tuning of an open file
+	 */
+	result = libevtx_file_set_auto_tuning(
+	          file,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_flags(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t flags           = 0;
+	int flags_is_set         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_flags(
+	          file,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	flags_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( flags_is_set != 0 )
+	{
+		result = libevtx_file_get_flags(
+		          file,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_advise_sequential_access function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_advise_sequential_access(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_advise_sequential_access(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_advise_sequential_access(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_memory_usage(
+     libevtx_file_t *file )
+{
+	uint64_t values[ LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t memory_usage    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_memory_usage(
+	          file,
+	          &memory_usage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_memory_usage_values(
+	          file,
+	          values,
+	          LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_TOTAL ]",
+	 values[ LIBEVTX_MEMORY_USAGE_TOTAL ],
+	 memory_usage );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_memory_usage(
+	          NULL,
+	          &memory_usage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_memory_usage(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_memory_usage_values(
+	          file,
+	          NULL,
+	          LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_number_of_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_number_of_chunks(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	uint16_t number_of_chunks = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_chunks(
+	          file,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_number_of_chunks(
+	          NULL,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_number_of_chunks(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_chunk_information function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_chunk_information(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error                       = NULL;
+	libevtx_chunk_information_t *chunk_information = NULL;
+	off64_t file_offset                            = 0;
+	uint16_t number_of_chunks                      = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_chunks(
+	          file,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( number_of_chunks > 0 )
+	{
+		result = libevtx_file_get_chunk_information(
+		          file,
+		          0,
+		          &chunk_information,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "chunk_information",
+		 chunk_information );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_chunk_information_get_file_offset(
+		          chunk_information,
+		          &file_offset,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT64(
+		 "file_offset",
+		 (int64_t) file_offset,
+		 (int64_t) 4096 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_chunk_information_free(
+		          &chunk_information,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_get_chunk_information(
+	          NULL,
+	          0,
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_chunk_information(
+	          file,
+	          number_of_chunks,
+	          &chunk_information,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_chunk_information(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_information != NULL )
+	{
+		libevtx_chunk_information_free(
+		 &chunk_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_chunk_data(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	const uint8_t *chunk_data = NULL;
+	size_t chunk_data_size    = 0;
+	uint16_t number_of_chunks = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_chunks(
+	          file,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_chunks == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_chunk_data(
+	          file,
+	          0,
+	          &chunk_data,
+	          &chunk_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_data_size",
+	 (int) ( chunk_data_size >= 512 ),
+	 1 );
+
+	result = memory_compare(
+	          chunk_data,
+	          "ElfChnk",
+	          8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_chunk_data(
+	          NULL,
+	          0,
+	          &chunk_data,
+	          &chunk_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_chunks < UINT16_MAX )
+	{
+		result = libevtx_file_get_chunk_data(
+		          file,
+		          number_of_chunks,
+		          &chunk_data,
+		          &chunk_data_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libevtx_file_get_chunk_data(
+	          file,
+	          0,
+	          NULL,
+	          &chunk_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_chunk_data(
+	          file,
+	          0,
+	          &chunk_data,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_chunk_records_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_chunk_records_range(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	size_t string_length             = 0;
+	uint16_t chunk_index             = 0;
+	uint16_t number_of_chunks        = 0;
+	int first_record_index           = 0;
+	int number_of_chunk_records      = 0;
+	int number_of_ranged_records     = 0;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVTX_OPEN_READ_LAZY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_chunks(
+	          file,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The record ranges of the chunks are consecutive and cover all the records
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		result = libevtx_file_get_chunk_records_range(
+		          file,
+		          chunk_index,
+		          &first_record_index,
+		          &number_of_chunk_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "first_record_index",
+			 first_record_index,
+			 number_of_ranged_records );
+
+			number_of_ranged_records += number_of_chunk_records;
+		}
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranged_records",
+	 number_of_ranged_records,
+	 number_of_records );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_chunk_records_range(
+	          NULL,
+	          0,
+	          &first_record_index,
+	          &number_of_chunk_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_chunk_records_range(
+	          file,
+	          0,
+	          NULL,
+	          &number_of_chunk_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_chunk_records_range(
+	          file,
+	          0,
+	          &first_record_index,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_prefetch_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_prefetch_records(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_file_prefetch_records(
+	          file,
+	          0,
+	          number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test prefetch with a range that exceeds the number of records
+	 */
+	result = libevtx_file_prefetch_records(
+	          file,
+	          number_of_records - 1,
+	          number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_prefetch_records(
+	          NULL,
+	          0,
+	          number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_prefetch_records(
+	          file,
+	          -1,
+	          number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_prefetch_records(
+	          file,
+	          number_of_records,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_prefetch_records(
+	          file,
+	          0,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_pin_chunk and libevtx_file_unpin_chunk functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_pin_chunk(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	const uint8_t *chunk_data = NULL;
+	size_t chunk_data_size    = 0;
+	uint16_t number_of_chunks = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_chunks(
+	          file,
+	          &number_of_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_chunks == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_file_pin_chunk(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_pin_chunk(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_chunk_data(
+	          file,
+	          0,
+	          &chunk_data,
+	          &chunk_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          chunk_data,
+	          "ElfChnk",
+	          8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_file_unpin_chunk(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_unpin_chunk(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_unpin_chunk(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_pin_chunk(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_chunks < UINT16_MAX )
+	{
+		result = libevtx_file_pin_chunk(
+		          file,
+		          number_of_chunks,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libevtx_file_unpin_chunk(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_number_of_records(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	int number_of_records        = 0;
+	int number_of_records_is_set = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_records_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_records_is_set != 0 )
+	{
+		result = libevtx_file_get_number_of_records(
+		          file,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_record_by_index(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_record_t *record = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libevtx_record_free(
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_record_by_index(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          -1,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_records_by_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_records_by_range(
+     libevtx_file_t *file )
+{
+	libevtx_record_t *records[ 8 ];
+	libcerror_error_t *error    = NULL;
+	libevtx_record_t *record    = NULL;
+	uint64_t identifier         = 0;
+	uint64_t range_identifier   = 0;
+	int number_of_range_records = 0;
+	int number_of_records       = 0;
+	int range_index             = 0;
+	int result                  = 0;
+
+	for( range_index = 0;
+	     range_index < 8;
+	     range_index++ )
+	{
+		records[ range_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_range_records = ( number_of_records < 8 ) ? number_of_records : 8;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_records_by_range(
+	          file,
+	          0,
+	          number_of_range_records,
+	          records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < number_of_range_records;
+	     range_index++ )
+	{
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "records[ range_index ]",
+		 records[ range_index ] );
+
+		result = libevtx_record_get_identifier(
+		          records[ range_index ],
+		          &range_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          range_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "range_identifier",
+		 range_identifier,
+		 identifier );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &( records[ range_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_get_records_by_range(
+	          NULL,
+	          0,
+	          number_of_range_records,
+	          records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_records_by_range(
+	          file,
+	          -1,
+	          number_of_range_records,
+	          records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_records_by_range(
+	          file,
+	          0,
+	          number_of_records + 1,
+	          records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_records_by_range(
+	          file,
+	          0,
+	          number_of_range_records,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	for( range_index = 0;
+	     range_index < 8;
+	     range_index++ )
+	{
+		if( records[ range_index ] != NULL )
+		{
+			libevtx_record_free(
+			 &( records[ range_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_borrowed_record_by_index and libevtx_file_release_borrowed_record functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_borrowed_record_by_index(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error          = NULL;
+	libevtx_record_t *borrowed_record = NULL;
+	libevtx_record_t *record          = NULL;
+	uint64_t borrowed_identifier      = 0;
+	uint64_t identifier               = 0;
+	int number_of_records             = 0;
+	int record_index                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	for( record_index = 0;
+	     ( record_index < number_of_records ) && ( record_index < 8 );
+	     record_index++ )
+	{
+		result = libevtx_file_get_borrowed_record_by_index(
+		          file,
+		          record_index,
+		          &borrowed_record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "borrowed_record",
+		 borrowed_record );
+
+		result = libevtx_record_get_identifier(
+		          borrowed_record,
+		          &borrowed_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "borrowed_identifier",
+		 borrowed_identifier,
+		 identifier );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_record_free(
+	          &borrowed_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "borrowed_record",
+	 borrowed_record );
+
+	result = libevtx_file_release_borrowed_record(
+	          file,
+	          &borrowed_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "borrowed_record",
+	 borrowed_record );
+
+	result = libevtx_file_get_borrowed_record_by_index(
+	          NULL,
+	          0,
+	          &borrowed_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_borrowed_record_by_index(
+	          file,
+	          -1,
+	          &borrowed_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_borrowed_record_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	borrowed_record = (libevtx_record_t *) 0x12345678UL;
+
+	result = libevtx_file_get_borrowed_record_by_index(
+	          file,
+	          0,
+	          &borrowed_record,
+	          &error );
+
+	borrowed_record = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_release_borrowed_record(
+	          NULL,
+	          &borrowed_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_release_borrowed_record(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( borrowed_record != NULL )
+	{
+		libevtx_file_release_borrowed_record(
+		 file,
+		 &borrowed_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_seek_record_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_seek_record_by_identifier(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	libevtx_record_t *record   = NULL;
+	uint64_t identifier        = 0;
+	uint64_t record_identifier = 0;
+	int number_of_records      = 0;
+	int record_index           = 0;
+	int result                 = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          number_of_records - 1,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_seek_record_by_identifier(
+		          file,
+		          identifier,
+		          &record_index,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_GREATER_THAN_INT(
+		 "record_index",
+		 record_index,
+		 -1 );
+
+		EVTX_TEST_ASSERT_LESS_THAN_INT(
+		 "record_index",
+		 record_index,
+		 number_of_records );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &record_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "record_identifier",
+		 record_identifier,
+		 identifier );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_file_seek_record_by_identifier(
+	          file,
+	          (uint64_t) UINT64_MAX,
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_seek_record_by_identifier(
+	          NULL,
+	          0,
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_seek_record_by_identifier(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_record_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_record_by_identifier(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	libevtx_record_t *record   = NULL;
+	uint64_t identifier        = 0;
+	uint64_t record_identifier = 0;
+	int number_of_records      = 0;
+	int record_index           = 0;
+	int result                 = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index += ( number_of_records / 4 ) + 1 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_record_by_identifier(
+		          file,
+		          identifier,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &record_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "record_identifier",
+		 record_identifier,
+		 identifier );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_file_get_record_by_identifier(
+	          file,
+	          (uint64_t) UINT64_MAX,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_record_by_identifier(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_identifier(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_number_of_recovered_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_number_of_recovered_records(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error               = NULL;
+	int number_of_recovered_records        = 0;
+	int number_of_recovered_records_is_set = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_recovered_records_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_number_of_recovered_records(
+	          NULL,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_recovered_records_is_set != 0 )
+	{
+		result = libevtx_file_get_number_of_recovered_records(
+		          file,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_number_of_duplicate_recovered_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_number_of_duplicate_recovered_records(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_duplicate_recovered_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_records",
+	 number_of_records,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_number_of_duplicate_recovered_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_number_of_duplicate_recovered_records(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_number_of_identifier_gaps and libevtx_file_get_identifier_gap functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_number_of_identifier_gaps(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t first_identifier = 0;
+	uint64_t last_identifier  = 0;
+	uint8_t gap_type          = 0;
+	int number_of_gaps        = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_identifier_gaps(
+	          file,
+	          &number_of_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_gaps",
+	 number_of_gaps,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_gaps > 0 )
+	{
+		result = libevtx_file_get_identifier_gap(
+		          file,
+		          0,
+		          &gap_type,
+		          &first_identifier,
+		          &last_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_get_number_of_identifier_gaps(
+	          NULL,
+	          &number_of_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_number_of_identifier_gaps(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_identifier_gap(
+	          NULL,
+	          0,
+	          &gap_type,
+	          &first_identifier,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_identifier_gap(
+	          file,
+	          number_of_gaps,
+	          &gap_type,
+	          &first_identifier,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_recovered_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_recovered_record_by_index(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error           = NULL;
+	libevtx_record_t *recovered_record = 0;
+	int number_of_recovered_records    = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_recovered_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_recovered_record_by_index(
+	          file,
+	          0,
+	          &recovered_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	result = libevtx_record_free(
+	          &recovered_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_recovered_record_by_index(
+	          NULL,
+	          0,
+	          &recovered_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_recovered_record_by_index(
+	          file,
+	          -1,
+	          &recovered_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_recovered_record_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_refresh(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error        = NULL;
+	int number_of_records           = 0;
+	int refreshed_number_of_records = 0;
+	int result                      = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &refreshed_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "refreshed_number_of_records",
+	 refreshed_number_of_records,
+	 number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_refresh(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Counts the results passed by libevtx_file_verify
+ * The verification is stopped when the count reaches 0, i.e. after the file header if the count starts at -1
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int evtx_test_file_verify_callback(
+     int chunk_index,
+     off64_t file_offset,
+     uint32_t verify_result_flags EVTX_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	int *number_of_results = (int *) user_data;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( verify_result_flags )
+
+	if( ( chunk_index < -1 )
+	 || ( file_offset < 0 )
+	 || ( number_of_results == NULL ) )
+	{
+		return( -1 );
+	}
+	*number_of_results += 1;
+
+	if( *number_of_results == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libevtx_file_verify function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_verify(
      libevtx_file_t *file )
 {
-	int supported_codepages[ 15 ] = {
-		LIBEVTX_CODEPAGE_ASCII,
-		LIBEVTX_CODEPAGE_WINDOWS_874,
-		LIBEVTX_CODEPAGE_WINDOWS_932,
-		LIBEVTX_CODEPAGE_WINDOWS_936,
-		LIBEVTX_CODEPAGE_WINDOWS_949,
-		LIBEVTX_CODEPAGE_WINDOWS_950,
-		LIBEVTX_CODEPAGE_WINDOWS_1250,
-		LIBEVTX_CODEPAGE_WINDOWS_1251,
-		LIBEVTX_CODEPAGE_WINDOWS_1252,
-		LIBEVTX_CODEPAGE_WINDOWS_1253,
-		LIBEVTX_CODEPAGE_WINDOWS_1254,
-		LIBEVTX_CODEPAGE_WINDOWS_1255,
-		LIBEVTX_CODEPAGE_WINDOWS_1256,
-		LIBEVTX_CODEPAGE_WINDOWS_1257,
-		LIBEVTX_CODEPAGE_WINDOWS_1258 };
+	libcerror_error_t *error = NULL;
+	int number_of_results    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_verify(
+	          file,
+	          0,
+	          &evtx_test_file_verify_callback,
+	          (void *) &number_of_results,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_verify(
+	          file,
+	          LIBEVTX_VERIFY_FLAG_STOP_ON_FAILURE,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping the verification from the callback
+	 */
+	number_of_results = -1;
+
+	result = libevtx_file_verify(
+	          file,
+	          0,
+	          &evtx_test_file_verify_callback,
+	          (void *) &number_of_results,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_verify(
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_verify(
+	          file,
+	          0xff,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the callback returning an error
+	 */
+	result = libevtx_file_verify(
+	          file,
+	          0,
+	          &evtx_test_file_verify_callback,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Counts the records passed by libevtx_file_iterate_records
+ * The iteration is stopped when the count reaches 0, i.e. after the first record if the count starts at -1
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int evtx_test_file_iterate_records_callback(
+     libevtx_record_t *record,
+     void *user_data )
+{
+	int *number_of_records = (int *) user_data;
+
+	if( ( record == NULL )
+	 || ( number_of_records == NULL ) )
+	{
+		return( -1 );
+	}
+	*number_of_records += 1;
+
+	if( *number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libevtx_file_iterate_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_iterate_records(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int iterated_records     = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_iterate_records(
+	          file,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	int unsupported_codepages[ 17 ] = {
-		LIBEVTX_CODEPAGE_ISO_8859_1,
-		LIBEVTX_CODEPAGE_ISO_8859_2,
-		LIBEVTX_CODEPAGE_ISO_8859_3,
-		LIBEVTX_CODEPAGE_ISO_8859_4,
-		LIBEVTX_CODEPAGE_ISO_8859_5,
-		LIBEVTX_CODEPAGE_ISO_8859_6,
-		LIBEVTX_CODEPAGE_ISO_8859_7,
-		LIBEVTX_CODEPAGE_ISO_8859_8,
-		LIBEVTX_CODEPAGE_ISO_8859_9,
-		LIBEVTX_CODEPAGE_ISO_8859_10,
-		LIBEVTX_CODEPAGE_ISO_8859_11,
-		LIBEVTX_CODEPAGE_ISO_8859_13,
-		LIBEVTX_CODEPAGE_ISO_8859_14,
-		LIBEVTX_CODEPAGE_ISO_8859_15,
-		LIBEVTX_CODEPAGE_ISO_8859_16,
-		LIBEVTX_CODEPAGE_KOI8_R,
-		LIBEVTX_CODEPAGE_KOI8_U };
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "iterated_records",
+	 iterated_records,
+	 number_of_records );
 
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test set ASCII codepage
+	/* Test stopping the iteration from the callback
 	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
+	if( number_of_records > 0 )
 	{
-		codepage = supported_codepages[ index ];
+		iterated_records = -1;
 
-		result = libevtx_file_set_ascii_codepage(
+		result = libevtx_file_iterate_records(
 		          file,
-		          codepage,
+		          &evtx_test_file_iterate_records_callback,
+		          (void *) &iterated_records,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 1 );
+		 0 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "iterated_records",
+		 iterated_records,
+		 0 );
 
 		EVTX_TEST_ASSERT_IS_NULL(
 		 "error",
@@ -1383,9 +8832,10 @@ int evtx_test_file_set_ascii_codepage(
 	}
 	/* Test error cases
 	 */
-	result = libevtx_file_set_ascii_codepage(
+	result = libevtx_file_iterate_records(
 	          NULL,
-	          LIBEVTX_CODEPAGE_ASCII,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1400,15 +8850,32 @@ int evtx_test_file_set_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
-	{
-		codepage = unsupported_codepages[ index ];
+	result = libevtx_file_iterate_records(
+	          file,
+	          NULL,
+	          (void *) &iterated_records,
+	          &error );
 
-		result = libevtx_file_set_ascii_codepage(
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the callback returning an error
+	 */
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_iterate_records(
 		          file,
-		          codepage,
+		          &evtx_test_file_iterate_records_callback,
+		          NULL,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1423,11 +8890,117 @@ int evtx_test_file_set_ascii_codepage(
 		libcerror_error_free(
 		 &error );
 	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Checks that the records passed by libevtx_file_iterate_records are in ascending identifier order
+ * The user data contains the last identifier and the number of records
+ * Returns 1 to continue or -1 on error
+ */
+int evtx_test_file_iterate_records_by_record_identifier_callback(
+     libevtx_record_t *record,
+     void *user_data )
+{
+	uint64_t *values    = (uint64_t *) user_data;
+	uint64_t identifier = 0;
+
+	if( ( record == NULL )
+	 || ( values == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libevtx_record_get_identifier(
+	     record,
+	     &identifier,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( ( values[ 1 ] > 0 )
+	 && ( identifier <= values[ 0 ] ) )
+	{
+		return( -1 );
+	}
+	values[ 0 ] = identifier;
+	values[ 1 ] += 1;
+
+	return( 1 );
+}
+
+/* Tests the libevtx_file_iterate_records function with LIBEVTX_ITERATE_BY_RECORD_IDENTIFIER
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_iterate_records_by_record_identifier(
+     libevtx_file_t *file )
+{
+	uint64_t values[ 2 ]     = { 0, 0 };
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_set_iterate_order(
+	          file,
+	          LIBEVTX_ITERATE_BY_RECORD_IDENTIFIER,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_iterate_records(
+	          file,
+	          &evtx_test_file_iterate_records_by_record_identifier_callback,
+	          (void *) values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_iterated_records",
+	 values[ 1 ],
+	 (uint64_t) number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Clean up
 	 */
-	result = libevtx_file_set_ascii_codepage(
+	result = libevtx_file_set_iterate_order(
 	          file,
-	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          LIBEVTX_ITERATE_BY_CHUNK_OFFSET,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1447,121 +9020,167 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	libevtx_file_set_iterate_order(
+	 file,
+	 LIBEVTX_ITERATE_BY_CHUNK_OFFSET,
+	 NULL );
+
 	return( 0 );
 }
 
-/* Tests the libevtx_file_get_flags function
+/* Tests the libevtx_file_iterate_records_in_time_range function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_get_flags(
+int evtx_test_file_iterate_records_in_time_range(
      libevtx_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	uint32_t flags           = 0;
-	int flags_is_set         = 0;
+	libevtx_record_t *record = NULL;
+	uint64_t written_time    = 0;
+	int iterated_records     = 0;
+	int number_of_records    = 0;
 	int result               = 0;
 
-	/* Test regular cases
-	 */
-	result = libevtx_file_get_flags(
+	result = libevtx_file_get_number_of_records(
 	          file,
-	          &flags,
+	          &number_of_records,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	flags_is_set = result;
-
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libevtx_file_get_flags(
-	          NULL,
-	          &flags,
+	result = libevtx_file_iterate_records_in_time_range(
+	          file,
+	          0,
+	          (uint64_t) UINT64_MAX,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "iterated_records",
+	 iterated_records,
+	 number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	if( flags_is_set != 0 )
+	if( number_of_records > 0 )
 	{
-		result = libevtx_file_get_flags(
+		result = libevtx_file_get_record_by_index(
 		          file,
-		          NULL,
+		          0,
+		          &record,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
 		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+		result = libevtx_record_get_written_time(
+		          record,
+		          &written_time,
+		          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-/* Tests the libevtx_file_get_number_of_records function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_get_number_of_records(
-     libevtx_file_t *file )
-{
-	libcerror_error_t *error     = NULL;
-	int number_of_records        = 0;
-	int number_of_records_is_set = 0;
-	int result                   = 0;
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test regular cases
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The range of a single written time contains at least the first record
+		 */
+		iterated_records = 0;
+
+		result = libevtx_file_iterate_records_in_time_range(
+		          file,
+		          written_time,
+		          written_time,
+		          &evtx_test_file_iterate_records_callback,
+		          (void *) &iterated_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_GREATER_THAN_INT(
+		 "iterated_records",
+		 iterated_records,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
 	 */
-	result = libevtx_file_get_number_of_records(
-	          file,
-	          &number_of_records,
+	result = libevtx_file_iterate_records_in_time_range(
+	          NULL,
+	          0,
+	          (uint64_t) UINT64_MAX,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	number_of_records_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libevtx_file_get_number_of_records(
-	          NULL,
-	          &number_of_records,
+	result = libevtx_file_iterate_records_in_time_range(
+	          file,
+	          1,
+	          0,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1576,25 +9195,6 @@ int evtx_test_file_get_number_of_records(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_records_is_set != 0 )
-	{
-		result = libevtx_file_get_number_of_records(
-		          file,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1603,63 +9203,67 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevtx_file_get_record_by_index function
+/* Tests the libevtx_file_iterate_records_with_filter function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_get_record_by_index(
+int evtx_test_file_iterate_records_with_filter(
      libevtx_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	libevtx_record_t *record = 0;
-	int number_of_records    = 0;
-	int result               = 0;
+	libcerror_error_t *error               = NULL;
+	libevtx_record_t *record               = NULL;
+	libevtx_record_filter_t *record_filter = NULL;
+	uint32_t event_identifier              = 0;
+	int iterated_records                   = 0;
+	int number_of_records                  = 0;
+	int result                             = 0;
 
-	/* Initialize test
-	 */
 	result = libevtx_file_get_number_of_records(
 	          file,
 	          &number_of_records,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( number_of_records == 0 )
-	{
-		return( 1 );
-	}
-	/* Test regular cases
-	 */
-	result = libevtx_file_get_record_by_index(
-	          file,
-	          0,
-	          &record,
+	result = libevtx_record_filter_initialize(
+	          &record_filter,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
-	 "record",
-	 record );
-
-	result = libevtx_record_free(
-	          &record,
+	/* Test regular cases
+	 */
+	result = libevtx_file_iterate_records_with_filter(
+	          file,
+	          record_filter,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1667,16 +9271,109 @@ int evtx_test_file_get_record_by_index(
 	 result,
 	 1 );
 
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "iterated_records",
+	 iterated_records,
+	 number_of_records );
+
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          0,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_event_identifier(
+		          record,
+		          &event_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_filter_append_event_identifier(
+		          record_filter,
+		          event_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The event identifier of the first record matches at least the first record
+		 */
+		iterated_records = 0;
+
+		result = libevtx_file_iterate_records_with_filter(
+		          file,
+		          record_filter,
+		          &evtx_test_file_iterate_records_callback,
+		          (void *) &iterated_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_GREATER_THAN_INT(
+		 "iterated_records",
+		 iterated_records,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Test error cases
 	 */
-	result = libevtx_file_get_record_by_index(
+	result = libevtx_file_iterate_records_with_filter(
 	          NULL,
-	          0,
-	          &record,
+	          record_filter,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1684,10 +9381,6 @@ int evtx_test_file_get_record_by_index(
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1695,10 +9388,11 @@ int evtx_test_file_get_record_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_record_by_index(
+	result = libevtx_file_iterate_records_with_filter(
 	          file,
-	          -1,
-	          &record,
+	          NULL,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1706,10 +9400,6 @@ int evtx_test_file_get_record_by_index(
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1717,28 +9407,21 @@ int evtx_test_file_get_record_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_record_by_index(
-	          file,
-	          0,
-	          NULL,
+	/* Clean up
+	 */
+	result = libevtx_record_filter_free(
+	          &record_filter,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1747,158 +9430,219 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( record_filter != NULL )
+	{
+		libevtx_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevtx_file_get_number_of_recovered_records function
+/* Tests the libevtx_file_query function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_get_number_of_recovered_records(
+int evtx_test_file_query(
      libevtx_file_t *file )
 {
 	libcerror_error_t *error               = NULL;
-	int number_of_recovered_records        = 0;
-	int number_of_recovered_records_is_set = 0;
+	libevtx_record_t *record               = NULL;
+	libevtx_record_filter_t *record_filter = NULL;
+	uint32_t event_identifier              = 0;
+	int filtered_records                   = 0;
+	int iterated_records                   = 0;
+	int number_of_records                  = 0;
 	int result                             = 0;
 
-	/* Test regular cases
-	 */
-	result = libevtx_file_get_number_of_recovered_records(
+	result = libevtx_file_get_number_of_records(
 	          file,
-	          &number_of_recovered_records,
+	          &number_of_records,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_recovered_records_is_set = result;
+	result = libevtx_record_filter_initialize(
+	          &record_filter,
+	          &error );
 
-	/* Test error cases
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	result = libevtx_file_get_number_of_recovered_records(
-	          NULL,
-	          &number_of_recovered_records,
+	result = libevtx_file_query(
+	          file,
+	          record_filter,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "iterated_records",
+	 iterated_records,
+	 number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          0,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_event_identifier(
+		          record,
+		          &event_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_filter_append_event_identifier(
+		          record_filter,
+		          event_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	if( number_of_recovered_records_is_set != 0 )
-	{
-		result = libevtx_file_get_number_of_recovered_records(
+		/* The query index returns the same records as a filtered iteration
+		 */
+		result = libevtx_file_iterate_records_with_filter(
 		          file,
-		          NULL,
+		          record_filter,
+		          &evtx_test_file_iterate_records_callback,
+		          (void *) &filtered_records,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		EVTX_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libevtx_file_get_recovered_record_by_index function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_get_recovered_record_by_index(
-     libevtx_file_t *file )
-{
-	libcerror_error_t *error           = NULL;
-	libevtx_record_t *recovered_record = 0;
-	int number_of_recovered_records    = 0;
-	int result                         = 0;
+		iterated_records = 0;
 
-	/* Initialize test
-	 */
-	result = libevtx_file_get_number_of_recovered_records(
-	          file,
-	          &number_of_recovered_records,
-	          &error );
+		result = libevtx_file_query(
+		          file,
+		          record_filter,
+		          &evtx_test_file_iterate_records_callback,
+		          (void *) &iterated_records,
+		          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "iterated_records",
+		 iterated_records,
+		 filtered_records );
 
-	if( number_of_recovered_records == 0 )
-	{
-		return( 1 );
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 	}
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libevtx_file_get_recovered_record_by_index(
-	          file,
-	          0,
-	          &recovered_record,
+	result = libevtx_file_query(
+	          NULL,
+	          record_filter,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
-	 "recovered_record",
-	 recovered_record );
-
-	result = libevtx_record_free(
-	          &recovered_record,
-	          &error );
-
-	EVTX_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libevtx_file_get_recovered_record_by_index(
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_query(
+	          file,
 	          NULL,
-	          0,
-	          &recovered_record,
+	          &evtx_test_file_iterate_records_callback,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1906,10 +9650,6 @@ int evtx_test_file_get_recovered_record_by_index(
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "recovered_record",
-	 recovered_record );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1917,10 +9657,11 @@ int evtx_test_file_get_recovered_record_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_recovered_record_by_index(
+	result = libevtx_file_query(
 	          file,
-	          -1,
-	          &recovered_record,
+	          record_filter,
+	          NULL,
+	          (void *) &iterated_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1928,10 +9669,6 @@ int evtx_test_file_get_recovered_record_by_index(
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "recovered_record",
-	 recovered_record );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1939,28 +9676,21 @@ int evtx_test_file_get_recovered_record_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_recovered_record_by_index(
-	          file,
-	          0,
-	          NULL,
+	/* Clean up
+	 */
+	result = libevtx_record_filter_free(
+	          &record_filter,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
-	 "recovered_record",
-	 recovered_record );
-
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1969,6 +9699,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( record_filter != NULL )
+	{
+		libevtx_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2108,6 +9850,51 @@ int main(
 		 evtx_test_file_open_file_io_handle,
 		 source );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_memory",
+		 evtx_test_file_open_memory,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_thread_safe",
+		 evtx_test_file_open_thread_safe,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_recovered",
+		 evtx_test_file_open_recovered,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_live",
+		 evtx_test_file_open_live,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_progress_callback",
+		 evtx_test_file_open_progress,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_deferred_recovery",
+		 evtx_test_file_open_deferred_recovery,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_header_only",
+		 evtx_test_file_open_header_only,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_transcode_xml",
+		 evtx_test_file_open_transcode_xml,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_partition",
+		 evtx_test_file_open_partition,
+		 source );
+
 		EVTX_TEST_RUN(
 		 "libevtx_file_close",
 		 evtx_test_file_close );
@@ -2122,6 +9909,7 @@ int main(
 		result = evtx_test_file_open_source(
 		          &file,
 		          file_io_handle,
+		          LIBEVTX_OPEN_READ,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
@@ -2150,6 +9938,11 @@ int main(
 
 		/* TODO: add tests for libevtx_file_is_corrupted */
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_verify",
+		 evtx_test_file_verify,
+		 file );
+
 		EVTX_TEST_RUN_WITH_ARGS(
 		 "libevtx_file_get_ascii_codepage",
 		 evtx_test_file_get_ascii_codepage,
@@ -2160,6 +9953,66 @@ int main(
 		 evtx_test_file_set_ascii_codepage,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_validation_mode",
+		 evtx_test_file_get_validation_mode,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_validation_mode",
+		 evtx_test_file_set_validation_mode,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_decode_depth",
+		 evtx_test_file_get_decode_depth,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_decode_depth",
+		 evtx_test_file_set_decode_depth,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_iterate_order",
+		 evtx_test_file_get_iterate_order,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_iterate_order",
+		 evtx_test_file_set_iterate_order,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_cache_limits",
+		 evtx_test_file_get_cache_limits,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_cache_limits",
+		 evtx_test_file_set_cache_limits,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_number_of_threads",
+		 evtx_test_file_get_number_of_threads,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_number_of_threads",
+		 evtx_test_file_set_number_of_threads,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_string_interning",
+		 evtx_test_file_get_string_interning,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_auto_tuning",
+		 evtx_test_file_get_auto_tuning,
+		 file );
+
 		/* TODO: add tests for libevtx_file_get_format_version */
 
 		/* TODO: add tests for libevtx_file_get_version */
@@ -2169,21 +10022,121 @@ int main(
 		 evtx_test_file_get_flags,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_advise_sequential_access",
+		 evtx_test_file_advise_sequential_access,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_memory_usage",
+		 evtx_test_file_get_memory_usage,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_number_of_chunks",
+		 evtx_test_file_get_number_of_chunks,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_chunk_information",
+		 evtx_test_file_get_chunk_information,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_chunk_data",
+		 evtx_test_file_get_chunk_data,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_chunk_records_range",
+		 evtx_test_file_get_chunk_records_range,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_pin_chunk",
+		 evtx_test_file_pin_chunk,
+		 file );
+
 		EVTX_TEST_RUN_WITH_ARGS(
 		 "libevtx_file_get_number_of_records",
 		 evtx_test_file_get_number_of_records,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_prefetch_records",
+		 evtx_test_file_prefetch_records,
+		 file );
+
 		EVTX_TEST_RUN_WITH_ARGS(
 		 "libevtx_file_get_record_by_index",
 		 evtx_test_file_get_record_by_index,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_records_by_range",
+		 evtx_test_file_get_records_by_range,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_borrowed_record_by_index",
+		 evtx_test_file_get_borrowed_record_by_index,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_seek_record_by_identifier",
+		 evtx_test_file_seek_record_by_identifier,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_record_by_identifier",
+		 evtx_test_file_get_record_by_identifier,
+		 file );
+
 		EVTX_TEST_RUN_WITH_ARGS(
 		 "libevtx_file_get_number_of_recovered_records",
 		 evtx_test_file_get_number_of_recovered_records,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_number_of_identifier_gaps",
+		 evtx_test_file_get_number_of_identifier_gaps,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_number_of_duplicate_recovered_records",
+		 evtx_test_file_get_number_of_duplicate_recovered_records,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_refresh",
+		 evtx_test_file_refresh,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_iterate_records",
+		 evtx_test_file_iterate_records,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_iterate_records_by_record_identifier",
+		 evtx_test_file_iterate_records_by_record_identifier,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_iterate_records_in_time_range",
+		 evtx_test_file_iterate_records_in_time_range,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_iterate_records_with_filter",
+		 evtx_test_file_iterate_records_with_filter,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_query",
+		 evtx_test_file_query,
+		 file );
+
 #if defined( TODO )
 
 		EVTX_TEST_RUN_WITH_ARGS(
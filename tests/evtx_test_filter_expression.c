@@ -0,0 +1,688 @@
+/*
+ * Library filter_expression functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_filter_expression.h"
+#include "../libevtx/libevtx_record_values.h"
+#include "../libevtx/libevtx_system_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* 2018-01-01T00:00:00Z as a FILETIME
+ */
+#define EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME	131592384000000000UL
+
+/* Security as an UTF-16 little-endian stream
+ */
+uint8_t evtx_test_filter_expression_channel_name[ 16 ] = {
+	0x53, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00, 0x79, 0x00 };
+
+/* Compiles an expression and evaluates it with the record values
+ * Returns 1 if the record values match, 0 if not or -1 on error
+ */
+int evtx_test_filter_expression_compile_and_evaluate(
+     const char *string,
+     libevtx_record_values_t *record_values )
+{
+	libevtx_filter_expression_t *expression = NULL;
+	int result                              = -1;
+
+	if( libevtx_filter_expression_initialize(
+	     &expression,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libevtx_filter_expression_compile(
+	     expression,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME,
+	     NULL ) == 1 )
+	{
+		result = libevtx_filter_expression_evaluate(
+		          expression,
+		          record_values,
+		          NULL,
+		          NULL );
+	}
+	libevtx_filter_expression_free(
+	 &expression,
+	 NULL );
+
+	return( result );
+}
+
+/* Tests the libevtx_filter_expression_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_filter_expression_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libevtx_filter_expression_t *expression = NULL;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_filter_expression_initialize(
+	          &expression,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "expression",
+	 expression );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_filter_expression_free(
+	          &expression,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "expression",
+	 expression );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_filter_expression_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expression != NULL )
+	{
+		libevtx_filter_expression_free(
+		 &expression,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_filter_expression_compile function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_filter_expression_compile(
+     void )
+{
+	const char *unsupported_expressions[ 12 ] = {
+		"*[System[EventID=]]",
+		"*[System[EventID=4624]",
+		"*[System[EventID=4624]] and",
+		"*[System[Task=1]]",
+		"*[System[Channel<'Security']]",
+		"*[System[Channel=Security]]",
+		"*[System[Channel='Security]]",
+		"*[System[TimeCreated[@SystemTime>='2018-13-01T00:00:00Z']]]",
+		"*[System[Provider[@Guid='invalid']]]",
+		"*[EventData[Data[@Name='LogonType']>'10']]",
+		"*[System[EventID=18446744073709551616]]",
+		"*[System[not(EventID=4624]]" };
+
+	libcerror_error_t *error                = NULL;
+	libevtx_filter_expression_t *expression = NULL;
+	const char *string                      = NULL;
+	int expression_index                    = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_filter_expression_initialize(
+	          &expression,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "expression",
+	 expression );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string = "*[System[(EventID=4624 or EventID=4625) and Level &lt;= 4]]";
+
+	result = libevtx_filter_expression_compile(
+	          expression,
+	          (uint8_t *) string,
+	          narrow_string_length(
+	           string ),
+	          EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "expression->number_of_instructions",
+	 expression->number_of_instructions,
+	 5 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "expression->flags",
+	 expression->flags,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_filter_expression_compile(
+	          expression,
+	          (uint8_t *) string,
+	          narrow_string_length(
+	           string ),
+	          EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_filter_expression_free(
+	          &expression,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a expression that requires the XML document
+	 */
+	result = libevtx_filter_expression_initialize(
+	          &expression,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	string = "Event[System[Provider[@Name='Microsoft-Windows-Security-Auditing']] and EventData[Data[@Name='LogonType']='10']]";
+
+	result = libevtx_filter_expression_compile(
+	          expression,
+	          (uint8_t *) string,
+	          narrow_string_length(
+	           string ),
+	          EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "expression->number_of_instructions",
+	 expression->number_of_instructions,
+	 3 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "expression->flags",
+	 expression->flags,
+	 LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_XML_DOCUMENT | LIBEVTX_FILTER_EXPRESSION_FLAG_REQUIRES_EVENT_DATA );
+
+	result = libevtx_filter_expression_free(
+	          &expression,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test unsupported expressions
+	 */
+	for( expression_index = 0;
+	     expression_index < 12;
+	     expression_index++ )
+	{
+		result = libevtx_filter_expression_initialize(
+		          &expression,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		string = unsupported_expressions[ expression_index ];
+
+		result = libevtx_filter_expression_compile(
+		          expression,
+		          (uint8_t *) string,
+		          narrow_string_length(
+		           string ),
+		          EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "expression->number_of_instructions",
+		 expression->number_of_instructions,
+		 0 );
+
+		result = libevtx_filter_expression_free(
+		          &expression,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libevtx_filter_expression_compile(
+	          NULL,
+	          (uint8_t *) string,
+	          narrow_string_length(
+	           string ),
+	          EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expression != NULL )
+	{
+		libevtx_filter_expression_free(
+		 &expression,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_filter_parser_parse_date_time function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_filter_parser_parse_date_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_filter_parser_parse_date_time(
+	          (uint8_t *) "2018-03-01T12:34:56.5Z",
+	          22,
+	          &filetime,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 131643812965000000UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_filter_parser_parse_date_time(
+	          (uint8_t *) "2000-02-29T23:59:59",
+	          19,
+	          &filetime,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 125963423990000000UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_filter_parser_parse_date_time(
+	          (uint8_t *) "2018-03-01 12:34:56",
+	          19,
+	          &filetime,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_filter_parser_parse_date_time(
+	          NULL,
+	          19,
+	          &filetime,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_filter_expression_evaluate function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_filter_expression_evaluate(
+     void )
+{
+	libevtx_record_values_t record_values;
+
+	int result = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &record_values,
+	 0,
+	 sizeof( libevtx_record_values_t ) );
+
+	record_values.identifier                       = 1234;
+	record_values.written_time                     = EVTX_TEST_FILTER_EXPRESSION_CURRENT_TIME - 36000000000UL;
+	record_values.system_values_read               = 1;
+	record_values.system_values.event_identifier   = 4625;
+	record_values.system_values.event_level        = 4;
+	record_values.system_values.channel_name       = evtx_test_filter_expression_channel_name;
+	record_values.system_values.channel_name_size  = 16;
+	record_values.system_values.flags              = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER
+	                                               | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL
+	                                               | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME;
+
+	/* Test regular cases
+	 */
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[System[(EventID=4624 or EventID=4625) and Level<=4]]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[System[EventID=4624 or not(Level=4)]]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[System[Channel='security' and EventRecordID &gt; 1000]]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "System[Channel!='Security']",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The record was written 1 hour before the current time
+	 */
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[System[TimeCreated[timediff(@SystemTime) <= 7200000]]]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[System[TimeCreated[timediff(@SystemTime) <= 1800000]]]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[System[TimeCreated[@SystemTime>='2017-12-31T22:00:00Z' and @SystemTime<'2017-12-31T23:30:00.000Z']]]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Values that are not in the System values do not match
+	 */
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[System[Computer='WKS-01']]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = evtx_test_filter_expression_compile_and_evaluate(
+	          "*[EventData[Data='10']]",
+	          &record_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_filter_expression_initialize",
+	 evtx_test_filter_expression_initialize );
+
+	/* TODO: add tests for libevtx_filter_expression_append_instruction */
+
+	EVTX_TEST_RUN(
+	 "libevtx_filter_expression_compile",
+	 evtx_test_filter_expression_compile );
+
+	EVTX_TEST_RUN(
+	 "libevtx_filter_parser_parse_date_time",
+	 evtx_test_filter_parser_parse_date_time );
+
+	EVTX_TEST_RUN(
+	 "libevtx_filter_expression_evaluate",
+	 evtx_test_filter_expression_evaluate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
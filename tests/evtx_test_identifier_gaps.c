@@ -0,0 +1,849 @@
+/*
+ * Library identifier_gaps type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_identifier_gaps.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_identifier_gaps_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_identifier_gaps_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libevtx_identifier_gaps_t *identifier_gaps = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_identifier_gaps_initialize(
+	          &identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_gaps",
+	 identifier_gaps );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_identifier_gaps_free(
+	          &identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "identifier_gaps",
+	 identifier_gaps );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_identifier_gaps_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	identifier_gaps = (libevtx_identifier_gaps_t *) 0x12345678UL;
+
+	result = libevtx_identifier_gaps_initialize(
+	          &identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	identifier_gaps = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_identifier_gaps_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_identifier_gaps_initialize(
+		          &identifier_gaps,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( identifier_gaps != NULL )
+			{
+				libevtx_identifier_gaps_free(
+				 &identifier_gaps,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "identifier_gaps",
+			 identifier_gaps );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_identifier_gaps_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_identifier_gaps_initialize(
+		          &identifier_gaps,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( identifier_gaps != NULL )
+			{
+				libevtx_identifier_gaps_free(
+				 &identifier_gaps,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "identifier_gaps",
+			 identifier_gaps );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_gaps != NULL )
+	{
+		libevtx_identifier_gaps_free(
+		 &identifier_gaps,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_identifier_gaps_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_identifier_gaps_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_identifier_gaps_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Appends record identifiers to identifier gaps
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_identifier_gaps_append_identifiers(
+     libevtx_identifier_gaps_t *identifier_gaps,
+     const uint64_t *identifiers,
+     int number_of_identifiers )
+{
+	libcerror_error_t *error = NULL;
+	int identifier_index     = 0;
+	int result               = 0;
+
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		result = libevtx_identifier_gaps_append_identifier(
+		          identifier_gaps,
+		          identifiers[ identifier_index ],
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_identifier_gaps_append_identifier and libevtx_identifier_gaps_get_gap functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_identifier_gaps_append_identifier(
+     void )
+{
+	uint64_t identifiers[ 5 ]                  = { 1, 2, 5, 5, 3 };
+	uint8_t expected_gap_types[ 3 ]            = {
+		LIBEVTX_IDENTIFIER_GAP_TYPE_MISSING,
+		LIBEVTX_IDENTIFIER_GAP_TYPE_DUPLICATE,
+		LIBEVTX_IDENTIFIER_GAP_TYPE_OUT_OF_ORDER };
+	uint64_t expected_first_identifiers[ 3 ]   = { 3, 5, 3 };
+	uint64_t expected_last_identifiers[ 3 ]    = { 4, 5, 5 };
+	libcerror_error_t *error                   = NULL;
+	libevtx_identifier_gaps_t *identifier_gaps = NULL;
+	uint64_t first_identifier                  = 0;
+	uint64_t last_identifier                   = 0;
+	uint8_t gap_type                           = 0;
+	int gap_index                              = 0;
+	int number_of_gaps                         = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_identifier_gaps_initialize(
+	          &identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_gaps",
+	 identifier_gaps );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = evtx_test_identifier_gaps_append_identifiers(
+	          identifier_gaps,
+	          identifiers,
+	          5 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_identifier_gaps_finalize(
+	          identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_identifier_gaps_get_number_of_gaps(
+	          identifier_gaps,
+	          &number_of_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_gaps",
+	 number_of_gaps,
+	 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( gap_index = 0;
+	     gap_index < 3;
+	     gap_index++ )
+	{
+		result = libevtx_identifier_gaps_get_gap(
+		          identifier_gaps,
+		          gap_index,
+		          &gap_type,
+		          &first_identifier,
+		          &last_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "gap_type",
+		 gap_type,
+		 expected_gap_types[ gap_index ] );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "first_identifier",
+		 first_identifier,
+		 expected_first_identifiers[ gap_index ] );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "last_identifier",
+		 last_identifier,
+		 expected_last_identifiers[ gap_index ] );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_identifier_gaps_append_identifier(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_identifier_gaps_get_number_of_gaps(
+	          NULL,
+	          &number_of_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_identifier_gaps_get_number_of_gaps(
+	          identifier_gaps,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_identifier_gaps_get_gap(
+	          NULL,
+	          0,
+	          &gap_type,
+	          &first_identifier,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_identifier_gaps_get_gap(
+	          identifier_gaps,
+	          3,
+	          &gap_type,
+	          &first_identifier,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_identifier_gaps_get_gap(
+	          identifier_gaps,
+	          0,
+	          NULL,
+	          &first_identifier,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_identifier_gaps_free(
+	          &identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "identifier_gaps",
+	 identifier_gaps );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_gaps != NULL )
+	{
+		libevtx_identifier_gaps_free(
+		 &identifier_gaps,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_identifier_gaps_start_segment and libevtx_identifier_gaps_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_identifier_gaps_start_segment(
+     void )
+{
+	uint64_t newest_identifiers[ 2 ]           = { 10, 11 };
+	uint64_t oldest_identifiers[ 2 ]           = { 5, 6 };
+	libcerror_error_t *error                   = NULL;
+	libevtx_identifier_gaps_t *identifier_gaps = NULL;
+	uint64_t first_identifier                  = 0;
+	uint64_t last_identifier                   = 0;
+	uint8_t gap_type                           = 0;
+	int number_of_gaps                         = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_identifier_gaps_initialize(
+	          &identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_gaps",
+	 identifier_gaps );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = evtx_test_identifier_gaps_append_identifiers(
+	          identifier_gaps,
+	          newest_identifiers,
+	          2 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_identifier_gaps_start_segment(
+	          identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_identifier_gaps_append_identifiers(
+	          identifier_gaps,
+	          oldest_identifiers,
+	          2 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_identifier_gaps_get_number_of_gaps(
+	          identifier_gaps,
+	          &number_of_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_gaps",
+	 number_of_gaps,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_identifier_gaps_finalize(
+	          identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_identifier_gaps_get_number_of_gaps(
+	          identifier_gaps,
+	          &number_of_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_gaps",
+	 number_of_gaps,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_identifier_gaps_get_gap(
+	          identifier_gaps,
+	          0,
+	          &gap_type,
+	          &first_identifier,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "gap_type",
+	 gap_type,
+	 LIBEVTX_IDENTIFIER_GAP_TYPE_MISSING );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "first_identifier",
+	 first_identifier,
+	 (uint64_t) 7 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "last_identifier",
+	 last_identifier,
+	 (uint64_t) 9 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_identifier_gaps_start_segment(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_identifier_gaps_finalize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_identifier_gaps_free(
+	          &identifier_gaps,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "identifier_gaps",
+	 identifier_gaps );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_gaps != NULL )
+	{
+		libevtx_identifier_gaps_free(
+		 &identifier_gaps,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_identifier_gaps_initialize",
+	 evtx_test_identifier_gaps_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_identifier_gaps_free",
+	 evtx_test_identifier_gaps_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_identifier_gaps_append_identifier",
+	 evtx_test_identifier_gaps_append_identifier );
+
+	EVTX_TEST_RUN(
+	 "libevtx_identifier_gaps_start_segment",
+	 evtx_test_identifier_gaps_start_segment );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
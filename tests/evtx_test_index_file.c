@@ -0,0 +1,549 @@
+/*
+ * Library index_file functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_index_file.h"
+#include "../libevtx/libevtx_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_index_file_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_read_data(
+     void )
+{
+	uint8_t index_file_data[ 128 ];
+
+	libcerror_error_t *error                = NULL;
+	libevtx_io_handle_t *io_handle          = NULL;
+	uint64_t last_indexed_record_identifier = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	result = memory_set(
+	          index_file_data,
+	          0,
+	          sizeof( uint8_t ) * 128 ) != NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 * The lists and array are not accessed since the data cannot be used
+	 */
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 16,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 128,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_index_file_read_data(
+	          NULL,
+	          sizeof( uint8_t ) * 128,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          (size_t) SSIZE_MAX + 1,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 128,
+	          NULL,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 128,
+	          io_handle,
+	          (size64_t) 65536,
+	          NULL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 128,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          NULL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 128,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          NULL,
+	          &last_indexed_record_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 128,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_index_file_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_get_data_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 * The lists and array are not accessed since the arguments are validated first
+	 */
+	result = libevtx_index_file_get_data_size(
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_index_file_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_write_data(
+     void )
+{
+	uint8_t index_file_data[ 128 ];
+
+	libcerror_error_t *error       = NULL;
+	libevtx_io_handle_t *io_handle = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	/* Test error cases
+	 * The lists and array are not accessed since the arguments are validated first
+	 */
+	result = libevtx_index_file_write_data(
+	          NULL,
+	          sizeof( uint8_t ) * 128,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_write_data(
+	          index_file_data,
+	          (size_t) SSIZE_MAX + 1,
+	          io_handle,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_write_data(
+	          index_file_data,
+	          sizeof( uint8_t ) * 128,
+	          NULL,
+	          (size64_t) 65536,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libfdata_list_t *) 0x12345678UL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_read_data",
+	 evtx_test_index_file_read_data );
+
+	/* TODO: add tests for libevtx_index_file_read */
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_get_data_size",
+	 evtx_test_index_file_get_data_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_write_data",
+	 evtx_test_index_file_write_data );
+
+	/* TODO: add tests for libevtx_index_file_write */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
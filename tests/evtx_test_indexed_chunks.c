@@ -0,0 +1,403 @@
+/*
+ * Library indexed_chunks functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_indexed_chunks.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_indexed_chunks_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_indexed_chunks_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_indexed_chunks_t *indexed_chunks = NULL;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_indexed_chunks_initialize(
+	          &indexed_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "indexed_chunks",
+	 indexed_chunks );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_indexed_chunks_free(
+	          &indexed_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "indexed_chunks",
+	 indexed_chunks );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_indexed_chunks_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( indexed_chunks != NULL )
+	{
+		libevtx_indexed_chunks_free(
+		 &indexed_chunks,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_indexed_chunks_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_indexed_chunks_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_indexed_chunks_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_indexed_chunks_read_record_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_indexed_chunks_read_record_entries(
+     void )
+{
+	uint8_t record_entries_data[ 48 ] = {
+		0x00, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error                 = NULL;
+	libevtx_indexed_chunks_t *indexed_chunks = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_indexed_chunks_initialize(
+	          &indexed_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "indexed_chunks",
+	 indexed_chunks );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	indexed_chunks->number_of_chunks = 2;
+
+	/* Test regular cases
+	 */
+	result = libevtx_indexed_chunks_read_record_entries(
+	          indexed_chunks,
+	          record_entries_data,
+	          3,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "indexed_chunks->record_entry_indexes[ 0 ]",
+	 indexed_chunks->record_entry_indexes[ 0 ],
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "indexed_chunks->record_entry_indexes[ 1 ]",
+	 indexed_chunks->record_entry_indexes[ 1 ],
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "indexed_chunks->record_entry_indexes[ 2 ]",
+	 indexed_chunks->record_entry_indexes[ 2 ],
+	 3 );
+
+	/* The order of the record entries of the same chunk is retained
+	 */
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "indexed_chunks->record_entries[ 2 ]",
+	 indexed_chunks->record_entries[ 2 ],
+	 (uint64_t) 0x00011200UL );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "indexed_chunks->record_entries[ 4 ]",
+	 indexed_chunks->record_entries[ 4 ],
+	 (uint64_t) 0x00011400UL );
+
+	/* A record entry of a chunk that was not indexed is invalid
+	 */
+	indexed_chunks->number_of_chunks = 1;
+
+	result = libevtx_indexed_chunks_read_record_entries(
+	          indexed_chunks,
+	          record_entries_data,
+	          3,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "indexed_chunks->recovered_record_entry_indexes",
+	 indexed_chunks->recovered_record_entry_indexes );
+
+	/* Test error cases
+	 */
+	result = libevtx_indexed_chunks_read_record_entries(
+	          NULL,
+	          record_entries_data,
+	          3,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_indexed_chunks_read_record_entries(
+	          indexed_chunks,
+	          record_entries_data,
+	          3,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_indexed_chunks_read_record_entries(
+	          indexed_chunks,
+	          NULL,
+	          3,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_indexed_chunks_free(
+	          &indexed_chunks,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "indexed_chunks",
+	 indexed_chunks );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( indexed_chunks != NULL )
+	{
+		libevtx_indexed_chunks_free(
+		 &indexed_chunks,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_indexed_chunks_initialize",
+	 evtx_test_indexed_chunks_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_indexed_chunks_free",
+	 evtx_test_indexed_chunks_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_indexed_chunks_read_record_entries",
+	 evtx_test_indexed_chunks_read_record_entries );
+
+	/* TODO: add tests for libevtx_indexed_chunks_append_record_entries */
+
+	/* TODO: add tests for libevtx_indexed_chunks_take_chunk */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -45,6 +45,9 @@ int evtx_test_memcpy_attempts_before_fail                     = -1;
 int evtx_test_memset_attempts_before_fail                     = -1;
 int evtx_test_realloc_attempts_before_fail                    = -1;
 
+uint64_t evtx_test_number_of_malloc_calls                     = 0;
+uint64_t evtx_test_number_of_realloc_calls                    = 0;
+
 /* Custom malloc for testing memory error cases
  * Note this function might fail if compiled with optimation
  * Returns a pointer to newly allocated data or NULL
@@ -70,6 +73,8 @@ void *malloc(
 	{
 		evtx_test_malloc_attempts_before_fail--;
 	}
+	evtx_test_number_of_malloc_calls++;
+
 	ptr = evtx_test_real_malloc(
 	       size );
 
@@ -166,6 +171,8 @@ void *realloc(
 	{
 		evtx_test_realloc_attempts_before_fail--;
 	}
+	evtx_test_number_of_realloc_calls++;
+
 	ptr = evtx_test_real_realloc(
 	       ptr,
 	       size );
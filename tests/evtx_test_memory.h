@@ -23,6 +23,7 @@
 #define _EVTX_TEST_MEMORY_H
 
 #include <common.h>
+#include <types.h>
 
 #if defined( __cplusplus )
 extern "C" {
@@ -42,6 +43,10 @@ extern int evtx_test_memset_attempts_before_fail;
 
 extern int evtx_test_realloc_attempts_before_fail;
 
+extern uint64_t evtx_test_number_of_malloc_calls;
+
+extern uint64_t evtx_test_number_of_realloc_calls;
+
 #endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
 
 #if defined( __cplusplus )
@@ -0,0 +1,428 @@
+/*
+ * Library memory usage functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_memory_usage.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_memory_usage_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_memory_usage_clear(
+     void )
+{
+	libevtx_memory_usage_t memory_usage;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_memory_usage_clear(
+	          &memory_usage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libevtx_memory_usage_add(
+	 &memory_usage,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 65536 );
+
+	result = libevtx_memory_usage_clear(
+	          &memory_usage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage.total_size",
+	 memory_usage.total_size,
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage.peak_size",
+	 memory_usage.peak_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_memory_usage_clear(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_memory_usage_add and libevtx_memory_usage_remove functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_memory_usage_add_remove(
+     void )
+{
+	uint64_t values[ LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES ];
+
+	libevtx_memory_usage_t memory_usage;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libevtx_memory_usage_clear(
+	          &memory_usage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	libevtx_memory_usage_add(
+	 &memory_usage,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 65536 );
+
+	libevtx_memory_usage_add(
+	 &memory_usage,
+	 LIBEVTX_MEMORY_USAGE_RECORD_VALUES,
+	 512 );
+
+	libevtx_memory_usage_remove(
+	 &memory_usage,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 65536 );
+
+	libevtx_memory_usage_add(
+	 &memory_usage,
+	 LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS,
+	 1024 );
+
+	result = libevtx_memory_usage_get_values(
+	          &memory_usage,
+	          values,
+	          LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_CHUNK_DATA ]",
+	 values[ LIBEVTX_MEMORY_USAGE_CHUNK_DATA ],
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_RECORD_VALUES ]",
+	 values[ LIBEVTX_MEMORY_USAGE_RECORD_VALUES ],
+	 (uint64_t) 512 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS ]",
+	 values[ LIBEVTX_MEMORY_USAGE_XML_DOCUMENTS ],
+	 (uint64_t) 1024 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_TOTAL ]",
+	 values[ LIBEVTX_MEMORY_USAGE_TOTAL ],
+	 (uint64_t) 1536 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_PEAK ]",
+	 values[ LIBEVTX_MEMORY_USAGE_PEAK ],
+	 (uint64_t) 66048 );
+
+	/* Test that removing more than was added does not wrap around
+	 */
+	libevtx_memory_usage_remove(
+	 &memory_usage,
+	 LIBEVTX_MEMORY_USAGE_RECORDS_INDEX,
+	 4096 );
+
+	result = libevtx_memory_usage_get_values(
+	          &memory_usage,
+	          values,
+	          LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ]",
+	 values[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ],
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_TOTAL ]",
+	 values[ LIBEVTX_MEMORY_USAGE_TOTAL ],
+	 (uint64_t) 0 );
+
+	/* Test that the memory usage of NULL is ignored
+	 */
+	libevtx_memory_usage_add(
+	 NULL,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 65536 );
+
+	libevtx_memory_usage_remove(
+	 NULL,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 65536 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_memory_usage_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_memory_usage_get_values(
+     void )
+{
+	uint64_t values[ LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES ];
+
+	libevtx_memory_usage_t memory_usage;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libevtx_memory_usage_clear(
+	          &memory_usage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	libevtx_memory_usage_add(
+	 &memory_usage,
+	 LIBEVTX_MEMORY_USAGE_CHUNK_DATA,
+	 65536 );
+
+	values[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ] = 1;
+
+	result = libevtx_memory_usage_get_values(
+	          &memory_usage,
+	          values,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_CHUNK_DATA ]",
+	 values[ LIBEVTX_MEMORY_USAGE_CHUNK_DATA ],
+	 (uint64_t) 65536 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ]",
+	 values[ LIBEVTX_MEMORY_USAGE_RECORDS_INDEX ],
+	 (uint64_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_memory_usage_get_values(
+	          NULL,
+	          values,
+	          LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_memory_usage_get_values(
+	          &memory_usage,
+	          NULL,
+	          LIBEVTX_NUMBER_OF_MEMORY_USAGE_VALUES,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_memory_usage_get_values(
+	          &memory_usage,
+	          values,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_memory_usage_clear",
+	 evtx_test_memory_usage_clear );
+
+	EVTX_TEST_RUN(
+	 "libevtx_memory_usage_add",
+	 evtx_test_memory_usage_add_remove );
+
+	EVTX_TEST_RUN(
+	 "libevtx_memory_usage_get_values",
+	 evtx_test_memory_usage_get_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1069 @@
+/*
+ * Library message resolver functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_message_resolver.h"
+
+/* The size of the long test message, which exceeds the initial string size of the resolver
+ */
+#define EVTX_TEST_MESSAGE_RESOLVER_LONG_MESSAGE_SIZE	2048
+
+/* Resolves the test message strings
+ * The user data, if set, contains the number of times the callback was called
+ * Returns 1 if successful, 0 if no message is available or -1 on error
+ */
+int evtx_test_message_resolver_callback(
+     const uint8_t *provider_identifier EVTX_TEST_ATTRIBUTE_UNUSED,
+     size_t provider_identifier_size EVTX_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *utf8_source_name EVTX_TEST_ATTRIBUTE_UNUSED,
+     size_t utf8_source_name_size EVTX_TEST_ATTRIBUTE_UNUSED,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers EVTX_TEST_ATTRIBUTE_UNUSED,
+     uint32_t language_identifier EVTX_TEST_ATTRIBUTE_UNUSED,
+     uint8_t *utf8_string,
+     size_t *utf8_string_size,
+     void *user_data )
+{
+	const char *message = NULL;
+	size_t message_size = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( provider_identifier )
+	EVTX_TEST_UNREFERENCED_PARAMETER( provider_identifier_size )
+	EVTX_TEST_UNREFERENCED_PARAMETER( utf8_source_name )
+	EVTX_TEST_UNREFERENCED_PARAMETER( utf8_source_name_size )
+	EVTX_TEST_UNREFERENCED_PARAMETER( event_identifier_qualifiers )
+	EVTX_TEST_UNREFERENCED_PARAMETER( language_identifier )
+
+	if( user_data != NULL )
+	{
+		*( (int *) user_data ) += 1;
+	}
+	if( event_identifier == 1 )
+	{
+		message = "The %1 service entered the %2 state.%r%n%n";
+	}
+	else if( event_identifier == 2 )
+	{
+		return( 0 );
+	}
+	else if( event_identifier == 3 )
+	{
+		message_size = EVTX_TEST_MESSAGE_RESOLVER_LONG_MESSAGE_SIZE;
+	}
+	else if( event_identifier == 4 )
+	{
+		message = "Unsupported %q specifier";
+	}
+	else
+	{
+		return( -1 );
+	}
+	if( message != NULL )
+	{
+		message_size = 1 + narrow_string_length(
+		                    message );
+	}
+	if( message_size > *utf8_string_size )
+	{
+		*utf8_string_size = message_size;
+
+		return( 1 );
+	}
+	if( message != NULL )
+	{
+		if( memory_copy(
+		     utf8_string,
+		     message,
+		     message_size ) == NULL )
+		{
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( memory_set(
+		     utf8_string,
+		     (int) 'a',
+		     message_size - 1 ) == NULL )
+		{
+			return( -1 );
+		}
+		utf8_string[ message_size - 1 ] = 0;
+	}
+	*utf8_string_size = message_size;
+
+	return( 1 );
+}
+
+/* Tests the libevtx_message_resolver_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_message_resolver_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_message_resolver_t *message_resolver = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 2;
+	int number_of_memset_fail_tests              = 2;
+	int test_number                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_message_resolver_initialize(
+	          &message_resolver,
+	          &evtx_test_message_resolver_callback,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_resolver",
+	 message_resolver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_message_resolver_free(
+	          &message_resolver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_resolver",
+	 message_resolver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_message_resolver_initialize(
+	          NULL,
+	          &evtx_test_message_resolver_callback,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	message_resolver = (libevtx_message_resolver_t *) 0x12345678UL;
+
+	result = libevtx_message_resolver_initialize(
+	          &message_resolver,
+	          &evtx_test_message_resolver_callback,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	message_resolver = NULL;
+
+	result = libevtx_message_resolver_initialize(
+	          &message_resolver,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_message_resolver_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_message_resolver_initialize(
+		          &message_resolver,
+		          &evtx_test_message_resolver_callback,
+		          NULL,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( message_resolver != NULL )
+			{
+				libevtx_message_resolver_free(
+				 &message_resolver,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "message_resolver",
+			 message_resolver );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_message_resolver_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_message_resolver_initialize(
+		          &message_resolver,
+		          &evtx_test_message_resolver_callback,
+		          NULL,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( message_resolver != NULL )
+			{
+				libevtx_message_resolver_free(
+				 &message_resolver,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "message_resolver",
+			 message_resolver );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_resolver != NULL )
+	{
+		libevtx_message_resolver_free(
+		 &message_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_message_resolver_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_message_resolver_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_message_resolver_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_message_resolver_get_language_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_message_resolver_get_language_identifier(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_message_resolver_t *message_resolver = NULL;
+	uint32_t language_identifier                 = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_message_resolver_initialize(
+	          &message_resolver,
+	          &evtx_test_message_resolver_callback,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_resolver",
+	 message_resolver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_message_resolver_get_language_identifier(
+	          message_resolver,
+	          &language_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "language_identifier",
+	 language_identifier,
+	 (uint32_t) 0x00000409UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_message_resolver_set_language_identifier(
+	          message_resolver,
+	          0x00000407UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_message_resolver_get_language_identifier(
+	          message_resolver,
+	          &language_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "language_identifier",
+	 language_identifier,
+	 (uint32_t) 0x00000407UL );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_message_resolver_get_language_identifier(
+	          NULL,
+	          &language_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_message_resolver_get_language_identifier(
+	          message_resolver,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_message_resolver_set_language_identifier(
+	          NULL,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_message_resolver_free(
+	          &message_resolver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_resolver",
+	 message_resolver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_resolver != NULL )
+	{
+		libevtx_message_resolver_free(
+		 &message_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_message_resolver_format_message function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_message_resolver_format_message(
+     void )
+{
+	uint8_t formatted_string[ 64 ];
+
+	const uint8_t *expected_string               = (uint8_t *) "The Netlogon service entered the running state.\n";
+	const uint8_t *utf8_strings                  = (uint8_t *) "Netlogon\0running";
+	libcerror_error_t *error                     = NULL;
+	libevtx_message_resolver_t *message_resolver = NULL;
+	uint8_t *long_string                         = NULL;
+	size_t formatted_string_size                 = 0;
+	size_t utf8_string_offsets[ 2 ]              = { 0, 9 };
+	size_t utf8_string_sizes[ 2 ]                = { 9, 8 };
+	int number_of_calls                          = 0;
+	int number_of_messages                       = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_message_resolver_initialize(
+	          &message_resolver,
+	          &evtx_test_message_resolver_callback,
+	          &number_of_calls,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_resolver",
+	 message_resolver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          (uint8_t *) "Service Control Manager",
+	          24,
+	          1,
+	          0x4000,
+	          utf8_strings,
+	          2,
+	          utf8_string_offsets,
+	          utf8_string_sizes,
+	          NULL,
+	          0,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "formatted_string_size",
+	 formatted_string_size,
+	 (size_t) 49 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          (uint8_t *) "Service Control Manager",
+	          24,
+	          1,
+	          0x4000,
+	          utf8_strings,
+	          2,
+	          utf8_string_offsets,
+	          utf8_string_sizes,
+	          formatted_string,
+	          64,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "formatted_string_size",
+	 formatted_string_size,
+	 (size_t) 49 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          formatted_string,
+	          expected_string,
+	          49 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The compiled message is cached hence the callback is called once
+	 */
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_calls",
+	 number_of_calls,
+	 1 );
+
+	/* A substitution without a string is formatted as the conversion specifier
+	 */
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          (uint8_t *) "Service Control Manager",
+	          24,
+	          1,
+	          0x4000,
+	          utf8_strings,
+	          1,
+	          utf8_string_offsets,
+	          utf8_string_sizes,
+	          formatted_string,
+	          64,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "formatted_string_size",
+	 formatted_string_size,
+	 (size_t) 44 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          formatted_string,
+	          "The Netlogon service entered the %2 state.\n",
+	          44 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A message that is not available is cached as well
+	 */
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          NULL,
+	          0,
+	          2,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          NULL,
+	          0,
+	          2,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_calls",
+	 number_of_calls,
+	 2 );
+
+	/* A message that exceeds the initial string size is resolved in a second call
+	 */
+	long_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * EVTX_TEST_MESSAGE_RESOLVER_LONG_MESSAGE_SIZE );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "long_string",
+	 long_string );
+
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          NULL,
+	          0,
+	          3,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          long_string,
+	          EVTX_TEST_MESSAGE_RESOLVER_LONG_MESSAGE_SIZE,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "formatted_string_size",
+	 formatted_string_size,
+	 (size_t) EVTX_TEST_MESSAGE_RESOLVER_LONG_MESSAGE_SIZE );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "long_string[ 0 ]",
+	 long_string[ 0 ],
+	 (uint8_t) 'a' );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "long_string[ EVTX_TEST_MESSAGE_RESOLVER_LONG_MESSAGE_SIZE - 1 ]",
+	 long_string[ EVTX_TEST_MESSAGE_RESOLVER_LONG_MESSAGE_SIZE - 1 ],
+	 (uint8_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_calls",
+	 number_of_calls,
+	 4 );
+
+	memory_free(
+	 long_string );
+
+	long_string = NULL;
+
+	result = libevtx_message_resolver_get_number_of_messages(
+	          message_resolver,
+	          &number_of_messages,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_messages",
+	 number_of_messages,
+	 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_message_resolver_format_message(
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          0,
+	          utf8_strings,
+	          2,
+	          utf8_string_offsets,
+	          utf8_string_sizes,
+	          NULL,
+	          0,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The formatted string does not fit the buffer
+	 */
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          (uint8_t *) "Service Control Manager",
+	          24,
+	          1,
+	          0x4000,
+	          utf8_strings,
+	          2,
+	          utf8_string_offsets,
+	          utf8_string_sizes,
+	          formatted_string,
+	          16,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The message string contains an unsupported conversion specifier
+	 */
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          NULL,
+	          0,
+	          4,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The callback returns an error
+	 */
+	result = libevtx_message_resolver_format_message(
+	          message_resolver,
+	          NULL,
+	          NULL,
+	          0,
+	          5,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &formatted_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_message_resolver_free(
+	          &message_resolver,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_resolver",
+	 message_resolver );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_string != NULL )
+	{
+		memory_free(
+		 long_string );
+	}
+	if( message_resolver != NULL )
+	{
+		libevtx_message_resolver_free(
+		 &message_resolver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "libevtx_message_resolver_initialize",
+	 evtx_test_message_resolver_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_message_resolver_free",
+	 evtx_test_message_resolver_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_message_resolver_get_language_identifier",
+	 evtx_test_message_resolver_get_language_identifier );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_message_resolver_format_message",
+	 evtx_test_message_resolver_format_message );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,613 @@
+/*
+ * Library query_index type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_query_index.h"
+#include "../libevtx/libevtx_system_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* WKS-01 as an UTF-16 little-endian stream
+ */
+uint8_t evtx_test_query_index_computer_name[ 12 ] = {
+	0x57, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x31, 0x00 };
+
+/* Tests the libevtx_query_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_query_index_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libevtx_query_index_t *query_index = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_query_index_initialize(
+	          &query_index,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "query_index",
+	 query_index );
+
+	result = libevtx_query_index_free(
+	          &query_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "query_index",
+	 query_index );
+
+	/* Test error cases
+	 */
+	result = libevtx_query_index_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	query_index = (libevtx_query_index_t *) 0x12345678UL;
+
+	result = libevtx_query_index_initialize(
+	          &query_index,
+	          16,
+	          &error );
+
+	query_index = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_query_index_initialize(
+	          &query_index,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( query_index != NULL )
+	{
+		libevtx_query_index_free(
+		 &query_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_query_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_query_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_query_index_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_query_index_hash_utf16_stream and libevtx_query_index_hash_utf16_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_query_index_hash_utf16(
+     void )
+{
+	uint16_t utf16_string[ 7 ] = {
+		(uint16_t) 'w', (uint16_t) 'k', (uint16_t) 's', (uint16_t) '-', (uint16_t) '0', (uint16_t) '1', 0 };
+
+	uint32_t stream_hash = 0;
+	uint32_t string_hash = 0;
+
+	/* Test regular cases
+	 */
+	stream_hash = libevtx_query_index_hash_utf16_stream(
+	               evtx_test_query_index_computer_name,
+	               12 );
+
+	string_hash = libevtx_query_index_hash_utf16_string(
+	               utf16_string,
+	               7 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "string_hash",
+	 string_hash,
+	 stream_hash );
+
+	utf16_string[ 5 ] = (uint16_t) '2';
+
+	string_hash = libevtx_query_index_hash_utf16_string(
+	               utf16_string,
+	               7 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "string_hash",
+	 (int64_t) string_hash,
+	 (int64_t) stream_hash );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_query_index_mark_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_query_index_mark_records(
+     void )
+{
+	uint8_t records_bitmap[ 1 ];
+
+	libevtx_system_values_t system_values;
+
+	libcerror_error_t *error           = NULL;
+	libevtx_query_index_t *query_index = NULL;
+	uint32_t event_identifiers[ 3 ]    = { 4624, 4625, 4624 };
+	uint32_t key_value                 = 0;
+	int record_index                   = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &system_values,
+	 0,
+	 sizeof( libevtx_system_values_t ) );
+
+	system_values.computer_name      = evtx_test_query_index_computer_name;
+	system_values.computer_name_size = 12;
+	system_values.flags              = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER
+	                                 | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME;
+
+	result = libevtx_query_index_initialize(
+	          &query_index,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < 3;
+	     record_index++ )
+	{
+		system_values.event_identifier = event_identifiers[ record_index ];
+
+		result = libevtx_query_index_append_system_values(
+		          query_index,
+		          record_index,
+		          &system_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_query_index_append_unindexed_record(
+	          query_index,
+	          3,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_query_index_sort(
+	          query_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	records_bitmap[ 0 ] = 0;
+
+	result = libevtx_query_index_mark_records(
+	          query_index,
+	          LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER,
+	          4624,
+	          records_bitmap,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "records_bitmap[ 0 ]",
+	 records_bitmap[ 0 ],
+	 (uint8_t) 0x05 );
+
+	result = libevtx_query_index_mark_unindexed_records(
+	          query_index,
+	          records_bitmap,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "records_bitmap[ 0 ]",
+	 records_bitmap[ 0 ],
+	 (uint8_t) 0x0d );
+
+	records_bitmap[ 0 ] = 0;
+
+	key_value = libevtx_query_index_hash_utf16_stream(
+	             evtx_test_query_index_computer_name,
+	             12 );
+
+	result = libevtx_query_index_mark_records(
+	          query_index,
+	          LIBEVTX_QUERY_INDEX_KEY_COMPUTER_NAME,
+	          key_value,
+	          records_bitmap,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "records_bitmap[ 0 ]",
+	 records_bitmap[ 0 ],
+	 (uint8_t) 0x07 );
+
+	records_bitmap[ 0 ] = 0;
+
+	result = libevtx_query_index_mark_records(
+	          query_index,
+	          LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER,
+	          4634,
+	          records_bitmap,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "records_bitmap[ 0 ]",
+	 records_bitmap[ 0 ],
+	 (uint8_t) 0x00 );
+
+	/* Test error cases
+	 */
+	result = libevtx_query_index_mark_records(
+	          NULL,
+	          LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER,
+	          4624,
+	          records_bitmap,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_query_index_mark_records(
+	          query_index,
+	          LIBEVTX_QUERY_INDEX_NUMBER_OF_KEYS,
+	          4624,
+	          records_bitmap,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_query_index_mark_records(
+	          query_index,
+	          LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER,
+	          4624,
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_query_index_mark_records(
+	          query_index,
+	          LIBEVTX_QUERY_INDEX_KEY_EVENT_IDENTIFIER,
+	          4624,
+	          records_bitmap,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_query_index_append_system_values(
+	          query_index,
+	          4,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_query_index_free(
+	          &query_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( query_index != NULL )
+	{
+		libevtx_query_index_free(
+		 &query_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_query_index_initialize",
+	 evtx_test_query_index_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_query_index_free",
+	 evtx_test_query_index_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_query_index_hash_utf16_stream",
+	 evtx_test_query_index_hash_utf16 );
+
+	EVTX_TEST_RUN(
+	 "libevtx_query_index_mark_records",
+	 evtx_test_query_index_mark_records );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
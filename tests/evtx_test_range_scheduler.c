@@ -0,0 +1,707 @@
+/*
+ * Library range scheduler functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_range_scheduler.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_range_scheduler_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_range_scheduler_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libevtx_range_scheduler_t *range_scheduler = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 3;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_range_scheduler_initialize(
+	          &range_scheduler,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "range_scheduler",
+	 range_scheduler );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_range_scheduler_free(
+	          &range_scheduler,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "range_scheduler",
+	 range_scheduler );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_range_scheduler_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	range_scheduler = (libevtx_range_scheduler_t *) 0x12345678UL;
+
+	result = libevtx_range_scheduler_initialize(
+	          &range_scheduler,
+	          4,
+	          &error );
+
+	range_scheduler = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_range_scheduler_initialize(
+	          &range_scheduler,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_range_scheduler_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_range_scheduler_initialize(
+		          &range_scheduler,
+		          4,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( range_scheduler != NULL )
+			{
+				libevtx_range_scheduler_free(
+				 &range_scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "range_scheduler",
+			 range_scheduler );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( range_scheduler != NULL )
+	{
+		libevtx_range_scheduler_free(
+		 &range_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_range_scheduler_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_range_scheduler_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_range_scheduler_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_range_scheduler_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_range_scheduler_reset(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libevtx_range_scheduler_t *range_scheduler = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_range_scheduler_initialize(
+	          &range_scheduler,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "range_scheduler",
+	 range_scheduler );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_range_scheduler_reset(
+	          range_scheduler,
+	          10,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The remainder of the items is assigned to the first workers
+	 */
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "range_scheduler->range_start_indexes[ 0 ]",
+	 range_scheduler->range_start_indexes[ 0 ],
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "range_scheduler->range_end_indexes[ 0 ]",
+	 range_scheduler->range_end_indexes[ 0 ],
+	 3 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "range_scheduler->range_start_indexes[ 2 ]",
+	 range_scheduler->range_start_indexes[ 2 ],
+	 6 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "range_scheduler->range_end_indexes[ 3 ]",
+	 range_scheduler->range_end_indexes[ 3 ],
+	 10 );
+
+	result = libevtx_range_scheduler_reset(
+	          range_scheduler,
+	          0,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_range_scheduler_reset(
+	          NULL,
+	          10,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_range_scheduler_reset(
+	          range_scheduler,
+	          -1,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_range_scheduler_reset(
+	          range_scheduler,
+	          10,
+	          5,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_range_scheduler_free(
+	          &range_scheduler,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( range_scheduler != NULL )
+	{
+		libevtx_range_scheduler_free(
+		 &range_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_range_scheduler_get_next_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_range_scheduler_get_next_index(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libevtx_range_scheduler_t *range_scheduler = NULL;
+	int item_index                             = 0;
+	int number_of_items                        = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_range_scheduler_initialize(
+	          &range_scheduler,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "range_scheduler",
+	 range_scheduler );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_range_scheduler_reset(
+	          range_scheduler,
+	          8,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_range_scheduler_get_next_index(
+	          range_scheduler,
+	          1,
+	          &item_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 4 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Worker 0 takes all the items of its own range and then
+	 * steals the items 6 and 7 from the range of worker 1
+	 */
+	for( number_of_items = 0;
+	     number_of_items < 6;
+	     number_of_items++ )
+	{
+		result = libevtx_range_scheduler_get_next_index(
+		          range_scheduler,
+		          0,
+		          &item_index,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 7 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "range_scheduler->number_of_steals",
+	 range_scheduler->number_of_steals,
+	 1 );
+
+	result = libevtx_range_scheduler_get_next_index(
+	          range_scheduler,
+	          1,
+	          &item_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 5 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* All the items have been taken
+	 */
+	result = libevtx_range_scheduler_get_next_index(
+	          range_scheduler,
+	          0,
+	          &item_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_range_scheduler_get_next_index(
+	          range_scheduler,
+	          1,
+	          &item_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_range_scheduler_get_next_index(
+	          NULL,
+	          0,
+	          &item_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_range_scheduler_get_next_index(
+	          range_scheduler,
+	          2,
+	          &item_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_range_scheduler_get_next_index(
+	          range_scheduler,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_range_scheduler_free(
+	          &range_scheduler,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( range_scheduler != NULL )
+	{
+		libevtx_range_scheduler_free(
+		 &range_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_range_scheduler_initialize",
+	 evtx_test_range_scheduler_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_range_scheduler_free",
+	 evtx_test_range_scheduler_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_range_scheduler_reset",
+	 evtx_test_range_scheduler_reset );
+
+	EVTX_TEST_RUN(
+	 "libevtx_range_scheduler_get_next_index",
+	 evtx_test_range_scheduler_get_next_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "evtx_test_getopt.h"
+#include "evtx_test_libbfio.h"
 #include "evtx_test_libcerror.h"
 #include "evtx_test_libevtx.h"
 #include "evtx_test_macros.h"
@@ -35,19 +38,1202 @@
 
 #include "../libevtx/libevtx_record.h"
 
+#if !defined( LIBEVTX_HAVE_BFIO )
+
+LIBEVTX_EXTERN \
+int libevtx_file_open_file_io_handle(
+     libevtx_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libevtx_error_t **error );
+
+#endif /* !defined( LIBEVTX_HAVE_BFIO ) */
+
 /* Tests the libevtx_record_free function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_free(
-     void )
+int evtx_test_record_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_task function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_task(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t task            = 0;
+	int result               = 0;
+	int task_is_set          = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_task(
+	          record,
+	          &task,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	task_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_task(
+	          NULL,
+	          &task,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( task_is_set != 0 )
+	{
+		result = libevtx_record_get_task(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_opcode function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_opcode(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t opcode           = 0;
+	int result               = 0;
+	int opcode_is_set        = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_opcode(
+	          record,
+	          &opcode,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	opcode_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_opcode(
+	          NULL,
+	          &opcode,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( opcode_is_set != 0 )
+	{
+		result = libevtx_record_get_opcode(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_keywords function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_keywords(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t keywords        = 0;
+	int result               = 0;
+	int keywords_is_set      = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_keywords(
+	          record,
+	          &keywords,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	keywords_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_keywords(
+	          NULL,
+	          &keywords,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( keywords_is_set != 0 )
+	{
+		result = libevtx_record_get_keywords(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf8_channel_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_channel_name_size(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error          = NULL;
+	size_t utf8_channel_name_size     = 0;
+	int result                        = 0;
+	int utf8_channel_name_size_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf8_channel_name_size(
+	          record,
+	          &utf8_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_channel_name_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf8_channel_name_size(
+	          NULL,
+	          &utf8_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_channel_name_size_is_set != 0 )
+	{
+		result = libevtx_record_get_utf8_channel_name_size(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf8_channel_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_channel_name(
+     libevtx_record_t *record )
+{
+	uint8_t utf8_channel_name[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t utf8_channel_name_size = 0;
+	int result                    = 0;
+	int utf8_channel_name_is_set  = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf8_channel_name_size(
+	          record,
+	          &utf8_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_channel_name_is_set = result;
+
+	if( utf8_channel_name_is_set != 0 )
+	{
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "utf8_channel_name_size",
+		 (int) utf8_channel_name_size,
+		 0 );
+
+		EVTX_TEST_ASSERT_LESS_THAN_INT(
+		 "utf8_channel_name_size",
+		 (int) utf8_channel_name_size,
+		 513 );
+	}
+	result = libevtx_record_get_utf8_channel_name(
+	          record,
+	          utf8_channel_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 utf8_channel_name_is_set );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf8_channel_name(
+	          NULL,
+	          utf8_channel_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_channel_name_is_set != 0 )
+	{
+		result = libevtx_record_get_utf8_channel_name(
+		          record,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_get_utf8_channel_name(
+		          record,
+		          utf8_channel_name,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf16_channel_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf16_channel_name_size(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error           = NULL;
+	size_t utf16_channel_name_size     = 0;
+	int result                         = 0;
+	int utf16_channel_name_size_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf16_channel_name_size(
+	          record,
+	          &utf16_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_channel_name_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf16_channel_name_size(
+	          NULL,
+	          &utf16_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_channel_name_size_is_set != 0 )
+	{
+		result = libevtx_record_get_utf16_channel_name_size(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf16_channel_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf16_channel_name(
+     libevtx_record_t *record )
+{
+	uint16_t utf16_channel_name[ 512 ];
+
+	libcerror_error_t *error       = NULL;
+	size_t utf16_channel_name_size = 0;
+	int result                     = 0;
+	int utf16_channel_name_is_set  = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf16_channel_name_size(
+	          record,
+	          &utf16_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_channel_name_is_set = result;
+
+	if( utf16_channel_name_is_set != 0 )
+	{
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "utf16_channel_name_size",
+		 (int) utf16_channel_name_size,
+		 0 );
+
+		EVTX_TEST_ASSERT_LESS_THAN_INT(
+		 "utf16_channel_name_size",
+		 (int) utf16_channel_name_size,
+		 513 );
+	}
+	result = libevtx_record_get_utf16_channel_name(
+	          record,
+	          utf16_channel_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 utf16_channel_name_is_set );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf16_channel_name(
+	          NULL,
+	          utf16_channel_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_channel_name_is_set != 0 )
+	{
+		result = libevtx_record_get_utf16_channel_name(
+		          record,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_get_utf16_channel_name(
+		          record,
+		          utf16_channel_name,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_process_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_process_identifier(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error      = NULL;
+	uint32_t process_identifier   = 0;
+	int result                    = 0;
+	int process_identifier_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_process_identifier(
+	          record,
+	          &process_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	process_identifier_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_process_identifier(
+	          NULL,
+	          &process_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( process_identifier_is_set != 0 )
+	{
+		result = libevtx_record_get_process_identifier(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_thread_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_thread_identifier(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error     = NULL;
+	uint32_t thread_identifier   = 0;
+	int result                   = 0;
+	int thread_identifier_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_thread_identifier(
+	          record,
+	          &thread_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	thread_identifier_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_thread_identifier(
+	          NULL,
+	          &thread_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( thread_identifier_is_set != 0 )
+	{
+		result = libevtx_record_get_thread_identifier(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf8_activity_identifier_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_activity_identifier_size(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error                 = NULL;
+	size_t utf8_activity_identifier_size     = 0;
+	int result                               = 0;
+	int utf8_activity_identifier_size_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf8_activity_identifier_size(
+	          record,
+	          &utf8_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_activity_identifier_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf8_activity_identifier_size(
+	          NULL,
+	          &utf8_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_activity_identifier_size_is_set != 0 )
+	{
+		result = libevtx_record_get_utf8_activity_identifier_size(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf8_activity_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_activity_identifier(
+     libevtx_record_t *record )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint8_t utf8_activity_identifier[ 512 ];
+
+	libcerror_error_t *error             = NULL;
+	size_t utf8_activity_identifier_size = 0;
+	int result                           = 0;
+	int utf8_activity_identifier_is_set  = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf8_activity_identifier_size(
+	          record,
+	          &utf8_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_activity_identifier_is_set = result;
+
+	if( utf8_activity_identifier_is_set != 0 )
+	{
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "utf8_activity_identifier_size",
+		 (int) utf8_activity_identifier_size,
+		 0 );
+
+		EVTX_TEST_ASSERT_LESS_THAN_INT(
+		 "utf8_activity_identifier_size",
+		 (int) utf8_activity_identifier_size,
+		 513 );
+	}
+	result = libevtx_record_get_utf8_activity_identifier(
+	          record,
+	          utf8_activity_identifier,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 utf8_activity_identifier_is_set );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libevtx_record_free(
+	result = libevtx_record_get_utf8_activity_identifier(
+	          NULL,
+	          utf8_activity_identifier,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_activity_identifier_is_set != 0 )
+	{
+		result = libevtx_record_get_utf8_activity_identifier(
+		          record,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_get_utf8_activity_identifier(
+		          record,
+		          utf8_activity_identifier,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf16_activity_identifier_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf16_activity_identifier_size(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error                  = NULL;
+	size_t utf16_activity_identifier_size     = 0;
+	int result                                = 0;
+	int utf16_activity_identifier_size_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf16_activity_identifier_size(
+	          record,
+	          &utf16_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_activity_identifier_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf16_activity_identifier_size(
+	          NULL,
+	          &utf16_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_activity_identifier_size_is_set != 0 )
+	{
+		result = libevtx_record_get_utf16_activity_identifier_size(
+		          record,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf16_activity_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf16_activity_identifier(
+     libevtx_record_t *record )
+{
+	uint16_t utf16_activity_identifier[ 512 ];
+
+	libcerror_error_t *error              = NULL;
+	size_t utf16_activity_identifier_size = 0;
+	int result                            = 0;
+	int utf16_activity_identifier_is_set  = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_utf16_activity_identifier_size(
+	          record,
+	          &utf16_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_activity_identifier_is_set = result;
+
+	if( utf16_activity_identifier_is_set != 0 )
+	{
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "utf16_activity_identifier_size",
+		 (int) utf16_activity_identifier_size,
+		 0 );
+
+		EVTX_TEST_ASSERT_LESS_THAN_INT(
+		 "utf16_activity_identifier_size",
+		 (int) utf16_activity_identifier_size,
+		 513 );
+	}
+	result = libevtx_record_get_utf16_activity_identifier(
+	          record,
+	          utf16_activity_identifier,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 utf16_activity_identifier_is_set );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf16_activity_identifier(
 	          NULL,
+	          utf16_activity_identifier,
+	          512,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -62,6 +1248,44 @@ int evtx_test_record_free(
 	libcerror_error_free(
 	 &error );
 
+	if( utf16_activity_identifier_is_set != 0 )
+	{
+		result = libevtx_record_get_utf16_activity_identifier(
+		          record,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_get_utf16_activity_identifier(
+		          record,
+		          utf16_activity_identifier,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
 	return( 1 );
 
 on_error:
@@ -77,17 +1301,45 @@ on_error:
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
-	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	libevtx_record_t *record         = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
 
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
 	/* TODO: add tests for libevtx_record_initialize */
@@ -98,10 +1350,258 @@ int main(
 	 "libevtx_record_free",
 	 evtx_test_record_free );
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize file and record for tests
+		 */
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_initialize(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_open_file_io_handle(
+		          file,
+		          file_io_handle,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_records(
+		          file,
+		          &number_of_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_records > 0 )
+		{
+			result = libevtx_file_get_record_by_index(
+			          file,
+			          0,
+			          &record,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "record",
+			 record );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	if( record != NULL )
+	{
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_task",
+		 evtx_test_record_get_task,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_opcode",
+		 evtx_test_record_get_opcode,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_keywords",
+		 evtx_test_record_get_keywords,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf8_channel_name_size",
+		 evtx_test_record_get_utf8_channel_name_size,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf8_channel_name",
+		 evtx_test_record_get_utf8_channel_name,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf16_channel_name_size",
+		 evtx_test_record_get_utf16_channel_name_size,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf16_channel_name",
+		 evtx_test_record_get_utf16_channel_name,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_process_identifier",
+		 evtx_test_record_get_process_identifier,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_thread_identifier",
+		 evtx_test_record_get_thread_identifier,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf8_activity_identifier_size",
+		 evtx_test_record_get_utf8_activity_identifier_size,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf8_activity_identifier",
+		 evtx_test_record_get_utf8_activity_identifier,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf16_activity_identifier_size",
+		 evtx_test_record_get_utf16_activity_identifier_size,
+		 record );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf16_activity_identifier",
+		 evtx_test_record_get_utf16_activity_identifier,
+		 record );
+
+		/* Clean up
+		 */
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file != NULL )
+	{
+		result = libevtx_file_close(
+		          file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_free(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
 	/* TODO: add tests for libevtx_record_get_offset */
 
+	/* TODO: add tests for libevtx_record_get_size */
+
 	/* TODO: add tests for libevtx_record_get_identifier */
 
 	/* TODO: add tests for libevtx_record_get_written_time */
@@ -112,6 +1612,10 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_event_level */
 
+	/* TODO: add tests for libevtx_record_get_event_version */
+
+	/* TODO: add tests for libevtx_record_get_provider_identifier */
+
 	/* TODO: add tests for libevtx_record_get_utf8_provider_identifier_size */
 
 	/* TODO: add tests for libevtx_record_get_utf8_provider_identifier */
@@ -136,6 +1640,12 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_utf16_computer_name */
 
+	/* TODO: add tests for libevtx_record_get_source_name_identifier */
+
+	/* TODO: add tests for libevtx_record_get_computer_name_identifier */
+
+	/* TODO: add tests for libevtx_record_get_channel_name_identifier */
+
 	/* TODO: add tests for libevtx_record_get_utf8_user_security_identifier_size */
 
 	/* TODO: add tests for libevtx_record_get_utf8_user_security_identifier */
@@ -152,14 +1662,26 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_utf8_string */
 
+	/* TODO: add tests for libevtx_record_get_utf8_string_size_by_name */
+
+	/* TODO: add tests for libevtx_record_get_utf8_string_by_name */
+
 	/* TODO: add tests for libevtx_record_get_utf16_string_size */
 
 	/* TODO: add tests for libevtx_record_get_utf16_string */
 
+	/* TODO: add tests for libevtx_record_get_utf8_string_name_size */
+
+	/* TODO: add tests for libevtx_record_get_utf8_string_name */
+
 	/* TODO: add tests for libevtx_record_get_data_size */
 
 	/* TODO: add tests for libevtx_record_get_data */
 
+	/* TODO: add tests for libevtx_record_get_data_reference */
+
+	/* TODO: add tests for libevtx_record_get_data_range */
+
 	/* TODO: add tests for libevtx_record_get_utf8_xml_string_size */
 
 	/* TODO: add tests for libevtx_record_get_utf8_xml_string */
@@ -173,6 +1695,29 @@ int main(
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
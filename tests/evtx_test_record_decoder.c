@@ -0,0 +1,695 @@
+/*
+ * Library record_decoder type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_chunk.h"
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_libfwevt.h"
+#include "../libevtx/libevtx_record_decoder.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_record_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_record_decoder_t *record_decoder = NULL;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          4,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_decoder",
+	 record_decoder );
+
+	result = libevtx_record_decoder_free(
+	          &record_decoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_decoder",
+	 record_decoder );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_initialize(
+	          NULL,
+	          65536,
+	          4,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_decoder = (libevtx_record_decoder_t *) 0x12345678UL;
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          4,
+	          2,
+	          &error );
+
+	record_decoder = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          0,
+	          4,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          0,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          LIBEVTX_MAXIMUM_BACKGROUND_DECODE_DEPTH + 1,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          4,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 &record_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_decoder_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_reset(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_record_decoder_t *record_decoder = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          4,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_decoder_reset(
+	          record_decoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "record_decoder->chunk_file_offset",
+	 (int64_t) record_decoder->chunk_file_offset,
+	 (int64_t) -1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_reset(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_decoder_free(
+	          &record_decoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 &record_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_decoder_schedule function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_schedule(
+     void )
+{
+	libevtx_chunk_t chunk;
+
+	libcerror_error_t *error                 = NULL;
+	libevtx_record_decoder_t *record_decoder = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          4,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          &chunk,
+	          0,
+	          sizeof( libevtx_chunk_t ) ) != NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_schedule(
+	          NULL,
+	          &chunk,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_schedule(
+	          record_decoder,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A chunk without data cannot be scheduled
+	 */
+	result = libevtx_record_decoder_schedule(
+	          record_decoder,
+	          &chunk,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_decoder_free(
+	          &record_decoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 &record_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_decoder_take_xml_document function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_take_xml_document(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_record_decoder_t *record_decoder = NULL;
+	libfwevt_xml_document_t *xml_document    = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          65536,
+	          4,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* No records were scheduled hence none were decoded ahead
+	 */
+	result = libevtx_record_decoder_take_xml_document(
+	          record_decoder,
+	          0,
+	          0,
+	          &xml_document,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_take_xml_document(
+	          NULL,
+	          0,
+	          0,
+	          &xml_document,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_take_xml_document(
+	          record_decoder,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	xml_document = (libfwevt_xml_document_t *) 0x12345678UL;
+
+	result = libevtx_record_decoder_take_xml_document(
+	          record_decoder,
+	          0,
+	          0,
+	          &xml_document,
+	          &error );
+
+	xml_document = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_decoder_free(
+	          &record_decoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 &record_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_initialize",
+	 evtx_test_record_decoder_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_free",
+	 evtx_test_record_decoder_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_reset",
+	 evtx_test_record_decoder_reset );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_schedule",
+	 evtx_test_record_decoder_schedule );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_take_xml_document",
+	 evtx_test_record_decoder_take_xml_document );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
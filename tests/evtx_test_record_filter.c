@@ -0,0 +1,958 @@
+/*
+ * Library record_filter type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_record_filter.h"
+#include "../libevtx/libevtx_system_values.h"
+
+uint8_t evtx_test_record_filter_provider_identifier[ 16 ] = {
+	0x7f, 0x3a, 0x5b, 0x55, 0x9c, 0x8c, 0x4d, 0x43, 0x8c, 0x3b, 0xd2, 0x48, 0x2f, 0x55, 0xb1, 0x0a };
+
+/* Security as an UTF-16 little-endian stream
+ */
+uint8_t evtx_test_record_filter_channel_name[ 16 ] = {
+	0x53, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00, 0x79, 0x00 };
+
+/* WKS-01 as an UTF-16 little-endian stream
+ */
+uint8_t evtx_test_record_filter_computer_name[ 12 ] = {
+	0x57, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x31, 0x00 };
+
+/* Tests the libevtx_record_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_filter_t *record_filter = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_filter = (libevtx_record_filter_t *) 0x12345678UL;
+
+	result = libevtx_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_filter = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_filter_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_record_filter_initialize(
+		          &record_filter,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( record_filter != NULL )
+			{
+				libevtx_record_filter_free(
+				 &record_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_filter",
+			 record_filter );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_filter_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_record_filter_initialize(
+		          &record_filter,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( record_filter != NULL )
+			{
+				libevtx_record_filter_free(
+				 &record_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_filter",
+			 record_filter );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libevtx_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_filter_append_event_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_append_event_identifier(
+     libevtx_record_filter_t *record_filter )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_filter_append_event_identifier(
+	          record_filter,
+	          4624,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_filter_append_event_identifier(
+	          record_filter,
+	          4625,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_append_event_identifier(
+	          NULL,
+	          4624,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_filter_set_event_level function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_set_event_level(
+     libevtx_record_filter_t *record_filter )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_filter_set_event_level(
+	          record_filter,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_set_event_level(
+	          NULL,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_filter_set_provider_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_set_provider_identifier(
+     libevtx_record_filter_t *record_filter )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_filter_set_provider_identifier(
+	          record_filter,
+	          evtx_test_record_filter_provider_identifier,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_set_provider_identifier(
+	          NULL,
+	          evtx_test_record_filter_provider_identifier,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_filter_set_provider_identifier(
+	          record_filter,
+	          NULL,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_filter_set_provider_identifier(
+	          record_filter,
+	          evtx_test_record_filter_provider_identifier,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_filter_set_utf8_channel_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_set_utf8_channel_name(
+     libevtx_record_filter_t *record_filter )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_filter_set_utf8_channel_name(
+	          record_filter,
+	          (uint8_t *) "security",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_set_utf8_channel_name(
+	          NULL,
+	          (uint8_t *) "security",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_filter_set_utf8_channel_name(
+	          record_filter,
+	          NULL,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_filter_set_utf8_channel_name(
+	          record_filter,
+	          (uint8_t *) "security",
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_filter_set_utf8_computer_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_set_utf8_computer_name(
+     libevtx_record_filter_t *record_filter )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_filter_set_utf8_computer_name(
+	          record_filter,
+	          (uint8_t *) "wks-01",
+	          6,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_set_utf8_computer_name(
+	          NULL,
+	          (uint8_t *) "wks-01",
+	          6,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_filter_set_utf8_computer_name(
+	          record_filter,
+	          NULL,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_filter_set_utf8_computer_name(
+	          record_filter,
+	          (uint8_t *) "wks-01",
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_record_filter_match_system_values function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_filter_match_system_values(
+     libevtx_record_filter_t *record_filter )
+{
+	libevtx_system_values_t system_values;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	system_values.event_identifier   = 4625;
+	system_values.event_level        = 4;
+	system_values.channel_name       = evtx_test_record_filter_channel_name;
+	system_values.channel_name_size  = 16;
+	system_values.computer_name      = evtx_test_record_filter_computer_name;
+	system_values.computer_name_size = 12;
+	system_values.flags              = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER
+	                                 | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL
+	                                 | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER
+	                                 | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME
+	                                 | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME;
+
+	memory_copy(
+	 system_values.provider_identifier,
+	 evtx_test_record_filter_provider_identifier,
+	 16 );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_filter_match_system_values(
+	          (libevtx_internal_record_filter_t *) record_filter,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	system_values.event_identifier = 4634;
+
+	result = libevtx_record_filter_match_system_values(
+	          (libevtx_internal_record_filter_t *) record_filter,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	system_values.event_identifier = 4625;
+	system_values.flags           &= ~( LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME );
+
+	result = libevtx_record_filter_match_system_values(
+	          (libevtx_internal_record_filter_t *) record_filter,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	system_values.event_identifier = 4624;
+	system_values.flags           &= ~( LIBEVTX_SYSTEM_VALUES_FLAG_HAS_CHANNEL_NAME );
+
+	result = libevtx_record_filter_match_system_values(
+	          (libevtx_internal_record_filter_t *) record_filter,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_filter_match_system_values(
+	          NULL,
+	          &system_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_filter_match_system_values(
+	          (libevtx_internal_record_filter_t *) record_filter,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_filter_t *record_filter = NULL;
+	int result                             = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_filter_initialize",
+	 evtx_test_record_filter_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_filter_free",
+	 evtx_test_record_filter_free );
+
+	/* Initialize record filter for tests
+	 */
+	result = libevtx_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_record_filter_append_event_identifier",
+	 evtx_test_record_filter_append_event_identifier,
+	 record_filter );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_record_filter_set_event_level",
+	 evtx_test_record_filter_set_event_level,
+	 record_filter );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_record_filter_set_provider_identifier",
+	 evtx_test_record_filter_set_provider_identifier,
+	 record_filter );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_record_filter_set_utf8_channel_name",
+	 evtx_test_record_filter_set_utf8_channel_name,
+	 record_filter );
+
+	/* TODO: add tests for libevtx_record_filter_set_utf16_channel_name */
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_record_filter_set_utf8_computer_name",
+	 evtx_test_record_filter_set_utf8_computer_name,
+	 record_filter );
+
+	/* TODO: add tests for libevtx_record_filter_set_utf16_computer_name */
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_record_filter_match_system_values",
+	 evtx_test_record_filter_match_system_values,
+	 record_filter );
+
+	/* TODO: add tests for libevtx_record_filter_match_record_values */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libevtx_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libevtx_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,8 +34,42 @@
 #include "evtx_test_memory.h"
 #include "evtx_test_unused.h"
 
+#include "../libevtx/libevtx_definitions.h"
 #include "../libevtx/libevtx_record_values.h"
 
+uint8_t evtx_test_record_values_system_data1[ 493 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x34, 0x12,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x0f, 0x01,
+	0x01, 0x00, 0x01, 0xff, 0xff, 0x78, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00,
+	0x00, 0x02, 0x01, 0xff, 0xff, 0x0b, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d,
+	0x00, 0x00, 0x00, 0x02, 0x41, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x69,
+	0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x46, 0xb2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x05, 0x01, 0x04, 0x00, 0x54, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x06, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x47, 0x00, 0x75,
+	0x00, 0x69, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0f, 0x03, 0x01, 0xff, 0xff, 0x22,
+	0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x45,
+	0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x49, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02,
+	0x0d, 0x01, 0x00, 0x06, 0x04, 0x01, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x02, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x32, 0x00, 0x00,
+	0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x43, 0x00, 0x68,
+	0x00, 0x61, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01,
+	0x08, 0x00, 0x53, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00,
+	0x79, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74,
+	0x00, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x01, 0xff, 0xff, 0x1c,
+	0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x44,
+	0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x03, 0x00, 0x01, 0x04, 0x04,
+	0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x02, 0x00, 0x06, 0x00, 0x01, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3a, 0x5b, 0x55, 0x9c, 0x8c, 0x4d, 0x43, 0x8c, 0x3b,
+	0xd2, 0x48, 0x2f, 0x55, 0xb1, 0x0a, 0x10, 0x12, 0x04, 0xed, 0x01, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
 /* Tests the libevtx_record_values_initialize function
@@ -416,22 +451,45 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_event_identifier function
+/* Tests the libevtx_record_values_check_header function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_event_identifier(
+int evtx_test_record_values_check_header(
      void )
 {
-	libcerror_error_t *error               = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	uint32_t event_identifier              = 0;
-	int event_identifier_is_set            = 0;
-	int result                             = 0;
+	uint8_t chunk_data[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	void *memcpy_result      = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libevtx_record_values_initialize(
-	          &record_values,
+	memset_result = memory_set(
+	                 chunk_data,
+	                 0,
+	                 512 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memcpy_result = memory_copy(
+	                 chunk_data,
+	                 evtx_test_record_values_system_data1,
+	                 493 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_check_header(
+	          chunk_data,
+	          512,
+	          0,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -439,37 +497,92 @@ int evtx_test_record_values_get_event_identifier(
 	 result,
 	 1 );
 
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
-	 "record_values",
-	 record_values );
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a candidate without an event record signature
+	 */
+	result = libevtx_record_values_check_header(
+	          chunk_data,
+	          512,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test a candidate with a size that exceeds the chunk data
 	 */
-	result = libevtx_record_values_get_event_identifier(
-	          record_values,
-	          &event_identifier,
+	result = libevtx_record_values_check_header(
+	          chunk_data,
+	          493,
+	          0,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	event_identifier_is_set = result;
+	/* Test a candidate with a mismatching size copy
+	 */
+	chunk_data[ 489 ] = 0xff;
+
+	result = libevtx_record_values_check_header(
+	          chunk_data,
+	          512,
+	          0,
+	          &error );
+
+	chunk_data[ 489 ] = 0xed;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a candidate with an identifier of 0
+	 */
+	chunk_data[ 8 ] = 0x00;
+
+	result = libevtx_record_values_check_header(
+	          chunk_data,
+	          512,
+	          0,
+	          &error );
+
+	chunk_data[ 8 ] = 0x01;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_event_identifier(
+	result = libevtx_record_values_check_header(
 	          NULL,
-	          &event_identifier,
+	          512,
+	          0,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -484,44 +597,24 @@ int evtx_test_record_values_get_event_identifier(
 	libcerror_error_free(
 	 &error );
 
-	if( event_identifier_is_set != 0 )
-	{
-		result = libevtx_record_values_get_event_identifier(
-		          record_values,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
-	result = libevtx_record_values_free(
-	          &record_values,
+	result = libevtx_record_values_check_header(
+	          chunk_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "record_values",
-	 record_values );
+	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -530,26 +623,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( record_values != NULL )
-	{
-		libevtx_record_values_free(
-		 &record_values,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_event_identifier_qualifiers function
+/* Tests the libevtx_record_values_read_system_values function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_event_identifier_qualifiers(
+int evtx_test_record_values_read_system_values(
      void )
 {
-	libcerror_error_t *error               = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	uint32_t event_identifier_qualifiers   = 0;
-	int event_identifier_qualifiers_is_set = 0;
-	int result                             = 0;
+	libcerror_error_t *error                           = NULL;
+	libevtx_record_values_t *destination_record_values = NULL;
+	libevtx_record_values_t *record_values             = NULL;
+	uint32_t event_identifier                          = 0;
+	uint8_t event_level                                = 0;
+	int result                                         = 0;
 
 	/* Initialize test
 	 */
@@ -570,29 +658,142 @@ int evtx_test_record_values_get_event_identifier_qualifiers(
 	 "error",
 	 error );
 
+	record_values->chunk_data_offset = 0;
+	record_values->data_size         = 493;
+
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_event_identifier_qualifiers(
+	result = libevtx_record_values_read_system_values(
 	          record_values,
-	          &event_identifier_qualifiers,
+	          NULL,
+	          NULL,
+	          evtx_test_record_values_system_data1,
+	          493,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	event_identifier_qualifiers_is_set = result;
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values->channel_name_data",
+	 record_values->channel_name_data );
+
+	result = libevtx_record_values_has_system_values(
+	          record_values,
+	          0x03 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_record_values_has_system_values(
+	          record_values,
+	          0x10 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The event identifier and level are retrieved without the XML document
+	 */
+	result = libevtx_record_values_get_event_identifier(
+	          record_values,
+	          &event_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "event_identifier",
+	 event_identifier,
+	 4624 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_get_event_level(
+	          record_values,
+	          &event_level,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "event_level",
+	 (int) event_level,
+	 4 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the clone has its own copy of the channel name
+	 */
+	result = libevtx_record_values_clone(
+	          &destination_record_values,
+	          record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_record_values",
+	 destination_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_record_values->system_values.channel_name",
+	 destination_record_values->system_values.channel_name );
+
+	result = ( destination_record_values->system_values.channel_name != record_values->system_values.channel_name );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_record_values_free(
+	          &destination_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_event_identifier_qualifiers(
+	result = libevtx_record_values_read_system_values(
 	          NULL,
-	          &event_identifier_qualifiers,
+	          NULL,
+	          NULL,
+	          evtx_test_record_values_system_data1,
+	          493,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -607,25 +808,6 @@ int evtx_test_record_values_get_event_identifier_qualifiers(
 	libcerror_error_free(
 	 &error );
 
-	if( event_identifier_qualifiers_is_set != 0 )
-	{
-		result = libevtx_record_values_get_event_identifier_qualifiers(
-		          record_values,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -653,6 +835,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( destination_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &destination_record_values,
+		 NULL );
+	}
 	if( record_values != NULL )
 	{
 		libevtx_record_values_free(
@@ -662,16 +850,14 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_event_level function
+/* Tests the libevtx_record_values_resolve_system_xml_tags function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_event_level(
+int evtx_test_record_values_resolve_system_xml_tags(
      void )
 {
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
-	uint8_t event_level                    = 0;
-	int event_level_is_set                 = 0;
 	int result                             = 0;
 
 	/* Initialize test
@@ -693,29 +879,28 @@ int evtx_test_record_values_get_event_level(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libevtx_record_values_get_event_level(
-	          record_values,
-	          &event_level,
+	result = libevtx_record_values_resolve_system_xml_tags(
+	          NULL,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	event_level_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test with record values without a XML document
 	 */
-	result = libevtx_record_values_get_event_level(
-	          NULL,
-	          &event_level,
+	result = libevtx_record_values_resolve_system_xml_tags(
+	          record_values,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -730,25 +915,6 @@ int evtx_test_record_values_get_event_level(
 	libcerror_error_free(
 	 &error );
 
-	if( event_level_is_set != 0 )
-	{
-		result = libevtx_record_values_get_event_level(
-		          record_values,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -785,17 +951,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf8_provider_identifier_size function
+/* Tests the libevtx_record_values_decode_system_scalars function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf8_provider_identifier_size(
+int evtx_test_record_values_decode_system_scalars(
      void )
 {
-	libcerror_error_t *error                 = NULL;
-	libevtx_record_values_t *record_values   = NULL;
-	size_t utf8_provider_identifier_size     = 0;
-	int result                               = 0;
-	int utf8_provider_identifier_size_is_set = 0;
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
 
 	/* Initialize test
 	 */
@@ -818,27 +982,32 @@ int evtx_test_record_values_get_utf8_provider_identifier_size(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf8_provider_identifier_size(
+	record_values->system_scalars.flags = LIBEVTX_SYSTEM_SCALARS_FLAG_HAS_EVENT_LEVEL;
+
+	result = libevtx_record_values_decode_system_scalars(
 	          record_values,
-	          &utf8_provider_identifier_size,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	utf8_provider_identifier_size_is_set = result;
+	/* Without resolved System XML elements no values are decoded
+	 */
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_values->system_scalars.flags",
+	 (int) record_values->system_scalars.flags,
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf8_provider_identifier_size(
+	result = libevtx_record_values_decode_system_scalars(
 	          NULL,
-	          &utf8_provider_identifier_size,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -853,25 +1022,6 @@ int evtx_test_record_values_get_utf8_provider_identifier_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_provider_identifier_size_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf8_provider_identifier_size(
-		          record_values,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -908,18 +1058,17 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf8_provider_identifier function
+/* Tests the libevtx_record_values_get_event_identifier function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf8_provider_identifier(
+int evtx_test_record_values_get_event_identifier(
      void )
 {
-	uint8_t utf8_provider_identifier[ 512 ];
-
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
+	uint32_t event_identifier              = 0;
+	int event_identifier_is_set            = 0;
 	int result                             = 0;
-	int utf8_provider_identifier_is_set    = 0;
 
 	/* Initialize test
 	 */
@@ -942,10 +1091,9 @@ int evtx_test_record_values_get_utf8_provider_identifier(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf8_provider_identifier(
+	result = libevtx_record_values_get_event_identifier(
 	          record_values,
-	          utf8_provider_identifier,
-	          512,
+	          &event_identifier,
 	          &error );
 
 	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
@@ -957,14 +1105,13 @@ int evtx_test_record_values_get_utf8_provider_identifier(
 	 "error",
 	 error );
 
-	utf8_provider_identifier_is_set = result;
+	event_identifier_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf8_provider_identifier(
+	result = libevtx_record_values_get_event_identifier(
 	          NULL,
-	          utf8_provider_identifier,
-	          512,
+	          &event_identifier,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -979,48 +1126,11 @@ int evtx_test_record_values_get_utf8_provider_identifier(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_provider_identifier_is_set != 0 )
+	if( event_identifier_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf8_provider_identifier(
+		result = libevtx_record_values_get_event_identifier(
 		          record_values,
 		          NULL,
-		          512,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf8_provider_identifier(
-		          record_values,
-		          utf8_provider_identifier,
-		          0,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf8_provider_identifier(
-		          record_values,
-		          utf8_provider_identifier,
-		          (size_t) SSIZE_MAX + 1,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1071,17 +1181,17 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_provider_identifier_size function
+/* Tests the libevtx_record_values_get_event_identifier_qualifiers function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_provider_identifier_size(
+int evtx_test_record_values_get_event_identifier_qualifiers(
      void )
 {
-	libcerror_error_t *error                  = NULL;
-	libevtx_record_values_t *record_values    = NULL;
-	size_t utf16_provider_identifier_size     = 0;
-	int result                                = 0;
-	int utf16_provider_identifier_size_is_set = 0;
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	uint32_t event_identifier_qualifiers   = 0;
+	int event_identifier_qualifiers_is_set = 0;
+	int result                             = 0;
 
 	/* Initialize test
 	 */
@@ -1104,9 +1214,9 @@ int evtx_test_record_values_get_utf16_provider_identifier_size(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf16_provider_identifier_size(
+	result = libevtx_record_values_get_event_identifier_qualifiers(
 	          record_values,
-	          &utf16_provider_identifier_size,
+	          &event_identifier_qualifiers,
 	          &error );
 
 	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1118,13 +1228,13 @@ int evtx_test_record_values_get_utf16_provider_identifier_size(
 	 "error",
 	 error );
 
-	utf16_provider_identifier_size_is_set = result;
+	event_identifier_qualifiers_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_provider_identifier_size(
+	result = libevtx_record_values_get_event_identifier_qualifiers(
 	          NULL,
-	          &utf16_provider_identifier_size,
+	          &event_identifier_qualifiers,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1139,9 +1249,9 @@ int evtx_test_record_values_get_utf16_provider_identifier_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_provider_identifier_size_is_set != 0 )
+	if( event_identifier_qualifiers_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf16_provider_identifier_size(
+		result = libevtx_record_values_get_event_identifier_qualifiers(
 		          record_values,
 		          NULL,
 		          &error );
@@ -1194,18 +1304,17 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_provider_identifier function
+/* Tests the libevtx_record_values_get_event_level function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_provider_identifier(
+int evtx_test_record_values_get_event_level(
      void )
 {
-	uint16_t utf16_provider_identifier[ 512 ];
-
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
+	uint8_t event_level                    = 0;
+	int event_level_is_set                 = 0;
 	int result                             = 0;
-	int utf16_provider_identifier_is_set   = 0;
 
 	/* Initialize test
 	 */
@@ -1228,10 +1337,9 @@ int evtx_test_record_values_get_utf16_provider_identifier(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf16_provider_identifier(
+	result = libevtx_record_values_get_event_level(
 	          record_values,
-	          utf16_provider_identifier,
-	          512,
+	          &event_level,
 	          &error );
 
 	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1243,14 +1351,13 @@ int evtx_test_record_values_get_utf16_provider_identifier(
 	 "error",
 	 error );
 
-	utf16_provider_identifier_is_set = result;
+	event_level_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_provider_identifier(
+	result = libevtx_record_values_get_event_level(
 	          NULL,
-	          utf16_provider_identifier,
-	          512,
+	          &event_level,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1265,48 +1372,11 @@ int evtx_test_record_values_get_utf16_provider_identifier(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_provider_identifier_is_set != 0 )
+	if( event_level_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf16_provider_identifier(
+		result = libevtx_record_values_get_event_level(
 		          record_values,
 		          NULL,
-		          512,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf16_provider_identifier(
-		          record_values,
-		          utf16_provider_identifier,
-		          0,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf16_provider_identifier(
-		          record_values,
-		          utf16_provider_identifier,
-		          (size_t) SSIZE_MAX + 1,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1357,17 +1427,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf8_source_name_size function
+/* Tests the libevtx_record_values_get_task function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf8_source_name_size(
+int evtx_test_record_values_get_task(
      void )
 {
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
-	size_t utf8_source_name_size           = 0;
+	uint16_t task                          = 0;
 	int result                             = 0;
-	int utf8_source_name_size_is_set       = 0;
 
 	/* Initialize test
 	 */
@@ -1388,29 +1457,30 @@ int evtx_test_record_values_get_utf8_source_name_size(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf8_source_name_size(
-	          record_values,
-	          &utf8_source_name_size,
+	result = libevtx_record_values_get_task(
+	          NULL,
+	          &task,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	utf8_source_name_size_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test with record values without a XML document
 	 */
-	result = libevtx_record_values_get_utf8_source_name_size(
-	          NULL,
-	          &utf8_source_name_size,
+	result = libevtx_record_values_get_task(
+	          record_values,
+	          &task,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1425,25 +1495,6 @@ int evtx_test_record_values_get_utf8_source_name_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_source_name_size_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf8_source_name_size(
-		          record_values,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -1480,18 +1531,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf8_source_name function
+/* Tests the libevtx_record_values_get_opcode function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf8_source_name(
+int evtx_test_record_values_get_opcode(
      void )
 {
-	uint8_t utf8_source_name[ 512 ];
-
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
+	uint8_t opcode                         = 0;
 	int result                             = 0;
-	int utf8_source_name_is_set            = 0;
 
 	/* Initialize test
 	 */
@@ -1512,31 +1561,30 @@ int evtx_test_record_values_get_utf8_source_name(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf8_source_name(
-	          record_values,
-	          utf8_source_name,
-	          512,
+	result = libevtx_record_values_get_opcode(
+	          NULL,
+	          &opcode,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	utf8_source_name_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test with record values without a XML document
 	 */
-	result = libevtx_record_values_get_utf8_source_name(
-	          NULL,
-	          utf8_source_name,
-	          512,
+	result = libevtx_record_values_get_opcode(
+	          record_values,
+	          &opcode,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1551,62 +1599,6 @@ int evtx_test_record_values_get_utf8_source_name(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_source_name_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf8_source_name(
-		          record_values,
-		          NULL,
-		          512,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf8_source_name(
-		          record_values,
-		          utf8_source_name,
-		          0,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf8_source_name(
-		          record_values,
-		          utf8_source_name,
-		          (size_t) SSIZE_MAX + 1,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -1643,17 +1635,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_source_name_size function
+/* Tests the libevtx_record_values_get_keywords function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_source_name_size(
+int evtx_test_record_values_get_keywords(
      void )
 {
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
-	size_t utf16_source_name_size          = 0;
+	uint64_t keywords                      = 0;
 	int result                             = 0;
-	int utf16_source_name_size_is_set      = 0;
 
 	/* Initialize test
 	 */
@@ -1674,29 +1665,30 @@ int evtx_test_record_values_get_utf16_source_name_size(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_source_name_size(
-	          record_values,
-	          &utf16_source_name_size,
+	result = libevtx_record_values_get_keywords(
+	          NULL,
+	          &keywords,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	utf16_source_name_size_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test with record values without a XML document
 	 */
-	result = libevtx_record_values_get_utf16_source_name_size(
-	          NULL,
-	          &utf16_source_name_size,
+	result = libevtx_record_values_get_keywords(
+	          record_values,
+	          &keywords,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1711,25 +1703,6 @@ int evtx_test_record_values_get_utf16_source_name_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_source_name_size_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf16_source_name_size(
-		          record_values,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -1766,18 +1739,17 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_source_name function
+/* Tests the libevtx_record_values_get_event_version function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_source_name(
+int evtx_test_record_values_get_event_version(
      void )
 {
-	uint16_t utf16_source_name[ 512 ];
-
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
+	uint8_t event_version                  = 0;
+	int event_version_is_set               = 0;
 	int result                             = 0;
-	int utf16_source_name_is_set           = 0;
 
 	/* Initialize test
 	 */
@@ -1800,10 +1772,9 @@ int evtx_test_record_values_get_utf16_source_name(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf16_source_name(
+	result = libevtx_record_values_get_event_version(
 	          record_values,
-	          utf16_source_name,
-	          512,
+	          &event_version,
 	          &error );
 
 	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1815,14 +1786,13 @@ int evtx_test_record_values_get_utf16_source_name(
 	 "error",
 	 error );
 
-	utf16_source_name_is_set = result;
+	event_version_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_source_name(
+	result = libevtx_record_values_get_event_version(
 	          NULL,
-	          utf16_source_name,
-	          512,
+	          &event_version,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1837,48 +1807,11 @@ int evtx_test_record_values_get_utf16_source_name(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_source_name_is_set != 0 )
+	if( event_version_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf16_source_name(
+		result = libevtx_record_values_get_event_version(
 		          record_values,
 		          NULL,
-		          512,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf16_source_name(
-		          record_values,
-		          utf16_source_name,
-		          0,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf16_source_name(
-		          record_values,
-		          utf16_source_name,
-		          (size_t) SSIZE_MAX + 1,
 		          &error );
 
 		EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1929,17 +1862,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf8_computer_name_size function
+/* Tests the libevtx_record_values_get_provider_identifier function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf8_computer_name_size(
+int evtx_test_record_values_get_provider_identifier(
      void )
 {
+	uint8_t expected_provider_identifier[ 16 ] = {
+		0x7f, 0x3a, 0x5b, 0x55, 0x9c, 0x8c, 0x4d, 0x43, 0x8c, 0x3b, 0xd2, 0x48, 0x2f, 0x55, 0xb1, 0x0a };
+
+	uint8_t provider_identifier[ 16 ];
+
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
-	size_t utf8_computer_name_size         = 0;
 	int result                             = 0;
-	int utf8_computer_name_size_is_set     = 0;
 
 	/* Initialize test
 	 */
@@ -1960,29 +1896,59 @@ int evtx_test_record_values_get_utf8_computer_name_size(
 	 "error",
 	 error );
 
+	record_values->chunk_data_offset = 0;
+	record_values->data_size         = 493;
+
+	result = libevtx_record_values_read_system_values(
+	          record_values,
+	          NULL,
+	          NULL,
+	          evtx_test_record_values_system_data1,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf8_computer_name_size(
+	result = libevtx_record_values_get_provider_identifier(
 	          record_values,
-	          &utf8_computer_name_size,
+	          provider_identifier,
+	          16,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	utf8_computer_name_size_is_set = result;
+	result = memory_compare(
+	          provider_identifier,
+	          expected_provider_identifier,
+	          16 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf8_computer_name_size(
+	result = libevtx_record_values_get_provider_identifier(
 	          NULL,
-	          &utf8_computer_name_size,
+	          provider_identifier,
+	          16,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1997,118 +1963,28 @@ int evtx_test_record_values_get_utf8_computer_name_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_computer_name_size_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf8_computer_name_size(
-		          record_values,
-		          NULL,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
-	result = libevtx_record_values_free(
-	          &record_values,
+	result = libevtx_record_values_get_provider_identifier(
+	          record_values,
+	          NULL,
+	          16,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "record_values",
-	 record_values );
+	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	libcerror_error_free(
+	 &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( record_values != NULL )
-	{
-		libevtx_record_values_free(
-		 &record_values,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libevtx_record_values_get_utf8_computer_name function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_record_values_get_utf8_computer_name(
-     void )
-{
-	uint8_t utf8_computer_name[ 512 ];
-
-	libcerror_error_t *error               = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	int result                             = 0;
-	int utf8_computer_name_is_set          = 0;
-
-	/* Initialize test
-	 */
-	result = libevtx_record_values_initialize(
-	          &record_values,
-	          &error );
-
-	EVTX_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
-	 "record_values",
-	 record_values );
-
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test regular cases
-	 */
-	result = libevtx_record_values_get_utf8_computer_name(
+	result = libevtx_record_values_get_provider_identifier(
 	          record_values,
-	          utf8_computer_name,
-	          512,
-	          &error );
-
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	utf8_computer_name_is_set = result;
-
-	/* Test error cases
-	 */
-	result = libevtx_record_values_get_utf8_computer_name(
-	          NULL,
-	          utf8_computer_name,
-	          512,
+	          provider_identifier,
+	          15,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -2123,62 +1999,6 @@ int evtx_test_record_values_get_utf8_computer_name(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_computer_name_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf8_computer_name(
-		          record_values,
-		          NULL,
-		          512,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf8_computer_name(
-		          record_values,
-		          utf8_computer_name,
-		          0,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf8_computer_name(
-		          record_values,
-		          utf8_computer_name,
-		          (size_t) SSIZE_MAX + 1,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -2215,17 +2035,17 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_computer_name_size function
+/* Tests the libevtx_record_values_get_utf8_provider_identifier_size function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_computer_name_size(
+int evtx_test_record_values_get_utf8_provider_identifier_size(
      void )
 {
-	libcerror_error_t *error               = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	size_t utf16_computer_name_size        = 0;
-	int result                             = 0;
-	int utf16_computer_name_size_is_set    = 0;
+	libcerror_error_t *error                 = NULL;
+	libevtx_record_values_t *record_values   = NULL;
+	size_t utf8_provider_identifier_size     = 0;
+	int result                               = 0;
+	int utf8_provider_identifier_size_is_set = 0;
 
 	/* Initialize test
 	 */
@@ -2248,9 +2068,9 @@ int evtx_test_record_values_get_utf16_computer_name_size(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf16_computer_name_size(
+	result = libevtx_record_values_get_utf8_provider_identifier_size(
 	          record_values,
-	          &utf16_computer_name_size,
+	          &utf8_provider_identifier_size,
 	          &error );
 
 	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
@@ -2262,13 +2082,13 @@ int evtx_test_record_values_get_utf16_computer_name_size(
 	 "error",
 	 error );
 
-	utf16_computer_name_size_is_set = result;
+	utf8_provider_identifier_size_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_computer_name_size(
+	result = libevtx_record_values_get_utf8_provider_identifier_size(
 	          NULL,
-	          &utf16_computer_name_size,
+	          &utf8_provider_identifier_size,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -2283,9 +2103,9 @@ int evtx_test_record_values_get_utf16_computer_name_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_computer_name_size_is_set != 0 )
+	if( utf8_provider_identifier_size_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf16_computer_name_size(
+		result = libevtx_record_values_get_utf8_provider_identifier_size(
 		          record_values,
 		          NULL,
 		          &error );
@@ -2338,18 +2158,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_computer_name function
+/* Tests the libevtx_record_values_get_utf8_provider_identifier function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_computer_name(
+int evtx_test_record_values_get_utf8_provider_identifier(
      void )
 {
-	uint16_t utf16_computer_name[ 512 ];
+	uint8_t utf8_provider_identifier[ 512 ];
 
 	libcerror_error_t *error               = NULL;
 	libevtx_record_values_t *record_values = NULL;
 	int result                             = 0;
-	int utf16_computer_name_is_set         = 0;
+	int utf8_provider_identifier_is_set    = 0;
 
 	/* Initialize test
 	 */
@@ -2372,9 +2192,9 @@ int evtx_test_record_values_get_utf16_computer_name(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf16_computer_name(
+	result = libevtx_record_values_get_utf8_provider_identifier(
 	          record_values,
-	          utf16_computer_name,
+	          utf8_provider_identifier,
 	          512,
 	          &error );
 
@@ -2387,13 +2207,13 @@ int evtx_test_record_values_get_utf16_computer_name(
 	 "error",
 	 error );
 
-	utf16_computer_name_is_set = result;
+	utf8_provider_identifier_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_computer_name(
+	result = libevtx_record_values_get_utf8_provider_identifier(
 	          NULL,
-	          utf16_computer_name,
+	          utf8_provider_identifier,
 	          512,
 	          &error );
 
@@ -2409,9 +2229,9 @@ int evtx_test_record_values_get_utf16_computer_name(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_computer_name_is_set != 0 )
+	if( utf8_provider_identifier_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf16_computer_name(
+		result = libevtx_record_values_get_utf8_provider_identifier(
 		          record_values,
 		          NULL,
 		          512,
@@ -2429,9 +2249,9 @@ int evtx_test_record_values_get_utf16_computer_name(
 		libcerror_error_free(
 		 &error );
 
-		result = libevtx_record_values_get_utf16_computer_name(
+		result = libevtx_record_values_get_utf8_provider_identifier(
 		          record_values,
-		          utf16_computer_name,
+		          utf8_provider_identifier,
 		          0,
 		          &error );
 
@@ -2447,9 +2267,9 @@ int evtx_test_record_values_get_utf16_computer_name(
 		libcerror_error_free(
 		 &error );
 
-		result = libevtx_record_values_get_utf16_computer_name(
+		result = libevtx_record_values_get_utf8_provider_identifier(
 		          record_values,
-		          utf16_computer_name,
+		          utf8_provider_identifier,
 		          (size_t) SSIZE_MAX + 1,
 		          &error );
 
@@ -2501,17 +2321,17 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf8_user_security_identifier_size function
+/* Tests the libevtx_record_values_get_utf16_provider_identifier_size function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf8_user_security_identifier_size(
+int evtx_test_record_values_get_utf16_provider_identifier_size(
      void )
 {
-	libcerror_error_t *error                      = NULL;
-	libevtx_record_values_t *record_values        = NULL;
-	size_t utf8_user_security_identifier_size     = 0;
-	int result                                    = 0;
-	int utf8_user_security_identifier_size_is_set = 0;
+	libcerror_error_t *error                  = NULL;
+	libevtx_record_values_t *record_values    = NULL;
+	size_t utf16_provider_identifier_size     = 0;
+	int result                                = 0;
+	int utf16_provider_identifier_size_is_set = 0;
 
 	/* Initialize test
 	 */
@@ -2534,9 +2354,9 @@ int evtx_test_record_values_get_utf8_user_security_identifier_size(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf8_user_security_identifier_size(
+	result = libevtx_record_values_get_utf16_provider_identifier_size(
 	          record_values,
-	          &utf8_user_security_identifier_size,
+	          &utf16_provider_identifier_size,
 	          &error );
 
 	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
@@ -2548,13 +2368,13 @@ int evtx_test_record_values_get_utf8_user_security_identifier_size(
 	 "error",
 	 error );
 
-	utf8_user_security_identifier_size_is_set = result;
+	utf16_provider_identifier_size_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf8_user_security_identifier_size(
+	result = libevtx_record_values_get_utf16_provider_identifier_size(
 	          NULL,
-	          &utf8_user_security_identifier_size,
+	          &utf16_provider_identifier_size,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -2569,9 +2389,9 @@ int evtx_test_record_values_get_utf8_user_security_identifier_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_user_security_identifier_size_is_set != 0 )
+	if( utf16_provider_identifier_size_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf8_user_security_identifier_size(
+		result = libevtx_record_values_get_utf16_provider_identifier_size(
 		          record_values,
 		          NULL,
 		          &error );
@@ -2624,18 +2444,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf8_user_security_identifier function
+/* Tests the libevtx_record_values_get_utf16_provider_identifier function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf8_user_security_identifier(
+int evtx_test_record_values_get_utf16_provider_identifier(
      void )
 {
-	uint8_t utf8_user_security_identifier[ 512 ];
+	uint16_t utf16_provider_identifier[ 512 ];
 
-	libcerror_error_t *error                 = NULL;
-	libevtx_record_values_t *record_values   = NULL;
-	int result                               = 0;
-	int utf8_user_security_identifier_is_set = 0;
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+	int utf16_provider_identifier_is_set   = 0;
 
 	/* Initialize test
 	 */
@@ -2658,9 +2478,9 @@ int evtx_test_record_values_get_utf8_user_security_identifier(
 
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf8_user_security_identifier(
+	result = libevtx_record_values_get_utf16_provider_identifier(
 	          record_values,
-	          utf8_user_security_identifier,
+	          utf16_provider_identifier,
 	          512,
 	          &error );
 
@@ -2673,13 +2493,13 @@ int evtx_test_record_values_get_utf8_user_security_identifier(
 	 "error",
 	 error );
 
-	utf8_user_security_identifier_is_set = result;
+	utf16_provider_identifier_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf8_user_security_identifier(
+	result = libevtx_record_values_get_utf16_provider_identifier(
 	          NULL,
-	          utf8_user_security_identifier,
+	          utf16_provider_identifier,
 	          512,
 	          &error );
 
@@ -2695,9 +2515,9 @@ int evtx_test_record_values_get_utf8_user_security_identifier(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_user_security_identifier_is_set != 0 )
+	if( utf16_provider_identifier_is_set != 0 )
 	{
-		result = libevtx_record_values_get_utf8_user_security_identifier(
+		result = libevtx_record_values_get_utf16_provider_identifier(
 		          record_values,
 		          NULL,
 		          512,
@@ -2715,9 +2535,9 @@ int evtx_test_record_values_get_utf8_user_security_identifier(
 		libcerror_error_free(
 		 &error );
 
-		result = libevtx_record_values_get_utf8_user_security_identifier(
+		result = libevtx_record_values_get_utf16_provider_identifier(
 		          record_values,
-		          utf8_user_security_identifier,
+		          utf16_provider_identifier,
 		          0,
 		          &error );
 
@@ -2733,24 +2553,3165 @@ int evtx_test_record_values_get_utf8_user_security_identifier(
 		libcerror_error_free(
 		 &error );
 
-		result = libevtx_record_values_get_utf8_user_security_identifier(
+		result = libevtx_record_values_get_utf16_provider_identifier(
 		          record_values,
-		          utf8_user_security_identifier,
+		          utf16_provider_identifier,
 		          (size_t) SSIZE_MAX + 1,
 		          &error );
 
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_source_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_source_name_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf8_source_name_size           = 0;
+	int result                             = 0;
+	int utf8_source_name_size_is_set       = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf8_source_name_size(
+	          record_values,
+	          &utf8_source_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_source_name_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_source_name_size(
+	          NULL,
+	          &utf8_source_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_source_name_size_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf8_source_name_size(
+		          record_values,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_source_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_source_name(
+     void )
+{
+	uint8_t utf8_source_name[ 512 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+	int utf8_source_name_is_set            = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf8_source_name(
+	          record_values,
+	          utf8_source_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_source_name_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_source_name(
+	          NULL,
+	          utf8_source_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_source_name_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf8_source_name(
+		          record_values,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf8_source_name(
+		          record_values,
+		          utf8_source_name,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf8_source_name(
+		          record_values,
+		          utf8_source_name,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_source_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_source_name_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf16_source_name_size          = 0;
+	int result                             = 0;
+	int utf16_source_name_size_is_set      = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf16_source_name_size(
+	          record_values,
+	          &utf16_source_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_source_name_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_source_name_size(
+	          NULL,
+	          &utf16_source_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_source_name_size_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf16_source_name_size(
+		          record_values,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_source_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_source_name(
+     void )
+{
+	uint16_t utf16_source_name[ 512 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+	int utf16_source_name_is_set           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf16_source_name(
+	          record_values,
+	          utf16_source_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_source_name_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_source_name(
+	          NULL,
+	          utf16_source_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_source_name_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf16_source_name(
+		          record_values,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf16_source_name(
+		          record_values,
+		          utf16_source_name,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf16_source_name(
+		          record_values,
+		          utf16_source_name,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_computer_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_computer_name_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf8_computer_name_size         = 0;
+	int result                             = 0;
+	int utf8_computer_name_size_is_set     = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf8_computer_name_size(
+	          record_values,
+	          &utf8_computer_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_computer_name_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_computer_name_size(
+	          NULL,
+	          &utf8_computer_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_computer_name_size_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf8_computer_name_size(
+		          record_values,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_computer_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_computer_name(
+     void )
+{
+	uint8_t utf8_computer_name[ 512 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+	int utf8_computer_name_is_set          = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf8_computer_name(
+	          record_values,
+	          utf8_computer_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_computer_name_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_computer_name(
+	          NULL,
+	          utf8_computer_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_computer_name_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf8_computer_name(
+		          record_values,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf8_computer_name(
+		          record_values,
+		          utf8_computer_name,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf8_computer_name(
+		          record_values,
+		          utf8_computer_name,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_computer_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_computer_name_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf16_computer_name_size        = 0;
+	int result                             = 0;
+	int utf16_computer_name_size_is_set    = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf16_computer_name_size(
+	          record_values,
+	          &utf16_computer_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_computer_name_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_computer_name_size(
+	          NULL,
+	          &utf16_computer_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_computer_name_size_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf16_computer_name_size(
+		          record_values,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_computer_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_computer_name(
+     void )
+{
+	uint16_t utf16_computer_name[ 512 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+	int utf16_computer_name_is_set         = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf16_computer_name(
+	          record_values,
+	          utf16_computer_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_computer_name_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_computer_name(
+	          NULL,
+	          utf16_computer_name,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_computer_name_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf16_computer_name(
+		          record_values,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf16_computer_name(
+		          record_values,
+		          utf16_computer_name,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf16_computer_name(
+		          record_values,
+		          utf16_computer_name,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_channel_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_channel_name_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf8_channel_name_size          = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_channel_name_size(
+	          NULL,
+	          &utf8_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf8_channel_name_size(
+	          record_values,
+	          &utf8_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_channel_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_channel_name(
+     void )
+{
+	uint8_t utf8_channel_name[ 64 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_channel_name(
+	          NULL,
+	          utf8_channel_name,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf8_channel_name(
+	          record_values,
+	          utf8_channel_name,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_channel_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_channel_name_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf16_channel_name_size         = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_channel_name_size(
+	          NULL,
+	          &utf16_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf16_channel_name_size(
+	          record_values,
+	          &utf16_channel_name_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_channel_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_channel_name(
+     void )
+{
+	uint16_t utf16_channel_name[ 64 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_channel_name(
+	          NULL,
+	          utf16_channel_name,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf16_channel_name(
+	          record_values,
+	          utf16_channel_name,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_user_security_identifier_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_user_security_identifier_size(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevtx_record_values_t *record_values        = NULL;
+	size_t utf8_user_security_identifier_size     = 0;
+	int result                                    = 0;
+	int utf8_user_security_identifier_size_is_set = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf8_user_security_identifier_size(
+	          record_values,
+	          &utf8_user_security_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_user_security_identifier_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_user_security_identifier_size(
+	          NULL,
+	          &utf8_user_security_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_user_security_identifier_size_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf8_user_security_identifier_size(
+		          record_values,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_user_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_user_security_identifier(
+     void )
+{
+	uint8_t utf8_user_security_identifier[ 512 ];
+
+	libcerror_error_t *error                 = NULL;
+	libevtx_record_values_t *record_values   = NULL;
+	int result                               = 0;
+	int utf8_user_security_identifier_is_set = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf8_user_security_identifier(
+	          record_values,
+	          utf8_user_security_identifier,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_user_security_identifier_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_user_security_identifier(
+	          NULL,
+	          utf8_user_security_identifier,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_user_security_identifier_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf8_user_security_identifier(
+		          record_values,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf8_user_security_identifier(
+		          record_values,
+		          utf8_user_security_identifier,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf8_user_security_identifier(
+		          record_values,
+		          utf8_user_security_identifier,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_user_security_identifier_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_user_security_identifier_size(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libevtx_record_values_t *record_values         = NULL;
+	size_t utf16_user_security_identifier_size     = 0;
+	int result                                     = 0;
+	int utf16_user_security_identifier_size_is_set = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf16_user_security_identifier_size(
+	          record_values,
+	          &utf16_user_security_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_user_security_identifier_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_user_security_identifier_size(
+	          NULL,
+	          &utf16_user_security_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_user_security_identifier_size_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf16_user_security_identifier_size(
+		          record_values,
+		          NULL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_user_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_user_security_identifier(
+     void )
+{
+	uint16_t utf16_user_security_identifier[ 512 ];
+
+	libcerror_error_t *error                  = NULL;
+	libevtx_record_values_t *record_values    = NULL;
+	int result                                = 0;
+	int utf16_user_security_identifier_is_set = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_utf16_user_security_identifier(
+	          record_values,
+	          utf16_user_security_identifier,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_user_security_identifier_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_user_security_identifier(
+	          NULL,
+	          utf16_user_security_identifier,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_user_security_identifier_is_set != 0 )
+	{
+		result = libevtx_record_values_get_utf16_user_security_identifier(
+		          record_values,
+		          NULL,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf16_user_security_identifier(
+		          record_values,
+		          utf16_user_security_identifier,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevtx_record_values_get_utf16_user_security_identifier(
+		          record_values,
+		          utf16_user_security_identifier,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_process_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_process_identifier(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	uint32_t process_identifier            = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_process_identifier(
+	          NULL,
+	          &process_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_process_identifier(
+	          record_values,
+	          &process_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_thread_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_thread_identifier(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	uint32_t thread_identifier             = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_thread_identifier(
+	          NULL,
+	          &thread_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_thread_identifier(
+	          record_values,
+	          &thread_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_activity_identifier_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_activity_identifier_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf8_activity_identifier_size   = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_activity_identifier_size(
+	          NULL,
+	          &utf8_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf8_activity_identifier_size(
+	          record_values,
+	          &utf8_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_activity_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_activity_identifier(
+     void )
+{
+	uint8_t utf8_activity_identifier[ 64 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_activity_identifier(
+	          NULL,
+	          utf8_activity_identifier,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf8_activity_identifier(
+	          record_values,
+	          utf8_activity_identifier,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_activity_identifier_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_activity_identifier_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf16_activity_identifier_size  = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_activity_identifier_size(
+	          NULL,
+	          &utf16_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf16_activity_identifier_size(
+	          record_values,
+	          &utf16_activity_identifier_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_activity_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_activity_identifier(
+     void )
+{
+	uint16_t utf16_activity_identifier[ 64 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_activity_identifier(
+	          NULL,
+	          utf16_activity_identifier,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record values without a XML document
+	 */
+	result = libevtx_record_values_get_utf16_activity_identifier(
+	          record_values,
+	          utf16_activity_identifier,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_string_name_xml_tag function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_string_name_xml_tag(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	libfwevt_xml_tag_t *name_xml_tag       = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_string_name_xml_tag(
+	          NULL,
+	          NULL,
+	          0,
+	          &name_xml_tag,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test record values without an XML document
+	 */
+	result = libevtx_record_values_get_string_name_xml_tag(
+	          record_values,
+	          NULL,
+	          0,
+	          &name_xml_tag,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf8_string_name_size(
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf8_string_name(
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_string_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_string_name_hash(
+     void )
+{
+	uint32_t hash = 0;
+
+	/* Test regular cases
+	 */
+	hash = libevtx_record_values_get_string_name_hash(
+	        (uint8_t *) "TargetUserName",
+	        14 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xd7020cb0UL );
+
+	hash = libevtx_record_values_get_string_name_hash(
+	        (uint8_t *) "a",
+	        1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	/* An empty name has the FNV-1a offset basis as hash
+	 */
+	hash = libevtx_record_values_get_string_name_hash(
+	        (uint8_t *) "",
+	        0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	hash = libevtx_record_values_get_string_name_hash(
+	        NULL,
+	        0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_string_index_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_string_index_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+	int string_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          NULL,
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          record_values,
+	          NULL,
+	          NULL,
+	          14,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          record_values,
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test record values without an XML document
+	 */
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          record_values,
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_values->string_name_index_built",
+	 (int) record_values->string_name_index_built,
+	 0 );
+
+	result = libevtx_record_values_build_string_name_index(
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -2787,17 +5748,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_user_security_identifier_size function
+/* Tests the libevtx_record_values_resize_strings_arrays function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_user_security_identifier_size(
+int evtx_test_record_values_resize_strings_arrays(
      void )
 {
-	libcerror_error_t *error                       = NULL;
-	libevtx_record_values_t *record_values         = NULL;
-	size_t utf16_user_security_identifier_size     = 0;
-	int result                                     = 0;
-	int utf16_user_security_identifier_size_is_set = 0;
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int number_of_entries                  = 0;
+	int result                             = 0;
 
 	/* Initialize test
 	 */
@@ -2818,29 +5778,107 @@ int evtx_test_record_values_get_utf16_user_security_identifier_size(
 	 "error",
 	 error );
 
+	result = libcdata_array_initialize(
+	          &( record_values->string_identifiers_array ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &( record_values->strings_array ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libevtx_record_values_get_utf16_user_security_identifier_size(
+	result = libevtx_record_values_resize_strings_arrays(
 	          record_values,
-	          &utf16_user_security_identifier_size,
+	          8,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	utf16_user_security_identifier_size_is_set = result;
+	result = libcdata_array_get_number_of_entries(
+	          record_values->strings_array,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 8 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_resize_strings_arrays(
+	          record_values,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          record_values->string_identifiers_array,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_user_security_identifier_size(
+	result = libevtx_record_values_resize_strings_arrays(
 	          NULL,
-	          &utf16_user_security_identifier_size,
+	          8,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -2855,25 +5893,23 @@ int evtx_test_record_values_get_utf16_user_security_identifier_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_user_security_identifier_size_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf16_user_security_identifier_size(
-		          record_values,
-		          NULL,
-		          &error );
+	result = libevtx_record_values_resize_strings_arrays(
+	          record_values,
+	          -1,
+	          &error );
 
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -2910,18 +5946,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevtx_record_values_get_utf16_user_security_identifier function
+/* Tests the libevtx_record_values_get_utf8_strings function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_record_values_get_utf16_user_security_identifier(
+int evtx_test_record_values_get_utf8_strings(
      void )
 {
-	uint16_t utf16_user_security_identifier[ 512 ];
-
-	libcerror_error_t *error                  = NULL;
-	libevtx_record_values_t *record_values    = NULL;
-	int result                                = 0;
-	int utf16_user_security_identifier_is_set = 0;
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	const size_t *utf8_string_offsets      = NULL;
+	const size_t *utf8_string_sizes        = NULL;
+	const uint8_t *utf8_strings            = NULL;
+	int number_of_strings                  = 0;
+	int result                             = 0;
 
 	/* Initialize test
 	 */
@@ -2942,31 +5979,38 @@ int evtx_test_record_values_get_utf16_user_security_identifier(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libevtx_record_values_get_utf16_user_security_identifier(
-	          record_values,
-	          utf16_user_security_identifier,
-	          512,
+	result = libevtx_record_values_get_utf8_strings(
+	          NULL,
+	          NULL,
+	          &utf8_strings,
+	          &number_of_strings,
+	          &utf8_string_offsets,
+	          &utf8_string_sizes,
 	          &error );
 
-	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	utf16_user_security_identifier_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test record values without an XML document
 	 */
-	result = libevtx_record_values_get_utf16_user_security_identifier(
+	result = libevtx_record_values_get_utf8_strings(
+	          record_values,
 	          NULL,
-	          utf16_user_security_identifier,
-	          512,
+	          &utf8_strings,
+	          &number_of_strings,
+	          &utf8_string_offsets,
+	          &utf8_string_sizes,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -2981,62 +6025,6 @@ int evtx_test_record_values_get_utf16_user_security_identifier(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_user_security_identifier_is_set != 0 )
-	{
-		result = libevtx_record_values_get_utf16_user_security_identifier(
-		          record_values,
-		          NULL,
-		          512,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf16_user_security_identifier(
-		          record_values,
-		          utf16_user_security_identifier,
-		          0,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libevtx_record_values_get_utf16_user_security_identifier(
-		          record_values,
-		          utf16_user_security_identifier,
-		          (size_t) SSIZE_MAX + 1,
-		          &error );
-
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libevtx_record_values_free(
@@ -3676,6 +6664,90 @@ int main(
 	 "libevtx_record_values_clone",
 	 evtx_test_record_values_clone );
 
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_check_header",
+	 evtx_test_record_values_check_header );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_read_system_values",
+	 evtx_test_record_values_read_system_values );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_resolve_system_xml_tags",
+	 evtx_test_record_values_resolve_system_xml_tags );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_decode_system_scalars",
+	 evtx_test_record_values_decode_system_scalars );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_string_name_xml_tag",
+	 evtx_test_record_values_get_string_name_xml_tag );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_string_name_hash",
+	 evtx_test_record_values_get_string_name_hash );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_string_index_by_utf8_name",
+	 evtx_test_record_values_get_string_index_by_utf8_name );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_resize_strings_arrays",
+	 evtx_test_record_values_resize_strings_arrays );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_task",
+	 evtx_test_record_values_get_task );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_opcode",
+	 evtx_test_record_values_get_opcode );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_keywords",
+	 evtx_test_record_values_get_keywords );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_channel_name_size",
+	 evtx_test_record_values_get_utf8_channel_name_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_channel_name",
+	 evtx_test_record_values_get_utf8_channel_name );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf16_channel_name_size",
+	 evtx_test_record_values_get_utf16_channel_name_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf16_channel_name",
+	 evtx_test_record_values_get_utf16_channel_name );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_process_identifier",
+	 evtx_test_record_values_get_process_identifier );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_thread_identifier",
+	 evtx_test_record_values_get_thread_identifier );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_activity_identifier_size",
+	 evtx_test_record_values_get_utf8_activity_identifier_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_activity_identifier",
+	 evtx_test_record_values_get_utf8_activity_identifier );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf16_activity_identifier_size",
+	 evtx_test_record_values_get_utf16_activity_identifier_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf16_activity_identifier",
+	 evtx_test_record_values_get_utf16_activity_identifier );
+
 #if defined( TODO )
 
 	/* TODO: add tests for libevtx_record_values_read_header */
@@ -3694,6 +6766,14 @@ int main(
 	 "libevtx_record_values_get_event_level",
 	 evtx_test_record_values_get_event_level );
 
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_event_version",
+	 evtx_test_record_values_get_event_version );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_provider_identifier",
+	 evtx_test_record_values_get_provider_identifier );
+
 	EVTX_TEST_RUN(
 	 "libevtx_record_values_get_utf8_provider_identifier_size",
 	 evtx_test_record_values_get_utf8_provider_identifier_size );
@@ -3766,6 +6846,10 @@ int main(
 
 	/* TODO: add tests for libevtx_record_values_get_utf8_string */
 
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_strings",
+	 evtx_test_record_values_get_utf8_strings );
+
 	/* TODO: add tests for libevtx_record_values_get_utf16_string_size */
 
 	/* TODO: add tests for libevtx_record_values_get_utf16_string */
@@ -0,0 +1,1059 @@
+/*
+ * Library recovered_records_filter type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_recovered_records_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_recovered_records_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_recovered_records_filter_initialize(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libevtx_recovered_records_filter_t *recovered_records_filter = NULL;
+	int result                                                   = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests                              = 2;
+	int number_of_memset_fail_tests                              = 2;
+	int test_number                                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_recovered_records_filter_initialize(
+	          &recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "recovered_records_filter",
+	 recovered_records_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_recovered_records_filter_free(
+	          &recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "recovered_records_filter",
+	 recovered_records_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_recovered_records_filter_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	recovered_records_filter = (libevtx_recovered_records_filter_t *) 0x12345678UL;
+
+	result = libevtx_recovered_records_filter_initialize(
+	          &recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	recovered_records_filter = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_recovered_records_filter_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_recovered_records_filter_initialize(
+		          &recovered_records_filter,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( recovered_records_filter != NULL )
+			{
+				libevtx_recovered_records_filter_free(
+				 &recovered_records_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "recovered_records_filter",
+			 recovered_records_filter );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_recovered_records_filter_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_recovered_records_filter_initialize(
+		          &recovered_records_filter,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( recovered_records_filter != NULL )
+			{
+				libevtx_recovered_records_filter_free(
+				 &recovered_records_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "recovered_records_filter",
+			 recovered_records_filter );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( recovered_records_filter != NULL )
+	{
+		libevtx_recovered_records_filter_free(
+		 &recovered_records_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_recovered_records_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_recovered_records_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_recovered_records_filter_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_recovered_records_filter_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_recovered_records_filter_calculate_hash(
+     void )
+{
+	uint8_t chunk_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t hash            = 0;
+	uint64_t other_hash      = 0;
+	size_t data_index        = 0;
+	int result               = 0;
+
+	for( data_index = 0;
+	     data_index < 64;
+	     data_index++ )
+	{
+		chunk_data[ data_index ] = (uint8_t) data_index;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          &hash,
+	          chunk_data,
+	          64,
+	          16,
+	          32,
+	          1,
+	          132000000000000000UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          &other_hash,
+	          chunk_data,
+	          64,
+	          16,
+	          32,
+	          1,
+	          132000000000000000UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "other_hash",
+	 other_hash,
+	 hash );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A different written time results in a different hash
+	 */
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          &other_hash,
+	          chunk_data,
+	          64,
+	          16,
+	          32,
+	          1,
+	          132000000000000001UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "other_hash",
+	 (int64_t) other_hash,
+	 (int64_t) hash );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A different identifier results in a different hash
+	 */
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          &other_hash,
+	          chunk_data,
+	          64,
+	          16,
+	          32,
+	          2,
+	          132000000000000000UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "other_hash",
+	 (int64_t) other_hash,
+	 (int64_t) hash );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          NULL,
+	          chunk_data,
+	          64,
+	          16,
+	          32,
+	          1,
+	          132000000000000000UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          &hash,
+	          NULL,
+	          64,
+	          16,
+	          32,
+	          1,
+	          132000000000000000UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          &hash,
+	          chunk_data,
+	          (size_t) SSIZE_MAX + 1,
+	          16,
+	          32,
+	          1,
+	          132000000000000000UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_calculate_hash(
+	          &hash,
+	          chunk_data,
+	          64,
+	          48,
+	          32,
+	          1,
+	          132000000000000000UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_recovered_records_filter_insert_allocated_record and libevtx_recovered_records_filter_is_duplicate functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_recovered_records_filter_insert_allocated_record(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libevtx_recovered_records_filter_t *recovered_records_filter = NULL;
+	uint64_t hash                                                = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_recovered_records_filter_initialize(
+	          &recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "recovered_records_filter",
+	 recovered_records_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_recovered_records_filter_is_duplicate(
+	          recovered_records_filter,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_recovered_records_filter_insert_allocated_record(
+	          recovered_records_filter,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_recovered_records_filter_insert_allocated_record(
+	          recovered_records_filter,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_recovered_records_filter_is_duplicate(
+	          recovered_records_filter,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Insert more hashes than the initial number of slots to test the resize
+	 */
+	for( hash = 1;
+	     hash <= 2 * LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_SLOTS;
+	     hash++ )
+	{
+		result = libevtx_recovered_records_filter_insert_allocated_record(
+		          recovered_records_filter,
+		          hash * LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_SLOTS,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "recovered_records_filter->number_of_slots",
+	 (int) recovered_records_filter->number_of_slots,
+	 LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_SLOTS );
+
+	for( hash = 1;
+	     hash <= 2 * LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_SLOTS;
+	     hash++ )
+	{
+		result = libevtx_recovered_records_filter_is_duplicate(
+		          recovered_records_filter,
+		          hash * LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_SLOTS,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_recovered_records_filter_is_duplicate(
+	          recovered_records_filter,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_recovered_records_filter_insert_allocated_record(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_is_duplicate(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_recovered_records_filter_free(
+	          &recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "recovered_records_filter",
+	 recovered_records_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( recovered_records_filter != NULL )
+	{
+		libevtx_recovered_records_filter_free(
+		 &recovered_records_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_recovered_records_filter_append_candidate and libevtx_recovered_records_filter_get_candidate functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_recovered_records_filter_append_candidate(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libevtx_recovered_records_filter_t *recovered_records_filter = NULL;
+	size64_t element_data_size                                   = 0;
+	off64_t file_offset                                          = 0;
+	uint64_t hash                                                = 0;
+	int candidate_index                                          = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_recovered_records_filter_initialize(
+	          &recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "recovered_records_filter",
+	 recovered_records_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( candidate_index = 0;
+	     candidate_index < ( 2 * LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES ) + 1;
+	     candidate_index++ )
+	{
+		result = libevtx_recovered_records_filter_append_candidate(
+		          recovered_records_filter,
+		          (off64_t) ( 4096 + candidate_index ),
+		          (size64_t) candidate_index,
+		          (uint64_t) candidate_index + 1,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "recovered_records_filter->number_of_candidates",
+	 recovered_records_filter->number_of_candidates,
+	 ( 2 * LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES ) + 1 );
+
+	result = libevtx_recovered_records_filter_get_candidate(
+	          recovered_records_filter,
+	          LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES,
+	          &file_offset,
+	          &element_data_size,
+	          &hash,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) ( 4096 + LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "element_data_size",
+	 (uint64_t) element_data_size,
+	 (uint64_t) LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) LIBEVTX_RECOVERED_RECORDS_FILTER_INITIAL_NUMBER_OF_CANDIDATES + 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_recovered_records_filter_append_candidate(
+	          NULL,
+	          4096,
+	          0,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_get_candidate(
+	          NULL,
+	          0,
+	          &file_offset,
+	          &element_data_size,
+	          &hash,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_get_candidate(
+	          recovered_records_filter,
+	          -1,
+	          &file_offset,
+	          &element_data_size,
+	          &hash,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_get_candidate(
+	          recovered_records_filter,
+	          0,
+	          NULL,
+	          &element_data_size,
+	          &hash,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_get_candidate(
+	          recovered_records_filter,
+	          0,
+	          &file_offset,
+	          NULL,
+	          &hash,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_get_candidate(
+	          recovered_records_filter,
+	          0,
+	          &file_offset,
+	          &element_data_size,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libevtx_recovered_records_filter_clear_candidates
+	 */
+	result = libevtx_recovered_records_filter_clear_candidates(
+	          recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "recovered_records_filter->number_of_candidates",
+	 recovered_records_filter->number_of_candidates,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_recovered_records_filter_get_candidate(
+	          recovered_records_filter,
+	          0,
+	          &file_offset,
+	          &element_data_size,
+	          &hash,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_recovered_records_filter_clear_candidates(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_recovered_records_filter_free(
+	          &recovered_records_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "recovered_records_filter",
+	 recovered_records_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( recovered_records_filter != NULL )
+	{
+		libevtx_recovered_records_filter_free(
+		 &recovered_records_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_recovered_records_filter_initialize",
+	 evtx_test_recovered_records_filter_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_recovered_records_filter_free",
+	 evtx_test_recovered_records_filter_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_recovered_records_filter_calculate_hash",
+	 evtx_test_recovered_records_filter_calculate_hash );
+
+	EVTX_TEST_RUN(
+	 "libevtx_recovered_records_filter_insert_allocated_record",
+	 evtx_test_recovered_records_filter_insert_allocated_record );
+
+	EVTX_TEST_RUN(
+	 "libevtx_recovered_records_filter_append_candidate",
+	 evtx_test_recovered_records_filter_append_candidate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,607 @@
+/*
+ * Library search_prefilter functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_search_prefilter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Binary XML data containing evil.exe as an UTF-16 little-endian string
+ */
+uint8_t evtx_test_search_prefilter_utf16_data[ 32 ] = {
+	0x0f, 0x01, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x65, 0x00, 0x76, 0x00, 0x69,
+	0x00, 0x6c, 0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 };
+
+/* Binary data containing evil.exe as an ASCII string
+ */
+uint8_t evtx_test_search_prefilter_ascii_data[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x65, 0x76, 0x69, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00 };
+
+/* Binary data containing Evil.exe as an ASCII string
+ */
+uint8_t evtx_test_search_prefilter_no_match_data[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x45, 0x76, 0x69, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libevtx_search_prefilter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_search_prefilter_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_search_prefilter_t *search_prefilter = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_search_prefilter_initialize(
+	          &search_prefilter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "search_prefilter",
+	 search_prefilter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_search_prefilter_free(
+	          &search_prefilter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "search_prefilter",
+	 search_prefilter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_search_prefilter_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( search_prefilter != NULL )
+	{
+		libevtx_search_prefilter_free(
+		 &search_prefilter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_search_prefilter_append_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_search_prefilter_append_utf8_string(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_search_prefilter_t *search_prefilter = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_search_prefilter_initialize(
+	          &search_prefilter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "search_prefilter",
+	 search_prefilter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_search_prefilter_append_utf8_string(
+	          search_prefilter,
+	          (uint8_t *) "evil.exe",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "search_prefilter->number_of_patterns",
+	 search_prefilter->number_of_patterns,
+	 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "search_prefilter->minimum_pattern_size",
+	 search_prefilter->minimum_pattern_size,
+	 (size_t) 8 );
+
+	/* Test that a search string that was already appended is ignored
+	 */
+	result = libevtx_search_prefilter_append_utf8_string(
+	          search_prefilter,
+	          (uint8_t *) "evil.exe",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "search_prefilter->number_of_patterns",
+	 search_prefilter->number_of_patterns,
+	 2 );
+
+	/* Test that a single character is only searched for as UTF-16
+	 */
+	result = libevtx_search_prefilter_append_utf8_string(
+	          search_prefilter,
+	          (uint8_t *) "x",
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "search_prefilter->number_of_patterns",
+	 search_prefilter->number_of_patterns,
+	 3 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "search_prefilter->minimum_pattern_size",
+	 search_prefilter->minimum_pattern_size,
+	 (size_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libevtx_search_prefilter_append_utf8_string(
+	          NULL,
+	          (uint8_t *) "evil.exe",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_search_prefilter_append_utf8_string(
+	          search_prefilter,
+	          NULL,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_search_prefilter_append_utf8_string(
+	          search_prefilter,
+	          (uint8_t *) "evil.exe",
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_search_prefilter_free(
+	          &search_prefilter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "search_prefilter",
+	 search_prefilter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( search_prefilter != NULL )
+	{
+		libevtx_search_prefilter_free(
+		 &search_prefilter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_search_prefilter_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_search_prefilter_scan(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevtx_search_prefilter_t *search_prefilter = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_search_prefilter_initialize(
+	          &search_prefilter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "search_prefilter",
+	 search_prefilter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that no data matches without patterns
+	 */
+	result = libevtx_search_prefilter_scan(
+	          search_prefilter,
+	          evtx_test_search_prefilter_utf16_data,
+	          32,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_search_prefilter_append_utf8_string(
+	          search_prefilter,
+	          (uint8_t *) "mimikatz",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_search_prefilter_append_utf8_string(
+	          search_prefilter,
+	          (uint8_t *) "evil.exe",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_search_prefilter_scan(
+	          search_prefilter,
+	          evtx_test_search_prefilter_utf16_data,
+	          32,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_search_prefilter_scan(
+	          search_prefilter,
+	          evtx_test_search_prefilter_ascii_data,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the search strings are compared case sensitive
+	 */
+	result = libevtx_search_prefilter_scan(
+	          search_prefilter,
+	          evtx_test_search_prefilter_no_match_data,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a pattern at the end of the data must be complete
+	 */
+	result = libevtx_search_prefilter_scan(
+	          search_prefilter,
+	          evtx_test_search_prefilter_utf16_data,
+	          26,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_search_prefilter_scan(
+	          search_prefilter,
+	          evtx_test_search_prefilter_ascii_data,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_search_prefilter_scan(
+	          NULL,
+	          evtx_test_search_prefilter_ascii_data,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_search_prefilter_scan(
+	          search_prefilter,
+	          NULL,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_search_prefilter_free(
+	          &search_prefilter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "search_prefilter",
+	 search_prefilter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( search_prefilter != NULL )
+	{
+		libevtx_search_prefilter_free(
+		 &search_prefilter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_search_prefilter_initialize",
+	 evtx_test_search_prefilter_initialize );
+
+	/* TODO: add tests for libevtx_search_prefilter_append_pattern */
+
+	EVTX_TEST_RUN(
+	 "libevtx_search_prefilter_append_utf8_string",
+	 evtx_test_search_prefilter_append_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_search_prefilter_scan",
+	 evtx_test_search_prefilter_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,297 @@
+/*
+ * Library signature functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_signature.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_signature_find_event_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_signature_find_event_record(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	size_t data_offset       = 0;
+	size_t signature_offset  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 data,
+	                 0x2a,
+	                 sizeof( uint8_t ) * 256 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test data without a signature
+	 */
+	result = libevtx_signature_find_event_record(
+	          data,
+	          256,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a signature at every aligned offset
+	 * to cover the vector and byte-wise code paths
+	 */
+	for( data_offset = 0;
+	     data_offset <= 252;
+	     data_offset += 4 )
+	{
+		data[ data_offset + 2 ] = 0x00;
+		data[ data_offset + 3 ] = 0x00;
+
+		result = libevtx_signature_find_event_record(
+		          data,
+		          256,
+		          0,
+		          &signature_offset,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "signature_offset",
+		 signature_offset,
+		 data_offset );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test that a signature before the start offset is ignored
+		 */
+		result = libevtx_signature_find_event_record(
+		          data,
+		          256,
+		          data_offset + 4,
+		          &signature_offset,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data[ data_offset + 2 ] = 0x2a;
+		data[ data_offset + 3 ] = 0x2a;
+	}
+	/* Test that an unaligned signature is ignored
+	 */
+	data[ 66 ] = 0x2a;
+	data[ 67 ] = 0x2a;
+	data[ 68 ] = 0x00;
+	data[ 69 ] = 0x00;
+
+	result = libevtx_signature_find_event_record(
+	          data,
+	          256,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a signature that exceeds the data size is ignored
+	 */
+	result = libevtx_signature_find_event_record(
+	          data,
+	          68,
+	          2,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_signature_find_event_record(
+	          data,
+	          70,
+	          2,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "signature_offset",
+	 signature_offset,
+	 (size_t) 66 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_signature_find_event_record(
+	          NULL,
+	          256,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_signature_find_event_record(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_signature_find_event_record(
+	          data,
+	          256,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_signature_find_event_record",
+	 evtx_test_signature_find_event_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -199,6 +199,194 @@ on_error:
 	return( 0 );
 }
 
+/* The number of allocations made by the test allocator
+ */
+static int evtx_test_support_number_of_allocations = 0;
+
+/* The number of allocations freed by the test allocator
+ */
+static int evtx_test_support_number_of_frees = 0;
+
+/* Allocate function of the test allocator
+ */
+void *evtx_test_support_allocate(
+       void *context EVTX_TEST_ATTRIBUTE_UNUSED,
+       size_t size )
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( context )
+
+	evtx_test_support_number_of_allocations++;
+
+	return( malloc(
+	         size ) );
+}
+
+/* Reallocate function of the test allocator
+ */
+void *evtx_test_support_reallocate(
+       void *context EVTX_TEST_ATTRIBUTE_UNUSED,
+       void *buffer,
+       size_t size )
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( context )
+
+	if( buffer == NULL )
+	{
+		evtx_test_support_number_of_allocations++;
+	}
+	return( realloc(
+	         buffer,
+	         size ) );
+}
+
+/* Free function of the test allocator
+ */
+void evtx_test_support_free(
+      void *context EVTX_TEST_ATTRIBUTE_UNUSED,
+      void *buffer )
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( context )
+
+	if( buffer != NULL )
+	{
+		evtx_test_support_number_of_frees++;
+	}
+	free(
+	 buffer );
+}
+
+/* Tests the libevtx_set_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_set_allocator(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_file_t *file     = NULL;
+	int result               = 0;
+
+	evtx_test_support_number_of_allocations = 0;
+	evtx_test_support_number_of_frees       = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_set_allocator(
+	          &evtx_test_support_allocate,
+	          &evtx_test_support_reallocate,
+	          &evtx_test_support_free,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "evtx_test_support_number_of_allocations",
+	 evtx_test_support_number_of_allocations,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "evtx_test_support_number_of_frees",
+	 evtx_test_support_number_of_frees,
+	 evtx_test_support_number_of_allocations );
+
+	/* Test error cases
+	 */
+	result = libevtx_set_allocator(
+	          &evtx_test_support_allocate,
+	          NULL,
+	          &evtx_test_support_free,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	libevtx_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libevtx_check_file_signature function
  * Returns 1 if successful or 0 if not
  */
@@ -765,6 +953,10 @@ int main(
 	 "libevtx_set_codepage",
 	 evtx_test_set_codepage );
 
+	EVTX_TEST_RUN(
+	 "libevtx_set_allocator",
+	 evtx_test_set_allocator );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	EVTX_TEST_RUN_WITH_ARGS(
@@ -0,0 +1,739 @@
+/*
+ * Library system_fields type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_string_table.h"
+#include "../libevtx/libevtx_system_fields.h"
+#include "../libevtx/libevtx_system_values.h"
+
+/* Tests the libevtx_system_fields_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_system_fields_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_system_fields_t *system_fields = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_system_fields_initialize(
+	          &system_fields,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "system_fields",
+	 system_fields );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_system_fields_free(
+	          &system_fields,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "system_fields",
+	 system_fields );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_system_fields_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	system_fields = (libevtx_system_fields_t *) 0x12345678UL;
+
+	result = libevtx_system_fields_initialize(
+	          &system_fields,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	system_fields = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_system_fields_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_system_fields_initialize(
+		          &system_fields,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( system_fields != NULL )
+			{
+				libevtx_system_fields_free(
+				 &system_fields,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "system_fields",
+			 system_fields );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_system_fields_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_system_fields_initialize(
+		          &system_fields,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( system_fields != NULL )
+			{
+				libevtx_system_fields_free(
+				 &system_fields,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "system_fields",
+			 system_fields );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( system_fields != NULL )
+	{
+		libevtx_system_fields_free(
+		 &system_fields,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_system_fields_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_system_fields_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_system_fields_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_system_fields_set_record_values function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_system_fields_set_record_values(
+     void )
+{
+	uint8_t computer_name[ 4 ] = {
+		'P', 0, 'C', 0 };
+
+	libevtx_system_values_t system_values;
+
+	const uint32_t *computer_name_identifiers = NULL;
+	const uint32_t *event_identifiers         = NULL;
+	const uint64_t *keywords                  = NULL;
+	const uint64_t *written_times             = NULL;
+	const uint8_t *event_levels               = NULL;
+	const uint8_t *provider_identifiers       = NULL;
+	const uint8_t *record_flags               = NULL;
+	libcerror_error_t *error                  = NULL;
+	libevtx_string_table_t *string_table      = NULL;
+	libevtx_system_fields_t *system_fields    = NULL;
+	int number_of_records                     = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_system_fields_initialize(
+	          &system_fields,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "system_fields",
+	 system_fields );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_initialize(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_system_fields_resize(
+	          (libevtx_internal_system_fields_t *) system_fields,
+	          3,
+	          LIBEVTX_SYSTEM_FIELD_FLAGS_ALL & ~( LIBEVTX_SYSTEM_FIELD_FLAG_KEYWORDS ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &system_values,
+	 0,
+	 sizeof( libevtx_system_values_t ) );
+
+	system_values.event_identifier         = 4624;
+	system_values.event_level              = 4;
+	system_values.provider_identifier[ 0 ] = 0x7f;
+	system_values.computer_name            = computer_name;
+	system_values.computer_name_size       = 4;
+	system_values.keywords                 = 0x8020000000000000ULL;
+	system_values.flags                    = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_IDENTIFIER
+	                                       | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_EVENT_LEVEL
+	                                       | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER
+	                                       | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_COMPUTER_NAME
+	                                       | LIBEVTX_SYSTEM_VALUES_FLAG_HAS_KEYWORDS;
+
+	/* Test regular cases
+	 */
+	result = libevtx_system_fields_set_record_values(
+	          (libevtx_internal_system_fields_t *) system_fields,
+	          0,
+	          &system_values,
+	          0x01d0000000000001ULL,
+	          string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record with the same computer name
+	 */
+	system_values.event_identifier = 4634;
+
+	result = libevtx_system_fields_set_record_values(
+	          (libevtx_internal_system_fields_t *) system_fields,
+	          1,
+	          &system_values,
+	          0x01d0000000000002ULL,
+	          string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that is not supported by the System values
+	 */
+	result = libevtx_system_fields_set_record_values(
+	          (libevtx_internal_system_fields_t *) system_fields,
+	          2,
+	          NULL,
+	          0x01d0000000000003ULL,
+	          string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_system_fields_get_number_of_records(
+	          system_fields,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_system_fields_get_record_flags(
+	          system_fields,
+	          &record_flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_flags",
+	 record_flags );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_flags[ 0 ]",
+	 (int) record_flags[ 0 ],
+	 LIBEVTX_SYSTEM_FIELD_FLAGS_ALL & ~( LIBEVTX_SYSTEM_FIELD_FLAG_KEYWORDS ) );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_flags[ 2 ]",
+	 (int) record_flags[ 2 ],
+	 LIBEVTX_SYSTEM_FIELD_FLAG_WRITTEN_TIME );
+
+	result = libevtx_system_fields_get_event_identifiers(
+	          system_fields,
+	          &event_identifiers,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "event_identifiers[ 0 ]",
+	 event_identifiers[ 0 ],
+	 4624 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "event_identifiers[ 1 ]",
+	 event_identifiers[ 1 ],
+	 4634 );
+
+	result = libevtx_system_fields_get_event_levels(
+	          system_fields,
+	          &event_levels,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "event_levels[ 0 ]",
+	 (int) event_levels[ 0 ],
+	 4 );
+
+	result = libevtx_system_fields_get_written_times(
+	          system_fields,
+	          &written_times,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "written_times[ 2 ]",
+	 written_times[ 2 ],
+	 (uint64_t) 0x01d0000000000003ULL );
+
+	result = libevtx_system_fields_get_provider_identifiers(
+	          system_fields,
+	          &provider_identifiers,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "provider_identifiers[ 16 ]",
+	 (int) provider_identifiers[ 16 ],
+	 0x7f );
+
+	result = libevtx_system_fields_get_computer_name_identifiers(
+	          system_fields,
+	          &computer_name_identifiers,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "computer_name_identifiers[ 1 ]",
+	 computer_name_identifiers[ 1 ],
+	 computer_name_identifiers[ 0 ] );
+
+	/* The keywords were not part of the fields mask
+	 */
+	result = libevtx_system_fields_get_keywords(
+	          system_fields,
+	          &keywords,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_system_fields_set_record_values(
+	          NULL,
+	          0,
+	          &system_values,
+	          0,
+	          string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_system_fields_set_record_values(
+	          (libevtx_internal_system_fields_t *) system_fields,
+	          3,
+	          &system_values,
+	          0,
+	          string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_system_fields_get_event_identifiers(
+	          system_fields,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_string_table_free(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_system_fields_free(
+	          &system_fields,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "system_fields",
+	 system_fields );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_table != NULL )
+	{
+		libevtx_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	if( system_fields != NULL )
+	{
+		libevtx_system_fields_free(
+		 &system_fields,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "libevtx_system_fields_initialize",
+	 evtx_test_system_fields_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_system_fields_free",
+	 evtx_test_system_fields_free );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_system_fields_set_record_values",
+	 evtx_test_system_fields_set_record_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,661 @@
+/*
+ * Library system_values functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_system_values.h"
+
+uint8_t evtx_test_system_values_data1[ 493 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x34, 0x12,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x0f, 0x01,
+	0x01, 0x00, 0x01, 0xff, 0xff, 0x78, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00,
+	0x00, 0x02, 0x01, 0xff, 0xff, 0x0b, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d,
+	0x00, 0x00, 0x00, 0x02, 0x41, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x69,
+	0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x46, 0xb2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x05, 0x01, 0x04, 0x00, 0x54, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x06, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x47, 0x00, 0x75,
+	0x00, 0x69, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0f, 0x03, 0x01, 0xff, 0xff, 0x22,
+	0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x45,
+	0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x49, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02,
+	0x0d, 0x01, 0x00, 0x06, 0x04, 0x01, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x02, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x32, 0x00, 0x00,
+	0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x43, 0x00, 0x68,
+	0x00, 0x61, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01,
+	0x08, 0x00, 0x53, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00,
+	0x79, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74,
+	0x00, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x01, 0xff, 0xff, 0x1c,
+	0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x44,
+	0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x03, 0x00, 0x01, 0x04, 0x04,
+	0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x02, 0x00, 0x06, 0x00, 0x01, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3a, 0x5b, 0x55, 0x9c, 0x8c, 0x4d, 0x43, 0x8c, 0x3b,
+	0xd2, 0x48, 0x2f, 0x55, 0xb1, 0x0a, 0x10, 0x12, 0x04, 0xed, 0x01, 0x00, 0x00 };
+
+uint8_t evtx_test_system_values_data2[ 64 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_system_values_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_system_values_read_data(
+     void )
+{
+	libevtx_system_values_template_cache_t template_cache;
+	libevtx_system_values_t system_values;
+
+	libcerror_error_t *error = NULL;
+	int read_index           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_system_values_read_data(
+	          &system_values,
+	          NULL,
+	          NULL,
+	          evtx_test_system_values_data1,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "system_values.flags",
+	 (int) system_values.flags,
+	 0x0f );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "system_values.event_identifier",
+	 system_values.event_identifier,
+	 4624 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "system_values.event_level",
+	 (int) system_values.event_level,
+	 4 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "system_values.provider_identifier[ 0 ]",
+	 (int) system_values.provider_identifier[ 0 ],
+	 0x7f );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "system_values.channel_name_size",
+	 (int) system_values.channel_name_size,
+	 16 );
+
+	/* Test with a template cache, where the second read uses the cached template
+	 */
+	memory_set(
+	 &template_cache,
+	 0,
+	 sizeof( libevtx_system_values_template_cache_t ) );
+
+	for( read_index = 0;
+	     read_index < 2;
+	     read_index++ )
+	{
+		result = libevtx_system_values_read_data(
+		          &system_values,
+		          &template_cache,
+		          NULL,
+		          evtx_test_system_values_data1,
+		          493,
+		          0,
+		          493,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "system_values.flags",
+		 (int) system_values.flags,
+		 0x0f );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT32(
+		 "system_values.event_identifier",
+		 system_values.event_identifier,
+		 4624 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "system_values.channel_name_size",
+		 (int) system_values.channel_name_size,
+		 16 );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT32(
+		 "template_cache.templates[ 4 ].template_definition_offset",
+		 template_cache.templates[ 4 ].template_definition_offset,
+		 38 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "template_cache.templates[ 4 ].is_supported",
+		 (int) template_cache.templates[ 4 ].is_supported,
+		 1 );
+	}
+	/* Test with binary XML data that is not supported
+	 */
+	result = libevtx_system_values_read_data(
+	          &system_values,
+	          NULL,
+	          NULL,
+	          evtx_test_system_values_data2,
+	          64,
+	          0,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_system_values_read_data(
+	          NULL,
+	          NULL,
+	          NULL,
+	          evtx_test_system_values_data1,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_system_values_read_data(
+	          &system_values,
+	          NULL,
+	          NULL,
+	          NULL,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_system_values_read_data(
+	          &system_values,
+	          NULL,
+	          NULL,
+	          evtx_test_system_values_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_system_values_read_data(
+	          &system_values,
+	          NULL,
+	          NULL,
+	          evtx_test_system_values_data1,
+	          493,
+	          0,
+	          494,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_system_values_compare_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_system_values_compare_name(
+     void )
+{
+	uint8_t name_data[ 12 ] = {
+		'S', 0, 'y', 0, 's', 0, 't', 0, 'e', 0, 'm', 0 };
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_system_values_compare_name(
+	          name_data,
+	          12,
+	          "System",
+	          6 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_system_values_compare_name(
+	          name_data,
+	          12,
+	          "Sys",
+	          3 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_system_values_compare_name(
+	          name_data,
+	          12,
+	          "system",
+	          6 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_system_values_compare_name(
+	          NULL,
+	          12,
+	          "System",
+	          6 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_system_values_copy_decimal_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_system_values_copy_decimal_string(
+     void )
+{
+	uint8_t string_data1[ 10 ] = {
+		'4', 0, '6', 0, '2', 0, '4', 0, 0, 0 };
+
+	uint8_t string_data2[ 4 ] = {
+		'4', 0, 'x', 0 };
+
+	uint8_t string_data3[ 22 ] = {
+		'4', 0, '2', 0, '9', 0, '4', 0, '9', 0, '6', 0, '7', 0, '2', 0, '9', 0, '6', 0, 0, 0 };
+
+	uint32_t value_32bit = 0;
+	int result           = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_system_values_copy_decimal_string(
+	          string_data1,
+	          10,
+	          &value_32bit );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 4624 );
+
+	result = libevtx_system_values_copy_decimal_string(
+	          string_data2,
+	          4,
+	          &value_32bit );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a value that exceeds maximum
+	 */
+	result = libevtx_system_values_copy_decimal_string(
+	          string_data3,
+	          22,
+	          &value_32bit );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_system_values_copy_decimal_string(
+	          NULL,
+	          10,
+	          &value_32bit );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_system_values_copy_decimal_string(
+	          string_data1,
+	          10,
+	          NULL );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_system_values_copy_provider_identifier_to_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_system_values_copy_provider_identifier_to_string(
+     void )
+{
+	uint8_t provider_identifier[ 16 ] = {
+		0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d };
+
+	uint8_t string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	libevtx_system_values_t system_values;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &system_values,
+	     0,
+	     sizeof( libevtx_system_values_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test without a provider identifier
+	 */
+	result = libevtx_system_values_copy_provider_identifier_to_string(
+	          &system_values,
+	          string,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( memory_copy(
+	     system_values.provider_identifier,
+	     provider_identifier,
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	system_values.flags = LIBEVTX_SYSTEM_VALUES_FLAG_HAS_PROVIDER_IDENTIFIER;
+
+	result = libevtx_system_values_copy_provider_identifier_to_string(
+	          &system_values,
+	          string,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "{54849625-5478-4994-A5BA-3E3B0328C30D}",
+	          LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_system_values_copy_provider_identifier_to_string(
+	          NULL,
+	          string,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_system_values_copy_provider_identifier_to_string(
+	          &system_values,
+	          NULL,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_system_values_copy_provider_identifier_to_string(
+	          &system_values,
+	          string,
+	          LIBEVTX_SYSTEM_VALUES_PROVIDER_IDENTIFIER_STRING_SIZE - 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_system_values_read_data",
+	 evtx_test_system_values_read_data );
+
+	/* TODO: add tests for libevtx_system_values_read_template_definition */
+
+	/* TODO: add tests for libevtx_system_values_read_element */
+
+	/* TODO: add tests for libevtx_system_values_read_name */
+
+	/* TODO: add tests for libevtx_system_values_read_value */
+
+	/* TODO: add tests for libevtx_system_values_read_substitution_values */
+
+	EVTX_TEST_RUN(
+	 "libevtx_system_values_compare_name",
+	 evtx_test_system_values_compare_name );
+
+	EVTX_TEST_RUN(
+	 "libevtx_system_values_copy_decimal_string",
+	 evtx_test_system_values_copy_decimal_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_system_values_copy_provider_identifier_to_string",
+	 evtx_test_system_values_copy_provider_identifier_to_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,476 @@
+/*
+ * Library template_cache functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_template_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+uint8_t evtx_test_template_cache_identifier1[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+/* Tests the libevtx_template_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_template_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_template_cache_t *template_cache = NULL;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_template_cache_initialize(
+	          &template_cache,
+	          100,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "template_cache->number_of_entries",
+	 template_cache->number_of_entries,
+	 128 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_cache",
+	 template_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_template_cache_initialize(
+	          NULL,
+	          100,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_template_cache_initialize(
+	          &template_cache,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_cache != NULL )
+	{
+		libevtx_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_template_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_template_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_template_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_template_cache_get_values and libevtx_template_cache_set_values functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_template_cache_get_and_set_values(
+     void )
+{
+	libevtx_template_cache_value_t cached_values[ 2 ];
+	libevtx_template_cache_value_t values[ 2 ];
+
+	libcerror_error_t *error                 = NULL;
+	libevtx_template_cache_t *template_cache = NULL;
+	uint8_t is_supported                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_template_cache_initialize(
+	          &template_cache,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	values[ 0 ].substitution_index = -1;
+	values[ 0 ].string_data_offset = 48;
+	values[ 0 ].string_data_size   = 12;
+	values[ 1 ].substitution_index = 3;
+	values[ 1 ].string_data_offset = 0;
+	values[ 1 ].string_data_size   = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_template_cache_get_values(
+	          template_cache,
+	          evtx_test_template_cache_identifier1,
+	          256,
+	          0x0123456789abcdefULL,
+	          cached_values,
+	          2,
+	          &is_supported,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_template_cache_set_values(
+	          template_cache,
+	          evtx_test_template_cache_identifier1,
+	          256,
+	          0x0123456789abcdefULL,
+	          values,
+	          2,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_template_cache_get_values(
+	          template_cache,
+	          evtx_test_template_cache_identifier1,
+	          256,
+	          0x0123456789abcdefULL,
+	          cached_values,
+	          2,
+	          &is_supported,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "is_supported",
+	 is_supported,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "cached_values[ 0 ].substitution_index",
+	 cached_values[ 0 ].substitution_index,
+	 -1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "(int) cached_values[ 0 ].string_data_offset",
+	 (int) cached_values[ 0 ].string_data_offset,
+	 48 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "(int) cached_values[ 0 ].string_data_size",
+	 (int) cached_values[ 0 ].string_data_size,
+	 12 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "cached_values[ 1 ].substitution_index",
+	 cached_values[ 1 ].substitution_index,
+	 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a template with the same hash but a different data size
+	 */
+	result = libevtx_template_cache_get_values(
+	          template_cache,
+	          evtx_test_template_cache_identifier1,
+	          512,
+	          0x0123456789abcdefULL,
+	          cached_values,
+	          2,
+	          &is_supported,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_template_cache_get_values(
+	          NULL,
+	          evtx_test_template_cache_identifier1,
+	          256,
+	          0x0123456789abcdefULL,
+	          cached_values,
+	          2,
+	          &is_supported,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_template_cache_get_values(
+	          template_cache,
+	          evtx_test_template_cache_identifier1,
+	          256,
+	          0x0123456789abcdefULL,
+	          cached_values,
+	          LIBEVTX_TEMPLATE_CACHE_MAXIMUM_NUMBER_OF_VALUES + 1,
+	          &is_supported,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_template_cache_set_values(
+	          NULL,
+	          evtx_test_template_cache_identifier1,
+	          256,
+	          0x0123456789abcdefULL,
+	          values,
+	          2,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_cache",
+	 template_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_cache != NULL )
+	{
+		libevtx_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_template_cache_initialize",
+	 evtx_test_template_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_template_cache_free",
+	 evtx_test_template_cache_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_template_cache_get_and_set_values",
+	 evtx_test_template_cache_get_and_set_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -266,6 +266,151 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_template_definition_set_resource_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_template_definition_set_resource_data(
+     void )
+{
+	uint8_t resource_data[ 64 ];
+
+	libcerror_error_t *error                           = NULL;
+	libevtx_template_definition_t *template_definition = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_template_definition_initialize(
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition",
+	 template_definition );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_template_definition_set_resource_data(
+	          NULL,
+	          resource_data,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_template_definition_set_resource_data(
+	          template_definition,
+	          NULL,
+	          64,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_template_definition_set_resource_data(
+	          template_definition,
+	          resource_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_template_definition_set_resource_data(
+	          template_definition,
+	          resource_data,
+	          64,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_template_definition_free(
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition",
+	 template_definition );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_definition != NULL )
+	{
+		libevtx_template_definition_free(
+		 &template_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +436,10 @@ int main(
 
 	/* TODO: add tests for libevtx_template_definition_set_data */
 
+	EVTX_TEST_RUN(
+	 "libevtx_template_definition_set_resource_data",
+	 evtx_test_template_definition_set_resource_data );
+
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
 	/* TODO: add tests for libevtx_template_definition_read */
@@ -0,0 +1,472 @@
+/*
+ * Library UTF-16 stream functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_utf16_stream.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_utf16_stream_is_ascii function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_utf16_stream_is_ascii(
+     void )
+{
+	uint8_t utf16_stream[ 128 ];
+
+	size_t stream_offset = 0;
+	int result           = 0;
+
+	/* Initialize test
+	 */
+	for( stream_offset = 0;
+	     stream_offset < 128;
+	     stream_offset += 2 )
+	{
+		utf16_stream[ stream_offset ]     = (uint8_t) ( 'a' + ( ( stream_offset / 2 ) % 26 ) );
+		utf16_stream[ stream_offset + 1 ] = 0;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_utf16_stream_is_ascii(
+	          utf16_stream,
+	          128 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a non-ASCII character at every offset
+	 * to cover the vector and code unit-wise code paths
+	 */
+	for( stream_offset = 0;
+	     stream_offset < 128;
+	     stream_offset += 2 )
+	{
+		utf16_stream[ stream_offset + 1 ] = 0x01;
+
+		result = libevtx_utf16_stream_is_ascii(
+		          utf16_stream,
+		          128 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		utf16_stream[ stream_offset + 1 ] = 0x00;
+
+		utf16_stream[ stream_offset ] |= 0x80;
+
+		result = libevtx_utf16_stream_is_ascii(
+		          utf16_stream,
+		          128 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		utf16_stream[ stream_offset ] &= 0x7f;
+	}
+	/* Test that an end of string character is not considered ASCII
+	 */
+	utf16_stream[ 126 ] = 0;
+
+	result = libevtx_utf16_stream_is_ascii(
+	          utf16_stream,
+	          128 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_utf16_stream_is_ascii(
+	          utf16_stream,
+	          126 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_utf16_stream_is_ascii(
+	          NULL,
+	          128 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_utf16_stream_is_ascii(
+	          utf16_stream,
+	          0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_utf16_stream_is_ascii(
+	          utf16_stream,
+	          5 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_utf16_stream_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_utf16_stream_get_utf8_string_size(
+     void )
+{
+	uint8_t utf16_stream[ 8 ] = {
+		'T', 0x00, 'e', 0x00, 0xe9, 0x00, 's', 0x00 };
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_utf16_stream_get_utf8_string_size(
+	          utf16_stream,
+	          4,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a non-ASCII character
+	 */
+	result = libevtx_utf16_stream_get_utf8_string_size(
+	          utf16_stream,
+	          8,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_utf16_stream_get_utf8_string_size(
+	          utf16_stream,
+	          8,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_utf16_stream_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_utf16_stream_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf16_stream[ 160 ];
+	uint8_t utf8_string[ 96 ];
+
+	uint8_t expected_utf8_string[ 6 ] = {
+		'T', 'e', 0xc3, 0xa9, 's', 0 };
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	size_t number_of_units   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( string_index = 0;
+	     string_index < 80;
+	     string_index++ )
+	{
+		utf16_stream[ string_index * 2 ]         = (uint8_t) ( 'A' + ( string_index % 26 ) );
+		utf16_stream[ ( string_index * 2 ) + 1 ] = 0;
+	}
+	/* Test regular cases with different lengths
+	 * to cover the vector and code unit-wise code paths
+	 */
+	for( number_of_units = 1;
+	     number_of_units <= 80;
+	     number_of_units++ )
+	{
+		result = libevtx_utf16_stream_copy_to_utf8_string(
+		          utf16_stream,
+		          number_of_units * 2,
+		          utf8_string,
+		          96,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( string_index = 0;
+		     string_index < number_of_units;
+		     string_index++ )
+		{
+			EVTX_TEST_ASSERT_EQUAL_UINT8(
+			 "utf8_string[ string_index ]",
+			 utf8_string[ string_index ],
+			 utf16_stream[ string_index * 2 ] );
+		}
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "utf8_string[ number_of_units ]",
+		 utf8_string[ number_of_units ],
+		 0 );
+	}
+	/* Test a non-ASCII character
+	 */
+	utf16_stream[ 4 ] = 0xe9;
+	utf16_stream[ 6 ] = 's';
+
+	result = libevtx_utf16_stream_copy_to_utf8_string(
+	          utf16_stream,
+	          8,
+	          utf8_string,
+	          96,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream[ 0 ] = 'T';
+	utf16_stream[ 2 ] = 'e';
+
+	result = libevtx_utf16_stream_copy_to_utf8_string(
+	          utf16_stream,
+	          8,
+	          utf8_string,
+	          96,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          6 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_utf16_stream_copy_to_utf8_string(
+	          utf16_stream,
+	          8,
+	          NULL,
+	          96,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf16_stream_copy_to_utf8_string(
+	          utf16_stream,
+	          8,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an UTF-8 string that is too small for the ASCII string
+	 */
+	result = libevtx_utf16_stream_copy_to_utf8_string(
+	          &( utf16_stream[ 8 ] ),
+	          32,
+	          utf8_string,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_utf16_stream_is_ascii",
+	 evtx_test_utf16_stream_is_ascii );
+
+	EVTX_TEST_RUN(
+	 "libevtx_utf16_stream_get_utf8_string_size",
+	 evtx_test_utf16_stream_get_utf8_string_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_utf16_stream_copy_to_utf8_string",
+	 evtx_test_utf16_stream_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
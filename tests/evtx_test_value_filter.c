@@ -0,0 +1,373 @@
+/*
+ * Library value_filter functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_value_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_value_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_filter_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_value_filter_t *value_filter = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_value_filter_initialize(
+	          &value_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "value_filter",
+	 value_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_value_filter_free(
+	          &value_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "value_filter",
+	 value_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_value_filter_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_filter != NULL )
+	{
+		libevtx_value_filter_free(
+		 &value_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_value_filter_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_filter_insert_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_filter_insert_string(
+     void )
+{
+	libevtx_match_value_t match_value;
+
+	libcerror_error_t *error             = NULL;
+	libevtx_value_filter_t *value_filter = NULL;
+	int result                           = 0;
+
+	match_value.characters           = NULL;
+	match_value.number_of_characters = 0;
+	match_value.hash                 = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_value_filter_initialize(
+	          &value_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "value_filter",
+	 value_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_value_filter_insert_string(
+	          value_filter,
+	          (uint8_t *) "C:\\Windows\\Temp\\evil.exe",
+	          24,
+	          LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a token of the value matches case insensitive
+	 */
+	result = libevtx_match_value_set_utf8_string(
+	          &match_value,
+	          (uint8_t *) "EVIL.EXE",
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_value_filter_may_contain_match_value(
+	          value_filter,
+	          &match_value );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevtx_match_value_match_string(
+	          &match_value,
+	          (uint8_t *) "C:\\Windows\\Temp\\evil.exe",
+	          24,
+	          LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that a part of a token does not match
+	 */
+	result = libevtx_match_value_match_string(
+	          &match_value,
+	          (uint8_t *) "C:\\Windows\\Temp\\notevil.exe",
+	          27,
+	          LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 match_value.characters );
+
+	match_value.characters = NULL;
+
+	/* Test error cases
+	 */
+	result = libevtx_value_filter_insert_string(
+	          NULL,
+	          (uint8_t *) "evil.exe",
+	          8,
+	          LIBEVTX_VALUE_FILTER_STRING_TYPE_UTF8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_value_filter_free(
+	          &value_filter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "value_filter",
+	 value_filter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( match_value.characters != NULL )
+	{
+		memory_free(
+		 match_value.characters );
+	}
+	if( value_filter != NULL )
+	{
+		libevtx_value_filter_free(
+		 &value_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_filter_initialize",
+	 evtx_test_value_filter_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_filter_free",
+	 evtx_test_value_filter_free );
+
+	/* TODO: add tests for libevtx_value_filter_get_character */
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_filter_insert_string",
+	 evtx_test_value_filter_insert_string );
+
+	/* TODO: add tests for libevtx_match_value_match_string */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
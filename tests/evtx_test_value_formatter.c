@@ -0,0 +1,1271 @@
+/*
+ * Library value_formatter functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_value_formatter.h"
+
+uint8_t evtx_test_value_formatter_guid_data1[ 16 ] = {
+	0x7f, 0x3a, 0x5b, 0x55, 0x9c, 0x8c, 0x4d, 0x43, 0x8c, 0x3b, 0xd2, 0x48, 0x2f, 0x55, 0xb1, 0x0a };
+
+uint8_t evtx_test_value_formatter_sid_data1[ 16 ] = {
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00 };
+
+uint8_t evtx_test_value_formatter_systemtime_data1[ 16 ] = {
+	0xe0, 0x07, 0x03, 0x00, 0x05, 0x00, 0x12, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x98, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_value_formatter_copy_integer_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_formatter_copy_integer_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_integer_to_utf8_string(
+	          0,
+	          0,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 1 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0",
+	          1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_integer_to_utf8_string(
+	          (uint64_t) 4624,
+	          0,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 4 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "4624",
+	          4 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_integer_to_utf8_string(
+	          (uint64_t) -42,
+	          1,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 3 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "-42",
+	          3 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_integer_to_utf8_string(
+	          (uint64_t) 0xffffffffffffffffULL,
+	          0,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "18446744073709551615",
+	          20 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_integer_to_utf8_string(
+	          (uint64_t) 0x8000000000000000ULL,
+	          1,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "-9223372036854775808",
+	          20 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_integer_to_utf8_string(
+	          (uint64_t) 4624,
+	          0,
+	          NULL,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_integer_to_utf8_string(
+	          (uint64_t) 4624,
+	          0,
+	          utf8_string,
+	          3,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_formatter_copy_hexadecimal_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_formatter_copy_hexadecimal_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+	          (uint64_t) 0x3e7,
+	          8,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 10 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0x000003e7",
+	          10 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+	          (uint64_t) 0x8000000000000000ULL,
+	          16,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 18 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0x8000000000000000",
+	          18 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+	          (uint64_t) 0x3e7,
+	          8,
+	          NULL,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+	          (uint64_t) 0x3e7,
+	          17,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_hexadecimal_to_utf8_string(
+	          (uint64_t) 0x3e7,
+	          8,
+	          utf8_string,
+	          9,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_formatter_copy_boolean_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_formatter_copy_boolean_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_boolean_to_utf8_string(
+	          1,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 4 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "true",
+	          4 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_boolean_to_utf8_string(
+	          0,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "false",
+	          5 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_boolean_to_utf8_string(
+	          1,
+	          NULL,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_boolean_to_utf8_string(
+	          0,
+	          utf8_string,
+	          4,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_formatter_copy_guid_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_formatter_copy_guid_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_guid_to_utf8_string(
+	          evtx_test_value_formatter_guid_data1,
+	          16,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 38 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "{555B3A7F-8C9C-434D-8C3B-D2482F55B10A}",
+	          38 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_guid_to_utf8_string(
+	          NULL,
+	          16,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_guid_to_utf8_string(
+	          evtx_test_value_formatter_guid_data1,
+	          15,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_guid_to_utf8_string(
+	          evtx_test_value_formatter_guid_data1,
+	          16,
+	          utf8_string,
+	          37,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_formatter_copy_sid_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_formatter_copy_sid_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_sid_to_utf8_string(
+	          evtx_test_value_formatter_sid_data1,
+	          16,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 12 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "S-1-5-32-544",
+	          12 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_sid_to_utf8_string(
+	          evtx_test_value_formatter_sid_data1,
+	          12,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_sid_to_utf8_string(
+	          NULL,
+	          16,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_sid_to_utf8_string(
+	          evtx_test_value_formatter_sid_data1,
+	          16,
+	          utf8_string,
+	          11,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_formatter_copy_filetime_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_formatter_copy_filetime_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          (uint64_t) 131027479501529458ULL,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 30 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "2016-03-18T04:12:30.152945800Z",
+	          30 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          0,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 30 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "1601-01-01T00:00:00.000000000Z",
+	          30 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the last FILETIME with a 4 digit year
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          (uint64_t) 2650467743999999999ULL,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 30 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "9999-12-31T23:59:59.999999900Z",
+	          30 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test FILETIME values with a year above 9999
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          (uint64_t) 2650467744000000000ULL,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          (uint64_t) 0x7fffffffffffffffULL,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          (uint64_t) 0xffffffffffffffffULL,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          (uint64_t) 131027479501529458ULL,
+	          NULL,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_filetime_to_utf8_string(
+	          (uint64_t) 131027479501529458ULL,
+	          utf8_string,
+	          29,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_value_formatter_copy_systemtime_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_value_formatter_copy_systemtime_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_systemtime_to_utf8_string(
+	          evtx_test_value_formatter_systemtime_data1,
+	          16,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 24 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "2016-03-18T04:12:30.152Z",
+	          24 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_systemtime_to_utf8_string(
+	          evtx_test_value_formatter_systemtime_data1,
+	          15,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_systemtime_to_utf8_string(
+	          NULL,
+	          16,
+	          utf8_string,
+	          256,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	result = libevtx_value_formatter_copy_systemtime_to_utf8_string(
+	          evtx_test_value_formatter_systemtime_data1,
+	          16,
+	          utf8_string,
+	          23,
+	          &utf8_string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	/* TODO: add tests for libevtx_value_formatter_copy_fixed_width_decimal */
+
+	/* TODO: add tests for libevtx_value_formatter_check_utf8_string */
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_formatter_copy_integer_to_utf8_string",
+	 evtx_test_value_formatter_copy_integer_to_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_formatter_copy_hexadecimal_to_utf8_string",
+	 evtx_test_value_formatter_copy_hexadecimal_to_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_formatter_copy_boolean_to_utf8_string",
+	 evtx_test_value_formatter_copy_boolean_to_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_formatter_copy_guid_to_utf8_string",
+	 evtx_test_value_formatter_copy_guid_to_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_formatter_copy_sid_to_utf8_string",
+	 evtx_test_value_formatter_copy_sid_to_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_formatter_copy_filetime_to_utf8_string",
+	 evtx_test_value_formatter_copy_filetime_to_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_value_formatter_copy_systemtime_to_utf8_string",
+	 evtx_test_value_formatter_copy_systemtime_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,631 @@
+/*
+ * Library xml_transcoder functions test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_xml_transcoder.h"
+
+uint8_t evtx_test_xml_transcoder_data1[ 493 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x34, 0x12,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x0f, 0x01,
+	0x01, 0x00, 0x01, 0xff, 0xff, 0x78, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00,
+	0x00, 0x02, 0x01, 0xff, 0xff, 0x0b, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d,
+	0x00, 0x00, 0x00, 0x02, 0x41, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x69,
+	0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x46, 0xb2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x05, 0x01, 0x04, 0x00, 0x54, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00,
+	0x06, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x47, 0x00, 0x75,
+	0x00, 0x69, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0f, 0x03, 0x01, 0xff, 0xff, 0x22,
+	0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x45,
+	0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x49, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02,
+	0x0d, 0x01, 0x00, 0x06, 0x04, 0x01, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x02, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x32, 0x00, 0x00,
+	0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x43, 0x00, 0x68,
+	0x00, 0x61, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01,
+	0x08, 0x00, 0x53, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00,
+	0x79, 0x00, 0x04, 0x04, 0x01, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74,
+	0x00, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x01, 0xff, 0xff, 0x1c,
+	0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x44,
+	0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x03, 0x00, 0x01, 0x04, 0x04,
+	0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x02, 0x00, 0x06, 0x00, 0x01, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3a, 0x5b, 0x55, 0x9c, 0x8c, 0x4d, 0x43, 0x8c, 0x3b,
+	0xd2, 0x48, 0x2f, 0x55, 0xb1, 0x0a, 0x10, 0x12, 0x04, 0xed, 0x01, 0x00, 0x00 };
+
+uint8_t evtx_test_xml_transcoder_data2[ 64 ] = {
+	0x2a, 0x2a, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00 };
+
+char *evtx_test_xml_transcoder_expected_string1 = \
+	"<Event>\n" \
+	"  <System>\n" \
+	"    <Provider Name=\"Test\" Guid=\"{555B3A7F-8C9C-434D-8C3B-D2482F55B10A}\"/>\n" \
+	"    <EventID>4624</EventID>\n" \
+	"    <Level>4</Level>\n" \
+	"    <Channel>Security</Channel>\n" \
+	"  </System>\n" \
+	"  <EventData>\n" \
+	"    <Data/>\n" \
+	"  </EventData>\n" \
+	"</Event>\n";
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_xml_transcoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_xml_transcoder_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_xml_transcoder_t *xml_transcoder = NULL;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_xml_transcoder_initialize(
+	          &xml_transcoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_transcoder",
+	 xml_transcoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_xml_transcoder_free(
+	          &xml_transcoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "xml_transcoder",
+	 xml_transcoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_xml_transcoder_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_transcoder != NULL )
+	{
+		libevtx_xml_transcoder_free(
+		 &xml_transcoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_xml_transcoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_xml_transcoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_xml_transcoder_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_xml_transcoder_transcode_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_xml_transcoder_transcode_record(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_xml_transcoder_t *xml_transcoder = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_xml_transcoder_initialize(
+	          &xml_transcoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_transcoder",
+	 xml_transcoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_xml_transcoder_transcode_record(
+	          xml_transcoder,
+	          evtx_test_xml_transcoder_data1,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_transcoder->string_size",
+	 xml_transcoder->string_size,
+	 (size_t) 237 );
+
+	result = memory_compare(
+	          xml_transcoder->string,
+	          evtx_test_xml_transcoder_expected_string1,
+	          237 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with binary XML data that is not supported
+	 */
+	result = libevtx_xml_transcoder_transcode_record(
+	          xml_transcoder,
+	          evtx_test_xml_transcoder_data2,
+	          64,
+	          0,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_xml_transcoder_transcode_record(
+	          NULL,
+	          evtx_test_xml_transcoder_data1,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_xml_transcoder_transcode_record(
+	          xml_transcoder,
+	          NULL,
+	          493,
+	          0,
+	          493,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_xml_transcoder_transcode_record(
+	          xml_transcoder,
+	          evtx_test_xml_transcoder_data1,
+	          493,
+	          0,
+	          494,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_xml_transcoder_free(
+	          &xml_transcoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "xml_transcoder",
+	 xml_transcoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_transcoder != NULL )
+	{
+		libevtx_xml_transcoder_free(
+		 &xml_transcoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_xml_transcoder_append_integer, libevtx_xml_transcoder_append_hexadecimal
+ * and libevtx_xml_transcoder_append_filetime functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_xml_transcoder_append_formatted(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_xml_transcoder_t *xml_transcoder = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_xml_transcoder_initialize(
+	          &xml_transcoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_transcoder",
+	 xml_transcoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_xml_transcoder_append_integer(
+	          xml_transcoder,
+	          (uint64_t) -42,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_xml_transcoder_append_hexadecimal(
+	          xml_transcoder,
+	          0x3e7,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_xml_transcoder_append_filetime(
+	          xml_transcoder,
+	          (uint64_t) 131027479501529458ULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_transcoder->string_size",
+	 xml_transcoder->string_size,
+	 (size_t) 51 );
+
+	result = memory_compare(
+	          xml_transcoder->string,
+	          "-420x00000000000003e72016-03-18T04:12:30.152945800Z",
+	          51 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a FILETIME with a year above 9999
+	 */
+	result = libevtx_xml_transcoder_append_filetime(
+	          xml_transcoder,
+	          (uint64_t) 2650467744000000000ULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_transcoder->string_size",
+	 xml_transcoder->string_size,
+	 (size_t) 51 );
+
+	/* Test error cases
+	 */
+	result = libevtx_xml_transcoder_append_hexadecimal(
+	          xml_transcoder,
+	          0x3e7,
+	          17,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_xml_transcoder_append_integer(
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_xml_transcoder_free(
+	          &xml_transcoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "xml_transcoder",
+	 xml_transcoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_transcoder != NULL )
+	{
+		libevtx_xml_transcoder_free(
+		 &xml_transcoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_xml_transcoder_initialize",
+	 evtx_test_xml_transcoder_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_xml_transcoder_free",
+	 evtx_test_xml_transcoder_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_xml_transcoder_transcode_record",
+	 evtx_test_xml_transcoder_transcode_record );
+
+	/* TODO: add tests for libevtx_xml_transcoder_read_fragment */
+
+	/* TODO: add tests for libevtx_xml_transcoder_read_template_instance */
+
+	/* TODO: add tests for libevtx_xml_transcoder_read_element */
+
+	/* TODO: add tests for libevtx_xml_transcoder_read_value */
+
+	/* TODO: add tests for libevtx_xml_transcoder_append_utf16_stream */
+
+	EVTX_TEST_RUN(
+	 "libevtx_xml_transcoder_append_formatted",
+	 evtx_test_xml_transcoder_append_formatted );
+
+	/* TODO: add tests for libevtx_xml_transcoder_append_value */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,427 @@
+#!/usr/bin/env python
+#
+# Python-bindings benchmark script
+#
+# Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+
+from __future__ import print_function
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+import pyevtx
+
+
+if hasattr(time, "perf_counter"):
+  get_time = time.perf_counter
+else:
+  get_time = time.time
+
+
+# The record properties of which the access is measured.
+RECORD_PROPERTIES = [
+    "offset", "identifier", "written_time", "event_identifier",
+    "event_identifier_qualifiers", "event_level", "provider_identifier",
+    "source_name", "computer_name", "user_security_identifier",
+    "number_of_strings", "strings", "data", "xml_string"]
+
+# The names of the benchmarks of evtx_bench that correspond to those of this
+# script, used to determine the binding overhead.
+C_BENCHMARKS = {
+    "records iteration": "record iteration",
+    "xml_string": "XML rendering"}
+
+
+class BenchmarkResult(object):
+  """Benchmark result."""
+
+  def __init__(self, name):
+    """Initializes a benchmark result.
+
+    Args:
+      name (str): name of the benchmark.
+    """
+    super(BenchmarkResult, self).__init__()
+    self.name = name
+    self.number_of_samples = 0
+    self.total_size = 0
+    self.total_time = 0.0
+
+  def AddSamples(self, number_of_samples, elapsed_time, size=0):
+    """Adds samples.
+
+    Args:
+      number_of_samples (int): number of samples, such as records.
+      elapsed_time (float): elapsed time of the samples in seconds.
+      size (Optional[int]): number of bytes produced by the samples.
+    """
+    self.number_of_samples += number_of_samples
+    self.total_size += size
+    self.total_time += elapsed_time
+
+  def GetSamplesPerSecond(self):
+    """Retrieves the number of samples per second.
+
+    Returns:
+      float: number of samples per second or None if not available.
+    """
+    if not self.number_of_samples or self.total_time <= 0.0:
+      return None
+    return float(self.number_of_samples) / self.total_time
+
+  def GetMiBPerSecond(self):
+    """Retrieves the throughput in MiB per second.
+
+    Returns:
+      float: MiB per second or None if not available.
+    """
+    if not self.total_size or self.total_time <= 0.0:
+      return None
+    return (float(self.total_size) / (1024.0 * 1024.0)) / self.total_time
+
+
+def BenchmarkOpen(source, number_of_repetitions):
+  """Measures opening and closing a file.
+
+  Args:
+    source (str): path of the source file.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    BenchmarkResult: result.
+  """
+  result = BenchmarkResult("open")
+
+  for _ in range(number_of_repetitions):
+    start_time = get_time()
+
+    evtx_file = pyevtx.file()
+    evtx_file.open(source)
+    evtx_file.close()
+
+    result.AddSamples(1, get_time() - start_time)
+
+  return result
+
+
+def BenchmarkRecordsIteration(evtx_file, number_of_repetitions):
+  """Measures iterating the records and retrieving their identifiers.
+
+  Args:
+    evtx_file (pyevtx.file): file.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    BenchmarkResult: result.
+  """
+  result = BenchmarkResult("records iteration")
+
+  for _ in range(number_of_repetitions):
+    number_of_records = 0
+    start_time = get_time()
+
+    for record in evtx_file.records:
+      _ = record.identifier
+      number_of_records += 1
+
+    result.AddSamples(number_of_records, get_time() - start_time)
+
+  return result
+
+
+def BenchmarkIterRecords(evtx_file, number_of_repetitions):
+  """Measures iterating the records in batches and retrieving their identifiers.
+
+  Args:
+    evtx_file (pyevtx.file): file.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    BenchmarkResult: result.
+  """
+  result = BenchmarkResult("iter_records")
+
+  for _ in range(number_of_repetitions):
+    number_of_records = 0
+    start_time = get_time()
+
+    for record in evtx_file.iter_records():
+      _ = record.identifier
+      number_of_records += 1
+
+    result.AddSamples(number_of_records, get_time() - start_time)
+
+  return result
+
+
+def BenchmarkRecordProperty(evtx_file, property_name, number_of_repetitions):
+  """Measures accessing a record property.
+
+  Only the time of the property access is measured, not that of retrieving
+  the records.
+
+  Args:
+    evtx_file (pyevtx.file): file.
+    property_name (str): name of the record property.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    BenchmarkResult: result.
+  """
+  result = BenchmarkResult(property_name)
+
+  records = list(evtx_file.records)
+
+  for _ in range(number_of_repetitions):
+    total_size = 0
+    start_time = get_time()
+
+    for record in records:
+      value = getattr(record, property_name)
+      if property_name == "xml_string" and value:
+        total_size += len(value)
+
+    result.AddSamples(len(records), get_time() - start_time, size=total_size)
+
+  return result
+
+
+def BenchmarkIterDicts(evtx_file, number_of_repetitions):
+  """Measures retrieving the field values of the records as dictionaries.
+
+  Args:
+    evtx_file (pyevtx.file): file.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    BenchmarkResult: result.
+  """
+  result = BenchmarkResult("iter_dicts")
+
+  for _ in range(number_of_repetitions):
+    number_of_records = 0
+    start_time = get_time()
+
+    for _ in evtx_file.iter_dicts():
+      number_of_records += 1
+
+    result.AddSamples(number_of_records, get_time() - start_time)
+
+  return result
+
+
+def BenchmarkToColumns(evtx_file, number_of_repetitions):
+  """Measures retrieving the field values of the records as columns.
+
+  Args:
+    evtx_file (pyevtx.file): file.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    BenchmarkResult: result.
+  """
+  result = BenchmarkResult("to_columns")
+
+  number_of_records = evtx_file.get_number_of_records()
+
+  for _ in range(number_of_repetitions):
+    start_time = get_time()
+
+    evtx_file.to_columns()
+
+    result.AddSamples(number_of_records, get_time() - start_time)
+
+  return result
+
+
+def BenchmarkWrittenTimes(evtx_file, number_of_repetitions):
+  """Measures retrieving the written times of the records.
+
+  Args:
+    evtx_file (pyevtx.file): file.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    BenchmarkResult: result.
+  """
+  result = BenchmarkResult("written_times")
+
+  number_of_records = evtx_file.get_number_of_records()
+
+  for _ in range(number_of_repetitions):
+    start_time = get_time()
+
+    evtx_file.written_times()
+
+    result.AddSamples(number_of_records, get_time() - start_time)
+
+  return result
+
+
+def RunCBenchmark(c_benchmark, source, number_of_repetitions):
+  """Runs the C-level benchmark on the same file.
+
+  Args:
+    c_benchmark (str): path of the evtx_bench executable.
+    source (str): path of the source file.
+    number_of_repetitions (int): number of repetitions.
+
+  Returns:
+    dict[str, dict[str, object]]: C-level results per benchmark name or None
+        if the benchmark failed.
+  """
+  results_file = "pyevtx_bench_c.json"
+
+  command = [
+      c_benchmark, "-n", "{0:d}".format(number_of_repetitions),
+      "-j", results_file, source]
+
+  with open(os.devnull, "w") as null_file:
+    exit_code = subprocess.call(command, stdout=null_file)
+
+  if exit_code != 0:
+    print("Unable to run C-level benchmark: {0:s}".format(c_benchmark))
+    return None
+
+  with open(results_file, "r") as file_object:
+    c_results = json.load(file_object)
+
+  os.remove(results_file)
+
+  return {
+      benchmark["name"]: benchmark for benchmark in c_results["benchmarks"]}
+
+
+def Main():
+  """The main program function.
+
+  Returns:
+    bool: True if successful or False if not.
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      "Measures the performance of the libevtx Python-bindings."))
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default="evtx_bench.evtx", help=(
+          "The path of the source file, the default is the synthetic file "
+          "generated by evtx_bench: evtx_bench.evtx."))
+
+  argument_parser.add_argument(
+      "--c-benchmark", dest="c_benchmark", action="store", metavar="PATH",
+      default=None, help=(
+          "The path of evtx_bench, to run the C-level benchmark on the same "
+          "file and determine the binding overhead."))
+
+  argument_parser.add_argument(
+      "--json", dest="json_file", action="store", metavar="PATH",
+      default=None, help="The path of the file to write the results in JSON.")
+
+  argument_parser.add_argument(
+      "-n", "--repetitions", dest="number_of_repetitions", action="store",
+      type=int, default=5, help=(
+          "The number of repetitions of every benchmark, the default is 5."))
+
+  options = argument_parser.parse_args()
+
+  if options.number_of_repetitions <= 0:
+    print("Unsupported number of repetitions.")
+    return False
+
+  if not os.path.isfile(options.source):
+    print("No such file: {0:s}".format(options.source))
+    return False
+
+  results = [BenchmarkOpen(options.source, options.number_of_repetitions)]
+
+  evtx_file = pyevtx.file()
+  evtx_file.open(options.source)
+
+  results.append(BenchmarkRecordsIteration(
+      evtx_file, options.number_of_repetitions))
+
+  for property_name in RECORD_PROPERTIES:
+    results.append(BenchmarkRecordProperty(
+        evtx_file, property_name, options.number_of_repetitions))
+
+  results.append(BenchmarkIterRecords(
+      evtx_file, options.number_of_repetitions))
+  results.append(BenchmarkIterDicts(
+      evtx_file, options.number_of_repetitions))
+  results.append(BenchmarkToColumns(
+      evtx_file, options.number_of_repetitions))
+  results.append(BenchmarkWrittenTimes(
+      evtx_file, options.number_of_repetitions))
+
+  evtx_file.close()
+
+  c_results = None
+  if options.c_benchmark:
+    c_results = RunCBenchmark(
+        options.c_benchmark, options.source, options.number_of_repetitions)
+
+  print("Benchmark of: {0:s} with {1:d} repetitions.".format(
+      options.source, options.number_of_repetitions))
+  print("")
+  print("{0:<28s} {1:>10s} {2:>12s} {3:>10s} {4:>12s}".format(
+      "benchmark", "samples", "samples/s", "MiB/s", "overhead"))
+
+  json_results = []
+  for result in results:
+    samples_per_second = result.GetSamplesPerSecond()
+    mib_per_second = result.GetMiBPerSecond()
+
+    # The overhead is the ratio of the C-level and Python-level throughput.
+    overhead = None
+    c_benchmark_name = C_BENCHMARKS.get(result.name, None)
+    if c_results and c_benchmark_name in c_results and samples_per_second:
+      c_samples_per_second = c_results[c_benchmark_name].get(
+          "samples_per_second", None)
+      if c_samples_per_second:
+        overhead = c_samples_per_second / samples_per_second
+
+    print("{0:<28s} {1:>10d} {2:>12s} {3:>10s} {4:>12s}".format(
+        result.name, result.number_of_samples,
+        "{0:.0f}".format(samples_per_second) if samples_per_second else "-",
+        "{0:.2f}".format(mib_per_second) if mib_per_second else "-",
+        "{0:.2f}x".format(overhead) if overhead else "-"))
+
+    json_results.append({
+        "name": result.name,
+        "samples": result.number_of_samples,
+        "samples_per_second": samples_per_second,
+        "mib_per_second": mib_per_second,
+        "overhead": overhead})
+
+  if options.json_file:
+    with open(options.json_file, "w") as file_object:
+      json.dump({
+          "repetitions": options.number_of_repetitions,
+          "benchmarks": json_results}, file_object, indent=2)
+
+  return True
+
+
+if __name__ == "__main__":
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
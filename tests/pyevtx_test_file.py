@@ -141,6 +141,195 @@ class FileTypeTests(unittest.TestCase):
       with self.assertRaises(RuntimeError):
         evtx_file.set_ascii_codepage(codepage)
 
+  def test_to_columns(self):
+    """Tests the to_columns function."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    number_of_records = evtx_file.get_number_of_records()
+
+    columns = evtx_file.to_columns(
+        fields=["identifier", "event_identifier", "computer_name"])
+    self.assertEqual(
+        sorted(columns.keys()),
+        ["computer_name", "event_identifier", "identifier"])
+
+    for values in columns.values():
+      self.assertEqual(len(values), number_of_records)
+
+    if number_of_records > 0:
+      record = evtx_file.get_record(0)
+      self.assertEqual(columns["identifier"][0], record.identifier)
+      self.assertEqual(
+          columns["event_identifier"][0], record.event_identifier)
+
+    columns = evtx_file.to_columns()
+    self.assertIn("written_time", columns)
+
+    with self.assertRaises(ValueError):
+      evtx_file.to_columns(fields=["bogus"])
+
+    evtx_file.close()
+
+  def test_written_times(self):
+    """Tests the written_times function."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    number_of_records = evtx_file.get_number_of_records()
+
+    written_times = evtx_file.written_times()
+    self.assertEqual(len(written_times), number_of_records)
+
+    if number_of_records > 0:
+      record = evtx_file.get_record(0)
+      self.assertEqual(written_times[0], record.get_written_time_as_integer())
+
+      # The datetime object is cached by the record.
+      self.assertIs(record.get_written_time(), record.get_written_time())
+
+    evtx_file.close()
+
+  def test_get_index_data(self):
+    """Tests the get_index_data function and the index argument of open."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    number_of_records = evtx_file.get_number_of_records()
+    index_data = evtx_file.get_index_data()
+    self.assertIsInstance(index_data, bytes)
+
+    evtx_file.close()
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source, index=index_data)
+
+    self.assertEqual(evtx_file.get_number_of_records(), number_of_records)
+
+    evtx_file.close()
+
+    # Index data that cannot be used falls back to reading the chunks.
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source, index=b'\x00' * 64)
+
+    self.assertEqual(evtx_file.get_number_of_records(), number_of_records)
+
+    evtx_file.close()
+
+  def test_get_chunk_information(self):
+    """Tests the get_number_of_chunks and get_chunk_information functions."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    number_of_chunks = evtx_file.get_number_of_chunks()
+
+    if number_of_chunks > 0:
+      chunk_information = evtx_file.get_chunk_information(0)
+      self.assertIsInstance(chunk_information, dict)
+      self.assertIn("offset", chunk_information)
+      self.assertIn("number_of_records", chunk_information)
+
+    with self.assertRaises(IOError):
+      evtx_file.get_chunk_information(number_of_chunks)
+
+    evtx_file.close()
+
+  def test_get_record_by_identifier(self):
+    """Tests the get_record_by_identifier function."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    number_of_records = evtx_file.get_number_of_records()
+
+    if number_of_records > 0:
+      record = evtx_file.get_record(number_of_records - 1)
+      identifier = record.identifier
+
+      record = evtx_file.get_record_by_identifier(identifier)
+      self.assertIsNotNone(record)
+      self.assertEqual(record.identifier, identifier)
+
+    record = evtx_file.get_record_by_identifier(0xffffffffffffffff)
+    self.assertIsNone(record)
+
+    evtx_file.close()
+
+  def test_iter_records(self):
+    """Tests the iter_records function."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    number_of_records = evtx_file.get_number_of_records()
+
+    identifiers = [
+        record.identifier for record in evtx_file.iter_records(batch_size=3)]
+    self.assertEqual(len(identifiers), number_of_records)
+
+    if number_of_records > 0:
+      record = evtx_file.get_record(number_of_records - 1)
+      self.assertEqual(identifiers[-1], record.identifier)
+
+    with self.assertRaises(ValueError):
+      evtx_file.iter_records(batch_size=0)
+
+    evtx_file.close()
+
+  def test_iter_dicts(self):
+    """Tests the iter_dicts function."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    number_of_records = evtx_file.get_number_of_records()
+
+    columns = evtx_file.to_columns(fields=["identifier", "computer_name"])
+
+    dictionaries = list(evtx_file.iter_dicts(
+        fields=["identifier", "computer_name"], batch_size=3))
+    self.assertEqual(len(dictionaries), number_of_records)
+
+    for record_index, dictionary in enumerate(dictionaries):
+      self.assertEqual(
+          sorted(dictionary.keys()), ["computer_name", "identifier"])
+      self.assertEqual(
+          dictionary["identifier"], columns["identifier"][record_index])
+      self.assertEqual(
+          dictionary["computer_name"], columns["computer_name"][record_index])
+
+    with self.assertRaises(ValueError):
+      evtx_file.iter_dicts(fields=["bogus"])
+
+    evtx_file.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
@@ -34,6 +34,22 @@ class SupportFunctionsTests(unittest.TestCase):
     # TODO: check version.
     # self.assertEqual(version, "00000000")
 
+  def test_open_many(self):
+    """Tests the open_many function."""
+    files = pyevtx.open_many([], threads=2)
+    self.assertEqual(files, [])
+
+    files = pyevtx.open_many(["_does_not_exist_1", "_does_not_exist_2"], threads=2)
+    self.assertEqual(len(files), 2)
+    self.assertIsInstance(files[0], IOError)
+    self.assertIsInstance(files[1], IOError)
+
+    with self.assertRaises(TypeError):
+      pyevtx.open_many([None])
+
+    with self.assertRaises(ValueError):
+      pyevtx.open_many([], threads=0)
+
 
 if __name__ == "__main__":
   unittest.main(verbosity=2)
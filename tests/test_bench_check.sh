@@ -0,0 +1,182 @@
+#!/bin/bash
+# Benchmark regression testing script
+#
+# Runs evtx_bench on the synthetic file and compares the results against
+# the baseline in evtx_bench_baseline.json. Use --update to replace the
+# baseline with the results of the current system.
+#
+# Version: 20181111
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+# The tolerances in percent, throughput may decrease and the number of
+# allocations and the peak resident set size may increase by this much.
+THROUGHPUT_TOLERANCE=${EVTX_BENCH_THROUGHPUT_TOLERANCE:-15};
+ALLOCATIONS_TOLERANCE=${EVTX_BENCH_ALLOCATIONS_TOLERANCE:-5};
+MEMORY_TOLERANCE=${EVTX_BENCH_MEMORY_TOLERANCE:-20};
+
+# The synthetic file is generated with fixed options so that the results
+# of different runs are comparable.
+BENCH_OPTIONS="-c 64 -n 5 -r 10 -s 1 -t 16";
+
+BASELINE_FILE="${srcdir:-.}/evtx_bench_baseline.json";
+RESULTS_FILE="evtx_bench.json";
+
+UPDATE_BASELINE=0;
+
+if test "$1" = "--update";
+then
+	UPDATE_BASELINE=1;
+fi
+
+if ! test -z ${SKIP_BENCH_CHECK};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_EXECUTABLE="./evtx_bench";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="./evtx_bench.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+${TEST_EXECUTABLE} ${BENCH_OPTIONS} -j ${RESULTS_FILE};
+RESULT=$?;
+
+if test ${RESULT} -ne ${EXIT_SUCCESS};
+then
+	echo "Running: ${TEST_EXECUTABLE} failed";
+
+	exit ${EXIT_FAILURE};
+fi
+
+if test ${UPDATE_BASELINE} -ne 0;
+then
+	cp ${RESULTS_FILE} ${BASELINE_FILE};
+
+	echo "Updated baseline: ${BASELINE_FILE}";
+
+	exit ${EXIT_SUCCESS};
+fi
+
+if ! test -f "${BASELINE_FILE}";
+then
+	echo "Missing baseline: ${BASELINE_FILE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+echo "";
+echo "Comparing against baseline: ${BASELINE_FILE}";
+
+# Values that are null in either the baseline or the results are not compared.
+awk \
+ -v throughput_tolerance=${THROUGHPUT_TOLERANCE} \
+ -v allocations_tolerance=${ALLOCATIONS_TOLERANCE} \
+ -v memory_tolerance=${MEMORY_TOLERANCE} '
+function get_value(line, key)
+{
+	if( match( line, "\"" key "\": [^,}]*" ) == 0 )
+	{
+		return "null";
+	}
+	value = substr( line, RSTART + length( key ) + 4, RLENGTH - length( key ) - 4 );
+	gsub( /"/, "", value );
+	gsub( /^ +| +$/, "", value );
+
+	return value;
+}
+
+function check_minimum(name, key, baseline, result)
+{
+	if( baseline == "null" || result == "null" )
+	{
+		return;
+	}
+	if( result + 0 < ( baseline * ( 100 - throughput_tolerance ) ) / 100 )
+	{
+		printf( "FAIL: %s %s: %s is more than %s%% below the baseline: %s\n", name, key, result, throughput_tolerance, baseline );
+		number_of_failures++;
+	}
+	else if( result + 0 > ( baseline * ( 100 + throughput_tolerance ) ) / 100 )
+	{
+		printf( "NOTE: %s %s: %s is more than %s%% above the baseline: %s, consider updating the baseline\n", name, key, result, throughput_tolerance, baseline );
+	}
+}
+
+function check_maximum(name, key, baseline, result, tolerance)
+{
+	if( baseline == "null" || result == "null" )
+	{
+		return;
+	}
+	if( result + 0 > ( baseline * ( 100 + tolerance ) ) / 100 )
+	{
+		printf( "FAIL: %s %s: %s is more than %s%% above the baseline: %s\n", name, key, result, tolerance, baseline );
+		number_of_failures++;
+	}
+}
+
+FNR == NR {
+	if( $0 ~ /"peak_rss_kib"/ )
+	{
+		baseline_peak_rss = get_value( $0, "peak_rss_kib" );
+	}
+	else if( $0 ~ /"name"/ )
+	{
+		name = get_value( $0, "name" );
+
+		baseline_samples_per_second[ name ]     = get_value( $0, "samples_per_second" );
+		baseline_mib_per_second[ name ]         = get_value( $0, "mib_per_second" );
+		baseline_allocations_per_sample[ name ] = get_value( $0, "allocations_per_sample" );
+	}
+	next;
+}
+
+{
+	if( $0 ~ /"peak_rss_kib"/ )
+	{
+		check_maximum( "process", "peak_rss_kib", baseline_peak_rss, get_value( $0, "peak_rss_kib" ), memory_tolerance );
+	}
+	else if( $0 ~ /"name"/ )
+	{
+		name = get_value( $0, "name" );
+
+		if( !( name in baseline_samples_per_second ) )
+		{
+			printf( "NOTE: %s: not in the baseline\n", name );
+			next;
+		}
+		check_minimum( name, "samples_per_second", baseline_samples_per_second[ name ], get_value( $0, "samples_per_second" ) );
+		check_minimum( name, "mib_per_second", baseline_mib_per_second[ name ], get_value( $0, "mib_per_second" ) );
+		check_maximum( name, "allocations_per_sample", baseline_allocations_per_sample[ name ], get_value( $0, "allocations_per_sample" ), allocations_tolerance );
+	}
+}
+
+END {
+	if( number_of_failures > 0 )
+	{
+		printf( "%d performance regression(s) detected.\n", number_of_failures );
+		exit 1;
+	}
+	printf( "No performance regressions detected.\n" );
+}' ${BASELINE_FILE} ${RESULTS_FILE};
+RESULT=$?;
+
+if test ${RESULT} -ne ${EXIT_SUCCESS};
+then
+	exit ${EXIT_FAILURE};
+fi
+
+exit ${EXIT_SUCCESS};
+
@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "chunk chunks_table error io_handle notify record record_values template_definition"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "arena arena_pool async_reader async_request buffer_pool byte_stream cache carver checksum chunk chunk_batch chunk_descriptor chunk_information chunk_prefetcher chunks_table codepage_table collection decode_budget decode_profile document_cache element_name error event_data_values identifier_gaps identifier_index index_file indexed_chunks io_handle memory_usage message_resolver notify query_index range_scheduler read_buffer record_decoder record_filter record_values recovered_records_filter signature string_table system_fields system_values template_cache template_definition utf16_stream value_filter value_formatter xml_transcoder"
+$LibraryTestsWithInput = "file record support"
 
 $InputGlob = "*"
 
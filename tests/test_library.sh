@@ -7,8 +7,14 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="chunk chunks_table error io_handle notify record record_values template_definition";
-LIBRARY_TESTS_WITH_INPUT="file support";
+LIBRARY_TESTS="arena arena_pool async_reader async_request buffer_pool byte_stream cache carver checksum chunk chunk_batch chunk_builder chunk_descriptor chunk_information chunk_prefetcher chunks_table codepage_table collection decode_budget decode_profile decoded_values_file document_cache element_name error event_data_values filter_expression identifier_gaps identifier_index index_file indexed_chunks io_handle memory_usage message_resolver notify query_index range_scheduler read_buffer record_decoder record_filter record_values recovered_records_filter search_prefilter signature string_table system_fields system_values template_cache template_definition utf16_stream value_filter value_formatter xml_transcoder";
+LIBRARY_TESTS_WITH_INPUT="file record support";
+
+# The C++ interface test is only built if a C++17 compiler is available.
+if test -x "./evtx_test_cpp" || test -x "./evtx_test_cpp.exe";
+then
+	LIBRARY_TESTS_WITH_INPUT="${LIBRARY_TESTS_WITH_INPUT} cpp";
+fi
 OPTION_SETS="";
 
 INPUT_GLOB="*";